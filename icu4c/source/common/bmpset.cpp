@@ -17,17 +17,31 @@
 */
 
 #include "unicode/utypes.h"
+#include "unicode/ucptrie.h"
+#include "unicode/umutablecptrie.h"
 #include "unicode/uniset.h"
 #include "unicode/utf8.h"
 #include "unicode/utf16.h"
 #include "cmemory.h"
 #include "bmpset.h"
 #include "uassert.h"
+#include "ustr_imp.h"
 
 U_NAMESPACE_BEGIN
 
+/*
+ * A set gets a trie for containsSlow() once it has been used for
+ * BMPSET_TRIE_LONG_SPANS spans of at least BMPSET_TRIE_MIN_SPAN_LENGTH
+ * code units, if its inversion list has at least
+ * BMPSET_TRIE_MIN_LIST_LENGTH entries above U+07FF.
+ */
+#define BMPSET_TRIE_MIN_LIST_LENGTH 64
+#define BMPSET_TRIE_MIN_SPAN_LENGTH 1024
+#define BMPSET_TRIE_LONG_SPANS 256
+
 BMPSet::BMPSet(const int32_t *parentList, int32_t parentListLength) :
-        list(parentList), listLength(parentListLength) {
+        list(parentList), listLength(parentListLength),
+        longSpanCount(0), trieReady(0), trie(NULL) {
     uprv_memset(latin1Contains, 0, sizeof(latin1Contains));
     uprv_memset(table7FF, 0, sizeof(table7FF));
     uprv_memset(bmpBlockBits, 0, sizeof(bmpBlockBits));
@@ -53,14 +67,70 @@ BMPSet::BMPSet(const int32_t *parentList, int32_t parentListLength) :
 
 BMPSet::BMPSet(const BMPSet &otherBMPSet, const int32_t *newParentList, int32_t newParentListLength) :
         containsFFFD(otherBMPSet.containsFFFD),
-        list(newParentList), listLength(newParentListLength) {
+        asciiValue(otherBMPSet.asciiValue), latin1Value(otherBMPSet.latin1Value),
+        list(newParentList), listLength(newParentListLength),
+        longSpanCount(0), trieReady(0), trie(NULL) {
     uprv_memcpy(latin1Contains, otherBMPSet.latin1Contains, sizeof(latin1Contains));
     uprv_memcpy(table7FF, otherBMPSet.table7FF, sizeof(table7FF));
     uprv_memcpy(bmpBlockBits, otherBMPSet.bmpBlockBits, sizeof(bmpBlockBits));
     uprv_memcpy(list4kStarts, otherBMPSet.list4kStarts, sizeof(list4kStarts));
 }
 
+BMPSet::BMPSet(const int32_t *parentList, int32_t parentListLength,
+               const uint16_t *serialized, UErrorCode &errorCode) :
+        list(parentList), listLength(parentListLength),
+        longSpanCount(0), trieReady(0), trie(NULL) {
+    // See serialize() for the layout.
+    int32_t i;
+    for(i=0; i<0x100; i+=2) {
+        uint16_t pair=*serialized++;
+        latin1Contains[i]=(UBool)(pair>>8);
+        latin1Contains[i+1]=(UBool)(pair&0xff);
+    }
+    uint16_t flags=*serialized++;
+    containsFFFD=(UBool)(flags>>14);
+    asciiValue=(int8_t)(((flags>>7)&0x7f)-1);
+    latin1Value=(int8_t)((flags&0x7f)-1);
+    for(i=0; i<64; ++i, serialized+=2) {
+        table7FF[i]=((uint32_t)serialized[0]<<16)|serialized[1];
+    }
+    for(i=0; i<64; ++i, serialized+=2) {
+        bmpBlockBits[i]=((uint32_t)serialized[0]<<16)|serialized[1];
+    }
+    for(i=0; i<18; ++i, serialized+=2) {
+        list4kStarts[i]=(int32_t)(((uint32_t)serialized[0]<<16)|serialized[1]);
+        // The binary searches rely on these indexes into the list.
+        if(list4kStarts[i]<0 || listLength<=list4kStarts[i] ||
+                (i>0 && list4kStarts[i]<list4kStarts[i-1])) {
+            errorCode=U_INVALID_FORMAT_ERROR;
+        }
+    }
+}
+
 BMPSet::~BMPSet() {
+    ucptrie_close(trie);
+}
+
+void BMPSet::serialize(uint16_t *dest) const {
+    // latin1Contains[] two per unit, one unit of flags,
+    // then table7FF[], bmpBlockBits[] and list4kStarts[] with the high half first.
+    int32_t i;
+    for(i=0; i<0x100; i+=2) {
+        *dest++=(uint16_t)((latin1Contains[i]<<8)|latin1Contains[i+1]);
+    }
+    *dest++=(uint16_t)((containsFFFD<<14)|((asciiValue+1)<<7)|(latin1Value+1));
+    for(i=0; i<64; ++i) {
+        *dest++=(uint16_t)(table7FF[i]>>16);
+        *dest++=(uint16_t)table7FF[i];
+    }
+    for(i=0; i<64; ++i) {
+        *dest++=(uint16_t)(bmpBlockBits[i]>>16);
+        *dest++=(uint16_t)bmpBlockBits[i];
+    }
+    for(i=0; i<18; ++i) {
+        *dest++=(uint16_t)(list4kStarts[i]>>16);
+        *dest++=(uint16_t)list4kStarts[i];
+    }
 }
 
 /*
@@ -138,6 +208,13 @@ void BMPSet::initBits() {
         } while(start<limit && start<0x100);
     } while(limit<=0x100);
 
+    // All of U+0000..U+007F (U+00FF) are in the set if the first range covers them,
+    // and none of them are if the first range starts after them.
+    start=list[0];
+    limit= listLength>1 ? list[1] : 0x110000;
+    asciiValue= start>=0x80 ? 0 : (start==0 && limit>=0x80) ? 1 : -1;
+    latin1Value= start>=0x100 ? 0 : (start==0 && limit>=0x100) ? 1 : -1;
+
     // Find the first range overlapping with (or after) 80..FF again,
     // to include them in table7FF as well.
     for(listIndex=0;;) {
@@ -315,6 +392,105 @@ BMPSet::contains(UChar32 c) const {
     }
 }
 
+/*
+ * If all of the ASCII (Latin-1) characters have the same value contains(c),
+ * then test 64-bit words of bytes (code units) for being in that range,
+ * four words at a time while possible.
+ * Otherwise look up four at a time, combining their values without branches.
+ * This uses portable 64-bit masks rather than per-platform SIMD code;
+ * the word is copied rather than read through a cast pointer, for alignment.
+ */
+inline const uint8_t *
+BMPSet::spanASCII(const uint8_t *s, const uint8_t *limit, USetSpanCondition spanCondition) const {
+    UBool contained= spanCondition!=USET_SPAN_NOT_CONTAINED;
+    if(asciiValue==contained) {
+        while((limit-s)>=32) {
+            uint64_t words[4];
+            uprv_memcpy(words, s, 32);
+            if(!ASCIIWords::isAscii(words[0]|words[1]|words[2]|words[3])) {
+                break;
+            }
+            s+=32;
+        }
+        while((limit-s)>=8 && ASCIIWords::isAscii8(s)) {
+            s+=8;
+        }
+    } else if(contained) {
+        while((limit-s)>=4 && (s[0]|s[1]|s[2]|s[3])<0x80 &&
+                (latin1Contains[s[0]]&latin1Contains[s[1]]&latin1Contains[s[2]]&latin1Contains[s[3]])) {
+            s+=4;
+        }
+    } else {
+        while((limit-s)>=4 && (s[0]|s[1]|s[2]|s[3])<0x80 &&
+                !(latin1Contains[s[0]]|latin1Contains[s[1]]|latin1Contains[s[2]]|latin1Contains[s[3]])) {
+            s+=4;
+        }
+    }
+    return s;
+}
+
+inline const UChar *
+BMPSet::spanLatin1(const UChar *s, const UChar *limit, USetSpanCondition spanCondition) const {
+    UBool contained= spanCondition!=USET_SPAN_NOT_CONTAINED;
+    if(latin1Value==contained) {
+        while((limit-s)>=16) {
+            uint64_t words[4];
+            uprv_memcpy(words, s, 32);
+            if((words[0]|words[1]|words[2]|words[3])&UINT64_C(0xff00ff00ff00ff00)) {
+                break;
+            }
+            s+=16;
+        }
+        while((limit-s)>=4) {
+            uint64_t word;
+            uprv_memcpy(&word, s, 8);
+            if(word&UINT64_C(0xff00ff00ff00ff00)) {
+                break;
+            }
+            s+=4;
+        }
+    } else if(contained) {
+        while((limit-s)>=4 && (s[0]|s[1]|s[2]|s[3])<=0xff &&
+                (latin1Contains[s[0]]&latin1Contains[s[1]]&latin1Contains[s[2]]&latin1Contains[s[3]])) {
+            s+=4;
+        }
+    } else {
+        while((limit-s)>=4 && (s[0]|s[1]|s[2]|s[3])<=0xff &&
+                !(latin1Contains[s[0]]|latin1Contains[s[1]]|latin1Contains[s[2]]|latin1Contains[s[3]])) {
+            s+=4;
+        }
+    }
+    return s;
+}
+
+/*
+ * Count a long span, and build the trie when there have been enough of them.
+ * Only the thread whose count reaches BMPSET_TRIE_LONG_SPANS builds the trie.
+ * Other threads keep using binary searches until trieReady is set.
+ * If building the trie fails, then it is not tried again.
+ */
+void BMPSet::noteLongSpan() const {
+    if((list4kStarts[0x11]-list4kStarts[0])<BMPSET_TRIE_MIN_LIST_LENGTH ||
+            umtx_loadAcquire(longSpanCount)>=BMPSET_TRIE_LONG_SPANS ||
+            umtx_atomic_inc(&longSpanCount)!=BMPSET_TRIE_LONG_SPANS) {
+        return;
+    }
+    UErrorCode errorCode=U_ZERO_ERROR;
+    UMutableCPTrie *mutableTrie=umutablecptrie_open(0, 0, &errorCode);
+    // The list is pairs of range starts and limits, ending with list[listLength-1]=0x110000.
+    for(int32_t i=0; (i+1)<listLength; i+=2) {
+        umutablecptrie_setRange(mutableTrie, list[i], list[i+1]-1, 1, &errorCode);
+    }
+    UCPTrie *newTrie=umutablecptrie_buildImmutable(mutableTrie, UCPTRIE_TYPE_FAST, UCPTRIE_VALUE_BITS_8, &errorCode);
+    umutablecptrie_close(mutableTrie);
+    if(U_SUCCESS(errorCode)) {
+        trie=newTrie;
+        umtx_storeRelease(trieReady, 1);
+    } else {
+        ucptrie_close(newTrie);
+    }
+}
+
 /*
  * Check for sufficient length for trail unit for each surrogate pair.
  * Handle single surrogates as surrogate code points as usual in ICU.
@@ -322,6 +498,9 @@ BMPSet::contains(UChar32 c) const {
 const UChar *
 BMPSet::span(const UChar *s, const UChar *limit, USetSpanCondition spanCondition) const {
     UChar c, c2;
+    if((limit-s)>=BMPSET_TRIE_MIN_SPAN_LENGTH) {
+        noteLongSpan();
+    }
 
     if(spanCondition) {
         // span
@@ -331,6 +510,8 @@ BMPSet::span(const UChar *s, const UChar *limit, USetSpanCondition spanCondition
                 if(!latin1Contains[c]) {
                     break;
                 }
+                // Skip the rest of a Latin-1 run; s stays on its last known unit.
+                s=spanLatin1(s+1, limit, spanCondition)-1;
             } else if(c<=0x7ff) {
                 if((table7FF[c&0x3f]&((uint32_t)1<<(c>>6)))==0) {
                     break;
@@ -371,6 +552,8 @@ BMPSet::span(const UChar *s, const UChar *limit, USetSpanCondition spanCondition
                 if(latin1Contains[c]) {
                     break;
                 }
+                // Skip the rest of a Latin-1 run; s stays on its last known unit.
+                s=spanLatin1(s+1, limit, spanCondition)-1;
             } else if(c<=0x7ff) {
                 if((table7FF[c&0x3f]&((uint32_t)1<<(c>>6)))!=0) {
                     break;
@@ -411,6 +594,9 @@ BMPSet::span(const UChar *s, const UChar *limit, USetSpanCondition spanCondition
 const UChar *
 BMPSet::spanBack(const UChar *s, const UChar *limit, USetSpanCondition spanCondition) const {
     UChar c, c2;
+    if((limit-s)>=BMPSET_TRIE_MIN_SPAN_LENGTH) {
+        noteLongSpan();
+    }
 
     if(spanCondition) {
         // span
@@ -512,23 +698,31 @@ BMPSet::spanUTF8(const uint8_t *s, int32_t length, USetSpanCondition spanConditi
     uint8_t b=*s;
     if(U8_IS_SINGLE(b)) {
         // Initial all-ASCII span.
+        s=spanASCII(s, limit, spanCondition);
+        if(s==limit) {
+            return s;
+        }
+        b=*s;
         if(spanCondition) {
-            do {
+            while(U8_IS_SINGLE(b)) {
                 if(!latin1Contains[b] || ++s==limit) {
                     return s;
                 }
                 b=*s;
-            } while(U8_IS_SINGLE(b));
+            }
         } else {
-            do {
+            while(U8_IS_SINGLE(b)) {
                 if(latin1Contains[b] || ++s==limit) {
                     return s;
                 }
                 b=*s;
-            } while(U8_IS_SINGLE(b));
+            }
         }
         length=(int32_t)(limit-s);
     }
+    if(length>=BMPSET_TRIE_MIN_SPAN_LENGTH) {
+        noteLongSpan();
+    }
 
     if(spanCondition!=USET_SPAN_NOT_CONTAINED) {
         spanCondition=USET_SPAN_CONTAINED;  // Pin to 0/1 values.
@@ -577,25 +771,38 @@ BMPSet::spanUTF8(const uint8_t *s, int32_t length, USetSpanCondition spanConditi
     while(s<limit) {
         b=*s;
         if(U8_IS_SINGLE(b)) {
-            // ASCII
+            // ASCII: Check one byte, and skip ahead if the run continues after it.
+            if(latin1Contains[b]!=spanCondition) {
+                return s;
+            } else if(++s==limit) {
+                return limit0;
+            }
+            b=*s;
+            if(U8_IS_SINGLE(b)) {
+                s=spanASCII(s, limit, spanCondition);
+                if(s==limit) {
+                    return limit0;
+                }
+                b=*s;
+            }
             if(spanCondition) {
-                do {
+                while(U8_IS_SINGLE(b)) {
                     if(!latin1Contains[b]) {
                         return s;
                     } else if(++s==limit) {
                         return limit0;
                     }
                     b=*s;
-                } while(U8_IS_SINGLE(b));
+                }
             } else {
-                do {
+                while(U8_IS_SINGLE(b)) {
                     if(latin1Contains[b]) {
                         return s;
                     } else if(++s==limit) {
                         return limit0;
                     }
                     b=*s;
-                } while(U8_IS_SINGLE(b));
+                }
             }
         }
         ++s;  // Advance past the lead byte.
@@ -673,6 +880,9 @@ BMPSet::spanUTF8(const uint8_t *s, int32_t length, USetSpanCondition spanConditi
  */
 int32_t
 BMPSet::spanBackUTF8(const uint8_t *s, int32_t length, USetSpanCondition spanCondition) const {
+    if(length>=BMPSET_TRIE_MIN_SPAN_LENGTH) {
+        noteLongSpan();
+    }
     if(spanCondition!=USET_SPAN_NOT_CONTAINED) {
         spanCondition=USET_SPAN_CONTAINED;  // Pin to 0/1 values.
     }
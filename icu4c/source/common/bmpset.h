@@ -20,7 +20,9 @@
 #define __BMPSET_H__
 
 #include "unicode/utypes.h"
+#include "unicode/ucptrie.h"
 #include "unicode/uniset.h"
+#include "umutex.h"
 
 U_NAMESPACE_BEGIN
 
@@ -39,8 +41,21 @@ class BMPSet : public UMemory {
 public:
     BMPSet(const int32_t *parentList, int32_t parentListLength);
     BMPSet(const BMPSet &otherBMPSet, const int32_t *newParentList, int32_t newParentListLength);
+    /*
+     * Restores the tables written by serialize() for the same parent list.
+     * The serialized data must have SERIALIZED_LENGTH units;
+     * sets U_INVALID_FORMAT_ERROR if it does not fit the list.
+     */
+    BMPSet(const int32_t *parentList, int32_t parentListLength,
+           const uint16_t *serialized, UErrorCode &errorCode);
     virtual ~BMPSet();
 
+    /* Number of 16-bit units written by serialize(). */
+    static const int32_t SERIALIZED_LENGTH = 0x80 + 1 + 4 * 64 + 2 * 18;
+
+    /* Writes the lookup tables, SERIALIZED_LENGTH units. */
+    void serialize(uint16_t *dest) const;
+
     virtual UBool contains(UChar32 c) const;
 
     /*
@@ -74,6 +89,18 @@ class BMPSet : public UMemory {
 private:
     void initBits();
     void overrideIllegal();
+    void noteLongSpan() const;
+
+    /*
+     * Skip a run of ASCII bytes b (Latin-1 code units c) with
+     * spanCondition==contains(b), several at a time.
+     * The run may continue after the returned pointer,
+     * for fewer than a whole group of bytes (code units).
+     */
+    inline const uint8_t *spanASCII(const uint8_t *s, const uint8_t *limit,
+                                    USetSpanCondition spanCondition) const;
+    inline const UChar *spanLatin1(const UChar *s, const UChar *limit,
+                                   USetSpanCondition spanCondition) const;
 
     /**
      * Same as UnicodeSet::findCodePoint(UChar32 c) const except that the
@@ -104,6 +131,14 @@ class BMPSet : public UMemory {
     /* TRUE if contains(U+FFFD). */
     UBool containsFFFD;
 
+    /*
+     * The value of latin1Contains[] if it is the same
+     * for all of U+0000..U+007F (asciiValue) or U+0000..U+00FF (latin1Value),
+     * otherwise -1.
+     * Runs of such characters are spanned a whole word at a time.
+     */
+    int8_t asciiValue, latin1Value;
+
     /*
      * One bit per code point from U+0000..U+07FF.
      * The bits are organized vertically; consecutive code points
@@ -153,9 +188,24 @@ class BMPSet : public UMemory {
      */
     const int32_t *list;
     int32_t listLength;
+
+    /*
+     * Sets with many ranges above U+07FF that are used for many long spans
+     * get a trie with value 1 for each code point in the set.
+     * Building the trie takes much longer than freezing the set,
+     * so it is not done until the set has been used enough to pay for it.
+     * Once trieReady is set, containsSlow() looks up code points in the trie
+     * rather than doing a binary search over the inversion list.
+     */
+    mutable u_atomic_int32_t longSpanCount;
+    mutable u_atomic_int32_t trieReady;
+    mutable UCPTrie *trie;
 };
 
 inline UBool BMPSet::containsSlow(UChar32 c, int32_t lo, int32_t hi) const {
+    if(umtx_loadAcquire(trieReady)) {
+        return (UBool)UCPTRIE_FAST_GET(trie, UCPTRIE_8, c);
+    }
     return (UBool)(findCodePoint(c, lo, hi) & 1);
 }
 
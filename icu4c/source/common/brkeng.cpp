@@ -59,27 +59,29 @@ LanguageBreakFactory::~LanguageBreakFactory() {
  ******************************************************************
  */
 
-UnhandledEngine::UnhandledEngine(UErrorCode &status) : fHandled(nullptr) {
+UnhandledEngine::UnhandledEngine(UErrorCode &status) {
     (void)status;
+    uprv_memset(fHandled, 0, sizeof(fHandled));
 }
 
 UnhandledEngine::~UnhandledEngine() {
-    delete fHandled;
-    fHandled = nullptr;
 }
 
 UBool
 UnhandledEngine::handles(UChar32 c) const {
-    return fHandled && fHandled->contains(c);
+    int32_t script = u_getIntPropertyValue(c, UCHAR_SCRIPT);
+    return 0 <= script && script < USCRIPT_CODE_LIMIT &&
+        (fHandled[script >> 5] & ((uint32_t)1 << (script & 0x1f))) != 0;
 }
 
 int32_t
 UnhandledEngine::findBreaks( UText *text,
                              int32_t /* startPos */,
                              int32_t endPos,
-                             UVector32 &/*foundBreaks*/ ) const {
+                             UVector32 &/*foundBreaks*/,
+                             DictionaryBreakBuffers * /* buffers */ ) const {
     UChar32 c = utext_current32(text); 
-    while((int32_t)utext_getNativeIndex(text) < endPos && fHandled->contains(c)) {
+    while((int32_t)utext_getNativeIndex(text) < endPos && handles(c)) {
         utext_next32(text);            // TODO:  recast loop to work with post-increment operations.
         c = utext_current32(text);
     }
@@ -88,17 +90,10 @@ UnhandledEngine::findBreaks( UText *text,
 
 void
 UnhandledEngine::handleCharacter(UChar32 c) {
-    if (fHandled == nullptr) {
-        fHandled = new UnicodeSet();
-        if (fHandled == nullptr) {
-            return;
-        }
-    }
-    if (!fHandled->contains(c)) {
-        UErrorCode status = U_ZERO_ERROR;
-        // Apply the entire script of the character.
-        int32_t script = u_getIntPropertyValue(c, UCHAR_SCRIPT);
-        fHandled->applyIntPropertyValue(UCHAR_SCRIPT, script, status);
+    // Handle the entire script of the character.
+    int32_t script = u_getIntPropertyValue(c, UCHAR_SCRIPT);
+    if (0 <= script && script < USCRIPT_CODE_LIMIT) {
+        fHandled[script >> 5] |= (uint32_t)1 << (script & 0x1f);
     }
 }
 
@@ -108,6 +103,10 @@ UnhandledEngine::handleCharacter(UChar32 c) {
 
 ICULanguageBreakFactory::ICULanguageBreakFactory(UErrorCode &/*status*/) {
     fEngines = 0;
+    for (int32_t i = 0; i < USCRIPT_CODE_LIMIT; ++i) {
+        fScriptEngines[i].store(NULL, std::memory_order_relaxed);
+        fNoEngineForScript[i] = FALSE;
+    }
 }
 
 ICULanguageBreakFactory::~ICULanguageBreakFactory() {
@@ -129,6 +128,19 @@ ICULanguageBreakFactory::getEngineFor(UChar32 c) {
     const LanguageBreakEngine *lbe = NULL;
     UErrorCode  status = U_ZERO_ERROR;
 
+    // Fast path without locking: the engine last found for the script of c.
+    UScriptCode code = uscript_getScript(c, &status);
+    if (U_FAILURE(status) || code < 0 || code >= USCRIPT_CODE_LIMIT) {
+        code = USCRIPT_INVALID_CODE;
+        status = U_ZERO_ERROR;
+    } else {
+        lbe = fScriptEngines[code].load(std::memory_order_acquire);
+        if (lbe != NULL && lbe->handles(c)) {
+            return lbe;
+        }
+        lbe = NULL;
+    }
+
     static UMutex gBreakEngineMutex;
     Mutex m(&gBreakEngineMutex);
 
@@ -145,15 +157,26 @@ ICULanguageBreakFactory::getEngineFor(UChar32 c) {
         while (--i >= 0) {
             lbe = (const LanguageBreakEngine *)(fEngines->elementAt(i));
             if (lbe != NULL && lbe->handles(c)) {
+                if (code != USCRIPT_INVALID_CODE) {
+                    fScriptEngines[code].store(lbe, std::memory_order_release);
+                }
                 return lbe;
             }
         }
     }
     
-    // We didn't find an engine. Create one.
+    // We didn't find an engine. Create one, unless that already failed for this script.
+    if (code != USCRIPT_INVALID_CODE && fNoEngineForScript[code]) {
+        return NULL;
+    }
     lbe = loadEngineFor(c);
     if (lbe != NULL) {
         fEngines->push((void *)lbe, status);
+        if (U_SUCCESS(status) && code != USCRIPT_INVALID_CODE) {
+            fScriptEngines[code].store(lbe, std::memory_order_release);
+        }
+    } else if (code != USCRIPT_INVALID_CODE) {
+        fNoEngineForScript[code] = TRUE;
     }
     return lbe;
 }
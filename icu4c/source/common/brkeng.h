@@ -15,12 +15,15 @@
 #include "unicode/utext.h"
 #include "unicode/uscript.h"
 
+#include <atomic>
+
 U_NAMESPACE_BEGIN
 
 class UnicodeSet;
 class UStack;
 class UVector32;
 class DictionaryMatcher;
+class DictionaryBreakBuffers;
 
 /*******************************************************************
  * LanguageBreakEngine
@@ -68,12 +71,15 @@ class LanguageBreakEngine : public UMemory {
   * @param startPos The start of the run within the supplied text.
   * @param endPos The end of the run within the supplied text.
   * @param foundBreaks A Vector of int32_t to receive the breaks.
+  * @param buffers Working storage that the engine may reuse from call to call.
+  * Owned by the caller, typically one per break iterator; may be NULL.
   * @return The number of breaks found.
   */
   virtual int32_t findBreaks( UText *text,
                               int32_t startPos,
                               int32_t endPos,
-                              UVector32 &foundBreaks ) const = 0;
+                              UVector32 &foundBreaks,
+                              DictionaryBreakBuffers *buffers ) const = 0;
 
 };
 
@@ -147,11 +153,12 @@ class UnhandledEngine : public LanguageBreakEngine {
  private:
 
     /**
-     * The sets of characters handled.
+     * The scripts handled, one bit per UScriptCode. Testing the script of a
+     * character is much cheaper than building the set of all its characters.
      * @internal
      */
 
-  UnicodeSet    *fHandled;
+  uint32_t      fHandled[(USCRIPT_CODE_LIMIT + 31) / 32];
 
  public:
 
@@ -185,12 +192,14 @@ class UnhandledEngine : public LanguageBreakEngine {
   * @param startPos The start of the run within the supplied text.
   * @param endPos The end of the run within the supplied text.
   * @param foundBreaks An allocated C array of the breaks found, if any
+  * @param buffers Working storage that the engine may reuse; unused.
   * @return The number of breaks found.
   */
   virtual int32_t findBreaks( UText *text,
                               int32_t startPos,
                               int32_t endPos,
-                              UVector32 &foundBreaks ) const;
+                              UVector32 &foundBreaks,
+                              DictionaryBreakBuffers *buffers ) const;
 
  /**
   * <p>Tell the engine to handle a particular character and break type.</p>
@@ -220,6 +229,21 @@ class ICULanguageBreakFactory : public LanguageBreakFactory {
 
   UStack    *fEngines;
 
+    /**
+     * For each script, an engine from fEngines found for a character of that
+     * script, for lookup without locking. Engines are never removed, so an
+     * engine read from here stays valid as long as the factory.
+     * @internal
+     */
+  std::atomic<const LanguageBreakEngine *> fScriptEngines[USCRIPT_CODE_LIMIT];
+
+    /**
+     * Scripts for which loadEngineFor() failed, so that it is not tried again.
+     * Guarded by the factory mutex.
+     * @internal
+     */
+  UBool     fNoEngineForScript[USCRIPT_CODE_LIMIT];
+
  public:
 
   /**
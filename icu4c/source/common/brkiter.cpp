@@ -39,6 +39,7 @@
 #include "uassert.h"
 #include "ubrkimpl.h"
 #include "charstr.h"
+#include "utracimp.h"
 
 // *****************************************************************************
 // class BreakIterator
@@ -371,7 +372,7 @@ BreakIterator::createInstance(const Locale& loc, int32_t kind, UErrorCode& statu
     }
 
 #if !UCONFIG_NO_SERVICE
-    if (hasService()) {
+    if (hasService() && !gService->isDefault()) {
         Locale actualLoc("");
         BreakIterator *result = (BreakIterator*)gService->get(loc, kind, &actualLoc, status);
         // TODO: The way the service code works in ICU 2.8 is that if
@@ -407,6 +408,8 @@ BreakIterator::makeInstance(const Locale& loc, int32_t kind, UErrorCode& status)
     if (U_FAILURE(status)) {
         return NULL;
     }
+    UTRACE_ENTRY_OC(UTRACE_UBRK_OPEN);
+    UTRACE_DATA2(UTRACE_OPEN_CLOSE, "kind %d locale %s", kind, loc.getName());
     char lbType[kKeyValueLenMax];
 
     BreakIterator *result = NULL;
@@ -455,9 +458,11 @@ BreakIterator::makeInstance(const Locale& loc, int32_t kind, UErrorCode& status)
     }
 
     if (U_FAILURE(status)) {
+        UTRACE_EXIT_STATUS(status);
         return NULL;
     }
 
+    UTRACE_EXIT_STATUS(status);
     return result;
 }
 
@@ -98,8 +98,10 @@ BytesTrie::branchNext(const uint8_t *pos, int32_t length, int32_t inByte) {
     // Drop down to linear search for the last few bytes.
     // length>=2 because the loop body above sees length>kMaxBranchLinearSubNodeLength>=3
     // and divides length by 2.
+    // The bytes are in ascending order, so we can stop as soon as we pass inByte.
     do {
-        if(inByte==*pos++) {
+        int32_t unit=*pos++;
+        if(inByte==unit) {
             UStringTrieResult result;
             int32_t node=*pos;
             U_ASSERT(node>=kMinValueLead);
@@ -133,6 +135,9 @@ BytesTrie::branchNext(const uint8_t *pos, int32_t length, int32_t inByte) {
             }
             pos_=pos;
             return result;
+        } else if(inByte<unit) {
+            stop();
+            return USTRINGTRIE_NO_MATCH;
         }
         --length;
         pos=skipValue(pos);
@@ -229,22 +229,30 @@ BytesTrieBuilder::buildBytes(UStringTrieBuildOption buildOption, UErrorCode &err
             errorCode=U_INDEX_OUTOFBOUNDS_ERROR;
             return;
         }
-        uprv_sortArray(elements, elementsLength, (int32_t)sizeof(BytesTrieElement),
-                      compareElementStrings, strings,
-                      FALSE,  // need not be a stable sort
-                      &errorCode);
-        if(U_FAILURE(errorCode)) {
-            return;
+        // Elements that were added in strictly ascending order
+        // need not be sorted nor checked for duplicates.
+        int32_t i=1;
+        while(i<elementsLength && elements[i-1].compareStringTo(elements[i], *strings)<0) {
+            ++i;
         }
-        // Duplicate strings are not allowed.
-        StringPiece prev=elements[0].getString(*strings);
-        for(int32_t i=1; i<elementsLength; ++i) {
-            StringPiece current=elements[i].getString(*strings);
-            if(prev==current) {
-                errorCode=U_ILLEGAL_ARGUMENT_ERROR;
+        if(i<elementsLength) {
+            uprv_sortArray(elements, elementsLength, (int32_t)sizeof(BytesTrieElement),
+                          compareElementStrings, strings,
+                          FALSE,  // need not be a stable sort
+                          &errorCode);
+            if(U_FAILURE(errorCode)) {
                 return;
             }
-            prev=current;
+            // Duplicate strings are not allowed.
+            StringPiece prev=elements[0].getString(*strings);
+            for(i=1; i<elementsLength; ++i) {
+                StringPiece current=elements[i].getString(*strings);
+                if(prev==current) {
+                    errorCode=U_ILLEGAL_ARGUMENT_ERROR;
+                    return;
+                }
+                prev=current;
+            }
         }
     }
     // Create and byte-serialize the trie for the elements.
@@ -68,6 +68,9 @@ UOBJECT_DEFINE_RTTI_IMPLEMENTATION(CanonicalIterator)
  *@param source string to get results for
  */
 CanonicalIterator::CanonicalIterator(const UnicodeString &sourceStr, UErrorCode &status) :
+    done(TRUE),
+    maxResults(INT32_MAX),
+    resultCount(0),
     pieces(NULL),
     pieces_length(0),
     pieces_lengths(NULL),
@@ -81,6 +84,31 @@ CanonicalIterator::CanonicalIterator(const UnicodeString &sourceStr, UErrorCode
     }
 }
 
+/**
+ *@param source string to get results for
+ *@param maxResultCount the maximum number of strings returned by next()
+ */
+CanonicalIterator::CanonicalIterator(const UnicodeString &sourceStr, int32_t maxResultCount,
+                                     UErrorCode &status) :
+    done(TRUE),
+    maxResults(maxResultCount),
+    resultCount(0),
+    pieces(NULL),
+    pieces_length(0),
+    pieces_lengths(NULL),
+    current(NULL),
+    current_length(0),
+    nfd(*Normalizer2::getNFDInstance(status)),
+    nfcImpl(*Normalizer2Factory::getNFCImpl(status))
+{
+    if(U_SUCCESS(status) && maxResultCount <= 0) {
+      status = U_ILLEGAL_ARGUMENT_ERROR;
+    }
+    if(U_SUCCESS(status) && nfcImpl.ensureCanonIterData(status)) {
+      setSource(sourceStr, status);
+    }
+}
+
 CanonicalIterator::~CanonicalIterator() {
   cleanPieces();
 }
@@ -120,6 +148,7 @@ UnicodeString CanonicalIterator::getSource() {
  */
 void CanonicalIterator::reset() {
     done = FALSE;
+    resultCount = 0;
     for (int i = 0; i < current_length; ++i) {
         current[i] = 0;
     }
@@ -147,6 +176,11 @@ UnicodeString CanonicalIterator::next() {
     }
     //String result = buffer.toString(); // not needed
 
+    if (++resultCount >= maxResults) {
+        done = TRUE;
+        return buffer;
+    }
+
     // find next value for next time
 
     for (i = current_length - 1; ; --i) {
@@ -177,6 +211,7 @@ void CanonicalIterator::setSource(const UnicodeString &newSource, UErrorCode &st
       return;
     }
     done = FALSE;
+    resultCount = 0;
 
     cleanPieces();
 
@@ -265,7 +300,17 @@ void CanonicalIterator::setSource(const UnicodeString &newSource, UErrorCode &st
  * @return the results in a set.
  */
 void U_EXPORT2 CanonicalIterator::permute(UnicodeString &source, UBool skipZeros, Hashtable *result, UErrorCode &status) {
-    if(U_FAILURE(status)) {
+    permute(source, skipZeros, result, INT32_MAX, status);
+}
+
+/**
+ * Same as above, but stops when the result set has maxResults strings.
+ * Each level then generates only as many sub-permutations as it needs,
+ * rather than all of them.
+ */
+void CanonicalIterator::permute(UnicodeString &source, UBool skipZeros, Hashtable *result,
+                                int32_t maxResults, UErrorCode &status) {
+    if(U_FAILURE(status) || result->count() >= maxResults) {
         return;
     }
     //if (PROGRESS) printf("Permute: %s\n", UToS(Tr(source)));
@@ -293,7 +338,7 @@ void U_EXPORT2 CanonicalIterator::permute(UnicodeString &source, UBool skipZeros
     }
     subpermute.setValueDeleter(uprv_deleteUObject);
 
-    for (i = 0; i < source.length(); i += U16_LENGTH(cp)) {
+    for (i = 0; i < source.length() && result->count() < maxResults; i += U16_LENGTH(cp)) {
         cp = source.char32At(i);
         const UHashElement *ne = NULL;
         int32_t el = UHASH_FIRST;
@@ -311,7 +356,7 @@ void U_EXPORT2 CanonicalIterator::permute(UnicodeString &source, UBool skipZeros
 
         // see what the permutations of the characters before and after this one are
         //Hashtable *subpermute = permute(source.substring(0,i) + source.substring(i + UTF16.getCharCount(cp)));
-        permute(subPermuteString.remove(i, U16_LENGTH(cp)), skipZeros, &subpermute, status);
+        permute(subPermuteString.remove(i, U16_LENGTH(cp)), skipZeros, &subpermute, maxResults, status);
         /* Test for buffer overflows */
         if(U_FAILURE(status)) {
             return;
@@ -321,7 +366,7 @@ void U_EXPORT2 CanonicalIterator::permute(UnicodeString &source, UBool skipZeros
 
         // prefix this character to all of them
         ne = subpermute.nextElement(el);
-        while (ne != NULL) {
+        while (ne != NULL && result->count() < maxResults) {
             UnicodeString *permRes = (UnicodeString *)(ne->value.pointer);
             UnicodeString *chStr = new UnicodeString(cp);
             //test for  NULL
@@ -352,6 +397,9 @@ UnicodeString* CanonicalIterator::getEquivalents(const UnicodeString &segment, i
     permutations.setValueDeleter(uprv_deleteUObject);
     basic.setValueDeleter(uprv_deleteUObject);
 
+    // The segment itself is always the first result.
+    result.put(segment, new UnicodeString(segment), status);
+
     UChar USeg[256];
     int32_t segLen = segment.extract(USeg, 256, status);
     getEquivalents2(&basic, USeg, segLen, status);
@@ -365,18 +413,18 @@ UnicodeString* CanonicalIterator::getEquivalents(const UnicodeString &segment, i
     //Iterator it = basic.iterator();
     ne = basic.nextElement(el);
     //while (it.hasNext())
-    while (ne != NULL) {
+    while (ne != NULL && result.count() < maxResults) {
         //String item = (String) it.next();
         UnicodeString item = *((UnicodeString *)(ne->value.pointer));
 
         permutations.removeAll();
-        permute(item, CANITER_SKIP_ZEROES, &permutations, status);
+        permute(item, CANITER_SKIP_ZEROES, &permutations, maxResults, status);
         const UHashElement *ne2 = NULL;
         int32_t el2 = UHASH_FIRST;
         //Iterator it2 = permutations.iterator();
         ne2 = permutations.nextElement(el2);
         //while (it2.hasNext())
-        while (ne2 != NULL) {
+        while (ne2 != NULL && result.count() < maxResults) {
             //String possible = (String) it2.next();
             //UnicodeString *possible = new UnicodeString(*((UnicodeString *)(ne2->value.pointer)));
             UnicodeString possible(*((UnicodeString *)(ne2->value.pointer)));
@@ -417,11 +465,15 @@ UnicodeString* CanonicalIterator::getEquivalents(const UnicodeString &segment, i
         return NULL;
     }
     //result.toArray(finalResult);
-    result_len = 0;
+    finalResult[0] = segment;
+    result_len = 1;
     el = UHASH_FIRST;
     ne = result.nextElement(el);
     while(ne != NULL) {
-        finalResult[result_len++] = *((UnicodeString *)(ne->value.pointer));
+        const UnicodeString &item = *((UnicodeString *)(ne->value.pointer));
+        if (item != segment) {
+            finalResult[result_len++] = item;
+        }
         ne = result.nextElement(el);
     }
 
@@ -445,7 +497,7 @@ Hashtable *CanonicalIterator::getEquivalents2(Hashtable *fillinResult, const UCh
 
     // cycle through all the characters
     UChar32 cp;
-    for (int32_t i = 0; i < segLen; i += U16_LENGTH(cp)) {
+    for (int32_t i = 0; i < segLen && fillinResult->count() < maxResults; i += U16_LENGTH(cp)) {
         // see if any character is at the start of some decomposition
         U16_GET(segment, 0, i, segLen, cp);
         if (!nfcImpl.getCanonStartSet(cp, starts)) {
@@ -453,7 +505,7 @@ Hashtable *CanonicalIterator::getEquivalents2(Hashtable *fillinResult, const UCh
         }
         // if so, see which decompositions match
         UnicodeSetIterator iter(starts);
-        while (iter.next()) {
+        while (fillinResult->count() < maxResults && iter.next()) {
             UChar32 cp2 = iter.getCodepoint();
             Hashtable remainder(status);
             remainder.setValueDeleter(uprv_deleteUObject);
@@ -467,7 +519,7 @@ Hashtable *CanonicalIterator::getEquivalents2(Hashtable *fillinResult, const UCh
 
             int32_t el = UHASH_FIRST;
             const UHashElement *ne = remainder.nextElement(el);
-            while (ne != NULL) {
+            while (ne != NULL && fillinResult->count() < maxResults) {
                 UnicodeString item = *((UnicodeString *)(ne->value.pointer));
                 UnicodeString *toAdd = new UnicodeString(prefix);
                 /* test for NULL */
@@ -9,17 +9,20 @@
 #include "unicode/uchar.h"
 #include "unicode/ucpmap.h"
 #include "unicode/ucptrie.h"
+#include "unicode/udata.h"
 #include "unicode/umutablecptrie.h"
 #include "unicode/uniset.h"
 #include "unicode/uscript.h"
 #include "unicode/uset.h"
 #include "cmemory.h"
-#include "mutex.h"
+#include "cpsnap.h"
 #include "normalizer2impl.h"
 #include "uassert.h"
 #include "ubidi_props.h"
 #include "ucase.h"
 #include "ucln_cmn.h"
+#include "ucmndata.h"
+#include "udatamem.h"
 #include "umutex.h"
 #include "uprops.h"
 
@@ -43,11 +46,171 @@ struct Inclusion {
 };
 Inclusion gInclusions[NUM_INCLUSIONS]; // cached getInclusions()
 
-UnicodeSet *sets[UCHAR_BINARY_LIMIT] = {};
+struct PropertySet {
+    UnicodeSet  *fSet = nullptr;
+    UInitOnce    fInitOnce = U_INITONCE_INITIALIZER;
+};
+PropertySet sets[UCHAR_BINARY_LIMIT];
+
+struct PropertyMap {
+    UCPMap      *fMap = nullptr;
+    UInitOnce    fInitOnce = U_INITONCE_INITIALIZER;
+};
+PropertyMap maps[UCHAR_INT_LIMIT - UCHAR_INT_START];
+
+//----------------------------------------------------------------
+// Snapshot
+//----------------------------------------------------------------
+
+// A snapshot of the structures that this file builds, see u_writePropertySnapshot().
+// For the format see cpsnap.h.
+// The items are gInclusions[], sets[] and maps[].
+// A snapshot is either set with u_setPropertySnapshot(), or loaded from the ICU data
+// the first time that an item is needed.
+
+constexpr int32_t SNAPSHOT_SETS_START = NUM_INCLUSIONS;
+constexpr int32_t SNAPSHOT_MAPS_START = SNAPSHOT_SETS_START + UCHAR_BINARY_LIMIT;
+constexpr int32_t SNAPSHOT_ITEM_COUNT = SNAPSHOT_MAPS_START + UCHAR_INT_LIMIT - UCHAR_INT_START;
+
+// The indexes of the snapshot in use, or nullptr.
+std::atomic<const int32_t *> gSnapshot(nullptr);
+
+UDataMemory *gSnapshotMemory = nullptr;
+UInitOnce gSnapshotMemoryInitOnce = U_INITONCE_INITIALIZER;
+
+// Is this item a well-formed UnicodeSet::serialize() output of at most length bytes?
+UBool isValidSerializedSet(const uint8_t *p, int32_t length) {
+    const uint16_t *units = reinterpret_cast<const uint16_t *>(p);
+    int32_t unitsLength = length / 2;
+    if (unitsLength < 1) { return FALSE; }
+    int32_t headerSize = (units[0] & 0x8000) ? 2 : 1;
+    int32_t listLength = units[0] & 0x7fff;
+    if (unitsLength < headerSize || (unitsLength - headerSize) < listLength) { return FALSE; }
+    int32_t bmpLength = headerSize == 1 ? listLength : units[1];
+    return bmpLength <= listLength && ((listLength - bmpLength) & 1) == 0;
+}
+
+// Returns the snapshot's indexes if it is usable by this ICU, otherwise nullptr.
+const int32_t *validateSnapshot(const void *data, int32_t length) {
+    const DataHeader *header = static_cast<const DataHeader *>(data);
+    UVersionInfo unicodeVersion;
+    u_getUnicodeVersion(unicodeVersion);
+    if (length < CPSNAP_HEADER_SIZE + CPSNAP_IX_COUNT * 4 ||
+            header->dataHeader.magic1 != 0xda || header->dataHeader.magic2 != 0x27 ||
+            header->dataHeader.headerSize != CPSNAP_HEADER_SIZE ||
+            header->info.isBigEndian != U_IS_BIG_ENDIAN ||
+            header->info.charsetFamily != U_CHARSET_FAMILY ||
+            header->info.dataFormat[0] != CPSNAP_FMT_0 ||
+            header->info.dataFormat[1] != CPSNAP_FMT_1 ||
+            header->info.dataFormat[2] != CPSNAP_FMT_2 ||
+            header->info.dataFormat[3] != CPSNAP_FMT_3 ||
+            header->info.formatVersion[0] != 1 ||
+            uprv_memcmp(header->info.dataVersion, unicodeVersion, 4) != 0) {
+        return nullptr;
+    }
+    const int32_t *indexes =
+        reinterpret_cast<const int32_t *>(static_cast<const uint8_t *>(data) + CPSNAP_HEADER_SIZE);
+    int32_t indexesLength = indexes[CPSNAP_IX_INDEXES_LENGTH];
+    int32_t snapshotLength = indexes[CPSNAP_IX_LENGTH];
+    if (indexesLength < CPSNAP_IX_COUNT ||
+            indexes[CPSNAP_IX_ICU_VERSION] != U_ICU_VERSION_MAJOR_NUM ||
+            indexes[CPSNAP_IX_INCLUSIONS_COUNT] != NUM_INCLUSIONS ||
+            indexes[CPSNAP_IX_SETS_COUNT] != UCHAR_BINARY_LIMIT ||
+            indexes[CPSNAP_IX_MAPS_COUNT] != UCHAR_INT_LIMIT - UCHAR_INT_START ||
+            snapshotLength > length - CPSNAP_HEADER_SIZE ||
+            indexesLength > snapshotLength / 4 - (SNAPSHOT_ITEM_COUNT + 1)) {
+        return nullptr;
+    }
+    const int32_t *offsets = indexes + indexesLength;
+    if (offsets[0] < (indexesLength + SNAPSHOT_ITEM_COUNT + 1) * 4 ||
+            offsets[SNAPSHOT_ITEM_COUNT] > snapshotLength) {
+        return nullptr;
+    }
+    for (int32_t i = 0; i < SNAPSHOT_ITEM_COUNT; ++i) {
+        int32_t itemLength = offsets[i + 1] - offsets[i];
+        if ((offsets[i] & 3) != 0 || itemLength < 0 ||
+                (i < SNAPSHOT_MAPS_START && itemLength > 0 &&
+                    !isValidSerializedSet(reinterpret_cast<const uint8_t *>(indexes) + offsets[i],
+                                          itemLength))) {
+            return nullptr;
+        }
+    }
+    return indexes;
+}
+
+UBool U_CALLCONV
+isAcceptableSnapshot(void * /*context*/,
+                     const char * /* type */, const char * /*name*/,
+                     const UDataInfo *pInfo) {
+    return pInfo->size >= 20 &&
+        pInfo->isBigEndian == U_IS_BIG_ENDIAN &&
+        pInfo->charsetFamily == U_CHARSET_FAMILY &&
+        pInfo->dataFormat[0] == CPSNAP_FMT_0 &&
+        pInfo->dataFormat[1] == CPSNAP_FMT_1 &&
+        pInfo->dataFormat[2] == CPSNAP_FMT_2 &&
+        pInfo->dataFormat[3] == CPSNAP_FMT_3 &&
+        pInfo->formatVersion[0] == 1;
+}
 
-UCPMap *maps[UCHAR_INT_LIMIT - UCHAR_INT_START] = {};
+// UInitOnce singleton initialization function.
+// Loads the snapshot from the ICU data unless one was set with u_setPropertySnapshot().
+// Without a usable snapshot, everything is built at runtime; that is not an error.
+void U_CALLCONV loadSnapshot() {
+    if (gSnapshot.load(std::memory_order_acquire) != nullptr) { return; }
+    UErrorCode errorCode = U_ZERO_ERROR;
+    UDataMemory *memory = udata_openChoice(
+        nullptr, CPSNAP_DATA_TYPE, CPSNAP_DATA_NAME, isAcceptableSnapshot, nullptr, &errorCode);
+    if (U_FAILURE(errorCode)) { return; }
+    int32_t length = udata_getLength(memory);
+    const int32_t *indexes = nullptr;
+    if (length >= CPSNAP_IX_COUNT * 4) {
+        indexes = validateSnapshot(udata_getRawMemory(memory), CPSNAP_HEADER_SIZE + length);
+    }
+    if (indexes == nullptr) {
+        udata_close(memory);
+        return;
+    }
+    gSnapshotMemory = memory;
+    gSnapshot.store(indexes, std::memory_order_release);
+    ucln_common_registerCleanup(UCLN_COMMON_CHARACTERPROPERTIES, characterproperties_cleanup);
+}
+
+const uint8_t *getSnapshotItem(int32_t item, int32_t &length) {
+    umtx_initOnce(gSnapshotMemoryInitOnce, &loadSnapshot);
+    const int32_t *indexes = gSnapshot.load(std::memory_order_acquire);
+    if (indexes == nullptr) { return nullptr; }
+    const int32_t *offsets = indexes + indexes[CPSNAP_IX_INDEXES_LENGTH];
+    length = offsets[item + 1] - offsets[item];
+    return length > 0 ? reinterpret_cast<const uint8_t *>(indexes) + offsets[item] : nullptr;
+}
+
+// Returns nullptr if the set is not in the snapshot.
+UnicodeSet *getSnapshotSet(int32_t item, UErrorCode &errorCode) {
+    int32_t length;
+    const uint8_t *p = getSnapshotItem(item, length);
+    if (p == nullptr) { return nullptr; }
+    LocalPointer<UnicodeSet> set(
+        new UnicodeSet(reinterpret_cast<const uint16_t *>(p), length / 2,
+                       UnicodeSet::kSerialized, errorCode),
+        errorCode);
+    if (U_FAILURE(errorCode)) { return nullptr; }
+    if (set->isBogus()) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return nullptr;
+    }
+    return set.orphan();
+}
 
-icu::UMutex cpMutex;
+// Returns nullptr if the map is not in the snapshot.
+// The map aliases the snapshot.
+UCPMap *getSnapshotMap(int32_t item, UErrorCode &errorCode) {
+    int32_t length;
+    const uint8_t *p = getSnapshotItem(item, length);
+    if (p == nullptr) { return nullptr; }
+    return reinterpret_cast<UCPMap *>(
+        ucptrie_openFromBinary(UCPTRIE_TYPE_ANY, UCPTRIE_VALUE_BITS_ANY,
+                               p, length, nullptr, &errorCode));
+}
 
 //----------------------------------------------------------------
 // Inclusions list
@@ -76,14 +239,20 @@ UBool U_CALLCONV characterproperties_cleanup() {
         in.fSet = nullptr;
         in.fInitOnce.reset();
     }
-    for (int32_t i = 0; i < UPRV_LENGTHOF(sets); ++i) {
-        delete sets[i];
-        sets[i] = nullptr;
+    for (PropertySet &ps: sets) {
+        delete ps.fSet;
+        ps.fSet = nullptr;
+        ps.fInitOnce.reset();
     }
-    for (int32_t i = 0; i < UPRV_LENGTHOF(maps); ++i) {
-        ucptrie_close(reinterpret_cast<UCPTrie *>(maps[i]));
-        maps[i] = nullptr;
+    for (PropertyMap &pm: maps) {
+        ucptrie_close(reinterpret_cast<UCPTrie *>(pm.fMap));
+        pm.fMap = nullptr;
+        pm.fInitOnce.reset();
     }
+    gSnapshot.store(nullptr, std::memory_order_relaxed);
+    udata_close(gSnapshotMemory);
+    gSnapshotMemory = nullptr;
+    gSnapshotMemoryInitOnce.reset();
     return TRUE;
 }
 
@@ -96,6 +265,13 @@ void U_CALLCONV initInclusion(UPropertySource src, UErrorCode &errorCode) {
     }
     U_ASSERT(gInclusions[src].fSet == nullptr);
 
+    UnicodeSet *snapshotIncl = getSnapshotSet(src, errorCode);
+    if (U_FAILURE(errorCode)) { return; }
+    if (snapshotIncl != nullptr) {
+        gInclusions[src].fSet = snapshotIncl;
+        return;
+    }
+
     LocalPointer<UnicodeSet> incl(new UnicodeSet());
     if (incl.isNull()) {
         errorCode = U_MEMORY_ALLOCATION_ERROR;
@@ -204,6 +380,12 @@ void U_CALLCONV initIntPropInclusion(UProperty prop, UErrorCode &errorCode) {
     U_ASSERT(UCHAR_INT_START <= prop && prop < UCHAR_INT_LIMIT);
     int32_t inclIndex = UPROPS_SRC_COUNT + prop - UCHAR_INT_START;
     U_ASSERT(gInclusions[inclIndex].fSet == nullptr);
+    UnicodeSet *snapshotIncl = getSnapshotSet(inclIndex, errorCode);
+    if (U_FAILURE(errorCode)) { return; }
+    if (snapshotIncl != nullptr) {
+        gInclusions[inclIndex].fSet = snapshotIncl;
+        return;
+    }
     UPropertySource src = uprops_getSource(prop);
     const UnicodeSet *incl = getInclusionsForSource(src, errorCode);
     if (U_FAILURE(errorCode)) {
@@ -347,6 +529,36 @@ UCPMap *makeMap(UProperty property, UErrorCode &errorCode) {
         umutablecptrie_buildImmutable(mutableTrie.getAlias(), type, valueWidth, &errorCode));
 }
 
+void U_CALLCONV initSet(UProperty property, UErrorCode &errorCode) {
+    // This function is invoked only via umtx_initOnce().
+    UnicodeSet *set = getSnapshotSet(SNAPSHOT_SETS_START + property, errorCode);
+    if (set != nullptr) {
+        set->freeze();
+    } else {
+        set = makeSet(property, errorCode);
+    }
+    if (U_FAILURE(errorCode)) {
+        delete set;
+        return;
+    }
+    sets[property].fSet = set;
+    ucln_common_registerCleanup(UCLN_COMMON_CHARACTERPROPERTIES, characterproperties_cleanup);
+}
+
+void U_CALLCONV initMap(UProperty property, UErrorCode &errorCode) {
+    // This function is invoked only via umtx_initOnce().
+    UCPMap *map = getSnapshotMap(SNAPSHOT_MAPS_START + property - UCHAR_INT_START, errorCode);
+    if (map == nullptr && U_SUCCESS(errorCode)) {
+        map = makeMap(property, errorCode);
+    }
+    if (U_FAILURE(errorCode)) {
+        ucptrie_close(reinterpret_cast<UCPTrie *>(map));
+        return;
+    }
+    maps[property - UCHAR_INT_START].fMap = map;
+    ucln_common_registerCleanup(UCLN_COMMON_CHARACTERPROPERTIES, characterproperties_cleanup);
+}
+
 }  // namespace
 
 U_NAMESPACE_USE
@@ -358,13 +570,11 @@ u_getBinaryPropertySet(UProperty property, UErrorCode *pErrorCode) {
         *pErrorCode = U_ILLEGAL_ARGUMENT_ERROR;
         return nullptr;
     }
-    Mutex m(&cpMutex);
-    UnicodeSet *set = sets[property];
-    if (set == nullptr) {
-        sets[property] = set = makeSet(property, *pErrorCode);
-    }
+    // After the first call for a property, this is a lock-free lookup.
+    PropertySet &ps = sets[property];
+    umtx_initOnce(ps.fInitOnce, &initSet, property, *pErrorCode);
     if (U_FAILURE(*pErrorCode)) { return nullptr; }
-    return set->toUSet();
+    return ps.fSet->toUSet();
 }
 
 U_CAPI const UCPMap * U_EXPORT2
@@ -374,10 +584,119 @@ u_getIntPropertyMap(UProperty property, UErrorCode *pErrorCode) {
         *pErrorCode = U_ILLEGAL_ARGUMENT_ERROR;
         return nullptr;
     }
-    Mutex m(&cpMutex);
-    UCPMap *map = maps[property - UCHAR_INT_START];
-    if (map == nullptr) {
-        maps[property - UCHAR_INT_START] = map = makeMap(property, *pErrorCode);
+    PropertyMap &pm = maps[property - UCHAR_INT_START];
+    umtx_initOnce(pm.fInitOnce, &initMap, property, *pErrorCode);
+    if (U_FAILURE(*pErrorCode)) { return nullptr; }
+    return pm.fMap;
+}
+
+U_CAPI int32_t U_EXPORT2
+u_writePropertySnapshot(void *dest, int32_t capacity, UErrorCode *pErrorCode) {
+    if (U_FAILURE(*pErrorCode)) { return 0; }
+    if (capacity < 0 || (capacity > 0 && (dest == nullptr || U_POINTER_MASK_LSB(dest, 3) != 0))) {
+        *pErrorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
     }
-    return map;
+
+    // Build everything. Items that fail to build, for example without normalization data,
+    // are left out of the snapshot.
+    const UnicodeSet *setItems[SNAPSHOT_MAPS_START] = {};
+    const UCPTrie *mapItems[SNAPSHOT_ITEM_COUNT - SNAPSHOT_MAPS_START] = {};
+    for (int32_t src = UPROPS_SRC_NONE + 1; src < UPROPS_SRC_COUNT; ++src) {
+        UErrorCode errorCode = U_ZERO_ERROR;
+        setItems[src] = getInclusionsForSource((UPropertySource)src, errorCode);
+    }
+    for (int32_t prop = UCHAR_INT_START; prop < UCHAR_INT_LIMIT; ++prop) {
+        UErrorCode errorCode = U_ZERO_ERROR;
+        setItems[UPROPS_SRC_COUNT + prop - UCHAR_INT_START] =
+            CharacterProperties::getInclusionsForProperty((UProperty)prop, errorCode);
+        errorCode = U_ZERO_ERROR;
+        mapItems[prop - UCHAR_INT_START] =
+            reinterpret_cast<const UCPTrie *>(u_getIntPropertyMap((UProperty)prop, &errorCode));
+    }
+    for (int32_t prop = 0; prop < UCHAR_BINARY_LIMIT; ++prop) {
+        UErrorCode errorCode = U_ZERO_ERROR;
+        const USet *set = u_getBinaryPropertySet((UProperty)prop, &errorCode);
+        setItems[SNAPSHOT_SETS_START + prop] = set != nullptr ? UnicodeSet::fromUSet(set) : nullptr;
+    }
+
+    int32_t offsets[SNAPSHOT_ITEM_COUNT + 1];
+    int32_t length = (CPSNAP_IX_COUNT + SNAPSHOT_ITEM_COUNT + 1) * 4;
+    for (int32_t i = 0; i < SNAPSHOT_ITEM_COUNT; ++i) {
+        offsets[i] = length;
+        UErrorCode errorCode = U_ZERO_ERROR;
+        int32_t itemLength = 0;
+        if (i < SNAPSHOT_MAPS_START) {
+            if (setItems[i] != nullptr) {
+                itemLength = setItems[i]->serialize(nullptr, 0, errorCode) * 2;
+            }
+        } else if (mapItems[i - SNAPSHOT_MAPS_START] != nullptr) {
+            itemLength = ucptrie_toBinary(mapItems[i - SNAPSHOT_MAPS_START], nullptr, 0, &errorCode);
+        }
+        if (errorCode != U_BUFFER_OVERFLOW_ERROR) {
+            itemLength = 0;  // Too large for its serialization format, or not built.
+        }
+        length += (itemLength + 3) & ~3;
+    }
+    offsets[SNAPSHOT_ITEM_COUNT] = length;
+    int32_t totalLength = CPSNAP_HEADER_SIZE + length;
+    if (capacity < totalLength) {
+        *pErrorCode = U_BUFFER_OVERFLOW_ERROR;
+        return totalLength;
+    }
+
+    uint8_t *bytes = static_cast<uint8_t *>(dest);
+    uprv_memset(bytes, 0, totalLength);
+    DataHeader *header = reinterpret_cast<DataHeader *>(bytes);
+    header->dataHeader.headerSize = (uint16_t)CPSNAP_HEADER_SIZE;
+    header->dataHeader.magic1 = 0xda;
+    header->dataHeader.magic2 = 0x27;
+    header->info.size = (uint16_t)sizeof(UDataInfo);
+    header->info.isBigEndian = U_IS_BIG_ENDIAN;
+    header->info.charsetFamily = U_CHARSET_FAMILY;
+    header->info.sizeofUChar = U_SIZEOF_UCHAR;
+    header->info.dataFormat[0] = CPSNAP_FMT_0;
+    header->info.dataFormat[1] = CPSNAP_FMT_1;
+    header->info.dataFormat[2] = CPSNAP_FMT_2;
+    header->info.dataFormat[3] = CPSNAP_FMT_3;
+    header->info.formatVersion[0] = 1;
+    u_getUnicodeVersion(header->info.dataVersion);
+
+    int32_t *indexes = reinterpret_cast<int32_t *>(bytes + CPSNAP_HEADER_SIZE);
+    indexes[CPSNAP_IX_INDEXES_LENGTH] = CPSNAP_IX_COUNT;
+    indexes[CPSNAP_IX_ICU_VERSION] = U_ICU_VERSION_MAJOR_NUM;
+    indexes[CPSNAP_IX_INCLUSIONS_COUNT] = NUM_INCLUSIONS;
+    indexes[CPSNAP_IX_SETS_COUNT] = UCHAR_BINARY_LIMIT;
+    indexes[CPSNAP_IX_MAPS_COUNT] = UCHAR_INT_LIMIT - UCHAR_INT_START;
+    indexes[CPSNAP_IX_LENGTH] = length;
+    uprv_memcpy(indexes + CPSNAP_IX_COUNT, offsets, sizeof(offsets));
+    uint8_t *items = bytes + CPSNAP_HEADER_SIZE;
+    for (int32_t i = 0; i < SNAPSHOT_ITEM_COUNT; ++i) {
+        int32_t itemLength = offsets[i + 1] - offsets[i];
+        if (itemLength == 0) { continue; }
+        if (i < SNAPSHOT_MAPS_START) {
+            setItems[i]->serialize(reinterpret_cast<uint16_t *>(items + offsets[i]),
+                                   itemLength / 2, *pErrorCode);
+        } else {
+            ucptrie_toBinary(mapItems[i - SNAPSHOT_MAPS_START], items + offsets[i],
+                             itemLength, pErrorCode);
+        }
+    }
+    return U_SUCCESS(*pErrorCode) ? totalLength : 0;
+}
+
+U_CAPI void U_EXPORT2
+u_setPropertySnapshot(const void *data, int32_t length, UErrorCode *pErrorCode) {
+    if (U_FAILURE(*pErrorCode)) { return; }
+    if (data == nullptr || length < 0 || U_POINTER_MASK_LSB(data, 3) != 0) {
+        *pErrorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    const int32_t *indexes = validateSnapshot(data, length);
+    if (indexes == nullptr) {
+        *pErrorCode = U_INVALID_FORMAT_ERROR;
+        return;
+    }
+    gSnapshot.store(indexes, std::memory_order_release);
+    ucln_common_registerCleanup(UCLN_COMMON_CHARACTERPROPERTIES, characterproperties_cleanup);
 }
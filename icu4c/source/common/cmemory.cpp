@@ -23,6 +23,7 @@
 #include "unicode/uclean.h"
 #include "cmemory.h"
 #include "putilimp.h"
+#include "ucounterimp.h"
 #include "uassert.h"
 #include <stdlib.h>
 
@@ -52,6 +53,8 @@ uprv_malloc(size_t s) {
 #endif
 #endif
     if (s > 0) {
+        UCOUNTER_INC(UCOUNTER_ALLOCATIONS);
+        UCOUNTER_ADD(UCOUNTER_ALLOCATED_BYTES, s);
         if (pAlloc) {
             return (*pAlloc)(pContext, s);
         } else {
@@ -78,6 +81,8 @@ uprv_realloc(void * buffer, size_t size) {
         }
         return (void *)zeroMem;
     } else {
+        UCOUNTER_INC(UCOUNTER_ALLOCATIONS);
+        UCOUNTER_ADD(UCOUNTER_ALLOCATED_BYTES, size);
         if (pRealloc) {
             return (*pRealloc)(pContext, buffer, size);
         } else {
@@ -31,6 +31,7 @@
 #include <stddef.h>
 #include <string.h>
 #include "unicode/localpointer.h"
+#include "uassert.h"
 
 #if U_DEBUG && defined(UPRV_MALLOC_COUNT)
 #include <stdio.h>
@@ -122,6 +123,7 @@ uprv_deleteUObject(void *obj);
 
 #ifdef __cplusplus
 
+#include <new>
 #include <utility>
 #include "unicode/uobject.h"
 
@@ -658,6 +660,148 @@ inline H *MaybeStackHeaderAndArray<H, T, stackCapacity>::orphanOrClone(int32_t l
     return p;
 }
 
+/**
+ * Growable array of primitive (plain-old data) values, with room for the
+ * first stackCapacity values inside the object itself; see MaybeStackArray.
+ *
+ * Unlike UVector32 and UVector64, it is typed, its element access is inline
+ * and only checked by assertions, and moving it transfers the heap buffer
+ * rather than copying it. Used instead of those on hot paths.
+ *
+ * The capacity doubles when it runs out. Callers that know how many values
+ * they need should say so with ensureCapacity() or setSize(), and
+ * setMaxCapacity() limits the growth.
+ *
+ * WARNING: Like MaybeStackArray, this only works with primitive types.
+ */
+template<typename T, int32_t stackCapacity>
+class MaybeStackVector {
+public:
+    MaybeStackVector() : count(0), maxCapacity(0) {}
+
+    MaybeStackVector(const MaybeStackVector &) = delete;
+    MaybeStackVector &operator=(const MaybeStackVector &) = delete;
+
+    /**
+     * Move constructor: transfers ownership or copies the stack array.
+     */
+    MaybeStackVector(MaybeStackVector &&src) U_NOEXCEPT
+            : array(std::move(src.array)), count(src.count), maxCapacity(src.maxCapacity) {
+        src.count = 0;
+    }
+
+    /**
+     * Move assignment: transfers ownership or copies the stack array.
+     */
+    MaybeStackVector &operator=(MaybeStackVector &&src) U_NOEXCEPT {
+        array = std::move(src.array);
+        count = src.count;
+        maxCapacity = src.maxCapacity;
+        src.count = 0;
+        return *this;
+    }
+
+    int32_t size() const { return count; }
+    UBool isEmpty() const { return count == 0; }
+    int32_t getCapacity() const { return array.getCapacity(); }
+
+    /**
+     * Limits the capacity; 0 means no limit. Growing beyond the limit
+     * sets U_BUFFER_OVERFLOW_ERROR.
+     */
+    void setMaxCapacity(int32_t limit) { maxCapacity = limit > 0 ? limit : 0; }
+
+    T *getBuffer() { return array.getAlias(); }
+    const T *getBuffer() const { return array.getAlias(); }
+
+    T &operator[](int32_t i) {
+        U_ASSERT(0 <= i && i < count);
+        return array[i];
+    }
+    const T &operator[](int32_t i) const {
+        U_ASSERT(0 <= i && i < count);
+        return array[i];
+    }
+
+    /** Returns the last value. The vector must not be empty. */
+    T &peek() {
+        U_ASSERT(count > 0);
+        return array[count - 1];
+    }
+
+    void addElement(T value, UErrorCode &status) {
+        if (ensureCapacity(count + 1, status)) {
+            array[count++] = value;
+        }
+    }
+
+    void removeAllElements() { count = 0; }
+
+    /**
+     * Makes sure there is room for minimumCapacity values without reallocating.
+     * @return TRUE if successful
+     */
+    UBool ensureCapacity(int32_t minimumCapacity, UErrorCode &status) {
+        if (minimumCapacity <= array.getCapacity() && U_SUCCESS(status)) {
+            return TRUE;
+        }
+        return grow(minimumCapacity, status);
+    }
+
+    /**
+     * Changes the size. Values added this way are uninitialized.
+     * @return TRUE if successful
+     */
+    UBool setSize(int32_t newSize, UErrorCode &status) {
+        if (newSize < 0) {
+            if (U_SUCCESS(status)) {
+                status = U_ILLEGAL_ARGUMENT_ERROR;
+            }
+            return FALSE;
+        }
+        if (!ensureCapacity(newSize, status)) {
+            return FALSE;
+        }
+        count = newSize;
+        return TRUE;
+    }
+
+private:
+    UBool grow(int32_t minimumCapacity, UErrorCode &status);
+
+    MaybeStackArray<T, stackCapacity> array;
+    int32_t count;
+    int32_t maxCapacity;
+};
+
+template<typename T, int32_t stackCapacity>
+UBool MaybeStackVector<T, stackCapacity>::grow(int32_t minimumCapacity, UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return FALSE;
+    }
+    if (minimumCapacity < 0) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return FALSE;
+    }
+    if (maxCapacity > 0 && minimumCapacity > maxCapacity) {
+        status = U_BUFFER_OVERFLOW_ERROR;
+        return FALSE;
+    }
+    int32_t capacity = array.getCapacity();
+    int32_t newCapacity = capacity <= INT32_MAX / 2 ? 2 * capacity : INT32_MAX;
+    if (newCapacity < minimumCapacity) {
+        newCapacity = minimumCapacity;
+    }
+    if (maxCapacity > 0 && newCapacity > maxCapacity) {
+        newCapacity = maxCapacity;
+    }
+    if (array.resize(newCapacity, count) == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return FALSE;
+    }
+    return TRUE;
+}
+
 /**
  * A simple memory management class that creates new heap allocated objects (of
  * any class that has a public constructor), keeps track of them and eventually
@@ -679,30 +823,43 @@ inline H *MaybeStackHeaderAndArray<H, T, stackCapacity>::orphanOrClone(int32_t l
  *
  *     // MemoryPool will take care of deleting the MyType objects.
  *
+ * The objects are constructed in place in blocks of uprv_malloc'ed memory,
+ * so that creating n objects costs O(log n) heap allocations rather than n.
+ * The first block holds stackCapacity objects, and each further block
+ * twice as many as the previous one, up to kMaxBlockCapacity.
+ * Objects do not move once created, including when the pool itself is moved,
+ * and they must not be deleted other than by the pool.
+ *
  * It doesn't do anything more than that, and is intentionally kept minimalist.
  */
 template<typename T, int32_t stackCapacity = 8>
 class MemoryPool : public UMemory {
 public:
-    MemoryPool() : count(0), pool() {}
+    MemoryPool() : blockCount(0), count(0), blocks() {}
 
     ~MemoryPool() {
-        for (int32_t i = 0; i < count; ++i) {
-            delete pool[i];
-        }
+        deleteAll();
     }
 
     MemoryPool(const MemoryPool&) = delete;
     MemoryPool& operator=(const MemoryPool&) = delete;
 
-    MemoryPool(MemoryPool&& other) U_NOEXCEPT : count(other.count),
-                                                pool(std::move(other.pool)) {
+    MemoryPool(MemoryPool&& other) U_NOEXCEPT : blockCount(other.blockCount),
+                                                count(other.count),
+                                                blocks(std::move(other.blocks)) {
+        other.blockCount = 0;
         other.count = 0;
     }
 
     MemoryPool& operator=(MemoryPool&& other) U_NOEXCEPT {
+        if (this == &other) {
+            return *this;
+        }
+        deleteAll();
+        blockCount = other.blockCount;
         count = other.count;
-        pool = std::move(other.pool);
+        blocks = std::move(other.blocks);
+        other.blockCount = 0;
         other.count = 0;
         return *this;
     }
@@ -716,18 +873,49 @@ class MemoryPool : public UMemory {
      */
     template<typename... Args>
     T* create(Args&&... args) {
-        int32_t capacity = pool.getCapacity();
-        if (count == capacity &&
-            pool.resize(capacity == stackCapacity ? 4 * capacity : 2 * capacity,
-                        capacity) == nullptr) {
-            return nullptr;
+        if (blockCount == 0 || count == blockCapacity(blockCount - 1)) {
+            if (blockCount == blocks.getCapacity() &&
+                    blocks.resize(2 * blockCount, blockCount) == nullptr) {
+                return nullptr;
+            }
+            T *block = static_cast<T *>(uprv_malloc(sizeof(T) * blockCapacity(blockCount)));
+            if (block == nullptr) {
+                return nullptr;
+            }
+            blocks[blockCount++] = block;
+            count = 0;
         }
-        return pool[count++] = new T(std::forward<Args>(args)...);
+        return ::new(blocks[blockCount - 1] + count++) T(std::forward<Args>(args)...);
     }
 
 private:
+    static const int32_t kMaxBlockCapacity = 1024;
+
+    static int32_t blockCapacity(int32_t blockIndex) {
+        int32_t capacity = stackCapacity > 0 ? stackCapacity : 1;
+        for (; blockIndex > 0 && capacity < kMaxBlockCapacity; --blockIndex) {
+            capacity *= 2;
+        }
+        return capacity;
+    }
+
+    void deleteAll() {
+        for (int32_t i = 0; i < blockCount; ++i) {
+            T *block = blocks[i];
+            int32_t length = i < blockCount - 1 ? blockCapacity(i) : count;
+            for (int32_t j = 0; j < length; ++j) {
+                block[j].~T();
+            }
+            uprv_free(block);
+        }
+        blockCount = 0;
+        count = 0;
+    }
+
+    int32_t blockCount;
+    /** Number of objects in the last block. */
     int32_t count;
-    MaybeStackArray<T*, stackCapacity> pool;
+    MaybeStackArray<T*, stackCapacity> blocks;
 };
 
 U_NAMESPACE_END
@@ -0,0 +1,51 @@
+// © 2019 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+
+// cpsnap.h
+// Character property snapshot: the sets and maps that characterproperties.cpp
+// builds, precomputed. See u_writePropertySnapshot().
+
+#ifndef __CPSNAP_H__
+#define __CPSNAP_H__
+
+#include "unicode/utypes.h"
+
+// file definitions ------------------------------------------------------------
+
+#define CPSNAP_DATA_NAME "cpsnap"
+#define CPSNAP_DATA_TYPE "icu"
+
+// data format "CPSn"
+#define CPSNAP_FMT_0 0x43
+#define CPSNAP_FMT_1 0x50
+#define CPSNAP_FMT_2 0x53
+#define CPSNAP_FMT_3 0x6e
+
+// The data header is padded to this many bytes.
+constexpr int32_t CPSNAP_HEADER_SIZE = 32;
+
+// The data header is followed by
+//   int32_t indexes[indexes[CPSNAP_IX_INDEXES_LENGTH]];
+//   int32_t offsets[item count + 1];
+//   the items
+// Item i is at bytes offsets[i]..offsets[i+1]-1 from the start of the indexes,
+// and offsets are multiples of 4.
+// The items are, in this order,
+// - the inclusions (property starts) per UPropertySource and per int property,
+//   and the binary property sets, all in UnicodeSet::serialize() format
+// - the int property maps as UCPTrie binaries
+// An item is empty if it was not available when the snapshot was written;
+// it is built at runtime when it is first used.
+
+// indexes into indexes[]
+enum {
+    CPSNAP_IX_INDEXES_LENGTH,
+    CPSNAP_IX_ICU_VERSION,  // U_ICU_VERSION_MAJOR_NUM
+    CPSNAP_IX_INCLUSIONS_COUNT,
+    CPSNAP_IX_SETS_COUNT,
+    CPSNAP_IX_MAPS_COUNT,
+    CPSNAP_IX_LENGTH,  // bytes from the start of the indexes to the end of the items
+    CPSNAP_IX_COUNT
+};
+
+#endif  // __CPSNAP_H__
@@ -7,6 +7,8 @@
  *******************************************************************************
  */
 
+#include <condition_variable>
+#include <mutex>
 #include <utility>
 
 #include "unicode/utypes.h"
@@ -27,6 +29,17 @@
 
 U_NAMESPACE_BEGIN
 
+/*
+ ******************************************************************
+ */
+
+DictionaryBreakBuffers::DictionaryBreakBuffers(UErrorCode & /* status */)
+        : executor(NULL), executorContext(NULL) {
+}
+
+DictionaryBreakBuffers::~DictionaryBreakBuffers() {
+}
+
 /*
  ******************************************************************
  */
@@ -46,7 +59,8 @@ int32_t
 DictionaryBreakEngine::findBreaks( UText *text,
                                  int32_t startPos,
                                  int32_t endPos,
-                                 UVector32 &foundBreaks ) const {
+                                 UVector32 &foundBreaks,
+                                 DictionaryBreakBuffers *buffers ) const {
     (void)startPos;            // TODO: remove this param?
     int32_t result = 0;
 
@@ -65,7 +79,7 @@ DictionaryBreakEngine::findBreaks( UText *text,
     }
     rangeStart = start;
     rangeEnd = current;
-    result = divideUpDictionaryRange(text, rangeStart, rangeEnd, foundBreaks);
+    result = divideUpDictionaryRange(text, rangeStart, rangeEnd, foundBreaks, buffers);
     utext_setNativeIndex(text, current);
     
     return result;
@@ -223,7 +237,8 @@ int32_t
 ThaiBreakEngine::divideUpDictionaryRange( UText *text,
                                                 int32_t rangeStart,
                                                 int32_t rangeEnd,
-                                                UVector32 &foundBreaks ) const {
+                                                UVector32 &foundBreaks,
+                                                DictionaryBreakBuffers * /* buffers */ ) const {
     utext_setNativeIndex(text, rangeStart);
     utext_moveIndex32(text, THAI_MIN_WORD_SPAN);
     if (utext_getNativeIndex(text) >= rangeEnd) {
@@ -462,7 +477,8 @@ int32_t
 LaoBreakEngine::divideUpDictionaryRange( UText *text,
                                                 int32_t rangeStart,
                                                 int32_t rangeEnd,
-                                                UVector32 &foundBreaks ) const {
+                                                UVector32 &foundBreaks,
+                                                DictionaryBreakBuffers * /* buffers */ ) const {
     if ((rangeEnd - rangeStart) < LAO_MIN_WORD_SPAN) {
         return 0;       // Not enough characters for two words
     }
@@ -655,7 +671,8 @@ int32_t
 BurmeseBreakEngine::divideUpDictionaryRange( UText *text,
                                                 int32_t rangeStart,
                                                 int32_t rangeEnd,
-                                                UVector32 &foundBreaks ) const {
+                                                UVector32 &foundBreaks,
+                                                DictionaryBreakBuffers * /* buffers */ ) const {
     if ((rangeEnd - rangeStart) < BURMESE_MIN_WORD_SPAN) {
         return 0;       // Not enough characters for two words
     }
@@ -860,7 +877,8 @@ int32_t
 KhmerBreakEngine::divideUpDictionaryRange( UText *text,
                                                 int32_t rangeStart,
                                                 int32_t rangeEnd,
-                                                UVector32 &foundBreaks ) const {
+                                                UVector32 &foundBreaks,
+                                                DictionaryBreakBuffers * /* buffers */ ) const {
     if ((rangeEnd - rangeStart) < KHMER_MIN_WORD_SPAN) {
         return 0;       // Not enough characters for two words
     }
@@ -1099,6 +1117,168 @@ static inline int32_t utext_i32_flag(int32_t bitIndex) {
 }
 
        
+// Dictionary ranges are only split into pieces when the break iterator has an
+// executor, and only when they are longer than this many code units.
+static const int32_t kMinSplitRangeLength = 4096;
+// Preferred length of a piece, in code units.
+static const int32_t kDictionaryPieceLength = 2048;
+// How far back from the preferred end of a piece to look for a safe cut, in code points.
+static const int32_t kPieceCutWindow = 64;
+// The longest dictionary match that segmentRange() asks for, in code units.
+// A match can be one code unit longer if it ends with a supplementary character.
+static const int32_t kMaxWordSize = 20;
+
+UBool
+CjkBreakEngine::isSafePieceLimit( UText *inText,
+        int32_t pieceStart,
+        int32_t limit,
+        int32_t rangeEnd ) const {
+    // segmentRange() normalizes the text one fragment at a time, so a piece
+    // boundary must also be a fragment boundary in the whole range.
+    utext_setNativeIndex(inText, limit);
+    if (!nfkcNorm2->hasBoundaryBefore(utext_current32(inText))) {
+        return FALSE;
+    }
+
+    // Normalize whole fragments on both sides of the limit, enough for any
+    // dictionary word that could cross it.
+    UErrorCode status = U_ZERO_ERROR;
+    UnicodeString original;
+    UnicodeString before;
+    int32_t windowStart = limit;
+    do {
+        UChar32 c;
+        do {
+            c = utext_previous32(inText);
+            original.insert(0, c);
+            windowStart = (int32_t)utext_getNativeIndex(inText);
+        } while (windowStart > pieceStart && !nfkcNorm2->hasBoundaryBefore(c));
+        nfkcNorm2->normalize(original, before, status);
+    } while (windowStart > pieceStart && before.length() <= kMaxWordSize);
+    original.remove();
+    UnicodeString after;
+    int32_t windowLimit = limit;
+    utext_setNativeIndex(inText, limit);
+    do {
+        do {
+            original.append(utext_next32(inText));
+            windowLimit = (int32_t)utext_getNativeIndex(inText);
+        } while (windowLimit < rangeEnd && !nfkcNorm2->hasBoundaryBefore(utext_current32(inText)));
+        nfkcNorm2->normalize(original, after, status);
+    } while (windowLimit < rangeEnd && after.length() <= kMaxWordSize);
+    if (U_FAILURE(status) || before.isEmpty() || after.isEmpty()) {
+        return FALSE;
+    }
+
+    // A Katakana run is a candidate word up to its end. Hangul syllables have no
+    // single-character fallback, so parts of a Korean lattice can be unreachable;
+    // Korean ranges are all Hangul and are never split. Every position of a
+    // Chinese/Japanese lattice is reachable, and so the best segmentation of
+    // the whole range passes through any limit that no edge crosses.
+    UChar32 last = before.char32At(before.length() - 1);
+    UChar32 first = after.char32At(0);
+    if ((isKatakana(last) && isKatakana(first)) ||
+            fHangulWordSet.contains(last) || fHangulWordSet.contains(first)) {
+        return FALSE;
+    }
+
+    int32_t cut = before.length();
+    before.append(after);
+    UText fu = UTEXT_INITIALIZER;
+    utext_openConstUnicodeString(&fu, &before, &status);
+    if (U_FAILURE(status)) {
+        return FALSE;
+    }
+    int32_t lengths[kMaxWordSize + 1];
+    UBool isSafe = TRUE;
+    for (int32_t ix = 0; ix < cut && isSafe; ix = before.moveIndex32(ix, 1)) {
+        if (cut - ix > kMaxWordSize) {
+            continue;
+        }
+        utext_setNativeIndex(&fu, ix);
+        // The matches are in order from shortest to longest.
+        int32_t count = fDictionary->matches(&fu, kMaxWordSize, kMaxWordSize + 1,
+                                             lengths, NULL, NULL, NULL);
+        isSafe = count == 0 || ix + lengths[count - 1] <= cut;
+    }
+    utext_close(&fu);
+    return isSafe;
+}
+
+int32_t
+CjkBreakEngine::findPieceLimit( UText *inText,
+        int32_t pieceStart,
+        int32_t target,
+        int32_t rangeEnd ) const {
+    utext_setNativeIndex(inText, target);
+    int32_t limit = (int32_t)utext_getNativeIndex(inText);
+    for (int32_t i = 0; i < kPieceCutWindow && limit > pieceStart; ++i) {
+        if (isSafePieceLimit(inText, pieceStart, limit, rangeEnd)) {
+            return limit;
+        }
+        utext_setNativeIndex(inText, limit);
+        utext_previous32(inText);
+        limit = (int32_t)utext_getNativeIndex(inText);
+    }
+    return -1;
+}
+
+/**
+ * The pieces of one very long dictionary range. The calling thread copies the
+ * range into text, and each task segments its piece of that copy through its
+ * own UText, into its own vector of boundaries relative to the start of the copy.
+ */
+class DictionaryPieceBatch : public UMemory {
+public:
+    DictionaryPieceBatch(const CjkBreakEngine &e, const UnicodeString &t,
+                         const UVector32 &starts, UVector &breaks)
+            : engine(e), text(t), pieceStarts(starts), pieceBreaks(breaks), pending(0) {}
+
+    void run(int32_t piece);
+
+    const CjkBreakEngine &engine;
+    const UnicodeString &text;
+    const UVector32 &pieceStarts;
+    UVector &pieceBreaks;
+    std::mutex mutex;
+    std::condition_variable done;
+    int32_t pending;
+};
+
+U_NAMESPACE_END
+
+struct UBreakIteratorTask {
+    icu::DictionaryPieceBatch *batch;
+    int32_t piece;
+};
+
+U_CAPI void U_EXPORT2
+ubrk_runTask(UBreakIteratorTask *task) {
+    task->batch->run(task->piece);
+}
+
+U_NAMESPACE_BEGIN
+
+void DictionaryPieceBatch::run(int32_t piece) {
+    int32_t start = pieceStarts.elementAti(piece);
+    int32_t limit = pieceStarts.elementAti(piece + 1);
+    UVector32 &breaks = *static_cast<UVector32 *>(pieceBreaks.elementAt(piece));
+    // A read-only alias of the piece; the copy is not modified while tasks run.
+    UnicodeString pieceText(FALSE, text.getBuffer() + start, limit - start);
+    UErrorCode status = U_ZERO_ERROR;
+    UText ut = UTEXT_INITIALIZER;
+    utext_openConstUnicodeString(&ut, &pieceText, &status);
+    if (U_SUCCESS(status)) {
+        // A piece that fails is left without boundaries.
+        engine.segmentRange(&ut, 0, limit - start, breaks, NULL);
+    }
+    utext_close(&ut);
+    std::lock_guard<std::mutex> lock(mutex);
+    if (--pending == 0) {
+        done.notify_all();
+    }
+}
+
 /*
  * @param text A UText representing the text
  * @param rangeStart The start of the range of dictionary characters
@@ -1110,19 +1290,133 @@ int32_t
 CjkBreakEngine::divideUpDictionaryRange( UText *inText,
         int32_t rangeStart,
         int32_t rangeEnd,
-        UVector32 &foundBreaks ) const {
+        UVector32 &foundBreaks,
+        DictionaryBreakBuffers *buffers ) const {
+    if (buffers == NULL || buffers->executor == NULL ||
+            rangeEnd - rangeStart <= kMinSplitRangeLength) {
+        return segmentRange(inText, rangeStart, rangeEnd, foundBreaks, buffers);
+    }
+
+    // Copy the range, so that the tasks never use the caller's UText,
+    // and map the indexes of the copy back to native indexes.
+    UErrorCode status = U_ZERO_ERROR;
+    UnicodeString text;
+    UVector32 nativeIndexes(status);
+    utext_setNativeIndex(inText, rangeStart);
+    while (utext_getNativeIndex(inText) < rangeEnd && U_SUCCESS(status)) {
+        int32_t nativeIndex = (int32_t)utext_getNativeIndex(inText);
+        text.append(utext_next32(inText));
+        while (nativeIndexes.size() < text.length() && U_SUCCESS(status)) {
+            nativeIndexes.addElement(nativeIndex, status);
+        }
+    }
+    nativeIndexes.addElement(rangeEnd, status);
+
+    // Cut the copy only where the pieces give the same boundaries as the whole.
+    int32_t length = text.length();
+    UVector32 pieceStarts(status);
+    pieceStarts.addElement(0, status);
+    UText ut = UTEXT_INITIALIZER;
+    utext_openConstUnicodeString(&ut, &text, &status);
+    for (int32_t pieceStart = 0, target = kDictionaryPieceLength;
+            length - target >= kDictionaryPieceLength / 2 && U_SUCCESS(status);) {
+        int32_t limit = findPieceLimit(&ut, pieceStart, target, length);
+        if (limit > pieceStart) {
+            pieceStarts.addElement(limit, status);
+            pieceStart = limit;
+            target = limit + kDictionaryPieceLength;
+        } else {
+            // No safe cut near the target; make the piece longer.
+            target += kDictionaryPieceLength;
+        }
+    }
+    utext_close(&ut);
+    pieceStarts.addElement(length, status);
+    int32_t numPieces = pieceStarts.size() - 1;
+
+    UVector pieceBreaks(uprv_deleteUObject, NULL, numPieces, status);
+    for (int32_t i = 0; i < numPieces && U_SUCCESS(status); ++i) {
+        UVector32 *breaks = new UVector32(status);
+        if (breaks == NULL) {
+            status = U_MEMORY_ALLOCATION_ERROR;
+            break;
+        }
+        pieceBreaks.addElement(breaks, status);
+    }
+    MaybeStackArray<UBreakIteratorTask, 8> tasks;
+    if (U_SUCCESS(status) && numPieces > 1 && tasks.resize(numPieces) == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+    }
+    if (U_FAILURE(status) || numPieces <= 1) {
+        return segmentRange(inText, rangeStart, rangeEnd, foundBreaks, buffers);
+    }
+
+    DictionaryPieceBatch batch(*this, text, pieceStarts, pieceBreaks);
+    {
+        std::lock_guard<std::mutex> lock(batch.mutex);
+        batch.pending = numPieces;
+    }
+    for (int32_t i = 0; i < numPieces; ++i) {
+        tasks[i].batch = &batch;
+        tasks[i].piece = i;
+        buffers->executor(buffers->executorContext, &tasks[i]);
+    }
+    {
+        std::unique_lock<std::mutex> lock(batch.mutex);
+        batch.done.wait(lock, [&batch]() { return batch.pending == 0; });
+    }
+    for (int32_t i = 0; i < numPieces; ++i) {
+        if (static_cast<const UVector32 *>(pieceBreaks.elementAt(i))->size() == 0) {
+            return segmentRange(inText, rangeStart, rangeEnd, foundBreaks, buffers);
+        }
+    }
+
+    // Stitch the pieces together. Each piece starts with a break at its own start,
+    // which is dropped if it duplicates the end of the previous piece, or a break
+    // that the caller already has at the start of the range.
+    int32_t numBreaks = 0;
+    for (int32_t i = 0; i < numPieces; ++i) {
+        const UVector32 *breaks = static_cast<const UVector32 *>(pieceBreaks.elementAt(i));
+        int32_t pieceStart = pieceStarts.elementAti(i);
+        for (int32_t j = 0; j < breaks->size(); ++j) {
+            int32_t pos = nativeIndexes.elementAti(pieceStart + breaks->elementAti(j));
+            if (foundBreaks.size() == 0 || foundBreaks.peeki() < pos) {
+                foundBreaks.push(pos, status);
+                ++numBreaks;
+            }
+        }
+    }
+    return numBreaks;
+}
+
+int32_t
+CjkBreakEngine::segmentRange( UText *inText,
+        int32_t rangeStart,
+        int32_t rangeEnd,
+        UVector32 &foundBreaks,
+        DictionaryBreakBuffers *buffers ) const {
     if (rangeStart >= rangeEnd) {
         return 0;
     }
 
+    UErrorCode     status      = U_ZERO_ERROR;
+
+    // Without caller-provided buffers, use temporary ones.
+    LocalPointer<DictionaryBreakBuffers> localBuffers;
+    if (buffers == NULL) {
+        localBuffers.adoptInsteadAndCheckErrorCode(new DictionaryBreakBuffers(status), status);
+        if (U_FAILURE(status)) {
+            return 0;
+        }
+        buffers = localBuffers.getAlias();
+    }
+
     // UnicodeString version of input UText, NFKC normalized if necessary.
-    UnicodeString inString;
+    UnicodeString &inString = buffers->inString;
 
     // inputMap[inStringIndex] = corresponding native index from UText inText.
     // If NULL then mapping is 1:1
-    LocalPointer<UVector32>     inputMap;
-
-    UErrorCode     status      = U_ZERO_ERROR;
+    DictionaryBreakBuffers::CjkIndexVector *inputMap = NULL;
 
 
     // if UText has the input string as one contiguous UTF-16 chunk
@@ -1145,10 +1439,9 @@ CjkBreakEngine::divideUpDictionaryRange( UText *inText,
         if (limit > utext_nativeLength(inText)) {
             limit = (int32_t)utext_nativeLength(inText);
         }
-        inputMap.adoptInsteadAndCheckErrorCode(new UVector32(status), status);
-        if (U_FAILURE(status)) {
-            return 0;
-        }
+        inString.remove();
+        inputMap = &buffers->inputMap;
+        inputMap->removeAllElements();
         while (utext_getNativeIndex(inText) < limit) {
             int32_t nativePosition = (int32_t)utext_getNativeIndex(inText);
             UChar32 c = utext_next32(inText);
@@ -1163,15 +1456,16 @@ CjkBreakEngine::divideUpDictionaryRange( UText *inText,
 
 
     if (!nfkcNorm2->isNormalized(inString, status)) {
-        UnicodeString normalizedInput;
+        UnicodeString &normalizedInput = buffers->normalizedInput;
+        normalizedInput.remove();
         //  normalizedMap[normalizedInput position] ==  original UText position.
-        LocalPointer<UVector32> normalizedMap(new UVector32(status), status);
-        if (U_FAILURE(status)) {
-            return 0;
-        }
-        
-        UnicodeString fragment;
-        UnicodeString normalizedFragment;
+        //  Use whichever of the two map buffers is not already holding inputMap.
+        DictionaryBreakBuffers::CjkIndexVector *normalizedMap =
+            inputMap == &buffers->inputMap ? &buffers->normalizedMap : &buffers->inputMap;
+        normalizedMap->removeAllElements();
+
+        UnicodeString &fragment = buffers->fragment;
+        UnicodeString &normalizedFragment = buffers->normalizedFragment;
         for (int32_t srcI = 0; srcI < inString.length();) {  // Once per normalization chunk
             fragment.remove();
             int32_t fragmentStartI = srcI;
@@ -1192,8 +1486,8 @@ CjkBreakEngine::divideUpDictionaryRange( UText *inText,
 
             // Map every position in the normalized chunk to the start of the chunk
             //   in the original input.
-            int32_t fragmentOriginalStart = inputMap.isValid() ?
-                    inputMap->elementAti(fragmentStartI) : fragmentStartI+rangeStart;
+            int32_t fragmentOriginalStart = inputMap != NULL ?
+                    (*inputMap)[fragmentStartI] : fragmentStartI+rangeStart;
             while (normalizedMap->size() < normalizedInput.length()) {
                 normalizedMap->addElement(fragmentOriginalStart, status);
                 if (U_FAILURE(status)) {
@@ -1202,12 +1496,13 @@ CjkBreakEngine::divideUpDictionaryRange( UText *inText,
             }
         }
         U_ASSERT(normalizedMap->size() == normalizedInput.length());
-        int32_t nativeEnd = inputMap.isValid() ?
-                inputMap->elementAti(inString.length()) : inString.length()+rangeStart;
+        int32_t nativeEnd = inputMap != NULL ?
+                (*inputMap)[inString.length()] : inString.length()+rangeStart;
         normalizedMap->addElement(nativeEnd, status);
 
-        inputMap = std::move(normalizedMap);
-        inString = std::move(normalizedInput);
+        inputMap = normalizedMap;
+        // Swap rather than copy, so that both strings keep their buffers.
+        inString.swap(normalizedInput);
     }
 
     int32_t numCodePts = inString.countChar32();
@@ -1217,18 +1512,16 @@ CjkBreakEngine::divideUpDictionaryRange( UText *inText,
         //   not in terms of code unit string indexes.
         // Use the inputMap mechanism to take care of this in addition to indexing differences
         //    from normalization and/or UTF-8 input.
-        UBool hadExistingMap = inputMap.isValid();
+        UBool hadExistingMap = inputMap != NULL;
         if (!hadExistingMap) {
-            inputMap.adoptInsteadAndCheckErrorCode(new UVector32(status), status);
-            if (U_FAILURE(status)) {
-                return 0;
-            }
+            inputMap = &buffers->inputMap;
+            inputMap->removeAllElements();
         }
         int32_t cpIdx = 0;
         for (int32_t cuIdx = 0; ; cuIdx = inString.moveIndex32(cuIdx, 1)) {
             U_ASSERT(cuIdx >= cpIdx);
             if (hadExistingMap) {
-                inputMap->setElementAt(inputMap->elementAti(cuIdx), cpIdx);
+                (*inputMap)[cpIdx] = (*inputMap)[cuIdx];
             } else {
                 inputMap->addElement(cuIdx+rangeStart, status);
             }
@@ -1241,25 +1534,33 @@ CjkBreakEngine::divideUpDictionaryRange( UText *inText,
                 
     // bestSnlp[i] is the snlp of the best segmentation of the first i
     // code points in the range to be matched.
-    UVector32 bestSnlp(numCodePts + 1, status);
-    bestSnlp.addElement(0, status);
+    DictionaryBreakBuffers::CjkIndexVector &bestSnlp = buffers->bestSnlp;
+    if (!bestSnlp.setSize(numCodePts + 1, status)) {
+        return 0;
+    }
+    bestSnlp[0] = 0;
     for(int32_t i = 1; i <= numCodePts; i++) {
-        bestSnlp.addElement(kuint32max, status);
+        bestSnlp[i] = kuint32max;
     }
 
 
     // prev[i] is the index of the last CJK code point in the previous word in 
     // the best segmentation of the first i characters.
-    UVector32 prev(numCodePts + 1, status);
+    DictionaryBreakBuffers::CjkIndexVector &prev = buffers->prev;
+    if (!prev.setSize(numCodePts + 1, status)) {
+        return 0;
+    }
     for(int32_t i = 0; i <= numCodePts; i++){
-        prev.addElement(-1, status);
+        prev[i] = -1;
     }
 
-    const int32_t maxWordSize = 20;
-    UVector32 values(numCodePts, status);
-    values.setSize(numCodePts);
-    UVector32 lengths(numCodePts, status);
-    lengths.setSize(numCodePts);
+    const int32_t maxWordSize = kMaxWordSize;
+    // One more than the dictionary can match, for the single-character word below.
+    DictionaryBreakBuffers::CjkIndexVector &values = buffers->values;
+    DictionaryBreakBuffers::CjkIndexVector &lengths = buffers->lengths;
+    if (!values.setSize(numCodePts + 1, status) || !lengths.setSize(numCodePts + 1, status)) {
+        return 0;
+    }
 
     UText fu = UTEXT_INITIALIZER;
     utext_openUnicodeString(&fu, &inString, &status);
@@ -1272,7 +1573,7 @@ CjkBreakEngine::divideUpDictionaryRange( UText *inText,
     int32_t ix = 0;
     bool is_prev_katakana = false;
     for (int32_t i = 0;  i < numCodePts;  ++i, ix = inString.moveIndex32(ix, 1)) {
-        if ((uint32_t)bestSnlp.elementAti(i) == kuint32max) {
+        if ((uint32_t)bestSnlp[i] == kuint32max) {
             continue;
         }
 
@@ -1288,18 +1589,18 @@ CjkBreakEngine::divideUpDictionaryRange( UText *inText,
         // with the highest value possible, i.e. the least likely to occur.
         // Exclude Korean characters from this treatment, as they should be left
         // together by default.
-        if ((count == 0 || lengths.elementAti(0) != 1) &&
+        if ((count == 0 || lengths[0] != 1) &&
                 !fHangulWordSet.contains(inString.char32At(ix))) {
-            values.setElementAt(maxSnlp, count);   // 255
-            lengths.setElementAt(1, count++);
+            values[count] = maxSnlp;   // 255
+            lengths[count++] = 1;
         }
 
         for (int32_t j = 0; j < count; j++) {
-            uint32_t newSnlp = (uint32_t)bestSnlp.elementAti(i) + (uint32_t)values.elementAti(j);
-            int32_t ln_j_i = lengths.elementAti(j) + i;
-            if (newSnlp < (uint32_t)bestSnlp.elementAti(ln_j_i)) {
-                bestSnlp.setElementAt(newSnlp, ln_j_i);
-                prev.setElementAt(i, ln_j_i);
+            uint32_t newSnlp = (uint32_t)bestSnlp[i] + (uint32_t)values[j];
+            int32_t ln_j_i = lengths[j] + i;
+            if (newSnlp < (uint32_t)bestSnlp[ln_j_i]) {
+                bestSnlp[ln_j_i] = newSnlp;
+                prev[ln_j_i] = i;
             }
         }
 
@@ -1320,10 +1621,10 @@ CjkBreakEngine::divideUpDictionaryRange( UText *inText,
                 katakanaRunLength++;
             }
             if (katakanaRunLength < kMaxKatakanaGroupLength) {
-                uint32_t newSnlp = bestSnlp.elementAti(i) + getKatakanaCost(katakanaRunLength);
-                if (newSnlp < (uint32_t)bestSnlp.elementAti(i+katakanaRunLength)) {
-                    bestSnlp.setElementAt(newSnlp, i+katakanaRunLength);
-                    prev.setElementAt(i, i+katakanaRunLength);  // prev[j] = i;
+                uint32_t newSnlp = bestSnlp[i] + getKatakanaCost(katakanaRunLength);
+                if (newSnlp < (uint32_t)bestSnlp[i+katakanaRunLength]) {
+                    bestSnlp[i+katakanaRunLength] = newSnlp;
+                    prev[i+katakanaRunLength] = i;
                 }
             }
         }
@@ -1335,19 +1636,20 @@ CjkBreakEngine::divideUpDictionaryRange( UText *inText,
     // prev[numCodePts] is guaranteed to be meaningful.
     // We'll first push in the reverse order, i.e.,
     // t_boundary[0] = numCodePts, and afterwards do a swap.
-    UVector32 t_boundary(numCodePts+1, status);
+    DictionaryBreakBuffers::CjkIndexVector &t_boundary = buffers->boundaries;
+    t_boundary.removeAllElements();
 
     int32_t numBreaks = 0;
     // No segmentation found, set boundary to end of range
-    if ((uint32_t)bestSnlp.elementAti(numCodePts) == kuint32max) {
+    if ((uint32_t)bestSnlp[numCodePts] == kuint32max) {
         t_boundary.addElement(numCodePts, status);
         numBreaks++;
     } else {
-        for (int32_t i = numCodePts; i > 0; i = prev.elementAti(i)) {
+        for (int32_t i = numCodePts; i > 0; i = prev[i]) {
             t_boundary.addElement(i, status);
             numBreaks++;
         }
-        U_ASSERT(prev.elementAti(t_boundary.elementAti(numBreaks - 1)) == 0);
+        U_ASSERT(prev[t_boundary[numBreaks - 1]] == 0);
     }
 
     // Add a break for the start of the dictionary range if there is not one
@@ -1363,9 +1665,9 @@ CjkBreakEngine::divideUpDictionaryRange( UText *inText,
     int32_t prevCPPos = -1;
     int32_t prevUTextPos = -1;
     for (int32_t i = numBreaks-1; i >= 0; i--) {
-        int32_t cpPos = t_boundary.elementAti(i);
+        int32_t cpPos = t_boundary[i];
         U_ASSERT(cpPos > prevCPPos);
-        int32_t utextPos =  inputMap.isValid() ? inputMap->elementAti(cpPos) : cpPos + rangeStart;
+        int32_t utextPos =  inputMap != NULL ? (*inputMap)[cpPos] : cpPos + rangeStart;
         U_ASSERT(utextPos >= prevUTextPos);
         if (utextPos > prevUTextPos) {
             // Boundaries are added to foundBreaks output in ascending order.
@@ -1382,10 +1684,17 @@ CjkBreakEngine::divideUpDictionaryRange( UText *inText,
     }
     (void)prevCPPos; // suppress compiler warnings about unused variable
 
-    // inString goes out of scope
-    // inputMap goes out of scope
     return numBreaks;
 }
+#else
+U_NAMESPACE_END
+
+// Without the CJK break engine there are never any tasks to run.
+U_CAPI void U_EXPORT2
+ubrk_runTask(UBreakIteratorTask * /* task */) {
+}
+
+U_NAMESPACE_BEGIN
 #endif
 
 U_NAMESPACE_END
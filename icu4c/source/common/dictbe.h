@@ -11,17 +11,57 @@
 #define DICTBE_H
 
 #include "unicode/utypes.h"
+#include "unicode/ubrk.h"
 #include "unicode/uniset.h"
 #include "unicode/utext.h"
 
 #include "brkeng.h"
+#include "cmemory.h"
 #include "uvectr32.h"
 
 U_NAMESPACE_BEGIN
 
 class DictionaryMatcher;
+class DictionaryPieceBatch;
 class Normalizer2;
 
+/*******************************************************************
+ * DictionaryBreakBuffers
+ */
+
+/**
+ * <p>Working storage for the dictionary break engines. The engines are shared
+ * between threads, so each break iterator owns one of these and passes it in;
+ * the buffers keep their capacity from call to call and steady-state
+ * segmentation does not allocate. It also carries the break iterator's
+ * executor, if any, see ubrk_setExecutor().</p>
+ */
+class DictionaryBreakBuffers : public UMemory {
+ public:
+  DictionaryBreakBuffers(UErrorCode &status);
+  ~DictionaryBreakBuffers();
+
+  // Runs the pieces of very long CjkBreakEngine ranges, or NULL.
+  UBreakIteratorExecutor *executor;
+  const void *executorContext;
+
+  typedef MaybeStackVector<int32_t, 32> CjkIndexVector;
+
+  // CjkBreakEngine: input text, its NFKC form and the normalization
+  // fragments, the maps back to native indexes, and the lattice.
+  UnicodeString inString;
+  UnicodeString normalizedInput;
+  UnicodeString fragment;
+  UnicodeString normalizedFragment;
+  CjkIndexVector inputMap;
+  CjkIndexVector normalizedMap;
+  CjkIndexVector bestSnlp;
+  CjkIndexVector prev;
+  CjkIndexVector values;
+  CjkIndexVector lengths;
+  CjkIndexVector boundaries;
+};
+
 /*******************************************************************
  * DictionaryBreakEngine
  */
@@ -73,12 +113,14 @@ class DictionaryBreakEngine : public LanguageBreakEngine {
    * @param startPos The start of the run within the supplied text.
    * @param endPos The end of the run within the supplied text.
    * @param foundBreaks vector of int32_t to receive the break positions
+   * @param buffers Working storage to reuse from call to call, or NULL
    * @return The number of breaks found.
    */
   virtual int32_t findBreaks( UText *text,
                               int32_t startPos,
                               int32_t endPos,
-                              UVector32 &foundBreaks ) const;
+                              UVector32 &foundBreaks,
+                              DictionaryBreakBuffers *buffers ) const;
 
  protected:
 
@@ -96,12 +138,14 @@ class DictionaryBreakEngine : public LanguageBreakEngine {
   * @param rangeStart The start of the range of dictionary characters
   * @param rangeEnd The end of the range of dictionary characters
   * @param foundBreaks Output of C array of int32_t break positions, or 0
+  * @param buffers Working storage to reuse from call to call, or NULL
   * @return The number of breaks found
   */
   virtual int32_t divideUpDictionaryRange( UText *text,
                                            int32_t rangeStart,
                                            int32_t rangeEnd,
-                                           UVector32 &foundBreaks ) const = 0;
+                                           UVector32 &foundBreaks,
+                                           DictionaryBreakBuffers *buffers ) const = 0;
 
 };
 
@@ -153,12 +197,14 @@ class ThaiBreakEngine : public DictionaryBreakEngine {
   * @param rangeStart The start of the range of dictionary characters
   * @param rangeEnd The end of the range of dictionary characters
   * @param foundBreaks Output of C array of int32_t break positions, or 0
+  * @param buffers Working storage to reuse from call to call, or NULL
   * @return The number of breaks found
   */
   virtual int32_t divideUpDictionaryRange( UText *text,
                                            int32_t rangeStart,
                                            int32_t rangeEnd,
-                                           UVector32 &foundBreaks ) const;
+                                           UVector32 &foundBreaks,
+                                           DictionaryBreakBuffers *buffers ) const;
 
 };
 
@@ -209,12 +255,14 @@ class LaoBreakEngine : public DictionaryBreakEngine {
   * @param rangeStart The start of the range of dictionary characters
   * @param rangeEnd The end of the range of dictionary characters
   * @param foundBreaks Output of C array of int32_t break positions, or 0
+  * @param buffers Working storage to reuse from call to call, or NULL
   * @return The number of breaks found
   */
   virtual int32_t divideUpDictionaryRange( UText *text,
                                            int32_t rangeStart,
                                            int32_t rangeEnd,
-                                           UVector32 &foundBreaks ) const;
+                                           UVector32 &foundBreaks,
+                                           DictionaryBreakBuffers *buffers ) const;
 
 };
 
@@ -265,12 +313,14 @@ class BurmeseBreakEngine : public DictionaryBreakEngine {
   * @param rangeStart The start of the range of dictionary characters 
   * @param rangeEnd The end of the range of dictionary characters 
   * @param foundBreaks Output of C array of int32_t break positions, or 0 
+  * @param buffers Working storage to reuse from call to call, or NULL 
   * @return The number of breaks found 
   */ 
   virtual int32_t divideUpDictionaryRange( UText *text, 
                                            int32_t rangeStart, 
                                            int32_t rangeEnd, 
-                                           UVector32 &foundBreaks ) const; 
+                                           UVector32 &foundBreaks, 
+                                           DictionaryBreakBuffers *buffers ) const; 
  
 }; 
  
@@ -321,12 +371,14 @@ class KhmerBreakEngine : public DictionaryBreakEngine {
   * @param rangeStart The start of the range of dictionary characters 
   * @param rangeEnd The end of the range of dictionary characters 
   * @param foundBreaks Output of C array of int32_t break positions, or 0 
+  * @param buffers Working storage to reuse from call to call, or NULL 
   * @return The number of breaks found 
   */ 
   virtual int32_t divideUpDictionaryRange( UText *text, 
                                            int32_t rangeStart, 
                                            int32_t rangeEnd, 
-                                           UVector32 &foundBreaks ) const; 
+                                           UVector32 &foundBreaks, 
+                                           DictionaryBreakBuffers *buffers ) const; 
  
 }; 
  
@@ -385,12 +437,69 @@ class CjkBreakEngine : public DictionaryBreakEngine {
      * @param rangeStart The start of the range of dictionary characters
      * @param rangeEnd The end of the range of dictionary characters
      * @param foundBreaks Output of C array of int32_t break positions, or 0
+     * @param buffers Working storage to reuse from call to call, or NULL
      * @return The number of breaks found
      */
   virtual int32_t divideUpDictionaryRange( UText *text,
           int32_t rangeStart,
           int32_t rangeEnd,
-          UVector32 &foundBreaks ) const;
+          UVector32 &foundBreaks,
+          DictionaryBreakBuffers *buffers ) const;
+
+ private:
+  friend class DictionaryPieceBatch;
+
+    /**
+     * <p>Segment a dictionary range, or one piece of it, with the lattice search.
+     * divideUpDictionaryRange() calls this once for normal-size ranges, and
+     * once per piece through the executor for very long ones.</p>
+     *
+     * @param text A UText representing the text
+     * @param rangeStart The start of the piece
+     * @param rangeEnd The end of the piece
+     * @param foundBreaks Output of C array of int32_t break positions
+     * @param buffers Working storage to reuse from call to call, or NULL
+     * @return The number of breaks found
+     */
+  int32_t segmentRange( UText *text,
+          int32_t rangeStart,
+          int32_t rangeEnd,
+          UVector32 &foundBreaks,
+          DictionaryBreakBuffers *buffers ) const;
+
+    /**
+     * <p>Find where to end a piece of a very long dictionary range.
+     * Looks backwards from the target for a position where isSafePieceLimit()
+     * holds.</p>
+     *
+     * @param text A UText representing the text
+     * @param pieceStart The start of the piece; the cut is always after it
+     * @param target The preferred end of the piece
+     * @param rangeEnd The end of the range
+     * @return The native index at which to end the piece, or -1 if there is
+     * no safe one near the target
+     */
+  int32_t findPieceLimit( UText *text,
+          int32_t pieceStart,
+          int32_t target,
+          int32_t rangeEnd ) const;
+
+    /**
+     * <p>Check whether segmenting a range in two pieces that meet at limit
+     * gives the same boundaries as segmenting it at once: limit starts a
+     * normalization fragment, no dictionary word and no Katakana run crosses
+     * it, and it is not next to a Hangul syllable.</p>
+     *
+     * @param text A UText representing the text
+     * @param pieceStart The start of the piece, itself a safe limit or the start of the range
+     * @param limit The candidate end of the piece, on a code point boundary
+     * @param rangeEnd The end of the range
+     * @return TRUE if the range can be cut at limit
+     */
+  UBool isSafePieceLimit( UText *text,
+          int32_t pieceStart,
+          int32_t limit,
+          int32_t rangeEnd ) const;
 
 };
 
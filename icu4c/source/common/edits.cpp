@@ -206,6 +206,52 @@ void Edits::addReplace(int32_t oldLength, int32_t newLength) {
     }
 }
 
+void Edits::addRepeatedReplace(int32_t oldLength, int32_t newLength, int32_t count) {
+    if(U_FAILURE(errorCode_) || count == 0) { return; }
+    if(count < 0) {
+        errorCode_ = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    if(count == 1 || !(0 < oldLength && oldLength <= MAX_SHORT_CHANGE_OLD_LENGTH &&
+            0 <= newLength && newLength <= MAX_SHORT_CHANGE_NEW_LENGTH)) {
+        // Long or invalid changes: one at a time.
+        do {
+            addReplace(oldLength, newLength);
+        } while(--count > 0);
+        return;
+    }
+    int64_t newDelta = (int64_t)delta + (int64_t)(newLength - oldLength) * count;
+    if(newDelta < INT32_MIN || INT32_MAX < newDelta) {
+        // Integer overflow or underflow.
+        errorCode_ = U_INDEX_OUTOFBOUNDS_ERROR;
+        return;
+    }
+    numChanges += count;
+    delta = (int32_t)newDelta;
+
+    // Fill the previous same-lengths short-replacement record, if any,
+    // then append full records of SHORT_CHANGE_NUM_MASK+1 changes each.
+    int32_t u = (oldLength << 12) | (newLength << 9);
+    int32_t last = lastUnit();
+    if(MAX_UNCHANGED < last && last < MAX_SHORT_CHANGE &&
+            (last & ~SHORT_CHANGE_NUM_MASK) == u) {
+        int32_t remaining = SHORT_CHANGE_NUM_MASK - (last & SHORT_CHANGE_NUM_MASK);
+        if(remaining >= count) {
+            setLastUnit(last + count);
+            return;
+        }
+        setLastUnit(last + remaining);
+        count -= remaining;
+    }
+    while(count > SHORT_CHANGE_NUM_MASK) {
+        append(u | SHORT_CHANGE_NUM_MASK);
+        count -= SHORT_CHANGE_NUM_MASK + 1;
+    }
+    if(count > 0) {
+        append(u | (count - 1));
+    }
+}
+
 void Edits::append(int32_t r) {
     if(length < capacity || growArray()) {
         array[length++] = (uint16_t)r;
@@ -482,6 +528,7 @@ UBool Edits::Iterator::next(UBool onlyChanges, UErrorCode &errorCode) {
     int32_t u = array[index++];
     if (u <= MAX_UNCHANGED) {
         // Combine adjacent unchanged ranges.
+        changed = FALSE;
         oldLength_ = u + 1;
         while (index < length && (u = array[index]) <= MAX_UNCHANGED) {
             ++index;
@@ -20,6 +20,8 @@
 #include "ubrkimpl.h" // U_ICUDATA_BRKITR
 #include "uvector.h"
 #include "cmemory.h"
+#include "sharedobject.h"
+#include "unifiedcache.h"
 
 U_NAMESPACE_BEGIN
 
@@ -133,19 +135,21 @@ static const int32_t kAddToForward = (1<<1);
 static const UChar   kFULLSTOP = 0x002E; // '.'
 
 /**
- * Shared data for SimpleFilteredSentenceBreakIterator
+ * Shared, immutable data for SimpleFilteredSentenceBreakIterator:
+ * the serialized exception tries. Each iterator reads them through its own
+ * UCharsTrie objects, which alias these buffers without copying them.
+ * The data built from the exceptions of a locale is kept in the UnifiedCache.
  */
-class SimpleFilteredSentenceBreakData : public UMemory {
+class SimpleFilteredSentenceBreakData : public SharedObject {
 public:
-  SimpleFilteredSentenceBreakData(UCharsTrie *forwards, UCharsTrie *backwards ) 
-      : fForwardsPartialTrie(forwards), fBackwardsTrie(backwards), refcount(1) { }
-  SimpleFilteredSentenceBreakData *incr() { refcount++;  return this; }
-  SimpleFilteredSentenceBreakData *decr() { if((--refcount) <= 0) delete this; return 0; }
+  SimpleFilteredSentenceBreakData() {}
   virtual ~SimpleFilteredSentenceBreakData();
 
-  LocalPointer<UCharsTrie>    fForwardsPartialTrie; //  Has ".a" for "a.M."
-  LocalPointer<UCharsTrie>    fBackwardsTrie; //  i.e. ".srM" for Mrs.
-  int32_t                     refcount;
+  UBool hasForwardsPartialTrie() const { return !fForwardsPartialTrie.isEmpty(); }
+  UBool hasBackwardsTrie() const { return !fBackwardsTrie.isEmpty(); }
+
+  UnicodeString               fForwardsPartialTrie; //  Has ".a" for "a.M."; empty if none
+  UnicodeString               fBackwardsTrie; //  i.e. ".srM" for Mrs.; empty if none
 };
 
 SimpleFilteredSentenceBreakData::~SimpleFilteredSentenceBreakData() {}
@@ -155,11 +159,16 @@ SimpleFilteredSentenceBreakData::~SimpleFilteredSentenceBreakData() {}
  */
 class SimpleFilteredSentenceBreakIterator : public BreakIterator {
 public:
-  SimpleFilteredSentenceBreakIterator(BreakIterator *adopt, UCharsTrie *forwards, UCharsTrie *backwards, UErrorCode &status);
+  /**
+   * @param data shared exception data; the iterator adds its own reference
+   */
+  SimpleFilteredSentenceBreakIterator(BreakIterator *adopt, const SimpleFilteredSentenceBreakData *data, UErrorCode &status);
   SimpleFilteredSentenceBreakIterator(const SimpleFilteredSentenceBreakIterator& other);
   virtual ~SimpleFilteredSentenceBreakIterator();
 private:
-  SimpleFilteredSentenceBreakData *fData;
+  const SimpleFilteredSentenceBreakData *fData;
+  UCharsTrie                  fForwardsPartialTrie; //  iterates over fData->fForwardsPartialTrie
+  UCharsTrie                  fBackwardsTrie; //  iterates over fData->fBackwardsTrie
   LocalPointer<BreakIterator> fDelegate;
   LocalUTextPointer           fText;
 
@@ -234,21 +243,28 @@ class SimpleFilteredSentenceBreakIterator : public BreakIterator {
 };
 
 SimpleFilteredSentenceBreakIterator::SimpleFilteredSentenceBreakIterator(const SimpleFilteredSentenceBreakIterator& other)
-  : BreakIterator(other), fData(other.fData->incr()), fDelegate(other.fDelegate->clone())
+  : BreakIterator(other), fData(other.fData),
+    fForwardsPartialTrie(other.fData->fForwardsPartialTrie.getBuffer()),
+    fBackwardsTrie(other.fData->fBackwardsTrie.getBuffer()),
+    fDelegate(other.fDelegate->clone())
 {
+  fData->addRef();
 }
 
 
-SimpleFilteredSentenceBreakIterator::SimpleFilteredSentenceBreakIterator(BreakIterator *adopt, UCharsTrie *forwards, UCharsTrie *backwards, UErrorCode &status) :
+SimpleFilteredSentenceBreakIterator::SimpleFilteredSentenceBreakIterator(BreakIterator *adopt, const SimpleFilteredSentenceBreakData *data, UErrorCode &status) :
   BreakIterator(adopt->getLocale(ULOC_VALID_LOCALE,status),adopt->getLocale(ULOC_ACTUAL_LOCALE,status)),
-  fData(new SimpleFilteredSentenceBreakData(forwards, backwards)),
+  fData(data),
+  fForwardsPartialTrie(data->fForwardsPartialTrie.getBuffer()),
+  fBackwardsTrie(data->fBackwardsTrie.getBuffer()),
   fDelegate(adopt)
 {
-  // all set..
+  fData->addRef();
 }
 
 SimpleFilteredSentenceBreakIterator::~SimpleFilteredSentenceBreakIterator() {
-    fData = fData->decr();
+    fData->removeRef();
+    fData = NULL;
 }
 
 void SimpleFilteredSentenceBreakIterator::resetState(UErrorCode &status) {
@@ -261,7 +277,7 @@ SimpleFilteredSentenceBreakIterator::breakExceptionAt(int32_t n) {
     int32_t bestValue = -1;
     // loops while 'n' points to an exception.
     utext_setNativeIndex(fText.getAlias(), n); // from n..
-    fData->fBackwardsTrie->reset();
+    fBackwardsTrie.reset();
     UChar32 uch;
 
     //if(debug2) u_printf(" n@ %d\n", n);
@@ -278,17 +294,17 @@ SimpleFilteredSentenceBreakIterator::breakExceptionAt(int32_t n) {
     UStringTrieResult r = USTRINGTRIE_INTERMEDIATE_VALUE;
 
     while((uch=utext_previous32(fText.getAlias()))!=U_SENTINEL  &&   // more to consume backwards and..
-          USTRINGTRIE_HAS_NEXT(r=fData->fBackwardsTrie->nextForCodePoint(uch))) {// more in the trie
+          USTRINGTRIE_HAS_NEXT(r=fBackwardsTrie.nextForCodePoint(uch))) {// more in the trie
       if(USTRINGTRIE_HAS_VALUE(r)) { // remember the best match so far
         bestPosn = utext_getNativeIndex(fText.getAlias());
-        bestValue = fData->fBackwardsTrie->getValue();
+        bestValue = fBackwardsTrie.getValue();
       }
       //if(debug2) u_printf("rev< /%C/ cont?%d @%d\n", (UChar)uch, r, utext_getNativeIndex(fText.getAlias()));
     }
 
     if(USTRINGTRIE_MATCHES(r)) { // exact match?
       //if(debug2) u_printf("rev<?/%C/?end of seq.. r=%d, bestPosn=%d, bestValue=%d\n", (UChar)uch, r, bestPosn, bestValue);
-      bestValue = fData->fBackwardsTrie->getValue();
+      bestValue = fBackwardsTrie.getValue();
       bestPosn = utext_getNativeIndex(fText.getAlias());
       //if(debug2) u_printf("rev<+/%C/+end of seq.. r=%d, bestPosn=%d, bestValue=%d\n", (UChar)uch, r, bestPosn, bestValue);
     }
@@ -304,16 +320,16 @@ SimpleFilteredSentenceBreakIterator::breakExceptionAt(int32_t n) {
         //if(debug2) u_printf(" exact backward match\n");
         return kExceptionHere; // See if the next is another exception.
       } else if(bestValue == kPARTIAL
-                && fData->fForwardsPartialTrie.isValid()) { // make sure there's a forward trie
+                && fData->hasForwardsPartialTrie()) { // make sure there's a forward trie
         //if(debug2) u_printf(" partial backward match\n");
         // We matched the "Ph." in "Ph.D." - now we need to run everything through the forwards trie
         // to see if it matches something going forward.
-        fData->fForwardsPartialTrie->reset();
+        fForwardsPartialTrie.reset();
         UStringTrieResult rfwd = USTRINGTRIE_INTERMEDIATE_VALUE;
         utext_setNativeIndex(fText.getAlias(), bestPosn); // hope that's close ..
         //if(debug2) u_printf("Retrying at %d\n", bestPosn);
         while((uch=utext_next32(fText.getAlias()))!=U_SENTINEL &&
-              USTRINGTRIE_HAS_NEXT(rfwd=fData->fForwardsPartialTrie->nextForCodePoint(uch))) {
+              USTRINGTRIE_HAS_NEXT(rfwd=fForwardsPartialTrie.nextForCodePoint(uch))) {
           //if(debug2) u_printf("fwd> /%C/ cont?%d @%d\n", (UChar)uch, rfwd, utext_getNativeIndex(fText.getAlias()));
         }
         if(USTRINGTRIE_MATCHES(rfwd)) {
@@ -339,7 +355,7 @@ SimpleFilteredSentenceBreakIterator::breakExceptionAt(int32_t n) {
 int32_t
 SimpleFilteredSentenceBreakIterator::internalNext(int32_t n) {
   if(n == UBRK_DONE || // at end  or
-    fData->fBackwardsTrie.isNull()) { // .. no backwards table loaded == no exceptions
+    !fData->hasBackwardsTrie()) { // .. no backwards table loaded == no exceptions
       return n;
   }
   // OK, do we need to break here?
@@ -369,7 +385,7 @@ SimpleFilteredSentenceBreakIterator::internalNext(int32_t n) {
 int32_t
 SimpleFilteredSentenceBreakIterator::internalPrev(int32_t n) {
   if(n == 0 || n == UBRK_DONE || // at end  or
-    fData->fBackwardsTrie.isNull()) { // .. no backwards table loaded == no exceptions
+    !fData->hasBackwardsTrie()) { // .. no backwards table loaded == no exceptions
       return n;
   }
   // OK, do we need to break here?
@@ -420,7 +436,7 @@ SimpleFilteredSentenceBreakIterator::previous(void) {
 UBool SimpleFilteredSentenceBreakIterator::isBoundary(int32_t offset) {
   if (!fDelegate->isBoundary(offset)) return false; // no break to suppress
 
-  if (fData->fBackwardsTrie.isNull()) return true; // no data = no suppressions
+  if (!fData->hasBackwardsTrie()) return true; // no data = no suppressions
 
   UErrorCode status = U_ZERO_ERROR;
   resetState(status);
@@ -454,31 +470,11 @@ SimpleFilteredSentenceBreakIterator::last(void) {
 
 
 /**
- * Concrete implementation of builder class.
+ * Load the sentence break exceptions of a locale into the set.
+ * Leaves the set empty if the locale has none.
  */
-class U_COMMON_API SimpleFilteredBreakIteratorBuilder : public FilteredBreakIteratorBuilder {
-public:
-  virtual ~SimpleFilteredBreakIteratorBuilder();
-  SimpleFilteredBreakIteratorBuilder(const Locale &fromLocale, UErrorCode &status);
-  SimpleFilteredBreakIteratorBuilder(UErrorCode &status);
-  virtual UBool suppressBreakAfter(const UnicodeString& exception, UErrorCode& status);
-  virtual UBool unsuppressBreakAfter(const UnicodeString& exception, UErrorCode& status);
-  virtual BreakIterator *build(BreakIterator* adoptBreakIterator, UErrorCode& status);
-private:
-  UStringSet fSet;
-};
-
-SimpleFilteredBreakIteratorBuilder::~SimpleFilteredBreakIteratorBuilder()
-{
-}
-
-SimpleFilteredBreakIteratorBuilder::SimpleFilteredBreakIteratorBuilder(UErrorCode &status) 
-  : fSet(status)
-{
-}
-
-SimpleFilteredBreakIteratorBuilder::SimpleFilteredBreakIteratorBuilder(const Locale &fromLocale, UErrorCode &status)
-  : fSet(status)
+static void
+loadExceptions(const Locale &fromLocale, UStringSet &set, UErrorCode &status)
 {
   if(U_SUCCESS(status)) {
     UErrorCode subStatus = U_ZERO_ERROR;
@@ -521,7 +517,7 @@ SimpleFilteredBreakIteratorBuilder::SimpleFilteredBreakIteratorBuilder(const Loc
       strs.adoptInstead(ures_getNextResource(breaks.getAlias(), strs.orphan(), &subStatus));
       if(strs.isValid() && U_SUCCESS(subStatus)) {
         UnicodeString str(ures_getUnicodeString(strs.getAlias(), &status));
-        suppressBreakAfter(str, status); // load the string
+        set.add(str, status); // load the string
       }
     } while (strs.isValid() && U_SUCCESS(subStatus));
     if(U_FAILURE(subStatus)&&subStatus!=U_INDEX_OUTOFBOUNDS_ERROR&&U_SUCCESS(status)) {
@@ -530,21 +526,6 @@ SimpleFilteredBreakIteratorBuilder::SimpleFilteredBreakIteratorBuilder(const Loc
   }
 }
 
-UBool
-SimpleFilteredBreakIteratorBuilder::suppressBreakAfter(const UnicodeString& exception, UErrorCode& status)
-{
-  UBool r = fSet.add(exception, status);
-  FB_TRACE("suppressBreakAfter",&exception,r,0);
-  return r;
-}
-
-UBool
-SimpleFilteredBreakIteratorBuilder::unsuppressBreakAfter(const UnicodeString& exception, UErrorCode& status)
-{
-  UBool r = fSet.remove(exception, status);
-  FB_TRACE("unsuppressBreakAfter",&exception,r,0);
-  return r;
-}
 
 /**
  * Jitterbug 2974: MSVC has a bug whereby new X[0] behaves badly.
@@ -557,10 +538,8 @@ static inline UnicodeString* newUnicodeStringArray(size_t count) {
     return new UnicodeString[count ? count : 1];
 }
 
-BreakIterator *
-SimpleFilteredBreakIteratorBuilder::build(BreakIterator* adoptBreakIterator, UErrorCode& status) {
-  LocalPointer<BreakIterator> adopt(adoptBreakIterator);
-
+static SimpleFilteredSentenceBreakData *
+buildData(const UStringSet &set, UErrorCode& status) {
   LocalPointer<UCharsTrieBuilder> builder(new UCharsTrieBuilder(status), status);
   LocalPointer<UCharsTrieBuilder> builder2(new UCharsTrieBuilder(status), status);
   if(U_FAILURE(status)) {
@@ -570,7 +549,7 @@ SimpleFilteredBreakIteratorBuilder::build(BreakIterator* adoptBreakIterator, UEr
   int32_t revCount = 0;
   int32_t fwdCount = 0;
 
-  int32_t subCount = fSet.size();
+  int32_t subCount = set.size();
 
   UnicodeString *ustrs_ptr = newUnicodeStringArray(subCount);
   
@@ -579,14 +558,17 @@ SimpleFilteredBreakIteratorBuilder::build(BreakIterator* adoptBreakIterator, UEr
   LocalMemory<int> partials;
   partials.allocateInsteadAndReset(subCount);
 
-  LocalPointer<UCharsTrie>    backwardsTrie; //  i.e. ".srM" for Mrs.
-  LocalPointer<UCharsTrie>    forwardsPartialTrie; //  Has ".a" for "a.M."
+  LocalPointer<SimpleFilteredSentenceBreakData> data(new SimpleFilteredSentenceBreakData(), status);
+  if(U_FAILURE(status)) {
+    return NULL;
+  }
+  UnicodeString serialized;
 
   int n=0;
   for ( int32_t i = 0;
-        i<fSet.size();
+        i<set.size();
         i++) {
-    const UnicodeString *abbr = fSet.getStringAt(i);
+    const UnicodeString *abbr = set.getStringAt(i);
     if(abbr) {
       FB_TRACE("build",abbr,TRUE,i);
       ustrs[n] = *abbr; // copy by value
@@ -658,8 +640,9 @@ SimpleFilteredBreakIteratorBuilder::build(BreakIterator* adoptBreakIterator, UEr
   }
   FB_TRACE("AbbrCount",NULL,FALSE, subCount);
 
+  // Assignment copies each trie out of the builder's array.
   if(revCount>0) {
-    backwardsTrie.adoptInstead(builder->build(USTRINGTRIE_BUILD_FAST, status));
+    data->fBackwardsTrie = builder->buildUnicodeString(USTRINGTRIE_BUILD_FAST, serialized, status);
     if(U_FAILURE(status)) {
       FB_TRACE(u_errorName(status),NULL,FALSE, -1);
       return NULL;
@@ -667,16 +650,135 @@ SimpleFilteredBreakIteratorBuilder::build(BreakIterator* adoptBreakIterator, UEr
   }
 
   if(fwdCount>0) {
-    forwardsPartialTrie.adoptInstead(builder2->build(USTRINGTRIE_BUILD_FAST, status));
+    data->fForwardsPartialTrie = builder2->buildUnicodeString(USTRINGTRIE_BUILD_FAST, serialized, status);
     if(U_FAILURE(status)) {
       FB_TRACE(u_errorName(status),NULL,FALSE, -1);
       return NULL;
     }
   }
 
-  return new SimpleFilteredSentenceBreakIterator(adopt.orphan(), forwardsPartialTrie.orphan(), backwardsTrie.orphan(), status);
+  return data.orphan();
 }
 
+template<>
+const SimpleFilteredSentenceBreakData *LocaleCacheKey<SimpleFilteredSentenceBreakData>::createObject(
+        const void * /*unused*/, UErrorCode &status) const {
+  UStringSet set(status);
+  loadExceptions(fLoc, set, status);
+  if(U_FAILURE(status)) {
+    return NULL;
+  }
+  SimpleFilteredSentenceBreakData *result = buildData(set, status);
+  if(U_FAILURE(status)) {
+    return NULL;
+  }
+  result->addRef();
+  return result;
+}
+
+/**
+ * Concrete implementation of builder class.
+ */
+class U_COMMON_API SimpleFilteredBreakIteratorBuilder : public FilteredBreakIteratorBuilder {
+public:
+  virtual ~SimpleFilteredBreakIteratorBuilder();
+  SimpleFilteredBreakIteratorBuilder(const Locale &fromLocale, UErrorCode &status);
+  SimpleFilteredBreakIteratorBuilder(UErrorCode &status);
+  virtual UBool suppressBreakAfter(const UnicodeString& exception, UErrorCode& status);
+  virtual UBool unsuppressBreakAfter(const UnicodeString& exception, UErrorCode& status);
+  virtual BreakIterator *build(BreakIterator* adoptBreakIterator, UErrorCode& status);
+private:
+  /**
+   * Replace the cached locale data with a modifiable set of its exceptions.
+   */
+  void copyLocaleExceptions(UErrorCode &status);
+
+  UStringSet fSet;
+  Locale fLocale;
+  /**
+   * Until the exceptions are modified, a builder for a locale uses
+   * the cached data built from them, and fSet stays empty.
+   */
+  const SimpleFilteredSentenceBreakData *fLocaleData;
+};
+
+SimpleFilteredBreakIteratorBuilder::~SimpleFilteredBreakIteratorBuilder()
+{
+  if(fLocaleData != NULL) {
+    fLocaleData->removeRef();
+  }
+}
+
+SimpleFilteredBreakIteratorBuilder::SimpleFilteredBreakIteratorBuilder(UErrorCode &status) 
+  : fSet(status), fLocaleData(NULL)
+{
+}
+
+SimpleFilteredBreakIteratorBuilder::SimpleFilteredBreakIteratorBuilder(const Locale &fromLocale, UErrorCode &status)
+  : fSet(status), fLocale(fromLocale.getBaseName()), fLocaleData(NULL)
+{
+  if(U_SUCCESS(status)) {
+    UnifiedCache::getByLocale(fLocale, fLocaleData, status);
+  }
+}
+
+void
+SimpleFilteredBreakIteratorBuilder::copyLocaleExceptions(UErrorCode &status)
+{
+  if(fLocaleData == NULL || U_FAILURE(status)) {
+    return;
+  }
+  fLocaleData->removeRef();
+  fLocaleData = NULL;
+  UErrorCode subStatus = U_ZERO_ERROR;
+  loadExceptions(fLocale, fSet, subStatus);
+  if(U_FAILURE(subStatus)) {
+    status = subStatus;
+  }
+}
+
+UBool
+SimpleFilteredBreakIteratorBuilder::suppressBreakAfter(const UnicodeString& exception, UErrorCode& status)
+{
+  copyLocaleExceptions(status);
+  UBool r = fSet.add(exception, status);
+  FB_TRACE("suppressBreakAfter",&exception,r,0);
+  return r;
+}
+
+UBool
+SimpleFilteredBreakIteratorBuilder::unsuppressBreakAfter(const UnicodeString& exception, UErrorCode& status)
+{
+  copyLocaleExceptions(status);
+  UBool r = fSet.remove(exception, status);
+  FB_TRACE("unsuppressBreakAfter",&exception,r,0);
+  return r;
+}
+
+BreakIterator *
+SimpleFilteredBreakIteratorBuilder::build(BreakIterator* adoptBreakIterator, UErrorCode& status) {
+  LocalPointer<BreakIterator> adopt(adoptBreakIterator);
+  if(U_FAILURE(status)) {
+    return NULL;
+  }
+
+  const SimpleFilteredSentenceBreakData *data = fLocaleData;
+  if(data == NULL) {
+    data = buildData(fSet, status);
+    if(U_FAILURE(status)) {
+      return NULL;
+    }
+  }
+  data->addRef(); // keep alive until the iterator holds its own reference
+  BreakIterator *result = new SimpleFilteredSentenceBreakIterator(adopt.getAlias(), data, status);
+  data->removeRef();
+  if(result == NULL) {
+    status = U_MEMORY_ALLOCATION_ERROR;
+    return NULL;
+  }
+  adopt.orphan();
+  return result;
+}
 
 // ----------- Base class implementation
 
@@ -27,6 +27,7 @@
 #include "normalizer2impl.h"
 #include "uassert.h"
 #include "ucln_cmn.h"
+#include "ucounterimp.h"
 #include "uhash.h"
 
 U_NAMESPACE_BEGIN
@@ -144,6 +145,7 @@ static Norm2AllModes *nfkc_cfSingleton;
 static icu::UInitOnce nfkc_cfInitOnce = U_INITONCE_INITIALIZER;
 
 static UHashtable    *cache=NULL;
+static UMutex         cacheMutex;
 
 // UInitOnce singleton initialization function
 static void U_CALLCONV initSingletons(const char *what, UErrorCode &errorCode) {
@@ -194,6 +196,7 @@ U_CDECL_END
 const Norm2AllModes *
 Norm2AllModes::getNFCInstance(UErrorCode &errorCode) {
     if(U_FAILURE(errorCode)) { return NULL; }
+    UCOUNTER_INC(UCOUNTER_NORMALIZER2_FETCHES);
     umtx_initOnce(nfcInitOnce, &initSingletons, "nfc", errorCode);
     return nfcSingleton;
 }
@@ -202,6 +205,7 @@ Norm2AllModes::getNFCInstance(UErrorCode &errorCode) {
 const Norm2AllModes *
 Norm2AllModes::getNFKCInstance(UErrorCode &errorCode) {
     if(U_FAILURE(errorCode)) { return NULL; }
+    UCOUNTER_INC(UCOUNTER_NORMALIZER2_FETCHES);
     umtx_initOnce(nfkcInitOnce, &initSingletons, "nfkc", errorCode);
     return nfkcSingleton;
 }
@@ -209,6 +213,7 @@ Norm2AllModes::getNFKCInstance(UErrorCode &errorCode) {
 const Norm2AllModes *
 Norm2AllModes::getNFKC_CFInstance(UErrorCode &errorCode) {
     if(U_FAILURE(errorCode)) { return NULL; }
+    UCOUNTER_INC(UCOUNTER_NORMALIZER2_FETCHES);
     umtx_initOnce(nfkc_cfInitOnce, &initSingletons, "nfkc_cf", errorCode);
     return nfkc_cfSingleton;
 }
@@ -284,8 +289,9 @@ Normalizer2::getInstance(const char *packageName,
         }
     }
     if(allModes==NULL && U_SUCCESS(errorCode)) {
+        UCOUNTER_INC(UCOUNTER_NORMALIZER2_FETCHES);
         {
-            Mutex lock;
+            Mutex lock(&cacheMutex);
             if(cache!=NULL) {
                 allModes=(Norm2AllModes *)uhash_get(cache, name);
             }
@@ -295,7 +301,7 @@ Normalizer2::getInstance(const char *packageName,
             LocalPointer<Norm2AllModes> localAllModes(
                 Norm2AllModes::createInstance(packageName, name, errorCode));
             if(U_SUCCESS(errorCode)) {
-                Mutex lock;
+                Mutex lock(&cacheMutex);
                 if(cache==NULL) {
                     cache=uhash_open(uhash_hashChars, uhash_compareChars, NULL, &errorCode);
                     if(U_FAILURE(errorCode)) {
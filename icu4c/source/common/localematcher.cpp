@@ -0,0 +1,250 @@
+// © 2019 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html#License
+
+// localematcher.cpp
+
+#include "unicode/utypes.h"
+#include "unicode/localematcher.h"
+#include "unicode/locid.h"
+#include "unicode/stringpiece.h"
+#include "charstr.h"
+#include "cmemory.h"
+#include "cstring.h"
+#include "uarrsort.h"
+#include "uhash.h"
+
+U_NAMESPACE_BEGIN
+
+namespace {
+
+/**
+ * Maximizes the locale and writes its "lang_Script_REGION" key.
+ * @return FALSE if the locale has no language after maximization
+ */
+UBool getMaximizedKey(const Locale &locale, CharString &key, UErrorCode &errorCode) {
+    Locale max(locale);
+    max.addLikelySubtags(errorCode);
+    if (U_FAILURE(errorCode) || max.isBogus() || *max.getLanguage() == 0) {
+        return FALSE;
+    }
+    key.clear().append(max.getLanguage(), errorCode).
+        append('_', errorCode).append(max.getScript(), errorCode).
+        append('_', errorCode).append(max.getCountry(), errorCode);
+    return U_SUCCESS(errorCode);
+}
+
+struct DesiredItem {
+    int32_t weight;  // q value times 1000
+    int32_t start;
+    int32_t length;
+};
+
+int32_t U_CALLCONV
+compareDesiredItems(const void * /*context*/, const void *left, const void *right) {
+    // Higher weights first.
+    return ((const DesiredItem *)right)->weight - ((const DesiredItem *)left)->weight;
+}
+
+inline UBool isSpace(char c) {
+    return c == ' ' || c == '\t';
+}
+
+/**
+ * Parses an Accept-Language q value like "0.8" or "1.000" into 0..1000.
+ * @return the weight, or -1 if the value is malformed
+ */
+int32_t parseWeight(const char *s, const char *limit) {
+    if (s == limit || (*s != '0' && *s != '1')) {
+        return -1;
+    }
+    int32_t weight = (*s++ - '0') * 1000;
+    if (s != limit && *s == '.') {
+        ++s;
+        int32_t factor = 100;
+        for (; s != limit && '0' <= *s && *s <= '9' && factor > 0; ++s, factor /= 10) {
+            weight += (*s - '0') * factor;
+        }
+    }
+    if (s != limit || weight > 1000) {
+        return -1;
+    }
+    return weight;
+}
+
+}  // namespace
+
+LocaleMatcher::LocaleMatcher(const Locale *locales, int32_t length, UErrorCode &errorCode) :
+        supportedLocales(nullptr), supportedLength(0), supportedIndexes(nullptr) {
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    if (length < 0 || (locales == nullptr && length > 0)) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    supportedIndexes = uhash_open(uhash_hashChars, uhash_compareChars, nullptr, &errorCode);
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    uhash_setKeyDeleter(supportedIndexes, uprv_free);
+    if (length == 0) {
+        return;
+    }
+    supportedLocales = new Locale[length];
+    LocalMemory<UBool> isLikely;
+    if (supportedLocales == nullptr || isLikely.allocateInsteadAndReset(length) == nullptr) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    supportedLength = length;
+    CharString key, likelyKey;
+    for (int32_t i = 0; i < length; ++i) {
+        supportedLocales[i] = locales[i];
+        if (!getMaximizedKey(locales[i], key, errorCode)) {
+            if (U_FAILURE(errorCode)) {
+                return;
+            }
+            continue;
+        }
+        if (uhash_geti(supportedIndexes, key.data()) == 0) {
+            uhash_puti(supportedIndexes, uprv_strdup(key.data()), i + 1, &errorCode);
+        }
+        // Does the locale have the likely region for its language and script?
+        int32_t langScriptLength = (int32_t)(uprv_strrchr(key.data(), '_') - key.data());
+        CharString langScript(key.data(), langScriptLength, errorCode);
+        if (U_FAILURE(errorCode) ||
+                !getMaximizedKey(Locale(langScript.data()), likelyKey, errorCode)) {
+            if (U_FAILURE(errorCode)) {
+                return;
+            }
+            continue;
+        }
+        isLikely[i] = uprv_strcmp(key.data(), likelyKey.data()) == 0;
+        // The first locale with the likely region wins,
+        // otherwise the first locale with the language and script.
+        int32_t prev = uhash_geti(supportedIndexes, langScript.data());
+        if (prev == 0) {
+            uhash_puti(supportedIndexes, uprv_strdup(langScript.data()), i + 1, &errorCode);
+        } else if (isLikely[i] && !isLikely[prev - 1]) {
+            uhash_puti(supportedIndexes, uprv_strdup(langScript.data()), i + 1, &errorCode);
+        }
+        if (U_FAILURE(errorCode)) {
+            return;
+        }
+    }
+}
+
+LocaleMatcher::~LocaleMatcher() {
+    delete[] supportedLocales;
+    uhash_close(supportedIndexes);
+}
+
+int32_t LocaleMatcher::getBestMatchIndex(const Locale &desiredLocale,
+                                         UErrorCode &errorCode) const {
+    CharString key;
+    if (supportedLength == 0 || !getMaximizedKey(desiredLocale, key, errorCode)) {
+        return -1;
+    }
+    int32_t index = uhash_geti(supportedIndexes, key.data());
+    if (index == 0) {
+        key.truncate((int32_t)(uprv_strrchr(key.data(), '_') - key.data()));
+        index = uhash_geti(supportedIndexes, key.data());
+    }
+    return index - 1;
+}
+
+const Locale *LocaleMatcher::getBestMatch(const Locale &desiredLocale,
+                                          UErrorCode &errorCode) const {
+    return getBestMatch(&desiredLocale, 1, errorCode);
+}
+
+const Locale *LocaleMatcher::getBestMatch(const Locale *desiredLocales, int32_t length,
+                                          UErrorCode &errorCode) const {
+    if (U_FAILURE(errorCode)) {
+        return nullptr;
+    }
+    if (length < 0 || (desiredLocales == nullptr && length > 0)) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return nullptr;
+    }
+    for (int32_t i = 0; i < length; ++i) {
+        int32_t index = getBestMatchIndex(desiredLocales[i], errorCode);
+        if (U_FAILURE(errorCode)) {
+            return nullptr;
+        }
+        if (index >= 0) {
+            return supportedLocales + index;
+        }
+    }
+    return nullptr;
+}
+
+const Locale *LocaleMatcher::getBestMatchForListString(StringPiece desiredLocaleList,
+                                                       UErrorCode &errorCode) const {
+    if (U_FAILURE(errorCode)) {
+        return nullptr;
+    }
+    // Split the list into tags and weights.
+    MaybeStackArray<DesiredItem, 8> items;
+    int32_t count = 0;
+    const char *list = desiredLocaleList.data();
+    const char *p = list;
+    const char *limit = p + desiredLocaleList.length();
+    while (p != limit) {
+        while (p != limit && (isSpace(*p) || *p == ',')) { ++p; }
+        const char *start = p;
+        while (p != limit && !isSpace(*p) && *p != ',' && *p != ';') { ++p; }
+        const char *tagLimit = p;
+        int32_t weight = 1000;
+        while (p != limit && *p != ',') {
+            // Parameters: ;q=0.5
+            while (p != limit && (isSpace(*p) || *p == ';')) { ++p; }
+            const char *paramStart = p;
+            while (p != limit && *p != ',' && *p != ';') { ++p; }
+            const char *paramLimit = p;
+            while (paramLimit != paramStart && isSpace(paramLimit[-1])) { --paramLimit; }
+            if (paramStart != paramLimit && (*paramStart == 'q' || *paramStart == 'Q')) {
+                const char *q = paramStart + 1;
+                while (q != paramLimit && isSpace(*q)) { ++q; }
+                if (q != paramLimit && *q == '=') {
+                    ++q;
+                    while (q != paramLimit && isSpace(*q)) { ++q; }
+                    weight = parseWeight(q, paramLimit);
+                }
+            }
+        }
+        if (start == tagLimit || weight <= 0 ||
+                (tagLimit - start == 1 && *start == '*')) {
+            continue;
+        }
+        if (count == items.getCapacity() && items.resize(2 * count, count) == nullptr) {
+            errorCode = U_MEMORY_ALLOCATION_ERROR;
+            return nullptr;
+        }
+        DesiredItem &item = items[count++];
+        item.weight = weight;
+        item.start = (int32_t)(start - list);
+        item.length = (int32_t)(tagLimit - start);
+    }
+    uprv_sortArray(items.getAlias(), count, (int32_t)sizeof(DesiredItem),
+                   compareDesiredItems, nullptr, /*sortStable=*/TRUE, &errorCode);
+    // Convert and match the tags lazily, in order of preference.
+    for (int32_t i = 0; i < count && U_SUCCESS(errorCode); ++i) {
+        UErrorCode tagErrorCode = U_ZERO_ERROR;
+        Locale desired = Locale::forLanguageTag(
+            StringPiece(list + items[i].start, items[i].length), tagErrorCode);
+        if (U_FAILURE(tagErrorCode)) {
+            if (tagErrorCode == U_MEMORY_ALLOCATION_ERROR) {
+                errorCode = tagErrorCode;
+            }
+            continue;
+        }
+        int32_t index = getBestMatchIndex(desired, errorCode);
+        if (U_SUCCESS(errorCode) && index >= 0) {
+            return supportedLocales + index;
+        }
+    }
+    return nullptr;
+}
+
+U_NAMESPACE_END
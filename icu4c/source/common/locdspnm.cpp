@@ -20,6 +20,7 @@
 #include "unicode/ucurr.h"
 #include "cmemory.h"
 #include "cstring.h"
+#include "hash.h"
 #include "mutex.h"
 #include "ulocimp.h"
 #include "umutex.h"
@@ -63,9 +64,17 @@ U_NAMESPACE_BEGIN
 
 // Access resource data for locale components.
 // Wrap code in uloc.c for now.
+// Resolved items are cached per table: A language picker asks for hundreds of
+// names, and each uncached lookup opens the bundle and walks the fallback chain.
 class ICUDataTable {
     const char* path;
     Locale locale;
+    // Maps tableKey/subTableKey/itemKey to the item string,
+    // or to a bogus string if there is no such item. Guarded by cacheMutex.
+    mutable Hashtable* cache;
+
+    UBool lookup(const char* tableKey, const char* subTableKey, const char* itemKey,
+                 UnicodeString& result) const;
 
 public:
     ICUDataTable(const char* path, const Locale& locale);
@@ -95,7 +104,7 @@ ICUDataTable::getNoFallback(const char* tableKey, const char* itemKey, UnicodeSt
 }
 
 ICUDataTable::ICUDataTable(const char* path, const Locale& locale)
-    : path(NULL), locale(Locale::getRoot())
+    : path(NULL), locale(Locale::getRoot()), cache(NULL)
 {
   if (path) {
     int32_t len = static_cast<int32_t>(uprv_strlen(path));
@@ -112,6 +121,7 @@ ICUDataTable::~ICUDataTable() {
     uprv_free((void*) path);
     path = NULL;
   }
+  delete cache;
 }
 
 const Locale&
@@ -119,17 +129,65 @@ ICUDataTable::getLocale() {
   return locale;
 }
 
-UnicodeString &
-ICUDataTable::get(const char* tableKey, const char* subTableKey, const char* itemKey,
-                  UnicodeString &result) const {
+static UMutex cacheMutex;
+
+UBool
+ICUDataTable::lookup(const char* tableKey, const char* subTableKey, const char* itemKey,
+                     UnicodeString &result) const {
+  // The key parts are invariant-character strings without NULs,
+  // so NUL separators keep the combined keys distinct.
+  UnicodeString key(tableKey, -1, US_INV);
+  key.append((UChar)0);
+  if (subTableKey != NULL) {
+    key.append(UnicodeString(subTableKey, -1, US_INV));
+  }
+  key.append((UChar)0).append(UnicodeString(itemKey, -1, US_INV));
+  {
+    Mutex lock(&cacheMutex);
+    if (cache != NULL) {
+      const UnicodeString *value = static_cast<const UnicodeString *>(cache->get(key));
+      if (value != NULL) {
+        result = *value;
+        return !result.isBogus();
+      }
+    }
+  }
+
   UErrorCode status = U_ZERO_ERROR;
   int32_t len = 0;
-
   const UChar *s = uloc_getTableStringWithFallback(path, locale.getName(),
                                                    tableKey, subTableKey, itemKey,
                                                    &len, &status);
-  if (U_SUCCESS(status) && len > 0) {
-    return result.setTo(s, len);
+  if (U_SUCCESS(status)) {
+    result.setTo(s, len);
+  } else {
+    result.setToBogus();
+  }
+
+  Mutex lock(&cacheMutex);
+  UErrorCode cacheStatus = U_ZERO_ERROR;
+  if (cache == NULL) {
+    LocalPointer<Hashtable> newCache(new Hashtable(cacheStatus), cacheStatus);
+    if (U_FAILURE(cacheStatus)) {
+      return U_SUCCESS(status);
+    }
+    newCache->setValueDeleter(uprv_deleteUObject);
+    cache = newCache.orphan();
+  }
+  if (cache->get(key) == NULL) {
+    UnicodeString *value = new UnicodeString(result);
+    if (value != NULL) {
+      cache->put(key, value, cacheStatus);
+    }
+  }
+  return U_SUCCESS(status);
+}
+
+UnicodeString &
+ICUDataTable::get(const char* tableKey, const char* subTableKey, const char* itemKey,
+                  UnicodeString &result) const {
+  if (lookup(tableKey, subTableKey, itemKey, result) && !result.isEmpty()) {
+    return result;
   }
   return result.setTo(UnicodeString(itemKey, -1, US_INV));
 }
@@ -137,17 +195,7 @@ ICUDataTable::get(const char* tableKey, const char* subTableKey, const char* ite
 UnicodeString &
 ICUDataTable::getNoFallback(const char* tableKey, const char* subTableKey, const char* itemKey,
                             UnicodeString& result) const {
-  UErrorCode status = U_ZERO_ERROR;
-  int32_t len = 0;
-
-  const UChar *s = uloc_getTableStringWithFallback(path, locale.getName(),
-                                                   tableKey, subTableKey, itemKey,
-                                                   &len, &status);
-  if (U_SUCCESS(status)) {
-    return result.setTo(s, len);
-  }
-
-  result.setToBogus();
+  lookup(tableKey, subTableKey, itemKey, result);
   return result;
 }
 
@@ -155,6 +203,15 @@ ICUDataTable::getNoFallback(const char* tableKey, const char* subTableKey, const
 
 LocaleDisplayNames::~LocaleDisplayNames() {}
 
+UnicodeString*
+LocaleDisplayNames::localeDisplayNames(const Locale* locales, int32_t count,
+                                       UnicodeString* results) const {
+  for (int32_t i = 0; i < count; ++i) {
+    localeDisplayName(locales[i], results[i]);
+  }
+  return results;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #if 0  // currently unused
@@ -439,7 +439,16 @@ Locale& Locale::operator=(const Locale& other) {
         return *this;
     }
 
-    setToBogus();
+    // Locales are copied a lot, for example into cache keys.
+    // Release only heap storage, rather than resetting all fields via setToBogus().
+    if (baseName != fullName) {
+        uprv_free(baseName);
+    }
+    baseName = nullptr;
+    if (fullName != fullNameBuffer) {
+        uprv_free(fullName);
+        fullName = fullNameBuffer;
+    }
 
     if (other.fullName == other.fullNameBuffer) {
         uprv_strcpy(fullNameBuffer, other.fullNameBuffer);
@@ -447,19 +456,27 @@ Locale& Locale::operator=(const Locale& other) {
         fullName = nullptr;
     } else {
         fullName = uprv_strdup(other.fullName);
-        if (fullName == nullptr) return *this;
+        if (fullName == nullptr) {
+            fullName = fullNameBuffer;
+            setToBogus();
+            return *this;
+        }
     }
 
     if (other.baseName == other.fullName) {
         baseName = fullName;
     } else if (other.baseName != nullptr) {
         baseName = uprv_strdup(other.baseName);
-        if (baseName == nullptr) return *this;
+        if (baseName == nullptr) {
+            setToBogus();
+            return *this;
+        }
     }
 
-    uprv_strcpy(language, other.language);
-    uprv_strcpy(script, other.script);
-    uprv_strcpy(country, other.country);
+    // The subtag fields are short; copying them whole is faster than strcpy().
+    uprv_memcpy(language, other.language, sizeof(language));
+    uprv_memcpy(script, other.script, sizeof(script));
+    uprv_memcpy(country, other.country, sizeof(country));
 
     variantBegin = other.variantBegin;
     fIsBogus = other.fIsBogus;
@@ -20,6 +20,8 @@
 */
 
 #include "unicode/bytestream.h"
+#include "unicode/bytestrie.h"
+#include "unicode/bytestriebuilder.h"
 #include "unicode/utypes.h"
 #include "unicode/locid.h"
 #include "unicode/putil.h"
@@ -27,13 +29,18 @@
 #include "unicode/uloc.h"
 #include "unicode/ures.h"
 #include "unicode/uscript.h"
+#include "unicode/ustring.h"
 #include "bytesinkutil.h"
 #include "charstr.h"
 #include "cmemory.h"
 #include "cstring.h"
+#include "ucln_cmn.h"
 #include "ulocimp.h"
+#include "umutex.h"
 #include "ustr_imp.h"
 
+U_NAMESPACE_USE
+
 /**
  * These are the canonical strings for unknown languages, scripts and regions.
  **/
@@ -41,70 +48,101 @@ static const char* const unknownLanguage = "und";
 static const char* const unknownScript = "Zzzz";
 static const char* const unknownRegion = "ZZ";
 
+namespace {
+
+/**
+ * The likelySubtags resource, loaded once: a BytesTrie maps each key to the
+ * offset of its value in gLikelyValues, where the values are stored as
+ * NUL-terminated invariant-character strings without a leading "und".
+ */
+BytesTrie *gLikelyTrie = nullptr;
+CharString *gLikelyValues = nullptr;
+UInitOnce gLikelyInitOnce = U_INITONCE_INITIALIZER;
+
+UBool U_CALLCONV cleanupLikelySubtags() {
+    delete gLikelyTrie;
+    gLikelyTrie = nullptr;
+    delete gLikelyValues;
+    gLikelyValues = nullptr;
+    gLikelyInitOnce.reset();
+    return TRUE;
+}
+
+void U_CALLCONV loadLikelySubtags(UErrorCode &errorCode) {
+    ucln_common_registerCleanup(UCLN_COMMON_LIKELY_SUBTAGS, cleanupLikelySubtags);
+    LocalUResourceBundlePointer subtags(ures_openDirect(NULL, "likelySubtags", &errorCode));
+    LocalPointer<CharString> values(new CharString(), errorCode);
+    BytesTrieBuilder builder(errorCode);
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    while (ures_hasNext(subtags.getAlias())) {
+        const char *key = NULL;
+        int32_t length = 0;
+        const UChar *s = ures_getNextString(subtags.getAlias(), &length, &key, &errorCode);
+        if (U_FAILURE(errorCode)) {
+            return;
+        }
+        if (length >= ULOC_FULLNAME_CAPACITY) {
+            /* The output buffers of the callers should never overflow. */
+            errorCode = U_INTERNAL_PROGRAM_ERROR;
+            return;
+        }
+        if (length >= 3 &&
+                u_strncmp(s, u"und", 3) == 0 && (length == 3 || s[3] == u'_')) {
+            s += 3;
+            length -= 3;
+        }
+        builder.add(key, values->length(), errorCode);
+        values->appendInvariantChars(s, length, errorCode).append('\0', errorCode);
+    }
+    gLikelyTrie = builder.build(USTRINGTRIE_BUILD_SMALL, errorCode);
+    if (U_FAILURE(errorCode)) {
+        delete gLikelyTrie;
+        gLikelyTrie = nullptr;
+        return;
+    }
+    gLikelyValues = values.orphan();
+}
+
+}  // namespace
+
 /**
  * This function looks for the localeID in the likelySubtags resource.
  *
  * @param localeID The tag to find.
- * @param buffer A buffer to hold the matching entry
- * @param bufferLength The length of the output buffer
- * @return A pointer to "buffer" if found, or a null pointer if not.
+ * @return A pointer to the matching entry, or a null pointer if not found.
+ *         The entry is owned by the likely-subtags table and stays valid
+ *         until u_cleanup().
  */
 static const char*  U_CALLCONV
 findLikelySubtags(const char* localeID,
-                  char* buffer,
-                  int32_t bufferLength,
                   UErrorCode* err) {
-    const char* result = NULL;
-
-    if (!U_FAILURE(*err)) {
-        int32_t resLen = 0;
-        const UChar* s = NULL;
-        UErrorCode tmpErr = U_ZERO_ERROR;
-        icu::LocalUResourceBundlePointer subtags(ures_openDirect(NULL, "likelySubtags", &tmpErr));
-        if (U_SUCCESS(tmpErr)) {
-            icu::CharString und;
-            if (localeID != NULL) {
-                if (*localeID == '\0') {
-                    localeID = unknownLanguage;
-                } else if (*localeID == '_') {
-                    und.append(unknownLanguage, *err);
-                    und.append(localeID, *err);
-                    if (U_FAILURE(*err)) {
-                        return NULL;
-                    }
-                    localeID = und.data();
-                }
-            }
-            s = ures_getStringByKey(subtags.getAlias(), localeID, &resLen, &tmpErr);
-
-            if (U_FAILURE(tmpErr)) {
-                /*
-                 * If a resource is missing, it's not really an error, it's
-                 * just that we don't have any data for that particular locale ID.
-                 */
-                if (tmpErr != U_MISSING_RESOURCE_ERROR) {
-                    *err = tmpErr;
-                }
-            }
-            else if (resLen >= bufferLength) {
-                /* The buffer should never overflow. */
-                *err = U_INTERNAL_PROGRAM_ERROR;
-            }
-            else {
-                u_UCharsToChars(s, buffer, resLen + 1);
-                if (resLen >= 3 &&
-                    uprv_strnicmp(buffer, unknownLanguage, 3) == 0 &&
-                    (resLen == 3 || buffer[3] == '_')) {
-                    uprv_memmove(buffer, buffer + 3, resLen - 3 + 1);
-                }
-                result = buffer;
-            }
-        } else {
-            *err = tmpErr;
+    umtx_initOnce(gLikelyInitOnce, &loadLikelySubtags, *err);
+    if (U_FAILURE(*err)) {
+        return NULL;
+    }
+    /* Look up "und" + "_XX" without building the concatenated key. */
+    BytesTrie trie(*gLikelyTrie);
+    UStringTrieResult match;
+    if (localeID == NULL) {
+        return NULL;
+    } else if (*localeID == '\0') {
+        match = trie.next(unknownLanguage, 3);
+    } else {
+        if (*localeID == '_') {
+            trie.next(unknownLanguage, 3);
         }
+        match = trie.next(localeID, (int32_t)uprv_strlen(localeID));
     }
-
-    return result;
+    if (!USTRINGTRIE_HAS_VALUE(match)) {
+        /*
+         * A missing entry is not really an error, it's
+         * just that we don't have any data for that particular locale ID.
+         */
+        return NULL;
+    }
+    return gLikelyValues->data() + trie.getValue();
 }
 
 /**
@@ -561,14 +599,6 @@ createLikelySubtagsString(
     int32_t variantsLength,
     icu::ByteSink& sink,
     UErrorCode* err) {
-    /**
-     * ULOC_FULLNAME_CAPACITY will provide enough capacity
-     * that we can build a string that contains the language,
-     * script and region code without worrying about overrunning
-     * the user-supplied buffer.
-     **/
-    char likelySubtagsBuffer[ULOC_FULLNAME_CAPACITY];
-
     if(U_FAILURE(*err)) {
         goto error;
     }
@@ -602,8 +632,6 @@ createLikelySubtagsString(
         likelySubtags =
             findLikelySubtags(
                 tagBuffer.data(),
-                likelySubtagsBuffer,
-                sizeof(likelySubtagsBuffer),
                 err);
         if(U_FAILURE(*err)) {
             goto error;
@@ -658,8 +686,6 @@ createLikelySubtagsString(
         likelySubtags =
             findLikelySubtags(
                 tagBuffer.data(),
-                likelySubtagsBuffer,
-                sizeof(likelySubtagsBuffer),
                 err);
         if(U_FAILURE(*err)) {
             goto error;
@@ -714,8 +740,6 @@ createLikelySubtagsString(
         likelySubtags =
             findLikelySubtags(
                 tagBuffer.data(),
-                likelySubtagsBuffer,
-                sizeof(likelySubtagsBuffer),
                 err);
         if(U_FAILURE(*err)) {
             goto error;
@@ -769,8 +793,6 @@ createLikelySubtagsString(
         likelySubtags =
             findLikelySubtags(
                 tagBuffer.data(),
-                likelySubtagsBuffer,
-                sizeof(likelySubtagsBuffer),
                 err);
         if(U_FAILURE(*err)) {
             goto error;
@@ -23,6 +23,7 @@
 // see LocaleUtility::getAvailableLocaleNames
 static icu::UInitOnce   LocaleUtilityInitOnce = U_INITONCE_INITIALIZER;
 static icu::Hashtable * LocaleUtility_cache = NULL;
+static icu::UMutex      gLocaleUtilityCacheMutex;
 
 #define UNDERSCORE_CHAR ((UChar)0x005f)
 #define AT_SIGN_CHAR    ((UChar)64)
@@ -220,9 +221,9 @@ LocaleUtility::getAvailableLocaleNames(const UnicodeString& bundleID)
     }
 
     Hashtable* htp;
-    umtx_lock(NULL);
+    umtx_lock(&gLocaleUtilityCacheMutex);
     htp = (Hashtable*) cache->get(bundleID);
-    umtx_unlock(NULL);
+    umtx_unlock(&gLocaleUtilityCacheMutex);
 
     if (htp == NULL) {
         htp = new Hashtable(status);
@@ -242,17 +243,17 @@ LocaleUtility::getAvailableLocaleNames(const UnicodeString& bundleID)
                 delete htp;
                 return NULL;
             }
-            umtx_lock(NULL);
+            umtx_lock(&gLocaleUtilityCacheMutex);
             Hashtable *t = static_cast<Hashtable *>(cache->get(bundleID));
             if (t != NULL) {
                 // Another thread raced through this code, creating the cache entry first.
                 // Discard ours and return theirs.
-                umtx_unlock(NULL);
+                umtx_unlock(&gLocaleUtilityCacheMutex);
                 delete htp;
                 htp = t;
             } else {
                 cache->put(bundleID, (void*)htp, status);
-                umtx_unlock(NULL);
+                umtx_unlock(&gLocaleUtilityCacheMutex);
             }
         }
     }
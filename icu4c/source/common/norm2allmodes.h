@@ -24,6 +24,7 @@
 #include "unicode/unistr.h"
 #include "cpputils.h"
 #include "normalizer2impl.h"
+#include "utracimp.h"
 
 U_NAMESPACE_BEGIN
 
@@ -49,11 +50,15 @@ class Normalizer2WithImpl : public Normalizer2 {
             dest.setToBogus();
             return dest;
         }
+        UTRACE_ENTRY(UTRACE_UNORM2_NORMALIZE);
         dest.remove();
-        ReorderingBuffer buffer(impl, dest);
-        if(buffer.init(src.length(), errorCode)) {
-            normalize(sArray, sArray+src.length(), buffer, errorCode);
+        {
+            ReorderingBuffer buffer(impl, dest);
+            if(buffer.init(src.length(), errorCode)) {
+                normalize(sArray, sArray+src.length(), buffer, errorCode);
+            }
         }
+        UTRACE_EXIT_STATUS(errorCode);
         return dest;
     }
     virtual void
@@ -199,6 +204,27 @@ class DecomposeNormalizer2 : public Normalizer2WithImpl {
     }
     using Normalizer2WithImpl::normalize;  // Avoid warning about hiding base class function.
     virtual void
+    normalizeUTF8(uint32_t options, StringPiece src, ByteSink &sink,
+                  Edits *edits, UErrorCode &errorCode) const U_OVERRIDE {
+        if (U_FAILURE(errorCode)) {
+            return;
+        }
+        if (edits != nullptr && (options & U_EDITS_NO_RESET) == 0) {
+            edits->reset();
+        }
+        const uint8_t *s = reinterpret_cast<const uint8_t *>(src.data());
+        impl.decomposeUTF8(options, s, s + src.length(), &sink, edits, errorCode);
+        sink.Flush();
+    }
+    virtual UBool
+    isNormalizedUTF8(StringPiece sp, UErrorCode &errorCode) const U_OVERRIDE {
+        if(U_FAILURE(errorCode)) {
+            return FALSE;
+        }
+        const uint8_t *s = reinterpret_cast<const uint8_t *>(sp.data());
+        return impl.decomposeUTF8(0, s, s + sp.length(), nullptr, nullptr, errorCode);
+    }
+    virtual void
     normalizeAndAppend(const UChar *src, const UChar *limit, UBool doNormalize,
                        UnicodeString &safeMiddle,
                        ReorderingBuffer &buffer, UErrorCode &errorCode) const {
@@ -326,6 +352,27 @@ class FCDNormalizer2 : public Normalizer2WithImpl {
     }
     using Normalizer2WithImpl::normalize;  // Avoid warning about hiding base class function.
     virtual void
+    normalizeUTF8(uint32_t options, StringPiece src, ByteSink &sink,
+                  Edits *edits, UErrorCode &errorCode) const U_OVERRIDE {
+        if (U_FAILURE(errorCode)) {
+            return;
+        }
+        if (edits != nullptr && (options & U_EDITS_NO_RESET) == 0) {
+            edits->reset();
+        }
+        const uint8_t *s = reinterpret_cast<const uint8_t *>(src.data());
+        impl.makeFCDUTF8(options, s, s + src.length(), &sink, edits, errorCode);
+        sink.Flush();
+    }
+    virtual UBool
+    isNormalizedUTF8(StringPiece sp, UErrorCode &errorCode) const U_OVERRIDE {
+        if(U_FAILURE(errorCode)) {
+            return FALSE;
+        }
+        const uint8_t *s = reinterpret_cast<const uint8_t *>(sp.data());
+        return impl.makeFCDUTF8(0, s, s + sp.length(), nullptr, nullptr, errorCode);
+    }
+    virtual void
     normalizeAndAppend(const UChar *src, const UChar *limit, UBool doNormalize,
                        UnicodeString &safeMiddle,
                        ReorderingBuffer &buffer, UErrorCode &errorCode) const {
@@ -20,17 +20,21 @@
 
 #if !UCONFIG_NO_NORMALIZATION
 
+#include "unicode/appendable.h"
+#include "unicode/bytestream.h"
 #include "unicode/edits.h"
 #include "unicode/normalizer2.h"
 #include "unicode/stringoptions.h"
 #include "unicode/unistr.h"
 #include "unicode/unorm.h"
+#include "charstr.h"
 #include "cstring.h"
 #include "mutex.h"
 #include "norm2allmodes.h"
 #include "normalizer2impl.h"
 #include "uassert.h"
 #include "ucln_cmn.h"
+#include "ucounterimp.h"
 
 using icu::Normalizer2Impl;
 
@@ -80,6 +84,294 @@ Normalizer2::isNormalizedUTF8(StringPiece s, UErrorCode &errorCode) const {
     return U_SUCCESS(errorCode) && isNormalized(UnicodeString::fromUTF8(s), errorCode);
 }
 
+namespace {
+
+/** Forwards to another sink and counts the bytes, but does not forward Flush(). */
+class CountingByteSink : public ByteSink {
+public:
+    CountingByteSink(ByteSink &dest) : sink(dest), length(0) {}
+    virtual void Append(const char *bytes, int32_t n) U_OVERRIDE {
+        sink.Append(bytes, n);
+        length += n;
+    }
+    virtual char *GetAppendBuffer(int32_t min_capacity, int32_t desired_capacity_hint,
+                                  char *scratch, int32_t scratch_capacity,
+                                  int32_t *result_capacity) U_OVERRIDE {
+        return sink.GetAppendBuffer(min_capacity, desired_capacity_hint,
+                                    scratch, scratch_capacity, result_capacity);
+    }
+
+    ByteSink &sink;
+    int64_t length;
+};
+
+}  // namespace
+
+void
+Normalizer2::normalizeUTF8Batch(uint32_t options, const StringPiece *src, int32_t count,
+                                ByteSink &sink, int32_t *destLimits, UBool *isNormalized,
+                                UErrorCode &errorCode) const {
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    if (count < 0 || (src == nullptr && count > 0)) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    CountingByteSink counter(sink);
+    for (int32_t i = 0; i < count; ++i) {
+        UBool isNorm = isNormalizedUTF8(src[i], errorCode);
+        if (U_FAILURE(errorCode)) {
+            return;
+        }
+        if (!isNorm) {
+            normalizeUTF8(0, src[i], counter, nullptr, errorCode);
+            if (U_FAILURE(errorCode)) {
+                return;
+            }
+        } else if ((options & U_OMIT_UNCHANGED_TEXT) == 0) {
+            counter.Append(src[i].data(), src[i].length());
+        }
+        if (counter.length > INT32_MAX) {
+            errorCode = U_INDEX_OUTOFBOUNDS_ERROR;
+            return;
+        }
+        if (destLimits != nullptr) {
+            destLimits[i] = (int32_t)counter.length;
+        }
+        if (isNormalized != nullptr) {
+            isNormalized[i] = isNorm;
+        }
+    }
+    sink.Flush();
+}
+
+// StreamingNormalizer2 ---------------------------------------------------- ***
+
+namespace {
+
+/**
+ * Held-back text longer than this is written out even without a boundary,
+ * to bound the memory use for pathological input.
+ * Stream-Safe Text Format (UAX #15) limits sequences of non-starters to 30.
+ */
+const int32_t MAX_HELD_BACK = 1024;
+
+/**
+ * Returns the index of the first code point in s[start..length[ that has
+ * a normalization boundary before it, or -1 if there is none.
+ */
+int32_t firstBoundary(const Normalizer2 &n2, const UChar *s, int32_t start, int32_t length) {
+    for (int32_t i = start; i < length;) {
+        int32_t cpStart = i;
+        UChar32 c;
+        U16_NEXT(s, i, length, c);
+        if (n2.hasBoundaryBefore(c)) {
+            return cpStart;
+        }
+    }
+    return -1;
+}
+
+/**
+ * Returns the index of the last code point in s[start..limit[ that has
+ * a normalization boundary before it, or start if there is none.
+ */
+int32_t lastBoundary(const Normalizer2 &n2, const UChar *s, int32_t start, int32_t limit) {
+    for (int32_t i = limit; i > start;) {
+        UChar32 c;
+        U16_PREV(s, start, i, c);
+        if (n2.hasBoundaryBefore(c)) {
+            return i;
+        }
+    }
+    return start;
+}
+
+/** UTF-8 version of firstBoundary(). Ill-formed sequences are not boundaries. */
+int32_t firstBoundary(const Normalizer2 &n2, const uint8_t *s, int32_t start, int32_t length) {
+    for (int32_t i = start; i < length;) {
+        int32_t cpStart = i;
+        UChar32 c;
+        U8_NEXT(s, i, length, c);
+        if (c >= 0 && n2.hasBoundaryBefore(c)) {
+            return cpStart;
+        }
+    }
+    return -1;
+}
+
+/** UTF-8 version of lastBoundary(). */
+int32_t lastBoundary(const Normalizer2 &n2, const uint8_t *s, int32_t start, int32_t limit) {
+    for (int32_t i = limit; i > start;) {
+        UChar32 c;
+        U8_PREV(s, start, i, c);
+        if (c >= 0 && n2.hasBoundaryBefore(c)) {
+            return i;
+        }
+    }
+    return start;
+}
+
+}  // namespace
+
+StreamingNormalizer2::StreamingNormalizer2(const Normalizer2 &n2) :
+        norm2(n2), pending8(nullptr) {}
+
+StreamingNormalizer2::~StreamingNormalizer2() {
+    delete pending8;
+}
+
+void
+StreamingNormalizer2::reset() {
+    pending.remove();
+    if (pending8 != nullptr) {
+        pending8->clear();
+    }
+}
+
+void
+StreamingNormalizer2::write(const UChar *s, int32_t length, Appendable &dest,
+                            UErrorCode &errorCode) {
+    if (U_FAILURE(errorCode) || length == 0) {
+        return;
+    }
+    norm2.normalize(UnicodeString(FALSE, s, length), normalized, errorCode);
+    if (U_SUCCESS(errorCode) &&
+            !dest.appendString(normalized.getBuffer(), normalized.length())) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+    }
+}
+
+void
+StreamingNormalizer2::writeUTF8(const char *s, int32_t length, ByteSink &sink,
+                                UErrorCode &errorCode) {
+    if (U_FAILURE(errorCode) || length == 0) {
+        return;
+    }
+    norm2.normalizeUTF8(0, StringPiece(s, length), sink, nullptr, errorCode);
+}
+
+// Both versions work the same way:
+// The held-back text always starts at a boundary (or at the start of the text),
+// so it is normalized together with the chunk up to the chunk's first boundary.
+// The chunk is then written out up to its last boundary, and the rest is held back.
+// A code point split across chunks is never a boundary:
+// Its leading part is held back, and its trailing part is skipped
+// when looking for the first boundary in the next chunk.
+
+void
+StreamingNormalizer2::normalizeChunk(const UnicodeString &chunk, Appendable &dest,
+                                     UErrorCode &errorCode) {
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    if (chunk.isBogus()) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    if (pending8 != nullptr && !pending8->isEmpty()) {
+        errorCode = U_INVALID_STATE_ERROR;  // mixed UTF-8 and UTF-16 input
+        return;
+    }
+    const UChar *s = chunk.getBuffer();
+    int32_t length = chunk.length();
+    int32_t limit = length;
+    if (limit > 0 && U16_IS_LEAD(s[limit - 1])) { --limit; }
+    int32_t start = 0;
+    if (!pending.isEmpty()) {
+        int32_t first = firstBoundary(norm2, s, (length > 0 && U16_IS_TRAIL(s[0])) ? 1 : 0, limit);
+        if (first < 0) {
+            pending.append(chunk);
+            if (pending.length() > MAX_HELD_BACK) {
+                int32_t pendingLimit = pending.length();
+                if (U16_IS_LEAD(pending[pendingLimit - 1])) { --pendingLimit; }
+                write(pending.getBuffer(), pendingLimit, dest, errorCode);
+                pending.remove(0, pendingLimit);
+            }
+            return;
+        }
+        pending.append(s, first);
+        write(pending.getBuffer(), pending.length(), dest, errorCode);
+        pending.remove();
+        start = first;
+    }
+    int32_t last = lastBoundary(norm2, s, start, limit);
+    if ((length - last) > MAX_HELD_BACK) {
+        last = limit;
+    }
+    write(s + start, last - start, dest, errorCode);
+    pending.setTo(s + last, length - last);
+}
+
+void
+StreamingNormalizer2::finish(Appendable &dest, UErrorCode &errorCode) {
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    write(pending.getBuffer(), pending.length(), dest, errorCode);
+    pending.remove();
+}
+
+void
+StreamingNormalizer2::normalizeChunkUTF8(StringPiece chunk, ByteSink &sink,
+                                         UErrorCode &errorCode) {
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    if (!pending.isEmpty()) {
+        errorCode = U_INVALID_STATE_ERROR;  // mixed UTF-8 and UTF-16 input
+        return;
+    }
+    if (pending8 == nullptr) {
+        pending8 = new CharString();
+        if (pending8 == nullptr) {
+            errorCode = U_MEMORY_ALLOCATION_ERROR;
+            return;
+        }
+    }
+    const uint8_t *s = reinterpret_cast<const uint8_t *>(chunk.data());
+    int32_t length = chunk.length();
+    int32_t start = 0;
+    if (!pending8->isEmpty()) {
+        int32_t first = 0;
+        while (first < length && U8_IS_TRAIL(s[first])) { ++first; }
+        first = firstBoundary(norm2, s, first, length);
+        if (first < 0) {
+            pending8->append(chunk, errorCode);
+            if (U_SUCCESS(errorCode) && pending8->length() > MAX_HELD_BACK) {
+                int32_t limit = pending8->length();
+                U8_TRUNCATE_IF_INCOMPLETE(pending8->data(), 0, limit);
+                writeUTF8(pending8->data(), limit, sink, errorCode);
+                CharString rest(pending8->data() + limit, pending8->length() - limit, errorCode);
+                pending8->copyFrom(rest, errorCode);
+            }
+            return;
+        }
+        pending8->append(chunk.data(), first, errorCode);
+        writeUTF8(pending8->data(), pending8->length(), sink, errorCode);
+        pending8->clear();
+        start = first;
+    }
+    int32_t limit = length;
+    U8_TRUNCATE_IF_INCOMPLETE(s, start, limit);
+    int32_t last = lastBoundary(norm2, s, start, limit);
+    if ((length - last) > MAX_HELD_BACK) {
+        last = limit;
+    }
+    writeUTF8(chunk.data() + start, last - start, sink, errorCode);
+    pending8->clear().append(chunk.data() + last, length - last, errorCode);
+}
+
+void
+StreamingNormalizer2::finishUTF8(ByteSink &sink, UErrorCode &errorCode) {
+    if (U_FAILURE(errorCode) || pending8 == nullptr) {
+        return;
+    }
+    writeUTF8(pending8->data(), pending8->length(), sink, errorCode);
+    pending8->clear();
+}
+
 // Normalizer2 implementation for the old UNORM_NONE.
 class NoopNormalizer2 : public Normalizer2 {
     virtual ~NoopNormalizer2();
@@ -255,6 +547,7 @@ static void U_CALLCONV initNFCSingleton(UErrorCode &errorCode) {
 const Norm2AllModes *
 Norm2AllModes::getNFCInstance(UErrorCode &errorCode) {
     if(U_FAILURE(errorCode)) { return NULL; }
+    UCOUNTER_INC(UCOUNTER_NORMALIZER2_FETCHES);
     umtx_initOnce(nfcInitOnce, &initNFCSingleton, errorCode);
     return nfcSingleton;
 }
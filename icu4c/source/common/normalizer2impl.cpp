@@ -62,6 +62,144 @@ inline uint8_t leadByteForCP(UChar32 c) {
     }
 }
 
+/**
+ * Returns TRUE if any of the 8-bit or 16-bit units in the word is at least min.
+ * high has the most significant bit of each unit set.
+ * add has the distance from min to that bit in each unit if min is at most that bit (minIsLow),
+ * otherwise the distance from min to the unit's overflow.
+ * Adding it to the other bits of a unit does not carry into the next unit.
+ */
+inline UBool anyUnitAtLeast(uint64_t word, uint64_t high, uint64_t add, UBool minIsLow) {
+    uint64_t sum = (word & ~high) + add;
+    return ((minIsLow ? (word | sum) : (word & sum)) & high) != 0;
+}
+
+/**
+ * Returns the first position at or after src with a byte >= minByte, or limit.
+ * Tests 8-byte words at a time for the quick check fast paths.
+ */
+inline const uint8_t *spanBelow(const uint8_t *src, const uint8_t *limit, uint8_t minByte) {
+    const uint64_t ones = UINT64_C(0x0101010101010101);
+    UBool minIsLow = minByte <= 0x80;
+    uint64_t add = ones * (uint64_t)((minIsLow ? 0x80 : 0x100) - minByte);
+    while ((limit - src) >= 8) {
+        uint64_t word;
+        uprv_memcpy(&word, src, 8);
+        if (anyUnitAtLeast(word, ones * 0x80, add, minIsLow)) {
+            break;
+        }
+        src += 8;
+    }
+    while (src != limit && *src < minByte) {
+        ++src;
+    }
+    return src;
+}
+
+/**
+ * Returns the first position at or after src with a code unit >= minCP, or limit.
+ * Tests four code units (one 64-bit word) at a time.
+ */
+inline const UChar *spanBelow(const UChar *src, const UChar *limit, UChar32 minCP) {
+    const uint64_t ones = UINT64_C(0x0001000100010001);
+    UBool minIsLow = minCP <= 0x8000;
+    uint64_t add = ones * (uint64_t)((minIsLow ? 0x8000 : 0x10000) - minCP);
+    while ((limit - src) >= 4) {
+        uint64_t word;
+        uprv_memcpy(&word, src, 8);
+        if (anyUnitAtLeast(word, ones * 0x8000, add, minIsLow)) {
+            break;
+        }
+        src += 4;
+    }
+    while (src != limit && *src < minCP) {
+        ++src;
+    }
+    return src;
+}
+
+/**
+ * Returns a word with the most significant bit set in each byte of an all-ASCII word
+ * that is an uppercase letter A..Z.
+ */
+inline uint64_t asciiUpperMask(uint64_t word) {
+    const uint64_t ones = UINT64_C(0x0101010101010101);
+    return (word + ones * (0x80 - 0x41)) & ~(word + ones * (0x80 - 0x5b)) & (ones * 0x80);
+}
+
+inline UBool isAsciiUpper(uint8_t b) {
+    return (uint8_t)(b - 0x41) <= (0x5a - 0x41);
+}
+
+/**
+ * Returns the first uppercase letter at or after src in the ASCII text, or limit.
+ */
+inline const uint8_t *spanNotAsciiUpper(const uint8_t *src, const uint8_t *limit) {
+    while ((limit - src) >= 8) {
+        uint64_t word;
+        uprv_memcpy(&word, src, 8);
+        if (asciiUpperMask(word) != 0) {
+            break;
+        }
+        src += 8;
+    }
+    while (src != limit && !isAsciiUpper(*src)) {
+        ++src;
+    }
+    return src;
+}
+
+/**
+ * Appends the ASCII text [src, limit) with A..Z lowercased.
+ * Each lowercased letter is a 1:1 change, as if mapped one at a time.
+ */
+void appendAsciiLowercase(const uint8_t *src, const uint8_t *limit,
+                          ByteSink &sink, uint32_t options, Edits *edits) {
+    if (edits != nullptr) {
+        for (const uint8_t *p = src; p != limit;) {
+            const uint8_t *upper = spanNotAsciiUpper(p, limit);
+            if (upper != p) {
+                edits->addUnchanged((int32_t)(upper - p));
+            }
+            for (p = upper; p != limit && isAsciiUpper(*p); ++p) {
+                edits->addReplace(1, 1);
+            }
+        }
+    }
+    if ((options & U_OMIT_UNCHANGED_TEXT) != 0) {
+        while (src != limit) {
+            src = spanNotAsciiUpper(src, limit);
+            char buffer[64];
+            int32_t length = 0;
+            while (src != limit && length < UPRV_LENGTHOF(buffer) && isAsciiUpper(*src)) {
+                buffer[length++] = (char)(*src++ + 0x20);
+            }
+            if (length > 0) {
+                sink.Append(buffer, length);
+            }
+        }
+        return;
+    }
+    // Lowercase 8 bytes at a time without branching on the letters.
+    char buffer[256];
+    while (src != limit) {
+        int32_t length = 0;
+        while ((limit - src) >= 8 && length <= (UPRV_LENGTHOF(buffer) - 8)) {
+            uint64_t word;
+            uprv_memcpy(&word, src, 8);
+            word |= asciiUpperMask(word) >> 2;
+            uprv_memcpy(buffer + length, &word, 8);
+            src += 8;
+            length += 8;
+        }
+        while (src != limit && length < UPRV_LENGTHOF(buffer)) {
+            uint8_t b = *src++;
+            buffer[length++] = (char)(isAsciiUpper(b) ? b + 0x20 : b);
+        }
+        sink.Append(buffer, length);
+    }
+}
+
 /**
  * Returns the code point from one single well-formed UTF-8 byte sequence
  * between cpStart and cpLimit.
@@ -450,6 +588,19 @@ Normalizer2Impl::init(const int32_t *inIndexes, const UCPTrie *inTrie,
     extraData=maybeYesCompositions+((MIN_NORMAL_MAYBE_YES-minMaybeYes)>>OFFSET_SHIFT);
 
     smallFCD=inSmallFCD;
+
+    // composeUTF8() lowercases runs of ASCII without looking up each character
+    // if that is all that the data does to ASCII.
+    asciiUpperToLower = minCompNoMaybeCP == 0x41;
+    for (UChar32 c = 0; c <= 0x7f && asciiUpperToLower; ++c) {
+        uint16_t norm16 = getRawNorm16(c);
+        if (0x41 <= c && c <= 0x5a) {
+            asciiUpperToLower = isDecompNoAlgorithmic(norm16) &&
+                !isMaybeOrNonZeroCC(norm16) && mapAlgorithmic(c, norm16) == c + 0x20;
+        } else {
+            asciiUpperToLower = isCompYesAndZeroCC(norm16) && norm16HasCompBoundaryBefore(norm16);
+        }
+    }
 }
 
 U_CDECL_BEGIN
@@ -809,6 +960,87 @@ Normalizer2Impl::decomposeShort(const uint8_t *src, const uint8_t *limit,
     return src;
 }
 
+UBool
+Normalizer2Impl::decomposeUTF8(uint32_t options,
+                               const uint8_t *src, const uint8_t *limit,
+                               ByteSink *sink, Edits *edits, UErrorCode &errorCode) const {
+    U_ASSERT(limit != nullptr);
+    UnicodeString s16;
+    uint8_t minNoLead = leadByteForCP(minDecompNoCP);
+    const uint8_t *prevBoundary = src;
+
+    for (;;) {
+        // Fast path: Scan over a sequence of characters below the minimum "no" code point,
+        // or with (decompYes && ccc==0) properties.
+        const uint8_t *prevSrc;
+        uint16_t norm16 = 0;
+        for (;;) {
+            if (src == limit) {
+                if (prevBoundary != limit && sink != nullptr) {
+                    ByteSinkUtil::appendUnchanged(prevBoundary, limit,
+                                                  *sink, options, edits, errorCode);
+                }
+                return TRUE;
+            }
+            if (*src < minNoLead) {
+                src = spanBelow(src + 1, limit, minNoLead);
+            } else {
+                prevSrc = src;
+                UCPTRIE_FAST_U8_NEXT(normTrie, UCPTRIE_16, src, limit, norm16);
+                if (!isMostDecompYesAndZeroCC(norm16)) {
+                    break;
+                }
+            }
+        }
+        // The current character either decomposes or has ccc!=0.
+        // The previous character, if any, has a boundary after it,
+        // so the segment from here to the next character with a boundary before it
+        // decomposes and reorders independently of the surrounding text.
+        // Invalid UTF-8 is inert and has a boundary before it, so it ends the segment.
+        for (;;) {
+            if (src == limit) {
+                break;
+            }
+            const uint8_t *nextSrc = src;
+            uint16_t n16;
+            UCPTRIE_FAST_U8_NEXT(normTrie, UCPTRIE_16, nextSrc, limit, n16);
+            if (norm16HasDecompBoundaryBefore(n16)) {
+                break;
+            }
+            src = nextSrc;
+        }
+        ReorderingBuffer buffer(*this, s16, errorCode);
+        if (U_FAILURE(errorCode)) {
+            break;
+        }
+        decomposeShort(prevSrc, src, FALSE /* !stopAtCompBoundary */, FALSE /* onlyContiguous */,
+                       buffer, errorCode);
+        if (U_FAILURE(errorCode)) {
+            break;
+        }
+        if ((src - prevSrc) > INT32_MAX) {  // guard before buffer.equals()
+            errorCode = U_INDEX_OUTOFBOUNDS_ERROR;
+            return TRUE;
+        }
+        if (!buffer.equals(prevSrc, src)) {
+            if (sink == nullptr) {
+                return FALSE;
+            }
+            if (prevBoundary != prevSrc &&
+                    !ByteSinkUtil::appendUnchanged(prevBoundary, prevSrc,
+                                                   *sink, options, edits, errorCode)) {
+                break;
+            }
+            if (!ByteSinkUtil::appendChange(prevSrc, src, buffer.getStart(), buffer.length(),
+                                            *sink, edits, errorCode)) {
+                break;
+            }
+            prevBoundary = src;
+        }
+    }
+    return TRUE;
+}
+
 const UChar *
 Normalizer2Impl::getDecomposition(UChar32 c, UChar buffer[4], int32_t &length) const {
     uint16_t norm16;
@@ -1339,9 +1571,10 @@ Normalizer2Impl::compose(const UChar *src, const UChar *limit,
                 }
                 return TRUE;
             }
-            if( (c=*src)<minNoMaybeCP ||
-                isCompYesAndZeroCC(norm16=UCPTRIE_FAST_BMP_GET(normTrie, UCPTRIE_16, c))
-            ) {
+            if ((c=*src) < minNoMaybeCP) {
+                // Typical text has long runs of such characters.
+                src = spanBelow(src + 1, limit, minNoMaybeCP);
+            } else if (isCompYesAndZeroCC(norm16=UCPTRIE_FAST_BMP_GET(normTrie, UCPTRIE_16, c))) {
                 ++src;
             } else {
                 prevSrc = src++;
@@ -1600,9 +1833,10 @@ Normalizer2Impl::composeQuickCheck(const UChar *src, const UChar *limit,
             if(src==limit) {
                 return src;
             }
-            if( (c=*src)<minNoMaybeCP ||
-                isCompYesAndZeroCC(norm16=UCPTRIE_FAST_BMP_GET(normTrie, UCPTRIE_16, c))
-            ) {
+            if ((c=*src) < minNoMaybeCP) {
+                // Typical text has long runs of such characters.
+                src = spanBelow(src + 1, limit, minNoMaybeCP);
+            } else if (isCompYesAndZeroCC(norm16=UCPTRIE_FAST_BMP_GET(normTrie, UCPTRIE_16, c))) {
                 ++src;
             } else {
                 prevSrc = src++;
@@ -1752,8 +1986,33 @@ Normalizer2Impl::composeUTF8(uint32_t options, UBool onlyContiguous,
                 return TRUE;
             }
             if (*src < minNoMaybeLead) {
-                ++src;
+                // Typical text has long runs of such bytes.
+                src = spanBelow(src + 1, limit, minNoMaybeLead);
             } else {
+                if (asciiUpperToLower && *src < 0x80) {
+                    // NFKC_Casefold: Case-fold a run of ASCII except for its last character
+                    // if that is followed by non-ASCII text which might combine with it.
+                    const uint8_t *asciiLimit = spanBelow(src + 1, limit, 0x80);
+                    if (asciiLimit != limit) {
+                        --asciiLimit;
+                    }
+                    if (src != asciiLimit) {
+                        const uint8_t *upper = spanNotAsciiUpper(src, asciiLimit);
+                        if (upper != asciiLimit) {
+                            if (sink == nullptr) {
+                                return FALSE;
+                            }
+                            if (!ByteSinkUtil::appendUnchanged(prevBoundary, upper,
+                                                               *sink, options, edits, errorCode)) {
+                                return TRUE;
+                            }
+                            appendAsciiLowercase(upper, asciiLimit, *sink, options, edits);
+                            prevBoundary = asciiLimit;
+                        }
+                        src = asciiLimit;
+                        continue;
+                    }
+                }
                 prevSrc = src;
                 UCPTRIE_FAST_U8_NEXT(normTrie, UCPTRIE_16, src, limit, norm16);
                 if (!isCompYesAndZeroCC(norm16)) {
@@ -2299,6 +2558,87 @@ void Normalizer2Impl::makeFCDAndAppend(const UChar *src, const UChar *limit,
     }
 }
 
+UBool
+Normalizer2Impl::makeFCDUTF8(uint32_t options,
+                             const uint8_t *src, const uint8_t *limit,
+                             ByteSink *sink, Edits *edits, UErrorCode &errorCode) const {
+    U_ASSERT(limit != nullptr);
+    UnicodeString s16;
+    uint8_t minNoLead = leadByteForCP(minDecompNoCP);
+    const uint8_t *prevBoundary = src;
+
+    for (;;) {
+        // Fast path: Scan over a sequence of characters below the minimum "no" code point,
+        // or with FCD boundaries before and after them.
+        // (Characters below minLcccCP may still have tccc!=0.)
+        const uint8_t *prevSrc;
+        uint16_t norm16 = 0;
+        for (;;) {
+            if (src == limit) {
+                if (prevBoundary != limit && sink != nullptr) {
+                    ByteSinkUtil::appendUnchanged(prevBoundary, limit,
+                                                  *sink, options, edits, errorCode);
+                }
+                return TRUE;
+            }
+            if (*src < minNoLead) {
+                src = spanBelow(src + 1, limit, minNoLead);
+            } else {
+                prevSrc = src;
+                UCPTRIE_FAST_U8_NEXT(normTrie, UCPTRIE_16, src, limit, norm16);
+                if (!norm16HasDecompBoundaryBefore(norm16) ||
+                        !norm16HasDecompBoundaryAfter(norm16)) {
+                    break;
+                }
+            }
+        }
+        // The current character has lccc!=0 or tccc>1.
+        // Check the segment up to the next FCD boundary for canonical order;
+        // if it is out of order, then decompose it, the same as makeFCD().
+        // Invalid UTF-8 is inert and has boundaries around it, so it ends the segment.
+        uint16_t prevFCD16 = getFCD16FromNormData(codePointFromValidUTF8(prevSrc, src));
+        UBool inOrder = TRUE;
+        while (src != limit && !norm16HasDecompBoundaryAfter(norm16)) {
+            const uint8_t *nextSrc = src;
+            UCPTRIE_FAST_U8_NEXT(normTrie, UCPTRIE_16, nextSrc, limit, norm16);
+            if (norm16HasDecompBoundaryBefore(norm16)) {
+                break;
+            }
+            uint16_t fcd16 = getFCD16FromNormData(codePointFromValidUTF8(src, nextSrc));
+            if ((prevFCD16 & 0xff) > (fcd16 >> 8)) {
+                inOrder = FALSE;
+            }
+            src = nextSrc;
+            prevFCD16 = fcd16;
+        }
+        if (!inOrder) {
+            if (sink == nullptr) {
+                return FALSE;
+            }
+            ReorderingBuffer buffer(*this, s16, errorCode);
+            if (U_FAILURE(errorCode)) {
+                break;
+            }
+            decomposeShort(prevSrc, src, FALSE /* !stopAtCompBoundary */, FALSE /* onlyContiguous */,
+                           buffer, errorCode);
+            if (U_FAILURE(errorCode)) {
+                break;
+            }
+            if (prevBoundary != prevSrc &&
+                    !ByteSinkUtil::appendUnchanged(prevBoundary, prevSrc,
+                                                   *sink, options, edits, errorCode)) {
+                break;
+            }
+            if (!ByteSinkUtil::appendChange(prevSrc, src, buffer.getStart(), buffer.length(),
+                                            *sink, edits, errorCode)) {
+                break;
+            }
+            prevBoundary = src;
+        }
+    }
+    return TRUE;
+}
+
 const UChar *Normalizer2Impl::findPreviousFCDBoundary(const UChar *start, const UChar *p) const {
     while(start<p) {
         const UChar *codePointLimit = p;
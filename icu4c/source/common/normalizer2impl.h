@@ -491,6 +491,10 @@ class U_COMMON_API Normalizer2Impl : public UObject {
                             UnicodeString &safeMiddle,
                             ReorderingBuffer &buffer,
                             UErrorCode &errorCode) const;
+    /** sink==nullptr: isNormalized() */
+    UBool decomposeUTF8(uint32_t options,
+                        const uint8_t *src, const uint8_t *limit,
+                        ByteSink *sink, icu::Edits *edits, UErrorCode &errorCode) const;
     UBool compose(const UChar *src, const UChar *limit,
                   UBool onlyContiguous,
                   UBool doCompose,
@@ -518,6 +522,10 @@ class U_COMMON_API Normalizer2Impl : public UObject {
                           UnicodeString &safeMiddle,
                           ReorderingBuffer &buffer,
                           UErrorCode &errorCode) const;
+    /** sink==nullptr: isNormalized() */
+    UBool makeFCDUTF8(uint32_t options,
+                      const uint8_t *src, const uint8_t *limit,
+                      ByteSink *sink, icu::Edits *edits, UErrorCode &errorCode) const;
 
     UBool hasDecompBoundaryBefore(UChar32 c) const;
     UBool norm16HasDecompBoundaryBefore(uint16_t norm16) const;
@@ -720,6 +728,8 @@ class U_COMMON_API Normalizer2Impl : public UObject {
     const uint16_t *maybeYesCompositions;
     const uint16_t *extraData;  // mappings and/or compositions for yesYes, yesNo & noNo characters
     const uint8_t *smallFCD;  // [0x100] one bit per 32 BMP code points, set if any FCD!=0
+    // TRUE if A..Z map to a..z and all other ASCII characters are inert, as in NFKC_Casefold.
+    UBool asciiUpperToLower;
 
     UInitOnce       fCanonIterDataInitOnce = U_INITONCE_INITIALIZER;
     CanonIterData  *fCanonIterData;
@@ -51,12 +51,15 @@ Disclaimer and license
 #include "unicode/ustring.h"
 #include "unicode/utf.h"
 #include "unicode/utf16.h"
+#include "unicode/utf8.h"
 #include "ustr_imp.h"
 #include "cstring.h"
 #include "cmemory.h"
 #include "punycode.h"
 #include "uassert.h"
 
+U_NAMESPACE_USE
+
 
 /* Punycode ----------------------------------------------------------------- */
 
@@ -180,6 +183,118 @@ adaptBias(int32_t delta, int32_t length, UBool firstTime) {
 
 #define MAX_CP_COUNT    200
 
+/*
+ * Encodes the non-basic code points in cpBuffer (caseFlag in the sign bit,
+ * 0 for basic code points) after the basicLength basic ones
+ * which the caller has already written to dest.
+ * Shared by the UTF-16 and UTF-8 encoders.
+ * Returns the output length without NUL termination.
+ */
+template<typename Char>
+static int32_t
+encodeExtended(const int32_t *cpBuffer, int32_t srcCPCount, int32_t basicLength,
+               Char *dest, int32_t destCapacity,
+               UErrorCode *pErrorCode) {
+    int32_t n, delta, handledCPCount, destLength, bias, j, m, q, k, t;
+
+    /* Finish the basic string - if it is not empty - with a delimiter. */
+    destLength=basicLength;
+    if(basicLength>0) {
+        if(destLength<destCapacity) {
+            dest[destLength]=DELIMITER;
+        }
+        ++destLength;
+    }
+
+    /*
+     * handledCPCount is the number of code points that have been handled
+     * basicLength is the number of basic code points
+     * destLength is the number of chars that have been output
+     */
+
+    /* Initialize the state: */
+    n=INITIAL_N;
+    delta=0;
+    bias=INITIAL_BIAS;
+
+    /* Main encoding loop: */
+    for(handledCPCount=basicLength; handledCPCount<srcCPCount; /* no op */) {
+        /*
+         * All non-basic code points < n have been handled already.
+         * Find the next larger one:
+         */
+        for(m=0x7fffffff, j=0; j<srcCPCount; ++j) {
+            q=cpBuffer[j]&0x7fffffff; /* remove case flag from the sign bit */
+            if(n<=q && q<m) {
+                m=q;
+            }
+        }
+
+        /*
+         * Increase delta enough to advance the decoder's
+         * <n,i> state to <m,0>, but guard against overflow:
+         */
+        if(m-n>(0x7fffffff-MAX_CP_COUNT-delta)/(handledCPCount+1)) {
+            *pErrorCode=U_INTERNAL_PROGRAM_ERROR;
+            return 0;
+        }
+        delta+=(m-n)*(handledCPCount+1);
+        n=m;
+
+        /* Encode a sequence of same code points n */
+        for(j=0; j<srcCPCount; ++j) {
+            q=cpBuffer[j]&0x7fffffff; /* remove case flag from the sign bit */
+            if(q<n) {
+                ++delta;
+            } else if(q==n) {
+                /* Represent delta as a generalized variable-length integer: */
+                for(q=delta, k=BASE; /* no condition */; k+=BASE) {
+
+                    /** RAM: comment out the old code for conformance with draft-ietf-idn-punycode-03.txt
+
+                    t=k-bias;
+                    if(t<TMIN) {
+                        t=TMIN;
+                    } else if(t>TMAX) {
+                        t=TMAX;
+                    }
+                    */
+
+                    t=k-bias;
+                    if(t<TMIN) {
+                        t=TMIN;
+                    } else if(k>=(bias+TMAX)) {
+                        t=TMAX;
+                    }
+
+                    if(q<t) {
+                        break;
+                    }
+
+                    if(destLength<destCapacity) {
+                        dest[destLength]=digitToBasic(t+(q-t)%(BASE-t), 0);
+                    }
+                    ++destLength;
+                    q=(q-t)/(BASE-t);
+                }
+
+                if(destLength<destCapacity) {
+                    dest[destLength]=digitToBasic(q, (UBool)(cpBuffer[j]<0));
+                }
+                ++destLength;
+                bias=adaptBias(delta, handledCPCount+1, (UBool)(handledCPCount==basicLength));
+                delta=0;
+                ++handledCPCount;
+            }
+        }
+
+        ++delta;
+        ++n;
+    }
+
+    return destLength;
+}
+
 U_CFUNC int32_t
 u_strToPunycode(const UChar *src, int32_t srcLength,
                 UChar *dest, int32_t destCapacity,
@@ -187,7 +302,7 @@ u_strToPunycode(const UChar *src, int32_t srcLength,
                 UErrorCode *pErrorCode) {
 
     int32_t cpBuffer[MAX_CP_COUNT];
-    int32_t n, delta, handledCPCount, basicLength, destLength, bias, j, m, q, k, t, srcCPCount;
+    int32_t n, destLength, j, srcCPCount;
     UChar c, c2;
 
     /* argument checking */
@@ -275,102 +390,101 @@ u_strToPunycode(const UChar *src, int32_t srcLength,
         }
     }
 
-    /* Finish the basic string - if it is not empty - with a delimiter. */
-    basicLength=destLength;
-    if(basicLength>0) {
-        if(destLength<destCapacity) {
-            dest[destLength]=DELIMITER;
-        }
-        ++destLength;
-    }
+    destLength=encodeExtended(cpBuffer, srcCPCount, destLength, dest, destCapacity, pErrorCode);
+    return u_terminateUChars(dest, destCapacity, destLength, pErrorCode);
+}
+
+/*
+ * Decodes one generalized variable-length integer starting at src[in]
+ * and applies it to the decoder state <n,i>.
+ * Afterwards, n is the next code point, to be inserted at code point index i
+ * of an output that will have destCPCount code points including it.
+ * Shared by the UTF-16 and UTF-8 decoders.
+ * Returns FALSE and sets an error code if the input is ill-formed.
+ */
+template<typename Char>
+static UBool
+decodeNext(const Char *src, int32_t srcLength, int32_t &in,
+           int32_t &n, int32_t &i, int32_t &bias, int32_t destCPCount,
+           UErrorCode *pErrorCode) {
+    int32_t oldi, w, k, digit, t;
+    Char c;
 
     /*
-     * handledCPCount is the number of code points that have been handled
-     * basicLength is the number of basic code points
-     * destLength is the number of chars that have been output
+     * Decode a generalized variable-length integer into delta,
+     * which gets added to i.  The overflow checking is easier
+     * if we increase i as we go, then subtract off its starting
+     * value at the end to obtain delta.
      */
-
-    /* Initialize the state: */
-    n=INITIAL_N;
-    delta=0;
-    bias=INITIAL_BIAS;
-
-    /* Main encoding loop: */
-    for(handledCPCount=basicLength; handledCPCount<srcCPCount; /* no op */) {
-        /*
-         * All non-basic code points < n have been handled already.
-         * Find the next larger one:
-         */
-        for(m=0x7fffffff, j=0; j<srcCPCount; ++j) {
-            q=cpBuffer[j]&0x7fffffff; /* remove case flag from the sign bit */
-            if(n<=q && q<m) {
-                m=q;
-            }
+    for(oldi=i, w=1, k=BASE; /* no condition */; k+=BASE) {
+        if(in>=srcLength) {
+            *pErrorCode=U_ILLEGAL_CHAR_FOUND;
+            return FALSE;
         }
 
-        /*
-         * Increase delta enough to advance the decoder's
-         * <n,i> state to <m,0>, but guard against overflow:
-         */
-        if(m-n>(0x7fffffff-MAX_CP_COUNT-delta)/(handledCPCount+1)) {
-            *pErrorCode=U_INTERNAL_PROGRAM_ERROR;
-            return 0;
+        c=src[in++];
+        digit= IS_BASIC(c) ? basicToDigit[c] : -1;
+        if(digit<0) {
+            *pErrorCode=U_INVALID_CHAR_FOUND;
+            return FALSE;
+        }
+        if(digit>(0x7fffffff-i)/w) {
+            /* integer overflow */
+            *pErrorCode=U_ILLEGAL_CHAR_FOUND;
+            return FALSE;
         }
-        delta+=(m-n)*(handledCPCount+1);
-        n=m;
-
-        /* Encode a sequence of same code points n */
-        for(j=0; j<srcCPCount; ++j) {
-            q=cpBuffer[j]&0x7fffffff; /* remove case flag from the sign bit */
-            if(q<n) {
-                ++delta;
-            } else if(q==n) {
-                /* Represent delta as a generalized variable-length integer: */
-                for(q=delta, k=BASE; /* no condition */; k+=BASE) {
-
-                    /** RAM: comment out the old code for conformance with draft-ietf-idn-punycode-03.txt
 
-                    t=k-bias;
-                    if(t<TMIN) {
-                        t=TMIN;
-                    } else if(t>TMAX) {
-                        t=TMAX;
-                    }
-                    */
+        i+=digit*w;
+        /** RAM: comment out the old code for conformance with draft-ietf-idn-punycode-03.txt  
+        t=k-bias;
+        if(t<TMIN) {
+            t=TMIN;
+        } else if(t>TMAX) {
+            t=TMAX;
+        }
+        */
+        t=k-bias;
+        if(t<TMIN) {
+            t=TMIN;
+        } else if(k>=(bias+TMAX)) {
+            t=TMAX;
+        }
+        if(digit<t) {
+            break;
+        }
 
-                    t=k-bias;
-                    if(t<TMIN) {
-                        t=TMIN;
-                    } else if(k>=(bias+TMAX)) {
-                        t=TMAX;
-                    }
+        if(w>0x7fffffff/(BASE-t)) {
+            /* integer overflow */
+            *pErrorCode=U_ILLEGAL_CHAR_FOUND;
+            return FALSE;
+        }
+        w*=BASE-t;
+    }
 
-                    if(q<t) {
-                        break;
-                    }
+    bias=adaptBias(i-oldi, destCPCount, (UBool)(oldi==0));
 
-                    if(destLength<destCapacity) {
-                        dest[destLength]=digitToBasic(t+(q-t)%(BASE-t), 0);
-                    }
-                    ++destLength;
-                    q=(q-t)/(BASE-t);
-                }
+    /*
+     * i was supposed to wrap around from (incremented) destCPCount to 0,
+     * incrementing n each time, so we'll fix that now:
+     */
+    if(i/destCPCount>(0x7fffffff-n)) {
+        /* integer overflow */
+        *pErrorCode=U_ILLEGAL_CHAR_FOUND;
+        return FALSE;
+    }
 
-                if(destLength<destCapacity) {
-                    dest[destLength]=digitToBasic(q, (UBool)(cpBuffer[j]<0));
-                }
-                ++destLength;
-                bias=adaptBias(delta, handledCPCount+1, (UBool)(handledCPCount==basicLength));
-                delta=0;
-                ++handledCPCount;
-            }
-        }
+    n+=i/destCPCount;
+    i%=destCPCount;
+    /* not needed for Punycode: */
+    /* if (decode_digit(n) <= BASE) return punycode_invalid_input; */
 
-        ++delta;
-        ++n;
+    if(n>0x10ffff || U_IS_SURROGATE(n)) {
+        /* Unicode code point overflow */
+        *pErrorCode=U_ILLEGAL_CHAR_FOUND;
+        return FALSE;
     }
 
-    return u_terminateUChars(dest, destCapacity, destLength, pErrorCode);
+    return TRUE;
 }
 
 U_CFUNC int32_t
@@ -378,7 +492,7 @@ u_strFromPunycode(const UChar *src, int32_t srcLength,
                   UChar *dest, int32_t destCapacity,
                   UBool *caseFlags,
                   UErrorCode *pErrorCode) {
-    int32_t n, destLength, i, bias, basicLength, j, in, oldi, w, k, digit, t,
+    int32_t n, destLength, i, bias, basicLength, j, in,
             destCPCount, firstSupplementaryIndex, cpLength;
     UChar b;
 
@@ -444,81 +558,12 @@ u_strFromPunycode(const UChar *src, int32_t srcLength,
          * in is the index of the next character to be consumed, and
          * destCPCount is the number of code points in the output array.
          *
-         * Decode a generalized variable-length integer into delta,
-         * which gets added to i.  The overflow checking is easier
-         * if we increase i as we go, then subtract off its starting
-         * value at the end to obtain delta.
-         */
-        for(oldi=i, w=1, k=BASE; /* no condition */; k+=BASE) {
-            if(in>=srcLength) {
-                *pErrorCode=U_ILLEGAL_CHAR_FOUND;
-                return 0;
-            }
-
-            digit=basicToDigit[(uint8_t)src[in++]];
-            if(digit<0) {
-                *pErrorCode=U_INVALID_CHAR_FOUND;
-                return 0;
-            }
-            if(digit>(0x7fffffff-i)/w) {
-                /* integer overflow */
-                *pErrorCode=U_ILLEGAL_CHAR_FOUND;
-                return 0;
-            }
-
-            i+=digit*w;
-            /** RAM: comment out the old code for conformance with draft-ietf-idn-punycode-03.txt  
-            t=k-bias;
-            if(t<TMIN) {
-                t=TMIN;
-            } else if(t>TMAX) {
-                t=TMAX;
-            }
-            */
-            t=k-bias;
-            if(t<TMIN) {
-                t=TMIN;
-            } else if(k>=(bias+TMAX)) {
-                t=TMAX;
-            }
-            if(digit<t) {
-                break;
-            }
-
-            if(w>0x7fffffff/(BASE-t)) {
-                /* integer overflow */
-                *pErrorCode=U_ILLEGAL_CHAR_FOUND;
-                return 0;
-            }
-            w*=BASE-t;
-        }
-
-        /*
          * Modification from sample code:
          * Increments destCPCount here,
          * where needed instead of in for() loop tail.
          */
         ++destCPCount;
-        bias=adaptBias(i-oldi, destCPCount, (UBool)(oldi==0));
-
-        /*
-         * i was supposed to wrap around from (incremented) destCPCount to 0,
-         * incrementing n each time, so we'll fix that now:
-         */
-        if(i/destCPCount>(0x7fffffff-n)) {
-            /* integer overflow */
-            *pErrorCode=U_ILLEGAL_CHAR_FOUND;
-            return 0;
-        }
-
-        n+=i/destCPCount;
-        i%=destCPCount;
-        /* not needed for Punycode: */
-        /* if (decode_digit(n) <= BASE) return punycode_invalid_input; */
-
-        if(n>0x10ffff || U_IS_SURROGATE(n)) {
-            /* Unicode code point overflow */
-            *pErrorCode=U_ILLEGAL_CHAR_FOUND;
+        if(!decodeNext(src, srcLength, in, n, i, bias, destCPCount, pErrorCode)) {
             return 0;
         }
 
@@ -584,6 +629,136 @@ u_strFromPunycode(const UChar *src, int32_t srcLength,
     return u_terminateUChars(dest, destCapacity, destLength, pErrorCode);
 }
 
+U_CFUNC int32_t
+u_strToPunycodeUTF8(const char *src, int32_t srcLength,
+                    char *dest, int32_t destCapacity,
+                    UErrorCode *pErrorCode) {
+    int32_t cpBuffer[MAX_CP_COUNT];
+    int32_t destLength, j, srcCPCount;
+    UChar32 c;
+
+    /* argument checking */
+    if(pErrorCode==NULL || U_FAILURE(*pErrorCode)) {
+        return 0;
+    }
+
+    if(src==NULL || srcLength<-1 || (dest==NULL && destCapacity!=0)) {
+        *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+
+    if(srcLength==-1) {
+        srcLength=(int32_t)uprv_strlen(src);
+    }
+    const uint8_t *s=reinterpret_cast<const uint8_t *>(src);
+
+    /*
+     * Copy the basic code points and
+     * convert extended ones to UTF-32 in cpBuffer, without case flags.
+     */
+    srcCPCount=destLength=0;
+    for(j=0; j<srcLength;) {
+        if(srcCPCount==MAX_CP_COUNT) {
+            /* too many input code points */
+            *pErrorCode=U_INDEX_OUTOFBOUNDS_ERROR;
+            return 0;
+        }
+        U8_NEXT(s, j, srcLength, c);
+        if(c<0) {
+            /* error: ill-formed UTF-8 */
+            *pErrorCode=U_INVALID_CHAR_FOUND;
+            return 0;
+        } else if(IS_BASIC(c)) {
+            cpBuffer[srcCPCount++]=0;
+            if(destLength<destCapacity) {
+                dest[destLength]=(char)c;
+            }
+            ++destLength;
+        } else {
+            cpBuffer[srcCPCount++]=c;
+        }
+    }
+
+    destLength=encodeExtended(cpBuffer, srcCPCount, destLength, dest, destCapacity, pErrorCode);
+    return u_terminateChars(dest, destCapacity, destLength, pErrorCode);
+}
+
+U_CFUNC int32_t
+u_strFromPunycodeUTF8(const char *src, int32_t srcLength,
+                      char *dest, int32_t destCapacity,
+                      UErrorCode *pErrorCode) {
+    int32_t n, destLength, i, bias, basicLength, j, in, destCPCount;
+
+    /* argument checking */
+    if(pErrorCode==NULL || U_FAILURE(*pErrorCode)) {
+        return 0;
+    }
+
+    if(src==NULL || srcLength<-1 || (dest==NULL && destCapacity!=0)) {
+        *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+
+    if(srcLength==-1) {
+        srcLength=(int32_t)uprv_strlen(src);
+    }
+    const uint8_t *s=reinterpret_cast<const uint8_t *>(src);
+
+    /*
+     * Each input character yields at most one code point.
+     * Decode into UTF-32 where insertions are by code point index,
+     * then write UTF-8.
+     */
+    MaybeStackArray<int32_t, MAX_CP_COUNT> cpBuffer;
+    if(srcLength>cpBuffer.getCapacity() && cpBuffer.resize(srcLength)==NULL) {
+        *pErrorCode=U_MEMORY_ALLOCATION_ERROR;
+        return 0;
+    }
+
+    /* Copy the basic code points before the last delimiter. */
+    for(j=srcLength; j>0;) {
+        if(s[--j]==DELIMITER) {
+            break;
+        }
+    }
+    basicLength=destCPCount=j;
+    while(j>0) {
+        n=s[--j];
+        if(!IS_BASIC(n)) {
+            *pErrorCode=U_INVALID_CHAR_FOUND;
+            return 0;
+        }
+        cpBuffer[j]=n;
+    }
+
+    n=INITIAL_N;
+    i=0;
+    bias=INITIAL_BIAS;
+    for(in=basicLength>0 ? basicLength+1 : 0; in<srcLength; /* no op */) {
+        ++destCPCount;
+        if(!decodeNext(s, srcLength, in, n, i, bias, destCPCount, pErrorCode)) {
+            return 0;
+        }
+        /* Insert n at position i of the output: */
+        if(i<destCPCount-1) {
+            uprv_memmove(cpBuffer.getAlias()+i+1, cpBuffer.getAlias()+i,
+                         (destCPCount-1-i)*4);
+        }
+        cpBuffer[i++]=n;
+    }
+
+    destLength=0;
+    for(j=0; j<destCPCount; ++j) {
+        UChar32 c=cpBuffer[j];
+        if((destLength+U8_LENGTH(c))<=destCapacity) {
+            U8_APPEND_UNSAFE(dest, destLength, c);
+        } else {
+            destLength+=U8_LENGTH(c);
+        }
+    }
+    return u_terminateChars(dest, destCapacity, destLength, pErrorCode);
+}
+
 /* ### check notes on overflow handling - only necessary if not IDNA? are these Punycode functions to be public? */
 
 #endif /* #if !UCONFIG_NO_IDNA */
@@ -73,8 +73,9 @@ u_strToPunycode(const UChar *src, int32_t srcLength,
 
 /**
  * u_strFromPunycode() converts Punycode to Unicode.
- * The Unicode string will be at most as long (in UChars)
- * than the Punycode string (in chars).
+ * The Unicode string will be at most twice as long (in UChars)
+ * as the Punycode string (in chars):
+ * Each input character yields at most one code point.
  *
  * @param src Input Punycode string.
  * @param srcLength Length of puny, or -1 if NUL-terminated
@@ -106,6 +107,51 @@ u_strFromPunycode(const UChar *src, int32_t srcLength,
                   UBool *caseFlags,
                   UErrorCode *pErrorCode);
 
+/**
+ * u_strToPunycodeUTF8() converts UTF-8 to Punycode,
+ * without intermediate UTF-16 and without case flags.
+ * Otherwise the same as u_strToPunycode().
+ *
+ * @param src Input UTF-8 string.
+ *            U_INDEX_OUTOFBOUNDS_ERROR is set if it contains
+ *            too many code points, see u_strToPunycode().
+ * @param srcLength Number of bytes in src, or -1 if NUL-terminated.
+ * @param dest Output Punycode buffer.
+ * @param destCapacity Size of dest.
+ * @param pErrorCode ICU in/out error code parameter.
+ *                   U_INVALID_CHAR_FOUND if src is not well-formed UTF-8.
+ * @return Number of ASCII characters in the Punycode string.
+ *
+ * @see u_strToPunycode
+ * @see u_strFromPunycodeUTF8
+ */
+U_CFUNC int32_t
+u_strToPunycodeUTF8(const char *src, int32_t srcLength,
+                    char *dest, int32_t destCapacity,
+                    UErrorCode *pErrorCode);
+
+/**
+ * u_strFromPunycodeUTF8() converts Punycode to UTF-8,
+ * without intermediate UTF-16 and without case flags.
+ * Otherwise the same as u_strFromPunycode().
+ * The UTF-8 string will be at most four times as long as the Punycode string.
+ *
+ * @param src Input Punycode string.
+ * @param srcLength Length of src, or -1 if NUL-terminated.
+ * @param dest Output UTF-8 string buffer.
+ * @param destCapacity Size of dest in bytes.
+ * @param pErrorCode ICU in/out error code parameter.
+ *                   Same errors as for u_strFromPunycode().
+ * @return Number of bytes written to dest.
+ *
+ * @see u_strFromPunycode
+ * @see u_strToPunycodeUTF8
+ */
+U_CFUNC int32_t
+u_strFromPunycodeUTF8(const char *src, int32_t srcLength,
+                      char *dest, int32_t destCapacity,
+                      UErrorCode *pErrorCode);
+
 #endif /* #if !UCONFIG_NO_IDNA */
 
 #endif
@@ -2153,12 +2153,13 @@ int_getDefaultCodepage()
 U_CAPI const char*  U_EXPORT2
 uprv_getDefaultCodepage()
 {
+    static UMutex defaultCodepageMutex;
     static char const  *name = NULL;
-    umtx_lock(NULL);
+    umtx_lock(&defaultCodepageMutex);
     if (name == NULL) {
         name = int_getDefaultCodepage();
     }
-    umtx_unlock(NULL);
+    umtx_unlock(&defaultCodepageMutex);
     return name;
 }
 #endif  /* !U_CHARSET_IS_UTF8 */
@@ -25,6 +25,8 @@
 #include "unicode/uchriter.h"
 #include "unicode/uclean.h"
 #include "unicode/udata.h"
+#include "unicode/utf16.h"
+#include "unicode/utf8.h"
 
 #include "brkeng.h"
 #include "ucln_cmn.h"
@@ -36,6 +38,7 @@
 #include "rbbirb.h"
 #include "uassert.h"
 #include "umutex.h"
+#include "utext_imp.h"
 #include "uvectr32.h"
 
 #ifdef RBBI_DEBUG
@@ -222,9 +225,29 @@ RuleBasedBreakIterator::operator=(const RuleBasedBreakIterator& that) {
 
     if (fLanguageBreakEngines != NULL) {
         delete fLanguageBreakEngines;
-        fLanguageBreakEngines = NULL;   // Just rebuild for now
+        fLanguageBreakEngines = NULL;
+    }
+    // The engines found so far by "that" are owned by the break engine factories,
+    // are immutable, and can be shared; copying them saves looking them up again.
+    // The exception is the unhandled-characters engine, which is per iterator.
+    if (that.fLanguageBreakEngines != NULL) {
+        UErrorCode engineStatus = U_ZERO_ERROR;
+        fLanguageBreakEngines = new UStack(engineStatus);
+        if (fLanguageBreakEngines == NULL) {
+            engineStatus = U_MEMORY_ALLOCATION_ERROR;
+        }
+        for (int32_t i = 0; U_SUCCESS(engineStatus) && i < that.fLanguageBreakEngines->size(); ++i) {
+            void *lbe = that.fLanguageBreakEngines->elementAt(i);
+            if (lbe != that.fUnhandledBreakEngine) {
+                fLanguageBreakEngines->push(lbe, engineStatus);
+            }
+        }
+        if (U_FAILURE(engineStatus)) {
+            // Just rebuild on demand.
+            delete fLanguageBreakEngines;
+            fLanguageBreakEngines = NULL;
+        }
     }
-    // TODO: clone fLanguageBreakEngines from "that"
     UErrorCode status = U_ZERO_ERROR;
     utext_clone(&fText, &that.fText, FALSE, TRUE, &status);
 
@@ -261,7 +284,10 @@ RuleBasedBreakIterator::operator=(const RuleBasedBreakIterator& that) {
     //       the iteration without the caches present would go to the rules, with
     //       the assumption that the current position is on a rule boundary.
     fBreakCache->reset(fPosition, fRuleStatusIndex);
+    fBreakCache->copyIndex(*that.fBreakCache);
     fDictionaryCache->reset();
+    fDictionaryCache->fExecutor = that.fDictionaryCache->fExecutor;
+    fDictionaryCache->fExecutorContext = that.fDictionaryCache->fExecutorContext;
 
     return *this;
 }
@@ -387,6 +413,7 @@ void RuleBasedBreakIterator::setText(UText *ut, UErrorCode &status) {
         return;
     }
     fBreakCache->reset();
+    fBreakCache->resetIndex();
     fDictionaryCache->reset();
     utext_clone(&fText, ut, FALSE, TRUE, &status);
 
@@ -442,6 +469,7 @@ RuleBasedBreakIterator::adoptText(CharacterIterator* newText) {
     fCharIter = newText;
     UErrorCode status = U_ZERO_ERROR;
     fBreakCache->reset();
+    fBreakCache->resetIndex();
     fDictionaryCache->reset();
     if (newText==NULL || newText->startIndex() != 0) {
         // startIndex !=0 wants to be an error, but there's no way to report it.
@@ -462,6 +490,7 @@ void
 RuleBasedBreakIterator::setText(const UnicodeString& newText) {
     UErrorCode status = U_ZERO_ERROR;
     fBreakCache->reset();
+    fBreakCache->resetIndex();
     fDictionaryCache->reset();
     utext_openConstUnicodeString(&fText, &newText, &status);
 
@@ -746,6 +775,108 @@ struct LookAheadResults {
 };
 
 
+//-----------------------------------------------------------------------------------
+//
+//  Text readers for the state machines.
+//     The general one goes through the UText functions. The others read
+//     contiguous UTF-16 and UTF-8 strings directly, which saves the UText chunk
+//     checks and the native index mapping for every character.
+//     All of them return U_SENTINEL at the ends of the text, and setIndex()
+//     moves to the start of the code point containing the index, like
+//     utext_setNativeIndex().
+//
+//-----------------------------------------------------------------------------------
+namespace {
+
+class UTextBreakReader {
+public:
+    UTextBreakReader(UText *ut) : fUT(ut) {}
+    void setIndex(int32_t index) { UTEXT_SETNATIVEINDEX(fUT, index); }
+    int32_t getIndex() const { return (int32_t)UTEXT_GETNATIVEINDEX(fUT); }
+    UChar32 next32() { return UTEXT_NEXT32(fUT); }
+    UChar32 previous32() { return UTEXT_PREVIOUS32(fUT); }
+private:
+    UText *fUT;
+};
+
+class UTF16BreakReader {
+public:
+    UTF16BreakReader(const UChar *s, int32_t length) : fS(s), fIndex(0), fLength(length) {}
+    void setIndex(int32_t index) {
+        if (index <= 0) {
+            index = 0;
+        } else if (index >= fLength) {
+            index = fLength;
+        } else {
+            U16_SET_CP_START(fS, 0, index);
+        }
+        fIndex = index;
+    }
+    int32_t getIndex() const { return fIndex; }
+    UChar32 next32() {
+        if (fIndex >= fLength) {
+            return U_SENTINEL;
+        }
+        UChar32 c;
+        U16_NEXT(fS, fIndex, fLength, c);
+        return c;
+    }
+    UChar32 previous32() {
+        if (fIndex <= 0) {
+            return U_SENTINEL;
+        }
+        UChar32 c;
+        U16_PREV(fS, 0, fIndex, c);
+        return c;
+    }
+private:
+    const UChar *fS;
+    int32_t fIndex;
+    int32_t fLength;
+};
+
+class UTF8BreakReader {
+public:
+    UTF8BreakReader(const uint8_t *s, int32_t length) : fS(s), fIndex(0), fLength(length) {}
+    void setIndex(int32_t index) {
+        if (index <= 0) {
+            index = 0;
+        } else if (index >= fLength) {
+            index = fLength;
+        } else {
+            U8_SET_CP_START(fS, 0, index);
+        }
+        fIndex = index;
+    }
+    int32_t getIndex() const { return fIndex; }
+    UChar32 next32() {
+        if (fIndex >= fLength) {
+            return U_SENTINEL;
+        }
+        UChar32 c = fS[fIndex];
+        if (U8_IS_SINGLE(c)) {
+            ++fIndex;
+        } else {
+            U8_NEXT_OR_FFFD(fS, fIndex, fLength, c);
+        }
+        return c;
+    }
+    UChar32 previous32() {
+        if (fIndex <= 0) {
+            return U_SENTINEL;
+        }
+        UChar32 c;
+        U8_PREV_OR_FFFD(fS, 0, fIndex, c);
+        return c;
+    }
+private:
+    const uint8_t *fS;
+    int32_t fIndex;
+    int32_t fLength;
+};
+
+}  // namespace
+
 //-----------------------------------------------------------------------------------
 //
 //  handleNext()
@@ -753,11 +884,73 @@ struct LookAheadResults {
 //
 //-----------------------------------------------------------------------------------
 int32_t RuleBasedBreakIterator::handleNext() {
+    UBool use8Bits = (fData->fForwardTable->fFlags & RBBI_8BITS_ROWS) != 0;
+    UBool asciiPairs = fData->fAsciiPairTags != NULL;
+    int32_t length;
+    const UChar *s16 = utext_getUTF16Contents(&fText, &length);
+    if (s16 != NULL) {
+        UTF16BreakReader text(s16, length);
+        if (asciiPairs && handleNextAsciiPair(text)) {
+            return fPosition;
+        }
+        return use8Bits ? handleNextImpl<RBBIStateTableRow8>(text) :
+                          handleNextImpl<RBBIStateTableRow16>(text);
+    }
+    const uint8_t *s8 = utext_getUTF8Contents(&fText, &length);
+    if (s8 != NULL) {
+        UTF8BreakReader text(s8, length);
+        if (asciiPairs && handleNextAsciiPair(text)) {
+            return fPosition;
+        }
+        return use8Bits ? handleNextImpl<RBBIStateTableRow8>(text) :
+                          handleNextImpl<RBBIStateTableRow16>(text);
+    }
+    UTextBreakReader text(&fText);
+    if (asciiPairs && handleNextAsciiPair(text)) {
+        return fPosition;
+    }
+    return use8Bits ? handleNextImpl<RBBIStateTableRow8>(text) :
+                      handleNextImpl<RBBIStateTableRow16>(text);
+}
+
+//-----------------------------------------------------------------------------------
+//
+//  handleNextAsciiPair()
+//     Fast path for handleNext(): if the text continues with two ASCII characters
+//     and the rules always put a boundary between them, set the boundary and its
+//     rule status without running the state machine.
+//     The pair table is derived from the forward state table when the data is loaded.
+//     Returns FALSE if the state machine needs to be run.
+//
+//-----------------------------------------------------------------------------------
+template<typename TextReader>
+UBool RuleBasedBreakIterator::handleNextAsciiPair(TextReader &text) {
+    text.setIndex(fPosition);
+    UChar32 c = text.next32();
+    if (0 <= c && c < 0x80) {
+        int32_t afterFirst = text.getIndex();
+        UChar32 c2 = text.next32();
+        if (0 <= c2 && c2 < 0x80) {
+            int32_t tag = fData->fAsciiPairTags[fData->fAsciiClasses[c] * fData->fAsciiClassCount +
+                                                fData->fAsciiClasses[c2]];
+            if (tag >= 0) {
+                fRuleStatusIndex = tag;
+                fDictionaryCharCount = 0;
+                fPosition = afterFirst;
+                return TRUE;
+            }
+        }
+    }
+    return FALSE;
+}
+
+template<typename RowType, typename TextReader>
+int32_t RuleBasedBreakIterator::handleNextImpl(TextReader text) {
     int32_t             state;
     uint16_t            category        = 0;
     RBBIRunMode         mode;
 
-    RBBIStateTableRow  *row;
+    const RowType      *row;
     UChar32             c;
     LookAheadResults    lookAheadMatches;
     int32_t             result             = 0;
@@ -765,6 +958,9 @@ int32_t RuleBasedBreakIterator::handleNext() {
     const RBBIStateTable *statetable       = fData->fForwardTable;
     const char         *tableData          = statetable->fTableData;
     uint32_t            tableRowLen        = statetable->fRowLen;
+    const UCPTrie      *trie               = fData->fTrie;
+    UBool               trie8              = trie->valueWidth == UCPTRIE_VALUE_BITS_8;
+    uint16_t            dictBit            = fData->fDictBit;
     #ifdef RBBI_DEBUG
         if (gTrace) {
             RBBIDebugPuts("Handle Next   pos   char  state category");
@@ -779,9 +975,9 @@ int32_t RuleBasedBreakIterator::handleNext() {
 
     // if we're already at the end of the text, return DONE.
     initialPosition = fPosition;
-    UTEXT_SETNATIVEINDEX(&fText, initialPosition);
+    text.setIndex(initialPosition);
     result          = initialPosition;
-    c               = UTEXT_NEXT32(&fText);
+    c               = text.next32();
     if (c==U_SENTINEL) {
         fDone = TRUE;
         return UBRK_DONE;
@@ -789,7 +985,7 @@ int32_t RuleBasedBreakIterator::handleNext() {
 
     //  Set the initial state for the state machine
     state = START_STATE;
-    row = (RBBIStateTableRow *)
+    row = (const RowType *)
             //(statetable->fTableData + (statetable->fRowLen * state));
             (tableData + tableRowLen * state);
 
@@ -825,26 +1021,27 @@ int32_t RuleBasedBreakIterator::handleNext() {
         if (mode == RBBI_RUN) {
             // look up the current character's character category, which tells us
             // which column in the state table to look at.
-            // Note:  the 16 in UTRIE_GET16 refers to the size of the data being returned,
-            //        not the size of the character going in, which is a UChar32.
+            // The trie width is fixed per break iterator data, so this branch
+            // is well predicted.
             //
-            category = UTRIE2_GET16(fData->fTrie, c);
+            category = trie8 ? UCPTRIE_FAST_GET(trie, UCPTRIE_8, c) :
+                               UCPTRIE_FAST_GET(trie, UCPTRIE_16, c);
 
             // Check the dictionary bit in the character's category.
             //    Counter is only used by dictionary based iteration.
             //    Chars that need to be handled by a dictionary have a flag bit set
             //    in their category values.
             //
-            if ((category & 0x4000) != 0)  {
+            if ((category & dictBit) != 0)  {
                 fDictionaryCharCount++;
                 //  And off the dictionary flag bit.
-                category &= ~0x4000;
+                category &= ~dictBit;
             }
         }
 
        #ifdef RBBI_DEBUG
             if (gTrace) {
-                RBBIDebugPrintf("             %4" PRId64 "   ", utext_getNativeIndex(&fText));
+                RBBIDebugPrintf("             %4d   ", text.getIndex());
                 if (0x20<=c && c<0x7f) {
                     RBBIDebugPrintf("\"%c\"  ", c);
                 } else {
@@ -860,7 +1057,7 @@ int32_t RuleBasedBreakIterator::handleNext() {
         // fNextState is a variable-length array.
         U_ASSERT(category<fData->fHeader->fCatCount);
         state = row->fNextState[category];  /*Not accessing beyond memory*/
-        row = (RBBIStateTableRow *)
+        row = (const RowType *)
             // (statetable->fTableData + (statetable->fRowLen * state));
             (tableData + tableRowLen * state);
 
@@ -868,7 +1065,7 @@ int32_t RuleBasedBreakIterator::handleNext() {
         if (row->fAccepting == -1) {
             // Match found, common case.
             if (mode != RBBI_START) {
-                result = (int32_t)UTEXT_GETNATIVEINDEX(&fText);
+                result = text.getIndex();
             }
             fRuleStatusIndex = row->fTagIdx;   // Remember the break status (tag) values.
         }
@@ -886,7 +1083,7 @@ int32_t RuleBasedBreakIterator::handleNext() {
         int16_t rule = row->fLookAhead;
         if (rule != 0) {
             // At the position of a '/' in a look-ahead match. Record it.
-            int32_t  pos = (int32_t)UTEXT_GETNATIVEINDEX(&fText);
+            int32_t  pos = text.getIndex();
             lookAheadMatches.setPosition(rule, pos);
         }
 
@@ -902,7 +1099,7 @@ int32_t RuleBasedBreakIterator::handleNext() {
         //    the input position.  The next iteration will be processing the
         //    first real input character.
         if (mode == RBBI_RUN) {
-            c = UTEXT_NEXT32(&fText);
+            c = text.next32();
         } else {
             if (mode == RBBI_START) {
                 mode = RBBI_RUN;
@@ -916,9 +1113,9 @@ int32_t RuleBasedBreakIterator::handleNext() {
     //   (This really indicates a defect in the break rules.  They should always match
     //    at least one character.)
     if (result == initialPosition) {
-        utext_setNativeIndex(&fText, initialPosition);
-        utext_next32(&fText);
-        result = (int32_t)utext_getNativeIndex(&fText);
+        text.setIndex(initialPosition);
+        text.next32();
+        result = text.getIndex();
         fRuleStatusIndex = 0;
     }
 
@@ -943,14 +1140,41 @@ int32_t RuleBasedBreakIterator::handleNext() {
 //
 //-----------------------------------------------------------------------------------
 int32_t RuleBasedBreakIterator::handleSafePrevious(int32_t fromPosition) {
+    if (fData == NULL) {
+        return BreakIterator::DONE;
+    }
+    UBool use8Bits = (fData->fReverseTable->fFlags & RBBI_8BITS_ROWS) != 0;
+    int32_t length;
+    const UChar *s16 = utext_getUTF16Contents(&fText, &length);
+    if (s16 != NULL) {
+        UTF16BreakReader text(s16, length);
+        return use8Bits ? handleSafePreviousImpl<RBBIStateTableRow8>(text, fromPosition) :
+                          handleSafePreviousImpl<RBBIStateTableRow16>(text, fromPosition);
+    }
+    const uint8_t *s8 = utext_getUTF8Contents(&fText, &length);
+    if (s8 != NULL) {
+        UTF8BreakReader text(s8, length);
+        return use8Bits ? handleSafePreviousImpl<RBBIStateTableRow8>(text, fromPosition) :
+                          handleSafePreviousImpl<RBBIStateTableRow16>(text, fromPosition);
+    }
+    UTextBreakReader text(&fText);
+    return use8Bits ? handleSafePreviousImpl<RBBIStateTableRow8>(text, fromPosition) :
+                      handleSafePreviousImpl<RBBIStateTableRow16>(text, fromPosition);
+}
+
+template<typename RowType, typename TextReader>
+int32_t RuleBasedBreakIterator::handleSafePreviousImpl(TextReader text, int32_t fromPosition) {
     int32_t             state;
     uint16_t            category        = 0;
-    RBBIStateTableRow  *row;
+    const RowType      *row;
     UChar32             c;
     int32_t             result          = 0;
 
     const RBBIStateTable *stateTable = fData->fReverseTable;
-    UTEXT_SETNATIVEINDEX(&fText, fromPosition);
+    const UCPTrie      *trie            = fData->fTrie;
+    UBool               trie8           = trie->valueWidth == UCPTRIE_VALUE_BITS_8;
+    uint16_t            dictBit         = fData->fDictBit;
+    text.setIndex(fromPosition);
     #ifdef RBBI_DEBUG
         if (gTrace) {
             RBBIDebugPuts("Handle Previous   pos   char  state category");
@@ -958,32 +1182,31 @@ int32_t RuleBasedBreakIterator::handleSafePrevious(int32_t fromPosition) {
     #endif
 
     // if we're already at the start of the text, return DONE.
-    if (fData == NULL || UTEXT_GETNATIVEINDEX(&fText)==0) {
+    if (fData == NULL || text.getIndex()==0) {
         return BreakIterator::DONE;
     }
 
     //  Set the initial state for the state machine
-    c = UTEXT_PREVIOUS32(&fText);
+    c = text.previous32();
     state = START_STATE;
-    row = (RBBIStateTableRow *)
+    row = (const RowType *)
             (stateTable->fTableData + (stateTable->fRowLen * state));
 
     // loop until we reach the start of the text or transition to state 0
     //
-    for (; c != U_SENTINEL; c = UTEXT_PREVIOUS32(&fText)) {
+    for (; c != U_SENTINEL; c = text.previous32()) {
 
         // look up the current character's character category, which tells us
         // which column in the state table to look at.
-        // Note:  the 16 in UTRIE_GET16 refers to the size of the data being returned,
-        //        not the size of the character going in, which is a UChar32.
         //
         //  And off the dictionary flag bit. For reverse iteration it is not used.
-        category = UTRIE2_GET16(fData->fTrie, c);
-        category &= ~0x4000;
+        category = trie8 ? UCPTRIE_FAST_GET(trie, UCPTRIE_8, c) :
+                           UCPTRIE_FAST_GET(trie, UCPTRIE_16, c);
+        category &= ~dictBit;
 
         #ifdef RBBI_DEBUG
             if (gTrace) {
-                RBBIDebugPrintf("             %4d   ", (int32_t)utext_getNativeIndex(&fText));
+                RBBIDebugPrintf("             %4d   ", text.getIndex());
                 if (0x20<=c && c<0x7f) {
                     RBBIDebugPrintf("\"%c\"  ", c);
                 } else {
@@ -998,7 +1221,7 @@ int32_t RuleBasedBreakIterator::handleSafePrevious(int32_t fromPosition) {
         // fNextState is a variable-length array.
         U_ASSERT(category<fData->fHeader->fCatCount);
         state = row->fNextState[category];  /*Not accessing beyond memory*/
-        row = (RBBIStateTableRow *)
+        row = (const RowType *)
             (stateTable->fTableData + (stateTable->fRowLen * state));
 
         if (state == STOP_STATE) {
@@ -1009,7 +1232,7 @@ int32_t RuleBasedBreakIterator::handleSafePrevious(int32_t fromPosition) {
     }
 
     // The state machine is done.  Check whether it found a match...
-    result = (int32_t)UTEXT_GETNATIVEINDEX(&fText);
+    result = text.getIndex();
     #ifdef RBBI_DEBUG
         if (gTrace) {
             RBBIDebugPrintf("result = %d\n\n", result);
@@ -1060,6 +1283,94 @@ int32_t RuleBasedBreakIterator::getRuleStatusVec(
 
 
 
+//-------------------------------------------------------------------------------
+//
+//   setBoundaryIndexEnabled
+//
+//-------------------------------------------------------------------------------
+void RuleBasedBreakIterator::setBoundaryIndexEnabled(UBool enabled) {
+    fBreakCache->setIndexEnabled(enabled);
+}
+
+
+UBool RuleBasedBreakIterator::isBoundaryIndexEnabled() const {
+    return fBreakCache->isIndexEnabled();
+}
+
+
+void RuleBasedBreakIterator::setExecutor(UBreakIteratorExecutor *executor,
+                                         const void *executorContext) {
+    fDictionaryCache->fExecutor = executor;
+    fDictionaryCache->fExecutorContext = executorContext;
+}
+
+
+//-------------------------------------------------------------------------------
+//
+//   getBoundaries         Bulk forward iteration. Boundaries that the break cache
+//                         would have to compute anyway are found by running
+//                         handleNext() directly, without adding them to the cache.
+//                         Rule segments that contain dictionary characters, and
+//                         boundaries that are already cached, go through the cache.
+//
+//-------------------------------------------------------------------------------
+int32_t RuleBasedBreakIterator::getBoundaries(int32_t *boundaries, int32_t *ruleStatuses,
+                                              int32_t capacity, UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return 0;
+    }
+    if (capacity < 0 || (boundaries == NULL && capacity > 0)) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+
+    int32_t length = 0;
+    // TRUE while fPosition is ahead of the break cache, which then needs a reset.
+    UBool ranRules = FALSE;
+    while (length < capacity) {
+        if ((ranRules || fBreakCache->isAtEnd()) &&
+                (fPosition < fDictionaryCache->fStart || fDictionaryCache->fLimit <= fPosition)) {
+            int32_t fromPosition = fPosition;
+            int32_t fromRuleStatusIdx = fRuleStatusIndex;
+            if (handleNext() == UBRK_DONE) {
+                break;
+            }
+            if (fDictionaryCharCount > 0) {
+                // Let the break cache subdivide this segment.
+                fPosition = fromPosition;
+                fRuleStatusIndex = fromRuleStatusIdx;
+                fBreakCache->reset(fromPosition, fromRuleStatusIdx);
+                ranRules = FALSE;
+                fBreakCache->next();
+                if (fDone) {
+                    break;
+                }
+            } else {
+                ranRules = TRUE;
+            }
+        } else {
+            if (ranRules) {
+                fBreakCache->reset(fPosition, fRuleStatusIndex);
+                ranRules = FALSE;
+            }
+            fBreakCache->next();
+            if (fDone) {
+                break;
+            }
+        }
+        boundaries[length] = fPosition;
+        if (ruleStatuses != NULL) {
+            ruleStatuses[length] = getRuleStatus();
+        }
+        ++length;
+    }
+    if (ranRules) {
+        fBreakCache->reset(fPosition, fRuleStatusIndex);
+    }
+    return length;
+}
+
+
 //-------------------------------------------------------------------------------
 //
 //   getBinaryRules        Access to the compiled form of the rules,
@@ -14,6 +14,7 @@
 
 #include "brkeng.h"
 #include "cmemory.h"
+#include "dictbe.h"
 #include "rbbidata.h"
 #include "rbbirb.h"
 #include "uassert.h"
@@ -27,10 +28,12 @@ U_NAMESPACE_BEGIN
 
 RuleBasedBreakIterator::DictionaryCache::DictionaryCache(RuleBasedBreakIterator *bi, UErrorCode &status) :
         fBI(bi), fBreaks(status), fPositionInCache(-1),
-        fStart(0), fLimit(0), fFirstRuleStatusIndex(0), fOtherRuleStatusIndex(0) {
+        fStart(0), fLimit(0), fFirstRuleStatusIndex(0), fOtherRuleStatusIndex(0), fBuffers(nullptr),
+        fExecutor(nullptr), fExecutorContext(nullptr) {
 }
 
 RuleBasedBreakIterator::DictionaryCache::~DictionaryCache() {
+    delete fBuffers;
 }
 
 void RuleBasedBreakIterator::DictionaryCache::reset() {
@@ -136,19 +139,33 @@ void RuleBasedBreakIterator::DictionaryCache::populateDictionary(int32_t startPo
     int32_t     foundBreakCount = 0;
     UText      *text = &fBI->fText;
 
+    if (fBuffers == nullptr) {
+        fBuffers = new DictionaryBreakBuffers(status);
+        if (U_FAILURE(status)) {
+            // Without buffers the engines use temporary ones.
+            delete fBuffers;
+            fBuffers = nullptr;
+            status = U_ZERO_ERROR;
+        }
+    }
+    if (fBuffers != nullptr) {
+        fBuffers->executor = fExecutor;
+        fBuffers->executorContext = fExecutorContext;
+    }
+
     // Loop through the text, looking for ranges of dictionary characters.
     // For each span, find the appropriate break engine, and ask it to find
     // any breaks within the span.
 
     utext_setNativeIndex(text, rangeStart);
     UChar32     c = utext_current32(text);
-    category = UTRIE2_GET16(fBI->fData->fTrie, c);
+    category = fBI->fData->getCategory(c);
 
     while(U_SUCCESS(status)) {
-        while((current = (int32_t)UTEXT_GETNATIVEINDEX(text)) < rangeEnd && (category & 0x4000) == 0) {
+        while((current = (int32_t)UTEXT_GETNATIVEINDEX(text)) < rangeEnd && (category & fBI->fData->fDictBit) == 0) {
             utext_next32(text);           // TODO: cleaner loop structure.
             c = utext_current32(text);
-            category = UTRIE2_GET16(fBI->fData->fTrie, c);
+            category = fBI->fData->getCategory(c);
         }
         if (current >= rangeEnd) {
             break;
@@ -161,12 +178,12 @@ void RuleBasedBreakIterator::DictionaryCache::populateDictionary(int32_t startPo
         // Ask the language object if there are any breaks. It will add them to the cache and
         // leave the text pointer on the other side of its range, ready to search for the next one.
         if (lbe != NULL) {
-            foundBreakCount += lbe->findBreaks(text, rangeStart, rangeEnd, fBreaks);
+            foundBreakCount += lbe->findBreaks(text, rangeStart, rangeEnd, fBreaks, fBuffers);
         }
 
         // Reload the loop variables for the next go-round
         c = utext_current32(text);
-        category = UTRIE2_GET16(fBI->fData->fTrie, c);
+        category = fBI->fData->getCategory(c);
     }
 
     // If we found breaks, ensure that the first and last entries are
@@ -203,7 +220,8 @@ void RuleBasedBreakIterator::DictionaryCache::populateDictionary(int32_t startPo
  */
 
 RuleBasedBreakIterator::BreakCache::BreakCache(RuleBasedBreakIterator *bi, UErrorCode &status) :
-        fBI(bi), fSideBuffer(status) {
+        fBI(bi), fSideBuffer(status), fIndexEnabled(FALSE),
+        fIndexBoundaries(status), fIndexStatuses(status), fIndexLimit(0), fIndexCount(0) {
     reset();
 }
 
@@ -222,6 +240,84 @@ void RuleBasedBreakIterator::BreakCache::reset(int32_t pos, int32_t ruleStatus)
 }
 
 
+void RuleBasedBreakIterator::BreakCache::setIndexEnabled(UBool enabled) {
+    if (!enabled) {
+        resetIndex();
+    }
+    fIndexEnabled = enabled;
+}
+
+
+void RuleBasedBreakIterator::BreakCache::resetIndex() {
+    fIndexBoundaries.removeAllElements();
+    fIndexStatuses.removeAllElements();
+    fIndexLimit = 0;
+    fIndexCount = 0;
+}
+
+
+void RuleBasedBreakIterator::BreakCache::copyIndex(const BreakCache &other) {
+    UErrorCode status = U_ZERO_ERROR;
+    fIndexEnabled = other.fIndexEnabled;
+    fIndexBoundaries.assign(other.fIndexBoundaries, status);
+    fIndexStatuses.assign(other.fIndexStatuses, status);
+    fIndexLimit = other.fIndexLimit;
+    fIndexCount = other.fIndexCount;
+    if (U_FAILURE(status)) {
+        resetIndex();
+    }
+}
+
+
+UBool RuleBasedBreakIterator::BreakCache::seekIndex(int32_t position, int32_t &boundary, int32_t &ruleStatusIdx) {
+    if (!fIndexEnabled) {
+        return FALSE;
+    }
+    if (fIndexLimit < position) {
+        // Extend the index by running the rules forward from its end.
+        UErrorCode status = U_ZERO_ERROR;
+        fBI->fPosition = fIndexLimit;
+        while (fIndexLimit < position) {
+            int32_t pos = fBI->handleNext();
+            if (pos == UBRK_DONE) {
+                break;
+            }
+            fIndexLimit = pos;
+            if (++fIndexCount == INDEX_INTERVAL) {
+                fIndexCount = 0;
+                fIndexBoundaries.addElement(pos, status);
+                fIndexStatuses.addElement(fBI->fRuleStatusIndex, status);
+            }
+        }
+        if (U_FAILURE(status)) {
+            // Keep the two vectors in step; the index is rebuilt on the next use.
+            resetIndex();
+            return FALSE;
+        }
+    }
+
+    // Binary search for the first index entry following the position.
+    int32_t min = 0;
+    int32_t max = fIndexBoundaries.size();
+    while (min < max) {
+        int32_t probe = (min + max) / 2;
+        if (fIndexBoundaries.elementAti(probe) <= position) {
+            min = probe + 1;
+        } else {
+            max = probe;
+        }
+    }
+    if (min == 0) {
+        boundary = 0;
+        ruleStatusIdx = 0;
+    } else {
+        boundary = fIndexBoundaries.elementAti(min - 1);
+        ruleStatusIdx = fIndexStatuses.elementAti(min - 1);
+    }
+    return TRUE;
+}
+
+
 int32_t  RuleBasedBreakIterator::BreakCache::current() {
     fBI->fPosition = fTextIdx;
     fBI->fRuleStatusIndex = fStatuses[fBufIdx];
@@ -350,7 +446,20 @@ UBool RuleBasedBreakIterator::BreakCache::populateNear(int32_t position, UErrorC
     if ((position < fBoundaries[fStartBufIdx] - 15) || position > (fBoundaries[fEndBufIdx] + 15)) {
         int32_t aBoundary = 0;
         int32_t ruleStatusIndex = 0;
-        if (position > 20) {
+        if (seekIndex(position, aBoundary, ruleStatusIndex)) {
+            // Advance from the indexed boundary with the rules alone, to the last rule boundary
+            // at or preceding the position, so that only the segment containing the position
+            // goes to the dictionary.
+            fBI->fPosition = aBoundary;
+            for (;;) {
+                int32_t pos = fBI->handleNext();
+                if (pos == UBRK_DONE || pos > position) {
+                    break;
+                }
+                aBoundary = pos;
+                ruleStatusIndex = fBI->fRuleStatusIndex;
+            }
+        } else if (position > 20) {
             int32_t backupPos = fBI->handleSafePrevious(position);
 
             if (backupPos > 0) {
@@ -489,40 +598,42 @@ UBool RuleBasedBreakIterator::BreakCache::populatePreceding(UErrorCode &status)
         return TRUE;
     }
 
-    int32_t backupPosition = fromPosition;
-
-    // Find a boundary somewhere preceding the first already-cached boundary
-    do {
-        backupPosition = backupPosition - 30;
-        if (backupPosition <= 0) {
-            backupPosition = 0;
-        } else {
-            backupPosition = fBI->handleSafePrevious(backupPosition);
-        }
-        if (backupPosition == UBRK_DONE || backupPosition == 0) {
-            position = 0;
-            positionStatusIdx = 0;
-        } else {
-            // Advance to the boundary following the backup position.
-            // There is a complication: the safe reverse rules identify pairs of code points
-            // that are safe. If advancing from the safe point moves forwards by less than
-            // two code points, we need to advance one more time to ensure that the boundary
-            // is good, including a correct rules status value.
-            //
-            fBI->fPosition = backupPosition;
-            position = fBI->handleNext();
-            if (position <= backupPosition + 4) {
-                // +4 is a quick test for possibly having advanced only one codepoint.
-                // Four being the length of the longest potential code point, a supplementary in UTF-8
-                utext_setNativeIndex(&fBI->fText, position);
-                if (backupPosition == utext_getPreviousNativeIndex(&fBI->fText)) {
-                    // The initial handleNext() only advanced by a single code point. Go again.
-                    position = fBI->handleNext();   // Safe rules identify safe pairs.
-                }
-            };
-            positionStatusIdx = fBI->fRuleStatusIndex;
-        }
-    } while (position >= fromPosition);
+    // With a boundary index, start from the indexed boundary preceding the first cached one.
+    // Otherwise find a boundary somewhere preceding the first already-cached boundary.
+    if (!seekIndex(fromPosition - 1, position, positionStatusIdx)) {
+        int32_t backupPosition = fromPosition;
+        do {
+            backupPosition = backupPosition - 30;
+            if (backupPosition <= 0) {
+                backupPosition = 0;
+            } else {
+                backupPosition = fBI->handleSafePrevious(backupPosition);
+            }
+            if (backupPosition == UBRK_DONE || backupPosition == 0) {
+                position = 0;
+                positionStatusIdx = 0;
+            } else {
+                // Advance to the boundary following the backup position.
+                // There is a complication: the safe reverse rules identify pairs of code points
+                // that are safe. If advancing from the safe point moves forwards by less than
+                // two code points, we need to advance one more time to ensure that the boundary
+                // is good, including a correct rules status value.
+                //
+                fBI->fPosition = backupPosition;
+                position = fBI->handleNext();
+                if (position <= backupPosition + 4) {
+                    // +4 is a quick test for possibly having advanced only one codepoint.
+                    // Four being the length of the longest potential code point, a supplementary in UTF-8
+                    utext_setNativeIndex(&fBI->fText, position);
+                    if (backupPosition == utext_getPreviousNativeIndex(&fBI->fText)) {
+                        // The initial handleNext() only advanced by a single code point. Go again.
+                        position = fBI->handleNext();   // Safe rules identify safe pairs.
+                    }
+                };
+                positionStatusIdx = fBI->fRuleStatusIndex;
+            }
+        } while (position >= fromPosition);
+    }
 
     // Find boundaries between the one we just located and the first already-cached boundary
     // Put them in a side buffer, because we don't yet know where they will fall in the circular cache buffer..
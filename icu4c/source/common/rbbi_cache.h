@@ -17,6 +17,8 @@
 
 U_NAMESPACE_BEGIN
 
+class DictionaryBreakBuffers;
+
 /* DictionaryCache  stores the boundaries obtained from a run of dictionary characters.
  *                 Dictionary boundaries are moved first to this cache, then from here
  *                 to the main BreakCache, where they may inter-leave with non-dictionary
@@ -64,6 +66,10 @@ class RuleBasedBreakIterator::DictionaryCache: public UMemory {
                                                 //    text segment being handled by the dictionary.
     int32_t             fFirstRuleStatusIndex;  // Rule status info for first boundary.
     int32_t             fOtherRuleStatusIndex;  // Rule status info for 2nd through last boundaries.
+    DictionaryBreakBuffers *fBuffers;           // Working storage for the break engines, reused
+                                                //    from one dictionary run to the next.
+    UBreakIteratorExecutor *fExecutor;          // See RuleBasedBreakIterator::setExecutor(), or NULL.
+    const void         *fExecutorContext;
 };
 
 
@@ -101,6 +107,12 @@ class RuleBasedBreakIterator::BreakCache: public UMemory {
     void        nextOL();
     void        previous(UErrorCode &status);
 
+    /*
+     * Return TRUE if the iteration position is on the last cached boundary,
+     * so that next() has to find the following boundary.
+     */
+    UBool       isAtEnd() const { return fBufIdx == fEndBufIdx; }
+
     // Move the iteration state to the position following the startPosition.
     // Input position must be pinned to the input length.
     void        following(int32_t startPosition, UErrorCode &status);
@@ -175,14 +187,46 @@ class RuleBasedBreakIterator::BreakCache: public UMemory {
      */
     UBool                   seek(int32_t startPosition);
 
+    /*
+     * Turn the boundary index on or off.
+     * See RuleBasedBreakIterator::setBoundaryIndexEnabled().
+     */
+    void                    setIndexEnabled(UBool enabled);
+    UBool                   isIndexEnabled() const { return fIndexEnabled; }
+
+    /*
+     * Discard the boundary index, keeping it enabled or not.
+     * Needed whenever the iterator's text changes.
+     */
+    void                    resetIndex();
+
+    /*
+     * Copy the boundary index and its setting from another cache
+     * over the same text. On failure, the index is left empty.
+     */
+    void                    copyIndex(const BreakCache &other);
+
     void dumpCache();
 
   private:
     static inline int32_t   modChunkSize(int index) { return index & (CACHE_SIZE - 1); }
 
+    /*
+     * If the boundary index is enabled, find the indexed rule boundary at or
+     * preceding the position, extending the index up to the position as needed.
+     * The start of the text counts as indexed.
+     * Return FALSE if there is no index.
+     */
+    UBool                   seekIndex(int32_t position, int32_t &boundary, int32_t &ruleStatusIdx);
+
     static constexpr int32_t CACHE_SIZE = 128;
     static_assert((CACHE_SIZE & (CACHE_SIZE-1)) == 0, "CACHE_SIZE must be power of two.");
 
+    /*
+     * Number of rule boundaries from one boundary index entry to the next.
+     */
+    static constexpr int32_t INDEX_INTERVAL = 16;
+
     RuleBasedBreakIterator *fBI;
     int32_t                 fStartBufIdx;
     int32_t                 fEndBufIdx;    // inclusive
@@ -194,6 +238,12 @@ class RuleBasedBreakIterator::BreakCache: public UMemory {
     uint16_t                fStatuses[CACHE_SIZE];
 
     UVector32               fSideBuffer;
+
+    UBool                   fIndexEnabled;
+    UVector32               fIndexBoundaries;   // Every INDEX_INTERVAL'th rule boundary, ascending.
+    UVector32               fIndexStatuses;     // Rule status index for each of fIndexBoundaries.
+    int32_t                 fIndexLimit;        // Last rule boundary reached while building the index.
+    int32_t                 fIndexCount;        // Rule boundaries since the last index entry.
 };
 
 U_NAMESPACE_END
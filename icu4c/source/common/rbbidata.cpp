@@ -14,11 +14,13 @@
 #include "unicode/utypes.h"
 #include "rbbidata.h"
 #include "rbbirb.h"
-#include "utrie2.h"
+#include "unicode/ucptrie.h"
+#include "unicode/umutablecptrie.h"
 #include "udatamem.h"
 #include "cmemory.h"
 #include "cstring.h"
 #include "umutex.h"
+#include "utrie2.h"
 
 #include "uassert.h"
 
@@ -67,10 +69,45 @@ RBBIDataWrapper::RBBIDataWrapper(UDataMemory* udm, UErrorCode &status) {
 }
 
 UBool RBBIDataWrapper::isDataVersionAcceptable(const UVersionInfo version) {
-    return RBBI_DATA_FORMAT_VERSION[0] == version[0];
+    return RBBI_DATA_FORMAT_VERSION[0] == version[0] || version[0] == 5;
 }
 
 
+namespace {
+
+struct TrieCopyContext {
+    UMutableCPTrie *trie;
+    UErrorCode      status;
+};
+
+UBool U_CALLCONV copyTrieRange(const void *context, UChar32 start, UChar32 end, uint32_t value) {
+    TrieCopyContext *copy = (TrieCopyContext *)context;
+    umutablecptrie_setRange(copy->trie, start, end, value, &copy->status);
+    return U_SUCCESS(copy->status);
+}
+
+/*
+ * Format version 5 data has the character categories in a UTrie2 with 16-bit values.
+ * Copy them into a UCPTrie, as in version 6 data.
+ */
+UCPTrie *openTrieFromVersion5(const uint8_t *data, int32_t length, UErrorCode &status) {
+    UTrie2 *trie2 = utrie2_openFromSerialized(UTRIE2_16_VALUE_BITS, data, length, NULL, &status);
+    TrieCopyContext copy = { umutablecptrie_open(0, 0, &status), U_ZERO_ERROR };
+    UCPTrie *trie = NULL;
+    if (U_SUCCESS(status)) {
+        utrie2_enum(trie2, NULL, copyTrieRange, &copy);
+        status = copy.status;
+        trie = umutablecptrie_buildImmutable(copy.trie, UCPTRIE_TYPE_FAST, UCPTRIE_VALUE_BITS_16,
+                                             &status);
+    }
+    umutablecptrie_close(copy.trie);
+    utrie2_close(trie2);
+    return trie;
+}
+
+}  // namespace
+
+
 //-----------------------------------------------------------------------------
 //
 //    init().   Does most of the work of construction, shared between the
@@ -84,6 +121,9 @@ void RBBIDataWrapper::init0() {
     fRuleSource   = NULL;
     fRuleStatusTable = NULL;
     fTrie         = NULL;
+    fDictBit      = 0;
+    fAsciiClassCount = 0;
+    fAsciiPairTags = NULL;
     fUDataMem     = NULL;
     fRefCount     = 0;
     fDontFreeData = TRUE;
@@ -109,15 +149,35 @@ void RBBIDataWrapper::init(const RBBIDataHeader *data, UErrorCode &status) {
     if (data->fRTableLen != 0) {
         fReverseTable = (RBBIStateTable *)((char *)data + fHeader->fRTable);
     }
+    // Tables with 8-bit rows came with format version 6.
+    if (fHeader->fFormatVersion[0] == 5 &&
+            ((fForwardTable != NULL && (fForwardTable->fFlags & RBBI_8BITS_ROWS) != 0) ||
+             (fReverseTable != NULL && (fReverseTable->fFlags & RBBI_8BITS_ROWS) != 0))) {
+        status = U_INVALID_FORMAT_ERROR;
+        return;
+    }
 
-    fTrie = utrie2_openFromSerialized(UTRIE2_16_VALUE_BITS,
-                                      (uint8_t *)data + fHeader->fTrie,
-                                      fHeader->fTrieLen,
-                                      NULL,           // *actual length
-                                      &status);
+    if (fHeader->fFormatVersion[0] == 5) {
+        fTrie = openTrieFromVersion5((uint8_t *)data + fHeader->fTrie, fHeader->fTrieLen, status);
+    } else {
+        fTrie = ucptrie_openFromBinary(UCPTRIE_TYPE_FAST,
+                                       UCPTRIE_VALUE_BITS_ANY,
+                                       (uint8_t *)data + fHeader->fTrie,
+                                       fHeader->fTrieLen,
+                                       NULL,           // *actual length
+                                       &status);
+    }
     if (U_FAILURE(status)) {
         return;
     }
+    if (fTrie->valueWidth == UCPTRIE_VALUE_BITS_8) {
+        fDictBit = 0x80;
+    } else if (fTrie->valueWidth == UCPTRIE_VALUE_BITS_16) {
+        fDictBit = 0x4000;
+    } else {
+        status = U_INVALID_FORMAT_ERROR;
+        return;
+    }
 
     fRuleSource   = (UChar *)((char *)data + fHeader->fRuleSource);
     fRuleString.setTo(TRUE, fRuleSource, -1);
@@ -126,6 +186,11 @@ void RBBIDataWrapper::init(const RBBIDataHeader *data, UErrorCode &status) {
     fRuleStatusTable = (int32_t *)((char *)data + fHeader->fStatusTable);
     fStatusMaxIdx    = data->fStatusTableLen / sizeof(int32_t);
 
+    initAsciiPairTags(status);
+    if (U_FAILURE(status)) {
+        return;
+    }
+
     fRefCount = 1;
 
 #ifdef RBBI_DEBUG
@@ -135,6 +200,110 @@ void RBBIDataWrapper::init(const RBBIDataHeader *data, UErrorCode &status) {
 }
 
 
+//-----------------------------------------------------------------------------
+//
+//    initAsciiPairTags()   Precompute, for each pair of ASCII characters, whether
+//                          the forward state machine stops with a boundary right
+//                          after the first one, so that handleNext() can skip
+//                          the state machine in that case.
+//
+//-----------------------------------------------------------------------------
+namespace {
+
+// Same values as in rbbi.cpp.
+constexpr int32_t START_STATE = 1;
+constexpr int32_t STOP_STATE = 0;
+
+/*
+ * Runs the forward state machine like RuleBasedBreakIterator::handleNextImpl()
+ * over the two categories cat1 and cat2.
+ * Returns the rule status index if the match ends right after the first character
+ * no matter what follows the second one, otherwise -1.
+ */
+template<typename RowType>
+int32_t getPairTag(const RBBIStateTable *table, uint16_t cat1, uint16_t cat2) {
+    const char *tableData = table->fTableData;
+    uint32_t rowLen = table->fRowLen;
+    int32_t state = START_STATE;
+    const RowType *row = (const RowType *)(tableData + rowLen * state);
+    int32_t tag = 0;
+    UBool haveResult = FALSE;  // TRUE if the boundary after cat1 was matched
+    // Step 0 is the {bof} pseudo-category if required; it never sets the result.
+    int32_t step = (table->fFlags & RBBI_BOF_REQUIRED) ? 0 : 1;
+    for (; step <= 2; ++step) {
+        uint16_t category = step == 0 ? 2 : step == 1 ? cat1 : cat2;
+        state = row->fNextState[category];
+        row = (const RowType *)(tableData + rowLen * state);
+        if (row->fAccepting == -1) {
+            if (step == 2) {
+                return -1;  // The match extends past the second character.
+            }
+            haveResult = step == 1;
+            tag = row->fTagIdx;
+        }
+        if (row->fAccepting > 0 || row->fLookAhead != 0) {
+            return -1;  // Look-ahead rules need the full state machine.
+        }
+        if (state == STOP_STATE) {
+            // handleNextImpl() forces a boundary after the first character
+            // with status 0 if the rules did not match anything.
+            return haveResult ? tag : 0;
+        }
+    }
+    return -1;  // The outcome depends on more text.
+}
+
+}  // namespace
+
+void RBBIDataWrapper::initAsciiPairTags(UErrorCode &status) {
+    if (U_FAILURE(status) || fForwardTable == NULL) {
+        return;
+    }
+    uint16_t classCategories[0x80];
+    int32_t count = 0;
+    for (UChar32 c = 0; c < 0x80; ++c) {
+        uint16_t category = getCategory(c);
+        if ((category & fDictBit) != 0) {
+            return;  // Dictionary characters need the full state machine.
+        }
+        int32_t i = 0;
+        while (i < count && classCategories[i] != category) {
+            ++i;
+        }
+        if (i == count) {
+            classCategories[count++] = category;
+        }
+        fAsciiClasses[c] = (uint8_t)i;
+    }
+    int16_t *pairTags = (int16_t *)uprv_malloc(count * count * sizeof(int16_t));
+    if (pairTags == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    UBool use8Bits = (fForwardTable->fFlags & RBBI_8BITS_ROWS) != 0;
+    int32_t simpleCount = 0;
+    for (int32_t i = 0; i < count; ++i) {
+        for (int32_t j = 0; j < count; ++j) {
+            int32_t tag = use8Bits ?
+                getPairTag<RBBIStateTableRow8>(fForwardTable, classCategories[i], classCategories[j]) :
+                getPairTag<RBBIStateTableRow16>(fForwardTable, classCategories[i], classCategories[j]);
+            pairTags[i * count + j] = (int16_t)tag;
+            if (tag >= 0) {
+                ++simpleCount;
+            }
+        }
+    }
+    // A failed lookup costs a little, so only use the fast path for rules like
+    // the character and word rules where most ASCII pairs have a boundary.
+    if (simpleCount * 2 < count * count) {
+        uprv_free(pairTags);
+        return;
+    }
+    fAsciiClassCount = count;
+    fAsciiPairTags = pairTags;
+}
+
+
 //-----------------------------------------------------------------------------
 //
 //    Destructor.     Don't call this - use removeReference() instead.
@@ -142,8 +311,10 @@ void RBBIDataWrapper::init(const RBBIDataHeader *data, UErrorCode &status) {
 //-----------------------------------------------------------------------------
 RBBIDataWrapper::~RBBIDataWrapper() {
     U_ASSERT(fRefCount == 0);
-    utrie2_close(fTrie);
+    ucptrie_close(fTrie);
     fTrie = NULL;
+    uprv_free(fAsciiPairTags);
+    fAsciiPairTags = NULL;
     if (fUDataMem) {
         udata_close(fUDataMem);
     } else if (!fDontFreeData) {
@@ -236,12 +407,21 @@ void  RBBIDataWrapper::printTable(const char *heading, const RBBIStateTable *tab
         RBBIDebugPrintf("         N U L L   T A B L E\n\n");
         return;
     }
+    UBool use8Bits = (table->fFlags & RBBI_8BITS_ROWS) != 0;
     for (s=0; s<table->fNumStates; s++) {
-        RBBIStateTableRow *row = (RBBIStateTableRow *)
-                                  (table->fTableData + (table->fRowLen * s));
-        RBBIDebugPrintf("%4d  |  %3d %3d %3d ", s, row->fAccepting, row->fLookAhead, row->fTagIdx);
-        for (c=0; c<fHeader->fCatCount; c++)  {
-            RBBIDebugPrintf("%3d ", row->fNextState[c]);
+        const char *rowData = table->fTableData + (table->fRowLen * s);
+        if (use8Bits) {
+            const RBBIStateTableRow8 *row = (const RBBIStateTableRow8 *)rowData;
+            RBBIDebugPrintf("%4d  |  %3d %3d %3d ", s, row->fAccepting, row->fLookAhead, row->fTagIdx);
+            for (c=0; c<fHeader->fCatCount; c++)  {
+                RBBIDebugPrintf("%3d ", row->fNextState[c]);
+            }
+        } else {
+            const RBBIStateTableRow16 *row = (const RBBIStateTableRow16 *)rowData;
+            RBBIDebugPrintf("%4d  |  %3d %3d %3d ", s, row->fAccepting, row->fLookAhead, row->fTagIdx);
+            for (c=0; c<fHeader->fCatCount; c++)  {
+                RBBIDebugPrintf("%3d ", row->fNextState[c]);
+            }
         }
         RBBIDebugPrintf("\n");
     }
@@ -350,6 +530,24 @@ ubrk_swap(const UDataSwapper *ds, const void *inData, int32_t length, void *outD
         return 0;
         }
 
+    //
+    // Tables with 8-bit rows came with format version 6.
+    //
+    if (rbbiDH->fFormatVersion[0] == 5) {
+        const int32_t tableOffsets[] = { (int32_t)ds->readUInt32(rbbiDH->fFTable),
+                                         (int32_t)ds->readUInt32(rbbiDH->fRTable) };
+        const int32_t tableLengths[] = { (int32_t)ds->readUInt32(rbbiDH->fFTableLen),
+                                         (int32_t)ds->readUInt32(rbbiDH->fRTableLen) };
+        for (int32_t i = 0; i < 2; ++i) {
+            const RBBIStateTable *table = (const RBBIStateTable *)(inBytes+tableOffsets[i]);
+            if (tableLengths[i] > 0 && (ds->readUInt32(table->fFlags) & RBBI_8BITS_ROWS) != 0) {
+                udata_printError(ds, "ubrk_swap(): 8-bit state table rows in format version 5 data.\n");
+                *status=U_INVALID_FORMAT_ERROR;
+                return 0;
+            }
+        }
+    }
+
 
     //
     // Swap the Data.  Do the data itself first, then the RBBI Data Header, because
@@ -382,10 +580,19 @@ ubrk_swap(const UDataSwapper *ds, const void *inData, int32_t length, void *outD
     tableLength      = ds->readUInt32(rbbiDH->fFTableLen);
 
     if (tableLength > 0) {
+        const RBBIStateTable *inTable = (const RBBIStateTable *)(inBytes+tableStartOffset);
+        UBool use8Bits = (ds->readUInt32(inTable->fFlags) & RBBI_8BITS_ROWS) != 0;
         ds->swapArray32(ds, inBytes+tableStartOffset, topSize, 
                             outBytes+tableStartOffset, status);
-        ds->swapArray16(ds, inBytes+tableStartOffset+topSize, tableLength-topSize,
-                            outBytes+tableStartOffset+topSize, status);
+        if (use8Bits) {
+            if (inBytes != outBytes) {
+                uprv_memcpy(outBytes+tableStartOffset+topSize, inBytes+tableStartOffset+topSize,
+                             tableLength-topSize);
+            }
+        } else {
+            ds->swapArray16(ds, inBytes+tableStartOffset+topSize, tableLength-topSize,
+                                outBytes+tableStartOffset+topSize, status);
+        }
     }
     
     // Reverse state table.  Same layout as forward table, above.
@@ -393,15 +600,29 @@ ubrk_swap(const UDataSwapper *ds, const void *inData, int32_t length, void *outD
     tableLength      = ds->readUInt32(rbbiDH->fRTableLen);
 
     if (tableLength > 0) {
+        const RBBIStateTable *inTable = (const RBBIStateTable *)(inBytes+tableStartOffset);
+        UBool use8Bits = (ds->readUInt32(inTable->fFlags) & RBBI_8BITS_ROWS) != 0;
         ds->swapArray32(ds, inBytes+tableStartOffset, topSize, 
                             outBytes+tableStartOffset, status);
-        ds->swapArray16(ds, inBytes+tableStartOffset+topSize, tableLength-topSize,
-                            outBytes+tableStartOffset+topSize, status);
+        if (use8Bits) {
+            if (inBytes != outBytes) {
+                uprv_memcpy(outBytes+tableStartOffset+topSize, inBytes+tableStartOffset+topSize,
+                             tableLength-topSize);
+            }
+        } else {
+            ds->swapArray16(ds, inBytes+tableStartOffset+topSize, tableLength-topSize,
+                                outBytes+tableStartOffset+topSize, status);
+        }
     }
 
     // Trie table for character categories
-    utrie2_swap(ds, inBytes+ds->readUInt32(rbbiDH->fTrie), ds->readUInt32(rbbiDH->fTrieLen),
-                    outBytes+ds->readUInt32(rbbiDH->fTrie), status);
+    if (rbbiDH->fFormatVersion[0] == 5) {
+        utrie2_swap(ds, inBytes+ds->readUInt32(rbbiDH->fTrie), ds->readUInt32(rbbiDH->fTrieLen),
+                        outBytes+ds->readUInt32(rbbiDH->fTrie), status);
+    } else {
+        ucptrie_swap(ds, inBytes+ds->readUInt32(rbbiDH->fTrie), ds->readUInt32(rbbiDH->fTrieLen),
+                         outBytes+ds->readUInt32(rbbiDH->fTrie), status);
+    }
 
     // Source Rules Text.  It's UChar data
     ds->swapArray16(ds, inBytes+ds->readUInt32(rbbiDH->fRuleSource), ds->readUInt32(rbbiDH->fRuleSourceLen),
@@ -52,13 +52,18 @@ ubrk_swap(const UDataSwapper *ds,
 #include "unicode/uobject.h"
 #include "unicode/unistr.h"
 #include "unicode/uversion.h"
+#include "unicode/ucptrie.h"
 #include "umutex.h"
-#include "utrie2.h"
 
 U_NAMESPACE_BEGIN
 
 // The current RBBI data format version.
-static const uint8_t RBBI_DATA_FORMAT_VERSION[] = {5, 0, 0, 0};
+// Version 6 has the character categories in a UCPTrie with 8-bit or 16-bit values,
+// and state tables may have 8-bit rows (RBBI_8BITS_ROWS).
+// Version 5 data, with a UTrie2 and 16-bit rows only, can still be read;
+// see RBBIDataWrapper::init().
+// ICU4J's RBBIDataWrapper reads both versions as well.
+static const uint8_t RBBI_DATA_FORMAT_VERSION[] = {6, 0, 0, 0};
 
 /*  
  *   The following structs map exactly onto the raw data from ICU common data file. 
@@ -81,7 +86,7 @@ struct RBBIDataHeader {
     uint32_t         fFTableLen;
     uint32_t         fRTable;         /*  Offset to the reverse state transition table. */
     uint32_t         fRTableLen;
-    uint32_t         fTrie;           /*  Offset to Trie data for character categories */
+    uint32_t         fTrie;           /*  Offset to UCPTrie data for character categories */
     uint32_t         fTrieLen;
     uint32_t         fRuleSource;     /*  Offset to the source for for the break */
     uint32_t         fRuleSourceLen;  /*    rules.  Stored UChar *. */
@@ -94,7 +99,7 @@ struct RBBIDataHeader {
 
 
 
-struct  RBBIStateTableRow {
+struct  RBBIStateTableRow16 {
     int16_t          fAccepting;    /*  Non-zero if this row is for an accepting state.   */
                                     /*  Value 0: not an accepting state.                  */
                                     /*       -1: Unconditional Accepting state.           */
@@ -120,13 +125,26 @@ struct  RBBIStateTableRow {
                                     /*              before changing anything here.        */
 };
 
+/*
+ *  A state table row with 8-bit values, for tables in which all of these values fit.
+ *  Used when the table's fFlags include RBBI_8BITS_ROWS, only in format version 6 data;
+ *  it is otherwise the same as RBBIStateTableRow16.
+ */
+struct  RBBIStateTableRow8 {
+    int8_t           fAccepting;
+    int8_t           fLookAhead;
+    uint8_t          fTagIdx;
+    uint8_t          fReserved;
+    uint8_t          fNextState[1]; /*  Array Size is actually fData->fHeader->fCatCount */
+};
+
 
 struct RBBIStateTable {
     uint32_t         fNumStates;    /*  Number of states.                                 */
     uint32_t         fRowLen;       /*  Length of a state table row, in bytes.            */
     uint32_t         fFlags;        /*  Option Flags for this state table                 */
     uint32_t         fReserved;     /*  reserved                                          */
-    char             fTableData[1]; /*  First RBBIStateTableRow begins here.              */
+    char             fTableData[1]; /*  First RBBIStateTableRow8 or 16 begins here.       */
                                     /*    Variable-length array declared with length 1    */
                                     /*    to disable bounds checkers.                     */
                                     /*    (making it char[] simplifies ugly address       */
@@ -135,7 +153,8 @@ struct RBBIStateTable {
 
 typedef enum {
     RBBI_LOOKAHEAD_HARD_BREAK = 1,
-    RBBI_BOF_REQUIRED = 2
+    RBBI_BOF_REQUIRED = 2,
+    RBBI_8BITS_ROWS = 4
 } RBBIStateTableFlags;
 
 
@@ -176,9 +195,40 @@ class RBBIDataWrapper : public UMemory {
     /* number of int32_t values in the rule status table.   Used to sanity check indexing */
     int32_t             fStatusMaxIdx;
 
-    UTrie2             *fTrie;
+    /*
+     * The character categories, with 8-bit or 16-bit values.
+     * A category value with fDictBit set is for a character that is handled
+     * by a dictionary; the category is the value without that bit.
+     */
+    UCPTrie            *fTrie;
+    uint16_t            fDictBit;
+
+    /* Returns the category value for c, possibly with fDictBit set. */
+    inline uint16_t getCategory(UChar32 c) const {
+        if (fTrie->valueWidth == UCPTRIE_VALUE_BITS_8) {
+            return UCPTRIE_FAST_GET(fTrie, UCPTRIE_8, c);
+        } else {
+            return UCPTRIE_FAST_GET(fTrie, UCPTRIE_16, c);
+        }
+    }
+
+    /*
+     * ASCII fast path for the forward state table, derived from the table at load time.
+     * fAsciiClasses maps each ASCII character to a compact index over the distinct
+     * categories of ASCII characters.
+     * fAsciiPairTags[fAsciiClasses[a] * fAsciiClassCount + fAsciiClasses[b]] is the
+     * rule status index of the boundary that handleNext() finds between a and b when
+     * the text continues with a and b, or -1 if the state machine must be run for
+     * that pair (no boundary right after a, or look-ahead rules are involved).
+     * fAsciiPairTags is NULL if the fast path is not available for this data.
+     */
+    uint8_t             fAsciiClasses[0x80];
+    int32_t             fAsciiClassCount;
+    int16_t            *fAsciiPairTags;
 
 private:
+    void                initAsciiPairTags(UErrorCode &status);
+
     u_atomic_int32_t    fRefCount;
     UDataMemory        *fUDataMem;
     UnicodeString       fRuleString;
@@ -35,7 +35,8 @@
 #if !UCONFIG_NO_BREAK_ITERATION
 
 #include "unicode/uniset.h"
-#include "utrie2.h"
+#include "unicode/ucptrie.h"
+#include "unicode/umutablecptrie.h"
 #include "uvector.h"
 #include "uassert.h"
 #include "cmemory.h"
@@ -79,7 +80,7 @@ RBBISetBuilder::~RBBISetBuilder()
         delete r;
     }
 
-    utrie2_close(fTrie);
+    ucptrie_close(fTrie);
 }
 
 
@@ -251,22 +252,32 @@ void RBBISetBuilder::buildRanges() {
 //
 // Build the Trie table for mapping UChar32 values to the corresponding
 // range group number.
+// The trie has 8-bit values if all of the categories fit, with the
+// dictionary bit moved to DICT_BIT_8; otherwise it has 16-bit values.
 //
 void RBBISetBuilder::buildTrie() {
     RangeDescriptor *rlRange;
-
-    fTrie = utrie2_open(0,       //  Initial value for all code points.
-                        0,       //  Error value for out-of-range input.
-                        fStatus);
+    UMutableCPTrie *mutableTrie =
+        umutablecptrie_open(0,       //  Initial value for all code points.
+                            0,       //  Error value for out-of-range input.
+                            fStatus);
+    UBool use8Bits = getNumCharCategories() <= DICT_BIT_8;
 
     for (rlRange = fRangeList; rlRange!=0 && U_SUCCESS(*fStatus); rlRange=rlRange->fNext) {
-        utrie2_setRange32(fTrie,
-                          rlRange->fStartChar,     // Range start
-                          rlRange->fEndChar,       // Range end (inclusive)
-                          rlRange->fNum,           // value for range
-                          TRUE,                    // Overwrite previously written values
-                          fStatus);
+        uint32_t value = rlRange->fNum;
+        if (use8Bits && (value & DICT_BIT) != 0) {
+            value = (value & ~DICT_BIT) | DICT_BIT_8;
+        }
+        umutablecptrie_setRange(mutableTrie,
+                                rlRange->fStartChar,     // Range start
+                                rlRange->fEndChar,       // Range end (inclusive)
+                                value,                   // value for range
+                                fStatus);
     }
+    fTrie = umutablecptrie_buildImmutable(mutableTrie, UCPTRIE_TYPE_FAST,
+                                          use8Bits ? UCPTRIE_VALUE_BITS_8 : UCPTRIE_VALUE_BITS_16,
+                                          fStatus);
+    umutablecptrie_close(mutableTrie);
 }
 
 
@@ -295,8 +306,7 @@ int32_t RBBISetBuilder::getTrieSize()  {
     if (U_FAILURE(*fStatus)) {
         return 0;
     }
-    utrie2_freeze(fTrie, UTRIE2_16_VALUE_BITS, fStatus);
-    fTrieSize  = utrie2_serialize(fTrie,
+    fTrieSize  = ucptrie_toBinary(fTrie,
                                   NULL,                // Buffer
                                   0,                   // Capacity
                                   fStatus);
@@ -316,7 +326,7 @@ int32_t RBBISetBuilder::getTrieSize()  {
 //
 //-----------------------------------------------------------------------------------
 void RBBISetBuilder::serializeTrie(uint8_t *where) {
-    utrie2_serialize(fTrie,
+    ucptrie_toBinary(fTrie,
                      where,                   // Buffer
                      fTrieSize,               // Capacity
                      fStatus);
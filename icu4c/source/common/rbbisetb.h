@@ -18,7 +18,7 @@
 
 #include "unicode/uobject.h"
 #include "rbbirb.h"
-#include "utrie2.h"
+#include "unicode/ucptrie.h"
 #include "uvector.h"
 
 U_NAMESPACE_BEGIN
@@ -103,6 +103,12 @@ class RBBISetBuilder : public UMemory {
 
     static constexpr int32_t DICT_BIT = 0x4000;
 
+    /**
+     * The dictionary bit in the trie values when the categories fit into
+     * an 8-bit trie, see buildTrie().
+     */
+    static constexpr int32_t DICT_BIT_8 = 0x80;
+
 #ifdef RBBI_DEBUG
     void     printSets();
     void     printRanges();
@@ -121,7 +127,7 @@ class RBBISetBuilder : public UMemory {
 
     RangeDescriptor       *fRangeList;      // Head of the linked list of RangeDescriptors
 
-    UTrie2                *fTrie;           // The mapping TRIE that is the end result of processing
+    UCPTrie               *fTrie;           // The mapping TRIE that is the end result of processing
     uint32_t               fTrieSize;       //  the Unicode Sets.
 
     // Groups correspond to character categories -
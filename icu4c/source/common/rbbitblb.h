@@ -85,6 +85,12 @@ class RBBITableBuilder : public UMemory {
      */
     void     exportSafeTable(void *where);
 
+    /** Return true if the forward table fits into 8-bit rows (RBBIStateTableRow8). */
+    bool     use8BitsForTable() const;
+
+    /** Return true if the safe reverse table fits into 8-bit rows (RBBIStateTableRow8). */
+    bool     use8BitsForSafeTable() const;
+
 
 private:
     void     calcNullable(RBBINode *n);
@@ -15,6 +15,15 @@
 
 U_NAMESPACE_BEGIN
 
+namespace {
+
+// A NULL path is the ICU data, like for udata_open() and ures_open().
+const char* getTracePath(const char* path) {
+    return path != nullptr ? path : U_ICUDATA_NAME;
+}
+
+}  // namespace
+
 ResourceTracer::~ResourceTracer() = default;
 
 void ResourceTracer::trace(const char* resType) const {
@@ -54,7 +63,7 @@ void ResourceTracer::traceOpen() const {
 
 CharString& ResourceTracer::getFilePath(CharString& output, UErrorCode& status) const {
     if (fResB) {
-        output.append(fResB->fData->fPath, status);
+        output.append(getTracePath(fResB->fData->fPath), status);
         output.append('/', status);
         output.append(fResB->fData->fName, status);
         output.append(".res", status);
@@ -101,7 +110,7 @@ void FileTracer::traceOpenDataFile(const char* path, const char* type, const cha
     UErrorCode status = U_ZERO_ERROR;
 
     CharString filePath;
-    filePath.append(path, status);
+    filePath.append(getTracePath(path), status);
     filePath.append('/', status);
     filePath.append(name, status);
     filePath.append('.', status);
@@ -116,7 +125,7 @@ void FileTracer::traceOpenResFile(const char* path, const char* name) {
     UErrorCode status = U_ZERO_ERROR;
 
     CharString filePath;
-    filePath.append(path, status);
+    filePath.append(getTracePath(path), status);
     filePath.append('/', status);
     filePath.append(name, status);
     filePath.append(".res", status);
@@ -339,6 +339,7 @@ ICUService::ICUService()
 : name()
 , timestamp(0)
 , factories(NULL)
+, factoryCount(0)
 , serviceCache(NULL)
 , idCache(NULL)
 , dnCache(NULL)
@@ -349,6 +350,7 @@ ICUService::ICUService(const UnicodeString& newName)
 : name(newName)
 , timestamp(0)
 , factories(NULL)
+, factoryCount(0)
 , serviceCache(NULL)
 , idCache(NULL)
 , dnCache(NULL)
@@ -860,6 +862,7 @@ ICUService::registerFactory(ICUServiceFactory* factoryToAdopt, UErrorCode& statu
         }
         factories->insertElementAt(factoryToAdopt, 0, status);
         if (U_SUCCESS(status)) {
+            umtx_storeRelease(factoryCount, factories->size());
             clearCaches();
         } else {
             delete factoryToAdopt;
@@ -883,6 +886,7 @@ ICUService::unregister(URegistryKey rkey, UErrorCode& status)
         Mutex mutex(&lock);
 
         if (factories->removeElement(factory)) {
+            umtx_storeRelease(factoryCount, factories->size());
             clearCaches();
             result = TRUE;
         } else {
@@ -913,6 +917,7 @@ ICUService::reInitializeFactories()
     if (factories != NULL) {
         factories->removeAllElements();
     }
+    umtx_storeRelease(factoryCount, 0);
 }
 
 UBool 
@@ -967,7 +972,7 @@ ICUService::getName(UnicodeString& result) const
 int32_t 
 ICUService::countFactories() const 
 {
-    return factories == NULL ? 0 : factories->size();
+    return umtx_loadAcquire(factoryCount);
 }
 
 int32_t
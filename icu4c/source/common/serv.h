@@ -31,6 +31,7 @@ U_NAMESPACE_END
 #include "unicode/umisc.h"
 
 #include "hash.h"
+#include "umutex.h"
 #include "uvector.h"
 #include "servnotf.h"
 
@@ -542,6 +543,11 @@ class U_COMMON_API ICUService : public ICUNotifier {
      */
     UVector* factories;
 
+    /**
+     * The size of factories, readable without holding the service mutex.
+     */
+    mutable u_atomic_int32_t factoryCount;
+
     /**
      * The service cache.
      */
@@ -837,6 +843,10 @@ class U_COMMON_API ICUService : public ICUNotifier {
      *
      * <p>The default implementation returns TRUE if there are no 
      * factories registered.</p>
+     *
+     * <p>It does not lock the service mutex. A service in its default state
+     * only reaches the fallback in handleDefault(), so callers check this first
+     * and call their own factory method directly instead of going through get().</p>
      */
     virtual UBool isDefault(void) const;
 
@@ -975,7 +985,10 @@ class U_COMMON_API ICUService : public ICUNotifier {
     int32_t getTimestamp(void) const;
 
     /**
-     * <p>Return the number of registered factories.</p>
+     * <p>Return the number of registered factories.
+     *
+     * This does not lock the service mutex, so that callers can cheaply check
+     * isDefault() before going through the service.</p>
      *
      * @return the number of factories registered at the time of the call.
      */
@@ -17,6 +17,10 @@ U_NAMESPACE_BEGIN
 
 SharedObject::~SharedObject() {}
 
+int32_t SharedObject::getMemoryFootprint() const {
+    return 0;
+}
+
 UnifiedCacheBase::~UnifiedCacheBase() {}
 
 void
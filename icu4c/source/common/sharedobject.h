@@ -57,17 +57,31 @@ class U_COMMON_API SharedObject : public UObject {
     SharedObject() :
             softRefCount(0),
             hardRefCount(0),
-            cachePtr(NULL) {}
+            cachePtr(NULL),
+            cacheFootprint(0),
+            nextDoomed(NULL) {}
 
     /** Initializes totalRefCount, softRefCount to 0. */
     SharedObject(const SharedObject &other) :
             UObject(other),
             softRefCount(0),
             hardRefCount(0),
-            cachePtr(NULL) {}
+            cachePtr(NULL),
+            cacheFootprint(0),
+            nextDoomed(NULL) {}
 
     virtual ~SharedObject();
 
+    /**
+     * Returns the approximate number of bytes of heap and data memory used by
+     * this object, for the UnifiedCache memory budget. Subclasses that hold
+     * large data should override this; it is called once, when the object
+     * is first added to the cache.
+     * The default implementation returns 0, meaning unknown; the cache then
+     * charges a fixed default amount.
+     */
+    virtual int32_t getMemoryFootprint() const;
+
     /**
      * Increments the number of hard references to this object. Thread-safe.
      * Not for use from within the Unified Cache implementation.
@@ -165,10 +179,12 @@ class U_COMMON_API SharedObject : public UObject {
      * The number of references from the UnifiedCache, which is
      * the number of times that the sharedObject is stored as a hash table value.
      * For use by UnifiedCache implementation code only.
-     * All access is synchronized by UnifiedCache's gCacheMutex
+     * Atomic because a value may be stored under keys in different cache
+     * shards, each of which is synchronized by its own mutex.
      */
-    mutable int32_t softRefCount;
+    mutable u_atomic_int32_t softRefCount;
     friend class UnifiedCache;
+    friend class UnifiedCacheShard;
 
     /**
      * Reference count, excluding references from within the UnifiedCache implementation.
@@ -177,6 +193,18 @@ class U_COMMON_API SharedObject : public UObject {
     
     mutable const UnifiedCacheBase *cachePtr;
 
+    /**
+     * Bytes charged against the UnifiedCache memory budget while the object
+     * is cached. For use by UnifiedCache implementation code only.
+     */
+    mutable int32_t cacheFootprint;
+
+    /**
+     * Links the values that a UnifiedCache shard deletes after releasing its mutex.
+     * For use by UnifiedCache implementation code only.
+     */
+    mutable const SharedObject *nextDoomed;
+
 };
 
 U_NAMESPACE_END
@@ -12,8 +12,10 @@
 #include "static_unicode_sets.h"
 #include "umutex.h"
 #include "ucln_cmn.h"
+#include "unicode/uchar.h"
 #include "unicode/uniset.h"
 #include "uresimp.h"
+#include "cmemory.h"
 #include "cstring.h"
 #include "uassert.h"
 
@@ -65,6 +67,41 @@ UnicodeSet* computeUnion(Key k1, Key k2, Key k3) {
 }
 
 
+// The sets whose contents are fixed in this file, rather than by data,
+// as pairs of start and end code points.
+// They are built without parsing set patterns.
+
+// [٬‘\u0020\u00A0\u2000-\u200A\u202F\u205F\u3000]
+const UChar32 gOtherGroupingSeparatorRanges[] = {
+    0x20, 0x20, 0xa0, 0xa0, 0x66c, 0x66c, 0x2000, 0x200a, 0x2018, 0x2018,
+    0x202f, 0x202f, 0x205f, 0x205f, 0x3000, 0x3000
+};
+
+// [∞]
+const UChar32 gInfinitySignRanges[] = { 0x221e, 0x221e };
+
+UnicodeSet* newSetFromRanges(const UChar32* ranges, int32_t length) {
+    UnicodeSet* result = new UnicodeSet();
+    if (result == nullptr) {
+        return nullptr;
+    }
+    for (int32_t i = 0; i < length; i += 2) {
+        result->add(ranges[i], ranges[i + 1]);
+    }
+    return result;
+}
+
+// Builds a set of characters with a property value from the property data,
+// like a [:property=value:] pattern but without parsing it.
+UnicodeSet* newPropertySet(UProperty property, int32_t value, UErrorCode& status) {
+    UnicodeSet* result = new UnicodeSet();
+    if (result == nullptr) {
+        return nullptr;
+    }
+    result->applyIntPropertyValue(property, value, status);
+    return result;
+}
+
 void saveSet(Key key, const UnicodeString& unicodeSetPattern, UErrorCode& status) {
     // assert unicodeSets.get(key) == null;
     gUnicodeSets[key] = new UnicodeSet(unicodeSetPattern, status);
@@ -154,9 +191,18 @@ void U_CALLCONV initNumberParseUniSets(UErrorCode& status) {
 
     // These sets were decided after discussion with icu-design@. See tickets #13084 and #13309.
     // Zs+TAB is "horizontal whitespace" according to UTS #18 (blank property).
-    gUnicodeSets[DEFAULT_IGNORABLES] = new UnicodeSet(
-            u"[[:Zs:][\\u0009][:Bidi_Control:][:Variation_Selector:]]", status);
-    gUnicodeSets[STRICT_IGNORABLES] = new UnicodeSet(u"[[:Bidi_Control:]]", status);
+    // DEFAULT_IGNORABLES is [[:Zs:][\\u0009][:Bidi_Control:][:Variation_Selector:]],
+    // STRICT_IGNORABLES is [[:Bidi_Control:]].
+    LocalPointer<UnicodeSet> defaultIgnorables(
+        newPropertySet(UCHAR_GENERAL_CATEGORY_MASK, U_GC_ZS_MASK, status), status);
+    const USet* bidiControl = u_getBinaryPropertySet(UCHAR_BIDI_CONTROL, &status);
+    const USet* variationSelector = u_getBinaryPropertySet(UCHAR_VARIATION_SELECTOR, &status);
+    if (U_FAILURE(status)) { return; }
+    defaultIgnorables->add(u'\t');
+    defaultIgnorables->addAll(*UnicodeSet::fromUSet(bidiControl));
+    defaultIgnorables->addAll(*UnicodeSet::fromUSet(variationSelector));
+    gUnicodeSets[DEFAULT_IGNORABLES] = defaultIgnorables.orphan();
+    gUnicodeSets[STRICT_IGNORABLES] = new UnicodeSet(*UnicodeSet::fromUSet(bidiControl));
 
     LocalUResourceBundlePointer rb(ures_open(nullptr, "root", &status));
     if (U_FAILURE(status)) { return; }
@@ -171,10 +217,8 @@ void U_CALLCONV initNumberParseUniSets(UErrorCode& status) {
     U_ASSERT(gUnicodeSets[STRICT_PERIOD] != nullptr);
     U_ASSERT(gUnicodeSets[APOSTROPHE_SIGN] != nullptr);
 
-    LocalPointer<UnicodeSet> otherGrouping(new UnicodeSet(
-        u"[٬‘\\u0020\\u00A0\\u2000-\\u200A\\u202F\\u205F\\u3000]",
-        status
-    ), status);
+    LocalPointer<UnicodeSet> otherGrouping(newSetFromRanges(
+        gOtherGroupingSeparatorRanges, UPRV_LENGTHOF(gOtherGroupingSeparatorRanges)), status);
     if (U_FAILURE(status)) { return; }
     otherGrouping->addAll(*gUnicodeSets[APOSTROPHE_SIGN]);
     gUnicodeSets[OTHER_GROUPING_SEPARATORS] = otherGrouping.orphan();
@@ -187,7 +231,8 @@ void U_CALLCONV initNumberParseUniSets(UErrorCode& status) {
     U_ASSERT(gUnicodeSets[PERCENT_SIGN] != nullptr);
     U_ASSERT(gUnicodeSets[PERMILLE_SIGN] != nullptr);
 
-    gUnicodeSets[INFINITY_SIGN] = new UnicodeSet(u"[∞]", status);
+    gUnicodeSets[INFINITY_SIGN] = newSetFromRanges(
+        gInfinitySignRanges, UPRV_LENGTHOF(gInfinitySignRanges));
     if (U_FAILURE(status)) { return; }
 
     U_ASSERT(gUnicodeSets[DOLLAR_SIGN] != nullptr);
@@ -196,7 +241,8 @@ void U_CALLCONV initNumberParseUniSets(UErrorCode& status) {
     U_ASSERT(gUnicodeSets[YEN_SIGN] != nullptr);
     U_ASSERT(gUnicodeSets[WON_SIGN] != nullptr);
 
-    gUnicodeSets[DIGITS] = new UnicodeSet(u"[:digit:]", status);
+    // [:digit:]
+    gUnicodeSets[DIGITS] = newPropertySet(UCHAR_GENERAL_CATEGORY_MASK, U_GC_ND_MASK, status);
     if (U_FAILURE(status)) { return; }
     gUnicodeSets[DIGITS_OR_ALL_SEPARATORS] = computeUnion(DIGITS, ALL_SEPARATORS);
     gUnicodeSets[DIGITS_OR_STRICT_ALL_SEPARATORS] = computeUnion(DIGITS, STRICT_ALL_SEPARATORS);
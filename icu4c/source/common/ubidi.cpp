@@ -465,6 +465,12 @@ getDirProps(UBiDi *pBiDi) {
        encountering the initiator of an isolate sequence */
     State  previousStateStack[UBIDI_MAX_EXPLICIT_LEVEL+1];
     int32_t stackLast=-1;
+    /* Without a class callback and without control removal, runs of BMP
+       characters are classified directly from the bidi properties trie.
+       Such a run stops at characters that change the state below:
+       B and isolates, and strong characters while seeking one. */
+    const UCPTrie *trie=
+        pBiDi->fnClassCallback==NULL && !removeBiDiControls ? ubidi_getTrie() : NULL;
 
     if(pBiDi->reorderingOptions & UBIDI_OPTION_STREAMING)
         pBiDi->length=0;
@@ -493,6 +499,37 @@ getDirProps(UBiDi *pBiDi) {
      * their bit 0 alone yields the intended default
      */
     for( /* i=0 above */ ; i<originalLength; ) {
+        if(trie!=NULL) {
+            Flags stopMask=DIRPROP_FLAG(B)|MASK_ISO;
+            if(state==SEEKING_STRONG_FOR_PARA || state==SEEKING_STRONG_FOR_FSI) {
+                stopMask|=DIRPROP_FLAG(L)|MASK_R_AL;
+            }
+            Flags runFlags=0;
+            while(i<originalLength && !U16_IS_SURROGATE(uchar=text[i])) {
+                dirProp=(DirProp)UBIDI_GET_CLASS(UCPTRIE_FAST_BMP_GET(trie, UCPTRIE_16, uchar));
+                if(DIRPROP_FLAG(dirProp)&stopMask) {
+                    break;
+                }
+                runFlags|=DIRPROP_FLAG(dirProp);
+                dirProps[i++]=dirProp;
+            }
+            flags|=runFlags;
+            if(runFlags&(DIRPROP_FLAG(L)|MASK_R_AL)) {
+                int32_t j=i;
+                do {
+                    dirProp=dirProps[--j];
+                } while(dirProp!=L && dirProp!=R && dirProp!=AL);
+                lastStrong= dirProp==L ? L : R;
+                if(runFlags&DIRPROP_FLAG(AL)) {
+                    j=i;
+                    while(dirProps[--j]!=AL) {}
+                    lastArabicPos=j;
+                }
+            }
+            if(i>=originalLength) {
+                break;
+            }
+        }
         /* i is incremented by U16_NEXT */
         U16_NEXT(text, i, originalLength, uchar);
         flags|=DIRPROP_FLAG(dirProp=(DirProp)ubidi_getCustomizedClass(pBiDi, uchar));
@@ -764,6 +801,7 @@ bracketAddOpening(BracketData *bd, UChar match, int32_t position) {
     pOpening->contextPos=pLastIsoRun->contextPos;
     pOpening->flags=0;
     pLastIsoRun->limit++;
+    bd->pBiDi->implicitOnly=FALSE;
     return TRUE;
 }
 
@@ -1005,8 +1043,7 @@ bracketProcessChar(BracketData *bd, int32_t position) {
 
 /* determine if the text is mixed-directional or single-directional */
 static UBiDiDirection
-directionFromFlags(UBiDi *pBiDi) {
-    Flags flags=pBiDi->flags;
+directionFromFlags(Flags flags) {
     /* if the text contains AN and neutrals, then some neutrals may become RTL */
     if(!(flags&MASK_RTL || ((flags&DIRPROP_FLAG(AN)) && (flags&MASK_POSSIBLE_N)))) {
         return UBIDI_LTR;
@@ -1084,7 +1121,7 @@ resolveExplicitLevels(UBiDi *pBiDi, UErrorCode *pErrorCode) {
     if(U_FAILURE(*pErrorCode)) { return UBIDI_LTR; }
 
     /* determine if the text is mixed-directional or single-directional */
-    direction=directionFromFlags(pBiDi);
+    direction=directionFromFlags(pBiDi->flags);
 
     /* we may not need to resolve any explicit levels */
     if((direction!=UBIDI_MIXED)) {
@@ -1113,6 +1150,7 @@ resolveExplicitLevels(UBiDi *pBiDi, UErrorCode *pErrorCode) {
         int32_t paraIndex, start, limit;
         BracketData bracketData;
         bracketInit(pBiDi, &bracketData);
+        pBiDi->implicitOnly=TRUE;
         for(paraIndex=0; paraIndex<pBiDi->paraCount; paraIndex++) {
             if(paraIndex==0)
                 start=0;
@@ -1327,7 +1365,7 @@ resolveExplicitLevels(UBiDi *pBiDi, UErrorCode *pErrorCode) {
             flags|=DIRPROP_FLAG(L);
         /* again, determine if the text is mixed-directional or single-directional */
         pBiDi->flags=flags;
-        direction=directionFromFlags(pBiDi);
+        direction=directionFromFlags(pBiDi->flags);
     }
     return direction;
 }
@@ -1408,7 +1446,7 @@ checkExplicitLevels(UBiDi *pBiDi, UErrorCode *pErrorCode) {
         flags|=DIRPROP_FLAG_LR(pBiDi->paraLevel);
     /* determine if the text is mixed-directional or single-directional */
     pBiDi->flags=flags;
-    return directionFromFlags(pBiDi);
+    return directionFromFlags(pBiDi->flags);
 }
 
 /******************************************************************
@@ -2284,9 +2322,11 @@ resolveImplicitLevels(UBiDi *pBiDi,
  * This function also sets appropriate levels for BN, and
  * explicit embedding types that are supposed to have been removed
  * from the paragraph in (X9).
+ * Only the levels in [start..limit[ are reset; limit must be the
+ * trailingWSStart or the index after a character that is not WS, BN or B/S.
  */
 static void
-adjustWSLevels(UBiDi *pBiDi) {
+adjustWSLevels(UBiDi *pBiDi, int32_t start, int32_t limit) {
     const DirProp *dirProps=pBiDi->dirProps;
     UBiDiLevel *levels=pBiDi->levels;
     int32_t i;
@@ -2295,10 +2335,10 @@ adjustWSLevels(UBiDi *pBiDi) {
         UBool orderParagraphsLTR=pBiDi->orderParagraphsLTR;
         Flags flag;
 
-        i=pBiDi->trailingWSStart;
-        while(i>0) {
+        i=limit;
+        while(i>start) {
             /* reset a sequence of WS/BN before eop and B/S to the paragraph paraLevel */
-            while(i>0 && (flag=DIRPROP_FLAG(dirProps[--i]))&MASK_WS) {
+            while(i>start && (flag=DIRPROP_FLAG(dirProps[--i]))&MASK_WS) {
                 if(orderParagraphsLTR&&(flag&DIRPROP_FLAG(B))) {
                     levels[i]=0;
                 } else {
@@ -2308,7 +2348,7 @@ adjustWSLevels(UBiDi *pBiDi) {
 
             /* reset BN to the next character's paraLevel until B/S, which restarts above loop */
             /* here, i+1 is guaranteed to be <length */
-            while(i>0) {
+            while(i>start) {
                 flag=DIRPROP_FLAG(dirProps[--i]);
                 if(flag&MASK_BN_EXPLICIT) {
                     levels[i]=levels[i+1];
@@ -2588,6 +2628,7 @@ ubidi_setPara(UBiDi *pBiDi, const UChar *text, int32_t length,
     pBiDi->runs=NULL;
     pBiDi->insertPoints.size=0;         /* clean up from last call */
     pBiDi->insertPoints.confirmed=0;    /* clean up from last call */
+    pBiDi->implicitOnly=FALSE;
 
     /*
      * Save the original paraLevel if contextual; otherwise, set to 0.
@@ -2809,7 +2850,7 @@ ubidi_setPara(UBiDi *pBiDi, const UChar *text, int32_t length,
             return;
         }
         /* reset the embedding levels for some non-graphic characters (L1), (X9) */
-        adjustWSLevels(pBiDi);
+        adjustWSLevels(pBiDi, 0, pBiDi->trailingWSStart);
         break;
     }
     /* add RLM for inverse Bidi with contextual orientation resolving
@@ -2854,6 +2895,197 @@ ubidi_setPara(UBiDi *pBiDi, const UChar *text, int32_t length,
     setParaSuccess(pBiDi);              /* mark successful setPara */
 }
 
+/*
+ * Resolve the levels again only between the last strong character (L, R, AL)
+ * before an edit and the first one after it, for ubidi_updatePara().
+ * The resolved levels of a strong character do not depend on its context,
+ * and neither do those of any other character on text beyond the
+ * next strong character on either side, as long as there are no explicit
+ * embeddings, isolates or paired brackets and only one paragraph.
+ *
+ * Returns FALSE if the whole text must be processed with ubidi_setPara().
+ */
+static UBool
+updateLevels(UBiDi *pBiDi, const UChar *text, int32_t length,
+             int32_t start, int32_t deletedLength, int32_t insertedLength,
+             UErrorCode *pErrorCode) {
+    const Flags strongMask=DIRPROP_FLAG(L)|MASK_R_AL;
+    DirProp *dirProps=pBiDi->dirProps;
+    UBiDiLevel *levels;
+    int32_t oldLength=pBiDi->length;
+    int32_t delta=insertedLength-deletedLength;
+    int32_t editStart=start, editLimit=start+insertedLength;
+    int32_t windowStart, windowLimit, i, lastArabicPos;
+    Flags flags;
+    UBiDiLevel level;
+    DirProp dirProp;
+    BracketData bracketData;
+
+    /* a surrogate pair may have been joined or split at either end of the edit */
+    if(editStart>0 && U16_IS_LEAD(text[editStart-1])) {
+        --editStart;
+    }
+    if(editLimit<length && U16_IS_TRAIL(text[editLimit])) {
+        ++editLimit;
+    }
+
+    /* find the strong characters around the edit, in the old dirProps[] */
+    for(windowStart=editStart;
+        windowStart>0 && !(DIRPROP_FLAG(dirProps[windowStart-1])&strongMask);
+        --windowStart) {}
+    if(windowStart>0) {
+        --windowStart;
+    } else if(pBiDi->defaultParaLevel!=0) {
+        return FALSE;           /* the edit may change the paragraph level */
+    }
+    for(i=editLimit-delta; i<oldLength && !(DIRPROP_FLAG(dirProps[i])&strongMask); ++i) {}
+    windowLimit= i<oldLength ? i+1+delta : length;
+
+    /* find the last AL outside of the edit */
+    lastArabicPos=pBiDi->lastArabicPos;
+    if(lastArabicPos>=editLimit-delta) {
+        lastArabicPos+=delta;
+    } else if(lastArabicPos>=editStart) {
+        for(lastArabicPos=editStart; --lastArabicPos>=0 && dirProps[lastArabicPos]!=AL;) {}
+    }
+
+    /* move the dirProps[] and levels[] after the edit */
+    pBiDi->pParaBiDi=NULL;      /* mark unfinished setPara */
+    if(delta>0 && !(getDirPropsMemory(pBiDi, length) && getLevelsMemory(pBiDi, length))) {
+        *pErrorCode=U_MEMORY_ALLOCATION_ERROR;
+        return TRUE;
+    }
+    dirProps=pBiDi->dirProps=pBiDi->dirPropsMemory;
+    levels=pBiDi->levels=pBiDi->levelsMemory;
+    if(delta!=0) {
+        uprv_memmove(dirProps+editLimit, dirProps+editLimit-delta, length-editLimit);
+        uprv_memmove(levels+editLimit, levels+editLimit-delta, length-editLimit);
+    }
+
+    /* get the directional properties in the window, as in getDirProps() */
+    if(windowStart>0) {
+        flags=DIRPROP_FLAG(dirProps[windowStart]);
+        i=windowStart+1;
+    } else {
+        flags=0;
+        i=0;
+    }
+    while(i<windowLimit) {
+        UChar32 uchar;
+        U16_NEXT(text, i, windowLimit, uchar);
+        flags|=DIRPROP_FLAG(dirProp=(DirProp)ubidi_getCustomizedClass(pBiDi, uchar));
+        dirProps[i-1]=dirProp;
+        if(uchar>0xffff) {  /* set the lead surrogate's property to BN */
+            flags|=DIRPROP_FLAG(BN);
+            dirProps[i-2]=BN;
+        }
+        if(dirProp==AL && lastArabicPos<i-1) {
+            lastArabicPos=i-1;
+        }
+    }
+    flags|=DIRPROP_FLAG_LR(pBiDi->paraLevel);
+    if(flags&(MASK_EXPLICIT|MASK_ISO|DIRPROP_FLAG(B))) {
+        return FALSE;
+    }
+
+    /* the text must still be mixed-directional */
+    if(directionFromFlags(flags)!=UBIDI_MIXED) {
+        Flags allFlags=flags;
+        for(i=0; i<length && directionFromFlags(allFlags)!=UBIDI_MIXED; ++i) {
+            if(i==windowStart) {
+                i=windowLimit-1;
+            } else {
+                allFlags|=DIRPROP_FLAG(dirProps[i]);
+            }
+        }
+        if(directionFromFlags(allFlags)!=UBIDI_MIXED) {
+            return FALSE;
+        }
+    }
+
+    pBiDi->text=text;
+    pBiDi->length=pBiDi->originalLength=pBiDi->resultLength=length;
+    pBiDi->paras[0].limit=length;
+    pBiDi->trailingWSStart=length;
+    pBiDi->runCount=-1;
+    pBiDi->runs=NULL;
+    pBiDi->flags|=flags;
+    pBiDi->lastArabicPos=lastArabicPos;
+    pBiDi->isolateCount=-1;
+
+    /* (X1)..(X9) and bracket pairs (N0) in the window, as in resolveExplicitLevels() */
+    level=GET_PARALEVEL(pBiDi, 0);
+    bracketInit(pBiDi, &bracketData);
+    pBiDi->implicitOnly=TRUE;
+    for(i=windowStart; i<windowLimit; ++i) {
+        levels[i]=level;
+        if(dirProps[i]!=BN && !bracketProcessChar(&bracketData, i)) {
+            *pErrorCode=U_MEMORY_ALLOCATION_ERROR;
+            return TRUE;
+        }
+    }
+    if(!pBiDi->implicitOnly) {
+        return FALSE;
+    }
+
+    /* the window is bounded by the strong characters, or by sos and eos */
+    dirProp= windowLimit<length ? (DirProp)(dirProps[windowLimit-1]==L ? L : R) :
+                                  GET_LR_FROM_LEVEL(level);
+    resolveImplicitLevels(pBiDi, windowStart, windowLimit, GET_LR_FROM_LEVEL(level), dirProp);
+    adjustWSLevels(pBiDi, windowStart, windowLimit);
+    setParaSuccess(pBiDi);
+    return TRUE;
+}
+
+U_CAPI void U_EXPORT2
+ubidi_updatePara(UBiDi *pBiDi, const UChar *text, int32_t length,
+                 UBiDiLevel paraLevel,
+                 int32_t start, int32_t deletedLength, int32_t insertedLength,
+                 UErrorCode *pErrorCode) {
+    /* check the argument values */
+    RETURN_VOID_IF_NULL_OR_FAILING_ERRCODE(pErrorCode);
+    if(pBiDi==NULL || text==NULL || length<-1 ||
+       (paraLevel>UBIDI_MAX_EXPLICIT_LEVEL && paraLevel<UBIDI_DEFAULT_LTR) ||
+       start<0 || deletedLength<0 || insertedLength<0) {
+        *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+
+    if(length==-1) {
+        length=u_strlen(text);
+    }
+    if(insertedLength>length-start) {
+        *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+
+    if(IS_VALID_PARA(pBiDi)) {
+        int32_t oldLength=pBiDi->originalLength;
+        if(deletedLength>oldLength-start || length-insertedLength!=oldLength-deletedLength) {
+            *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
+            return;
+        }
+        /* are the levels of the previous text those of a single-run paragraph? */
+        if(pBiDi->direction==UBIDI_MIXED && pBiDi->paraCount==1 &&
+           pBiDi->length==oldLength && pBiDi->levels==pBiDi->levelsMemory &&
+           !(pBiDi->flags&(MASK_EXPLICIT|MASK_ISO|DIRPROP_FLAG(B))) &&
+           pBiDi->implicitOnly &&
+           pBiDi->reorderingMode==UBIDI_REORDER_DEFAULT &&
+           pBiDi->pImpTabPair==&impTab_DEFAULT &&
+           !(pBiDi->reorderingOptions&(UBIDI_OPTION_REMOVE_CONTROLS|UBIDI_OPTION_STREAMING)) &&
+           pBiDi->fnClassCallback==NULL &&
+           pBiDi->proLength==0 && pBiDi->epiLength==0 &&
+           /* UBIDI_DEFAULT_LTR and _RTL only differ without strong characters */
+           (IS_DEFAULT_LEVEL(paraLevel) ?
+                pBiDi->defaultParaLevel!=0 :
+                pBiDi->defaultParaLevel==0 && pBiDi->paraLevel==paraLevel) &&
+           updateLevels(pBiDi, text, length, start, deletedLength, insertedLength, pErrorCode)) {
+            return;
+        }
+    }
+    ubidi_setPara(pBiDi, text, length, paraLevel, NULL, pErrorCode);
+}
+
 U_CAPI void U_EXPORT2
 ubidi_orderParagraphsLTR(UBiDi *pBiDi, UBool orderParagraphsLTR) {
     if(pBiDi!=NULL) {
@@ -25,7 +25,7 @@
 #include "udatamem.h"
 #include "uassert.h"
 #include "cmemory.h"
-#include "utrie2.h"
+#include "unicode/ucptrie.h"
 #include "ubidi_props.h"
 #include "ucln_cmn.h"
 
@@ -36,7 +36,7 @@ struct UBiDiProps {
     const uint8_t *jgArray;
     const uint8_t *jgArray2;
 
-    UTrie2 trie;
+    UCPTrie trie;
     uint8_t formatVersion[4];
 };
 
@@ -46,16 +46,6 @@ struct UBiDiProps {
 
 /* set of property starts for UnicodeSet ------------------------------------ */
 
-static UBool U_CALLCONV
-_enumPropertyStartsRange(const void *context, UChar32 start, UChar32 end, uint32_t value) {
-    (void)end;
-    (void)value;
-    /* add the start code point to the USet */
-    const USetAdder *sa=(const USetAdder *)context;
-    sa->add(sa->set, start);
-    return TRUE;
-}
-
 U_CFUNC void
 ubidi_addPropertyStarts(const USetAdder *sa, UErrorCode *pErrorCode) {
     int32_t i, length;
@@ -69,7 +59,12 @@ ubidi_addPropertyStarts(const USetAdder *sa, UErrorCode *pErrorCode) {
     }
 
     /* add the start code point of each same-value range of the trie */
-    utrie2_enum(&ubidi_props_singleton.trie, NULL, _enumPropertyStartsRange, sa);
+    start=0;
+    while((limit=ucptrie_getRange(&ubidi_props_singleton.trie, start, UCPMAP_RANGE_NORMAL, 0,
+                                  NULL, NULL, NULL))>=0) {
+        sa->add(sa->set, start);
+        start=limit+1;
+    }
 
     /* add the code points from the bidi mirroring table */
     length=ubidi_props_singleton.indexes[UBIDI_IX_MIRROR_LENGTH];
@@ -130,15 +125,20 @@ ubidi_getMaxValue(UProperty which) {
     }
 }
 
+U_CFUNC const UCPTrie *
+ubidi_getTrie() {
+    return &ubidi_props_singleton.trie;
+}
+
 U_CAPI UCharDirection
 ubidi_getClass(UChar32 c) {
-    uint16_t props=UTRIE2_GET16(&ubidi_props_singleton.trie, c);
+    uint16_t props=UCPTRIE_FAST_GET(&ubidi_props_singleton.trie, UCPTRIE_16, c);
     return (UCharDirection)UBIDI_GET_CLASS(props);
 }
 
 U_CFUNC UBool
 ubidi_isMirrored(UChar32 c) {
-    uint16_t props=UTRIE2_GET16(&ubidi_props_singleton.trie, c);
+    uint16_t props=UCPTRIE_FAST_GET(&ubidi_props_singleton.trie, UCPTRIE_16, c);
     return (UBool)UBIDI_GET_FLAG(props, UBIDI_IS_MIRRORED_SHIFT);
 }
 
@@ -176,25 +176,25 @@ getMirror(UChar32 c, uint16_t props) {
 
 U_CFUNC UChar32
 ubidi_getMirror(UChar32 c) {
-    uint16_t props=UTRIE2_GET16(&ubidi_props_singleton.trie, c);
+    uint16_t props=UCPTRIE_FAST_GET(&ubidi_props_singleton.trie, UCPTRIE_16, c);
     return getMirror(c, props);
 }
 
 U_CFUNC UBool
 ubidi_isBidiControl(UChar32 c) {
-    uint16_t props=UTRIE2_GET16(&ubidi_props_singleton.trie, c);
+    uint16_t props=UCPTRIE_FAST_GET(&ubidi_props_singleton.trie, UCPTRIE_16, c);
     return (UBool)UBIDI_GET_FLAG(props, UBIDI_BIDI_CONTROL_SHIFT);
 }
 
 U_CFUNC UBool
 ubidi_isJoinControl(UChar32 c) {
-    uint16_t props=UTRIE2_GET16(&ubidi_props_singleton.trie, c);
+    uint16_t props=UCPTRIE_FAST_GET(&ubidi_props_singleton.trie, UCPTRIE_16, c);
     return (UBool)UBIDI_GET_FLAG(props, UBIDI_JOIN_CONTROL_SHIFT);
 }
 
 U_CFUNC UJoiningType
 ubidi_getJoiningType(UChar32 c) {
-    uint16_t props=UTRIE2_GET16(&ubidi_props_singleton.trie, c);
+    uint16_t props=UCPTRIE_FAST_GET(&ubidi_props_singleton.trie, UCPTRIE_16, c);
     return (UJoiningType)((props&UBIDI_JT_MASK)>>UBIDI_JT_SHIFT);
 }
 
@@ -217,13 +217,13 @@ ubidi_getJoiningGroup(UChar32 c) {
 
 U_CFUNC UBidiPairedBracketType
 ubidi_getPairedBracketType(UChar32 c) {
-    uint16_t props=UTRIE2_GET16(&ubidi_props_singleton.trie, c);
+    uint16_t props=UCPTRIE_FAST_GET(&ubidi_props_singleton.trie, UCPTRIE_16, c);
     return (UBidiPairedBracketType)((props&UBIDI_BPT_MASK)>>UBIDI_BPT_SHIFT);
 }
 
 U_CFUNC UChar32
 ubidi_getPairedBracket(UChar32 c) {
-    uint16_t props=UTRIE2_GET16(&ubidi_props_singleton.trie, c);
+    uint16_t props=UCPTRIE_FAST_GET(&ubidi_props_singleton.trie, UCPTRIE_16, c);
     if((props&UBIDI_BPT_MASK)==0) {
         return c;
     } else {
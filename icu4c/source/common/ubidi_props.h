@@ -22,6 +22,7 @@
 #define __UBIDI_PROPS_H__
 
 #include "unicode/utypes.h"
+#include "unicode/ucptrie.h"
 #include "unicode/uset.h"
 #include "putilimp.h"
 #include "uset_imp.h"
@@ -42,6 +43,10 @@ ubidi_getMaxValue(UProperty which);
 U_CAPI UCharDirection
 ubidi_getClass(UChar32 c);
 
+/** The trie of bidi properties words, for inline UBIDI_GET_CLASS() lookups in loops. */
+U_CFUNC const UCPTrie *
+ubidi_getTrie(void);
+
 U_CFUNC UBool
 ubidi_isMirrored(UChar32 c);
 
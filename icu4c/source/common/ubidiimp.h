@@ -369,6 +369,10 @@ struct UBiDi {
     /* for option UBIDI_OPTION_REMOVE_CONTROLS */
     int32_t controlCount;
 
+    /* for ubidi_updatePara(): were the levels resolved without explicit
+       embeddings, isolates and opening paired brackets? */
+    UBool implicitOnly;
+
     /* for Bidi class callback */
     UBiDiClassCallback *fnClassCallback;    /* action pointer */
     const void *coClassCallback;            /* context pointer */
@@ -295,6 +295,50 @@ ubrk_getRuleStatusVec(UBreakIterator *bi, int32_t *fillInVec, int32_t capacity,
 }
 
 
+U_CAPI int32_t U_EXPORT2
+ubrk_getBoundaries(UBreakIterator *bi, int32_t *boundaries, int32_t *ruleStatuses,
+                   int32_t capacity, UErrorCode *status)
+{
+    if (U_FAILURE(*status)) {
+        return 0;
+    }
+    BreakIterator *brkit = reinterpret_cast<BreakIterator *>(bi);
+    RuleBasedBreakIterator *rbbi = dynamic_cast<RuleBasedBreakIterator *>(brkit);
+    if (rbbi != NULL) {
+        return rbbi->getBoundaries(boundaries, ruleStatuses, capacity, *status);
+    }
+    if (capacity < 0 || (boundaries == NULL && capacity > 0)) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    int32_t length = 0;
+    int32_t boundary;
+    while (length < capacity && (boundary = brkit->next()) != UBRK_DONE) {
+        boundaries[length] = boundary;
+        if (ruleStatuses != NULL) {
+            ruleStatuses[length] = brkit->getRuleStatus();
+        }
+        ++length;
+    }
+    return length;
+}
+
+
+U_CAPI void U_EXPORT2
+ubrk_setExecutor(UBreakIterator *bi, UBreakIteratorExecutor *executor,
+                 const void *executorContext, UErrorCode *status)
+{
+    if (U_FAILURE(*status)) {
+        return;
+    }
+    RuleBasedBreakIterator *rbbi =
+        dynamic_cast<RuleBasedBreakIterator *>(reinterpret_cast<BreakIterator *>(bi));
+    if (rbbi != NULL) {
+        rbbi->setExecutor(executor, executorContext);
+    }
+}
+
+
 U_CAPI const char* U_EXPORT2
 ubrk_getLocaleByType(const UBreakIterator *bi,
                      ULocDataLocaleType type,
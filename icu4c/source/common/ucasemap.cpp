@@ -165,6 +165,70 @@ appendResult(int32_t cpLength, int32_t result, const UChar *s,
 inline uint8_t getTwoByteLead(UChar32 c) { return (uint8_t)((c >> 6) | 0xc0); }
 inline uint8_t getTwoByteTrail(UChar32 c) { return (uint8_t)((c & 0x3f) | 0x80); }
 
+/**
+ * Appends the mappings of a run of characters below U+0180 that have
+ * simple deltas in latinMap, starting at srcIndex with one that changes,
+ * with one ByteSink::Append() call rather than one or two per change.
+ * Returns the source index after the run.
+ */
+int32_t appendLatinRun(const int8_t *latinMap,
+                       const uint8_t *src, int32_t srcIndex, int32_t srcLimit,
+                       ByteSink &sink, uint32_t options, Edits *edits) {
+    char buffer[64];
+    int32_t length = 0;
+    int32_t unchangedLength = 0;
+    while (length <= (UPRV_LENGTHOF(buffer) - 2) && srcIndex < srcLimit) {
+        uint8_t lead = src[srcIndex];
+        UChar32 c;
+        int32_t cpLength;
+        uint8_t t;
+        if (lead <= 0x7f) {
+            c = lead;
+            cpLength = 1;
+        } else if (0xc2 <= lead && lead <= 0xc5 && (srcIndex + 1) < srcLimit &&
+                (t = src[srcIndex + 1] - 0x80) <= 0x3f) {
+            c = ((lead - 0xc0) << 6) | t;
+            cpLength = 2;
+        } else {
+            break;
+        }
+        int8_t d = latinMap[c];
+        if (d == LatinCase::EXC) { break; }
+        if (d == 0) {
+            if ((options & U_OMIT_UNCHANGED_TEXT) == 0) {
+                buffer[length++] = (char)lead;
+                if (cpLength == 2) {
+                    buffer[length++] = (char)src[srcIndex + 1];
+                }
+            }
+            unchangedLength += cpLength;
+        } else {
+            if (edits != nullptr && unchangedLength > 0) {
+                edits->addUnchanged(unchangedLength);
+            }
+            unchangedLength = 0;
+            c += d;
+            if (cpLength == 1) {
+                buffer[length++] = (char)c;
+            } else {
+                buffer[length++] = (char)getTwoByteLead(c);
+                buffer[length++] = (char)getTwoByteTrail(c);
+            }
+            if (edits != nullptr) {
+                edits->addReplace(cpLength, cpLength);
+            }
+        }
+        srcIndex += cpLength;
+    }
+    if (edits != nullptr && unchangedLength > 0) {
+        edits->addUnchanged(unchangedLength);
+    }
+    if (length > 0) {
+        sink.Append(buffer, length);
+    }
+    return srcIndex;
+}
+
 UChar32 U_CALLCONV
 utf8_caseContextIterator(void *context, int8_t dir) {
     UCaseContext *csc=(UCaseContext *)context;
@@ -213,7 +277,7 @@ void toLower(int32_t caseLocale, uint32_t options,
     } else {
         latinToLower = LatinCase::TO_LOWER_TR_LT;
     }
-    const UTrie2 *trie = ucase_getTrie();
+    const UCPTrie *trie = ucase_getTrie();
     int32_t prev = srcStart;
     int32_t srcIndex = srcStart;
     for (;;) {
@@ -236,11 +300,8 @@ void toLower(int32_t caseLocale, uint32_t options,
                 if (d == 0) { continue; }
                 ByteSinkUtil::appendUnchanged(src + prev, srcIndex - 1 - prev,
                                               sink, options, edits, errorCode);
-                char ascii = (char)(lead + d);
-                sink.Append(&ascii, 1);
-                if (edits != nullptr) {
-                    edits->addReplace(1, 1);
-                }
+                srcIndex = appendLatinRun(latinToLower, src, srcIndex - 1, srcLimit,
+                                          sink, options, edits);
                 prev = srcIndex;
                 continue;
             } else if (lead < 0xe3) {
@@ -258,10 +319,8 @@ void toLower(int32_t caseLocale, uint32_t options,
                     if (d == 0) { continue; }
                     ByteSinkUtil::appendUnchanged(src + prev, srcIndex - 2 - prev,
                                                   sink, options, edits, errorCode);
-                    ByteSinkUtil::appendTwoBytes(c + d, sink);
-                    if (edits != nullptr) {
-                        edits->addReplace(2, 2);
-                    }
+                    srcIndex = appendLatinRun(latinToLower, src, srcIndex - 2, srcLimit,
+                                              sink, options, edits);
                     prev = srcIndex;
                     continue;
                 }
@@ -278,7 +337,7 @@ void toLower(int32_t caseLocale, uint32_t options,
                 // ill-formed UTF-8
                 continue;
             }
-            uint16_t props = UTRIE2_GET16(trie, c);
+            uint16_t props = UCPTRIE_FAST_GET(trie, UCPTRIE_16, c);
             if (UCASE_HAS_EXCEPTION(props)) { break; }
             int32_t delta;
             if (!UCASE_IS_UPPER_OR_TITLE(props) || (delta = UCASE_GET_DELTA(props)) == 0) {
@@ -321,7 +380,7 @@ void toUpper(int32_t caseLocale, uint32_t options,
     } else {
         latinToUpper = LatinCase::TO_UPPER_NORMAL;
     }
-    const UTrie2 *trie = ucase_getTrie();
+    const UCPTrie *trie = ucase_getTrie();
     int32_t prev = 0;
     int32_t srcIndex = 0;
     for (;;) {
@@ -344,11 +403,8 @@ void toUpper(int32_t caseLocale, uint32_t options,
                 if (d == 0) { continue; }
                 ByteSinkUtil::appendUnchanged(src + prev, srcIndex - 1 - prev,
                                               sink, options, edits, errorCode);
-                char ascii = (char)(lead + d);
-                sink.Append(&ascii, 1);
-                if (edits != nullptr) {
-                    edits->addReplace(1, 1);
-                }
+                srcIndex = appendLatinRun(latinToUpper, src, srcIndex - 1, srcLength,
+                                          sink, options, edits);
                 prev = srcIndex;
                 continue;
             } else if (lead < 0xe3) {
@@ -366,10 +422,8 @@ void toUpper(int32_t caseLocale, uint32_t options,
                     if (d == 0) { continue; }
                     ByteSinkUtil::appendUnchanged(src + prev, srcIndex - 2 - prev,
                                                   sink, options, edits, errorCode);
-                    ByteSinkUtil::appendTwoBytes(c + d, sink);
-                    if (edits != nullptr) {
-                        edits->addReplace(2, 2);
-                    }
+                    srcIndex = appendLatinRun(latinToUpper, src, srcIndex - 2, srcLength,
+                                              sink, options, edits);
                     prev = srcIndex;
                     continue;
                 }
@@ -386,7 +440,7 @@ void toUpper(int32_t caseLocale, uint32_t options,
                 // ill-formed UTF-8
                 continue;
             }
-            uint16_t props = UTRIE2_GET16(trie, c);
+            uint16_t props = UCPTRIE_FAST_GET(trie, UCPTRIE_16, c);
             if (UCASE_HAS_EXCEPTION(props)) { break; }
             int32_t delta;
             if (UCASE_GET_TYPE(props) != UCASE_LOWER || (delta = UCASE_GET_DELTA(props)) == 0) {
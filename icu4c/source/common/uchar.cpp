@@ -25,8 +25,11 @@
 #include "unicode/uchar.h"
 #include "unicode/uscript.h"
 #include "unicode/udata.h"
+#include "unicode/ustring.h"
+#include "unicode/utf16.h"
 #include "uassert.h"
 #include "cmemory.h"
+#include "cstring.h"
 #include "ucln_cmn.h"
 #include "utrie2.h"
 #include "udataswp.h"
@@ -52,6 +55,65 @@ u_charType(UChar32 c) {
     return (int8_t)GET_CATEGORY(props);
 }
 
+/*
+ * Batch versions of u_charType():
+ * One pass with the trie macros that decode the string and look up the properties together,
+ * instead of one function call, code point decoding and range check per code point.
+ */
+U_CAPI int32_t U_EXPORT2
+u_charTypes(const UChar *s, int32_t length, int8_t *types, UErrorCode *pErrorCode) {
+    if(U_FAILURE(*pErrorCode)) {
+        return 0;
+    }
+    if(s==NULL || length<-1 || (types==NULL && length!=0)) {
+        *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    if(length<0) {
+        length=u_strlen(s);
+    }
+    const UChar *src=s, *limit=s+length;
+    int8_t *dest=types;
+    while(src<limit) {
+        UChar32 c;
+        uint16_t props;
+        UTRIE2_U16_NEXT16(&propsTrie, src, limit, c, props);
+        int8_t type=(int8_t)GET_CATEGORY(props);
+        *dest++=type;
+        if(c>0xffff) {
+            *dest++=type;
+        }
+    }
+    return length;
+}
+
+U_CAPI int32_t U_EXPORT2
+u_charTypesUTF8(const char *s, int32_t length, int8_t *types, UErrorCode *pErrorCode) {
+    if(U_FAILURE(*pErrorCode)) {
+        return 0;
+    }
+    if(s==NULL || length<-1 || (types==NULL && length!=0)) {
+        *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    if(length<0) {
+        length=(int32_t)uprv_strlen(s);
+    }
+    const uint8_t *src=(const uint8_t *)s, *limit=src+length;
+    int8_t *dest=types;
+    while(src<limit) {
+        const uint8_t *start=src;
+        uint16_t props;
+        UTRIE2_U8_NEXT16(&propsTrie, src, limit, props);
+        // An ill-formed sequence yields the trie's error value, which is U_UNASSIGNED.
+        int8_t type=(int8_t)GET_CATEGORY(props);
+        do {
+            *dest++=type;
+        } while(++start<src);
+    }
+    return length;
+}
+
 /* Enumerate all code points with their general categories. */
 struct _EnumTypeCallback {
     UCharEnumTypeRange *enumRange;
@@ -79,8 +79,10 @@ UCharsTrie::branchNext(const UChar *pos, int32_t length, int32_t uchar) {
     // Drop down to linear search for the last few units.
     // length>=2 because the loop body above sees length>kMaxBranchLinearSubNodeLength>=3
     // and divides length by 2.
+    // The units are in ascending order, so we can stop as soon as we pass uchar.
     do {
-        if(uchar==*pos++) {
+        int32_t unit=*pos++;
+        if(uchar==unit) {
             UStringTrieResult result;
             int32_t node=*pos;
             if(node&kValueIsFinal) {
@@ -106,6 +108,9 @@ UCharsTrie::branchNext(const UChar *pos, int32_t length, int32_t uchar) {
             }
             pos_=pos;
             return result;
+        } else if(uchar<unit) {
+            stop();
+            return USTRINGTRIE_NO_MATCH;
         }
         --length;
         pos=skipValue(pos);
@@ -82,7 +82,9 @@ UCharsTrieElement::setTo(const UnicodeString &s, int32_t val,
 
 int32_t
 UCharsTrieElement::compareStringTo(const UCharsTrieElement &other, const UnicodeString &strings) const {
-    return getString(strings).compare(other.getString(strings));
+    // Compare in place, without temporary UnicodeString objects.
+    return strings.compare(stringOffset+1, getStringLength(strings),
+                           strings, other.stringOffset+1, other.getStringLength(strings));
 }
 
 UCharsTrieBuilder::UCharsTrieBuilder(UErrorCode & /*errorCode*/)
@@ -186,22 +188,27 @@ UCharsTrieBuilder::buildUChars(UStringTrieBuildOption buildOption, UErrorCode &e
             errorCode=U_MEMORY_ALLOCATION_ERROR;
             return;
         }
-        uprv_sortArray(elements, elementsLength, (int32_t)sizeof(UCharsTrieElement),
-                      compareElementStrings, &strings,
-                      FALSE,  // need not be a stable sort
-                      &errorCode);
-        if(U_FAILURE(errorCode)) {
-            return;
+        // Elements that were added in strictly ascending order
+        // need not be sorted nor checked for duplicates.
+        int32_t i=1;
+        while(i<elementsLength && elements[i-1].compareStringTo(elements[i], strings)<0) {
+            ++i;
         }
-        // Duplicate strings are not allowed.
-        UnicodeString prev=elements[0].getString(strings);
-        for(int32_t i=1; i<elementsLength; ++i) {
-            UnicodeString current=elements[i].getString(strings);
-            if(prev==current) {
-                errorCode=U_ILLEGAL_ARGUMENT_ERROR;
+        if(i<elementsLength) {
+            uprv_sortArray(elements, elementsLength, (int32_t)sizeof(UCharsTrieElement),
+                          compareElementStrings, &strings,
+                          FALSE,  // need not be a stable sort
+                          &errorCode);
+            if(U_FAILURE(errorCode)) {
                 return;
             }
-            prev.fastCopyFrom(current);
+            // Duplicate strings are not allowed.
+            for(i=1; i<elementsLength; ++i) {
+                if(elements[i-1].compareStringTo(elements[i], strings)==0) {
+                    errorCode=U_ILLEGAL_ARGUMENT_ERROR;
+                    return;
+                }
+            }
         }
     }
     // Create and UChar-serialize the trie for the elements.
@@ -22,11 +22,16 @@
  *
  */
 
+#include <atomic>
+
 #include "unicode/utypes.h"
 #include "unicode/udata.h"
+#include "cmemory.h"
 #include "cstring.h"
+#include "mutex.h"
 #include "ucmndata.h"
 #include "udatamem.h"
+#include "umutex.h"
 
 #if defined(UDATA_DEBUG) || defined(UDATA_DEBUG_DUMP)
 #   include <stdio.h>
@@ -211,6 +216,132 @@ pointerTOCPrefixBinarySearch(const char *s, const PointerTOCEntry *toc, int32_t
     return -1;
 }
 
+/*-----------------------------------------------------------------------------*
+ *                                                                             *
+ *    Hash indexes for large tables of contents                                *
+ *                                                                             *
+ *-----------------------------------------------------------------------------*/
+
+/*
+ * A table of contents with at least this many entries gets a hash index,
+ * built on its first lookup and kept until udata_cleanupTOCIndexes(),
+ * so that a lookup usually compares the name with one entry rather than
+ * with the log2(count) entries of the binary search.
+ */
+#define TOC_INDEX_MIN_COUNT 32
+
+typedef const char *GetTOCNameFn(const void *toc, int32_t number);
+
+struct TOCIndexSlot {
+    uint32_t hash;
+    int32_t  number;    /* TOC entry number, or -1 for an empty slot */
+};
+
+struct TOCIndex {
+    const void *toc;
+    TOCIndex   *next;
+    uint32_t    mask;   /* number of slots - 1; the slots are an open-addressing hash table */
+    /**
+     * Variable-length array declared with length 1 to disable bounds checkers.
+     * The actual array length is mask+1.
+     */
+    TOCIndexSlot slots[1];
+};
+
+/* The list only grows until cleanup, so that lookups read it without locking. */
+static std::atomic<TOCIndex *> gTOCIndexes(nullptr);
+static icu::UMutex gTOCIndexMutex;
+
+static uint32_t
+hashTOCName(const char *s) {
+    /* FNV-1a */
+    uint32_t h=0x811c9dc5;
+    while(*s!=0) {
+        h=(h^(uint8_t)*s++)*0x01000193;
+    }
+    return h;
+}
+
+static const TOCIndex *
+getTOCIndex(const void *toc, int32_t count, GetTOCNameFn *getName) {
+    TOCIndex *index;
+    if(count<TOC_INDEX_MIN_COUNT) {
+        return NULL;
+    }
+    for(index=gTOCIndexes.load(std::memory_order_acquire); index!=NULL; index=index->next) {
+        if(index->toc==toc) {
+            return index;
+        }
+    }
+    icu::Mutex lock(&gTOCIndexMutex);
+    TOCIndex *head=gTOCIndexes.load(std::memory_order_relaxed);
+    for(index=head; index!=NULL; index=index->next) {
+        if(index->toc==toc) {
+            return index;
+        }
+    }
+    /* At most half of the slots are used. */
+    uint32_t capacity=64;
+    while(capacity<2*(uint32_t)count) {
+        capacity*=2;
+    }
+    index=(TOCIndex *)uprv_malloc(sizeof(TOCIndex)+(capacity-1)*sizeof(TOCIndexSlot));
+    if(index==NULL) {
+        return NULL;  /* use the binary search */
+    }
+    index->toc=toc;
+    index->next=head;
+    index->mask=capacity-1;
+    for(uint32_t i=0; i<capacity; ++i) {
+        index->slots[i].number=-1;
+    }
+    for(int32_t number=0; number<count; ++number) {
+        uint32_t hash=hashTOCName(getName(toc, number));
+        uint32_t i=hash&index->mask;
+        while(index->slots[i].number>=0) {
+            i=(i+1)&index->mask;
+        }
+        index->slots[i].hash=hash;
+        index->slots[i].number=number;
+    }
+    gTOCIndexes.store(index, std::memory_order_release);
+    return index;
+}
+
+static int32_t
+findTOCIndexEntry(const TOCIndex *index, const char *s, GetTOCNameFn *getName) {
+    uint32_t hash=hashTOCName(s);
+    for(uint32_t i=hash&index->mask;; i=(i+1)&index->mask) {
+        const TOCIndexSlot &slot=index->slots[i];
+        if(slot.number<0) {
+            return -1;
+        }
+        if(slot.hash==hash && 0==uprv_strcmp(s, getName(index->toc, slot.number))) {
+            return slot.number;
+        }
+    }
+}
+
+U_CFUNC void
+udata_cleanupTOCIndexes() {
+    TOCIndex *index=gTOCIndexes.exchange(nullptr);
+    while(index!=NULL) {
+        TOCIndex *next=index->next;
+        uprv_free(index);
+        index=next;
+    }
+}
+
+static const char *
+getOffsetTOCName(const void *toc, int32_t number) {
+    return (const char *)toc+((const UDataOffsetTOC *)toc)->entry[number].nameOffset;
+}
+
+static const char *
+getPointerTOCName(const void *toc, int32_t number) {
+    return ((const PointerTOC *)toc)->entry[number].entryName;
+}
+
 U_CDECL_BEGIN
 static uint32_t U_CALLCONV
 offsetTOCEntryCount(const UDataMemory *pData) {
@@ -240,7 +371,12 @@ offsetTOCLookupFn(const UDataMemory *pData,
             fprintf(stderr, "\tx%d: %s\n", number, &base[toc->entry[number].nameOffset]);
         }
 #endif
-        number=offsetTOCPrefixBinarySearch(tocEntryName, base, toc->entry, count);
+        const TOCIndex *index=getTOCIndex(toc, count, getOffsetTOCName);
+        if(index!=NULL) {
+            number=findTOCIndexEntry(index, tocEntryName, getOffsetTOCName);
+        } else {
+            number=offsetTOCPrefixBinarySearch(tocEntryName, base, toc->entry, count);
+        }
         if(number>=0) {
             /* found it */
             const UDataOffsetTOCEntry *entry=toc->entry+number;
@@ -289,7 +425,12 @@ static const DataHeader * U_CALLCONV pointerTOCLookupFn(const UDataMemory *pData
             fprintf(stderr, "\tx%d: %s\n", number, toc->entry[number].entryName);
         }
 #endif
-        number=pointerTOCPrefixBinarySearch(name, toc->entry, count);
+        const TOCIndex *index=getTOCIndex(toc, count, getPointerTOCName);
+        if(index!=NULL) {
+            number=findTOCIndexEntry(index, name, getPointerTOCName);
+        } else {
+            number=pointerTOCPrefixBinarySearch(name, toc->entry, count);
+        }
         if(number>=0) {
             /* found it */
 #ifdef UDATA_DEBUG
@@ -114,4 +114,10 @@ typedef struct {
  */
 U_CFUNC void udata_checkCommonData(UDataMemory *pData, UErrorCode *pErrorCode);
 
+/*
+ *  Frees the hash indexes that lookups built for large tables of contents.
+ *  Called when the common data is closed, at cleanup time.
+ */
+U_CFUNC void udata_cleanupTOCIndexes(void);
+
 #endif
@@ -150,16 +150,16 @@ ucnv_openCCSID (int32_t codepage,
     return ucnv_createConverter(NULL, myName, err);
 }
 
-/* Creating a temporary stack-based object that can be used in one thread, 
-and created from a converter that is shared across threads.
-*/
-
-U_CAPI UConverter* U_EXPORT2
-ucnv_safeClone(const UConverter* cnv, void *stackBuffer, int32_t *pBufferSize, UErrorCode *status)
+/*
+ * Copies cnv into the memory at localConverter, which has room for bufferSizeNeeded bytes,
+ * and lets the implementation and the callbacks clone their own state.
+ * Increments the reference count of the shared data unless borrowSharedData is TRUE.
+ * Returns NULL if an error occurred; the caller then releases the memory.
+ */
+static UConverter *
+cloneInto(const UConverter *cnv, UConverter *localConverter, int32_t bufferSizeNeeded,
+          int32_t *pBufferSize, UBool isCopyLocal, UBool borrowSharedData, UErrorCode *status)
 {
-    UConverter *localConverter, *allocatedConverter;
-    int32_t stackBufferSize;
-    int32_t bufferSizeNeeded;
     UErrorCode cbErr;
     UConverterToUnicodeArgs toUArgs = {
         sizeof(UConverterToUnicodeArgs),
@@ -182,6 +182,69 @@ ucnv_safeClone(const UConverter* cnv, void *stackBuffer, int32_t *pBufferSize, U
             NULL
     };
 
+    uprv_memset(localConverter, 0, bufferSizeNeeded);
+
+    /* Copy initial state */
+    uprv_memcpy(localConverter, cnv, sizeof(UConverter));
+    localConverter->isCopyLocal = localConverter->isExtraLocal = FALSE;
+    localConverter->isSharedDataBorrowed = borrowSharedData;
+
+    /* copy the substitution string */
+    if (cnv->subChars == (uint8_t *)cnv->subUChars) {
+        localConverter->subChars = (uint8_t *)localConverter->subUChars;
+    } else {
+        localConverter->subChars = (uint8_t *)uprv_malloc(UCNV_ERROR_BUFFER_LENGTH * U_SIZEOF_UCHAR);
+        if (localConverter->subChars == NULL) {
+            *status = U_MEMORY_ALLOCATION_ERROR;
+            return NULL;
+        }
+        uprv_memcpy(localConverter->subChars, cnv->subChars, UCNV_ERROR_BUFFER_LENGTH * U_SIZEOF_UCHAR);
+    }
+
+    /* now either call the safeclone fcn or not */
+    if (cnv->sharedData->impl->safeClone != NULL) {
+        /* call the custom safeClone function */
+        UConverter *allocatedConverter = localConverter;
+        localConverter = cnv->sharedData->impl->safeClone(cnv, localConverter, pBufferSize, status);
+        if(localConverter==NULL || U_FAILURE(*status)) {
+            if (allocatedConverter->subChars != (uint8_t *)allocatedConverter->subUChars) {
+                uprv_free(allocatedConverter->subChars);
+            }
+            return NULL;
+        }
+    }
+
+    /* increment refcount of shared data if needed */
+    if (cnv->sharedData->isReferenceCounted && !borrowSharedData) {
+        ucnv_incrementRefCount(cnv->sharedData);
+    }
+
+    if(isCopyLocal) {
+        /* we're using user provided data - set to not destroy */
+        localConverter->isCopyLocal = TRUE;
+    }
+
+    /* allow callback functions to handle any memory allocation */
+    toUArgs.converter = fromUArgs.converter = localConverter;
+    cbErr = U_ZERO_ERROR;
+    cnv->fromCharErrorBehaviour(cnv->toUContext, &toUArgs, NULL, 0, UCNV_CLONE, &cbErr);
+    cbErr = U_ZERO_ERROR;
+    cnv->fromUCharErrorBehaviour(cnv->fromUContext, &fromUArgs, NULL, 0, 0, UCNV_CLONE, &cbErr);
+
+    return localConverter;
+}
+
+/* Creating a temporary stack-based object that can be used in one thread, 
+and created from a converter that is shared across threads.
+*/
+
+U_CAPI UConverter* U_EXPORT2
+ucnv_safeClone(const UConverter* cnv, void *stackBuffer, int32_t *pBufferSize, UErrorCode *status)
+{
+    UConverter *localConverter, *allocatedConverter;
+    int32_t stackBufferSize;
+    int32_t bufferSizeNeeded;
+
     UTRACE_ENTRY_OC(UTRACE_UCNV_CLONE);
 
     if (status == NULL || U_FAILURE(*status)){
@@ -262,59 +325,61 @@ ucnv_safeClone(const UConverter* cnv, void *stackBuffer, int32_t *pBufferSize, U
         allocatedConverter = NULL;
     }
 
-    uprv_memset(localConverter, 0, bufferSizeNeeded);
+    localConverter = cloneInto(cnv, localConverter, bufferSizeNeeded, pBufferSize,
+                               (UBool)(localConverter == (UConverter*)stackBuffer), FALSE, status);
+    if(localConverter==NULL) {
+        uprv_free(allocatedConverter);
+        UTRACE_EXIT_STATUS(*status);
+        return NULL;
+    }
 
-    /* Copy initial state */
-    uprv_memcpy(localConverter, cnv, sizeof(UConverter));
-    localConverter->isCopyLocal = localConverter->isExtraLocal = FALSE;
+    UTRACE_EXIT_PTR_STATUS(localConverter, *status);
+    return localConverter;
+}
 
-    /* copy the substitution string */
-    if (cnv->subChars == (uint8_t *)cnv->subUChars) {
-        localConverter->subChars = (uint8_t *)localConverter->subUChars;
-    } else {
-        localConverter->subChars = (uint8_t *)uprv_malloc(UCNV_ERROR_BUFFER_LENGTH * U_SIZEOF_UCHAR);
-        if (localConverter->subChars == NULL) {
-            uprv_free(allocatedConverter);
-            UTRACE_EXIT_STATUS(*status);
-            return NULL;
-        }
-        uprv_memcpy(localConverter->subChars, cnv->subChars, UCNV_ERROR_BUFFER_LENGTH * U_SIZEOF_UCHAR);
-    }
 
-    /* now either call the safeclone fcn or not */
-    if (cnv->sharedData->impl->safeClone != NULL) {
-        /* call the custom safeClone function */
-        localConverter = cnv->sharedData->impl->safeClone(cnv, localConverter, pBufferSize, status);
-    }
 
-    if(localConverter==NULL || U_FAILURE(*status)) {
-        if (allocatedConverter != NULL && allocatedConverter->subChars != (uint8_t *)allocatedConverter->subUChars) {
-            uprv_free(allocatedConverter->subChars);
-        }
-        uprv_free(allocatedConverter);
-        UTRACE_EXIT_STATUS(*status);
+U_CAPI UConverter* U_EXPORT2
+ucnv_initFromPrototype(const UConverter *prototype, void *buffer, int32_t *pBufferSize, UErrorCode *status)
+{
+    UConverter *localConverter;
+    int32_t bufferSizeNeeded;
+
+    if (status == NULL || U_FAILURE(*status)) {
         return NULL;
     }
-
-    /* increment refcount of shared data if needed */
-    if (cnv->sharedData->isReferenceCounted) {
-        ucnv_incrementRefCount(cnv->sharedData);
+    if (prototype == NULL || pBufferSize == NULL || *pBufferSize < 0 ||
+            (buffer == NULL && *pBufferSize > 0)) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return NULL;
     }
 
-    if(localConverter == (UConverter*)stackBuffer) {
-        /* we're using user provided data - set to not destroy */
-        localConverter->isCopyLocal = TRUE;
+    if (prototype->sharedData->impl->safeClone != NULL) {
+        /* call the custom safeClone function for sizing */
+        bufferSizeNeeded = 0;
+        prototype->sharedData->impl->safeClone(prototype, NULL, &bufferSizeNeeded, status);
+        if (U_FAILURE(*status)) {
+            return NULL;
+        }
+    } else {
+        bufferSizeNeeded = sizeof(UConverter);
     }
+    /* leave room for aligning the buffer */
+    bufferSizeNeeded += alignof(UConverter) - 1;
 
-    /* allow callback functions to handle any memory allocation */
-    toUArgs.converter = fromUArgs.converter = localConverter;
-    cbErr = U_ZERO_ERROR;
-    cnv->fromCharErrorBehaviour(cnv->toUContext, &toUArgs, NULL, 0, UCNV_CLONE, &cbErr);
-    cbErr = U_ZERO_ERROR;
-    cnv->fromUCharErrorBehaviour(cnv->fromUContext, &fromUArgs, NULL, 0, 0, UCNV_CLONE, &cbErr);
+    if (*pBufferSize < bufferSizeNeeded) {
+        /* preflighting or a buffer that is too small */
+        *pBufferSize = bufferSizeNeeded;
+        *status = U_BUFFER_OVERFLOW_ERROR;
+        return NULL;
+    }
 
-    UTRACE_EXIT_PTR_STATUS(localConverter, *status);
-    return localConverter;
+    uintptr_t p = reinterpret_cast<uintptr_t>(buffer);
+    uintptr_t aligned_p = (p + alignof(UConverter) - 1) & ~(alignof(UConverter) - 1);
+    localConverter = reinterpret_cast<UConverter *>(aligned_p);
+    int32_t size = *pBufferSize - (int32_t)(aligned_p - p);
+    return cloneInto(prototype, localConverter, bufferSizeNeeded - (alignof(UConverter) - 1), &size,
+                     TRUE, TRUE, status);
 }
 
 
@@ -382,7 +447,7 @@ ucnv_close (UConverter * converter)
         uprv_free(converter->subChars);
     }
 
-    if (converter->sharedData->isReferenceCounted) {
+    if (converter->sharedData->isReferenceCounted && !converter->isSharedDataBorrowed) {
         ucnv_unloadSharedDataIfReady(converter->sharedData);
     }
 
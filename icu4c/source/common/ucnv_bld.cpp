@@ -33,6 +33,7 @@
 #include "putilimp.h"
 #include "uassert.h"
 #include "utracimp.h"
+#include "ucounterimp.h"
 #include "ucnv_io.h"
 #include "ucnv_bld.h"
 #include "ucnvmbcs.h"
@@ -44,6 +45,7 @@
 #include "cstring.h"
 #include "cmemory.h"
 #include "ucln_cmn.h"
+#include "udatamem.h"
 #include "ustr_cnv.h"
 
 
@@ -832,6 +834,7 @@ ucnv_createConverter(UConverter *myUConverter, const char *converterName, UError
     UConverterSharedData *mySharedConverterData;
 
     UTRACE_ENTRY_OC(UTRACE_UCNV_OPEN);
+    UCOUNTER_INC(UCOUNTER_CONVERTER_OPENS);
 
     if(U_SUCCESS(*err)) {
         UTRACE_DATA1(UTRACE_OPEN_CLOSE, "open converter %s", converterName);
@@ -889,6 +892,7 @@ ucnv_createAlgorithmicConverter(UConverter *myUConverter,
     UConverterLoadArgs stackArgs=UCNV_LOAD_ARGS_INITIALIZER;
 
     UTRACE_ENTRY_OC(UTRACE_UCNV_OPEN_ALGORITHMIC);
+    UCOUNTER_INC(UCOUNTER_CONVERTER_OPENS);
     UTRACE_DATA1(UTRACE_OPEN_CLOSE, "open algorithmic converter type %d", (int32_t)type);
 
     if(type<0 || UCNV_NUMBER_OF_SUPPORTED_CONVERTER_TYPES<=type) {
@@ -925,6 +929,7 @@ ucnv_createConverterFromPackage(const char *packageName, const char *converterNa
     UConverterLoadArgs stackArgs=UCNV_LOAD_ARGS_INITIALIZER;
 
     UTRACE_ENTRY_OC(UTRACE_UCNV_OPEN_PACKAGE);
+    UCOUNTER_INC(UCOUNTER_CONVERTER_OPENS);
 
     if(U_FAILURE(*err)) {
         UTRACE_EXIT_STATUS(*err);
@@ -1100,6 +1105,58 @@ ucnv_flushCache ()
 
 /* available converters list --------------------------------------------------- */
 
+/*
+ * Tests whether a data-based converter can be loaded, like ucnv_canCreateConverter()
+ * but without opening its data: The .cnv item is looked up in place in the
+ * common data package and validated as in ucnv_data_unFlattenClone(),
+ * and the MBCS load function runs in test mode on a stack copy of the shared data.
+ * Returns TRUE if the converter is loadable, or else sets *pKnown to FALSE
+ * if the caller must fall back to ucnv_canCreateConverter(),
+ * for example for algorithmic converters and for converters not in the common data.
+ */
+static UBool
+canLoadConverterFromCommonData(const char *converterName, UBool *pKnown) {
+    UConverterNamePieces pieces;
+    UConverterLoadArgs args=UCNV_LOAD_ARGS_INITIALIZER;
+    UErrorCode errorCode = U_ZERO_ERROR;
+
+    *pKnown = FALSE;
+    pieces.cnvName[0] = 0;
+    pieces.locale[0] = 0;
+    pieces.options = 0;
+    parseConverterOptions(converterName, &pieces, &args, &errorCode);
+    if (U_FAILURE(errorCode) || getAlgorithmicTypeFromName(args.name) != NULL) {
+        return FALSE;
+    }
+
+    const uint8_t *raw = (const uint8_t *)udata_findCommonItem(DATA_TYPE, args.name, isCnvAcceptable, NULL);
+    if (raw == NULL) {
+        return FALSE;
+    }
+    const UConverterStaticData *source = (const UConverterStaticData *)raw;
+    if (source->conversionType != UCNV_MBCS ||
+            source->structSize != sizeof(UConverterStaticData)) {
+        return FALSE;
+    }
+
+    /* Only the MBCS load function does any work in test mode; it does not allocate. */
+    UConverterSharedData data;
+    uprv_memcpy(&data, converterData[UCNV_MBCS], sizeof(UConverterSharedData));
+    data.staticData = source;
+    data.sharedDataCached = FALSE;
+    data.dataMemory = NULL;
+    args.nestedLoads = 1;
+    args.onlyTestIsLoadable = TRUE;
+
+    /* An extension-only converter loads its base converter through the cache. */
+    umtx_lock(&cnvCacheMutex);
+    data.impl->load(&data, &args, raw + source->structSize, &errorCode);
+    umtx_unlock(&cnvCacheMutex);
+
+    *pKnown = TRUE;
+    return U_SUCCESS(errorCode);
+}
+
 static void U_CALLCONV initAvailableConvertersList(UErrorCode &errCode) {
     U_ASSERT(gAvailableConverterCount == 0);
     U_ASSERT(gAvailableConverters == NULL);
@@ -1128,7 +1185,12 @@ static void U_CALLCONV initAvailableConvertersList(UErrorCode &errCode) {
     for (int32_t idx = 0; idx < allConverterCount; idx++) {
         localStatus = U_ZERO_ERROR;
         const char *converterName = uenum_next(allConvEnum, NULL, &localStatus);
-        if (ucnv_canCreateConverter(converterName, &localStatus)) {
+        UBool known;
+        UBool canLoad = canLoadConverterFromCommonData(converterName, &known);
+        if (!known) {
+            canLoad = ucnv_canCreateConverter(converterName, &localStatus);
+        }
+        if (canLoad) {
             gAvailableConverters[gAvailableConverterCount++] = converterName;
         }
     }
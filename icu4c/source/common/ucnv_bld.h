@@ -184,6 +184,7 @@ struct UConverter {
     UBool sharedDataIsCached;  /* TRUE:  shared data is in cache, don't destroy on ucnv_close() if 0 ref.  FALSE: shared data isn't in the cache, do attempt to clean it up if the ref is 0 */
     UBool isCopyLocal;  /* TRUE if UConverter is not owned and not released in ucnv_close() (stack-allocated, safeClone(), etc.) */
     UBool isExtraLocal; /* TRUE if extraInfo is not owned and not released in ucnv_close() (stack-allocated, safeClone(), etc.) */
+    UBool isSharedDataBorrowed; /* TRUE if sharedData is owned by a prototype converter and not reference-counted here (ucnv_initFromPrototype()) */
 
     UBool  useFallback;
     int8_t toULength;                   /* number of bytes in toUBytes */
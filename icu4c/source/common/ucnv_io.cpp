@@ -45,6 +45,7 @@
 #include "ucnv_io.h"
 #include "uenumimp.h"
 #include "ucln_cmn.h"
+#include "ustr_imp.h"
 
 /* Format of cnvalias.icu -----------------------------------------------------
  *
@@ -177,6 +178,15 @@ static const char DATA_TYPE[] = "icu";
 static UDataMemory *gAliasData=NULL;
 static icu::UInitOnce gAliasDataInitOnce = U_INITONCE_INITIALIZER;
 
+/*
+ * Hash index over the normalized aliases, built on first lookup.
+ * Each slot holds 1+ the index into gMainTable.aliasList, or 0 if empty.
+ * Immutable once built, so lookups need no lock.
+ */
+static uint16_t *gAliasHashTable=NULL;
+static uint32_t gAliasHashMask=0;
+static icu::UInitOnce gAliasHashInitOnce = U_INITONCE_INITIALIZER;
+
 enum {
     tocLengthIndex=0,
     converterListIndex=1,
@@ -218,6 +228,11 @@ isAcceptable(void * /*context*/,
 
 static UBool U_CALLCONV ucnv_io_cleanup(void)
 {
+    uprv_free(gAliasHashTable);
+    gAliasHashTable = NULL;
+    gAliasHashMask = 0;
+    gAliasHashInitOnce.reset();
+
     if (gAliasData) {
         udata_close(gAliasData);
         gAliasData = NULL;
@@ -544,6 +559,58 @@ ucnv_compareNames(const char *name1, const char *name2) {
     }
 }
 
+static void U_CALLCONV initAliasHash(UErrorCode &errCode) {
+    uint32_t i, capacity, count = gMainTable.untaggedConvArraySize;
+
+    /* 1+index must fit into a slot */
+    if (count >= 0xffff) {
+        errCode = U_UNSUPPORTED_ERROR;
+        return;
+    }
+    /* power of 2 with a load factor of at most 1/2 */
+    for (capacity = 64; capacity < 2 * count; capacity <<= 1) {}
+    gAliasHashTable = (uint16_t *)uprv_malloc(capacity * sizeof(uint16_t));
+    if (gAliasHashTable == NULL) {
+        errCode = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    uprv_memset(gAliasHashTable, 0, capacity * sizeof(uint16_t));
+    gAliasHashMask = capacity - 1;
+
+    for (i = 0; i < count; ++i) {
+        const char *name = GET_NORMALIZED_STRING(gMainTable.aliasList[i]);
+        uint32_t slot = (uint32_t)ustr_hashCharsN(name, (int32_t)uprv_strlen(name)) & gAliasHashMask;
+        while (gAliasHashTable[slot] != 0) {
+            slot = (slot + 1) & gAliasHashMask;
+        }
+        gAliasHashTable[slot] = (uint16_t)(i + 1);
+    }
+}
+
+/*
+ * return the converter number index for gConverterList
+ * for the alias at index i in gMainTable.aliasList
+ */
+static inline uint32_t
+getAliasConverter(uint32_t i, UBool *containsOption, UErrorCode *pErrorCode) {
+    /* Since the gencnval tool folds duplicates into one entry,
+     * this alias in gAliasList is unique, but different standards
+     * may map an alias to different converters.
+     */
+    if (gMainTable.untaggedConvArray[i] & UCNV_AMBIGUOUS_ALIAS_MAP_BIT) {
+        *pErrorCode = U_AMBIGUOUS_ALIAS_WARNING;
+    }
+    /* State whether the canonical converter name contains an option.
+    This information is contained in this list in order to maintain backward & forward compatibility. */
+    if (containsOption) {
+        UBool containsCnvOptionInfo = (UBool)gMainTable.optionTable->containsCnvOptionInfo;
+        *containsOption = (UBool)((containsCnvOptionInfo
+            && ((gMainTable.untaggedConvArray[i] & UCNV_CONTAINS_OPTION_BIT) != 0))
+            || !containsCnvOptionInfo);
+    }
+    return gMainTable.untaggedConvArray[i] & UCNV_CONVERTER_INDEX_MASK;
+}
+
 /*
  * search for an alias
  * return the converter number index for gConverterList
@@ -557,6 +624,8 @@ findConverter(const char *alias, UBool *containsOption, UErrorCode *pErrorCode)
     char strippedName[UCNV_MAX_CONVERTER_NAME_LENGTH];
 
     if (!isUnnormalized) {
+        UErrorCode hashErrorCode = U_ZERO_ERROR;
+
         if (uprv_strlen(alias) >= UCNV_MAX_CONVERTER_NAME_LENGTH) {
             *pErrorCode = U_BUFFER_OVERFLOW_ERROR;
             return UINT32_MAX;
@@ -565,6 +634,20 @@ findConverter(const char *alias, UBool *containsOption, UErrorCode *pErrorCode)
         /* Lower case and remove ignoreable characters. */
         ucnv_io_stripForCompare(strippedName, alias);
         alias = strippedName;
+
+        /* use the hash index if it could be built, otherwise the binary search below */
+        umtx_initOnce(gAliasHashInitOnce, &initAliasHash, hashErrorCode);
+        if (U_SUCCESS(hashErrorCode)) {
+            uint32_t slot = (uint32_t)ustr_hashCharsN(alias, (int32_t)uprv_strlen(alias)) & gAliasHashMask;
+            uint32_t i;
+            while ((i = gAliasHashTable[slot]) != 0) {
+                if (uprv_strcmp(alias, GET_NORMALIZED_STRING(gMainTable.aliasList[i - 1])) == 0) {
+                    return getAliasConverter(i - 1, containsOption, pErrorCode);
+                }
+                slot = (slot + 1) & gAliasHashMask;
+            }
+            return UINT32_MAX;
+        }
     }
 
     /* do a binary search for the alias */
@@ -591,22 +674,7 @@ findConverter(const char *alias, UBool *containsOption, UErrorCode *pErrorCode)
         } else if (result > 0) {
             start = mid;
         } else {
-            /* Since the gencnval tool folds duplicates into one entry,
-             * this alias in gAliasList is unique, but different standards
-             * may map an alias to different converters.
-             */
-            if (gMainTable.untaggedConvArray[mid] & UCNV_AMBIGUOUS_ALIAS_MAP_BIT) {
-                *pErrorCode = U_AMBIGUOUS_ALIAS_WARNING;
-            }
-            /* State whether the canonical converter name contains an option.
-            This information is contained in this list in order to maintain backward & forward compatibility. */
-            if (containsOption) {
-                UBool containsCnvOptionInfo = (UBool)gMainTable.optionTable->containsCnvOptionInfo;
-                *containsOption = (UBool)((containsCnvOptionInfo
-                    && ((gMainTable.untaggedConvArray[mid] & UCNV_CONTAINS_OPTION_BIT) != 0))
-                    || !containsCnvOptionInfo);
-            }
-            return gMainTable.untaggedConvArray[mid] & UCNV_CONVERTER_INDEX_MASK;
+            return getAliasConverter(mid, containsOption, pErrorCode);
         }
     }
 
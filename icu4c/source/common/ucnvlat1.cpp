@@ -21,6 +21,7 @@
 #include "unicode/ucnv.h"
 #include "unicode/uset.h"
 #include "unicode/utf8.h"
+#include "cmemory.h"
 #include "ucnv_bld.h"
 #include "ucnv_cnv.h"
 #include "ustr_imp.h"
@@ -422,6 +423,71 @@ ucnv_Latin1FromUTF8(UConverterFromUnicodeArgs *pFromUArgs,
     pFromUArgs->target=(char *)target;
 }
 
+/* Convert Latin-1 to UTF-8 directly; every byte maps to U+0000..U+00FF. */
+static void U_CALLCONV
+ucnv_Latin1ToUTF8(UConverterFromUnicodeArgs *pFromUArgs,
+                  UConverterToUnicodeArgs *pToUArgs,
+                  UErrorCode *pErrorCode) {
+    UConverter *utf8;
+    const uint8_t *source, *sourceLimit;
+    uint8_t *target;
+    const uint8_t *targetLimit;
+
+    uint8_t b, bytes[2];
+
+    utf8=pFromUArgs->converter;
+    if(utf8->fromUChar32!=0) {
+        /* a pending lead surrogate is handled by the pivoting implementation */
+        *pErrorCode=U_USING_DEFAULT_WARNING;
+        return;
+    }
+
+    /* set up the local pointers */
+    source=(const uint8_t *)pToUArgs->source;
+    sourceLimit=(const uint8_t *)pToUArgs->sourceLimit;
+    target=(uint8_t *)pFromUArgs->target;
+    targetLimit=(const uint8_t *)pFromUArgs->targetLimit;
+
+    /* conversion loop */
+    while(source<sourceLimit) {
+        if(target>=targetLimit) {
+            /* target is full */
+            *pErrorCode=U_BUFFER_OVERFLOW_ERROR;
+            break;
+        }
+        b=*source++;
+        if(b<=0x7f) {
+            *target++=b;
+            /* copy a run of ASCII bytes, testing 8 at a time at every 8th source position */
+            while( ((uintptr_t)source&7)==0 &&
+                   (targetLimit-target)>=8 && (sourceLimit-source)>=8 &&
+                   icu::ASCIIWords::isAscii8(source)
+            ) {
+                uprv_memcpy(target, source, 8);
+                source+=8;
+                target+=8;
+            }
+        } else {
+            bytes[0]=(uint8_t)(0xc0|(b>>6));
+            bytes[1]=(uint8_t)(0x80|(b&0x3f));
+            if((targetLimit-target)>=2) {
+                *target++=bytes[0];
+                *target++=bytes[1];
+            } else {
+                /* the trail byte goes into the UTF-8 converter's overflow buffer */
+                ucnv_fromUWriteBytes(utf8, (const char *)bytes, 2,
+                                     (char **)&target, (const char *)targetLimit,
+                                     NULL, -1, pErrorCode);
+                break;
+            }
+        }
+    }
+
+    /* write back the updated pointers */
+    pToUArgs->source=(const char *)source;
+    pFromUArgs->target=(char *)target;
+}
+
 static void U_CALLCONV
 _Latin1GetUnicodeSet(const UConverter *cnv,
                      const USetAdder *sa,
@@ -457,7 +523,7 @@ static const UConverterImpl _Latin1Impl={
     NULL,
     _Latin1GetUnicodeSet,
 
-    NULL,
+    ucnv_Latin1ToUTF8,
     ucnv_Latin1FromUTF8
 };
 
@@ -613,7 +679,10 @@ _ASCIIGetNextUChar(UConverterToUnicodeArgs *pArgs,
     return 0xffff;
 }
 
-/* "Convert" UTF-8 to US-ASCII: Validate and copy. */
+/*
+ * "Convert" UTF-8 to US-ASCII, or US-ASCII to UTF-8: Validate and copy.
+ * Used in both directions, like ucnv_UTF8FromUTF8().
+ */
 static void U_CALLCONV
 ucnv_ASCIIFromUTF8(UConverterFromUnicodeArgs *pFromUArgs,
                    UConverterToUnicodeArgs *pToUArgs,
@@ -624,8 +693,8 @@ ucnv_ASCIIFromUTF8(UConverterFromUnicodeArgs *pFromUArgs,
 
     uint8_t c;
 
-    if(pToUArgs->converter->toULength > 0) {
-        /* no handling of partial UTF-8 characters here, fall back to pivoting */
+    if(pToUArgs->converter->toULength > 0 || pFromUArgs->converter->fromUChar32 != 0) {
+        /* no handling of partial characters here, fall back to pivoting */
         *pErrorCode=U_USING_DEFAULT_WARNING;
         return;
     }
@@ -736,7 +805,7 @@ static const UConverterImpl _ASCIIImpl={
     NULL,
     _ASCIIGetUnicodeSet,
 
-    NULL,
+    ucnv_ASCIIFromUTF8,
     ucnv_ASCIIFromUTF8
 };
 
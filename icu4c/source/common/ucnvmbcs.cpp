@@ -65,6 +65,83 @@
 #define MBCS_UNROLL_SINGLE_TO_BMP 1
 #define MBCS_UNROLL_SINGLE_FROM_BMP 0
 
+/*
+ * Runs of ASCII are converted a 64-bit word at a time with portable shifts and masks.
+ * The asciiRoundtrips bit set has a granularity of 4 characters;
+ * if it is not complete, then the bytes of a word are checked individually
+ * against the initial state of the state table.
+ */
+
+/**
+ * Returns TRUE if the 8 bytes at s are all ASCII
+ * and round-trip with the same code points.
+ */
+static inline UBool
+isAsciiRoundtrip8(const uint8_t *s, uint32_t asciiRoundtrips, const int32_t *stateZero) {
+    if(!icu::ASCIIWords::isAscii8(s)) {
+        return FALSE;
+    }
+    if(asciiRoundtrips == 0xffffffff) {
+        return TRUE;
+    }
+    int32_t diff = 0;
+    for(int32_t i = 0; i < 8; ++i) {
+        diff |= stateZero[s[i]] ^ MBCS_ENTRY_FINAL(0, MBCS_STATE_VALID_DIRECT_16, s[i]);
+    }
+    return diff == 0;
+}
+
+/**
+ * Returns TRUE if the 4 UChars at s are all ASCII
+ * and round-trip with the same byte values.
+ */
+static inline UBool
+isAsciiRoundtrip4(const UChar *s, uint32_t asciiRoundtrips, const int32_t *stateZero) {
+    if(!icu::ASCIIWords::isAscii4(s)) {
+        return FALSE;
+    }
+    if(asciiRoundtrips == 0xffffffff) {
+        return TRUE;
+    }
+    int32_t diff = 0;
+    for(int32_t i = 0; i < 4; ++i) {
+        diff |= stateZero[s[i]] ^ MBCS_ENTRY_FINAL(0, MBCS_STATE_VALID_DIRECT_16, s[i]);
+    }
+    return diff == 0;
+}
+
+/**
+ * Converts 8 bytes with the initial state of the state table
+ * if they are all ASCII-range bytes with valid direct BMP mappings
+ * that stay in the initial state.
+ * The lookups are independent of each other and checked together.
+ * Returns FALSE if any byte needs the regular conversion loop;
+ * the dest contents are then undefined.
+ */
+static inline UBool
+lookupSingleBytes8(const int32_t *stateZero, const uint8_t *s, UChar *dest) {
+    if(!icu::ASCIIWords::isAscii8(s)) {
+        return FALSE;
+    }
+    uint32_t oredBits = 0;
+    for(int32_t i = 0; i < 8; ++i) {
+        int32_t entry = stateZero[s[i]];
+        /* MBCS_ENTRY_FINAL_IS_VALID_DIRECT_16(entry) for all entries */
+        oredBits |= (uint32_t)entry ^ 0x80000000;
+        dest[i] = (UChar)MBCS_ENTRY_FINAL_VALUE_16(entry);
+    }
+    return (oredBits & 0xfff00000) == 0;
+}
+
+static inline void
+narrowAscii4(uint8_t *dest, const UChar *s) {
+    uint64_t word;
+    uprv_memcpy(&word, s, 8);
+    word = (word | (word >> 8)) & UINT64_C(0x0000ffff0000ffff);
+    uint32_t bytes = (uint32_t)((word | (word >> 16)) & 0xffffffff);
+    uprv_memcpy(dest, &bytes, 4);
+}
+
 /*
  * _MBCSHeader versions 5.3 & 4.3
  * (Note that the _MBCSHeader version is in addition to the converter formatVersion.)
@@ -431,6 +508,11 @@ ucnv_DBCSFromUTF8(UConverterFromUnicodeArgs *pFromUArgs,
                   UConverterToUnicodeArgs *pToUArgs,
                   UErrorCode *pErrorCode);
 
+static void U_CALLCONV
+ucnv_MBCSToUTF8(UConverterFromUnicodeArgs *pFromUArgs,
+                UConverterToUnicodeArgs *pToUArgs,
+                UErrorCode *pErrorCode);
+
 static const UConverterImpl _SBCSUTF8Impl={
     UCNV_MBCS,
 
@@ -453,7 +535,7 @@ static const UConverterImpl _SBCSUTF8Impl={
     NULL,
     ucnv_MBCSGetUnicodeSet,
 
-    NULL,
+    ucnv_MBCSToUTF8,
     ucnv_SBCSFromUTF8
 };
 
@@ -479,7 +561,7 @@ static const UConverterImpl _DBCSUTF8Impl={
     NULL,
     ucnv_MBCSGetUnicodeSet,
 
-    NULL,
+    ucnv_MBCSToUTF8,
     ucnv_DBCSFromUTF8
 };
 
@@ -508,6 +590,33 @@ static const UConverterImpl _MBCSImpl={
     NULL
 };
 
+/* same as _MBCSImpl but with direct conversion to UTF-8 */
+static const UConverterImpl _MBCSToUTF8Impl={
+    UCNV_MBCS,
+
+    ucnv_MBCSLoad,
+    ucnv_MBCSUnload,
+
+    ucnv_MBCSOpen,
+    NULL,
+    NULL,
+
+    ucnv_MBCSToUnicodeWithOffsets,
+    ucnv_MBCSToUnicodeWithOffsets,
+    ucnv_MBCSFromUnicodeWithOffsets,
+    ucnv_MBCSFromUnicodeWithOffsets,
+    ucnv_MBCSGetNextUChar,
+
+    ucnv_MBCSGetStarters,
+    ucnv_MBCSGetName,
+    ucnv_MBCSWriteSub,
+    NULL,
+    ucnv_MBCSGetUnicodeSet,
+
+    ucnv_MBCSToUTF8,
+    NULL
+};
+
 /* Static data is in tools/makeconv/ucnvstat.c for data-based
  * converters. Be sure to update it as well.
  */
@@ -1254,6 +1363,9 @@ _extToU(UConverter *cnv, const UConverterSharedData *sharedData,
 #define U_LF 0x0a
 #define U_NL 0x85
 
+/* guards the lazily built swaplfnl tables in UConverterMBCSTable */
+static icu::UMutex gSwapLFNLMutex;
+
 static UBool
 _EBCDICSwapLFNL(UConverterSharedData *sharedData, UErrorCode *pErrorCode) {
     UConverterMBCSTable *mbcsTable;
@@ -1383,7 +1495,7 @@ _EBCDICSwapLFNL(UConverterSharedData *sharedData, UErrorCode *pErrorCode) {
     uprv_strcat(name, UCNV_SWAP_LFNL_OPTION_STRING);
 
     /* set the pointers */
-    icu::umtx_lock(NULL);
+    icu::umtx_lock(&gSwapLFNLMutex);
     if(mbcsTable->swapLFNLStateTable==NULL) {
         mbcsTable->swapLFNLStateTable=newStateTable;
         mbcsTable->swapLFNLFromUnicodeBytes=(uint8_t *)newResults;
@@ -1391,7 +1503,7 @@ _EBCDICSwapLFNL(UConverterSharedData *sharedData, UErrorCode *pErrorCode) {
 
         newStateTable=NULL;
     }
-    icu::umtx_unlock(NULL);
+    icu::umtx_unlock(&gSwapLFNLMutex);
 
     /* release the allocated memory if another thread beat us to it */
     if(newStateTable!=NULL) {
@@ -1856,6 +1968,27 @@ ucnv_MBCSLoad(UConverterSharedData *sharedData,
         }
     }
 
+    /*
+     * Derive option bits from the converter name once here rather than
+     * in every ucnv_MBCSOpen(). The shared data is cached under this name.
+     */
+    mbcsTable->nameOptions=0;
+    if(uprv_strstr(pArgs->name, "18030")!=NULL) {
+        if(uprv_strstr(pArgs->name, "gb18030")!=NULL || uprv_strstr(pArgs->name, "GB18030")!=NULL) {
+            /* set a flag for GB 18030 mode, which changes the callback behavior */
+            mbcsTable->nameOptions=_MBCS_OPTION_GB18030;
+        }
+    } else if((uprv_strstr(pArgs->name, "KEIS")!=NULL) || (uprv_strstr(pArgs->name, "keis")!=NULL)) {
+        /* set a flag for KEIS converter, which changes the SI/SO character sequence */
+        mbcsTable->nameOptions=_MBCS_OPTION_KEIS;
+    } else if((uprv_strstr(pArgs->name, "JEF")!=NULL) || (uprv_strstr(pArgs->name, "jef")!=NULL)) {
+        /* set a flag for JEF converter, which changes the SI/SO character sequence */
+        mbcsTable->nameOptions=_MBCS_OPTION_JEF;
+    } else if((uprv_strstr(pArgs->name, "JIPS")!=NULL) || (uprv_strstr(pArgs->name, "jips")!=NULL)) {
+        /* set a flag for JIPS converter, which changes the SI/SO character sequence */
+        mbcsTable->nameOptions=_MBCS_OPTION_JIPS;
+    }
+
     /* Set the impl pointer here so that it is set for both extension-only and base tables. */
     if(mbcsTable->utf8Friendly) {
         if(mbcsTable->countStates==1) {
@@ -1866,6 +1999,16 @@ ucnv_MBCSLoad(UConverterSharedData *sharedData,
             }
         }
     }
+    if( sharedData->impl==&_MBCSImpl &&
+        mbcsTable->outputType!=MBCS_OUTPUT_DBCS_ONLY && mbcsTable->outputType!=MBCS_OUTPUT_2_SISO
+    ) {
+        /*
+         * Stateful converters would fall back to the pivoting code for
+         * every character after a state change, which costs more than
+         * the direct path saves.
+         */
+        sharedData->impl=&_MBCSToUTF8Impl;
+    }
 
     if(mbcsTable->outputType==MBCS_OUTPUT_DBCS_ONLY || mbcsTable->outputType==MBCS_OUTPUT_2_SISO) {
         /*
@@ -1919,9 +2062,9 @@ ucnv_MBCSOpen(UConverter *cnv,
         /* do this because double-checked locking is broken */
         UBool isCached;
 
-        icu::umtx_lock(NULL);
+        icu::umtx_lock(&gSwapLFNLMutex);
         isCached=mbcsTable->swapLFNLStateTable!=NULL;
-        icu::umtx_unlock(NULL);
+        icu::umtx_unlock(&gSwapLFNLMutex);
 
         if(!isCached) {
             if(!_EBCDICSwapLFNL(cnv->sharedData, pErrorCode)) {
@@ -1935,21 +2078,8 @@ ucnv_MBCSOpen(UConverter *cnv,
         }
     }
 
-    if(uprv_strstr(pArgs->name, "18030")!=NULL) {
-        if(uprv_strstr(pArgs->name, "gb18030")!=NULL || uprv_strstr(pArgs->name, "GB18030")!=NULL) {
-            /* set a flag for GB 18030 mode, which changes the callback behavior */
-            cnv->options|=_MBCS_OPTION_GB18030;
-        }
-    } else if((uprv_strstr(pArgs->name, "KEIS")!=NULL) || (uprv_strstr(pArgs->name, "keis")!=NULL)) {
-        /* set a flag for KEIS converter, which changes the SI/SO character sequence */
-        cnv->options|=_MBCS_OPTION_KEIS;
-    } else if((uprv_strstr(pArgs->name, "JEF")!=NULL) || (uprv_strstr(pArgs->name, "jef")!=NULL)) {
-        /* set a flag for JEF converter, which changes the SI/SO character sequence */
-        cnv->options|=_MBCS_OPTION_JEF;
-    } else if((uprv_strstr(pArgs->name, "JIPS")!=NULL) || (uprv_strstr(pArgs->name, "jips")!=NULL)) {
-        /* set a flag for JIPS converter, which changes the SI/SO character sequence */
-        cnv->options|=_MBCS_OPTION_JIPS;
-    }
+    /* GB 18030, KEIS, JEF and JIPS flags, see ucnv_MBCSLoad() */
+    cnv->options|=mbcsTable->nameOptions;
 
     /* fix maxBytesPerUChar depending on outputType and options etc. */
     if(outputType==MBCS_OUTPUT_2_SISO) {
@@ -2196,6 +2326,7 @@ ucnv_MBCSSingleToBMPWithOffsets(UConverterToUnicodeArgs *pArgs,
 
     int32_t entry;
     uint8_t action;
+    uint32_t asciiRoundtrips;
 
     /* set up the local pointers */
     cnv=pArgs->converter;
@@ -2210,6 +2341,7 @@ ucnv_MBCSSingleToBMPWithOffsets(UConverterToUnicodeArgs *pArgs,
     } else {
         stateTable=cnv->sharedData->mbcs.stateTable;
     }
+    asciiRoundtrips=cnv->sharedData->mbcs.asciiRoundtrips;
 
     /* sourceIndex=-1 if the current character began in the previous buffer */
     sourceIndex=0;
@@ -2233,6 +2365,15 @@ ucnv_MBCSSingleToBMPWithOffsets(UConverterToUnicodeArgs *pArgs,
 
         loops=count=targetCapacity>>4;
         do {
+            if(asciiRoundtrips==0xffffffff &&
+                    icu::ASCIIWords::isAscii8(source) && icu::ASCIIWords::isAscii8(source+8)) {
+                /* 16 ASCII bytes map to themselves */
+                icu::ASCIIWords::widen8(target, source);
+                icu::ASCIIWords::widen8(target+8, source+8);
+                source+=16;
+                target+=16;
+                continue;
+            }
             oredEntries=entry=stateTable[0][*source++];
             *target++=(UChar)MBCS_ENTRY_FINAL_VALUE_16(entry);
             oredEntries|=entry=stateTable[0][*source++];
@@ -2587,6 +2728,15 @@ ucnv_MBCSToUnicodeWithOffsets(UConverterToUnicodeArgs *pArgs,
                             ++source;
                             *target++=(UChar)MBCS_ENTRY_FINAL_VALUE_16(entry);
                             state=(uint8_t)MBCS_ENTRY_FINAL_STATE(entry); /* typically 0 */
+                            if(state==0) {
+                                /* convert runs of 8 single-byte ASCII-range characters at a time */
+                                while( (sourceLimit-source)>=8 && (targetLimit-target)>=8 &&
+                                       lookupSingleBytes8(stateTable[0], source, target)
+                                ) {
+                                    source+=8;
+                                    target+=8;
+                                }
+                            }
                         } else {
                             /* leave the optimized loop */
                             break;
@@ -2631,6 +2781,19 @@ ucnv_MBCSToUnicodeWithOffsets(UConverterToUnicodeArgs *pArgs,
                                 sourceIndex=++nextSourceIndex;
                             }
                             state=(uint8_t)MBCS_ENTRY_FINAL_STATE(entry); /* typically 0 */
+                            if(state==0) {
+                                /* convert runs of 8 single-byte ASCII-range characters at a time */
+                                while( (sourceLimit-source)>=8 && (targetLimit-target)>=8 &&
+                                       lookupSingleBytes8(stateTable[0], source, target)
+                                ) {
+                                    source+=8;
+                                    target+=8;
+                                    for(int32_t i=0; i<8; ++i) {
+                                        *offsets++=sourceIndex++;
+                                    }
+                                    nextSourceIndex=sourceIndex;
+                                }
+                            }
                         } else {
                             /* leave the optimized loop */
                             break;
@@ -3421,6 +3584,7 @@ ucnv_MBCSDoubleFromUnicodeWithOffsets(UConverterFromUnicodeArgs *pArgs,
 
     uint32_t stage2Entry;
     uint32_t asciiRoundtrips;
+    const int32_t *stateZero;
     uint32_t value;
     uint8_t unicodeMask;
 
@@ -3443,6 +3607,7 @@ ucnv_MBCSDoubleFromUnicodeWithOffsets(UConverterFromUnicodeArgs *pArgs,
         bytes=cnv->sharedData->mbcs.fromUnicodeBytes;
     }
     asciiRoundtrips=cnv->sharedData->mbcs.asciiRoundtrips;
+    stateZero=cnv->sharedData->mbcs.stateTable[0];
 
     /* get the converter state from UConverter */
     c=cnv->fromUChar32;
@@ -3481,6 +3646,22 @@ ucnv_MBCSDoubleFromUnicodeWithOffsets(UConverterFromUnicodeArgs *pArgs,
                 }
                 --targetCapacity;
                 c=0;
+                /* convert a run of ASCII a word at a time */
+                while( targetCapacity>=4 && (sourceLimit-source)>=4 &&
+                       isAsciiRoundtrip4(source, asciiRoundtrips, stateZero)
+                ) {
+                    narrowAscii4(target, source);
+                    source+=4;
+                    target+=4;
+                    targetCapacity-=4;
+                    if(offsets!=NULL) {
+                        *offsets++=sourceIndex++;
+                        *offsets++=sourceIndex++;
+                        *offsets++=sourceIndex++;
+                        *offsets++=sourceIndex++;
+                        nextSourceIndex=sourceIndex;
+                    }
+                }
                 continue;
             }
             /*
@@ -3827,6 +4008,7 @@ ucnv_MBCSSingleFromBMPWithOffsets(UConverterFromUnicodeArgs *pArgs,
     int32_t sourceIndex;
 
     uint32_t asciiRoundtrips;
+    const int32_t *stateZero;
     uint16_t value, minValue;
 
     /* set up the local pointers */
@@ -3844,6 +4026,7 @@ ucnv_MBCSSingleFromBMPWithOffsets(UConverterFromUnicodeArgs *pArgs,
         results=(uint16_t *)cnv->sharedData->mbcs.fromUnicodeBytes;
     }
     asciiRoundtrips=cnv->sharedData->mbcs.asciiRoundtrips;
+    stateZero=cnv->sharedData->mbcs.stateTable[0];
 
     if(cnv->useFallback) {
         /* use all roundtrip and fallback results */
@@ -3940,6 +4123,13 @@ ucnv_MBCSSingleFromBMPWithOffsets(UConverterFromUnicodeArgs *pArgs,
             *target++=(uint8_t)c;
             --targetCapacity;
             c=0;
+            /* convert a run of ASCII a word at a time; targetCapacity<=source length */
+            while(targetCapacity>=4 && isAsciiRoundtrip4(source, asciiRoundtrips, stateZero)) {
+                narrowAscii4(target, source);
+                source+=4;
+                target+=4;
+                targetCapacity-=4;
+            }
             continue;
         }
         value=MBCS_SINGLE_RESULT_FROM_U(table, results, c);
@@ -4087,6 +4277,7 @@ ucnv_MBCSFromUnicodeWithOffsets(UConverterFromUnicodeArgs *pArgs,
 
     uint32_t stage2Entry;
     uint32_t asciiRoundtrips;
+    const int32_t *stateZero;
     uint32_t value;
     /* Shift-In and Shift-Out byte sequences differ by encoding scheme. */
     uint8_t siBytes[2] = {0, 0};
@@ -4143,6 +4334,7 @@ ucnv_MBCSFromUnicodeWithOffsets(UConverterFromUnicodeArgs *pArgs,
         bytes=cnv->sharedData->mbcs.fromUnicodeBytes;
     }
     asciiRoundtrips=cnv->sharedData->mbcs.asciiRoundtrips;
+    stateZero=cnv->sharedData->mbcs.stateTable[0];
 
     /* get the converter state from UConverter */
     c=cnv->fromUChar32;
@@ -4211,6 +4403,23 @@ ucnv_MBCSFromUnicodeWithOffsets(UConverterFromUnicodeArgs *pArgs,
                 }
                 --targetCapacity;
                 c=0;
+                /* convert a run of ASCII a word at a time */
+                while( targetCapacity>=4 && (sourceLimit-source)>=4 &&
+                       isAsciiRoundtrip4(source, asciiRoundtrips, stateZero)
+                ) {
+                    narrowAscii4(target, source);
+                    source+=4;
+                    target+=4;
+                    targetCapacity-=4;
+                    if(offsets!=NULL) {
+                        *offsets++=sourceIndex++;
+                        *offsets++=sourceIndex++;
+                        *offsets++=sourceIndex++;
+                        *offsets++=sourceIndex;
+                        prevSourceIndex=sourceIndex++;
+                        nextSourceIndex=sourceIndex;
+                    }
+                }
                 continue;
             }
             /*
@@ -5034,6 +5243,7 @@ ucnv_SBCSFromUTF8(UConverterFromUnicodeArgs *pFromUArgs,
     uint8_t b, t1, t2;
 
     uint32_t asciiRoundtrips;
+    const int32_t *stateZero;
     uint16_t value, minValue = 0;
     UBool hasSupplementary;
 
@@ -5053,6 +5263,7 @@ ucnv_SBCSFromUTF8(UConverterFromUnicodeArgs *pFromUArgs,
         results=(uint16_t *)cnv->sharedData->mbcs.fromUnicodeBytes;
     }
     asciiRoundtrips=cnv->sharedData->mbcs.asciiRoundtrips;
+    stateZero=cnv->sharedData->mbcs.stateTable[0];
 
     if(cnv->useFallback) {
         /* use all roundtrip and fallback results */
@@ -5132,6 +5343,15 @@ ucnv_SBCSFromUTF8(UConverterFromUnicodeArgs *pFromUArgs,
                 if(IS_ASCII_ROUNDTRIP(b, asciiRoundtrips)) {
                     *target++=(uint8_t)b;
                     --targetCapacity;
+                    /* copy a run of ASCII bytes unchanged */
+                    while( targetCapacity>=8 && (sourceLimit-source)>=8 &&
+                           isAsciiRoundtrip8(source, asciiRoundtrips, stateZero)
+                    ) {
+                        uprv_memcpy(target, source, 8);
+                        source+=8;
+                        target+=8;
+                        targetCapacity-=8;
+                    }
                     continue;
                 } else {
                     c=b;
@@ -5337,6 +5557,7 @@ ucnv_DBCSFromUTF8(UConverterFromUnicodeArgs *pFromUArgs,
 
     uint32_t stage2Entry;
     uint32_t asciiRoundtrips;
+    const int32_t *stateZero;
     uint16_t value = 0;
     UBool hasSupplementary;
 
@@ -5356,6 +5577,7 @@ ucnv_DBCSFromUTF8(UConverterFromUnicodeArgs *pFromUArgs,
         results=(uint16_t *)cnv->sharedData->mbcs.fromUnicodeBytes;
     }
     asciiRoundtrips=cnv->sharedData->mbcs.asciiRoundtrips;
+    stateZero=cnv->sharedData->mbcs.stateTable[0];
 
     hasSupplementary=(UBool)(cnv->sharedData->mbcs.unicodeMask&UCNV_HAS_SUPPLEMENTARY);
 
@@ -5410,6 +5632,15 @@ ucnv_DBCSFromUTF8(UConverterFromUnicodeArgs *pFromUArgs,
                 if(IS_ASCII_ROUNDTRIP(b, asciiRoundtrips)) {
                     *target++=b;
                     --targetCapacity;
+                    /* copy a run of ASCII bytes unchanged */
+                    while( targetCapacity>=8 && (sourceLimit-source)>=8 &&
+                           isAsciiRoundtrip8(source, asciiRoundtrips, stateZero)
+                    ) {
+                        uprv_memcpy(target, source, 8);
+                        source+=8;
+                        target+=8;
+                        targetCapacity-=8;
+                    }
                     continue;
                 } else {
                     value=DBCS_RESULT_FROM_UTF8(mbcsIndex, results, 0, b);
@@ -5622,6 +5853,145 @@ ucnv_DBCSFromUTF8(UConverterFromUnicodeArgs *pFromUArgs,
     pFromUArgs->target=(char *)target;
 }
 
+/* MBCS-to-UTF-8 conversion function ---------------------------------------- */
+
+/*
+ * Converts directly from an MBCS charset to UTF-8 without pivoting through UTF-16.
+ * Handles single bytes and two-byte sequences that start and end in the initial
+ * state and map to BMP code points.
+ * Returns with U_USING_DEFAULT_WARNING before any other byte sequence
+ * (unassigned, illegal, fallback, surrogate and extension mappings,
+ * longer sequences, state changes) so that ucnv_convertEx() handles it
+ * via the pivot buffer.
+ */
+static void U_CALLCONV
+ucnv_MBCSToUTF8(UConverterFromUnicodeArgs *pFromUArgs,
+                UConverterToUnicodeArgs *pToUArgs,
+                UErrorCode *pErrorCode) {
+    UConverter *cnv, *utf8;
+    const uint8_t *source, *sourceLimit;
+    uint8_t *target;
+    const uint8_t *targetLimit;
+
+    const int32_t (*stateTable)[256];
+    const uint16_t *unicodeCodeUnits;
+    uint32_t asciiRoundtrips;
+
+    int32_t entry, length;
+    uint32_t offset;
+    UChar c;
+    uint8_t bytes[3];
+
+    cnv=pToUArgs->converter;
+    utf8=pFromUArgs->converter;
+
+    if( cnv->toULength>0 || cnv->mode!=0 ||
+        cnv->sharedData->mbcs.dbcsOnlyState!=0 || utf8->fromUChar32!=0
+    ) {
+        /* continue a partial character or a non-initial state via the pivot */
+        *pErrorCode=U_USING_DEFAULT_WARNING;
+        return;
+    }
+
+    if((cnv->options&UCNV_OPTION_SWAP_LFNL)!=0) {
+        stateTable=(const int32_t (*)[256])cnv->sharedData->mbcs.swapLFNLStateTable;
+    } else {
+        stateTable=cnv->sharedData->mbcs.stateTable;
+    }
+    unicodeCodeUnits=cnv->sharedData->mbcs.unicodeCodeUnits;
+    asciiRoundtrips=cnv->sharedData->mbcs.asciiRoundtrips;
+
+    /* set up the local pointers */
+    source=(const uint8_t *)pToUArgs->source;
+    sourceLimit=(const uint8_t *)pToUArgs->sourceLimit;
+    target=(uint8_t *)pFromUArgs->target;
+    targetLimit=(const uint8_t *)pFromUArgs->targetLimit;
+
+    /* conversion loop */
+    while(source<sourceLimit) {
+        if(target>=targetLimit) {
+            /* target is full */
+            *pErrorCode=U_BUFFER_OVERFLOW_ERROR;
+            break;
+        }
+        entry=stateTable[0][*source];
+        if(MBCS_ENTRY_FINAL_IS_VALID_DIRECT_16(entry)) {
+            c=(UChar)MBCS_ENTRY_FINAL_VALUE_16(entry);
+            if(c<=0x7f) {
+                ++source;
+                *target++=(uint8_t)c;
+                /*
+                 * Copy a run of ASCII bytes unchanged.
+                 * Try this only at every 8th source position so that mixed text
+                 * does not pay for a failed word test after every ASCII byte.
+                 */
+                while( ((uintptr_t)source&7)==0 &&
+                       (targetLimit-target)>=8 && (sourceLimit-source)>=8 &&
+                       isAsciiRoundtrip8(source, asciiRoundtrips, stateTable[0])
+                ) {
+                    uprv_memcpy(target, source, 8);
+                    source+=8;
+                    target+=8;
+                }
+                continue;
+            }
+            length=1;
+        } else if(MBCS_ENTRY_IS_TRANSITION(entry) && (sourceLimit-source)>=2) {
+            offset=MBCS_ENTRY_TRANSITION_OFFSET(entry);
+            entry=stateTable[MBCS_ENTRY_TRANSITION_STATE(entry)][source[1]];
+            if( MBCS_ENTRY_IS_FINAL(entry) && MBCS_ENTRY_FINAL_STATE(entry)==0 &&
+                MBCS_ENTRY_FINAL_ACTION(entry)==MBCS_STATE_VALID_16 &&
+                (c=unicodeCodeUnits[offset+MBCS_ENTRY_FINAL_VALUE_16(entry)])<0xfffe
+            ) {
+                length=2;
+            } else {
+                *pErrorCode=U_USING_DEFAULT_WARNING;
+                break;
+            }
+        } else {
+            *pErrorCode=U_USING_DEFAULT_WARNING;
+            break;
+        }
+        if(U16_IS_SURROGATE(c)) {
+            *pErrorCode=U_USING_DEFAULT_WARNING;
+            break;
+        }
+        source+=length;
+
+        /* write the code point as UTF-8 */
+        if(c<=0x7f) {
+            *target++=(uint8_t)c;
+            continue;
+        } else if(c<=0x7ff) {
+            bytes[0]=(uint8_t)(0xc0|(c>>6));
+            bytes[1]=(uint8_t)(0x80|(c&0x3f));
+            length=2;
+        } else {
+            bytes[0]=(uint8_t)(0xe0|(c>>12));
+            bytes[1]=(uint8_t)(0x80|((c>>6)&0x3f));
+            bytes[2]=(uint8_t)(0x80|(c&0x3f));
+            length=3;
+        }
+        if((targetLimit-target)>=length) {
+            *target++=bytes[0];
+            *target++=bytes[1];
+            if(length==3) {
+                *target++=bytes[2];
+            }
+        } else {
+            /* the rest goes into the UTF-8 converter's overflow buffer */
+            ucnv_fromUWriteBytes(utf8, (const char *)bytes, length,
+                                 (char **)&target, (const char *)targetLimit,
+                                 NULL, -1, pErrorCode);
+            break;
+        }
+    }
+
+    /* write back the updated pointers */
+    pToUArgs->source=(const char *)source;
+    pFromUArgs->target=(char *)target;
+}
+
 /* miscellaneous ------------------------------------------------------------ */
 
 static void U_CALLCONV
@@ -391,6 +391,9 @@ typedef struct UConverterMBCSTable {
     /* roundtrips */
     uint32_t asciiRoundtrips;
 
+    /* option bits derived from the converter name, set at load time */
+    uint32_t nameOptions;
+
     /* reconstituted data that was omitted from the .cnv file */
     uint8_t *reconstitutedData;
 
@@ -424,6 +427,9 @@ typedef struct UConverterMBCSTable {
     0, \
      \
     /* roundtrips */ \
+    0, \
+     \
+    /* option bits derived from the converter name */ \
     0, \
      \
     /* reconstituted data that was omitted from the .cnv file */ \
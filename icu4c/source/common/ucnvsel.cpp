@@ -768,12 +768,18 @@ ucnvsel_selectForString(const UConverterSelector* sel,
       limit = NULL;
     }
     
+    // Intersecting with the same vector again does not change the mask,
+    // so runs of characters with the same pv index intersect only once.
+    uint32_t prevIndex = 0xffffffff;
     while (limit == NULL ? *s != 0 : s != limit) {
       UChar32 c;
       uint16_t pvIndex;
       UTRIE2_U16_NEXT16(sel->trie, s, limit, c, pvIndex);
-      if (intersectMasks(mask, sel->pv+pvIndex, columns)) {
-        break;
+      if (pvIndex != prevIndex) {
+        if (intersectMasks(mask, sel->pv+pvIndex, columns)) {
+          break;
+        }
+        prevIndex = pvIndex;
       }
     }
   }
@@ -809,11 +815,16 @@ ucnvsel_selectForUTF8(const UConverterSelector* sel,
   if(s!=NULL) {
     const char *limit = s + length;
     
+    // See ucnvsel_selectForString().
+    uint32_t prevIndex = 0xffffffff;
     while (s != limit) {
       uint16_t pvIndex;
       UTRIE2_U8_NEXT16(sel->trie, s, limit, pvIndex);
-      if (intersectMasks(mask, sel->pv+pvIndex, columns)) {
-        break;
+      if (pvIndex != prevIndex) {
+        if (intersectMasks(mask, sel->pv+pvIndex, columns)) {
+          break;
+        }
+        prevIndex = pvIndex;
       }
     }
   }
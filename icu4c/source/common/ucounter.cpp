@@ -0,0 +1,30 @@
+// © 2019 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+
+// ucounter.cpp
+
+#include "unicode/utypes.h"
+#include "unicode/ucounter.h"
+#include "ucounterimp.h"
+
+#if U_ENABLE_COUNTERS
+
+U_NAMESPACE_BEGIN
+
+thread_local int64_t gThreadCounters[UCOUNTER_LIMIT];
+
+U_NAMESPACE_END
+
+#endif  // U_ENABLE_COUNTERS
+
+U_CAPI int64_t U_EXPORT2
+ucounter_get(UCounterType type) {
+#if U_ENABLE_COUNTERS
+    if (0 <= type && type < UCOUNTER_LIMIT) {
+        return icu::gThreadCounters[type];
+    }
+#else
+    (void)type;
+#endif
+    return 0;
+}
@@ -0,0 +1,39 @@
+// © 2019 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+
+// ucounterimp.h
+
+#ifndef __UCOUNTERIMP_H__
+#define __UCOUNTERIMP_H__
+
+#include "unicode/utypes.h"
+#include "unicode/ucounter.h"
+
+#if U_ENABLE_COUNTERS
+
+U_NAMESPACE_BEGIN
+
+/** The calling thread's counters, indexed by UCounterType. @internal */
+extern thread_local int64_t gThreadCounters[UCOUNTER_LIMIT];
+
+U_NAMESPACE_END
+
+/**
+ * Adds n to the calling thread's counter of the given UCounterType.
+ * @internal
+ */
+#define UCOUNTER_ADD(type, n) (icu::gThreadCounters[type] += (int64_t)(n))
+
+#else
+
+#define UCOUNTER_ADD(type, n)
+
+#endif  // U_ENABLE_COUNTERS
+
+/**
+ * Increments the calling thread's counter of the given UCounterType.
+ * @internal
+ */
+#define UCOUNTER_INC(type) UCOUNTER_ADD(type, 1)
+
+#endif  // __UCOUNTERIMP_H__
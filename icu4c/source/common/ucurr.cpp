@@ -36,6 +36,10 @@
 #include "uresimp.h"
 #include "ureslocs.h"
 #include "ulocimp.h"
+#include "unicode/ucharstrie.h"
+#include "unicode/ucharstriebuilder.h"
+#include "sharedobject.h"
+#include "unifiedcache.h"
 
 using namespace icu;
 
@@ -483,21 +487,14 @@ ucurr_unregister(UCurrRegistryKey key, UErrorCode* status)
 /**
  * Release all static memory held by currency.
  */
-/*The declaration here is needed so currency_cleanup(void)
- * can call this function.
- */
-static UBool U_CALLCONV
-currency_cache_cleanup(void);
-
 U_CDECL_BEGIN
 static UBool U_CALLCONV currency_cleanup(void) {
 #if !UCONFIG_NO_SERVICE
     CReg::cleanup();
 #endif
     /*
-     * There might be some cached currency data or isoCodes data.
+     * There might be some cached isoCodes data.
      */
-    currency_cache_cleanup();
     isoCodes_cleanup();
     currSymbolsEquiv_cleanup();
 
@@ -953,11 +950,16 @@ collectCurrencyNames(const char* locale,
     *currencySymbols = (CurrencyNameStruct*)uprv_malloc
         (sizeof(CurrencyNameStruct) * (*total_currency_symbol_count));
 
-    if(currencyNames == NULL || currencySymbols == NULL) {
+    if(*currencyNames == NULL || *currencySymbols == NULL) {
       ec = U_MEMORY_ALLOCATION_ERROR;
     }
 
-    if (U_FAILURE(ec)) return;
+    if (U_FAILURE(ec)) {
+        // Nothing has been added to the arrays yet.
+        *total_currency_name_count = 0;
+        *total_currency_symbol_count = 0;
+        return;
+    }
 
     const UChar* s = NULL;  // currency name
     char* iso = NULL;  // currency ISO code
@@ -1115,368 +1117,142 @@ collectCurrencyNames(const char* locale,
     }
 }
 
-// @param  currencyNames: currency names array
-// @param  indexInCurrencyNames: the index of the character in currency names 
-//         array against which the comparison is done
-// @param  key: input text char to compare against
-// @param  begin(IN/OUT): the begin index of matching range in currency names array
-// @param  end(IN/OUT): the end index of matching range in currency names array.
-static int32_t
-binarySearch(const CurrencyNameStruct* currencyNames, 
-             int32_t indexInCurrencyNames,
-             const UChar key,
-             int32_t* begin, int32_t* end) {
-#ifdef UCURR_DEBUG
-    printf("key = %x\n", key);
-#endif
-   int32_t first = *begin;
-   int32_t last = *end;
-   while (first <= last) {
-       int32_t mid = (first + last) / 2;  // compute mid point.
-       if (indexInCurrencyNames >= currencyNames[mid].currencyNameLen) {
-           first = mid + 1;
-       } else {
-           if (key > currencyNames[mid].currencyName[indexInCurrencyNames]) {
-               first = mid + 1;
-           }
-           else if (key < currencyNames[mid].currencyName[indexInCurrencyNames]) {
-               last = mid - 1;
-           }
-           else {
-                // Find a match, and looking for ranges
-                // Now do two more binary searches. First, on the left side for
-                // the greatest L such that CurrencyNameStruct[L] < key.
-                int32_t L = *begin;
-                int32_t R = mid;
-
-#ifdef UCURR_DEBUG
-                printf("mid = %d\n", mid);
-#endif
-                while (L < R) {
-                    int32_t M = (L + R) / 2;
-#ifdef UCURR_DEBUG
-                    printf("L = %d, R = %d, M = %d\n", L, R, M);
-#endif
-                    if (indexInCurrencyNames >= currencyNames[M].currencyNameLen) {
-                        L = M + 1;
-                    } else {
-                        if (currencyNames[M].currencyName[indexInCurrencyNames] < key) {
-                            L = M + 1;
-                        } else {
-#ifdef UCURR_DEBUG
-                            U_ASSERT(currencyNames[M].currencyName[indexInCurrencyNames] == key);
-#endif
-                            R = M;
-                        }
-                    }
-                }
-#ifdef UCURR_DEBUG
-                U_ASSERT(L == R);
-#endif
-                *begin = L;
-#ifdef UCURR_DEBUG
-                printf("begin = %d\n", *begin);
-                U_ASSERT(currencyNames[*begin].currencyName[indexInCurrencyNames] == key);
-#endif
+//========================= currency name cache =====================
 
-                // Now for the second search, finding the least R such that
-                // key < CurrencyNameStruct[R].
-                L = mid;
-                R = *end;
-                while (L < R) {
-                    int32_t M = (L + R) / 2;
-#ifdef UCURR_DEBUG
-                    printf("L = %d, R = %d, M = %d\n", L, R, M);
-#endif
-                    if (currencyNames[M].currencyNameLen < indexInCurrencyNames) {
-                        L = M + 1;
-                    } else {
-                        if (currencyNames[M].currencyName[indexInCurrencyNames] > key) {
-                            R = M;
-                        } else {
-#ifdef UCURR_DEBUG
-                            U_ASSERT(currencyNames[M].currencyName[indexInCurrencyNames] == key);
-#endif
-                            L = M + 1;
-                        }
-                    }
-                }
-#ifdef UCURR_DEBUG
-                U_ASSERT(L == R);
-#endif
-                if (currencyNames[R].currencyName[indexInCurrencyNames] > key) {
-                    *end = R - 1;
-                } else {
-                    *end = R;
-                }
-#ifdef UCURR_DEBUG
-                printf("end = %d\n", *end);
-#endif
+// The currency names and symbols of one locale, shared through the UnifiedCache.
+// Each array is sorted and indexed by a UCharsTrie that maps every name to its
+// position in the array, for longest-match lookup.
+struct CurrencyNameCacheEntry : public SharedObject {
+    // currency names, case insensitive
+    CurrencyNameStruct* currencyNames;
+    int32_t totalCurrencyNameCount;
+    // currency symbols and ISO code, case sensitive
+    CurrencyNameStruct* currencySymbols;
+    int32_t totalCurrencySymbolCount;
+    UnicodeString currencyNamesTrie;
+    UnicodeString currencySymbolsTrie;
+
+    CurrencyNameCacheEntry()
+            : currencyNames(NULL), totalCurrencyNameCount(0),
+              currencySymbols(NULL), totalCurrencySymbolCount(0) {}
+    virtual ~CurrencyNameCacheEntry();
+};
 
-                // now, found the range. check whether there is exact match
-                if (currencyNames[*begin].currencyNameLen == indexInCurrencyNames + 1) {
-                    return *begin;  // find range and exact match.
-                }
-                return -1;  // find range, but no exact match.
-           }
-       }
-   }
-   *begin = -1;
-   *end = -1;
-   return -1;    // failed to find range.
+// Cache deletion
+static void
+deleteCurrencyNames(CurrencyNameStruct* currencyNames, int32_t count) {
+    if (currencyNames == NULL) {
+        return;
+    }
+    for (int32_t index = 0; index < count; ++index) {
+        if ( (currencyNames[index].flag & NEED_TO_BE_DELETED) ) {
+            uprv_free(currencyNames[index].currencyName);
+        }
+    }
+    uprv_free(currencyNames);
 }
 
+CurrencyNameCacheEntry::~CurrencyNameCacheEntry() {
+    deleteCurrencyNames(currencyNames, totalCurrencyNameCount);
+    deleteCurrencyNames(currencySymbols, totalCurrencySymbolCount);
+}
 
-// Linear search "text" in "currencyNames".
-// @param  begin, end: the begin and end index in currencyNames, within which
-//         range should the search be performed.
-// @param  textLen: the length of the text to be compared
-// @param  maxMatchLen(IN/OUT): passing in the computed max matching length
-//                              pass out the new max  matching length
-// @param  maxMatchIndex: the index in currencyName which has the longest
-//                        match with input text.
+// Builds a trie over the sorted currency names. Of several equal names,
+// the trie maps to the first one.
 static void
-linearSearch(const CurrencyNameStruct* currencyNames, 
-             int32_t begin, int32_t end,
-             const UChar* text, int32_t textLen,
-             int32_t *partialMatchLen,
-             int32_t *maxMatchLen, int32_t* maxMatchIndex) {
-    int32_t initialPartialMatchLen = *partialMatchLen;
-    for (int32_t index = begin; index <= end; ++index) {
-        int32_t len = currencyNames[index].currencyNameLen;
-        if (len > *maxMatchLen && len <= textLen &&
-            uprv_memcmp(currencyNames[index].currencyName, text, len * sizeof(UChar)) == 0) {
-            *partialMatchLen = MAX(*partialMatchLen, len);
-            *maxMatchIndex = index;
-            *maxMatchLen = len;
-#ifdef UCURR_DEBUG
-            printf("maxMatchIndex = %d, maxMatchLen = %d\n",
-                   *maxMatchIndex, *maxMatchLen);
-#endif
-        } else {
-            // Check for partial matches.
-            for (int32_t i=initialPartialMatchLen; i<MIN(len, textLen); i++) {
-                if (currencyNames[index].currencyName[i] != text[i]) {
-                    break;
-                }
-                *partialMatchLen = MAX(*partialMatchLen, i + 1);
-            }
-        }
+buildCurrencyNameTrie(const CurrencyNameStruct* currencyNames, int32_t count,
+                      UnicodeString& trie, UErrorCode& ec) {
+    if (U_FAILURE(ec) || count == 0) {
+        return;
     }
+    UCharsTrieBuilder builder(ec);
+    for (int32_t index = 0; index < count && U_SUCCESS(ec); ++index) {
+        if (index > 0 && currencyNameComparator(&currencyNames[index - 1], &currencyNames[index]) == 0) {
+            continue;
+        }
+        if (currencyNames[index].currencyNameLen == 0) {
+            continue;
+        }
+        builder.add(UnicodeString(FALSE, currencyNames[index].currencyName,
+                                  currencyNames[index].currencyNameLen),
+                    index, ec);
+    }
+    // The serialized trie aliases the builder's buffer; copy it.
+    UnicodeString serialized;
+    builder.buildUnicodeString(USTRINGTRIE_BUILD_FAST, serialized, ec);
+    trie = serialized;
 }
 
-#define LINEAR_SEARCH_THRESHOLD 10
-
-// Find longest match between "text" and currency names in "currencyNames".
-// @param  total_currency_count: total number of currency names in CurrencyNames.
+// Find longest match between "text" and the currency names indexed by "trie".
 // @param  textLen: the length of the text to be compared
-// @param  maxMatchLen: passing in the computed max matching length
-//                              pass out the new max  matching length
-// @param  maxMatchIndex: the index in currencyName which has the longest
-//                        match with input text.
+// @param  partialMatchLen(IN/OUT): the longest prefix of text that is a prefix
+//                                  of some currency name
+// @param  maxMatchLen: the length of the longest currency name matching text
+// @param  maxMatchIndex: the index in the currency names array of that name
 static void
-searchCurrencyName(const CurrencyNameStruct* currencyNames, 
-                   int32_t total_currency_count,
+searchCurrencyName(const UnicodeString& trie,
                    const UChar* text, int32_t textLen,
                    int32_t *partialMatchLen,
                    int32_t* maxMatchLen, int32_t* maxMatchIndex) {
     *maxMatchIndex = -1;
     *maxMatchLen = 0;
-    int32_t matchIndex = -1;
-    int32_t binarySearchBegin = 0;
-    int32_t binarySearchEnd = total_currency_count - 1;
-    // It is a variant of binary search.
-    // For example, given the currency names in currencyNames array are:
-    // A AB ABC AD AZ B BB BBEX BBEXYZ BS C D E....
-    // and the input text is BBEXST
-    // The first round binary search search "B" in the text against
-    // the first char in currency names, and find the first char matching range
-    // to be "B BB BBEX BBEXYZ BS" (and the maximum matching "B").
-    // The 2nd round binary search search the second "B" in the text against
-    // the 2nd char in currency names, and narrow the matching range to
-    // "BB BBEX BBEXYZ" (and the maximum matching "BB").
-    // The 3rd round returnes the range as "BBEX BBEXYZ" (without changing
-    // maximum matching).
-    // The 4th round returns the same range (the maximum matching is "BBEX").
-    // The 5th round returns no matching range.
+    if (trie.isEmpty()) {
+        return;
+    }
+    UCharsTrie iter(trie.getBuffer());
     for (int32_t index = 0; index < textLen; ++index) {
-        // matchIndex saves the one with exact match till the current point.
-        // [binarySearchBegin, binarySearchEnd] saves the matching range.
-        matchIndex = binarySearch(currencyNames, index,
-                                  text[index],
-                                  &binarySearchBegin, &binarySearchEnd);
-        if (binarySearchBegin == -1) { // did not find the range
+        UStringTrieResult result = iter.next(text[index]);
+        if (result == USTRINGTRIE_NO_MATCH) {
             break;
         }
         *partialMatchLen = MAX(*partialMatchLen, index + 1);
-        if (matchIndex != -1) { 
-            // find an exact match for text from text[0] to text[index] 
-            // in currencyNames array.
+        if (USTRINGTRIE_HAS_VALUE(result)) {
             *maxMatchLen = index + 1;
-            *maxMatchIndex = matchIndex;
+            *maxMatchIndex = iter.getValue();
         }
-        if (binarySearchEnd - binarySearchBegin < LINEAR_SEARCH_THRESHOLD) {
-            // linear search if within threshold.
-            linearSearch(currencyNames, binarySearchBegin, binarySearchEnd,
-                         text, textLen,
-                         partialMatchLen,
-                         maxMatchLen, maxMatchIndex);
+        if (result == USTRINGTRIE_FINAL_VALUE) {
             break;
         }
     }
-    return;
 }
 
-//========================= currency name cache =====================
-typedef struct {
-    char locale[ULOC_FULLNAME_CAPACITY];  //key
-    // currency names, case insensitive
-    CurrencyNameStruct* currencyNames;  // value
-    int32_t totalCurrencyNameCount;  // currency name count
-    // currency symbols and ISO code, case sensitive
-    CurrencyNameStruct* currencySymbols; // value
-    int32_t totalCurrencySymbolCount;  // count
-    // reference count.
-    // reference count is set to 1 when an entry is put to cache.
-    // it increases by 1 before accessing, and decreased by 1 after accessing.
-    // The entry is deleted when ref count is zero, which means 
-    // the entry is replaced out of cache and no process is accessing it.
-    int32_t refCount;
-} CurrencyNameCacheEntry;
-
-
-#define CURRENCY_NAME_CACHE_NUM 10
-
-// Reserve 10 cache entries.
-static CurrencyNameCacheEntry* currCache[CURRENCY_NAME_CACHE_NUM] = {NULL};
-// Using an index to indicate which entry to be replaced when cache is full.
-// It is a simple round-robin replacement strategy.
-static int8_t currentCacheEntryIndex = 0;
-
-static UMutex gCurrencyCacheMutex;
+U_NAMESPACE_BEGIN
 
-// Cache deletion
-static void
-deleteCurrencyNames(CurrencyNameStruct* currencyNames, int32_t count) {
-    for (int32_t index = 0; index < count; ++index) {
-        if ( (currencyNames[index].flag & NEED_TO_BE_DELETED) ) {
-            uprv_free(currencyNames[index].currencyName);
-        }
+template<> U_COMMON_API
+const CurrencyNameCacheEntry *LocaleCacheKey<CurrencyNameCacheEntry>::createObject(
+        const void * /*unused*/, UErrorCode &status) const {
+    LocalPointer<CurrencyNameCacheEntry> result(new CurrencyNameCacheEntry(), status);
+    if (U_FAILURE(status)) {
+        return NULL;
     }
-    uprv_free(currencyNames);
-}
-
-
-static void
-deleteCacheEntry(CurrencyNameCacheEntry* entry) {
-    deleteCurrencyNames(entry->currencyNames, entry->totalCurrencyNameCount);
-    deleteCurrencyNames(entry->currencySymbols, entry->totalCurrencySymbolCount);
-    uprv_free(entry);
-}
-
-
-// Cache clean up
-static UBool U_CALLCONV
-currency_cache_cleanup(void) {
-    for (int32_t i = 0; i < CURRENCY_NAME_CACHE_NUM; ++i) {
-        if (currCache[i]) {
-            deleteCacheEntry(currCache[i]);
-            currCache[i] = 0;
-        }
+    collectCurrencyNames(fLoc.getName(),
+                         &result->currencyNames, &result->totalCurrencyNameCount,
+                         &result->currencySymbols, &result->totalCurrencySymbolCount,
+                         status);
+    buildCurrencyNameTrie(result->currencyNames, result->totalCurrencyNameCount,
+                          result->currencyNamesTrie, status);
+    buildCurrencyNameTrie(result->currencySymbols, result->totalCurrencySymbolCount,
+                          result->currencySymbolsTrie, status);
+    if (U_FAILURE(status)) {
+        return NULL;
     }
-    return TRUE;
+    result->addRef();
+    return result.orphan();
 }
 
+U_NAMESPACE_END
 
 /**
  * Loads the currency name data from the cache, or from resource bundles if necessary.
- * The refCount is automatically incremented.  It is the caller's responsibility
- * to decrement it when done!
+ * It is the caller's responsibility to call removeRef() when done!
  */
-static CurrencyNameCacheEntry*
+static const CurrencyNameCacheEntry*
 getCacheEntry(const char* locale, UErrorCode& ec) {
-
-    int32_t total_currency_name_count = 0;
-    CurrencyNameStruct* currencyNames = NULL;
-    int32_t total_currency_symbol_count = 0;
-    CurrencyNameStruct* currencySymbols = NULL;
-    CurrencyNameCacheEntry* cacheEntry = NULL;
-
-    umtx_lock(&gCurrencyCacheMutex);
-    // in order to handle racing correctly,
-    // not putting 'search' in a separate function.
-    int8_t found = -1;
-    for (int8_t i = 0; i < CURRENCY_NAME_CACHE_NUM; ++i) {
-        if (currCache[i]!= NULL &&
-            uprv_strcmp(locale, currCache[i]->locale) == 0) {
-            found = i;
-            break;
-        }
-    }
-    if (found != -1) {
-        cacheEntry = currCache[found];
-        ++(cacheEntry->refCount);
-    }
-    umtx_unlock(&gCurrencyCacheMutex);
-    if (found == -1) {
-        collectCurrencyNames(locale, &currencyNames, &total_currency_name_count, &currencySymbols, &total_currency_symbol_count, ec);
-        if (U_FAILURE(ec)) {
-            return NULL;
-        }
-        umtx_lock(&gCurrencyCacheMutex);
-        // check again.
-        for (int8_t i = 0; i < CURRENCY_NAME_CACHE_NUM; ++i) {
-            if (currCache[i]!= NULL &&
-                uprv_strcmp(locale, currCache[i]->locale) == 0) {
-                found = i;
-                break;
-            }
-        }
-        if (found == -1) {
-            // insert new entry to 
-            // currentCacheEntryIndex % CURRENCY_NAME_CACHE_NUM
-            // and remove the existing entry 
-            // currentCacheEntryIndex % CURRENCY_NAME_CACHE_NUM
-            // from cache.
-            cacheEntry = currCache[currentCacheEntryIndex];
-            if (cacheEntry) {
-                --(cacheEntry->refCount);
-                // delete if the ref count is zero
-                if (cacheEntry->refCount == 0) {
-                    deleteCacheEntry(cacheEntry);
-                }
-            }
-            cacheEntry = (CurrencyNameCacheEntry*)uprv_malloc(sizeof(CurrencyNameCacheEntry));
-            currCache[currentCacheEntryIndex] = cacheEntry;
-            uprv_strcpy(cacheEntry->locale, locale);
-            cacheEntry->currencyNames = currencyNames;
-            cacheEntry->totalCurrencyNameCount = total_currency_name_count;
-            cacheEntry->currencySymbols = currencySymbols;
-            cacheEntry->totalCurrencySymbolCount = total_currency_symbol_count;
-            cacheEntry->refCount = 2; // one for cache, one for reference
-            currentCacheEntryIndex = (currentCacheEntryIndex + 1) % CURRENCY_NAME_CACHE_NUM;
-            ucln_common_registerCleanup(UCLN_COMMON_CURRENCY, currency_cleanup);
-        } else {
-            deleteCurrencyNames(currencyNames, total_currency_name_count);
-            deleteCurrencyNames(currencySymbols, total_currency_symbol_count);
-            cacheEntry = currCache[found];
-            ++(cacheEntry->refCount);
-        }
-        umtx_unlock(&gCurrencyCacheMutex);
-    }
-
+    const CurrencyNameCacheEntry* cacheEntry = NULL;
+    UnifiedCache::getByLocale(Locale(locale), cacheEntry, ec);
     return cacheEntry;
 }
 
-static void releaseCacheEntry(CurrencyNameCacheEntry* cacheEntry) {
-    umtx_lock(&gCurrencyCacheMutex);
-    --(cacheEntry->refCount);
-    if (cacheEntry->refCount == 0) {  // remove
-        deleteCacheEntry(cacheEntry);
-    }
-    umtx_unlock(&gCurrencyCacheMutex);
-}
-
 U_CAPI void
 uprv_parseCurrency(const char* locale,
                    const icu::UnicodeString& text,
@@ -1489,15 +1265,13 @@ uprv_parseCurrency(const char* locale,
     if (U_FAILURE(ec)) {
         return;
     }
-    CurrencyNameCacheEntry* cacheEntry = getCacheEntry(locale, ec);
+    const CurrencyNameCacheEntry* cacheEntry = getCacheEntry(locale, ec);
     if (U_FAILURE(ec)) {
         return;
     }
 
-    int32_t total_currency_name_count = cacheEntry->totalCurrencyNameCount;
-    CurrencyNameStruct* currencyNames = cacheEntry->currencyNames;
-    int32_t total_currency_symbol_count = cacheEntry->totalCurrencySymbolCount;
-    CurrencyNameStruct* currencySymbols = cacheEntry->currencySymbols;
+    const CurrencyNameStruct* currencyNames = cacheEntry->currencyNames;
+    const CurrencyNameStruct* currencySymbols = cacheEntry->currencySymbols;
 
     int32_t start = pos.getIndex();
 
@@ -1514,7 +1288,7 @@ uprv_parseCurrency(const char* locale,
     int32_t max = 0;
     int32_t matchIndex = -1;
     // case in-sensitive comparision against currency names
-    searchCurrencyName(currencyNames, total_currency_name_count, 
+    searchCurrencyName(cacheEntry->currencyNamesTrie,
                        upperText, textLen, partialMatchLen, &max, &matchIndex);
 
 #ifdef UCURR_DEBUG
@@ -1525,7 +1299,7 @@ uprv_parseCurrency(const char* locale,
     int32_t matchIndexInSymbol = -1;
     if (type != UCURR_LONG_NAME) {  // not name only
         // case sensitive comparison against currency symbols and ISO code.
-        searchCurrencyName(currencySymbols, total_currency_symbol_count, 
+        searchCurrencyName(cacheEntry->currencySymbolsTrie,
                            inputText, textLen,
                            partialMatchLen,
                            &maxInSymbol, &matchIndexInSymbol);
@@ -1546,8 +1320,7 @@ uprv_parseCurrency(const char* locale,
         pos.setIndex(start + maxInSymbol);
     }
 
-    // decrease reference count
-    releaseCacheEntry(cacheEntry);
+    cacheEntry->removeRef();
 }
 
 void uprv_currencyLeads(const char* locale, icu::UnicodeSet& result, UErrorCode& ec) {
@@ -1555,7 +1328,7 @@ void uprv_currencyLeads(const char* locale, icu::UnicodeSet& result, UErrorCode&
     if (U_FAILURE(ec)) {
         return;
     }
-    CurrencyNameCacheEntry* cacheEntry = getCacheEntry(locale, ec);
+    const CurrencyNameCacheEntry* cacheEntry = getCacheEntry(locale, ec);
     if (U_FAILURE(ec)) {
         return;
     }
@@ -1574,8 +1347,7 @@ void uprv_currencyLeads(const char* locale, icu::UnicodeSet& result, UErrorCode&
         result.add(cp);
     }
 
-    // decrease reference count
-    releaseCacheEntry(cacheEntry);
+    cacheEntry->removeRef();
 }
 
 
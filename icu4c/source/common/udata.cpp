@@ -37,10 +37,14 @@ might have to #include some other header
 #include "uassert.h"
 #include "ucln_cmn.h"
 #include "ucmndata.h"
+#include "ucounterimp.h"
+#include "udatacmp.h"
 #include "udatamem.h"
+#include "uenumimp.h"
 #include "uhash.h"
 #include "umapfile.h"
 #include "umutex.h"
+#include "ustr_imp.h"
 
 /***********************************************************************
 *
@@ -104,12 +108,58 @@ static UDataMemory *udata_findCachedData(const char *path, UErrorCode &err);
  * that they really need, reducing the size of binaries that take advantage
  * of this.
  */
-static UDataMemory *gCommonICUDataArray[10] = { NULL };   // Access protected by icu global mutex.
+// Entries are only added, under udataMutex, until cleanup, so that they are read without locking.
+static std::atomic<UDataMemory *> gCommonICUDataArray[10];
 
 static u_atomic_int32_t gHaveTriedToLoadCommonData = ATOMIC_INT32_T_INITIALIZER(0);  //  See extendICUData().
 
-static UHashtable  *gCommonDataCache = NULL;  /* Global hash table of opened ICU data files.  */
+/*
+ * Serializes changes to gCommonICUDataArray and gCommonDataCache,
+ * and accesses to the loaded-items data below.
+ * The udata code does not use the global ICU mutex, which many other ICU services share.
+ */
+static UMutex udataMutex;
+
+struct DataCacheElement;
+#define DATA_CACHE_SIZE 64
+/* Global hash table of opened ICU data files; see udata_findCachedData().  */
+static std::atomic<DataCacheElement *> gCommonDataCache[DATA_CACHE_SIZE];
 static icu::UInitOnce gCommonDataCacheInitOnce = U_INITONCE_INITIALIZER;
+static void udata_deleteCache();
+
+/*
+ * The names of the common data items opened so far, for udata_openLoadedItems().
+ * gLoadedItemNames has the NUL-terminated names in the order in which they were first opened,
+ * and gLoadedItemNameSet is the set of them.  Opening an item again is checked
+ * in gLoadedItems, the set of the items' header addresses, which are cheaper to hash;
+ * the same item can have several addresses in copies of the data.
+ * Access protected by udataMutex.
+ */
+static UHashtable  *gLoadedItems = NULL;
+static UHashtable  *gLoadedItemNameSet = NULL;
+static CharString  *gLoadedItemNames = NULL;
+
+/*
+ * The uncompressed copies of compressed common data items,
+ * keyed by the header addresses of the compressed items.
+ * Access protected by udataMutex.
+ */
+static UHashtable  *gUncompressedItems = NULL;
+
+/*
+ * The data overlays published with udata_publishOverlay(), newest first.
+ * Overlays are prepended with udataMutex locked, and they stay until
+ * udata_cleanup(), so that they are looked up without locking.
+ * The epoch of an overlay is the value of gDataEpoch after it was published;
+ * gDataEpoch is stored after the list so that readers of an epoch see its overlay.
+ */
+struct DataOverlay : public UMemory {
+    UDataMemory data;
+    int32_t epoch;
+    DataOverlay *next;
+};
+static std::atomic<DataOverlay *> gDataOverlays(NULL);
+static std::atomic<int32_t> gDataEpoch(0);
 
 #if U_PLATFORM_HAS_WINUWP_API == 0 
 static UDataFileAccess  gDataFileAccess = UDATA_DEFAULT_ACCESS;  // Access not synchronized.
@@ -123,17 +173,33 @@ udata_cleanup(void)
 {
     int32_t i;
 
-    if (gCommonDataCache) {             /* Delete the cache of user data mappings.  */
-        uhash_close(gCommonDataCache);  /*   Table owns the contents, and will delete them. */
-        gCommonDataCache = NULL;        /*   Cleanup is not thread safe.                */
+    udata_deleteCache();                /* Delete the cache of user data mappings.  */
+    gCommonDataCacheInitOnce.reset();   /*   Cleanup is not thread safe.            */
+
+    uhash_close(gLoadedItems);
+    gLoadedItems = NULL;
+    uhash_close(gLoadedItemNameSet);
+    gLoadedItemNameSet = NULL;
+    delete gLoadedItemNames;
+    gLoadedItemNames = NULL;
+    uhash_close(gUncompressedItems);
+    gUncompressedItems = NULL;
+
+    /* The epoch is not reset, so that cached objects of older epochs stay stale. */
+    DataOverlay *overlay = gDataOverlays.load(std::memory_order_relaxed);
+    while (overlay != NULL) {
+        DataOverlay *next = overlay->next;
+        delete overlay;
+        overlay = next;
     }
-    gCommonDataCacheInitOnce.reset();
+    gDataOverlays.store(NULL, std::memory_order_relaxed);
 
     for (i = 0; i < UPRV_LENGTHOF(gCommonICUDataArray) && gCommonICUDataArray[i] != NULL; ++i) {
         udata_close(gCommonICUDataArray[i]);
-        gCommonICUDataArray[i] = NULL;
+        gCommonICUDataArray[i].store(NULL, std::memory_order_relaxed);
     }
     gHaveTriedToLoadCommonData = 0;
+    udata_cleanupTOCIndexes();
 
     return TRUE;                   /* Everything was cleaned up */
 }
@@ -148,14 +214,15 @@ findCommonICUDataByName(const char *inBasename, UErrorCode &err)
     if (U_FAILURE(err) || pData == NULL)
         return FALSE;
 
-    {
-        Mutex lock;
-        for (i = 0; i < UPRV_LENGTHOF(gCommonICUDataArray); ++i) {
-            if ((gCommonICUDataArray[i] != NULL) && (gCommonICUDataArray[i]->pHeader == pData->pHeader)) {
-                /* The data pointer is already in the array. */
-                found = TRUE;
-                break;
-            }
+    for (i = 0; i < UPRV_LENGTHOF(gCommonICUDataArray); ++i) {
+        UDataMemory *pCommonData = gCommonICUDataArray[i].load(std::memory_order_acquire);
+        if (pCommonData == NULL) {
+            break;
+        }
+        if (pCommonData->pHeader == pData->pHeader) {
+            /* The data pointer is already in the array. */
+            found = TRUE;
+            break;
         }
     }
     return found;
@@ -183,18 +250,19 @@ setCommonICUData(UDataMemory *pData,     /*  The new common data.  Belongs to ca
     /*    deleted - someone may still have a pointer to it lying around in           */
     /*    their locals.                                                              */
     UDatamemory_assign(newCommonData, pData);
-    umtx_lock(NULL);
+    umtx_lock(&udataMutex);
     for (i = 0; i < UPRV_LENGTHOF(gCommonICUDataArray); ++i) {
-        if (gCommonICUDataArray[i] == NULL) {
-            gCommonICUDataArray[i] = newCommonData;
+        UDataMemory *pCommonData = gCommonICUDataArray[i].load(std::memory_order_relaxed);
+        if (pCommonData == NULL) {
+            gCommonICUDataArray[i].store(newCommonData, std::memory_order_release);
             didUpdate = TRUE;
             break;
-        } else if (gCommonICUDataArray[i]->pHeader == pData->pHeader) {
+        } else if (pCommonData->pHeader == pData->pHeader) {
             /* The same data pointer is already in the array. */
             break;
         }
     }
-    umtx_unlock(NULL);
+    umtx_unlock(&udataMutex);
 
     if (i == UPRV_LENGTHOF(gCommonICUDataArray) && warn) {
         *pErr = U_USING_DEFAULT_WARNING;
@@ -260,63 +328,66 @@ packageNameFromPath(const char *path)
  *                                                                      *
  *----------------------------------------------------------------------*/
 
-typedef struct DataCacheElement {
-    char          *name;
-    UDataMemory   *item;
-} DataCacheElement;
+/*
+ * The cache is a hash table with a fixed number of buckets, and with chains of elements
+ * that only grow until cleanup.  Each new element is fully set up before it is
+ * published at the head of its chain, so lookups read the table without locking.
+ * Additions are serialized by udataMutex.
+ */
+struct DataCacheElement {
+    char             *name;
+    UDataMemory      *item;
+    int32_t           hash;
+    DataCacheElement *next;
+};
 
 
 
 /*
- * Deleter function for DataCacheElements.
- *         udata cleanup function closes the hash table; hash table in turn calls back to
- *         here for each entry.
+ * Deletes all of the DataCacheElements.
+ *         Called by the udata cleanup function; not thread safe.
  */
-static void U_CALLCONV DataCacheElement_deleter(void *pDCEl) {
-    DataCacheElement *p = (DataCacheElement *)pDCEl;
-    udata_close(p->item);              /* unmaps storage */
-    uprv_free(p->name);                /* delete the hash key string. */
-    uprv_free(pDCEl);                  /* delete 'this'          */
+static void udata_deleteCache() {
+    for (int32_t i = 0; i < DATA_CACHE_SIZE; ++i) {
+        DataCacheElement *p = gCommonDataCache[i].load(std::memory_order_relaxed);
+        gCommonDataCache[i].store(NULL, std::memory_order_relaxed);
+        while (p != NULL) {
+            DataCacheElement *next = p->next;
+            udata_close(p->item);              /* unmaps storage */
+            uprv_free(p->name);                /* delete the hash key string. */
+            uprv_free(p);                      /* delete 'this'          */
+            p = next;
+        }
+    }
 }
 
-static void U_CALLCONV udata_initHashTable(UErrorCode &err) {
-    U_ASSERT(gCommonDataCache == NULL);
-    gCommonDataCache = uhash_open(uhash_hashChars, uhash_compareChars, NULL, &err);
-    if (U_FAILURE(err)) {
-       return;
-    }
-    U_ASSERT(gCommonDataCache != NULL);
-    uhash_setValueDeleter(gCommonDataCache, DataCacheElement_deleter);
+static void U_CALLCONV udata_initCache() {
     ucln_common_registerCleanup(UCLN_COMMON_UDATA, udata_cleanup);
 }
 
- /*   udata_getCacheHashTable()
-  *     Get the hash table used to store the data cache entries.
-  *     Lazy create it if it doesn't yet exist.
-  */
-static UHashtable *udata_getHashTable(UErrorCode &err) {
-    umtx_initOnce(gCommonDataCacheInitOnce, &udata_initHashTable, err);
-    return gCommonDataCache;
+static DataCacheElement *udata_findCacheElement(const char *baseName, int32_t hash) {
+    DataCacheElement *el =
+        gCommonDataCache[(uint32_t)hash % DATA_CACHE_SIZE].load(std::memory_order_acquire);
+    while (el != NULL && (el->hash != hash || uprv_strcmp(el->name, baseName) != 0)) {
+        el = el->next;
+    }
+    return el;
 }
 
 
 
 static UDataMemory *udata_findCachedData(const char *path, UErrorCode &err)
 {
-    UHashtable        *htable;
     UDataMemory       *retVal = NULL;
     DataCacheElement  *el;
     const char        *baseName;
 
-    htable = udata_getHashTable(err);
     if (U_FAILURE(err)) {
         return NULL;
     }
 
     baseName = findBasename(path);   /* Cache remembers only the base name, not the full path. */
-    umtx_lock(NULL);
-    el = (DataCacheElement *)uhash_get(htable, baseName);
-    umtx_unlock(NULL);
+    el = udata_findCacheElement(baseName, ustr_hashCharsN(baseName, (int32_t)uprv_strlen(baseName)));
     if (el != NULL) {
         retVal = el->item;
     }
@@ -331,14 +402,12 @@ static UDataMemory *udata_cacheDataItem(const char *path, UDataMemory *item, UEr
     DataCacheElement *newElement;
     const char       *baseName;
     int32_t           nameLen;
-    UHashtable       *htable;
     DataCacheElement *oldValue = NULL;
-    UErrorCode        subErr = U_ZERO_ERROR;
 
-    htable = udata_getHashTable(*pErr);
     if (U_FAILURE(*pErr)) {
         return NULL;
     }
+    umtx_initOnce(gCommonDataCacheInitOnce, &udata_initCache);
 
     /* Create a new DataCacheElement - the thingy we store in the hash table -
      * and copy the supplied path and UDataMemoryItems into it.
@@ -365,34 +434,32 @@ static UDataMemory *udata_cacheDataItem(const char *path, UDataMemory *item, UEr
         return NULL;
     }
     uprv_strcpy(newElement->name, baseName);
+    newElement->hash = ustr_hashCharsN(baseName, nameLen);
 
     /* Stick the new DataCacheElement into the hash table.
     */
-    umtx_lock(NULL);
-    oldValue = (DataCacheElement *)uhash_get(htable, path);
-    if (oldValue != NULL) {
-        subErr = U_USING_DEFAULT_WARNING;
-    }
-    else {
-        uhash_put(
-            htable,
-            newElement->name,               /* Key   */
-            newElement,                     /* Value */
-            &subErr);
+    umtx_lock(&udataMutex);
+    oldValue = udata_findCacheElement(baseName, newElement->hash);
+    if (oldValue == NULL) {
+        std::atomic<DataCacheElement *> &head =
+            gCommonDataCache[(uint32_t)newElement->hash % DATA_CACHE_SIZE];
+        newElement->next = head.load(std::memory_order_relaxed);
+        head.store(newElement, std::memory_order_release);
     }
-    umtx_unlock(NULL);
+    umtx_unlock(&udataMutex);
 
 #ifdef UDATA_DEBUG
     fprintf(stderr, "Cache: [%s] <<< %p : %s. vFunc=%p\n", newElement->name, 
-    (void*) newElement->item, u_errorName(subErr), (void*) newElement->item->vFuncs);
+    (void*) newElement->item, oldValue != NULL ? "U_USING_DEFAULT_WARNING" : "U_ZERO_ERROR",
+    (void*) newElement->item->vFuncs);
 #endif
 
-    if (subErr == U_USING_DEFAULT_WARNING || U_FAILURE(subErr)) {
-        *pErr = subErr; /* copy sub err unto fillin ONLY if something happens. */
+    if (oldValue != NULL) {
+        *pErr = U_USING_DEFAULT_WARNING; /* copy sub err unto fillin ONLY if something happens. */
         uprv_free(newElement->name);
         uprv_free(newElement->item);
         uprv_free(newElement);
-        return oldValue ? oldValue->item : NULL;
+        return oldValue->item;
     }
 
     return newElement->item;
@@ -686,14 +753,14 @@ openCommonData(const char *path,          /*  Path from OpenChoice?          */
             return NULL;
         }
         {
-            Mutex lock;
-            if(gCommonICUDataArray[commonDataIndex] != NULL) {
-                return gCommonICUDataArray[commonDataIndex];
+            UDataMemory *pCommonData = gCommonICUDataArray[commonDataIndex].load(std::memory_order_acquire);
+            if(pCommonData != NULL) {
+                return pCommonData;
             }
 #if U_PLATFORM_HAS_WINUWP_API == 0 // Windows UWP Platform does not support dll icu data at this time
             int32_t i;
             for(i = 0; i < commonDataIndex; ++i) {
-                if(gCommonICUDataArray[i]->pHeader == &U_ICUDATA_ENTRY_POINT) {
+                if(gCommonICUDataArray[i].load(std::memory_order_acquire)->pHeader == &U_ICUDATA_ENTRY_POINT) {
                     /* The linked-in data is already in the list. */
                     return NULL;
                 }
@@ -716,10 +783,7 @@ openCommonData(const char *path,          /*  Path from OpenChoice?          */
         */
 #if U_PLATFORM_HAS_WINUWP_API == 0 // Windows UWP Platform does not support dll icu data at this time
         setCommonICUDataPointer(&U_ICUDATA_ENTRY_POINT, FALSE, pErrorCode);
-        {
-            Mutex lock;
-            return gCommonICUDataArray[commonDataIndex];
-        }
+        return gCommonICUDataArray[commonDataIndex].load(std::memory_order_acquire);
 #endif
     }
 
@@ -929,6 +993,42 @@ udata_setAppData(const char *path, const void *data, UErrorCode *err)
     udata_cacheDataItem(path, &udm, err);
 }
 
+/*---------------------------------------------------------------------------
+ *
+ *  udata_publishOverlay
+ *
+ *---------------------------------------------------------------------------- */
+U_CAPI void U_EXPORT2
+udata_publishOverlay(const void *data, UErrorCode *pErrorCode) {
+    if(pErrorCode==NULL || U_FAILURE(*pErrorCode)) {
+        return;
+    }
+    if(data==NULL) {
+        *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+
+    LocalPointer<DataOverlay> overlay(new DataOverlay, *pErrorCode);
+    if (U_FAILURE(*pErrorCode)) {
+        return;
+    }
+    UDataMemory_init(&overlay->data);
+    UDataMemory_setData(&overlay->data, data);
+    udata_checkCommonData(&overlay->data, pErrorCode);
+    if (U_FAILURE(*pErrorCode)) {
+        return;
+    }
+
+    {
+        Mutex lock(&udataMutex);
+        overlay->epoch = gDataEpoch.load(std::memory_order_relaxed) + 1;
+        overlay->next = gDataOverlays.load(std::memory_order_relaxed);
+        gDataOverlays.store(overlay.getAlias(), std::memory_order_release);
+        gDataEpoch.store(overlay.orphan()->epoch, std::memory_order_release);
+    }
+    ucln_common_registerCleanup(UCLN_COMMON_UDATA, udata_cleanup);
+}
+
 /*----------------------------------------------------------------------------*
  *                                                                            *
  *  checkDataItem     Given a freshly located/loaded data item, either        *
@@ -1011,6 +1111,7 @@ static UDataMemory *doLoadFromIndividualFiles(const char *pkgName,
                 *  and return it.   */
                 pEntryData->mapAddr = dataMemory.mapAddr;
                 pEntryData->map     = dataMemory.map;
+                pEntryData->length  = dataMemory.length;
 
 #ifdef UDATA_DEBUG
                 fprintf(stderr, "** Mapped file: %s\n", pathBuffer);
@@ -1036,6 +1137,203 @@ static UDataMemory *doLoadFromIndividualFiles(const char *pkgName,
     return NULL;
 }
 
+/*
+ * Adds a common data item to the ones reported by udata_openLoadedItems().
+ * Returns TRUE if it was not loaded before, or if that is not known.
+ */
+U_CDECL_BEGIN
+static int32_t U_CALLCONV
+hashLoadedItem(const UHashTok key) {
+    uintptr_t p = (uintptr_t)key.pointer;
+    return (int32_t)((p >> 4) ^ (p >> 20));
+}
+
+static UBool U_CALLCONV
+compareLoadedItems(const UHashTok key1, const UHashTok key2) {
+    return key1.pointer == key2.pointer;
+}
+U_CDECL_END
+
+static UBool recordLoadedItem(const DataHeader *pHeader, const char *tocEntryName) {
+    UErrorCode errorCode = U_ZERO_ERROR;
+    UBool isNew = TRUE;
+    UBool isFirst = FALSE;
+    {
+        Mutex lock(&udataMutex);
+        if (gLoadedItems == NULL) {
+            gLoadedItems = uhash_open(hashLoadedItem, compareLoadedItems, NULL, &errorCode);
+            gLoadedItemNameSet = uhash_open(uhash_hashChars, uhash_compareChars, NULL, &errorCode);
+            gLoadedItemNames = new CharString();
+            if (U_FAILURE(errorCode) || gLoadedItemNames == NULL) {
+                uhash_close(gLoadedItems);
+                gLoadedItems = NULL;
+                uhash_close(gLoadedItemNameSet);
+                gLoadedItemNameSet = NULL;
+                delete gLoadedItemNames;
+                gLoadedItemNames = NULL;
+                return TRUE;
+            }
+            uhash_setKeyDeleter(gLoadedItemNameSet, uprv_free);
+            isFirst = TRUE;
+        }
+        if (uhash_geti(gLoadedItems, pHeader) != 0) {
+            isNew = FALSE;
+        } else {
+            uhash_puti(gLoadedItems, (void *)pHeader, 1, &errorCode);
+            if (uhash_geti(gLoadedItemNameSet, tocEntryName) == 0) {
+                int32_t length = (int32_t)uprv_strlen(tocEntryName);
+                char *key = (char *)uprv_malloc(length + 1);
+                if (key != NULL) {
+                    uprv_memcpy(key, tocEntryName, length + 1);
+                    uhash_puti(gLoadedItemNameSet, key, 1, &errorCode);
+                    if (U_SUCCESS(errorCode)) {
+                        gLoadedItemNames->append(tocEntryName, length, errorCode).append((char)0, errorCode);
+                    }
+                }
+            }
+        }
+    }
+    if (isFirst) {
+        ucln_common_registerCleanup(UCLN_COMMON_UDATA, udata_cleanup);
+    }
+    return isNew;
+}
+
+namespace {
+
+struct UncompressedItem : public UMemory {
+    UncompressedItem() : pHeader(NULL), length(0) {}
+    ~UncompressedItem() { uprv_free(pHeader); }
+
+    DataHeader *pHeader;
+    int32_t length;
+};
+
+}  // namespace
+
+U_CDECL_BEGIN
+static void U_CALLCONV
+deleteUncompressedItem(void *obj) {
+    delete static_cast<UncompressedItem *>(obj);
+}
+U_CDECL_END
+
+/*
+ * Returns the uncompressed copy of a compressed common data item,
+ * and uncompresses it on first access.
+ * *pLength is the length of the compressed item on input, and of the uncompressed one on output.
+ * Returns NULL and sets *subErrorCode if the item is malformed.
+ */
+static const DataHeader *getUncompressedItem(const DataHeader *pHeader, int32_t *pLength,
+                                             UErrorCode *subErrorCode, UErrorCode *pErrorCode) {
+    {
+        Mutex lock(&udataMutex);
+        if (gUncompressedItems != NULL) {
+            const UncompressedItem *item =
+                static_cast<const UncompressedItem *>(uhash_get(gUncompressedItems, pHeader));
+            if (item != NULL) {
+                *pLength = item->length;
+                return item->pHeader;
+            }
+        }
+    }
+
+    // Uncompress without holding the lock; other threads may do the same for this item,
+    // and only the first result is kept.
+    UErrorCode errorCode = U_ZERO_ERROR;
+    int32_t length = udata_uncompressItem(pHeader, *pLength, NULL, 0, &errorCode);
+    if (errorCode != U_BUFFER_OVERFLOW_ERROR) {
+        *subErrorCode = U_INVALID_FORMAT_ERROR;
+        return NULL;
+    }
+    LocalPointer<UncompressedItem> item(new UncompressedItem(), *pErrorCode);
+    if (U_FAILURE(*pErrorCode)) {
+        return NULL;
+    }
+    item->pHeader = static_cast<DataHeader *>(uprv_malloc(length > 0 ? length : 1));
+    if (item->pHeader == NULL) {
+        *pErrorCode = U_MEMORY_ALLOCATION_ERROR;
+        return NULL;
+    }
+    errorCode = U_ZERO_ERROR;
+    item->length = udata_uncompressItem(pHeader, *pLength, item->pHeader, length, &errorCode);
+    if (U_FAILURE(errorCode) || item->length < (int32_t)sizeof(DataHeader)) {
+        *subErrorCode = U_INVALID_FORMAT_ERROR;
+        return NULL;
+    }
+
+    const UncompressedItem *result;
+    UBool isFirst = FALSE;
+    {
+        Mutex lock(&udataMutex);
+        if (gUncompressedItems == NULL) {
+            gUncompressedItems = uhash_open(hashLoadedItem, compareLoadedItems, NULL, pErrorCode);
+            if (U_FAILURE(*pErrorCode)) {
+                return NULL;
+            }
+            uhash_setValueDeleter(gUncompressedItems, deleteUncompressedItem);
+            isFirst = TRUE;
+        }
+        result = static_cast<const UncompressedItem *>(uhash_get(gUncompressedItems, pHeader));
+        if (result == NULL) {
+            result = item.getAlias();
+            uhash_put(gUncompressedItems, (void *)pHeader, item.orphan(), pErrorCode);
+            if (U_FAILURE(*pErrorCode)) {
+                return NULL;
+            }
+        }
+    }
+    if (isFirst) {
+        ucln_common_registerCleanup(UCLN_COMMON_UDATA, udata_cleanup);
+    }
+    *pLength = result->length;
+    return result->pHeader;
+}
+
+/*
+ * Looks up an item in the data overlays that were published after sinceEpoch, newest first.
+ * Returns the item's header and sets *pLength, or returns NULL.
+ */
+static const DataHeader *findOverlayItem(const char *tocEntryName, int32_t sinceEpoch, int32_t *pLength) {
+    for (DataOverlay *overlay = gDataOverlays.load(std::memory_order_acquire);
+            overlay != NULL && overlay->epoch > sinceEpoch;
+            overlay = overlay->next) {
+        UErrorCode errorCode = U_ZERO_ERROR;
+        const DataHeader *pHeader =
+            overlay->data.vFuncs->Lookup(&overlay->data, tocEntryName, pLength, &errorCode);
+        if (pHeader != NULL && U_SUCCESS(errorCode)) {
+            return pHeader;
+        }
+    }
+    return NULL;
+}
+
+/*
+ * Loads an ICU data item from the data overlays.
+ * Returns NULL if no overlay has an acceptable item of this name.
+ */
+static UDataMemory *doLoadFromOverlays(const char *tocEntryName,
+                                       const char *type, const char *name,
+                                       UDataMemoryIsAcceptable *isAcceptable, void *context,
+                                       UErrorCode *subErrorCode, UErrorCode *pErrorCode) {
+    int32_t length;
+    const DataHeader *pHeader = findOverlayItem(tocEntryName, 0, &length);
+    if (pHeader == NULL) {
+        return NULL;
+    }
+    if (udata_isCompressedItem(pHeader, length)) {
+        pHeader = getUncompressedItem(pHeader, &length, subErrorCode, pErrorCode);
+        if (pHeader == NULL || U_FAILURE(*pErrorCode)) {
+            return NULL;
+        }
+    }
+    UDataMemory *pEntryData = checkDataItem(pHeader, isAcceptable, context, type, name, subErrorCode, pErrorCode);
+    if (pEntryData != NULL) {
+        pEntryData->length = length;
+    }
+    return pEntryData;
+}
+
 /**
  * @return 0 if not loaded, 1 if loaded or err 
  */
@@ -1073,6 +1371,14 @@ static UDataMemory *doLoadFromCommonData(UBool isICUData, const char * /*pkgName
             fprintf(stderr, "%s: pHeader=%p - %s\n", tocEntryName, (void*) pHeader, u_errorName(*subErrorCode));
 #endif
 
+            UBool isCompressed = pHeader!=NULL && udata_isCompressedItem(pHeader, length);
+            if(isCompressed) {
+                pHeader=getUncompressedItem(pHeader, &length, subErrorCode, pErrorCode);
+                if (U_FAILURE(*pErrorCode)) {
+                    return NULL;
+                }
+            }
+
             if(pHeader!=NULL) {
                 pEntryData = checkDataItem(pHeader, isAcceptable, context, type, name, subErrorCode, pErrorCode);
 #ifdef UDATA_DEBUG
@@ -1083,6 +1389,10 @@ static UDataMemory *doLoadFromCommonData(UBool isICUData, const char * /*pkgName
                 }
                 if (pEntryData != NULL) {
                     pEntryData->length = length;
+                    if (recordLoadedItem(pHeader, tocEntryName) && !isCompressed) {
+                        /* The common data is mapped for random access; read this item ahead. */
+                        uprv_adviseMemory(pHeader, length, UMAP_ADVISE_WILLNEED);
+                    }
                     return pEntryData;
                 }
             }
@@ -1296,6 +1606,15 @@ doOpenChoice(const char *path, const char *type, const char *name,
     /* End of dealing with a null basename */
     dataPath = u_getDataDirectory();
 
+    /****    Data overlays override all other ICU data  */
+    if (isICUData && gDataOverlays.load(std::memory_order_acquire) != NULL) {
+        retVal = doLoadFromOverlays(tocEntryName.data(), type, name, isAcceptable, context,
+                                    &subErrorCode, pErrorCode);
+        if((retVal != NULL) || U_FAILURE(*pErrorCode)) {
+            return retVal;
+        }
+    }
+
     /****    Time zone individual files override  */
     if (isICUData && isTimeZoneFile(name, type)) {
         const char *tzFilesDir = u_getTimeZoneFilesDirectory(pErrorCode);
@@ -1401,6 +1720,7 @@ udata_open(const char *path, const char *type, const char *name,
         *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
         return NULL;
     } else {
+        UCOUNTER_INC(UCOUNTER_DATA_OPENS);
         return doOpenChoice(path, type, name, NULL, NULL, pErrorCode);
     }
 }
@@ -1421,6 +1741,7 @@ udata_openChoice(const char *path, const char *type, const char *name,
         *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
         return NULL;
     } else {
+        UCOUNTER_INC(UCOUNTER_DATA_OPENS);
         return doOpenChoice(path, type, name, isAcceptable, context, pErrorCode);
     }
 }
@@ -1449,6 +1770,218 @@ udata_getInfo(UDataMemory *pData, UDataInfo *pInfo) {
 }
 
 
+U_CAPI int32_t U_EXPORT2
+udata_prefetch(const char *const *itemNames, int32_t count, UErrorCode *pErrorCode) {
+    if (U_FAILURE(*pErrorCode)) {
+        return 0;
+    }
+    if (count < 0 || (itemNames == NULL && count > 0)) {
+        *pErrorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    int32_t numFound = 0;
+    for (int32_t i = 0; i < count; ++i) {
+        /* Look in each ICU common data package, as doLoadFromCommonData() does. */
+        UBool checkedExtendedICUData = FALSE;
+        for (int32_t commonDataIndex = 0;;) {
+            UErrorCode subErrorCode = U_ZERO_ERROR;
+            UDataMemory *pCommonData = openCommonData(NULL, commonDataIndex, &subErrorCode);
+            if (U_SUCCESS(subErrorCode) && pCommonData != NULL) {
+                int32_t length;
+                const DataHeader *pHeader =
+                    pCommonData->vFuncs->Lookup(pCommonData, itemNames[i], &length, &subErrorCode);
+                if (pHeader != NULL) {
+                    uprv_adviseMemory(pHeader, length, UMAP_ADVISE_WILLNEED);
+                    ++numFound;
+                    break;
+                }
+                ++commonDataIndex;
+            } else if (subErrorCode == U_MEMORY_ALLOCATION_ERROR) {
+                *pErrorCode = subErrorCode;
+                return numFound;
+            } else if (pCommonData == NULL && !checkedExtendedICUData &&
+                       extendICUData(&subErrorCode)) {
+                checkedExtendedICUData = TRUE;
+            } else {
+                break;
+            }
+        }
+    }
+    return numFound;
+}
+
+U_CFUNC const void *
+udata_findCommonItem(const char *type, const char *name,
+                     UDataMemoryIsAcceptable *isAcceptable, void *context) {
+    /* Data overlays override the common data, see doOpenChoice(). */
+    if (gDataOverlays.load(std::memory_order_acquire) != NULL) {
+        return NULL;
+    }
+    UErrorCode errorCode = U_ZERO_ERROR;
+    CharString tocEntryName(U_ICUDATA_NAME, errorCode);
+    tocEntryName.append(U_TREE_ENTRY_SEP_CHAR, errorCode).append(name, errorCode).
+        append('.', errorCode).append(type, errorCode);
+    if (U_FAILURE(errorCode)) {
+        return NULL;
+    }
+    /* Look in each ICU common data package, as doLoadFromCommonData() does. */
+    UBool checkedExtendedICUData = FALSE;
+    for (int32_t commonDataIndex = 0;;) {
+        UErrorCode subErrorCode = U_ZERO_ERROR;
+        UDataMemory *pCommonData = openCommonData(NULL, commonDataIndex, &subErrorCode);
+        if (U_SUCCESS(subErrorCode) && pCommonData != NULL) {
+            int32_t length;
+            const DataHeader *pHeader =
+                pCommonData->vFuncs->Lookup(pCommonData, tocEntryName.data(), &length, &subErrorCode);
+            if (pHeader != NULL) {
+                if (U_FAILURE(subErrorCode) || udata_isCompressedItem(pHeader, length) ||
+                        pHeader->dataHeader.magic1 != 0xda || pHeader->dataHeader.magic2 != 0x27 ||
+                        (isAcceptable != NULL && !isAcceptable(context, type, name, &pHeader->info))) {
+                    return NULL;
+                }
+                return (const char *)pHeader + udata_getHeaderSize(pHeader);
+            }
+            ++commonDataIndex;
+        } else if (pCommonData == NULL && subErrorCode != U_MEMORY_ALLOCATION_ERROR &&
+                   !checkedExtendedICUData && extendICUData(&subErrorCode)) {
+            checkedExtendedICUData = TRUE;
+        } else {
+            return NULL;
+        }
+    }
+}
+
+/* Enumeration of the NUL-separated names in the context, for udata_openLoadedItems(). */
+
+typedef struct ULoadedItemsContext {
+    char *names;
+    char *limit;
+    char *current;
+} ULoadedItemsContext;
+
+U_CDECL_BEGIN
+
+static void U_CALLCONV
+udata_closeLoadedItems(UEnumeration *en) {
+    uprv_free(((ULoadedItemsContext *)en->context)->names);
+    uprv_free(en->context);
+    uprv_free(en);
+}
+
+static int32_t U_CALLCONV
+udata_countLoadedItems(UEnumeration *en, UErrorCode * /*status*/) {
+    const ULoadedItemsContext *context = (const ULoadedItemsContext *)en->context;
+    int32_t count = 0;
+    for (const char *name = context->names; name < context->limit; name += uprv_strlen(name) + 1) {
+        ++count;
+    }
+    return count;
+}
+
+static const char * U_CALLCONV
+udata_nextLoadedItem(UEnumeration *en, int32_t *resultLength, UErrorCode * /*status*/) {
+    ULoadedItemsContext *context = (ULoadedItemsContext *)en->context;
+    const char *result = NULL;
+    int32_t length = 0;
+    if (context->current < context->limit) {
+        result = context->current;
+        length = (int32_t)uprv_strlen(result);
+        context->current += length + 1;
+    }
+    if (resultLength != NULL) {
+        *resultLength = length;
+    }
+    return result;
+}
+
+static void U_CALLCONV
+udata_resetLoadedItems(UEnumeration *en, UErrorCode * /*status*/) {
+    ULoadedItemsContext *context = (ULoadedItemsContext *)en->context;
+    context->current = context->names;
+}
+
+U_CDECL_END
+
+static const UEnumeration gLoadedItemsEnum = {
+    NULL,
+    NULL,
+    udata_closeLoadedItems,
+    udata_countLoadedItems,
+    uenum_unextDefault,
+    udata_nextLoadedItem,
+    udata_resetLoadedItems
+};
+
+U_CAPI UEnumeration * U_EXPORT2
+udata_openLoadedItems(UErrorCode *pErrorCode) {
+    if (U_FAILURE(*pErrorCode)) {
+        return NULL;
+    }
+    UEnumeration *en = (UEnumeration *)uprv_malloc(sizeof(UEnumeration));
+    ULoadedItemsContext *context = (ULoadedItemsContext *)uprv_malloc(sizeof(ULoadedItemsContext));
+    char *names = NULL;
+    int32_t length = 0;
+    if (en != NULL && context != NULL) {
+        Mutex lock(&udataMutex);
+        length = gLoadedItemNames != NULL ? gLoadedItemNames->length() : 0;
+        names = (char *)uprv_malloc(length + 1);
+        if (names != NULL) {
+            uprv_memcpy(names, length > 0 ? gLoadedItemNames->data() : "", length + 1);
+        }
+    }
+    if (names == NULL) {
+        uprv_free(en);
+        uprv_free(context);
+        *pErrorCode = U_MEMORY_ALLOCATION_ERROR;
+        return NULL;
+    }
+    uprv_memcpy(en, &gLoadedItemsEnum, sizeof(UEnumeration));
+    context->names = context->current = names;
+    context->limit = names + length;
+    en->context = context;
+    return en;
+}
+
+U_CAPI int32_t U_EXPORT2
+udata_getDataEpoch() {
+    return gDataEpoch.load(std::memory_order_acquire);
+}
+
+U_CAPI UBool U_EXPORT2
+udata_isOverlaidSince(const char *path, const char *type, const char *name, int32_t epoch) {
+    const DataOverlay *overlay = gDataOverlays.load(std::memory_order_acquire);
+    if (overlay == NULL || overlay->epoch <= epoch || name == NULL) {
+        return FALSE;
+    }
+
+    /* Build the item name of ICU data like doOpenChoice() does. */
+    UErrorCode errorCode = U_ZERO_ERROR;
+    CharString tocEntryName(U_ICUDATA_NAME, errorCode);
+    if (path != NULL && uprv_strcmp(path, U_ICUDATA_ALIAS) != 0) {
+        const char *treeName;
+        if (!uprv_strncmp(path, U_ICUDATA_NAME U_TREE_SEPARATOR_STRING,
+                          uprv_strlen(U_ICUDATA_NAME U_TREE_SEPARATOR_STRING))) {
+            treeName = path + uprv_strlen(U_ICUDATA_NAME U_TREE_SEPARATOR_STRING);
+        } else if (!uprv_strncmp(path, U_ICUDATA_ALIAS U_TREE_SEPARATOR_STRING,
+                                 uprv_strlen(U_ICUDATA_ALIAS U_TREE_SEPARATOR_STRING))) {
+            treeName = path + uprv_strlen(U_ICUDATA_ALIAS U_TREE_SEPARATOR_STRING);
+        } else {
+            return FALSE;  /* not ICU data */
+        }
+        if (uprv_strchr(path, U_FILE_SEP_CHAR) != NULL || uprv_strchr(path, U_FILE_ALT_SEP_CHAR) != NULL) {
+            return FALSE;  /* a file path, not a tree name */
+        }
+        tocEntryName.append(U_TREE_ENTRY_SEP_CHAR, errorCode).append(treeName, errorCode);
+    }
+    tocEntryName.append(U_TREE_ENTRY_SEP_CHAR, errorCode).append(name, errorCode);
+    if (type != NULL && *type != 0) {
+        tocEntryName.append(".", errorCode).append(type, errorCode);
+    }
+    int32_t length;
+    /* Assume that the item was overlaid if its name cannot be built. */
+    return U_FAILURE(errorCode) || findOverlayItem(tocEntryName.data(), epoch, &length) != NULL;
+}
+
 U_CAPI void U_EXPORT2 udata_setFileAccess(UDataFileAccess access, UErrorCode * /*status*/)
 {
     // Note: this function is documented as not thread safe.
@@ -0,0 +1,179 @@
+// © 2019 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+
+/*----------------------------------------------------------------------------------
+ *
+ *   Compressed data items, see udatacmp.h.
+ *
+ *----------------------------------------------------------------------------------*/
+
+#include "unicode/utypes.h"
+#include "unicode/udata.h"
+#include "cmemory.h"
+#include "ucmndata.h"
+#include "udatacmp.h"
+
+namespace {
+
+uint16_t readUInt16(const void *p, UBool isBigEndian) {
+    const uint8_t *s = static_cast<const uint8_t *>(p);
+    return isBigEndian ? (uint16_t)((s[0] << 8) | s[1]) : (uint16_t)((s[1] << 8) | s[0]);
+}
+
+int32_t readInt32(const void *p, UBool isBigEndian) {
+    const uint8_t *s = static_cast<const uint8_t *>(p);
+    uint32_t x = isBigEndian ?
+        ((uint32_t)s[0] << 24) | ((uint32_t)s[1] << 16) | ((uint32_t)s[2] << 8) | s[3] :
+        ((uint32_t)s[3] << 24) | ((uint32_t)s[2] << 16) | ((uint32_t)s[1] << 8) | s[0];
+    return (int32_t)x;
+}
+
+/*
+ * Returns the header size of a compressed item, or 0 if it is not one.
+ * The length is not checked if it is negative.
+ */
+int32_t getCompressedItemHeaderSize(const void *data, int32_t length) {
+    const DataHeader *pHeader = static_cast<const DataHeader *>(data);
+    if (pHeader == NULL || (0 <= length && length < (int32_t)sizeof(DataHeader)) ||
+            pHeader->dataHeader.magic1 != 0xda || pHeader->dataHeader.magic2 != 0x27 ||
+            pHeader->info.dataFormat[0] != UDATA_CMP_FMT_0 ||
+            pHeader->info.dataFormat[1] != UDATA_CMP_FMT_1 ||
+            pHeader->info.dataFormat[2] != UDATA_CMP_FMT_2 ||
+            pHeader->info.dataFormat[3] != UDATA_CMP_FMT_3 ||
+            pHeader->info.formatVersion[0] != 1) {
+        return 0;
+    }
+    UBool isBigEndian = pHeader->info.isBigEndian;
+    int32_t headerSize = readUInt16(&pHeader->dataHeader.headerSize, isBigEndian);
+    int32_t infoSize = readUInt16(&pHeader->info.size, isBigEndian);
+    if (infoSize < (int32_t)sizeof(UDataInfo) || headerSize < (4 + infoSize) ||
+            (0 <= length && length < headerSize + UDATA_CMP_IX_COUNT * 4)) {
+        return 0;
+    }
+    return headerSize;
+}
+
+/*
+ * Uncompresses the LZ4 block format: A sequence of
+ * token, [literal length bytes], literals, 2-byte offset, [match length bytes].
+ * The last sequence has only the token, the literal length bytes and the literals.
+ * Returns FALSE if the input is not well-formed or if it does not
+ * uncompress to exactly destLength bytes.
+ */
+UBool lz4Uncompress(const uint8_t *src, int32_t srcLength, uint8_t *dest, int32_t destLength) {
+    const uint8_t *srcLimit = src + srcLength;
+    int32_t destIndex = 0;
+    while (src < srcLimit) {
+        int32_t token = *src++;
+        int32_t literalLength = token >> 4;
+        if (literalLength == 15) {
+            int32_t b;
+            do {
+                if (src == srcLimit) {
+                    return FALSE;
+                }
+                b = *src++;
+                literalLength += b;
+                if (literalLength > destLength) {
+                    return FALSE;
+                }
+            } while (b == 255);
+        }
+        if (literalLength > (srcLimit - src) || literalLength > (destLength - destIndex)) {
+            return FALSE;
+        }
+        uprv_memcpy(dest + destIndex, src, literalLength);
+        src += literalLength;
+        destIndex += literalLength;
+        if (src == srcLimit) {
+            break;  // last sequence
+        }
+
+        if ((srcLimit - src) < 2) {
+            return FALSE;
+        }
+        int32_t offset = src[0] | (src[1] << 8);
+        src += 2;
+        if (offset == 0 || offset > destIndex) {
+            return FALSE;
+        }
+        int32_t matchLength = token & 15;
+        if (matchLength == 15) {
+            int32_t b;
+            do {
+                if (src == srcLimit) {
+                    return FALSE;
+                }
+                b = *src++;
+                matchLength += b;
+                if (matchLength > destLength) {
+                    return FALSE;
+                }
+            } while (b == 255);
+        }
+        matchLength += 4;
+        if (matchLength > (destLength - destIndex)) {
+            return FALSE;
+        }
+        const uint8_t *match = dest + destIndex - offset;
+        if (offset >= matchLength) {
+            uprv_memcpy(dest + destIndex, match, matchLength);
+        } else {
+            // The match overlaps the bytes that it produces.
+            for (int32_t i = 0; i < matchLength; ++i) {
+                dest[destIndex + i] = match[i];
+            }
+        }
+        destIndex += matchLength;
+    }
+    return destIndex == destLength;
+}
+
+}  // namespace
+
+U_CAPI UBool U_EXPORT2
+udata_isCompressedItem(const void *data, int32_t length) {
+    return getCompressedItemHeaderSize(data, length) > 0;
+}
+
+U_CAPI int32_t U_EXPORT2
+udata_uncompressItem(const void *data, int32_t length,
+                     void *dest, int32_t destCapacity,
+                     UErrorCode *pErrorCode) {
+    if (U_FAILURE(*pErrorCode)) {
+        return 0;
+    }
+    if (data == NULL || length < -1 || destCapacity < 0 || (dest == NULL && destCapacity > 0)) {
+        *pErrorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    int32_t headerSize = getCompressedItemHeaderSize(data, length);
+    if (headerSize == 0) {
+        *pErrorCode = U_INVALID_FORMAT_ERROR;
+        return 0;
+    }
+    UBool isBigEndian = static_cast<const DataHeader *>(data)->info.isBigEndian;
+    const uint8_t *indexes = static_cast<const uint8_t *>(data) + headerSize;
+    int32_t indexesLength = readInt32(indexes + 4 * UDATA_CMP_IX_INDEXES_LENGTH, isBigEndian);
+    int32_t method = readInt32(indexes + 4 * UDATA_CMP_IX_METHOD, isBigEndian);
+    int32_t uncompressedLength = readInt32(indexes + 4 * UDATA_CMP_IX_UNCOMPRESSED_LENGTH, isBigEndian);
+    int32_t compressedLength = readInt32(indexes + 4 * UDATA_CMP_IX_COMPRESSED_LENGTH, isBigEndian);
+    int32_t capacity = readInt32(indexes + 4 * UDATA_CMP_IX_CAPACITY, isBigEndian);
+    if (indexesLength < UDATA_CMP_IX_COUNT || method != UDATA_CMP_METHOD_LZ4_BLOCK ||
+            uncompressedLength < 0 || compressedLength < 0 || compressedLength > capacity ||
+            (length >= 0 && (indexesLength > (length - headerSize) / 4 ||
+                             capacity > (length - headerSize - 4 * indexesLength)))) {
+        *pErrorCode = U_INVALID_FORMAT_ERROR;
+        return 0;
+    }
+    if (uncompressedLength > destCapacity) {
+        *pErrorCode = U_BUFFER_OVERFLOW_ERROR;
+        return uncompressedLength;
+    }
+    if (!lz4Uncompress(indexes + 4 * indexesLength, compressedLength,
+                       static_cast<uint8_t *>(dest), uncompressedLength)) {
+        *pErrorCode = U_INVALID_FORMAT_ERROR;
+        return 0;
+    }
+    return uncompressedLength;
+}
@@ -0,0 +1,76 @@
+// © 2019 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+
+/*----------------------------------------------------------------------------------
+ *
+ *   Compressed data items   A data item in a common data package can be
+ *                           stored compressed.  udata_open() uncompresses it
+ *                           on first access and keeps the uncompressed item
+ *                           until u_cleanup().
+ *
+ *   A compressed item has an ordinary data header with dataFormat "Cmpr", and
+ *   with the isBigEndian, charsetFamily and sizeofUChar of the item it contains.
+ *   The header is followed by
+ *
+ *     int32_t indexes[indexesLength];  -- indexesLength=indexes[UDATA_CMP_IX_INDEXES_LENGTH]
+ *     uint8_t compressed[indexes[UDATA_CMP_IX_CAPACITY]];
+ *
+ *   The first indexes[UDATA_CMP_IX_COMPRESSED_LENGTH] bytes of compressed[] are the whole
+ *   contained item, including its own data header, in the LZ4 block format.
+ *   The rest is padding.  It leaves room for compressing the item for the other
+ *   platform types, so that the item can be swapped in place.
+ *   The compressed item ends with compressed[], and its length is a multiple of 16.
+ *
+ *   These functions are part of the ICU internal implementation, and
+ *   are not intended to be used directly by applications.
+ */
+
+#ifndef __UDATACMP_H__
+#define __UDATACMP_H__
+
+#include "unicode/utypes.h"
+
+/* dataFormat="Cmpr" */
+#define UDATA_CMP_FMT_0 0x43
+#define UDATA_CMP_FMT_1 0x6d
+#define UDATA_CMP_FMT_2 0x70
+#define UDATA_CMP_FMT_3 0x72
+
+/* Indexes into the int32_t indexes[] following the data header. */
+enum {
+    UDATA_CMP_IX_INDEXES_LENGTH,
+    UDATA_CMP_IX_METHOD,
+    UDATA_CMP_IX_UNCOMPRESSED_LENGTH,
+    UDATA_CMP_IX_COMPRESSED_LENGTH,
+    UDATA_CMP_IX_CAPACITY,
+    UDATA_CMP_IX_COUNT
+};
+
+/* Values for indexes[UDATA_CMP_IX_METHOD]. */
+enum {
+    UDATA_CMP_METHOD_LZ4_BLOCK=1
+};
+
+/**
+ * Is this a compressed data item?
+ * Works for items of any platform type.
+ */
+U_CAPI UBool U_EXPORT2
+udata_isCompressedItem(const void *data, int32_t length);
+
+/**
+ * Uncompresses a compressed data item of any platform type.
+ * The result has the platform type of the compressed item.
+ * @param data compressed data item
+ * @param length length of the compressed item, or -1 if it is not known
+ * @param dest output buffer, can be NULL if destCapacity==0 for preflighting
+ * @param destCapacity capacity of dest
+ * @param pErrorCode ICU error code
+ * @return the length of the uncompressed item
+ */
+U_CAPI int32_t U_EXPORT2
+udata_uncompressItem(const void *data, int32_t length,
+                     void *dest, int32_t destCapacity,
+                     UErrorCode *pErrorCode);
+
+#endif
@@ -58,4 +58,35 @@ udata_getLength(const UDataMemory *pData);
 U_CAPI const void * U_EXPORT2
 udata_getRawMemory(const UDataMemory *pData);
 
+/**
+ * Returns the current data epoch: The number of data overlays
+ * published with udata_publishOverlay().
+ * Objects built from ICU data can remember the epoch when they were built,
+ * and check with udata_isOverlaidSince() whether their data was replaced.
+ */
+U_CAPI int32_t U_EXPORT2
+udata_getDataEpoch(void);
+
+/**
+ * Looks up an ICU data item in place in the ICU common data packages,
+ * without creating a UDataMemory and without looking for individual files.
+ * The type, name and isAcceptable parameters are as for udata_openChoice()
+ * with a NULL path.
+ * Returns the item's data as udata_getMemory() would, or NULL if the item is
+ * not found, not acceptable, or compressed, or if there are data overlays;
+ * then the caller must use udata_openChoice() to find out.
+ */
+U_CFUNC const void *
+udata_findCommonItem(const char *type, const char *name,
+                     UDataMemoryIsAcceptable *isAcceptable, void *context);
+
+/**
+ * Has an ICU data item been overlaid by an overlay that was published after the epoch?
+ * The path, type and name are as for udata_openChoice().
+ * Returns FALSE for items that are not ICU data.
+ * Does not lock a mutex.
+ */
+U_CAPI UBool U_EXPORT2
+udata_isOverlaidSince(const char *path, const char *type, const char *name, int32_t epoch);
+
 #endif
@@ -19,26 +19,21 @@
 #include "uassert.h"
 #include "ustr_imp.h"
 
-/* This hashtable is implemented as a double hash.  All elements are
- * stored in a single array with no secondary storage for collision
- * resolution (no linked list, etc.).  When there is a hash collision
- * (when two unequal keys have the same hashcode) we resolve this by
- * using a secondary hash.  The secondary hash is an increment
- * computed as a hash function (a different one) of the primary
- * hashcode.  This increment is added to the initial hash value to
- * obtain further slots assigned to the same hash code.  For this to
- * work, the length of the array and the increment must be relatively
- * prime.  The easiest way to achieve this is to have the length of
- * the array be prime, and the increment be any value from
- * 1..length-1.
+/* This hashtable is implemented with open addressing and linear
+ * probing.  All elements are stored in a single array with no
+ * secondary storage for collision resolution (no linked list, etc.).
+ * The length of the array is a power of two.  A key's home slot is
+ * taken from the high bits of its hashcode multiplied by a large odd
+ * constant (Fibonacci hashing), which spreads even weak hashcodes
+ * over the table without a division.  When there is a collision, the
+ * following slots are tried in order, so that most lookups touch only
+ * one or two adjacent elements (typically the same cache line), and
+ * the full hashcode stored in each element is compared before the
+ * keyComparator is called.
  *
  * Hashcodes are 32-bit integers.  We make sure all hashcodes are
- * non-negative by masking off the top bit.  This has two effects: (1)
- * modulo arithmetic is simplified.  If we allowed negative hashcodes,
- * then when we computed hashcode % length, we could get a negative
- * result, which we would then have to adjust back into range.  It's
- * simpler to just make hashcodes non-negative. (2) It makes it easy
- * to check for empty vs. occupied slots in the table.  We just mark
+ * non-negative by masking off the top bit.  This makes it easy to
+ * check for empty vs. occupied slots in the table.  We just mark
  * empty or deleted slots with a negative hashcode.
  *
  * The central function is _uhash_find().  This function looks for a
@@ -59,9 +54,9 @@
  * reallocated and repopulated.  Setting the low water ratio to zero
  * means the table will never shrink.  Setting the high water ratio to
  * one means the table will never grow.  The ratios should be
- * coordinated with the ratio between successive elements of the
- * PRIMES table, so that when the primeIndex is incremented or
- * decremented during rehashing, it brings the ratio of count / length
+ * coordinated with the factor of 2 between successive table lengths,
+ * so that when the lengthShift is incremented or decremented during
+ * rehashing, it brings the ratio of count / length
  * back into the desired range (between low and high water ratios).
  */
 
@@ -69,26 +64,14 @@
  * PRIVATE Constants, Macros
  ********************************************************************/
 
-/* This is a list of non-consecutive primes chosen such that
- * PRIMES[i+1] ~ 2*PRIMES[i].  (Currently, the ratio ranges from 1.81
- * to 2.18; the inverse ratio ranges from 0.459 to 0.552.)  If this
- * ratio is changed, the low and high water ratios should also be
- * adjusted to suit.
- *
- * These prime numbers were also chosen so that they are the largest
- * prime number while being less than a power of two.
+/* The table length is 1 << lengthShift, for lengthShift in
+ * MIN_LENGTH_SHIFT..MAX_LENGTH_SHIFT.
  */
-static const int32_t PRIMES[] = {
-    7, 13, 31, 61, 127, 251, 509, 1021, 2039, 4093, 8191, 16381, 32749,
-    65521, 131071, 262139, 524287, 1048573, 2097143, 4194301, 8388593,
-    16777213, 33554393, 67108859, 134217689, 268435399, 536870909,
-    1073741789, 2147483647 /*, 4294967291 */
-};
-
-#define PRIMES_LENGTH UPRV_LENGTHOF(PRIMES)
-#define DEFAULT_PRIME_INDEX 4
+#define MIN_LENGTH_SHIFT 3
+#define MAX_LENGTH_SHIFT 30
+#define DEFAULT_LENGTH_SHIFT 7
 
-/* These ratios are tuned to the PRIMES array such that a resize
+/* These ratios are tuned to the doubling of table lengths such that a resize
  * places the table back into the zone of non-resizing.  That is,
  * after a call to _uhash_rehash(), a subsequent call to
  * _uhash_rehash() should do nothing (should not churn).  This is only
@@ -185,7 +168,21 @@ _uhash_internalRemoveElement(UHashtable *hash, UHashElement* e) {
     U_ASSERT(!IS_EMPTY_OR_DELETED(e->hashcode));
     --hash->count;
     empty.pointer = NULL; empty.integer = 0;
-    return _uhash_setElement(hash, e, HASH_DELETED, empty, empty, 0);
+    UHashTok result = _uhash_setElement(hash, e, HASH_DELETED, empty, empty, 0);
+    /* A probe sequence never continues past an empty slot, so if the
+     * next slot is empty then this one and any deleted slots just
+     * before it can be marked empty as well.  This keeps deleted
+     * markers from accumulating in tables with many removals.
+     */
+    int32_t mask = hash->length - 1;
+    int32_t i = (int32_t)(e - hash->elements);
+    if (hash->elements[(i + 1) & mask].hashcode == HASH_EMPTY) {
+        while (hash->elements[i].hashcode == HASH_DELETED) {
+            hash->elements[i].hashcode = HASH_EMPTY;
+            i = (i - 1) & mask;
+        }
+    }
+    return result;
 }
 
 static void
@@ -198,17 +195,17 @@ _uhash_internalSetResizePolicy(UHashtable *hash, enum UHashResizePolicy policy)
 }
 
 /**
- * Allocate internal data array of a size determined by the given
- * prime index.  If the index is out of range it is pinned into range.
+ * Allocate internal data array of length 1 << lengthShift.
  * If the allocation fails the status is set to
  * U_MEMORY_ALLOCATION_ERROR and all array storage is freed.  In
  * either case the previous array pointer is overwritten.
  *
- * Caller must ensure primeIndex is in range 0..PRIME_LENGTH-1.
+ * Caller must ensure lengthShift is in range
+ * MIN_LENGTH_SHIFT..MAX_LENGTH_SHIFT.
  */
 static void
 _uhash_allocate(UHashtable *hash,
-                int32_t primeIndex,
+                int32_t lengthShift,
                 UErrorCode *status) {
 
     UHashElement *p, *limit;
@@ -216,10 +213,10 @@ _uhash_allocate(UHashtable *hash,
 
     if (U_FAILURE(*status)) return;
 
-    U_ASSERT(primeIndex >= 0 && primeIndex < PRIMES_LENGTH);
+    U_ASSERT(MIN_LENGTH_SHIFT <= lengthShift && lengthShift <= MAX_LENGTH_SHIFT);
 
-    hash->primeIndex = static_cast<int8_t>(primeIndex);
-    hash->length = PRIMES[primeIndex];
+    hash->lengthShift = static_cast<int8_t>(lengthShift);
+    hash->length = (int32_t)1 << lengthShift;
 
     p = hash->elements = (UHashElement*)
         uprv_malloc(sizeof(UHashElement) * hash->length);
@@ -250,7 +247,7 @@ _uhash_init(UHashtable *result,
               UHashFunction *keyHash,
               UKeyComparator *keyComp,
               UValueComparator *valueComp,
-              int32_t primeIndex,
+              int32_t lengthShift,
               UErrorCode *status)
 {
     if (U_FAILURE(*status)) return NULL;
@@ -265,7 +262,7 @@ _uhash_init(UHashtable *result,
     result->allocated       = FALSE;
     _uhash_internalSetResizePolicy(result, U_GROW);
 
-    _uhash_allocate(result, primeIndex, status);
+    _uhash_allocate(result, lengthShift, status);
 
     if (U_FAILURE(*status)) {
         return NULL;
@@ -278,7 +275,7 @@ static UHashtable*
 _uhash_create(UHashFunction *keyHash,
               UKeyComparator *keyComp,
               UValueComparator *valueComp,
-              int32_t primeIndex,
+              int32_t lengthShift,
               UErrorCode *status) {
     UHashtable *result;
 
@@ -290,7 +287,7 @@ _uhash_create(UHashFunction *keyHash,
         return NULL;
     }
 
-    _uhash_init(result, keyHash, keyComp, valueComp, primeIndex, status);
+    _uhash_init(result, keyHash, keyComp, valueComp, lengthShift, status);
     result->allocated       = TRUE;
 
     if (U_FAILURE(*status)) {
@@ -306,28 +303,24 @@ _uhash_create(UHashFunction *keyHash,
  * empty slot matching the given hashcode.  Keys are compared using
  * the keyComparator function.
  *
- * First find the start position, which is the hashcode modulo
- * the length.  Test it to see if it is:
+ * First find the start position from the hashcode (see the top of
+ * this file).  Test it to see if it is:
  *
  * a. identical:  First check the hash values for a quick check,
  *    then compare keys for equality using keyComparator.
  * b. deleted
  * c. empty
  *
- * Stop if it is identical or empty, otherwise continue by adding a
- * "jump" value (moduloing by the length again to keep it within
- * range) and retesting.  For efficiency, there need enough empty
- * values so that the searchs stop within a reasonable amount of time.
- * This can be changed by changing the high/low water marks.
+ * Stop if it is identical or empty, otherwise continue with the next
+ * slot (wrapping around at the end of the array) and retest.  For
+ * efficiency, there need enough empty values so that the searchs stop
+ * within a reasonable amount of time.  This can be changed by
+ * changing the high/low water marks.
  *
  * In theory, this function can return NULL, if it is full (no empty
  * or deleted slots) and if no matching key is found.  In practice, we
  * prevent this elsewhere (in uhash_put) by making sure the last slot
  * in the table is never filled.
- *
- * The size of the table should be prime for this algorithm to work;
- * otherwise we are not guaranteed that the jump value (the secondary
- * hash) is relatively prime to the table length.
  */
 static UHashElement*
 _uhash_find(const UHashtable *hash, UHashTok key,
@@ -335,12 +328,13 @@ _uhash_find(const UHashtable *hash, UHashTok key,
 
     int32_t firstDeleted = -1;  /* assume invalid index */
     int32_t theIndex, startIndex;
-    int32_t jump = 0; /* lazy evaluate */
+    int32_t mask = hash->length - 1;
     int32_t tableHash;
     UHashElement *elements = hash->elements;
 
     hashcode &= 0x7FFFFFFF; /* must be positive */
-    startIndex = theIndex = (hashcode ^ 0x4000000) % hash->length;
+    startIndex = theIndex =
+        (int32_t)(((uint32_t)hashcode * 0x9E3779B9u) >> (32 - hash->lengthShift));
 
     do {
         tableHash = elements[theIndex].hashcode;
@@ -358,14 +352,7 @@ _uhash_find(const UHashtable *hash, UHashTok key,
         } else if (firstDeleted < 0) { /* remember first deleted */
             firstDeleted = theIndex;
         }
-        if (jump == 0) { /* lazy compute jump */
-            /* The jump value must be relatively prime to the table
-             * length.  As long as the length is prime, then any value
-             * 1..length-1 will be relatively prime to it.
-             */
-            jump = (hashcode % (hash->length - 1)) + 1;
-        }
-        theIndex = (theIndex + jump) % hash->length;
+        theIndex = (theIndex + 1) & mask;
     } while (theIndex != startIndex);
 
     if (firstDeleted >= 0) {
@@ -395,26 +382,28 @@ _uhash_rehash(UHashtable *hash, UErrorCode *status) {
 
     UHashElement *old = hash->elements;
     int32_t oldLength = hash->length;
-    int32_t newPrimeIndex = hash->primeIndex;
+    int8_t oldLengthShift = hash->lengthShift;
+    int32_t newLengthShift = oldLengthShift;
     int32_t i;
 
     if (hash->count > hash->highWaterMark) {
-        if (++newPrimeIndex >= PRIMES_LENGTH) {
+        if (++newLengthShift > MAX_LENGTH_SHIFT) {
             return;
         }
     } else if (hash->count < hash->lowWaterMark) {
-        if (--newPrimeIndex < 0) {
+        if (--newLengthShift < MIN_LENGTH_SHIFT) {
             return;
         }
     } else {
         return;
     }
 
-    _uhash_allocate(hash, newPrimeIndex, status);
+    _uhash_allocate(hash, newLengthShift, status);
 
     if (U_FAILURE(*status)) {
         hash->elements = old;
         hash->length = oldLength;
+        hash->lengthShift = oldLengthShift;
         return;
     }
 
@@ -540,7 +529,7 @@ uhash_open(UHashFunction *keyHash,
            UValueComparator *valueComp,
            UErrorCode *status) {
 
-    return _uhash_create(keyHash, keyComp, valueComp, DEFAULT_PRIME_INDEX, status);
+    return _uhash_create(keyHash, keyComp, valueComp, DEFAULT_LENGTH_SHIFT, status);
 }
 
 U_CAPI UHashtable* U_EXPORT2
@@ -550,9 +539,9 @@ uhash_openSize(UHashFunction *keyHash,
                int32_t size,
                UErrorCode *status) {
 
-    /* Find the smallest index i for which PRIMES[i] >= size. */
-    int32_t i = 0;
-    while (i<(PRIMES_LENGTH-1) && PRIMES[i]<size) {
+    /* Find the smallest shift i for which (1 << i) >= size. */
+    int32_t i = MIN_LENGTH_SHIFT;
+    while (i<MAX_LENGTH_SHIFT && ((int32_t)1 << i)<size) {
         ++i;
     }
 
@@ -566,7 +555,7 @@ uhash_init(UHashtable *fillinResult,
            UValueComparator *valueComp,
            UErrorCode *status) {
 
-    return _uhash_init(fillinResult, keyHash, keyComp, valueComp, DEFAULT_PRIME_INDEX, status);
+    return _uhash_init(fillinResult, keyHash, keyComp, valueComp, DEFAULT_LENGTH_SHIFT, status);
 }
 
 U_CAPI UHashtable* U_EXPORT2
@@ -577,9 +566,9 @@ uhash_initSize(UHashtable *fillinResult,
                int32_t size,
                UErrorCode *status) {
 
-    // Find the smallest index i for which PRIMES[i] >= size.
-    int32_t i = 0;
-    while (i<(PRIMES_LENGTH-1) && PRIMES[i]<size) {
+    // Find the smallest shift i for which (1 << i) >= size.
+    int32_t i = MIN_LENGTH_SHIFT;
+    while (i<MAX_LENGTH_SHIFT && ((int32_t)1 << i)<size) {
         ++i;
     }
     return _uhash_init(fillinResult, keyHash, keyComp, valueComp, i, status);
@@ -159,7 +159,7 @@ struct UHashtable {
                              * 0 <= count <= length.  In practice we
                              * never let count == length (see code). */
     int32_t     length;     /* The physical size of the arrays hashes, keys
-                             * and values.  Must be prime. */
+                             * and values.  Always a power of two. */
 
     /* Rehashing thresholds */
 
@@ -168,8 +168,7 @@ struct UHashtable {
     float       highWaterRatio; /* 0..1; high water as a fraction of length */
     float       lowWaterRatio;  /* 0..1; low water as a fraction of length */
 
-    int8_t      primeIndex;     /* Index into our prime table for length.
-                                 * length == PRIMES[primeIndex] */
+    int8_t      lengthShift;    /* length == 1 << lengthShift */
     UBool       allocated; /* Was this UHashtable allocated? */
 };
 typedef struct UHashtable UHashtable;
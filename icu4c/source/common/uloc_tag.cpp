@@ -15,12 +15,17 @@
 #include "unicode/uenum.h"
 #include "unicode/uloc.h"
 #include "ustr_imp.h"
+#include "bytesinkutil.h"
 #include "charstr.h"
 #include "cmemory.h"
 #include "cstring.h"
+#include "mutex.h"
 #include "putilimp.h"
+#include "ucln_cmn.h"
+#include "uhash.h"
 #include "uinvchar.h"
 #include "ulocimp.h"
+#include "umutex.h"
 #include "uassert.h"
 
 
@@ -2764,12 +2769,12 @@ uloc_forLanguageTag(const char* langtag,
 }
 
 
-U_CAPI void U_EXPORT2
-ulocimp_forLanguageTag(const char* langtag,
-                       int32_t tagLen,
-                       icu::ByteSink& sink,
-                       int32_t* parsedLength,
-                       UErrorCode* status) {
+static void
+_forLanguageTag(const char* langtag,
+                int32_t tagLen,
+                icu::ByteSink& sink,
+                int32_t* parsedLength,
+                UErrorCode* status) {
     UBool isEmpty = TRUE;
     const char *subtag, *p;
     int32_t len;
@@ -2854,3 +2859,111 @@ ulocimp_forLanguageTag(const char* langtag,
         _appendKeywords(lt.getAlias(), sink, status);
     }
 }
+
+/*
+* A bounded cache of language tag to locale ID conversions, for callers
+* like HTTP servers which convert the same few Accept-Language tags over
+* and over. Only tags which parse completely and successfully are cached.
+*/
+namespace {
+
+/* Tags longer than this are not cached. */
+constexpr int32_t kMaxCachedTagLength = 64;
+/* When the cache is full, it is emptied before adding another entry. */
+constexpr int32_t kMaxCachedTags = 256;
+
+UHashtable *gTagCache = nullptr;
+icu::UMutex gTagCacheMutex;
+
+UBool U_CALLCONV cleanupTagCache() {
+    uhash_close(gTagCache);
+    gTagCache = nullptr;
+    return TRUE;
+}
+
+}  // namespace
+
+U_CAPI void U_EXPORT2
+ulocimp_forLanguageTag(const char* langtag,
+                       int32_t tagLen,
+                       icu::ByteSink& sink,
+                       int32_t* parsedLength,
+                       UErrorCode* status) {
+    if (U_FAILURE(*status)) {
+        return;
+    }
+    if (tagLen < 0 && langtag != NULL) {
+        tagLen = (int32_t)uprv_strlen(langtag);
+    }
+    if (langtag == NULL || tagLen > kMaxCachedTagLength) {
+        _forLanguageTag(langtag, tagLen, sink, parsedLength, status);
+        return;
+    }
+
+    char key[kMaxCachedTagLength + 1];
+    uprv_memcpy(key, langtag, tagLen);
+    key[tagLen] = 0;
+    if ((int32_t)uprv_strlen(key) != tagLen) {
+        /* The tag contains a NUL byte. */
+        _forLanguageTag(langtag, tagLen, sink, parsedLength, status);
+        return;
+    }
+    icu::CharString localeID;
+    {
+        icu::Mutex lock(&gTagCacheMutex);
+        const char *cached =
+            gTagCache != nullptr ? (const char *)uhash_get(gTagCache, key) : nullptr;
+        if (cached != nullptr) {
+            localeID.append(cached, *status);
+        }
+    }
+    if (U_FAILURE(*status)) {
+        return;
+    }
+    if (!localeID.isEmpty()) {
+        sink.Append(localeID.data(), localeID.length());
+        if (parsedLength != NULL) {
+            *parsedLength = tagLen;
+        }
+        return;
+    }
+
+    UErrorCode errorCode = U_ZERO_ERROR;
+    int32_t length = 0;
+    {
+        icu::CharStringByteSink localeIDSink(&localeID);
+        _forLanguageTag(key, tagLen, localeIDSink, &length, &errorCode);
+    }
+    if (U_FAILURE(errorCode)) {
+        *status = errorCode;
+        return;
+    }
+    sink.Append(localeID.data(), localeID.length());
+    if (parsedLength != NULL) {
+        *parsedLength = length;
+    }
+    if (length != tagLen || localeID.isEmpty()) {
+        return;
+    }
+
+    icu::Mutex lock(&gTagCacheMutex);
+    if (gTagCache == nullptr) {
+        gTagCache = uhash_open(uhash_hashChars, uhash_compareChars, NULL, &errorCode);
+        if (U_FAILURE(errorCode)) {
+            return;
+        }
+        uhash_setKeyDeleter(gTagCache, uprv_free);
+        uhash_setValueDeleter(gTagCache, uprv_free);
+        ucln_common_registerCleanup(UCLN_COMMON_LOCALE_TAG_CACHE, cleanupTagCache);
+    } else if (uhash_count(gTagCache) >= kMaxCachedTags) {
+        uhash_removeAll(gTagCache);
+    }
+    char *cachedKey = uprv_strdup(key);
+    char *cachedID = uprv_strdup(localeID.data());
+    if (cachedKey == nullptr || cachedID == nullptr) {
+        uprv_free(cachedKey);
+        uprv_free(cachedID);
+        return;
+    }
+    uhash_put(gTagCache, cachedKey, cachedID, &errorCode);
+}
@@ -171,6 +171,13 @@ typedef HANDLE MemoryMap;
             return FALSE;
         }
 
+        /* get the file length; the mapping covers the whole file */
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart > INT32_MAX) {
+            CloseHandle(file);
+            return FALSE;
+        }
+
         // Note: We use NULL/nullptr for lpAttributes parameter below.
         // This means our handle cannot be inherited and we will get the default security descriptor.
         /* create an unnamed Windows file-mapping object for the specified file */
@@ -193,6 +200,7 @@ typedef HANDLE MemoryMap;
             return FALSE;
         }
         pData->map = map;
+        pData->length = (int32_t)fileSize.QuadPart;
         return TRUE;
     }
 
@@ -209,6 +217,42 @@ typedef HANDLE MemoryMap;
 
 
 #elif MAP_IMPLEMENTATION==MAP_POSIX
+#if U_MAP_HUGE_PAGES && defined(MAP_ANONYMOUS)
+    /*
+     * A huge page can only back the mapping if the virtual address is aligned
+     * like the file offset, so map large files at a huge-page-aligned address.
+     * Reserves enough address space to find an aligned start,
+     * maps the file over it, and releases the rest of the reservation.
+     */
+    static void *
+    mapHugePageAligned(int fd, size_t length) {
+        const size_t hugePageSize = 0x200000;
+        if(length < hugePageSize) {
+            return mmap(0, length, PROT_READ, MAP_SHARED, fd, 0);
+        }
+        size_t reservedLength = length + hugePageSize;
+        char *reserved = (char *)mmap(0, reservedLength, PROT_NONE, MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+        if(reserved == MAP_FAILED) {
+            return MAP_FAILED;
+        }
+        char *start = (char *)(((uintptr_t)reserved + hugePageSize - 1) & ~(uintptr_t)(hugePageSize - 1));
+        void *data = mmap(start, length, PROT_READ, MAP_SHARED|MAP_FIXED, fd, 0);
+        if(data == MAP_FAILED) {
+            munmap(reserved, reservedLength);
+            return MAP_FAILED;
+        }
+        size_t pageSize = (size_t)sysconf(_SC_PAGESIZE);
+        char *end = start + ((length + pageSize - 1) & ~(pageSize - 1));
+        if(start > reserved) {
+            munmap(reserved, start - reserved);
+        }
+        if(end < reserved + reservedLength) {
+            munmap(end, reserved + reservedLength - end);
+        }
+        return data;
+    }
+#endif
+
     U_CFUNC UBool
     uprv_mapFile(UDataMemory *pData, const char *path, UErrorCode *status) {
         int fd;
@@ -222,20 +266,23 @@ typedef HANDLE MemoryMap;
 
         UDataMemory_init(pData); /* Clear the output struct.        */
 
-        /* determine the length of the file */
-        if(stat(path, &mystat)!=0 || mystat.st_size<=0) {
-            return FALSE;
-        }
-        length=mystat.st_size;
-
         /* open the file */
         fd=open(path, O_RDONLY);
         if(fd==-1) {
             return FALSE;
         }
 
+        /* determine the length of the opened file, which may have replaced the one at path since */
+        if(fstat(fd, &mystat)!=0 || mystat.st_size<=0 || mystat.st_size>INT32_MAX) {
+            close(fd);
+            return FALSE;
+        }
+        length=(int)mystat.st_size;
+
         /* get a view of the mapping */
-#if U_PLATFORM != U_PF_HPUX
+#if U_MAP_HUGE_PAGES && defined(MAP_ANONYMOUS)
+        data=mapHugePageAligned(fd, length);
+#elif U_PLATFORM != U_PF_HPUX
         data=mmap(0, length, PROT_READ, MAP_SHARED,  fd, 0);
 #else
         data=mmap(0, length, PROT_READ, MAP_PRIVATE, fd, 0);
@@ -249,8 +296,14 @@ typedef HANDLE MemoryMap;
         pData->map = (char *)data + length;
         pData->pHeader=(const DataHeader *)data;
         pData->mapAddr = data;
-#if U_PLATFORM == U_PF_IPHONE
-        posix_madvise(data, length, POSIX_MADV_RANDOM);
+        pData->length = (int32_t)length;
+#if U_MAP_HUGE_PAGES
+        /* Huge pages are filled by reading ahead, which UMAP_ADVISE_RANDOM would turn off. */
+        uprv_adviseMemory(data, length, UMAP_ADVISE_HUGEPAGE);
+#else
+        /* ICU data is read an item at a time, and the items in a common data file
+         * are not read in order; see uprv_adviseMemory(). */
+        uprv_adviseMemory(data, length, UMAP_ADVISE_RANDOM);
 #endif
         return TRUE;
     }
@@ -327,6 +380,7 @@ typedef HANDLE MemoryMap;
         pData->map=p;
         pData->pHeader=(const DataHeader *)p;
         pData->mapAddr=p;
+        pData->length=fileLength;
         return TRUE;
     }
 
@@ -467,6 +521,7 @@ typedef HANDLE MemoryMap;
             pData->map = (char *)data + length;
             pData->pHeader=(const DataHeader *)data;
             pData->mapAddr = data;
+            pData->length = (int32_t)length;
             return TRUE;
         }
 
@@ -528,3 +583,33 @@ typedef HANDLE MemoryMap;
 #else
 #   error MAP_IMPLEMENTATION is set incorrectly
 #endif
+
+
+/*----------------------------------------------------------------------------*
+ *                                                                            *
+ *   uprv_adviseMemory   Pass an access pattern for mapped data on to the OS. *
+ *                                                                            *
+ *----------------------------------------------------------------------------*/
+#if MAP_IMPLEMENTATION==MAP_POSIX && defined(POSIX_MADV_RANDOM) && defined(POSIX_MADV_WILLNEED)
+    U_CFUNC void
+    uprv_adviseMemory(const void *start, int32_t length, int32_t advice) {
+        static const long pageSize = sysconf(_SC_PAGESIZE);
+        if(start==nullptr || length<=0 || pageSize<=0) {
+            return;
+        }
+        uintptr_t first = (uintptr_t)start & ~(uintptr_t)(pageSize - 1);
+        uintptr_t limit = (uintptr_t)start + length;
+        if(advice==UMAP_ADVISE_HUGEPAGE) {
+#ifdef MADV_HUGEPAGE
+            madvise((void *)first, limit - first, MADV_HUGEPAGE);
+#endif
+            return;
+        }
+        posix_madvise((void *)first, limit - first,
+                      advice==UMAP_ADVISE_WILLNEED ? POSIX_MADV_WILLNEED : POSIX_MADV_RANDOM);
+    }
+#else
+    U_CFUNC void
+    uprv_adviseMemory(const void * /*start*/, int32_t /*length*/, int32_t /*advice*/) {
+    }
+#endif
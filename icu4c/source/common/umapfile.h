@@ -32,6 +32,39 @@
 U_CFUNC UBool uprv_mapFile(UDataMemory *pdm, const char *path, UErrorCode *status);
 U_CFUNC void  uprv_unmapFile(UDataMemory *pData);
 
+/**
+ * Expected access patterns for uprv_adviseMemory().
+ */
+enum {
+    /** The pages will be read in no particular order, so reading ahead is wasted. */
+    UMAP_ADVISE_RANDOM,
+    /** The pages will be read soon; start reading them in now. */
+    UMAP_ADVISE_WILLNEED,
+    /** Back the range with huge pages where possible, for fewer TLB misses. */
+    UMAP_ADVISE_HUGEPAGE
+};
+
+/**
+ * Tells the operating system how the given range of mapped data will be accessed.
+ * The range is extended to whole pages.
+ * This is only a hint: where it is not supported, or where it fails, nothing happens.
+ */
+U_CFUNC void  uprv_adviseMemory(const void *start, int32_t length, int32_t advice);
+
+/**
+ * \def U_MAP_HUGE_PAGES
+ * Set to 1 (for example, via CPPFLAGS) to have uprv_mapFile() map data files
+ * of at least 2MB at 2MB-aligned addresses and advise UMAP_ADVISE_HUGEPAGE
+ * instead of UMAP_ADVISE_RANDOM.
+ * This lets the Linux kernel use transparent huge pages for a large common data file
+ * where it supports them for file mappings, which can reduce TLB misses
+ * for data-heavy workloads. It may also read more of the file than is used.
+ * Default 0.
+ */
+#ifndef U_MAP_HUGE_PAGES
+#   define U_MAP_HUGE_PAGES 0
+#endif
+
 /* MAP_NONE: no memory mapping, no file access at all */
 #define MAP_NONE        0
 #define MAP_WIN32       1
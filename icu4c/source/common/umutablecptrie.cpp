@@ -17,6 +17,7 @@
 #include "cmemory.h"
 #include "uassert.h"
 #include "ucptrie_impl.h"
+#include "uhash.h"
 
 // ICU-20235 In case Microsoft math.h has defined this, undefine it.
 #ifdef OVERFLOW
@@ -771,24 +772,17 @@ class MixedBlocks {
     bool init(int32_t maxLength, int32_t newBlockLength) {
         // We store actual data indexes + 1 to reserve 0 for empty entries.
         int32_t maxDataIndex = maxLength - newBlockLength + 1;
-        int32_t newLength;
-        if (maxDataIndex <= 0xfff) {  // 4k
+        // Use just enough bits for the data indexes (at least 12, for 4k),
+        // and a prime table length about 1.5 times the maximum number of entries.
+        // maxDataIndex is up to around MAX_DATA_LENGTH, ca. 1.1M.
+        shift = 12;
+        while (maxDataIndex > ((1 << shift) - 1)) { ++shift; }
+        mask = ((uint32_t)1 << shift) - 1;
+        int32_t newLength = maxDataIndex + maxDataIndex / 2;
+        if (newLength < 6007) {
             newLength = 6007;
-            shift = 12;
-            mask = 0xfff;
-        } else if (maxDataIndex <= 0x7fff) {  // 32k
-            newLength = 50021;
-            shift = 15;
-            mask = 0x7fff;
-        } else if (maxDataIndex <= 0x1ffff) {  // 128k
-            newLength = 200003;
-            shift = 17;
-            mask = 0x1ffff;
         } else {
-            // maxDataIndex up to around MAX_DATA_LENGTH, ca. 1.1M
-            newLength = 1500007;
-            shift = 21;
-            mask = 0x1fffff;
+            newLength = nextPrime(newLength);
         }
         if (newLength > capacity) {
             uprv_free(table);
@@ -802,6 +796,11 @@ class MixedBlocks {
         uprv_memset(table, 0, length * 4);
 
         blockLength = newBlockLength;
+        // 37^(blockLength-1) for removing the first value from a rolling hash code.
+        firstFactor = 1;
+        for (int32_t i = 1; i < blockLength; ++i) {
+            firstFactor *= 37;
+        }
         return true;
     }
 
@@ -813,8 +812,15 @@ class MixedBlocks {
         } else {
             start = minStart;  // Begin with the first full block.
         }
-        for (int32_t end = newDataLength - blockLength; start <= end; ++start) {
-            uint32_t hashCode = makeHashCode(data, start);
+        int32_t end = newDataLength - blockLength;
+        if (start > end) { return; }
+        // Roll the hash code along the data rather than recomputing it
+        // over the whole block at each start index.
+        uint32_t hashCode = makeHashCode(data, start);
+        addEntry(data, start, hashCode, start);
+        while (start < end) {
+            hashCode = 37 * (hashCode - firstFactor * data[start]) + data[start + blockLength];
+            ++start;
             addEntry(data, start, hashCode, start);
         }
     }
@@ -906,6 +912,19 @@ class MixedBlocks {
         }
     }
 
+    static int32_t nextPrime(int32_t n) {
+        for (n |= 1;; n += 2) {
+            bool isPrime = true;
+            for (int32_t d = 3; d * d <= n; d += 2) {
+                if ((n % d) == 0) {
+                    isPrime = false;
+                    break;
+                }
+            }
+            if (isPrime) { return n; }
+        }
+    }
+
     inline int32_t nextIndex(int32_t initialEntryIndex, int32_t entryIndex) const {
         // U_ASSERT(0 < initialEntryIndex && initialEntryIndex < length);
         return (entryIndex + initialEntryIndex) % length;
@@ -922,6 +941,7 @@ class MixedBlocks {
     uint32_t mask = 0;
 
     int32_t blockLength = 0;
+    uint32_t firstFactor = 1;
 };
 
 int32_t MutableCodePointTrie::compactWholeDataBlocks(int32_t fastILimit, AllSameBlocks &allSameBlocks) {
@@ -940,6 +960,8 @@ int32_t MutableCodePointTrie::compactWholeDataBlocks(int32_t fastILimit, AllSame
     int32_t iLimit = highStart >> UCPTRIE_SHIFT_3;
     int32_t blockLength = UCPTRIE_FAST_DATA_BLOCK_LENGTH;
     int32_t inc = SMALL_DATA_BLOCKS_PER_BMP_BLOCK;
+    // Built when allSameBlocks first overflows.
+    LocalUHashtablePointer firstSameBlocks;
     for (int32_t i = 0; i < iLimit; i += inc) {
         if (i == fastILimit) {
             blockLength = UCPTRIE_SMALL_DATA_BLOCK_LENGTH;
@@ -991,24 +1013,38 @@ int32_t MutableCodePointTrie::compactWholeDataBlocks(int32_t fastILimit, AllSame
                 overflow = true;
             }
 #endif
-            int32_t jInc = SMALL_DATA_BLOCKS_PER_BMP_BLOCK;
-            for (int32_t j = 0;; j += jInc) {
-                if (j == i) {
-                    allSameBlocks.add(i, inc, value);
-                    break;
-                }
-                if (j == fastILimit) {
-                    jInc = 1;
-                }
-                if (flags[j] == ALL_SAME && index[j] == value) {
-                    allSameBlocks.add(j, jInc + inc, value);
-                    other = j;
-                    break;
-                    // We could keep counting blocks with the same value
-                    // before we add the first one, which may improve compaction in rare cases,
-                    // but it would make it slower.
+            // Map each value to the first earlier ALL_SAME block with that value,
+            // rather than scanning all earlier blocks for each overflow.
+            UErrorCode errorCode = U_ZERO_ERROR;
+            if (firstSameBlocks.isNull()) {
+                firstSameBlocks.adoptInstead(
+                    uhash_open(uhash_hashLong, uhash_compareLong, nullptr, &errorCode));
+                int32_t jInc = SMALL_DATA_BLOCKS_PER_BMP_BLOCK;
+                for (int32_t j = 0; j < i && U_SUCCESS(errorCode); j += jInc) {
+                    if (j == fastILimit) {
+                        jInc = 1;
+                    }
+                    if (flags[j] == ALL_SAME &&
+                            uhash_igeti(firstSameBlocks.getAlias(), (int32_t)index[j]) == 0) {
+                        // Store j + 1 because 0 means "not found".
+                        uhash_iputi(firstSameBlocks.getAlias(), (int32_t)index[j], j + 1, &errorCode);
+                    }
                 }
             }
+            if (U_FAILURE(errorCode)) {
+                return -1;
+            }
+            int32_t j = uhash_igeti(firstSameBlocks.getAlias(), (int32_t)value) - 1;
+            if (j >= 0) {
+                allSameBlocks.add(j, (j < fastILimit ? SMALL_DATA_BLOCKS_PER_BMP_BLOCK : 1) + inc,
+                                  value);
+                other = j;
+                // We could keep counting blocks with the same value
+                // before we add the first one, which may improve compaction in rare cases,
+                // but it would make it slower.
+            } else {
+                allSameBlocks.add(i, inc, value);
+            }
         }
         if (other >= 0) {
             flags[i] = SAME_AS;
@@ -1016,6 +1052,13 @@ int32_t MutableCodePointTrie::compactWholeDataBlocks(int32_t fastILimit, AllSame
         } else {
             // New unique same-value block.
             newDataCapacity += blockLength;
+            if (firstSameBlocks.isValid()) {
+                UErrorCode errorCode = U_ZERO_ERROR;
+                uhash_iputi(firstSameBlocks.getAlias(), (int32_t)value, i + 1, &errorCode);
+                if (U_FAILURE(errorCode)) {
+                    return -1;
+                }
+            }
         }
     }
     return newDataCapacity;
@@ -22,10 +22,15 @@
 
 #include "umutex.h"
 
+#if U_ENABLE_TRACING
+#include <chrono>
+#endif
+
 #include "unicode/utypes.h"
 #include "uassert.h"
 #include "ucln_cmn.h"
 #include "cmemory.h"
+#include "utracimp.h"
 
 U_NAMESPACE_BEGIN
 
@@ -103,6 +108,21 @@ std::mutex *UMutex::getMutex() {
 
 UMutex *UMutex::gListHead = nullptr;
 
+#if U_ENABLE_TRACING
+void UMutex::lockContended(std::mutex *m) {
+    UTRACE_ENTRY(UTRACE_UMTX_LOCK_WAIT);
+    auto start = std::chrono::steady_clock::now();
+    m->lock();
+    int64_t waitNanos = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start).count();
+    ++fContentionCount;
+    fWaitNanos += waitNanos;
+    UTRACE_DATA5(UTRACE_VERBOSE, "mutex %p waited %l ns (total %l ns), %d of %d acquisitions contended",
+                 this, waitNanos, fWaitNanos, fContentionCount, fAcquisitionCount + 1);
+    UTRACE_EXIT();
+}
+#endif
+
 void UMutex::cleanup() {
     UMutex *next = nullptr;
     for (UMutex *m = gListHead; m != nullptr; m = next) {
@@ -223,7 +223,12 @@ class U_COMMON_API UMutex {
     void lock() {
         std::mutex *m = fMutex.load(std::memory_order_acquire);
         if (m == nullptr) { m = getMutex(); }
+#if U_ENABLE_TRACING
+        if (!m->try_lock()) { lockContended(m); }
+        ++fAcquisitionCount;
+#else
         m->lock();
+#endif
     }
     void unlock() { fMutex.load(std::memory_order_relaxed)->unlock(); }
 
@@ -243,6 +248,16 @@ class U_COMMON_API UMutex {
      * Initial fast check is inline, in lock().
      */
     std::mutex *getMutex();
+
+#if U_ENABLE_TRACING
+    /** Contention statistics for UTRACE_UMTX_LOCK_WAIT, only modified while the mutex is held. */
+    int32_t fAcquisitionCount;
+    int32_t fContentionCount;
+    int64_t fWaitNanos;
+
+    /** Out-of-line, traced slow path of lock() when the mutex is already held. */
+    void lockContended(std::mutex *m);
+#endif
 };
 
 
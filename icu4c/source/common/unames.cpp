@@ -107,6 +107,22 @@ static UDataMemory *uCharNamesData=NULL;
 static UCharNames *uCharNames=NULL;
 static icu::UInitOnce gCharNamesInitOnce = U_INITONCE_INITIALIZER;
 
+/*
+ * Index from character names to code points, for u_charFromName().
+ * Built the first time a name is looked up for a name choice.
+ * The table is an open-addressing hash table with linear probing,
+ * keyed by the hash of the name. It stores only code points;
+ * lookups verify a candidate by comparing with its name in the data.
+ * Names are inserted in code point order, so that the first match is the
+ * lowest code point, as with the linear search through all names.
+ */
+struct NameIndex {
+    UChar32 *fTable=nullptr;  /* code points, -1 for empty slots */
+    uint32_t fMask=0;
+    icu::UInitOnce fInitOnce=U_INITONCE_INITIALIZER;
+};
+static NameIndex gNameIndexes[U_CHAR_NAME_CHOICE_COUNT];
+
 /*
  * Maximum length of character names (regular & 1.0).
  */
@@ -172,6 +188,12 @@ static UBool U_CALLCONV unames_cleanup(void)
         uCharNames = NULL;
     }
     gCharNamesInitOnce.reset();
+    for(NameIndex &index : gNameIndexes) {
+        uprv_free(index.fTable);
+        index.fTable=NULL;
+        index.fMask=0;
+        index.fInitOnce.reset();
+    }
     gMaxNameLength=0;
     return TRUE;
 }
@@ -1440,6 +1462,103 @@ calcNameSetsLengths(UErrorCode *pErrorCode) {
     return TRUE;
 }
 
+/* name index for u_charFromName() ------------------------------------------ */
+
+/*
+ * Builds the name index for one name choice.
+ * Algorithmic names and extended names are not indexed;
+ * u_charFromName() handles them before using the index.
+ */
+static void U_CALLCONV
+buildNameIndex(UCharNameChoice nameChoice, UErrorCode &errorCode) {
+    NameIndex &index=gNameIndexes[nameChoice];
+    const uint16_t *group=GET_GROUPS(uCharNames);
+    uint16_t groupCount=*group++;
+
+    /* collect the hashes and code points of all names, in code point order */
+    int32_t capacity=groupCount*LINES_PER_GROUP;
+    int32_t *hashes=(int32_t *)uprv_malloc(capacity*4);
+    UChar32 *codes=(UChar32 *)uprv_malloc(capacity*4);
+    if(hashes==NULL || codes==NULL) {
+        uprv_free(hashes);
+        uprv_free(codes);
+        errorCode=U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    int32_t count=0;
+    while(groupCount>0) {
+        uint16_t offsets[LINES_PER_GROUP+2], lengths[LINES_PER_GROUP+2];
+        const uint8_t *s=(uint8_t *)uCharNames+uCharNames->groupStringOffset+GET_GROUP_OFFSET(group);
+        s=expandGroupLengths(s, offsets, lengths);
+        UChar32 start=(UChar32)group[GROUP_MSB]<<GROUP_SHIFT;
+        for(int32_t line=0; line<LINES_PER_GROUP; ++line) {
+            char buffer[200];
+            uint16_t length=expandName(uCharNames, s+offsets[line], lengths[line], nameChoice,
+                                       buffer, sizeof(buffer));
+            if(length>0 && length<sizeof(buffer)) {
+                hashes[count]=ustr_hashCharsN(buffer, length);
+                codes[count++]=start+line;
+            }
+        }
+        group=NEXT_GROUP(group);
+        --groupCount;
+    }
+
+    /* load factor at most 3/4 */
+    uint32_t tableLength=1024;
+    while((int64_t)tableLength*3<(int64_t)count*4) {
+        tableLength<<=1;
+    }
+    UChar32 *table=(UChar32 *)uprv_malloc(tableLength*4);
+    if(table==NULL) {
+        uprv_free(hashes);
+        uprv_free(codes);
+        errorCode=U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    uprv_memset(table, 0xff, tableLength*4);
+    uint32_t mask=tableLength-1;
+    for(int32_t i=0; i<count; ++i) {
+        uint32_t slot=(uint32_t)hashes[i]&mask;
+        while(table[slot]>=0) {
+            slot=(slot+1)&mask;
+        }
+        table[slot]=codes[i];
+    }
+    uprv_free(hashes);
+    uprv_free(codes);
+    index.fTable=table;
+    index.fMask=mask;
+}
+
+/*
+ * Finds the code point with the given name (all uppercase, length>0)
+ * via the name index. Returns -1 if there is no such name.
+ */
+static UChar32
+findNameInIndex(UCharNameChoice nameChoice, const char *otherName, int32_t length,
+                UErrorCode *pErrorCode) {
+    NameIndex &index=gNameIndexes[nameChoice];
+    umtx_initOnce(index.fInitOnce, &buildNameIndex, nameChoice, *pErrorCode);
+    if(U_FAILURE(*pErrorCode)) {
+        return -1;
+    }
+    uint32_t slot=(uint32_t)ustr_hashCharsN(otherName, length)&index.fMask;
+    UChar32 code;
+    while((code=index.fTable[slot])>=0) {
+        const uint16_t *group=getGroup(uCharNames, code);
+        uint16_t offsets[LINES_PER_GROUP+2], lengths[LINES_PER_GROUP+2];
+        const uint8_t *s=(uint8_t *)uCharNames+uCharNames->groupStringOffset+GET_GROUP_OFFSET(group);
+        s=expandGroupLengths(s, offsets, lengths);
+        if(compareName(uCharNames, s+offsets[code&GROUP_MASK], lengths[code&GROUP_MASK],
+                       nameChoice, otherName)) {
+            return code;
+        }
+        slot=(slot+1)&index.fMask;
+    }
+    return -1;
+}
+
 U_NAMESPACE_END
 
 /* public API --------------------------------------------------------------- */
@@ -1520,7 +1639,6 @@ u_charFromName(UCharNameChoice nameChoice,
                const char *name,
                UErrorCode *pErrorCode) {
     char upper[120], lower[120];
-    FindName findName;
     AlgorithmicRange *algRange;
     uint32_t *p;
     uint32_t i;
@@ -1620,14 +1738,15 @@ u_charFromName(UCharNameChoice nameChoice,
         --i;
     }
 
-    /* normal character name */
-    findName.otherName=upper;
-    findName.code=error;
-    enumNames(uCharNames, 0, UCHAR_MAX_VALUE + 1, DO_FIND_NAME, &findName, nameChoice);
-    if (findName.code == error) {
-         *pErrorCode = U_ILLEGAL_CHAR_FOUND;
+    /* normal character name, via the name index */
+    cp = findNameInIndex(nameChoice, upper, (int32_t)uprv_strlen(upper), pErrorCode);
+    if (cp < 0) {
+        if (U_SUCCESS(*pErrorCode)) {
+            *pErrorCode = U_ILLEGAL_CHAR_FOUND;
+        }
+        return error;
     }
-    return findName.code;
+    return cp;
 }
 
 U_CAPI void U_EXPORT2
@@ -60,6 +60,7 @@ class U_COMMON_API BytesTrieBuilder : public StringTrieBuilder {
      * The byte sequence must be unique.
      * The bytes will be copied; the builder does not keep
      * a reference to the input StringPiece or its data().
+     * Building is faster when the byte sequences are added in ascending (unsigned) byte order.
      * @param s The input byte sequence.
      * @param value The value associated with this byte sequence.
      * @param errorCode Standard ICU error code. Its input value must
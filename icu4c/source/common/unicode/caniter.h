@@ -83,6 +83,24 @@ class U_COMMON_API CanonicalIterator U_FINAL : public UObject {
      */
     CanonicalIterator(const UnicodeString &source, UErrorCode &status);
 
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Construct a CanonicalIterator object which returns at most maxResults strings.
+     * The number of canonically equivalent strings grows factorially with the number
+     * of combining marks. With a limit, the equivalents of each segment of the source
+     * are generated only up to the limit, which bounds the time and memory
+     * used for such input.
+     * The iterator then returns a subset of the canonically equivalent strings,
+     * starting with the NFD form of the source.
+     * The limit also applies to later setSource() calls.
+     * @param source        string to get results for
+     * @param maxResults    the maximum number of strings returned by next(); must be positive
+     * @param status        Fill-in parameter which receives the status of this operation.
+     * @draft ICU 65
+     */
+    CanonicalIterator(const UnicodeString &source, int32_t maxResults, UErrorCode &status);
+#endif  /* U_HIDE_DRAFT_API */
+
     /** Destructor
      *  Cleans pieces
      * @stable ICU 2.4
@@ -169,6 +187,10 @@ class U_COMMON_API CanonicalIterator U_FINAL : public UObject {
     UnicodeString source;
     UBool done;
 
+    // at most this many strings are generated per segment, and returned by next()
+    int32_t maxResults;
+    int32_t resultCount;
+
     // 2 dimensional array holds the pieces of the string with
     // their different canonically equivalent representations
     UnicodeString **pieces;
@@ -203,6 +225,9 @@ class U_COMMON_API CanonicalIterator U_FINAL : public UObject {
 
     void cleanPieces();
 
+    static void permute(UnicodeString &source, UBool skipZeros, Hashtable *result,
+                        int32_t maxResults, UErrorCode &status);
+
 };
 
 U_NAMESPACE_END
@@ -152,6 +152,16 @@ class U_COMMON_API Edits U_FINAL : public UMemory {
      * @stable ICU 59
      */
     void addReplace(int32_t oldLength, int32_t newLength);
+#ifndef U_HIDE_INTERNAL_API
+    /**
+     * Adds count change edits of the same lengths.
+     * Same as calling addReplace(oldLength, newLength) count times, but short changes
+     * are recorded in bulk.
+     * Normally called from inside ICU string transformation functions, not user code.
+     * @internal
+     */
+    void addRepeatedReplace(int32_t oldLength, int32_t newLength, int32_t count);
+#endif  // U_HIDE_INTERNAL_API
     /**
      * Sets the UErrorCode if an error occurred while recording edits.
      * Preserves older error codes in the outErrorCode.
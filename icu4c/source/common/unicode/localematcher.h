@@ -0,0 +1,149 @@
+// © 2019 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html#License
+
+// localematcher.h
+
+#ifndef __LOCALEMATCHER_H__
+#define __LOCALEMATCHER_H__
+
+#include "unicode/utypes.h"
+
+#if U_SHOW_CPLUSPLUS_API
+
+#include "unicode/locid.h"
+#include "unicode/stringpiece.h"
+#include "unicode/uobject.h"
+
+#ifndef U_HIDE_DRAFT_API
+/**
+ * \file
+ * \brief C++ API: Locale matcher: selects the best matching locale from a supported list.
+ */
+
+struct UHashtable;
+
+U_NAMESPACE_BEGIN
+
+/**
+ * Immutable class that picks the best match between a user's desired locales and
+ * an application's supported locales.
+ *
+ * The supported locales are analyzed once when the matcher is constructed:
+ * each one is maximized with likely subtags (see Locale::addLikelySubtags())
+ * and indexed by its language, script and region.
+ * Each desired locale is then maximized the same way and looked up in that index,
+ * so that matching does not depend on the number of supported locales.
+ *
+ * A desired locale matches a supported locale if their maximized language and script
+ * subtags are equal. For example, "en-GB" matches "en" and "en-US",
+ * "zh-TW" matches "zh-Hant" but not "zh", and "sr-ME" matches "sr-Latn".
+ * Among the supported locales with the same language and script,
+ * the one with the same maximized region is preferred;
+ * otherwise the one that maximizes to the likely region of that language and script;
+ * otherwise the first one in the supported list.
+ *
+ * When there are several desired locales, they are tried in order,
+ * and the first one that matches any supported locale wins.
+ *
+ * This class is thread-safe once constructed.
+ *
+ * Example:
+ * <pre>
+ * UErrorCode errorCode = U_ZERO_ERROR;
+ * Locale supported[] = { Locale("fr"), Locale("en-GB"), Locale("en") };
+ * LocaleMatcher matcher(supported, 3, errorCode);
+ * const Locale *best = matcher.getBestMatchForListString("de-CH, en-GB;q=0.8, fr;q=0.5", errorCode);
+ * // best points to the matcher's copy of the "en-GB" Locale
+ * </pre>
+ *
+ * @draft ICU 65
+ */
+class U_COMMON_API LocaleMatcher : public UMemory {
+public:
+    /**
+     * Constructs a matcher for the supported locales.
+     * The locales are copied.
+     *
+     * @param supportedLocales the supported locales, in order of preference
+     * @param length the number of supported locales
+     * @param errorCode ICU error code. Its input value must pass the U_SUCCESS() test,
+     *                  or else the function returns immediately. Check for U_FAILURE()
+     *                  on output or use with function chaining. (See User Guide for details.)
+     * @draft ICU 65
+     */
+    LocaleMatcher(const Locale *supportedLocales, int32_t length, UErrorCode &errorCode);
+
+    /**
+     * Destructor.
+     * @draft ICU 65
+     */
+    ~LocaleMatcher();
+
+    /**
+     * Returns the supported locale which best matches the desired locale.
+     *
+     * @param desiredLocale Typically a user's language.
+     * @param errorCode ICU error code. Its input value must pass the U_SUCCESS() test,
+     *                  or else the function returns immediately. Check for U_FAILURE()
+     *                  on output or use with function chaining. (See User Guide for details.)
+     * @return a pointer to the best-matching supported locale, owned by this matcher,
+     *         or nullptr if there is no match
+     * @draft ICU 65
+     */
+    const Locale *getBestMatch(const Locale &desiredLocale, UErrorCode &errorCode) const;
+
+    /**
+     * Returns the supported locale which best matches one of the desired locales.
+     * Earlier desired locales take precedence over later ones.
+     *
+     * @param desiredLocales Typically a user's languages, in order of preference.
+     * @param length the number of desired locales
+     * @param errorCode ICU error code. Its input value must pass the U_SUCCESS() test,
+     *                  or else the function returns immediately. Check for U_FAILURE()
+     *                  on output or use with function chaining. (See User Guide for details.)
+     * @return a pointer to the best-matching supported locale, owned by this matcher,
+     *         or nullptr if there is no match
+     * @draft ICU 65
+     */
+    const Locale *getBestMatch(const Locale *desiredLocales, int32_t length,
+                               UErrorCode &errorCode) const;
+
+    /**
+     * Parses an HTTP Accept-Language list of language tags with optional weights,
+     * like "de-CH, fr;q=0.9, en;q=0.5", and returns the supported locale
+     * which best matches one of them.
+     * The tags are tried in order of decreasing weight; tags with equal weights
+     * keep their list order, and tags with a weight of 0 are ignored.
+     * Tags which are not well-formed, and the "*" wildcard, are ignored as well.
+     *
+     * @param desiredLocaleList Typically a user's languages, as an Accept-Language value.
+     * @param errorCode ICU error code. Its input value must pass the U_SUCCESS() test,
+     *                  or else the function returns immediately. Check for U_FAILURE()
+     *                  on output or use with function chaining. (See User Guide for details.)
+     * @return a pointer to the best-matching supported locale, owned by this matcher,
+     *         or nullptr if there is no match
+     * @draft ICU 65
+     */
+    const Locale *getBestMatchForListString(StringPiece desiredLocaleList,
+                                            UErrorCode &errorCode) const;
+
+private:
+    LocaleMatcher(const LocaleMatcher &other) = delete;
+    LocaleMatcher &operator=(const LocaleMatcher &other) = delete;
+
+    int32_t getBestMatchIndex(const Locale &desiredLocale, UErrorCode &errorCode) const;
+
+    Locale *supportedLocales;
+    int32_t supportedLength;
+    // Maps "lang_Script_REGION" and "lang_Script" of maximized supported locales
+    // to supportedLocales indexes + 1.
+    UHashtable *supportedIndexes;
+};
+
+U_NAMESPACE_END
+
+#endif  // U_HIDE_DRAFT_API
+
+#endif  // U_SHOW_CPLUSPLUS_API
+
+#endif  // __LOCALEMATCHER_H__
@@ -125,6 +125,22 @@ class U_COMMON_API LocaleDisplayNames : public UObject {
     virtual UnicodeString& localeDisplayName(const char* localeId,
                          UnicodeString& result) const = 0;
 
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Returns the display names of the provided locales.
+     * Equivalent to calling localeDisplayName() for each of them;
+     * the component names shared among the locales are looked up only once.
+     * @param locales the locales whose display names to return
+     * @param count the number of locales
+     * @param results receives the locales' display names;
+     *                must have room for count strings
+     * @return results
+     * @draft ICU 65
+     */
+    UnicodeString* localeDisplayNames(const Locale* locales, int32_t count,
+                                      UnicodeString* results) const;
+#endif  // U_HIDE_DRAFT_API
+
     // names for components of a locale id
     /**
      * Returns the display name of the provided language code.
@@ -37,7 +37,9 @@
 
 U_NAMESPACE_BEGIN
 
+class Appendable;
 class ByteSink;
+class CharString;
 
 /**
  * Unicode normalization functionality for standard Unicode normalization or
@@ -225,10 +227,10 @@ class U_COMMON_API Normalizer2 : public UObject {
      * Normalizes a UTF-8 string and optionally records how source substrings
      * relate to changed and unchanged result substrings.
      *
-     * Currently implemented completely only for "compose" modes,
-     * such as for NFC, NFKC, and NFKC_Casefold
-     * (UNORM2_COMPOSE and UNORM2_COMPOSE_CONTIGUOUS).
-     * Otherwise currently converts to & from UTF-16 and does not support edits.
+     * Currently implemented completely for the standard modes
+     * (UNORM2_COMPOSE, UNORM2_COMPOSE_CONTIGUOUS, UNORM2_DECOMPOSE and UNORM2_FCD).
+     * Otherwise, for example for custom subclasses,
+     * currently converts to & from UTF-16 and does not support edits.
      *
      * @param options   Options bit set, usually 0. See U_OMIT_UNCHANGED_TEXT and U_EDITS_NO_RESET.
      * @param src       Source UTF-8 string.
@@ -382,10 +384,9 @@ class U_COMMON_API Normalizer2 : public UObject {
      * at the cost of doing more work in those cases.
      *
      * This works for all normalization modes,
-     * but it is currently optimized for UTF-8 only for "compose" modes,
-     * such as for NFC, NFKC, and NFKC_Casefold
-     * (UNORM2_COMPOSE and UNORM2_COMPOSE_CONTIGUOUS).
-     * For other modes it currently converts to UTF-16 and calls isNormalized().
+     * and it is optimized for UTF-8 for the standard modes
+     * (UNORM2_COMPOSE, UNORM2_COMPOSE_CONTIGUOUS, UNORM2_DECOMPOSE and UNORM2_FCD).
+     * Otherwise it currently converts to UTF-16 and calls isNormalized().
      *
      * @param s UTF-8 input string
      * @param errorCode Standard ICU error code. Its input value must
@@ -398,6 +399,38 @@ class U_COMMON_API Normalizer2 : public UObject {
     virtual UBool
     isNormalizedUTF8(StringPiece s, UErrorCode &errorCode) const;
 
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Normalizes an array of UTF-8 strings into one contiguous output,
+     * for many short strings such as tags, names and identifiers
+     * where the setup for each separate call would dominate.
+     * Each string is quick-checked first. If it is already normalized,
+     * then it is copied without being transformed, or it is omitted
+     * if options includes U_OMIT_UNCHANGED_TEXT so that the caller can
+     * reference the input string instead.
+     *
+     * @param options   Options bit set, usually 0. See U_OMIT_UNCHANGED_TEXT.
+     * @param src       Array of count source UTF-8 strings.
+     * @param count     Number of source strings.
+     * @param sink      A ByteSink to which the results are written one after another.
+     *                  sink.Flush() is called at the end.
+     * @param destLimits If not nullptr, an array of count offsets:
+     *                  Result i is at [destLimits[i-1], destLimits[i]) in the output,
+     *                  starting at 0 for i=0.
+     * @param isNormalized If not nullptr, an array of count flags:
+     *                  isNormalized[i] is set to TRUE if src[i] was already normalized.
+     * @param errorCode Standard ICU error code. Its input value must
+     *                  pass the U_SUCCESS() test, or else the function returns
+     *                  immediately. Check for U_FAILURE() on output or use with
+     *                  function chaining. (See User Guide for details.)
+     * @draft ICU 65
+     */
+    void
+    normalizeUTF8Batch(uint32_t options, const StringPiece *src, int32_t count,
+                       ByteSink &sink, int32_t *destLimits, UBool *isNormalized,
+                       UErrorCode &errorCode) const;
+#endif  // U_HIDE_DRAFT_API
+
 
     /**
      * Tests if the string is normalized.
@@ -543,10 +576,10 @@ class U_COMMON_API FilteredNormalizer2 : public Normalizer2 {
      * Normalizes a UTF-8 string and optionally records how source substrings
      * relate to changed and unchanged result substrings.
      *
-     * Currently implemented completely only for "compose" modes,
-     * such as for NFC, NFKC, and NFKC_Casefold
-     * (UNORM2_COMPOSE and UNORM2_COMPOSE_CONTIGUOUS).
-     * Otherwise currently converts to & from UTF-16 and does not support edits.
+     * Currently implemented completely for the standard modes
+     * (UNORM2_COMPOSE, UNORM2_COMPOSE_CONTIGUOUS, UNORM2_DECOMPOSE and UNORM2_FCD).
+     * Otherwise, for example for custom subclasses,
+     * currently converts to & from UTF-16 and does not support edits.
      *
      * @param options   Options bit set, usually 0. See U_OMIT_UNCHANGED_TEXT and U_EDITS_NO_RESET.
      * @param src       Source UTF-8 string.
@@ -677,10 +710,9 @@ class U_COMMON_API FilteredNormalizer2 : public Normalizer2 {
      * at the cost of doing more work in those cases.
      *
      * This works for all normalization modes,
-     * but it is currently optimized for UTF-8 only for "compose" modes,
-     * such as for NFC, NFKC, and NFKC_Casefold
-     * (UNORM2_COMPOSE and UNORM2_COMPOSE_CONTIGUOUS).
-     * For other modes it currently converts to UTF-16 and calls isNormalized().
+     * and it is optimized for UTF-8 for the standard modes
+     * (UNORM2_COMPOSE, UNORM2_COMPOSE_CONTIGUOUS, UNORM2_DECOMPOSE and UNORM2_FCD).
+     * Otherwise it currently converts to UTF-16 and calls isNormalized().
      *
      * @param s UTF-8 input string
      * @param errorCode Standard ICU error code. Its input value must
@@ -770,6 +802,129 @@ class U_COMMON_API FilteredNormalizer2 : public Normalizer2 {
     const UnicodeSet &set;
 };
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Normalizes text that arrives in pieces, for example from a network connection,
+ * without first collecting it in one string.
+ *
+ * Each chunk is normalized up to the last normalization boundary in it
+ * (a character for which Normalizer2::hasBoundaryBefore() returns TRUE),
+ * and the result is written to the output.
+ * Only the text from that boundary to the end of the chunk is held back
+ * and normalized together with the start of the next chunk.
+ * Chunks may end in the middle of a UTF-16 surrogate pair or UTF-8 sequence.
+ * The concatenation of all of the output is the same as the normalization
+ * of the concatenation of all of the input.
+ *
+ * The held-back text is limited to about 1000 code units.
+ * If the text from the last boundary is longer than that
+ * (only possible with extremely long sequences of combining marks)
+ * it is normalized and written out anyway;
+ * the output then need not be the same as for the whole text.
+ *
+ * An instance handles one text at a time: Call normalizeChunk() for each chunk
+ * and finish() at the end, or normalizeChunkUTF8() and finishUTF8().
+ * Do not mix UTF-16 and UTF-8 input in one text.
+ * After finish() or finishUTF8() the object can be used for another text.
+ * An instance must not be used concurrently by multiple threads.
+ *
+ * \code
+ * StreamingNormalizer2 stream(*Normalizer2::getNFCInstance(errorCode));
+ * while (readChunk(chunk)) {
+ *     stream.normalizeChunkUTF8(chunk, sink, errorCode);
+ * }
+ * stream.finishUTF8(sink, errorCode);
+ * \endcode
+ *
+ * @draft ICU 65
+ */
+class U_COMMON_API StreamingNormalizer2 : public UMemory {
+public:
+    /**
+     * Constructor.
+     * @param n2 the Normalizer2 instance for the normalization form;
+     *           must outlive this object
+     * @draft ICU 65
+     */
+    explicit StreamingNormalizer2(const Normalizer2 &n2);
+
+    /**
+     * Destructor.
+     * @draft ICU 65
+     */
+    ~StreamingNormalizer2();
+
+    /**
+     * Normalizes the next chunk of UTF-16 text as far as possible,
+     * and appends the result to dest.
+     * @param chunk the next part of the text
+     * @param dest receives the normalized text so far
+     * @param errorCode Standard ICU error code. Its input value must
+     *                  pass the U_SUCCESS() test, or else the function returns
+     *                  immediately. Check for U_FAILURE() on output or use with
+     *                  function chaining. (See User Guide for details.)
+     * @draft ICU 65
+     */
+    void normalizeChunk(const UnicodeString &chunk, Appendable &dest, UErrorCode &errorCode);
+
+    /**
+     * Normalizes the held-back UTF-16 text at the end of the input
+     * and appends it to dest.
+     * @param dest receives the rest of the normalized text
+     * @param errorCode Standard ICU error code. Its input value must
+     *                  pass the U_SUCCESS() test, or else the function returns
+     *                  immediately. Check for U_FAILURE() on output or use with
+     *                  function chaining. (See User Guide for details.)
+     * @draft ICU 65
+     */
+    void finish(Appendable &dest, UErrorCode &errorCode);
+
+    /**
+     * Normalizes the next chunk of UTF-8 text as far as possible,
+     * and writes the result to the sink.
+     * @param chunk the next part of the text
+     * @param sink receives the normalized text so far
+     * @param errorCode Standard ICU error code. Its input value must
+     *                  pass the U_SUCCESS() test, or else the function returns
+     *                  immediately. Check for U_FAILURE() on output or use with
+     *                  function chaining. (See User Guide for details.)
+     * @draft ICU 65
+     */
+    void normalizeChunkUTF8(StringPiece chunk, ByteSink &sink, UErrorCode &errorCode);
+
+    /**
+     * Normalizes the held-back UTF-8 text at the end of the input
+     * and writes it to the sink.
+     * @param sink receives the rest of the normalized text
+     * @param errorCode Standard ICU error code. Its input value must
+     *                  pass the U_SUCCESS() test, or else the function returns
+     *                  immediately. Check for U_FAILURE() on output or use with
+     *                  function chaining. (See User Guide for details.)
+     * @draft ICU 65
+     */
+    void finishUTF8(ByteSink &sink, UErrorCode &errorCode);
+
+    /**
+     * Discards the held-back text, for starting over with another text
+     * without writing out the end of the current one.
+     * @draft ICU 65
+     */
+    void reset();
+
+private:
+    StreamingNormalizer2(const StreamingNormalizer2 &) = delete;
+    StreamingNormalizer2 &operator=(const StreamingNormalizer2 &) = delete;
+
+    void write(const UChar *s, int32_t length, Appendable &dest, UErrorCode &errorCode);
+    void writeUTF8(const char *s, int32_t length, ByteSink &sink, UErrorCode &errorCode);
+
+    const Normalizer2 &norm2;
+    UnicodeString pending;
+    UnicodeString normalized;
+    CharString *pending8;
+};
+#endif  // U_HIDE_DRAFT_API
+
 U_NAMESPACE_END
 
 #endif  // !UCONFIG_NO_NORMALIZATION
@@ -172,6 +172,13 @@ class U_COMMON_API RuleBasedBreakIterator /*U_FINAL*/ : public BreakIterator {
     /**
      * Copy constructor.  Will produce a break iterator with the same behavior,
      * and which iterates over the same text, as the one passed in.
+     *
+     * The compiled rules and the dictionary break engines are shared with the
+     * original, not copied, so this is a cheap way to get a private iterator.
+     * A RuleBasedBreakIterator that is only ever accessed as const can be shared
+     * between threads as a prototype: each thread copies it, for example into a
+     * local variable, and sets its own text on the copy.
+     *
      * @param that The RuleBasedBreakIterator passed to be copied
      * @stable ICU 2.0
      */
@@ -199,6 +206,11 @@ class U_COMMON_API RuleBasedBreakIterator /*U_FINAL*/ : public BreakIterator {
      * caller of this function.  The compiled rules must not be  modified or
      * deleted during the life of the break iterator.
      *
+     * The compiled rules are used in place, not copied, and they are not modified.
+     * They may therefore be in read-only memory that is shared among processes,
+     * such as a memory-mapped file or a shared memory segment filled by another
+     * process, so that the rule tables are stored only once.
+     *
      * The compiled rules are not compatible across different major versions of ICU.
      * The compiled rules are compatible only between machines with the same
      * byte ordering (little or big endian) and the same base character set family
@@ -512,6 +524,70 @@ class U_COMMON_API RuleBasedBreakIterator /*U_FINAL*/ : public BreakIterator {
     */
     virtual int32_t getRuleStatusVec(int32_t *fillInVec, int32_t capacity, UErrorCode &status);
 
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Advances the iterator over up to capacity boundaries at once,
+     * storing each boundary and optionally its rule status.
+     * The results are the same as from calling next() and getRuleStatus()
+     * up to capacity times, but the rules run directly for boundaries
+     * that are not cached yet, which is faster for forward iteration
+     * over text without dictionary-handled characters.
+     *
+     * Afterwards, the iterator is positioned on the last stored boundary,
+     * or at the end of the text if fewer than capacity boundaries were stored.
+     * Call again to continue.
+     *
+     * @param boundaries   an array to be filled in with boundary positions
+     * @param ruleStatuses an array to be filled in with the rule status of each boundary,
+     *                     as from getRuleStatus(); can be NULL
+     * @param capacity     the length of the arrays
+     * @param status       receives error codes
+     * @return the number of boundaries stored; fewer than capacity
+     *         only if the end of the text was reached
+     * @draft ICU 65
+     */
+    int32_t getBoundaries(int32_t *boundaries, int32_t *ruleStatuses, int32_t capacity,
+                          UErrorCode &status);
+
+    /**
+     * Turns the boundary index on or off. With the index, the iterator checkpoints
+     * every 16th rule-based boundary of its text as it moves through it, and
+     * following(), preceding() and isBoundary() at offsets away from the current
+     * position resume from the nearest checkpoint instead of recomputing boundaries
+     * near the offset. This makes heavy random access over long texts fast, notably
+     * for line break rules, at the cost of about half a byte per boundary.
+     *
+     * The index is discarded when the text is set, and when it is turned off.
+     * Copies of the iterator copy the index and this setting. The boundaries are
+     * the same whether or not the index is used. Off by default.
+     *
+     * @param enabled TRUE to keep a boundary index
+     * @see isBoundaryIndexEnabled
+     * @draft ICU 65
+     */
+    void setBoundaryIndexEnabled(UBool enabled);
+
+    /**
+     * Returns TRUE if this iterator keeps a boundary index.
+     * @return TRUE if the boundary index is on
+     * @see setBoundaryIndexEnabled
+     * @draft ICU 65
+     */
+    UBool isBoundaryIndexEnabled() const;
+
+    /**
+     * Sets a thread pool on which this iterator may segment very long runs of
+     * Chinese or Japanese text in parallel. The boundaries are the same with or
+     * without an executor. Copies of the iterator use the same executor.
+     * See ubrk_setExecutor() for details.
+     *
+     * @param executor function that schedules the tasks, or NULL (the default)
+     * @param executorContext passed verbatim to executor
+     * @draft ICU 65
+     */
+    void setExecutor(UBreakIteratorExecutor *executor, const void *executorContext);
+#endif  /* U_HIDE_DRAFT_API */
+
     /**
      * Returns a unique class ID POLYMORPHICALLY.  Pure virtual override.
      * This method is to implement a simple version of RTTI, since not all
@@ -658,6 +734,27 @@ class U_COMMON_API RuleBasedBreakIterator /*U_FINAL*/ : public BreakIterator {
      */
     int32_t handleNext();
 
+    /**
+     * handleNext() and handleSafePrevious() for one state table row format
+     * (8 or 16 bits per value) and one way of reading the text:
+     * through the UText, or directly from a contiguous UTF-16 or UTF-8 string.
+     * The text readers are defined in rbbi.cpp.
+     * @internal (private)
+     */
+    template<typename RowType, typename TextReader>
+    int32_t handleNextImpl(TextReader text);
+
+    /**
+     * Fast path for handleNext() for a pair of ASCII characters.
+     * @internal (private)
+     */
+    template<typename TextReader>
+    UBool handleNextAsciiPair(TextReader &text);
+
+    /** @internal (private) */
+    template<typename RowType, typename TextReader>
+    int32_t handleSafePreviousImpl(TextReader text, int32_t fromPosition);
+
 
     /**
      * This function returns the appropriate LanguageBreakEngine for a
@@ -1233,6 +1233,58 @@ ubidi_setPara(UBiDi *pBiDi, const UChar *text, int32_t length,
               UBiDiLevel paraLevel, UBiDiLevel *embeddingLevels,
               UErrorCode *pErrorCode);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Perform the Unicode Bidi algorithm on text after an edit of the text
+ * that was last passed to <code>ubidi_setPara()</code> or <code>ubidi_updatePara()</code>
+ * for this object.
+ * The result is the same as that of
+ * <code>ubidi_setPara(pBiDi, text, length, paraLevel, NULL, pErrorCode)</code>.<p>
+ *
+ * The edit replaced <code>deletedLength</code> code units at <code>start</code>
+ * of the previous text with the <code>insertedLength</code> code units at
+ * <code>start</code> of the new text; all other text must be unchanged.
+ * This is typically called by an editor after each keystroke, with the
+ * paragraph text edited in place.<p>
+ *
+ * For a single paragraph without explicit directional embeddings, overrides
+ * or isolates, without paired brackets, and with mixed directionality
+ * before and after the edit, only the levels between the strong
+ * characters on either side of the edit are resolved again.
+ * This requires the default reordering mode, no class callback, and neither
+ * <code>#UBIDI_OPTION_REMOVE_CONTROLS</code> nor <code>#UBIDI_OPTION_STREAMING</code>,
+ * and none of these may have changed since the previous call;
+ * if <code>paraLevel</code> is one of the default levels, then there must also
+ * be a strong character before the edit.
+ * Otherwise, and if the object does not hold the result of a previous
+ * call (for example after <code>ubidi_setLine()</code> on it), the whole text
+ * is processed as in <code>ubidi_setPara()</code>.
+ *
+ * @param pBiDi A <code>UBiDi</code> object allocated with <code>ubidi_open()</code>
+ *        which will be set to contain the reordering information,
+ *        especially the resolved levels for all the characters in <code>text</code>.
+ * @param text is a pointer to the edited text, as for <code>ubidi_setPara()</code>.
+ * @param length is the length of the text; if <code>length==-1</code> then
+ *        the text must be zero-terminated.
+ * @param paraLevel specifies the default level for the text, as for <code>ubidi_setPara()</code>;
+ *        the levels are only updated incrementally if this is the same value
+ *        as in the previous call.
+ * @param start is the index of the edit in both the previous and the new text.
+ * @param deletedLength is the number of code units that were removed from the previous text.
+ * @param insertedLength is the number of code units that were inserted at <code>start</code>.
+ *        The previous text must have been
+ *        <code>length-insertedLength+deletedLength</code> long.
+ * @param pErrorCode must be a valid pointer to an error code value.
+ * @see ubidi_setPara
+ * @draft ICU 65
+ */
+U_CAPI void U_EXPORT2
+ubidi_updatePara(UBiDi *pBiDi, const UChar *text, int32_t length,
+                 UBiDiLevel paraLevel,
+                 int32_t start, int32_t deletedLength, int32_t insertedLength,
+                 UErrorCode *pErrorCode);
+#endif  // U_HIDE_DRAFT_API
+
 /**
  * <code>ubidi_setLine()</code> sets a <code>UBiDi</code> to
  * contain the reordering information, especially the resolved levels,
@@ -279,6 +279,8 @@ ubrk_openRules(const UChar     *rules,
  *                    rules remains with the caller of this function. The compiled
  *                    rules must not be modified or deleted during the life of the
  *                    break iterator.
+ *                    They are used in place and not modified, so they may be in
+ *                    read-only memory that is shared among processes.
  * @param rulesLength The length of binaryRules in bytes; must be >= 0.
  * @param text        The text to be iterated over.  May be null, in which case
  *                    ubrk_setText() is used to specify the text to be iterated.
@@ -550,6 +552,81 @@ ubrk_getRuleStatus(UBreakIterator *bi);
 U_STABLE  int32_t U_EXPORT2
 ubrk_getRuleStatusVec(UBreakIterator *bi, int32_t *fillInVec, int32_t capacity, UErrorCode *status);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Advances the break iterator over up to capacity boundaries at once,
+ * storing each boundary and optionally its rule status.
+ * The results are the same as from calling ubrk_next() and ubrk_getRuleStatus()
+ * up to capacity times, but faster for rule-based break iterators.
+ * Afterwards, the iterator is positioned on the last stored boundary,
+ * or at the end of the text if fewer than capacity boundaries were stored.
+ *
+ * @param bi           The break iterator to use
+ * @param boundaries   an array to be filled in with boundary positions
+ * @param ruleStatuses an array to be filled in with the rule status of each boundary,
+ *                     as from ubrk_getRuleStatus(); can be NULL
+ * @param capacity     the length of the arrays
+ * @param status       receives error codes
+ * @return the number of boundaries stored; fewer than capacity
+ *         only if the end of the text was reached
+ * @draft ICU 65
+ */
+U_CAPI int32_t U_EXPORT2
+ubrk_getBoundaries(UBreakIterator *bi, int32_t *boundaries, int32_t *ruleStatuses,
+                   int32_t capacity, UErrorCode *status);
+
+/**
+ * Opaque unit of work created by a break iterator that has an executor.
+ * @see ubrk_setExecutor
+ * @draft ICU 65
+ */
+struct UBreakIteratorTask;
+typedef struct UBreakIteratorTask UBreakIteratorTask;  /**< C typedef for struct UBreakIteratorTask. @draft ICU 65 */
+
+/**
+ * Function type for handing break iterator tasks to a caller's thread pool.
+ * The function must arrange for ubrk_runTask() to be called
+ * exactly once for the task, on any thread. It may also call it directly.
+ *
+ * @param context the executorContext passed to ubrk_setExecutor()
+ * @param task the task to run
+ * @draft ICU 65
+ */
+typedef void U_CALLCONV
+UBreakIteratorExecutor(const void *context, UBreakIteratorTask *task);
+
+/**
+ * Sets a thread pool on which a rule-based break iterator may segment very long
+ * runs of Chinese or Japanese text in parallel. Such a run is cut into pieces only
+ * where that does not change its boundaries, so the boundaries are the same with
+ * or without an executor. The break iterator blocks until all of its tasks are done,
+ * so the executor must not run them on the thread that uses the break iterator
+ * after returning.
+ *
+ * Copies of the break iterator use the same executor. Break iterators that are
+ * not rule-based ignore it.
+ *
+ * @param bi The break iterator to use
+ * @param executor function that schedules the tasks,
+ *                 or NULL to segment all text on the calling thread (the default)
+ * @param executorContext passed verbatim to executor
+ * @param status receives error codes
+ * @draft ICU 65
+ */
+U_CAPI void U_EXPORT2
+ubrk_setExecutor(UBreakIterator *bi, UBreakIteratorExecutor *executor,
+                 const void *executorContext, UErrorCode *status);
+
+/**
+ * Runs one break iterator task. Called by the executor passed to ubrk_setExecutor().
+ *
+ * @param task the task to run
+ * @draft ICU 65
+ */
+U_CAPI void U_EXPORT2
+ubrk_runTask(UBreakIteratorTask *task);
+#endif  /* U_HIDE_DRAFT_API */
+
 /**
  * Return the locale of the break iterator. You can choose between the valid and
  * the actual locale.
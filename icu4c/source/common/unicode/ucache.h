@@ -0,0 +1,139 @@
+// © 2019 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+
+// ucache.h
+
+#ifndef __UCACHE_H__
+#define __UCACHE_H__
+
+#include "unicode/utypes.h"
+
+#ifndef U_HIDE_DRAFT_API
+
+/**
+ * \file
+ * \brief C API: Statistics of ICU's internal object cache.
+ *
+ * ICU keeps frequently used, expensive to build objects such as number
+ * format data, date format symbols, plural rules and collation tailorings
+ * in one process-wide cache. These functions return snapshots of that
+ * cache's counters, for example for export to a metrics system.
+ *
+ * All functions are thread-safe. The counters are cumulative over the
+ * lifetime of the cache, which starts with the first use of the cache and
+ * ends with u_cleanup().
+ */
+
+/**
+ * A snapshot of the counters of ICU's object cache.
+ * @see ucache_getStats
+ * @draft ICU 65
+ */
+typedef struct UCacheStats {
+    /**
+     * Number of lookups that found a completed cache entry,
+     * including hitsWithoutLock.
+     * @draft ICU 65
+     */
+    int64_t hits;
+    /**
+     * Number of hits that were served without taking any mutex.
+     * @draft ICU 65
+     */
+    int64_t hitsWithoutLock;
+    /**
+     * Number of lookups that had to create the object.
+     * @draft ICU 65
+     */
+    int64_t misses;
+    /**
+     * Number of lookups that waited for another thread to finish creating
+     * the same object.
+     * @draft ICU 65
+     */
+    int64_t inProgressWaits;
+    /**
+     * Total time in nanoseconds spent in those waits.
+     * @draft ICU 65
+     */
+    int64_t inProgressWaitNanos;
+    /**
+     * Number of entries evicted automatically to honor the eviction policy.
+     * Entries removed by flushing are not included.
+     * @draft ICU 65
+     */
+    int64_t evictions;
+    /**
+     * Approximate number of bytes used by the cached objects.
+     * @draft ICU 65
+     */
+    int64_t memoryFootprint;
+    /**
+     * Current number of keys in the cache.
+     * @draft ICU 65
+     */
+    int32_t keyCount;
+    /**
+     * Current number of keys whose values are not in use outside the cache.
+     * @draft ICU 65
+     */
+    int32_t unusedCount;
+} UCacheStats;
+
+/**
+ * Cache counters for all keys that map to one type of cached object.
+ * @see ucache_getKeyTypeStats
+ * @draft ICU 65
+ */
+typedef struct UCacheKeyTypeStats {
+    /**
+     * Implementation-specific name of the cached object type, as reported
+     * by the C++ runtime. The string has static storage duration.
+     * @draft ICU 65
+     */
+    const char *typeName;
+    /**
+     * Current number of keys of this type.
+     * @draft ICU 65
+     */
+    int32_t keyCount;
+    /**
+     * Approximate number of bytes used by the objects first created for
+     * keys of this type.
+     * @draft ICU 65
+     */
+    int64_t memoryFootprint;
+} UCacheKeyTypeStats;
+
+/**
+ * Fills in a snapshot of the counters of ICU's object cache.
+ * The snapshot is not atomic across shards of the cache, but each counter
+ * is consistent on its own.
+ *
+ * @param stats receives the snapshot
+ * @param status ICU error code in/out parameter.
+ *               Must fulfill U_SUCCESS before the function call.
+ * @draft ICU 65
+ */
+U_CAPI void U_EXPORT2
+ucache_getStats(UCacheStats *stats, UErrorCode *status);
+
+/**
+ * Fills in the current key and memory counts per type of cached object,
+ * in no particular order. Walks the whole cache, so it is more expensive
+ * than ucache_getStats().
+ *
+ * @param dest destination array, can be NULL if capacity==0
+ * @param capacity number of elements available at dest
+ * @param status ICU error code in/out parameter.
+ *               Must fulfill U_SUCCESS before the function call.
+ *               Set to U_BUFFER_OVERFLOW_ERROR if capacity is too small.
+ * @return the number of types in the cache, which may exceed capacity
+ * @draft ICU 65
+ */
+U_CAPI int32_t U_EXPORT2
+ucache_getKeyTypeStats(UCacheKeyTypeStats *dest, int32_t capacity, UErrorCode *status);
+
+#endif  // U_HIDE_DRAFT_API
+
+#endif  // __UCACHE_H__
@@ -2598,6 +2598,48 @@ u_hasBinaryProperty(UChar32 c, UProperty which);
 U_CAPI const USet * U_EXPORT2
 u_getBinaryPropertySet(UProperty property, UErrorCode *pErrorCode);
 
+/**
+ * Writes a binary property value for each code unit of a UTF-16 string.
+ * All code units of a code point get that code point's value;
+ * an unpaired surrogate gets the value of the surrogate code point.
+ * Same results as u_hasBinaryProperty() on each code point, in one pass over the string.
+ *
+ * @param s UTF-16 string
+ * @param length length of s, or -1 if NUL-terminated
+ * @param which UProperty selector constant, identifies which binary property to check.
+ *        Must be UCHAR_BINARY_START<=which<UCHAR_BINARY_LIMIT.
+ * @param dest destination array with at least as many elements as s has code units
+ * @param pErrorCode an in/out ICU UErrorCode; set to U_ILLEGAL_ARGUMENT_ERROR
+ *        if 'which' is not a binary property
+ * @return the number of code units in s (the number of values written)
+ * @see u_hasBinaryProperty
+ * @draft ICU 65
+ */
+U_CAPI int32_t U_EXPORT2
+u_hasBinaryProperties(const UChar *s, int32_t length, UProperty which,
+                      UBool *dest, UErrorCode *pErrorCode);
+
+/**
+ * Writes a binary property value for each byte of a UTF-8 string.
+ * All bytes of a code point get that code point's value;
+ * the bytes of an ill-formed sequence get FALSE.
+ * Same results as u_hasBinaryProperty() on each code point, in one pass over the string.
+ *
+ * @param s UTF-8 string
+ * @param length length of s in bytes, or -1 if NUL-terminated
+ * @param which UProperty selector constant, identifies which binary property to check.
+ *        Must be UCHAR_BINARY_START<=which<UCHAR_BINARY_LIMIT.
+ * @param dest destination array with at least as many elements as s has bytes
+ * @param pErrorCode an in/out ICU UErrorCode; set to U_ILLEGAL_ARGUMENT_ERROR
+ *        if 'which' is not a binary property
+ * @return the number of bytes in s (the number of values written)
+ * @see u_hasBinaryProperty
+ * @draft ICU 65
+ */
+U_CAPI int32_t U_EXPORT2
+u_hasBinaryPropertiesUTF8(const char *s, int32_t length, UProperty which,
+                          UBool *dest, UErrorCode *pErrorCode);
+
 #endif  // U_HIDE_DRAFT_API
 
 /**
@@ -2779,6 +2821,53 @@ u_getIntPropertyMap(UProperty property, UErrorCode *pErrorCode);
 
 #endif  // U_HIDE_DRAFT_API
 
+#ifndef U_HIDE_DRAFT_API
+
+/**
+ * Writes a snapshot of the character property structures that ICU otherwise
+ * builds at runtime from the Unicode property data: the sets returned by
+ * u_getBinaryPropertySet(), the maps returned by u_getIntPropertyMap(),
+ * and the internal range boundaries that UnicodeSet property patterns are built from.
+ * Builds all of them first.
+ *
+ * The snapshot is position-independent, so that a short-lived process can
+ * memory-map a file with the snapshot and pass it to u_setPropertySnapshot().
+ * It is tied to the ICU version, the Unicode version and the platform type.
+ *
+ * @param dest destination buffer, must be 4-aligned; can be NULL if capacity==0 for preflighting
+ * @param capacity capacity of dest in bytes
+ * @param pErrorCode an in/out ICU UErrorCode
+ * @return the length of the snapshot in bytes
+ * @see u_setPropertySnapshot
+ * @draft ICU 65
+ */
+U_CAPI int32_t U_EXPORT2
+u_writePropertySnapshot(void *dest, int32_t capacity, UErrorCode *pErrorCode);
+
+/**
+ * Makes ICU take the character property structures from a snapshot
+ * written by u_writePropertySnapshot(), rather than building them when they are first used.
+ * Structures that have already been built are not replaced.
+ * Call this early, before using character property sets and maps.
+ *
+ * The ICU data normally contains such a snapshot, which ICU uses
+ * unless this function was called first.
+ *
+ * The snapshot is not copied; it must remain valid until u_cleanup().
+ * Sets U_INVALID_FORMAT_ERROR if the snapshot was written by a different
+ * ICU version, for a different Unicode version or platform type, or if it is malformed.
+ *
+ * @param data the snapshot, must be 4-aligned
+ * @param length the length of the snapshot in bytes
+ * @param pErrorCode an in/out ICU UErrorCode
+ * @see u_writePropertySnapshot
+ * @draft ICU 65
+ */
+U_CAPI void U_EXPORT2
+u_setPropertySnapshot(const void *data, int32_t length, UErrorCode *pErrorCode);
+
+#endif  // U_HIDE_DRAFT_API
+
 /**
  * Get the numeric value for a Unicode code point as defined in the
  * Unicode Character Database.
@@ -3309,6 +3398,44 @@ u_getBidiPairedBracket(UChar32 c);
 U_STABLE int8_t U_EXPORT2
 u_charType(UChar32 c);
 
+#ifndef U_HIDE_DRAFT_API
+
+/**
+ * Writes the general category value for each code unit of a UTF-16 string.
+ * All code units of a code point get that code point's value;
+ * an unpaired surrogate gets the value of the surrogate code point (U_SURROGATE).
+ * Same results as u_charType() on each code point, in one pass over the string.
+ *
+ * @param s UTF-16 string
+ * @param length length of s, or -1 if NUL-terminated
+ * @param types destination array with at least as many elements as s has code units
+ * @param pErrorCode an in/out ICU UErrorCode
+ * @return the number of code units in s (the number of values written)
+ * @see u_charType
+ * @draft ICU 65
+ */
+U_CAPI int32_t U_EXPORT2
+u_charTypes(const UChar *s, int32_t length, int8_t *types, UErrorCode *pErrorCode);
+
+/**
+ * Writes the general category value for each byte of a UTF-8 string.
+ * All bytes of a code point get that code point's value;
+ * the bytes of an ill-formed sequence get U_UNASSIGNED.
+ * Same results as u_charType() on each code point, in one pass over the string.
+ *
+ * @param s UTF-8 string
+ * @param length length of s in bytes, or -1 if NUL-terminated
+ * @param types destination array with at least as many elements as s has bytes
+ * @param pErrorCode an in/out ICU UErrorCode
+ * @return the number of bytes in s (the number of values written)
+ * @see u_charType
+ * @draft ICU 65
+ */
+U_CAPI int32_t U_EXPORT2
+u_charTypesUTF8(const char *s, int32_t length, int8_t *types, UErrorCode *pErrorCode);
+
+#endif  // U_HIDE_DRAFT_API
+
 /**
  * Get a single-bit bit set for the general category of a character.
  * This bit set can be compared bitwise with U_GC_SM_MASK, U_GC_L_MASK, etc.
@@ -60,6 +60,7 @@ class U_COMMON_API UCharsTrieBuilder : public StringTrieBuilder {
      * The string must be unique.
      * The string contents will be copied; the builder does not keep
      * a reference to the input UnicodeString or its buffer.
+     * Building is faster when the strings are added in ascending code unit order.
      * @param s The input string.
      * @param value The value associated with this string.
      * @param errorCode Standard ICU error code. Its input value must
@@ -543,6 +543,56 @@ ucnv_safeClone(const UConverter *cnv,
                int32_t          *pBufferSize,
                UErrorCode       *status);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Initializes a converter in caller-provided memory from a prototype converter.
+ * This is like ucnv_safeClone() but intended for many short-lived converters
+ * per thread, for example one per task in a worker pool:
+ * The new converter borrows the prototype's shared, immutable conversion data
+ * without incrementing its reference count, which avoids the global lock that
+ * ucnv_safeClone() and ucnv_close() take for that.
+ * Neither the converter name nor the alias table is looked up again.
+ *
+ * The prototype is typically opened once with ucnv_open(),
+ * configured (callbacks, substitution string, fallbacks),
+ * and then only read, never used for conversion, while other threads
+ * initialize converters from it.
+ * It must not be closed while any converter initialized from it is still in use.
+ *
+ * Call this function with *pBufferSize==0 to get the required size;
+ * it then sets U_BUFFER_OVERFLOW_ERROR. The buffer need not be aligned.
+ * Unlike ucnv_safeClone(), this function does not allocate the converter
+ * if the buffer is too small: It sets U_BUFFER_OVERFLOW_ERROR and the required size.
+ * The size is the same for all converters initialized from the same prototype.
+ *
+ * The new converter starts with the conversion state of the prototype,
+ * normally the reset state.
+ * You must ucnv_close() the new converter when you are done with it;
+ * that releases any memory that it might have allocated
+ * (for example for a long substitution string) but never the buffer itself.
+ *
+ * Stateful encodings with their own sub-converters (for example ISO-2022)
+ * still reference-count those sub-converters.
+ *
+ * @param prototype the converter to copy; must not be NULL
+ * @param buffer caller-provided memory for the new converter;
+ *               may be NULL only if *pBufferSize==0
+ * @param pBufferSize pointer to the size of the buffer in bytes;
+ *                    set to the required size if that is larger
+ * @param status ICU error code in/out parameter.
+ *               Must fulfill U_SUCCESS before the function call.
+ * @return the new converter, located in buffer (not necessarily at its start),
+ *         or NULL if an error occurred
+ * @see ucnv_safeClone
+ * @draft ICU 65
+ */
+U_CAPI UConverter * U_EXPORT2
+ucnv_initFromPrototype(const UConverter *prototype,
+                       void             *buffer,
+                       int32_t          *pBufferSize,
+                       UErrorCode       *status);
+#endif  /* U_HIDE_DRAFT_API */
+
 #ifndef U_HIDE_DEPRECATED_API
 
 /**
@@ -136,6 +136,15 @@
 #define U_ENABLE_TRACING 0
 #endif
 
+/**
+ * \def U_ENABLE_COUNTERS
+ * Determines whether to maintain the per-thread counters of unicode/ucounter.h.
+ * @internal
+ */
+#ifndef U_ENABLE_COUNTERS
+#define U_ENABLE_COUNTERS 0
+#endif
+
 /**
  * \def UCONFIG_ENABLE_PLUGINS
  * Determines whether to enable ICU plugins.
@@ -0,0 +1,95 @@
+// © 2019 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+
+// ucounter.h
+
+#ifndef __UCOUNTER_H__
+#define __UCOUNTER_H__
+
+#include "unicode/utypes.h"
+
+#ifndef U_HIDE_DRAFT_API
+
+/**
+ * \file
+ * \brief C API: Per-thread counters of ICU-internal work.
+ *
+ * ICU can count, for each thread, how often it allocates memory, misses its
+ * object cache, opens data files, resource bundles and converters, and fetches
+ * Normalizer2 instances. Reading the counters before and after a unit of work
+ * on the same thread attributes that ICU overhead to the work.
+ *
+ * The counters are only maintained when ICU is built with U_ENABLE_COUNTERS
+ * defined to 1, for example with CPPFLAGS=-DU_ENABLE_COUNTERS=1; otherwise
+ * they always read 0. Each counter is a plain thread-local integer, so
+ * counting does not synchronize threads.
+ */
+
+/**
+ * The kinds of per-thread counters.
+ * @see ucounter_get
+ * @draft ICU 65
+ */
+typedef enum UCounterType {
+    /**
+     * Number of calls to ICU's internal malloc and realloc wrappers.
+     * @draft ICU 65
+     */
+    UCOUNTER_ALLOCATIONS,
+    /**
+     * Number of bytes requested by those calls.
+     * @draft ICU 65
+     */
+    UCOUNTER_ALLOCATED_BYTES,
+    /**
+     * Number of lookups in ICU's object cache that had to create the object.
+     * @see ucache_getStats
+     * @draft ICU 65
+     */
+    UCOUNTER_CACHE_MISSES,
+    /**
+     * Number of udata_open() and udata_openChoice() calls, including ICU-internal ones.
+     * @draft ICU 65
+     */
+    UCOUNTER_DATA_OPENS,
+    /**
+     * Number of resource bundles opened with ures_open() and related functions,
+     * including ICU-internal ones.
+     * @draft ICU 65
+     */
+    UCOUNTER_RESOURCE_BUNDLE_OPENS,
+    /**
+     * Number of converters created with ucnv_open() and related functions,
+     * including ICU-internal ones.
+     * @draft ICU 65
+     */
+    UCOUNTER_CONVERTER_OPENS,
+    /**
+     * Number of requests for Normalizer2 instances, including ICU-internal ones.
+     * @draft ICU 65
+     */
+    UCOUNTER_NORMALIZER2_FETCHES,
+#ifndef U_HIDE_INTERNAL_API
+    /**
+     * One more than the highest normal UCounterType value.
+     * @internal The numeric value may change over time, see ICU ticket #12420.
+     */
+    UCOUNTER_LIMIT
+#endif  // U_HIDE_INTERNAL_API
+} UCounterType;
+
+/**
+ * Returns the current value of one of the calling thread's counters.
+ * The counters start at 0 when a thread first uses ICU and are never reset,
+ * so callers compare values read before and after the work they measure.
+ *
+ * @param type the counter to read
+ * @return the counter value, or 0 if counters are not enabled or the type is out of range
+ * @draft ICU 65
+ */
+U_CAPI int64_t U_EXPORT2
+ucounter_get(UCounterType type);
+
+#endif  // U_HIDE_DRAFT_API
+
+#endif  // __UCOUNTER_H__
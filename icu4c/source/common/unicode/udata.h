@@ -21,6 +21,7 @@
 
 #include "unicode/utypes.h"
 #include "unicode/localpointer.h"
+#include "unicode/uenum.h"
 
 U_CDECL_BEGIN
 
@@ -413,6 +414,70 @@ typedef enum UDataFileAccess {
 U_STABLE void U_EXPORT2
 udata_setFileAccess(UDataFileAccess access, UErrorCode *status);
 
+#ifndef U_HIDE_DRAFT_API
+
+/**
+ * Asks the operating system to start reading the given items of the ICU common data
+ * into memory, so that opening them later does not wait for the storage.
+ * This is useful at application startup, for example for all of the collation data
+ * for a list of locales: U_ICUDATA_NAME "/coll/de.res", U_ICUDATA_NAME "/coll/fr.res".
+ *
+ * The item names are the names in the table of contents of the ICU common data,
+ * as returned by udata_openLoadedItems(). Only items in memory-mapped common data
+ * are prefetched; names that are not found are ignored. This is a hint, and it
+ * does not change the results of any ICU API.
+ *
+ * @param itemNames the names of the data items
+ * @param count the number of names
+ * @param pErrorCode ICU error code
+ * @return the number of items that were found in the ICU common data
+ * @see udata_openLoadedItems
+ * @draft ICU 65
+ */
+U_CAPI int32_t U_EXPORT2
+udata_prefetch(const char *const *itemNames, int32_t count, UErrorCode *pErrorCode);
+
+/**
+ * Returns an enumeration of the items of common data packages that this process
+ * has opened so far, in the order in which they were first opened,
+ * for example "icudt65l/coll/de.res".
+ * The names of ICU data items can be passed to udata_prefetch() in a later run
+ * of the application.
+ *
+ * @param pErrorCode ICU error code
+ * @return the item names; the caller must close it with uenum_close()
+ * @see udata_prefetch
+ * @draft ICU 65
+ */
+U_CAPI UEnumeration * U_EXPORT2
+udata_openLoadedItems(UErrorCode *pErrorCode);
+
+/**
+ * Publishes a data overlay: A common data package whose items replace
+ * the items of the same names in the ICU data, for example updated time zone data
+ * U_ICUDATA_NAME "/zoneinfo64.res" and U_ICUDATA_NAME "/metaZones.res",
+ * without restarting the process.
+ *
+ * The data is a common data package as for udata_setCommonData().
+ * It is not copied; it must remain valid until u_cleanup().
+ * Overlays published later take precedence over earlier ones.
+ * Each overlay starts a new data epoch: Data items that are opened afterwards
+ * come from the overlay, and ICU's caches of resource bundles and of objects
+ * built from the ICU data stop returning entries of earlier epochs.
+ * Objects that the application already holds keep using their data.
+ *
+ * This function is thread-safe, and it does not block other threads that use ICU data.
+ *
+ * @param data pointer to the common data package
+ * @param pErrorCode ICU error code
+ * @see udata_setCommonData
+ * @draft ICU 65
+ */
+U_CAPI void U_EXPORT2
+udata_publishOverlay(const void *data, UErrorCode *pErrorCode);
+
+#endif  /* U_HIDE_DRAFT_API */
+
 U_CDECL_END
 
 #if U_SHOW_CPLUSPLUS_API
@@ -392,15 +392,17 @@ class U_COMMON_API UnicodeSet U_FINAL : public UnicodeFilter {
      * @internal
      */
     enum ESerialization {
-      kSerialized  /* result of serialize() */
+      kSerialized,  /* result of serialize() */
+      kSerializedFrozen  /* result of serializeFrozen() */
     };
 
     /**
-     * Constructs a set from the output of serialize().
+     * Constructs a set from the output of serialize(),
+     * or a frozen set from the output of serializeFrozen().
      *
      * @param buffer the 16 bit array
-     * @param bufferLen the original length returned from serialize()
-     * @param serialization the value 'kSerialized'
+     * @param bufferLen the original length returned from serialize() or serializeFrozen()
+     * @param serialization the value 'kSerialized' or 'kSerializedFrozen'
      * @param status error code
      *
      * @internal
@@ -1459,6 +1461,26 @@ class U_COMMON_API UnicodeSet U_FINAL : public UnicodeFilter {
      */
     int32_t serialize(uint16_t *dest, int32_t destCapacity, UErrorCode& ec) const;
 
+#ifndef U_HIDE_INTERNAL_API
+    /**
+     * Serializes this set like serialize(), followed by the lookup tables
+     * that freeze() computes. The set constructed from the result with
+     * kSerializedFrozen is frozen and only copies those tables,
+     * which makes loading much faster than deserializing and freezing.
+     *
+     * The tables are written whether or not this set is frozen.
+     * Sets with strings are not supported (U_UNSUPPORTED_ERROR).
+     *
+     * @param dest pointer to buffer of destCapacity 16-bit integers.
+     * May be NULL only if destCapacity is zero.
+     * @param destCapacity size of dest, or zero.  Must not be negative.
+     * @param ec error code, as for serialize()
+     * @return the total length of the serialized format
+     * @internal
+     */
+    int32_t serializeFrozen(uint16_t *dest, int32_t destCapacity, UErrorCode& ec) const;
+#endif  /* U_HIDE_INTERNAL_API */
+
     /**
      * Reallocate this objects internal structures to take up the least
      * possible space, without changing this object's value.
@@ -191,6 +191,14 @@ class UnicodeStringAppendable;  // unicode/appendable.h
  *
  * sizeof(UnicodeString) >= 48 should work for all known platforms.
  *
+ * To change it, define UNISTR_OBJECT_SIZE when building ICU and all code that uses it,
+ * for example with CPPFLAGS=-DUNISTR_OBJECT_SIZE=96 for up to 43 char16_ts
+ * on a 64-bit machine. The value changes the layout of UnicodeString objects,
+ * so libraries and applications built with different values are not compatible.
+ * Short strings are copied, moved and swapped without heap allocation;
+ * test/perf/ustrperf (TestCopy, TestMoveAssign, TestFastCopy)
+ * measures the effect of a different size on a workload's strings.
+ *
  * For example, on a 64-bit machine where sizeof(vtable pointer) is 8,
  * sizeof(UnicodeString) = 64 would leave space for
  * (64 - sizeof(vtable pointer) - 2) / U_SIZEOF_UCHAR = (64 - 8 - 2) / 2 = 27
@@ -199,6 +199,7 @@
 #define res_getString U_ICU_ENTRY_POINT_RENAME(res_getString)
 #define res_getTableItemByIndex U_ICU_ENTRY_POINT_RENAME(res_getTableItemByIndex)
 #define res_getTableItemByKey U_ICU_ENTRY_POINT_RENAME(res_getTableItemByKey)
+#define res_hashTableKey U_ICU_ENTRY_POINT_RENAME(res_hashTableKey)
 #define res_load U_ICU_ENTRY_POINT_RENAME(res_load)
 #define res_read U_ICU_ENTRY_POINT_RENAME(res_read)
 #define res_unload U_ICU_ENTRY_POINT_RENAME(res_unload)
@@ -216,6 +217,8 @@
 #define u_charMirror U_ICU_ENTRY_POINT_RENAME(u_charMirror)
 #define u_charName U_ICU_ENTRY_POINT_RENAME(u_charName)
 #define u_charType U_ICU_ENTRY_POINT_RENAME(u_charType)
+#define u_charTypes U_ICU_ENTRY_POINT_RENAME(u_charTypes)
+#define u_charTypesUTF8 U_ICU_ENTRY_POINT_RENAME(u_charTypesUTF8)
 #define u_charsToUChars U_ICU_ENTRY_POINT_RENAME(u_charsToUChars)
 #define u_cleanup U_ICU_ENTRY_POINT_RENAME(u_cleanup)
 #define u_countChar32 U_ICU_ENTRY_POINT_RENAME(u_countChar32)
@@ -281,6 +284,8 @@
 #define u_getUnicodeVersion U_ICU_ENTRY_POINT_RENAME(u_getUnicodeVersion)
 #define u_getVersion U_ICU_ENTRY_POINT_RENAME(u_getVersion)
 #define u_get_stdout U_ICU_ENTRY_POINT_RENAME(u_get_stdout)
+#define u_hasBinaryProperties U_ICU_ENTRY_POINT_RENAME(u_hasBinaryProperties)
+#define u_hasBinaryPropertiesUTF8 U_ICU_ENTRY_POINT_RENAME(u_hasBinaryPropertiesUTF8)
 #define u_hasBinaryProperty U_ICU_ENTRY_POINT_RENAME(u_hasBinaryProperty)
 #define u_init U_ICU_ENTRY_POINT_RENAME(u_init)
 #define u_isIDIgnorable U_ICU_ENTRY_POINT_RENAME(u_isIDIgnorable)
@@ -316,6 +321,7 @@
 #define u_isxdigit U_ICU_ENTRY_POINT_RENAME(u_isxdigit)
 #define u_locbund_close U_ICU_ENTRY_POINT_RENAME(u_locbund_close)
 #define u_locbund_getNumberFormat U_ICU_ENTRY_POINT_RENAME(u_locbund_getNumberFormat)
+#define u_locbund_getNumberFormatVariant U_ICU_ENTRY_POINT_RENAME(u_locbund_getNumberFormatVariant)
 #define u_locbund_init U_ICU_ENTRY_POINT_RENAME(u_locbund_init)
 #define u_memcasecmp U_ICU_ENTRY_POINT_RENAME(u_memcasecmp)
 #define u_memchr U_ICU_ENTRY_POINT_RENAME(u_memchr)
@@ -338,6 +344,7 @@
 #define u_setDataDirectory U_ICU_ENTRY_POINT_RENAME(u_setDataDirectory)
 #define u_setMemoryFunctions U_ICU_ENTRY_POINT_RENAME(u_setMemoryFunctions)
 #define u_setMutexFunctions U_ICU_ENTRY_POINT_RENAME(u_setMutexFunctions)
+#define u_setPropertySnapshot U_ICU_ENTRY_POINT_RENAME(u_setPropertySnapshot)
 #define u_setTimeZoneFilesDirectory U_ICU_ENTRY_POINT_RENAME(u_setTimeZoneFilesDirectory)
 #define u_shapeArabic U_ICU_ENTRY_POINT_RENAME(u_shapeArabic)
 #define u_snprintf U_ICU_ENTRY_POINT_RENAME(u_snprintf)
@@ -354,6 +361,7 @@
 #define u_strFoldCase U_ICU_ENTRY_POINT_RENAME(u_strFoldCase)
 #define u_strFromJavaModifiedUTF8WithSub U_ICU_ENTRY_POINT_RENAME(u_strFromJavaModifiedUTF8WithSub)
 #define u_strFromPunycode U_ICU_ENTRY_POINT_RENAME(u_strFromPunycode)
+#define u_strFromPunycodeUTF8 U_ICU_ENTRY_POINT_RENAME(u_strFromPunycodeUTF8)
 #define u_strFromUTF32 U_ICU_ENTRY_POINT_RENAME(u_strFromUTF32)
 #define u_strFromUTF32WithSub U_ICU_ENTRY_POINT_RENAME(u_strFromUTF32WithSub)
 #define u_strFromUTF8 U_ICU_ENTRY_POINT_RENAME(u_strFromUTF8)
@@ -364,6 +372,7 @@
 #define u_strToJavaModifiedUTF8 U_ICU_ENTRY_POINT_RENAME(u_strToJavaModifiedUTF8)
 #define u_strToLower U_ICU_ENTRY_POINT_RENAME(u_strToLower)
 #define u_strToPunycode U_ICU_ENTRY_POINT_RENAME(u_strToPunycode)
+#define u_strToPunycodeUTF8 U_ICU_ENTRY_POINT_RENAME(u_strToPunycodeUTF8)
 #define u_strToTitle U_ICU_ENTRY_POINT_RENAME(u_strToTitle)
 #define u_strToUTF32 U_ICU_ENTRY_POINT_RENAME(u_strToUTF32)
 #define u_strToUTF32WithSub U_ICU_ENTRY_POINT_RENAME(u_strToUTF32WithSub)
@@ -422,6 +431,7 @@
 #define u_vsscanf U_ICU_ENTRY_POINT_RENAME(u_vsscanf)
 #define u_vsscanf_u U_ICU_ENTRY_POINT_RENAME(u_vsscanf_u)
 #define u_writeIdenticalLevelRun U_ICU_ENTRY_POINT_RENAME(u_writeIdenticalLevelRun)
+#define u_writePropertySnapshot U_ICU_ENTRY_POINT_RENAME(u_writePropertySnapshot)
 #define ubidi_addPropertyStarts U_ICU_ENTRY_POINT_RENAME(ubidi_addPropertyStarts)
 #define ubidi_close U_ICU_ENTRY_POINT_RENAME(ubidi_close)
 #define ubidi_countParagraphs U_ICU_ENTRY_POINT_RENAME(ubidi_countParagraphs)
@@ -454,6 +464,7 @@
 #define ubidi_getResultLength U_ICU_ENTRY_POINT_RENAME(ubidi_getResultLength)
 #define ubidi_getRuns U_ICU_ENTRY_POINT_RENAME(ubidi_getRuns)
 #define ubidi_getText U_ICU_ENTRY_POINT_RENAME(ubidi_getText)
+#define ubidi_getTrie U_ICU_ENTRY_POINT_RENAME(ubidi_getTrie)
 #define ubidi_getVisualIndex U_ICU_ENTRY_POINT_RENAME(ubidi_getVisualIndex)
 #define ubidi_getVisualMap U_ICU_ENTRY_POINT_RENAME(ubidi_getVisualMap)
 #define ubidi_getVisualRun U_ICU_ENTRY_POINT_RENAME(ubidi_getVisualRun)
@@ -475,6 +486,7 @@
 #define ubidi_setPara U_ICU_ENTRY_POINT_RENAME(ubidi_setPara)
 #define ubidi_setReorderingMode U_ICU_ENTRY_POINT_RENAME(ubidi_setReorderingMode)
 #define ubidi_setReorderingOptions U_ICU_ENTRY_POINT_RENAME(ubidi_setReorderingOptions)
+#define ubidi_updatePara U_ICU_ENTRY_POINT_RENAME(ubidi_updatePara)
 #define ubidi_writeReordered U_ICU_ENTRY_POINT_RENAME(ubidi_writeReordered)
 #define ubidi_writeReverse U_ICU_ENTRY_POINT_RENAME(ubidi_writeReverse)
 #define ubiditransform_close U_ICU_ENTRY_POINT_RENAME(ubiditransform_close)
@@ -488,6 +500,7 @@
 #define ubrk_following U_ICU_ENTRY_POINT_RENAME(ubrk_following)
 #define ubrk_getAvailable U_ICU_ENTRY_POINT_RENAME(ubrk_getAvailable)
 #define ubrk_getBinaryRules U_ICU_ENTRY_POINT_RENAME(ubrk_getBinaryRules)
+#define ubrk_getBoundaries U_ICU_ENTRY_POINT_RENAME(ubrk_getBoundaries)
 #define ubrk_getLocaleByType U_ICU_ENTRY_POINT_RENAME(ubrk_getLocaleByType)
 #define ubrk_getRuleStatus U_ICU_ENTRY_POINT_RENAME(ubrk_getRuleStatus)
 #define ubrk_getRuleStatusVec U_ICU_ENTRY_POINT_RENAME(ubrk_getRuleStatusVec)
@@ -500,20 +513,29 @@
 #define ubrk_preceding U_ICU_ENTRY_POINT_RENAME(ubrk_preceding)
 #define ubrk_previous U_ICU_ENTRY_POINT_RENAME(ubrk_previous)
 #define ubrk_refreshUText U_ICU_ENTRY_POINT_RENAME(ubrk_refreshUText)
+#define ubrk_runTask U_ICU_ENTRY_POINT_RENAME(ubrk_runTask)
 #define ubrk_safeClone U_ICU_ENTRY_POINT_RENAME(ubrk_safeClone)
+#define ubrk_setExecutor U_ICU_ENTRY_POINT_RENAME(ubrk_setExecutor)
 #define ubrk_setText U_ICU_ENTRY_POINT_RENAME(ubrk_setText)
 #define ubrk_setUText U_ICU_ENTRY_POINT_RENAME(ubrk_setUText)
 #define ubrk_swap U_ICU_ENTRY_POINT_RENAME(ubrk_swap)
 #define ucache_compareKeys U_ICU_ENTRY_POINT_RENAME(ucache_compareKeys)
 #define ucache_deleteKey U_ICU_ENTRY_POINT_RENAME(ucache_deleteKey)
+#define ucache_getKeyTypeStats U_ICU_ENTRY_POINT_RENAME(ucache_getKeyTypeStats)
+#define ucache_getStats U_ICU_ENTRY_POINT_RENAME(ucache_getStats)
 #define ucache_hashKeys U_ICU_ENTRY_POINT_RENAME(ucache_hashKeys)
+#define ucache_preload U_ICU_ENTRY_POINT_RENAME(ucache_preload)
+#define ucache_runPreloadTask U_ICU_ENTRY_POINT_RENAME(ucache_runPreloadTask)
+#define ucache_unpin U_ICU_ENTRY_POINT_RENAME(ucache_unpin)
 #define ucal_add U_ICU_ENTRY_POINT_RENAME(ucal_add)
 #define ucal_clear U_ICU_ENTRY_POINT_RENAME(ucal_clear)
 #define ucal_clearField U_ICU_ENTRY_POINT_RENAME(ucal_clearField)
 #define ucal_clone U_ICU_ENTRY_POINT_RENAME(ucal_clone)
 #define ucal_close U_ICU_ENTRY_POINT_RENAME(ucal_close)
 #define ucal_countAvailable U_ICU_ENTRY_POINT_RENAME(ucal_countAvailable)
+#define ucal_datesToFields U_ICU_ENTRY_POINT_RENAME(ucal_datesToFields)
 #define ucal_equivalentTo U_ICU_ENTRY_POINT_RENAME(ucal_equivalentTo)
+#define ucal_fieldsToDates U_ICU_ENTRY_POINT_RENAME(ucal_fieldsToDates)
 #define ucal_get U_ICU_ENTRY_POINT_RENAME(ucal_get)
 #define ucal_getAttribute U_ICU_ENTRY_POINT_RENAME(ucal_getAttribute)
 #define ucal_getAvailable U_ICU_ENTRY_POINT_RENAME(ucal_getAvailable)
@@ -675,6 +697,7 @@
 #define ucnv_getType U_ICU_ENTRY_POINT_RENAME(ucnv_getType)
 #define ucnv_getUnicodeSet U_ICU_ENTRY_POINT_RENAME(ucnv_getUnicodeSet)
 #define ucnv_incrementRefCount U_ICU_ENTRY_POINT_RENAME(ucnv_incrementRefCount)
+#define ucnv_initFromPrototype U_ICU_ENTRY_POINT_RENAME(ucnv_initFromPrototype)
 #define ucnv_io_countKnownConverters U_ICU_ENTRY_POINT_RENAME(ucnv_io_countKnownConverters)
 #define ucnv_io_getConverterName U_ICU_ENTRY_POINT_RENAME(ucnv_io_getConverterName)
 #define ucnv_io_stripASCIIForCompare U_ICU_ENTRY_POINT_RENAME(ucnv_io_stripASCIIForCompare)
@@ -719,6 +742,9 @@
 #define ucol_cloneBinary U_ICU_ENTRY_POINT_RENAME(ucol_cloneBinary)
 #define ucol_close U_ICU_ENTRY_POINT_RENAME(ucol_close)
 #define ucol_closeElements U_ICU_ENTRY_POINT_RENAME(ucol_closeElements)
+#define ucol_closeProbe U_ICU_ENTRY_POINT_RENAME(ucol_closeProbe)
+#define ucol_compareProbe U_ICU_ENTRY_POINT_RENAME(ucol_compareProbe)
+#define ucol_compareProbeUTF8 U_ICU_ENTRY_POINT_RENAME(ucol_compareProbeUTF8)
 #define ucol_countAvailable U_ICU_ENTRY_POINT_RENAME(ucol_countAvailable)
 #define ucol_equal U_ICU_ENTRY_POINT_RENAME(ucol_equal)
 #define ucol_equals U_ICU_ENTRY_POINT_RENAME(ucol_equals)
@@ -743,6 +769,9 @@
 #define ucol_getRulesEx U_ICU_ENTRY_POINT_RENAME(ucol_getRulesEx)
 #define ucol_getShortDefinitionString U_ICU_ENTRY_POINT_RENAME(ucol_getShortDefinitionString)
 #define ucol_getSortKey U_ICU_ENTRY_POINT_RENAME(ucol_getSortKey)
+#define ucol_getSortKeyUTF8 U_ICU_ENTRY_POINT_RENAME(ucol_getSortKeyUTF8)
+#define ucol_getSortKeys U_ICU_ENTRY_POINT_RENAME(ucol_getSortKeys)
+#define ucol_getSortKeysUTF8 U_ICU_ENTRY_POINT_RENAME(ucol_getSortKeysUTF8)
 #define ucol_getStrength U_ICU_ENTRY_POINT_RENAME(ucol_getStrength)
 #define ucol_getTailoredSet U_ICU_ENTRY_POINT_RENAME(ucol_getTailoredSet)
 #define ucol_getUCAVersion U_ICU_ENTRY_POINT_RENAME(ucol_getUCAVersion)
@@ -751,6 +780,7 @@
 #define ucol_getVersion U_ICU_ENTRY_POINT_RENAME(ucol_getVersion)
 #define ucol_greater U_ICU_ENTRY_POINT_RENAME(ucol_greater)
 #define ucol_greaterOrEqual U_ICU_ENTRY_POINT_RENAME(ucol_greaterOrEqual)
+#define ucol_initView U_ICU_ENTRY_POINT_RENAME(ucol_initView)
 #define ucol_keyHashCode U_ICU_ENTRY_POINT_RENAME(ucol_keyHashCode)
 #define ucol_looksLikeCollationBinary U_ICU_ENTRY_POINT_RENAME(ucol_looksLikeCollationBinary)
 #define ucol_mergeSortkeys U_ICU_ENTRY_POINT_RENAME(ucol_mergeSortkeys)
@@ -762,12 +792,15 @@
 #define ucol_openBinary U_ICU_ENTRY_POINT_RENAME(ucol_openBinary)
 #define ucol_openElements U_ICU_ENTRY_POINT_RENAME(ucol_openElements)
 #define ucol_openFromShortString U_ICU_ENTRY_POINT_RENAME(ucol_openFromShortString)
+#define ucol_openProbe U_ICU_ENTRY_POINT_RENAME(ucol_openProbe)
 #define ucol_openRules U_ICU_ENTRY_POINT_RENAME(ucol_openRules)
+#define ucol_openRulesCached U_ICU_ENTRY_POINT_RENAME(ucol_openRulesCached)
 #define ucol_prepareShortStringOpen U_ICU_ENTRY_POINT_RENAME(ucol_prepareShortStringOpen)
 #define ucol_previous U_ICU_ENTRY_POINT_RENAME(ucol_previous)
 #define ucol_primaryOrder U_ICU_ENTRY_POINT_RENAME(ucol_primaryOrder)
 #define ucol_reset U_ICU_ENTRY_POINT_RENAME(ucol_reset)
 #define ucol_restoreVariableTop U_ICU_ENTRY_POINT_RENAME(ucol_restoreVariableTop)
+#define ucol_runSortTask U_ICU_ENTRY_POINT_RENAME(ucol_runSortTask)
 #define ucol_safeClone U_ICU_ENTRY_POINT_RENAME(ucol_safeClone)
 #define ucol_secondaryOrder U_ICU_ENTRY_POINT_RENAME(ucol_secondaryOrder)
 #define ucol_setAttribute U_ICU_ENTRY_POINT_RENAME(ucol_setAttribute)
@@ -777,12 +810,19 @@
 #define ucol_setStrength U_ICU_ENTRY_POINT_RENAME(ucol_setStrength)
 #define ucol_setText U_ICU_ENTRY_POINT_RENAME(ucol_setText)
 #define ucol_setVariableTop U_ICU_ENTRY_POINT_RENAME(ucol_setVariableTop)
+#define ucol_setViewAttribute U_ICU_ENTRY_POINT_RENAME(ucol_setViewAttribute)
+#define ucol_sortStrings U_ICU_ENTRY_POINT_RENAME(ucol_sortStrings)
+#define ucol_sortStringsUTF8 U_ICU_ENTRY_POINT_RENAME(ucol_sortStringsUTF8)
 #define ucol_strcoll U_ICU_ENTRY_POINT_RENAME(ucol_strcoll)
 #define ucol_strcollIter U_ICU_ENTRY_POINT_RENAME(ucol_strcollIter)
 #define ucol_strcollUTF8 U_ICU_ENTRY_POINT_RENAME(ucol_strcollUTF8)
 #define ucol_swap U_ICU_ENTRY_POINT_RENAME(ucol_swap)
 #define ucol_swapInverseUCA U_ICU_ENTRY_POINT_RENAME(ucol_swapInverseUCA)
 #define ucol_tertiaryOrder U_ICU_ENTRY_POINT_RENAME(ucol_tertiaryOrder)
+#define ucol_viewGetSortKey U_ICU_ENTRY_POINT_RENAME(ucol_viewGetSortKey)
+#define ucol_viewStrcoll U_ICU_ENTRY_POINT_RENAME(ucol_viewStrcoll)
+#define ucol_viewStrcollUTF8 U_ICU_ENTRY_POINT_RENAME(ucol_viewStrcollUTF8)
+#define ucounter_get U_ICU_ENTRY_POINT_RENAME(ucounter_get)
 #define ucpmap_get U_ICU_ENTRY_POINT_RENAME(ucpmap_get)
 #define ucpmap_getRange U_ICU_ENTRY_POINT_RENAME(ucpmap_getRange)
 #define ucptrie_close U_ICU_ENTRY_POINT_RENAME(ucptrie_close)
@@ -866,19 +906,27 @@
 #define udat_toPatternRelativeTime U_ICU_ENTRY_POINT_RENAME(udat_toPatternRelativeTime)
 #define udat_unregisterOpener U_ICU_ENTRY_POINT_RENAME(udat_unregisterOpener)
 #define udata_checkCommonData U_ICU_ENTRY_POINT_RENAME(udata_checkCommonData)
+#define udata_cleanupTOCIndexes U_ICU_ENTRY_POINT_RENAME(udata_cleanupTOCIndexes)
 #define udata_close U_ICU_ENTRY_POINT_RENAME(udata_close)
 #define udata_closeSwapper U_ICU_ENTRY_POINT_RENAME(udata_closeSwapper)
+#define udata_findCommonItem U_ICU_ENTRY_POINT_RENAME(udata_findCommonItem)
+#define udata_getDataEpoch U_ICU_ENTRY_POINT_RENAME(udata_getDataEpoch)
 #define udata_getHeaderSize U_ICU_ENTRY_POINT_RENAME(udata_getHeaderSize)
 #define udata_getInfo U_ICU_ENTRY_POINT_RENAME(udata_getInfo)
 #define udata_getInfoSize U_ICU_ENTRY_POINT_RENAME(udata_getInfoSize)
 #define udata_getLength U_ICU_ENTRY_POINT_RENAME(udata_getLength)
 #define udata_getMemory U_ICU_ENTRY_POINT_RENAME(udata_getMemory)
 #define udata_getRawMemory U_ICU_ENTRY_POINT_RENAME(udata_getRawMemory)
+#define udata_isCompressedItem U_ICU_ENTRY_POINT_RENAME(udata_isCompressedItem)
+#define udata_isOverlaidSince U_ICU_ENTRY_POINT_RENAME(udata_isOverlaidSince)
 #define udata_open U_ICU_ENTRY_POINT_RENAME(udata_open)
 #define udata_openChoice U_ICU_ENTRY_POINT_RENAME(udata_openChoice)
+#define udata_openLoadedItems U_ICU_ENTRY_POINT_RENAME(udata_openLoadedItems)
 #define udata_openSwapper U_ICU_ENTRY_POINT_RENAME(udata_openSwapper)
 #define udata_openSwapperForInputData U_ICU_ENTRY_POINT_RENAME(udata_openSwapperForInputData)
+#define udata_prefetch U_ICU_ENTRY_POINT_RENAME(udata_prefetch)
 #define udata_printError U_ICU_ENTRY_POINT_RENAME(udata_printError)
+#define udata_publishOverlay U_ICU_ENTRY_POINT_RENAME(udata_publishOverlay)
 #define udata_readInt16 U_ICU_ENTRY_POINT_RENAME(udata_readInt16)
 #define udata_readInt32 U_ICU_ENTRY_POINT_RENAME(udata_readInt32)
 #define udata_setAppData U_ICU_ENTRY_POINT_RENAME(udata_setAppData)
@@ -886,6 +934,7 @@
 #define udata_setFileAccess U_ICU_ENTRY_POINT_RENAME(udata_setFileAccess)
 #define udata_swapDataHeader U_ICU_ENTRY_POINT_RENAME(udata_swapDataHeader)
 #define udata_swapInvStringBlock U_ICU_ENTRY_POINT_RENAME(udata_swapInvStringBlock)
+#define udata_uncompressItem U_ICU_ENTRY_POINT_RENAME(udata_uncompressItem)
 #define udatpg_addPattern U_ICU_ENTRY_POINT_RENAME(udatpg_addPattern)
 #define udatpg_clone U_ICU_ENTRY_POINT_RENAME(udatpg_clone)
 #define udatpg_close U_ICU_ENTRY_POINT_RENAME(udatpg_close)
@@ -1293,6 +1342,7 @@
 #define uprops_getSource U_ICU_ENTRY_POINT_RENAME(uprops_getSource)
 #define upropsvec_addPropertyStarts U_ICU_ENTRY_POINT_RENAME(upropsvec_addPropertyStarts)
 #define uprv_add32_overflow U_ICU_ENTRY_POINT_RENAME(uprv_add32_overflow)
+#define uprv_adviseMemory U_ICU_ENTRY_POINT_RENAME(uprv_adviseMemory)
 #define uprv_aestrncpy U_ICU_ENTRY_POINT_RENAME(uprv_aestrncpy)
 #define uprv_asciiFromEbcdic U_ICU_ENTRY_POINT_RENAME(uprv_asciiFromEbcdic)
 #define uprv_asciitolower U_ICU_ENTRY_POINT_RENAME(uprv_asciitolower)
@@ -1437,6 +1487,7 @@
 #define uprv_sortArray U_ICU_ENTRY_POINT_RENAME(uprv_sortArray)
 #define uprv_stableBinarySearch U_ICU_ENTRY_POINT_RENAME(uprv_stableBinarySearch)
 #define uprv_strCompare U_ICU_ENTRY_POINT_RENAME(uprv_strCompare)
+#define uprv_strFindMismatch U_ICU_ENTRY_POINT_RENAME(uprv_strFindMismatch)
 #define uprv_strdup U_ICU_ENTRY_POINT_RENAME(uprv_strdup)
 #define uprv_stricmp U_ICU_ENTRY_POINT_RENAME(uprv_stricmp)
 #define uprv_strndup U_ICU_ENTRY_POINT_RENAME(uprv_strndup)
@@ -1612,6 +1663,7 @@
 #define uscript_resetRun U_ICU_ENTRY_POINT_RENAME(uscript_resetRun)
 #define uscript_setRunText U_ICU_ENTRY_POINT_RENAME(uscript_setRunText)
 #define usearch_close U_ICU_ENTRY_POINT_RENAME(usearch_close)
+#define usearch_closeTextIndex U_ICU_ENTRY_POINT_RENAME(usearch_closeTextIndex)
 #define usearch_first U_ICU_ENTRY_POINT_RENAME(usearch_first)
 #define usearch_following U_ICU_ENTRY_POINT_RENAME(usearch_following)
 #define usearch_getAttribute U_ICU_ENTRY_POINT_RENAME(usearch_getAttribute)
@@ -1631,6 +1683,7 @@
 #define usearch_next U_ICU_ENTRY_POINT_RENAME(usearch_next)
 #define usearch_open U_ICU_ENTRY_POINT_RENAME(usearch_open)
 #define usearch_openFromCollator U_ICU_ENTRY_POINT_RENAME(usearch_openFromCollator)
+#define usearch_openTextIndex U_ICU_ENTRY_POINT_RENAME(usearch_openTextIndex)
 #define usearch_preceding U_ICU_ENTRY_POINT_RENAME(usearch_preceding)
 #define usearch_previous U_ICU_ENTRY_POINT_RENAME(usearch_previous)
 #define usearch_reset U_ICU_ENTRY_POINT_RENAME(usearch_reset)
@@ -1642,6 +1695,7 @@
 #define usearch_setOffset U_ICU_ENTRY_POINT_RENAME(usearch_setOffset)
 #define usearch_setPattern U_ICU_ENTRY_POINT_RENAME(usearch_setPattern)
 #define usearch_setText U_ICU_ENTRY_POINT_RENAME(usearch_setText)
+#define usearch_setTextIndex U_ICU_ENTRY_POINT_RENAME(usearch_setTextIndex)
 #define uset_add U_ICU_ENTRY_POINT_RENAME(uset_add)
 #define uset_addAll U_ICU_ENTRY_POINT_RENAME(uset_addAll)
 #define uset_addAllCodePoints U_ICU_ENTRY_POINT_RENAME(uset_addAllCodePoints)
@@ -1726,6 +1780,9 @@
 #define uspoof_getSkeletonUTF8 U_ICU_ENTRY_POINT_RENAME(uspoof_getSkeletonUTF8)
 #define uspoof_getSkeletonUnicodeString U_ICU_ENTRY_POINT_RENAME(uspoof_getSkeletonUnicodeString)
 #define uspoof_internalInitStatics U_ICU_ENTRY_POINT_RENAME(uspoof_internalInitStatics)
+#define uspoof_isConfusableWithAny U_ICU_ENTRY_POINT_RENAME(uspoof_isConfusableWithAny)
+#define uspoof_isConfusableWithAnyUTF8 U_ICU_ENTRY_POINT_RENAME(uspoof_isConfusableWithAnyUTF8)
+#define uspoof_isConfusableWithAnyUnicodeString U_ICU_ENTRY_POINT_RENAME(uspoof_isConfusableWithAnyUnicodeString)
 #define uspoof_open U_ICU_ENTRY_POINT_RENAME(uspoof_open)
 #define uspoof_openCheckResult U_ICU_ENTRY_POINT_RENAME(uspoof_openCheckResult)
 #define uspoof_openFromSerialized U_ICU_ENTRY_POINT_RENAME(uspoof_openFromSerialized)
@@ -1763,6 +1820,8 @@
 #define utext_freeze U_ICU_ENTRY_POINT_RENAME(utext_freeze)
 #define utext_getNativeIndex U_ICU_ENTRY_POINT_RENAME(utext_getNativeIndex)
 #define utext_getPreviousNativeIndex U_ICU_ENTRY_POINT_RENAME(utext_getPreviousNativeIndex)
+#define utext_getUTF16Contents U_ICU_ENTRY_POINT_RENAME(utext_getUTF16Contents)
+#define utext_getUTF8Contents U_ICU_ENTRY_POINT_RENAME(utext_getUTF8Contents)
 #define utext_hasMetaData U_ICU_ENTRY_POINT_RENAME(utext_hasMetaData)
 #define utext_isLengthExpensive U_ICU_ENTRY_POINT_RENAME(utext_isLengthExpensive)
 #define utext_isWritable U_ICU_ENTRY_POINT_RENAME(utext_isWritable)
@@ -67,6 +67,25 @@ typedef enum UTraceFunctionNumber {
     UTRACE_U_INIT=UTRACE_FUNCTION_START,
     UTRACE_U_CLEANUP,
 
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Indicates that a thread had to wait for an ICU-internal mutex
+     * that another thread was holding. Traced at UTRACE_INFO for the entry
+     * and exit, with one UTRACE_VERBOSE data record while the mutex is held.
+     *
+     * Provides to UTraceData: the address of the mutex, which identifies its
+     * static variable in the ICU library's symbol table; the wait time in
+     * nanoseconds and the total wait time for that mutex so far (both 64-bit);
+     * and the number of contended and of all acquisitions of that mutex so far.
+     *
+     * The trace functions are called with the mutex held,
+     * so they must not call back into ICU.
+     *
+     * @draft ICU 65
+     */
+    UTRACE_UMTX_LOCK_WAIT,
+#endif  // U_HIDE_DRAFT_API
+
 #ifndef U_HIDE_DEPRECATED_API
     /**
      * One more than the highest normal collation trace location.
@@ -176,6 +195,62 @@ typedef enum UTraceFunctionNumber {
     UTRACE_RES_DATA_LIMIT,
 #endif  // U_HIDE_INTERNAL_API
 
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * The lowest trace location for frequently called formatting,
+     * break iterator, normalization and cache functions.
+     * Each one is traced with a matching entry and exit, so that trace functions
+     * which record timestamps can attribute time to these operations.
+     * @draft ICU 65
+     */
+    UTRACE_API_START=0x4000,
+
+    /**
+     * Formatting one number with a LocalizedNumberFormatter,
+     * which also backs DecimalFormat and unum_format*().
+     * Traced at UTRACE_INFO.
+     * @draft ICU 65
+     */
+    UTRACE_UNUM_FORMAT=UTRACE_API_START,
+
+    /**
+     * Formatting one date with a SimpleDateFormat.
+     * Traced at UTRACE_INFO.
+     * @draft ICU 65
+     */
+    UTRACE_UDAT_FORMAT,
+
+    /**
+     * Creating a break iterator from locale data.
+     * Traced at UTRACE_OPEN_CLOSE; provides the UBreakIteratorType
+     * and the locale ID to UTraceData.
+     * @draft ICU 65
+     */
+    UTRACE_UBRK_OPEN,
+
+    /**
+     * Normalizing a string with one of the built-in Normalizer2 instances.
+     * Traced at UTRACE_INFO.
+     * @draft ICU 65
+     */
+    UTRACE_UNORM2_NORMALIZE,
+
+    /**
+     * Looking up a value in the UnifiedCache, including creating it on a miss.
+     * Traced at UTRACE_INFO; exits with the UErrorCode of the lookup.
+     * @draft ICU 65
+     */
+    UTRACE_UCACHE_GET,
+#endif  // U_HIDE_DRAFT_API
+
+#ifndef U_HIDE_INTERNAL_API
+    /**
+     * One more than the highest normal API trace location.
+     * @internal The numeric value may change over time, see ICU ticket #12420.
+     */
+    UTRACE_API_LIMIT,
+#endif  // U_HIDE_INTERNAL_API
+
 } UTraceFunctionNumber;
 
 /**
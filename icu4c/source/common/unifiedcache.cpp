@@ -13,20 +13,30 @@
 #include "unifiedcache.h"
 
 #include <algorithm>      // For std::max()
+#include <chrono>
 #include <mutex>
+#include <thread>         // For std::this_thread::yield()
 
+#include "cmemory.h"
 #include "uassert.h"
 #include "uhash.h"
 #include "ucln_cmn.h"
+#include "ucounterimp.h"
+#include "utracimp.h"
 
 static icu::UnifiedCache *gCache = NULL;
-static std::mutex *gCacheMutex = nullptr;
-static std::condition_variable *gInProgressValueAddedCond;
 static icu::UInitOnce gCacheInitOnce = U_INITONCE_INITIALIZER;
 
 static const int32_t MAX_EVICT_ITERATIONS = 10;
 static const int32_t DEFAULT_MAX_UNUSED = 1000;
 static const int32_t DEFAULT_PERCENTAGE_OF_IN_USE = 100;
+static const int32_t DEFAULT_SHARD_COUNT = 16;
+
+// Bytes charged for a value whose getMemoryFootprint() returns 0.
+static const int32_t DEFAULT_MEMORY_FOOTPRINT = 1024;
+// Values at least this large get extra CLOCK chances under a memory budget.
+static const int32_t LARGE_MEMORY_FOOTPRINT = 64 * 1024;
+static const int8_t LARGE_VALUE_USE_WEIGHT = 3;
 
 
 U_CDECL_BEGIN
@@ -34,10 +44,6 @@ static UBool U_CALLCONV unifiedcache_cleanup() {
     gCacheInitOnce.reset();
     delete gCache;
     gCache = nullptr;
-    gCacheMutex->~mutex();
-    gCacheMutex = nullptr;
-    gInProgressValueAddedCond->~condition_variable();
-    gInProgressValueAddedCond = nullptr;
     return TRUE;
 }
 U_CDECL_END
@@ -55,7 +61,7 @@ U_CAPI UBool U_EXPORT2
 ucache_compareKeys(const UHashTok key1, const UHashTok key2) {
     const CacheKeyBase *p1 = (const CacheKeyBase *) key1.pointer;
     const CacheKeyBase *p2 = (const CacheKeyBase *) key2.pointer;
-    return *p1 == *p2;
+    return p1->isSameDataEpoch(*p2) && *p1 == *p2;
 }
 
 U_CAPI void U_EXPORT2
@@ -67,14 +73,53 @@ ucache_deleteKey(void *obj) {
 CacheKeyBase::~CacheKeyBase() {
 }
 
+U_CAPI void U_EXPORT2
+ucache_getStats(UCacheStats *stats, UErrorCode *status) {
+    if (U_FAILURE(*status)) {
+        return;
+    }
+    if (stats == nullptr) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    const UnifiedCache *cache = UnifiedCache::getInstance(*status);
+    if (U_FAILURE(*status)) {
+        return;
+    }
+    cache->getStats(*stats);
+}
+
+U_CAPI int32_t U_EXPORT2
+ucache_getKeyTypeStats(UCacheKeyTypeStats *dest, int32_t capacity, UErrorCode *status) {
+    if (U_FAILURE(*status)) {
+        return 0;
+    }
+    const UnifiedCache *cache = UnifiedCache::getInstance(*status);
+    if (U_FAILURE(*status)) {
+        return 0;
+    }
+    return cache->getKeyTypeStats(dest, capacity, *status);
+}
+
+/**
+ * A completed cache entry published in a shard's hot table. Immutable once
+ * published. key and value are owned by the shard's hash table; the entry
+ * is unpublished and synchronized before either may be deleted.
+ */
+struct UnifiedCacheHotEntry : public UMemory {
+    int32_t hashCode;
+    const CacheKeyBase *key;
+    const SharedObject *value;
+    UErrorCode status;
+    UnifiedCacheHotEntry *nextRetired;
+};
+
 static void U_CALLCONV cacheInit(UErrorCode &status) {
     U_ASSERT(gCache == NULL);
     ucln_common_registerCleanup(
             UCLN_COMMON_UNIFIED_CACHE, unifiedcache_cleanup);
 
-    gCacheMutex = STATIC_NEW(std::mutex);
-    gInProgressValueAddedCond = STATIC_NEW(std::condition_variable);
-    gCache = new UnifiedCache(status);
+    gCache = new UnifiedCache(DEFAULT_SHARD_COUNT, status);
     if (gCache == NULL) {
         status = U_MEMORY_ALLOCATION_ERROR;
     }
@@ -94,18 +139,105 @@ UnifiedCache *UnifiedCache::getInstance(UErrorCode &status) {
     return gCache;
 }
 
-UnifiedCache::UnifiedCache(UErrorCode &status) :
-        fHashtable(NULL),
+UnifiedCacheShard::UnifiedCacheShard() :
+        fCache(nullptr),
+        fHashtable(nullptr),
         fEvictPos(UHASH_FIRST),
         fNumValuesTotal(0),
         fNumValuesInUse(0),
+        fAutoEvictedCount(0),
+        fMemoryFootprint(0),
+        fReadEpoch(0),
+        fHitsWithoutLock(0),
+        fLockedHits(0),
+        fMisses(0),
+        fInProgressWaits(0),
+        fInProgressWaitNanos(0),
+        fRetired(nullptr),
+        fRetiredCount(0),
+        fDoomed(nullptr) {
+    for (int32_t i = 0; i < HOT_TABLE_SIZE; ++i) {
+        fHotTable[i] = nullptr;
+    }
+    fActiveReaders[0] = 0;
+    fActiveReaders[1] = 0;
+}
+
+UnifiedCacheShard::~UnifiedCacheShard() {
+    // The owning cache has already unpublished and synchronized everything;
+    // this only reclaims what an incomplete initialization left behind.
+    for (int32_t i = 0; i < HOT_TABLE_SIZE; ++i) {
+        delete fHotTable[i].load();
+    }
+    while (fRetired != nullptr) {
+        UnifiedCacheHotEntry *next = fRetired->nextRetired;
+        delete fRetired;
+        fRetired = next;
+    }
+    uhash_close(fHashtable);
+    fHashtable = nullptr;
+    while (fDoomed != nullptr) {
+        const SharedObject *next = fDoomed->nextDoomed;
+        delete fDoomed;
+        fDoomed = next;
+    }
+}
+
+void UnifiedCacheShard::handleUnreferencedObject() const {
+    fCache->_handleUnreferencedObject(*this);
+}
+
+UnifiedCache::UnifiedCache(UErrorCode &status) :
+        fShards(nullptr),
+        fShardCount(0),
         fMaxUnused(DEFAULT_MAX_UNUSED),
         fMaxPercentageOfInUse(DEFAULT_PERCENTAGE_OF_IN_USE),
-        fAutoEvictedCount(0),
+        fMaxBytes(0),
+        fNoValue(nullptr) {
+    init(1, status);
+}
+
+UnifiedCache::UnifiedCache(int32_t shardCount, UErrorCode &status) :
+        fShards(nullptr),
+        fShardCount(0),
+        fMaxUnused(DEFAULT_MAX_UNUSED),
+        fMaxPercentageOfInUse(DEFAULT_PERCENTAGE_OF_IN_USE),
+        fMaxBytes(0),
         fNoValue(nullptr) {
+    init(shardCount, status);
+}
+
+void UnifiedCache::init(int32_t shardCount, UErrorCode &status) {
     if (U_FAILURE(status)) {
         return;
     }
+    if (shardCount < 1) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    fShards = new UnifiedCacheShard[shardCount];
+    if (fShards == nullptr) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    fShardCount = shardCount;
+    for (int32_t i = 0; i < fShardCount; ++i) {
+        UnifiedCacheShard &shard = fShards[i];
+        shard.fCache = this;
+        shard.fHashtable = uhash_open(
+                &ucache_hashKeys,
+                &ucache_compareKeys,
+                NULL,
+                &status);
+        if (U_FAILURE(status)) {
+            delete[] fShards;
+            fShards = nullptr;
+            fShardCount = 0;
+            return;
+        }
+        uhash_setKeyDeleter(shard.fHashtable, &ucache_deleteKey);
+    }
+
     fNoValue = new SharedObject();
     if (fNoValue == nullptr) {
         status = U_MEMORY_ALLOCATION_ERROR;
@@ -113,17 +245,135 @@ UnifiedCache::UnifiedCache(UErrorCode &status) :
     }
     fNoValue->softRefCount = 1;  // Add fake references to prevent fNoValue from being deleted
     fNoValue->hardRefCount = 1;  // when other references to it are removed.
-    fNoValue->cachePtr = this;
+    fNoValue->cachePtr = &fShards[0];
+}
 
-    fHashtable = uhash_open(
-            &ucache_hashKeys,
-            &ucache_compareKeys,
-            NULL,
-            &status);
-    if (U_FAILURE(status)) {
+UnifiedCacheShard &UnifiedCache::_shardFor(const CacheKeyBase &key) const {
+    return _shardFor(key.hashCode());
+}
+
+UnifiedCacheShard &UnifiedCache::_shardFor(int32_t hashCode) const {
+    // The hash table buckets and hot table slots within a shard are chosen
+    // from the same hash code, so scramble it first to keep the shard choice
+    // independent.
+    uint32_t hash = static_cast<uint32_t>(hashCode) * 0x9E3779B1u;
+    return fShards[(hash >> 16) % static_cast<uint32_t>(fShardCount)];
+}
+
+// Slot index in a shard's hot table. Uses the hash code as stored in
+// UHashElement.hashcode so that it can be recomputed from an element.
+static inline int32_t hotSlot(int32_t hashCode) {
+    return (hashCode & 0x7FFFFFFF) % UnifiedCacheShard::HOT_TABLE_SIZE;
+}
+
+UBool UnifiedCache::_pollHot(
+        const CacheKeyBase &key,
+        int32_t hashCode,
+        const SharedObject *&value,
+        UErrorCode &status) const {
+    U_ASSERT(value == NULL);
+    U_ASSERT(status == U_ZERO_ERROR);
+    const UnifiedCacheShard &shard = _shardFor(hashCode);
+
+    // Enter the read side. The epoch is checked again after announcing this
+    // reader, otherwise a writer that advanced the epoch in between would not
+    // know to wait for us. All operations here are sequentially consistent.
+    int32_t epoch;
+    for (;;) {
+        epoch = shard.fReadEpoch.load();
+        shard.fActiveReaders[epoch & 1].fetch_add(1);
+        if (shard.fReadEpoch.load() == epoch) {
+            break;
+        }
+        shard.fActiveReaders[epoch & 1].fetch_sub(1);
+    }
+
+    UBool found = FALSE;
+    const UnifiedCacheHotEntry *entry = shard.fHotTable[hotSlot(hashCode)].load();
+    if (entry != nullptr &&
+            entry->hashCode == (hashCode & 0x7FFFFFFF) &&
+            entry->key->isSameDataEpoch(key) && *entry->key == key) {
+        _recordUse(entry->key, entry->value);
+        addHardRef(entry->value);
+        shard.fHitsWithoutLock.fetch_add(1, std::memory_order_relaxed);
+        value = entry->value;
+        status = entry->status;
+        found = TRUE;
+    }
+
+    shard.fActiveReaders[epoch & 1].fetch_sub(1);
+    return found;
+}
+
+void UnifiedCache::_publishHot(
+        const UnifiedCacheShard &shard, const UHashElement *element) const {
+    const CacheKeyBase *theKey = (const CacheKeyBase *) element->key.pointer;
+    const SharedObject *theValue = (const SharedObject *) element->value.pointer;
+    if (theValue == fNoValue || U_FAILURE(theKey->fCreationStatus)) {
+        return;
+    }
+    std::atomic<UnifiedCacheHotEntry *> &slot = shard.fHotTable[hotSlot(element->hashcode)];
+    const UnifiedCacheHotEntry *current = slot.load();
+    if (current != nullptr && current->key == theKey) {
+        return;
+    }
+    UnifiedCacheHotEntry *entry = new UnifiedCacheHotEntry;
+    if (entry == nullptr) {
+        return;  // The hot table is best-effort only.
+    }
+    entry->hashCode = element->hashcode;
+    entry->key = theKey;
+    entry->value = theValue;
+    entry->status = theKey->fCreationStatus;
+    entry->nextRetired = nullptr;
+    UnifiedCacheHotEntry *old = slot.exchange(entry);
+    if (old != nullptr) {
+        old->nextRetired = shard.fRetired;
+        shard.fRetired = old;
+        // Keys colliding in one slot retire an entry on every publish.
+        // Bound the garbage.
+        if (++shard.fRetiredCount >= UnifiedCacheShard::HOT_TABLE_SIZE) {
+            _synchronize(shard);
+        }
+    }
+}
+
+void UnifiedCache::_unpublishHot(
+        const UnifiedCacheShard &shard, const CacheKeyBase *key, int32_t hashCode) const {
+    std::atomic<UnifiedCacheHotEntry *> &slot = shard.fHotTable[hotSlot(hashCode)];
+    UnifiedCacheHotEntry *entry = slot.load();
+    if (entry == nullptr || entry->key != key) {
         return;
     }
-    uhash_setKeyDeleter(fHashtable, &ucache_deleteKey);
+    slot.store(nullptr);
+    entry->nextRetired = shard.fRetired;
+    shard.fRetired = entry;
+    ++shard.fRetiredCount;
+}
+
+void UnifiedCache::_synchronize(const UnifiedCacheShard &shard) const {
+    if (shard.fRetired == nullptr) {
+        // Nothing was unpublished, so no reader can hold anything stale.
+        return;
+    }
+    // Send new readers to the other counter and wait for the ones that
+    // may have seen the retired entries. Only writers advance the epoch and
+    // they hold the shard mutex, so at most two epochs are ever active.
+    int32_t epoch = shard.fReadEpoch.load();
+    shard.fReadEpoch.store(epoch + 1);
+    while (shard.fActiveReaders[epoch & 1].load() != 0) {
+        std::this_thread::yield();
+    }
+    while (shard.fRetired != nullptr) {
+        UnifiedCacheHotEntry *next = shard.fRetired->nextRetired;
+        delete shard.fRetired;
+        shard.fRetired = next;
+    }
+    shard.fRetiredCount = 0;
+}
+
+const UnifiedCacheShard *UnifiedCache::_ownerOf(const SharedObject *value) {
+    return static_cast<const UnifiedCacheShard *>(value->cachePtr);
 }
 
 void UnifiedCache::setEvictionPolicy(
@@ -135,39 +385,157 @@ void UnifiedCache::setEvictionPolicy(
         status = U_ILLEGAL_ARGUMENT_ERROR;
         return;
     }
-    std::lock_guard<std::mutex> lock(*gCacheMutex);
-    fMaxUnused = count;
-    fMaxPercentageOfInUse = percentageOfInUseItems;
+    umtx_storeRelease(fMaxUnused, count);
+    umtx_storeRelease(fMaxPercentageOfInUse, percentageOfInUseItems);
+}
+
+void UnifiedCache::setMemoryBudget(int64_t maxBytes, UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return;
+    }
+    if (maxBytes < 0) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    fMaxBytes.store(maxBytes);
+}
+
+int64_t UnifiedCache::memoryFootprint() const {
+    int64_t result = 0;
+    for (int32_t i = 0; i < fShardCount; ++i) {
+        result += fShards[i].fMemoryFootprint.load();
+    }
+    return result;
+}
+
+void UnifiedCache::getStats(UCacheStats &stats) const {
+    uprv_memset(&stats, 0, sizeof(stats));
+    for (int32_t i = 0; i < fShardCount; ++i) {
+        const UnifiedCacheShard &shard = fShards[i];
+        int64_t hitsWithoutLock = shard.fHitsWithoutLock.load(std::memory_order_relaxed);
+        stats.hits += hitsWithoutLock;
+        stats.hitsWithoutLock += hitsWithoutLock;
+        stats.memoryFootprint += shard.fMemoryFootprint.load();
+        std::lock_guard<std::mutex> lock(shard.fMutex);
+        stats.hits += shard.fLockedHits;
+        stats.misses += shard.fMisses;
+        stats.inProgressWaits += shard.fInProgressWaits;
+        stats.inProgressWaitNanos += shard.fInProgressWaitNanos;
+        stats.evictions += shard.fAutoEvictedCount;
+        stats.keyCount += uhash_count(shard.fHashtable);
+        stats.unusedCount +=
+                uhash_count(shard.fHashtable) - umtx_loadAcquire(shard.fNumValuesInUse);
+    }
+}
+
+int32_t UnifiedCache::getKeyTypeStats(
+        UCacheKeyTypeStats *dest, int32_t capacity, UErrorCode &status) const {
+    if (U_FAILURE(status)) {
+        return 0;
+    }
+    if (capacity < 0 || (dest == nullptr && capacity > 0)) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    MaybeStackArray<UCacheKeyTypeStats, 16> types;
+    int32_t typeCount = 0;
+    for (int32_t i = 0; i < fShardCount; ++i) {
+        const UnifiedCacheShard &shard = fShards[i];
+        std::lock_guard<std::mutex> lock(shard.fMutex);
+        int32_t pos = UHASH_FIRST;
+        const UHashElement *element;
+        while ((element = uhash_nextElement(shard.fHashtable, &pos)) != nullptr) {
+            const CacheKeyBase *theKey = (const CacheKeyBase *) element->key.pointer;
+            const SharedObject *theValue = (const SharedObject *) element->value.pointer;
+            const char *typeName = typeid(*theKey).name();
+            int32_t j = 0;
+            while (j < typeCount && uprv_strcmp(types[j].typeName, typeName) != 0) {
+                ++j;
+            }
+            if (j == typeCount) {
+                if (typeCount == types.getCapacity() &&
+                        types.resize(2 * typeCount, typeCount) == nullptr) {
+                    status = U_MEMORY_ALLOCATION_ERROR;
+                    return 0;
+                }
+                types[j].typeName = typeName;
+                types[j].keyCount = 0;
+                types[j].memoryFootprint = 0;
+                ++typeCount;
+            }
+            ++types[j].keyCount;
+            if (theKey->fIsMaster) {
+                types[j].memoryFootprint += theValue->cacheFootprint;
+            }
+        }
+    }
+    if (typeCount > capacity) {
+        status = U_BUFFER_OVERFLOW_ERROR;
+    } else if (typeCount > 0) {
+        uprv_memcpy(dest, types.getAlias(), typeCount * sizeof(UCacheKeyTypeStats));
+    }
+    return typeCount;
 }
 
 int32_t UnifiedCache::unusedCount() const {
-    std::lock_guard<std::mutex> lock(*gCacheMutex);
-    return uhash_count(fHashtable) - fNumValuesInUse;
+    int32_t result = 0;
+    for (int32_t i = 0; i < fShardCount; ++i) {
+        const UnifiedCacheShard &shard = fShards[i];
+        std::lock_guard<std::mutex> lock(shard.fMutex);
+        result += uhash_count(shard.fHashtable) - umtx_loadAcquire(shard.fNumValuesInUse);
+    }
+    return result;
 }
 
 int64_t UnifiedCache::autoEvictedCount() const {
-    std::lock_guard<std::mutex> lock(*gCacheMutex);
-    return fAutoEvictedCount;
+    int64_t result = 0;
+    for (int32_t i = 0; i < fShardCount; ++i) {
+        const UnifiedCacheShard &shard = fShards[i];
+        std::lock_guard<std::mutex> lock(shard.fMutex);
+        result += shard.fAutoEvictedCount;
+    }
+    return result;
 }
 
 int32_t UnifiedCache::keyCount() const {
-    std::lock_guard<std::mutex> lock(*gCacheMutex);
-    return uhash_count(fHashtable);
+    int32_t result = 0;
+    for (int32_t i = 0; i < fShardCount; ++i) {
+        const UnifiedCacheShard &shard = fShards[i];
+        std::lock_guard<std::mutex> lock(shard.fMutex);
+        result += uhash_count(shard.fHashtable);
+    }
+    return result;
 }
 
 void UnifiedCache::flush() const {
-    std::lock_guard<std::mutex> lock(*gCacheMutex);
-
     // Use a loop in case cache items that are flushed held hard references to
     // other cache items making those additional cache items eligible for
-    // flushing.
-    while (_flush(FALSE));
+    // flushing. Flushing a non-master entry in one shard can also make the
+    // master entry in another shard evictable, so repeat over all shards until
+    // nothing more is flushed.
+    UBool flushedAny;
+    do {
+        flushedAny = FALSE;
+        for (int32_t i = 0; i < fShardCount; ++i) {
+            const UnifiedCacheShard &shard = fShards[i];
+            {
+                std::lock_guard<std::mutex> lock(shard.fMutex);
+                while (_flush(shard, FALSE)) {
+                    flushedAny = TRUE;
+                }
+            }
+            _deleteDoomed(shard);
+        }
+    } while (flushedAny);
 }
 
-void UnifiedCache::handleUnreferencedObject() const {
-    std::lock_guard<std::mutex> lock(*gCacheMutex);
-    --fNumValuesInUse;
-    _runEvictionSlice();
+void UnifiedCache::_handleUnreferencedObject(const UnifiedCacheShard &shard) const {
+    {
+        std::lock_guard<std::mutex> lock(shard.fMutex);
+        umtx_atomic_dec(&shard.fNumValuesInUse);
+        _runEvictionSlice(shard);
+    }
+    _deleteDoomed(shard);
 }
 
 #ifdef UNIFIED_CACHE_DEBUG
@@ -184,19 +552,22 @@ void UnifiedCache::dump() {
 }
 
 void UnifiedCache::dumpContents() const {
-    std::lock_guard<std::mutex> lock(*gCacheMutex);
-    _dumpContents();
+    for (int32_t i = 0; i < fShardCount; ++i) {
+        const UnifiedCacheShard &shard = fShards[i];
+        std::lock_guard<std::mutex> lock(shard.fMutex);
+        _dumpContents(shard);
+    }
 }
 
-// Dumps content of cache.
-// On entry, gCacheMutex must be held.
-// On exit, cache contents dumped to stderr.
-void UnifiedCache::_dumpContents() const {
+// Dumps content of one shard.
+// On entry, the shard's mutex must be held.
+// On exit, shard contents dumped to stderr.
+void UnifiedCache::_dumpContents(const UnifiedCacheShard &shard) const {
     int32_t pos = UHASH_FIRST;
-    const UHashElement *element = uhash_nextElement(fHashtable, &pos);
+    const UHashElement *element = uhash_nextElement(shard.fHashtable, &pos);
     char buffer[256];
     int32_t cnt = 0;
-    for (; element != NULL; element = uhash_nextElement(fHashtable, &pos)) {
+    for (; element != NULL; element = uhash_nextElement(shard.fHashtable, &pos)) {
         const SharedObject *sharedObject =
                 (const SharedObject *) element->value.pointer;
         const CacheKeyBase *key =
@@ -207,89 +578,144 @@ void UnifiedCache::_dumpContents() const {
                     stderr,
                     "Unified Cache: Key '%s', error %d, value %p, total refcount %d, soft refcount %d\n",
                     key->writeDescription(buffer, 256),
-                    key->creationStatus,
+                    key->fCreationStatus,
                     sharedObject == fNoValue ? NULL :sharedObject,
                     sharedObject->getRefCount(),
-                    sharedObject->getSoftRefCount());
+                    (int32_t)sharedObject->softRefCount);
         }
     }
-    fprintf(stderr, "Unified Cache: %d out of a total of %d still have hard references\n", cnt, uhash_count(fHashtable));
+    fprintf(stderr, "Unified Cache: %d out of a total of %d still have hard references\n", cnt, uhash_count(shard.fHashtable));
 }
 #endif
 
 UnifiedCache::~UnifiedCache() {
     // Try our best to clean up first.
     flush();
-    {
-        // Now all that should be left in the cache are entries that refer to
-        // each other and entries with hard references from outside the cache.
-        // Nothing we can do about these so proceed to wipe out the cache.
-        std::lock_guard<std::mutex> lock(*gCacheMutex);
-        _flush(TRUE);
+    // Now all that should be left in the cache are entries that refer to
+    // each other and entries with hard references from outside the cache.
+    // Nothing we can do about these so proceed to wipe out the cache.
+    for (int32_t i = 0; i < fShardCount; ++i) {
+        const UnifiedCacheShard &shard = fShards[i];
+        {
+            std::lock_guard<std::mutex> lock(shard.fMutex);
+            _flush(shard, TRUE);
+        }
+        _deleteDoomed(shard);
     }
-    uhash_close(fHashtable);
-    fHashtable = nullptr;
+    delete[] fShards;
+    fShards = nullptr;
+    fShardCount = 0;
     delete fNoValue;
     fNoValue = nullptr;
 }
 
 const UHashElement *
-UnifiedCache::_nextElement() const {
-    const UHashElement *element = uhash_nextElement(fHashtable, &fEvictPos);
+UnifiedCache::_nextElement(const UnifiedCacheShard &shard) const {
+    const UHashElement *element = uhash_nextElement(shard.fHashtable, &shard.fEvictPos);
     if (element == NULL) {
-        fEvictPos = UHASH_FIRST;
-        return uhash_nextElement(fHashtable, &fEvictPos);
+        shard.fEvictPos = UHASH_FIRST;
+        return uhash_nextElement(shard.fHashtable, &shard.fEvictPos);
     }
     return element;
 }
 
-UBool UnifiedCache::_flush(UBool all) const {
+UBool UnifiedCache::_flush(const UnifiedCacheShard &shard, UBool all) const {
     UBool result = FALSE;
-    int32_t origSize = uhash_count(fHashtable);
+    for (int32_t i = 0; i < UnifiedCacheShard::HOT_TABLE_SIZE; ++i) {
+        UnifiedCacheHotEntry *entry = shard.fHotTable[i].exchange(nullptr);
+        if (entry != nullptr) {
+            entry->nextRetired = shard.fRetired;
+            shard.fRetired = entry;
+            ++shard.fRetiredCount;
+        }
+    }
+    _synchronize(shard);
+    int32_t origSize = uhash_count(shard.fHashtable);
     for (int32_t i = 0; i < origSize; ++i) {
-        const UHashElement *element = _nextElement();
+        const UHashElement *element = _nextElement(shard);
         if (element == nullptr) {
             break;
         }
         if (all || _isEvictable(element)) {
             const SharedObject *sharedObject =
                     (const SharedObject *) element->value.pointer;
-            U_ASSERT(sharedObject->cachePtr == this);
-            uhash_removeElement(fHashtable, element);
-            removeSoftRef(sharedObject);    // Deletes the sharedObject when softRefCount goes to zero.
+            U_ASSERT(_ownerOf(sharedObject)->fCache == this);
+            uhash_removeElement(shard.fHashtable, element);
+            removeSoftRef(shard, sharedObject);    // Dooms the sharedObject when softRefCount goes to zero.
             result = TRUE;
         }
     }
     return result;
 }
 
-int32_t UnifiedCache::_computeCountOfItemsToEvict() const {
-    int32_t totalItems = uhash_count(fHashtable);
-    int32_t evictableItems = totalItems - fNumValuesInUse;
+int32_t UnifiedCache::_computeCountOfItemsToEvict(const UnifiedCacheShard &shard) const {
+    int32_t totalItems = uhash_count(shard.fHashtable);
+    int32_t numValuesInUse = umtx_loadAcquire(shard.fNumValuesInUse);
+    int32_t evictableItems = totalItems - numValuesInUse;
 
-    int32_t unusedLimitByPercentage = fNumValuesInUse * fMaxPercentageOfInUse / 100;
-    int32_t unusedLimit = std::max(unusedLimitByPercentage, fMaxUnused);
+    int32_t unusedLimitByPercentage =
+            numValuesInUse * umtx_loadAcquire(fMaxPercentageOfInUse) / 100;
+    int32_t unusedLimit = std::max(
+            unusedLimitByPercentage, umtx_loadAcquire(fMaxUnused) / fShardCount);
     int32_t countOfItemsToEvict = std::max(0, evictableItems - unusedLimit);
     return countOfItemsToEvict;
 }
 
-void UnifiedCache::_runEvictionSlice() const {
-    int32_t maxItemsToEvict = _computeCountOfItemsToEvict();
-    if (maxItemsToEvict <= 0) {
+UBool UnifiedCache::_isOverMemoryBudget(const UnifiedCacheShard &shard) const {
+    int64_t maxBytes = fMaxBytes.load();
+    return maxBytes > 0 && shard.fMemoryFootprint.load() > maxBytes / fShardCount;
+}
+
+void UnifiedCache::_recordUse(const CacheKeyBase *key, const SharedObject *value) {
+    int8_t weight = value->cacheFootprint >= LARGE_MEMORY_FOOTPRINT ? LARGE_VALUE_USE_WEIGHT : 1;
+    // Avoid writing to a shared cache line on every hit of a hot entry.
+    if (key->fRecentUses.load(std::memory_order_relaxed) != weight) {
+        key->fRecentUses.store(weight, std::memory_order_relaxed);
+    }
+}
+
+void UnifiedCache::_runEvictionSlice(const UnifiedCacheShard &shard) const {
+    int32_t maxItemsToEvict = _computeCountOfItemsToEvict(shard);
+    if (maxItemsToEvict <= 0 && !_isOverMemoryBudget(shard)) {
         return;
     }
+
+    // Unpublish the entries this slice will examine so that lock-free readers
+    // cannot add references to them while their evictability is decided.
+    int32_t evictPos = shard.fEvictPos;
+    for (int32_t i = 0; i < MAX_EVICT_ITERATIONS; ++i) {
+        const UHashElement *element = _nextElement(shard);
+        if (element == nullptr) {
+            break;
+        }
+        _unpublishHot(shard, (const CacheKeyBase *) element->key.pointer, element->hashcode);
+    }
+    shard.fEvictPos = evictPos;
+    _synchronize(shard);
+
     for (int32_t i = 0; i < MAX_EVICT_ITERATIONS; ++i) {
-        const UHashElement *element = _nextElement();
+        const UHashElement *element = _nextElement(shard);
         if (element == nullptr) {
             break;
         }
         if (_isEvictable(element)) {
+            if (maxItemsToEvict <= 0) {
+                // Only the memory budget calls for eviction: CLOCK sweep,
+                // entries used since the last pass get another chance.
+                const CacheKeyBase *theKey = (const CacheKeyBase *) element->key.pointer;
+                int8_t uses = theKey->fRecentUses.load(std::memory_order_relaxed);
+                if (uses > 0) {
+                    theKey->fRecentUses.store(uses - 1, std::memory_order_relaxed);
+                    continue;
+                }
+            }
             const SharedObject *sharedObject =
                     (const SharedObject *) element->value.pointer;
-            uhash_removeElement(fHashtable, element);
-            removeSoftRef(sharedObject);   // Deletes sharedObject when SoftRefCount goes to zero.
-            ++fAutoEvictedCount;
-            if (--maxItemsToEvict == 0) {
+            uhash_removeElement(shard.fHashtable, element);
+            removeSoftRef(shard, sharedObject);   // Dooms sharedObject when SoftRefCount goes to zero.
+            ++shard.fAutoEvictedCount;
+            --maxItemsToEvict;
+            if (maxItemsToEvict <= 0 && !_isOverMemoryBudget(shard)) {
                 break;
             }
         }
@@ -297,6 +723,7 @@ void UnifiedCache::_runEvictionSlice() const {
 }
 
 void UnifiedCache::_putNew(
+        const UnifiedCacheShard &shard,
         const CacheKeyBase &key,
         const SharedObject *value,
         const UErrorCode creationStatus,
@@ -311,9 +738,9 @@ void UnifiedCache::_putNew(
     }
     keyToAdopt->fCreationStatus = creationStatus;
     if (value->softRefCount == 0) {
-        _registerMaster(keyToAdopt, value);
+        _registerMaster(shard, keyToAdopt, value);
     }
-    void *oldValue = uhash_put(fHashtable, keyToAdopt, (void *) value, &status);
+    void *oldValue = uhash_put(shard.fHashtable, keyToAdopt, (void *) value, &status);
     U_ASSERT(oldValue == nullptr);
     (void)oldValue;
     if (U_SUCCESS(status)) {
@@ -325,22 +752,35 @@ void UnifiedCache::_putIfAbsentAndGet(
         const CacheKeyBase &key,
         const SharedObject *&value,
         UErrorCode &status) const {
-    std::lock_guard<std::mutex> lock(*gCacheMutex);
-    const UHashElement *element = uhash_find(fHashtable, &key);
-    if (element != NULL && !_inProgress(element)) {
-        _fetch(element, value, status);
-        return;
-    }
-    if (element == NULL) {
-        UErrorCode putError = U_ZERO_ERROR;
-        // best-effort basis only.
-        _putNew(key, value, status, putError);
-    } else {
-        _put(element, value, status);
+    const UnifiedCacheShard &shard = _shardFor(key);
+    {
+        std::lock_guard<std::mutex> lock(shard.fMutex);
+        const UHashElement *element = uhash_find(shard.fHashtable, &key);
+        if (element != NULL && !_inProgress(element)) {
+            _recordUse((const CacheKeyBase *) element->key.pointer,
+                       (const SharedObject *) element->value.pointer);
+            _publishHot(shard, element);
+            _fetch(element, value, status);
+            return;
+        }
+        if (element == NULL) {
+            UErrorCode putError = U_ZERO_ERROR;
+            // best-effort basis only.
+            _putNew(shard, key, value, status, putError);
+            element = uhash_find(shard.fHashtable, &key);
+        } else {
+            _put(shard, element, value, status);
+        }
+        if (element != NULL) {
+            _recordUse((const CacheKeyBase *) element->key.pointer,
+                       (const SharedObject *) element->value.pointer);
+            _publishHot(shard, element);
+        }
+        // Run an eviction slice. This will run even if we added a master entry
+        // which doesn't increase the unused count, but that is still o.k
+        _runEvictionSlice(shard);
     }
-    // Run an eviction slice. This will run even if we added a master entry
-    // which doesn't increase the unused count, but that is still o.k
-    _runEvictionSlice();
+    _deleteDoomed(shard);
 }
 
 
@@ -350,28 +790,40 @@ UBool UnifiedCache::_poll(
         UErrorCode &status) const {
     U_ASSERT(value == NULL);
     U_ASSERT(status == U_ZERO_ERROR);
-    std::unique_lock<std::mutex> lock(*gCacheMutex);
-    const UHashElement *element = uhash_find(fHashtable, &key);
+    const UnifiedCacheShard &shard = _shardFor(key);
+    std::unique_lock<std::mutex> lock(shard.fMutex);
+    const UHashElement *element = uhash_find(shard.fHashtable, &key);
 
     // If the hash table contains an inProgress placeholder entry for this key,
     // this means that another thread is currently constructing the value object.
     // Loop, waiting for that construction to complete.
-     while (element != NULL && _inProgress(element)) {
-         gInProgressValueAddedCond->wait(lock);
-         element = uhash_find(fHashtable, &key);
+    if (element != NULL && _inProgress(element)) {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        do {
+            shard.fInProgressValueAddedCond.wait(lock);
+            element = uhash_find(shard.fHashtable, &key);
+        } while (element != NULL && _inProgress(element));
+        ++shard.fInProgressWaits;
+        shard.fInProgressWaitNanos += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - start).count();
     }
 
     // If the hash table contains an entry for the key,
     // fetch out the contents and return them.
     if (element != NULL) {
+         _recordUse((const CacheKeyBase *) element->key.pointer,
+                    (const SharedObject *) element->value.pointer);
+         _publishHot(shard, element);
          _fetch(element, value, status);
+         ++shard.fLockedHits;
         return TRUE;
     }
+    ++shard.fMisses;
 
     // The hash table contained nothing for this key.
     // Insert an inProgress place holder value.
     // Our caller will create the final value and update the hash table.
-    _putNew(key, fNoValue, U_ZERO_ERROR, status);
+    _putNew(shard, key, fNoValue, U_ZERO_ERROR, status);
     return FALSE;
 }
 
@@ -382,15 +834,23 @@ void UnifiedCache::_get(
         UErrorCode &status) const {
     U_ASSERT(value == NULL);
     U_ASSERT(status == U_ZERO_ERROR);
+    UTRACE_ENTRY(UTRACE_UCACHE_GET);
+    if (_pollHot(key, key.hashCode(), value, status)) {
+        UTRACE_EXIT_STATUS(status);
+        return;
+    }
     if (_poll(key, value, status)) {
         if (value == fNoValue) {
             SharedObject::clearPtr(value);
         }
+        UTRACE_EXIT_STATUS(status);
         return;
     }
     if (U_FAILURE(status)) {
+        UTRACE_EXIT_STATUS(status);
         return;
     }
+    UCOUNTER_INC(UCOUNTER_CACHE_MISSES);
     value = key.createObject(creationContext, status);
     U_ASSERT(value == NULL || value->hasHardReferences());
     U_ASSERT(value != NULL || status != U_ZERO_ERROR);
@@ -401,17 +861,24 @@ void UnifiedCache::_get(
     if (value == fNoValue) {
         SharedObject::clearPtr(value);
     }
+    UTRACE_EXIT_STATUS(status);
 }
 
 void UnifiedCache::_registerMaster(
-            const CacheKeyBase *theKey, const SharedObject *value) const {
+            const UnifiedCacheShard &shard,
+            const CacheKeyBase *theKey,
+            const SharedObject *value) const {
     theKey->fIsMaster = true;
-    value->cachePtr = this;
-    ++fNumValuesTotal;
-    ++fNumValuesInUse;
+    value->cachePtr = &shard;
+    int32_t footprint = value->getMemoryFootprint();
+    value->cacheFootprint = footprint > 0 ? footprint : DEFAULT_MEMORY_FOOTPRINT;
+    shard.fMemoryFootprint += value->cacheFootprint;
+    umtx_atomic_inc(&shard.fNumValuesTotal);
+    umtx_atomic_inc(&shard.fNumValuesInUse);
 }
 
 void UnifiedCache::_put(
+        const UnifiedCacheShard &shard,
         const UHashElement *element,
         const SharedObject *value,
         const UErrorCode status) const {
@@ -420,17 +887,17 @@ void UnifiedCache::_put(
     const SharedObject *oldValue = (const SharedObject *) element->value.pointer;
     theKey->fCreationStatus = status;
     if (value->softRefCount == 0) {
-        _registerMaster(theKey, value);
+        _registerMaster(shard, theKey, value);
     }
     value->softRefCount++;
     UHashElement *ptr = const_cast<UHashElement *>(element);
     ptr->value.pointer = (void *) value;
     U_ASSERT(oldValue == fNoValue);
-    removeSoftRef(oldValue);
+    removeSoftRef(shard, oldValue);
 
     // Tell waiting threads that we replace in-progress status with
     // an error.
-    gInProgressValueAddedCond->notify_all();
+    shard.fInProgressValueAddedCond.notify_all();
 }
 
 void UnifiedCache::_fetch(
@@ -479,13 +946,20 @@ UBool UnifiedCache::_isEvictable(const UHashElement *element) const
     return (!theKey->fIsMaster || (theValue->softRefCount == 1 && theValue->noHardReferences()));
 }
 
-void UnifiedCache::removeSoftRef(const SharedObject *value) const {
-    U_ASSERT(value->cachePtr == this);
+void UnifiedCache::removeSoftRef(
+        const UnifiedCacheShard &shard, const SharedObject *value) const {
+    const UnifiedCacheShard *owner = _ownerOf(value);
+    U_ASSERT(owner != nullptr && owner->fCache == this);
     U_ASSERT(value->softRefCount > 0);
     if (--value->softRefCount == 0) {
-        --fNumValuesTotal;
+        umtx_atomic_dec(&owner->fNumValuesTotal);
+        owner->fMemoryFootprint -= value->cacheFootprint;
         if (value->noHardReferences()) {
-            delete value;
+            // Deleting the value can release references to other cached values,
+            // which needs a shard mutex, possibly the one held by our caller.
+            // Linking through the value itself cannot fail.
+            value->nextDoomed = shard.fDoomed;
+            shard.fDoomed = value;
         } else {
             // This path only happens from flush(all). Which only happens from the
             // UnifiedCache destructor.  Nulling out value.cacheptr changes the behavior
@@ -495,13 +969,29 @@ void UnifiedCache::removeSoftRef(const SharedObject *value) const {
     }
 }
 
+void UnifiedCache::_deleteDoomed(const UnifiedCacheShard &shard) const {
+    for (;;) {
+        const SharedObject *value;
+        {
+            std::lock_guard<std::mutex> lock(shard.fMutex);
+            value = shard.fDoomed;
+            if (value == nullptr) {
+                return;
+            }
+            shard.fDoomed = value->nextDoomed;
+        }
+        delete value;
+    }
+}
+
 int32_t UnifiedCache::removeHardRef(const SharedObject *value) const {
     int refCount = 0;
     if (value) {
         refCount = umtx_atomic_dec(&value->hardRefCount);
         U_ASSERT(refCount >= 0);
-        if (refCount == 0) {
-            --fNumValuesInUse;
+        const UnifiedCacheShard *owner = _ownerOf(value);
+        if (refCount == 0 && owner != nullptr) {
+            umtx_atomic_dec(&owner->fNumValuesInUse);
         }
     }
     return refCount;
@@ -512,8 +1002,9 @@ int32_t UnifiedCache::addHardRef(const SharedObject *value) const {
     if (value) {
         refCount = umtx_atomic_inc(&value->hardRefCount);
         U_ASSERT(refCount >= 1);
-        if (refCount == 1) {
-            fNumValuesInUse++;
+        const UnifiedCacheShard *owner = _ownerOf(value);
+        if (refCount == 1 && owner != nullptr) {
+            umtx_atomic_inc(&owner->fNumValuesInUse);
         }
     }
     return refCount;
@@ -17,10 +17,12 @@
 
 #include "unicode/uobject.h"
 #include "unicode/locid.h"
+#include "unicode/ucache.h"
 #include "sharedobject.h"
 #include "unicode/unistr.h"
 #include "cstring.h"
 #include "ustr_imp.h"
+#include "udatamem.h"
 
 struct UHashtable;
 struct UHashElement;
@@ -28,19 +30,22 @@ struct UHashElement;
 U_NAMESPACE_BEGIN
 
 class UnifiedCache;
+struct UnifiedCacheHotEntry;
 
 /**
  * A base class for all cache keys.
  */
 class U_COMMON_API CacheKeyBase : public UObject {
  public:
-   CacheKeyBase() : fCreationStatus(U_ZERO_ERROR), fIsMaster(FALSE) {}
+   CacheKeyBase() : fCreationStatus(U_ZERO_ERROR), fIsMaster(FALSE), fRecentUses(0),
+                    fDataEpoch(udata_getDataEpoch()) {}
 
    /**
     * Copy constructor. Needed to support cloning.
     */
    CacheKeyBase(const CacheKeyBase &other) 
-           : UObject(other), fCreationStatus(other.fCreationStatus), fIsMaster(FALSE) { }
+           : UObject(other), fCreationStatus(other.fCreationStatus), fIsMaster(FALSE),
+             fRecentUses(0), fDataEpoch(other.fDataEpoch) { }
    virtual ~CacheKeyBase();
 
    /**
@@ -86,9 +91,30 @@ class U_COMMON_API CacheKeyBase : public UObject {
    UBool operator != (const CacheKeyBase &other) const {
        return !(*this == other);
    }
+
+   /**
+    * Returns TRUE if both keys were created in the same data epoch.
+    * Cache lookups match only keys of the same epoch.
+    */
+   UBool isSameDataEpoch(const CacheKeyBase &other) const {
+       return fDataEpoch == other.fDataEpoch;
+   }
  private:
    mutable UErrorCode fCreationStatus;
    mutable UBool fIsMaster;
+
+   /**
+    * CLOCK counter for the memory budget: set on every use of the cache
+    * entry, counted down by eviction sweeps. Written by lock-free readers.
+    */
+   mutable std::atomic<int8_t> fRecentUses;
+
+   /**
+    * The data epoch when the key was created, see udata_publishOverlay().
+    * Keys of different epochs are not equal, so that objects built from
+    * data that has since been overlaid are not found, and are evicted like unused ones.
+    */
+   int32_t fDataEpoch;
    friend class UnifiedCache;
 };
 
@@ -106,8 +132,9 @@ class CacheKey : public CacheKeyBase {
     * The template parameter, T, determines the hash code returned.
     */
    virtual int32_t hashCode() const {
-       const char *s = typeid(T).name();
-       return ustr_hashCharsN(s, static_cast<int32_t>(uprv_strlen(s)));
+       // The type name is the same for all keys of this class; hash it once.
+       static const int32_t typeHash = hashTypeName();
+       return typeHash;
    }
 
    /**
@@ -126,6 +153,12 @@ class CacheKey : public CacheKeyBase {
    virtual UBool operator == (const CacheKeyBase &other) const {
        return typeid(*this) == typeid(other);
    }
+
+ private:
+   static int32_t hashTypeName() {
+       const char *s = typeid(T).name();
+       return ustr_hashCharsN(s, static_cast<int32_t>(uprv_strlen(s)));
+   }
 };
 
 /**
@@ -136,13 +169,18 @@ template<typename T>
 class LocaleCacheKey : public CacheKey<T> {
  protected:
    Locale   fLoc;
+   // Computed once: the cache hashes each key at least twice per lookup,
+   // and clones copy it instead of rehashing the locale ID.
+   int32_t  fHash;
  public:
-   LocaleCacheKey(const Locale &loc) : fLoc(loc) {}
+   LocaleCacheKey(const Locale &loc)
+           : fLoc(loc),
+             fHash((int32_t)(37u * (uint32_t)CacheKey<T>::hashCode() + (uint32_t)loc.hashCode())) {}
    LocaleCacheKey(const LocaleCacheKey<T> &other)
-           : CacheKey<T>(other), fLoc(other.fLoc) { }
+           : CacheKey<T>(other), fLoc(other.fLoc), fHash(other.fHash) { }
    virtual ~LocaleCacheKey() { }
    virtual int32_t hashCode() const {
-       return (int32_t)(37u * (uint32_t)CacheKey<T>::hashCode() + (uint32_t)fLoc.hashCode());
+       return fHash;
    }
    virtual UBool operator == (const CacheKeyBase &other) const {
        // reflexive
@@ -175,20 +213,104 @@ class LocaleCacheKey : public CacheKey<T> {
 
 };
 
+/**
+ * One hash partition of the UnifiedCache. Each shard has its own hash table,
+ * mutex, in-progress condition and eviction state so that lookups of keys
+ * that land in different shards do not contend with each other.
+ *
+ * A SharedObject's cachePtr points to the shard holding its master entry.
+ * All other state is private to the UnifiedCache implementation.
+ *
+ * Besides the hash table, each shard publishes completed entries in a small
+ * direct-mapped hot table that readers search without taking the mutex.
+ * Readers announce themselves in one of two counters selected by fReadEpoch;
+ * before a published key or value may be deleted, the writer unpublishes it,
+ * advances the epoch and waits for the readers of the old epoch to finish.
+ * @internal
+ */
+class U_COMMON_API UnifiedCacheShard : public UnifiedCacheBase {
+ public:
+   /** Number of slots in the lock-free hot table. */
+   static constexpr int32_t HOT_TABLE_SIZE = 64;
+
+   virtual void handleUnreferencedObject() const;
+   virtual ~UnifiedCacheShard();
+ private:
+   UnifiedCacheShard();
+   UnifiedCacheShard(const UnifiedCacheShard &other);
+   UnifiedCacheShard &operator=(const UnifiedCacheShard &other);
+
+   const UnifiedCache *fCache;
+   UHashtable *fHashtable;
+   mutable std::mutex fMutex;
+   mutable std::condition_variable fInProgressValueAddedCond;
+   mutable int32_t fEvictPos;
+
+   /**
+    * Counts of values whose master entry lives in this shard. These may be
+    * updated while another shard's mutex is held, so they are atomic.
+    */
+   mutable u_atomic_int32_t fNumValuesTotal;
+   mutable u_atomic_int32_t fNumValuesInUse;
+   mutable int64_t fAutoEvictedCount;
+
+   /** Footprint in bytes of the values whose master entry lives here. */
+   mutable std::atomic<int64_t> fMemoryFootprint;
+
+   mutable std::atomic<UnifiedCacheHotEntry *> fHotTable[HOT_TABLE_SIZE];
+   mutable std::atomic<int32_t> fReadEpoch;
+   mutable std::atomic<int32_t> fActiveReaders[2];
+   // Shares the cache line that lock-free readers write anyway.
+   mutable std::atomic<int64_t> fHitsWithoutLock;
+
+   // Statistics updated with the mutex held.
+   mutable int64_t fLockedHits;
+   mutable int64_t fMisses;
+   mutable int64_t fInProgressWaits;
+   mutable int64_t fInProgressWaitNanos;
+
+   /**
+    * Unpublished hot entries that readers may still be looking at.
+    * Freed by the next UnifiedCache::_synchronize() on this shard.
+    */
+   mutable UnifiedCacheHotEntry *fRetired;
+   mutable int32_t fRetiredCount;
+
+   /**
+    * Values that lost their last reference while the mutex was held,
+    * from entries in this shard, linked through SharedObject::nextDoomed.
+    * Their destructors may release other cached values, which would need
+    * the mutex again, so they are deleted only after it is released.
+    */
+   mutable const SharedObject *fDoomed;
+   friend class UnifiedCache;
+};
+
 /**
  * The unified cache. A singleton type.
  * Design doc here:
  * https://docs.google.com/document/d/1RwGQJs4N4tawNbf809iYDRCvXoMKqDJihxzYt1ysmd8/edit?usp=sharing
+ *
+ * The cache is split into shards selected by CacheKeyBase::hashCode().
+ * Each shard is locked, waited on and evicted independently.
  */
-class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
+class U_COMMON_API UnifiedCache : public UObject {
  public:
    /**
     * @internal
     * Do not call directly. Instead use UnifiedCache::getInstance() as
     * there should be only one UnifiedCache in an application.
+    * Creates a cache with a single shard.
     */
    UnifiedCache(UErrorCode &status);
 
+   /**
+    * @internal
+    * Do not call directly. Creates a cache with shardCount shards.
+    * If shardCount is less than 1, sets status to U_ILLEGAL_ARGUMENT_ERROR.
+    */
+   UnifiedCache(int32_t shardCount, UErrorCode &status);
+
    /**
     * Return a pointer to the global cache instance.
     */
@@ -308,6 +430,10 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
     *
     * If this method is never called, the default settings are 1000 and 100%.
     *
+    * Each shard evicts on its own: a shard begins eviction when its unused
+    * entries exceed both count / (number of shards) and its own in-use
+    * items * (percentageOfInUseItems / 100).
+    *
     * Although this method is thread-safe, it is designed to be called at
     * application startup. If it is called in the middle of execution, it
     * will have no immediate effect on the cache. However over time, the
@@ -328,6 +454,28 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
            int32_t count, int32_t percentageOfInUseItems, UErrorCode &status);
 
 
+   /**
+    * Configures an optional memory budget, in bytes, for the values in this
+    * cache. The budget is split evenly between the shards. When a shard is
+    * over its share, eviction slices also run, and they sweep with CLOCK
+    * second chances: an unused entry that was used since the last sweep is
+    * skipped, and entries whose values are large (and therefore typically
+    * expensive to rebuild) get extra chances.
+    *
+    * The budget is a target rather than a hard limit: values in use are
+    * never evicted. Sizes come from SharedObject::getMemoryFootprint().
+    *
+    * A maxBytes of 0, the default, disables the memory budget; then only the
+    * count based policy of setEvictionPolicy() applies. If maxBytes is
+    * negative, sets status to U_ILLEGAL_ARGUMENT_ERROR.
+    */
+   void setMemoryBudget(int64_t maxBytes, UErrorCode &status);
+
+   /**
+    * Returns the approximate number of bytes used by the values in this cache.
+    */
+   int64_t memoryFootprint() const;
+
    /**
     * Returns how many entries have been auto evicted during the lifetime
     * of this cache. This only includes auto evicted entries, not
@@ -335,33 +483,120 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
     */
    int64_t autoEvictedCount() const;
 
+   /**
+    * Fills in a snapshot of this cache's counters.
+    * @see ucache_getStats
+    */
+   void getStats(UCacheStats &stats) const;
+
+   /**
+    * Fills in the key and memory counts per key type.
+    * Type names are those of the C++ key classes.
+    * @see ucache_getKeyTypeStats
+    */
+   int32_t getKeyTypeStats(
+           UCacheKeyTypeStats *dest, int32_t capacity, UErrorCode &status) const;
+
    /**
     * Returns the unused entry count in this cache. For testing only,
     * Regular clients will not need this.
     */
    int32_t unusedCount() const;
 
-   virtual void handleUnreferencedObject() const;
+   /**
+    * Returns the number of shards in this cache.
+    */
+   int32_t shardCount() const { return fShardCount; }
+
    virtual ~UnifiedCache();
    
  private:
-   UHashtable *fHashtable;
-   mutable int32_t fEvictPos;
-   mutable int32_t fNumValuesTotal;
-   mutable int32_t fNumValuesInUse;
-   int32_t fMaxUnused;
-   int32_t fMaxPercentageOfInUse;
-   mutable int64_t fAutoEvictedCount;
+   UnifiedCacheShard *fShards;
+   int32_t fShardCount;
+   mutable u_atomic_int32_t fMaxUnused;
+   mutable u_atomic_int32_t fMaxPercentageOfInUse;
+   mutable std::atomic<int64_t> fMaxBytes;
    SharedObject *fNoValue;
    
    UnifiedCache(const UnifiedCache &other);
    UnifiedCache &operator=(const UnifiedCache &other);
+
+   friend class UnifiedCacheShard;
+
+   /**
+    * Allocates and initializes the shards. Called from the constructors.
+    */
+   void init(int32_t shardCount, UErrorCode &status);
+
+   /**
+    * Returns the shard that holds the given key.
+    */
+   UnifiedCacheShard &_shardFor(const CacheKeyBase &key) const;
+
+   /**
+    * Returns the shard that holds the master entry of value, or nullptr if
+    * value is not (or no longer) owned by this cache.
+    */
+   static const UnifiedCacheShard *_ownerOf(const SharedObject *value);
+
+   /**
+    * Returns the shard that holds keys with the given hash code.
+    */
+   UnifiedCacheShard &_shardFor(int32_t hashCode) const;
+
+   /**
+    * Looks up key in its shard's hot table without locking.
+    * On entry, value must be NULL and status must be U_ZERO_ERROR.
+    * Returns TRUE on a hit, with a hard reference added to value and status
+    * set to the stored creation status. Returns FALSE otherwise, leaving
+    * value and status unchanged; caller should then use the locked path.
+    */
+   UBool _pollHot(
+           const CacheKeyBase &key,
+           int32_t hashCode,
+           const SharedObject *&value,
+           UErrorCode &status) const;
+
+   /**
+    * Publishes a completed hash entry in the shard's hot table. Entries that
+    * are in progress or hold an error are not published.
+    * On entry, the shard's mutex must be held.
+    */
+   void _publishHot(const UnifiedCacheShard &shard, const UHashElement *element) const;
+
+   /**
+    * Removes any hot table entry for the given key from the shard.
+    * The removed entry is retired, not freed.
+    * On entry, the shard's mutex must be held.
+    */
+   void _unpublishHot(const UnifiedCacheShard &shard, const CacheKeyBase *key, int32_t hashCode) const;
+
+   /**
+    * Waits until no reader can still see an unpublished hot entry of the
+    * shard, then frees the retired entries. After this returns, all hard
+    * references added by lock-free readers are visible.
+    * On entry, the shard's mutex must be held.
+    */
+   void _synchronize(const UnifiedCacheShard &shard) const;
+
+   /**
+    * Deletes the values that removeSoftRef() left for deletion in the shard,
+    * including any that become unreferenced while doing so.
+    * On entry, the shard's mutex must not be held.
+    */
+   void _deleteDoomed(const UnifiedCacheShard &shard) const;
+
+   /**
+    * Called by a shard when one of its values drops to zero hard references.
+    * On entry, the shard's mutex must not be held.
+    */
+   void _handleUnreferencedObject(const UnifiedCacheShard &shard) const;
    
    /**
-    * Flushes the contents of the cache. If cache values hold references to other
+    * Flushes the contents of one shard. If cache values hold references to other
     * cache values then _flush should be called in a loop until it returns FALSE.
     * 
-    * On entry, gCacheMutex must be held.
+    * On entry, the shard's mutex must be held.
     * On exit, those values with are evictable are flushed.
     * 
     *  @param all if false flush evictable items only, which are those with no external
@@ -372,11 +607,11 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
     *                     _flush is not thread safe when all is true.
     *   @return TRUE if any value in cache was flushed or FALSE otherwise.
     */
-   UBool _flush(UBool all) const;
+   UBool _flush(const UnifiedCacheShard &shard, UBool all) const;
    
    /**
     * Gets value out of cache.
-    * On entry. gCacheMutex must not be held. value must be NULL. status
+    * On entry. The key's shard mutex must not be held. value must be NULL. status
     * must be U_ZERO_ERROR.
     * On exit. value and status set to what is in cache at key or on cache
     * miss the key's createObject() is called and value and status are set to
@@ -393,7 +628,7 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
 
     /**
      * Attempts to fetch value and status for key from cache.
-     * On entry, gCacheMutex must not be held value must be NULL and status must
+     * On entry, the key's shard mutex must not be held value must be NULL and status must
      * be U_ZERO_ERROR.
      * On exit, either returns FALSE (In this
      * case caller should try to create the object) or returns TRUE with value
@@ -409,11 +644,12 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
     
     /**
      * Places a new value and creationStatus in the cache for the given key.
-     * On entry, gCacheMutex must be held. key must not exist in the cache. 
+     * On entry, the shard's mutex must be held. key must not exist in the shard.
      * On exit, value and creation status placed under key. Soft reference added
      * to value on successful add. On error sets status.
      */
     void _putNew(
+        const UnifiedCacheShard &shard,
         const CacheKeyBase &key,
         const SharedObject *value,
         const UErrorCode creationStatus,
@@ -424,7 +660,7 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
      * entry for key is in progress. Otherwise, it leaves the current value and
      * status there.
      * 
-     * On entry. gCacheMutex must not be held. Value must be
+     * On entry. The key's shard mutex must not be held. Value must be
      * included in the reference count of the object to which it points.
      * 
      * On exit, value and status are changed to what was already in the cache if
@@ -440,9 +676,9 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
     /**
      * Returns the next element in the cache round robin style.
      * Returns nullptr if the cache is empty.
-     * On entry, gCacheMutex must be held.
+     * On entry, the shard's mutex must be held.
      */
-    const UHashElement *_nextElement() const;
+    const UHashElement *_nextElement(const UnifiedCacheShard &shard) const;
    
    /**
     * Return the number of cache items that would need to be evicted
@@ -450,17 +686,29 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
     * 
     * An item corresponds to an entry in the hash table, a hash table element.
     * 
-    * On entry, gCacheMutex must be held.
+    * On entry, the shard's mutex must be held.
     */
-   int32_t _computeCountOfItemsToEvict() const;
+   int32_t _computeCountOfItemsToEvict(const UnifiedCacheShard &shard) const;
+
+   /**
+    * Returns TRUE if a memory budget is set and the shard uses more than
+    * its share of it.
+    */
+   UBool _isOverMemoryBudget(const UnifiedCacheShard &shard) const;
+
+   /**
+    * Notes a use of a cache entry for the CLOCK sweep of the memory budget.
+    * May be called without holding any mutex.
+    */
+   static void _recordUse(const CacheKeyBase *key, const SharedObject *value);
    
    /**
-    * Run an eviction slice.
-    * On entry, gCacheMutex must be held.
+    * Run an eviction slice on one shard.
+    * On entry, the shard's mutex must be held.
     * _runEvictionSlice runs a slice of the evict pipeline by examining the next
-    * 10 entries in the cache round robin style evicting them if they are eligible.
+    * 10 entries in the shard round robin style evicting them if they are eligible.
     */
-   void _runEvictionSlice() const;
+   void _runEvictionSlice(const UnifiedCacheShard &shard) const;
  
    /**
     * Register a master cache entry. A master key is the first key to create
@@ -468,37 +716,47 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
     * produce referneces to an already existing SharedObject are not masters -
     * they can be evicted and subsequently recreated.
     * 
-    * On entry, gCacheMutex must be held.
-    * On exit, items in use count incremented, entry is marked as a master
-    * entry, and value registered with cache so that subsequent calls to
-    * addRef() and removeRef() on it correctly interact with the cache.
-    */
-   void _registerMaster(const CacheKeyBase *theKey, const SharedObject *value) const;
+    * On entry, the shard's mutex must be held.
+    * On exit, the shard's items in use count incremented, entry is marked as a
+    * master entry, and value registered with the shard so that subsequent calls
+    * to addRef() and removeRef() on it correctly interact with the cache.
+    */
+   void _registerMaster(
+           const UnifiedCacheShard &shard,
+           const CacheKeyBase *theKey,
+           const SharedObject *value) const;
         
    /**
     * Store a value and creation error status in given hash entry.
-    * On entry, gCacheMutex must be held. Hash entry element must be in progress.
-    * value must be non NULL.
+    * On entry, the shard's mutex must be held. Hash entry element must be in
+    * progress. value must be non NULL.
     * On Exit, soft reference added to value. value and status stored in hash
-    * entry. Soft reference removed from previous stored value. Waiting
-    * threads notified.
+    * entry. Soft reference removed from previous stored value. Threads waiting
+    * on the shard notified.
     */
    void _put(
+           const UnifiedCacheShard &shard,
            const UHashElement *element,
            const SharedObject *value,
            const UErrorCode status) const;
     /**
      * Remove a soft reference, and delete the SharedObject if no references remain.
+     * The deletion is deferred until the caller calls _deleteDoomed()
+     * after releasing the mutex.
      * To be used from within the UnifiedCache implementation only.
-     * gCacheMutex must be held by caller.
+     * The mutex of the shard holding the removed entry must be held by caller.
+     * @param shard the shard holding the removed entry.
      * @param value the SharedObject to be acted on.
      */
-   void removeSoftRef(const SharedObject *value) const;
+   void removeSoftRef(const UnifiedCacheShard &shard, const SharedObject *value) const;
    
    /**
     * Increment the hard reference count of the given SharedObject.
-    * gCacheMutex must be held by the caller.
-    * Update numValuesEvictable on transitions between zero and one reference.
+    * Update the owning shard's in use count on transitions between zero and
+    * one reference.
+    * Both counts are atomic, so the shard mutex need not be held.
+    * _pollHot() calls this without the mutex, from inside its read epoch;
+    * the epoch keeps the value alive until the reference is added.
     * 
     * @param value The SharedObject to be referenced.
     * @return the hard reference count after the addition.
@@ -507,8 +765,9 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
    
   /**
     * Decrement the hard reference count of the given SharedObject.
-    * gCacheMutex must be held by the caller.
-    * Update numValuesEvictable on transitions between one and zero reference.
+    * Update the owning shard's in use count on transitions between one and
+    * zero reference.
+    * Both counts are atomic, so the shard mutex need not be held.
     * 
     * @param value The SharedObject to be referenced.
     * @return the hard reference count after the removal.
@@ -517,12 +776,12 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
 
    
 #ifdef UNIFIED_CACHE_DEBUG
-   void _dumpContents() const;
+   void _dumpContents(const UnifiedCacheShard &shard) const;
 #endif
    
    /**
     *  Fetch value and error code from a particular hash entry.
-    *  On entry, gCacheMutex must be held. value must be either NULL or must be
+    *  On entry, the shard's mutex must be held. value must be either NULL or must be
     *  included in the ref count of the object to which it points.
     *  On exit, value and status set to what is in the hash entry. Caller must
     *  eventually call removeRef on value.
@@ -534,19 +793,19 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
                        
     /**
      * Determine if given hash entry is in progress.
-     * On entry, gCacheMutex must be held.
+     * On entry, the shard's mutex must be held.
      */
    UBool _inProgress(const UHashElement *element) const;
    
    /**
     * Determine if given hash entry is in progress.
-    * On entry, gCacheMutex must be held.
+    * On entry, the shard's mutex must be held.
     */
    UBool _inProgress(const SharedObject *theValue, UErrorCode creationStatus) const;
    
    /**
     * Determine if given hash entry is eligible for eviction.
-    * On entry, gCacheMutex must be held.
+    * On entry, the shard's mutex must be held.
     */
    UBool _isEvictable(const UHashElement *element) const;
 };
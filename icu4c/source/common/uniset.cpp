@@ -1474,7 +1474,7 @@ UnicodeSet::UnicodeSet(const uint16_t data[], int32_t dataLen, ESerialization se
     return;
   }
 
-  if( (serialization != kSerialized)
+  if( (serialization != kSerialized && serialization != kSerializedFrozen)
       || (data==NULL)
       || (dataLen < 1)) {
     ec = U_ILLEGAL_ARGUMENT_ERROR;
@@ -1486,6 +1486,15 @@ UnicodeSet::UnicodeSet(const uint16_t data[], int32_t dataLen, ESerialization se
   int32_t headerSize = ((data[0]&0x8000)) ?2:1;
   int32_t bmpLength = (headerSize==1)?data[0]:data[1];
 
+  // The frozen format appends the BMPSet tables to the serialize() output.
+  int32_t serializedLength = headerSize + (data[0]&0x7FFF);
+  if (serialization == kSerializedFrozen &&
+          dataLen < serializedLength + BMPSet::SERIALIZED_LENGTH) {
+    ec = U_ILLEGAL_ARGUMENT_ERROR;
+    setToBogus();
+    return;
+  }
+
   int32_t newLength = (((data[0]&0x7FFF)-bmpLength)/2)+bmpLength;
 #ifdef DEBUG_SERIALIZE
   printf("dataLen %d headerSize %d bmpLen %d len %d. data[0]=%X/%X/%X/%X\n", dataLen,headerSize,bmpLength,newLength, data[0],data[1],data[2],data[3]);
@@ -1514,6 +1523,18 @@ UnicodeSet::UnicodeSet(const uint16_t data[], int32_t dataLen, ESerialization se
     list[i++] = UNICODESET_HIGH;
   }
   len = i;
+
+  if (serialization == kSerializedFrozen) {
+    bmpSet = new BMPSet(list, len, data + serializedLength, ec);
+    if (bmpSet == NULL) {
+      ec = U_MEMORY_ALLOCATION_ERROR;
+      setToBogus();
+    } else if (U_FAILURE(ec)) {
+      delete bmpSet;
+      bmpSet = NULL;
+      setToBogus();
+    }
+  }
 }
 
 
@@ -1609,6 +1630,30 @@ int32_t UnicodeSet::serialize(uint16_t *dest, int32_t destCapacity, UErrorCode&
     return destLength;
 }
 
+int32_t UnicodeSet::serializeFrozen(uint16_t *dest, int32_t destCapacity, UErrorCode& ec) const {
+    if (U_FAILURE(ec)) {
+        return 0;
+    }
+    if (hasStrings()) {
+        ec=U_UNSUPPORTED_ERROR;
+        return 0;
+    }
+    int32_t length=serialize(dest, destCapacity, ec);
+    if (U_FAILURE(ec) && ec!=U_BUFFER_OVERFLOW_ERROR) {
+        return 0;
+    }
+    int32_t destLength=length+BMPSet::SERIALIZED_LENGTH;
+    if (destLength>destCapacity) {
+        ec=U_BUFFER_OVERFLOW_ERROR;
+    } else if (bmpSet!=NULL) {
+        bmpSet->serialize(dest+length);
+    } else {
+        BMPSet tables(list, len);
+        tables.serialize(dest+length);
+    }
+    return destLength;
+}
+
 //----------------------------------------------------------------
 // Implementation: Utility methods
 //----------------------------------------------------------------
@@ -95,6 +95,14 @@ static UBool U_CALLCONV uset_cleanup();
 static UnicodeSet *uni32Singleton;
 static icu::UInitOnce uni32InitOnce = U_INITONCE_INITIALIZER;
 
+// Sets built by applyIntPropertyValue(), keyed by property and value.
+// Guarded by propertyValueSetsMutex.
+static Hashtable *propertyValueSets = NULL;
+static UMutex propertyValueSetsMutex;
+
+// Sets for rarely used values are not cached once there are this many.
+static const int32_t MAX_CACHED_PROPERTY_VALUE_SETS = 256;
+
 /**
  * Cleanup function for UnicodeSet
  */
@@ -102,6 +110,8 @@ static UBool U_CALLCONV uset_cleanup(void) {
     delete uni32Singleton;
     uni32Singleton = NULL;
     uni32InitOnce.reset();
+    delete propertyValueSets;
+    propertyValueSets = NULL;
     return TRUE;
 }
 
@@ -804,9 +814,33 @@ static UBool mungeCharName(char* dst, const char* src, int32_t dstCapacity) {
 
 #define FAIL(ec) {ec=U_ILLEGAL_ARGUMENT_ERROR; return *this;}
 
+namespace {
+
+UnicodeString &makePropertyValueKey(UProperty prop, int32_t value, UnicodeString &key) {
+    return key.append((UChar)prop).append((UChar)(value >> 16)).append((UChar)value);
+}
+
+}  // namespace
+
 UnicodeSet&
 UnicodeSet::applyIntPropertyValue(UProperty prop, int32_t value, UErrorCode& ec) {
     if (U_FAILURE(ec) || isFrozen()) { return *this; }
+    // Building a set from a property filter visits every same-value range start
+    // of the property, so keep the result for when the same term is used again.
+    UBool isCacheable = prop == UCHAR_GENERAL_CATEGORY_MASK || prop == UCHAR_SCRIPT_EXTENSIONS ||
+        (UCHAR_INT_START <= prop && prop < UCHAR_INT_LIMIT);
+    UnicodeString key;
+    if (isCacheable) {
+        makePropertyValueKey(prop, value, key);
+        Mutex lock(&propertyValueSetsMutex);
+        if (propertyValueSets != NULL) {
+            const UnicodeSet *cached = static_cast<const UnicodeSet *>(propertyValueSets->get(key));
+            if (cached != NULL) {
+                copyFrom(*cached, TRUE);
+                return *this;
+            }
+        }
+    }
     if (prop == UCHAR_GENERAL_CATEGORY_MASK) {
         const UnicodeSet* inclusions = CharacterProperties::getInclusionsForProperty(prop, ec);
         applyFilter(generalCategoryMaskFilter, &value, inclusions, ec);
@@ -832,6 +866,32 @@ UnicodeSet::applyIntPropertyValue(UProperty prop, int32_t value, UErrorCode& ec)
     } else {
         ec = U_ILLEGAL_ARGUMENT_ERROR;
     }
+    if (isCacheable && U_SUCCESS(ec)) {
+        Mutex lock(&propertyValueSetsMutex);
+        if (propertyValueSets == NULL) {
+            propertyValueSets = new Hashtable(ec);
+            if (propertyValueSets == NULL) {
+                ec = U_MEMORY_ALLOCATION_ERROR;
+            } else if (U_FAILURE(ec)) {
+                delete propertyValueSets;
+                propertyValueSets = NULL;
+            } else {
+                propertyValueSets->setValueDeleter(uprv_deleteUObject);
+                ucln_common_registerCleanup(UCLN_COMMON_USET, uset_cleanup);
+            }
+        }
+        if (propertyValueSets != NULL && propertyValueSets->get(key) == NULL &&
+                propertyValueSets->count() < MAX_CACHED_PROPERTY_VALUE_SETS) {
+            // A copy failure only loses the cache entry.
+            UErrorCode cacheErrorCode = U_ZERO_ERROR;
+            UnicodeSet *copy = new UnicodeSet(*this);
+            if (copy != NULL && !copy->isBogus()) {
+                propertyValueSets->put(key, copy, cacheErrorCode);
+            } else {
+                delete copy;
+            }
+        }
+    }
     return *this;
 }
 
@@ -483,6 +483,27 @@ UnicodeString UnicodeString::fromUTF32(const UChar32 *utf32, int32_t length) {
 // Assignment
 //========================================
 
+namespace {
+
+/**
+ * Copies the contents of a short string's stack buffer.
+ * With the default UNISTR_OBJECT_SIZE, copying the whole fixed-size buffer
+ * compiles to a few unconditional register moves,
+ * while a variable-length uprv_memcpy() is a function call.
+ * Larger configured buffers are copied only up to the string length.
+ */
+template<int32_t capacity>
+inline void copyStackBuffer(char16_t (&dest)[capacity], const char16_t (&src)[capacity],
+                            int32_t length) {
+    if (capacity * U_SIZEOF_UCHAR <= 64) {
+        uprv_memcpy(dest, src, capacity * U_SIZEOF_UCHAR);
+    } else {
+        uprv_memcpy(dest, src, length * U_SIZEOF_UCHAR);
+    }
+}
+
+}  // namespace
+
 UnicodeString &
 UnicodeString::operator=(const UnicodeString &src) {
   return copyFrom(src);
@@ -520,8 +541,8 @@ UnicodeString::copyFrom(const UnicodeString &src, UBool fastCopy) {
   switch(src.fUnion.fFields.fLengthAndFlags & kAllStorageFlags) {
   case kShortString:
     // short string using the stack buffer, do the same
-    uprv_memcpy(fUnion.fStackFields.fBuffer, src.fUnion.fStackFields.fBuffer,
-                getShortLength() * U_SIZEOF_UCHAR);
+    copyStackBuffer(fUnion.fStackFields.fBuffer, src.fUnion.fStackFields.fBuffer,
+                    getShortLength());
     break;
   case kLongString:
     // src uses a refCounted string buffer, use that buffer with refCount
@@ -587,8 +608,8 @@ void UnicodeString::copyFieldsFrom(UnicodeString &src, UBool setSrcToBogus) U_NO
     // Check for self assignment to prevent "overlap in memcpy" warnings,
     // although it should be harmless to copy a buffer to itself exactly.
     if(this != &src) {
-      uprv_memcpy(fUnion.fStackFields.fBuffer, src.fUnion.fStackFields.fBuffer,
-                  getShortLength() * U_SIZEOF_UCHAR);
+      copyStackBuffer(fUnion.fStackFields.fBuffer, src.fUnion.fStackFields.fBuffer,
+                      getShortLength());
     }
   } else {
     // In all other cases, copy all fields.
@@ -727,13 +748,12 @@ UnicodeString::doCompare( int32_t start,
         return (int8_t)(result >> 15 | 1);
       }
 #   else
-      // little-endian: compare UChar units
-      do {
-        result = ((int32_t)*(chars++) - (int32_t)*(srcChars++));
-        if(result != 0) {
-          return (int8_t)(result >> 15 | 1);
-        }
-      } while(--minLength > 0);
+      // little-endian: compare UChar units, after skipping the identical prefix
+      int32_t i = uprv_strFindMismatch(chars, srcChars, minLength);
+      if(i < minLength) {
+        result = ((int32_t)chars[i] - (int32_t)srcChars[i]);
+        return (int8_t)(result >> 15 | 1);
+      }
 #   endif
   }
   return lengthResult;
@@ -186,6 +186,21 @@ unorm_cmpEquivFold(const UChar *s1, int32_t length1,
         return 0;
     }
 
+    /*
+     * Skip the identical prefix, without splitting a surrogate pair.
+     * The loop below would just step over it one code unit at a time.
+     */
+    if(length1>=0 && length2>=0 && (options&_STRNCMP_STYLE)==0) {
+        int32_t i=uprv_strFindMismatch(s1, s2, length1<length2 ? length1 : length2);
+        if(i>0 && U16_IS_LEAD(s1[i-1])) {
+            --i;
+        }
+        s1+=i;
+        length1-=i;
+        s2+=i;
+        length2-=i;
+    }
+
     /* initialize */
     start1=s1;
     if(length1==-1) {
@@ -571,6 +586,64 @@ unorm_compare(const UChar *s1, int32_t length1,
         return 0;
     }
 
+    /*
+     * Skip the common prefix up to its last ASCII character, and compare
+     * all-ASCII strings directly.
+     * ASCII characters are starters that do not decompose,
+     * and they case-fold to ASCII (except 0049 with U_FOLD_CASE_EXCLUDE_SPECIAL_I),
+     * so the rest of the strings compare the same without such a prefix,
+     * and ASCII-only text does not need normalization data.
+     */
+    if((options&U_FOLD_CASE_EXCLUDE_SPECIAL_I)==0) {
+        int32_t i=0, prefixLength=0;
+        UBool isASCII=TRUE;
+        for(;; ++i) {
+            UChar32 c1= (length1>=0 ? i<length1 : s1[i]!=0) ? s1[i] : -1;
+            UChar32 c2= (length2>=0 ? i<length2 : s2[i]!=0) ? s2[i] : -1;
+            if(c1<0 || c2<0) {
+                if(c1==c2) {
+                    return 0;
+                } else if(!isASCII) {
+                    break;
+                }
+                /* The other string continues with at least one more character. */
+                return c1<0 ? -1 : 1;
+            }
+            if(c1!=c2) {
+                if(c1>=0x80 || c2>=0x80) {
+                    break;
+                }
+                if(options&U_COMPARE_IGNORE_CASE) {
+                    if(0x41<=c1 && c1<=0x5a) {
+                        c1+=0x20;
+                    }
+                    if(0x41<=c2 && c2<=0x5a) {
+                        c2+=0x20;
+                    }
+                }
+                if(c1!=c2) {
+                    if(isASCII) {
+                        return c1-c2;
+                    }
+                    break;
+                }
+            }
+            if(c1<0x80) {
+                prefixLength=i+1;
+            } else {
+                isASCII=FALSE;
+            }
+        }
+        s1+=prefixLength;
+        if(length1>=0) {
+            length1-=prefixLength;
+        }
+        s2+=prefixLength;
+        if(length2>=0) {
+            length2-=prefixLength;
+        }
+    }
+
     UnicodeString fcd1, fcd2;
     int32_t normOptions=(int32_t)(options>>UNORM_COMPARE_NORM_OPTIONS_SHIFT);
     options|=_COMPARE_EQUIV;
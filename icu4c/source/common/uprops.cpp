@@ -30,6 +30,8 @@
 #include "unicode/unorm2.h"
 #include "unicode/uscript.h"
 #include "unicode/ustring.h"
+#include "unicode/utf8.h"
+#include "unicode/utf16.h"
 #include "cstring.h"
 #include "mutex.h"
 #include "normalizer2impl.h"
@@ -410,6 +412,63 @@ u_hasBinaryProperty(UChar32 c, UProperty which) {
     }
 }
 
+U_CAPI int32_t U_EXPORT2
+u_hasBinaryProperties(const UChar *s, int32_t length, UProperty which,
+                      UBool *dest, UErrorCode *pErrorCode) {
+    if(U_FAILURE(*pErrorCode)) {
+        return 0;
+    }
+    if(s==NULL || length<-1 || (dest==NULL && length!=0) ||
+            which<UCHAR_BINARY_START || UCHAR_BINARY_LIMIT<=which) {
+        *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    if(length<0) {
+        length=u_strlen(s);
+    }
+    // Look up the property implementation once for the whole string.
+    const BinaryProperty &prop=binProps[which];
+    int32_t i=0;
+    while(i<length) {
+        UChar32 c;
+        int32_t start=i;
+        U16_NEXT(s, i, length, c);
+        UBool value=prop.contains(prop, c, which);
+        do {
+            dest[start]=value;
+        } while(++start<i);
+    }
+    return length;
+}
+
+U_CAPI int32_t U_EXPORT2
+u_hasBinaryPropertiesUTF8(const char *s, int32_t length, UProperty which,
+                          UBool *dest, UErrorCode *pErrorCode) {
+    if(U_FAILURE(*pErrorCode)) {
+        return 0;
+    }
+    if(s==NULL || length<-1 || (dest==NULL && length!=0) ||
+            which<UCHAR_BINARY_START || UCHAR_BINARY_LIMIT<=which) {
+        *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    if(length<0) {
+        length=(int32_t)uprv_strlen(s);
+    }
+    const BinaryProperty &prop=binProps[which];
+    int32_t i=0;
+    while(i<length) {
+        UChar32 c;
+        int32_t start=i;
+        U8_NEXT(s, i, length, c);
+        UBool value= c>=0 && prop.contains(prop, c, which);
+        do {
+            dest[start]=value;
+        } while(++start<i);
+    }
+    return length;
+}
+
 struct IntProperty;
 
 typedef int32_t IntPropertyGetValue(const IntProperty &prop, UChar32 c, UProperty which);
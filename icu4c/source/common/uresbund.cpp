@@ -31,6 +31,7 @@
 #include "ucln_cmn.h"
 #include "cmemory.h"
 #include "cstring.h"
+#include "ucounterimp.h"
 #include "mutex.h"
 #include "uhash.h"
 #include "unicode/uenum.h"
@@ -39,6 +40,7 @@
 #include "umutex.h"
 #include "putilimp.h"
 #include "uassert.h"
+#include "udatamem.h"
 
 using namespace icu;
 
@@ -91,14 +93,15 @@ static UBool chopLocale(char *name) {
 }
 
 /**
- *  Internal function
+ *  Internal function.
+ *  Does not lock resbMutex: The reference counts are atomic, and
+ *  the fallback chain of an entry that is in use does not change.
  */
 static void entryIncrease(UResourceDataEntry *entry) {
-    Mutex lock(&resbMutex);
-    entry->fCountExisting++;
+    umtx_atomic_inc(&entry->fCountExisting);
     while(entry->fParent != NULL) {
       entry = entry->fParent;
-      entry->fCountExisting++;
+      umtx_atomic_inc(&entry->fCountExisting);
     }
 }
 
@@ -146,9 +149,148 @@ static const ResourceData *getFallbackData(const UResourceBundle* resBundle, con
     }
 }
 
+static void entryCloseInt(UResourceDataEntry *resB);
+
+/*
+ * Lock-free memo of the lookups by ures_getByKeyWithFallback() in the tables of an entry,
+ * keyed by the table, the bundle's resource path and the key path,
+ * so that looking up the same deep path again is one hash probe
+ * instead of a binary search per table level, fallback and alias.
+ * Records are added with resbMutex locked, and they stay until the entry is freed.
+ * A record of an item found in another entry holds a reference to that entry.
+ */
+struct UResPathCacheRecord {
+    uint32_t hashCode;
+    Resource table;  /* the table that the path starts from */
+    int32_t resPathLength;
+    const char *path;  /* the bundle's resource path followed by the key path */
+    UResourceDataEntry *entry;  /* where the item was found, or NULL for the entry itself */
+    Resource res;  /* RES_BOGUS if the item is missing */
+};
+
+#define URES_PATH_CACHE_SIZE 128  /* must be a power of 2 */
+#define URES_PATH_CACHE_MAX_PROBES 8
+
+struct UResPathCache {
+    std::atomic<UResPathCacheRecord *> records[URES_PATH_CACHE_SIZE];
+};
+
+static uint32_t pathCacheHash(Resource table, const char *resPath, int32_t resPathLength,
+                              const char *key) {
+    uint32_t hashCode = (uint32_t)ustr_hashCharsN(key, (int32_t)uprv_strlen(key));
+    if(resPathLength > 0) {
+        hashCode += 37u*(uint32_t)ustr_hashCharsN(resPath, resPathLength);
+    }
+    return hashCode*31u+(uint32_t)table;
+}
+
+static UBool pathCacheMatches(const UResPathCacheRecord *record, uint32_t hashCode, Resource table,
+                              const char *resPath, int32_t resPathLength, const char *key) {
+    return (UBool)(record->hashCode == hashCode && record->table == table &&
+        record->resPathLength == resPathLength &&
+        (resPathLength == 0 || uprv_memcmp(record->path, resPath, resPathLength) == 0) &&
+        uprv_strcmp(record->path + resPathLength, key) == 0);
+}
+
+/**
+ *  INTERNAL: Looks up the memo of a lookup of key in the table of resB.
+ *    Does not need resbMutex to be locked.
+ */
+static UBool pathCacheGet(const UResourceBundle *resB, const char *key, uint32_t hashCode,
+                          UResourceDataEntry **entry, Resource *res) {
+    const UResPathCache *pathCache = resB->fData->fPathCache.load(std::memory_order_acquire);
+    if(pathCache == NULL) {
+        return FALSE;
+    }
+    for(int32_t i = 0; i < URES_PATH_CACHE_MAX_PROBES; ++i) {
+        const UResPathCacheRecord *record =
+            pathCache->records[(hashCode + i) & (URES_PATH_CACHE_SIZE - 1)].load(std::memory_order_acquire);
+        if(record == NULL) {
+            break;
+        }
+        if(pathCacheMatches(record, hashCode, resB->fRes, resB->fResPath, resB->fResPathLen, key)) {
+            *entry = record->entry;
+            *res = record->res;
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+/**
+ *  INTERNAL: Adds the result of a lookup of key in the table of resB
+ *    to the memo of its entry, if there is room for it.
+ */
+static void pathCachePut(const UResourceBundle *resB, const char *key, uint32_t hashCode,
+                         UResourceDataEntry *entry, Resource res) {
+    Mutex lock(&resbMutex);
+    UResPathCache *pathCache = resB->fData->fPathCache.load(std::memory_order_relaxed);
+    if(pathCache == NULL) {
+        pathCache = (UResPathCache *)uprv_calloc(1, sizeof(UResPathCache));
+        if(pathCache == NULL) {
+            return;  /* The memo is best-effort only. */
+        }
+        resB->fData->fPathCache.store(pathCache, std::memory_order_release);
+    }
+    int32_t resPathLength = resB->fResPathLen;
+    for(int32_t i = 0; i < URES_PATH_CACHE_MAX_PROBES; ++i) {
+        std::atomic<UResPathCacheRecord *> &slot =
+            pathCache->records[(hashCode + i) & (URES_PATH_CACHE_SIZE - 1)];
+        const UResPathCacheRecord *record = slot.load(std::memory_order_relaxed);
+        if(record != NULL) {
+            if(pathCacheMatches(record, hashCode, resB->fRes, resB->fResPath, resPathLength, key)) {
+                return;
+            }
+            continue;
+        }
+        int32_t keyLength = (int32_t)uprv_strlen(key) + 1;
+        UResPathCacheRecord *newRecord = (UResPathCacheRecord *)uprv_malloc(
+            sizeof(UResPathCacheRecord) + resPathLength + keyLength);
+        if(newRecord == NULL) {
+            return;
+        }
+        char *path = (char *)(newRecord + 1);
+        if(resPathLength > 0) {
+            uprv_memcpy(path, resB->fResPath, resPathLength);
+        }
+        uprv_memcpy(path + resPathLength, key, keyLength);
+        newRecord->hashCode = hashCode;
+        newRecord->table = resB->fRes;
+        newRecord->resPathLength = resPathLength;
+        newRecord->path = path;
+        newRecord->entry = entry;
+        newRecord->res = res;
+        if(entry != NULL) {
+            entryIncrease(entry);
+        }
+        slot.store(newRecord, std::memory_order_release);
+        return;
+    }
+}
+
+/** INTERNAL: Releases the memo of an entry that is being freed. */
+static void pathCacheFree(UResourceDataEntry *entry) {
+    UResPathCache *pathCache = entry->fPathCache.load(std::memory_order_relaxed);
+    if(pathCache == NULL) {
+        return;
+    }
+    for(int32_t i = 0; i < URES_PATH_CACHE_SIZE; ++i) {
+        UResPathCacheRecord *record = pathCache->records[i].load(std::memory_order_relaxed);
+        if(record != NULL) {
+            if(record->entry != NULL) {
+                entryCloseInt(record->entry);
+            }
+            uprv_free(record);
+        }
+    }
+    uprv_free(pathCache);
+    entry->fPathCache.store(NULL, std::memory_order_relaxed);
+}
+
 static void
 free_entry(UResourceDataEntry *entry) {
     UResourceDataEntry *alias;
+    pathCacheFree(entry);
     res_unload(&(entry->fData));
     if(entry->fName != NULL && entry->fName != entry->fNameBuffer) {
         uprv_free(entry->fName);
@@ -169,6 +311,12 @@ free_entry(UResourceDataEntry *entry) {
     uprv_free(entry);
 }
 
+/*
+ * Entries that init_entry() removed from the cache because their data was overlaid.
+ * They stay in this list while they are in use; access protected by resbMutex.
+ */
+static UResourceDataEntry *gRetiredEntries = NULL;
+
 /* Works just like ucnv_flushCache() */
 static int32_t ures_flushCache()
 {
@@ -209,6 +357,16 @@ static int32_t ures_flushCache()
                 free_entry(resB);
             }
         }
+        for (UResourceDataEntry **pRetired = &gRetiredEntries; (resB = *pRetired) != NULL;) {
+            if (resB->fCountExisting == 0) {
+                rbDeletedNum++;
+                deletedMore = TRUE;
+                *pRetired = resB->fNextRetired;
+                free_entry(resB);
+            } else {
+                pRetired = &resB->fNextRetired;
+            }
+        }
         /*
          * Do it again to catch bundles (aliases, pool bundle) whose fCountExisting
          * got decremented by free_entry().
@@ -238,7 +396,7 @@ U_CAPI UBool U_EXPORT2 ures_dumpCacheContents(void) {
       resB = (UResourceDataEntry *) e->value.pointer;
       fprintf(stderr,"%s:%d: RB Cache: Entry @0x%p, refcount %d, name %s:%s.  Pool 0x%p, alias 0x%p, parent 0x%p\n",
               __FILE__, __LINE__,
-              (void*)resB, resB->fCountExisting,
+              (void*)resB, (int)umtx_loadAcquire(resB->fCountExisting),
               resB->fName?resB->fName:"NULL",
               resB->fPath?resB->fPath:"NULL",
               (void*)resB->fPool,
@@ -252,12 +410,16 @@ U_CAPI UBool U_EXPORT2 ures_dumpCacheContents(void) {
 
 #endif
 
+static void openCacheClear();
+
 static UBool U_CALLCONV ures_cleanup(void)
 {
+    openCacheClear();
     if (cache != NULL) {
         ures_flushCache();
         uhash_close(cache);
         cache = NULL;
+        gRetiredEntries = NULL;  /* Like the cache, entries that are still in use are abandoned. */
     }
     gCacheInitOnce.reset();
     return TRUE;
@@ -297,6 +459,26 @@ static void setEntryName(UResourceDataEntry *res, const char *name, UErrorCode *
 static UResourceDataEntry *
 getPoolEntry(const char *path, UErrorCode *status);
 
+/**
+ *  INTERNAL: Returns TRUE if no data of the entry, its parents, pool bundle and alias
+ *  has been overlaid since the entry was loaded, see udata_publishOverlay().
+ *  Marks the entries that are current with the epoch, so that the next check is one comparison.
+ *    CAUTION:  resbMutex must be locked when calling this function.
+ */
+static UBool isEntryCurrent(UResourceDataEntry *r, int32_t epoch) {
+    if (r->fDataEpoch == epoch) {
+        return TRUE;
+    }
+    if (udata_isOverlaidSince(r->fPath, "res", r->fName, r->fDataEpoch) ||
+            (r->fParent != NULL && !isEntryCurrent(r->fParent, epoch)) ||
+            (r->fPool != NULL && !isEntryCurrent(r->fPool, epoch)) ||
+            (r->fAlias != NULL && !isEntryCurrent(r->fAlias, epoch))) {
+        return FALSE;
+    }
+    r->fDataEpoch = epoch;
+    return TRUE;
+}
+
 /**
  *  INTERNAL: Inits and opens an entry from a data DLL.
  *    CAUTION:  resbMutex must be locked when calling this function.
@@ -332,7 +514,19 @@ static UResourceDataEntry *init_entry(const char *localeID, const char *path, UE
     /*hashValue = hashEntry(hashkey);*/
 
     /* check to see if we already have this entry */
+    int32_t epoch = udata_getDataEpoch();
     r = (UResourceDataEntry *)uhash_get(cache, &find);
+    if(r != NULL && !isEntryCurrent(r, epoch)) {
+        /*
+         * The data was overlaid: Load the entry again.
+         * The old one is still in use by open bundles and by other entries' fallback chains,
+         * and ures_flushCache() frees it when it is no longer used.
+         */
+        uhash_remove(cache, r);
+        r->fNextRetired = gRetiredEntries;
+        gRetiredEntries = r;
+        r = NULL;
+    }
     if(r == NULL) {
         /* if the entry is not yet in the hash table, we'll try to construct a new one */
         r = (UResourceDataEntry *) uprv_malloc(sizeof(UResourceDataEntry));
@@ -341,8 +535,9 @@ static UResourceDataEntry *init_entry(const char *localeID, const char *path, UE
             return NULL;
         }
 
-        uprv_memset(r, 0, sizeof(UResourceDataEntry));
+        uprv_memset((void *)r, 0, sizeof(UResourceDataEntry));  // Also sets fCountExisting=0.
         /*r->fHashKey = hashValue;*/
+        r->fDataEpoch = epoch;
 
         setEntryName(r, name, status);
         if (U_FAILURE(*status)) {
@@ -623,6 +818,128 @@ enum UResOpenType {
 };
 typedef enum UResOpenType UResOpenType;
 
+/*
+ * Lock-free cache of the results of entryOpen() and entryOpenDirect(),
+ * keyed by their arguments, so that opening a bundle again
+ * does not lock resbMutex.
+ * Records are added with resbMutex locked, and they stay until ures_cleanup().
+ * Each record holds a reference to its entry and the entry's fallback chain.
+ * Results that depend on the default locale are not cached.
+ * A record of an earlier data epoch is not used, see udata_publishOverlay(),
+ * and it is replaced when the bundle is opened with the lock.
+ * Replaced records are kept until ures_cleanup() because other threads may still read them.
+ */
+struct UResOpenCacheRecord {
+    uint32_t hashCode;
+    UResOpenType openType;
+    const char *path;  /* NULL for ICU data */
+    const char *localeID;
+    UResourceDataEntry *entry;
+    UErrorCode status;  /* warning to return with the entry */
+    int32_t dataEpoch;  /* data epoch when the entry was opened */
+    UResOpenCacheRecord *nextReplaced;
+};
+
+#define URES_OPEN_CACHE_SIZE 1024  /* must be a power of 2 */
+#define URES_OPEN_CACHE_MAX_PROBES 16
+
+static std::atomic<UResOpenCacheRecord *> gOpenCache[URES_OPEN_CACHE_SIZE];
+static UResOpenCacheRecord *gReplacedOpenCacheRecords = NULL;  /* protected by resbMutex */
+
+static uint32_t openCacheHash(const char *path, const char *localeID, UResOpenType openType) {
+    uint32_t hashCode = (uint32_t)ustr_hashCharsN(localeID, (int32_t)uprv_strlen(localeID));
+    if(path != NULL) {
+        hashCode += 37u*(uint32_t)ustr_hashCharsN(path, (int32_t)uprv_strlen(path));
+    }
+    return hashCode*31u+(uint32_t)openType;
+}
+
+static UBool openCacheMatches(const UResOpenCacheRecord *record, uint32_t hashCode,
+                              const char *path, const char *localeID, UResOpenType openType) {
+    return (UBool)(record->hashCode == hashCode && record->openType == openType &&
+        uprv_strcmp(record->localeID, localeID) == 0 &&
+        (path == NULL ? record->path == NULL :
+            record->path != NULL && uprv_strcmp(record->path, path) == 0));
+}
+
+/**
+ *  INTERNAL: Returns the cached entry for these arguments, or NULL.
+ *    Does not need resbMutex to be locked.
+ */
+static UResourceDataEntry *openCacheGet(const char *path, const char *localeID,
+                                        UResOpenType openType, UErrorCode *status) {
+    uint32_t hashCode = openCacheHash(path, localeID, openType);
+    for(int32_t i = 0; i < URES_OPEN_CACHE_MAX_PROBES; ++i) {
+        const UResOpenCacheRecord *record =
+            gOpenCache[(hashCode + i) & (URES_OPEN_CACHE_SIZE - 1)].load(std::memory_order_acquire);
+        if(record == NULL) {
+            break;
+        }
+        if(openCacheMatches(record, hashCode, path, localeID, openType)) {
+            if(record->dataEpoch != udata_getDataEpoch()) {
+                return NULL;
+            }
+            entryIncrease(record->entry);
+            if(record->status != U_ZERO_ERROR) {
+                *status = record->status;
+            }
+            return record->entry;
+        }
+    }
+    return NULL;
+}
+
+/**
+ *  INTERNAL: Adds an entry to the open cache, if there is room for it.
+ *    CAUTION:  resbMutex must be locked when calling this function.
+ */
+static void openCachePut(const char *path, const char *localeID, UResOpenType openType,
+                         UResourceDataEntry *entry, UErrorCode status, int32_t dataEpoch) {
+    uint32_t hashCode = openCacheHash(path, localeID, openType);
+    for(int32_t i = 0; i < URES_OPEN_CACHE_MAX_PROBES; ++i) {
+        std::atomic<UResOpenCacheRecord *> &slot = gOpenCache[(hashCode + i) & (URES_OPEN_CACHE_SIZE - 1)];
+        UResOpenCacheRecord *record = slot.load(std::memory_order_relaxed);
+        if(record != NULL) {
+            if(!openCacheMatches(record, hashCode, path, localeID, openType)) {
+                continue;
+            }
+            if(record->dataEpoch >= dataEpoch) {
+                return;
+            }
+        }
+        int32_t pathLength = path != NULL ? (int32_t)uprv_strlen(path) + 1 : 0;
+        int32_t localeIDLength = (int32_t)uprv_strlen(localeID) + 1;
+        UResOpenCacheRecord *newRecord = (UResOpenCacheRecord *)uprv_malloc(
+            sizeof(UResOpenCacheRecord) + pathLength + localeIDLength);
+        if(newRecord == NULL) {
+            return;  /* The open cache is best-effort only. */
+        }
+        char *strings = (char *)(newRecord + 1);
+        newRecord->hashCode = hashCode;
+        newRecord->openType = openType;
+        newRecord->path = NULL;
+        if(path != NULL) {
+            uprv_memcpy(strings, path, pathLength);
+            newRecord->path = strings;
+            strings += pathLength;
+        }
+        uprv_memcpy(strings, localeID, localeIDLength);
+        newRecord->localeID = strings;
+        newRecord->entry = entry;
+        newRecord->status = status;
+        newRecord->dataEpoch = dataEpoch;
+        newRecord->nextReplaced = NULL;
+        entryIncrease(entry);
+        slot.store(newRecord, std::memory_order_release);
+        if(record != NULL) {
+            record->nextReplaced = gReplacedOpenCacheRecords;
+            gReplacedOpenCacheRecords = record;
+        }
+        return;
+    }
+    /* All of the probed slots are taken; this bundle is opened with the lock. */
+}
+
 static UResourceDataEntry *entryOpen(const char* path, const char* localeID,
                                      UResOpenType openType, UErrorCode* status) {
     U_ASSERT(openType != URES_OPEN_DIRECT);
@@ -633,6 +950,7 @@ static UResourceDataEntry *entryOpen(const char* path, const char* localeID,
     UBool isRoot = FALSE;
     UBool hasRealData = FALSE;
     UBool hasChopped = TRUE;
+    UBool usedDefault = TRUE;  /* The default locale may have been used as a fallback. */
     UBool usingUSRData = U_USE_USRDATA && ( path == NULL || uprv_strncmp(path,U_ICUDATA_NAME,8) == 0);
 
     char name[ULOC_FULLNAME_CAPACITY];
@@ -644,6 +962,13 @@ static UResourceDataEntry *entryOpen(const char* path, const char* localeID,
         return NULL;
     }
 
+    /* Read the epoch first: A record must not claim data that was overlaid while it was opened. */
+    int32_t dataEpoch = udata_getDataEpoch();
+    r = openCacheGet(path, localeID, openType, status);
+    if(r != NULL) {
+        return r;
+    }
+
     uprv_strncpy(name, localeID, sizeof(name) - 1);
     name[sizeof(name) - 1] = 0;
 
@@ -673,6 +998,7 @@ static UResourceDataEntry *entryOpen(const char* path, const char* localeID,
     if(r != NULL) { /* if there is one real locale, we can look for parents. */
         t1 = r;
         hasRealData = TRUE;
+        usedDefault = FALSE;
         if ( usingUSRData ) {  /* This code inserts user override data into the inheritance chain */
             UErrorCode usrStatus = U_ZERO_ERROR;
             UResourceDataEntry *u1 = init_entry(t1->fName, usrDataPath, &usrStatus);
@@ -757,6 +1083,10 @@ static UResourceDataEntry *entryOpen(const char* path, const char* localeID,
         t1 = t1->fParent;
     }
 
+    if(!usedDefault && U_SUCCESS(*status)) {
+        openCachePut(path, localeID, openType, r, intStatus, dataEpoch);
+    }
+
 finish:
     if(U_SUCCESS(*status)) {
         if(intStatus != U_ZERO_ERROR) {
@@ -781,6 +1111,12 @@ entryOpenDirect(const char* path, const char* localeID, UErrorCode* status) {
         return NULL;
     }
 
+    int32_t dataEpoch = udata_getDataEpoch();
+    UResourceDataEntry *cached = openCacheGet(path, localeID, URES_OPEN_DIRECT, status);
+    if(cached != NULL) {
+        return cached;
+    }
+
     Mutex lock(&resbMutex);
     // findFirstExisting() without fallbacks.
     UResourceDataEntry *r = init_entry(localeID, path, status);
@@ -818,13 +1154,14 @@ entryOpenDirect(const char* path, const char* localeID, UErrorCode* status) {
             t1->fParent->fCountExisting++;
             t1 = t1->fParent;
         }
+        openCachePut(path, localeID, URES_OPEN_DIRECT, r, U_ZERO_ERROR, dataEpoch);
     }
     return r;
 }
 
 /**
  * Functions to create and destroy resource bundles.
- *     CAUTION:  resbMutex must be locked when calling this function.
+ *     Like entryIncrease(), these do not need resbMutex to be locked.
  */
 /* INTERNAL: */
 static void entryCloseInt(UResourceDataEntry *resB) {
@@ -832,7 +1169,7 @@ static void entryCloseInt(UResourceDataEntry *resB) {
 
     while(resB != NULL) {
         p = resB->fParent;
-        resB->fCountExisting--;
+        umtx_atomic_dec(&resB->fCountExisting);
 
         /* Entries are left in the cache. TODO: add ures_flushCache() to force a flush
          of the cache. */
@@ -861,10 +1198,27 @@ static void entryCloseInt(UResourceDataEntry *resB) {
  */
 
 static void entryClose(UResourceDataEntry *resB) {
-  Mutex lock(&resbMutex);
   entryCloseInt(resB);
 }
 
+/** INTERNAL: Releases the open cache records, from ures_cleanup(). */
+static void openCacheClear() {
+    for(int32_t i = 0; i < URES_OPEN_CACHE_SIZE; ++i) {
+        UResOpenCacheRecord *record = gOpenCache[i].load(std::memory_order_relaxed);
+        if(record != NULL) {
+            entryCloseInt(record->entry);
+            uprv_free(record);
+            gOpenCache[i].store(NULL, std::memory_order_relaxed);
+        }
+    }
+    while(gReplacedOpenCacheRecords != NULL) {
+        UResOpenCacheRecord *record = gReplacedOpenCacheRecords;
+        gReplacedOpenCacheRecords = record->nextReplaced;
+        entryCloseInt(record->entry);
+        uprv_free(record);
+    }
+}
+
 /*
 U_CFUNC void ures_setResPath(UResourceBundle *resB, const char* toAdd) {
   if(resB->fResPath == NULL) {
@@ -1868,6 +2222,25 @@ ures_getByKeyWithFallback(const UResourceBundle *resB,
 
     int32_t type = RES_GET_TYPE(resB->fRes);
     if(URES_IS_TABLE(type)) {
+        uint32_t hashCode = pathCacheHash(resB->fRes, resB->fResPath, resB->fResPathLen, inKey);
+        UResourceDataEntry *cachedEntry = NULL;
+        if(pathCacheGet(resB, inKey, hashCode, &cachedEntry, &res)) {
+            if(cachedEntry == NULL) {
+                if(res != RES_BOGUS) {
+                    fillIn = init_resb_result(&(resB->fResData), res, inKey, -1, resB->fData, resB, 0, fillIn, status);
+                } else {
+                    *status = U_MISSING_RESOURCE_ERROR;
+                }
+            } else {
+                if(uprv_strcmp(cachedEntry->fName, uloc_getDefault())==0 || uprv_strcmp(cachedEntry->fName, kRootLocaleName)==0) {
+                    *status = U_USING_DEFAULT_WARNING;
+                } else {
+                    *status = U_USING_FALLBACK_WARNING;
+                }
+                fillIn = init_resb_result(&(cachedEntry->fData), res, inKey, -1, cachedEntry, resB, 0, fillIn, status);
+            }
+            return fillIn;
+        }
         res = getTableItemByKeyPath(&(resB->fResData), resB->fRes, inKey);
         const char* key = inKey;
         if(res == RES_BOGUS) {
@@ -1912,6 +2285,9 @@ ures_getByKeyWithFallback(const UResourceBundle *resB,
                 }
             }
             /*const ResourceData *rd = getFallbackData(resB, &key, &realData, &res, status);*/
+            if(U_SUCCESS(*status) && dataEntry != resB->fData) {
+                pathCachePut(resB, inKey, hashCode, res != RES_BOGUS ? dataEntry : NULL, res);
+            }
             if(res != RES_BOGUS) {
               /* check if resB->fResPath gives the right name here */
                 if(uprv_strcmp(dataEntry->fName, uloc_getDefault())==0 || uprv_strcmp(dataEntry->fName, kRootLocaleName)==0) {
@@ -1925,6 +2301,7 @@ ures_getByKeyWithFallback(const UResourceBundle *resB,
                 *status = U_MISSING_RESOURCE_ERROR;
             }
         } else {
+            pathCachePut(resB, inKey, hashCode, NULL, res);
             fillIn = init_resb_result(&(resB->fResData), res, key, -1, resB->fData, resB, 0, fillIn, status);
         }
     } 
@@ -2250,6 +2627,7 @@ ures_openWithType(UResourceBundle *r, const char* path, const char* localeID,
     if(U_FAILURE(*status)) {
         return NULL;
     }
+    UCOUNTER_INC(UCOUNTER_RESOURCE_BUNDLE_OPENS);
 
     UResourceDataEntry *entry;
     if(openType != URES_OPEN_DIRECT) {
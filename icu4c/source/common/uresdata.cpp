@@ -216,6 +216,19 @@ res_init(ResourceData *pResData,
             pResData->usesPoolBundle=(UBool)((att&URES_ATT_USES_POOL_BUNDLE)!=0);
             pResData->poolStringIndexLimit|=(att&0xf000)<<12;  // bits 15..12 -> 27..24
             pResData->poolStringIndex16Limit=(int32_t)((uint32_t)att>>16);
+            if((att&URES_ATT_TABLE_HASHES)!=0 &&
+                    indexes[URES_INDEX_RESOURCES_TOP]+URES_TABLE_HASHES_DIRECTORY<=indexes[URES_INDEX_BUNDLE_TOP]) {
+                const int32_t *hashes=pResData->pRoot+indexes[URES_INDEX_RESOURCES_TOP];
+                int32_t directoryLength=hashes[URES_TABLE_HASHES_DIRECTORY_LENGTH];
+                if(hashes[URES_TABLE_HASHES_CHARSET_FAMILY]==U_CHARSET_FAMILY &&
+                        directoryLength>0 && (directoryLength&(directoryLength-1))==0 &&
+                        directoryLength<=(indexes[URES_INDEX_BUNDLE_TOP]-indexes[URES_INDEX_RESOURCES_TOP]-
+                                          URES_TABLE_HASHES_DIRECTORY)/2) {
+                    pResData->pTableHashes=hashes;
+                    pResData->tableHashesLength=
+                        indexes[URES_INDEX_BUNDLE_TOP]-indexes[URES_INDEX_RESOURCES_TOP];
+                }
+            }
         }
         if((pResData->isPoolBundle || pResData->usesPoolBundle) && indexLength<=URES_INDEX_POOL_CHECKSUM) {
             *errorCode=U_INVALID_FORMAT_ERROR;
@@ -708,6 +721,78 @@ makeResourceFrom16(const ResourceData *pResData, int32_t res16) {
     return URES_MAKE_RESOURCE(URES_STRING_V2, res16);
 }
 
+U_CAPI uint32_t U_EXPORT2
+res_hashTableKey(const char *key, uint32_t seed) {
+    /* FNV-1a over the key bytes, with a finalizer that mixes all bits */
+    uint32_t h=0x811c9dc5u^(seed*0x9e3779b9u);
+    uint8_t c;
+    while((c=(uint8_t)*key++)!=0) {
+        h=(h^c)*0x01000193u;
+    }
+    h^=h>>16;
+    h*=0x85ebca6bu;
+    h^=h>>13;
+    h*=0xc2b2ae35u;
+    h^=h>>16;
+    return h;
+}
+
+/*
+ * Returns the index of the only item of the table that can have the key,
+ * or -1 if the table has no hash index.
+ * The hash index comes from the data file, and res_init() checked only its header.
+ * Anything else that is out of range also returns -1,
+ * and the caller falls back to a binary search.
+ */
+static int32_t
+_res_findHashedTableItem(const ResourceData *pResData, Resource table, int32_t length,
+                         const char *key) {
+    const int32_t *hashes=pResData->pTableHashes;
+    if(hashes==NULL || length<hashes[URES_TABLE_HASHES_MIN_LENGTH]) {
+        return -1;
+    }
+    int32_t directoryLength=hashes[URES_TABLE_HASHES_DIRECTORY_LENGTH];
+    int32_t mask=directoryLength-1;
+    const int32_t *directory=hashes+URES_TABLE_HASHES_DIRECTORY;
+    int32_t i=(int32_t)((table*0x9e3779b9u)>>16)&mask;
+    int32_t probes=0;
+    for(;;) {
+        Resource t=(Resource)directory[2*i];
+        if(t==table) {
+            break;
+        } else if(t==0 || ++probes==directoryLength) {
+            return -1;
+        }
+        i=(i+1)&mask;
+    }
+    int32_t blockOffset=directory[2*i+1];
+    int32_t hashesLength=pResData->tableHashesLength;
+    if(blockOffset<URES_TABLE_HASHES_DIRECTORY+2*directoryLength || blockOffset>=hashesLength) {
+        return -1;
+    }
+    const int32_t *block=hashes+blockOffset;
+    uint32_t bucketCount=(uint32_t)block[0];
+    if(bucketCount==0 || (int64_t)bucketCount+length>hashesLength-blockOffset-1) {
+        return -1;
+    }
+    uint32_t seed=(uint32_t)block[1+URES_HASH_REDUCE(res_hashTableKey(key, 0), bucketCount)];
+    int32_t idx=block[1+bucketCount+URES_HASH_REDUCE(res_hashTableKey(key, seed), (uint32_t)length)];
+    if(idx<0 || idx>=length) {
+        return -1;
+    }
+    return idx;
+}
+
+/* Compares only the key of the one item that the table hash index yields. */
+static int32_t
+_res_findHashedItem(const char *key, const char *tableKey, int32_t idx, const char **realKey) {
+    if(uprv_strcmp(key, tableKey)==0) {
+        *realKey=tableKey;
+        return idx;
+    }
+    return URESDATA_ITEM_NOT_FOUND;
+}
+
 U_CAPI Resource U_EXPORT2
 res_getTableItemByKey(const ResourceData *pResData, Resource table,
                       int32_t *indexR, const char **key) {
@@ -722,7 +807,13 @@ res_getTableItemByKey(const ResourceData *pResData, Resource table,
         if (offset!=0) { /* empty if offset==0 */
             const uint16_t *p= (const uint16_t *)(pResData->pRoot+offset);
             length=*p++;
-            *indexR=idx=_res_findTableItem(pResData, p, length, *key, key);
+            idx=_res_findHashedTableItem(pResData, table, length, *key);
+            if(idx>=0) {
+                idx=_res_findHashedItem(*key, RES_GET_KEY16(pResData, p[idx]), idx, key);
+            } else {
+                idx=_res_findTableItem(pResData, p, length, *key, key);
+            }
+            *indexR=idx;
             if(idx>=0) {
                 const Resource *p32=(const Resource *)(p+length+(~length&1));
                 return p32[idx];
@@ -733,7 +824,13 @@ res_getTableItemByKey(const ResourceData *pResData, Resource table,
     case URES_TABLE16: {
         const uint16_t *p=pResData->p16BitUnits+offset;
         length=*p++;
-        *indexR=idx=_res_findTableItem(pResData, p, length, *key, key);
+        idx=_res_findHashedTableItem(pResData, table, length, *key);
+        if(idx>=0) {
+            idx=_res_findHashedItem(*key, RES_GET_KEY16(pResData, p[idx]), idx, key);
+        } else {
+            idx=_res_findTableItem(pResData, p, length, *key, key);
+        }
+        *indexR=idx;
         if(idx>=0) {
             return makeResourceFrom16(pResData, p[length+idx]);
         }
@@ -743,7 +840,13 @@ res_getTableItemByKey(const ResourceData *pResData, Resource table,
         if (offset!=0) { /* empty if offset==0 */
             const int32_t *p= pResData->pRoot+offset;
             length=*p++;
-            *indexR=idx=_res_findTable32Item(pResData, p, length, *key, key);
+            idx=_res_findHashedTableItem(pResData, table, length, *key);
+            if(idx>=0) {
+                idx=_res_findHashedItem(*key, RES_GET_KEY32(pResData, p[idx]), idx, key);
+            } else {
+                idx=_res_findTable32Item(pResData, p, length, *key, key);
+            }
+            *indexR=idx;
             if(idx>=0) {
                 return (Resource)p[length+idx];
             }
@@ -1326,7 +1429,7 @@ ures_swap(const UDataSwapper *ds,
     const int32_t *inIndexes;
 
     /* the following integers count Resource item offsets (4 bytes each), not bytes */
-    int32_t bundleLength, indexLength, keysBottom, keysTop, resBottom, top;
+    int32_t bundleLength, indexLength, keysBottom, keysTop, resBottom, resTop, top;
 
     /* udata_swapDataHeader checks the arguments */
     headerSize=udata_swapDataHeader(ds, inData, length, outData, pErrorCode);
@@ -1388,6 +1491,7 @@ ures_swap(const UDataSwapper *ds,
     } else {
         resBottom=keysTop;
     }
+    resTop=udata_readInt32(ds, inIndexes[URES_INDEX_RESOURCES_TOP]);
     top=udata_readInt32(ds, inIndexes[URES_INDEX_BUNDLE_TOP]);
     maxTableLength=udata_readInt32(ds, inIndexes[URES_INDEX_MAX_TABLE_LENGTH]);
 
@@ -1487,6 +1591,11 @@ ures_swap(const UDataSwapper *ds,
             uprv_free(tempTable.resFlags);
         }
 
+        /* swap the table hash indexes (int32_t values) after the resources */
+        if(resTop<top) {
+            ds->swapArray32(ds, inBundle+resTop, (top-resTop)*4, outBundle+resTop, pErrorCode);
+        }
+
         /* swap the root resource and indexes */
         ds->swapArray32(ds, inBundle, keysBottom*4, outBundle, pErrorCode);
     }
@@ -156,9 +156,64 @@ enum {
 #define URES_ATT_IS_POOL_BUNDLE 2
 #define URES_ATT_USES_POOL_BUNDLE 4
 
+/*
+ * Table hashes attribute, attribute bit 3 in indexes[URES_INDEX_ATTRIBUTES].
+ * New in ICU 65, for formatVersion 2 and up.
+ *
+ * If set, then the bundle contains perfect-hash indexes for some of its tables
+ * after the resources, between indexes[URES_INDEX_RESOURCES_TOP]
+ * and indexes[URES_INDEX_BUNDLE_TOP]. See the file format description below.
+ */
+#define URES_ATT_TABLE_HASHES 8
+
+/* Maps a 32-bit hash value to 0..n-1 without a division. */
+#define URES_HASH_REDUCE(h, n) ((uint32_t)(((uint64_t)(h)*(n))>>32))
+
+/* Table hash indexes header values; see the file format description below. */
+enum {
+    /** [0] charset family of the key strings that were hashed */
+    URES_TABLE_HASHES_CHARSET_FAMILY,
+    /** [1] tables with fewer items than this have no hash index */
+    URES_TABLE_HASHES_MIN_LENGTH,
+    /** [2] number of directory slots, a power of 2 */
+    URES_TABLE_HASHES_DIRECTORY_LENGTH,
+    /** [3] start of the directory */
+    URES_TABLE_HASHES_DIRECTORY
+};
+
 /*
  * File format for .res resource bundle files
  *
+ * ICU 65: Optional table hash indexes (formatVersion 2 and up): -------------
+ *
+ * genrb --tableHashes writes a minimal-perfect-hash index for each table
+ * with at least a minimum number of items, so that readers can find an item
+ * with one key string comparison rather than a binary search.
+ * Readers that do not know about the indexes ignore them.
+ *
+ * The indexes are stored as int32_t values after the resources,
+ * from indexes[URES_INDEX_RESOURCES_TOP] up to indexes[URES_INDEX_BUNDLE_TOP],
+ * and URES_ATT_TABLE_HASHES is set.
+ *
+ *   int32_t charsetFamily; -- U_CHARSET_FAMILY when the keys were hashed;
+ *                             readers of other charset families ignore the indexes
+ *   int32_t minTableLength;
+ *   int32_t directoryLength; -- a power of 2
+ *   struct { Resource table; int32_t blockOffset; } directory[directoryLength];
+ *       -- open addressing with linear probing, starting at
+ *          ((table*0x9e3779b9)>>16)&(directoryLength-1);
+ *          an empty slot has table==0;
+ *          blockOffset counts int32_t values from charsetFamily
+ *   per hashed table with count items, at its blockOffset:
+ *       int32_t bucketCount, int32_t seeds[bucketCount], int32_t items[count]
+ *
+ * A key is in bucket b=URES_HASH_REDUCE(res_hashTableKey(key, 0), bucketCount),
+ * and items[URES_HASH_REDUCE(res_hashTableKey(key, seeds[b]), count)] is the index
+ * of the table item that must have this key if the table contains it at all.
+ *
+ * ures_swap() swaps the indexes as int32_t values.
+ * (It does not reorder table items in formatVersion 2 and up.)
+ *
  * ICU 56: New in formatVersion 3 compared with 2: -------------
  *
  * Resource bundles can optionally use shared string-v2 values
@@ -397,6 +452,8 @@ typedef struct ResourceData {
     UBool isPoolBundle;
     UBool usesPoolBundle;
     UBool useNativeStrcmp;
+    const int32_t *pTableHashes;  /* table hash indexes, or NULL */
+    int32_t tableHashesLength;  /* number of int32_t values at pTableHashes */
 } ResourceData;
 
 /*
@@ -461,6 +518,13 @@ res_getTableItemByIndex(const ResourceData *pResData, Resource table, int32_t in
 U_INTERNAL Resource U_EXPORT2
 res_getTableItemByKey(const ResourceData *pResData, Resource table, int32_t *indexS, const char* * key);
 
+/*
+ * Hash function for table key strings in table hash indexes.
+ * See the file format description.
+ */
+U_INTERNAL uint32_t U_EXPORT2
+res_hashTableKey(const char *key, uint32_t seed);
+
 /**
  * Iterates over the path and stops when a scalar resource is found.
  * Follows aliases.
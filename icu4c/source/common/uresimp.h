@@ -15,6 +15,10 @@
 
 #include "uresdata.h"
 
+#ifdef __cplusplus
+#include "umutex.h"
+#endif
+
 #define kRootLocaleName         "root"
 #define kPoolBundleName         "pool"
 
@@ -38,7 +42,15 @@
 struct UResourceDataEntry;
 typedef struct UResourceDataEntry UResourceDataEntry;
 
+#ifdef __cplusplus
+
+struct UResPathCache;
+
 /*
+ * Only uresbund.cpp looks inside UResourceDataEntry.
+ * The reference count is atomic so that opening and closing bundles
+ * that are already in the cache does not need to lock a mutex.
+ *
  * Note: If we wanted to make this structure smaller, then we could try
  * to use one UResourceDataEntry pointer for fAlias and fPool, with a separate
  * flag to distinguish whether this struct is for a real bundle with a pool,
@@ -52,11 +64,16 @@ struct UResourceDataEntry {
     UResourceDataEntry *fPool;
     ResourceData fData; /* data for low level access */
     char fNameBuffer[3]; /* A small buffer of free space for fName. The free space is due to struct padding. */
-    uint32_t fCountExisting; /* how much is this resource used */
+    icu::u_atomic_int32_t fCountExisting; /* how much is this resource used */
     UErrorCode fBogus;
+    std::atomic<UResPathCache *> fPathCache; /* memo of ures_getByKeyWithFallback() lookups, or NULL */
+    int32_t fDataEpoch; /* data epoch for which this entry and its chain are known to be current */
+    UResourceDataEntry *fNextRetired; /* next in the list of entries removed from the cache, see init_entry() */
     /* int32_t fHashKey;*/ /* for faster access in the hashtable */
 };
 
+#endif  /* __cplusplus */
+
 #define RES_BUFSIZE 64
 #define RES_PATH_SEPARATOR   '/'
 #define RES_PATH_SEPARATOR_S   "/"
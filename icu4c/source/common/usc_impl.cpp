@@ -163,6 +163,15 @@ getPairIndex(UChar32 ch)
     int32_t probe = pairedCharPower;
     int32_t pairIndex = 0;
 
+    /*
+     * Most characters are not paired;
+     * skip the search outside the ranges of the table.
+     */
+    if (ch < pairedChars[0] || ch > pairedChars[pairedCharCount - 1] ||
+            (ch > 0x00bb && ch < 0x2018)) {
+        return -1;
+    }
+
     if (ch >= pairedChars[pairedCharExtra]) {
         pairIndex = pairedCharExtra;
     }
@@ -290,7 +299,15 @@ uscript_nextRun(UScriptRun *scriptRun, int32_t *pRunStart, int32_t *pRunLimit, U
             }
         }
 
-        sc = uscript_getScript(ch, &error);
+        /*
+         * ASCII letters are Latin and all other ASCII characters are Common,
+         * which saves the property lookup for most text in Latin scripts.
+         */
+        if (ch < 0x80) {
+            sc = (uint32_t)((ch | 0x20) - 0x61) < 26 ? USCRIPT_LATIN : USCRIPT_COMMON;
+        } else {
+            sc = uscript_getScript(ch, &error);
+        }
         pairIndex = getPairIndex(ch);
 
         /*
@@ -728,11 +728,11 @@ static int32_t
 handleGeneratedSpaces(UChar *dest, int32_t sourceLength,
                     int32_t destSize,
                     uint32_t options,
-                    UErrorCode *pErrorCode,struct uShapeVariables shapeVars ) {
+                    UChar *tempbuffer,
+                    struct uShapeVariables shapeVars ) {
 
     int32_t i = 0, j = 0;
     int32_t count = 0;
-    UChar *tempbuffer=NULL;
 
     int lamAlefOption = 0;
     int tashkeelOption = 0;
@@ -747,14 +747,6 @@ handleGeneratedSpaces(UChar *dest, int32_t sourceLength,
         }
     }
 
-    tempbuffer = (UChar *)uprv_malloc((sourceLength+1)*U_SIZEOF_UCHAR);
-    /* Test for NULL */
-    if(tempbuffer == NULL) {
-        *pErrorCode = U_MEMORY_ALLOCATION_ERROR;
-        return 0;
-    }
-
-
     if (lamAlefOption || tashkeelOption){
         uprv_memset(tempbuffer, 0, (sourceLength+1)*U_SIZEOF_UCHAR);
 
@@ -881,11 +873,6 @@ handleGeneratedSpaces(UChar *dest, int32_t sourceLength,
         destSize = sourceLength;
     }
 
-
-    if(tempbuffer){
-        uprv_free(tempbuffer);
-    }
-
     return destSize;
 }
 
@@ -900,18 +887,10 @@ handleGeneratedSpaces(UChar *dest, int32_t sourceLength,
  */
 
 static int32_t
-expandCompositCharAtBegin(UChar *dest, int32_t sourceLength, int32_t destSize,UErrorCode *pErrorCode) {
+expandCompositCharAtBegin(UChar *dest, int32_t sourceLength, int32_t destSize,
+                          UChar *tempbuffer, UErrorCode *pErrorCode) {
     int32_t      i = 0,j = 0;
     int32_t      countl = 0;
-    UChar    *tempbuffer=NULL;
-
-    tempbuffer = (UChar *)uprv_malloc((sourceLength+1)*U_SIZEOF_UCHAR);
-
-    /* Test for NULL */
-    if(tempbuffer == NULL) {
-        *pErrorCode = U_MEMORY_ALLOCATION_ERROR;
-        return 0;
-    }
 
         uprv_memset(tempbuffer, 0, (sourceLength+1)*U_SIZEOF_UCHAR);
 
@@ -943,8 +922,6 @@ expandCompositCharAtBegin(UChar *dest, int32_t sourceLength, int32_t destSize,UE
         }
         u_memcpy(dest, tempbuffer, sourceLength);
 
-        uprv_free(tempbuffer);
-
         destSize = sourceLength;
         return destSize;
 }
@@ -960,21 +937,13 @@ expandCompositCharAtBegin(UChar *dest, int32_t sourceLength, int32_t destSize,UE
  */
 
 static int32_t
-expandCompositCharAtEnd(UChar *dest, int32_t sourceLength, int32_t destSize,UErrorCode *pErrorCode) {
+expandCompositCharAtEnd(UChar *dest, int32_t sourceLength, int32_t destSize,
+                        UChar *tempbuffer, UErrorCode *pErrorCode) {
     int32_t      i = 0,j = 0;
 
     int32_t      countr = 0;
     int32_t  inpsize = sourceLength;
 
-    UChar    *tempbuffer=NULL;
-    tempbuffer = (UChar *)uprv_malloc((sourceLength+1)*U_SIZEOF_UCHAR);
-
-    /* Test for NULL */
-    if(tempbuffer == NULL) {
-        *pErrorCode = U_MEMORY_ALLOCATION_ERROR;
-         return 0;
-    }
-
     uprv_memset(tempbuffer, 0, (sourceLength+1)*U_SIZEOF_UCHAR);
 
     while(dest[inpsize-1] == SPACE_CHAR) {
@@ -1011,8 +980,6 @@ expandCompositCharAtEnd(UChar *dest, int32_t sourceLength, int32_t destSize,UErr
     }
     u_memcpy(dest, tempbuffer, sourceLength);
 
-    uprv_free(tempbuffer);
-
     destSize = sourceLength;
     return destSize;
 }
@@ -1082,11 +1049,11 @@ expandCompositCharAtNear(UChar *dest, int32_t sourceLength, int32_t destSize,UEr
 static int32_t
 expandCompositChar(UChar *dest, int32_t sourceLength,
               int32_t destSize,uint32_t options,
+              UChar *tempbuffer,
               UErrorCode *pErrorCode, int shapingMode,struct uShapeVariables shapeVars) {
 
     int32_t      i = 0,j = 0;
 
-    UChar    *tempbuffer=NULL;
     int yehHamzaOption = 0;
     int seenTailOption = 0;
     int lamAlefOption = 0;
@@ -1095,18 +1062,18 @@ expandCompositChar(UChar *dest, int32_t sourceLength,
         if ( (options&U_SHAPE_LAMALEF_MASK) == U_SHAPE_LAMALEF_AUTO){
 
             if(shapeVars.spacesRelativeToTextBeginEnd == 0) {
-                destSize = expandCompositCharAtEnd(dest, sourceLength, destSize, pErrorCode);
+                destSize = expandCompositCharAtEnd(dest, sourceLength, destSize, tempbuffer, pErrorCode);
 
                 if(*pErrorCode == U_NO_SPACE_AVAILABLE) {
                     *pErrorCode = U_ZERO_ERROR;
-                    destSize = expandCompositCharAtBegin(dest, sourceLength, destSize, pErrorCode);
+                    destSize = expandCompositCharAtBegin(dest, sourceLength, destSize, tempbuffer, pErrorCode);
                 }
             }else {
-                destSize = expandCompositCharAtBegin(dest, sourceLength, destSize, pErrorCode);
+                destSize = expandCompositCharAtBegin(dest, sourceLength, destSize, tempbuffer, pErrorCode);
 
                 if(*pErrorCode == U_NO_SPACE_AVAILABLE) {
                     *pErrorCode = U_ZERO_ERROR;
-                    destSize = expandCompositCharAtEnd(dest, sourceLength, destSize, pErrorCode);
+                    destSize = expandCompositCharAtEnd(dest, sourceLength, destSize, tempbuffer, pErrorCode);
                 }
             }
 
@@ -1120,13 +1087,13 @@ expandCompositChar(UChar *dest, int32_t sourceLength,
 
     if (shapingMode == 1){
         if ( (options&U_SHAPE_LAMALEF_MASK) == shapeVars.uShapeLamalefEnd){
-            destSize = expandCompositCharAtEnd(dest, sourceLength, destSize, pErrorCode);
+            destSize = expandCompositCharAtEnd(dest, sourceLength, destSize, tempbuffer, pErrorCode);
         }
     }
 
     if (shapingMode == 1){
         if ( (options&U_SHAPE_LAMALEF_MASK) == shapeVars.uShapeLamalefBegin){
-            destSize = expandCompositCharAtBegin(dest, sourceLength, destSize, pErrorCode);
+            destSize = expandCompositCharAtBegin(dest, sourceLength, destSize, tempbuffer, pErrorCode);
         }
     }
 
@@ -1154,14 +1121,6 @@ expandCompositChar(UChar *dest, int32_t sourceLength,
     if (shapingMode == 1){
         if ( (options&U_SHAPE_LAMALEF_MASK) == U_SHAPE_LAMALEF_RESIZE){
             destSize = calculateSize(dest,sourceLength,destSize,options);
-            tempbuffer = (UChar *)uprv_malloc((destSize+1)*U_SIZEOF_UCHAR);
-
-            /* Test for NULL */
-            if(tempbuffer == NULL) {
-                *pErrorCode = U_MEMORY_ALLOCATION_ERROR;
-                return 0;
-            }
-
             uprv_memset(tempbuffer, 0, (destSize+1)*U_SIZEOF_UCHAR);
 
             i = j = 0;
@@ -1181,9 +1140,6 @@ expandCompositChar(UChar *dest, int32_t sourceLength,
         }
     }
 
-    if(tempbuffer) {
-        uprv_free(tempbuffer);
-    }
     return destSize;
 }
 
@@ -1195,6 +1151,7 @@ expandCompositChar(UChar *dest, int32_t sourceLength,
 static int32_t
 shapeUnicode(UChar *dest, int32_t sourceLength,
              int32_t destSize,uint32_t options,
+             UChar *tempbuffer,
              UErrorCode *pErrorCode,
              int tashkeelFlag, struct uShapeVariables shapeVars) {
 
@@ -1350,11 +1307,11 @@ shapeUnicode(UChar *dest, int32_t sourceLength,
     }
     destSize = sourceLength;
     if ( (lamalef_found != 0 ) || (tashkeelFound  != 0) ){
-        destSize = handleGeneratedSpaces(dest,sourceLength,destSize,options,pErrorCode, shapeVars);
+        destSize = handleGeneratedSpaces(dest,sourceLength,destSize,options,tempbuffer, shapeVars);
     }
 
     if ( (seenfamFound != 0) || (yehhamzaFound != 0) ) {
-        destSize = expandCompositChar(dest, sourceLength,destSize,options,pErrorCode, SHAPE_MODE,shapeVars);
+        destSize = expandCompositChar(dest, sourceLength,destSize,options,tempbuffer,pErrorCode, SHAPE_MODE,shapeVars);
     }
     return destSize;
 }
@@ -1367,6 +1324,7 @@ shapeUnicode(UChar *dest, int32_t sourceLength,
 static int32_t
 deShapeUnicode(UChar *dest, int32_t sourceLength,
                int32_t destSize,uint32_t options,
+               UChar *tempbuffer,
                UErrorCode *pErrorCode, struct uShapeVariables shapeVars) {
     int32_t i = 0;
     int32_t lamalef_found = 0;
@@ -1406,7 +1364,7 @@ deShapeUnicode(UChar *dest, int32_t sourceLength,
 
    destSize = sourceLength;
    if (lamalef_found != 0){
-          destSize = expandCompositChar(dest,sourceLength,destSize,options,pErrorCode,DESHAPE_MODE, shapeVars);
+          destSize = expandCompositChar(dest,sourceLength,destSize,options,tempbuffer,pErrorCode,DESHAPE_MODE, shapeVars);
    }
    return destSize;
 }
@@ -1493,8 +1451,8 @@ u_shapeArabic(const UChar *source, int32_t sourceLength,
     }
 
     if((options&U_SHAPE_LETTERS_MASK)!=U_SHAPE_LETTERS_NOOP) {
-        UChar buffer[300];
-        UChar *tempbuffer, *tempsource = NULL;
+        UChar buffer[300], scratchBuffer[UPRV_LENGTHOF(buffer)+1];
+        UChar *tempbuffer, *scratch, *tempsource = NULL;
         int32_t outputSize, spacesCountl=0, spacesCountr=0;
 
         if((options&U_SHAPE_AGGREGATE_TASHKEEL_MASK)>0) {
@@ -1557,12 +1515,19 @@ u_shapeArabic(const UChar *source, int32_t sourceLength,
             outputSize=sourceLength;
         }
 
-        /* Start of Arabic letter shaping part */
+        /*
+         * Start of Arabic letter shaping part.
+         * The helper functions that move characters around need
+         * a scratch buffer of up to outputSize+1 UChars.
+         * Allocate it together with the temporary buffer, once per call.
+         */
         if(outputSize<=UPRV_LENGTHOF(buffer)) {
             outputSize=UPRV_LENGTHOF(buffer);
             tempbuffer=buffer;
+            scratch=scratchBuffer;
         } else {
-            tempbuffer = (UChar *)uprv_malloc(outputSize*U_SIZEOF_UCHAR);
+            tempbuffer = (UChar *)uprv_malloc((2*outputSize+1)*U_SIZEOF_UCHAR);
+            scratch=tempbuffer+outputSize;
 
             /*Test for NULL*/
             if(tempbuffer == NULL) {
@@ -1600,10 +1565,10 @@ u_shapeArabic(const UChar *source, int32_t sourceLength,
              if( (options&U_SHAPE_TASHKEEL_MASK)> 0
                  && ((options&U_SHAPE_TASHKEEL_MASK) !=U_SHAPE_TASHKEEL_REPLACE_BY_TATWEEL)) {
                 /* Call the shaping function with tashkeel flag == 2 for removal of tashkeel */
-                destLength = shapeUnicode(tempbuffer,sourceLength,destCapacity,options,pErrorCode,2,shapeVars);
+                destLength = shapeUnicode(tempbuffer,sourceLength,destCapacity,options,scratch,pErrorCode,2,shapeVars);
              }else {
                 /* default Call the shaping function with tashkeel flag == 1 */
-                destLength = shapeUnicode(tempbuffer,sourceLength,destCapacity,options,pErrorCode,1,shapeVars);
+                destLength = shapeUnicode(tempbuffer,sourceLength,destCapacity,options,scratch,pErrorCode,1,shapeVars);
 
                 /*After shaping text check if user wants to remove tashkeel and replace it with tatweel*/
                 if( (options&U_SHAPE_TASHKEEL_MASK) == U_SHAPE_TASHKEEL_REPLACE_BY_TATWEEL){
@@ -1613,12 +1578,12 @@ u_shapeArabic(const UChar *source, int32_t sourceLength,
             break;
         case U_SHAPE_LETTERS_SHAPE_TASHKEEL_ISOLATED :
             /* Call the shaping function with tashkeel flag == 0 */
-            destLength = shapeUnicode(tempbuffer,sourceLength,destCapacity,options,pErrorCode,0,shapeVars);
+            destLength = shapeUnicode(tempbuffer,sourceLength,destCapacity,options,scratch,pErrorCode,0,shapeVars);
             break;
 
         case U_SHAPE_LETTERS_UNSHAPE :
             /* Call the deshaping function */
-            destLength = deShapeUnicode(tempbuffer,sourceLength,destCapacity,options,pErrorCode,shapeVars);
+            destLength = deShapeUnicode(tempbuffer,sourceLength,destCapacity,options,scratch,pErrorCode,shapeVars);
             break;
         default :
             /* will never occur because of validity checks above */
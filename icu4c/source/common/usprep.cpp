@@ -502,12 +502,119 @@ getValues(uint16_t trieWord, int16_t& value, UBool& isIndex){
     return type;
 }
 
-// TODO: change to writing to UnicodeString not UChar *
+static inline UBool
+isProhibited(uint16_t trieWord) {
+    int16_t value;
+    UBool isIndex;
+    return getValues(trieWord, value, isIndex) == USPREP_PROHIBITED ||
+        ((trieWord < _SPREP_TYPE_THRESHOLD) && (trieWord & 0x01) /* first bit says it the code point is prohibited*/);
+}
+
+namespace {
+
+/*
+ * Collects what step 4 needs while the string is checked one code point at a time.
+ */
+class BiDiCheck {
+public:
+    BiDiCheck() : direction(U_CHAR_DIRECTION_COUNT), firstCharDir(U_CHAR_DIRECTION_COUNT),
+                  leftToRight(FALSE), rightToLeft(FALSE), rtlPos(-1), ltrPos(-1) {}
+
+    /* c ends before s[limit]. */
+    inline void add(UChar32 c, int32_t limit) {
+        if(c < 0x80){
+            // Only the ASCII letters are L, and no ASCII character is R or AL.
+            direction = ((uint32_t)((c|0x20)-0x61) <= 0x19) ? U_LEFT_TO_RIGHT : U_OTHER_NEUTRAL;
+        }else{
+            direction = ubidi_getClass(c);
+        }
+        if(firstCharDir == U_CHAR_DIRECTION_COUNT){
+            firstCharDir = direction;
+        }
+        if(direction == U_LEFT_TO_RIGHT){
+            leftToRight = TRUE;
+            ltrPos = limit-1;
+        }
+        if(direction == U_RIGHT_TO_LEFT || direction == U_RIGHT_TO_LEFT_ARABIC){
+            rightToLeft = TRUE;
+            rtlPos = limit-1;
+        }
+    }
+
+    UBool finish(const UChar *s, int32_t length, UParseError *parseError, UErrorCode *status) const {
+        // satisfy 2
+        if( leftToRight == TRUE && rightToLeft == TRUE){
+            *status = U_STRINGPREP_CHECK_BIDI_ERROR;
+            uprv_syntaxError(s, (rtlPos>ltrPos) ? rtlPos : ltrPos, length, parseError);
+            return FALSE;
+        }
+
+        //satisfy 3
+        if( rightToLeft == TRUE && 
+            !((firstCharDir == U_RIGHT_TO_LEFT || firstCharDir == U_RIGHT_TO_LEFT_ARABIC) &&
+              (direction == U_RIGHT_TO_LEFT || direction == U_RIGHT_TO_LEFT_ARABIC))
+           ){
+            *status = U_STRINGPREP_CHECK_BIDI_ERROR;
+            uprv_syntaxError(s, rtlPos, length, parseError);
+            return FALSE;
+        }
+        return TRUE;
+    }
+
+private:
+    UCharDirection direction, firstCharDir;
+    UBool leftToRight, rightToLeft;
+    int32_t rtlPos, ltrPos;
+};
+
+}  // namespace
+
+/*
+ * Steps 3 and 4 on the final string.
+ */
+static UBool
+usprep_check(const UStringPrepProfile* profile,
+             const UChar *s, int32_t length,
+             UParseError* parseError,
+             UErrorCode* status) {
+    BiDiCheck bidi;
+    for(int32_t i=0; i<length;){
+        UChar32 ch;
+        U16_NEXT(s, i, length, ch);
+
+        uint16_t result;
+        UTRIE_GET16(&profile->sprepTrie,ch,result);
+
+        if(isProhibited(result)){
+            *status = U_STRINGPREP_PROHIBITED_ERROR;
+            uprv_syntaxError(s, i-U16_LENGTH(ch), length, parseError);
+            return FALSE;
+        }
+        if(profile->checkBiDi) {
+            bidi.add(ch, i);
+        }
+    }
+    return !profile->checkBiDi || bidi.finish(s, length, parseError, status);
+}
+
+/*
+ * Step 1, writing to dest with preflighting.
+ *
+ * As long as no code point has been mapped or deleted, the output equals the input.
+ * Until then, this function also runs the checks for steps 3 and 4 on
+ * the code points it copies, with the trie values it has already looked up:
+ * If the string needs no mapping and no normalization,
+ * then the caller need not look at it again.
+ * *pUnchanged is set to TRUE if the output equals the input.
+ * Then *pProhibitedStart is the start of the first prohibited code point or -1,
+ * and bidi (if not NULL) has seen all code points.
+ */
 static int32_t 
 usprep_map(  const UStringPrepProfile* profile, 
              const UChar* src, int32_t srcLength, 
              UChar* dest, int32_t destCapacity,
              int32_t options,
+             UBool *pUnchanged, int32_t *pProhibitedStart, BiDiCheck *bidi,
              UParseError* parseError,
              UErrorCode* status ){
     
@@ -519,6 +626,8 @@ usprep_map(  const UStringPrepProfile* profile,
     int16_t value;
     UBool isIndex;
     const int32_t* indexes = profile->indexes;
+    UBool unchanged = TRUE;
+    int32_t prohibitedStart = -1;
 
     // no error checking the caller check for error and arguments
     // no string length check the caller finds out the string length
@@ -544,6 +653,7 @@ usprep_map(  const UStringPrepProfile* profile,
         }else if(type == USPREP_MAP){
             
             int32_t index, length;
+            unchanged = FALSE;
 
             if(isIndex){
                 index = value;
@@ -576,7 +686,15 @@ usprep_map(  const UStringPrepProfile* profile,
 
         }else if(type==USPREP_DELETE){
              // just consume the codepoint and contine
+            unchanged = FALSE;
             continue;
+        }else if(unchanged){
+            if(prohibitedStart < 0 && isProhibited(result)){
+                prohibitedStart = srcIndex-U16_LENGTH(ch);
+            }
+            if(bidi != NULL){
+                bidi->add(ch, srcIndex);
+            }
         }
         //copy the code point into destination
         if(ch <= 0xFFFF){
@@ -594,6 +712,8 @@ usprep_map(  const UStringPrepProfile* profile,
        
     }
         
+    *pUnchanged = unchanged;
+    *pProhibitedStart = prohibitedStart;
     return u_terminateUChars(dest, destCapacity, destIndex, status);
 }
 
@@ -667,8 +787,13 @@ usprep_prepare(   const UStringPrepProfile* profile,
         *status = U_MEMORY_ALLOCATION_ERROR;
         return 0;
     }
+    UBool unchanged;
+    int32_t prohibitedStart;
+    BiDiCheck bidi;
     int32_t b1Len = usprep_map(profile, src, srcLength,
-                               b1, s1.getCapacity(), options, parseError, status);
+                               b1, s1.getCapacity(), options,
+                               &unchanged, &prohibitedStart, profile->checkBiDi ? &bidi : NULL,
+                               parseError, status);
     s1.releaseBuffer(U_SUCCESS(*status) ? b1Len : 0);
 
     if(*status == U_BUFFER_OVERFLOW_ERROR){
@@ -682,7 +807,9 @@ usprep_prepare(   const UStringPrepProfile* profile,
 
         *status = U_ZERO_ERROR; // reset error
         b1Len = usprep_map(profile, src, srcLength,
-                           b1, s1.getCapacity(), options, parseError, status);
+                           b1, s1.getCapacity(), options,
+                           &unchanged, &prohibitedStart, NULL,
+                           parseError, status);
         s1.releaseBuffer(U_SUCCESS(*status) ? b1Len : 0);
     }
     if(U_FAILURE(*status)){
@@ -697,7 +824,16 @@ usprep_prepare(   const UStringPrepProfile* profile,
         if(U_FAILURE(*status)){
             return 0;
         }
-        fn2.normalize(s1, s2, *status);
+        // Most strings are already normalized after mapping;
+        // then avoid normalizing and copying them.
+        int32_t spanLength = fn2.spanQuickCheckYes(s1, *status);
+        if(spanLength == s1.length()){
+            s2.fastCopyFrom(s1);
+        }else{
+            s2.setTo(s1, 0, spanLength);
+            fn2.normalizeSecondAndAppend(s2, s1.tempSubString(spanLength), *status);
+            unchanged = FALSE;
+        }
     }else{
         s2.fastCopyFrom(s1);
     }
@@ -705,64 +841,21 @@ usprep_prepare(   const UStringPrepProfile* profile,
         return 0;
     }
 
-    // Prohibit and checkBiDi in one pass
+    // Prohibit and checkBiDi in one pass,
+    // unless usprep_map() already did that on the same string
     const UChar *b2 = s2.getBuffer();
     int32_t b2Len = s2.length();
-    UCharDirection direction=U_CHAR_DIRECTION_COUNT, firstCharDir=U_CHAR_DIRECTION_COUNT;
-    UBool leftToRight=FALSE, rightToLeft=FALSE;
-    int32_t rtlPos =-1, ltrPos =-1;
-
-    for(int32_t b2Index=0; b2Index<b2Len;){
-        UChar32 ch = 0;
-        U16_NEXT(b2, b2Index, b2Len, ch);
-
-        uint16_t result;
-        UTRIE_GET16(&profile->sprepTrie,ch,result);
-
-        int16_t value;
-        UBool isIndex;
-        UStringPrepType type = getValues(result, value, isIndex);
-
-        if( type == USPREP_PROHIBITED || 
-            ((result < _SPREP_TYPE_THRESHOLD) && (result & 0x01) /* first bit says it the code point is prohibited*/)
-           ){
+    if(unchanged){
+        if(prohibitedStart >= 0){
             *status = U_STRINGPREP_PROHIBITED_ERROR;
-            uprv_syntaxError(b2, b2Index-U16_LENGTH(ch), b2Len, parseError);
+            uprv_syntaxError(b2, prohibitedStart, b2Len, parseError);
             return 0;
         }
-
-        if(profile->checkBiDi) {
-            direction = ubidi_getClass(ch);
-            if(firstCharDir == U_CHAR_DIRECTION_COUNT){
-                firstCharDir = direction;
-            }
-            if(direction == U_LEFT_TO_RIGHT){
-                leftToRight = TRUE;
-                ltrPos = b2Index-1;
-            }
-            if(direction == U_RIGHT_TO_LEFT || direction == U_RIGHT_TO_LEFT_ARABIC){
-                rightToLeft = TRUE;
-                rtlPos = b2Index-1;
-            }
-        }
-    }
-    if(profile->checkBiDi == TRUE){
-        // satisfy 2
-        if( leftToRight == TRUE && rightToLeft == TRUE){
-            *status = U_STRINGPREP_CHECK_BIDI_ERROR;
-            uprv_syntaxError(b2,(rtlPos>ltrPos) ? rtlPos : ltrPos, b2Len, parseError);
+        if(profile->checkBiDi && !bidi.finish(b2, b2Len, parseError, status)){
             return 0;
         }
-
-        //satisfy 3
-        if( rightToLeft == TRUE && 
-            !((firstCharDir == U_RIGHT_TO_LEFT || firstCharDir == U_RIGHT_TO_LEFT_ARABIC) &&
-              (direction == U_RIGHT_TO_LEFT || direction == U_RIGHT_TO_LEFT_ARABIC))
-           ){
-            *status = U_STRINGPREP_CHECK_BIDI_ERROR;
-            uprv_syntaxError(b2, rtlPos, b2Len, parseError);
-            return FALSE;
-        }
+    }else if(!usprep_check(profile, b2, b2Len, parseError, status)){
+        return 0;
     }
     return s2.extract(dest, destCapacity, *status);
 }
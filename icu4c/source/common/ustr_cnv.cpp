@@ -33,6 +33,7 @@
 /* mutexed access to a shared default converter ----------------------------- */
 
 static UConverter *gDefaultConverter = NULL;
+static icu::UMutex gDefaultConverterMutex;
 
 U_CAPI UConverter* U_EXPORT2
 u_getDefaultConverter(UErrorCode *status)
@@ -40,14 +41,14 @@ u_getDefaultConverter(UErrorCode *status)
     UConverter *converter = NULL;
     
     if (gDefaultConverter != NULL) {
-        icu::umtx_lock(NULL);
+        icu::umtx_lock(&gDefaultConverterMutex);
         
         /* need to check to make sure it wasn't taken out from under us */
         if (gDefaultConverter != NULL) {
             converter = gDefaultConverter;
             gDefaultConverter = NULL;
         }
-        icu::umtx_unlock(NULL);
+        icu::umtx_unlock(&gDefaultConverterMutex);
     }
 
     /* if the cache was empty, create a converter */
@@ -70,12 +71,12 @@ u_releaseDefaultConverter(UConverter *converter)
             ucnv_reset(converter);
         }
         ucnv_enableCleanup();
-        icu::umtx_lock(NULL);
+        icu::umtx_lock(&gDefaultConverterMutex);
         if(gDefaultConverter == NULL) {
             gDefaultConverter = converter;
             converter = NULL;
         }
-        icu::umtx_unlock(NULL);
+        icu::umtx_unlock(&gDefaultConverterMutex);
     }
 
     if(converter != NULL) {
@@ -89,14 +90,14 @@ u_flushDefaultConverter()
     UConverter *converter = NULL;
     
     if (gDefaultConverter != NULL) {
-        icu::umtx_lock(NULL);
+        icu::umtx_lock(&gDefaultConverterMutex);
         
         /* need to check to make sure it wasn't taken out from under us */
         if (gDefaultConverter != NULL) {
             converter = gDefaultConverter;
             gDefaultConverter = NULL;
         }
-        icu::umtx_unlock(NULL);
+        icu::umtx_unlock(&gDefaultConverterMutex);
     }
 
     /* if the cache was populated, flush it */
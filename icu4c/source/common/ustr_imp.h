@@ -19,6 +19,7 @@
 
 #include "unicode/utypes.h"
 #include "unicode/utf8.h"
+#include "cmemory.h"
 
 /**
  * Internal option for unorm_cmpEquivFold() for strncmp style.
@@ -26,6 +27,14 @@
  */
 #define _STRNCMP_STYLE 0x1000
 
+/**
+ * Returns the index of the first code unit where two strings differ,
+ * or length if their first length code units are the same.
+ * Compares several code units at a time.
+ */
+U_CFUNC int32_t U_EXPORT2
+uprv_strFindMismatch(const UChar *s1, const UChar *s2, int32_t length);
+
 /**
  * Compare two strings in code point order or code unit order.
  * Works in strcmp style (both lengths -1),
@@ -136,6 +145,64 @@ class UTF8 {
     }
 };
 
+/**
+ * Tests and widens ASCII text a 64-bit word at a time,
+ * for the fast paths of conversion and span loops.
+ * The pointers need not be aligned.
+ */
+class ASCIIWords {
+public:
+    ASCIIWords() = delete;  // all static
+
+    /** @return TRUE if all 8 bytes in word are ASCII. */
+    static inline UBool isAscii(uint64_t word) {
+        return (word & UINT64_C(0x8080808080808080)) == 0;
+    }
+
+    /** @return TRUE if the 8 bytes at s are all ASCII. */
+    static inline UBool isAscii8(const uint8_t *s) {
+        uint64_t word;
+        uprv_memcpy(&word, s, 8);
+        return isAscii(word);
+    }
+
+    static inline UBool isAscii8(const char *s) {
+        return isAscii8(reinterpret_cast<const uint8_t *>(s));
+    }
+
+    /** @return TRUE if the 4 UChars at s are all ASCII. */
+    static inline UBool isAscii4(const UChar *s) {
+        uint64_t word;
+        uprv_memcpy(&word, s, 8);
+        return (word & UINT64_C(0xff80ff80ff80ff80)) == 0;
+    }
+
+    /**
+     * Widens 8 bytes at s to 8 UChars at dest.
+     * Only the bytes need to be ASCII for the result to be meaningful text.
+     */
+    static inline void widen8(UChar *dest, const uint8_t *s) {
+        // Spread the bytes to 16-bit units; the same shifts work for either byte order.
+        uint64_t word;
+        uprv_memcpy(&word, s, 8);
+#if U_IS_BIG_ENDIAN
+        uint64_t first = word >> 32, second = word & 0xffffffff;
+#else
+        uint64_t first = word & 0xffffffff, second = word >> 32;
+#endif
+        first = (first | (first << 16)) & UINT64_C(0x0000ffff0000ffff);
+        first = (first | (first << 8)) & UINT64_C(0x00ff00ff00ff00ff);
+        second = (second | (second << 16)) & UINT64_C(0x0000ffff0000ffff);
+        second = (second | (second << 8)) & UINT64_C(0x00ff00ff00ff00ff);
+        uprv_memcpy(dest, &first, 8);
+        uprv_memcpy(dest + 4, &second, 8);
+    }
+
+    static inline void widen8(UChar *dest, const char *s) {
+        widen8(dest, reinterpret_cast<const uint8_t *>(s));
+    }
+};
+
 U_NAMESPACE_END
 
 #endif  // __cplusplus
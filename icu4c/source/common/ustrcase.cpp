@@ -163,6 +163,18 @@ appendUnchanged(UChar *dest, int32_t destIndex, int32_t destCapacity,
     return appendNonEmptyUnchanged(dest, destIndex, destCapacity, s, length, options, edits);
 }
 
+/**
+ * Records the run of 1:1 changes from the toLower()/toUpper() fast paths,
+ * which are counted rather than recorded one by one.
+ */
+inline void
+addPendingChanges(icu::Edits *edits, int32_t &changes) {
+    if (edits != nullptr && changes > 0) {
+        edits->addRepeatedReplace(1, 1, changes);
+    }
+    changes = 0;
+}
+
 UChar32 U_CALLCONV
 utf16_caseContextIterator(void *context, int8_t dir) {
     UCaseContext *csc=(UCaseContext *)context;
@@ -212,10 +224,11 @@ int32_t toLower(int32_t caseLocale, uint32_t options,
     } else {
         latinToLower = LatinCase::TO_LOWER_TR_LT;
     }
-    const UTrie2 *trie = ucase_getTrie();
+    const UCPTrie *trie = ucase_getTrie();
     int32_t destIndex = 0;
     int32_t prev = srcStart;
     int32_t srcIndex = srcStart;
+    int32_t changes = 0;  // pending 1:1 changes right before prev
     for (;;) {
         // fast path for simple cases
         UChar lead = 0;
@@ -231,7 +244,7 @@ int32_t toLower(int32_t caseLocale, uint32_t options,
             } else if (lead >= 0xd800) {
                 break;  // surrogate or higher
             } else {
-                uint16_t props = UTRIE2_GET16_FROM_U16_SINGLE_LEAD(trie, lead);
+                uint16_t props = UCPTRIE_FAST_BMP_GET(trie, UCPTRIE_16, lead);
                 if (UCASE_HAS_EXCEPTION(props)) { break; }
                 ++srcIndex;
                 if (!UCASE_IS_UPPER_OR_TITLE(props) || (delta = UCASE_GET_DELTA(props)) == 0) {
@@ -239,13 +252,14 @@ int32_t toLower(int32_t caseLocale, uint32_t options,
                 }
             }
             lead += static_cast<UChar>(delta);
-            destIndex = appendUnchanged(dest, destIndex, destCapacity,
-                                        src + prev, srcIndex - 1 - prev, options, edits);
+            if (srcIndex - 1 > prev) {
+                addPendingChanges(edits, changes);
+                destIndex = appendUnchanged(dest, destIndex, destCapacity,
+                                            src + prev, srcIndex - 1 - prev, options, edits);
+            }
             if (destIndex >= 0) {
                 destIndex = appendUChar(dest, destIndex, destCapacity, lead);
-                if (edits != nullptr) {
-                    edits->addReplace(1, 1);
-                }
+                ++changes;
             }
             if (destIndex < 0) {
                 errorCode = U_INDEX_OUTOFBOUNDS_ERROR;
@@ -275,6 +289,7 @@ int32_t toLower(int32_t caseLocale, uint32_t options,
             c = ucase_toFullFolding(c, &s, options);
         }
         if (c >= 0) {
+            addPendingChanges(edits, changes);
             destIndex = appendUnchanged(dest, destIndex, destCapacity,
                                         src + prev, cpStart - prev, options, edits);
             if (destIndex >= 0) {
@@ -288,6 +303,7 @@ int32_t toLower(int32_t caseLocale, uint32_t options,
             prev = srcIndex;
         }
     }
+    addPendingChanges(edits, changes);
     destIndex = appendUnchanged(dest, destIndex, destCapacity,
                                 src + prev, srcIndex - prev, options, edits);
     if (destIndex < 0) {
@@ -307,10 +323,11 @@ int32_t toUpper(int32_t caseLocale, uint32_t options,
     } else {
         latinToUpper = LatinCase::TO_UPPER_NORMAL;
     }
-    const UTrie2 *trie = ucase_getTrie();
+    const UCPTrie *trie = ucase_getTrie();
     int32_t destIndex = 0;
     int32_t prev = 0;
     int32_t srcIndex = 0;
+    int32_t changes = 0;  // pending 1:1 changes right before prev
     for (;;) {
         // fast path for simple cases
         UChar lead = 0;
@@ -326,7 +343,7 @@ int32_t toUpper(int32_t caseLocale, uint32_t options,
             } else if (lead >= 0xd800) {
                 break;  // surrogate or higher
             } else {
-                uint16_t props = UTRIE2_GET16_FROM_U16_SINGLE_LEAD(trie, lead);
+                uint16_t props = UCPTRIE_FAST_BMP_GET(trie, UCPTRIE_16, lead);
                 if (UCASE_HAS_EXCEPTION(props)) { break; }
                 ++srcIndex;
                 if (UCASE_GET_TYPE(props) != UCASE_LOWER || (delta = UCASE_GET_DELTA(props)) == 0) {
@@ -334,13 +351,14 @@ int32_t toUpper(int32_t caseLocale, uint32_t options,
                 }
             }
             lead += static_cast<UChar>(delta);
-            destIndex = appendUnchanged(dest, destIndex, destCapacity,
-                                        src + prev, srcIndex - 1 - prev, options, edits);
+            if (srcIndex - 1 > prev) {
+                addPendingChanges(edits, changes);
+                destIndex = appendUnchanged(dest, destIndex, destCapacity,
+                                            src + prev, srcIndex - 1 - prev, options, edits);
+            }
             if (destIndex >= 0) {
                 destIndex = appendUChar(dest, destIndex, destCapacity, lead);
-                if (edits != nullptr) {
-                    edits->addReplace(1, 1);
-                }
+                ++changes;
             }
             if (destIndex < 0) {
                 errorCode = U_INDEX_OUTOFBOUNDS_ERROR;
@@ -366,6 +384,7 @@ int32_t toUpper(int32_t caseLocale, uint32_t options,
         const UChar *s;
         c = ucase_toFullUpper(c, utf16_caseContextIterator, csc, &s, caseLocale);
         if (c >= 0) {
+            addPendingChanges(edits, changes);
             destIndex = appendUnchanged(dest, destIndex, destCapacity,
                                         src + prev, cpStart - prev, options, edits);
             if (destIndex >= 0) {
@@ -379,6 +398,7 @@ int32_t toUpper(int32_t caseLocale, uint32_t options,
             prev = srcIndex;
         }
     }
+    addPendingChanges(edits, changes);
     destIndex = appendUnchanged(dest, destIndex, destCapacity,
                                 src + prev, srcIndex - prev, options, edits);
     if (destIndex < 0) {
@@ -1759,6 +1779,20 @@ u_strcmpFold(const UChar *s1, int32_t length1,
              const UChar *s2, int32_t length2,
              uint32_t options,
              UErrorCode *pErrorCode) {
+    /*
+     * Skip the identical prefix, without splitting a surrogate pair.
+     * _cmpFold() would just step over it one code unit at a time.
+     */
+    if(length1>=0 && length2>=0 && (options&_STRNCMP_STYLE)==0) {
+        int32_t i=uprv_strFindMismatch(s1, s2, length1<length2 ? length1 : length2);
+        if(i>0 && U16_IS_LEAD(s1[i-1])) {
+            --i;
+        }
+        s1+=i;
+        length1-=i;
+        s2+=i;
+        length2-=i;
+    }
     return _cmpFold(s1, length1, s2, length2, options, NULL, NULL, pErrorCode);
 }
 
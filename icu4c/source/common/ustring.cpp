@@ -683,6 +683,29 @@ u_strcmp(const UChar *s1,
     return (int32_t)c1 - (int32_t)c2;
 }
 
+U_CFUNC int32_t U_EXPORT2
+uprv_strFindMismatch(const UChar *s1, const UChar *s2, int32_t length) {
+    /*
+     * Compare 4 code units (64 bits) at a time until a block differs,
+     * then find the differing unit in that block.
+     * This only finds the position, so it works the same with either byte order.
+     */
+    int32_t i=0;
+    while((length-i)>=4) {
+        uint64_t w1, w2;
+        uprv_memcpy(&w1, s1+i, 8);
+        uprv_memcpy(&w2, s2+i, 8);
+        if(w1!=w2) {
+            break;
+        }
+        i+=4;
+    }
+    while(i<length && s1[i]==s2[i]) {
+        ++i;
+    }
+    return i;
+}
+
 U_CFUNC int32_t U_EXPORT2
 uprv_strCompare(const UChar *s1, int32_t length1,
                 const UChar *s2, int32_t length2,
@@ -771,20 +794,15 @@ uprv_strCompare(const UChar *s1, int32_t length1,
             return lengthResult;
         }
 
-        for(;;) {
-            /* check pseudo-limit */
-            if(s1==limit1) {
-                return lengthResult;
-            }
-
-            c1=*s1;
-            c2=*s2;
-            if(c1!=c2) {
-                break;
-            }
-            ++s1;
-            ++s2;
+        /* skip the identical prefix */
+        int32_t i=uprv_strFindMismatch(s1, s2, (int32_t)(limit1-s1));
+        s1+=i;
+        s2+=i;
+        if(s1==limit1) {
+            return lengthResult;
         }
+        c1=*s1;
+        c2=*s2;
 
         /* setup for fix-up */
         limit1=start1+length1;
@@ -1145,16 +1163,9 @@ u_memset(UChar *dest, UChar c, int32_t count) {
 U_CAPI int32_t U_EXPORT2
 u_memcmp(const UChar *buf1, const UChar *buf2, int32_t count) {
     if(count > 0) {
-        const UChar *limit = buf1 + count;
-        int32_t result;
-
-        while (buf1 < limit) {
-            result = (int32_t)(uint16_t)*buf1 - (int32_t)(uint16_t)*buf2;
-            if (result != 0) {
-                return result;
-            }
-            buf1++;
-            buf2++;
+        int32_t i = uprv_strFindMismatch(buf1, buf2, count);
+        if (i < count) {
+            return (int32_t)(uint16_t)buf1[i] - (int32_t)(uint16_t)buf2[i];
         }
     }
     return 0;
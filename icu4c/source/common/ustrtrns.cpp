@@ -36,6 +36,21 @@
 #include "ustr_imp.h"
 #include "uassert.h"
 
+/*
+ * Runs of ASCII are converted a 64-bit word at a time in the conversion loops
+ * with known source lengths, using portable shifts and masks
+ * rather than per-platform SIMD code.
+ */
+
+static inline void
+narrowAscii4(uint8_t *dest, const UChar *s) {
+    uint64_t word;
+    uprv_memcpy(&word, s, 8);
+    word = (word | (word >> 8)) & UINT64_C(0x0000ffff0000ffff);
+    uint32_t bytes = (uint32_t)((word | (word >> 16)) & 0xffffffff);
+    uprv_memcpy(dest, &bytes, 4);
+}
+
 U_CAPI UChar* U_EXPORT2 
 u_strFromUTF32WithSub(UChar *dest,
                int32_t destCapacity,
@@ -403,6 +418,13 @@ u_strFromUTF8WithSub(UChar *dest,
                 c = (uint8_t)src[i++];
                 if(U8_IS_SINGLE(c)) {
                     *pDest++=(UChar)c;
+                    // Each block of 8 ASCII bytes uses up 8 iterations.
+                    while(count > 8 && icu::ASCIIWords::isAscii8(src + i)) {
+                        icu::ASCIIWords::widen8(pDest, src + i);
+                        i += 8;
+                        pDest += 8;
+                        count -= 8;
+                    }
                 } else {
                     uint8_t __t1, __t2;
                     if( /* handle U+0800..U+FFFF inline */
@@ -492,6 +514,10 @@ u_strFromUTF8WithSub(UChar *dest,
             c = (uint8_t)src[i++];
             if(U8_IS_SINGLE(c)) {
                 ++reqLength;
+                while((srcLength - i) >= 8 && icu::ASCIIWords::isAscii8(src + i)) {
+                    i += 8;
+                    reqLength += 8;
+                }
             } else {
                 uint8_t __t1, __t2;
                 if( /* handle U+0800..U+FFFF inline */
@@ -921,6 +947,13 @@ u_strToUTF8WithSub(char *dest,
                 ch=*pSrc++;
                 if(ch <= 0x7f) {
                     *pDest++ = (uint8_t)ch;
+                    // Each block of 4 ASCII UChars uses up 4 iterations.
+                    while(count > 4 && icu::ASCIIWords::isAscii4(pSrc)) {
+                        narrowAscii4(pDest, pSrc);
+                        pSrc += 4;
+                        pDest += 4;
+                        count -= 4;
+                    }
                 } else if(ch <= 0x7ff) {
                     *pDest++=(uint8_t)((ch>>6)|0xc0);
                     *pDest++=(uint8_t)((ch&0x3f)|0x80);
@@ -1020,6 +1053,10 @@ u_strToUTF8WithSub(char *dest,
             ch=*pSrc++;
             if(ch<=0x7f) {
                 ++reqLength;
+                while((pSrcLimit - pSrc) >= 4 && icu::ASCIIWords::isAscii4(pSrc)) {
+                    pSrc += 4;
+                    reqLength += 4;
+                }
             } else if(ch<=0x7ff) {
                 reqLength+=2;
             } else if(!U16_IS_SURROGATE(ch)) {
@@ -25,6 +25,7 @@
 #include "unicode/utf8.h"
 #include "unicode/utf16.h"
 #include "ustr_imp.h"
+#include "utext_imp.h"
 #include "cmemory.h"
 #include "cstring.h"
 #include "uassert.h"
@@ -855,6 +856,15 @@ U_CDECL_END
 //
 enum { UTF8_TEXT_CHUNK_SIZE=32 };
 
+//
+// ASCII chunk size.
+//     A run of ASCII text at least UTF8_TEXT_CHUNK_SIZE bytes long (or reaching the
+//     start or end of the string) is loaded into a larger chunk of up to this many
+//     UChars without any index maps: native and UTF-16 indexes line up one-to-one,
+//     so the whole chunk is natively indexed.
+//
+enum { UTF8_TEXT_ASCII_CHUNK_SIZE=256 };
+
 //
 // UTF8Buf  Two of these structs will be set up in the UText's extra allocated space.
 //          Each contains the UChar chunk buffer, the to and from native maps, and
@@ -893,9 +903,30 @@ struct UTF8Buf {
                                                      //    and one for an entry for the buffer limit position.
     uint8_t   mapToUChars[UTF8_TEXT_CHUNK_SIZE*3+6]; // Map native offset from bufNativeStart to
                                                      //   correspoding offset in filled part of buf.
-    int32_t   align;
+    int32_t   isAscii;                               // TRUE if the chunk is in asciiBuf rather than buf.
+                                                     //   Then bufStartIdx is 0, the chunk is natively
+                                                     //   indexed throughout, and the maps are not used.
+    UChar     asciiBuf[UTF8_TEXT_ASCII_CHUNK_SIZE];  // The UChar buffer for an all-ASCII chunk.
 };
 
+// The chunk contents of a filled UTF8Buf.
+static inline UChar *
+utf8BufContents(UTF8Buf *u8b) {
+    return u8b->isAscii ? u8b->asciiBuf : &u8b->buf[u8b->bufStartIdx];
+}
+
+// The chunk offset for native index ix, which must be within the UTF8Buf.
+static inline int32_t
+utf8BufChunkOffset(const UTF8Buf *u8b, int32_t ix) {
+    if (u8b->isAscii) {
+        return ix - u8b->bufNativeStart;
+    }
+    int32_t mapIndex = ix - u8b->toUCharsMapStart;
+    U_ASSERT(mapIndex>=0);
+    U_ASSERT(mapIndex<(int32_t)sizeof(UTF8Buf::mapToUChars));
+    return u8b->mapToUChars[mapIndex] - u8b->bufStartIdx;
+}
+
 U_CDECL_BEGIN
 
 //
@@ -942,7 +973,6 @@ utf8TextAccess(UText *ut, int64_t index, UBool forward) {
     UTF8Buf *u8b = NULL;
     int32_t  length = ut->b;         // Length of original utf-8
     int32_t  ix= (int32_t)index;     // Requested index, trimmed to 32 bits.
-    int32_t  mapIndex = 0;
     if (index<0) {
         ix=0;
     } else if (index > 0x7fffffff) {
@@ -1033,9 +1063,7 @@ utf8TextAccess(UText *ut, int64_t index, UBool forward) {
 
             // Requested index is in this buffer.
             u8b = (UTF8Buf *)ut->p;   // the current buffer
-            mapIndex = ix - u8b->toUCharsMapStart;
-            U_ASSERT(mapIndex < (int32_t)sizeof(UTF8Buf::mapToUChars));
-            ut->chunkOffset = u8b->mapToUChars[mapIndex] - u8b->bufStartIdx;
+            ut->chunkOffset = utf8BufChunkOffset(u8b, ix);
             return TRUE;
 
         }
@@ -1098,8 +1126,7 @@ utf8TextAccess(UText *ut, int64_t index, UBool forward) {
     // Requested index is in this buffer.
     //   Set the utf16 buffer index.
     u8b = (UTF8Buf *)ut->p;
-    mapIndex = ix - u8b->toUCharsMapStart;
-    ut->chunkOffset = u8b->mapToUChars[mapIndex] - u8b->bufStartIdx;
+    ut->chunkOffset = utf8BufChunkOffset(u8b, ix);
     if (ut->chunkOffset==0) {
         // This occurs when the first character in the text is
         //   a multi-byte UTF-8 char, and the requested index is to
@@ -1121,7 +1148,7 @@ utf8TextAccess(UText *ut, int64_t index, UBool forward) {
         u8b   = (UTF8Buf *)ut->q;
         ut->q = ut->p;
         ut->p = u8b;
-        ut->chunkContents       = &u8b->buf[u8b->bufStartIdx];
+        ut->chunkContents       = utf8BufContents(u8b);
         ut->chunkLength         = u8b->bufLimitIdx - u8b->bufStartIdx;
         ut->chunkNativeStart    = u8b->bufNativeStart;
         ut->chunkNativeLimit    = u8b->bufNativeLimit;
@@ -1132,10 +1159,7 @@ utf8TextAccess(UText *ut, int64_t index, UBool forward) {
         //    to check whether native indexing can be used.
         U_ASSERT(ix>=u8b->bufNativeStart);
         U_ASSERT(ix<=u8b->bufNativeLimit);
-        mapIndex = ix - u8b->toUCharsMapStart;
-        U_ASSERT(mapIndex>=0);
-        U_ASSERT(mapIndex<(int32_t)sizeof(u8b->mapToUChars));
-        ut->chunkOffset = u8b->mapToUChars[mapIndex] - u8b->bufStartIdx;
+        ut->chunkOffset = utf8BufChunkOffset(u8b, ix);
 
         return TRUE;
     }
@@ -1153,7 +1177,7 @@ utf8TextAccess(UText *ut, int64_t index, UBool forward) {
     u8b   = (UTF8Buf *)ut->q;
     ut->q = ut->p;
     ut->p = u8b;
-    ut->chunkContents       = &u8b->buf[u8b->bufStartIdx];
+    ut->chunkContents       = utf8BufContents(u8b);
     ut->chunkLength         = u8b->bufLimitIdx - u8b->bufStartIdx;
     ut->chunkNativeStart    = u8b->bufNativeStart;
     ut->chunkNativeLimit    = u8b->bufNativeLimit;
@@ -1184,6 +1208,7 @@ utf8TextAccess(UText *ut, int64_t index, UBool forward) {
     u8b->toUCharsMapStart = ix;
     u8b->mapToNative[0]   = 0;
     u8b->mapToUChars[0]   = 0;
+    u8b->isAscii          = FALSE;
     goto swapBuffersAndFail;
 
 
@@ -1207,6 +1232,46 @@ utf8TextAccess(UText *ut, int64_t index, UBool forward) {
             nulTerminated = TRUE;
         }
 
+        // A long run of ASCII goes into a large chunk without index maps.
+        //   Zero bytes end the run to simplify bounds checking.
+        {
+            int32_t runLimit = ix;
+            int32_t maxLimit = strLen - ix > UTF8_TEXT_ASCII_CHUNK_SIZE ?
+                ix + UTF8_TEXT_ASCII_CHUNK_SIZE : strLen;
+            UChar *asciiBuf = u8b_swap->asciiBuf;
+            uint8_t b;
+            while (runLimit<maxLimit && (b=s8[runLimit])>0 && b<0x80) {
+                asciiBuf[runLimit++ - ix] = b;
+            }
+            if (runLimit - ix >= UTF8_TEXT_CHUNK_SIZE ||
+                    (runLimit > ix && (runLimit == strLen || (nulTerminated && s8[runLimit] == 0)))) {
+                int32_t runLength = runLimit - ix;
+                u8b_swap->isAscii          = TRUE;
+                u8b_swap->bufNativeStart   = ix;
+                u8b_swap->bufNativeLimit   = runLimit;
+                u8b_swap->bufStartIdx      = 0;
+                u8b_swap->bufLimitIdx      = runLength;
+                u8b_swap->bufNILimit       = runLength;
+                u8b_swap->toUCharsMapStart = ix;
+
+                ut->chunkContents       = asciiBuf;
+                ut->chunkOffset         = 0;
+                ut->chunkLength         = runLength;
+                ut->chunkNativeStart    = ix;
+                ut->chunkNativeLimit    = runLimit;
+                ut->nativeIndexingLimit = runLength;
+
+                if (nulTerminated && runLimit>ut->c) {
+                    ut->c = runLimit;
+                    if (s8[runLimit]==0) {
+                        ut->b = runLimit;
+                        ut->providerProperties &= ~I32_FLAG(UTEXT_PROVIDER_LENGTH_IS_EXPENSIVE);
+                    }
+                }
+                return TRUE;
+            }
+        }
+
         UChar   *buf = u8b_swap->buf;
         uint8_t *mapToNative  = u8b_swap->mapToNative;
         uint8_t *mapToUChars  = u8b_swap->mapToUChars;
@@ -1271,6 +1336,7 @@ utf8TextAccess(UText *ut, int64_t index, UBool forward) {
             u8b_swap->bufNILimit     = destIx;
         }
         u8b_swap->toUCharsMapStart   = u8b_swap->bufNativeStart;
+        u8b_swap->isAscii            = FALSE;
 
         // Set UText chunk to refer to this buffer.
         ut->chunkContents       = buf;
@@ -1315,6 +1381,37 @@ utf8TextAccess(UText *ut, int64_t index, UBool forward) {
         ut->q = ut->p;
         ut->p = u8b_swap;
 
+        // A long run of ASCII goes into a large chunk without index maps.
+        {
+            int32_t runStart = ix;
+            int32_t minStart = ix > UTF8_TEXT_ASCII_CHUNK_SIZE ? ix - UTF8_TEXT_ASCII_CHUNK_SIZE : 0;
+            while (runStart>minStart && s8[runStart-1]<0x80) {
+                runStart--;
+            }
+            if (ix - runStart >= UTF8_TEXT_CHUNK_SIZE || (runStart == 0 && ix > 0)) {
+                int32_t runLength = ix - runStart;
+                UChar *asciiBuf = u8b_swap->asciiBuf;
+                for (int32_t i=0; i<runLength; i++) {
+                    asciiBuf[i] = s8[runStart+i];
+                }
+                u8b_swap->isAscii          = TRUE;
+                u8b_swap->bufNativeStart   = runStart;
+                u8b_swap->bufNativeLimit   = ix;
+                u8b_swap->bufStartIdx      = 0;
+                u8b_swap->bufLimitIdx      = runLength;
+                u8b_swap->bufNILimit       = runLength;
+                u8b_swap->toUCharsMapStart = runStart;
+
+                ut->chunkContents       = asciiBuf;
+                ut->chunkLength         = runLength;
+                ut->chunkOffset         = runLength;
+                ut->chunkNativeStart    = runStart;
+                ut->chunkNativeLimit    = ix;
+                ut->nativeIndexingLimit = runLength;
+                return TRUE;
+            }
+        }
+
         UChar   *buf = u8b_swap->buf;
         uint8_t *mapToNative = u8b_swap->mapToNative;
         uint8_t *mapToUChars = u8b_swap->mapToUChars;
@@ -1393,6 +1490,7 @@ utf8TextAccess(UText *ut, int64_t index, UBool forward) {
         u8b_swap->bufLimitIdx        = UTF8_TEXT_CHUNK_SIZE+2;
         u8b_swap->bufNILimit         = bufNILimit - u8b_swap->bufStartIdx;
         u8b_swap->toUCharsMapStart   = toUCharsMapStart;
+        u8b_swap->isAscii            = FALSE;
 
         ut->chunkContents       = &buf[u8b_swap->bufStartIdx];
         ut->chunkLength         = u8b_swap->bufLimitIdx - u8b_swap->bufStartIdx;
@@ -1658,6 +1756,15 @@ utext_openUTF8(UText *ut, const char *s, int64_t length, UErrorCode *status) {
 
 }
 
+U_CAPI const uint8_t * U_EXPORT2
+utext_getUTF8Contents(const UText *ut, int32_t *pLength) {
+    if (ut->pFuncs != &utf8Funcs || ut->b < 0) {
+        return NULL;
+    }
+    *pLength = ut->b;
+    return (const uint8_t *)ut->context;
+}
+
 
 
 
@@ -2639,6 +2746,21 @@ utext_openUChars(UText *ut, const UChar *s, int64_t length, UErrorCode *status)
     return ut;
 }
 
+U_CAPI const UChar * U_EXPORT2
+utext_getUTF16Contents(const UText *ut, int32_t *pLength) {
+    if (ut->pFuncs == &ucstrFuncs) {
+        // The chunk grows while a NUL-terminated string is scanned.
+        if (ut->a < 0 || ut->chunkNativeLimit != ut->a) {
+            return NULL;
+        }
+    } else if (ut->pFuncs != &unistrFuncs) {
+        return NULL;
+    }
+    U_ASSERT(ut->chunkNativeStart == 0 && ut->nativeIndexingLimit == ut->chunkLength);
+    *pLength = ut->chunkLength;
+    return ut->chunkContents;
+}
+
 
 //------------------------------------------------------------------------------
 //
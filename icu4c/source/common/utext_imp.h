@@ -0,0 +1,48 @@
+// © 2019 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+**********************************************************************
+*   file name:  utext_imp.h
+*   encoding:   UTF-8
+*   tab size:   8 (not used)
+*   indentation:4
+*
+*   Internal functions for UText users that can work directly
+*   on contiguous text buffers.
+**********************************************************************
+*/
+
+#ifndef __UTEXT_IMP_H__
+#define __UTEXT_IMP_H__
+
+#include "unicode/utypes.h"
+#include "unicode/utext.h"
+
+/**
+ * Returns the whole text of a UText if it is a contiguous UTF-16 string
+ * whose native indexes are UTF-16 offsets,
+ * as from utext_openUnicodeString(), utext_openConstUnicodeString()
+ * or utext_openUChars() once the length is known.
+ *
+ * @param ut the UText
+ * @param pLength receives the string length
+ * @return the string, or NULL if the text is not of this kind
+ * @internal
+ */
+U_CAPI const UChar * U_EXPORT2
+utext_getUTF16Contents(const UText *ut, int32_t *pLength);
+
+/**
+ * Returns the whole text of a UText from utext_openUTF8()
+ * if its length is known, for example because it was passed in.
+ * Native indexes are UTF-8 offsets.
+ *
+ * @param ut the UText
+ * @param pLength receives the string length
+ * @return the string, or NULL if the text is not of this kind
+ * @internal
+ */
+U_CAPI const uint8_t * U_EXPORT2
+utext_getUTF8Contents(const UText *ut, int32_t *pLength);
+
+#endif
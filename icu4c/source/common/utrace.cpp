@@ -444,6 +444,7 @@ static const char * const
 trFnName[] = {
     "u_init",
     "u_cleanup",
+    "umtx_lock_wait",
     NULL
 };
 
@@ -486,6 +487,17 @@ trResDataNames[] = {
     NULL
 };
 
+
+static const char* const
+trApiNames[] = {
+    "unum_format",
+    "udat_format",
+    "ubrk_open",
+    "unorm2_normalize",
+    "ucache_get",
+    NULL
+};
+
                 
 U_CAPI const char * U_EXPORT2
 utrace_functionName(int32_t fnNumber) {
@@ -497,6 +509,8 @@ utrace_functionName(int32_t fnNumber) {
         return trCollNames[fnNumber - UTRACE_COLLATION_START];
     } else if(UTRACE_UDATA_START <= fnNumber && fnNumber < UTRACE_RES_DATA_LIMIT){
         return trResDataNames[fnNumber - UTRACE_UDATA_START];
+    } else if(UTRACE_API_START <= fnNumber && fnNumber < UTRACE_API_LIMIT){
+        return trApiNames[fnNumber - UTRACE_API_START];
     } else {
         return "[BOGUS Trace Function Number]";
     }
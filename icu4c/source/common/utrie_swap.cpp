@@ -269,7 +269,9 @@ ucptrie_swap(const UDataSwapper *ds,
         case UCPTRIE_VALUE_BITS_8:
             ds->swapArray16(ds, inTrie+1, trie.indexLength*2, outTrie+1, pErrorCode);
             if(inTrie!=outTrie) {
-                uprv_memmove((outTrie+1)+trie.indexLength, (inTrie+1)+trie.indexLength, dataLength);
+                uprv_memmove((uint16_t *)(outTrie+1)+trie.indexLength,
+                             (const uint16_t *)(inTrie+1)+trie.indexLength,
+                             dataLength);
             }
             break;
         default:
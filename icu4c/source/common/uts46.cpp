@@ -353,7 +353,9 @@ UTS46::process(const UnicodeString &src,
             break;
         }
         int cData=asciiData[c];
-        if(cData>0) {
+        if(cData==0 && c>0x2e) {
+            destArray[i]=c;  // Copy a digit or lowercase letter, the most common case.
+        } else if(cData>0) {
             destArray[i]=c+0x20;  // Lowercase an uppercase ASCII letter.
         } else if(cData<0 && disallowNonLDHDot) {
             break;  // Replacing with U+FFFD can be complicated for toASCII.
@@ -454,7 +456,9 @@ UTS46::processUTF8(StringPiece src,
                 break;
             }
             int cData=asciiData[(int)c];  // Cast: gcc warns about indexing with a char.
-            if(cData>0) {
+            if(cData==0 && c>0x2e) {
+                destArray[i]=c;  // Copy a digit or lowercase letter, the most common case.
+            } else if(cData>0) {
                 destArray[i]=c+0x20;  // Lowercase an uppercase ASCII letter.
             } else if(cData<0 && disallowNonLDHDot) {
                 break;  // Replacing with U+FFFD can be complicated for toASCII.
@@ -715,9 +719,11 @@ UTS46::processLabel(UnicodeString &dest,
     if(labelLength>=4 && label[0]==0x78 && label[1]==0x6e && label[2]==0x2d && label[3]==0x2d) {
         // Label starts with "xn--", try to un-Punycode it.
         wasPunycode=TRUE;
-        UChar *unicodeBuffer=fromPunycode.getBuffer(-1);  // capacity==-1: most labels should fit
+        // The output has at most two UChars per input character,
+        // so one conversion pass suffices.
+        // For most labels, this fits into the internal buffer.
+        UChar *unicodeBuffer=fromPunycode.getBuffer(2*(labelLength-4));
         if(unicodeBuffer==NULL) {
-            // Should never occur if we used capacity==-1 which uses the internal buffer.
             errorCode=U_MEMORY_ALLOCATION_ERROR;
             return labelLength;
         }
@@ -725,18 +731,6 @@ UTS46::processLabel(UnicodeString &dest,
         int32_t unicodeLength=u_strFromPunycode(label+4, labelLength-4,
                                                 unicodeBuffer, fromPunycode.getCapacity(),
                                                 NULL, &punycodeErrorCode);
-        if(punycodeErrorCode==U_BUFFER_OVERFLOW_ERROR) {
-            fromPunycode.releaseBuffer(0);
-            unicodeBuffer=fromPunycode.getBuffer(unicodeLength);
-            if(unicodeBuffer==NULL) {
-                errorCode=U_MEMORY_ALLOCATION_ERROR;
-                return labelLength;
-            }
-            punycodeErrorCode=U_ZERO_ERROR;
-            unicodeLength=u_strFromPunycode(label+4, labelLength-4,
-                                            unicodeBuffer, fromPunycode.getCapacity(),
-                                            NULL, &punycodeErrorCode);
-        }
         fromPunycode.releaseBuffer(unicodeLength);
         if(U_FAILURE(punycodeErrorCode)) {
             info.labelErrors|=UIDNA_ERROR_PUNYCODE;
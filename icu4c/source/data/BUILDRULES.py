@@ -23,6 +23,7 @@ def generate(config, glob, common_vars):
 
     requests += generate_cnvalias(config, glob, common_vars)
     requests += generate_ulayout(config, glob, common_vars)
+    requests += generate_cpsnap(config, glob, common_vars)
     requests += generate_confusables(config, glob, common_vars)
     requests += generate_conversion_mappings(config, glob, common_vars)
     requests += generate_brkitr_brk(config, glob, common_vars)
@@ -362,6 +363,26 @@ def generate_ulayout(config, glob, common_vars):
     ]
 
 
+def generate_cpsnap(config, glob, common_vars):
+    # Precomputed character property sets and maps; see u_writePropertySnapshot().
+    # icuinfo builds them from the property data compiled into the common library
+    # and from the normalization and layout data in {OUT_DIR}.
+    basename = "cpsnap"
+    output_file = OutFile("%s.icu" % basename)
+    return [
+        SingleExecutionRequest(
+            name = basename,
+            category = basename,
+            dep_targets = [DepTarget("normalization"), DepTarget("ulayout")],
+            input_files = [],
+            output_files = [output_file],
+            tool = IcuTool("icuinfo"),
+            args = "-i {OUT_DIR} --property-snapshot {OUT_DIR}/{OUTPUT_FILES[0]}",
+            format_with = {}
+        )
+    ]
+
+
 def generate_misc(config, glob, common_vars):
     # Misc Data Res Files
     input_files = [InFile(filename) for filename in glob("misc/*.txt")]
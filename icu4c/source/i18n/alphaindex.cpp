@@ -17,6 +17,7 @@
 #include "unicode/normalizer2.h"
 #include "unicode/tblcoll.h"
 #include "unicode/uchar.h"
+#include "unicode/uiter.h"
 #include "unicode/ulocdata.h"
 #include "unicode/uniset.h"
 #include "unicode/uobject.h"
@@ -27,6 +28,7 @@
 #include "cstring.h"
 #include "uassert.h"
 #include "uvector.h"
+#include "uvectr32.h"
 #include "uvectr64.h"
 
 //#include <string>
@@ -125,12 +127,15 @@ int32_t binarySearch(const UVector &list, const UnicodeString &s, const Collator
 // However, we also don't need U_I18N_API because it is not used from outside the i18n library.
 class BucketList : public UObject {
 public:
-    BucketList(UVector *bucketList, UVector *publicBucketList)
-            : bucketList_(bucketList), immutableVisibleList_(publicBucketList) {
+    BucketList(UVector *bucketList, UVector *publicBucketList,
+               const Collator &collatorPrimaryOnly, UErrorCode &errorCode)
+            : bucketList_(bucketList), immutableVisibleList_(publicBucketList),
+              boundaryKeyLimits_(errorCode), maxBoundaryKeyLength_(0) {
         int32_t displayIndex = 0;
         for (int32_t i = 0; i < publicBucketList->size(); ++i) {
             getBucket(*publicBucketList, i)->displayIndex_ = displayIndex++;
         }
+        initBoundaryKeys(collatorPrimaryOnly, errorCode);
     }
 
     // The virtual destructor must not be inline.
@@ -141,17 +146,53 @@ class BucketList : public UObject {
         return immutableVisibleList_->size();
     }
 
+    /**
+     * Writes the prefix of the name's primary sort key that suffices
+     * for comparing it with all of the bucket boundaries.
+     * @return the prefix length, at most maxBoundaryKeyLength_
+     */
+    int32_t getNameKey(const UnicodeString &name, const Collator &collatorPrimaryOnly,
+                       uint8_t *dest, UErrorCode &errorCode) const {
+        UCharIterator iter;
+        uiter_setString(&iter, name.getBuffer(), name.length());
+        uint32_t state[2] = { 0, 0 };
+        return ucol_nextSortKeyPart(collatorPrimaryOnly.toUCollator(), &iter, state,
+                                    dest, maxBoundaryKeyLength_, &errorCode);
+    }
+
+    /**
+     * Compares a name key from getNameKey() with the lower boundary of bucket i,
+     * like collatorPrimaryOnly.compare(name, lowerBoundary_) < 0.
+     * Primary sort key bytes are never 00 or 01, so a name key that runs out
+     * before the boundary key sorts before it, and one that has the whole
+     * boundary key as a prefix sorts at or after it.
+     */
+    UBool isBelowBoundary(const uint8_t *nameKey, int32_t nameKeyLength, int32_t i) const {
+        int32_t start = i == 0 ? 0 : boundaryKeyLimits_.elementAti(i - 1);
+        int32_t length = boundaryKeyLimits_.elementAti(i) - start;
+        int32_t cmp = uprv_memcmp(nameKey, boundaryKeys_.getAlias() + start,
+                                  nameKeyLength < length ? nameKeyLength : length);
+        return cmp < 0 || (cmp == 0 && nameKeyLength < length);
+    }
+
     int32_t getBucketIndex(const UnicodeString &name, const Collator &collatorPrimaryOnly,
-                           UErrorCode &errorCode) {
+                           UErrorCode &errorCode) const {
+        MaybeStackArray<uint8_t, 64> nameKey;
+        if (maxBoundaryKeyLength_ > nameKey.getCapacity() &&
+                nameKey.resize(maxBoundaryKeyLength_) == NULL) {
+            errorCode = U_MEMORY_ALLOCATION_ERROR;
+            return 0;
+        }
+        int32_t nameKeyLength = getNameKey(name, collatorPrimaryOnly, nameKey.getAlias(), errorCode);
+        if (U_FAILURE(errorCode)) {
+            return 0;
+        }
         // binary search
         int32_t start = 0;
         int32_t limit = bucketList_->size();
         while ((start + 1) < limit) {
             int32_t i = (start + limit) / 2;
-            const AlphabeticIndex::Bucket *bucket = getBucket(*bucketList_, i);
-            UCollationResult nameVsBucket =
-                collatorPrimaryOnly.compare(name, bucket->lowerBoundary_, errorCode);
-            if (nameVsBucket < 0) {
+            if (isBelowBoundary(nameKey.getAlias(), nameKeyLength, i)) {
                 limit = i;
             } else {
                 start = i;
@@ -168,6 +209,42 @@ class BucketList : public UObject {
     UVector *bucketList_;
     /** Just the visible buckets. */
     UVector *immutableVisibleList_;
+    /**
+     * Primary sort keys of the buckets' lower boundaries, without the terminating 00,
+     * concatenated; the key of bucket i ends at boundaryKeyLimits_[i].
+     * Records are bucketed by comparing sort key bytes rather than strings.
+     */
+    MaybeStackArray<uint8_t, 256> boundaryKeys_;
+    UVector32 boundaryKeyLimits_;
+    int32_t maxBoundaryKeyLength_;
+
+private:
+    void initBoundaryKeys(const Collator &collatorPrimaryOnly, UErrorCode &errorCode) {
+        int32_t length = 0;
+        for (int32_t i = 0; U_SUCCESS(errorCode) && i < bucketList_->size(); ++i) {
+            const UnicodeString &boundary = getBucket(*bucketList_, i)->lowerBoundary_;
+            int32_t capacity = boundaryKeys_.getCapacity() - length;
+            int32_t keyLength = collatorPrimaryOnly.getSortKey(
+                boundary, boundaryKeys_.getAlias() + length, capacity);
+            if (keyLength > capacity) {
+                if (boundaryKeys_.resize(2 * boundaryKeys_.getCapacity() + keyLength, length) == NULL) {
+                    errorCode = U_MEMORY_ALLOCATION_ERROR;
+                    return;
+                }
+                collatorPrimaryOnly.getSortKey(
+                    boundary, boundaryKeys_.getAlias() + length, keyLength);
+            }
+            if (keyLength == 0) {
+                errorCode = U_INTERNAL_PROGRAM_ERROR;
+                return;
+            }
+            length += keyLength - 1;  // without the terminating 00
+            boundaryKeyLimits_.addElement(length, errorCode);
+            if (keyLength - 1 > maxBoundaryKeyLength_) {
+                maxBoundaryKeyLength_ = keyLength - 1;
+            }
+        }
+    }
 };
 
 BucketList::~BucketList() {
@@ -544,13 +621,18 @@ BucketList *AlphabeticIndex::createBucketList(UErrorCode &errorCode) const {
     if (U_FAILURE(errorCode)) { return NULL; }
     if (bucketList->size() == 1) {
         // No real labels, show only the underflow label.
-        BucketList *bl = new BucketList(bucketList.getAlias(), bucketList.getAlias());
-        if (bl == NULL) {
-            errorCode = U_MEMORY_ALLOCATION_ERROR;
+        LocalPointer<BucketList> bl(
+            new BucketList(bucketList.getAlias(), bucketList.getAlias(),
+                           *collatorPrimaryOnly_, errorCode),
+            errorCode);
+        if (U_FAILURE(errorCode)) {
+            if (bl.isValid()) {
+                bl->bucketList_ = bl->immutableVisibleList_ = NULL;
+            }
             return NULL;
         }
         bucketList.orphan();
-        return bl;
+        return bl.orphan();
     }
     // overflow bucket
     bucket = new Bucket(getOverflowLabel(), *scriptUpperBoundary, U_ALPHAINDEX_OVERFLOW);
@@ -576,13 +658,18 @@ BucketList *AlphabeticIndex::createBucketList(UErrorCode &errorCode) const {
 
     if (U_FAILURE(errorCode)) { return NULL; }
     if (!hasInvisibleBuckets) {
-        BucketList *bl = new BucketList(bucketList.getAlias(), bucketList.getAlias());
-        if (bl == NULL) {
-            errorCode = U_MEMORY_ALLOCATION_ERROR;
+        LocalPointer<BucketList> bl(
+            new BucketList(bucketList.getAlias(), bucketList.getAlias(),
+                           *collatorPrimaryOnly_, errorCode),
+            errorCode);
+        if (U_FAILURE(errorCode)) {
+            if (bl.isValid()) {
+                bl->bucketList_ = bl->immutableVisibleList_ = NULL;
+            }
             return NULL;
         }
         bucketList.orphan();
-        return bl;
+        return bl.orphan();
     }
     // Merge inflow buckets that are visually adjacent.
     // Iterate backwards: Merge inflow into overflow rather than the other way around.
@@ -615,14 +702,19 @@ BucketList *AlphabeticIndex::createBucketList(UErrorCode &errorCode) const {
         }
     }
     if (U_FAILURE(errorCode)) { return NULL; }
-    BucketList *bl = new BucketList(bucketList.getAlias(), publicBucketList.getAlias());
-    if (bl == NULL) {
-        errorCode = U_MEMORY_ALLOCATION_ERROR;
+    LocalPointer<BucketList> bl(
+        new BucketList(bucketList.getAlias(), publicBucketList.getAlias(),
+                       *collatorPrimaryOnly_, errorCode),
+        errorCode);
+    if (U_FAILURE(errorCode)) {
+        if (bl.isValid()) {
+            bl->bucketList_ = bl->immutableVisibleList_ = NULL;
+        }
         return NULL;
     }
     bucketList.orphan();
     publicBucketList.orphan();
-    return bl;
+    return bl.orphan();
 }
 
 /**
@@ -658,12 +750,27 @@ void AlphabeticIndex::initBuckets(UErrorCode &errorCode) {
         nextBucket = NULL;
         upperBoundary = NULL;
     }
+    // Compare sort key prefixes rather than strings, see BucketList::isBelowBoundary().
+    MaybeStackArray<uint8_t, 64> nameKey;
+    if (buckets_->maxBoundaryKeyLength_ > nameKey.getCapacity() &&
+            nameKey.resize(buckets_->maxBoundaryKeyLength_) == NULL) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
     for (int32_t i = 0; i < inputList_->size(); ++i) {
         Record *r = getRecord(*inputList_, i);
+        int32_t nameKeyLength = 0;
+        if (upperBoundary != NULL) {
+            nameKeyLength = buckets_->getNameKey(
+                r->name_, *collatorPrimaryOnly_, nameKey.getAlias(), errorCode);
+            if (U_FAILURE(errorCode)) {
+                return;
+            }
+        }
         // if the current bucket isn't the right one, find the one that is
         // We have a special flag for the last bucket so that we don't look any further
         while (upperBoundary != NULL &&
-                collatorPrimaryOnly_->compare(r->name_, *upperBoundary, errorCode) >= 0) {
+                !buckets_->isBelowBoundary(nameKey.getAlias(), nameKeyLength, bucketIndex - 1)) {
             currentBucket = nextBucket;
             // now reset the boundary that we compare against
             if (bucketIndex < buckets_->bucketList_->size()) {
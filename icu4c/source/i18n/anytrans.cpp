@@ -55,6 +55,9 @@ U_CDECL_END
 
 U_NAMESPACE_BEGIN
 
+// Guards the per-script transliterator caches of all AnyTransliterator instances.
+static UMutex gCacheMutex;
+
 //------------------------------------------------------------
 // ScriptRunIterator
 
@@ -285,7 +288,7 @@ Transliterator* AnyTransliterator::getTransliterator(UScriptCode source) const {
 
     Transliterator* t = NULL;
     {
-        Mutex m(NULL);
+        Mutex m(&gCacheMutex);
         t = (Transliterator*) uhash_iget(cache, (int32_t) source);
     }
     if (t == NULL) {
@@ -311,7 +314,7 @@ Transliterator* AnyTransliterator::getTransliterator(UScriptCode source) const {
         if (t != NULL) {
             Transliterator *rt = NULL;
             {
-                Mutex m(NULL);
+                Mutex m(&gCacheMutex);
                 rt = static_cast<Transliterator *> (uhash_iget(cache, (int32_t) source));
                 if (rt == NULL) {
                     // Common case, no race to cache this new transliterator.
@@ -16,8 +16,7 @@
 #include <float.h>
 #include "unicode/putil.h"
 #include "uhash.h"
-#include "umutex.h"
-#include "ucln_in.h"
+#include "mutex.h"
 #include "putilimp.h"
 #include <stdio.h>  // for toString()
 
@@ -65,14 +64,6 @@ static inline UBool isINVALID(double d) {
   return(uprv_isNaN(d));
 }
 
-static icu::UMutex ccLock;
-
-U_CDECL_BEGIN
-static UBool calendar_astro_cleanup(void) {
-  return TRUE;
-}
-U_CDECL_END
-
 U_NAMESPACE_BEGIN
 
 /**
@@ -1530,73 +1521,65 @@ UnicodeString CalendarAstronomer::Horizon::toString() const
 
 // =============== Calendar Cache ================
 
-void CalendarCache::createCache(CalendarCache** cache, UErrorCode& status) {
-    ucln_i18n_registerCleanup(UCLN_I18N_ASTRO_CALENDAR, calendar_astro_cleanup);
-    if(cache == NULL) {
-        status = U_MEMORY_ALLOCATION_ERROR;
-    } else {
-        *cache = new CalendarCache(32, status);
-        if(U_FAILURE(status)) {
-            delete *cache;
-            *cache = NULL;
-        }
-    }
+#ifdef CALENDAR_CACHE_LOCK_FREE
+
+// Each slot holds the key in the upper and the value in the lower 32 bits.
+// An empty slot reads as key 0 with value 0, which is the same as a miss.
+
+int32_t CalendarCache::get(int32_t key) const {
+    uint64_t slot = fSlots[(uint32_t)key % SIZE].load(std::memory_order_relaxed);
+    int32_t res = (int32_t)(slot >> 32) == key ? (int32_t)(uint32_t)slot : 0;
+    U_DEBUG_ASTRO_MSG(("%p: GET: [%d] == %d\n", this, key, res));
+    return res;
 }
 
-int32_t CalendarCache::get(CalendarCache** cache, int32_t key, UErrorCode &status) {
-    int32_t res;
+void CalendarCache::put(int32_t key, int32_t value) {
+    fSlots[(uint32_t)key % SIZE].store(((uint64_t)(uint32_t)key << 32) | (uint32_t)value,
+                                       std::memory_order_relaxed);
+    U_DEBUG_ASTRO_MSG(("%p: PUT: [%d] := %d\n", this, key, value));
+}
 
-    if(U_FAILURE(status)) {
-        return 0;
+void CalendarCache::clear() {
+    for (std::atomic<uint64_t> &slot : fSlots) {
+        slot.store(0, std::memory_order_relaxed);
     }
-    umtx_lock(&ccLock);
+}
 
-    if(*cache == NULL) {
-        createCache(cache, status);
-        if(U_FAILURE(status)) {
-            umtx_unlock(&ccLock);
-            return 0;
-        }
-    }
+#else
 
-    res = uhash_igeti((*cache)->fTable, key);
-    U_DEBUG_ASTRO_MSG(("%p: GET: [%d] == %d\n", (*cache)->fTable, key, res));
+// Without lock-free 64-bit atomics, all caches share one mutex
+// and each opens its hash table on the first put().
+static UMutex ccLock;
 
-    umtx_unlock(&ccLock);
+int32_t CalendarCache::get(int32_t key) const {
+    Mutex lock(&ccLock);
+    int32_t res = fTable != NULL ? uhash_igeti(fTable, key) : 0;
+    U_DEBUG_ASTRO_MSG(("%p: GET: [%d] == %d\n", fTable, key, res));
     return res;
 }
 
-void CalendarCache::put(CalendarCache** cache, int32_t key, int32_t value, UErrorCode &status) {
-    if(U_FAILURE(status)) {
-        return;
-    }
-    umtx_lock(&ccLock);
-
-    if(*cache == NULL) {
-        createCache(cache, status);
-        if(U_FAILURE(status)) {
-            umtx_unlock(&ccLock);
+void CalendarCache::put(int32_t key, int32_t value) {
+    Mutex lock(&ccLock);
+    UErrorCode status = U_ZERO_ERROR;
+    if (fTable == NULL) {
+        fTable = uhash_openSize(uhash_hashLong, uhash_compareLong, NULL, 32, &status);
+        if (U_FAILURE(status)) {
+            // Leave the cache empty; callers recompute on a miss.
+            fTable = NULL;
             return;
         }
     }
-
-    uhash_iputi((*cache)->fTable, key, value, &status);
-    U_DEBUG_ASTRO_MSG(("%p: PUT: [%d] := %d\n", (*cache)->fTable, key, value));
-
-    umtx_unlock(&ccLock);
+    uhash_iputi(fTable, key, value, &status);
+    U_DEBUG_ASTRO_MSG(("%p: PUT: [%d] := %d\n", fTable, key, value));
 }
 
-CalendarCache::CalendarCache(int32_t size, UErrorCode &status) {
-    fTable = uhash_openSize(uhash_hashLong, uhash_compareLong, NULL, size, &status);
-    U_DEBUG_ASTRO_MSG(("%p: Opening.\n", fTable));
+void CalendarCache::clear() {
+    Mutex lock(&ccLock);
+    uhash_close(fTable);
+    fTable = NULL;
 }
 
-CalendarCache::~CalendarCache() {
-    if(fTable != NULL) {
-        U_DEBUG_ASTRO_MSG(("%p: Closing.\n", fTable));
-        uhash_close(fTable);
-    }
-}
+#endif  // CALENDAR_CACHE_LOCK_FREE
 
 U_NAMESPACE_END
 
@@ -14,6 +14,8 @@
 
 #if !UCONFIG_NO_FORMATTING
 
+#include <atomic>
+
 #include "gregoimp.h"  // for Math
 #include "unicode/unistr.h"
 
@@ -732,23 +734,34 @@ struct UHashtable;
 
 U_NAMESPACE_BEGIN
 
+#if defined(ATOMIC_LLONG_LOCK_FREE) && ATOMIC_LLONG_LOCK_FREE == 2
+#define CALENDAR_CACHE_LOCK_FREE 1
+#endif
+
 /**
- * Cache of month -> julian day
+ * Cache of month -> julian day, or of other values keyed by an int32_t.
+ * Where 64-bit atomics are lock-free, this is a fixed-size, direct-mapped
+ * table whose slots each hold a key and its value in one atomic word, so
+ * get() and put() take no lock; put() replaces whatever the slot held before.
+ * Otherwise it is a hash table guarded by a mutex.
+ * A zero-initialized static instance is an empty cache.
  * @internal
  */
 class CalendarCache : public UMemory {
 public:
-  static int32_t get(CalendarCache** cache, int32_t key, UErrorCode &status);
-  static void put(CalendarCache** cache, int32_t key, int32_t value, UErrorCode &status);
-  virtual ~CalendarCache();
-private:
-  CalendarCache(int32_t size, UErrorCode& status);
-  static void createCache(CalendarCache** cache, UErrorCode& status);
   /**
-   * not implemented
+   * @return the value cached for the key, or 0 if there is none
    */
-  CalendarCache();
+  int32_t get(int32_t key) const;
+  void put(int32_t key, int32_t value);
+  void clear();
+private:
+#ifdef CALENDAR_CACHE_LOCK_FREE
+  static const int32_t SIZE = 256;
+  std::atomic<uint64_t> fSlots[SIZE];
+#else
   UHashtable *fTable;
+#endif
 };
 
 U_NAMESPACE_END
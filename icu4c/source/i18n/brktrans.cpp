@@ -36,6 +36,9 @@ UOBJECT_DEFINE_RTTI_IMPLEMENTATION(BreakTransliterator)
 
 static const UChar SPACE       = 32;  // ' '
 
+// Guards the cached break iterator and boundaries of all BreakTransliterator instances.
+static UMutex gCacheMutex;
+
 
 /**
  * Constructs a transliterator with the default delimiters '{' and
@@ -79,7 +82,7 @@ void BreakTransliterator::handleTransliterate(Replaceable& text, UTransPosition&
         LocalPointer<UVector32> boundaries;
 
         {
-            Mutex m;
+            Mutex m(&gCacheMutex);
             BreakTransliterator *nonConstThis = const_cast<BreakTransliterator *>(this);
             boundaries = std::move(nonConstThis->cachedBoundaries);
             bi = std::move(nonConstThis->cachedBI);
@@ -144,7 +147,7 @@ void BreakTransliterator::handleTransliterate(Replaceable& text, UTransPosition&
 
         // Return break iterator & boundaries vector to the cache.
         {
-            Mutex m;
+            Mutex m(&gCacheMutex);
             BreakTransliterator *nonConstThis = const_cast<BreakTransliterator *>(this);
             if (nonConstThis->cachedBI.isNull()) {
                 nonConstThis->cachedBI = std::move(bi);
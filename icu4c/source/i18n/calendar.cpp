@@ -558,6 +558,11 @@ class CalendarService : public ICULocaleService {
     virtual UBool isDefault() const {
         return countFactories() == 1;
     }
+
+    // CalendarService() and initCalendarService() register two built-in factories.
+    UBool hasRegistrations() const {
+        return countFactories() > 2;
+    }
 };
 
 CalendarService::~CalendarService() {}
@@ -566,7 +571,9 @@ CalendarService::~CalendarService() {}
 
 static inline UBool
 isCalendarServiceUsed() {
-    return !gServiceInitOnce.isReset();
+    // Until something is registered, the service only delegates to the built-in factories.
+    return !gServiceInitOnce.isReset() && gService != NULL &&
+        static_cast<CalendarService *>(gService)->hasRegistrations();
 }
 
 // -------------------------------------
@@ -27,6 +27,9 @@
 #include "uhash.h"
 #include "ucln_in.h"
 
+#define INCLUDED_FROM_CHNSECAL_CPP
+#include "chnsecal_data.h"
+
 // Debugging
 #ifdef U_DEBUG_CHNSECAL
 # include <stdio.h>
@@ -54,9 +57,8 @@ static void debug_chnsecal_msg(const char *pat, ...)
 static icu::UMutex astroLock;
 static icu::CalendarAstronomer *gChineseCalendarAstro = NULL;
 
-// Lazy Creation & Access synchronized by class CalendarCache with a mutex.
-static icu::CalendarCache *gChineseCalendarWinterSolsticeCache = NULL;
-static icu::CalendarCache *gChineseCalendarNewYearCache = NULL;
+static icu::CalendarCache gChineseCalendarWinterSolsticeCache;
+static icu::CalendarCache gChineseCalendarNewYearCache;
 
 static icu::TimeZone *gChineseCalendarZoneAstroCalc = NULL;
 static icu::UInitOnce gChineseCalendarZoneAstroCalcInitOnce = U_INITONCE_INITIALIZER;
@@ -83,6 +85,43 @@ static const int32_t CHINA_OFFSET = 8 * kOneHour;
  */
 static const int32_t SYNODIC_GAP = 25;
 
+/**
+ * Find the months around the given local days in a precomputed table.
+ * @param days local days after the first and on or before the last new
+ * moon in the table
+ * @param index receives the index of the first month that starts on or
+ * after days
+ * @param prevStart receives the start of the month before that one
+ * @return the start of month index
+ */
+static int32_t findNewMoon(const icu::ChineseCalendarAstroTable &table, int32_t days,
+                           int32_t &index, int32_t &prevStart) {
+    // Find the last word whose first month starts before days.
+    int32_t start = 0, limit = (table.newMoonCount + 31) / 32;
+    while (limit - start > 1) {
+        int32_t mid = (start + limit) / 2;
+        if (table.newMoonStarts[mid] < days) {
+            start = mid;
+        } else {
+            limit = mid;
+        }
+    }
+    index = start * 32;
+    int32_t monthStart = table.newMoonStarts[start];
+    uint32_t longMonths = table.longMonths[start];
+    do {
+        prevStart = monthStart;
+        monthStart += 29 + (longMonths & 1);
+        longMonths >>= 1;
+        ++index;
+    } while (monthStart < days);
+    return monthStart;
+}
+
+static inline UBool isInTable(const icu::ChineseCalendarAstroTable *table, int32_t days) {
+    return table != NULL && table->newMoonStarts[0] < days && days <= table->lastNewMoon;
+}
+
 
 U_CDECL_BEGIN
 static UBool calendar_chinese_cleanup(void) {
@@ -90,14 +129,8 @@ static UBool calendar_chinese_cleanup(void) {
         delete gChineseCalendarAstro;
         gChineseCalendarAstro = NULL;
     }
-    if (gChineseCalendarWinterSolsticeCache) {
-        delete gChineseCalendarWinterSolsticeCache;
-        gChineseCalendarWinterSolsticeCache = NULL;
-    }
-    if (gChineseCalendarNewYearCache) {
-        delete gChineseCalendarNewYearCache;
-        gChineseCalendarNewYearCache = NULL;
-    }
+    gChineseCalendarWinterSolsticeCache.clear();
+    gChineseCalendarNewYearCache.clear();
     if (gChineseCalendarZoneAstroCalc) {
         delete gChineseCalendarZoneAstroCalc;
         gChineseCalendarZoneAstroCalc = NULL;
@@ -126,17 +159,21 @@ ChineseCalendar::ChineseCalendar(const Locale& aLocale, UErrorCode& success)
 :   Calendar(TimeZone::createDefault(), aLocale, success),
     isLeapYear(FALSE),
     fEpochYear(CHINESE_EPOCH_YEAR),
-    fZoneAstroCalc(getChineseCalZoneAstroCalc())
+    fZoneAstroCalc(getChineseCalZoneAstroCalc()),
+    fAstroTable(&gChineseCalendarAstroTable)
 {
     setTimeInMillis(getNow(), success); // Call this again now that the vtable is set up properly.
 }
 
 ChineseCalendar::ChineseCalendar(const Locale& aLocale, int32_t epochYear,
-                                const TimeZone* zoneAstroCalc, UErrorCode &success)
+                                const TimeZone* zoneAstroCalc,
+                                const ChineseCalendarAstroTable* astroTable,
+                                UErrorCode &success)
 :   Calendar(TimeZone::createDefault(), aLocale, success),
     isLeapYear(FALSE),
     fEpochYear(epochYear),
-    fZoneAstroCalc(zoneAstroCalc)
+    fZoneAstroCalc(zoneAstroCalc),
+    fAstroTable(astroTable)
 {
     setTimeInMillis(getNow(), success); // Call this again now that the vtable is set up properly.
 }
@@ -145,6 +182,7 @@ ChineseCalendar::ChineseCalendar(const ChineseCalendar& other) : Calendar(other)
     isLeapYear = other.isLeapYear;
     fEpochYear = other.fEpochYear;
     fZoneAstroCalc = other.fZoneAstroCalc;
+    fAstroTable = other.fAstroTable;
 }
 
 ChineseCalendar::~ChineseCalendar()
@@ -525,8 +563,12 @@ double ChineseCalendar::millisToDays(double millis) const {
  */
 int32_t ChineseCalendar::winterSolstice(int32_t gyear) const {
 
-    UErrorCode status = U_ZERO_ERROR;
-    int32_t cacheValue = CalendarCache::get(&gChineseCalendarWinterSolsticeCache, gyear, status);
+    if (fAstroTable != NULL && fAstroTable->firstYear <= gyear && gyear <= fAstroTable->lastYear) {
+        return Grego::fieldsToDay(gyear, UCAL_DECEMBER, 1) +
+            fAstroTable->winterSolstices[gyear - fAstroTable->firstYear];
+    }
+
+    int32_t cacheValue = gChineseCalendarWinterSolsticeCache.get(gyear);
 
     if (cacheValue == 0) {
         // In books December 15 is used, but it fails for some years
@@ -546,10 +588,7 @@ int32_t ChineseCalendar::winterSolstice(int32_t gyear) const {
 
         // Winter solstice is 270 degrees solar longitude aka Dongzhi
         cacheValue = (int32_t)millisToDays(solarLong);
-        CalendarCache::put(&gChineseCalendarWinterSolsticeCache, gyear, cacheValue, status);
-    }
-    if(U_FAILURE(status)) {
-        cacheValue = 0;
+        gChineseCalendarWinterSolsticeCache.put(gyear, cacheValue);
     }
     return cacheValue;
 }
@@ -564,7 +603,14 @@ int32_t ChineseCalendar::winterSolstice(int32_t gyear) const {
  * new moon after or before <code>days</code>
  */
 int32_t ChineseCalendar::newMoonNear(double days, UBool after) const {
-    
+
+    int32_t intDays = (int32_t)days;
+    if (intDays == days && isInTable(fAstroTable, intDays)) {
+        int32_t index, prevStart;
+        int32_t monthStart = findNewMoon(*fAstroTable, intDays, index, prevStart);
+        return after ? monthStart : prevStart;
+    }
+
     umtx_lock(&astroLock);
     if(gChineseCalendarAstro == NULL) {
         gChineseCalendarAstro = new CalendarAstronomer();
@@ -620,6 +666,12 @@ int32_t ChineseCalendar::majorSolarTerm(int32_t days) const {
  * moon
  */
 UBool ChineseCalendar::hasNoMajorSolarTerm(int32_t newMoon) const {
+    if (isInTable(fAstroTable, newMoon) && newMoon < fAstroTable->lastNewMoon) {
+        int32_t index, prevStart;
+        if (findNewMoon(*fAstroTable, newMoon, index, prevStart) == newMoon) {
+            return (fAstroTable->noMajorSolarTerm[index / 32] >> (index % 32)) & 1;
+        }
+    }
     return majorSolarTerm(newMoon) ==
         majorSolarTerm(newMoonNear(newMoon + SYNODIC_GAP, TRUE));
 }
@@ -757,8 +809,10 @@ void ChineseCalendar::computeChineseFields(int32_t days, int32_t gyear, int32_t
  * Chinese new year of the given year (this will be a new moon)
  */
 int32_t ChineseCalendar::newYear(int32_t gyear) const {
-    UErrorCode status = U_ZERO_ERROR;
-    int32_t cacheValue = CalendarCache::get(&gChineseCalendarNewYearCache, gyear, status);
+    // With precomputed solstices and new moons, this is cheaper than the cache.
+    UBool useCache = fAstroTable == NULL ||
+        gyear <= fAstroTable->firstYear || fAstroTable->lastYear < gyear;
+    int32_t cacheValue = useCache ? gChineseCalendarNewYearCache.get(gyear) : 0;
 
     if (cacheValue == 0) {
 
@@ -775,10 +829,9 @@ int32_t ChineseCalendar::newYear(int32_t gyear) const {
             cacheValue = newMoon2;
         }
 
-        CalendarCache::put(&gChineseCalendarNewYearCache, gyear, cacheValue, status);
-    }
-    if(U_FAILURE(status)) {
-        cacheValue = 0;
+        if (useCache) {
+            gChineseCalendarNewYearCache.put(gyear, cacheValue);
+        }
     }
     return cacheValue;
 }
@@ -27,6 +27,29 @@
 
 U_NAMESPACE_BEGIN
 
+/**
+ * Precomputed results of the astronomical calculations of a Chinese calendar
+ * variant, in local days of its astronomical base zone.
+ * Month i (0-based) starts at newMoonStarts[i/32] plus 29 days for each
+ * preceding month in that word, plus one day for each of those with its
+ * longMonths bit set. Bit i%32 of noMajorSolarTerm[i/32] is set if month i
+ * lacks a major solar term. The last of the newMoonCount months starts
+ * at lastNewMoon; its bits are not valid.
+ * The winter solstice of Gregorian year y is on December 1 of that year
+ * plus winterSolstices[y-firstYear] days.
+ * @internal
+ */
+struct ChineseCalendarAstroTable {
+  int32_t newMoonCount;
+  int32_t lastNewMoon;
+  const int32_t *newMoonStarts;
+  const uint32_t *longMonths;
+  const uint32_t *noMajorSolarTerm;
+  int32_t firstYear;
+  int32_t lastYear;
+  const uint8_t *winterSolstices;
+};
+
 /**
  * <code>ChineseCalendar</code> is a concrete subclass of {@link Calendar}
  * that implements a traditional Chinese calendar.  The traditional Chinese
@@ -124,11 +147,14 @@ class U_I18N_API ChineseCalendar : public Calendar {
    * @param epochYear       The epoch year to use for calculation.
    * @param zoneAstroCalc   The TimeZone to use for astronomical calculations. If null,
    *                        will be set appropriately for Chinese calendar (UTC + 8:00).
+   * @param astroTable      Precomputed astronomical results for zoneAstroCalc, or NULL.
+   *                        Outside of its range, or without one, the calendar calculates.
    * @param success         Indicates the status of ChineseCalendar object construction;
    *                        if successful, will not be changed to an error value.
    * @internal
    */
-  ChineseCalendar(const Locale& aLocale, int32_t epochYear, const TimeZone* zoneAstroCalc, UErrorCode &success);
+  ChineseCalendar(const Locale& aLocale, int32_t epochYear, const TimeZone* zoneAstroCalc,
+                  const ChineseCalendarAstroTable* astroTable, UErrorCode &success);
 
  public:
   /**
@@ -156,6 +182,8 @@ class U_I18N_API ChineseCalendar : public Calendar {
   int32_t fEpochYear;   // Start year of this Chinese calendar instance.
   const TimeZone* fZoneAstroCalc;   // Zone used for the astronomical calculation
                                     // of this Chinese calendar instance.
+  const ChineseCalendarAstroTable* fAstroTable;  // Precomputed results for fZoneAstroCalc,
+                                                 // or NULL.
 
   //----------------------------------------------------------------------
   // Calendar framework
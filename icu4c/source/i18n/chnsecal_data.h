@@ -0,0 +1,70 @@
+// © 2019 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+//
+// file name: chnsecal_data.h
+//
+// machine-generated from the astronomical calculations in chnsecal.cpp
+// (CalendarAstronomer) for the Chinese calendar's astronomical base zone.
+// See ChineseCalendarAstroTable in chnsecal.h for the format.
+
+
+#ifdef INCLUDED_FROM_CHNSECAL_CPP
+
+static const int32_t gChineseCalendarNewMoonStarts[78]={
+-25626,-24681,-23736,-22791,-21846,-20902,-19956,-19011,-18066,-17121,
+-16176,-15231,-14287,-13341,-12396,-11452,-10506,-9561,-8616,-7672,
+-6726,-5781,-4837,-3891,-2946,-2002,-1057,-111,834,1778,
+2724,3669,4613,5558,6504,7448,8393,9338,10284,11228,
+12173,13118,14063,15008,15953,16898,17842,18788,19733,20678,
+21623,22568,23513,24457,25403,26348,27292,28238,29183,30128,
+31073,32018,32963,33907,34853,35798,36742,37688,38633,39578,
+40522,41468,42413,43357,44303,45248,46192,47137
+};
+
+static const uint32_t gChineseCalendarLongMonths[78]={
+0x5752b695,0xc9764aea,0xaaaad536,0x5d4ad655,0x25d92ba9,0xb4aba4bb,0x6d2ad655,0x9764b6a5,
+0xd26e92f4,0xb52b6a56,0x5d52da95,0x49ba4bd2,0xb52ba95b,0x6d4b5a95,0x26e92ec9,0xd4aea4ed,
+0xb5556a96,0x9ba4daaa,0x52ba93b4,0xb54daa5b,0x6d956aaa,0x4aea4ed2,0xd52ea95d,0xb5556aaa,
+0x2ba95b4a,0x64bb2575,0xd555aa9b,0xaea56d2a,0x92ec96d4,0xda55d25d,0xb6956d2a,0x4bb25b52,
+0x6937497a,0xda95b52b,0x2ea96d52,0xa4dd25e9,0x5a95d4ad,0xb6a9ad53,0x93749764,0x6a5752b6,
+0x5aaab54b,0x4dd26d55,0xa95d49da,0x6aa6d52d,0x574ab555,0x25752b69,0x6a9764af,0x5b2ab555,
+0x95d4ada5,0xb25d92bc,0x6b2ada55,0x5752b695,0x49764b6a,0x6d2ae92f,0x5b52d695,0x25d92da9,
+0xb4aba4bd,0x6d52da95,0x9764b6a9,0xd26e92f4,0xad4aea56,0x5d54daa9,0x49ba4dd2,0xb52ba95b,
+0xad555aa5,0x26e956ca,0xd4aea56d,0xb5556a96,0xaba55aaa,0x92ba95b4,0xb653b25b,0xad955aaa,
+0x4aea56d2,0xd92ed16e,0xb5956d2a,0x2ba95b52,0xa8bb45b9,0x0295749b
+};
+
+static const uint32_t gChineseCalendarNoMajorSolarTerm[78]={
+0x00000800,0x00002000,0x00020000,0x00100000,0x00020000,0x00200000,0x01000000,0x00200000,
+0x02000000,0x10000000,0x80000000,0x10000000,0x00000000,0x00000001,0x00000008,0x00000001,
+0x00000010,0x00000080,0x00000400,0x00000100,0x00000800,0x00004000,0x00001000,0x00008000,
+0x00040000,0x00400000,0x00080000,0x00400000,0x04000000,0x00800000,0x04000000,0x20000000,
+0x90000000,0x40000000,0x00000000,0x00000002,0x00000010,0x00000004,0x00000010,0x00000100,
+0x00000800,0x00000200,0x00001000,0x00010000,0x00004000,0x00010000,0x00080000,0x00400000,
+0x00080000,0x00800000,0x04000000,0x28800000,0x08000000,0x80000000,0x00000000,0x80000002,
+0x00000000,0x00000004,0x00000020,0x00000108,0x00000040,0x00000200,0x00002000,0x00000400,
+0x00002000,0x00020000,0x00004000,0x00020000,0x00100000,0x01000000,0x00200000,0x01000000,
+0x10000000,0x02000000,0x10000000,0x80000000,0x00000000,0x00000004
+};
+
+static const uint8_t gChineseCalendarWinterSolstices[201]={
+21,21,22,22,21,21,22,22,21,21,22,22,21,21,22,22,21,21,22,22,
+21,21,21,22,21,21,21,22,21,21,21,22,21,21,21,22,21,21,21,22,
+21,21,21,22,21,21,21,22,21,21,21,22,21,21,21,21,21,21,21,21,
+21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+21,21,21,21,21,21,21,21,20,21,21,21,20,21,21,21,20,21,21,21,
+20,21,21,21,20,21,21,21,20,21,21,21,20,21,21,21,20,20,21,21,
+20,20,21,21,20,20,21,21,20,20,21,21,20,20,21,21,20,20,21,21,
+20,20,21,21,20,20,21,21,20,20,20,21,20,20,20,21,20,20,20,21,
+20,20,20,21,20,20,20,21,20,20,20,21,20,20,20,21,20,20,20,21,
+20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+21
+};
+
+static const icu::ChineseCalendarAstroTable gChineseCalendarAstroTable={
+  2491, 47905,
+  gChineseCalendarNewMoonStarts, gChineseCalendarLongMonths, gChineseCalendarNoMajorSolarTerm,
+  1900, 2100, gChineseCalendarWinterSolstices
+};
+
+#endif  // INCLUDED_FROM_CHNSECAL_CPP
@@ -439,7 +439,7 @@ Collator* U_EXPORT2 Collator::createInstance(const Locale& desiredLocale,
 
     Collator* coll;
 #if !UCONFIG_NO_SERVICE
-    if (hasService()) {
+    if (hasService() && !gService->isDefault()) {
         Locale actualLoc;
         coll = (Collator*)gService->get(desiredLocale, &actualLoc, status);
     } else
@@ -996,6 +996,23 @@ Collator::internalCompareUTF8(const char *left, int32_t leftLength,
             errorCode);
 }
 
+int32_t
+Collator::internalGetSortKeyUTF8(const char *s, int32_t length,
+                                 uint8_t *dest, int32_t capacity, UErrorCode &errorCode) const {
+    if(U_FAILURE(errorCode)) { return 0; }
+    if((s == NULL && length != 0) || capacity < 0 || (dest == NULL && capacity > 0)) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    UnicodeString s16 = UnicodeString::fromUTF8(
+            StringPiece(s, (length < 0) ? static_cast<int32_t>(uprv_strlen(s)) : length));
+    if(s16.isBogus()) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return 0;
+    }
+    return getSortKey(s16, dest, capacity);
+}
+
 int32_t
 Collator::internalNextSortKeyPart(UCharIterator * /*iter*/, uint32_t /*state*/[2],
                                   uint8_t * /*dest*/, int32_t /*count*/, UErrorCode &errorCode) const {
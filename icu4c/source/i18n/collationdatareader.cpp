@@ -302,27 +302,41 @@ CollationDataReader::read(const CollationTailoring *base, const uint8_t *inBytes
             }
         }
         // Add the ranges from the data file to the unsafe-backward set.
+        // The serialized ranges are in order, so collecting them in a separate set
+        // only appends, and the union is a single merge rather than one per range.
         USerializedSet sset;
         const uint16_t *unsafeData = reinterpret_cast<const uint16_t *>(inBytes + offset);
         if(!uset_getSerializedSet(&sset, unsafeData, length / 2)) {
             errorCode = U_INVALID_FORMAT_ERROR;
             return;
         }
+        UnicodeSet ranges;
         int32_t count = uset_getSerializedRangeCount(&sset);
         for(int32_t i = 0; i < count; ++i) {
             UChar32 start, end;
             uset_getSerializedRange(&sset, i, &start, &end);
-            tailoring.unsafeBackwardSet->add(start, end);
+            ranges.add(start, end);
         }
+        tailoring.unsafeBackwardSet->addAll(ranges);
         // Mark each lead surrogate as "unsafe"
         // if any of its 1024 associated supplementary code points is "unsafe".
-        UChar32 c = 0x10000;
-        for(UChar lead = 0xd800; lead < 0xdc00; ++lead, c += 0x400) {
-            if(!tailoring.unsafeBackwardSet->containsNone(c, c + 0x3ff)) {
-                tailoring.unsafeBackwardSet->add(lead);
+        // Walk the supplementary ranges rather than testing each lead surrogate.
+        UnicodeSet leads;
+        UnicodeSet &unsafe = *tailoring.unsafeBackwardSet;
+        for(int32_t i = 0, rangeCount = unsafe.getRangeCount(); i < rangeCount; ++i) {
+            UChar32 end = unsafe.getRangeEnd(i);
+            if(end >= 0x10000) {
+                UChar32 start = unsafe.getRangeStart(i);
+                if(start < 0x10000) { start = 0x10000; }
+                leads.add(U16_LEAD(start), U16_LEAD(end));
             }
         }
-        tailoring.unsafeBackwardSet->freeze();
+        unsafe.addAll(leads);
+        if(unsafe.isBogus()) {
+            errorCode = U_MEMORY_ALLOCATION_ERROR;
+            return;
+        }
+        unsafe.freeze();
         data->unsafeBackwardSet = tailoring.unsafeBackwardSet;
     } else if(data == NULL) {
         // Nothing to do.
@@ -334,20 +348,22 @@ CollationDataReader::read(const CollationTailoring *base, const uint8_t *inBytes
         return;
     }
 
-    // If the fast Latin format version is different,
+    // If the fast Latin format version is not supported,
     // or the version is set to 0 for "no fast Latin table",
     // then just always use the normal string comparison path.
     if(data != NULL) {
         data->fastLatinTable = NULL;
         data->fastLatinTableLength = 0;
-        if(((inIndexes[IX_OPTIONS] >> 16) & 0xff) == CollationFastLatin::VERSION) {
+        int32_t fastLatinVersion = (inIndexes[IX_OPTIONS] >> 16) & 0xff;
+        if(CollationFastLatin::MIN_VERSION <= fastLatinVersion &&
+                fastLatinVersion <= CollationFastLatin::VERSION) {
             index = IX_FAST_LATIN_TABLE_OFFSET;
             offset = getIndex(inIndexes, indexesLength, index);
             length = getIndex(inIndexes, indexesLength, index + 1) - offset;
             if(length >= 2) {
                 data->fastLatinTable = reinterpret_cast<const uint16_t *>(inBytes + offset);
                 data->fastLatinTableLength = length / 2;
-                if((*data->fastLatinTable >> 8) != CollationFastLatin::VERSION) {
+                if((*data->fastLatinTable >> 8) != fastLatinVersion) {
                     errorCode = U_INVALID_FORMAT_ERROR;  // header vs. table version mismatch
                     return;
                 }
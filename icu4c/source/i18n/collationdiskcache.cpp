@@ -0,0 +1,237 @@
+// © 2019 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+
+// collationdiskcache.cpp
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_COLLATION
+
+#include <stdio.h>
+
+#include "unicode/putil.h"
+#include "unicode/tblcoll.h"
+#include "unicode/ucol.h"
+#include "unicode/udata.h"
+#include "unicode/uversion.h"
+#include "charstr.h"
+#include "cmemory.h"
+#include "collationdatareader.h"
+#include "collationdiskcache.h"
+#include "collationroot.h"
+#include "collationtailoring.h"
+#include "putilimp.h"
+#include "udatamem.h"
+
+U_NAMESPACE_BEGIN
+
+namespace {
+
+/** udata type (file name extension) of cache files. */
+const char CACHE_FILE_TYPE[] = "ucb";
+
+/** FNV-1a over the UTF-16 code units. */
+uint64_t hashRules(const UnicodeString &rules) {
+    uint64_t hash = UINT64_C(0xcbf29ce484222325);
+    const char16_t *p = rules.getBuffer();
+    for(int32_t i = 0; i < rules.length(); ++i) {
+        hash = (hash ^ p[i]) * UINT64_C(0x100000001b3);
+    }
+    return hash;
+}
+
+/** Rounds up to a multiple of 4. */
+inline int32_t align4(int32_t length) {
+    return (length + 3) & ~3;
+}
+
+/**
+ * Returns the length of the collation data at the start of a cache file,
+ * or -1 if the rule string at its end is not the same as rules.
+ */
+int32_t checkRules(const uint8_t *bytes, int32_t length, const UnicodeString &rules) {
+    // Trailer: int32_t binaryLength, rulesLength
+    if(length < 8 || (length & 3) != 0) { return -1; }
+    const int32_t *trailer = reinterpret_cast<const int32_t *>(bytes + length - 8);
+    int32_t binaryLength = trailer[0];
+    int32_t rulesLength = trailer[1];
+    if(binaryLength <= 0 || rulesLength != rules.length() ||
+            binaryLength > length - 8 ||
+            align4(rulesLength * 2) != length - 8 - align4(binaryLength)) {
+        return -1;
+    }
+    const char16_t *fileRules =
+        reinterpret_cast<const char16_t *>(bytes + align4(binaryLength));
+    if(uprv_memcmp(fileRules, rules.getBuffer(), rulesLength * 2) != 0) { return -1; }
+    return binaryLength;
+}
+
+}  // namespace
+
+void
+CollationDiskCache::getDirAndName(const char *dir, const UnicodeString &rules,
+                                  CharString &dirPath, CharString &name,
+                                  UErrorCode &errorCode) {
+    const CollationTailoring *root = CollationRoot::getRoot(errorCode);
+    if(U_FAILURE(errorCode)) { return; }
+    dirPath.clear().append(dir, errorCode);
+    if(dirPath.isEmpty() || dirPath[dirPath.length() - 1] != U_FILE_SEP_CHAR) {
+        dirPath.append(U_FILE_SEP_CHAR, errorCode);
+    }
+    // The name must not contain the udata tree separator '-'.
+    uint64_t hash = hashRules(rules);
+    char buffer[64];
+    snprintf(buffer, sizeof(buffer), "ucol%08x%08x_%d%02x%02x%02x%02x",
+             (unsigned int)(hash >> 32), (unsigned int)hash, U_ICU_VERSION_MAJOR_NUM,
+             root->version[0], root->version[1], root->version[2], root->version[3]);
+    name.clear().append(buffer, errorCode);
+}
+
+void
+CollationDiskCache::getPath(const char *dir, const UnicodeString &rules,
+                            CharString &path, UErrorCode &errorCode) {
+    CharString name;
+    getDirAndName(dir, rules, path, name, errorCode);
+    path.append(name, errorCode).append('.', errorCode).append(CACHE_FILE_TYPE, errorCode);
+}
+
+CollationTailoring *
+CollationDiskCache::load(const char *dir, const UnicodeString &rules, UErrorCode &errorCode) {
+    CharString dirPath, name;
+    getDirAndName(dir, rules, dirPath, name, errorCode);
+    const CollationTailoring *root = CollationRoot::getRoot(errorCode);
+    if(U_FAILURE(errorCode)) { return NULL; }
+    LocalPointer<CollationTailoring> t(new CollationTailoring(root->settings));
+    if(t.isNull() || t->isBogus()) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return NULL;
+    }
+    // A missing, stale or damaged file is not an error: The caller builds the tailoring.
+    UErrorCode loadErrorCode = U_ZERO_ERROR;
+    t->memory = udata_openChoice(dirPath.data(), CACHE_FILE_TYPE, name.data(),
+                                 CollationDataReader::isAcceptable, t->version,
+                                 &loadErrorCode);
+    if(U_FAILURE(loadErrorCode)) { return NULL; }
+    // The length of the file as mapped, rather than as it may be now.
+    const uint8_t *bytes = reinterpret_cast<const uint8_t *>(t->memory->pHeader);
+    int32_t length = t->memory->length;
+    if(length < 0) { return NULL; }
+    // Different rules can have the same hash and thus the same file name.
+    int32_t binaryLength = checkRules(bytes, length, rules);
+    if(binaryLength < 0) { return NULL; }
+    CollationDataReader::read(root, bytes, binaryLength, *t, loadErrorCode);
+    if(U_FAILURE(loadErrorCode)) { return NULL; }
+    t->rules = rules;
+    t->actualLocale.setToBogus();
+    return t.orphan();
+}
+
+void
+CollationDiskCache::store(const char *dir, const UnicodeString &rules,
+                          const RuleBasedCollator &coll, UErrorCode &errorCode) {
+    CharString path;
+    getPath(dir, rules, path, errorCode);
+    if(U_FAILURE(errorCode)) { return; }
+    UErrorCode storeErrorCode = U_ZERO_ERROR;
+    int32_t binaryLength = coll.cloneBinary(NULL, 0, storeErrorCode);
+    if(storeErrorCode != U_BUFFER_OVERFLOW_ERROR) { return; }
+    int32_t rulesStart = align4(binaryLength);
+    int32_t rulesLength = rules.length();
+    if(rulesLength > (INT32_MAX - rulesStart - 11) / 2) { return; }
+    int32_t length = rulesStart + align4(rulesLength * 2) + 8;
+    MaybeStackArray<uint8_t, 1> buffer;
+    if(buffer.resize(length) == NULL) { return; }
+    uprv_memset(buffer.getAlias(), 0, length);
+    storeErrorCode = U_ZERO_ERROR;
+    coll.cloneBinary(buffer.getAlias(), binaryLength, storeErrorCode);
+    if(U_FAILURE(storeErrorCode)) { return; }
+    uprv_memcpy(buffer.getAlias() + rulesStart, rules.getBuffer(), rulesLength * 2);
+    int32_t trailer[2] = { binaryLength, rulesLength };
+    uprv_memcpy(buffer.getAlias() + length - 8, trailer, 8);
+
+    // Make the temporary name unique enough that concurrent writers
+    // in other processes or threads do not interleave their output.
+    char suffix[32];
+    snprintf(suffix, sizeof(suffix), ".%08x.tmp",
+             (unsigned int)((uint32_t)uprv_getRawUTCtime() ^ (uint32_t)(uintptr_t)&coll ^
+                            (uint32_t)(uintptr_t)buffer.getAlias()));
+    CharString tempPath(path, storeErrorCode);
+    tempPath.append(suffix, storeErrorCode);
+    if(U_FAILURE(storeErrorCode)) { return; }
+    FILE *f = fopen(tempPath.data(), "wb");
+    if(f == NULL) { return; }
+    UBool ok = fwrite(buffer.getAlias(), 1, length, f) == (size_t)length;
+    ok = (fclose(f) == 0) && ok;
+    // rename() fails on some platforms if another writer got there first;
+    // that file has the same contents.
+    if(!ok || rename(tempPath.data(), path.data()) != 0) {
+        remove(tempPath.data());
+    }
+}
+
+void
+RuleBasedCollator::internalBuildCachedTailoring(const UnicodeString &rules,
+                                                int32_t strength,
+                                                UColAttributeValue decompositionMode,
+                                                const char *cacheDir,
+                                                UParseError *outParseError,
+                                                UErrorCode &errorCode) {
+    if(U_FAILURE(errorCode)) { return; }
+    CollationTailoring *t = CollationDiskCache::load(cacheDir, rules, errorCode);
+    if(U_FAILURE(errorCode)) { return; }
+    if(t != NULL) {
+        if(outParseError != NULL) {
+            outParseError->line = 0;
+            outParseError->offset = -1;
+            outParseError->preContext[0] = 0;
+            outParseError->postContext[0] = 0;
+        }
+        adoptTailoring(t, errorCode);
+    } else {
+        // Cache the default settings, before the attributes are set.
+        internalBuildTailoring(rules, UCOL_DEFAULT, UCOL_DEFAULT, outParseError, NULL, errorCode);
+        if(U_FAILURE(errorCode)) { return; }
+        CollationDiskCache::store(cacheDir, rules, *this, errorCode);
+    }
+    if(strength != UCOL_DEFAULT) {
+        setAttribute(UCOL_STRENGTH, (UColAttributeValue)strength, errorCode);
+    }
+    if(decompositionMode != UCOL_DEFAULT) {
+        setAttribute(UCOL_NORMALIZATION_MODE, decompositionMode, errorCode);
+    }
+}
+
+U_NAMESPACE_END
+
+U_NAMESPACE_USE
+
+U_CAPI UCollator * U_EXPORT2
+ucol_openRulesCached(const UChar *rules, int32_t rulesLength,
+                     UColAttributeValue normalizationMode, UCollationStrength strength,
+                     const char *cacheDir,
+                     UParseError *parseError, UErrorCode *pErrorCode) {
+    if(U_FAILURE(*pErrorCode)) { return NULL; }
+    if(cacheDir == NULL || *cacheDir == 0) {
+        return ucol_openRules(rules, rulesLength, normalizationMode, strength,
+                              parseError, pErrorCode);
+    }
+    if(rules == NULL && rulesLength != 0) {
+        *pErrorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return NULL;
+    }
+    RuleBasedCollator *coll = new RuleBasedCollator();
+    if(coll == NULL) {
+        *pErrorCode = U_MEMORY_ALLOCATION_ERROR;
+        return NULL;
+    }
+    UnicodeString r((UBool)(rulesLength < 0), rules, rulesLength);
+    coll->internalBuildCachedTailoring(r, strength, normalizationMode, cacheDir,
+                                       parseError, *pErrorCode);
+    if(U_FAILURE(*pErrorCode)) {
+        delete coll;
+        return NULL;
+    }
+    return coll->toUCollator();
+}
+
+#endif  // !UCONFIG_NO_COLLATION
@@ -0,0 +1,68 @@
+// © 2019 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+
+// collationdiskcache.h
+
+#ifndef __COLLATIONDISKCACHE_H__
+#define __COLLATIONDISKCACHE_H__
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_COLLATION
+
+#include "unicode/unistr.h"
+#include "charstr.h"
+
+U_NAMESPACE_BEGIN
+
+struct CollationTailoring;
+class RuleBasedCollator;
+
+/**
+ * Implements ucol_openRulesCached().
+ *
+ * A cache file holds the output of RuleBasedCollator::cloneBinary()
+ * for one rule string; that is, ICU data with the "UCol" header.
+ * It is followed by the rule string itself, each part padded to a multiple of 4 bytes,
+ * and then by the int32_t lengths of the binary data and of the rules (in UTF-16 units).
+ * The file is used only if its rule string is the same as the requested one.
+ * Its name is derived from a 64-bit hash of the rules, the ICU version
+ * and the root collator version, so that files written by other ICU versions
+ * or with other root data are never picked up.
+ * Files are written to a temporary name and then renamed,
+ * so that readers in other processes never see partial data.
+ */
+struct U_I18N_API CollationDiskCache /* all static */ {
+    /**
+     * Sets path to the full file name for the rules in directory dir.
+     */
+    static void getPath(const char *dir, const UnicodeString &rules,
+                        CharString &path, UErrorCode &errorCode);
+
+    /**
+     * Memory-maps the cache file for the rules.
+     * Returns NULL (without setting an error) if there is no usable file.
+     * The tailoring owns the mapping.
+     */
+    static CollationTailoring *load(const char *dir, const UnicodeString &rules,
+                                    UErrorCode &errorCode);
+
+    /**
+     * Writes the collator's tailoring data to the cache file for the rules.
+     * Failures to write are not reported; the cache only affects performance.
+     */
+    static void store(const char *dir, const UnicodeString &rules,
+                      const RuleBasedCollator &coll, UErrorCode &errorCode);
+
+private:
+    CollationDiskCache();  // no constructor
+
+    static void getDirAndName(const char *dir, const UnicodeString &rules,
+                              CharString &dirPath, CharString &name,
+                              UErrorCode &errorCode);
+};
+
+U_NAMESPACE_END
+
+#endif  // !UCONFIG_NO_COLLATION
+#endif  // __COLLATIONDISKCACHE_H__
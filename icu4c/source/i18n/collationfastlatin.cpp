@@ -920,17 +920,34 @@ CollationFastLatin::nextPair(const uint16_t *table, UChar32 c, uint32_t ce,
             int32_t head = table[i];  // first skip the default mapping
             int32_t x;
             do {
-                i += head >> CONTR_LENGTH_SHIFT;
+                i += (head >> CONTR_LENGTH_SHIFT) & CONTR_LENGTH_MASK;
                 head = table[i];
                 x = head & CONTR_CHAR_MASK;
             } while(x < c2);
             if(x == c2) {
                 index = i;
                 sIndex = nextIndex;
+                if((head & CONTR_CHECK_NEXT) != 0 && nextIndex != sLength) {
+                    // A longer contraction might continue with a non-fast-Latin character.
+                    int32_t c3;
+                    if(s16 != NULL) {
+                        c3 = s16[nextIndex];
+                        if(c3 > LATIN_MAX && !(PUNCT_START <= c3 && c3 < PUNCT_LIMIT)) {
+                            return BAIL_OUT;
+                        }
+                    } else {
+                        c3 = s8[nextIndex];
+                        if(c3 > 0x7f && !(0xc2 <= c3 && c3 <= 0xc5) &&
+                                !(c3 == 0xe2 && (nextIndex + 1) != sLength &&
+                                    s8[nextIndex + 1] == 0x80)) {
+                            return BAIL_OUT;
+                        }
+                    }
+                }
             }
         }
         // Return the CE or CEs for the default or contraction mapping.
-        int32_t length = table[index] >> CONTR_LENGTH_SHIFT;
+        int32_t length = (table[index] >> CONTR_LENGTH_SHIFT) & CONTR_LENGTH_MASK;
         if(length == 1) {
             return BAIL_OUT;
         }
@@ -33,7 +33,12 @@ class U_I18N_API CollationFastLatin /* all static */ {
      * When the major version number of the main data format changes,
      * we can reset this fast Latin version to 1.
      */
-    static const uint16_t VERSION = 2;
+    static const uint16_t VERSION = 3;
+    /**
+     * Lowest fast Latin version that this code can read.
+     * Version 3 only added CONTR_CHECK_NEXT, so version 2 tables can be used as is.
+     */
+    static const uint16_t MIN_VERSION = 2;
 
     static const int32_t LATIN_MAX = 0x17f;
     static const int32_t LATIN_LIMIT = LATIN_MAX + 1;
@@ -181,6 +186,14 @@ class U_I18N_API CollationFastLatin /* all static */ {
      * 1=bail out, 2=one mini CE, 3=two mini CEs
      */
     static const uint32_t CONTR_LENGTH_SHIFT = 9;
+    static const uint32_t CONTR_LENGTH_MASK = 3;
+    /**
+     * Contraction result first word bit 11 is set if a longer contraction
+     * continues the matched one with a character that is not fast Latin.
+     * Bail out if the character after the matched one is not fast Latin,
+     * for example a combining mark.
+     */
+    static const uint32_t CONTR_CHECK_NEXT = 0x800;
 
     /**
      * Comparison return value when the regular comparison must be used.
@@ -254,7 +267,7 @@ class U_I18N_API CollationFastLatin /* all static */ {
 
 /*
  * Format of the CollationFastLatin data table.
- * CollationFastLatin::VERSION = 2.
+ * CollationFastLatin::VERSION = 3.
  *
  * This table contains data for a Latin-text collation fastpath.
  * The data is stored as an array of uint16_t which contains the following parts.
@@ -295,6 +308,7 @@ class U_I18N_API CollationFastLatin /* all static */ {
  *   Contraction mini CEs contain an offset relative to just after the miniCEs table.
  *   It points to a list of tuples which map from a contraction suffix character to a result.
  *   First uint16_t of each tuple:
+ *     Bit     11: Check the next character, see comments on CONTR_CHECK_NEXT.
  *     Bits 10..9: Length of the result (1..3), see comments on CONTR_LENGTH_SHIFT.
  *     Bits  8..0: Contraction character, see comments on CONTR_CHAR_MASK.
  *   This is followed by 0, 1, or 2 uint16_t according to the length.
@@ -303,6 +317,15 @@ class U_I18N_API CollationFastLatin /* all static */ {
  *   for when there is no contraction match.
  *
  * -----------------
+ * Changes for version 3 (ICU 65)
+ *
+ * New contraction flag CONTR_CHECK_NEXT.
+ * Before, a fast Latin character with both a single-character contraction suffix
+ * and a longer one (for example, Croatian "dž" and its canonical closure "dz\u030C")
+ * bailed out for all text where it followed the contraction starter.
+ * Version 2 tables are valid version 3 tables.
+ *
+ * -----------------
  * Changes for version 2 (ICU 55)
  *
  * Special reorder groups do not necessarily start on whole primary lead bytes any more.
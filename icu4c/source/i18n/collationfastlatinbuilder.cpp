@@ -298,6 +298,11 @@ CollationFastLatinBuilder::getCEsFromCE32(const CollationData &data, UChar32 c,
             return FALSE;
         }
     }
+    return areEncodableCEs();
+}
+
+UBool
+CollationFastLatinBuilder::areEncodableCEs() const {
     // A mapping can be completely ignorable.
     if(ce0 == 0) { return ce1 == 0; }
     // We do not support an ignorable ce0 unless it is completely ignorable.
@@ -354,37 +359,61 @@ CollationFastLatinBuilder::getCEsFromContractionCE32(const CollationData &data,
         // Bail out for c-without-contraction.
         addContractionEntry(CollationFastLatin::CONTR_CHAR_MASK, Collation::NO_CE, 0, errorCode);
     }
-    // Handle an encodable contraction unless the next contraction is too long
-    // and starts with the same character.
+    UBool hasDefault = U_SUCCESS(errorCode) &&
+            contractionCEs.elementAti(contractionIndex + 1) != Collation::NO_CE;
+    int64_t defaultCE0 = contractionCEs.elementAti(contractionIndex + 1);
+    int64_t defaultCE1 = contractionCEs.elementAti(contractionIndex + 2);
+    // Group the suffixes by their first character.
+    // Handle an encodable single-character contraction.
+    // If there are also longer contractions that start with the same character,
+    // then they must continue with characters that are not fast Latin,
+    // such as combining marks from canonical closure.
+    // The runtime code bails out when it sees such a character after this one.
     int32_t prevX = -1;
-    UBool addContraction = FALSE;
+    UChar prevC = 0;
+    UBool hasSingle = FALSE;
+    UBool hasLonger = FALSE;
+    UBool longerNeedNonFast = TRUE;
+    int64_t singleCE0 = 0, singleCE1 = 0;
     UCharsTrie::Iterator suffixes(p + 2, 0, errorCode);
-    while(suffixes.next(errorCode)) {
-        const UnicodeString &suffix = suffixes.getString();
-        int32_t x = CollationFastLatin::getCharIndex(suffix.charAt(0));
-        if(x < 0) { continue; }  // ignore anything but fast Latin text
-        if(x == prevX) {
-            if(addContraction) {
-                // Bail out for all contractions starting with this character.
-                addContractionEntry(x, Collation::NO_CE, 0, errorCode);
-                addContraction = FALSE;
+    for(;;) {
+        UBool hasNext = suffixes.next(errorCode);
+        int32_t x = -1;
+        if(hasNext) {
+            const UnicodeString &suffix = suffixes.getString();
+            x = CollationFastLatin::getCharIndex(suffix.charAt(0));
+            if(x < 0) { continue; }  // ignore anything but fast Latin text
+            if(x == prevX) {
+                // A longer suffix; the single-character one would have come first.
+                hasLonger = TRUE;
+                if(CollationFastLatin::getCharIndex(suffix.charAt(1)) >= 0) {
+                    longerNeedNonFast = FALSE;
+                }
+                continue;
             }
-            continue;
         }
-        if(addContraction) {
-            addContractionEntry(prevX, ce0, ce1, errorCode);
+        if(prevX >= 0) {
+            addSuffixEntry(data, prevX, prevC, hasSingle, singleCE0, singleCE1,
+                           hasLonger && longerNeedNonFast, hasLonger,
+                           hasDefault, defaultCE0, defaultCE1, errorCode);
         }
-        ce32 = (uint32_t)suffixes.getValue();
-        if(suffix.length() == 1 && getCEsFromCE32(data, U_SENTINEL, ce32, errorCode)) {
-            addContraction = TRUE;
+        if(!hasNext) { break; }
+        const UnicodeString &suffix = suffixes.getString();
+        prevX = x;
+        prevC = suffix.charAt(0);
+        hasLonger = suffix.length() > 1;
+        longerNeedNonFast = !hasLonger ||
+                CollationFastLatin::getCharIndex(suffix.charAt(1)) < 0;
+        hasSingle = !hasLonger;
+        if(hasSingle &&
+                getCEsFromCE32(data, U_SENTINEL, (uint32_t)suffixes.getValue(), errorCode)) {
+            singleCE0 = ce0;
+            singleCE1 = ce1;
         } else {
-            addContractionEntry(x, Collation::NO_CE, 0, errorCode);
-            addContraction = FALSE;
+            // No single-character contraction, or it is not encodable.
+            singleCE0 = Collation::NO_CE;
+            singleCE1 = 0;
         }
-        prevX = x;
-    }
-    if(addContraction) {
-        addContractionEntry(prevX, ce0, ce1, errorCode);
     }
     if(U_FAILURE(errorCode)) { return FALSE; }
     // Note: There might not be any fast Latin contractions, but
@@ -397,6 +426,67 @@ CollationFastLatinBuilder::getCEsFromContractionCE32(const CollationData &data,
     return TRUE;
 }
 
+void
+CollationFastLatinBuilder::addSuffixEntry(const CollationData &data, int32_t x, UChar c,
+                                          UBool hasSingle, int64_t singleCE0, int64_t singleCE1,
+                                          UBool checkNext, UBool hasLonger,
+                                          UBool hasDefault, int64_t defaultCE0, int64_t defaultCE1,
+                                          UErrorCode &errorCode) {
+    // singleCE0 is NO_CE if the single-character contraction is not encodable,
+    // which makes the runtime code bail out.
+    if(!hasLonger) {
+        addContractionEntry(x, singleCE0, singleCE1, errorCode);
+        return;
+    }
+    if(!checkNext || (hasSingle && singleCE0 == Collation::NO_CE)) {
+        // Bail out for all contractions starting with this character.
+        addContractionEntry(x, Collation::NO_CE, 0, errorCode);
+        return;
+    }
+    int32_t flaggedX = x | CollationFastLatin::CONTR_CHECK_NEXT;
+    if(hasSingle) {
+        addContractionEntry(flaggedX, singleCE0, singleCE1, errorCode);
+        return;
+    }
+    // There are only longer contractions starting with c.
+    // Without one of them, the text maps to the default CE of the contraction starter
+    // followed by the CE for c.
+    // Encode that pair, unless c needs context that the runtime code would not see.
+    if(hasDefault && defaultCE1 == 0) {
+        const CollationData *d = &data;
+        uint32_t ce32 = d->getCE32(c);
+        if(ce32 == Collation::FALLBACK_CE32 && d->base != NULL) {
+            d = d->base;
+            ce32 = d->getCE32(c);
+        }
+        ce32 = d->getFinalCE32(ce32);
+        if(Collation::isContractionCE32(ce32)) {
+            // c may start contractions of its own, typically from canonical closure.
+            // The check for a following non-fast-Latin character covers them
+            // if none of them continues with a fast Latin character.
+            const UChar *q = d->contexts + Collation::indexFromCE32(ce32);
+            ce32 = CollationData::readCE32(q);
+            UCharsTrie::Iterator cSuffixes(q + 2, 0, errorCode);
+            while(cSuffixes.next(errorCode)) {
+                if(CollationFastLatin::getCharIndex(cSuffixes.getString().charAt(0)) >= 0) {
+                    ce32 = Collation::FALLBACK_CE32;  // not encodable
+                    break;
+                }
+            }
+        }
+        if(ce32 != Collation::FALLBACK_CE32 && !Collation::ce32HasContext(ce32) &&
+                getCEsFromCE32(*d, c, ce32, errorCode) && ce1 == 0 && ce0 != 0) {
+            ce1 = ce0;
+            ce0 = defaultCE0;
+            if(areEncodableCEs()) {
+                addContractionEntry(flaggedX, ce0, ce1, errorCode);
+                return;
+            }
+        }
+    }
+    addContractionEntry(x, Collation::NO_CE, 0, errorCode);
+}
+
 void
 CollationFastLatinBuilder::addContractionEntry(int32_t x, int64_t cce0, int64_t cce1,
                                                UErrorCode &errorCode) {
@@ -54,6 +54,12 @@ class U_I18N_API CollationFastLatinBuilder : public UObject {
                          UErrorCode &errorCode);
     UBool getCEsFromContractionCE32(const CollationData &data, uint32_t ce32,
                                     UErrorCode &errorCode);
+    UBool areEncodableCEs() const;
+    void addSuffixEntry(const CollationData &data, int32_t x, UChar c,
+                        UBool hasSingle, int64_t singleCE0, int64_t singleCE1,
+                        UBool checkNext, UBool hasLonger,
+                        UBool hasDefault, int64_t defaultCE0, int64_t defaultCE1,
+                        UErrorCode &errorCode);
     void addContractionEntry(int32_t x, int64_t cce0, int64_t cce1, UErrorCode &errorCode);
     void addUniqueCE(int64_t ce, UErrorCode &errorCode);
     uint32_t getMiniCE(int64_t ce) const;
@@ -205,6 +205,14 @@ class U_I18N_API CollationIterator : public UObject {
         cesIndex = ceBuffer.length = 0;
     }
 
+    /**
+     * Makes nextCE() return the buffered CEs again from the first one.
+     * After fetchCEs(), this replays all of the CEs without reading the text again.
+     */
+    void rewindCEs() {
+        cesIndex = 0;
+    }
+
     void clearCEsIfNoneRemaining() {
         if(cesIndex == ceBuffer.length) { clearCEs(); }
     }
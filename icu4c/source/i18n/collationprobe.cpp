@@ -0,0 +1,186 @@
+// © 2019 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+
+// collationprobe.cpp
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_COLLATION
+
+#include "unicode/tblcoll.h"
+#include "unicode/ucol.h"
+#include "unicode/ustring.h"
+#include "collation.h"
+#include "collationcompare.h"
+#include "collationdata.h"
+#include "collationfastlatin.h"
+#include "collationprobe.h"
+#include "collationsettings.h"
+#include "cstring.h"
+#include "utf16collationiterator.h"
+#include "utf8collationiterator.h"
+
+U_NAMESPACE_BEGIN
+
+CollationProbe::CollationProbe(const RuleBasedCollator &c, const UChar *s, int32_t length,
+                               UErrorCode &errorCode)
+        : coll(c), s16(s, length) {
+    if(s16.isBogus()) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    int32_t capacity;
+    int32_t length8 = 0;
+    char *buffer = s8.getAppendBuffer(s16.length() * 3, s16.length() * 3, capacity, errorCode);
+    u_strToUTF8WithSub(buffer, capacity, &length8, s16.getBuffer(), s16.length(),
+                       0xfffd, NULL, &errorCode);
+    s8.append(buffer, length8, errorCode);
+    if(U_FAILURE(errorCode)) { return; }
+    const UChar *p = s16.getBuffer();
+    const UChar *limit = p + s16.length();
+    UBool numeric = coll.settings->isNumeric();
+    if(coll.settings->dontCheckFCD()) {
+        iter.adoptInsteadAndCheckErrorCode(
+            new UTF16CollationIterator(coll.data, numeric, p, p, limit), errorCode);
+    } else {
+        iter.adoptInsteadAndCheckErrorCode(
+            new FCDUTF16CollationIterator(coll.data, numeric, p, p, limit), errorCode);
+    }
+    if(U_FAILURE(errorCode)) { return; }
+    iter->fetchCEs(errorCode);
+}
+
+CollationProbe::~CollationProbe() {}
+
+UCollationResult
+CollationProbe::compareCEs(CollationIterator &other, UErrorCode &errorCode) {
+    iter->rewindCEs();
+    // compareUpToQuaternary() may overwrite variable CEs and the ignorables after them.
+    // It writes the same values when it sees them again, so the buffer stays valid.
+    return (UCollationResult)CollationCompare::compareUpToQuaternary(
+        *iter, other, *coll.settings, errorCode);
+}
+
+UCollationResult
+CollationProbe::compare(const UChar *t, int32_t length, UErrorCode &errorCode) {
+    if(U_FAILURE(errorCode)) { return UCOL_EQUAL; }
+    if(t == NULL && length != 0) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return UCOL_EQUAL;
+    }
+    if(length < 0) { length = u_strlen(t); }
+    const CollationSettings &settings = *coll.settings;
+    const UChar *s = s16.getBuffer();
+    int32_t sLength = s16.length();
+    if(sLength > 0 && length > 0 && s[0] == t[0]) {
+        // The regular comparison skips the identical prefix, which is usually faster
+        // than replaying the CEs from the start of the probe.
+        return coll.compare(s, sLength, t, length, errorCode);
+    }
+    int32_t result = CollationFastLatin::BAIL_OUT_RESULT;
+    if(settings.fastLatinOptions >= 0 &&
+            (sLength == 0 || s[0] <= CollationFastLatin::LATIN_MAX) &&
+            (length == 0 || t[0] <= CollationFastLatin::LATIN_MAX)) {
+        result = CollationFastLatin::compareUTF16(coll.data->fastLatinTable,
+                                                  settings.fastLatinPrimaries,
+                                                  settings.fastLatinOptions,
+                                                  s, sLength, t, length);
+    }
+    if(result == CollationFastLatin::BAIL_OUT_RESULT) {
+        UBool numeric = settings.isNumeric();
+        if(settings.dontCheckFCD()) {
+            UTF16CollationIterator tIter(coll.data, numeric, t, t, t + length);
+            result = compareCEs(tIter, errorCode);
+        } else {
+            FCDUTF16CollationIterator tIter(coll.data, numeric, t, t, t + length);
+            result = compareCEs(tIter, errorCode);
+        }
+    }
+    if(result != UCOL_EQUAL || settings.getStrength() < UCOL_IDENTICAL || U_FAILURE(errorCode)) {
+        return (UCollationResult)result;
+    }
+    // Rare: Let the collator compare the identical level.
+    return coll.compare(s, sLength, t, length, errorCode);
+}
+
+UCollationResult
+CollationProbe::compareUTF8(const char *t, int32_t length, UErrorCode &errorCode) {
+    if(U_FAILURE(errorCode)) { return UCOL_EQUAL; }
+    if(t == NULL && length != 0) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return UCOL_EQUAL;
+    }
+    if(length < 0) { length = static_cast<int32_t>(uprv_strlen(t)); }
+    const CollationSettings &settings = *coll.settings;
+    const uint8_t *t8 = reinterpret_cast<const uint8_t *>(t);
+    if(!s8.isEmpty() && length > 0 && s8[0] == t[0]) {
+        return coll.internalCompareUTF8(s8.data(), s8.length(), t, length, errorCode);
+    }
+    int32_t result = CollationFastLatin::BAIL_OUT_RESULT;
+    // Same check for the first characters as in RuleBasedCollator::doCompare().
+    if(settings.fastLatinOptions >= 0 &&
+            (s16.isEmpty() || s16.charAt(0) <= CollationFastLatin::LATIN_MAX) &&
+            (length == 0 || t8[0] <= 0x7f || (0xc2 <= t8[0] && t8[0] <= 0xc5))) {
+        result = CollationFastLatin::compareUTF8(coll.data->fastLatinTable,
+                                                 settings.fastLatinPrimaries,
+                                                 settings.fastLatinOptions,
+                                                 reinterpret_cast<const uint8_t *>(s8.data()),
+                                                 s8.length(), t8, length);
+    }
+    if(result == CollationFastLatin::BAIL_OUT_RESULT) {
+        UBool numeric = settings.isNumeric();
+        if(settings.dontCheckFCD()) {
+            UTF8CollationIterator tIter(coll.data, numeric, t8, 0, length);
+            result = compareCEs(tIter, errorCode);
+        } else {
+            FCDUTF8CollationIterator tIter(coll.data, numeric, t8, 0, length);
+            result = compareCEs(tIter, errorCode);
+        }
+    }
+    if(result != UCOL_EQUAL || settings.getStrength() < UCOL_IDENTICAL || U_FAILURE(errorCode)) {
+        return (UCollationResult)result;
+    }
+    return coll.internalCompareUTF8(s8.data(), s8.length(), t, length, errorCode);
+}
+
+U_NAMESPACE_END
+
+U_NAMESPACE_USE
+
+U_CAPI UCollationProbe * U_EXPORT2
+ucol_openProbe(const UCollator *coll, const UChar *source, int32_t sourceLength,
+               UErrorCode *status) {
+    if(U_FAILURE(*status)) { return NULL; }
+    if(source == NULL && sourceLength != 0) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return NULL;
+    }
+    const RuleBasedCollator *rbc = RuleBasedCollator::rbcFromUCollator(coll);
+    if(rbc == NULL) {
+        *status = U_UNSUPPORTED_ERROR;
+        return NULL;
+    }
+    LocalPointer<CollationProbe> probe(
+        new CollationProbe(*rbc, source, sourceLength, *status), *status);
+    if(U_FAILURE(*status)) { return NULL; }
+    return reinterpret_cast<UCollationProbe *>(probe.orphan());
+}
+
+U_CAPI void U_EXPORT2
+ucol_closeProbe(UCollationProbe *probe) {
+    delete reinterpret_cast<CollationProbe *>(probe);
+}
+
+U_CAPI UCollationResult U_EXPORT2
+ucol_compareProbe(UCollationProbe *probe, const UChar *target, int32_t targetLength,
+                  UErrorCode *status) {
+    return reinterpret_cast<CollationProbe *>(probe)->compare(target, targetLength, *status);
+}
+
+U_CAPI UCollationResult U_EXPORT2
+ucol_compareProbeUTF8(UCollationProbe *probe, const char *target, int32_t targetLength,
+                      UErrorCode *status) {
+    return reinterpret_cast<CollationProbe *>(probe)->compareUTF8(target, targetLength, *status);
+}
+
+#endif  // !UCONFIG_NO_COLLATION
@@ -0,0 +1,58 @@
+// © 2019 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+
+// collationprobe.h
+
+#ifndef __COLLATIONPROBE_H__
+#define __COLLATIONPROBE_H__
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_COLLATION
+
+#include "unicode/localpointer.h"
+#include "unicode/ucol.h"
+#include "unicode/unistr.h"
+#include "charstr.h"
+#include "collationiterator.h"
+
+U_NAMESPACE_BEGIN
+
+class RuleBasedCollator;
+
+/**
+ * Implements UCollationProbe.
+ * Compares one fixed string against many others with the same results as
+ * RuleBasedCollator::compare(). The CEs of the fixed string are computed once
+ * and replayed for each comparison that cannot use the fast Latin path.
+ *
+ * Not thread-safe: compare() reuses the buffered CEs.
+ */
+class CollationProbe : public UMemory {
+public:
+    CollationProbe(const RuleBasedCollator &coll, const UChar *s, int32_t length,
+                   UErrorCode &errorCode);
+    ~CollationProbe();
+
+    UCollationResult compare(const UChar *t, int32_t length, UErrorCode &errorCode);
+    UCollationResult compareUTF8(const char *t, int32_t length, UErrorCode &errorCode);
+
+private:
+    CollationProbe(const CollationProbe &) = delete;
+    CollationProbe &operator=(const CollationProbe &) = delete;
+
+    /** Compares the buffered CEs with the ones from the other iterator. */
+    UCollationResult compareCEs(CollationIterator &other, UErrorCode &errorCode);
+
+    const RuleBasedCollator &coll;
+    UnicodeString s16;
+    /** s16 in UTF-8, for comparisons with UTF-8 text. */
+    CharString s8;
+    /** Holds all CEs of s16 after the constructor. */
+    LocalPointer<CollationIterator> iter;
+};
+
+U_NAMESPACE_END
+
+#endif  // !UCONFIG_NO_COLLATION
+#endif  // __COLLATIONPROBE_H__
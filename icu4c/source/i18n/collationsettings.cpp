@@ -243,6 +243,26 @@ CollationSettings::copyReorderingFrom(const CollationSettings &other, UErrorCode
     }
 }
 
+void
+CollationSettings::aliasFrom(const CollationSettings &other) {
+    if(reorderCodesCapacity != 0) {
+        uprv_free(const_cast<int32_t *>(reorderCodes));
+        reorderCodesCapacity = 0;
+    }
+    options = other.options;
+    variableTop = other.variableTop;
+    reorderTable = other.reorderTable;
+    minHighNoReorder = other.minHighNoReorder;
+    reorderRanges = other.reorderRanges;
+    reorderRangesLength = other.reorderRangesLength;
+    reorderCodes = other.reorderCodes;
+    reorderCodesLength = other.reorderCodesLength;
+    fastLatinOptions = other.fastLatinOptions;
+    if(fastLatinOptions >= 0) {
+        uprv_memcpy(fastLatinPrimaries, other.fastLatinPrimaries, sizeof(fastLatinPrimaries));
+    }
+}
+
 UBool
 CollationSettings::reorderTableHasSplitBytes(const uint8_t table[256]) {
     U_ASSERT(table[0] == 0);
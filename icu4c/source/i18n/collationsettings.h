@@ -130,6 +130,12 @@ struct U_I18N_API CollationSettings : public SharedObject {
     void setReordering(const CollationData &data, const int32_t *codes, int32_t codesLength,
                        UErrorCode &errorCode);
     void copyReorderingFrom(const CollationSettings &other, UErrorCode &errorCode);
+    /**
+     * Copies all of the other settings without allocating memory.
+     * The reordering arrays are aliased, so the other settings object
+     * must outlive this one and must not change its reordering.
+     */
+    void aliasFrom(const CollationSettings &other);
 
     inline UBool hasReordering() const { return reorderTable != NULL; }
     static UBool reorderTableHasSplitBytes(const uint8_t table[256]);
@@ -66,6 +66,24 @@ CollationTailoring::~CollationTailoring() {
     maxExpansionsInitOnce.reset();
 }
 
+int32_t
+CollationTailoring::getMemoryFootprint() const {
+    int32_t size = (int32_t)sizeof(*this) + rules.length() * U_SIZEOF_UCHAR;
+    if(ownedData != NULL) {
+        size += (int32_t)sizeof(CollationData) +
+                ownedData->ce32sLength * 4 +
+                ownedData->cesLength * 8 +
+                ownedData->contextsLength * U_SIZEOF_UCHAR +
+                ownedData->fastLatinTableLength * 2;
+    }
+    if(trie != NULL) {
+        // Preflighting returns the size of the trie data.
+        UErrorCode errorCode = U_ZERO_ERROR;
+        size += utrie2_serialize(trie, NULL, 0, &errorCode);
+    }
+    return size;
+}
+
 UBool
 CollationTailoring::ensureOwnedData(UErrorCode &errorCode) {
     if(U_FAILURE(errorCode)) { return FALSE; }
@@ -108,6 +126,15 @@ CollationCacheEntry::~CollationCacheEntry() {
     SharedObject::clearPtr(tailoring);
 }
 
+int32_t
+CollationCacheEntry::getMemoryFootprint() const {
+    int32_t size = (int32_t)sizeof(*this);
+    if(tailoring != NULL) {
+        size += tailoring->getMemoryFootprint();
+    }
+    return size;
+}
+
 U_NAMESPACE_END
 
 #endif  // !UCONFIG_NO_COLLATION
@@ -49,6 +49,9 @@ struct U_I18N_API CollationTailoring : public SharedObject {
     CollationTailoring(const CollationSettings *baseSettings);
     virtual ~CollationTailoring();
 
+    /** Approximate size of the rules and of the data owned by this tailoring. */
+    virtual int32_t getMemoryFootprint() const;
+
     /**
      * Returns TRUE if the constructor could not initialize properly.
      */
@@ -101,6 +104,8 @@ struct CollationCacheEntry : public SharedObject {
     }
     ~CollationCacheEntry();
 
+    virtual int32_t getMemoryFootprint() const;
+
     Locale validLocale;
     const CollationTailoring *tailoring;
 };
@@ -148,7 +148,7 @@ void CharsetDetector::setRecognizers(UErrorCode &status)
 }
 
 CharsetDetector::CharsetDetector(UErrorCode &status)
-  : textIn(new InputText(status)), resultArray(NULL),
+  : textIn(new InputText(status)), resultArray(NULL), fMatches(NULL),
     resultCount(0), fStripTags(FALSE), fFreshTextSet(FALSE),
     fEnabledRecognizers(NULL)
 {
@@ -156,37 +156,32 @@ CharsetDetector::CharsetDetector(UErrorCode &status)
         return;
     }
 
+    if (textIn == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+
     setRecognizers(status);
 
     if (U_FAILURE(status)) {
         return;
     }
 
+    // All matches are allocated here, so that detecting the charsets of
+    //   any number of texts with this detector does not allocate memory.
     resultArray = (CharsetMatch **)uprv_malloc(sizeof(CharsetMatch *)*fCSRecognizers_size);
+    fMatches = new CharsetMatch[fCSRecognizers_size];
 
-    if (resultArray == NULL) {
+    if (resultArray == NULL || fMatches == NULL) {
         status = U_MEMORY_ALLOCATION_ERROR;
         return;
     }
-
-    for(int32_t i = 0; i < fCSRecognizers_size; i += 1) {
-        resultArray[i] = new CharsetMatch();
-
-        if (resultArray[i] == NULL) {
-            status = U_MEMORY_ALLOCATION_ERROR;
-            break;
-        }
-    }
 }
 
 CharsetDetector::~CharsetDetector()
 {
     delete textIn;
-
-    for(int32_t i = 0; i < fCSRecognizers_size; i += 1) {
-        delete resultArray[i];
-    }
-
+    delete[] fMatches;
     uprv_free(resultArray);
 
     if (fEnabledRecognizers) {
@@ -257,7 +252,8 @@ const CharsetMatch * const *CharsetDetector::detectAll(int32_t &maxMatchesFound,
         resultCount = 0;
         for (i = 0; i < fCSRecognizers_size; i += 1) {
             csr = fCSRecognizers[i]->recognizer;
-            if (csr->match(textIn, resultArray[resultCount])) {
+            if (csr->match(textIn, &fMatches[resultCount])) {
+                resultArray[resultCount] = &fMatches[resultCount];
                 resultCount++;
             }
         }
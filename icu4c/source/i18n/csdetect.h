@@ -26,7 +26,8 @@ class CharsetDetector : public UMemory
 {
 private:
     InputText *textIn;
-    CharsetMatch **resultArray;
+    CharsetMatch **resultArray;  // The matches in fMatches, sorted by confidence.
+    CharsetMatch *fMatches;
     int32_t resultCount;
     UBool fStripTags;   // If true, setText() will strip tags from input text.
     UBool fFreshTextSet;
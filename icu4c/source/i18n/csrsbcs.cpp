@@ -18,6 +18,10 @@
 #define N_GRAM_SIZE 3
 #define N_GRAM_MASK 0xFFFFFF
 
+// Hash table size for NGramCounts: a power of 2, at least twice
+// the number of n-grams in the 8kB of input text.
+#define N_GRAM_TABLE_SIZE 0x4000
+
 U_NAMESPACE_BEGIN
 
 NGramParser::NGramParser(const int32_t *theNgramList, const uint8_t *theCharMap)
@@ -120,13 +124,8 @@ void NGramParser::parseCharacters(InputText *det)
     }
 }
 
-int32_t NGramParser::parse(InputText *det)
+static int32_t ngramConfidence(int32_t hitCount, int32_t ngramCount)
 {
-    parseCharacters(det);
-
-    // TODO: Is this OK? The buffer could have ended in the middle of a word...
-    addByte(0x20);
-
     double rawPercent = (double) hitCount / (double) ngramCount;
 
     //            if (rawPercent <= 2.0) {
@@ -142,6 +141,124 @@ int32_t NGramParser::parse(InputText *det)
     return (int32_t) (rawPercent * 300.0);
 }
 
+int32_t NGramParser::parse(InputText *det)
+{
+    parseCharacters(det);
+
+    // TODO: Is this OK? The buffer could have ended in the middle of a word...
+    addByte(0x20);
+
+    return ngramConfidence(hitCount, ngramCount);
+}
+
+NGramCounts::NGramCounts(UErrorCode &status)
+ : charMap(NULL), keys(NULL), values(NULL), ngramCount(0)
+{
+    if (U_FAILURE(status)) {
+        return;
+    }
+
+    keys   = (int32_t *) uprv_malloc(N_GRAM_TABLE_SIZE * sizeof(int32_t));
+    values = (int32_t *) uprv_malloc(N_GRAM_TABLE_SIZE * sizeof(int32_t));
+
+    if (keys == NULL || values == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+    }
+}
+
+NGramCounts::~NGramCounts()
+{
+    uprv_free(keys);
+    uprv_free(values);
+}
+
+/*
+ * N-grams are never 0, because their last byte is not 0,
+ * so a key of 0 marks an empty slot.
+ */
+static inline int32_t ngramHash(int32_t ngram)
+{
+    return (int32_t) (((uint32_t) ngram * 0x9E3779B1u) >> 18) & (N_GRAM_TABLE_SIZE - 1);
+}
+
+void NGramCounts::add(int32_t thisNgram)
+{
+    ngramCount += 1;
+
+    int32_t i = ngramHash(thisNgram);
+    while (keys[i] != thisNgram) {
+        if (keys[i] == 0) {
+            keys[i]   = thisNgram;
+            values[i] = 0;
+            break;
+        }
+
+        i = (i + 1) & (N_GRAM_TABLE_SIZE - 1);
+    }
+
+    values[i] += 1;
+}
+
+int32_t NGramCounts::get(int32_t thisNgram) const
+{
+    int32_t i = ngramHash(thisNgram);
+    while (keys[i] != thisNgram) {
+        if (keys[i] == 0) {
+            return 0;
+        }
+
+        i = (i + 1) & (N_GRAM_TABLE_SIZE - 1);
+    }
+
+    return values[i];
+}
+
+void NGramCounts::count(InputText *det, const uint8_t *theCharMap)
+{
+    if (charMap == theCharMap) {
+        return;
+    }
+
+    charMap = theCharMap;
+    ngramCount = 0;
+    uprv_memset(keys, 0, N_GRAM_TABLE_SIZE * sizeof(int32_t));
+
+    // Same as NGramParser::parseCharacters() and parse().
+    const uint8_t *bytes = det->fInputBytes;
+    int32_t ngram = 0;
+    bool ignoreSpace = FALSE;
+
+    for (int32_t i = 0; i < det->fInputLen; i += 1) {
+        uint8_t mb = charMap[bytes[i]];
+
+        if (mb != 0) {
+            if (!(mb == 0x20 && ignoreSpace)) {
+                ngram = ((ngram << 8) + mb) & N_GRAM_MASK;
+                add(ngram);
+            }
+
+            ignoreSpace = (mb == 0x20);
+        }
+    }
+
+    ngram = ((ngram << 8) + 0x20) & N_GRAM_MASK;
+    add(ngram);
+}
+
+int32_t NGramCounts::score(const int32_t *ngramList) const
+{
+    // The lists have 64 n-grams, in ascending order.
+    int32_t hitCount = 0;
+
+    for (int32_t i = 0; i < 64; i += 1) {
+        if (i == 0 || ngramList[i] != ngramList[i - 1]) {
+            hitCount += get(ngramList[i]);
+        }
+    }
+
+    return ngramConfidence(hitCount, ngramCount);
+}
+
 #if !UCONFIG_ONLY_HTML_CONVERSION
 static const uint8_t unshapeMap_IBM420[] = {
 /*           -0    -1    -2    -3    -4    -5    -6    -7    -8    -9    -A    -B    -C    -D    -E    -F   */
@@ -253,12 +370,18 @@ CharsetRecog_sbcs::~CharsetRecog_sbcs()
 
 int32_t CharsetRecog_sbcs::match_sbcs(InputText *det, const int32_t ngrams[],  const uint8_t byteMap[]) const
 {
-    NGramParser parser(ngrams, byteMap);
-    int32_t result;
+    NGramCounts *counts = det->getNGramCounts();
 
-    result = parser.parse(det);
+    if (counts == NULL) {
+        // Out of memory: parse the text for just these n-grams.
+        NGramParser parser(ngrams, byteMap);
+        return parser.parse(det);
+    }
 
-    return result;
+    // Recognizers with the same byteMap share the counts.
+    counts->count(det, byteMap);
+
+    return counts->score(ngrams);
 }
 
 static const uint8_t charMap_8859_1[] = {
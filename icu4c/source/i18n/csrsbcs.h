@@ -53,6 +53,40 @@ class NGramParser : public UMemory
 
 };
 
+/*
+ * Counts of the n-grams in the input text, with its bytes mapped through a
+ * charMap the way NGramParser maps them.  Recognizers with the same charMap,
+ * like the languages of ISO-8859-1, share one pass over the text, and then
+ * only look up their own n-grams.
+ */
+class NGramCounts : public UMemory
+{
+public:
+    NGramCounts(UErrorCode &status);
+    ~NGramCounts();
+
+    /* Forgets the counts, for new input text. */
+    void reset() { charMap = NULL; }
+
+    /* Counts the n-grams of the text mapped through theCharMap, unless that is already done. */
+    void count(InputText *det, const uint8_t *theCharMap);
+
+    /* Returns the same confidence as NGramParser::parse() with ngramList. */
+    int32_t score(const int32_t *ngramList) const;
+
+private:
+    void add(int32_t thisNgram);
+    int32_t get(int32_t thisNgram) const;
+
+    const uint8_t *charMap;
+
+    // Hash table of the distinct n-grams and how often each occurs.
+    int32_t *keys;
+    int32_t *values;
+
+    int32_t ngramCount;
+};
+
 #if !UCONFIG_ONLY_HTML_CONVERSION
 class NGramParser_IBM420 : public NGramParser
 {
@@ -22,6 +22,9 @@
 #include "unicode/rbtz.h"
 #include "unicode/tzrule.h"
 
+#define INCLUDED_FROM_DANGICAL_CPP
+#include "dangical_data.h"
+
 // --- The cache --
 static icu::TimeZone *gDangiCalendarZoneAstroCalc = NULL;
 static icu::UInitOnce gDangiCalendarInitOnce = U_INITONCE_INITIALIZER;
@@ -52,7 +55,8 @@ U_NAMESPACE_BEGIN
 //-------------------------------------------------------------------------
 
 DangiCalendar::DangiCalendar(const Locale& aLocale, UErrorCode& success)
-:   ChineseCalendar(aLocale, DANGI_EPOCH_YEAR, getDangiCalZoneAstroCalc(), success)
+:   ChineseCalendar(aLocale, DANGI_EPOCH_YEAR, getDangiCalZoneAstroCalc(),
+                    &gDangiCalendarAstroTable, success)
 {
 }
 
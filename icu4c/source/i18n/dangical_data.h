@@ -0,0 +1,70 @@
+// © 2019 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+//
+// file name: dangical_data.h
+//
+// machine-generated from the astronomical calculations in chnsecal.cpp
+// (CalendarAstronomer) for the Dangi calendar's astronomical base zone.
+// See ChineseCalendarAstroTable in chnsecal.h for the format.
+
+
+#ifdef INCLUDED_FROM_DANGICAL_CPP
+
+static const int32_t gDangiCalendarNewMoonStarts[78]={
+-25626,-24681,-23736,-22791,-21846,-20902,-19956,-19011,-18066,-17121,
+-16176,-15231,-14287,-13341,-12396,-11452,-10506,-9561,-8616,-7672,
+-6726,-5781,-4837,-3891,-2946,-2002,-1057,-111,834,1778,
+2724,3669,4613,5558,6504,7448,8393,9339,10284,11228,
+12173,13119,14063,15008,15953,16898,17843,18788,19733,20678,
+21623,22568,23513,24458,25403,26348,27292,28238,29183,30128,
+31073,32018,32963,33907,34853,35798,36742,37688,38633,39578,
+40522,41468,42413,43357,44303,45248,46192,47137
+};
+
+static const uint32_t gDangiCalendarLongMonths[78]={
+0x5752b695,0xc9764aea,0xaaaad536,0x5d4ad655,0x25d92ba9,0xb29ba4bb,0x6d2ad555,0x96d4aea5,
+0xd26e92ec,0xad2b5956,0x5b52da95,0x49ba4bb2,0xb52ba93b,0x6d4ada95,0x26e92ea9,0xd4aea4ed,
+0xb54b6a96,0x9ba4daa5,0x52ba93b4,0xb54b6a57,0x6d955aaa,0x4aea4ed2,0xd52da95d,0xb5556aaa,
+0x2ba95b4a,0x64b72575,0xd5556a9b,0xaea56b2a,0x92dc95d4,0xd955d25d,0xb6956b2a,0x4bb25b52,
+0x69374976,0xd695b52b,0x2da96d4a,0xa4dd25d9,0xda95d4ad,0xb6a5ad4a,0x93749764,0x6a575276,
+0xdaaab54b,0x4dd26d54,0xa95d49da,0x5aa5d52d,0x574ab555,0xa5752769,0x6a96d4ae,0x5aaab555,
+0x95d4ada5,0xb25b92ba,0x6aaad64d,0x5752b695,0xc9764aea,0x6d2ae92e,0x5b4ab695,0x25d92da9,
+0xb49ba4bd,0x6d4ada95,0x96e4b6a5,0xd26e92ec,0xad4aea56,0x5b54d6a9,0x49ba4bb2,0xb52ba95b,
+0xad555aa5,0x26e936aa,0xd4aea4ed,0xb5556a96,0xaba55aaa,0x52ba95b4,0xb54bb257,0xad955aaa,
+0x4aea56d2,0xd92ec95e,0xb5556b2a,0x2ba95b4a,0x64bb2575,0x02957497
+};
+
+static const uint32_t gDangiCalendarNoMajorSolarTerm[78]={
+0x00000800,0x00002000,0x00020000,0x00100000,0x00020000,0x00200000,0x00800000,0x00200000,
+0x01000000,0x10000000,0x80000000,0x10000000,0x00000000,0x00000001,0x00000008,0x00000001,
+0x00000010,0x00000080,0x00000400,0x00000100,0x00000800,0x00004000,0x00001000,0x00008000,
+0x00040000,0x00400000,0x00080000,0x00400000,0x04000000,0x00800000,0x04000000,0x20000000,
+0x90000000,0x20000000,0x00000000,0x00000002,0x00000010,0x00000004,0x00000010,0x00000100,
+0x00000800,0x00000200,0x00001000,0x00008000,0x00004000,0x00008000,0x00080000,0x00400000,
+0x00080000,0x00800000,0x04000000,0x28800000,0x08000000,0x80000000,0x00000000,0x80000002,
+0x00000000,0x00000004,0x00000020,0x00000108,0x00000040,0x00000200,0x00002000,0x00000400,
+0x00002000,0x00020000,0x00004000,0x00020000,0x00100000,0x01000000,0x00200000,0x01000000,
+0x10000000,0x02000000,0x10000000,0x80000000,0x00000000,0x00000008
+};
+
+static const uint8_t gDangiCalendarWinterSolstices[201]={
+21,21,22,22,21,21,22,22,21,21,22,22,21,21,22,22,21,21,22,22,
+21,21,22,22,21,21,22,22,21,21,21,22,21,21,21,22,21,21,21,22,
+21,21,21,22,21,21,21,22,21,21,21,22,21,21,21,22,21,21,21,21,
+21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+21,21,21,21,21,21,21,21,21,21,21,21,20,21,21,21,20,21,21,21,
+20,21,21,21,20,21,21,21,20,21,21,21,20,21,21,21,20,21,21,21,
+20,21,21,21,20,20,21,21,20,20,21,21,20,20,21,21,20,20,21,21,
+20,20,21,21,20,20,21,21,20,20,21,21,20,20,21,21,20,20,20,21,
+20,20,20,21,20,20,20,21,20,20,20,21,20,20,20,21,20,20,20,21,
+20,20,20,21,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+21
+};
+
+static const icu::ChineseCalendarAstroTable gDangiCalendarAstroTable={
+  2491, 47905,
+  gDangiCalendarNewMoonStarts, gDangiCalendarLongMonths, gDangiCalendarNoMajorSolarTerm,
+  1900, 2100, gDangiCalendarWinterSolstices
+};
+
+#endif  // INCLUDED_FROM_DANGICAL_CPP
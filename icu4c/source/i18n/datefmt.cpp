@@ -29,6 +29,7 @@
 #include "unicode/dtptngen.h"
 #include "unicode/udisplaycontext.h"
 #include "reldtfmt.h"
+#include "fphdlimp.h"
 #include "sharedobject.h"
 #include "unifiedcache.h"
 #include "uarrsort.h"
@@ -279,6 +280,15 @@ DateFormat::format(Calendar& /* unused cal */,
 
 UnicodeString&
 DateFormat::format(UDate date, UnicodeString& appendTo, FieldPosition& fieldPosition) const {
+    const SimpleDateFormat *sdf = dynamic_cast<const SimpleDateFormat *>(this);
+    if (sdf != NULL) {
+        // Most SimpleDateFormat patterns are formatted without a Calendar clone.
+        UErrorCode ec = U_ZERO_ERROR;
+        FieldPositionOnlyHandler handler(fieldPosition);
+        if (sdf->formatWithFields(date, appendTo, handler, ec)) {
+            return appendTo;
+        }
+    }
     if (fCalendar != NULL) {
         // Use a clone of our calendar instance
         Calendar* calClone = fCalendar->clone();
@@ -299,6 +309,13 @@ DateFormat::format(UDate date, UnicodeString& appendTo, FieldPosition& fieldPosi
 UnicodeString&
 DateFormat::format(UDate date, UnicodeString& appendTo, FieldPositionIterator* posIter,
                    UErrorCode& status) const {
+    const SimpleDateFormat *sdf = dynamic_cast<const SimpleDateFormat *>(this);
+    if (sdf != NULL) {
+        FieldPositionIteratorHandler handler(posIter, status);
+        if (sdf->formatWithFields(date, appendTo, handler, status)) {
+            return appendTo;
+        }
+    }
     if (fCalendar != NULL) {
         Calendar* calClone = fCalendar->clone();
         if (calClone != NULL) {
@@ -330,6 +347,11 @@ DateFormat::parse(const UnicodeString& text,
                   ParsePosition& pos) const
 {
     UDate d = 0; // Error return UDate is 0 (the epoch)
+    const SimpleDateFormat *sdf = dynamic_cast<const SimpleDateFormat *>(this);
+    if (sdf != NULL && sdf->parseFixedNumeric(text, pos, d)) {
+        // Fixed-width numeric text is parsed without a Calendar clone.
+        return d;
+    }
     if (fCalendar != NULL) {
         Calendar* calClone = fCalendar->clone();
         if (calClone != NULL) {
@@ -14,6 +14,7 @@
 #include <stdlib.h>
 #include "unicode/errorcode.h"
 #include "unicode/decimfmt.h"
+#include "unicode/ustring.h"
 #include "number_decimalquantity.h"
 #include "number_types.h"
 #include "numparse_impl.h"
@@ -744,6 +745,73 @@ void DecimalFormat::parse(const UnicodeString& text, Formattable& output,
     }
 }
 
+namespace {
+
+/**
+ * Parses from the start of UTF-8 text and returns the number of bytes consumed,
+ * or 0 with U_INVALID_FORMAT_ERROR if nothing could be parsed.
+ */
+int32_t parseUTF8(const NumberParserImpl& parser, StringPiece text, ParsedNumber& result,
+                  UErrorCode& status) {
+    // The parser works on UTF-16. Fields in delimited text are usually short
+    // enough for the UnicodeString stack buffer, so this rarely allocates.
+    UnicodeString utf16 = UnicodeString::fromUTF8(text);
+    if (utf16.isEmpty()) {
+        status = U_INVALID_FORMAT_ERROR;
+        return 0;
+    }
+    parser.parse(utf16, 0, true, result, status);
+    if (U_FAILURE(status)) {
+        return 0;
+    }
+    if (!result.success()) {
+        status = U_INVALID_FORMAT_ERROR;
+        return 0;
+    }
+    // Convert the end index back from UTF-16 to UTF-8.
+    int32_t length = 0;
+    UErrorCode lengthStatus = U_ZERO_ERROR;
+    u_strToUTF8(nullptr, 0, &length, utf16.getBuffer(), result.charEnd, &lengthStatus);
+    return length;
+}
+
+} // namespace
+
+int32_t DecimalFormat::parseDouble(StringPiece text, double& result, UErrorCode& status) const {
+    if (U_FAILURE(status)) { return 0; }
+    if (fields == nullptr) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return 0;
+    }
+    const NumberParserImpl* parser = getParser(status);
+    if (U_FAILURE(status)) { return 0; }
+    ParsedNumber parsed;
+    int32_t length = parseUTF8(*parser, text, parsed, status);
+    if (U_FAILURE(status)) { return 0; }
+    result = parsed.getDouble(status);
+    return U_SUCCESS(status) ? length : 0;
+}
+
+int32_t DecimalFormat::parseInt64(StringPiece text, int64_t& result, UErrorCode& status) const {
+    if (U_FAILURE(status)) { return 0; }
+    if (fields == nullptr) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return 0;
+    }
+    const NumberParserImpl* parser = getParser(status);
+    if (U_FAILURE(status)) { return 0; }
+    ParsedNumber parsed;
+    int32_t length = parseUTF8(*parser, text, parsed, status);
+    if (U_FAILURE(status)) { return 0; }
+    if ((parsed.flags & (FLAG_NAN | FLAG_INFINITY)) != 0 || parsed.quantity.bogus ||
+            !parsed.quantity.fitsInLong()) {
+        status = U_INVALID_FORMAT_ERROR;
+        return 0;
+    }
+    result = parsed.quantity.toLong();
+    return length;
+}
+
 CurrencyAmount* DecimalFormat::parseCurrency(const UnicodeString& text, ParsePosition& parsePosition) const {
     if (fields == nullptr) {
         return nullptr;
@@ -27,6 +27,8 @@
 #include "cstring.h"
 #include "dtitv_impl.h"
 #include "mutex.h"
+#include "sharedobject.h"
+#include "unifiedcache.h"
 #include "uresimp.h"
 #include "formattedval_impl.h"
 
@@ -91,6 +93,83 @@ DateIntervalFormat::createInstance(const UnicodeString& skeleton,
 }
 
 
+/**
+ * A DateIntervalFormat with its interval patterns resolved for one locale and skeleton,
+ * kept in the UnifiedCache. It is only ever cloned.
+ */
+class SharedDateIntervalFormat : public SharedObject {
+public:
+    SharedDateIntervalFormat(DateIntervalFormat *dtitvfmtToAdopt) : ptr(dtitvfmtToAdopt) { }
+    virtual ~SharedDateIntervalFormat();
+    const DateIntervalFormat *get() const { return ptr; }
+private:
+    DateIntervalFormat *ptr;
+    SharedDateIntervalFormat(const SharedDateIntervalFormat &);
+    SharedDateIntervalFormat &operator=(const SharedDateIntervalFormat &);
+};
+
+SharedDateIntervalFormat::~SharedDateIntervalFormat() {
+    delete ptr;
+}
+
+template<> U_I18N_API
+const SharedDateIntervalFormat *LocaleCacheKey<SharedDateIntervalFormat>::createObject(
+        const void * /*creationContext*/, UErrorCode &status) const {
+    status = U_UNSUPPORTED_ERROR;
+    return NULL;
+}
+
+class U_I18N_API DateIntervalFormatKey : public LocaleCacheKey<SharedDateIntervalFormat> {
+private:
+    UnicodeString fSkeleton;
+public:
+    DateIntervalFormatKey(const Locale &loc, const UnicodeString &skeleton)
+            : LocaleCacheKey<SharedDateIntervalFormat>(loc), fSkeleton(skeleton) { }
+    DateIntervalFormatKey(const DateIntervalFormatKey &other) :
+            LocaleCacheKey<SharedDateIntervalFormat>(other),
+            fSkeleton(other.fSkeleton) { }
+    virtual ~DateIntervalFormatKey();
+    virtual int32_t hashCode() const {
+        return (int32_t)(37u * (uint32_t)LocaleCacheKey<SharedDateIntervalFormat>::hashCode() + (uint32_t)fSkeleton.hashCode());
+    }
+    virtual UBool operator==(const CacheKeyBase &other) const {
+       if (this == &other) {
+           return TRUE;
+       }
+       if (!LocaleCacheKey<SharedDateIntervalFormat>::operator==(other)) {
+           return FALSE;
+       }
+       // We know that this and other are of same class if we get this far.
+       const DateIntervalFormatKey &realOther =
+               static_cast<const DateIntervalFormatKey &>(other);
+       return (realOther.fSkeleton == fSkeleton);
+    }
+    virtual CacheKeyBase *clone() const {
+        return new DateIntervalFormatKey(*this);
+    }
+    virtual const SharedDateIntervalFormat *createObject(
+            const void * /*unused*/, UErrorCode &status) const {
+        DateIntervalInfo* dtitvinf = new DateIntervalInfo(fLoc, status);
+        LocalPointer<DateIntervalFormat> dtitvfmt(
+                DateIntervalFormat::create(fLoc, dtitvinf, &fSkeleton, status), status);
+        if (U_FAILURE(status)) {
+            return NULL;
+        }
+        LocalPointer<SharedDateIntervalFormat> shared(
+                new SharedDateIntervalFormat(dtitvfmt.getAlias()), status);
+        if (U_FAILURE(status)) {
+            return NULL;
+        }
+        dtitvfmt.orphan();
+        SharedDateIntervalFormat *result = shared.orphan();
+        result->addRef();
+        return result;
+    }
+};
+
+DateIntervalFormatKey::~DateIntervalFormatKey() { }
+
+
 DateIntervalFormat* U_EXPORT2
 DateIntervalFormat::createInstance(const UnicodeString& skeleton,
                                    const Locale& locale,
@@ -107,8 +186,29 @@ DateIntervalFormat::createInstance(const UnicodeString& skeleton,
     PRINTMESG(mesg)
 #endif
 
-    DateIntervalInfo* dtitvinf = new DateIntervalInfo(locale, status);
-    return create(locale, dtitvinf, &skeleton, status);
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    // Loading the interval patterns and matching the skeleton is much slower
+    // than cloning a formatter that has done so.
+    const UnifiedCache *cache = UnifiedCache::getInstance(status);
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    const SharedDateIntervalFormat *shared = NULL;
+    cache->get(DateIntervalFormatKey(locale, skeleton), shared, status);
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    LocalPointer<DateIntervalFormat> f(static_cast<DateIntervalFormat *>(shared->get()->clone()), status);
+    shared->removeRef();
+    // The cached formatter has the default time zone from when it was created.
+    LocalPointer<TimeZone> zone(TimeZone::createDefault(), status);
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    f->adoptTimeZone(zone.orphan());
+    return f.orphan();
 }
 
 
@@ -42,6 +42,7 @@
 #include "ucln_in.h"
 #include "charstr.h"
 #include "uassert.h"
+#include "unifiedcache.h"
 
 #if U_CHARSET_FAMILY==U_EBCDIC_FAMILY
 /**
@@ -301,14 +302,88 @@ DateTimePatternGenerator::createInstance(UErrorCode& status) {
     return createInstance(Locale::getDefault(), status);
 }
 
+static UMutex gBestPatternsMutex;
+
+SharedDateTimePatternGenerator::SharedDateTimePatternGenerator(const Locale &locale, UErrorCode &status)
+        : ptr(nullptr), bestPatterns(status) {
+    if (U_FAILURE(status)) {
+        return;
+    }
+    bestPatterns.setValueDeleter(uprv_deleteUObject);
+    LocalPointer<DateTimePatternGenerator> dtpg(new DateTimePatternGenerator(locale, status), status);
+    if (U_SUCCESS(status)) {
+        ptr = dtpg.orphan();
+    }
+}
+
+SharedDateTimePatternGenerator::~SharedDateTimePatternGenerator() {
+    delete ptr;
+}
+
+UBool
+SharedDateTimePatternGenerator::getBestPattern(const UnicodeString &key, UnicodeString &pattern) const {
+    Mutex lock(&gBestPatternsMutex);
+    const UnicodeString *value = static_cast<const UnicodeString *>(bestPatterns.get(key));
+    if (value == nullptr) {
+        return FALSE;
+    }
+    pattern = *value;
+    return TRUE;
+}
+
+void
+SharedDateTimePatternGenerator::putBestPattern(const UnicodeString &key, const UnicodeString &pattern) const {
+    Mutex lock(&gBestPatternsMutex);
+    if (bestPatterns.count() >= MAX_BEST_PATTERNS || bestPatterns.get(key) != nullptr) {
+        return;
+    }
+    UnicodeString *value = new UnicodeString(pattern);
+    if (value == nullptr) {
+        return;
+    }
+    UErrorCode status = U_ZERO_ERROR;
+    bestPatterns.put(key, value, status);  // deletes value on failure
+}
+
+UnicodeString
+SharedDateTimePatternGenerator::bestPatternKey(const UnicodeString &skeleton, UDateTimePatternMatchOptions options) {
+    // The options are a mask of UDATPG_FIELD_COUNT (16) bits.
+    UnicodeString key((UChar)options);
+    return key.append(skeleton);
+}
+
+template<> U_I18N_API
+const SharedDateTimePatternGenerator *LocaleCacheKey<SharedDateTimePatternGenerator>::createObject(
+        const void * /*unusedCreationContext*/, UErrorCode &status) const {
+    LocalPointer<SharedDateTimePatternGenerator> shared(
+            new SharedDateTimePatternGenerator(fLoc, status), status);
+    if (U_FAILURE(status)) {
+        return nullptr;
+    }
+    SharedDateTimePatternGenerator *result = shared.orphan();
+    result->addRef();
+    return result;
+}
+
 DateTimePatternGenerator* U_EXPORT2
 DateTimePatternGenerator::createInstance(const Locale& locale, UErrorCode& status) {
     if (U_FAILURE(status)) {
         return nullptr;
     }
-    LocalPointer<DateTimePatternGenerator> result(
-            new DateTimePatternGenerator(locale, status), status);
-    return U_SUCCESS(status) ? result.orphan() : nullptr;
+    // Loading and processing the locale data is much slower than copying the result.
+    const SharedDateTimePatternGenerator *shared = nullptr;
+    UnifiedCache::getByLocale(locale, shared, status);
+    if (U_FAILURE(status)) {
+        return nullptr;
+    }
+    LocalPointer<DateTimePatternGenerator> result(shared->get()->clone(), status);
+    if (U_FAILURE(status)) {
+        shared->removeRef();
+        return nullptr;
+    }
+    // The clone takes over the reference from the cache.
+    result->fSharedData = shared;
+    return result.orphan();
 }
 
 DateTimePatternGenerator*  U_EXPORT2
@@ -324,7 +399,8 @@ DateTimePatternGenerator::createEmptyInstance(UErrorCode& status) {
 DateTimePatternGenerator::DateTimePatternGenerator(UErrorCode &status) :
     skipMatcher(nullptr),
     fAvailableFormatKeyHash(nullptr),
-    internalErrorCode(U_ZERO_ERROR)
+    internalErrorCode(U_ZERO_ERROR),
+    fSharedData(nullptr)
 {
     fp = new FormatParser();
     dtMatcher = new DateTimeMatcher();
@@ -338,7 +414,8 @@ DateTimePatternGenerator::DateTimePatternGenerator(UErrorCode &status) :
 DateTimePatternGenerator::DateTimePatternGenerator(const Locale& locale, UErrorCode &status) :
     skipMatcher(nullptr),
     fAvailableFormatKeyHash(nullptr),
-    internalErrorCode(U_ZERO_ERROR)
+    internalErrorCode(U_ZERO_ERROR),
+    fSharedData(nullptr)
 {
     fp = new FormatParser();
     dtMatcher = new DateTimeMatcher();
@@ -356,7 +433,8 @@ DateTimePatternGenerator::DateTimePatternGenerator(const DateTimePatternGenerato
     UObject(),
     skipMatcher(nullptr),
     fAvailableFormatKeyHash(nullptr),
-    internalErrorCode(U_ZERO_ERROR)
+    internalErrorCode(U_ZERO_ERROR),
+    fSharedData(nullptr)
 {
     fp = new FormatParser();
     dtMatcher = new DateTimeMatcher();
@@ -405,8 +483,11 @@ DateTimePatternGenerator::operator=(const DateTimePatternGenerator& other) {
             fieldDisplayNames[i][j].getTerminatedBuffer(); // NUL-terminate for the C API.
         }
     }
+    uprv_memcpy(fAllowedHourFormats, other.fAllowedHourFormats, sizeof(fAllowedHourFormats));
     patternMap->copyFrom(*other.patternMap, internalErrorCode);
     copyHashtable(other.fAvailableFormatKeyHash, internalErrorCode);
+    // A clone of the cached generator keeps sharing its memo of best patterns.
+    SharedObject::copyPtr(other.fSharedData, fSharedData);
     return *this;
 }
 
@@ -450,6 +531,7 @@ DateTimePatternGenerator::~DateTimePatternGenerator() {
     if (distanceInfo != nullptr) delete distanceInfo;
     if (patternMap != nullptr) delete patternMap;
     if (skipMatcher != nullptr) delete skipMatcher;
+    SharedObject::clearPtr(fSharedData);
 }
 
 namespace {
@@ -1048,6 +1130,7 @@ DateTimePatternGenerator::initHashtable(UErrorCode& err) {
 
 void
 DateTimePatternGenerator::setAppendItemFormat(UDateTimePatternField field, const UnicodeString& value) {
+    SharedObject::clearPtr(fSharedData);
     appendItemFormats[field] = value;
     // NUL-terminate for the C API.
     appendItemFormats[field].getTerminatedBuffer();
@@ -1070,6 +1153,7 @@ DateTimePatternGenerator::getAppendItemName(UDateTimePatternField field) const {
 
 void
 DateTimePatternGenerator::setFieldDisplayName(UDateTimePatternField field, UDateTimePGDisplayWidth width, const UnicodeString& value) {
+    SharedObject::clearPtr(fSharedData);
     fieldDisplayNames[field][width] = value;
     // NUL-terminate for the C API.
     fieldDisplayNames[field][width].getTerminatedBuffer();
@@ -1106,6 +1190,23 @@ DateTimePatternGenerator::getBestPattern(const UnicodeString& patternForm, UDate
         status = internalErrorCode;
         return UnicodeString();
     }
+    UnicodeString memoKey;
+    if (fSharedData != nullptr) {
+        UnicodeString memoized;
+        memoKey = SharedDateTimePatternGenerator::bestPatternKey(patternForm, options);
+        if (fSharedData->getBestPattern(memoKey, memoized)) {
+            return memoized;
+        }
+    }
+    UnicodeString result = getBestPatternImpl(patternForm, options, status);
+    if (fSharedData != nullptr && U_SUCCESS(status)) {
+        fSharedData->putBestPattern(memoKey, result);
+    }
+    return result;
+}
+
+UnicodeString
+DateTimePatternGenerator::getBestPatternImpl(const UnicodeString& patternForm, UDateTimePatternMatchOptions options, UErrorCode& status) {
     const UnicodeString *bestPattern = nullptr;
     UnicodeString dtFormat;
     UnicodeString resultPattern;
@@ -1263,6 +1364,7 @@ DateTimePatternGenerator::replaceFieldTypes(const UnicodeString& pattern,
 
 void
 DateTimePatternGenerator::setDecimal(const UnicodeString& newDecimal) {
+    SharedObject::clearPtr(fSharedData);
     this->decimal = newDecimal;
     // NUL-terminate for the C API.
     this->decimal.getTerminatedBuffer();
@@ -1288,6 +1390,7 @@ DateTimePatternGenerator::addCanonicalItems(UErrorCode& status) {
 
 void
 DateTimePatternGenerator::setDateTimeFormat(const UnicodeString& dtFormat) {
+    SharedObject::clearPtr(fSharedData);
     dateTimeFormat = dtFormat;
     // NUL-terminate for the C API.
     dateTimeFormat.getTerminatedBuffer();
@@ -1388,6 +1491,8 @@ DateTimePatternGenerator::addPatternWithSkeleton(
         return UDATPG_NO_CONFLICT;
     }
 
+    SharedObject::clearPtr(fSharedData);
+
     UnicodeString basePattern;
     PtnSkeleton   skeleton;
     UDateTimePatternConflict conflictingStatus = UDATPG_NO_CONFLICT;
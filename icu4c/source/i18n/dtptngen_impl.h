@@ -16,8 +16,11 @@
 
 #include "unicode/udatpg.h"
 
+#include "unicode/dtptngen.h"
 #include "unicode/strenum.h"
 #include "unicode/unistr.h"
+#include "hash.h"
+#include "sharedobject.h"
 #include "uvector.h"
 
 // TODO(claireho): Split off Builder class.
@@ -304,6 +307,38 @@ class DTRedundantEnumeration : public StringEnumeration {
     LocalPointer<UVector> fPatterns;
 };
 
+/**
+ * A fully initialized DateTimePatternGenerator for one locale, kept in the UnifiedCache.
+ * createInstance() clones it, and the clones share a memo of getBestPattern() results
+ * until one of them is modified.
+ */
+class SharedDateTimePatternGenerator : public SharedObject {
+public:
+    SharedDateTimePatternGenerator(const Locale &locale, UErrorCode &status);
+    virtual ~SharedDateTimePatternGenerator();
+    const DateTimePatternGenerator *get() const { return ptr; }
+
+    /**
+     * Looks up a memoized best pattern for the key made by bestPatternKey().
+     * @return TRUE if found
+     */
+    UBool getBestPattern(const UnicodeString &key, UnicodeString &pattern) const;
+    /** Memoizes a best pattern, unless the memo is full. */
+    void putBestPattern(const UnicodeString &key, const UnicodeString &pattern) const;
+    static UnicodeString bestPatternKey(const UnicodeString &skeleton, UDateTimePatternMatchOptions options);
+
+private:
+    /** Callers usually ask for the same few skeletons, so the memo need not grow without bound. */
+    static const int32_t MAX_BEST_PATTERNS = 256;
+
+    DateTimePatternGenerator *ptr;
+    // Maps bestPatternKey() to a UnicodeString *. Guarded by a mutex in dtptngen.cpp.
+    mutable Hashtable bestPatterns;
+
+    SharedDateTimePatternGenerator(const SharedDateTimePatternGenerator &);
+    SharedDateTimePatternGenerator &operator=(const SharedDateTimePatternGenerator &);
+};
+
 U_NAMESPACE_END
 
 #endif
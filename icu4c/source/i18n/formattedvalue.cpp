@@ -67,6 +67,14 @@ void ConstrainedFieldPosition::setState(
 
 FormattedValue::~FormattedValue() = default;
 
+void FormattedValue::appendToUTF8(ByteSink& sink, UErrorCode& status) const {
+    UnicodeString s = toTempString(status);
+    if (U_FAILURE(status)) {
+        return;
+    }
+    s.toUTF8(sink);
+}
+
 
 ///////////////////////
 /// C API FUNCTIONS ///
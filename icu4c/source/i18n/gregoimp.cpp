@@ -20,6 +20,8 @@
 #include "cstring.h"
 #include "uassert.h"
 
+#include <atomic>
+
 U_NAMESPACE_BEGIN
 
 int32_t ClockMath::floorDivide(int32_t numerator, int32_t denominator) {
@@ -96,8 +98,57 @@ double Grego::fieldsToDay(int32_t year, int32_t month, int32_t dom) {
     return julian - JULIAN_1970_CE; // JD => epoch day
 }
 
+#if defined(ATOMIC_LLONG_LOCK_FREE) && ATOMIC_LLONG_LOCK_FREE == 2
+#define GREGO_DAY_CACHE 1
+
+namespace {
+
+// Timestamp-heavy code converts the same few days over and over.
+// Recently converted days are kept in a small direct-mapped cache,
+// indexed by the low bits of the day number. Each entry packs one day and its
+// fields into a single 64-bit word, so that threads can share the cache
+// without locking; a torn or stale entry simply does not match.
+//
+// Bits 62..38: day - kMinCachedDay (25 bits)
+// Bits 37..22: year (16 bits)
+// Bits 21..18: month
+// Bits 17..13: dom
+// Bits 12..10: dow
+// Bits  9..1:  doy
+// Bit      0:  1 if the entry is in use
+constexpr int32_t kMinCachedDay = -719162;  // 0001-01-01
+constexpr int32_t kMaxCachedDay = kMinCachedDay + (1 << 25) - 1;
+constexpr int32_t kMaxCachedYear = 0xffff;  // Later days are converted but not stored.
+constexpr int32_t kDayCacheSize = 16;
+
+std::atomic<uint64_t> gDayCache[kDayCacheSize];
+
+}  // namespace
+
+#endif  // ATOMIC_LLONG_LOCK_FREE
+
 void Grego::dayToFields(double day, int32_t& year, int32_t& month,
                         int32_t& dom, int32_t& dow, int32_t& doy) {
+#ifdef GREGO_DAY_CACHE
+    std::atomic<uint64_t> *cacheEntry = nullptr;
+    uint64_t cacheKey = 0;
+    if (kMinCachedDay <= day && day <= kMaxCachedDay) {
+        int32_t intDay = (int32_t)day;
+        if (intDay == day) {
+            cacheEntry = &gDayCache[intDay & (kDayCacheSize - 1)];
+            cacheKey = ((uint64_t)(intDay - kMinCachedDay) << 38) | 1;
+            uint64_t entry = cacheEntry->load(std::memory_order_relaxed);
+            if ((entry & ~(((uint64_t)1 << 38) - 2)) == cacheKey) {
+                year = (int32_t)(entry >> 22) & 0xffff;
+                month = (int32_t)(entry >> 18) & 0xf;
+                dom = (int32_t)(entry >> 13) & 0x1f;
+                dow = (int32_t)(entry >> 10) & 7;
+                doy = (int32_t)(entry >> 1) & 0x1ff;
+                return;
+            }
+        }
+    }
+#endif
 
     // Convert from 1970 CE epoch to 1 CE epoch (Gregorian calendar)
     day += JULIAN_1970_CE - JULIAN_1_CE;
@@ -132,6 +183,14 @@ void Grego::dayToFields(double day, int32_t& year, int32_t& month,
     month = (12 * (doy + correction) + 6) / 367; // zero-based month
     dom = doy - DAYS_BEFORE[month + (isLeap ? 12 : 0)] + 1; // one-based DOM
     doy++; // one-based doy
+
+#ifdef GREGO_DAY_CACHE
+    if (cacheEntry != nullptr && year <= kMaxCachedYear) {
+        cacheEntry->store(cacheKey | ((uint64_t)year << 22) | ((uint64_t)month << 18) |
+                              ((uint64_t)dom << 13) | ((uint64_t)dow << 10) | ((uint64_t)doy << 1),
+                          std::memory_order_relaxed);
+    }
+#endif
 }
 
 void Grego::timeToFields(UDate time, int32_t& year, int32_t& month,
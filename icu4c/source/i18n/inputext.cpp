@@ -12,6 +12,7 @@
 #if !UCONFIG_NO_CONVERSION
 
 #include "inputext.h"
+#include "csrsbcs.h"
 
 #include "cmemory.h"
 #include "cstring.h"
@@ -25,25 +26,24 @@ U_NAMESPACE_BEGIN
 #define NEW_ARRAY(type,count) (type *) uprv_malloc((count) * sizeof(type))
 #define DELETE_ARRAY(array) uprv_free((void *) (array))
 
-InputText::InputText(UErrorCode &status)
-    : fInputBytes(NEW_ARRAY(uint8_t, BUFFER_SIZE)), // The text to be checked.  Markup will have been
-                                                 //   removed if appropriate.
-      fByteStats(NEW_ARRAY(int16_t, 256)),       // byte frequency statistics for the input text.
-                                                 //   Value is percent, not absolute.
+InputText::InputText(UErrorCode & /*status*/)
+    : fInputBytes(0),
+      fInputLen(0),
+      fC1Bytes(FALSE),
       fDeclaredEncoding(0),
       fRawInput(0),
-      fRawLength(0)
+      fRawLength(0),
+      fStripBuffer(0),   // Allocated on first use, for the input with markup removed.
+      fDeclaredEncodingCapacity(0),
+      fNGramCounts(NULL)
 {
-    if (fInputBytes == NULL || fByteStats == NULL) {
-        status = U_MEMORY_ALLOCATION_ERROR;
-    }
 }
 
 InputText::~InputText()
 {
+    delete fNGramCounts;
     DELETE_ARRAY(fDeclaredEncoding);
-    DELETE_ARRAY(fByteStats);
-    DELETE_ARRAY(fInputBytes);
+    DELETE_ARRAY(fStripBuffer);
 }
 
 void InputText::setText(const char *in, int32_t len)
@@ -62,9 +62,15 @@ void InputText::setDeclaredEncoding(const char* encoding, int32_t len)
         }
 
         len += 1;     // to make place for the \0 at the end.
-        uprv_free(fDeclaredEncoding);
-        fDeclaredEncoding = NEW_ARRAY(char, len);
-        uprv_strncpy(fDeclaredEncoding, encoding, len);
+        if (len > fDeclaredEncodingCapacity) {
+            // Keep the buffer for later texts, unless it is too small.
+            uprv_free(fDeclaredEncoding);
+            fDeclaredEncoding = NEW_ARRAY(char, len);
+            fDeclaredEncodingCapacity = fDeclaredEncoding != NULL ? len : 0;
+        }
+        if (fDeclaredEncoding != NULL) {
+            uprv_strncpy(fDeclaredEncoding, encoding, len);
+        }
     }
 }
 
@@ -94,7 +100,11 @@ void InputText::MungeInput(UBool fStripTags) {
     //     Count how many total '<' and illegal (nested) '<' occur, so we can make some
     //     guess as to whether the input was actually marked up at all.
     // TODO: Think about how this interacts with EBCDIC charsets that are detected.
-    if (fStripTags) {
+    if (fStripTags && fStripBuffer == NULL) {
+        fStripBuffer = NEW_ARRAY(uint8_t, BUFFER_SIZE);
+    }
+
+    if (fStripTags && fStripBuffer != NULL) {
         for (srci = 0; srci < fRawLength && dsti < BUFFER_SIZE; srci += 1) {
             b = fRawInput[srci];
 
@@ -108,7 +118,7 @@ void InputText::MungeInput(UBool fStripTags) {
             }
 
             if (! inMarkup) {
-                fInputBytes[dsti++] = b;
+                fStripBuffer[dsti++] = b;
             }
 
             if (b == (uint8_t)0x3E) { /* Check for the ASCII '>' */
@@ -116,13 +126,15 @@ void InputText::MungeInput(UBool fStripTags) {
             }
         }
 
+        fInputBytes = fStripBuffer;
         fInputLen = dsti;
     }
 
     //
     //  If it looks like this input wasn't marked up, or if it looks like it's
     //    essentially nothing but markup abandon the markup stripping.
-    //    Detection will have to work on the unstripped input.
+    //    Detection will have to work on the unstripped input,
+    //    which is used in place rather than copied.
     //
     if (openTags<5 || openTags/5 < badTags || 
         (fInputLen < 100 && fRawLength>600))
@@ -133,11 +145,12 @@ void InputText::MungeInput(UBool fStripTags) {
             limit = BUFFER_SIZE;
         }
 
-        for (srci=0; srci<limit; srci++) {
-            fInputBytes[srci] = fRawInput[srci];
-        }
+        fInputBytes = fRawInput;
+        fInputLen = limit;
+    }
 
-        fInputLen = srci;
+    if (fNGramCounts != NULL) {
+        fNGramCounts->reset();
     }
 
     //
@@ -159,6 +172,20 @@ void InputText::MungeInput(UBool fStripTags) {
     }
 }
 
+NGramCounts *InputText::getNGramCounts()
+{
+    if (fNGramCounts == NULL) {
+        UErrorCode status = U_ZERO_ERROR;
+        fNGramCounts = new NGramCounts(status);
+        if (U_FAILURE(status)) {
+            delete fNGramCounts;
+            fNGramCounts = NULL;
+        }
+    }
+
+    return fNGramCounts;
+}
+
 U_NAMESPACE_END
 #endif
 
@@ -25,6 +25,8 @@
 
 U_NAMESPACE_BEGIN 
 
+class NGramCounts;
+
 class InputText : public UMemory
 {
     // Prevent copying
@@ -38,14 +40,19 @@ class InputText : public UMemory
     UBool isSet() const; 
     void MungeInput(UBool fStripTags);
 
+    // The n-gram counts shared by the single byte recognizers,
+    //   or NULL if they cannot be allocated.
+    NGramCounts *getNGramCounts();
+
     // The text to be checked.  Markup will have been
-    //   removed if appropriate.
-    uint8_t    *fInputBytes;
+    //   removed if appropriate.  Points into fRawInput
+    //   if no markup was removed.
+    const uint8_t *fInputBytes;
     int32_t     fInputLen;          // Length of the byte data in fInputBytes.
     // byte frequency statistics for the input text.
     //   Value is percent, not absolute.
     //   Value is rounded up, so zero really means zero occurences. 
-    int16_t  *fByteStats;
+    int16_t   fByteStats[256];
     UBool     fC1Bytes;          // True if any bytes in the range 0x80 - 0x9F are in the input;false by default
     char     *fDeclaredEncoding;
 
@@ -55,6 +62,10 @@ class InputText : public UMemory
     //   buffer here.
     int32_t                  fRawLength;    // Length of data in fRawInput array.
 
+private:
+    uint8_t                 *fStripBuffer;  // The input with markup removed.
+    int32_t                  fDeclaredEncodingCapacity;
+    NGramCounts             *fNGramCounts;  // Created by getNGramCounts().
 };
 
 U_NAMESPACE_END
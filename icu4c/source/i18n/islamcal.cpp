@@ -54,15 +54,12 @@ static void debug_islamcal_msg(const char *pat, ...)
 
 // --- The cache --
 // cache of months
-static icu::CalendarCache *gMonthCache = NULL;
+static icu::CalendarCache gMonthCache;
 static icu::CalendarAstronomer *gIslamicCalendarAstro = NULL;
 
 U_CDECL_BEGIN
 static UBool calendar_islamic_cleanup(void) {
-    if (gMonthCache) {
-        delete gMonthCache;
-        gMonthCache = NULL;
-    }
+    gMonthCache.clear();
     if (gIslamicCalendarAstro) {
         delete gIslamicCalendarAstro;
         gIslamicCalendarAstro = NULL;
@@ -414,7 +411,7 @@ int32_t IslamicCalendar::monthStart(int32_t year, int32_t month) const {
 int32_t IslamicCalendar::trueMonthStart(int32_t month) const
 {
     UErrorCode status = U_ZERO_ERROR;
-    int32_t start = CalendarCache::get(&gMonthCache, month, status);
+    int32_t start = gMonthCache.get(month);
 
     if (start==0) {
         // Make a guess at when the month started, using the average length
@@ -448,7 +445,7 @@ int32_t IslamicCalendar::trueMonthStart(int32_t month) const
             } while (age < 0);
         }
         start = (int32_t)ClockMath::floorDivide((origin - HIJRA_MILLIS), (double)kOneDay) + 1;
-        CalendarCache::put(&gMonthCache, month, start, status);
+        gMonthCache.put(month, start);
     }
 trueMonthStartEnd :
     if(U_FAILURE(status)) {
@@ -650,23 +647,26 @@ void IslamicCalendar::handleComputeFields(int32_t julianDay, UErrorCode &status)
                 month = month<11?month:11;
                 startDate = monthStart(year, month);
             }else{
-                int y =UMALQURA_YEAR_START-1, m =0;
-                long d = 1;
-                while(d > 0){ 
-                    y++; 
-                    d = days - yearStart(y) +1;
-                    if(d == handleGetYearLength(y)){
-                        m=11;
-                        break;
-                    }else if(d < handleGetYearLength(y) ){
-                        int monthLen = handleGetMonthLength(y, m); 
-                        m=0;
-                        while(d > monthLen){
-                            d -= monthLen;
-                            m++;
-                            monthLen = handleGetMonthLength(y, m);
-                        }
-                        break;
+                // Estimate the year from the average year length, then find the
+                // first year that ends after the date.
+                int32_t y = UMALQURA_YEAR_START + (int32_t)((days - umalquraStartdays) / 354.36720);
+                if (y < UMALQURA_YEAR_START) {
+                    y = UMALQURA_YEAR_START;
+                }
+                while (y > UMALQURA_YEAR_START && days < yearStart(y - 1) + handleGetYearLength(y - 1)) {
+                    --y;
+                }
+                while (days >= yearStart(y) + handleGetYearLength(y)) {
+                    ++y;
+                }
+                int32_t d = days - yearStart(y) + 1;
+                int32_t m = 0;
+                if (d > 0) {
+                    int32_t monthLen = handleGetMonthLength(y, m);
+                    while (d > monthLen) {
+                        d -= monthLen;
+                        m++;
+                        monthLen = handleGetMonthLength(y, m);
                     }
                 }
                 year = y;
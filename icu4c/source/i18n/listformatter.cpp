@@ -22,24 +22,65 @@
 #include "unicode/simpleformatter.h"
 #include "unicode/ulistformatter.h"
 #include "fphdlimp.h"
-#include "mutex.h"
-#include "hash.h"
 #include "cstring.h"
 #include "uarrsort.h"
 #include "ulocimp.h"
 #include "charstr.h"
-#include "ucln_in.h"
 #include "uresimp.h"
 #include "resource.h"
 #include "formattedval_impl.h"
+#include "sharedobject.h"
+#include "unifiedcache.h"
 
 U_NAMESPACE_BEGIN
 
-struct ListFormatInternal : public UMemory {
+/**
+ * A list pattern with both of its arguments removed, so that a list can be
+ * formatted in a single pass instead of by repeated substitution.
+ * The pattern joins the list formatted so far ({0}) with the next item ({1}).
+ */
+struct ListPatternParts : public UMemory {
+    UnicodeString text;
+    int32_t firstOffset;   // where {0} was in the pattern, or -1 if not split
+    int32_t secondOffset;  // where {1} was in the pattern
+
+    ListPatternParts() : firstOffset(-1), secondOffset(-1) {}
+
+    /** Returns FALSE if the pattern does not contain each argument exactly once. */
+    UBool init(const SimpleFormatter &pattern, UErrorCode &errorCode);
+};
+
+UBool ListPatternParts::init(const SimpleFormatter &pattern, UErrorCode &errorCode) {
+    firstOffset = secondOffset = -1;
+    if (U_FAILURE(errorCode) || pattern.getArgumentLimit() != 2) {
+        return FALSE;
+    }
+    int32_t offsets[2];
+    text = pattern.getTextWithNoArguments(offsets, UPRV_LENGTHOF(offsets));
+    if (offsets[0] < 0 || offsets[1] < 0) {
+        return FALSE;
+    }
+    // getTextWithNoArguments() reports only the last occurrence of each argument.
+    UnicodeString formatted;
+    pattern.format(UnicodeString((UChar)0x30), UnicodeString((UChar)0x31), formatted, errorCode);
+    if (U_FAILURE(errorCode) || formatted.length() != text.length() + 2) {
+        return FALSE;
+    }
+    firstOffset = offsets[0];
+    secondOffset = offsets[1];
+    return TRUE;
+}
+
+struct ListFormatInternal : public SharedObject {
     SimpleFormatter twoPattern;
     SimpleFormatter startPattern;
     SimpleFormatter middlePattern;
     SimpleFormatter endPattern;
+    ListPatternParts twoParts;
+    ListPatternParts startParts;
+    ListPatternParts middleParts;
+    ListPatternParts endParts;
+    UBool singlePass;
 
 ListFormatInternal(
         const UnicodeString& two,
@@ -50,21 +91,54 @@ ListFormatInternal(
         twoPattern(two, 2, 2, errorCode),
         startPattern(start, 2, 2, errorCode),
         middlePattern(middle, 2, 2, errorCode),
-        endPattern(end, 2, 2, errorCode) {}
+        endPattern(end, 2, 2, errorCode) {
+    initParts(errorCode);
+}
 
 ListFormatInternal(const ListFormatData &data, UErrorCode &errorCode) :
         twoPattern(data.twoPattern, errorCode),
         startPattern(data.startPattern, errorCode),
         middlePattern(data.middlePattern, errorCode),
-        endPattern(data.endPattern, errorCode) { }
+        endPattern(data.endPattern, errorCode) {
+    initParts(errorCode);
+}
+
+virtual ~ListFormatInternal();
+
+void initParts(UErrorCode &errorCode) {
+    // Bitwise & so that every pattern is split.
+    singlePass = twoParts.init(twoPattern, errorCode) &
+        startParts.init(startPattern, errorCode) &
+        middleParts.init(middlePattern, errorCode) &
+        endParts.init(endPattern, errorCode);
+}
 
-ListFormatInternal(const ListFormatInternal &other) :
-    twoPattern(other.twoPattern),
-    startPattern(other.startPattern),
-    middlePattern(other.middlePattern),
-    endPattern(other.endPattern) { }
+/** Returns the pattern that joins item k to the items before it. */
+const SimpleFormatter &patternFor(int32_t k, int32_t nItems) const {
+    if (nItems == 2) {
+        return twoPattern;
+    } else if (k == 1) {
+        return startPattern;
+    } else if (k == nItems - 1) {
+        return endPattern;
+    }
+    return middlePattern;
+}
+
+const ListPatternParts &partsFor(int32_t k, int32_t nItems) const {
+    if (nItems == 2) {
+        return twoParts;
+    } else if (k == 1) {
+        return startParts;
+    } else if (k == nItems - 1) {
+        return endParts;
+    }
+    return middleParts;
+}
 };
 
+ListFormatInternal::~ListFormatInternal() {}
+
 
 #if !UCONFIG_NO_FORMATTING
 class FormattedListData : public FormattedValueFieldPositionIteratorImpl {
@@ -79,106 +153,8 @@ UPRV_FORMATTED_VALUE_SUBCLASS_AUTO_IMPL(FormattedList)
 #endif
 
 
-static Hashtable* listPatternHash = nullptr;
 static const char STANDARD_STYLE[] = "standard";
 
-U_CDECL_BEGIN
-static UBool U_CALLCONV uprv_listformatter_cleanup() {
-    delete listPatternHash;
-    listPatternHash = nullptr;
-    return TRUE;
-}
-
-static void U_CALLCONV
-uprv_deleteListFormatInternal(void *obj) {
-    delete static_cast<ListFormatInternal *>(obj);
-}
-
-U_CDECL_END
-
-ListFormatter::ListFormatter(const ListFormatter& other) :
-        owned(other.owned), data(other.data) {
-    if (other.owned != nullptr) {
-        owned = new ListFormatInternal(*other.owned);
-        data = owned;
-    }
-}
-
-ListFormatter& ListFormatter::operator=(const ListFormatter& other) {
-    if (this == &other) {
-        return *this;
-    }
-    delete owned;
-    if (other.owned) {
-        owned = new ListFormatInternal(*other.owned);
-        data = owned;
-    } else {
-        owned = nullptr;
-        data = other.data;
-    }
-    return *this;
-}
-
-void ListFormatter::initializeHash(UErrorCode& errorCode) {
-    if (U_FAILURE(errorCode)) {
-        return;
-    }
-
-    listPatternHash = new Hashtable();
-    if (listPatternHash == nullptr) {
-        errorCode = U_MEMORY_ALLOCATION_ERROR;
-        return;
-    }
-
-    listPatternHash->setValueDeleter(uprv_deleteListFormatInternal);
-    ucln_i18n_registerCleanup(UCLN_I18N_LIST_FORMATTER, uprv_listformatter_cleanup);
-
-}
-
-const ListFormatInternal* ListFormatter::getListFormatInternal(
-        const Locale& locale, const char *style, UErrorCode& errorCode) {
-    if (U_FAILURE(errorCode)) {
-        return nullptr;
-    }
-    CharString keyBuffer(locale.getName(), errorCode);
-    keyBuffer.append(':', errorCode).append(style, errorCode);
-    UnicodeString key(keyBuffer.data(), -1, US_INV);
-    ListFormatInternal* result = nullptr;
-    static UMutex listFormatterMutex;
-    {
-        Mutex m(&listFormatterMutex);
-        if (listPatternHash == nullptr) {
-            initializeHash(errorCode);
-            if (U_FAILURE(errorCode)) {
-                return nullptr;
-            }
-        }
-        result = static_cast<ListFormatInternal*>(listPatternHash->get(key));
-    }
-    if (result != nullptr) {
-        return result;
-    }
-    result = loadListFormatInternal(locale, style, errorCode);
-    if (U_FAILURE(errorCode)) {
-        return nullptr;
-    }
-
-    {
-        Mutex m(&listFormatterMutex);
-        ListFormatInternal* temp = static_cast<ListFormatInternal*>(listPatternHash->get(key));
-        if (temp != nullptr) {
-            delete result;
-            result = temp;
-        } else {
-            listPatternHash->put(key, result, errorCode);
-            if (U_FAILURE(errorCode)) {
-                return nullptr;
-            }
-        }
-    }
-    return result;
-}
-
 static const UChar solidus = 0x2F;
 static const UChar aliasPrefix[] = { 0x6C,0x69,0x73,0x74,0x50,0x61,0x74,0x74,0x65,0x72,0x6E,0x2F }; // "listPattern/"
 enum {
@@ -291,6 +267,69 @@ ListFormatInternal* ListFormatter::loadListFormatInternal(
     return result;
 }
 
+template<> U_I18N_API
+const ListFormatInternal *LocaleCacheKey<ListFormatInternal>::createObject(
+        const void * /*unused*/, UErrorCode &status) const {
+    status = U_UNSUPPORTED_ERROR;
+    return nullptr;
+}
+
+class ListFormatterKey : public LocaleCacheKey<ListFormatInternal> {
+private:
+    char fStyle[kStyleLenMax+1];
+public:
+    ListFormatterKey(const Locale &loc, const char *style)
+            : LocaleCacheKey<ListFormatInternal>(loc) {
+        uprv_strncpy(fStyle, style, kStyleLenMax);
+        fStyle[kStyleLenMax] = 0;
+    }
+    ListFormatterKey(const ListFormatterKey &other)
+            : LocaleCacheKey<ListFormatInternal>(other) {
+        uprv_strcpy(fStyle, other.fStyle);
+    }
+    virtual ~ListFormatterKey();
+    virtual int32_t hashCode() const {
+        return (int32_t)(37u * (uint32_t)LocaleCacheKey<ListFormatInternal>::hashCode() +
+                         (uint32_t)ustr_hashCharsN(fStyle, static_cast<int32_t>(uprv_strlen(fStyle))));
+    }
+    virtual UBool operator==(const CacheKeyBase &other) const {
+        if (this == &other) {
+            return TRUE;
+        }
+        if (!LocaleCacheKey<ListFormatInternal>::operator==(other)) {
+            return FALSE;
+        }
+        // We know that this and other are of same class if we get this far.
+        const ListFormatterKey &realOther = static_cast<const ListFormatterKey &>(other);
+        return uprv_strcmp(fStyle, realOther.fStyle) == 0;
+    }
+    virtual CacheKeyBase *clone() const {
+        return new ListFormatterKey(*this);
+    }
+    virtual const ListFormatInternal *createObject(
+            const void * /*unused*/, UErrorCode &status) const {
+        ListFormatInternal *result = ListFormatter::loadListFormatInternal(fLoc, fStyle, status);
+        if (U_FAILURE(status)) {
+            return nullptr;
+        }
+        result->addRef();
+        return result;
+    }
+};
+
+ListFormatterKey::~ListFormatterKey() {}
+
+const ListFormatInternal* ListFormatter::getListFormatInternal(
+        const Locale& locale, const char *style, UErrorCode& errorCode) {
+    const UnifiedCache *cache = UnifiedCache::getInstance(errorCode);
+    if (U_FAILURE(errorCode)) {
+        return nullptr;
+    }
+    const ListFormatInternal *result = nullptr;
+    cache->get(ListFormatterKey(locale, style), result, errorCode);
+    return result;
+}
+
 ListFormatter* ListFormatter::createInstance(UErrorCode& errorCode) {
     Locale locale;  // The default locale.
     return createInstance(locale, errorCode);
@@ -306,6 +345,7 @@ ListFormatter* ListFormatter::createInstance(const Locale& locale, const char *s
         return nullptr;
     }
     ListFormatter* p = new ListFormatter(listFormatInternal);
+    listFormatInternal->removeRef();
     if (p == nullptr) {
         errorCode = U_MEMORY_ALLOCATION_ERROR;
         return nullptr;
@@ -313,16 +353,26 @@ ListFormatter* ListFormatter::createInstance(const Locale& locale, const char *s
     return p;
 }
 
-ListFormatter::ListFormatter(const ListFormatData& listFormatData, UErrorCode &errorCode) {
-    owned = new ListFormatInternal(listFormatData, errorCode);
-    data = owned;
+ListFormatter::ListFormatter(const ListFormatData& listFormatData, UErrorCode &errorCode) : data(nullptr) {
+    ListFormatInternal* owned = new ListFormatInternal(listFormatData, errorCode);
+    SharedObject::copyPtr(owned, data);
 }
 
-ListFormatter::ListFormatter(const ListFormatInternal* listFormatterInternal) : owned(nullptr), data(listFormatterInternal) {
+ListFormatter::ListFormatter(const ListFormatInternal* listFormatterInternal) : data(nullptr) {
+    SharedObject::copyPtr(listFormatterInternal, data);
+}
+
+ListFormatter::ListFormatter(const ListFormatter& other) : data(nullptr) {
+    SharedObject::copyPtr(other.data, data);
+}
+
+ListFormatter& ListFormatter::operator=(const ListFormatter& other) {
+    SharedObject::copyPtr(other.data, data);
+    return *this;
 }
 
 ListFormatter::~ListFormatter() {
-    delete owned;
+    SharedObject::clearPtr(data);
 }
 
 /**
@@ -371,6 +421,26 @@ static void joinStringsAndReplace(
     if (offsetSecond != nullptr) *offsetSecond = offsets[1];
 }
 
+/**
+ * Appends items[i], recording where it starts: in offset if i is the
+ * requested index, and in itemStarts if that is not null.
+ */
+static void appendListItem(
+        const UnicodeString items[],
+        int32_t i,
+        int32_t index,
+        UnicodeString &appendTo,
+        int32_t &offset,
+        int32_t *itemStarts) {
+    if (i == index) {
+        offset = appendTo.length();
+    }
+    if (itemStarts != nullptr) {
+        itemStarts[i] = appendTo.length();
+    }
+    appendTo.append(items[i]);
+}
+
 UnicodeString& ListFormatter::format(
         const UnicodeString items[],
         int32_t nItems,
@@ -474,71 +544,82 @@ UnicodeString& ListFormatter::format_(
         appendTo.append(items[0]);
         return appendTo;
     }
-    UnicodeString result(items[0]);
-    if (index == 0) {
-        offset = 0;
-    }
-    int32_t offsetFirst = 0;
-    int32_t offsetSecond = 0;
-    int32_t prefixLength = 0;
+    int32_t start = appendTo.length();
     // for n items, there are 2 * (n + 1) boundary including 0 and the upper
     // edge.
     MaybeStackArray<int32_t, 10> offsets((handler != nullptr) ? 2 * (nItems + 1): 0);
-    joinStringsAndReplace(
-            nItems == 2 ? data->twoPattern : data->startPattern,
-            result,
-            items[1],
-            result,
-            index == 1,
-            offset,
-            &offsetFirst,
-            &offsetSecond,
-            errorCode);
-    if (handler != nullptr) {
-        offsets[0] = 0;
-        prefixLength += offsetFirst;
-        offsets[1] = offsetSecond - prefixLength;
-    }
-    if (nItems > 2) {
-        for (int32_t i = 2; i < nItems - 1; ++i) {
-             joinStringsAndReplace(
-                     data->middlePattern,
-                     result,
-                     items[i],
-                     result,
-                     index == i,
-                     offset,
-                     &offsetFirst,
-                     &offsetSecond,
-                     errorCode);
-            if (handler != nullptr) {
+    int32_t *itemStarts = (handler != nullptr) ? offsets.getAlias() : nullptr;
+    if (data->singlePass) {
+        // Each pattern joins the list formatted so far with the next item, so
+        // the result is the text of each pattern up to its {0}, outermost
+        // pattern first, then the first item, then the rest of each pattern,
+        // innermost pattern first. This appends every item exactly once.
+        for (int32_t k = nItems - 1; k >= 1; --k) {
+            const ListPatternParts &parts = data->partsFor(k, nItems);
+            if (parts.secondOffset < parts.firstOffset) {
+                appendTo.append(parts.text, 0, parts.secondOffset);
+                appendListItem(items, k, index, appendTo, offset, itemStarts);
+                appendTo.append(parts.text, parts.secondOffset, parts.firstOffset - parts.secondOffset);
+            } else {
+                appendTo.append(parts.text, 0, parts.firstOffset);
+            }
+        }
+        appendListItem(items, 0, index, appendTo, offset, itemStarts);
+        for (int32_t k = 1; k < nItems; ++k) {
+            const ListPatternParts &parts = data->partsFor(k, nItems);
+            if (parts.secondOffset < parts.firstOffset) {
+                appendTo.append(parts.text, parts.firstOffset, INT32_MAX);
+            } else {
+                appendTo.append(parts.text, parts.firstOffset, parts.secondOffset - parts.firstOffset);
+                appendListItem(items, k, index, appendTo, offset, itemStarts);
+                appendTo.append(parts.text, parts.secondOffset, INT32_MAX);
+            }
+        }
+    } else {
+        // Some pattern repeats an argument; substitute the items one at a time.
+        UnicodeString result(items[0]);
+        if (index == 0) {
+            offset = 0;
+        }
+        int32_t offsetFirst = 0;
+        int32_t offsetSecond = 0;
+        int32_t prefixLength = 0;
+        if (itemStarts != nullptr) {
+            itemStarts[0] = 0;
+        }
+        for (int32_t i = 1; i < nItems; ++i) {
+            joinStringsAndReplace(
+                    data->patternFor(i, nItems),
+                    result,
+                    items[i],
+                    result,
+                    index == i,
+                    offset,
+                    &offsetFirst,
+                    &offsetSecond,
+                    errorCode);
+            if (itemStarts != nullptr) {
                 prefixLength += offsetFirst;
-                offsets[i] = offsetSecond - prefixLength;
+                itemStarts[i] = offsetSecond - prefixLength;
             }
         }
-        joinStringsAndReplace(
-                data->endPattern,
-                result,
-                items[nItems - 1],
-                result,
-                index == nItems - 1,
-                offset,
-                &offsetFirst,
-                &offsetSecond,
-                errorCode);
-        if (handler != nullptr) {
-            prefixLength += offsetFirst;
-            offsets[nItems - 1] = offsetSecond - prefixLength;
+        if (U_FAILURE(errorCode)) {
+            return appendTo;
+        }
+        if (itemStarts != nullptr) {
+            for (int32_t i = 0; i < nItems; ++i) {
+                itemStarts[i] += start + prefixLength;
+            }
+        }
+        if (offset >= 0) {
+            offset += start;
         }
+        appendTo += result;
     }
     if (handler != nullptr) {
-        // If there are already some data in appendTo, we need to adjust the index
-        // by shifting that lenght while insert into handler.
-        int32_t shift = appendTo.length() + prefixLength;
         // Output the ULISTFMT_ELEMENT_FIELD in the order of the input elements
         for (int32_t i = 0; i < nItems; ++i) {
-            offsets[i + nItems] = offsets[i] + items[i].length() + shift;
-            offsets[i] += shift;
+            offsets[i + nItems] = offsets[i] + items[i].length();
             handler->addAttribute(
                 ULISTFMT_ELEMENT_FIELD,  // id
                 offsets[i],  // index
@@ -549,8 +630,8 @@ UnicodeString& ListFormatter::format_(
         // To handle the edging case, just insert the two ends into the array
         // and sort. Then we output ULISTFMT_LITERAL_FIELD if the indecies
         // between the even and odd position are not the same in the sorted array.
-        offsets[2 * nItems] = shift - prefixLength;
-        offsets[2 * nItems + 1] = result.length() + shift - prefixLength;
+        offsets[2 * nItems] = start;
+        offsets[2 * nItems + 1] = appendTo.length();
         uprv_sortArray(offsets.getAlias(), 2 * (nItems + 1), sizeof(int32_t),
                uprv_int32Comparator, nullptr,
                false, &errorCode);
@@ -563,12 +644,6 @@ UnicodeString& ListFormatter::format_(
           }
         }
     }
-    if (U_SUCCESS(errorCode)) {
-        if (offset >= 0) {
-            offset += appendTo.length();
-        }
-        appendTo += result;
-    }
 #endif  
     return appendTo;
 }
@@ -43,9 +43,11 @@
 #include "messageimpl.h"
 #include "msgfmt_impl.h"
 #include "plurrule_impl.h"
+#include "sharedmessageformat.h"
 #include "uassert.h"
 #include "uelement.h"
 #include "uhash.h"
+#include "unifiedcache.h"
 #include "ustrfmt.h"
 #include "util.h"
 #include "uvector.h"
@@ -226,6 +228,30 @@ class AppendableWrapper : public UMemory {
     int32_t len;
 };
 
+/**
+ * What format() needs to know about the argument at one ARG_START part index.
+ */
+struct MessageFormat::ArgStartFormat {
+    enum Kind {
+        /** No cached formatter; format according to the argument type. */
+        NONE,
+        /** A DummyFormat from setFormat(NULL); format like an ARG_TYPE_NONE argument. */
+        DUMMY,
+        /** An explicit or custom formatter that formats the argument directly. */
+        SIMPLE,
+        /** A custom ChoiceFormat, PluralFormat or SelectFormat whose result may be a sub-message. */
+        NESTED
+    };
+    /** Aliases the cachedFormatters value, or NULL. */
+    const Format* formatter;
+    Kind kind;
+    /**
+     * For plural and selectordinal arguments, the precomputed
+     * findFirstPluralNumberArg() result for the "other" sub-message.
+     */
+    int32_t pluralNumberArg;
+};
+
 
 // -------------------------------------
 // Creates a MessageFormat instance based on the pattern.
@@ -244,6 +270,8 @@ MessageFormat::MessageFormat(const UnicodeString& pattern,
   defaultDateFormat(NULL),
   cachedFormatters(NULL),
   customFormatArgStarts(NULL),
+  argStartFormats(NULL),
+  argStartFormatCount(0),
   pluralProvider(*this, UPLURAL_TYPE_CARDINAL),
   ordinalProvider(*this, UPLURAL_TYPE_ORDINAL)
 {
@@ -266,6 +294,8 @@ MessageFormat::MessageFormat(const UnicodeString& pattern,
   defaultDateFormat(NULL),
   cachedFormatters(NULL),
   customFormatArgStarts(NULL),
+  argStartFormats(NULL),
+  argStartFormatCount(0),
   pluralProvider(*this, UPLURAL_TYPE_CARDINAL),
   ordinalProvider(*this, UPLURAL_TYPE_ORDINAL)
 {
@@ -289,6 +319,8 @@ MessageFormat::MessageFormat(const UnicodeString& pattern,
   defaultDateFormat(NULL),
   cachedFormatters(NULL),
   customFormatArgStarts(NULL),
+  argStartFormats(NULL),
+  argStartFormatCount(0),
   pluralProvider(*this, UPLURAL_TYPE_CARDINAL),
   ordinalProvider(*this, UPLURAL_TYPE_ORDINAL)
 {
@@ -311,6 +343,8 @@ MessageFormat::MessageFormat(const MessageFormat& that)
   defaultDateFormat(NULL),
   cachedFormatters(NULL),
   customFormatArgStarts(NULL),
+  argStartFormats(NULL),
+  argStartFormatCount(0),
   pluralProvider(*this, UPLURAL_TYPE_CARDINAL),
   ordinalProvider(*this, UPLURAL_TYPE_ORDINAL)
 {
@@ -329,6 +363,7 @@ MessageFormat::~MessageFormat()
 
     uprv_free(argTypes);
     uprv_free(formatAliases);
+    uprv_free(argStartFormats);
     delete defaultNumberFormat;
     delete defaultDateFormat;
 }
@@ -366,6 +401,60 @@ UBool MessageFormat::allocateArgTypes(int32_t capacity, UErrorCode& status) {
     return TRUE;
 }
 
+/**
+ * Allocate argStartFormats[] for count part indexes and clear all of its
+ * entries. If that fails, leave argStartFormats[] unchanged.
+ */
+UBool MessageFormat::allocateArgStartFormats(int32_t count, UErrorCode& status) {
+    if (U_FAILURE(status)) {
+        return FALSE;
+    }
+    if (count != argStartFormatCount) {
+        ArgStartFormat* a = (ArgStartFormat*)
+                uprv_realloc(argStartFormats, sizeof(*argStartFormats) * (count > 0 ? count : 1));
+        if (a == NULL) {
+            status = U_MEMORY_ALLOCATION_ERROR;
+            return FALSE;
+        }
+        argStartFormats = a;
+        argStartFormatCount = count;
+    }
+    for (int32_t i = 0; i < argStartFormatCount; ++i) {
+        argStartFormats[i].formatter = NULL;
+        argStartFormats[i].kind = ArgStartFormat::NONE;
+        argStartFormats[i].pluralNumberArg = 0;
+    }
+    return TRUE;
+}
+
+// Mirrors a cachedFormatters entry into argStartFormats[].
+void MessageFormat::setArgStartFormatSlot(int32_t argStart, const Format* formatter) {
+    if (argStart < 0 || argStart >= argStartFormatCount) {
+        return;
+    }
+    ArgStartFormat& slot = argStartFormats[argStart];
+    slot.formatter = formatter;
+    if (formatter == NULL) {
+        slot.kind = ArgStartFormat::NONE;
+    } else if (dynamic_cast<const DummyFormat*>(formatter) != NULL) {
+        slot.kind = ArgStartFormat::DUMMY;
+    } else if (dynamic_cast<const ChoiceFormat*>(formatter) != NULL ||
+               dynamic_cast<const PluralFormat*>(formatter) != NULL ||
+               dynamic_cast<const SelectFormat*>(formatter) != NULL) {
+        slot.kind = ArgStartFormat::NESTED;
+    } else {
+        slot.kind = ArgStartFormat::SIMPLE;
+    }
+}
+
+// Forgets all formatters, for when cachedFormatters is emptied.
+void MessageFormat::clearArgStartFormatSlots() {
+    for (int32_t i = 0; i < argStartFormatCount; ++i) {
+        argStartFormats[i].formatter = NULL;
+        argStartFormats[i].kind = ArgStartFormat::NONE;
+    }
+}
+
 // -------------------------------------
 // assignment operator
 
@@ -503,6 +592,9 @@ void MessageFormat::resetPattern() {
     cachedFormatters = NULL;
     uhash_close(customFormatArgStarts);
     customFormatArgStarts = NULL;
+    uprv_free(argStartFormats);
+    argStartFormats = NULL;
+    argStartFormatCount = 0;
     argTypeCount = 0;
     hasArgTypeConflicts = FALSE;
 }
@@ -567,6 +659,9 @@ void MessageFormat::setArgStartFormat(int32_t argStart,
         formatter = new DummyFormat();
     }
     uhash_iput(cachedFormatters, argStart, formatter, &status);
+    if (U_SUCCESS(status)) {
+        setArgStartFormatSlot(argStart, formatter);
+    }
 }
 
 
@@ -619,6 +714,7 @@ MessageFormat::adoptFormats(Format** newFormats,
     if (customFormatArgStarts != NULL) {
         uhash_removeAll(customFormatArgStarts);
     }
+    clearArgStartFormatSlots();
 
     int32_t formatNumber = 0;
     UErrorCode status = U_ZERO_ERROR;
@@ -652,6 +748,7 @@ MessageFormat::setFormats(const Format** newFormats,
     if (customFormatArgStarts != NULL) {
         uhash_removeAll(customFormatArgStarts);
     }
+    clearArgStartFormatSlots();
 
     UErrorCode status = U_ZERO_ERROR;
     int32_t formatNumber = 0;
@@ -930,12 +1027,13 @@ MessageFormat::format(const UnicodeString* argumentNames,
     return format(arguments, argumentNames, count, appendTo, NULL, success);
 }
 
-// Does linear search to find the match for an ArgName.
+// Does linear search to find the match for an ARG_NAME part.
 const Formattable* MessageFormat::getArgFromListByName(const Formattable* arguments,
                                                        const UnicodeString *argumentNames,
-                                                       int32_t cnt, UnicodeString& name) const {
+                                                       int32_t cnt,
+                                                       const MessagePattern::Part& namePart) const {
     for (int32_t i = 0; i < cnt; ++i) {
-        if (0 == argumentNames[i].compare(name)) {
+        if (msgPattern.partSubstringMatches(namePart, argumentNames[i])) {
             return arguments + i;
         }
     }
@@ -968,9 +1066,9 @@ namespace {
  */
 class PluralSelectorContext {
 public:
-    PluralSelectorContext(int32_t start, const UnicodeString &name,
+    PluralSelectorContext(int32_t start, int32_t firstNumberArg,
                           const Formattable &num, double off, UErrorCode &errorCode)
-            : startIndex(start), argName(name), offset(off),
+            : startIndex(start), pluralNumberArg(firstNumberArg), offset(off),
               numberArgIndex(-1), formatter(NULL), forReplaceNumber(FALSE) {
         // number needs to be set even when select() is not called.
         // Keep it as a Number/Formattable:
@@ -984,7 +1082,8 @@ class PluralSelectorContext {
 
     // Input values for plural selection with decimals.
     int32_t startIndex;
-    const UnicodeString &argName;
+    /** ARG_START of the number in the "other" sub-message; see findFirstPluralNumberArg() */
+    int32_t pluralNumberArg;
     /** argument number - plural offset */
     Formattable number;
     double offset;
@@ -1044,10 +1143,11 @@ void MessageFormat::format(int32_t msgStart, const void *plNumber,
         }
         int32_t argLimit = msgPattern.getLimitPartIndex(i);
         UMessagePatternArgType argType = part->getArgType();
+        U_ASSERT(i < argStartFormatCount);
+        const ArgStartFormat& argFormat = argStartFormats[i];
         part = &msgPattern.getPart(++i);
         const Formattable* arg;
         UBool noArg = FALSE;
-        UnicodeString argName = msgPattern.getSubstring(*part);
         if (argumentNames == NULL) {
             int32_t argNumber = part->getValue();  // ARG_NUMBER
             if (0 <= argNumber && argNumber < cnt) {
@@ -1057,17 +1157,17 @@ void MessageFormat::format(int32_t msgStart, const void *plNumber,
                 noArg = TRUE;
             }
         } else {
-            arg = getArgFromListByName(arguments, argumentNames, cnt, argName);
+            arg = getArgFromListByName(arguments, argumentNames, cnt, *part);
             if (arg == NULL) {
                 noArg = TRUE;
             }
         }
         ++i;
         int32_t prevDestLength = appendTo.length();
-        const Format* formatter = NULL;
+        const Format* formatter = argFormat.formatter;
         if (noArg) {
-            appendTo.append(
-                UnicodeString(LEFT_CURLY_BRACE).append(argName).append(RIGHT_CURLY_BRACE));
+            appendTo.append(UnicodeString(LEFT_CURLY_BRACE)
+                .append(msgString, part->getIndex(), part->getLength()).append(RIGHT_CURLY_BRACE));
         } else if (arg == NULL) {
             appendTo.append(NULL_STRING, 4);
         } else if(plNumber!=NULL &&
@@ -1083,11 +1183,10 @@ void MessageFormat::format(int32_t msgStart, const void *plNumber,
                 // that formats the number without subtracting the offset.
                 appendTo.formatAndAppend(pluralNumber.formatter, *arg, success);
             }
-        } else if ((formatter = getCachedFormatter(i -2)) != 0) {
+        } else if (argFormat.kind == ArgStartFormat::SIMPLE ||
+                   argFormat.kind == ArgStartFormat::NESTED) {
             // Handles all ArgType.SIMPLE, and formatters from setFormat() and its siblings.
-            if (dynamic_cast<const ChoiceFormat*>(formatter) ||
-                dynamic_cast<const PluralFormat*>(formatter) ||
-                dynamic_cast<const SelectFormat*>(formatter)) {
+            if (argFormat.kind == ArgStartFormat::NESTED) {
                 // We only handle nested formats here if they were provided via
                 // setFormat() or its siblings. Otherwise they are not cached and instead
                 // handled below according to argType.
@@ -1104,10 +1203,8 @@ void MessageFormat::format(int32_t msgStart, const void *plNumber,
             } else {
                 appendTo.formatAndAppend(formatter, *arg, success);
             }
-        } else if (argType == UMSGPAT_ARG_TYPE_NONE || (cachedFormatters && uhash_iget(cachedFormatters, i - 2))) {
-            // We arrive here if getCachedFormatter returned NULL, but there was actually an element in the hash table.
-            // This can only happen if the hash table contained a DummyFormat, so the if statement above is a check
-            // for the hash table containind DummyFormat.
+        } else if (argType == UMSGPAT_ARG_TYPE_NONE || argFormat.kind == ArgStartFormat::DUMMY) {
+            // A DummyFormat represents setFormat(NULL).
             if (arg->isNumeric()) {
                 const NumberFormat* nf = getDefaultNumberFormat(success);
                 appendTo.formatAndAppend(nf, *arg, success);
@@ -1138,7 +1235,7 @@ void MessageFormat::format(int32_t msgStart, const void *plNumber,
             // We must use the Formattable::getDouble() variant with the UErrorCode parameter
             // because only this one converts non-double numeric types to double.
             double offset = msgPattern.getPluralOffset(i);
-            PluralSelectorContext context(i, argName, *arg, offset, success);
+            PluralSelectorContext context(i, argFormat.pluralNumberArg, *arg, offset, success);
             int32_t subMsgStart = PluralFormat::findSubMessage(
                     msgPattern, i, selector, &context, arg->getDouble(success), success);
             formatComplexSubMessage(subMsgStart, &context, arguments, argumentNames,
@@ -1329,6 +1426,12 @@ void MessageFormat::copyObjects(const MessageFormat& that, UErrorCode& ec) {
     if (customFormatArgStarts != NULL) {
         uhash_removeAll(customFormatArgStarts);
     }
+    if (!allocateArgStartFormats(that.argStartFormatCount, ec)) {
+        return;
+    }
+    for (int32_t i = 0; i < argStartFormatCount; ++i) {
+        argStartFormats[i].pluralNumberArg = that.argStartFormats[i].pluralNumberArg;
+    }
     if (that.cachedFormatters) {
         if (cachedFormatters == NULL) {
             cachedFormatters=uhash_open(uhash_hashLong, uhash_compareLong,
@@ -1346,6 +1449,9 @@ void MessageFormat::copyObjects(const MessageFormat& that, UErrorCode& ec) {
             Format* newFormat = ((Format*)(cur->value.pointer))->clone();
             if (newFormat) {
                 uhash_iput(cachedFormatters, cur->key.integer, newFormat, &ec);
+                if (U_SUCCESS(ec)) {
+                    setArgStartFormatSlot(cur->key.integer, newFormat);
+                }
             } else {
                 ec = U_MEMORY_ALLOCATION_ERROR;
                 return;
@@ -1592,6 +1698,9 @@ void MessageFormat::cacheExplicitFormats(UErrorCode& status) {
     if (customFormatArgStarts != NULL) {
         uhash_removeAll(customFormatArgStarts);
     }
+    if (!allocateArgStartFormats(msgPattern.countParts(), status)) {
+        return;
+    }
 
     // The last two "parts" can at most be ARG_LIMIT and MSG_LIMIT
     // which we need not examine.
@@ -1674,6 +1783,18 @@ void MessageFormat::cacheExplicitFormats(UErrorCode& status) {
             argTypes[argNumber] = formattableType;
         }
     }
+
+    // Resolve where each plural argument's number is formatted,
+    // so that PluralSelectorProvider::select() need not search for it.
+    for (int32_t i = 1; i < limit && U_SUCCESS(status); ++i) {
+        const MessagePattern::Part& part = msgPattern.getPart(i);
+        if (part.getType() == UMSGPAT_PART_TYPE_ARG_START &&
+                UMSGPAT_ARG_TYPE_HAS_PLURAL_STYLE(part.getArgType())) {
+            UnicodeString argName = msgPattern.getSubstring(msgPattern.getPart(i + 1));
+            int32_t otherIndex = findOtherSubMessage(i + 2);
+            argStartFormats[i].pluralNumberArg = findFirstPluralNumberArg(otherIndex, argName);
+        }
+    }
 }
 
 Format* MessageFormat::createAppropriateFormat(UnicodeString& type, UnicodeString& style,
@@ -1862,6 +1983,111 @@ MessageFormat::getArgTypeCount() const {
     return argTypeCount;
 }
 
+void MessageFormat::preloadFormatters(UErrorCode& status) {
+    if (U_FAILURE(status)) {
+        return;
+    }
+    UBool needsNumberFormat = FALSE;
+    UBool needsDateFormat = FALSE;
+    int32_t count = msgPattern.countParts();
+    for (int32_t i = 0; i < count && U_SUCCESS(status); ++i) {
+        const MessagePattern::Part& part = msgPattern.getPart(i);
+        if (part.getType() != UMSGPAT_PART_TYPE_ARG_START) {
+            continue;
+        }
+        switch (part.getArgType()) {
+        case UMSGPAT_ARG_TYPE_NONE:
+            needsNumberFormat = needsDateFormat = TRUE;
+            break;
+        case UMSGPAT_ARG_TYPE_PLURAL:
+            needsNumberFormat = TRUE;
+            pluralProvider.loadRules(status);
+            break;
+        case UMSGPAT_ARG_TYPE_SELECTORDINAL:
+            needsNumberFormat = TRUE;
+            ordinalProvider.loadRules(status);
+            break;
+        default:
+            break;
+        }
+    }
+    if (needsNumberFormat) {
+        getDefaultNumberFormat(status);
+    }
+    if (needsDateFormat) {
+        getDefaultDateFormat(status);
+    }
+}
+
+SharedMessageFormat::~SharedMessageFormat() {
+    delete ptr;
+}
+
+template<> U_I18N_API
+const SharedMessageFormat *LocaleCacheKey<SharedMessageFormat>::createObject(
+        const void * /*unused*/, UErrorCode &status) const {
+    status = U_UNSUPPORTED_ERROR;
+    return NULL;
+}
+
+class U_I18N_API MessageFormatKey : public LocaleCacheKey<SharedMessageFormat> {
+private:
+    UnicodeString fPattern;
+public:
+    MessageFormatKey(const Locale &loc, const UnicodeString &pattern)
+            : LocaleCacheKey<SharedMessageFormat>(loc), fPattern(pattern) { }
+    MessageFormatKey(const MessageFormatKey &other) :
+            LocaleCacheKey<SharedMessageFormat>(other),
+            fPattern(other.fPattern) { }
+    virtual ~MessageFormatKey();
+    virtual int32_t hashCode() const {
+        return (int32_t)(37u * (uint32_t)LocaleCacheKey<SharedMessageFormat>::hashCode() + (uint32_t)fPattern.hashCode());
+    }
+    virtual UBool operator==(const CacheKeyBase &other) const {
+        if (this == &other) {
+            return TRUE;
+        }
+        if (!LocaleCacheKey<SharedMessageFormat>::operator==(other)) {
+            return FALSE;
+        }
+        // We know that this and other are of same class if we get this far.
+        const MessageFormatKey &realOther = static_cast<const MessageFormatKey &>(other);
+        return realOther.fPattern == fPattern;
+    }
+    virtual CacheKeyBase *clone() const {
+        return new MessageFormatKey(*this);
+    }
+    virtual const SharedMessageFormat *createObject(
+            const void * /*unused*/, UErrorCode &status) const {
+        LocalPointer<MessageFormat> mf(new MessageFormat(fPattern, fLoc, status), status);
+        if (U_FAILURE(status)) {
+            return NULL;
+        }
+        mf->preloadFormatters(status);
+        LocalPointer<SharedMessageFormat> result(new SharedMessageFormat(mf.getAlias()), status);
+        if (U_FAILURE(status)) {
+            return NULL;
+        }
+        mf.orphan();
+        result->addRef();
+        return result.orphan();
+    }
+};
+
+MessageFormatKey::~MessageFormatKey() { }
+
+const SharedMessageFormat* U_EXPORT2
+MessageFormat::createSharedInstance(const UnicodeString& pattern, const Locale& locale,
+                                    UErrorCode& status) {
+    const UnifiedCache *cache = UnifiedCache::getInstance(status);
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    const SharedMessageFormat *result = NULL;
+    cache->get(MessageFormatKey(locale, pattern), result, status);
+    return result;
+}
+
 UBool MessageFormat::equalFormats(const void* left, const void* right) {
     return *(const Format*)left==*(const Format*)right;
 }
@@ -1951,11 +2177,9 @@ UnicodeString MessageFormat::PluralSelectorProvider::select(void *ctx, double nu
         return UnicodeString(FALSE, OTHER_STRING, 5);
     }
     MessageFormat::PluralSelectorProvider* t = const_cast<MessageFormat::PluralSelectorProvider*>(this);
-    if(rules == NULL) {
-        t->rules = PluralRules::forLocale(msgFormat.fLocale, type, ec);
-        if (U_FAILURE(ec)) {
-            return UnicodeString(FALSE, OTHER_STRING, 5);
-        }
+    t->loadRules(ec);
+    if (U_FAILURE(ec)) {
+        return UnicodeString(FALSE, OTHER_STRING, 5);
     }
     // Select a sub-message according to how the number is formatted,
     // which is specified in the selected sub-message.
@@ -1964,11 +2188,9 @@ UnicodeString MessageFormat::PluralSelectorProvider::select(void *ctx, double nu
     // which must always be present and usually contains the number.
     // Message authors should be consistent across sub-messages.
     PluralSelectorContext &context = *static_cast<PluralSelectorContext *>(ctx);
-    int32_t otherIndex = msgFormat.findOtherSubMessage(context.startIndex);
-    context.numberArgIndex = msgFormat.findFirstPluralNumberArg(otherIndex, context.argName);
-    if(context.numberArgIndex > 0 && msgFormat.cachedFormatters != NULL) {
-        context.formatter =
-            (const Format*)uhash_iget(msgFormat.cachedFormatters, context.numberArgIndex);
+    context.numberArgIndex = context.pluralNumberArg;
+    if(context.numberArgIndex > 0) {
+        context.formatter = msgFormat.argStartFormats[context.numberArgIndex].formatter;
     }
     if(context.formatter == NULL) {
         context.formatter = msgFormat.getDefaultNumberFormat(ec);
@@ -1992,6 +2214,12 @@ UnicodeString MessageFormat::PluralSelectorProvider::select(void *ctx, double nu
     }
 }
 
+void MessageFormat::PluralSelectorProvider::loadRules(UErrorCode& ec) {
+    if (U_SUCCESS(ec) && rules == NULL) {
+        rules = PluralRules::forLocale(msgFormat.fLocale, type, ec);
+    }
+}
+
 void MessageFormat::PluralSelectorProvider::reset() {
     delete rules;
     rules = NULL;
@@ -19,6 +19,7 @@
 
 #if U_HAVE_RBNF
 
+#include "unicode/localpointer.h"
 #include "unicode/uchar.h"
 #include "nfrule.h"
 #include "nfrlist.h"
@@ -193,6 +194,24 @@ NFRuleSet::NFRuleSet(RuleBasedNumberFormat *_owner, UnicodeString* descriptions,
     // by parseRules()
 }
 
+/**
+ * Creates an empty rule set with the name and flags of another one.  The
+ * rules are copied by copyRules() once all rule sets of the new owner exist.
+ */
+NFRuleSet::NFRuleSet(RuleBasedNumberFormat *_owner, const NFRuleSet& other)
+  : name(other.name)
+  , rules(0)
+  , owner(_owner)
+  , fractionRules()
+  , fIsFractionRuleSet(other.fIsFractionRuleSet)
+  , fIsPublic(other.fIsPublic)
+  , fIsParseable(other.fIsParseable)
+{
+    for (int32_t i = 0; i < NON_NUMERICAL_RULE_LENGTH; ++i) {
+        nonNumericalRules[i] = NULL;
+    }
+}
+
 void
 NFRuleSet::parseRules(UnicodeString& description, UErrorCode& status)
 {
@@ -262,6 +281,90 @@ NFRuleSet::parseRules(UnicodeString& description, UErrorCode& status)
     }
 }
 
+/**
+ * Copies the already parsed rules of another rule set into this one,
+ * instead of parsing them again from the description.
+ */
+void
+NFRuleSet::copyRules(const NFRuleSet& other, NFCopyContext& context, UErrorCode& status)
+{
+    if (U_FAILURE(status)) {
+        return;
+    }
+    context.setRuleSets(&other, this);
+
+    // the rules are copied in order, so that a >>> substitution finds
+    // the copy of its predecessor in this rule set's list
+    for (uint32_t i = 0; i < other.rules.size(); ++i) {
+        LocalPointer<NFRule> rule(new NFRule(*other.rules[i], context, status), status);
+        if (U_FAILURE(status)) {
+            return;
+        }
+        rules.add(rule.orphan());
+    }
+    for (uint32_t i = 0; i < other.fractionRules.size(); ++i) {
+        LocalPointer<NFRule> rule(new NFRule(*other.fractionRules[i], context, status), status);
+        if (U_FAILURE(status)) {
+            return;
+        }
+        fractionRules.add(rule.orphan());
+    }
+    for (int32_t i = 0; i < NON_NUMERICAL_RULE_LENGTH; ++i) {
+        const NFRule *rule = other.nonNumericalRules[i];
+        if (rule == NULL) {
+            continue;
+        }
+        if (i == IMPROPER_FRACTION_RULE_INDEX
+            || i == PROPER_FRACTION_RULE_INDEX
+            || i == MASTER_RULE_INDEX)
+        {
+            // these point into fractionRules, which owns them
+            for (uint32_t fIdx = 0; fIdx < other.fractionRules.size(); ++fIdx) {
+                if (other.fractionRules[fIdx] == rule) {
+                    nonNumericalRules[i] = fractionRules[fIdx];
+                    break;
+                }
+            }
+        } else {
+            nonNumericalRules[i] = new NFRule(*rule, context, status);
+            if (nonNumericalRules[i] == NULL) {
+                status = U_MEMORY_ALLOCATION_ERROR;
+            }
+            if (U_FAILURE(status)) {
+                return;
+            }
+        }
+    }
+}
+
+const NFRuleSet *
+NFCopyContext::mapRuleSet(const NFRuleSet *ruleSet) const
+{
+    if (ruleSet == NULL) {
+        return NULL;
+    }
+    for (int32_t i = 0; sourceSets[i] != NULL; ++i) {
+        if (sourceSets[i] == ruleSet) {
+            return targetSets[i];
+        }
+    }
+    return NULL;
+}
+
+const NFRule *
+NFCopyContext::mapRule(const NFRule *rule) const
+{
+    if (rule == NULL || sourceSet == NULL) {
+        return NULL;
+    }
+    for (uint32_t i = 0; i < sourceSet->rules.size() && i < targetSet->rules.size(); ++i) {
+        if (sourceSet->rules[i] == rule) {
+            return targetSet->rules[i];
+        }
+    }
+    return NULL;
+}
+
 /**
  * Set one of the non-numerical rules.
  * @param rule The rule to set.
@@ -30,10 +30,14 @@
 
 U_NAMESPACE_BEGIN
 
+class NFCopyContext;
+
 class NFRuleSet : public UMemory {
 public:
     NFRuleSet(RuleBasedNumberFormat *owner, UnicodeString* descriptions, int32_t index, UErrorCode& status);
+    NFRuleSet(RuleBasedNumberFormat *owner, const NFRuleSet& other);
     void parseRules(UnicodeString& rules, UErrorCode& status);
+    void copyRules(const NFRuleSet& other, NFCopyContext& context, UErrorCode& status);
     void setNonNumericalRule(NFRule *rule);
     void setBestFractionRule(int32_t originalIndex, NFRule *newRule, UBool rememberRule);
     void makeIntoFractionRuleSet() { fIsFractionRuleSet = TRUE; }
@@ -68,6 +72,7 @@ class NFRuleSet : public UMemory {
     const NFRule * findFractionRuleSetRule(double number) const;
     
     friend class NFSubstitution;
+    friend class NFCopyContext;
 
 private:
     UnicodeString name;
@@ -85,6 +90,32 @@ class NFRuleSet : public UMemory {
 
 // utilities from old llong.h
 // convert mantissa portion of double to int64
+/**
+ * Maps the rule sets and rules of a parsed formatter onto their counterparts
+ * in a copy of it, so that the parsed rules can be copied instead of being
+ * parsed again from the description.
+ */
+class NFCopyContext : public UMemory {
+public:
+    NFCopyContext(const RuleBasedNumberFormat *formatter, NFRuleSet * const *sourceSets, NFRuleSet * const *targetSets)
+        : formatter(formatter), sourceSets(sourceSets), targetSets(targetSets), sourceSet(NULL), targetSet(NULL) {}
+
+    const RuleBasedNumberFormat *getFormatter() const { return formatter; }
+
+    void setRuleSets(const NFRuleSet *source, const NFRuleSet *target) { sourceSet = source; targetSet = target; }
+
+    const NFRuleSet *mapRuleSet(const NFRuleSet *ruleSet) const;
+
+    const NFRule *mapRule(const NFRule *rule) const;
+
+private:
+    const RuleBasedNumberFormat *formatter;
+    NFRuleSet * const *sourceSets;
+    NFRuleSet * const *targetSets;
+    const NFRuleSet *sourceSet;
+    const NFRuleSet *targetSet;
+};
+
 int64_t util64_fromDouble(double d);
 
 // raise radix to the power exponent, only non-negative exponents
@@ -31,9 +31,30 @@
 #include "nfsubs.h"
 #include "patternprops.h"
 #include "putilimp.h"
+#include "sharedobject.h"
+#include "uvectr32.h"
 
 U_NAMESPACE_BEGIN
 
+/**
+ * The plural format of a rule's rule text.  It does not change once the
+ * rule is parsed, so copies of the rule share it instead of cloning it.
+ */
+class SharedPluralFormat : public SharedObject {
+public:
+    SharedPluralFormat(PluralFormat *pfToAdopt) : ptr(pfToAdopt) { }
+    virtual ~SharedPluralFormat();
+    const PluralFormat *get() const { return ptr; }
+private:
+    PluralFormat *ptr;
+    SharedPluralFormat(const SharedPluralFormat &);
+    SharedPluralFormat &operator=(const SharedPluralFormat &);
+};
+
+SharedPluralFormat::~SharedPluralFormat() {
+    delete ptr;
+}
+
 NFRule::NFRule(const RuleBasedNumberFormat* _rbnf, const UnicodeString &_ruleText, UErrorCode &status)
   : baseValue((int32_t)0)
   , radix(10)
@@ -50,6 +71,47 @@ NFRule::NFRule(const RuleBasedNumberFormat* _rbnf, const UnicodeString &_ruleTex
     }
 }
 
+/**
+ * Copies an already parsed rule for the formatter that context builds.
+ * The substitutions are copied so that they refer to that formatter's
+ * rule sets.
+ */
+NFRule::NFRule(const NFRule& other, const NFCopyContext& context, UErrorCode& status)
+  : baseValue(other.baseValue)
+  , radix(other.radix)
+  , exponent(other.exponent)
+  , decimalPoint(other.decimalPoint)
+  , fRuleText(other.fRuleText)
+  , sub1(NULL)
+  , sub2(NULL)
+  , formatter(context.getFormatter())
+  , rulePatternFormat(NULL)
+{
+    if (U_FAILURE(status)) {
+        return;
+    }
+    if (other.sub1 != NULL) {
+        sub1 = other.sub1->copy(context, status);
+        if (sub1 == NULL) {
+            status = U_MEMORY_ALLOCATION_ERROR;
+            return;
+        }
+    }
+    if (other.sub2 == other.sub1) {
+        sub2 = sub1;
+    } else if (other.sub2 != NULL) {
+        sub2 = other.sub2->copy(context, status);
+        if (sub2 == NULL) {
+            status = U_MEMORY_ALLOCATION_ERROR;
+            return;
+        }
+    }
+    if (other.rulePatternFormat != NULL) {
+        rulePatternFormat = other.rulePatternFormat;
+        rulePatternFormat->addRef();
+    }
+}
+
 NFRule::~NFRule()
 {
     if (sub1 != sub2) {
@@ -58,8 +120,10 @@ NFRule::~NFRule()
     }
     delete sub1;
     sub1 = NULL;
-    delete rulePatternFormat;
-    rulePatternFormat = NULL;
+    if (rulePatternFormat != NULL) {
+        rulePatternFormat->removeRef();
+        rulePatternFormat = NULL;
+    }
 }
 
 static const UChar gLeftBracket = 0x005b;
@@ -447,8 +511,23 @@ NFRule::extractSubstitutions(const NFRuleSet* ruleSet,
             status = U_ILLEGAL_ARGUMENT_ERROR;
             return;
         }
-        rulePatternFormat = formatter->createPluralFormat(pluralType,
-                fRuleText.tempSubString(endType + 1, pluralRuleEnd - endType - 1), status);
+        LocalPointer<PluralFormat> pluralFormat(formatter->createPluralFormat(pluralType,
+                fRuleText.tempSubString(endType + 1, pluralRuleEnd - endType - 1), status));
+        if (U_FAILURE(status)) {
+            return;
+        }
+        if (pluralFormat.isNull()) {
+            status = U_MEMORY_ALLOCATION_ERROR;
+            return;
+        }
+        SharedPluralFormat *shared = new SharedPluralFormat(pluralFormat.getAlias());
+        if (shared == NULL) {
+            status = U_MEMORY_ALLOCATION_ERROR;
+            return;
+        }
+        pluralFormat.orphan();
+        shared->addRef();
+        rulePatternFormat = shared;
     }
 }
 
@@ -743,25 +822,9 @@ NFRule::doFormat(int64_t number, UnicodeString& toInsertInto, int32_t pos, int32
     // into the right places in toInsertInto (notice we do the
     // substitutions in reverse order so that the offsets don't get
     // messed up)
-    int32_t pluralRuleStart = fRuleText.length();
-    int32_t lengthOffset = 0;
-    if (!rulePatternFormat) {
-        toInsertInto.insert(pos, fRuleText);
-    }
-    else {
-        pluralRuleStart = fRuleText.indexOf(gDollarOpenParenthesis, -1, 0);
-        int pluralRuleEnd = fRuleText.indexOf(gClosedParenthesisDollar, -1, pluralRuleStart);
-        int initialLength = toInsertInto.length();
-        if (pluralRuleEnd < fRuleText.length() - 1) {
-            toInsertInto.insert(pos, fRuleText.tempSubString(pluralRuleEnd + 2));
-        }
-        toInsertInto.insert(pos,
-            rulePatternFormat->format((int32_t)(number/util64_pow(radix, exponent)), status));
-        if (pluralRuleStart > 0) {
-            toInsertInto.insert(pos, fRuleText.tempSubString(0, pluralRuleStart));
-        }
-        lengthOffset = fRuleText.length() - (toInsertInto.length() - initialLength);
-    }
+    int32_t pluralRuleStart;
+    int32_t pluralNumber = rulePatternFormat ? (int32_t)(number/util64_pow(radix, exponent)) : 0;
+    int32_t lengthOffset = insertRuleText(pluralNumber, toInsertInto, pos, pluralRuleStart, status);
 
     if (sub2 != NULL) {
         sub2->doSubstitution(number, toInsertInto, pos - (sub2->getPos() > pluralRuleStart ? lengthOffset : 0), recursionCount, status);
@@ -789,18 +852,9 @@ NFRule::doFormat(double number, UnicodeString& toInsertInto, int32_t pos, int32_
     // [again, we have two copies of this routine that do the same thing
     // so that we don't sacrifice precision in a long by casting it
     // to a double]
-    int32_t pluralRuleStart = fRuleText.length();
-    int32_t lengthOffset = 0;
-    if (!rulePatternFormat) {
-        toInsertInto.insert(pos, fRuleText);
-    }
-    else {
-        pluralRuleStart = fRuleText.indexOf(gDollarOpenParenthesis, -1, 0);
-        int pluralRuleEnd = fRuleText.indexOf(gClosedParenthesisDollar, -1, pluralRuleStart);
-        int initialLength = toInsertInto.length();
-        if (pluralRuleEnd < fRuleText.length() - 1) {
-            toInsertInto.insert(pos, fRuleText.tempSubString(pluralRuleEnd + 2));
-        }
+    int32_t pluralRuleStart;
+    int32_t pluralNumber = 0;
+    if (rulePatternFormat) {
         double pluralVal = number;
         if (0 <= pluralVal && pluralVal < 1) {
             // We're in a fractional rule, and we have to match the NumeratorSubstitution behavior.
@@ -810,12 +864,9 @@ NFRule::doFormat(double number, UnicodeString& toInsertInto, int32_t pos, int32_
         else {
             pluralVal = pluralVal / util64_pow(radix, exponent);
         }
-        toInsertInto.insert(pos, rulePatternFormat->format((int32_t)(pluralVal), status));
-        if (pluralRuleStart > 0) {
-            toInsertInto.insert(pos, fRuleText.tempSubString(0, pluralRuleStart));
-        }
-        lengthOffset = fRuleText.length() - (toInsertInto.length() - initialLength);
+        pluralNumber = (int32_t)(pluralVal);
     }
+    int32_t lengthOffset = insertRuleText(pluralNumber, toInsertInto, pos, pluralRuleStart, status);
 
     if (sub2 != NULL) {
         sub2->doSubstitution(number, toInsertInto, pos - (sub2->getPos() > pluralRuleStart ? lengthOffset : 0), recursionCount, status);
@@ -825,6 +876,38 @@ NFRule::doFormat(double number, UnicodeString& toInsertInto, int32_t pos, int32_
     }
 }
 
+/**
+* Inserts the rule's rule text into toInsertInto, with its plural pattern
+* (if any) resolved for pluralNumber.  The text is assembled in one buffer
+* so that toInsertInto is modified only once.
+* @param pluralNumber The number that selects the plural pattern's message
+* @param toInsertInto The string where the rule text should be inserted
+* @param pos The position in toInsertInto where the rule text should be
+* inserted
+* @param pluralRuleStart Receives the offset of the plural pattern in the
+* rule text, or the rule text's length if there is none
+* @return The length of the rule text minus the length of the inserted text
+*/
+int32_t
+NFRule::insertRuleText(int32_t pluralNumber, UnicodeString& toInsertInto, int32_t pos, int32_t& pluralRuleStart, UErrorCode& status) const
+{
+    if (!rulePatternFormat) {
+        pluralRuleStart = fRuleText.length();
+        toInsertInto.insert(pos, fRuleText);
+        return 0;
+    }
+    pluralRuleStart = fRuleText.indexOf(gDollarOpenParenthesis, -1, 0);
+    int32_t pluralRuleEnd = fRuleText.indexOf(gClosedParenthesisDollar, -1, pluralRuleStart);
+    UnicodeString ruleText(fRuleText, 0, pluralRuleStart);
+    FieldPosition fpos(FieldPosition::DONT_CARE);
+    rulePatternFormat->get()->format(pluralNumber, ruleText, fpos, status);
+    if (pluralRuleEnd < fRuleText.length() - 1) {
+        ruleText.append(fRuleText, pluralRuleEnd + 2, fRuleText.length() - pluralRuleEnd - 2);
+    }
+    toInsertInto.insert(pos, ruleText);
+    return fRuleText.length() - ruleText.length();
+}
+
 /**
 * Used by the owning rule set to determine whether to invoke the
 * rollback rule (i.e., whether this rule or the one that precedes
@@ -1309,10 +1392,15 @@ NFRule::prefixLength(const UnicodeString& str, const UnicodeString& prefix, UErr
             status = U_MEMORY_ALLOCATION_ERROR;
             return 0;
         }
+        // the prefix's collation elements are looked up once per formatter,
+        // so only the target string needs an iterator here
+        const UVector32* prefixPrimaries = formatter->getLenientPrimaries(prefix, status);
+        if (U_FAILURE(status)) {
+            return 0;
+        }
         LocalPointer<CollationElementIterator> strIter(collator->createCollationElementIterator(str));
-        LocalPointer<CollationElementIterator> prefixIter(collator->createCollationElementIterator(prefix));
         // Check for memory allocation error.
-        if (strIter.isNull() || prefixIter.isNull()) {
+        if (prefixPrimaries == NULL || strIter.isNull()) {
             status = U_MEMORY_ALLOCATION_ERROR;
             return 0;
         }
@@ -1338,9 +1426,10 @@ NFRule::prefixLength(const UnicodeString& str, const UnicodeString& prefix, UErr
 
         // match collation elements between the strings
         int32_t oStr = strIter->next(err);
-        int32_t oPrefix = prefixIter->next(err);
+        int32_t iPrefix = 0;
+        int32_t prefixCount = prefixPrimaries->size();
 
-        while (oPrefix != CollationElementIterator::NULLORDER) {
+        while (iPrefix < prefixCount) {
             // skip over ignorable characters in the target string
             while (CollationElementIterator::primaryOrder(oStr) == 0
                 && oStr != CollationElementIterator::NULLORDER) {
@@ -1348,9 +1437,8 @@ NFRule::prefixLength(const UnicodeString& str, const UnicodeString& prefix, UErr
             }
 
             // skip over ignorable characters in the prefix
-            while (CollationElementIterator::primaryOrder(oPrefix) == 0
-                && oPrefix != CollationElementIterator::NULLORDER) {
-                oPrefix = prefixIter->next(err);
+            while (iPrefix < prefixCount && prefixPrimaries->elementAti(iPrefix) == 0) {
+                ++iPrefix;
             }
 
             // dlf: move this above following test, if we consume the
@@ -1359,7 +1447,7 @@ NFRule::prefixLength(const UnicodeString& str, const UnicodeString& prefix, UErr
 
             // if skipping over ignorables brought to the end of
             // the prefix, we DID match: drop out of the loop
-            if (oPrefix == CollationElementIterator::NULLORDER) {
+            if (iPrefix == prefixCount) {
                 break;
             }
 
@@ -1373,7 +1461,7 @@ NFRule::prefixLength(const UnicodeString& str, const UnicodeString& prefix, UErr
             // (considering only primary differences).  If we
             // get a mismatch, dump out and return 0
             if (CollationElementIterator::primaryOrder(oStr)
-                != CollationElementIterator::primaryOrder(oPrefix)) {
+                != prefixPrimaries->elementAti(iPrefix)) {
                 return 0;
 
                 // otherwise, advance to the next character in each string
@@ -1381,7 +1469,7 @@ NFRule::prefixLength(const UnicodeString& str, const UnicodeString& prefix, UErr
                 // collation elements in the prefix)
             } else {
                 oStr = strIter->next(err);
-                oPrefix = prefixIter->next(err);
+                ++iPrefix;
             }
         }
 
@@ -1480,7 +1568,7 @@ NFRule::findText(const UnicodeString& str,
         Formattable result;
         FieldPosition position(UNUM_INTEGER_FIELD);
         position.setBeginIndex(startingAt);
-        rulePatternFormat->parseType(str, this, result, position);
+        rulePatternFormat->get()->parseType(str, this, result, position);
         int start = position.getBeginIndex();
         if (start >= 0) {
             int32_t pluralRuleStart = fRuleText.indexOf(gDollarOpenParenthesis, -1, 0);
@@ -1517,43 +1605,97 @@ NFRule::findTextLenient(const UnicodeString& str,
                  int32_t startingAt,
                  int32_t* length) const
 {
-    //----------------------------------------------------------------
-    // JDK 1.1 HACK (take out of 1.2-specific code)
-
-    // in JDK 1.2, CollationElementIterator provides us with an
-    // API to map between character offsets and collation elements
-    // and we can do this by marching through the string comparing
-    // collation elements.  We can't do that in JDK 1.1.  Insted,
-    // we have to go through this horrible slow mess:
-    int32_t p = startingAt;
-    int32_t keyLen = 0;
-
-    // basically just isolate smaller and smaller substrings of
-    // the target string (each running to the end of the string,
-    // and with the first one running from startingAt to the end)
-    // and then use prefixLength() to see if the search key is at
-    // the beginning of each substring.  This is excruciatingly
-    // slow, but it will locate the key and tell use how long the
-    // matching text was.
-    UnicodeString temp;
-    UErrorCode status = U_ZERO_ERROR;
-    while (p < str.length() && keyLen == 0) {
-        temp.setTo(str, p, str.length() - p);
-        keyLen = prefixLength(temp, key, status);
+    // an empty key never matches (its prefix length is always 0)
+    *length = 0;
+    if (key.length() == 0 || startingAt >= str.length()) {
+        return -1;
+    }
+
+#if !UCONFIG_NO_COLLATION
+    if (formatter->isLenient()) {
+        // Rather than calling prefixLength() on every suffix of the target
+        // string, collect the target's collation elements once, noting
+        // the offsets each one starts and ends at, and match the key's
+        // primary weights against them the same way prefixLength() does.
+        UErrorCode status = U_ZERO_ERROR;
+        const RuleBasedCollator* collator = formatter->getCollator();
+        const UVector32* keyPrimaries = formatter->getLenientPrimaries(key, status);
+        if (collator == NULL || keyPrimaries == NULL || U_FAILURE(status)) {
+            return -1;
+        }
+        LocalPointer<CollationElementIterator> iter(
+            collator->createCollationElementIterator(str.tempSubString(startingAt)));
+        if (iter.isNull()) {
+            return -1;
+        }
+        UVector32 primaries(status);
+        UVector32 starts(status);
+        UVector32 limits(status);
+        int32_t start = iter->getOffset();
+        for (int32_t o = iter->next(status);
+                o != CollationElementIterator::NULLORDER && U_SUCCESS(status);
+                o = iter->next(status)) {
+            int32_t limit = iter->getOffset();
+            primaries.addElement(CollationElementIterator::primaryOrder(o), status);
+            starts.addElement(start, status);
+            limits.addElement(limit, status);
+            start = limit;
+        }
         if (U_FAILURE(status)) {
-            break;
+            return -1;
         }
-        if (keyLen != 0) {
-            *length = keyLen;
-            return p;
+
+        int32_t textLength = str.length() - startingAt;
+        int32_t count = primaries.size();
+        int32_t keyCount = keyPrimaries->size();
+        for (int32_t i = 0; i < count; ++i) {
+            // a match can only begin where the collation elements of a
+            // character begin; the later elements of an expansion don't
+            // consume any text
+            if (limits.elementAti(i) == starts.elementAti(i)) {
+                continue;
+            }
+            int32_t t = i;
+            int32_t k = 0;
+            UBool matched = TRUE;
+            while (k < keyCount) {
+                while (t < count && primaries.elementAti(t) == 0) {
+                    ++t;
+                }
+                while (k < keyCount && keyPrimaries->elementAti(k) == 0) {
+                    ++k;
+                }
+                if (k == keyCount) {
+                    break;
+                }
+                if (t == count || primaries.elementAti(t) != keyPrimaries->elementAti(k)) {
+                    matched = FALSE;
+                    break;
+                }
+                ++t;
+                ++k;
+            }
+            if (!matched) {
+                continue;
+            }
+            // like prefixLength(), back over the element read after the match
+            int32_t end = t < count ? limits.elementAti(t) - 1 : textLength;
+            int32_t keyLen = end - starts.elementAti(i);
+            if (keyLen != 0) {
+                *length = keyLen;
+                return startingAt + starts.elementAti(i);
+            }
         }
-        ++p;
+        return -1;
     }
-    // if we make it to here, we didn't find it.  Return -1 for the
-    // location.  The length should be ignored, but set it to 0,
-    // which should be "safe"
-    *length = 0;
-    return -1;
+#endif
+
+    // without lenient parsing, the key has to match exactly
+    int32_t p = str.indexOf(key, startingAt);
+    if (p >= 0) {
+        *length = key.length();
+    }
+    return p;
 }
 
 /**
@@ -22,12 +22,14 @@ U_NAMESPACE_BEGIN
 
 class FieldPosition;
 class Formattable;
+class NFCopyContext;
 class NFRuleList;
 class NFRuleSet;
 class NFSubstitution;
 class ParsePosition;
 class PluralFormat;
 class RuleBasedNumberFormat;
+class SharedPluralFormat;
 class UnicodeString;
 
 class NFRule : public UMemory {
@@ -52,6 +54,7 @@ class NFRule : public UMemory {
                           UErrorCode& status);
 
     NFRule(const RuleBasedNumberFormat* rbnf, const UnicodeString &ruleText, UErrorCode &status);
+    NFRule(const NFRule& other, const NFCopyContext& context, UErrorCode& status);
     ~NFRule();
 
     UBool operator==(const NFRule& rhs) const;
@@ -88,6 +91,7 @@ class NFRule : public UMemory {
 
 private:
     void parseRuleDescriptor(UnicodeString& descriptor, UErrorCode& status);
+    int32_t insertRuleText(int32_t pluralNumber, UnicodeString& toInsertInto, int32_t pos, int32_t& pluralRuleStart, UErrorCode& status) const;
     void extractSubstitutions(const NFRuleSet* ruleSet, const UnicodeString &ruleText, const NFRule* predecessor, UErrorCode& status);
     NFSubstitution* extractSubstitution(const NFRuleSet* ruleSet, const NFRule* predecessor, UErrorCode& status);
     
@@ -113,7 +117,7 @@ class NFRule : public UMemory {
     NFSubstitution* sub1;
     NFSubstitution* sub2;
     const RuleBasedNumberFormat* formatter;
-    const PluralFormat* rulePatternFormat;
+    const SharedPluralFormat* rulePatternFormat;
 
     NFRule(const NFRule &other); // forbid copying of this class
     NFRule &operator=(const NFRule &other); // forbid copying of this class
@@ -56,6 +56,11 @@ class SameValueSubstitution : public NFSubstitution {
         const NFRuleSet* ruleset,
         const UnicodeString& description,
         UErrorCode& status);
+    SameValueSubstitution(const SameValueSubstitution& other, const NFCopyContext& context, UErrorCode& status)
+        : NFSubstitution(other, context, status) {}
+    virtual NFSubstitution* copy(const NFCopyContext& context, UErrorCode& status) const {
+        return new SameValueSubstitution(*this, context, status);
+    }
     virtual ~SameValueSubstitution();
 
     virtual int64_t transformNumber(int64_t number) const { return number; }
@@ -86,6 +91,11 @@ class MultiplierSubstitution : public NFSubstitution {
             status = U_PARSE_ERROR;
         }
     }
+    MultiplierSubstitution(const MultiplierSubstitution& other, const NFCopyContext& context, UErrorCode& status)
+        : NFSubstitution(other, context, status), divisor(other.divisor) {}
+    virtual NFSubstitution* copy(const NFCopyContext& context, UErrorCode& status) const {
+        return new MultiplierSubstitution(*this, context, status);
+    }
     virtual ~MultiplierSubstitution();
 
     virtual void setDivisor(int32_t radix, int16_t exponent, UErrorCode& status) { 
@@ -135,6 +145,11 @@ class ModulusSubstitution : public NFSubstitution {
         const NFRuleSet* ruleSet,
         const UnicodeString& description,
         UErrorCode& status);
+    ModulusSubstitution(const ModulusSubstitution& other, const NFCopyContext& context, UErrorCode& status)
+        : NFSubstitution(other, context, status), divisor(other.divisor), ruleToUse(context.mapRule(other.ruleToUse)) {}
+    virtual NFSubstitution* copy(const NFCopyContext& context, UErrorCode& status) const {
+        return new ModulusSubstitution(*this, context, status);
+    }
     virtual ~ModulusSubstitution();
 
     virtual void setDivisor(int32_t radix, int16_t exponent, UErrorCode& status) { 
@@ -187,6 +202,11 @@ class IntegralPartSubstitution : public NFSubstitution {
         const UnicodeString& description,
         UErrorCode& status)
         : NFSubstitution(_pos, _ruleSet, description, status) {}
+    IntegralPartSubstitution(const IntegralPartSubstitution& other, const NFCopyContext& context, UErrorCode& status)
+        : NFSubstitution(other, context, status) {}
+    virtual NFSubstitution* copy(const NFCopyContext& context, UErrorCode& status) const {
+        return new IntegralPartSubstitution(*this, context, status);
+    }
     virtual ~IntegralPartSubstitution();
 
     virtual int64_t transformNumber(int64_t number) const { return number; }
@@ -211,6 +231,11 @@ class FractionalPartSubstitution : public NFSubstitution {
         const NFRuleSet* ruleSet,
         const UnicodeString& description,
         UErrorCode& status);
+    FractionalPartSubstitution(const FractionalPartSubstitution& other, const NFCopyContext& context, UErrorCode& status)
+        : NFSubstitution(other, context, status), byDigits(other.byDigits), useSpaces(other.useSpaces) {}
+    virtual NFSubstitution* copy(const NFCopyContext& context, UErrorCode& status) const {
+        return new FractionalPartSubstitution(*this, context, status);
+    }
     virtual ~FractionalPartSubstitution();
 
     virtual UBool operator==(const NFSubstitution& rhs) const;
@@ -246,6 +271,11 @@ class AbsoluteValueSubstitution : public NFSubstitution {
         const UnicodeString& description,
         UErrorCode& status)
         : NFSubstitution(_pos, _ruleSet, description, status) {}
+    AbsoluteValueSubstitution(const AbsoluteValueSubstitution& other, const NFCopyContext& context, UErrorCode& status)
+        : NFSubstitution(other, context, status) {}
+    virtual NFSubstitution* copy(const NFCopyContext& context, UErrorCode& status) const {
+        return new AbsoluteValueSubstitution(*this, context, status);
+    }
     virtual ~AbsoluteValueSubstitution();
 
     virtual int64_t transformNumber(int64_t number) const { return number >= 0 ? number : -number; }
@@ -283,6 +313,11 @@ class NumeratorSubstitution : public NFSubstitution {
         ldenominator = util64_fromDouble(denominator);
         withZeros = description.endsWith(LTLT, 2);
     }
+    NumeratorSubstitution(const NumeratorSubstitution& other, const NFCopyContext& context, UErrorCode& status)
+        : NFSubstitution(other, context, status), denominator(other.denominator), ldenominator(other.ldenominator), withZeros(other.withZeros) {}
+    virtual NFSubstitution* copy(const NFCopyContext& context, UErrorCode& status) const {
+        return new NumeratorSubstitution(*this, context, status);
+    }
     virtual ~NumeratorSubstitution();
 
     virtual UBool operator==(const NFSubstitution& rhs) const;
@@ -479,6 +514,25 @@ NFSubstitution::NFSubstitution(int32_t _pos,
     }
 }
 
+/**
+ * Copies a substitution for the formatter that context builds: the rule
+ * set is mapped to that formatter's copy of it and the DecimalFormat, if
+ * any, is cloned.
+ */
+NFSubstitution::NFSubstitution(const NFSubstitution& other, const NFCopyContext& context, UErrorCode& status)
+    : UObject(other), pos(other.pos), ruleSet(context.mapRuleSet(other.ruleSet)), numberFormat(NULL)
+{
+    if (U_FAILURE(status)) {
+        return;
+    }
+    if (other.numberFormat != NULL) {
+        numberFormat = static_cast<DecimalFormat*>(other.numberFormat->clone());
+        if (numberFormat == NULL) {
+            status = U_MEMORY_ALLOCATION_ERROR;
+        }
+    }
+}
+
 NFSubstitution::~NFSubstitution()
 {
     delete numberFormat;
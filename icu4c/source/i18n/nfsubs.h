@@ -41,6 +41,8 @@ class NFSubstitution : public UObject {
         const NFRuleSet* ruleSet,
         const UnicodeString& description,
         UErrorCode& status);
+
+    NFSubstitution(const NFSubstitution& other, const NFCopyContext& context, UErrorCode& status);
     
     /**
      * Get the Ruleset of the object.
@@ -67,6 +69,14 @@ class NFSubstitution : public UObject {
      * Destructor.
      */
     virtual ~NFSubstitution();
+
+    /**
+     * Returns a copy of this substitution that refers to the rule sets
+     * of the formatter being built through context.
+     * @param context Maps this formatter's rule sets and rules to the copy's.
+     * @return The new substitution, or NULL if it can't be allocated.
+     */
+    virtual NFSubstitution* copy(const NFCopyContext& context, UErrorCode& status) const = 0;
     
     /**
      * Return true if the given Format objects are semantically equal.
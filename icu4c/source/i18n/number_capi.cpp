@@ -90,7 +90,8 @@ unumf_openForSkeletonAndLocale(const UChar* skeleton, int32_t skeletonLen, const
     }
     // Readonly-alias constructor (first argument is whether we are NUL-terminated)
     UnicodeString skeletonString(skeletonLen == -1, skeleton, skeletonLen);
-    impl->fFormatter = NumberFormatter::forSkeleton(skeletonString, *ec).locale(locale);
+    // The C API formatter is long-lived, so build its data structures up front.
+    impl->fFormatter = NumberFormatter::forSkeleton(skeletonString, *ec).locale(locale).toCompiled(*ec);
     return impl->exportForC();
 }
 
@@ -104,7 +105,9 @@ unumf_openForSkeletonAndLocaleWithError(const UChar* skeleton, int32_t skeletonL
     }
     // Readonly-alias constructor (first argument is whether we are NUL-terminated)
     UnicodeString skeletonString(skeletonLen == -1, skeleton, skeletonLen);
-    impl->fFormatter = NumberFormatter::forSkeleton(skeletonString, *perror, *ec).locale(locale);
+    // The C API formatter is long-lived, so build its data structures up front.
+    impl->fFormatter = NumberFormatter::forSkeleton(skeletonString, *perror, *ec)
+        .locale(locale).toCompiled(*ec);
     return impl->exportForC();
 }
 
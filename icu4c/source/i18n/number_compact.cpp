@@ -255,7 +255,6 @@ void CompactHandler::precomputeAllModifiers(MutablePatternModifier &buildReferen
 
     for (int32_t i = 0; i < precomputedModsLength; i++) {
         auto patternString = static_cast<const UChar *>(allPatterns[i]);
-        UnicodeString hello(patternString);
         CompactModInfo &info = precomputedMods[i];
         ParsedPatternInfo patternInfo;
         PatternParser::parseToPatternInfo(UnicodeString(patternString), patternInfo, status);
@@ -265,6 +264,28 @@ void CompactHandler::precomputeAllModifiers(MutablePatternModifier &buildReferen
         if (U_FAILURE(status)) { return; }
         info.patternString = patternString;
     }
+
+    // Resolve the plural and magnitude fallbacks of getPattern() once,
+    // so that processQuantity() can go straight to the modifier.
+    for (int32_t magnitude = 0; magnitude <= COMPACT_MAX_DIGITS; magnitude++) {
+        for (int32_t i = 0; i < StandardPlural::COUNT; i++) {
+            auto plural = static_cast<StandardPlural::Form>(i);
+            const UChar *patternString = data.getPattern(magnitude, plural);
+            int8_t &modIndex = precomputedModIndexes[getIndex(magnitude, plural)];
+            modIndex = -1;
+            if (patternString == nullptr) {
+                continue;
+            }
+            for (int32_t j = 0; j < precomputedModsLength; j++) {
+                if (u_strcmp(patternString, precomputedMods[j].patternString) == 0) {
+                    modIndex = static_cast<int8_t>(j);
+                    break;
+                }
+            }
+            // It should be guaranteed that we found the entry.
+            U_ASSERT(modIndex >= 0);
+        }
+    }
 }
 
 void CompactHandler::processQuantity(DecimalQuantity &quantity, MicroProps &micros,
@@ -285,32 +306,34 @@ void CompactHandler::processQuantity(DecimalQuantity &quantity, MicroProps &micr
     }
 
     StandardPlural::Form plural = utils::getStandardPlural(rules, quantity);
-    const UChar *patternString = data.getPattern(magnitude, plural);
-    if (patternString == nullptr) {
-        // Use the default (non-compact) modifier.
-        // No need to take any action.
-    } else if (safe) {
+    if (safe) {
         // Safe code path.
-        // Java uses a hash set here for O(1) lookup.  C++ uses a linear search.
-        // TODO: Benchmark this and maybe change to a binary search or hash table.
-        int32_t i = 0;
-        for (; i < precomputedModsLength; i++) {
-            const CompactModInfo &info = precomputedMods[i];
-            if (u_strcmp(patternString, info.patternString) == 0) {
-                info.mod->applyToMicros(micros, quantity, status);
-                break;
+        // The modifiers were looked up by magnitude and plural form in precomputeAllModifiers().
+        // Magnitudes above COMPACT_MAX_DIGITS use the patterns of the largest magnitude.
+        if (magnitude >= 0) {
+            if (magnitude > COMPACT_MAX_DIGITS) {
+                magnitude = COMPACT_MAX_DIGITS;
+            }
+            int32_t modIndex = precomputedModIndexes[getIndex(magnitude, plural)];
+            if (modIndex >= 0) {
+                precomputedMods[modIndex].mod->applyToMicros(micros, quantity, status);
             }
         }
-        // It should be guaranteed that we found the entry.
-        U_ASSERT(i < precomputedModsLength);
+        // Otherwise, use the default (non-compact) modifier.
     } else {
-        // Unsafe code path.
-        // Overwrite the PatternInfo in the existing modMiddle.
-        // C++ Note: Use unsafePatternInfo for proper lifecycle.
-        ParsedPatternInfo &patternInfo = const_cast<CompactHandler *>(this)->unsafePatternInfo;
-        PatternParser::parseToPatternInfo(UnicodeString(patternString), patternInfo, status);
-        static_cast<MutablePatternModifier*>(const_cast<Modifier*>(micros.modMiddle))
-            ->setPatternInfo(&patternInfo, UNUM_COMPACT_FIELD);
+        const UChar *patternString = data.getPattern(magnitude, plural);
+        if (patternString == nullptr) {
+            // Use the default (non-compact) modifier.
+            // No need to take any action.
+        } else {
+            // Unsafe code path.
+            // Overwrite the PatternInfo in the existing modMiddle.
+            // C++ Note: Use unsafePatternInfo for proper lifecycle.
+            ParsedPatternInfo &patternInfo = const_cast<CompactHandler *>(this)->unsafePatternInfo;
+            PatternParser::parseToPatternInfo(UnicodeString(patternString), patternInfo, status);
+            static_cast<MutablePatternModifier*>(const_cast<Modifier*>(micros.modMiddle))
+                ->setPatternInfo(&patternInfo, UNUM_COMPACT_FIELD);
+        }
     }
 
     // We already performed rounding. Do not perform it again.
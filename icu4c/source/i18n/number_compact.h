@@ -72,6 +72,9 @@ class CompactHandler : public MicroPropsGenerator, public UMemory {
     // Initial capacity of 12 for 0K, 00K, 000K, ...M, ...B, and ...T
     MaybeStackArray<CompactModInfo, 12> precomputedMods;
     int32_t precomputedModsLength = 0;
+    // Index into precomputedMods for each magnitude and plural form, or -1 if
+    // there is no compact pattern; used by the safe code path
+    int8_t precomputedModIndexes[(COMPACT_MAX_DIGITS + 1) * StandardPlural::COUNT];
     CompactData data;
     ParsedPatternInfo unsafePatternInfo;
     UBool safe;
@@ -67,6 +67,67 @@ static double DOUBLE_MULTIPLIERS[] = {
         1e20,
         1e21};
 
+/** Packed BCD of 0 through 99: tens digit in the high nibble, ones digit in the low nibble. */
+const uint8_t kBcdDigitPairs[100] = {
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+        0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
+        0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29,
+        0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
+        0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49,
+        0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59,
+        0x60, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+        0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79,
+        0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89,
+        0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99
+};
+
+/**
+ * Converts a positive integer below 10^16 to packed BCD, two digits per division.
+ * Sets precision to the number of digits.
+ */
+inline uint64_t toBcdLong(uint64_t n, int32_t& precision) {
+    uint64_t result = 0;
+    int32_t shift = 0;
+    for (; n >= 100; n /= 100, shift += 8) {
+        result |= static_cast<uint64_t>(kBcdDigitPairs[n % 100]) << shift;
+    }
+    result |= static_cast<uint64_t>(kBcdDigitPairs[n]) << shift;
+    precision = shift / 4 + (n >= 10 ? 2 : 1);
+    return result;
+}
+
+/**
+ * Largest coefficient handled by the integer arithmetic in multiplyBy(), divideBy() and
+ * roundToIncrement(); anything larger goes through DecNum.
+ */
+constexpr uint64_t kMaxFastCoefficient = 999999999999999999ULL;  // 18 digits
+
+/** Reads a finite DecNum of up to 18 digits as coefficient * 10^exponent. */
+bool getDecNumCoefficient(const DecNum& decnum, uint64_t& coefficient, int32_t& exponent) {
+    const decNumber* dn = decnum.getRawDecNumber();
+    if ((dn->bits & DECSPECIAL) != 0 || dn->digits > 18) {
+        return false;
+    }
+    // DECDPUN is 1: one digit per unit, least significant first.
+    coefficient = 0;
+    for (int32_t i = dn->digits - 1; i >= 0; i--) {
+        coefficient = coefficient * 10 + dn->lsu[i];
+    }
+    exponent = dn->exponent;
+    return true;
+}
+
+/** Multiplies n by 10^power if the result stays within kMaxFastCoefficient. */
+bool multiplyByPowerOfTen(uint64_t& n, int32_t power) {
+    for (; power > 0; power--) {
+        if (n > kMaxFastCoefficient / 10) {
+            return false;
+        }
+        n *= 10;
+    }
+    return true;
+}
+
 }  // namespace
 
 icu::IFixedDecimal::~IFixedDecimal() = default;
@@ -195,6 +256,39 @@ void DecimalQuantity::roundToIncrement(double roundingIncrement, RoundingMode ro
     incrementDN.setTo(roundingIncrement, status);
     if (U_FAILURE(status)) { return; }
 
+    // Fast path: align this quantity and the increment to the same power of ten,
+    // and round the integer quotient.
+    uint64_t coefficient;
+    uint64_t increment;
+    int32_t incrementExponent;
+    if (getCoefficient(coefficient) &&
+            getDecNumCoefficient(incrementDN, increment, incrementExponent) &&
+            increment != 0 && !incrementDN.isNegative()) {
+        int32_t magnitude = std::min(scale, incrementExponent);
+        if (multiplyByPowerOfTen(coefficient, scale - magnitude) &&
+                multiplyByPowerOfTen(increment, incrementExponent - magnitude)) {
+            uint64_t quotient = coefficient / increment;
+            uint64_t remainder = coefficient % increment;
+            if (remainder != 0) {
+                roundingutils::Section section = 2 * remainder < increment
+                        ? roundingutils::SECTION_LOWER
+                        : 2 * remainder == increment
+                            ? roundingutils::SECTION_MIDPOINT
+                            : roundingutils::SECTION_UPPER;
+                bool roundDown = roundingutils::getRoundingDirection(
+                        (quotient % 2) == 0, isNegative(), section, roundingMode, status);
+                if (U_FAILURE(status)) { return; }
+                if (!roundDown) {
+                    quotient++;
+                }
+            }
+            if (quotient <= kMaxFastCoefficient / increment) {
+                setToCoefficient(quotient * increment, magnitude, isNegative());
+                return;
+            }
+        }
+    }
+
     // Divide this DecimalQuantity by the increment, round, then multiply back.
     divideBy(incrementDN, status);
     if (U_FAILURE(status)) { return; }
@@ -208,6 +302,17 @@ void DecimalQuantity::multiplyBy(const DecNum& multiplicand, UErrorCode& status)
     if (isZeroish()) {
         return;
     }
+    // Fast path: multiply the coefficients if the product fits into 18 digits.
+    uint64_t coefficient;
+    uint64_t multiplier;
+    int32_t exponent;
+    if (getCoefficient(coefficient) &&
+            getDecNumCoefficient(multiplicand, multiplier, exponent) &&
+            multiplier != 0 && coefficient <= kMaxFastCoefficient / multiplier) {
+        setToCoefficient(coefficient * multiplier, scale + exponent,
+                         isNegative() != multiplicand.isNegative());
+        return;
+    }
     // Convert to DecNum, multiply, and convert back.
     DecNum decnum;
     toDecNum(decnum, status);
@@ -221,6 +326,17 @@ void DecimalQuantity::divideBy(const DecNum& divisor, UErrorCode& status) {
     if (isZeroish()) {
         return;
     }
+    // Fast path: divide the coefficients if the division is exact.
+    uint64_t coefficient;
+    uint64_t quotientDivisor;
+    int32_t exponent;
+    if (getCoefficient(coefficient) &&
+            getDecNumCoefficient(divisor, quotientDivisor, exponent) &&
+            quotientDivisor != 0 && coefficient % quotientDivisor == 0) {
+        setToCoefficient(coefficient / quotientDivisor, scale - exponent,
+                         isNegative() != divisor.isNegative());
+        return;
+    }
     // Convert to DecNum, multiply, and convert back.
     DecNum decnum;
     toDecNum(decnum, status);
@@ -230,6 +346,28 @@ void DecimalQuantity::divideBy(const DecNum& divisor, UErrorCode& status) {
     setToDecNum(decnum, status);
 }
 
+bool DecimalQuantity::getCoefficient(uint64_t& coefficient) const {
+    if (isApproximate || precision > 18 || (flags & (INFINITY_FLAG | NAN_FLAG)) != 0) {
+        return false;
+    }
+    coefficient = 0;
+    for (int32_t m = precision - 1; m >= 0; m--) {
+        coefficient = coefficient * 10 + getDigitPos(m);
+    }
+    return true;
+}
+
+void DecimalQuantity::setToCoefficient(uint64_t coefficient, int32_t newScale, bool negative) {
+    U_ASSERT(coefficient <= kMaxFastCoefficient);
+    setBcdToZero();
+    flags = negative ? NEGATIVE_FLAG : 0;
+    if (coefficient != 0) {
+        _setToLong(static_cast<int64_t>(coefficient));
+        scale = newScale;
+        compact();
+    }
+}
+
 void DecimalQuantity::negate() {
     flags ^= NEGATIVE_FLAG;
 }
@@ -463,6 +601,31 @@ void DecimalQuantity::convertToAccurateDouble() {
     U_ASSERT(origDouble != 0);
     int32_t delta = origDelta;
 
+    // Fast path: the digits from _setToDoubleFast() are the shortest representation already if there
+    // are at most 15 of them and they convert back to exactly the original double, since distinct
+    // decimals with at most 15 significant digits never round to the same double. This covers most
+    // real-world values (prices, measurements, percentages) without calling the oracle.
+    if (!usingBytes && precision > 0 && precision <= 15) {
+        int32_t exponent = scale - delta;
+        if (exponent > -22 && exponent < 22) {
+            uint64_t digits = 0;
+            for (int32_t i = precision - 1; i >= 0; i--) {
+                digits = digits * 10 + getDigitPos(i);
+            }
+            // Both operands below are exact, so the result is correctly rounded.
+            double roundTrip = exponent < 0
+                ? static_cast<double>(digits) / DOUBLE_MULTIPLIERS[-exponent]
+                : static_cast<double>(digits) * DOUBLE_MULTIPLIERS[exponent];
+            if (roundTrip == origDouble) {
+                isApproximate = false;
+                origDouble = 0;
+                origDelta = 0;
+                explicitExactDouble = true;
+                return;
+            }
+        }
+    }
+
     // Call the slow oracle function (Double.toString in Java, DoubleToAscii in C++).
     char buffer[DoubleToStringConverter::kBase10MaximalLength + 1];
     bool sign; // unused; always positive
@@ -1024,17 +1187,11 @@ void DecimalQuantity::setBcdToZero() {
 }
 
 void DecimalQuantity::readIntToBcd(int32_t n) {
-    U_ASSERT(n != 0);
+    U_ASSERT(n > 0);
     // ints always fit inside the long implementation.
-    uint64_t result = 0L;
-    int i = 16;
-    for (; n != 0; n /= 10, i--) {
-        result = (result >> 4) + ((static_cast<uint64_t>(n) % 10) << 60);
-    }
     U_ASSERT(!usingBytes);
-    fBCD.bcdLong = result >> (i * 4);
+    fBCD.bcdLong = toBcdLong(static_cast<uint64_t>(n), precision);
     scale = 0;
-    precision = 16 - i;
 }
 
 void DecimalQuantity::readLongToBcd(int64_t n) {
@@ -1049,16 +1206,10 @@ void DecimalQuantity::readLongToBcd(int64_t n) {
         scale = 0;
         precision = i;
     } else {
-        uint64_t result = 0L;
-        int i = 16;
-        for (; n != 0L; n /= 10L, i--) {
-            result = (result >> 4) + ((n % 10) << 60);
-        }
-        U_ASSERT(i >= 0);
+        U_ASSERT(n > 0);
         U_ASSERT(!usingBytes);
-        fBCD.bcdLong = result >> (i * 4);
+        fBCD.bcdLong = toBcdLong(static_cast<uint64_t>(n), precision);
         scale = 0;
-        precision = 16 - i;
     }
 }
 
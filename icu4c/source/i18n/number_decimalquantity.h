@@ -445,6 +445,18 @@ class U_I18N_API DecimalQuantity : public IFixedDecimal, public UMemory {
 
     void readDecNumberToBcd(const DecNum& dn);
 
+    /**
+     * Gets the digits as an integer, to be multiplied by 10^scale. Returns false if the
+     * quantity is approximate, infinite, NaN, or has more than 18 digits.
+     */
+    bool getCoefficient(uint64_t& coefficient) const;
+
+    /**
+     * Sets this quantity to coefficient * 10^newScale, which must have at most 18 digits.
+     * Clears all flags except for the sign.
+     */
+    void setToCoefficient(uint64_t coefficient, int32_t newScale, bool negative);
+
     void readDoubleConversionToBcd(const char* buffer, int32_t length, int32_t point);
 
     void copyFieldsFrom(const DecimalQuantity& other);
@@ -7,6 +7,7 @@
 
 #include "uassert.h"
 #include "unicode/numberformatter.h"
+#include "unicode/ustring.h"
 #include "number_decimalquantity.h"
 #include "number_formatimpl.h"
 #include "umutex.h"
@@ -14,8 +15,10 @@
 #include "number_skeletons.h"
 #include "number_utils.h"
 #include "number_utypes.h"
+#include "ustr_imp.h"
 #include "util.h"
 #include "fphdlimp.h"
+#include "utracimp.h"
 
 using namespace icu;
 using namespace icu::number;
@@ -682,16 +685,140 @@ LocalizedNumberFormatter::formatDecimalQuantity(const DecimalQuantity& dq, UErro
     }
 }
 
+int32_t LocalizedNumberFormatter::formatInt(int64_t value, char16_t* dest, int32_t destCapacity,
+                                            UErrorCode& status) const {
+    UFormattedNumberData results;
+    results.quantity.setToLong(value);
+    return formatToBuffer(results, dest, destCapacity, status);
+}
+
+int32_t LocalizedNumberFormatter::formatDouble(double value, char16_t* dest, int32_t destCapacity,
+                                               UErrorCode& status) const {
+    UFormattedNumberData results;
+    results.quantity.setToDouble(value);
+    return formatToBuffer(results, dest, destCapacity, status);
+}
+
+int32_t LocalizedNumberFormatter::formatIntUTF8(int64_t value, char* dest, int32_t destCapacity,
+                                                UErrorCode& status) const {
+    UFormattedNumberData results;
+    results.quantity.setToLong(value);
+    return formatToBuffer(results, dest, destCapacity, status);
+}
+
+int32_t LocalizedNumberFormatter::formatDoubleUTF8(double value, char* dest, int32_t destCapacity,
+                                                   UErrorCode& status) const {
+    UFormattedNumberData results;
+    results.quantity.setToDouble(value);
+    return formatToBuffer(results, dest, destCapacity, status);
+}
+
+int32_t LocalizedNumberFormatter::formatToBuffer(UFormattedNumberData& results, char16_t* dest,
+                                                 int32_t destCapacity, UErrorCode& status) const {
+    if (U_FAILURE(status)) { return 0; }
+    if (destCapacity < 0 || (dest == nullptr && destCapacity > 0)) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    formatImpl(&results, status);
+    if (U_FAILURE(status)) { return 0; }
+    // Read-only alias of the builder's chars; extract() applies the preflighting convention.
+    return results.getStringRef().toTempUnicodeString().extract(dest, destCapacity, status);
+}
+
+int32_t LocalizedNumberFormatter::formatToBuffer(UFormattedNumberData& results, char* dest,
+                                                 int32_t destCapacity, UErrorCode& status) const {
+    if (U_FAILURE(status)) { return 0; }
+    if (destCapacity < 0 || (dest == nullptr && destCapacity > 0)) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    formatImpl(&results, status);
+    if (U_FAILURE(status)) { return 0; }
+    const UnicodeString temp = results.getStringRef().toTempUnicodeString();
+    int32_t length = 0;
+    u_strToUTF8(dest, destCapacity, &length, temp.getBuffer(), temp.length(), &status);
+    return length;
+}
+
+int32_t LocalizedNumberFormatter::formatBatch(const double* values, int32_t count, char16_t* dest,
+                                              int32_t destCapacity, int32_t* offsets,
+                                              UErrorCode& status) const {
+    return formatBatchImpl(values, nullptr, count, dest, destCapacity, offsets, status);
+}
+
+int32_t LocalizedNumberFormatter::formatBatch(const int64_t* values, int32_t count, char16_t* dest,
+                                              int32_t destCapacity, int32_t* offsets,
+                                              UErrorCode& status) const {
+    return formatBatchImpl(nullptr, values, count, dest, destCapacity, offsets, status);
+}
+
+int32_t LocalizedNumberFormatter::formatBatchImpl(const double* doubles, const int64_t* ints,
+                                                  int32_t count, char16_t* dest, int32_t destCapacity,
+                                                  int32_t* offsets, UErrorCode& status) const {
+    if (U_FAILURE(status)) { return 0; }
+    if (count < 0 || (doubles == nullptr && ints == nullptr && count > 0) ||
+            destCapacity < 0 || (dest == nullptr && destCapacity > 0)) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    if (fMacros.copyErrorTo(status)) { return 0; }
+
+    // Use the compiled formatter if it is ready. Otherwise build one for this batch only, so that the
+    // micro-props chain and the modifiers are set up once rather than once per value.
+    const NumberFormatterImpl* compiled = nullptr;
+    LocalPointer<const NumberFormatterImpl> batchCompiled;
+    if (getCallCount() < 0) {
+        compiled = fCompiled;
+    } else {
+        batchCompiled.adoptInsteadAndCheckErrorCode(new NumberFormatterImpl(fMacros, status), status);
+        compiled = batchCompiled.getAlias();
+    }
+    if (U_FAILURE(status)) { return 0; }
+
+    DecimalQuantity quantity;
+    FormattedStringBuilder string;
+    int32_t total = 0;
+    for (int32_t i = 0; i < count; i++) {
+        if (doubles != nullptr) {
+            quantity.setToDouble(doubles[i]);
+        } else {
+            quantity.setToLong(ints[i]);
+        }
+        string.clear();
+        compiled->format(quantity, string, status);
+        if (U_FAILURE(status)) { return 0; }
+        int32_t length = string.length();
+        if (length > INT32_MAX - total) {
+            status = U_INDEX_OUTOFBOUNDS_ERROR;
+            return 0;
+        }
+        if (offsets != nullptr) {
+            offsets[i] = total;
+        }
+        if (length <= destCapacity - total) {
+            const UnicodeString temp = string.toTempUnicodeString();
+            u_memcpy(dest + total, temp.getBuffer(), length);
+        }
+        total += length;
+    }
+    if (offsets != nullptr) {
+        offsets[count] = total;
+    }
+    return u_terminateUChars(dest, destCapacity, total, &status);
+}
+
 void LocalizedNumberFormatter::formatImpl(impl::UFormattedNumberData* results, UErrorCode& status) const {
+    UTRACE_ENTRY(UTRACE_UNUM_FORMAT);
     if (computeCompiled(status)) {
         fCompiled->format(results->quantity, results->getStringRef(), status);
     } else {
         NumberFormatterImpl::formatStatic(fMacros, results->quantity, results->getStringRef(), status);
     }
-    if (U_FAILURE(status)) {
-        return;
+    if (U_SUCCESS(status)) {
+        results->getStringRef().writeTerminator(status);
     }
-    results->getStringRef().writeTerminator(status);
+    UTRACE_EXIT_STATUS(status);
 }
 
 void LocalizedNumberFormatter::getAffixImpl(bool isPrefix, bool isNegative, UnicodeString& result,
@@ -756,6 +883,37 @@ bool LocalizedNumberFormatter::computeCompiled(UErrorCode& status) const {
     }
 }
 
+void LocalizedNumberFormatter::compileEagerly(UErrorCode& status) {
+    if (U_FAILURE(status) || fMacros.copyErrorTo(status) || fCompiled != nullptr) {
+        return;
+    }
+    const NumberFormatterImpl* compiled = new NumberFormatterImpl(fMacros, status);
+    if (compiled == nullptr) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    if (U_FAILURE(status)) {
+        delete compiled;
+        return;
+    }
+    // Same state as after computeCompiled() built the formatter.
+    fCompiled = compiled;
+    auto* callCount = reinterpret_cast<u_atomic_int32_t*>(fUnsafeCallCount);
+    umtx_storeRelease(*callCount, INT32_MIN);
+}
+
+LocalizedNumberFormatter LocalizedNumberFormatter::toCompiled(UErrorCode& status) const& {
+    LocalizedNumberFormatter copy(*this);
+    copy.compileEagerly(status);
+    return copy;
+}
+
+LocalizedNumberFormatter LocalizedNumberFormatter::toCompiled(UErrorCode& status)&& {
+    LocalizedNumberFormatter move(std::move(*this));
+    move.compileEagerly(status);
+    return move;
+}
+
 const impl::NumberFormatterImpl* LocalizedNumberFormatter::getCompiled() const {
     return fCompiled;
 }
@@ -15,6 +15,9 @@
 #include <algorithm>
 #include "cstring.h"
 #include "util.h"
+#include "sharedobject.h"
+#include "unifiedcache.h"
+#include "ustr_imp.h"
 
 using namespace icu;
 using namespace icu::number;
@@ -179,26 +182,183 @@ UnicodeString getPerUnitFormat(const Locale& locale, const UNumberUnitWidth &wid
     return UnicodeString(ptr, len);
 }
 
+void simpleFormatsToPatterns(const UnicodeString *simpleFormats, SimpleFormatter *outPatterns,
+                             UErrorCode &status) {
+    for (int32_t i = 0; i < StandardPlural::Form::COUNT; i++) {
+        StandardPlural::Form plural = static_cast<StandardPlural::Form>(i);
+        UnicodeString simpleFormat = getWithPlural(simpleFormats, plural, status);
+        if (U_FAILURE(status)) { return; }
+        outPatterns[i].applyPatternMinMaxArguments(simpleFormat, 0, 1, status);
+        if (U_FAILURE(status)) { return; }
+    }
+}
+
+void multiSimpleFormatsToPatterns(const UnicodeString *leadFormats, UnicodeString trailFormat,
+                                  SimpleFormatter *outPatterns, UErrorCode &status) {
+    SimpleFormatter trailCompiled(trailFormat, 1, 1, status);
+    if (U_FAILURE(status)) { return; }
+    for (int32_t i = 0; i < StandardPlural::Form::COUNT; i++) {
+        StandardPlural::Form plural = static_cast<StandardPlural::Form>(i);
+        UnicodeString leadFormat = getWithPlural(leadFormats, plural, status);
+        if (U_FAILURE(status)) { return; }
+        UnicodeString compoundFormat;
+        trailCompiled.format(leadFormat, compoundFormat, status);
+        if (U_FAILURE(status)) { return; }
+        outPatterns[i].applyPatternMinMaxArguments(compoundFormat, 0, 1, status);
+        if (U_FAILURE(status)) { return; }
+    }
+}
+
+/** Loads and compiles the patterns for unit, or for unit per perUnit if perUnit is not "none". */
+void getMeasurePatterns(const Locale &loc, const MeasureUnit &unit, const MeasureUnit &perUnit,
+                        const UNumberUnitWidth &width, SimpleFormatter *outPatterns, UErrorCode &status) {
+    UnicodeString primaryData[ARRAY_LENGTH];
+    getMeasureData(loc, unit, width, primaryData, status);
+    if (U_FAILURE(status)) { return; }
+    if (uprv_strcmp(perUnit.getType(), "none") == 0) {
+        simpleFormatsToPatterns(primaryData, outPatterns, status);
+        return;
+    }
+    UnicodeString secondaryData[ARRAY_LENGTH];
+    getMeasureData(loc, perUnit, width, secondaryData, status);
+    if (U_FAILURE(status)) { return; }
+
+    UnicodeString perUnitFormat;
+    if (!secondaryData[PER_INDEX].isBogus()) {
+        perUnitFormat = secondaryData[PER_INDEX];
+    } else {
+        UnicodeString rawPerUnitFormat = getPerUnitFormat(loc, width, status);
+        if (U_FAILURE(status)) { return; }
+        // rawPerUnitFormat is something like "{0}/{1}"; we need to substitute in the secondary unit.
+        SimpleFormatter compiled(rawPerUnitFormat, 2, 2, status);
+        if (U_FAILURE(status)) { return; }
+        UnicodeString secondaryFormat = getWithPlural(secondaryData, StandardPlural::Form::ONE, status);
+        if (U_FAILURE(status)) { return; }
+        SimpleFormatter secondaryCompiled(secondaryFormat, 1, 1, status);
+        if (U_FAILURE(status)) { return; }
+        UnicodeString secondaryString = secondaryCompiled.getTextWithNoArguments().trim();
+        // TODO: Why does UnicodeString need to be explicit in the following line?
+        compiled.format(UnicodeString(u"{0}"), secondaryString, perUnitFormat, status);
+        if (U_FAILURE(status)) { return; }
+    }
+    multiSimpleFormatsToPatterns(primaryData, perUnitFormat, outPatterns, status);
+}
+
 ////////////////////////
 /// END DATA LOADING ///
 ////////////////////////
 
 } // namespace
 
+U_NAMESPACE_BEGIN
+namespace number {
+namespace impl {
+
+/**
+ * The compiled unit patterns for each plural form of one locale, unit,
+ * per-unit and width. They are the same for every formatter with those
+ * settings, so they are loaded once and shared through the UnifiedCache.
+ */
+class LongNamePatterns : public SharedObject {
+  public:
+    SimpleFormatter patterns[StandardPlural::Form::COUNT];
+    virtual ~LongNamePatterns();
+};
+
+LongNamePatterns::~LongNamePatterns() {}
+
+class LongNamePatternsKey : public LocaleCacheKey<LongNamePatterns> {
+  private:
+    MeasureUnit fUnit;
+    MeasureUnit fPerUnit;
+    UNumberUnitWidth fWidth;
+
+    static int32_t hashUnit(const MeasureUnit &unit) {
+        return 37 * ustr_hashCharsN(unit.getType(), static_cast<int32_t>(uprv_strlen(unit.getType()))) +
+               ustr_hashCharsN(unit.getSubtype(), static_cast<int32_t>(uprv_strlen(unit.getSubtype())));
+    }
+
+    static bool equalUnits(const MeasureUnit &a, const MeasureUnit &b) {
+        return uprv_strcmp(a.getType(), b.getType()) == 0 &&
+               uprv_strcmp(a.getSubtype(), b.getSubtype()) == 0;
+    }
+
+  public:
+    LongNamePatternsKey(const Locale &loc, const MeasureUnit &unit, const MeasureUnit &perUnit,
+                        UNumberUnitWidth width)
+            : LocaleCacheKey<LongNamePatterns>(loc), fUnit(unit), fPerUnit(perUnit), fWidth(width) {}
+
+    LongNamePatternsKey(const LongNamePatternsKey &other)
+            : LocaleCacheKey<LongNamePatterns>(other), fUnit(other.fUnit), fPerUnit(other.fPerUnit),
+              fWidth(other.fWidth) {}
+
+    virtual ~LongNamePatternsKey();
+
+    virtual int32_t hashCode() const {
+        int32_t hash = LocaleCacheKey<LongNamePatterns>::hashCode();
+        hash = 37 * hash + hashUnit(fUnit);
+        hash = 37 * hash + hashUnit(fPerUnit);
+        return 37 * hash + static_cast<int32_t>(fWidth);
+    }
+
+    virtual UBool operator==(const CacheKeyBase &other) const {
+        if (this == &other) {
+            return TRUE;
+        }
+        if (!LocaleCacheKey<LongNamePatterns>::operator==(other)) {
+            return FALSE;
+        }
+        // We know that this and other are of same class if we get this far.
+        const LongNamePatternsKey &realOther = static_cast<const LongNamePatternsKey &>(other);
+        return fWidth == realOther.fWidth && equalUnits(fUnit, realOther.fUnit) &&
+               equalUnits(fPerUnit, realOther.fPerUnit);
+    }
+
+    virtual CacheKeyBase *clone() const {
+        return new LongNamePatternsKey(*this);
+    }
+
+    virtual const LongNamePatterns *createObject(const void * /*unused*/, UErrorCode &status) const {
+        LocalPointer<LongNamePatterns> result(new LongNamePatterns(), status);
+        if (U_FAILURE(status)) {
+            return nullptr;
+        }
+        getMeasurePatterns(fLoc, fUnit, fPerUnit, fWidth, result->patterns, status);
+        if (U_FAILURE(status)) {
+            return nullptr;
+        }
+        result->addRef();
+        return result.orphan();
+    }
+};
+
+LongNamePatternsKey::~LongNamePatternsKey() {}
+
+}  // namespace impl
+}  // namespace number
+
+template<> U_I18N_API
+const number::impl::LongNamePatterns *LocaleCacheKey<number::impl::LongNamePatterns>::createObject(
+        const void * /*unused*/, UErrorCode &status) const {
+    status = U_UNSUPPORTED_ERROR;
+    return nullptr;
+}
+
+U_NAMESPACE_END
+
 LongNameHandler*
-LongNameHandler::forMeasureUnit(const Locale &loc, const MeasureUnit &unitRef, const MeasureUnit &perUnit,
+LongNameHandler::forMeasureUnit(const Locale &loc, const MeasureUnit &unitRef, const MeasureUnit &perUnitRef,
                                 const UNumberUnitWidth &width, const PluralRules *rules,
                                 const MicroPropsGenerator *parent, UErrorCode &status) {
     MeasureUnit unit = unitRef;
+    MeasureUnit perUnit = perUnitRef;
     if (uprv_strcmp(perUnit.getType(), "none") != 0) {
         // Compound unit: first try to simplify (e.g., meters per second is its own unit).
         bool isResolved = false;
         MeasureUnit resolved = MeasureUnit::resolveUnitPerUnit(unit, perUnit, &isResolved);
         if (isResolved) {
             unit = resolved;
-        } else {
-            // No simplified form is available.
-            return forCompoundUnit(loc, unit, perUnit, width, rules, parent, status);
+            perUnit = MeasureUnit();
         }
     }
 
@@ -207,48 +367,13 @@ LongNameHandler::forMeasureUnit(const Locale &loc, const MeasureUnit &unitRef, c
         status = U_MEMORY_ALLOCATION_ERROR;
         return nullptr;
     }
-    UnicodeString simpleFormats[ARRAY_LENGTH];
-    getMeasureData(loc, unit, width, simpleFormats, status);
+    const UnifiedCache *cache = UnifiedCache::getInstance(status);
     if (U_FAILURE(status)) { return result; }
-    result->simpleFormatsToModifiers(simpleFormats, UNUM_MEASURE_UNIT_FIELD, status);
-    return result;
-}
-
-LongNameHandler*
-LongNameHandler::forCompoundUnit(const Locale &loc, const MeasureUnit &unit, const MeasureUnit &perUnit,
-                                 const UNumberUnitWidth &width, const PluralRules *rules,
-                                 const MicroPropsGenerator *parent, UErrorCode &status) {
-    auto* result = new LongNameHandler(rules, parent);
-    if (result == nullptr) {
-        status = U_MEMORY_ALLOCATION_ERROR;
-        return nullptr;
-    }
-    UnicodeString primaryData[ARRAY_LENGTH];
-    getMeasureData(loc, unit, width, primaryData, status);
+    const LongNamePatterns *patterns = nullptr;
+    cache->get(LongNamePatternsKey(loc, unit, perUnit, width), patterns, status);
     if (U_FAILURE(status)) { return result; }
-    UnicodeString secondaryData[ARRAY_LENGTH];
-    getMeasureData(loc, perUnit, width, secondaryData, status);
-    if (U_FAILURE(status)) { return result; }
-
-    UnicodeString perUnitFormat;
-    if (!secondaryData[PER_INDEX].isBogus()) {
-        perUnitFormat = secondaryData[PER_INDEX];
-    } else {
-        UnicodeString rawPerUnitFormat = getPerUnitFormat(loc, width, status);
-        if (U_FAILURE(status)) { return result; }
-        // rawPerUnitFormat is something like "{0}/{1}"; we need to substitute in the secondary unit.
-        SimpleFormatter compiled(rawPerUnitFormat, 2, 2, status);
-        if (U_FAILURE(status)) { return result; }
-        UnicodeString secondaryFormat = getWithPlural(secondaryData, StandardPlural::Form::ONE, status);
-        if (U_FAILURE(status)) { return result; }
-        SimpleFormatter secondaryCompiled(secondaryFormat, 1, 1, status);
-        if (U_FAILURE(status)) { return result; }
-        UnicodeString secondaryString = secondaryCompiled.getTextWithNoArguments().trim();
-        // TODO: Why does UnicodeString need to be explicit in the following line?
-        compiled.format(UnicodeString(u"{0}"), secondaryString, perUnitFormat, status);
-        if (U_FAILURE(status)) { return result; }
-    }
-    result->multiSimpleFormatsToModifiers(primaryData, perUnitFormat, UNUM_MEASURE_UNIT_FIELD, status);
+    result->patternsToModifiers(patterns->patterns, UNUM_MEASURE_UNIT_FIELD);
+    patterns->removeRef();
     return result;
 }
 
@@ -277,36 +402,17 @@ LongNameHandler* LongNameHandler::forCurrencyLongNames(const Locale &loc, const
     UnicodeString simpleFormats[ARRAY_LENGTH];
     getCurrencyLongNameData(loc, currency, simpleFormats, status);
     if (U_FAILURE(status)) { return nullptr; }
-    result->simpleFormatsToModifiers(simpleFormats, UNUM_CURRENCY_FIELD, status);
+    SimpleFormatter patterns[StandardPlural::Form::COUNT];
+    simpleFormatsToPatterns(simpleFormats, patterns, status);
+    if (U_FAILURE(status)) { return result; }
+    result->patternsToModifiers(patterns, UNUM_CURRENCY_FIELD);
     return result;
 }
 
-void LongNameHandler::simpleFormatsToModifiers(const UnicodeString *simpleFormats, Field field,
-                                               UErrorCode &status) {
+void LongNameHandler::patternsToModifiers(const SimpleFormatter *patterns, Field field) {
     for (int32_t i = 0; i < StandardPlural::Form::COUNT; i++) {
         StandardPlural::Form plural = static_cast<StandardPlural::Form>(i);
-        UnicodeString simpleFormat = getWithPlural(simpleFormats, plural, status);
-        if (U_FAILURE(status)) { return; }
-        SimpleFormatter compiledFormatter(simpleFormat, 0, 1, status);
-        if (U_FAILURE(status)) { return; }
-        fModifiers[i] = SimpleModifier(compiledFormatter, field, false, {this, SIGNUM_ZERO, plural});
-    }
-}
-
-void LongNameHandler::multiSimpleFormatsToModifiers(const UnicodeString *leadFormats, UnicodeString trailFormat,
-                                                    Field field, UErrorCode &status) {
-    SimpleFormatter trailCompiled(trailFormat, 1, 1, status);
-    if (U_FAILURE(status)) { return; }
-    for (int32_t i = 0; i < StandardPlural::Form::COUNT; i++) {
-        StandardPlural::Form plural = static_cast<StandardPlural::Form>(i);
-        UnicodeString leadFormat = getWithPlural(leadFormats, plural, status);
-        if (U_FAILURE(status)) { return; }
-        UnicodeString compoundFormat;
-        trailCompiled.format(leadFormat, compoundFormat, status);
-        if (U_FAILURE(status)) { return; }
-        SimpleFormatter compoundCompiled(compoundFormat, 0, 1, status);
-        if (U_FAILURE(status)) { return; }
-        fModifiers[i] = SimpleModifier(compoundCompiled, field, false, {this, SIGNUM_ZERO, plural});
+        fModifiers[i] = SimpleModifier(patterns[i], field, false, {this, SIGNUM_ZERO, plural});
     }
 }
 
@@ -44,14 +44,7 @@ class LongNameHandler : public MicroPropsGenerator, public ModifierStore, public
     LongNameHandler(const PluralRules *rules, const MicroPropsGenerator *parent)
             : rules(rules), parent(parent) {}
 
-    static LongNameHandler*
-    forCompoundUnit(const Locale &loc, const MeasureUnit &unit, const MeasureUnit &perUnit,
-                    const UNumberUnitWidth &width, const PluralRules *rules,
-                    const MicroPropsGenerator *parent, UErrorCode &status);
-
-    void simpleFormatsToModifiers(const UnicodeString *simpleFormats, Field field, UErrorCode &status);
-    void multiSimpleFormatsToModifiers(const UnicodeString *leadFormats, UnicodeString trailFormat,
-                                       Field field, UErrorCode &status);
+    void patternsToModifiers(const SimpleFormatter *patterns, Field field);
 };
 
 }  // namespace impl
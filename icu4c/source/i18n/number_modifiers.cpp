@@ -5,6 +5,7 @@
 
 #if !UCONFIG_NO_FORMATTING
 
+#include "unicode/uchar.h"
 #include "umutex.h"
 #include "ucln_cmn.h"
 #include "ucln_in.h"
@@ -38,12 +39,15 @@ UBool U_CALLCONV cleanupDefaultCurrencySpacing() {
 
 void U_CALLCONV initDefaultCurrencySpacing(UErrorCode &status) {
     ucln_i18n_registerCleanup(UCLN_I18N_CURRENCY_SPACING, cleanupDefaultCurrencySpacing);
-    UNISET_DIGIT = new UnicodeSet(UnicodeString(u"[:digit:]"), status);
-    UNISET_NOTS = new UnicodeSet(UnicodeString(u"[:^S:]"), status);
+    // [:digit:] and [:^S:], built from the property data without parsing the patterns.
+    UNISET_DIGIT = new UnicodeSet();
+    UNISET_NOTS = new UnicodeSet();
     if (UNISET_DIGIT == nullptr || UNISET_NOTS == nullptr) {
         status = U_MEMORY_ALLOCATION_ERROR;
         return;
     }
+    UNISET_DIGIT->applyIntPropertyValue(UCHAR_GENERAL_CATEGORY_MASK, U_GC_ND_MASK, status);
+    UNISET_NOTS->applyIntPropertyValue(UCHAR_GENERAL_CATEGORY_MASK, U_GC_S_MASK, status).complement();
     UNISET_DIGIT->freeze();
     UNISET_NOTS->freeze();
 }
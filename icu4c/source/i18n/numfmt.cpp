@@ -1039,7 +1039,7 @@ NumberFormat::internalCreateInstance(const Locale& loc, UNumberFormatStyle kind,
         }
     }
 #if !UCONFIG_NO_SERVICE
-    if (haveService()) {
+    if (haveService() && !gService->isDefault()) {
         return (NumberFormat*)gService->get(loc, kind, status);
     }
 #endif
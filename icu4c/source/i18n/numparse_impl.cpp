@@ -231,6 +231,25 @@ void NumberParserImpl::addMatcher(NumberParseMatcher& matcher) {
 
 void NumberParserImpl::freeze() {
     fFrozen = true;
+
+    // Smoke tests depend only on the first code point of the segment. Precompute them for Latin-1,
+    // which covers ASCII digits and the common signs and separators.
+    if (fNumMatchers > 32) {
+        return;
+    }
+    bool foldCase = 0 != (fParseFlags & PARSE_FLAG_IGNORE_CASE);
+    for (UChar32 c = 0; c < LEAD_TABLE_SIZE; c++) {
+        UnicodeString str(c);
+        StringSegment segment(str, foldCase);
+        uint32_t mask = 0;
+        for (int32_t i = 0; i < fNumMatchers; i++) {
+            if (fMatchers[i]->smokeTest(segment)) {
+                mask |= 1u << i;
+            }
+        }
+        fLeadMasks[c] = mask;
+    }
+    fHasLeadMasks = true;
 }
 
 parse_flags_t NumberParserImpl::getParseFlags() const {
@@ -275,7 +294,7 @@ void NumberParserImpl::parseGreedy(StringSegment& segment, ParsedNumber& result,
             return;
         }
         const NumberParseMatcher* matcher = fMatchers[i];
-        if (!matcher->smokeTest(segment)) {
+        if (!smokeTest(i, segment)) {
             // Matcher failed smoke test: try the next one
             i++;
             continue;
@@ -320,7 +339,7 @@ void NumberParserImpl::parseLongestRecursive(StringSegment& segment, ParsedNumbe
     int initialOffset = segment.getOffset();
     for (int32_t i = 0; i < fNumMatchers; i++) {
         const NumberParseMatcher* matcher = fMatchers[i];
-        if (!matcher->smokeTest(segment)) {
+        if (!smokeTest(i, segment)) {
             continue;
         }
 
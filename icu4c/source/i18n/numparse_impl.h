@@ -69,6 +69,13 @@ class U_I18N_API NumberParserImpl : public MutableMatcherCollection, public UMem
     MaybeStackArray<const NumberParseMatcher*, 10> fMatchers;
     bool fFrozen = false;
 
+    // Lead code point dispatch, built by freeze(): bit i of fLeadMasks[c] is set if fMatchers[i] passes
+    // its smoke test on a segment starting with c. Covers Latin-1 and at most 32 matchers; other code
+    // points and larger parsers fall back to calling smokeTest().
+    static constexpr int32_t LEAD_TABLE_SIZE = 0x100;
+    bool fHasLeadMasks = false;
+    uint32_t fLeadMasks[LEAD_TABLE_SIZE];
+
     // WARNING: All of these matchers start in an undefined state (default-constructed).
     // You must use an assignment operator on them before using.
     struct {
@@ -98,6 +105,17 @@ class U_I18N_API NumberParserImpl : public MutableMatcherCollection, public UMem
 
     void parseGreedy(StringSegment& segment, ParsedNumber& result, UErrorCode& status) const;
 
+    /** Equivalent to fMatchers[matcherIndex]->smokeTest(segment), using the lead table if possible. */
+    inline bool smokeTest(int32_t matcherIndex, const StringSegment& segment) const {
+        if (fHasLeadMasks) {
+            UChar32 cp = segment.getCodePoint();
+            if (cp >= 0 && cp < LEAD_TABLE_SIZE) {
+                return (fLeadMasks[cp] >> matcherIndex) & 1;
+            }
+        }
+        return fMatchers[matcherIndex]->smokeTest(segment);
+    }
+
     void parseLongestRecursive(
         StringSegment& segment, ParsedNumber& result, int32_t recursionLevels, UErrorCode& status) const;
 };
@@ -11,8 +11,12 @@
 
 #include "unicode/numberrangeformatter.h"
 #include "numrange_impl.h"
+#include "cstring.h"
 #include "patternprops.h"
+#include "sharedobject.h"
+#include "unifiedcache.h"
 #include "uresimp.h"
+#include "ustr_imp.h"
 #include "util.h"
 
 using namespace icu;
@@ -193,6 +197,103 @@ StandardPluralRanges::resolve(StandardPlural::Form first, StandardPlural::Form s
 }
 
 
+U_NAMESPACE_BEGIN
+namespace number {
+namespace impl {
+
+/**
+ * The range pattern, the approximately pattern and the plural ranges of one
+ * locale and numbering system. They are the same for every range formatter
+ * with those settings, so they are loaded once and shared through the
+ * UnifiedCache.
+ */
+class NumberRangePatterns : public SharedObject {
+  public:
+    SimpleFormatter rangePattern;
+    SimpleFormatter approximatelyPattern;
+    StandardPluralRanges pluralRanges;
+    virtual ~NumberRangePatterns();
+};
+
+NumberRangePatterns::~NumberRangePatterns() {}
+
+class NumberRangePatternsKey : public LocaleCacheKey<NumberRangePatterns> {
+  private:
+    // Same capacity as MicroProps::nsName.
+    char fNsName[9];
+
+  public:
+    NumberRangePatternsKey(const Locale &loc, const char *nsName)
+            : LocaleCacheKey<NumberRangePatterns>(loc) {
+        uprv_strncpy(fNsName, nsName, sizeof(fNsName) - 1);
+        fNsName[sizeof(fNsName) - 1] = 0;
+    }
+
+    NumberRangePatternsKey(const NumberRangePatternsKey &other)
+            : LocaleCacheKey<NumberRangePatterns>(other) {
+        uprv_strcpy(fNsName, other.fNsName);
+    }
+
+    virtual ~NumberRangePatternsKey();
+
+    virtual int32_t hashCode() const {
+        return 37 * LocaleCacheKey<NumberRangePatterns>::hashCode() +
+               ustr_hashCharsN(fNsName, static_cast<int32_t>(uprv_strlen(fNsName)));
+    }
+
+    virtual UBool operator==(const CacheKeyBase &other) const {
+        if (this == &other) {
+            return TRUE;
+        }
+        if (!LocaleCacheKey<NumberRangePatterns>::operator==(other)) {
+            return FALSE;
+        }
+        // We know that this and other are of same class if we get this far.
+        const NumberRangePatternsKey &realOther = static_cast<const NumberRangePatternsKey &>(other);
+        return uprv_strcmp(fNsName, realOther.fNsName) == 0;
+    }
+
+    virtual CacheKeyBase *clone() const {
+        return new NumberRangePatternsKey(*this);
+    }
+
+    virtual const NumberRangePatterns *createObject(const void * /*unused*/, UErrorCode &status) const {
+        LocalPointer<NumberRangePatterns> result(new NumberRangePatterns(), status);
+        if (U_FAILURE(status)) {
+            return nullptr;
+        }
+        NumberRangeData data;
+        getNumberRangeData(fLoc.getName(), fNsName, data, status);
+        if (U_FAILURE(status)) {
+            return nullptr;
+        }
+        result->rangePattern = data.rangePattern;
+        result->approximatelyPattern = data.approximatelyPattern;
+        // TODO: Get locale from PluralRules instead?
+        result->pluralRanges.initialize(fLoc, status);
+        if (U_FAILURE(status)) {
+            return nullptr;
+        }
+        result->addRef();
+        return result.orphan();
+    }
+};
+
+NumberRangePatternsKey::~NumberRangePatternsKey() {}
+
+}  // namespace impl
+}  // namespace number
+
+template<> U_I18N_API
+const number::impl::NumberRangePatterns *LocaleCacheKey<number::impl::NumberRangePatterns>::createObject(
+        const void * /*unused*/, UErrorCode &status) const {
+    status = U_UNSUPPORTED_ERROR;
+    return nullptr;
+}
+
+U_NAMESPACE_END
+
+
 NumberRangeFormatterImpl::NumberRangeFormatterImpl(const RangeMacroProps& macros, UErrorCode& status)
     : formatterImpl1(macros.formatter1.fMacros, status),
       formatterImpl2(macros.formatter2.fMacros, status),
@@ -206,15 +307,18 @@ NumberRangeFormatterImpl::NumberRangeFormatterImpl(const RangeMacroProps& macros
         return;
     }
 
-    NumberRangeData data;
-    getNumberRangeData(macros.locale.getName(), nsName, data, status);
+    const UnifiedCache *cache = UnifiedCache::getInstance(status);
     if (U_FAILURE(status)) { return; }
-    fRangeFormatter = data.rangePattern;
-    fApproximatelyModifier = {data.approximatelyPattern, UNUM_FIELD_COUNT, false};
-
-    // TODO: Get locale from PluralRules instead?
-    fPluralRanges.initialize(macros.locale, status);
+    cache->get(NumberRangePatternsKey(macros.locale, nsName), fPatterns, status);
     if (U_FAILURE(status)) { return; }
+    fRangeFormatter = fPatterns->rangePattern;
+    fApproximatelyModifier = {fPatterns->approximatelyPattern, UNUM_FIELD_COUNT, false};
+}
+
+NumberRangeFormatterImpl::~NumberRangeFormatterImpl() {
+    if (fPatterns != nullptr) {
+        fPatterns->removeRef();
+    }
 }
 
 void NumberRangeFormatterImpl::format(UFormattedNumberRangeData& data, bool equalBeforeRounding, UErrorCode& status) const {
@@ -225,6 +329,25 @@ void NumberRangeFormatterImpl::format(UFormattedNumberRangeData& data, bool equa
     MicroProps micros1;
     MicroProps micros2;
     formatterImpl1.preProcess(data.quantity1, micros1, status);
+
+    // Fast path: equal inputs through the same formatter round to the same
+    // quantity and get the same modifiers, so the second endpoint does not
+    // need its own pass unless the fallback formats a full range.
+    if (fSameFormatters && equalBeforeRounding
+            && fIdentityFallback != UNUM_IDENTITY_FALLBACK_RANGE) {
+        if (U_FAILURE(status)) {
+            return;
+        }
+        data.quantity2 = data.quantity1;
+        data.identityResult = UNUM_IDENTITY_RESULT_EQUAL_BEFORE_ROUNDING;
+        if (fIdentityFallback == UNUM_IDENTITY_FALLBACK_APPROXIMATELY) {
+            formatApproximately(data, micros1, micros1, status);
+        } else {
+            formatSingleValue(data, micros1, micros1, status);
+        }
+        return;
+    }
+
     if (fSameFormatters) {
         formatterImpl1.preProcess(data.quantity2, micros2, status);
     } else {
@@ -494,7 +617,7 @@ NumberRangeFormatterImpl::resolveModifierPlurals(const Modifier& first, const Mo
     StandardPlural::Form secondPlural = parameters.plural;
 
     // Get the required plural form from data
-    StandardPlural::Form resultPlural = fPluralRanges.resolve(firstPlural, secondPlural);
+    StandardPlural::Form resultPlural = fPatterns->pluralRanges.resolve(firstPlural, secondPlural);
 
     // Get and return the new Modifier
     const Modifier* mod = parameters.obj->getModifier(parameters.signum, resultPlural);
@@ -70,10 +70,16 @@ class StandardPluralRanges : public UMemory {
 };
 
 
+// Range pattern, approximately pattern and plural ranges of a locale; shared through the UnifiedCache.
+class NumberRangePatterns;
+
+
 class NumberRangeFormatterImpl : public UMemory {
   public:
     NumberRangeFormatterImpl(const RangeMacroProps& macros, UErrorCode& status);
 
+    ~NumberRangeFormatterImpl();
+
     void format(UFormattedNumberRangeData& data, bool equalBeforeRounding, UErrorCode& status) const;
 
   private:
@@ -87,7 +93,10 @@ class NumberRangeFormatterImpl : public UMemory {
     SimpleFormatter fRangeFormatter;
     SimpleModifier fApproximatelyModifier;
 
-    StandardPluralRanges fPluralRanges;
+    const NumberRangePatterns* fPatterns = nullptr;
+
+    NumberRangeFormatterImpl(const NumberRangeFormatterImpl&) = delete;
+    NumberRangeFormatterImpl& operator=(const NumberRangeFormatterImpl&) = delete;
 
     void formatSingleValue(UFormattedNumberRangeData& data,
                            MicroProps& micros1, MicroProps& micros2,
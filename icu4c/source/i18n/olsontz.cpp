@@ -96,7 +96,7 @@ UOBJECT_DEFINE_RTTI_IMPLEMENTATION(OlsonTimeZone)
  * Construct a GMT+0 zone with no transitions.  This is done when a
  * constructor fails so the resultant object is well-behaved.
  */
-void OlsonTimeZone::constructEmpty() {
+void OlsonTimeZoneData::constructEmpty() {
     canonicalID = NULL;
 
     transitionCountPre32 = transitionCount32 = transitionCountPost32 = 0;
@@ -107,7 +107,10 @@ void OlsonTimeZone::constructEmpty() {
     typeCount = 1;
     typeOffsets = ZEROS;
 
+    delete finalZone;
     finalZone = NULL;
+
+    initTransitionBuckets();
 }
 
 /**
@@ -117,14 +120,13 @@ void OlsonTimeZone::constructEmpty() {
  * @param res the resource bundle of the zone to be constructed
  * @param ec input-output error code
  */
-OlsonTimeZone::OlsonTimeZone(const UResourceBundle* top,
-                             const UResourceBundle* res,
-                             const UnicodeString& tzid,
-                             UErrorCode& ec) :
-  BasicTimeZone(tzid), finalZone(NULL)
+OlsonTimeZoneData::OlsonTimeZoneData(const UResourceBundle* top,
+                                     const UResourceBundle* res,
+                                     const UnicodeString& tzid,
+                                     UErrorCode& ec) :
+  finalZone(NULL)
 {
-    clearTransitionRules();
-    U_DEBUG_TZ_MSG(("OlsonTimeZone(%s)\n", ures_getKey((UResourceBundle*)res)));
+    U_DEBUG_TZ_MSG(("OlsonTimeZoneData(%s)\n", ures_getKey((UResourceBundle*)res)));
     if ((top == NULL || res == NULL) && U_SUCCESS(ec)) {
         ec = U_ILLEGAL_ARGUMENT_ERROR;
     }
@@ -257,44 +259,69 @@ OlsonTimeZone::OlsonTimeZone(const UResourceBundle* top,
 
     if (U_FAILURE(ec)) {
         constructEmpty();
+    } else {
+        initTransitionBuckets();
     }
 }
 
+OlsonTimeZoneData::~OlsonTimeZoneData() {
+    delete finalZone;
+}
+
+/**
+ * Construct from a resource bundle
+ * @param top the top-level zoneinfo resource bundle.  This is used
+ * to lookup the rule that `res' may refer to, if there is one.
+ * @param res the resource bundle of the zone to be constructed
+ * @param ec input-output error code
+ */
+OlsonTimeZone::OlsonTimeZone(const UResourceBundle* top,
+                             const UResourceBundle* res,
+                             const UnicodeString& tzid,
+                             UErrorCode& ec) :
+  BasicTimeZone(tzid), fData(NULL)
+{
+    clearTransitionRules();
+    OlsonTimeZoneData *data = new OlsonTimeZoneData(top, res, tzid, ec);
+    if (data == NULL) {
+        if (U_SUCCESS(ec)) {
+            ec = U_MEMORY_ALLOCATION_ERROR;
+        }
+        return;
+    }
+    data->addRef();
+    fData = data;
+}
+
+/**
+ * Construct from shared zone data
+ */
+OlsonTimeZone::OlsonTimeZone(const OlsonTimeZoneData* data, const UnicodeString& tzid) :
+  BasicTimeZone(tzid), fData(data)
+{
+    clearTransitionRules();
+    fData->addRef();
+}
+
 /**
  * Copy constructor
  */
 OlsonTimeZone::OlsonTimeZone(const OlsonTimeZone& other) :
-    BasicTimeZone(other), finalZone(0) {
-    *this = other;
+    BasicTimeZone(other), fData(other.fData) {
+    clearTransitionRules();
+    if (fData != NULL) {
+        fData->addRef();
+    }
 }
 
 /**
  * Assignment operator
  */
 OlsonTimeZone& OlsonTimeZone::operator=(const OlsonTimeZone& other) {
-    canonicalID = other.canonicalID;
-
-    transitionTimesPre32 = other.transitionTimesPre32;
-    transitionTimes32 = other.transitionTimes32;
-    transitionTimesPost32 = other.transitionTimesPost32;
-
-    transitionCountPre32 = other.transitionCountPre32;
-    transitionCount32 = other.transitionCount32;
-    transitionCountPost32 = other.transitionCountPost32;
-
-    typeCount = other.typeCount;
-    typeOffsets = other.typeOffsets;
-    typeMapData = other.typeMapData;
-
-    delete finalZone;
-    finalZone = (other.finalZone != 0) ?
-        (SimpleTimeZone*) other.finalZone->clone() : 0;
-
-    finalStartYear = other.finalStartYear;
-    finalStartMillis = other.finalStartMillis;
-
-    clearTransitionRules();
-
+    if (this != &other) {
+        SharedObject::copyPtr(other.fData, fData);
+        deleteTransitionRules();
+    }
     return *this;
 }
 
@@ -303,7 +330,7 @@ OlsonTimeZone& OlsonTimeZone::operator=(const OlsonTimeZone& other) {
  */
 OlsonTimeZone::~OlsonTimeZone() {
     deleteTransitionRules();
-    delete finalZone;
+    SharedObject::clearPtr(fData);
 }
 
 /**
@@ -371,8 +398,8 @@ int32_t OlsonTimeZone::getOffset(uint8_t era, int32_t year, int32_t month,
         year = -year;
     }
 
-    if (finalZone != NULL && year >= finalStartYear) {
-        return finalZone->getOffset(era, year, month, dom, dow,
+    if (fData->finalZone != NULL && year >= fData->finalStartYear) {
+        return fData->finalZone->getOffset(era, year, month, dom, dow,
                                     millis, monthLength, ec);
     }
 
@@ -391,8 +418,8 @@ void OlsonTimeZone::getOffset(UDate date, UBool local, int32_t& rawoff,
     if (U_FAILURE(ec)) {
         return;
     }
-    if (finalZone != NULL && date >= finalStartMillis) {
-        finalZone->getOffset(date, local, rawoff, dstoff, ec);
+    if (fData->finalZone != NULL && date >= fData->finalStartMillis) {
+        fData->finalZone->getOffset(date, local, rawoff, dstoff, ec);
     } else {
         getHistoricalOffset(date, local, kFormer, kLatter, rawoff, dstoff);
     }
@@ -404,8 +431,8 @@ OlsonTimeZone::getOffsetFromLocal(UDate date, int32_t nonExistingTimeOpt, int32_
     if (U_FAILURE(ec)) {
         return;
     }
-    if (finalZone != NULL && date >= finalStartMillis) {
-        finalZone->getOffsetFromLocal(date, nonExistingTimeOpt, duplicatedTimeOpt, rawoff, dstoff, ec);
+    if (fData->finalZone != NULL && date >= fData->finalStartMillis) {
+        fData->finalZone->getOffsetFromLocal(date, nonExistingTimeOpt, duplicatedTimeOpt, rawoff, dstoff, ec);
     } else {
         getHistoricalOffset(date, TRUE, nonExistingTimeOpt, duplicatedTimeOpt, rawoff, dstoff);
     }
@@ -446,7 +473,7 @@ void printTime(double ms) {
 #endif
 
 int64_t
-OlsonTimeZone::transitionTimeInSeconds(int16_t transIdx) const {
+OlsonTimeZoneData::transitionTimeInSeconds(int16_t transIdx) const {
     U_ASSERT(transIdx >= 0 && transIdx < transitionCount()); 
 
     if (transIdx < transitionCountPre32) {
@@ -464,6 +491,49 @@ OlsonTimeZone::transitionTimeInSeconds(int16_t transIdx) const {
         | ((int64_t)((uint32_t)transitionTimesPost32[(transIdx << 1) + 1]));
 }
 
+// Transition times in seconds of the first bucket (1900-01-01T00:00Z)
+// and just past the last bucket of the transition index lookup table.
+#define BUCKET_START_SECONDS (-2208988800.0)
+#define BUCKET_LIMIT_SECONDS (BUCKET_START_SECONDS + ((double)BUCKET_COUNT * ((int64_t)1 << BUCKET_SHIFT)))
+
+int16_t
+OlsonTimeZoneData::searchTransitionIndex(double sec) const {
+    // Binary search for the last transition at or before sec
+    int16_t start = 0;
+    int16_t limit = transitionCount();
+    while (start < limit) {
+        int16_t mid = (int16_t)((start + limit) >> 1);
+        if (sec >= transitionTimeInSeconds(mid)) {
+            start = mid + 1;
+        } else {
+            limit = mid;
+        }
+    }
+    return start - 1;
+}
+
+int16_t
+OlsonTimeZoneData::findTransitionIndex(double sec) const {
+    if (!(sec >= BUCKET_START_SECONDS && sec < BUCKET_LIMIT_SECONDS)) {
+        return searchTransitionIndex(sec);
+    }
+    int32_t bucket = (int32_t)(((int64_t)(sec - BUCKET_START_SECONDS)) >> BUCKET_SHIFT);
+    int16_t transIdx = transitionBuckets[bucket];
+    int16_t transCount = transitionCount();
+    while (transIdx + 1 < transCount && sec >= transitionTimeInSeconds(transIdx + 1)) {
+        transIdx++;
+    }
+    return transIdx;
+}
+
+void
+OlsonTimeZoneData::initTransitionBuckets() {
+    for (int32_t i = 0; i < BUCKET_COUNT; i++) {
+        transitionBuckets[i] = searchTransitionIndex(
+            BUCKET_START_SECONDS + (double)i * ((int64_t)1 << BUCKET_SHIFT));
+    }
+}
+
 // Maximum absolute offset in seconds (86400 seconds = 1 day)
 // getHistoricalOffset uses this constant as safety margin of
 // quick zone transition checking.
@@ -487,10 +557,13 @@ OlsonTimeZone::getHistoricalOffset(UDate date, UBool local,
             rawoff = initialRawOffset() * U_MILLIS_PER_SECOND;
             dstoff = initialDstOffset() * U_MILLIS_PER_SECOND;
         } else {
-            // Linear search from the end is the fastest approach, since
-            // most lookups will happen at/near the end.
-            int16_t transIdx;
-            for (transIdx = transCount - 1; transIdx >= 0; transIdx--) {
+            // Start from the last transition which could possibly apply.
+            // A local time cannot be affected by a transition more than
+            // MAX_OFFSET_SECONDS later, so the backward scan below only
+            // needs to look at a few transitions when local is true, and
+            // stops at the first one when local is false.
+            int16_t transIdx = fData->findTransitionIndex(local ? sec + MAX_OFFSET_SECONDS : sec);
+            for (; transIdx >= 0; transIdx--) {
                 int64_t transition = transitionTimeInSeconds(transIdx);
 
                 if (local && (sec >= (transition - MAX_OFFSET_SECONDS))) {
@@ -563,8 +636,8 @@ UBool OlsonTimeZone::useDaylightTime() const {
     // and returns TRUE if so.
 
     UDate current = uprv_getUTCtime();
-    if (finalZone != NULL && current >= finalStartMillis) {
-        return finalZone->useDaylightTime();
+    if (fData->finalZone != NULL && current >= fData->finalStartMillis) {
+        return fData->finalZone->useDaylightTime();
     }
 
     int32_t year, month, dom, dow, doy, mid;
@@ -590,8 +663,8 @@ UBool OlsonTimeZone::useDaylightTime() const {
 }
 int32_t 
 OlsonTimeZone::getDSTSavings() const{
-    if (finalZone != NULL){
-        return finalZone->getDSTSavings();
+    if (fData->finalZone != NULL){
+        return fData->finalZone->getDSTSavings();
     }
     return TimeZone::getDSTSavings();
 }
@@ -613,40 +686,43 @@ OlsonTimeZone::hasSameRules(const TimeZone &other) const {
     if (z == NULL) {
         return FALSE;
     }
+    if (fData == z->fData) {
+        return TRUE;
+    }
 
     // [sic] pointer comparison: typeMapData points into
     // memory-mapped or DLL space, so if two zones have the same
     // pointer, they are equal.
-    if (typeMapData == z->typeMapData) {
+    if (fData->typeMapData == z->fData->typeMapData) {
         return TRUE;
     }
     
     // If the pointers are not equal, the zones may still
     // be equal if their rules and transitions are equal
-    if ((finalZone == NULL && z->finalZone != NULL)
-        || (finalZone != NULL && z->finalZone == NULL)
-        || (finalZone != NULL && z->finalZone != NULL && *finalZone != *z->finalZone)) {
+    if ((fData->finalZone == NULL && z->fData->finalZone != NULL)
+        || (fData->finalZone != NULL && z->fData->finalZone == NULL)
+        || (fData->finalZone != NULL && z->fData->finalZone != NULL && *fData->finalZone != *z->fData->finalZone)) {
         return FALSE;
     }
 
-    if (finalZone != NULL) {
-        if (finalStartYear != z->finalStartYear || finalStartMillis != z->finalStartMillis) {
+    if (fData->finalZone != NULL) {
+        if (fData->finalStartYear != z->fData->finalStartYear || fData->finalStartMillis != z->fData->finalStartMillis) {
             return FALSE;
         }
     }
-    if (typeCount != z->typeCount
-        || transitionCountPre32 != z->transitionCountPre32
-        || transitionCount32 != z->transitionCount32
-        || transitionCountPost32 != z->transitionCountPost32) {
+    if (fData->typeCount != z->fData->typeCount
+        || fData->transitionCountPre32 != z->fData->transitionCountPre32
+        || fData->transitionCount32 != z->fData->transitionCount32
+        || fData->transitionCountPost32 != z->fData->transitionCountPost32) {
         return FALSE;
     }
 
     return
-        arrayEqual(transitionTimesPre32, z->transitionTimesPre32, sizeof(transitionTimesPre32[0]) * transitionCountPre32 << 1)
-        && arrayEqual(transitionTimes32, z->transitionTimes32, sizeof(transitionTimes32[0]) * transitionCount32)
-        && arrayEqual(transitionTimesPost32, z->transitionTimesPost32, sizeof(transitionTimesPost32[0]) * transitionCountPost32 << 1)
-        && arrayEqual(typeOffsets, z->typeOffsets, sizeof(typeOffsets[0]) * typeCount << 1)
-        && arrayEqual(typeMapData, z->typeMapData, sizeof(typeMapData[0]) * transitionCount());
+        arrayEqual(fData->transitionTimesPre32, z->fData->transitionTimesPre32, sizeof(fData->transitionTimesPre32[0]) * fData->transitionCountPre32 << 1)
+        && arrayEqual(fData->transitionTimes32, z->fData->transitionTimes32, sizeof(fData->transitionTimes32[0]) * fData->transitionCount32)
+        && arrayEqual(fData->transitionTimesPost32, z->fData->transitionTimesPost32, sizeof(fData->transitionTimesPost32[0]) * fData->transitionCountPost32 << 1)
+        && arrayEqual(fData->typeOffsets, z->fData->typeOffsets, sizeof(fData->typeOffsets[0]) * fData->typeCount << 1)
+        && arrayEqual(fData->typeMapData, z->fData->typeMapData, sizeof(fData->typeMapData[0]) * transitionCount());
 }
 
 void
@@ -734,7 +810,7 @@ OlsonTimeZone::initTransitionRules(UErrorCode& status) {
         // For now, keeping this code for just in case. Feb 19, 2010 Yoshito
         firstTZTransitionIdx = 0;
         for (transitionIdx = 0; transitionIdx < transCount; transitionIdx++) {
-            if (typeMapData[transitionIdx] != 0) { // type 0 is the initial type
+            if (fData->typeMapData[transitionIdx] != 0) { // type 0 is the initial type
                 break;
             }
             firstTZTransitionIdx++;
@@ -749,13 +825,13 @@ OlsonTimeZone::initTransitionRules(UErrorCode& status) {
                 deleteTransitionRules();
                 return;
             }
-            for (typeIdx = 0; typeIdx < typeCount; typeIdx++) {
+            for (typeIdx = 0; typeIdx < fData->typeCount; typeIdx++) {
                 // Gather all start times for each pair of offsets
                 int32_t nTimes = 0;
                 for (transitionIdx = firstTZTransitionIdx; transitionIdx < transCount; transitionIdx++) {
-                    if (typeIdx == (int16_t)typeMapData[transitionIdx]) {
+                    if (typeIdx == (int16_t)fData->typeMapData[transitionIdx]) {
                         UDate tt = (UDate)transitionTime(transitionIdx);
-                        if (finalZone == NULL || tt <= finalStartMillis) {
+                        if (fData->finalZone == NULL || tt <= fData->finalStartMillis) {
                             // Exclude transitions after finalMillis
                             times[nTimes++] = tt;
                         }
@@ -763,10 +839,10 @@ OlsonTimeZone::initTransitionRules(UErrorCode& status) {
                 }
                 if (nTimes > 0) {
                     // Create a TimeArrayTimeZoneRule
-                    raw = typeOffsets[typeIdx << 1] * U_MILLIS_PER_SECOND;
-                    dst = typeOffsets[(typeIdx << 1) + 1] * U_MILLIS_PER_SECOND;
+                    raw = fData->typeOffsets[typeIdx << 1] * U_MILLIS_PER_SECOND;
+                    dst = fData->typeOffsets[(typeIdx << 1) + 1] * U_MILLIS_PER_SECOND;
                     if (historicRules == NULL) {
-                        historicRuleCount = typeCount;
+                        historicRuleCount = fData->typeCount;
                         historicRules = (TimeArrayTimeZoneRule**)uprv_malloc(sizeof(TimeArrayTimeZoneRule*)*historicRuleCount);
                         if (historicRules == NULL) {
                             status = U_MEMORY_ALLOCATION_ERROR;
@@ -792,7 +868,7 @@ OlsonTimeZone::initTransitionRules(UErrorCode& status) {
             uprv_free(times);
 
             // Create initial transition
-            typeIdx = (int16_t)typeMapData[firstTZTransitionIdx];
+            typeIdx = (int16_t)fData->typeMapData[firstTZTransitionIdx];
             firstTZTransition = new TimeZoneTransition((UDate)transitionTime(firstTZTransitionIdx),
                     *initialRule, *historicRules[typeIdx]);
             // Check to make sure firstTZTransition was created.
@@ -803,12 +879,12 @@ OlsonTimeZone::initTransitionRules(UErrorCode& status) {
             }
         }
     }
-    if (finalZone != NULL) {
+    if (fData->finalZone != NULL) {
         // Get the first occurence of final rule starts
-        UDate startTime = (UDate)finalStartMillis;
+        UDate startTime = (UDate)fData->finalStartMillis;
         TimeZoneRule *firstFinalRule = NULL;
 
-        if (finalZone->useDaylightTime()) {
+        if (fData->finalZone->useDaylightTime()) {
             /*
              * Note: When an OlsonTimeZone is constructed, we should set the final year
              * as the start year of finalZone.  However, the bounday condition used for
@@ -816,14 +892,14 @@ OlsonTimeZone::initTransitionRules(UErrorCode& status) {
              * For now, we do not set the valid start year when the construction time
              * and create a clone and set the start year when extracting rules.
              */
-            finalZoneWithStartYear = (SimpleTimeZone*)finalZone->clone();
+            finalZoneWithStartYear = (SimpleTimeZone*)fData->finalZone->clone();
             // Check to make sure finalZone was actually cloned.
             if (finalZoneWithStartYear == NULL) {
                 status = U_MEMORY_ALLOCATION_ERROR;
                 deleteTransitionRules();
                 return;
             }
-            finalZoneWithStartYear->setStartYear(finalStartYear);
+            finalZoneWithStartYear->setStartYear(fData->finalStartYear);
 
             TimeZoneTransition tzt;
             finalZoneWithStartYear->getNextTransition(startTime, false, tzt);
@@ -837,16 +913,16 @@ OlsonTimeZone::initTransitionRules(UErrorCode& status) {
             startTime = tzt.getTime();
         } else {
             // final rule with no transitions
-            finalZoneWithStartYear = (SimpleTimeZone*)finalZone->clone();
+            finalZoneWithStartYear = (SimpleTimeZone*)fData->finalZone->clone();
             // Check to make sure finalZone was actually cloned.
             if (finalZoneWithStartYear == NULL) {
                 status = U_MEMORY_ALLOCATION_ERROR;
                 deleteTransitionRules();
                 return;
             }
-            finalZone->getID(tzid);
+            fData->finalZone->getID(tzid);
             firstFinalRule = new TimeArrayTimeZoneRule(tzid,
-                finalZone->getRawOffset(), 0, &startTime, 1, DateTimeRule::UTC_TIME);
+                fData->finalZone->getRawOffset(), 0, &startTime, 1, DateTimeRule::UTC_TIME);
             // Check firstFinalRule was properly created.
             if (firstFinalRule == NULL) {
                 status = U_MEMORY_ALLOCATION_ERROR;
@@ -856,7 +932,7 @@ OlsonTimeZone::initTransitionRules(UErrorCode& status) {
         }
         TimeZoneRule *prevRule = NULL;
         if (transCount > 0) {
-            prevRule = historicRules[typeMapData[transCount - 1]];
+            prevRule = historicRules[fData->typeMapData[transCount - 1]];
         }
         if (prevRule == NULL) {
             // No historic transitions, but only finalZone available
@@ -883,12 +959,12 @@ OlsonTimeZone::getNextTransition(UDate base, UBool inclusive, TimeZoneTransition
         return FALSE;
     }
 
-    if (finalZone != NULL) {
+    if (fData->finalZone != NULL) {
         if (inclusive && base == firstFinalTZTransition->getTime()) {
             result = *firstFinalTZTransition;
             return TRUE;
         } else if (base >= firstFinalTZTransition->getTime()) {
-            if (finalZone->useDaylightTime()) {
+            if (fData->finalZone->useDaylightTime()) {
                 //return finalZone->getNextTransition(base, inclusive, result);
                 return finalZoneWithStartYear->getNextTransition(base, inclusive, result);
             } else {
@@ -919,8 +995,8 @@ OlsonTimeZone::getNextTransition(UDate base, UBool inclusive, TimeZoneTransition
             return TRUE;
         } else {
             // Create a TimeZoneTransition
-            TimeZoneRule *to = historicRules[typeMapData[ttidx + 1]];
-            TimeZoneRule *from = historicRules[typeMapData[ttidx]];
+            TimeZoneRule *to = historicRules[fData->typeMapData[ttidx + 1]];
+            TimeZoneRule *from = historicRules[fData->typeMapData[ttidx]];
             UDate startTime = (UDate)transitionTime(ttidx+1);
 
             // The transitions loaded from zoneinfo.res may contain non-transition data
@@ -948,12 +1024,12 @@ OlsonTimeZone::getPreviousTransition(UDate base, UBool inclusive, TimeZoneTransi
         return FALSE;
     }
 
-    if (finalZone != NULL) {
+    if (fData->finalZone != NULL) {
         if (inclusive && base == firstFinalTZTransition->getTime()) {
             result = *firstFinalTZTransition;
             return TRUE;
         } else if (base > firstFinalTZTransition->getTime()) {
-            if (finalZone->useDaylightTime()) {
+            if (fData->finalZone->useDaylightTime()) {
                 //return finalZone->getPreviousTransition(base, inclusive, result);
                 return finalZoneWithStartYear->getPreviousTransition(base, inclusive, result);
             } else {
@@ -980,8 +1056,8 @@ OlsonTimeZone::getPreviousTransition(UDate base, UBool inclusive, TimeZoneTransi
             return TRUE;
         } else {
             // Create a TimeZoneTransition
-            TimeZoneRule *to = historicRules[typeMapData[ttidx]];
-            TimeZoneRule *from = historicRules[typeMapData[ttidx-1]];
+            TimeZoneRule *to = historicRules[fData->typeMapData[ttidx]];
+            TimeZoneRule *from = historicRules[fData->typeMapData[ttidx-1]];
             UDate startTime = (UDate)transitionTime(ttidx);
 
             // The transitions loaded from zoneinfo.res may contain non-transition data
@@ -1021,8 +1097,8 @@ OlsonTimeZone::countTransitionRules(UErrorCode& status) const {
             }
         }
     }
-    if (finalZone != NULL) {
-        if (finalZone->useDaylightTime()) {
+    if (fData->finalZone != NULL) {
+        if (fData->finalZone->useDaylightTime()) {
             count += 2;
         } else {
             count++;
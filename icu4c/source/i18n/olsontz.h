@@ -18,6 +18,7 @@
 #if !UCONFIG_NO_FORMATTING
 
 #include "unicode/basictz.h"
+#include "sharedobject.h"
 #include "umutex.h"
 
 struct UResourceBundle;
@@ -26,6 +27,128 @@ U_NAMESPACE_BEGIN
 
 class SimpleTimeZone;
 
+/**
+ * The immutable part of an OlsonTimeZone: transition times and offsets
+ * (aliases into the zoneinfo64 resource data), the final rule and the
+ * transition index lookup table. TimeZone::createTimeZone keeps one
+ * instance per zone ID in the UnifiedCache, and every OlsonTimeZone
+ * created or cloned for that ID only holds a reference to it.
+ */
+class U_I18N_API OlsonTimeZoneData : public SharedObject {
+ public:
+    /**
+     * Construct from a resource bundle.
+     * @param top the top-level zoneinfo resource bundle.  This is used
+     * to lookup the rule that `res' may refer to, if there is one.
+     * @param res the resource bundle of the zone to be constructed
+     * @param tzid the time zone ID
+     * @param ec input-output error code
+     */
+    OlsonTimeZoneData(const UResourceBundle* top,
+                      const UResourceBundle* res,
+                      const UnicodeString& tzid,
+                      UErrorCode& ec);
+
+    virtual ~OlsonTimeZoneData();
+
+    int16_t transitionCount() const;
+
+    int64_t transitionTimeInSeconds(int16_t transIdx) const;
+
+    /*
+     * Returns the index of the last transition at or before the given
+     * time in seconds, or -1 when the time is before the first transition.
+     */
+    int16_t findTransitionIndex(double sec) const;
+
+    /**
+     * Number of transitions in each time range
+     */
+    int16_t transitionCountPre32;
+    int16_t transitionCount32;
+    int16_t transitionCountPost32;
+
+    /**
+     * Time of each transition in seconds from 1970 epoch before 32bit second range (<= 1900).
+     * Each transition in this range is represented by a pair of int32_t.
+     * Length is transitionCount int32_t's.  NULL if no transitions in this range.
+     */
+    const int32_t *transitionTimesPre32; // alias into res; do not delete
+
+    /**
+     * Time of each transition in seconds from 1970 epoch in 32bit second range.
+     * Length is transitionCount int32_t's.  NULL if no transitions in this range.
+     */
+    const int32_t *transitionTimes32; // alias into res; do not delete
+
+    /**
+     * Time of each transition in seconds from 1970 epoch after 32bit second range (>= 2038).
+     * Each transition in this range is represented by a pair of int32_t.
+     * Length is transitionCount int32_t's.  NULL if no transitions in this range.
+     */
+    const int32_t *transitionTimesPost32; // alias into res; do not delete
+
+    /**
+     * Number of types, 1..255
+     */
+    int16_t typeCount;
+
+    /**
+     * Offset from GMT in seconds for each type.
+     * Length is typeCount int32_t's.  At least one type (a pair of int32_t)
+     * is required.
+     */
+    const int32_t *typeOffsets; // alias into res; do not delete
+
+    /**
+     * Type description data, consisting of transitionCount uint8_t
+     * type indices (from 0..typeCount-1).
+     * Length is transitionCount int16_t's.  NULL if no transitions.
+     */
+    const uint8_t *typeMapData; // alias into res; do not delete
+
+    /**
+     * A SimpleTimeZone that governs the behavior for date >= finalMillis.
+     */
+    SimpleTimeZone *finalZone; // owned, may be NULL
+
+    /**
+     * For date >= finalMillis, the finalZone will be used.
+     */
+    double finalStartMillis;
+
+    /**
+     * For year >= finalYear, the finalZone will be used.
+     */
+    int32_t finalStartYear;
+
+    /*
+     * Canonical (CLDR) ID of this zone
+     */
+    const UChar *canonicalID;
+
+    /**
+     * Transition index lookup table covering 1900 to 2100. The range is
+     * split into buckets of 2^BUCKET_SHIFT seconds (a little more than a
+     * year), and each entry holds the index of the last transition at or
+     * before the start of the bucket. Since a zone has at most a few
+     * transitions per year, a lookup only steps forward a couple of entries.
+     */
+    enum {
+        BUCKET_SHIFT = 25,
+        BUCKET_COUNT = 189
+    };
+    int16_t transitionBuckets[BUCKET_COUNT];
+
+ private:
+    void constructEmpty();
+    int16_t searchTransitionIndex(double sec) const;
+    void initTransitionBuckets();
+
+    OlsonTimeZoneData(const OlsonTimeZoneData&);  // not implemented
+    OlsonTimeZoneData& operator=(const OlsonTimeZoneData&);  // not implemented
+};
+
 /**
  * A time zone based on the Olson tz database.  Olson time zones change
  * behavior over time.  The raw offset, rules, presence or absence of
@@ -128,6 +251,13 @@ class U_I18N_API OlsonTimeZone: public BasicTimeZone {
                   const UnicodeString& tzid,
                   UErrorCode& ec);
 
+    /**
+     * Construct a zone referring to already loaded zone data.
+     * @param data the zone data, must not be NULL
+     * @param tzid the time zone ID
+     */
+    OlsonTimeZone(const OlsonTimeZoneData* data, const UnicodeString& tzid);
+
     /**
      * Copy constructor
      */
@@ -291,8 +421,6 @@ class U_I18N_API OlsonTimeZone: public BasicTimeZone {
 
 private:
 
-    void constructEmpty();
-
     void getHistoricalOffset(UDate date, UBool local,
         int32_t NonExistingTimeOpt, int32_t DuplicatedTimeOpt,
         int32_t& rawoff, int32_t& dstoff) const;
@@ -317,70 +445,9 @@ class U_I18N_API OlsonTimeZone: public BasicTimeZone {
     int32_t initialDstOffset() const;
 
     /**
-     * Number of transitions in each time range
-     */
-    int16_t transitionCountPre32;
-    int16_t transitionCount32;
-    int16_t transitionCountPost32;
-
-    /**
-     * Time of each transition in seconds from 1970 epoch before 32bit second range (<= 1900).
-     * Each transition in this range is represented by a pair of int32_t.
-     * Length is transitionCount int32_t's.  NULL if no transitions in this range.
-     */
-    const int32_t *transitionTimesPre32; // alias into res; do not delete
-
-    /**
-     * Time of each transition in seconds from 1970 epoch in 32bit second range.
-     * Length is transitionCount int32_t's.  NULL if no transitions in this range.
-     */
-    const int32_t *transitionTimes32; // alias into res; do not delete
-
-    /**
-     * Time of each transition in seconds from 1970 epoch after 32bit second range (>= 2038).
-     * Each transition in this range is represented by a pair of int32_t.
-     * Length is transitionCount int32_t's.  NULL if no transitions in this range.
-     */
-    const int32_t *transitionTimesPost32; // alias into res; do not delete
-
-    /**
-     * Number of types, 1..255
-     */
-    int16_t typeCount;
-
-    /**
-     * Offset from GMT in seconds for each type.
-     * Length is typeCount int32_t's.  At least one type (a pair of int32_t)
-     * is required.
-     */
-    const int32_t *typeOffsets; // alias into res; do not delete
-
-    /**
-     * Type description data, consisting of transitionCount uint8_t
-     * type indices (from 0..typeCount-1).
-     * Length is transitionCount int16_t's.  NULL if no transitions.
-     */
-    const uint8_t *typeMapData; // alias into res; do not delete
-
-    /**
-     * A SimpleTimeZone that governs the behavior for date >= finalMillis.
-     */
-    SimpleTimeZone *finalZone; // owned, may be NULL
-
-    /**
-     * For date >= finalMillis, the finalZone will be used.
+     * Zone data, shared with the other instances created for the same ID.
      */
-    double finalStartMillis;
-
-    /**
-     * For year >= finalYear, the finalZone will be used.
-     */
-    int32_t finalStartYear;
-
-    /*
-     * Canonical (CLDR) ID of this zone
-     */
-    const UChar *canonicalID;
+    const OlsonTimeZoneData *fData; // owns a reference
 
     /* BasicTimeZone support */
     void clearTransitionRules(void);
@@ -402,10 +469,20 @@ class U_I18N_API OlsonTimeZone: public BasicTimeZone {
 };
 
 inline int16_t
-OlsonTimeZone::transitionCount() const {
+OlsonTimeZoneData::transitionCount() const {
     return transitionCountPre32 + transitionCount32 + transitionCountPost32;
 }
 
+inline int16_t
+OlsonTimeZone::transitionCount() const {
+    return fData->transitionCount();
+}
+
+inline int64_t
+OlsonTimeZone::transitionTimeInSeconds(int16_t transIdx) const {
+    return fData->transitionTimeInSeconds(transIdx);
+}
+
 inline double
 OlsonTimeZone::transitionTime(int16_t transIdx) const {
     return (double)transitionTimeInSeconds(transIdx) * U_MILLIS_PER_SECOND;
@@ -413,35 +490,35 @@ OlsonTimeZone::transitionTime(int16_t transIdx) const {
 
 inline int32_t
 OlsonTimeZone::zoneOffsetAt(int16_t transIdx) const {
-    int16_t typeIdx = (transIdx >= 0 ? typeMapData[transIdx] : 0) << 1;
-    return typeOffsets[typeIdx] + typeOffsets[typeIdx + 1];
+    int16_t typeIdx = (transIdx >= 0 ? fData->typeMapData[transIdx] : 0) << 1;
+    return fData->typeOffsets[typeIdx] + fData->typeOffsets[typeIdx + 1];
 }
 
 inline int32_t
 OlsonTimeZone::rawOffsetAt(int16_t transIdx) const {
-    int16_t typeIdx = (transIdx >= 0 ? typeMapData[transIdx] : 0) << 1;
-    return typeOffsets[typeIdx];
+    int16_t typeIdx = (transIdx >= 0 ? fData->typeMapData[transIdx] : 0) << 1;
+    return fData->typeOffsets[typeIdx];
 }
 
 inline int32_t
 OlsonTimeZone::dstOffsetAt(int16_t transIdx) const {
-    int16_t typeIdx = (transIdx >= 0 ? typeMapData[transIdx] : 0) << 1;
-    return typeOffsets[typeIdx + 1];
+    int16_t typeIdx = (transIdx >= 0 ? fData->typeMapData[transIdx] : 0) << 1;
+    return fData->typeOffsets[typeIdx + 1];
 }
 
 inline int32_t
 OlsonTimeZone::initialRawOffset() const {
-    return typeOffsets[0];
+    return fData->typeOffsets[0];
 }
 
 inline int32_t
 OlsonTimeZone::initialDstOffset() const {
-    return typeOffsets[1];
+    return fData->typeOffsets[1];
 }
 
 inline const UChar*
 OlsonTimeZone::getCanonicalID() const {
-    return canonicalID;
+    return fData->canonicalID;
 }
 
 
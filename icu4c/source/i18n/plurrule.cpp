@@ -64,9 +64,15 @@ static const UChar PK_INTEGER[]={LOW_I,LOW_N,LOW_T,LOW_E,LOW_G,LOW_E,LOW_R,0};
 UOBJECT_DEFINE_RTTI_IMPLEMENTATION(PluralRules)
 UOBJECT_DEFINE_RTTI_IMPLEMENTATION(PluralKeywordEnumeration)
 
+static PluralRuleProgram *createProgram(const RuleChain *rules, UErrorCode &status) {
+    LocalPointer<PluralRuleProgram> program(new PluralRuleProgram(rules, status), status);
+    return U_SUCCESS(status) ? program.orphan() : nullptr;
+}
+
 PluralRules::PluralRules(UErrorCode& /*status*/)
 :   UObject(),
     mRules(nullptr),
+    mProgram(nullptr),
     mInternalStatus(U_ZERO_ERROR)
 {
 }
@@ -74,6 +80,7 @@ PluralRules::PluralRules(UErrorCode& /*status*/)
 PluralRules::PluralRules(const PluralRules& other)
 : UObject(other),
     mRules(nullptr),
+    mProgram(nullptr),
     mInternalStatus(U_ZERO_ERROR)
 {
     *this=other;
@@ -81,6 +88,7 @@ PluralRules::PluralRules(const PluralRules& other)
 
 PluralRules::~PluralRules() {
     delete mRules;
+    delete mProgram;
 }
 
 SharedPluralRules::~SharedPluralRules() {
@@ -104,6 +112,8 @@ PluralRules::operator=(const PluralRules& other) {
     if (this != &other) {
         delete mRules;
         mRules = nullptr;
+        delete mProgram;
+        mProgram = nullptr;
         mInternalStatus = other.mInternalStatus;
         if (U_FAILURE(mInternalStatus)) {
             // bail out early if the object we were copying from was already 'invalid'.
@@ -118,6 +128,9 @@ PluralRules::operator=(const PluralRules& other) {
                 // If the RuleChain wasn't fully copied, then set our status to failure as well.
                 mInternalStatus = mRules->fInternalStatus;
             }
+            else if (other.mProgram != nullptr) {
+                mProgram = createProgram(mRules, mInternalStatus);
+            }
         }
     }
     return *this;
@@ -257,14 +270,31 @@ PluralRules::internalForLocale(const Locale& locale, UPluralType type, UErrorCod
 
 UnicodeString
 PluralRules::select(int32_t number) const {
-    return select(FixedDecimal(number));
+    return select((int64_t)number);
 }
 
 UnicodeString
 PluralRules::select(double number) const {
+    // Integers below 2^53 are exact as doubles, and FixedDecimal gives them v=0.
+    if (mProgram != nullptr && number == uprv_floor(number) &&
+            -9007199254740992.0 < number && number < 9007199254740992.0) {
+        return select((int64_t)number);
+    }
     return select(FixedDecimal(number));
 }
 
+UnicodeString
+PluralRules::select(int64_t number) const {
+    if (mRules == nullptr) {
+        return UnicodeString(TRUE, PLURAL_DEFAULT_RULE, -1);
+    }
+    if (mProgram == nullptr) {
+        return mRules->select(FixedDecimal((double)number));
+    }
+    const UnicodeString *keyword = mProgram->select(number);
+    return keyword != nullptr ? *keyword : UnicodeString(TRUE, PLURAL_KEYWORD_OTHER, 5);
+}
+
 UnicodeString
 PluralRules::select(const number::FormattedNumber& number, UErrorCode& status) const {
     DecimalQuantity dq;
@@ -280,6 +310,10 @@ PluralRules::select(const IFixedDecimal &number) const {
     if (mRules == nullptr) {
         return UnicodeString(TRUE, PLURAL_DEFAULT_RULE, -1);
     }
+    else if (mProgram != nullptr) {
+        const UnicodeString *keyword = mProgram->select(number);
+        return keyword != nullptr ? *keyword : UnicodeString(TRUE, PLURAL_KEYWORD_OTHER, 5);
+    }
     else {
         return mRules->select(number);
     }
@@ -672,6 +706,10 @@ PluralRuleParser::parse(const UnicodeString& ruleData, PluralRules *prules, UErr
             break;
         }
     }
+    if (U_SUCCESS(status) && prules->mRules != nullptr) {
+        delete prules->mProgram;
+        prules->mProgram = createProgram(prules->mRules, status);
+    }
 }
 
 UnicodeString
@@ -971,6 +1009,159 @@ RuleChain::select(const IFixedDecimal &number) const {
     return UnicodeString(TRUE, PLURAL_KEYWORD_OTHER, 5);
 }
 
+PluralRuleProgram::PluralRuleProgram(const RuleChain *rules, UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return;
+    }
+    int32_t ruleCount = 0, constraintCount = 0, rangeCount = 0;
+    for (const RuleChain *rc = rules; rc != nullptr; rc = rc->fNext) {
+        ++ruleCount;
+        for (const OrConstraint *oc = rc->ruleHeader; oc != nullptr; oc = oc->next) {
+            for (const AndConstraint *ac = oc->childNode; ac != nullptr; ac = ac->next) {
+                ++constraintCount;
+                if (ac->rangeList != nullptr) {
+                    rangeCount += ac->rangeList->size();
+                }
+            }
+        }
+    }
+    if ((ruleCount > fRules.getCapacity() && fRules.resize(ruleCount) == nullptr) ||
+            (constraintCount > fConstraints.getCapacity() &&
+                fConstraints.resize(constraintCount) == nullptr) ||
+            (rangeCount > fRanges.getCapacity() && fRanges.resize(rangeCount) == nullptr)) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    int32_t c = 0, r = 0;
+    for (const RuleChain *rc = rules; rc != nullptr; rc = rc->fNext) {
+        for (const OrConstraint *oc = rc->ruleHeader; oc != nullptr; oc = oc->next) {
+            for (const AndConstraint *ac = oc->childNode; ac != nullptr; ac = ac->next) {
+                Constraint &con = fConstraints[c++];
+                con.always = ac->digitsType == none;
+                con.operand = con.always ? PLURAL_OPERAND_N : tokenTypeToPluralOperand(ac->digitsType);
+                con.hasModulus = ac->op == AndConstraint::MOD;
+                con.modulus = ac->opNum;
+                if (con.hasModulus && con.modulus == 0) {
+                    fHasZeroModulus = TRUE;
+                }
+                con.value = ac->value;
+                con.rangeStart = r;
+                if (ac->rangeList != nullptr) {
+                    for (int32_t i = 0; i < ac->rangeList->size(); ++i) {
+                        fRanges[r++] = ac->rangeList->elementAti(i);
+                    }
+                }
+                con.rangeLimit = r;
+                con.integerOnly = ac->integerOnly;
+                con.negated = ac->negated;
+                con.endsAndChain = ac->next == nullptr;
+            }
+        }
+        Rule &rule = fRules[fRuleCount++];
+        rule.keyword = &rc->fKeyword;
+        rule.constraintLimit = c;
+    }
+}
+
+const UnicodeString *
+PluralRuleProgram::select(const IFixedDecimal &number) const {
+    if (number.isNaN() || number.isInfinite()) {
+        return nullptr;
+    }
+    // n, i, f, t, v; fetched on first use.
+    double operands[PLURAL_OPERAND_V + 1];
+    uint32_t fetched = 0;
+    int32_t c = 0;
+    for (int32_t ruleIndex = 0; ruleIndex < fRuleCount; ++ruleIndex) {
+        const Rule &rule = fRules[ruleIndex];
+        // Each rule is an "or" of "and" chains, like OrConstraint::isFulfilled().
+        UBool chainResult = TRUE;
+        for (; c < rule.constraintLimit; ++c) {
+            const Constraint &con = fConstraints[c];
+            if (chainResult && !con.always) {
+                if ((fetched & (1u << con.operand)) == 0) {
+                    operands[con.operand] = number.getPluralOperand(con.operand);
+                    fetched |= 1u << con.operand;
+                }
+                double n = operands[con.operand];
+                UBool result;
+                if (con.integerOnly && n != uprv_floor(n)) {
+                    result = FALSE;
+                } else {
+                    if (con.hasModulus) {
+                        n = fmod(n, con.modulus);
+                    }
+                    if (con.rangeStart == con.rangeLimit) {
+                        result = con.value == -1 || n == con.value;
+                    } else {
+                        result = FALSE;
+                        for (int32_t i = con.rangeStart; i < con.rangeLimit; i += 2) {
+                            if (fRanges[i] <= n && n <= fRanges[i + 1]) {
+                                result = TRUE;
+                                break;
+                            }
+                        }
+                    }
+                }
+                chainResult = con.negated ? !result : result;
+            }
+            if (con.endsAndChain) {
+                if (chainResult) {
+                    return rule.keyword;
+                }
+                chainResult = TRUE;
+            }
+        }
+    }
+    return nullptr;
+}
+
+const UnicodeString *
+PluralRuleProgram::select(int64_t number) const {
+    if (fHasZeroModulus) {
+        return select(FixedDecimal((double)number));
+    }
+    // For an integer, n and i are its absolute value, and f, t and v are 0.
+    uint64_t absValue = number < 0 ? (uint64_t)0 - (uint64_t)number : (uint64_t)number;
+    int32_t c = 0;
+    for (int32_t ruleIndex = 0; ruleIndex < fRuleCount; ++ruleIndex) {
+        const Rule &rule = fRules[ruleIndex];
+        UBool chainResult = TRUE;
+        for (; c < rule.constraintLimit; ++c) {
+            const Constraint &con = fConstraints[c];
+            if (chainResult && !con.always) {
+                uint64_t n = (con.operand == PLURAL_OPERAND_N || con.operand == PLURAL_OPERAND_I) ?
+                        absValue : 0;
+                if (con.hasModulus) {
+                    // n >= 0, so n % m == n % |m| as with fmod().
+                    n %= con.modulus < 0 ? (uint64_t)0 - (uint64_t)con.modulus : (uint64_t)con.modulus;
+                }
+                UBool result;
+                if (con.rangeStart == con.rangeLimit) {
+                    result = con.value == -1 || (con.value >= 0 && n == (uint64_t)con.value);
+                } else {
+                    result = FALSE;
+                    for (int32_t i = con.rangeStart; i < con.rangeLimit; i += 2) {
+                        int32_t low = fRanges[i], high = fRanges[i + 1];
+                        if ((low < 0 || (uint64_t)low <= n) && high >= 0 && n <= (uint64_t)high) {
+                            result = TRUE;
+                            break;
+                        }
+                    }
+                }
+                chainResult = con.negated ? !result : result;
+            }
+            if (con.endsAndChain) {
+                if (chainResult) {
+                    return rule.keyword;
+                }
+                chainResult = TRUE;
+            }
+        }
+    }
+    return nullptr;
+}
+
 static UnicodeString tokenString(tokenType tok) {
     UnicodeString s;
     switch (tok) {
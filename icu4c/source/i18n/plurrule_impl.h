@@ -26,6 +26,7 @@
 #include "unicode/parseerr.h"
 #include "unicode/strenum.h"
 #include "unicode/ures.h"
+#include "cmemory.h"
 #include "uvector.h"
 #include "hash.h"
 #include "uassert.h"
@@ -366,6 +367,50 @@ class RuleChain : public UMemory  {
     UBool         isKeyword(const UnicodeString& keyword) const;
 };
 
+/**
+ * The constraints of a RuleChain flattened into arrays, so that select()
+ * need not walk the linked constraint lists, fetches each operand at most
+ * once, and evaluates integers with integer arithmetic instead of a FixedDecimal.
+ */
+class PluralRuleProgram : public UMemory {
+public:
+    PluralRuleProgram(const RuleChain *rules, UErrorCode &status);
+
+    /** Returns the keyword of the first rule that applies, or nullptr for "other". */
+    const UnicodeString *select(const IFixedDecimal &number) const;
+
+    /** Same as select(FixedDecimal((double)number)) but exact for all int64_t values. */
+    const UnicodeString *select(int64_t number) const;
+
+private:
+    struct Constraint {
+        PluralOperand operand;
+        int32_t modulus;        // the right operand of a mod operation
+        int32_t value;          // for 'is' constraints; -1 for an empty constraint
+        int32_t rangeStart;     // first range bound in fRanges; rangeStart==rangeLimit for 'is'
+        int32_t rangeLimit;
+        UBool hasModulus;
+        UBool integerOnly;
+        UBool negated;
+        UBool always;           // a keyword without an expression
+        UBool endsAndChain;     // the last constraint of an "and" chain
+    };
+    struct Rule {
+        const UnicodeString *keyword;
+        int32_t constraintLimit;
+    };
+
+    MaybeStackArray<Constraint, 8> fConstraints;
+    MaybeStackArray<Rule, 6> fRules;
+    MaybeStackArray<int32_t, 16> fRanges;
+    int32_t fRuleCount = 0;
+    // TRUE if some constraint is "x % 0", which only the double arithmetic handles.
+    UBool fHasZeroModulus = FALSE;
+
+    PluralRuleProgram(const PluralRuleProgram &) = delete;
+    PluralRuleProgram &operator=(const PluralRuleProgram &) = delete;
+};
+
 class PluralKeywordEnumeration : public StringEnumeration {
 public:
     PluralKeywordEnumeration(RuleChain *header, UErrorCode& status);
@@ -14,6 +14,7 @@
 
 #if U_HAVE_RBNF
 
+#include "unicode/coleitr.h"
 #include "unicode/normlzr.h"
 #include "unicode/plurfmt.h"
 #include "unicode/tblcoll.h"
@@ -31,8 +32,12 @@
 
 #include "cmemory.h"
 #include "cstring.h"
+#include "hash.h"
 #include "patternprops.h"
+#include "sharedrbnf.h"
+#include "unifiedcache.h"
 #include "uresimp.h"
+#include "uvectr32.h"
 #include "nfrs.h"
 #include "number_decimalquantity.h"
 
@@ -686,6 +691,7 @@ RuleBasedNumberFormat::RuleBasedNumberFormat(const UnicodeString& description,
   , defaultRuleSet(NULL)
   , locale(alocale)
   , collator(NULL)
+  , lenientPrimaries(NULL)
   , decimalFormatSymbols(NULL)
   , defaultInfinityRule(NULL)
   , defaultNaNRule(NULL)
@@ -711,6 +717,7 @@ RuleBasedNumberFormat::RuleBasedNumberFormat(const UnicodeString& description,
   , defaultRuleSet(NULL)
   , locale(Locale::getDefault())
   , collator(NULL)
+  , lenientPrimaries(NULL)
   , decimalFormatSymbols(NULL)
   , defaultInfinityRule(NULL)
   , defaultNaNRule(NULL)
@@ -736,6 +743,7 @@ RuleBasedNumberFormat::RuleBasedNumberFormat(const UnicodeString& description,
   , defaultRuleSet(NULL)
   , locale(alocale)
   , collator(NULL)
+  , lenientPrimaries(NULL)
   , decimalFormatSymbols(NULL)
   , defaultInfinityRule(NULL)
   , defaultNaNRule(NULL)
@@ -760,6 +768,7 @@ RuleBasedNumberFormat::RuleBasedNumberFormat(const UnicodeString& description,
   , defaultRuleSet(NULL)
   , locale(Locale::getDefault())
   , collator(NULL)
+  , lenientPrimaries(NULL)
   , decimalFormatSymbols(NULL)
   , defaultInfinityRule(NULL)
   , defaultNaNRule(NULL)
@@ -785,6 +794,7 @@ RuleBasedNumberFormat::RuleBasedNumberFormat(const UnicodeString& description,
   , defaultRuleSet(NULL)
   , locale(aLocale)
   , collator(NULL)
+  , lenientPrimaries(NULL)
   , decimalFormatSymbols(NULL)
   , defaultInfinityRule(NULL)
   , defaultNaNRule(NULL)
@@ -807,6 +817,7 @@ RuleBasedNumberFormat::RuleBasedNumberFormat(URBNFRuleSetTag tag, const Locale&
   , defaultRuleSet(NULL)
   , locale(alocale)
   , collator(NULL)
+  , lenientPrimaries(NULL)
   , decimalFormatSymbols(NULL)
   , defaultInfinityRule(NULL)
   , defaultNaNRule(NULL)
@@ -823,47 +834,14 @@ RuleBasedNumberFormat::RuleBasedNumberFormat(URBNFRuleSetTag tag, const Locale&
         return;
     }
 
-    const char* rules_tag = "RBNFRules";
-    const char* fmt_tag = "";
-    switch (tag) {
-    case URBNF_SPELLOUT: fmt_tag = "SpelloutRules"; break;
-    case URBNF_ORDINAL: fmt_tag = "OrdinalRules"; break;
-    case URBNF_DURATION: fmt_tag = "DurationRules"; break;
-    case URBNF_NUMBERING_SYSTEM: fmt_tag = "NumberingSystemRules"; break;
-    default: status = U_ILLEGAL_ARGUMENT_ERROR; return;
-    }
-
-    // TODO: read localization info from resource
-    LocalizationInfo* locinfo = NULL;
-
-    UResourceBundle* nfrb = ures_open(U_ICUDATA_RBNF, locale.getName(), &status);
-    if (U_SUCCESS(status)) {
-        setLocaleIDs(ures_getLocaleByType(nfrb, ULOC_VALID_LOCALE, &status),
-                     ures_getLocaleByType(nfrb, ULOC_ACTUAL_LOCALE, &status));
-
-        UResourceBundle* rbnfRules = ures_getByKeyWithFallback(nfrb, rules_tag, NULL, &status);
-        if (U_FAILURE(status)) {
-            ures_close(nfrb);
-        }
-        UResourceBundle* ruleSets = ures_getByKeyWithFallback(rbnfRules, fmt_tag, NULL, &status);
-        if (U_FAILURE(status)) {
-            ures_close(rbnfRules);
-            ures_close(nfrb);
-            return;
-        }
-
-        UnicodeString desc;
-        while (ures_hasNext(ruleSets)) {
-           desc.append(ures_getNextUnicodeString(ruleSets,NULL,&status));
-        }
-        UParseError perror;
-
-        init(desc, locinfo, perror, status);
-
-        ures_close(ruleSets);
-        ures_close(rbnfRules);
+    // the rules of each tag and locale are parsed only once, by the
+    // cached instance; copy its parsed rules
+    const SharedRuleBasedNumberFormat *shared = createSharedInstance(tag, alocale, status);
+    if (U_FAILURE(status)) {
+        return;
     }
-    ures_close(nfrb);
+    copyFrom(**shared, status);
+    shared->removeRef();
 }
 
 RuleBasedNumberFormat::RuleBasedNumberFormat(const RuleBasedNumberFormat& rhs)
@@ -874,6 +852,7 @@ RuleBasedNumberFormat::RuleBasedNumberFormat(const RuleBasedNumberFormat& rhs)
   , defaultRuleSet(NULL)
   , locale(rhs.locale)
   , collator(NULL)
+  , lenientPrimaries(NULL)
   , decimalFormatSymbols(NULL)
   , defaultInfinityRule(NULL)
   , defaultNaNRule(NULL)
@@ -897,16 +876,27 @@ RuleBasedNumberFormat::operator=(const RuleBasedNumberFormat& rhs)
     if (this == &rhs) {
         return *this;
     }
-    NumberFormat::operator=(rhs);
     UErrorCode status = U_ZERO_ERROR;
+    copyFrom(rhs, status);
+    return *this;
+}
+
+void
+RuleBasedNumberFormat::copyFrom(const RuleBasedNumberFormat& rhs, UErrorCode& status)
+{
+    NumberFormat::operator=(rhs);
     dispose();
     locale = rhs.locale;
     lenient = rhs.lenient;
 
-    UParseError perror;
     setDecimalFormatSymbols(*rhs.getDecimalFormatSymbols());
-    init(rhs.originalDescription, rhs.localizations ? rhs.localizations->ref() : NULL, perror, status);
-    setDefaultRuleSet(rhs.getDefaultRuleSetName(), status);
+    if (rhs.fRuleSets != NULL) {
+        copyRuleSets(rhs, status);
+    } else {
+        UParseError perror;
+        init(rhs.originalDescription, rhs.localizations ? rhs.localizations->ref() : NULL, perror, status);
+        setDefaultRuleSet(rhs.getDefaultRuleSetName(), status);
+    }
     setRoundingMode(rhs.getRoundingMode());
 
     capitalizationInfoSet = rhs.capitalizationInfoSet;
@@ -915,8 +905,57 @@ RuleBasedNumberFormat::operator=(const RuleBasedNumberFormat& rhs)
 #if !UCONFIG_NO_BREAK_ITERATION
     capitalizationBrkIter = (rhs.capitalizationBrkIter!=NULL)? rhs.capitalizationBrkIter->clone(): NULL;
 #endif
+}
 
-    return *this;
+/**
+ * Copies the parsed rule sets of another formatter, instead of parsing
+ * its description again.  The decimal format symbols must already be set.
+ */
+void
+RuleBasedNumberFormat::copyRuleSets(const RuleBasedNumberFormat& rhs, UErrorCode& status)
+{
+    initializeDefaultInfinityRule(status);
+    initializeDefaultNaNRule(status);
+    if (U_FAILURE(status)) {
+        return;
+    }
+
+    this->localizations = rhs.localizations == NULL ? NULL : rhs.localizations->ref();
+    originalDescription = rhs.originalDescription;
+    if (rhs.lenientParseRules != NULL) {
+        lenientParseRules = new UnicodeString(*rhs.lenientParseRules);
+        if (lenientParseRules == nullptr) {
+            status = U_MEMORY_ALLOCATION_ERROR;
+            return;
+        }
+    }
+
+    numRuleSets = rhs.numRuleSets;
+    fRuleSets = (NFRuleSet **)uprv_malloc((numRuleSets + 1) * sizeof(NFRuleSet *));
+    if (fRuleSets == 0) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    for (int i = 0; i <= numRuleSets; ++i) {
+        fRuleSets[i] = NULL;
+    }
+
+    // all rule sets have to exist before any rules are copied, because
+    // substitutions refer to other rule sets
+    for (int i = 0; i < numRuleSets; ++i) {
+        fRuleSets[i] = new NFRuleSet(this, *rhs.fRuleSets[i]);
+        if (fRuleSets[i] == nullptr) {
+            status = U_MEMORY_ALLOCATION_ERROR;
+            return;
+        }
+        if (rhs.fRuleSets[i] == rhs.defaultRuleSet) {
+            defaultRuleSet = fRuleSets[i];
+        }
+    }
+    NFCopyContext context(this, rhs.fRuleSets, fRuleSets);
+    for (int i = 0; i < numRuleSets; ++i) {
+        fRuleSets[i]->copyRules(*rhs.fRuleSets[i], context, status);
+    }
 }
 
 RuleBasedNumberFormat::~RuleBasedNumberFormat()
@@ -924,6 +963,119 @@ RuleBasedNumberFormat::~RuleBasedNumberFormat()
     dispose();
 }
 
+RuleBasedNumberFormat*
+RuleBasedNumberFormat::createFromResources(URBNFRuleSetTag tag, const Locale& alocale, UErrorCode& status)
+{
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+
+    const char* rules_tag = "RBNFRules";
+    const char* fmt_tag = "";
+    switch (tag) {
+    case URBNF_SPELLOUT: fmt_tag = "SpelloutRules"; break;
+    case URBNF_ORDINAL: fmt_tag = "OrdinalRules"; break;
+    case URBNF_DURATION: fmt_tag = "DurationRules"; break;
+    case URBNF_NUMBERING_SYSTEM: fmt_tag = "NumberingSystemRules"; break;
+    default: status = U_ILLEGAL_ARGUMENT_ERROR; return NULL;
+    }
+
+    // TODO: read localization info from resource
+    LocalizationInfo* locinfo = NULL;
+
+    LocalUResourceBundlePointer nfrb(ures_open(U_ICUDATA_RBNF, alocale.getName(), &status));
+    LocalUResourceBundlePointer rbnfRules(ures_getByKeyWithFallback(nfrb.getAlias(), rules_tag, NULL, &status));
+    LocalUResourceBundlePointer ruleSets(ures_getByKeyWithFallback(rbnfRules.getAlias(), fmt_tag, NULL, &status));
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+
+    UnicodeString desc;
+    while (ures_hasNext(ruleSets.getAlias())) {
+       desc.append(ures_getNextUnicodeString(ruleSets.getAlias(),NULL,&status));
+    }
+    UParseError perror;
+
+    LocalPointer<RuleBasedNumberFormat> result(
+        new RuleBasedNumberFormat(desc, locinfo, alocale, perror, status), status);
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    result->setLocaleIDs(ures_getLocaleByType(nfrb.getAlias(), ULOC_VALID_LOCALE, &status),
+                         ures_getLocaleByType(nfrb.getAlias(), ULOC_ACTUAL_LOCALE, &status));
+    return result.orphan();
+}
+
+SharedRuleBasedNumberFormat::~SharedRuleBasedNumberFormat() {
+    delete ptr;
+}
+
+template<> U_I18N_API
+const SharedRuleBasedNumberFormat *LocaleCacheKey<SharedRuleBasedNumberFormat>::createObject(
+        const void * /*unused*/, UErrorCode &status) const {
+    status = U_UNSUPPORTED_ERROR;
+    return NULL;
+}
+
+class U_I18N_API RuleBasedNumberFormatKey : public LocaleCacheKey<SharedRuleBasedNumberFormat> {
+private:
+    URBNFRuleSetTag fTag;
+public:
+    RuleBasedNumberFormatKey(const Locale &loc, URBNFRuleSetTag tag)
+            : LocaleCacheKey<SharedRuleBasedNumberFormat>(loc), fTag(tag) { }
+    RuleBasedNumberFormatKey(const RuleBasedNumberFormatKey &other) :
+            LocaleCacheKey<SharedRuleBasedNumberFormat>(other),
+            fTag(other.fTag) { }
+    virtual ~RuleBasedNumberFormatKey();
+    virtual int32_t hashCode() const {
+        return (int32_t)(37u * (uint32_t)LocaleCacheKey<SharedRuleBasedNumberFormat>::hashCode() + (uint32_t)fTag);
+    }
+    virtual UBool operator==(const CacheKeyBase &other) const {
+        if (this == &other) {
+            return TRUE;
+        }
+        if (!LocaleCacheKey<SharedRuleBasedNumberFormat>::operator==(other)) {
+            return FALSE;
+        }
+        // We know that this and other are of same class if we get this far.
+        const RuleBasedNumberFormatKey &realOther = static_cast<const RuleBasedNumberFormatKey &>(other);
+        return realOther.fTag == fTag;
+    }
+    virtual CacheKeyBase *clone() const {
+        return new RuleBasedNumberFormatKey(*this);
+    }
+    virtual const SharedRuleBasedNumberFormat *createObject(
+            const void * /*unused*/, UErrorCode &status) const {
+        LocalPointer<RuleBasedNumberFormat> rbnf(
+            RuleBasedNumberFormat::createFromResources(fTag, fLoc, status), status);
+        if (U_FAILURE(status)) {
+            return NULL;
+        }
+        LocalPointer<SharedRuleBasedNumberFormat> result(
+            new SharedRuleBasedNumberFormat(rbnf.getAlias()), status);
+        if (U_FAILURE(status)) {
+            return NULL;
+        }
+        rbnf.orphan();
+        result->addRef();
+        return result.orphan();
+    }
+};
+
+RuleBasedNumberFormatKey::~RuleBasedNumberFormatKey() { }
+
+const SharedRuleBasedNumberFormat* U_EXPORT2
+RuleBasedNumberFormat::createSharedInstance(URBNFRuleSetTag tag, const Locale& locale,
+                                            UErrorCode& status) {
+    const UnifiedCache *cache = UnifiedCache::getInstance(status);
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    const SharedRuleBasedNumberFormat *result = NULL;
+    cache->get(RuleBasedNumberFormatKey(locale, tag), result, status);
+    return result;
+}
+
 Format*
 RuleBasedNumberFormat::clone(void) const
 {
@@ -1436,6 +1588,8 @@ RuleBasedNumberFormat::setLenient(UBool enabled)
     if (!enabled && collator) {
         delete collator;
         collator = NULL;
+        delete lenientPrimaries;
+        lenientPrimaries = NULL;
     }
 }
 
@@ -1794,6 +1948,9 @@ RuleBasedNumberFormat::dispose()
 #endif
     collator = NULL;
 
+    delete lenientPrimaries;
+    lenientPrimaries = NULL;
+
     delete decimalFormatSymbols;
     decimalFormatSymbols = NULL;
 
@@ -1876,6 +2033,68 @@ RuleBasedNumberFormat::getCollator() const
     return collator;
 }
 
+/**
+ * Returns the primary weights of the collation elements of a string that
+ * lenient parsing matches against the text, with 0 for each ignorable
+ * element.  The weights are computed the first time a string is looked up
+ * and kept until the collator goes away.
+ * @return The weights, or null if lenient parsing is turned off.
+ */
+const UVector32*
+RuleBasedNumberFormat::getLenientPrimaries(const UnicodeString& key, UErrorCode& status) const
+{
+#if !UCONFIG_NO_COLLATION
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    const RuleBasedCollator* coll = getCollator();
+    if (coll == NULL) {
+        return NULL;
+    }
+
+    if (lenientPrimaries == NULL) {
+        LocalPointer<Hashtable> primaries(new Hashtable(status), status);
+        if (U_FAILURE(status)) {
+            return NULL;
+        }
+        primaries->setValueDeleter(uprv_deleteUObject);
+        // cast away const
+        ((RuleBasedNumberFormat*)this)->lenientPrimaries = primaries.orphan();
+    }
+
+    const UVector32* result = static_cast<const UVector32*>(lenientPrimaries->get(key));
+    if (result == NULL) {
+        LocalPointer<UVector32> keyPrimaries(new UVector32(status), status);
+        LocalPointer<CollationElementIterator> iter(coll->createCollationElementIterator(key));
+        if (U_FAILURE(status)) {
+            return NULL;
+        }
+        if (iter.isNull()) {
+            status = U_MEMORY_ALLOCATION_ERROR;
+            return NULL;
+        }
+        for (int32_t o = iter->next(status);
+                o != CollationElementIterator::NULLORDER && U_SUCCESS(status);
+                o = iter->next(status)) {
+            keyPrimaries->addElement(CollationElementIterator::primaryOrder(o), status);
+        }
+        if (U_FAILURE(status)) {
+            return NULL;
+        }
+        result = keyPrimaries.getAlias();
+        lenientPrimaries->put(key, keyPrimaries.orphan(), status);
+        if (U_FAILURE(status)) {
+            return NULL;
+        }
+    }
+    return result;
+#else
+    (void)key;
+    (void)status;
+    return NULL;
+#endif
+}
+
 
 DecimalFormatSymbols*
 RuleBasedNumberFormat::initializeDecimalFormatSymbols(UErrorCode &status)
@@ -248,20 +248,21 @@ RuleBasedTransliterator::handleTransliterate(Replaceable& text, UTransPosition&
     //   transliteration mutex.  If so, do not lock the transliteration
     //    mutex again.
     //
-    //  gLockedText variable is protected by the global ICU mutex.
+    //  gLockedText variable is protected by lockedTextMutex.
     //  Shared RBT data protected by transliteratorDataMutex.
     //
     // TODO(andy): Need a better scheme for handling this.
 
+    static UMutex lockedTextMutex;
     static UMutex transliteratorDataMutex;
     UBool needToLock;
     {
-        Mutex m;
+        Mutex m(&lockedTextMutex);
         needToLock = (&text != gLockedText);
     }
     if (needToLock) {
         umtx_lock(&transliteratorDataMutex);  // Contention, longish waits possible here.
-        Mutex m;
+        Mutex m(&lockedTextMutex);
         gLockedText = &text;
         lockedMutexAtThisLevel = TRUE;
     }
@@ -276,7 +277,7 @@ RuleBasedTransliterator::handleTransliterate(Replaceable& text, UTransPosition&
     }
     if (lockedMutexAtThisLevel) {
         {
-            Mutex m;
+            Mutex m(&lockedTextMutex);
             gLockedText = NULL;
         }
         umtx_unlock(&transliteratorDataMutex);
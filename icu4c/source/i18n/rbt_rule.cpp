@@ -219,13 +219,49 @@ int32_t TransliterationRule::getContextLength(void) const {
  * set, or otherwise can match multiple keys, the index value is -1.
  */
 int16_t TransliterationRule::getIndexValue() const {
+    UChar32 c = getFirstKeyChar();
+    return (int16_t)(c >= 0 ? (c & 0xFF) : -1);
+}
+
+/**
+ * Internal method.  Returns the literal character that text must
+ * have at the start of the key for this rule to match, or -1 if the
+ * first character of the key is a set, or the rule has only ante
+ * context.  If the key is empty this is the first character of the
+ * post context.
+ */
+UChar32 TransliterationRule::getFirstKeyChar() const {
     if (anteContextLength == pattern.length()) {
         // A pattern with just ante context {such as foo)>bar} can
         // match any key.
         return -1;
     }
     UChar32 c = pattern.char32At(anteContextLength);
-    return (int16_t)(data->lookupMatcher(c) == NULL ? (c & 0xFF) : -1);
+    return data->lookupMatcher(c) == NULL ? c : -1;
+}
+
+/**
+ * Internal method.  Returns the set that the first character of the
+ * key must belong to for this rule to match, if the key starts with a
+ * set of code points without strings, or NULL otherwise.  If the key
+ * is empty this applies to the post context.
+ */
+const UnicodeSet* TransliterationRule::getFirstKeySet() const {
+    if (anteContextLength == pattern.length()) {
+        return NULL;
+    }
+    const UnicodeFunctor* f = data->lookup(pattern.char32At(anteContextLength));
+    if (f == NULL || f->getDynamicClassID() != UnicodeSet::getStaticClassID()) {
+        return NULL;
+    }
+    const UnicodeSet* set = static_cast<const UnicodeSet*>(f);
+    // A string in the set may match text that starts with a character
+    // outside of its code points; leave such sets to the callers.
+    int32_t codePointCount = 0;
+    for (int32_t i=0; i<set->getRangeCount(); ++i) {
+        codePointCount += set->getRangeEnd(i) - set->getRangeStart(i) + 1;
+    }
+    return codePointCount == set->size() ? set : NULL;
 }
 
 /**
@@ -25,6 +25,7 @@ class Replaceable;
 class TransliterationRuleData;
 class StringMatcher;
 class UnicodeFunctor;
+class UnicodeSet;
 
 /**
  * A transliteration rule used by
@@ -228,6 +229,24 @@ class TransliterationRule : public UMemory {
      */
     int16_t getIndexValue() const;
 
+    /**
+     * Internal method.  Returns the literal character that text must
+     * have at the start of the key for this rule to match.  If the
+     * key is empty this is the first character of the post context.
+     * @return    the first key character, or -1 if it is a set or the
+     *            rule has only ante context and can match any key.
+     */
+    UChar32 getFirstKeyChar() const;
+
+    /**
+     * Internal method.  Returns the set that the first character of
+     * the key must belong to, if the key starts with a set of code
+     * points that contains no strings.  If the key is empty this
+     * applies to the post context.
+     * @return    the first key set, or NULL.
+     */
+    const UnicodeSet* getFirstKeySet() const;
+
     /**
      * Internal method.  Returns true if this rule matches the given
      * index value.  The index value is an 8-bit integer, 0..255,
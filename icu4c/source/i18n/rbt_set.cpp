@@ -16,10 +16,13 @@
 
 #include "unicode/unistr.h"
 #include "unicode/uniset.h"
+#include "unicode/umutablecptrie.h"
 #include "unicode/utf16.h"
 #include "rbt_set.h"
 #include "rbt_rule.h"
 #include "cmemory.h"
+#include "hash.h"
+#include "uvectr32.h"
 #include "putilimp.h"
 
 U_CDECL_BEGIN
@@ -172,6 +175,9 @@ TransliterationRuleSet::TransliterationRuleSet(UErrorCode& status) : UMemory() {
         status = U_MEMORY_ALLOCATION_ERROR;
     }
     rules = NULL;
+    keyIndex = NULL;
+    keyRules = NULL;
+    keyListStart = NULL;
     maxContextLength = 0;
 }
 
@@ -182,6 +188,9 @@ TransliterationRuleSet::TransliterationRuleSet(const TransliterationRuleSet& oth
     UMemory(other),
     ruleVector(0),
     rules(0),
+    keyIndex(NULL),
+    keyRules(NULL),
+    keyListStart(NULL),
     maxContextLength(other.maxContextLength) {
 
     int32_t i, len;
@@ -215,6 +224,7 @@ TransliterationRuleSet::TransliterationRuleSet(const TransliterationRuleSet& oth
 TransliterationRuleSet::~TransliterationRuleSet() {
     delete ruleVector; // This deletes the contained rules
     uprv_free(rules);
+    clearKeyIndex();
 }
 
 void TransliterationRuleSet::setData(const TransliterationRuleData* d) {
@@ -260,6 +270,7 @@ void TransliterationRuleSet::addRule(TransliterationRule* adoptedRule,
 
     uprv_free(rules);
     rules = 0;
+    clearKeyIndex();
 }
 
 /**
@@ -336,6 +347,7 @@ void TransliterationRuleSet::freeze(UParseError& parseError,UErrorCode& status)
     /* Freeze things into an array.
      */
     uprv_free(rules); // Contains alias pointers
+    clearKeyIndex();
 
     /* You can't do malloc(0)! */
     if (v.size() == 0) {
@@ -386,6 +398,169 @@ void TransliterationRuleSet::freeze(UParseError& parseError,UErrorCode& status)
     //if (errors != null) {
     //    throw new IllegalArgumentException(errors.toString());
     //}
+
+    buildKeyIndex(status);
+}
+
+/**
+ * Split each bin of rules[] by the exact first code unit of the text.
+ * A rule whose key starts with a literal character, or with a set of
+ * code points, can only match text whose first character is that
+ * literal or in that set.  So for a given first code unit we try just
+ * those rules plus the rules that can start with anything in the bin
+ * (the key starts with a segment, a quantifier or a set with strings,
+ * or the rule has only ante context), still in their original order.
+ * Supplementary literals and set members are left to index[], since
+ * text starting with a surrogate does not use keyIndex.
+ */
+void TransliterationRuleSet::buildKeyIndex(UErrorCode& status) {
+    if (U_FAILURE(status)) {
+        return;
+    }
+    int32_t n = ruleVector->size();
+    int32_t i, j, k, x;
+    UChar32 c;
+
+    MaybeStackArray<UChar32, 64> keyChars(n > 0 ? n : 1);
+    MaybeStackArray<const UnicodeSet*, 64> keySets(n > 0 ? n : 1);
+    // unitLimit[c] is the limit of the rules for code unit c in unitRules.
+    LocalMemory<int32_t> unitLimit((int32_t *)uprv_malloc(0x10001 * sizeof(int32_t)));
+    if (keyChars.getAlias() == NULL || keySets.getAlias() == NULL || unitLimit.isNull()) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    for (j=0; j<n; ++j) {
+        TransliterationRule* r = (TransliterationRule*) ruleVector->elementAt(j);
+        keyChars[j] = r->getFirstKeyChar();
+        keySets[j] = keyChars[j] < 0 ? r->getFirstKeySet() : NULL;
+    }
+
+    // Bucket the rules by each BMP code unit they can start with: count
+    // them, then fill in the buckets.  Going through the rules in order
+    // keeps every bucket in rule order.
+    LocalMemory<int32_t> unitRules;
+    uprv_memset(unitLimit.getAlias(), 0, 0x10001 * sizeof(int32_t));
+    for (int32_t pass=0; pass<2; ++pass) {
+        for (j=0; j<n; ++j) {
+            UChar32 start = keyChars[j], end = keyChars[j];
+            const UnicodeSet* set = keySets[j];
+            int32_t rangeCount = start >= 0 ? 1 : (set != NULL ? set->getRangeCount() : 0);
+            for (i=0; i<rangeCount; ++i) {
+                if (set != NULL) {
+                    start = set->getRangeStart(i);
+                    end = set->getRangeEnd(i);
+                }
+                for (c=start; c<=end && c<=0xFFFF; ++c) {
+                    if (U16_IS_SURROGATE(c)) {
+                        continue;
+                    }
+                    if (pass == 0) {
+                        ++unitLimit[c+1];
+                    } else {
+                        unitRules[unitLimit[c]++] = j;
+                    }
+                }
+            }
+        }
+        if (pass == 0) {
+            // Turn the counts into starts; the second pass moves each
+            // one up to the limit of its bucket.
+            for (c=1; c<=0x10000; ++c) {
+                unitLimit[c] += unitLimit[c-1];
+            }
+            if (unitRules.allocateInsteadAndReset(unitLimit[0x10000] > 0 ? unitLimit[0x10000] : 1) == NULL) {
+                status = U_MEMORY_ALLOCATION_ERROR;
+                return;
+            }
+        }
+    }
+
+    UVector32 listRules(status);
+    UVector32 listStart(257, status);
+    UVector32 merged(status);
+    Hashtable lists(status);
+    LocalUMutableCPTriePointer mutableTrie(umutablecptrie_open(0, 0, &status));
+    if (U_FAILURE(status)) {
+        return;
+    }
+
+    // Lists 0..255: the rules of each bin that can start with anything.
+    for (x=0; x<256; ++x) {
+        listStart.addElement(listRules.size(), status);
+        for (j=0; j<n; ++j) {
+            if (keyChars[j] < 0 && keySets[j] == NULL &&
+                    ((TransliterationRule*) ruleVector->elementAt(j))->matchesIndexValue((uint8_t)x)) {
+                listRules.addElement(j, status);
+            }
+        }
+    }
+    listStart.addElement(listRules.size(), status);
+
+    // One more list for each distinct set of candidates of a code unit.
+    UnicodeString content;
+    for (c=0; c<=0xFFFF && U_SUCCESS(status); ++c) {
+        int32_t unitStart = c > 0 ? unitLimit[c-1] : 0;
+        if (unitStart == unitLimit[c]) {
+            continue;
+        }
+        x = c & 0xFF;
+        merged.removeAllElements();
+        content.remove();
+        i = unitStart;
+        k = listStart.elementAti(x);
+        while (i < unitLimit[c] || k < listStart.elementAti(x+1)) {
+            if (k == listStart.elementAti(x+1) ||
+                    (i < unitLimit[c] && unitRules[i] < listRules.elementAti(k))) {
+                j = unitRules[i++];
+            } else {
+                j = listRules.elementAti(k++);
+            }
+            merged.addElement(j, status);
+            content.append((UChar)(j >> 16)).append((UChar)j);
+        }
+        int32_t list = lists.geti(content);
+        if (list == 0) {
+            list = listStart.size() - 1;
+            lists.puti(content, list, status);
+            for (i=0; i<merged.size(); ++i) {
+                listRules.addElement(merged.elementAti(i), status);
+            }
+            listStart.addElement(listRules.size(), status);
+        }
+        umutablecptrie_set(mutableTrie.getAlias(), c, (uint32_t)list, &status);
+    }
+    if (U_FAILURE(status)) {
+        return;
+    }
+
+    keyIndex = umutablecptrie_buildImmutable(mutableTrie.getAlias(), UCPTRIE_TYPE_FAST,
+                                             UCPTRIE_VALUE_BITS_32, &status);
+    /* You can't do malloc(0)! */
+    keyRules = (TransliterationRule **)uprv_malloc(
+        (listRules.size() > 0 ? listRules.size() : 1) * sizeof(TransliterationRule *));
+    keyListStart = (int32_t *)uprv_malloc(listStart.size() * sizeof(int32_t));
+    if (U_SUCCESS(status) && (keyRules == NULL || keyListStart == NULL)) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+    }
+    if (U_FAILURE(status)) {
+        clearKeyIndex();
+        return;
+    }
+    for (j=0; j<listRules.size(); ++j) {
+        keyRules[j] = (TransliterationRule*) ruleVector->elementAt(listRules.elementAti(j));
+    }
+    for (j=0; j<listStart.size(); ++j) {
+        keyListStart[j] = listStart.elementAti(j);
+    }
+}
+
+void TransliterationRuleSet::clearKeyIndex() {
+    ucptrie_close(keyIndex);
+    keyIndex = NULL;
+    uprv_free(keyRules);
+    keyRules = NULL;
+    uprv_free(keyListStart);
+    keyListStart = NULL;
 }
 
 /**
@@ -404,15 +579,32 @@ void TransliterationRuleSet::freeze(UParseError& parseError,UErrorCode& status)
 UBool TransliterationRuleSet::transliterate(Replaceable& text,
                                             UTransPosition& pos,
                                             UBool incremental) {
-    int16_t indexByte = (int16_t) (text.char32At(pos.start) & 0xFF);
-    for (int32_t i=index[indexByte]; i<index[indexByte+1]; ++i) {
-        UMatchDegree m = rules[i]->matchAndReplace(text, pos, incremental);
+    TransliterationRule** candidates;
+    int32_t start, limit;
+    UChar c = text.charAt(pos.start);
+    if (keyIndex != NULL && !U16_IS_SURROGATE(c)) {
+        // Skip the rules whose key starts with some other literal.
+        int32_t list = (int32_t) UCPTRIE_FAST_BMP_GET(keyIndex, UCPTRIE_32, c);
+        if (list == 0) {
+            list = c & 0xFF;
+        }
+        candidates = keyRules;
+        start = keyListStart[list];
+        limit = keyListStart[list+1];
+    } else {
+        int16_t indexByte = (int16_t) (text.char32At(pos.start) & 0xFF);
+        candidates = rules;
+        start = index[indexByte];
+        limit = index[indexByte+1];
+    }
+    for (int32_t i=start; i<limit; ++i) {
+        UMatchDegree m = candidates[i]->matchAndReplace(text, pos, incremental);
         switch (m) {
         case U_MATCH:
-            _debugOut("match", rules[i], text, pos);
+            _debugOut("match", candidates[i], text, pos);
             return TRUE;
         case U_PARTIAL_MATCH:
-            _debugOut("partial match", rules[i], text, pos);
+            _debugOut("partial match", candidates[i], text, pos);
             return FALSE;
         default: /* Ram: added default to make GCC happy */
             break;
@@ -17,6 +17,7 @@
 #if !UCONFIG_NO_TRANSLITERATION
 
 #include "unicode/uobject.h"
+#include "unicode/ucptrie.h"
 #include "unicode/utrans.h"
 #include "uvector.h"
 
@@ -58,6 +59,33 @@ class TransliterationRuleSet : public UMemory {
      */
     int32_t index[257];
 
+    /**
+     * Finer index by the first code unit of the text, created by
+     * freeze() from rules[].  keyIndex maps a BMP code unit c to a list
+     * number L, and the rules to try are
+     * keyRules[keyListStart[L]..keyListStart[L+1]-1].  Each list keeps
+     * the order of its bin in rules[], but leaves out the rules whose
+     * key starts with a literal character other than c, or with a set
+     * of code points that does not contain c.  Code units with the same
+     * candidates share a list.  A value of 0 means that no such key can
+     * start with c, and list c&0xFF is used instead; lists 0..255 hold
+     * only the rules of each bin that can start with anything.
+     * Surrogates still go through index[].
+     * keyIndex is NULL if the rule set is not frozen.
+     */
+    UCPTrie* keyIndex;
+
+    /**
+     * Candidate lists referenced by keyIndex.  Alias pointers to the
+     * rules in ruleVector.
+     */
+    TransliterationRule** keyRules;
+
+    /**
+     * Start of each candidate list in keyRules, plus a final limit.
+     */
+    int32_t* keyListStart;
+
     /**
      * Length of the longest preceding context
      */
@@ -157,6 +185,16 @@ class TransliterationRuleSet : public UMemory {
 
 private:
 
+    /**
+     * Build keyIndex, keyRules and keyListStart from rules[] and index[].
+     */
+    void buildKeyIndex(UErrorCode& status);
+
+    /**
+     * Release keyIndex, keyRules and keyListStart.
+     */
+    void clearKeyIndex();
+
     TransliterationRuleSet &operator=(const TransliterationRuleSet &other); // forbid copying of this class
 };
 
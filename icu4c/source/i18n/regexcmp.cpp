@@ -39,6 +39,7 @@
 #include "regexcst.h"   // Contains state table for the regex pattern parser.
                         //   generated by a Perl script.
 #include "regexcmp.h"
+#include "regexdfa.h"
 #include "regexst.h"
 #include "regextxt.h"
 
@@ -319,6 +320,11 @@ void    RegexCompile::compile(
     //
     matchStartType();
 
+    //
+    // Optimization pass 3: a literal string that every match contains
+    //
+    requiredString();
+
     //
     // Set up fast latin-1 range sets
     //
@@ -335,6 +341,11 @@ void    RegexCompile::compile(
         fRXPat->fSets8[i].init(s);
     }
 
+    //
+    // Patterns that need no backtracking state get an NFA, so that matching
+    //   can avoid the backtracking engine's exponential worst cases.
+    //
+    fRXPat->fNFA = RegexNFA::createInstance(*fRXPat, *fStatus);
 }
 
 
@@ -3168,6 +3179,136 @@ void   RegexCompile::matchStartType() {
 
 
 
+//------------------------------------------------------------------------------
+//
+//   requiredString    Find the longest run of literal characters that every match
+//                     of the pattern must contain, and an upper bound on its offset
+//                     from the start of the match.  find() uses these to pass over
+//                     input that could not contain a match.
+//
+//                     An op is on every path through the pattern unless some forward
+//                     branch (alternation, optional or repeated block) leads around it.
+//                     Patterns with look-around are not analysed.
+//
+//------------------------------------------------------------------------------
+void   RegexCompile::requiredString() {
+    if (U_FAILURE(*fStatus)) {
+        return;
+    }
+
+    int32_t    loc;
+    int32_t    op;
+    int32_t    opType;
+    int32_t    end = fRXPat->fCompiledPat->size();
+
+    // branchCounts holds, at each location, the change in the number of forward branches
+    //   that lead around the op at that location.  The running sum is zero for ops that
+    //   every match goes through.
+    UVector32  branchCounts(end+1, *fStatus);
+    branchCounts.setSize(end+1);
+    if (U_FAILURE(*fStatus)) {
+        return;
+    }
+    for (loc = 3; loc < end; loc++) {
+        op      = (int32_t)fRXPat->fCompiledPat->elementAti(loc);
+        opType  = URX_TYPE(op);
+        int32_t jmpDest = -1;
+        switch (opType) {
+        case URX_LA_START:
+        case URX_LB_START:
+        case URX_FAIL:
+            return;
+
+        case URX_STATE_SAVE:
+        case URX_JMP:
+        case URX_JMP_SAV:
+        case URX_JMP_SAV_X:
+            jmpDest = URX_VAL(op);
+            break;
+
+        case URX_JMPX:
+            jmpDest = URX_VAL(op);
+            loc++;              // URX_JMPX has an extra operand.
+            break;
+
+        case URX_CTR_INIT:
+        case URX_CTR_INIT_NG:
+            // The body of a counted loop may be passed over entirely.
+            jmpDest = URX_VAL(fRXPat->fCompiledPat->elementAti(loc+1)) + 1;
+            loc += 3;           // Skips over operands of CTR_INIT
+            break;
+
+        case URX_STRING:
+            loc++;
+            break;
+
+        default:
+            break;
+        }
+        if (jmpDest > loc+1) {
+            branchCounts.setElementAt(branchCounts.elementAti(loc+1) + 1, loc+1);
+            branchCounts.setElementAt(branchCounts.elementAti(jmpDest) - 1, jmpDest);
+        }
+    }
+
+    UnicodeString  bestString;
+    int32_t        bestLoc = 0;
+    UnicodeString  string;          // The run of literal characters being accumulated.
+    int32_t        stringLoc = 0;   // Location of the first op of the run.
+    UBool          atStart = TRUE;  // True if no op yet encountered could advance the match.
+    UBool          stringAtStart = FALSE;
+    int32_t        branchCount = 0;
+    for (loc = 3; loc <= end; loc++) {
+        op = loc < end ? (int32_t)fRXPat->fCompiledPat->elementAti(loc) : URX_END;
+        opType = URX_TYPE(op);
+        branchCount += branchCounts.elementAti(loc);
+        if (branchCount == 0 &&
+                (opType == URX_NOP || opType == URX_START_CAPTURE || opType == URX_END_CAPTURE)) {
+            continue;
+        }
+        if (branchCount == 0 && (opType == URX_ONECHAR || opType == URX_STRING)) {
+            if (string.isEmpty()) {
+                stringLoc = loc;
+                stringAtStart = atStart;
+            }
+            if (opType == URX_ONECHAR) {
+                string.append((UChar32)URX_VAL(op));
+            } else {
+                int32_t stringLen = URX_VAL(fRXPat->fCompiledPat->elementAti(loc+1));
+                string.append(fRXPat->fLiteralText, URX_VAL(op), stringLen);
+                loc++;
+            }
+            atStart = FALSE;
+            continue;
+        }
+
+        // Any other op ends the run of literal characters.
+        //   A run at the start of the pattern is already used by find(), if the
+        //   match start type is a string or a character.
+        if (string.length() > bestString.length() &&
+                !(stringAtStart && (fRXPat->fStartType == START_STRING || fRXPat->fStartType == START_CHAR))) {
+            bestString = string;
+            bestLoc = stringLoc;
+        }
+        string.remove();
+        atStart = FALSE;
+        if (opType == URX_STRING || opType == URX_STRING_I || opType == URX_JMPX) {
+            loc++;
+            branchCount += branchCounts.elementAti(loc);
+        }
+    }
+
+    if (bestString.isEmpty()) {
+        return;
+    }
+    fRXPat->fRequiredStringIdx   = fRXPat->fLiteralText.length();
+    fRXPat->fRequiredStringLen   = bestString.length();
+    fRXPat->fLiteralText.append(bestString);
+    fRXPat->fRequiredStringStart = maxMatchLength(3, bestLoc);
+}
+
+
+
 //------------------------------------------------------------------------------
 //
 //   minMatchLength    Calculate the length of the shortest string that could
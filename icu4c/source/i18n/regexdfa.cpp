@@ -0,0 +1,940 @@
+// © 2019 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+//
+//  file:  regexdfa.cpp
+//
+//  ICU Regular Expressions,
+//      Lazily constructed DFA for patterns that need no backtracking state.
+//      See regexdfa.h for an overview.
+//
+//      The NFA is read directly from the compiled pattern: each op of the compiled
+//      pattern is a node, with extra nodes for the characters of literal strings and
+//      for the bodies of the optimized [set]* loops.  The accepting nodes come first.
+//      An NFA of several patterns has a start node of its own, with an epsilon edge
+//      to the start of each of the patterns.
+//
+//      A DFA state is an ordered list of the NFA nodes that the match might be at.
+//      The forward, unanchored DFA used by find() keeps the nodes in the order that
+//      the backtracking engine would try them, and drops the nodes following a
+//      completed match (leftmost-first, as in Perl), so that the end of the leftmost
+//      match can be found in a single pass.  The start of the match is then found by
+//      scanning backwards from the match end with the reversed NFA.
+//
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_REGULAR_EXPRESSIONS
+
+#include "unicode/regex.h"
+#include "unicode/uchar.h"
+#include "unicode/umutablecptrie.h"
+#include "unicode/uniset.h"
+#include "unicode/utf16.h"
+#include "cmemory.h"
+#include "hash.h"
+#include "uarrsort.h"
+#include "uassert.h"
+#include "uvector.h"
+#include "uvectr32.h"
+#include "uvectr64.h"
+#include "regexdfa.h"
+#include "regeximp.h"
+
+U_NAMESPACE_BEGIN
+
+namespace {
+
+// Node numbers are stored as UChars in the keys of the DFA states.
+const int32_t kMaxNodes   = 0xffff;
+
+// Class numbers are stored in an 8 bit trie.
+const int32_t kMaxClasses = 256;
+
+// Bound on the number of transition table entries in one DFA cache.
+//   When it fills, the cache is flushed and the states are built again as needed.
+//   The states of several patterns combined are more numerous, and are given more room.
+const int32_t kMaxTransitions     = 0x10000;
+const int32_t kMaxEachTransitions = 0x100000;
+const int32_t kMinStates          = 16;
+
+// DFA state flags.
+enum {
+    kStateMatch   = 1,    // An accepting node is one of the state's nodes.
+    kStateConsume = 2,    // Some node of the state can consume more input.
+    kStateDead    = 4     // No further input can produce a match.
+};
+
+// Find a set among the distinct sets labeling the consuming edges, adding it if needed.
+int32_t addSet(UVector &sets, const UnicodeSet &set, UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return 0;
+    }
+    for (int32_t i = 0; i < sets.size(); ++i) {
+        if (*static_cast<const UnicodeSet *>(sets.elementAt(i)) == set) {
+            return i;
+        }
+    }
+    UnicodeSet *copy = new UnicodeSet(set);
+    if (copy == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return 0;
+    }
+    sets.addElement(copy, status);
+    if (U_FAILURE(status)) {
+        delete copy;
+        return 0;
+    }
+    return sets.size() - 1;
+}
+
+void addEdge(UVector32 &from, UVector32 &to, int32_t fromNode, int32_t toNode, UErrorCode &status) {
+    from.addElement(fromNode, status);
+    to.addElement(toNode, status);
+}
+
+// Group edges by their from node, keeping their relative order, into the flat graph arrays.
+void bucketEdges(int32_t numNodes, const UVector32 &from, const UVector32 &to, const UVector32 *labels,
+                 LocalMemory<int32_t> &index, LocalMemory<int32_t> &targets,
+                 LocalMemory<int32_t> *outLabels, UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return;
+    }
+    int32_t numEdges = from.size();
+    LocalMemory<int32_t> fill;
+    if (index.allocateInsteadAndReset(numNodes + 1) == NULL ||
+            targets.allocateInsteadAndReset(numEdges + 1) == NULL ||
+            (outLabels != NULL && outLabels->allocateInsteadAndReset(numEdges + 1) == NULL) ||
+            fill.allocateInsteadAndReset(numNodes) == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    int32_t e;
+    for (e = 0; e < numEdges; ++e) {
+        ++index[from.elementAti(e) + 1];
+    }
+    for (int32_t n = 0; n < numNodes; ++n) {
+        index[n + 1] += index[n];
+    }
+    for (e = 0; e < numEdges; ++e) {
+        int32_t node = from.elementAti(e);
+        int32_t slot = index[node] + fill[node]++;
+        targets[slot] = to.elementAti(e);
+        if (outLabels != NULL) {
+            (*outLabels)[slot] = labels->elementAti(e);
+        }
+    }
+}
+
+void buildGraph(RegexNFAGraph &graph, int32_t numNodes, int32_t start, int32_t accept, int32_t numAccepts,
+                const UVector32 &epsFrom, const UVector32 &epsTo,
+                const UVector32 &consumeFrom, const UVector32 &consumeTo, const UVector32 &consumeSets,
+                UErrorCode &status) {
+    graph.fNumNodes   = numNodes;
+    graph.fStart      = start;
+    graph.fAccept     = accept;
+    graph.fNumAccepts = numAccepts;
+    bucketEdges(numNodes, epsFrom, epsTo, NULL, graph.fEpsIndex, graph.fEpsTargets, NULL, status);
+    bucketEdges(numNodes, consumeFrom, consumeTo, &consumeSets,
+                graph.fConsumeIndex, graph.fConsumeTargets, &graph.fConsumeSets, status);
+}
+
+}  // namespace
+
+
+RegexNFAGraph::RegexNFAGraph() : fNumNodes(0), fStart(0), fAccept(0), fNumAccepts(0) {
+}
+
+
+//------------------------------------------------------------------------------
+//
+//   RegexNFA
+//
+//------------------------------------------------------------------------------
+RegexNFA::RegexNFA() : fNumClasses(0), fClassTrie(NULL), fMaskWords(0),
+        fPattern(NULL), fBuilt(FALSE) {
+    uprv_memset(fLatin1Classes, 0, sizeof(fLatin1Classes));
+}
+
+RegexNFA::~RegexNFA() {
+    ucptrie_close(fClassTrie);
+}
+
+RegexNFA *RegexNFA::createInstance(const RegexPattern &pattern, UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    // Only check that the pattern can be represented.  Building the character classes
+    //   costs far more than compiling most patterns, and is left for ensureBuilt().
+    const RegexPattern *patterns[] = { &pattern };
+    LocalPointer<RegexNFA> nfa(new RegexNFA(), status);
+    if (U_FAILURE(status) || !nfa->build(patterns, 1, TRUE, status) || U_FAILURE(status)) {
+        return NULL;
+    }
+    nfa->fPattern = &pattern;
+    return nfa.orphan();
+}
+
+RegexNFA *RegexNFA::createInstance(const RegexPattern *const *patterns, int32_t count,
+                                   UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    U_ASSERT(count > 0);
+    LocalPointer<RegexNFA> nfa(new RegexNFA(), status);
+    if (U_FAILURE(status) || !nfa->build(patterns, count, FALSE, status) || U_FAILURE(status)) {
+        return NULL;
+    }
+    nfa->fBuilt = TRUE;
+    return nfa.orphan();
+}
+
+
+void U_CALLCONV RegexNFA::buildOnce(RegexNFA *nfa, UErrorCode &status) {
+    const RegexPattern *patterns[] = { nfa->fPattern };
+    nfa->fBuilt = nfa->build(patterns, 1, FALSE, status) && U_SUCCESS(status);
+}
+
+
+UBool RegexNFA::ensureBuilt(UErrorCode &status) const {
+    if (fPattern != NULL) {
+        RegexNFA *nfa = const_cast<RegexNFA *>(this);
+        umtx_initOnce(nfa->fBuildOnce, &RegexNFA::buildOnce, nfa, status);
+    }
+    return U_SUCCESS(status) && fBuilt;
+}
+
+
+//------------------------------------------------------------------------------
+//
+//   build     Translate the compiled patterns into the NFA graphs.
+//             Return FALSE if a pattern contains an op that the NFA can't represent,
+//             or if the NFA would be too large.
+//             checkOnly:  stop once the ops have been checked, building nothing.
+//
+//------------------------------------------------------------------------------
+UBool RegexNFA::build(const RegexPattern *const *patterns, int32_t count, UBool checkOnly,
+                      UErrorCode &status) {
+    int32_t numNodes  = count;              // The accepting nodes.
+    int32_t startNode = numNodes;
+    if (count > 1) {
+        ++numNodes;
+    }
+
+    UVector   sets(uprv_deleteUObject, NULL, status);
+    UVector32 epsFrom(status);
+    UVector32 epsTo(status);
+    UVector32 consumeFrom(status);
+    UVector32 consumeTo(status);
+    UVector32 consumeSets(status);
+    UnicodeSet lineEnds(0x0a, 0x0d);
+    lineEnds.add(0x85).add(0x2028, 0x2029);
+
+    for (int32_t patIdx = 0; patIdx < count; ++patIdx) {
+        const RegexPattern &pattern = *patterns[patIdx];
+        const UVector64 &code      = *pattern.fCompiledPat;
+        const UChar     *litText   = pattern.fLiteralText.getBuffer();
+        int32_t          codeSize  = code.size();
+        int32_t          base      = numNodes;  // Node of the first op.
+        int32_t          matchNode = patIdx;
+        numNodes += codeSize;
+        if (numNodes > kMaxNodes) {
+            return FALSE;
+        }
+        if (count > 1) {
+            addEdge(epsFrom, epsTo, startNode, base, status);
+        }
+
+        for (int32_t pc = 0; pc < codeSize && U_SUCCESS(status); ++pc) {
+            int32_t    op      = (int32_t)code.elementAti(pc);
+            int32_t    opType  = URX_TYPE(op);
+            int32_t    opValue = URX_VAL(op);
+            UnicodeSet set;
+            UBool      consumes = TRUE;     // Op matches one character from set, then continues at pc+1.
+
+            switch (opType) {
+            case URX_NOP:
+            case URX_START_CAPTURE:
+            case URX_END_CAPTURE:
+            case URX_STO_INP_LOC:
+                addEdge(epsFrom, epsTo, base + pc, base + pc + 1, status);
+                consumes = FALSE;
+                break;
+
+            case URX_JMP:
+                addEdge(epsFrom, epsTo, base + pc, base + opValue, status);
+                consumes = FALSE;
+                break;
+
+            case URX_JMPX:
+                // Conditional on the loop having consumed input.  An iteration that consumed
+                //   nothing can't change what matches, so the NFA always takes the jump.
+                addEdge(epsFrom, epsTo, base + pc, base + opValue, status);
+                ++pc;
+                consumes = FALSE;
+                break;
+
+            case URX_STATE_SAVE:
+                addEdge(epsFrom, epsTo, base + pc, base + pc + 1, status);
+                addEdge(epsFrom, epsTo, base + pc, base + opValue, status);
+                consumes = FALSE;
+                break;
+
+            case URX_JMP_SAV:
+            case URX_JMP_SAV_X:
+                addEdge(epsFrom, epsTo, base + pc, base + opValue, status);
+                addEdge(epsFrom, epsTo, base + pc, base + pc + 1, status);
+                consumes = FALSE;
+                break;
+
+            case URX_END:
+                addEdge(epsFrom, epsTo, base + pc, matchNode, status);
+                consumes = FALSE;
+                break;
+
+            case URX_FAIL:
+            case URX_BACKTRACK:
+                consumes = FALSE;
+                break;
+
+            case URX_ONECHAR:
+                set.add(opValue);
+                break;
+
+            case URX_STRING:
+                {
+                    // One node per character. The last character continues after the URX_STRING_LEN.
+                    const UChar *s   = litText + opValue;
+                    int32_t      len = URX_VAL(code.elementAti(pc + 1));
+                    int32_t      i   = 0;
+                    int32_t      node = base + pc;
+                    while (i < len) {
+                        UChar32 c;
+                        U16_NEXT(s, i, len, c);
+                        set.set(c, c);
+                        int32_t next = i < len ? numNodes++ : base + pc + 2;
+                        addEdge(consumeFrom, consumeTo, node, next, status);
+                        consumeSets.addElement(addSet(sets, set, status), status);
+                        node = next;
+                    }
+                    ++pc;
+                    consumes = FALSE;
+                }
+                break;
+
+            case URX_SETREF:
+                set = *static_cast<const UnicodeSet *>(pattern.fSets->elementAt(opValue));
+                break;
+
+            case URX_STATIC_SETREF:
+                set = *pattern.fStaticSets[opValue & ~URX_NEG_SET];
+                if (opValue & URX_NEG_SET) {
+                    set.complement();
+                }
+                break;
+
+            case URX_STAT_SETREF_N:
+                set = *pattern.fStaticSets[opValue];
+                set.complement();
+                break;
+
+            case URX_DOTANY:
+                set = lineEnds;
+                set.complement();
+                break;
+
+            case URX_DOTANY_UNIX:
+                set.add(0x0a).complement();
+                break;
+
+            case URX_BACKSLASH_D:
+                set.applyIntPropertyValue(UCHAR_GENERAL_CATEGORY_MASK, U_GC_ND_MASK, status);
+                if (opValue != 0) {
+                    set.complement();
+                }
+                break;
+
+            case URX_BACKSLASH_H:
+                set.applyIntPropertyValue(UCHAR_GENERAL_CATEGORY_MASK, U_GC_ZS_MASK, status);
+                set.add(9);
+                if (opValue != 0) {
+                    set.complement();
+                }
+                break;
+
+            case URX_BACKSLASH_V:
+                set = lineEnds;
+                if (opValue != 0) {
+                    set.complement();
+                }
+                break;
+
+            case URX_LOOP_SR_I:
+            case URX_LOOP_DOT_I:
+                {
+                    // Greedy [set]* or .*, continuing after the URX_LOOP_C that follows.
+                    if (opType == URX_LOOP_SR_I) {
+                        set = *static_cast<const UnicodeSet *>(pattern.fSets->elementAt(opValue));
+                    } else if ((opValue & 1) == 0) {
+                        if ((opValue & 2) == 0) {
+                            set = lineEnds;
+                        } else {
+                            set.add(0x0a);
+                        }
+                        set.complement();
+                    } else {
+                        // Dot-matches-all mode backs out of a CR/LF as a unit.
+                        return FALSE;
+                    }
+                    int32_t loopNode = numNodes++;
+                    addEdge(epsFrom, epsTo, base + pc, loopNode, status);
+                    addEdge(epsFrom, epsTo, base + pc, base + pc + 2, status);
+                    addEdge(consumeFrom, consumeTo, loopNode, base + pc, status);
+                    consumeSets.addElement(addSet(sets, set, status), status);
+                    ++pc;
+                    consumes = FALSE;
+                }
+                break;
+
+            default:
+                // Anchors, boundaries, back references, look-around, atomic groups, counted
+                //   loops and case insensitive literals all need state that the NFA doesn't have.
+                return FALSE;
+            }
+
+            if (consumes) {
+                addEdge(consumeFrom, consumeTo, base + pc, base + pc + 1, status);
+                consumeSets.addElement(addSet(sets, set, status), status);
+            }
+            if (numNodes > kMaxNodes) {
+                return FALSE;
+            }
+        }
+    }
+    if (U_FAILURE(status) || checkOnly) {
+        return U_SUCCESS(status);
+    }
+
+    //
+    // Partition the code points into classes that none of the sets distinguish,
+    //   splitting the classes by each set in turn.
+    //
+    LocalUMutableCPTriePointer classes(umutablecptrie_open(0, 0, &status));
+    LocalMemory<int32_t> classSize;
+    LocalMemory<int32_t> inSet;
+    LocalMemory<int32_t> splitTo;
+    if (U_FAILURE(status)) {
+        return FALSE;
+    }
+    if (classSize.allocateInsteadAndReset(kMaxClasses) == NULL ||
+            inSet.allocateInsteadAndReset(kMaxClasses) == NULL ||
+            splitTo.allocateInsteadAndReset(kMaxClasses) == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return FALSE;
+    }
+    int32_t numClasses = 1;
+    classSize[0] = 0x110000;
+    int32_t setIdx;
+    for (setIdx = 0; setIdx < sets.size(); ++setIdx) {
+        const UnicodeSet *set = static_cast<const UnicodeSet *>(sets.elementAt(setIdx));
+        int32_t k;
+        for (k = 0; k < numClasses; ++k) {
+            inSet[k] = 0;
+        }
+        int32_t r;
+        for (r = 0; r < set->getRangeCount(); ++r) {
+            UChar32 start = set->getRangeStart(r);
+            UChar32 end   = set->getRangeEnd(r);
+            while (start <= end) {
+                uint32_t value;
+                UChar32 rangeEnd = umutablecptrie_getRange(classes.getAlias(), start, UCPMAP_RANGE_NORMAL, 0,
+                                                           NULL, NULL, &value);
+                if (rangeEnd > end) {
+                    rangeEnd = end;
+                }
+                inSet[value] += rangeEnd - start + 1;
+                start = rangeEnd + 1;
+            }
+        }
+        int32_t priorNumClasses = numClasses;
+        for (k = 0; k < kMaxClasses; ++k) {
+            splitTo[k] = -1;
+        }
+        for (k = 0; k < priorNumClasses; ++k) {
+            if (inSet[k] > 0 && inSet[k] < classSize[k]) {
+                if (numClasses >= kMaxClasses) {
+                    return FALSE;
+                }
+                splitTo[k] = numClasses;
+                classSize[numClasses++] = inSet[k];
+                classSize[k] -= inSet[k];
+            }
+        }
+        for (r = 0; r < set->getRangeCount(); ++r) {
+            UChar32 start = set->getRangeStart(r);
+            UChar32 end   = set->getRangeEnd(r);
+            while (start <= end) {
+                uint32_t value;
+                UChar32 rangeEnd = umutablecptrie_getRange(classes.getAlias(), start, UCPMAP_RANGE_NORMAL, 0,
+                                                           NULL, NULL, &value);
+                if (rangeEnd > end) {
+                    rangeEnd = end;
+                }
+                if (splitTo[value] >= 0) {
+                    umutablecptrie_setRange(classes.getAlias(), start, rangeEnd, splitTo[value], &status);
+                }
+                start = rangeEnd + 1;
+            }
+        }
+    }
+    if (U_FAILURE(status)) {
+        return FALSE;
+    }
+
+    // Each set becomes a bit mask over the classes.
+    fNumClasses = numClasses;
+    fMaskWords  = (numClasses + 31) / 32;
+    if (fSetMasks.allocateInsteadAndReset(sets.size() * fMaskWords + 1) == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return FALSE;
+    }
+    for (setIdx = 0; setIdx < sets.size(); ++setIdx) {
+        const UnicodeSet *set = static_cast<const UnicodeSet *>(sets.elementAt(setIdx));
+        uint32_t *mask = fSetMasks.getAlias() + setIdx * fMaskWords;
+        for (int32_t r = 0; r < set->getRangeCount(); ++r) {
+            UChar32 start = set->getRangeStart(r);
+            UChar32 end   = set->getRangeEnd(r);
+            while (start <= end) {
+                uint32_t value;
+                UChar32 rangeEnd = umutablecptrie_getRange(classes.getAlias(), start, UCPMAP_RANGE_NORMAL, 0,
+                                                           NULL, NULL, &value);
+                mask[value >> 5] |= (uint32_t)1 << (value & 31);
+                start = rangeEnd + 1;
+            }
+        }
+    }
+    for (UChar32 c = 0; c < 0x100; ++c) {
+        fLatin1Classes[c] = (uint8_t)umutablecptrie_get(classes.getAlias(), c);
+    }
+    fClassTrie = umutablecptrie_buildImmutable(classes.getAlias(), UCPTRIE_TYPE_FAST, UCPTRIE_VALUE_BITS_8, &status);
+
+    if (count == 1) {
+        buildGraph(fForward, numNodes, startNode, 0, 1, epsFrom, epsTo, consumeFrom, consumeTo, consumeSets, status);
+        buildGraph(fReverse, numNodes, 0, startNode, 1, epsTo, epsFrom, consumeTo, consumeFrom, consumeSets, status);
+    } else {
+        buildGraph(fForward, numNodes, startNode, 0, count, epsFrom, epsTo, consumeFrom, consumeTo, consumeSets, status);
+    }
+    return U_SUCCESS(status);
+}
+
+
+//------------------------------------------------------------------------------
+//
+//   RegexDFACache     The lazily built states of one DFA over one RegexNFAGraph.
+//
+//                     ordered:     keep the nodes of a state in priority order, and
+//                                  drop the nodes following the accepting node.
+//                                  Otherwise a state's nodes are kept sorted.
+//                     unanchored:  a match may begin at any position.  If ordered, only
+//                                  until a match has been seen; otherwise at every position,
+//                                  so that every match is seen.
+//
+//------------------------------------------------------------------------------
+class RegexDFACache : public UMemory {
+  public:
+    RegexDFACache(const RegexNFA &nfa, const RegexNFAGraph &graph, UBool ordered, UBool unanchored,
+                  int32_t maxTransitions, UErrorCode &status);
+
+    int32_t startState(UErrorCode &status);
+
+    inline int32_t next(int32_t state, int32_t cls, UErrorCode &status) {
+        int32_t next = fTransitions.elementAti(state * fNumClasses + cls);
+        return next > 0 ? next - 1 : computeNext(state, cls, status);
+    }
+
+    inline int32_t flags(int32_t state) const {
+        return fFlags.elementAti(state);
+    }
+
+    //  The state's nodes, starting at index 1.  Unordered, the accepting nodes come first.
+    inline const UnicodeString &nodes(int32_t state) const {
+        return *static_cast<const UnicodeString *>(fKeys.elementAt(state));
+    }
+
+  private:
+    int32_t computeNext(int32_t state, int32_t cls, UErrorCode &status);
+    void    beginNodes();
+    void    addClosure(int32_t node, UErrorCode &status);
+    int32_t addState(const UnicodeString &key, UErrorCode &status);
+    void    setKey(UBool matched, UErrorCode &status);
+    void    flush();
+
+    const RegexNFA       &fNFA;
+    const RegexNFAGraph  &fGraph;
+    UBool                 fOrdered;
+    UBool                 fUnanchored;
+    int32_t               fNumClasses;
+    int32_t               fMaxStates;
+    int32_t               fStartState;     // -1 if not yet built.
+
+    UVector32             fTransitions;    // [state * fNumClasses + class]: next state + 1, or 0 if unknown.
+    UVector32             fFlags;          // Per state kState* flags.
+    UVector               fKeys;           // Per state key, a UnicodeString: a flag set once a match has
+                                           //   been seen (unanchored only), followed by the state's nodes.
+    Hashtable             fStateMap;       // Key to state + 1.
+
+    // Scratch space for building states.
+    UVector32             fNodes;
+    UVector32             fStack;
+    LocalMemory<int32_t>  fMarks;          // Per NFA node, fMarkGeneration if already in fNodes.
+    int32_t               fMarkGeneration;
+    UBool                 fStopped;        // The accepting node was added to ordered fNodes.
+    UnicodeString         fKey;
+};
+
+
+RegexDFACache::RegexDFACache(const RegexNFA &nfa, const RegexNFAGraph &graph, UBool ordered, UBool unanchored,
+                             int32_t maxTransitions, UErrorCode &status) :
+        fNFA(nfa), fGraph(graph), fOrdered(ordered), fUnanchored(unanchored),
+        fNumClasses(nfa.fNumClasses), fMaxStates(maxTransitions / nfa.fNumClasses), fStartState(-1),
+        fTransitions(status), fFlags(status), fKeys(uprv_deleteUObject, NULL, status), fStateMap(status),
+        fNodes(status), fStack(status), fMarkGeneration(0), fStopped(FALSE) {
+    if (fMaxStates < kMinStates) {
+        fMaxStates = kMinStates;
+    }
+    if (U_SUCCESS(status) && fMarks.allocateInsteadAndReset(graph.fNumNodes) == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+    }
+}
+
+
+void RegexDFACache::beginNodes() {
+    fNodes.removeAllElements();
+    fStopped = FALSE;
+    if (++fMarkGeneration == INT32_MAX) {
+        uprv_memset(fMarks.getAlias(), 0, fGraph.fNumNodes * sizeof(int32_t));
+        fMarkGeneration = 1;
+    }
+}
+
+
+//------------------------------------------------------------------------------
+//
+//   addClosure    Add a node, and all nodes reachable from it by epsilon edges,
+//                 to the nodes of the state being built, in priority order.
+//                 Only nodes that consume input, and the accepting node, are kept.
+//
+//------------------------------------------------------------------------------
+void RegexDFACache::addClosure(int32_t node, UErrorCode &status) {
+    if (fStopped) {
+        return;
+    }
+    fStack.removeAllElements();
+    fStack.push(node, status);
+    while (!fStack.empty() && U_SUCCESS(status)) {
+        int32_t n = fStack.popi();
+        if (fMarks[n] == fMarkGeneration) {
+            continue;
+        }
+        fMarks[n] = fMarkGeneration;
+        if (fGraph.isAccept(n) || fGraph.fConsumeIndex[n] < fGraph.fConsumeIndex[n + 1]) {
+            fNodes.addElement(n, status);
+            if (fGraph.isAccept(n) && fOrdered) {
+                // Anything of lower priority than a completed match is never tried.
+                fStopped = TRUE;
+                return;
+            }
+        }
+        // Push in reverse, so that the first edge is followed first.
+        for (int32_t e = fGraph.fEpsIndex[n + 1] - 1; e >= fGraph.fEpsIndex[n]; --e) {
+            fStack.push(fGraph.fEpsTargets[e], status);
+        }
+    }
+}
+
+
+void RegexDFACache::setKey(UBool matched, UErrorCode &status) {
+    if (!fOrdered && fNodes.size() > 1) {
+        uprv_sortArray(fNodes.getBuffer(), fNodes.size(), sizeof(int32_t),
+                       uprv_int32Comparator, NULL, FALSE, &status);
+    }
+    fKey.remove();
+    fKey.append((UChar)matched);
+    for (int32_t i = 0; i < fNodes.size(); ++i) {
+        fKey.append((UChar)fNodes.elementAti(i));
+    }
+}
+
+
+int32_t RegexDFACache::addState(const UnicodeString &key, UErrorCode &status) {
+    int32_t state = fStateMap.geti(key) - 1;
+    if (state >= 0 || U_FAILURE(status)) {
+        return state >= 0 ? state : 0;
+    }
+    int32_t flags = 0;
+    for (int32_t i = 1; i < key.length(); ++i) {
+        int32_t node = key.charAt(i);
+        if (fGraph.isAccept(node)) {
+            flags |= kStateMatch;
+        }
+        if (fGraph.fConsumeIndex[node] < fGraph.fConsumeIndex[node + 1]) {
+            flags |= kStateConsume;
+        }
+    }
+    if (key.length() == 1 && (!fUnanchored || key.charAt(0) != 0)) {
+        flags |= kStateDead;
+    }
+
+    UnicodeString *keyCopy = new UnicodeString(key);
+    if (keyCopy == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return 0;
+    }
+    fKeys.addElement(keyCopy, status);
+    if (U_FAILURE(status)) {
+        delete keyCopy;
+        return 0;
+    }
+    state = fKeys.size() - 1;
+    fStateMap.puti(key, state + 1, status);
+    fFlags.addElement(flags, status);
+    if (fTransitions.ensureCapacity(fKeys.size() * fNumClasses, status)) {
+        fTransitions.setSize(fKeys.size() * fNumClasses);
+    }
+    return state;
+}
+
+
+void RegexDFACache::flush() {
+    fStateMap.removeAll();
+    fKeys.removeAllElements();
+    fFlags.removeAllElements();
+    fTransitions.removeAllElements();
+    fStartState = -1;
+}
+
+
+int32_t RegexDFACache::startState(UErrorCode &status) {
+    if (fStartState < 0 && U_SUCCESS(status)) {
+        if (fKeys.size() >= fMaxStates) {
+            flush();
+        }
+        beginNodes();
+        addClosure(fGraph.fStart, status);
+        setKey(FALSE, status);
+        fStartState = addState(fKey, status);
+    }
+    return U_SUCCESS(status) ? fStartState : 0;
+}
+
+
+int32_t RegexDFACache::computeNext(int32_t state, int32_t cls, UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return 0;
+    }
+    const UnicodeString &key = *static_cast<const UnicodeString *>(fKeys.elementAt(state));
+    UBool matched = key.charAt(0) != 0;
+    beginNodes();
+    for (int32_t i = 1; i < key.length() && !fStopped; ++i) {
+        int32_t node = key.charAt(i);
+        if (fGraph.isAccept(node) && fOrdered) {
+            matched = TRUE;
+        }
+        for (int32_t e = fGraph.fConsumeIndex[node]; e < fGraph.fConsumeIndex[node + 1]; ++e) {
+            if (fNFA.setContainsClass(fGraph.fConsumeSets[e], cls)) {
+                addClosure(fGraph.fConsumeTargets[e], status);
+            }
+        }
+    }
+    if (fUnanchored && !matched) {
+        // A match starting at the new position, tried after all earlier starts.
+        //   Unordered, matched stays FALSE, and a match may start at every position.
+        addClosure(fGraph.fStart, status);
+    }
+    if (fKeys.size() >= fMaxStates) {
+        // The cache is full. Start it over, keeping only the current state.
+        UnicodeString current(key);
+        flush();
+        state = addState(current, status);
+    }
+    setKey(matched, status);
+    int32_t next = addState(fKey, status);
+    if (U_SUCCESS(status)) {
+        fTransitions.setElementAt(next + 1, state * fNumClasses + cls);
+    }
+    return next;
+}
+
+
+//------------------------------------------------------------------------------
+//
+//   RegexDFA
+//
+//------------------------------------------------------------------------------
+RegexDFA::RegexDFA(const RegexNFA &nfa) :
+        fNFA(nfa), fFindCache(NULL), fReverseCache(NULL), fAnchoredCache(NULL), fEachCache(NULL) {
+}
+
+RegexDFA::~RegexDFA() {
+    delete fFindCache;
+    delete fReverseCache;
+    delete fAnchoredCache;
+    delete fEachCache;
+}
+
+
+RegexDFACache *RegexDFA::getCache(RegexDFACache *&cache, const RegexNFAGraph &graph,
+                                  UBool ordered, UBool unanchored, UErrorCode &status) {
+    if (cache == NULL && U_SUCCESS(status)) {
+        int32_t maxTransitions = (unanchored && !ordered) ? kMaxEachTransitions : kMaxTransitions;
+        cache = new RegexDFACache(fNFA, graph, ordered, unanchored, maxTransitions, status);
+        if (cache == NULL) {
+            status = U_MEMORY_ALLOCATION_ERROR;
+        } else if (U_FAILURE(status)) {
+            delete cache;
+            cache = NULL;
+        }
+    }
+    return cache;
+}
+
+
+UBool RegexDFA::find(UText *text, int64_t startIdx, int64_t limit, int64_t &matchStart,
+                     UBool &hitEnd, UErrorCode &status) {
+    RegexDFACache *forward = getCache(fFindCache, fNFA.fForward, TRUE, TRUE, status);
+    RegexDFACache *reverse = getCache(fReverseCache, fNFA.fReverse, FALSE, FALSE, status);
+    if (U_FAILURE(status)) {
+        return FALSE;
+    }
+
+    // Scan forward for the end of the leftmost match.
+    //   Nodes of matches starting earlier come first in a state, so a completed match
+    //   only cuts off matches that start later.  Nodes of earlier starts keep running
+    //   until they end or match, and the last match end seen is the end of a match
+    //   from the leftmost possible start.
+    int64_t idx      = startIdx;
+    int64_t matchEnd = -1;
+    int32_t state    = forward->startState(status);
+    UTEXT_SETNATIVEINDEX(text, idx);
+    while (U_SUCCESS(status)) {
+        int32_t flags = forward->flags(state);
+        if (flags & kStateMatch) {
+            matchEnd = idx;
+        }
+        if (flags & kStateDead) {
+            break;
+        }
+        if (idx >= limit) {
+            if (flags & kStateConsume) {
+                hitEnd = TRUE;
+            }
+            break;
+        }
+        UChar32 c = UTEXT_NEXT32(text);
+        idx = UTEXT_GETNATIVEINDEX(text);
+        state = forward->next(state, fNFA.classOf(c), status);
+    }
+    if (matchEnd < 0 || U_FAILURE(status)) {
+        return FALSE;
+    }
+
+    // Scan backwards from the match end. The match start is the earliest position,
+    //   not before startIdx, from which the pattern matches up to the match end.
+    matchStart = -1;
+    idx   = matchEnd;
+    state = reverse->startState(status);
+    UTEXT_SETNATIVEINDEX(text, idx);
+    while (U_SUCCESS(status)) {
+        int32_t flags = reverse->flags(state);
+        if (flags & kStateMatch) {
+            matchStart = idx;
+        }
+        if ((flags & kStateDead) || idx <= startIdx) {
+            break;
+        }
+        UChar32 c = UTEXT_PREVIOUS32(text);
+        idx = UTEXT_GETNATIVEINDEX(text);
+        if (idx < startIdx) {
+            // startIdx is inside of a character; the forward scan began by reading all of it.
+            idx = startIdx;
+        }
+        state = reverse->next(state, fNFA.classOf(c), status);
+    }
+    U_ASSERT(U_FAILURE(status) || matchStart >= startIdx);
+    return U_SUCCESS(status) && matchStart >= 0;
+}
+
+
+UBool RegexDFA::mayMatchAt(UText *text, int64_t startIdx, int64_t limit, UBool toEnd,
+                           UBool &hitEnd, UErrorCode &status) {
+    RegexDFACache *anchored = getCache(fAnchoredCache, fNFA.fForward, FALSE, FALSE, status);
+    if (U_FAILURE(status)) {
+        return FALSE;
+    }
+    int64_t idx   = startIdx;
+    int32_t state = anchored->startState(status);
+    UTEXT_SETNATIVEINDEX(text, idx);
+    while (U_SUCCESS(status)) {
+        int32_t flags = anchored->flags(state);
+        if ((flags & kStateMatch) && (!toEnd || idx >= limit)) {
+            return TRUE;
+        }
+        if (flags & kStateDead) {
+            break;
+        }
+        if (idx >= limit) {
+            if (flags & kStateConsume) {
+                hitEnd = TRUE;
+            }
+            break;
+        }
+        UChar32 c = UTEXT_NEXT32(text);
+        idx = UTEXT_GETNATIVEINDEX(text);
+        state = anchored->next(state, fNFA.classOf(c), status);
+    }
+    return FALSE;
+}
+
+
+int32_t RegexDFA::findEach(UText *text, int64_t startIdx, int64_t limit, UBool *matched,
+                           UErrorCode &status) {
+    const RegexNFAGraph &graph = fNFA.fForward;
+    RegexDFACache *each = getCache(fEachCache, graph, FALSE, TRUE, status);
+    if (U_FAILURE(status)) {
+        return 0;
+    }
+    int32_t numPatterns = graph.fNumAccepts;
+    int32_t numMatched  = 0;
+    int32_t remaining   = 0;
+    for (int32_t i = 0; i < numPatterns; ++i) {
+        if (!matched[i]) {
+            ++remaining;
+        }
+    }
+    int64_t idx   = startIdx;
+    int32_t state = each->startState(status);
+    UTEXT_SETNATIVEINDEX(text, idx);
+    while (U_SUCCESS(status) && remaining > 0) {
+        if (each->flags(state) & kStateMatch) {
+            const UnicodeString &nodes = each->nodes(state);
+            for (int32_t i = 1; i < nodes.length() && graph.isAccept(nodes.charAt(i)); ++i) {
+                int32_t patIdx = nodes.charAt(i) - graph.fAccept;
+                if (!matched[patIdx]) {
+                    matched[patIdx] = TRUE;
+                    ++numMatched;
+                    --remaining;
+                }
+            }
+        }
+        if (idx >= limit) {
+            break;
+        }
+        UChar32 c = UTEXT_NEXT32(text);
+        idx = UTEXT_GETNATIVEINDEX(text);
+        state = each->next(state, fNFA.classOf(c), status);
+    }
+    return numMatched;
+}
+
+U_NAMESPACE_END
+
+#endif  // !UCONFIG_NO_REGULAR_EXPRESSIONS
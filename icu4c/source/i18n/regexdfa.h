@@ -0,0 +1,168 @@
+// © 2019 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+//
+//  file:  regexdfa.h
+//
+//  ICU Regular Expressions,
+//      Lazily constructed DFA, used by the matcher to locate matches of patterns
+//      that need no backtracking state: no back references, look-around,
+//      atomic or possessive constructs, counted loops, anchors or case folding.
+//
+//  RegexNFA is made by the pattern compiler for the patterns that it can represent,
+//  and is shared by all matchers using the pattern.  Its graphs and character
+//  classes are only built when a matcher first needs them, and are immutable once
+//  built.
+//  RegexDFA holds the lazily built automaton states, and belongs to a single matcher.
+//
+//  A RegexSet combines several such patterns into one RegexNFA, with an accepting
+//  node for each of them, and scans the input once for all of them.
+//
+//  This class is internal to the regular expression implementation.
+//  For the public Regular Expression API, see the file "unicode/regex.h"
+//
+
+#ifndef REGEXDFA_H
+#define REGEXDFA_H
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_REGULAR_EXPRESSIONS
+
+#include "unicode/ucptrie.h"
+#include "unicode/uobject.h"
+#include "unicode/utext.h"
+#include "cmemory.h"
+#include "umutex.h"
+
+U_NAMESPACE_BEGIN
+
+class RegexDFACache;
+class RegexPattern;
+
+//
+//  RegexNFAGraph    One direction, forward or reverse, of a RegexNFA.
+//                   Nodes are connected by character consuming edges, labeled with
+//                   a character class set, and by epsilon edges, in priority order.
+//                   Both kinds of edge are stored as flat, per node index arrays.
+//
+struct RegexNFAGraph : public UMemory {
+    int32_t              fNumNodes;
+    int32_t              fStart;           // Node where matching begins.
+    int32_t              fAccept;          // Node reached by a successful match.
+    int32_t              fNumAccepts;      // For several patterns, the accepting nodes of
+                                           //   patterns 0 to fNumAccepts-1 are numbered
+                                           //   from fAccept up.
+    LocalMemory<int32_t> fEpsIndex;        // fNumNodes+1 entries, indexes into fEpsTargets.
+    LocalMemory<int32_t> fEpsTargets;
+    LocalMemory<int32_t> fConsumeIndex;    // fNumNodes+1 entries, indexes into the next two.
+    LocalMemory<int32_t> fConsumeSets;     // Class set (row of RegexNFA::fSetMasks) of each edge.
+    LocalMemory<int32_t> fConsumeTargets;
+
+    RegexNFAGraph();
+
+    inline UBool isAccept(int32_t node) const {
+        return (uint32_t)(node - fAccept) < (uint32_t)fNumAccepts;
+    }
+};
+
+
+class RegexNFA : public UMemory {
+  public:
+    //  Make the NFA for a compiled pattern, which must outlive it.
+    //  Returns NULL, with no error, if the pattern uses operations that can not be
+    //  expressed without backtracking state.
+    //  The NFA is not built until ensureBuilt() is called.
+    static RegexNFA *createInstance(const RegexPattern &pattern, UErrorCode &status);
+
+    //  Build one NFA for several patterns, each of which has an NFA of its own.
+    //  Only the forward graph is built.
+    //  Returns NULL, with no error, if the combined NFA is too large.
+    static RegexNFA *createInstance(const RegexPattern *const *patterns, int32_t count,
+                                    UErrorCode &status);
+    ~RegexNFA();
+
+    //  Build the NFA of a single pattern, if it hasn't been yet.  Thread safe.
+    //  Returns FALSE if the NFA can't be used, because it would be too large.
+    UBool ensureBuilt(UErrorCode &status) const;
+
+    inline int32_t classOf(UChar32 c) const {
+        return c < 0x100 ? fLatin1Classes[c] : UCPTRIE_FAST_GET(fClassTrie, UCPTRIE_8, c);
+    }
+    inline UBool setContainsClass(int32_t set, int32_t cls) const {
+        return (fSetMasks[set * fMaskWords + (cls >> 5)] >> (cls & 31)) & 1;
+    }
+
+    RegexNFAGraph          fForward;
+    RegexNFAGraph          fReverse;       // fForward with all edges reversed, start and accept swapped.
+                                           //   Not built for several patterns.
+
+    int32_t                fNumClasses;    // Code points are partitioned into classes that
+                                           //   no set used by the pattern distinguishes.
+    UCPTrie               *fClassTrie;     // Code point to class.
+    uint8_t                fLatin1Classes[256];
+    int32_t                fMaskWords;     // uint32_t words per row of fSetMasks.
+    LocalMemory<uint32_t>  fSetMasks;      // For each character set, a bit per class.
+
+  private:
+    RegexNFA();
+    UBool build(const RegexPattern *const *patterns, int32_t count, UBool checkOnly, UErrorCode &status);
+    static void U_CALLCONV buildOnce(RegexNFA *nfa, UErrorCode &status);
+
+    const RegexPattern    *fPattern;       // For a single pattern, the pattern to build from.
+    UInitOnce              fBuildOnce = U_INITONCE_INITIALIZER;
+    UBool                  fBuilt;         // The graphs and classes are built.
+
+    RegexNFA(const RegexNFA &other); // forbid copying of this class
+    RegexNFA &operator=(const RegexNFA &other); // forbid copying of this class
+};
+
+
+//
+//  RegexDFA     The matcher's lazily built DFAs over a RegexNFA.
+//               Scanning is linear in the length of the input; the number of
+//               cached states is bounded, the cache is flushed when it fills.
+//
+class RegexDFA : public UMemory {
+  public:
+    RegexDFA(const RegexNFA &nfa);
+    ~RegexDFA();
+
+    //  Find the start of the leftmost match at or after startIdx, not extending past limit.
+    //  Returns FALSE if there is no match.
+    //  hitEnd is set TRUE if a potential match was still in progress at the limit, and
+    //  is otherwise left unchanged.
+    UBool find(UText *text, int64_t startIdx, int64_t limit, int64_t &matchStart,
+               UBool &hitEnd, UErrorCode &status);
+
+    //  Check a match anchored at startIdx; for toEnd the match must extend to limit.
+    //  Returns FALSE only if there is no such match.
+    //  When FALSE is returned, hitEnd is set TRUE if a potential match was still in
+    //  progress at the limit, and is otherwise left unchanged.
+    UBool mayMatchAt(UText *text, int64_t startIdx, int64_t limit, UBool toEnd,
+                     UBool &hitEnd, UErrorCode &status);
+
+    //  For an NFA of several patterns, find which of them match anywhere between
+    //  startIdx and limit.  matched has an entry per pattern; the entries of the
+    //  patterns found to match are set TRUE, the others are left unchanged.
+    //  Returns the number of entries newly set TRUE.
+    int32_t findEach(UText *text, int64_t startIdx, int64_t limit, UBool *matched,
+                     UErrorCode &status);
+
+  private:
+    RegexDFACache *getCache(RegexDFACache *&cache, const RegexNFAGraph &graph,
+                            UBool ordered, UBool unanchored, UErrorCode &status);
+
+    const RegexNFA &fNFA;
+    RegexDFACache  *fFindCache;        // Forward, unanchored, leftmost match first.
+    RegexDFACache  *fReverseCache;     // Reverse, from the end of a found match.
+    RegexDFACache  *fAnchoredCache;    // Forward, anchored.
+    RegexDFACache  *fEachCache;        // Forward, unanchored, every match, for several patterns.
+
+    RegexDFA(const RegexDFA &other); // forbid copying of this class
+    RegexDFA &operator=(const RegexDFA &other); // forbid copying of this class
+};
+
+U_NAMESPACE_END
+
+#endif  // !UCONFIG_NO_REGULAR_EXPRESSIONS
+#endif  // REGEXDFA_H
@@ -296,6 +296,17 @@ struct REStackFrame {
 // number of UVector elements in the header
 #define RESTACKFRAME_HDRCOUNT 2
 
+//
+//  Saved states for patterns with large frames.
+//    Rather than a copy of the whole frame, the stack then holds only the frame
+//    header and the size of an undo log, which records the old values of the
+//    frame's extra state as the match engine changes them.  Backtracking replays
+//    the log back to the saved size.
+//
+#define RESTACKSTATE_SIZE 3            // UVector elements in a saved state.
+#define RESTACK_MAX_COPIED_FRAME 16    // Largest frame, in UVector elements, that is
+                                       //   saved by copying it.
+
 //
 //  Start-Of-Match type.  Used by find() to quickly scan to positions where a
 //                        match might start before firing up the full match engine.
@@ -381,34 +392,6 @@ class CaseFoldingUTextIterator: public UMemory {
 };
 
 
-// Case folded UChar * string iterator.
-//  Wraps a UChar  *, provides a case-folded enumeration over its contents.
-//  Used in implementing case insensitive matching constructs.
-//  Implementation in rematch.cpp
-
-class CaseFoldingUCharIterator: public UMemory {
-      public:
-        CaseFoldingUCharIterator(const UChar *chars, int64_t start, int64_t limit);
-        ~CaseFoldingUCharIterator();
-
-        UChar32 next();           // Next case folded character
-
-        UBool   inExpansion();    // True if last char returned from next() and the
-                                  //  next to be returned both originated from a string
-                                  //  folding of the same code point from the orignal UText.
-
-        int64_t  getIndex();      // Return the current input buffer index.
-
-      private:
-        const  UChar      *fChars;
-        int64_t            fIndex;
-        int64_t            fLimit;
-        const  UChar      *fFoldChars;
-        int32_t            fFoldLength;
-        int32_t            fFoldIndex;
-
-};
-
 U_NAMESPACE_END
 #endif
 
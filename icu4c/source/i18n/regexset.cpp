@@ -0,0 +1,325 @@
+// © 2019 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+//
+//  file:  regexset.cpp
+//
+//  ICU Regular Expressions,
+//      RegexSet, which reports which of a set of patterns match an input text.
+//
+//      The patterns that have NFAs of their own are combined into RegexNFAs of
+//      several patterns, as many at a time as the limits on the size of an NFA allow.
+//      A lazily built DFA over each combined NFA then scans the input once for all of
+//      its patterns.  The other patterns each get a RegexMatcher.
+//
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_REGULAR_EXPRESSIONS
+
+#include "unicode/regex.h"
+#include "unicode/utext.h"
+#include "cmemory.h"
+#include "uassert.h"
+#include "uvector.h"
+#include "uvectr32.h"
+#include "regexdfa.h"
+
+U_NAMESPACE_BEGIN
+
+//------------------------------------------------------------------------------
+//
+//   RegexSetGroup     A set of patterns combined into one NFA.
+//
+//------------------------------------------------------------------------------
+class RegexSetGroup : public UMemory {
+  public:
+    RegexSetGroup(RegexNFA *nfa, const int32_t *indexes, int32_t count, UErrorCode &status);
+    ~RegexSetGroup();
+
+    RegexNFA             *fNFA;
+    RegexDFA             *fDFA;
+    UVector32             fPatterns;       // Index in the RegexSet of each pattern of the NFA.
+    LocalMemory<UBool>    fMatched;        // Scratch space, an entry per pattern of the NFA.
+};
+
+RegexSetGroup::RegexSetGroup(RegexNFA *nfa, const int32_t *indexes, int32_t count, UErrorCode &status) :
+        fNFA(nfa), fDFA(NULL), fPatterns(status) {
+    if (U_FAILURE(status)) {
+        return;
+    }
+    for (int32_t i = 0; i < count; ++i) {
+        fPatterns.addElement(indexes[i], status);
+    }
+    fDFA = new RegexDFA(*fNFA);
+    if (fDFA == NULL || fMatched.allocateInsteadAndReset(count) == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+    }
+}
+
+RegexSetGroup::~RegexSetGroup() {
+    delete fDFA;
+    delete fNFA;
+}
+
+static void U_CALLCONV deleteRegexSetGroup(void *obj) {
+    delete static_cast<RegexSetGroup *>(obj);
+}
+
+
+//------------------------------------------------------------------------------
+//
+//   Constructor and Destructor
+//
+//------------------------------------------------------------------------------
+RegexSet::RegexSet(uint32_t flags, UErrorCode &status) :
+        fDeferredStatus(U_ZERO_ERROR), fFlags(flags), fPatterns(NULL), fBuilt(FALSE),
+        fGroups(NULL), fMatchers(NULL), fMatcherPatterns(NULL), fMatched(NULL) {
+    if (U_FAILURE(status)) {
+        fDeferredStatus = status;
+        return;
+    }
+    fPatterns        = new UVector(uprv_deleteUObject, NULL, status);
+    fGroups          = new UVector(deleteRegexSetGroup, NULL, status);
+    fMatchers        = new UVector(uprv_deleteUObject, NULL, status);
+    fMatcherPatterns = new UVector32(status);
+    if (U_SUCCESS(status) &&
+            (fPatterns == NULL || fGroups == NULL || fMatchers == NULL || fMatcherPatterns == NULL)) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+    }
+    fDeferredStatus = status;
+}
+
+RegexSet::~RegexSet() {
+    delete fMatchers;
+    delete fMatcherPatterns;
+    delete fGroups;
+    delete fPatterns;
+    uprv_free(fMatched);
+}
+
+
+//------------------------------------------------------------------------------
+//
+//   add
+//
+//------------------------------------------------------------------------------
+int32_t RegexSet::add(const UnicodeString &regex, UParseError &pe, UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return -1;
+    }
+    if (U_FAILURE(fDeferredStatus)) {
+        status = fDeferredStatus;
+        return -1;
+    }
+    RegexPattern *pattern = RegexPattern::compile(regex, fFlags, pe, status);
+    if (U_FAILURE(status)) {
+        return -1;
+    }
+    fPatterns->addElement(pattern, status);
+    if (U_FAILURE(status)) {
+        delete pattern;
+        return -1;
+    }
+    fBuilt = FALSE;
+    return fPatterns->size() - 1;
+}
+
+
+int32_t RegexSet::size() const {
+    return fPatterns != NULL ? fPatterns->size() : 0;
+}
+
+
+const RegexPattern &RegexSet::getPattern(int32_t index) const {
+    U_ASSERT(index >= 0 && index < size());
+    return *static_cast<const RegexPattern *>(fPatterns->elementAt(index));
+}
+
+
+//------------------------------------------------------------------------------
+//
+//   build     Combine the patterns that have NFAs into groups, and make
+//             RegexMatchers for the others.
+//
+//------------------------------------------------------------------------------
+void RegexSet::build(UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return;
+    }
+    fGroups->removeAllElements();
+    fMatchers->removeAllElements();
+    fMatcherPatterns->removeAllElements();
+    uprv_free(fMatched);
+    int32_t numPatterns = fPatterns->size();
+    fMatched = (UBool *)uprv_malloc((numPatterns + 1) * sizeof(UBool));
+    LocalMemory<const RegexPattern *> nfaPatterns;
+    LocalMemory<int32_t> nfaIndexes;
+    if (fMatched == NULL ||
+            nfaPatterns.allocateInsteadAndReset(numPatterns + 1) == NULL ||
+            nfaIndexes.allocateInsteadAndReset(numPatterns + 1) == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    int32_t numNFAPatterns = 0;
+    for (int32_t i = 0; i < numPatterns && U_SUCCESS(status); ++i) {
+        const RegexPattern *pattern = static_cast<const RegexPattern *>(fPatterns->elementAt(i));
+        if (pattern->fNFA != NULL) {
+            nfaPatterns[numNFAPatterns]  = pattern;
+            nfaIndexes[numNFAPatterns++] = i;
+        } else {
+            RegexMatcher *matcher = pattern->matcher(status);
+            if (U_FAILURE(status)) {
+                delete matcher;
+                return;
+            }
+            fMatchers->addElement(matcher, status);
+            if (U_FAILURE(status)) {
+                delete matcher;
+                return;
+            }
+            fMatcherPatterns->addElement(i, status);
+        }
+    }
+    if (numNFAPatterns > 0) {
+        addGroups(nfaPatterns.getAlias(), nfaIndexes.getAlias(), numNFAPatterns, status);
+    }
+    fBuilt = U_SUCCESS(status);
+}
+
+
+//------------------------------------------------------------------------------
+//
+//   addGroups     Combine patterns into one NFA, or if that is too large,
+//                 split them in halves and try again.
+//
+//------------------------------------------------------------------------------
+void RegexSet::addGroups(const RegexPattern **patterns, const int32_t *indexes, int32_t count,
+                         UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return;
+    }
+    RegexNFA *nfa = count == 1 ? RegexNFA::createInstance(*patterns[0], status) :
+                                 RegexNFA::createInstance(patterns, count, status);
+    if (U_FAILURE(status)) {
+        return;
+    }
+    if (count == 1 && nfa != NULL && !nfa->ensureBuilt(status)) {
+        // The pattern's own NFA is too large; leave it to a RegexMatcher.
+        delete nfa;
+        if (U_FAILURE(status)) {
+            return;
+        }
+        RegexMatcher *matcher = patterns[0]->matcher(status);
+        if (U_SUCCESS(status)) {
+            fMatchers->addElement(matcher, status);
+        }
+        if (U_FAILURE(status)) {
+            delete matcher;
+            return;
+        }
+        fMatcherPatterns->addElement(indexes[0], status);
+        return;
+    }
+    if (nfa == NULL) {
+        // A single pattern always has an NFA of its own.
+        U_ASSERT(count > 1);
+        int32_t half = count / 2;
+        addGroups(patterns, indexes, half, status);
+        addGroups(patterns + half, indexes + half, count - half, status);
+        return;
+    }
+    RegexSetGroup *group = new RegexSetGroup(nfa, indexes, count, status);
+    if (group == NULL) {
+        delete nfa;
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    fGroups->addElement(group, status);
+    if (U_FAILURE(status)) {
+        delete group;
+    }
+}
+
+
+//------------------------------------------------------------------------------
+//
+//   find
+//
+//------------------------------------------------------------------------------
+int32_t RegexSet::find(const UnicodeString &input, int32_t *dest, int32_t destCapacity, UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return 0;
+    }
+    UText inputText = UTEXT_INITIALIZER;
+    utext_openConstUnicodeString(&inputText, &input, &status);
+    int32_t numMatched = find(&inputText, dest, destCapacity, status);
+    utext_close(&inputText);
+    return numMatched;
+}
+
+
+int32_t RegexSet::find(UText *input, int32_t *dest, int32_t destCapacity, UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return 0;
+    }
+    if (U_FAILURE(fDeferredStatus)) {
+        status = fDeferredStatus;
+        return 0;
+    }
+    if (destCapacity < 0 || (dest == NULL && destCapacity > 0)) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    if (!fBuilt) {
+        build(status);
+        if (U_FAILURE(status)) {
+            return 0;
+        }
+    }
+    int32_t numPatterns = fPatterns->size();
+    uprv_memset(fMatched, 0, numPatterns * sizeof(UBool));
+
+    int64_t inputLength = utext_nativeLength(input);
+    int32_t i;
+    for (i = 0; i < fGroups->size() && U_SUCCESS(status); ++i) {
+        RegexSetGroup *group = static_cast<RegexSetGroup *>(fGroups->elementAt(i));
+        int32_t groupSize = group->fPatterns.size();
+        uprv_memset(group->fMatched.getAlias(), 0, groupSize * sizeof(UBool));
+        group->fDFA->findEach(input, 0, inputLength, group->fMatched.getAlias(), status);
+        for (int32_t j = 0; j < groupSize; ++j) {
+            if (group->fMatched[j]) {
+                fMatched[group->fPatterns.elementAti(j)] = TRUE;
+            }
+        }
+    }
+    for (i = 0; i < fMatchers->size() && U_SUCCESS(status); ++i) {
+        RegexMatcher *matcher = static_cast<RegexMatcher *>(fMatchers->elementAt(i));
+        matcher->reset(input);
+        if (matcher->find(status)) {
+            fMatched[fMatcherPatterns->elementAti(i)] = TRUE;
+        }
+    }
+    if (U_FAILURE(status)) {
+        return 0;
+    }
+
+    int32_t numMatched = 0;
+    for (i = 0; i < numPatterns; ++i) {
+        if (fMatched[i]) {
+            if (numMatched < destCapacity) {
+                dest[numMatched] = i;
+            }
+            ++numMatched;
+        }
+    }
+    if (numMatched > destCapacity) {
+        status = U_BUFFER_OVERFLOW_ERROR;
+    }
+    return numMatched;
+}
+
+UOBJECT_DEFINE_RTTI_IMPLEMENTATION(RegexSet)
+
+U_NAMESPACE_END
+
+#endif  // !UCONFIG_NO_REGULAR_EXPRESSIONS
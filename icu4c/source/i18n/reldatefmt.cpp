@@ -48,6 +48,7 @@
 #include "number_modifiers.h"
 #include "formattedval_impl.h"
 #include "number_utils.h"
+#include "number_decimalquantity.h"
 
 // Copied from uscript_props.cpp
 
@@ -56,6 +57,9 @@ U_NAMESPACE_BEGIN
 // RelativeDateTimeFormatter specific data for a single locale
 class RelativeDateTimeCacheData: public SharedObject {
 public:
+    // Number of small integers whose plural form is precomputed.
+    static constexpr int32_t kIntegerPluralFormCount = 100;
+
     RelativeDateTimeCacheData() : combinedDateAndTime(nullptr) {
         // Initialize the cache arrays
         for (int32_t style = 0; style < UDAT_STYLE_COUNT; ++style) {
@@ -98,6 +102,10 @@ class RelativeDateTimeCacheData: public SharedObject {
     // Mappping from source to target styles for alias fallback.
     int32_t fallBackCache[UDAT_STYLE_COUNT];
 
+    // Cardinal plural form of each integer 0..kIntegerPluralFormCount-1
+    // without fraction digits, as in "5 minutes ago".
+    StandardPlural::Form integerPluralForms[kIntegerPluralFormCount];
+
     void adoptCombinedDateAndTime(SimpleFormatter *fmtToAdopt) {
         delete combinedDateAndTime;
         combinedDateAndTime = fmtToAdopt;
@@ -722,6 +730,16 @@ const RelativeDateTimeCacheData *LocaleCacheKey<RelativeDateTimeCacheData>::crea
     if (U_FAILURE(status)) {
         return nullptr;
     }
+    // Same plural rules as RelativeDateTimeFormatter::init() uses for this locale.
+    const SharedPluralRules *pr = PluralRules::createSharedInstance(
+            fLoc, UPLURAL_TYPE_CARDINAL, status);
+    if (U_FAILURE(status)) {
+        return nullptr;
+    }
+    for (int32_t i = 0; i < RelativeDateTimeCacheData::kIntegerPluralFormCount; ++i) {
+        result->integerPluralForms[i] = StandardPlural::orOtherFromString((*pr)->select(i));
+    }
+    pr->removeRef();
     result->addRef();
     return result.orphan();
 }
@@ -746,6 +764,42 @@ FormattedRelativeDateTimeData::~FormattedRelativeDateTimeData() = default;
 UPRV_FORMATTED_VALUE_SUBCLASS_AUTO_IMPL(FormattedRelativeDateTime)
 
 
+/**
+ * Like QuantityFormatter::formatAndSelect(), but when the formatted number is
+ * a small integer without fraction digits, takes its plural form from the
+ * cache data instead of evaluating the plural rules.
+ */
+static void formatAndSelect(
+        double quantity,
+        const NumberFormat& fmt,
+        const PluralRules& rules,
+        const RelativeDateTimeCacheData& cache,
+        FormattedStringBuilder& output,
+        StandardPlural::Form& pluralForm,
+        UErrorCode& status) {
+    const DecimalFormat* df = dynamic_cast<const DecimalFormat*>(&fmt);
+    if (df == nullptr) {
+        QuantityFormatter::formatAndSelect(quantity, fmt, rules, output, pluralForm, status);
+        return;
+    }
+    number::impl::UFormattedNumberData fn;
+    fn.quantity.setToDouble(quantity);
+    df->toNumberFormatter().formatImpl(&fn, status);
+    if (U_FAILURE(status)) {
+        return;
+    }
+    output = std::move(fn.getStringRef());
+    if (fn.quantity.fitsInLong() && fn.quantity.getPluralOperand(PLURAL_OPERAND_V) == 0) {
+        int64_t n = fn.quantity.toLong();
+        if (0 <= n && n < RelativeDateTimeCacheData::kIntegerPluralFormCount) {
+            pluralForm = cache.integerPluralForms[n];
+            return;
+        }
+    }
+    pluralForm = StandardPlural::orOtherFromString(rules.select(fn.quantity));
+}
+
+
 RelativeDateTimeFormatter::RelativeDateTimeFormatter(UErrorCode& status) :
         fCache(nullptr),
         fNumberFormat(nullptr),
@@ -951,10 +1005,11 @@ void RelativeDateTimeFormatter::formatImpl(
     int32_t bFuture = direction == UDAT_DIRECTION_NEXT ? 1 : 0;
 
     StandardPlural::Form pluralForm;
-    QuantityFormatter::formatAndSelect(
+    formatAndSelect(
         quantity,
         **fNumberFormat,
         **fPluralRules,
+        *fCache,
         output.getStringRef(),
         pluralForm,
         status);
@@ -1019,10 +1074,11 @@ void RelativeDateTimeFormatter::formatNumericImpl(
     int32_t bFuture = direction == UDAT_DIRECTION_NEXT ? 1 : 0;
 
     StandardPlural::Form pluralForm;
-    QuantityFormatter::formatAndSelect(
+    formatAndSelect(
         offset,
         **fNumberFormat,
         **fPluralRules,
+        *fCache,
         output.getStringRef(),
         pluralForm,
         status);
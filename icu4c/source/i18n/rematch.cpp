@@ -26,13 +26,16 @@
 #include "uassert.h"
 #include "cmemory.h"
 #include "cstr.h"
+#include "putilimp.h"
 #include "uvector.h"
 #include "uvectr32.h"
 #include "uvectr64.h"
+#include "regexdfa.h"
 #include "regeximp.h"
 #include "regexst.h"
 #include "regextxt.h"
 #include "ucase.h"
+#include "utext_imp.h"
 
 // #include <malloc.h>        // Needed for heapcheck testing
 
@@ -62,6 +65,159 @@ static inline UBool isLineTerminator(UChar32 c) {
     return (c<=0x0d && c>=0x0a) || c==0x85 || c==0x2028 || c==0x2029;
 }
 
+//-----------------------------------------------------------------------------
+//
+//   Input readers for the match engine, MatchUsing(), and for findUsing().
+//
+//   Each reader has a current native index into the input text, and moves
+//   it over code points the way UText iteration does:  setIndex() pins the
+//   index to the text and moves it back to the start of a code point, and
+//   next32(), previous32() and current32() return U_SENTINEL at the ends
+//   of the text.  The match engine itself only checks the region limits.
+//
+//     UTextInput   any UText.
+//     UTF16Input   a UText whose entire text is in its chunk buffer.
+//     UTF8Input    a UText over a contiguous UTF-8 string; see getUTF8Input().
+//                  Ill-formed sequences read as U+FFFD, as with the UTF-8 UText.
+//
+//   skipTo(c, limit) may move the index forward to the next position before limit
+//   where c can start, or returns FALSE if there is none.  It is a hint for find(),
+//   and a reader that can not search quickly leaves the index where it is.
+//
+//-----------------------------------------------------------------------------
+namespace {
+
+class UTextInput {
+public:
+    UTextInput(UText *text) : fText(text) {}
+
+    inline void    setIndex(int64_t ix)  { UTEXT_SETNATIVEINDEX(fText, ix); }
+    inline int64_t getIndex() const      { return UTEXT_GETNATIVEINDEX(fText); }
+    inline UChar32 next32()              { return UTEXT_NEXT32(fText); }
+    inline UChar32 previous32()          { return UTEXT_PREVIOUS32(fText); }
+    inline UChar32 current32()           { return UTEXT_CURRENT32(fText); }
+    inline UBool   usesU16() const       { return UTEXT_USES_U16(fText); }
+    inline UBool   skipTo(UChar32, int64_t) { return TRUE; }
+
+private:
+    UText   *fText;
+};
+
+class UTF16Input {
+public:
+    UTF16Input(const UChar *s, int32_t length) : fS(s), fLength(length), fIndex(0) {}
+
+    inline void setIndex(int64_t ix) {
+        if (ix <= 0) {
+            fIndex = 0;
+        } else if (ix >= fLength) {
+            fIndex = fLength;
+        } else {
+            fIndex = (int32_t)ix;
+            U16_SET_CP_START(fS, 0, fIndex);
+        }
+    }
+    inline int64_t getIndex() const { return fIndex; }
+    inline UChar32 next32() {
+        if (fIndex >= fLength) {
+            return U_SENTINEL;
+        }
+        UChar32 c;
+        U16_NEXT(fS, fIndex, fLength, c);
+        return c;
+    }
+    inline UChar32 previous32() {
+        if (fIndex <= 0) {
+            return U_SENTINEL;
+        }
+        UChar32 c;
+        U16_PREV(fS, 0, fIndex, c);
+        return c;
+    }
+    inline UChar32 current32() const {
+        if (fIndex >= fLength) {
+            return U_SENTINEL;
+        }
+        UChar32 c;
+        U16_GET(fS, 0, fIndex, fLength, c);
+        return c;
+    }
+    inline UBool usesU16() const { return TRUE; }
+    inline UBool skipTo(UChar32, int64_t) { return TRUE; }
+
+private:
+    const UChar *fS;
+    int32_t      fLength;
+    int32_t      fIndex;
+};
+
+class UTF8Input {
+public:
+    UTF8Input(const uint8_t *s, int32_t length) : fS(s), fLength(length), fIndex(0) {}
+
+    inline void setIndex(int64_t ix) {
+        if (ix <= 0) {
+            fIndex = 0;
+        } else if (ix >= fLength) {
+            fIndex = fLength;
+        } else {
+            fIndex = (int32_t)ix;
+            U8_SET_CP_START(fS, 0, fIndex);
+        }
+    }
+    inline int64_t getIndex() const { return fIndex; }
+    inline UChar32 next32() {
+        if (fIndex >= fLength) {
+            return U_SENTINEL;
+        }
+        UChar32 c;
+        U8_NEXT_OR_FFFD(fS, fIndex, fLength, c);
+        return c;
+    }
+    inline UChar32 previous32() {
+        if (fIndex <= 0) {
+            return U_SENTINEL;
+        }
+        UChar32 c;
+        U8_PREV_OR_FFFD(fS, 0, fIndex, c);
+        return c;
+    }
+    inline UChar32 current32() const {
+        if (fIndex >= fLength) {
+            return U_SENTINEL;
+        }
+        int32_t ix = fIndex;
+        UChar32 c;
+        U8_NEXT_OR_FFFD(fS, ix, fLength, c);
+        return c;
+    }
+    inline UBool usesU16() const { return FALSE; }
+
+    // Search for the first byte of c.  U+FFFD is also what ill-formed bytes
+    //   read as, so it has no fixed first byte.
+    inline UBool skipTo(UChar32 c, int64_t limit) {
+        if (c == 0xfffd || fIndex >= limit) {
+            return TRUE;
+        }
+        uint8_t firstByte = (uint8_t)(c < 0x80 ? c :
+                                      c < 0x800 ? 0xc0 | (c >> 6) :
+                                      c < 0x10000 ? 0xe0 | (c >> 12) : 0xf0 | (c >> 18));
+        const void *hit = uprv_memchr(fS + fIndex, firstByte, (size_t)(limit - fIndex));
+        if (hit == NULL) {
+            return FALSE;
+        }
+        fIndex = (int32_t)((const uint8_t *)hit - fS);
+        return TRUE;
+    }
+
+private:
+    const uint8_t *fS;
+    int32_t        fLength;
+    int32_t        fIndex;
+};
+
+}  // namespace
+
 //-----------------------------------------------------------------------------
 //
 //   Constructor and Destructor
@@ -82,6 +238,20 @@ RegexMatcher::RegexMatcher(const RegexPattern *pat)  {
 }
 
 
+RegexMatcher::RegexMatcher(const RegexPattern &pattern, UErrorCode &status) {
+    init(status);
+    if (U_FAILURE(status)) {
+        return;
+    }
+    if (U_FAILURE(pattern.fDeferredStatus)) {
+        status = fDeferredStatus = pattern.fDeferredStatus;
+        return;
+    }
+    fPattern = &pattern;
+    init2(RegexStaticSets::gStaticSets->fEmptyText, status);
+}
+
+
 
 RegexMatcher::RegexMatcher(const UnicodeString &regexp, const UnicodeString &input,
                            uint32_t flags, UErrorCode &status) {
@@ -155,6 +325,8 @@ RegexMatcher::RegexMatcher(UText *regexp,
 
 RegexMatcher::~RegexMatcher() {
     delete fStack;
+    delete fUndoLog;
+    uprv_free(fCurrentFrame);
     if (fData != fSmallData) {
         uprv_free(fData);
         fData = NULL;
@@ -178,6 +350,7 @@ RegexMatcher::~RegexMatcher() {
     #if UCONFIG_NO_BREAK_ITERATION==0
     delete fWordBreakItr;
     #endif
+    delete fDFA;
 }
 
 //
@@ -222,8 +395,23 @@ void RegexMatcher::init(UErrorCode &status) {
     fDeferredStatus    = status;
     fData              = fSmallData;
     fWordBreakItr      = NULL;
+    fDFA               = NULL;
+    fDFAFallback       = FALSE;
+    fDFASwitch         = FALSE;
+    fDFAStartPos       = 0;
+    fDFATimeStart      = 0;
+    fRequiredStringPos = -1;
+    fBacktrackLimit    = 0;
+    fDeadline          = 0;
+    fOpCount           = 0;
+    fSaveCount         = 0;
+    fCutCount          = 0;
+    fStackHighWater    = 0;
 
     fStack             = NULL;
+    fUseUndoLog        = FALSE;
+    fUndoLog           = NULL;
+    fCurrentFrame      = NULL;
     fInputText         = NULL;
     fAltInputText      = NULL;
     fInput             = NULL;
@@ -254,6 +442,15 @@ void RegexMatcher::init2(UText *input, UErrorCode &status) {
         status = fDeferredStatus = U_MEMORY_ALLOCATION_ERROR;
         return;
     }
+    if (fPattern->fFrameSize > RESTACK_MAX_COPIED_FRAME) {
+        fUseUndoLog    = TRUE;
+        fUndoLog       = new UVector64(status);
+        fCurrentFrame  = (int64_t *)uprv_malloc(fPattern->fFrameSize * sizeof(int64_t));
+        if (fUndoLog == NULL || fCurrentFrame == NULL) {
+            status = fDeferredStatus = U_MEMORY_ALLOCATION_ERROR;
+            return;
+        }
+    }
 
     reset(input);
     setStackLimit(DEFAULT_BACKTRACK_STACK_CAPACITY, status);
@@ -635,10 +832,40 @@ UBool RegexMatcher::find(UErrorCode &status) {
         return FALSE;
     }
 
+    resetCounters();
+    UErrorCode entryStatus = status;
+    UBool found;
+    const uint8_t *utf8;
     if (UTEXT_FULL_TEXT_IN_CHUNK(fInputText, fInputLength)) {
-        return findUsingChunk(status);
-    }
+        UTF16Input input(fInputText->chunkContents, (int32_t)fInputLength);
+        found = findUsing(input, status);
+    } else if ((utf8 = getUTF8Input(fMatchEnd)) != NULL) {
+        UTF8Input input(utf8, (int32_t)fInputLength);
+        found = findUsing(input, status);
+    } else {
+        UTextInput input(fInputText);
+        found = findUsing(input, status);
+    }
+    fDFAFallback = FALSE;
+    if (fDFASwitch) {
+        // The match engine was stopped for excessive backtracking.
+        // Redo the search from its beginning with the DFA.
+        fDFASwitch = FALSE;
+        status = entryStatus;
+        found = findUsingDFA(fDFAStartPos, status);
+    }
+    return found;
+}
 
+
+//--------------------------------------------------------------------------------
+//
+//   findUsing() -- find(), reading the input text through one of the input
+//                  readers above.
+//
+//--------------------------------------------------------------------------------
+template<typename Input>
+UBool RegexMatcher::findUsing(Input &input, UErrorCode &status) {
     int64_t startPos = fMatchEnd;
     if (startPos==0) {
         startPos = fActiveStart;
@@ -656,9 +883,9 @@ UBool RegexMatcher::find(UErrorCode &status) {
                 fHitEnd = TRUE;
                 return FALSE;
             }
-            UTEXT_SETNATIVEINDEX(fInputText, startPos);
-            (void)UTEXT_NEXT32(fInputText);
-            startPos = UTEXT_GETNATIVEINDEX(fInputText);
+            input.setIndex(startPos);
+            (void)input.next32();
+            startPos = input.getIndex();
         }
     } else {
         if (fLastMatchEnd >= 0) {
@@ -671,12 +898,20 @@ UBool RegexMatcher::find(UErrorCode &status) {
     }
 
 
+    if (canSkipToRequiredString()) {
+        if (!skipToRequiredString(startPos)) {
+            fMatch = FALSE;
+            fHitEnd = TRUE;
+            return FALSE;
+        }
+    }
+
     // Compute the position in the input string beyond which a match can not begin, because
     //   the minimum length match would extend past the end of the input.
     //   Note:  some patterns that cannot match anything will have fMinMatchLength==Max Int.
     //          Be aware of possible overflows if making changes here.
     int64_t testStartLimit;
-    if (UTEXT_USES_U16(fInputText)) {
+    if (input.usesU16()) {
         testStartLimit = fActiveLimit - fPattern->fMinMatchLen;
         if (startPos > testStartLimit) {
             fMatch = FALSE;
@@ -689,6 +924,13 @@ UBool RegexMatcher::find(UErrorCode &status) {
         testStartLimit = fActiveLimit - (fPattern->fMinMatchLen > 0 ? 1 : 0);
     }
 
+    if (fPattern->fNFA != NULL && fFindProgressCallbackFn == NULL) {
+        // Let IncrementTime() hand the search over to the DFA if it backtracks heavily.
+        fDFAFallback  = TRUE;
+        fDFAStartPos  = startPos;
+        fDFATimeStart = fTime;
+    }
+
     UChar32  c;
     U_ASSERT(startPos >= 0);
 
@@ -697,7 +939,7 @@ UBool RegexMatcher::find(UErrorCode &status) {
         // No optimization was found.
         //  Try a match at each input position.
         for (;;) {
-            MatchAt(startPos, FALSE, status);
+            MatchUsing(input, startPos, FALSE, status);
             if (U_FAILURE(status)) {
                 return FALSE;
             }
@@ -708,9 +950,9 @@ UBool RegexMatcher::find(UErrorCode &status) {
                 fHitEnd = TRUE;
                 return FALSE;
             }
-            UTEXT_SETNATIVEINDEX(fInputText, startPos);
-            (void)UTEXT_NEXT32(fInputText);
-            startPos = UTEXT_GETNATIVEINDEX(fInputText);
+            input.setIndex(startPos);
+            (void)input.next32();
+            startPos = input.getIndex();
             // Note that it's perfectly OK for a pattern to have a zero-length
             //   match at the end of a string, so we must make sure that the loop
             //   runs with startPos == testStartLimit the last time through.
@@ -726,7 +968,7 @@ UBool RegexMatcher::find(UErrorCode &status) {
             fMatch = FALSE;
             return FALSE;
         }
-        MatchAt(startPos, FALSE, status);
+        MatchUsing(input, startPos, FALSE, status);
         if (U_FAILURE(status)) {
             return FALSE;
         }
@@ -737,24 +979,24 @@ UBool RegexMatcher::find(UErrorCode &status) {
         {
             // Match may start on any char from a pre-computed set.
             U_ASSERT(fPattern->fMinMatchLen > 0);
-            UTEXT_SETNATIVEINDEX(fInputText, startPos);
+            input.setIndex(startPos);
             for (;;) {
                 int64_t pos = startPos;
-                c = UTEXT_NEXT32(fInputText);
-                startPos = UTEXT_GETNATIVEINDEX(fInputText);
+                c = input.next32();
+                startPos = input.getIndex();
                 // c will be -1 (U_SENTINEL) at end of text, in which case we
                 // skip this next block (so we don't have a negative array index)
                 // and handle end of text in the following block.
                 if (c >= 0 && ((c<256 && fPattern->fInitialChars8->contains(c)) ||
                               (c>=256 && fPattern->fInitialChars->contains(c)))) {
-                    MatchAt(pos, FALSE, status);
+                    MatchUsing(input, pos, FALSE, status);
                     if (U_FAILURE(status)) {
                         return FALSE;
                     }
                     if (fMatch) {
                         return TRUE;
                     }
-                    UTEXT_SETNATIVEINDEX(fInputText, pos);
+                    input.setIndex(pos);
                 }
                 if (startPos > testStartLimit) {
                     fMatch = FALSE;
@@ -771,22 +1013,33 @@ UBool RegexMatcher::find(UErrorCode &status) {
     case START_CHAR:
         {
             // Match starts on exactly one char.
+            //   Without a progress callback to call at every position, the input
+            //   may skip ahead to where the char can start.
             U_ASSERT(fPattern->fMinMatchLen > 0);
             UChar32 theChar = fPattern->fInitialChar;
-            UTEXT_SETNATIVEINDEX(fInputText, startPos);
+            UBool   skip    = fFindProgressCallbackFn == NULL;
+            input.setIndex(startPos);
             for (;;) {
+                if (skip && startPos <= testStartLimit) {
+                    if (!input.skipTo(theChar, testStartLimit + 1)) {
+                        fMatch = FALSE;
+                        fHitEnd = TRUE;
+                        return FALSE;
+                    }
+                    startPos = input.getIndex();
+                }
                 int64_t pos = startPos;
-                c = UTEXT_NEXT32(fInputText);
-                startPos = UTEXT_GETNATIVEINDEX(fInputText);
+                c = input.next32();
+                startPos = input.getIndex();
                 if (c == theChar) {
-                    MatchAt(pos, FALSE, status);
+                    MatchUsing(input, pos, FALSE, status);
                     if (U_FAILURE(status)) {
                         return FALSE;
                     }
                     if (fMatch) {
                         return TRUE;
                     }
-                    UTEXT_SETNATIVEINDEX(fInputText, startPos);
+                    input.setIndex(startPos);
                 }
                 if (startPos > testStartLimit) {
                     fMatch = FALSE;
@@ -803,41 +1056,41 @@ UBool RegexMatcher::find(UErrorCode &status) {
         {
             UChar32 ch;
             if (startPos == fAnchorStart) {
-                MatchAt(startPos, FALSE, status);
+                MatchUsing(input, startPos, FALSE, status);
                 if (U_FAILURE(status)) {
                     return FALSE;
                 }
                 if (fMatch) {
                     return TRUE;
                 }
-                UTEXT_SETNATIVEINDEX(fInputText, startPos);
-                ch = UTEXT_NEXT32(fInputText);
-                startPos = UTEXT_GETNATIVEINDEX(fInputText);
+                input.setIndex(startPos);
+                ch = input.next32();
+                startPos = input.getIndex();
             } else {
-                UTEXT_SETNATIVEINDEX(fInputText, startPos);
-                ch = UTEXT_PREVIOUS32(fInputText);
-                UTEXT_SETNATIVEINDEX(fInputText, startPos);
+                input.setIndex(startPos);
+                ch = input.previous32();
+                input.setIndex(startPos);
             }
 
             if (fPattern->fFlags & UREGEX_UNIX_LINES) {
                 for (;;) {
                     if (ch == 0x0a) {
-                            MatchAt(startPos, FALSE, status);
+                            MatchUsing(input, startPos, FALSE, status);
                             if (U_FAILURE(status)) {
                                 return FALSE;
                             }
                             if (fMatch) {
                                 return TRUE;
                             }
-                            UTEXT_SETNATIVEINDEX(fInputText, startPos);
+                            input.setIndex(startPos);
                     }
                     if (startPos >= testStartLimit) {
                         fMatch = FALSE;
                         fHitEnd = TRUE;
                         return FALSE;
                     }
-                    ch = UTEXT_NEXT32(fInputText);
-                    startPos = UTEXT_GETNATIVEINDEX(fInputText);
+                    ch = input.next32();
+                    startPos = input.getIndex();
                     // Note that it's perfectly OK for a pattern to have a zero-length
                     //   match at the end of a string, so we must make sure that the loop
                     //   runs with startPos == testStartLimit the last time through.
@@ -847,26 +1100,26 @@ UBool RegexMatcher::find(UErrorCode &status) {
             } else {
                 for (;;) {
                     if (isLineTerminator(ch)) {
-                        if (ch == 0x0d && startPos < fActiveLimit && UTEXT_CURRENT32(fInputText) == 0x0a) {
-                            (void)UTEXT_NEXT32(fInputText);
-                            startPos = UTEXT_GETNATIVEINDEX(fInputText);
+                        if (ch == 0x0d && startPos < fActiveLimit && input.current32() == 0x0a) {
+                            (void)input.next32();
+                            startPos = input.getIndex();
                         }
-                        MatchAt(startPos, FALSE, status);
+                        MatchUsing(input, startPos, FALSE, status);
                         if (U_FAILURE(status)) {
                             return FALSE;
                         }
                         if (fMatch) {
                             return TRUE;
                         }
-                        UTEXT_SETNATIVEINDEX(fInputText, startPos);
+                        input.setIndex(startPos);
                     }
                     if (startPos >= testStartLimit) {
                         fMatch = FALSE;
                         fHitEnd = TRUE;
                         return FALSE;
                     }
-                    ch = UTEXT_NEXT32(fInputText);
-                    startPos = UTEXT_GETNATIVEINDEX(fInputText);
+                    ch = input.next32();
+                    startPos = input.getIndex();
                     // Note that it's perfectly OK for a pattern to have a zero-length
                     //   match at the end of a string, so we must make sure that the loop
                     //   runs with startPos == testStartLimit the last time through.
@@ -912,231 +1165,31 @@ UBool RegexMatcher::find(int64_t start, UErrorCode &status) {
 
 //--------------------------------------------------------------------------------
 //
-//   findUsingChunk() -- like find(), but with the advance knowledge that the
-//                       entire string is available in the UText's chunk buffer.
+//   getUTF8Input() -- Return the input text if it is a contiguous UTF-8 string that
+//                     findUsing() and MatchUsing() can read with a UTF8Input, for an
+//                     operation beginning at startIdx.  Otherwise return NULL.
+//
+//                     All the positions bounding the operation must be code point
+//                     boundaries, which UText iteration would not first move back
+//                     to the start of a code point.  An index that is not on a trail
+//                     byte is always a boundary.
 //
 //--------------------------------------------------------------------------------
-UBool RegexMatcher::findUsingChunk(UErrorCode &status) {
-    // Start at the position of the last match end.  (Will be zero if the
-    //   matcher has been reset.
-    //
-
-    int32_t startPos = (int32_t)fMatchEnd;
-    if (startPos==0) {
-        startPos = (int32_t)fActiveStart;
-    }
-
-    const UChar *inputBuf = fInputText->chunkContents;
-
-    if (fMatch) {
-        // Save the position of any previous successful match.
-        fLastMatchEnd = fMatchEnd;
-
-        if (fMatchStart == fMatchEnd) {
-            // Previous match had zero length.  Move start position up one position
-            //  to avoid sending find() into a loop on zero-length matches.
-            if (startPos >= fActiveLimit) {
-                fMatch = FALSE;
-                fHitEnd = TRUE;
-                return FALSE;
-            }
-            U16_FWD_1(inputBuf, startPos, fInputLength);
-        }
-    } else {
-        if (fLastMatchEnd >= 0) {
-            // A previous find() failed to match.  Don't try again.
-            //   (without this test, a pattern with a zero-length match
-            //    could match again at the end of an input string.)
-            fHitEnd = TRUE;
-            return FALSE;
-        }
-    }
-
-
-    // Compute the position in the input string beyond which a match can not begin, because
-    //   the minimum length match would extend past the end of the input.
-    //   Note:  some patterns that cannot match anything will have fMinMatchLength==Max Int.
-    //          Be aware of possible overflows if making changes here.
-    //   Note:  a match can begin at inputBuf + testLen; it is an inclusive limit.
-    int32_t testLen  = (int32_t)(fActiveLimit - fPattern->fMinMatchLen);
-    if (startPos > testLen) {
-        fMatch = FALSE;
-        fHitEnd = TRUE;
-        return FALSE;
-    }
-
-    UChar32  c;
-    U_ASSERT(startPos >= 0);
-
-    switch (fPattern->fStartType) {
-    case START_NO_INFO:
-        // No optimization was found.
-        //  Try a match at each input position.
-        for (;;) {
-            MatchChunkAt(startPos, FALSE, status);
-            if (U_FAILURE(status)) {
-                return FALSE;
-            }
-            if (fMatch) {
-                return TRUE;
-            }
-            if (startPos >= testLen) {
-                fHitEnd = TRUE;
-                return FALSE;
-            }
-            U16_FWD_1(inputBuf, startPos, fActiveLimit);
-            // Note that it's perfectly OK for a pattern to have a zero-length
-            //   match at the end of a string, so we must make sure that the loop
-            //   runs with startPos == testLen the last time through.
-            if  (findProgressInterrupt(startPos, status))
-                return FALSE;
-        }
-        UPRV_UNREACHABLE;
-
-    case START_START:
-        // Matches are only possible at the start of the input string
-        //   (pattern begins with ^ or \A)
-        if (startPos > fActiveStart) {
-            fMatch = FALSE;
-            return FALSE;
-        }
-        MatchChunkAt(startPos, FALSE, status);
-        if (U_FAILURE(status)) {
-            return FALSE;
-        }
-        return fMatch;
-
-
-    case START_SET:
-    {
-        // Match may start on any char from a pre-computed set.
-        U_ASSERT(fPattern->fMinMatchLen > 0);
-        for (;;) {
-            int32_t pos = startPos;
-            U16_NEXT(inputBuf, startPos, fActiveLimit, c);  // like c = inputBuf[startPos++];
-            if ((c<256 && fPattern->fInitialChars8->contains(c)) ||
-                (c>=256 && fPattern->fInitialChars->contains(c))) {
-                MatchChunkAt(pos, FALSE, status);
-                if (U_FAILURE(status)) {
-                    return FALSE;
-                }
-                if (fMatch) {
-                    return TRUE;
-                }
-            }
-            if (startPos > testLen) {
-                fMatch = FALSE;
-                fHitEnd = TRUE;
-                return FALSE;
-            }
-            if  (findProgressInterrupt(startPos, status))
-                return FALSE;
-        }
-    }
-    UPRV_UNREACHABLE;
-
-    case START_STRING:
-    case START_CHAR:
-    {
-        // Match starts on exactly one char.
-        U_ASSERT(fPattern->fMinMatchLen > 0);
-        UChar32 theChar = fPattern->fInitialChar;
-        for (;;) {
-            int32_t pos = startPos;
-            U16_NEXT(inputBuf, startPos, fActiveLimit, c);  // like c = inputBuf[startPos++];
-            if (c == theChar) {
-                MatchChunkAt(pos, FALSE, status);
-                if (U_FAILURE(status)) {
-                    return FALSE;
-                }
-                if (fMatch) {
-                    return TRUE;
-                }
-            }
-            if (startPos > testLen) {
-                fMatch = FALSE;
-                fHitEnd = TRUE;
-                return FALSE;
-            }
-            if  (findProgressInterrupt(startPos, status))
-                return FALSE;
-        }
-    }
-    UPRV_UNREACHABLE;
-
-    case START_LINE:
-    {
-        UChar32 ch;
-        if (startPos == fAnchorStart) {
-            MatchChunkAt(startPos, FALSE, status);
-            if (U_FAILURE(status)) {
-                return FALSE;
-            }
-            if (fMatch) {
-                return TRUE;
-            }
-            U16_FWD_1(inputBuf, startPos, fActiveLimit);
-        }
-
-        if (fPattern->fFlags & UREGEX_UNIX_LINES) {
-            for (;;) {
-                ch = inputBuf[startPos-1];
-                if (ch == 0x0a) {
-                    MatchChunkAt(startPos, FALSE, status);
-                    if (U_FAILURE(status)) {
-                        return FALSE;
-                    }
-                    if (fMatch) {
-                        return TRUE;
-                    }
-                }
-                if (startPos >= testLen) {
-                    fMatch = FALSE;
-                    fHitEnd = TRUE;
-                    return FALSE;
-                }
-                U16_FWD_1(inputBuf, startPos, fActiveLimit);
-                // Note that it's perfectly OK for a pattern to have a zero-length
-                //   match at the end of a string, so we must make sure that the loop
-                //   runs with startPos == testLen the last time through.
-                if  (findProgressInterrupt(startPos, status))
-                    return FALSE;
-            }
-        } else {
-            for (;;) {
-                ch = inputBuf[startPos-1];
-                if (isLineTerminator(ch)) {
-                    if (ch == 0x0d && startPos < fActiveLimit && inputBuf[startPos] == 0x0a) {
-                        startPos++;
-                    }
-                    MatchChunkAt(startPos, FALSE, status);
-                    if (U_FAILURE(status)) {
-                        return FALSE;
-                    }
-                    if (fMatch) {
-                        return TRUE;
-                    }
-                }
-                if (startPos >= testLen) {
-                    fMatch = FALSE;
-                    fHitEnd = TRUE;
-                    return FALSE;
-                }
-                U16_FWD_1(inputBuf, startPos, fActiveLimit);
-                // Note that it's perfectly OK for a pattern to have a zero-length
-                //   match at the end of a string, so we must make sure that the loop
-                //   runs with startPos == testLen the last time through.
-                if  (findProgressInterrupt(startPos, status))
-                    return FALSE;
-            }
-        }
-    }
+static inline UBool isUTF8Boundary(const uint8_t *s, int32_t length, int64_t index) {
+    return index <= 0 || index >= length || !U8_IS_TRAIL(s[index]);
+}
 
-    default:
-        UPRV_UNREACHABLE;
+const uint8_t *RegexMatcher::getUTF8Input(int64_t startIdx) const {
+    int32_t length = 0;
+    const uint8_t *s = utext_getUTF8Contents(fInputText, &length);
+    if (s == NULL || length != fInputLength ||
+            !isUTF8Boundary(s, length, startIdx) ||
+            !isUTF8Boundary(s, length, fRegionStart) || !isUTF8Boundary(s, length, fRegionLimit) ||
+            !isUTF8Boundary(s, length, fLookStart) || !isUTF8Boundary(s, length, fLookLimit) ||
+            !isUTF8Boundary(s, length, fAnchorStart) || !isUTF8Boundary(s, length, fAnchorLimit)) {
+        return NULL;
     }
-
-    UPRV_UNREACHABLE;
+    return s;
 }
 
 
@@ -1446,16 +1499,328 @@ static UBool compat_SyncMutableUTextContents(UText *ut) {
 
 //--------------------------------------------------------------------------------
 //
-//  lookingAt()
+//   findString()   Find the first occurrence of string in text.
+//                  memchr(), which C libraries commonly vectorize, skips ahead to the
+//                  occurrences of the low byte of one of the string's code units.
+//                  Only matches that begin and end on code point boundaries count.
 //
 //--------------------------------------------------------------------------------
-UBool RegexMatcher::lookingAt(UErrorCode &status) {
-    if (U_FAILURE(status)) {
-        return FALSE;
+static const UChar *findString(const UChar *text, int32_t textLen,
+                               const UChar *string, int32_t stringLen) {
+    if (textLen < stringLen) {
+        return NULL;
     }
-    if (U_FAILURE(fDeferredStatus)) {
-        status = fDeferredStatus;
-        return FALSE;
+    // Probe for the unit whose low byte is likely to be least common in text:
+    //  Low bytes of zero come with every Latin-1 character; lower case letters,
+    //  spaces and digits are also common.
+    int32_t probe     = 0;
+    int32_t probeRank = INT32_MAX;
+    for (int32_t i = 0; i < stringLen; ++i) {
+        uint8_t b    = (uint8_t)string[i];
+        int32_t rank = b == 0 ? 3 : (b == 0x20 || (b >= 0x61 && b <= 0x7a)) ? 2 :
+                                    (b >= 0x30 && b <= 0x39) ? 1 : 0;
+        if (rank < probeRank) {
+            probe     = i;
+            probeRank = rank;
+        }
+    }
+    const int32_t lowByte   = U_IS_BIG_ENDIAN ? 1 : 0;
+    const char   *bytes     = (const char *)text + lowByte;
+    const char   *p         = bytes + 2 * probe;
+    const char   *limit     = bytes + 2 * (textLen - stringLen + probe) + 1;
+    const UChar  *textLimit = text + textLen;
+    while (p < limit) {
+        const char *hit = (const char *)uprv_memchr(p, (uint8_t)string[probe], limit - p);
+        if (hit == NULL) {
+            break;
+        }
+        p = hit + 1;
+        if (((hit - bytes) & 1) != 0) {
+            continue;       // High byte of a unit.
+        }
+        const UChar *candidate = text + (hit - bytes) / 2 - probe;
+        if (u_memcmp(candidate, string, stringLen) == 0 &&
+                !(candidate > text && U16_IS_TRAIL(*candidate) && U16_IS_LEAD(candidate[-1])) &&
+                !(candidate + stringLen < textLimit && U16_IS_LEAD(candidate[stringLen - 1]) &&
+                  U16_IS_TRAIL(candidate[stringLen]))) {
+            return candidate;
+        }
+    }
+    return NULL;
+}
+
+
+//--------------------------------------------------------------------------------
+//
+//   findUTF8String()   Find the first occurrence of a UTF-16 string in UTF-8 text,
+//                      comparing code points as UText iteration would.
+//                      Like findString(), memchr() skips ahead to the occurrences of
+//                      one byte of the string's UTF-8 form, here the lead byte of one
+//                      of its code points.  A lead byte always begins a code point.
+//                      The string must not begin with U+FFFD, which ill-formed text
+//                      also produces, and which has no fixed byte form.
+//
+//--------------------------------------------------------------------------------
+static const uint8_t *findUTF8String(const uint8_t *text, int32_t textLen,
+                                     const UChar *string, int32_t stringLen) {
+    // Pick the code point with the least common lead byte, ranking bytes as findString()
+    //   does.  Only code points ahead of any U+FFFD have a known offset in the match.
+    //   Unpaired surrogates never match.
+    int32_t probeOffset = 0;       // Offset of the probe code point in a match.
+    uint8_t probeByte   = 0;
+    int32_t probeRank   = INT32_MAX;
+    int32_t offset      = 0;
+    UBool   knownOffset = TRUE;
+    for (int32_t i = 0; i < stringLen;) {
+        UChar32 c;
+        U16_NEXT(string, i, stringLen, c);
+        if (U_IS_SURROGATE(c)) {
+            return NULL;
+        }
+        if (c == 0xfffd) {
+            knownOffset = FALSE;
+        }
+        if (!knownOffset) {
+            continue;
+        }
+        uint8_t b    = (uint8_t)(c < 0x80 ? c : c < 0x800 ? 0xc0 | (c >> 6) :
+                                 c < 0x10000 ? 0xe0 | (c >> 12) : 0xf0 | (c >> 18));
+        int32_t rank = (b == 0x20 || (b >= 0x61 && b <= 0x7a)) ? 2 : (b >= 0x30 && b <= 0x39) ? 1 : 0;
+        if (rank < probeRank) {
+            probeOffset = offset;
+            probeByte   = b;
+            probeRank   = rank;
+        }
+        offset += U8_LENGTH(c);
+    }
+    U_ASSERT(probeRank != INT32_MAX);
+    const uint8_t *p     = text + probeOffset;
+    const uint8_t *limit = text + textLen;
+    while (p < limit) {
+        const uint8_t *hit = (const uint8_t *)uprv_memchr(p, probeByte, limit - p);
+        if (hit == NULL) {
+            break;
+        }
+        p = hit + 1;
+        int32_t ix = (int32_t)(hit - text) - probeOffset;
+        const uint8_t *candidate = text + ix;
+        UBool matched = TRUE;
+        for (int32_t i = 0; i < stringLen;) {
+            UChar32 c;
+            UChar32 s;
+            if (ix >= textLen) {
+                matched = FALSE;
+                break;
+            }
+            U8_NEXT_OR_FFFD(text, ix, textLen, c);
+            U16_NEXT(string, i, stringLen, s);
+            if (c != s) {
+                matched = FALSE;
+                break;
+            }
+        }
+        if (matched) {
+            return candidate;
+        }
+    }
+    return NULL;
+}
+
+
+//--------------------------------------------------------------------------------
+//
+//   canSkipToRequiredString() -- TRUE if find() may skip to the pattern's required
+//                     string.  Not with a callback or a time limit:  they must
+//                     still see a find() that tries and fails at each position.
+//
+//--------------------------------------------------------------------------------
+UBool RegexMatcher::canSkipToRequiredString() const {
+    return fPattern->fRequiredStringLen > 0 && fPattern->fStartType != START_START &&
+           fFindProgressCallbackFn == NULL && fCallbackFn == NULL && fTimeLimit == 0;
+}
+
+//--------------------------------------------------------------------------------
+//
+//   skipToRequiredString() -- For patterns with a required string, one that every
+//                     match contains:  find the next occurrence of the string at or
+//                     after startPos, and advance startPos past the positions from
+//                     which a match could not reach it.  Returns FALSE if the string
+//                     does not occur, in which case there can be no match.
+//
+//                     The occurrence found is kept for the following calls to find().
+//
+//--------------------------------------------------------------------------------
+UBool RegexMatcher::skipToRequiredString(int64_t &startPos) {
+    if (fRequiredStringPos < startPos) {
+        const UChar *string    = fPattern->fLiteralText.getBuffer() + fPattern->fRequiredStringIdx;
+        int32_t      stringLen = fPattern->fRequiredStringLen;
+        fRequiredStringPos = -1;
+        const uint8_t *utf8Buf = NULL;
+        if (UTEXT_FULL_TEXT_IN_CHUNK(fInputText, fInputLength)) {
+            const UChar *inputBuf = fInputText->chunkContents;
+            const UChar *found = findString(inputBuf + startPos, (int32_t)(fActiveLimit - startPos),
+                                            string, stringLen);
+            if (found != NULL) {
+                fRequiredStringPos = found - inputBuf;
+            }
+        } else if (string[0] != 0xfffd && (utf8Buf = getUTF8Input(startPos)) != NULL) {
+            const uint8_t *found = findUTF8String(utf8Buf + startPos, (int32_t)(fActiveLimit - startPos),
+                                                  string, stringLen);
+            if (found != NULL) {
+                fRequiredStringPos = found - utf8Buf;
+            }
+        } else {
+            int32_t  firstLen = 0;
+            UChar32  first;
+            U16_NEXT(string, firstLen, stringLen, first);
+            UBool    checkLimit = fActiveLimit < fInputLength;
+            UTEXT_SETNATIVEINDEX(fInputText, startPos);
+            for (;;) {
+                if (checkLimit && UTEXT_GETNATIVEINDEX(fInputText) >= fActiveLimit) {
+                    break;
+                }
+                UChar32 c = UTEXT_NEXT32(fInputText);
+                if (c != first) {
+                    if (c == U_SENTINEL) {
+                        break;
+                    }
+                    continue;
+                }
+                int64_t next    = UTEXT_GETNATIVEINDEX(fInputText);
+                UBool   matched = TRUE;
+                for (int32_t i = firstLen; i < stringLen;) {
+                    U16_NEXT(string, i, stringLen, c);
+                    if ((checkLimit && UTEXT_GETNATIVEINDEX(fInputText) >= fActiveLimit) ||
+                            UTEXT_NEXT32(fInputText) != c) {
+                        matched = FALSE;
+                        break;
+                    }
+                }
+                UTEXT_SETNATIVEINDEX(fInputText, next);
+                if (matched) {
+                    fRequiredStringPos = utext_getPreviousNativeIndex(fInputText);
+                    break;
+                }
+            }
+        }
+        if (fRequiredStringPos < 0) {
+            return FALSE;
+        }
+    }
+
+    // The bound on the offset of the required string is in UTF-16 code units.
+    //   For other native indexes, step back over as many code points.
+    int32_t maxOffset = fPattern->fRequiredStringStart;
+    if (maxOffset == INT32_MAX || fRequiredStringPos - startPos <= maxOffset) {
+        return TRUE;
+    }
+    if (UTEXT_USES_U16(fInputText)) {
+        UTEXT_SETNATIVEINDEX(fInputText, fRequiredStringPos - maxOffset);
+    } else {
+        UTEXT_SETNATIVEINDEX(fInputText, fRequiredStringPos);
+        for (int32_t i = 0; i < maxOffset && UTEXT_GETNATIVEINDEX(fInputText) > startPos; ++i) {
+            (void)UTEXT_PREVIOUS32(fInputText);
+        }
+    }
+    if (UTEXT_GETNATIVEINDEX(fInputText) > startPos) {
+        startPos = UTEXT_GETNATIVEINDEX(fInputText);
+    }
+    return TRUE;
+}
+
+
+//--------------------------------------------------------------------------------
+//
+//   findUsingDFA() -- find() for patterns with an NFA, once the match engine has
+//                     given up on it.  The DFA locates the start of the next match,
+//                     or shows that there is none, in time linear in the length of
+//                     the input. The match itself, with its capture groups, then
+//                     comes from a single run of the match engine.
+//
+//--------------------------------------------------------------------------------
+UBool RegexMatcher::findUsingDFA(int64_t startPos, UErrorCode &status) {
+    if (fDFA == NULL) {
+        fDFA = new RegexDFA(*fPattern->fNFA);
+        if (fDFA == NULL) {
+            status = U_MEMORY_ALLOCATION_ERROR;
+            return FALSE;
+        }
+    }
+    int64_t matchStart = 0;
+    UBool   hitEnd     = FALSE;
+    UBool   found      = fDFA->find(fInputText, startPos, fActiveLimit, matchStart, hitEnd, status);
+    if (U_FAILURE(status)) {
+        return FALSE;
+    }
+    if (hitEnd) {
+        fHitEnd = TRUE;
+    }
+    if (!found) {
+        // As when the match engine has been tried at every position through the end.
+        fMatch = FALSE;
+        fHitEnd = TRUE;
+        return FALSE;
+    }
+    MatchAt(matchStart, FALSE, status);
+    U_ASSERT(fMatch || U_FAILURE(status));
+    return fMatch;
+}
+
+
+//--------------------------------------------------------------------------------
+//
+//   matchAtWithDFAFallback() -- Run the match engine for matches() or lookingAt(),
+//                               for patterns with an NFA.  If the engine backtracks
+//                               heavily it is stopped, and the DFA checks whether
+//                               there is any match.  Only if there is does the
+//                               engine run again, to completion, for the groups.
+//
+//--------------------------------------------------------------------------------
+UBool RegexMatcher::matchAtWithDFAFallback(int64_t startIdx, UBool toEnd, UErrorCode &status) {
+    UErrorCode entryStatus = status;
+    fDFAFallback  = TRUE;
+    fDFAStartPos  = startIdx;
+    fDFATimeStart = fTime;
+    MatchAt(startIdx, toEnd, status);
+    fDFAFallback = FALSE;
+    if (!fDFASwitch) {
+        return fMatch;
+    }
+    fDFASwitch = FALSE;
+    status = entryStatus;
+    if (fDFA == NULL) {
+        fDFA = new RegexDFA(*fPattern->fNFA);
+        if (fDFA == NULL) {
+            status = U_MEMORY_ALLOCATION_ERROR;
+            return FALSE;
+        }
+    }
+    UBool hitEnd = FALSE;
+    if (!fDFA->mayMatchAt(fInputText, startIdx, fActiveLimit, toEnd, hitEnd, status)) {
+        fMatch = FALSE;
+        if (hitEnd) {
+            fHitEnd = TRUE;
+        }
+        return FALSE;
+    }
+    MatchAt(startIdx, toEnd, status);
+    return fMatch;
+}
+
+
+
+//--------------------------------------------------------------------------------
+//
+//  lookingAt()
+//
+//--------------------------------------------------------------------------------
+UBool RegexMatcher::lookingAt(UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return FALSE;
+    }
+    if (U_FAILURE(fDeferredStatus)) {
+        status = fDeferredStatus;
+        return FALSE;
     }
 
     if (fInputUniStrMaybeMutable) {
@@ -1467,11 +1832,11 @@ UBool RegexMatcher::lookingAt(UErrorCode &status) {
     else {
         resetPreserveRegion();
     }
-    if (UTEXT_FULL_TEXT_IN_CHUNK(fInputText, fInputLength)) {
-        MatchChunkAt((int32_t)fActiveStart, FALSE, status);
-    } else {
-        MatchAt(fActiveStart, FALSE, status);
+    resetCounters();
+    if (fPattern->fNFA != NULL) {
+        return matchAtWithDFAFallback(fActiveStart, FALSE, status);
     }
+    MatchAt(fActiveStart, FALSE, status);
     return fMatch;
 }
 
@@ -1505,11 +1870,10 @@ UBool RegexMatcher::lookingAt(int64_t start, UErrorCode &status) {
         return FALSE;
     }
 
-    if (UTEXT_FULL_TEXT_IN_CHUNK(fInputText, fInputLength)) {
-        MatchChunkAt((int32_t)nativeStart, FALSE, status);
-    } else {
-        MatchAt(nativeStart, FALSE, status);
+    if (fPattern->fNFA != NULL) {
+        return matchAtWithDFAFallback(nativeStart, FALSE, status);
     }
+    MatchAt(nativeStart, FALSE, status);
     return fMatch;
 }
 
@@ -1538,12 +1902,12 @@ UBool RegexMatcher::matches(UErrorCode &status) {
     else {
         resetPreserveRegion();
     }
+    resetCounters();
 
-    if (UTEXT_FULL_TEXT_IN_CHUNK(fInputText, fInputLength)) {
-        MatchChunkAt((int32_t)fActiveStart, TRUE, status);
-    } else {
-        MatchAt(fActiveStart, TRUE, status);
+    if (fPattern->fNFA != NULL) {
+        return matchAtWithDFAFallback(fActiveStart, TRUE, status);
     }
+    MatchAt(fActiveStart, TRUE, status);
     return fMatch;
 }
 
@@ -1577,11 +1941,10 @@ UBool RegexMatcher::matches(int64_t start, UErrorCode &status) {
         return FALSE;
     }
 
-    if (UTEXT_FULL_TEXT_IN_CHUNK(fInputText, fInputLength)) {
-        MatchChunkAt((int32_t)nativeStart, TRUE, status);
-    } else {
-        MatchAt(nativeStart, TRUE, status);
+    if (fPattern->fNFA != NULL) {
+        return matchAtWithDFAFallback(nativeStart, TRUE, status);
     }
+    MatchAt(nativeStart, TRUE, status);
     return fMatch;
 }
 
@@ -1832,6 +2195,8 @@ void RegexMatcher::resetPreserveRegion() {
     fRequireEnd     = FALSE;
     fTime           = 0;
     fTickCounter    = TIMER_INITIAL_VALUE;
+    fRequiredStringPos = -1;
+    resetCounters();
     //resetStack(); // more expensive than it looks...
 }
 
@@ -2385,9 +2750,13 @@ void RegexMatcher::setStackLimit(int32_t limit, UErrorCode &status) {
     //    would be lost by resizing to a smaller stack size.
     reset();
 
+    // The undo log, if any, is limited separately, to the same size as the stack.
     if (limit == 0) {
         // Unlimited stack expansion
         fStack->setMaxCapacity(0);
+        if (fUndoLog != NULL) {
+            fUndoLog->setMaxCapacity(0);
+        }
     } else {
         // Change the units of the limit  from bytes to ints, and bump the size up
         //   to be big enough to hold at least one stack frame for the pattern,
@@ -2397,6 +2766,9 @@ void RegexMatcher::setStackLimit(int32_t limit, UErrorCode &status) {
             adjustedLimit = fPattern->fFrameSize;
         }
         fStack->setMaxCapacity(adjustedLimit);
+        if (fUndoLog != NULL) {
+            fUndoLog->setMaxCapacity(adjustedLimit);
+        }
     }
     fStackLimit = limit;
 }
@@ -2412,6 +2784,86 @@ int32_t RegexMatcher::getStackLimit() const {
 }
 
 
+//--------------------------------------------------------------------------------
+//
+//     setBacktrackLimit
+//
+//--------------------------------------------------------------------------------
+void RegexMatcher::setBacktrackLimit(int64_t limit, UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return;
+    }
+    if (U_FAILURE(fDeferredStatus)) {
+        status = fDeferredStatus;
+        return;
+    }
+    if (limit < 0) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    fBacktrackLimit = limit;
+}
+
+
+//--------------------------------------------------------------------------------
+//
+//     getBacktrackLimit
+//
+//--------------------------------------------------------------------------------
+int64_t RegexMatcher::getBacktrackLimit() const {
+    return fBacktrackLimit;
+}
+
+
+//--------------------------------------------------------------------------------
+//
+//     setDeadline
+//
+//--------------------------------------------------------------------------------
+void RegexMatcher::setDeadline(UDate deadline, UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return;
+    }
+    if (U_FAILURE(fDeferredStatus)) {
+        status = fDeferredStatus;
+        return;
+    }
+    if (!(deadline >= 0)) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    fDeadline = deadline;
+}
+
+
+//--------------------------------------------------------------------------------
+//
+//     getDeadline
+//
+//--------------------------------------------------------------------------------
+UDate RegexMatcher::getDeadline() const {
+    return fDeadline;
+}
+
+
+//--------------------------------------------------------------------------------
+//
+//     getOpCount, getBacktrackCount, getStackHighWater
+//
+//--------------------------------------------------------------------------------
+int64_t RegexMatcher::getOpCount() const {
+    return fOpCount;
+}
+
+int64_t RegexMatcher::getBacktrackCount() const {
+    return fSaveCount - fCutCount;
+}
+
+int64_t RegexMatcher::getStackHighWater() const {
+    return (int64_t)fStackHighWater * (int64_t)sizeof(int64_t);
+}
+
+
 //--------------------------------------------------------------------------------
 //
 //     setMatchCallback
@@ -2495,11 +2947,21 @@ REStackFrame *RegexMatcher::resetStack() {
     // Discard any previous contents of the state save stack, and initialize a
     //  new stack frame with all -1 data.  The -1s are needed for capture group limits,
     //  where they indicate that a group has not yet matched anything.
+    //  With an undo log, the frame is kept off the stack.
     fStack->removeAllElements();
 
-    REStackFrame *iFrame = (REStackFrame *)fStack->reserveBlock(fPattern->fFrameSize, fDeferredStatus);
-    if(U_FAILURE(fDeferredStatus)) {
-        return NULL;
+    REStackFrame *iFrame;
+    if (fUseUndoLog) {
+        fUndoLog->removeAllElements();
+        iFrame = (REStackFrame *)fCurrentFrame;
+    } else {
+        iFrame = (REStackFrame *)fStack->reserveBlock(fPattern->fFrameSize, fDeferredStatus);
+        if(U_FAILURE(fDeferredStatus)) {
+            return NULL;
+        }
+    }
+    if (fStack->size() > fStackHighWater) {
+        fStackHighWater = fStack->size();
     }
 
     int32_t i;
@@ -2527,55 +2989,18 @@ REStackFrame *RegexMatcher::resetStack() {
 //              TODO:  double-check edge cases at region boundaries.
 //
 //--------------------------------------------------------------------------------
-UBool RegexMatcher::isWordBoundary(int64_t pos) {
-    UBool isBoundary = FALSE;
-    UBool cIsWord    = FALSE;
-
-    if (pos >= fLookLimit) {
-        fHitEnd = TRUE;
-    } else {
-        // Determine whether char c at current position is a member of the word set of chars.
-        // If we're off the end of the string, behave as though we're not at a word char.
-        UTEXT_SETNATIVEINDEX(fInputText, pos);
-        UChar32  c = UTEXT_CURRENT32(fInputText);
-        if (u_hasBinaryProperty(c, UCHAR_GRAPHEME_EXTEND) || u_charType(c) == U_FORMAT_CHAR) {
-            // Current char is a combining one.  Not a boundary.
-            return FALSE;
-        }
-        cIsWord = fPattern->fStaticSets[URX_ISWORD_SET]->contains(c);
-    }
-
-    // Back up until we come to a non-combining char, determine whether
-    //  that char is a word char.
-    UBool prevCIsWord = FALSE;
-    for (;;) {
-        if (UTEXT_GETNATIVEINDEX(fInputText) <= fLookStart) {
-            break;
-        }
-        UChar32 prevChar = UTEXT_PREVIOUS32(fInputText);
-        if (!(u_hasBinaryProperty(prevChar, UCHAR_GRAPHEME_EXTEND)
-              || u_charType(prevChar) == U_FORMAT_CHAR)) {
-            prevCIsWord = fPattern->fStaticSets[URX_ISWORD_SET]->contains(prevChar);
-            break;
-        }
-    }
-    isBoundary = cIsWord ^ prevCIsWord;
-    return isBoundary;
-}
-
-UBool RegexMatcher::isChunkWordBoundary(int32_t pos) {
+template<typename Input>
+UBool RegexMatcher::isWordBoundary(Input &input, int64_t pos) {
     UBool isBoundary = FALSE;
     UBool cIsWord    = FALSE;
 
-    const UChar *inputBuf = fInputText->chunkContents;
-
     if (pos >= fLookLimit) {
         fHitEnd = TRUE;
     } else {
         // Determine whether char c at current position is a member of the word set of chars.
         // If we're off the end of the string, behave as though we're not at a word char.
-        UChar32 c;
-        U16_GET(inputBuf, fLookStart, pos, fLookLimit, c);
+        input.setIndex(pos);
+        UChar32  c = input.current32();
         if (u_hasBinaryProperty(c, UCHAR_GRAPHEME_EXTEND) || u_charType(c) == U_FORMAT_CHAR) {
             // Current char is a combining one.  Not a boundary.
             return FALSE;
@@ -2587,11 +3012,10 @@ UBool RegexMatcher::isChunkWordBoundary(int32_t pos) {
     //  that char is a word char.
     UBool prevCIsWord = FALSE;
     for (;;) {
-        if (pos <= fLookStart) {
+        if (input.getIndex() <= fLookStart) {
             break;
         }
-        UChar32 prevChar;
-        U16_PREV(inputBuf, fLookStart, pos, prevChar);
+        UChar32 prevChar = input.previous32();
         if (!(u_hasBinaryProperty(prevChar, UCHAR_GRAPHEME_EXTEND)
               || u_charType(prevChar) == U_FORMAT_CHAR)) {
             prevCIsWord = fPattern->fStaticSets[URX_ISWORD_SET]->contains(prevChar);
@@ -2642,14 +3066,28 @@ UBool RegexMatcher::isUWordBoundary(int64_t pos) {
     return   returnVal;
 }
 
+//--------------------------------------------------------------------------------
+//
+//   resetCounters     Zero the execution counters at the start of a match operation.
+//
+//--------------------------------------------------------------------------------
+void RegexMatcher::resetCounters() {
+    fOpCount        = 0;
+    fSaveCount      = 0;
+    fCutCount       = 0;
+    fStackHighWater = 0;
+}
+
 //--------------------------------------------------------------------------------
 //
 //   IncrementTime     This function is called once each TIMER_INITIAL_VALUE state
 //                     saves. Increment the "time" counter, and call the
 //                     user callback function if there is one installed.
+//                     Check the time, backtrack and deadline limits.
 //
-//                     If the match operation needs to be aborted, either for a time-out
-//                     or because the user callback asked for it, just set an error status.
+//                     If the match operation needs to be aborted, either for a time-out,
+//                     because the user callback asked for it, or to hand the operation
+//                     over to the DFA, just set an error status.
 //                     The engine will pick that up and stop in its outer loop.
 //
 //--------------------------------------------------------------------------------
@@ -2662,8 +3100,34 @@ void RegexMatcher::IncrementTime(UErrorCode &status) {
             return;
         }
     }
+    if (fDFAFallback && fTime - fDFATimeStart > 1 &&
+            (int64_t)(fTime - fDFATimeStart) * TIMER_INITIAL_VALUE > fActiveLimit - fDFAStartPos) {
+        // The engine has saved more states than there is input left to scan.
+        //   The operation can be finished by the DFA, in linear time.  Stop the
+        //   engine; the caller sees fDFASwitch and restores the status.
+        //   The NFA is built the first time that any matcher needs it; if it
+        //   turns out to be too large, the engine carries on.
+        fDFAFallback = FALSE;
+        if (fPattern->fNFA->ensureBuilt(status)) {
+            fDFASwitch = TRUE;
+            status = U_REGEX_TIME_OUT;
+            return;
+        }
+        if (U_FAILURE(status)) {
+            return;
+        }
+    }
     if (fTimeLimit > 0 && fTime >= fTimeLimit) {
         status = U_REGEX_TIME_OUT;
+        return;
+    }
+    if (fBacktrackLimit > 0 &&
+            fSaveCount - fCutCount - savedStateCount() > fBacktrackLimit) {
+        status = U_REGEX_TIME_OUT;
+        return;
+    }
+    if (fDeadline > 0 && uprv_getUTCtime() >= fDeadline) {
+        status = U_REGEX_TIME_OUT;
     }
 }
 
@@ -2678,6 +3142,9 @@ void RegexMatcher::IncrementTime(UErrorCode &status) {
 //       Note that reserveBlock() may grow the stack, resulting in the
 //       whole thing being relocated in memory.
 //
+//       Patterns with large frames use an undo log instead: only the input and
+//       pattern positions are saved, and the engine stays in the current frame.
+//
 //    Parameters:
 //       fp           The top frame pointer when called.  At return, a new
 //                    fame will be present
@@ -2692,39 +3159,158 @@ inline REStackFrame *RegexMatcher::StateSave(REStackFrame *fp, int64_t savePatId
     if (U_FAILURE(status)) {
         return fp;
     }
-    // push storage for a new frame.
-    int64_t *newFP = fStack->reserveBlock(fFrameSize, status);
-    if (U_FAILURE(status)) {
-        // Failure on attempted stack expansion.
-        //   Stack function set some other error code, change it to a more
-        //   specific one for regular expressions.
-        status = U_REGEX_STACK_OVERFLOW;
-        // We need to return a writable stack frame, so just return the
-        //    previous frame.  The match operation will stop quickly
-        //    because of the error status, after which the frame will never
-        //    be looked at again.
-        return fp;
-    }
-    fp = (REStackFrame *)(newFP - fFrameSize);  // in case of realloc of stack.
-
-    // New stack frame = copy of old top frame.
-    int64_t *source = (int64_t *)fp;
-    int64_t *dest   = newFP;
-    for (;;) {
-        *dest++ = *source++;
-        if (source == newFP) {
-            break;
+    REStackFrame *newFP;
+    if (fUseUndoLog) {
+        // Save the frame header, and the position in the undo log to back up to.
+        //   The engine carries on in the same frame.
+        int64_t *state = fStack->reserveBlock(RESTACKSTATE_SIZE, status);
+        if (U_FAILURE(status)) {
+            status = U_REGEX_STACK_OVERFLOW;
+            return fp;
+        }
+        state[0] = fp->fInputIdx;
+        state[1] = savePatIdx;
+        state[2] = fUndoLog->size();
+        newFP = fp;
+    } else {
+        // push storage for a new frame.
+        int64_t *newFrame = fStack->reserveBlock(fFrameSize, status);
+        if (U_FAILURE(status)) {
+            // Failure on attempted stack expansion.
+            //   Stack function set some other error code, change it to a more
+            //   specific one for regular expressions.
+            status = U_REGEX_STACK_OVERFLOW;
+            // We need to return a writable stack frame, so just return the
+            //    previous frame.  The match operation will stop quickly
+            //    because of the error status, after which the frame will never
+            //    be looked at again.
+            return fp;
+        }
+        fp = (REStackFrame *)(newFrame - fFrameSize);  // in case of realloc of stack.
+
+        // New stack frame = copy of old top frame.
+        int64_t *source = (int64_t *)fp;
+        int64_t *dest   = newFrame;
+        for (;;) {
+            *dest++ = *source++;
+            if (source == newFrame) {
+                break;
+            }
         }
+        fp->fPatIdx = savePatIdx;
+        newFP = (REStackFrame *)newFrame;
     }
 
+    fSaveCount++;
+    int32_t stackSize = fStack->size() + (fUseUndoLog ? fUndoLog->size() : 0);
+    if (stackSize > fStackHighWater) {
+        fStackHighWater = stackSize;
+    }
     fTickCounter--;
     if (fTickCounter <= 0) {
        IncrementTime(status);    // Re-initializes fTickCounter
     }
-    fp->fPatIdx = savePatIdx;
+    return newFP;
+}
+
+
+//--------------------------------------------------------------------------------
+//
+//   StateRestore
+//       Backtrack: discard the current frame, and resume from the most recently
+//       saved state.  With an undo log, the frame stays in place, and its extra
+//       state is restored from the log.
+//
+//    Return
+//                    The frame pointer of the restored state.
+//
+//--------------------------------------------------------------------------------
+inline REStackFrame *RegexMatcher::StateRestore(REStackFrame *fp) {
+    if (!fUseUndoLog) {
+        return (REStackFrame *)fStack->popFrame(fFrameSize);
+    }
+    const int64_t *state = fStack->popFrame(RESTACKSTATE_SIZE) + RESTACKSTATE_SIZE;
+    int32_t logSize = fUndoLog->size();
+    int32_t logMark = (int32_t)state[2];
+    if (logSize > logMark) {
+        const int64_t *log = fUndoLog->getBuffer();
+        for (int32_t i = logSize; i > logMark; i -= 2) {
+            fp->fExtra[log[i-2]] = log[i-1];
+        }
+        fUndoLog->popFrame(logSize - logMark);
+    }
+    fp->fInputIdx = state[0];
+    fp->fPatIdx   = state[1];
+    return fp;
+}
+
+
+//--------------------------------------------------------------------------------
+//
+//   setExtra
+//       Change an item of the extra state in the current frame, logging its old value
+//       if the engine uses an undo log.
+//
+//--------------------------------------------------------------------------------
+inline void RegexMatcher::setExtra(REStackFrame *fp, int32_t index, int64_t value, UErrorCode &status) {
+    if (fUseUndoLog && fp->fExtra[index] != value) {
+        int64_t *entry = fUndoLog->reserveBlock(2, status);
+        if (entry == NULL) {
+            status = U_REGEX_STACK_OVERFLOW;
+            return;
+        }
+        entry[0] = index;
+        entry[1] = fp->fExtra[index];
+    }
+    fp->fExtra[index] = value;
+}
+
+
+//--------------------------------------------------------------------------------
+//
+//   cutStack
+//       Discard the states saved since the stack had newStackSize elements, without
+//       backtracking to them, as at the end of an atomic group or a look-around
+//       assertion.  The current frame carries on, with its capture groups.
+//
+//    Return
+//                    The new frame pointer.
+//
+//--------------------------------------------------------------------------------
+inline REStackFrame *RegexMatcher::cutStack(REStackFrame *fp, int32_t newStackSize) {
+    U_ASSERT(newStackSize <= fStack->size());
+    if (fUseUndoLog) {
+        // The log stays; the states that remain may still need to undo its changes.
+        fCutCount += (fStack->size() - newStackSize) / RESTACKSTATE_SIZE;
+        fStack->setSize(newStackSize);
+        return fp;
+    }
+    int64_t *newFP = fStack->getBuffer() + newStackSize - fFrameSize;
+    if (newFP != (int64_t *)fp) {
+        int32_t j;
+        for (j=0; j<fFrameSize; j++) {
+            newFP[j] = ((int64_t *)fp)[j];
+        }
+        fCutCount += (fStack->size() - newStackSize) / fFrameSize;
+        fStack->setSize(newStackSize);
+    }
     return (REStackFrame *)newFP;
 }
 
+
+//--------------------------------------------------------------------------------
+//
+//   savedStateCount
+//       The number of states saved on the stack while the match engine runs.
+//
+//--------------------------------------------------------------------------------
+inline int64_t RegexMatcher::savedStateCount() const {
+    if (fUseUndoLog) {
+        return fStack->size() / RESTACKSTATE_SIZE;
+    }
+    return fStack->size() / fFrameSize - 1;     // Less the current frame.
+}
+
 #if defined(REGEX_DEBUG)
 namespace {
 UnicodeString StringFromUText(UText *ut) {
@@ -2740,13 +3326,38 @@ UnicodeString StringFromUText(UText *ut) {
 
 //--------------------------------------------------------------------------------
 //
-//   MatchAt      This is the actual matching engine.
+//   MatchAt      Run the match engine on the input text, through the input reader
+//                that fits it.
 //
 //                  startIdx:    begin matching a this index.
 //                  toEnd:       if true, match must extend to end of the input region
 //
 //--------------------------------------------------------------------------------
 void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
+    const uint8_t *utf8;
+    if (UTEXT_FULL_TEXT_IN_CHUNK(fInputText, fInputLength)) {
+        UTF16Input input(fInputText->chunkContents, (int32_t)fInputLength);
+        MatchUsing(input, startIdx, toEnd, status);
+    } else if ((utf8 = getUTF8Input(startIdx)) != NULL) {
+        UTF8Input input(utf8, (int32_t)fInputLength);
+        MatchUsing(input, startIdx, toEnd, status);
+    } else {
+        UTextInput input(fInputText);
+        MatchUsing(input, startIdx, toEnd, status);
+    }
+}
+
+
+//--------------------------------------------------------------------------------
+//
+//   MatchUsing   This is the actual matching engine.
+//                  input:       the reader for the input text.
+//                  startIdx:    begin matching a this index.
+//                  toEnd:       if true, match must extend to end of the input region
+//
+//--------------------------------------------------------------------------------
+template<typename Input>
+void RegexMatcher::MatchUsing(Input &input, int64_t startIdx, UBool toEnd, UErrorCode &status) {
     UBool       isMatch  = FALSE;      // True if the we have a match.
 
     int64_t     backSearchIndex = U_INT64_MAX; // used after greedy single-character matches for searching backwards
@@ -2754,6 +3365,7 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
     int32_t     op;                    // Operation from the compiled pattern, split into
     int32_t     opType;                //    the opcode
     int32_t     opValue;               //    and the operand value.
+    int64_t     opCount  = 0;          // Operations executed, added to fOpCount at the end.
 
 #ifdef REGEX_RUN_DEBUG
     if (fTraceDebug) {
@@ -2800,13 +3412,14 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
         opValue = URX_VAL(op);
 #ifdef REGEX_RUN_DEBUG
         if (fTraceDebug) {
-            UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
+            input.setIndex(fp->fInputIdx);
             printf("inputIdx=%ld   inputChar=%x   sp=%3ld   activeLimit=%ld  ", fp->fInputIdx,
-                UTEXT_CURRENT32(fInputText), (int64_t *)fp-fStack->getBuffer(), fActiveLimit);
+                input.current32(), (int64_t)fStack->size(), fActiveLimit);
             fPattern->dumpOp(fp->fPatIdx);
         }
 #endif
         fp->fPatIdx++;
+        opCount++;
 
         switch (opType) {
 
@@ -2819,22 +3432,22 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
             // Force a backtrack.  In some circumstances, the pattern compiler
             //   will notice that the pattern can't possibly match anything, and will
             //   emit one of these at that point.
-            fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+            fp = StateRestore(fp);
             break;
 
 
         case URX_ONECHAR:
             if (fp->fInputIdx < fActiveLimit) {
-                UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
-                UChar32 c = UTEXT_NEXT32(fInputText);
+                input.setIndex(fp->fInputIdx);
+                UChar32 c = input.next32();
                 if (c == opValue) {
-                    fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                    fp->fInputIdx = input.getIndex();
                     break;
                 }
             } else {
                 fHitEnd = TRUE;
             }
-            fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+            fp = StateRestore(fp);
             break;
 
 
@@ -2854,17 +3467,17 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
 
                 const UChar *patternString = litText+stringStartIdx;
                 int32_t patternStringIndex = 0;
-                UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
+                input.setIndex(fp->fInputIdx);
                 UChar32 inputChar;
                 UChar32 patternChar;
                 UBool success = TRUE;
                 while (patternStringIndex < stringLen) {
-                    if (UTEXT_GETNATIVEINDEX(fInputText) >= fActiveLimit) {
+                    if (input.getIndex() >= fActiveLimit) {
                         success = FALSE;
                         fHitEnd = TRUE;
                         break;
                     }
-                    inputChar = UTEXT_NEXT32(fInputText);
+                    inputChar = input.next32();
                     U16_NEXT(patternString, patternStringIndex, stringLen, patternChar);
                     if (patternChar != inputChar) {
                         success = FALSE;
@@ -2873,9 +3486,9 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                 }
 
                 if (success) {
-                    fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                    fp->fInputIdx = input.getIndex();
                 } else {
-                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                    fp = StateRestore(fp);
                 }
             }
             break;
@@ -2891,7 +3504,7 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
             //   when we reach the end of the pattern.
             if (toEnd && fp->fInputIdx != fActiveLimit) {
                 // The pattern matched, but not to the end of input.  Try some more.
-                fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                fp = StateRestore(fp);
                 break;
             }
             isMatch = TRUE;
@@ -2904,15 +3517,15 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
             //                          has not yet been reached (and might not ever be).
         case URX_START_CAPTURE:
             U_ASSERT(opValue >= 0 && opValue < fFrameSize-3);
-            fp->fExtra[opValue+2] = fp->fInputIdx;
+            setExtra(fp, opValue+2, fp->fInputIdx, status);
             break;
 
 
         case URX_END_CAPTURE:
             U_ASSERT(opValue >= 0 && opValue < fFrameSize-3);
             U_ASSERT(fp->fExtra[opValue+2] >= 0);            // Start pos for this group must be set.
-            fp->fExtra[opValue]   = fp->fExtra[opValue+2];   // Tentative start becomes real.
-            fp->fExtra[opValue+1] = fp->fInputIdx;           // End position
+            setExtra(fp, opValue, fp->fExtra[opValue+2], status);   // Tentative start becomes real.
+            setExtra(fp, opValue+1, fp->fInputIdx, status);         // End position
             U_ASSERT(fp->fExtra[opValue] <= fp->fExtra[opValue+1]);
             break;
 
@@ -2927,15 +3540,15 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                     break;
                 }
 
-                UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
+                input.setIndex(fp->fInputIdx);
 
                 // If we are positioned just before a new-line that is located at the
                 //   end of input, succeed.
-                UChar32 c = UTEXT_NEXT32(fInputText);
-                if (UTEXT_GETNATIVEINDEX(fInputText) >= fAnchorLimit) {
+                UChar32 c = input.next32();
+                if (input.getIndex() >= fAnchorLimit) {
                     if (isLineTerminator(c)) {
                         // If not in the middle of a CR/LF sequence
-                        if ( !(c==0x0a && fp->fInputIdx>fAnchorStart && ((void)UTEXT_PREVIOUS32(fInputText), UTEXT_PREVIOUS32(fInputText))==0x0d)) {
+                        if ( !(c==0x0a && fp->fInputIdx>fAnchorStart && ((void)input.previous32(), input.previous32())==0x0d)) {
                             // At new-line at end of input. Success
                             fHitEnd = TRUE;
                             fRequireEnd = TRUE;
@@ -2944,15 +3557,15 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                         }
                     }
                 } else {
-                    UChar32 nextC = UTEXT_NEXT32(fInputText);
-                    if (c == 0x0d && nextC == 0x0a && UTEXT_GETNATIVEINDEX(fInputText) >= fAnchorLimit) {
+                    UChar32 nextC = input.next32();
+                    if (c == 0x0d && nextC == 0x0a && input.getIndex() >= fAnchorLimit) {
                         fHitEnd = TRUE;
                         fRequireEnd = TRUE;
                         break;                         // At CR/LF at end of input.  Success
                     }
                 }
 
-                fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                fp = StateRestore(fp);
             }
             break;
 
@@ -2964,10 +3577,10 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                 fRequireEnd = TRUE;
                 break;
             } else {
-                UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
-                UChar32 c = UTEXT_NEXT32(fInputText);
+                input.setIndex(fp->fInputIdx);
+                UChar32 c = input.next32();
                 // Either at the last character of input, or off the end.
-                if (c == 0x0a && UTEXT_GETNATIVEINDEX(fInputText) == fAnchorLimit) {
+                if (c == 0x0a && input.getIndex() == fAnchorLimit) {
                     fHitEnd = TRUE;
                     fRequireEnd = TRUE;
                     break;
@@ -2975,7 +3588,7 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
             }
 
             // Not at end of input.  Back-track out.
-            fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+            fp = StateRestore(fp);
             break;
 
 
@@ -2989,18 +3602,18 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                  }
                  // If we are positioned just before a new-line, succeed.
                  // It makes no difference where the new-line is within the input.
-                 UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
-                 UChar32 c = UTEXT_CURRENT32(fInputText);
+                 input.setIndex(fp->fInputIdx);
+                 UChar32 c = input.current32();
                  if (isLineTerminator(c)) {
                      // At a line end, except for the odd chance of  being in the middle of a CR/LF sequence
                      //  In multi-line mode, hitting a new-line just before the end of input does not
                      //   set the hitEnd or requireEnd flags
-                     if ( !(c==0x0a && fp->fInputIdx>fAnchorStart && UTEXT_PREVIOUS32(fInputText)==0x0d)) {
+                     if ( !(c==0x0a && fp->fInputIdx>fAnchorStart && input.previous32()==0x0d)) {
                         break;
                      }
                  }
                  // not at a new line.  Fail.
-                 fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                 fp = StateRestore(fp);
              }
              break;
 
@@ -3015,9 +3628,9 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                  }
                  // If we are not positioned just before a new-line, the test fails; backtrack out.
                  // It makes no difference where the new-line is within the input.
-                 UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
-                 if (UTEXT_CURRENT32(fInputText) != 0x0a) {
-                     fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                 input.setIndex(fp->fInputIdx);
+                 if (input.current32() != 0x0a) {
+                     fp = StateRestore(fp);
                  }
              }
              break;
@@ -3025,7 +3638,7 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
 
        case URX_CARET:                    //  ^, test for start of line
             if (fp->fInputIdx != fAnchorStart) {
-                fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                fp = StateRestore(fp);
             }
             break;
 
@@ -3038,15 +3651,15 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                }
                // Check whether character just before the current pos is a new-line
                //   unless we are at the end of input
-               UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
-               UChar32  c = UTEXT_PREVIOUS32(fInputText);
+               input.setIndex(fp->fInputIdx);
+               UChar32  c = input.previous32();
                if ((fp->fInputIdx < fAnchorLimit) && isLineTerminator(c)) {
                    //  It's a new-line.  ^ is true.  Success.
                    //  TODO:  what should be done with positions between a CR and LF?
                    break;
                }
                // Not at the start of a line.  Fail.
-               fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+               fp = StateRestore(fp);
            }
            break;
 
@@ -3060,21 +3673,21 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                }
                // Check whether character just before the current pos is a new-line
                U_ASSERT(fp->fInputIdx <= fAnchorLimit);
-               UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
-               UChar32  c = UTEXT_PREVIOUS32(fInputText);
+               input.setIndex(fp->fInputIdx);
+               UChar32  c = input.previous32();
                if (c != 0x0a) {
                    // Not at the start of a line.  Back-track out.
-                   fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                   fp = StateRestore(fp);
                }
            }
            break;
 
         case URX_BACKSLASH_B:          // Test for word boundaries
             {
-                UBool success = isWordBoundary(fp->fInputIdx);
+                UBool success = isWordBoundary(input, fp->fInputIdx);
                 success ^= (UBool)(opValue != 0);     // flip sense for \B
                 if (!success) {
-                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                    fp = StateRestore(fp);
                 }
             }
             break;
@@ -3085,7 +3698,7 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                 UBool success = isUWordBoundary(fp->fInputIdx);
                 success ^= (UBool)(opValue != 0);     // flip sense for \B
                 if (!success) {
-                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                    fp = StateRestore(fp);
                 }
             }
             break;
@@ -3095,20 +3708,20 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
             {
                 if (fp->fInputIdx >= fActiveLimit) {
                     fHitEnd = TRUE;
-                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                    fp = StateRestore(fp);
                     break;
                 }
 
-                UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
+                input.setIndex(fp->fInputIdx);
 
-                UChar32 c = UTEXT_NEXT32(fInputText);
+                UChar32 c = input.next32();
                 int8_t ctype = u_charType(c);     // TODO:  make a unicode set for this.  Will be faster.
                 UBool success = (ctype == U_DECIMAL_DIGIT_NUMBER);
                 success ^= (UBool)(opValue != 0);        // flip sense for \D
                 if (success) {
-                    fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                    fp->fInputIdx = input.getIndex();
                 } else {
-                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                    fp = StateRestore(fp);
                 }
             }
             break;
@@ -3116,7 +3729,7 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
 
         case URX_BACKSLASH_G:          // Test for position at end of previous match
             if (!((fMatch && fp->fInputIdx==fMatchEnd) || (fMatch==FALSE && fp->fInputIdx==fActiveStart))) {
-                fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                fp = StateRestore(fp);
             }
             break;
 
@@ -3125,18 +3738,18 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
             {
                 if (fp->fInputIdx >= fActiveLimit) {
                     fHitEnd = TRUE;
-                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                    fp = StateRestore(fp);
                     break;
                 }
-                UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
-                UChar32 c = UTEXT_NEXT32(fInputText);
+                input.setIndex(fp->fInputIdx);
+                UChar32 c = input.next32();
                 int8_t ctype = u_charType(c);
                 UBool success = (ctype == U_SPACE_SEPARATOR || c == 9);  // SPACE_SEPARATOR || TAB
                 success ^= (UBool)(opValue != 0);        // flip sense for \H
                 if (success) {
-                    fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                    fp->fInputIdx = input.getIndex();
                 } else {
-                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                    fp = StateRestore(fp);
                 }
             }
             break;
@@ -3146,18 +3759,18 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
             {
                 if (fp->fInputIdx >= fActiveLimit) {
                     fHitEnd = TRUE;
-                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                    fp = StateRestore(fp);
                     break;
                 }
-                UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
-                UChar32 c = UTEXT_NEXT32(fInputText);
+                input.setIndex(fp->fInputIdx);
+                UChar32 c = input.next32();
                 if (isLineTerminator(c)) {
-                    if (c == 0x0d && utext_current32(fInputText) == 0x0a) {
-                        utext_next32(fInputText);
+                    if (c == 0x0d && input.current32() == 0x0a) {
+                        input.next32();
                     }
-                    fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                    fp->fInputIdx = input.getIndex();
                 } else {
-                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                    fp = StateRestore(fp);
                 }
             }
             break;
@@ -3167,17 +3780,17 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
             {
                 if (fp->fInputIdx >= fActiveLimit) {
                     fHitEnd = TRUE;
-                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                    fp = StateRestore(fp);
                     break;
                 }
-                UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
-                UChar32 c = UTEXT_NEXT32(fInputText);
+                input.setIndex(fp->fInputIdx);
+                UChar32 c = input.next32();
                 UBool success = isLineTerminator(c);
                 success ^= (UBool)(opValue != 0);        // flip sense for \V
                 if (success) {
-                    fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                    fp->fInputIdx = input.getIndex();
                 } else {
-                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                    fp = StateRestore(fp);
                 }
             }
             break;
@@ -3192,17 +3805,17 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                 // Fail if at end of input
                 if (fp->fInputIdx >= fActiveLimit) {
                     fHitEnd = TRUE;
-                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                    fp = StateRestore(fp);
                     break;
                 }
 
-                UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
+                input.setIndex(fp->fInputIdx);
 
                 // Examine (and consume) the current char.
                 //   Dispatch into a little state machine, based on the char.
                 UChar32  c;
-                c = UTEXT_NEXT32(fInputText);
-                fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                c = input.next32();
+                fp->fInputIdx = input.getIndex();
                 UnicodeSet **sets = fPattern->fStaticSets;
                 if (sets[URX_GC_NORMAL]->contains(c))  goto GC_Extend;
                 if (sets[URX_GC_CONTROL]->contains(c)) goto GC_Control;
@@ -3217,33 +3830,33 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
 
 GC_L:
                 if (fp->fInputIdx >= fActiveLimit)         goto GC_Done;
-                c = UTEXT_NEXT32(fInputText);
-                fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                c = input.next32();
+                fp->fInputIdx = input.getIndex();
                 if (sets[URX_GC_L]->contains(c))       goto GC_L;
                 if (sets[URX_GC_LV]->contains(c))      goto GC_V;
                 if (sets[URX_GC_LVT]->contains(c))     goto GC_T;
                 if (sets[URX_GC_V]->contains(c))       goto GC_V;
-                (void)UTEXT_PREVIOUS32(fInputText);
-                fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                (void)input.previous32();
+                fp->fInputIdx = input.getIndex();
                 goto GC_Extend;
 
 GC_V:
                 if (fp->fInputIdx >= fActiveLimit)         goto GC_Done;
-                c = UTEXT_NEXT32(fInputText);
-                fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                c = input.next32();
+                fp->fInputIdx = input.getIndex();
                 if (sets[URX_GC_V]->contains(c))       goto GC_V;
                 if (sets[URX_GC_T]->contains(c))       goto GC_T;
-                (void)UTEXT_PREVIOUS32(fInputText);
-                fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                (void)input.previous32();
+                fp->fInputIdx = input.getIndex();
                 goto GC_Extend;
 
 GC_T:
                 if (fp->fInputIdx >= fActiveLimit)         goto GC_Done;
-                c = UTEXT_NEXT32(fInputText);
-                fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                c = input.next32();
+                fp->fInputIdx = input.getIndex();
                 if (sets[URX_GC_T]->contains(c))       goto GC_T;
-                (void)UTEXT_PREVIOUS32(fInputText);
-                fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                (void)input.previous32();
+                fp->fInputIdx = input.getIndex();
                 goto GC_Extend;
 
 GC_Extend:
@@ -3252,21 +3865,21 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                     if (fp->fInputIdx >= fActiveLimit) {
                         break;
                     }
-                    c = UTEXT_CURRENT32(fInputText);
+                    c = input.current32();
                     if (sets[URX_GC_EXTEND]->contains(c) == FALSE) {
                         break;
                     }
-                    (void)UTEXT_NEXT32(fInputText);
-                    fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                    (void)input.next32();
+                    fp->fInputIdx = input.getIndex();
                 }
                 goto GC_Done;
 
 GC_Control:
                 // Most control chars stand alone (don't combine with combining chars),
                 //   except for that CR/LF sequence is a single grapheme cluster.
-                if (c == 0x0d && fp->fInputIdx < fActiveLimit && UTEXT_CURRENT32(fInputText) == 0x0a) {
-                    c = UTEXT_NEXT32(fInputText);
-                    fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                if (c == 0x0d && fp->fInputIdx < fActiveLimit && input.current32() == 0x0a) {
+                    c = input.next32();
+                    fp->fInputIdx = input.getIndex();
                 }
 
 GC_Done:
@@ -3281,7 +3894,7 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
 
         case URX_BACKSLASH_Z:          // Test for end of Input
             if (fp->fInputIdx < fAnchorLimit) {
-                fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                fp = StateRestore(fp);
             } else {
                 fHitEnd = TRUE;
                 fRequireEnd = TRUE;
@@ -3299,7 +3912,7 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                 //    1:   success if input char is not in set.
                 if (fp->fInputIdx >= fActiveLimit) {
                     fHitEnd = TRUE;
-                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                    fp = StateRestore(fp);
                     break;
                 }
 
@@ -3307,8 +3920,8 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                 opValue &= ~URX_NEG_SET;
                 U_ASSERT(opValue > 0 && opValue < URX_LAST_SET);
 
-                UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
-                UChar32 c = UTEXT_NEXT32(fInputText);
+                input.setIndex(fp->fInputIdx);
+                UChar32 c = input.next32();
                 if (c < 256) {
                     Regex8BitSet *s8 = &fPattern->fStaticSets8[opValue];
                     if (s8->contains(c)) {
@@ -3321,10 +3934,10 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                     }
                 }
                 if (success) {
-                    fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                    fp->fInputIdx = input.getIndex();
                 } else {
                     // the character wasn't in the set.
-                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                    fp = StateRestore(fp);
                 }
             }
             break;
@@ -3336,30 +3949,30 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                 //    the predefined sets (Word Characters, for example)
                 if (fp->fInputIdx >= fActiveLimit) {
                     fHitEnd = TRUE;
-                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                    fp = StateRestore(fp);
                     break;
                 }
 
                 U_ASSERT(opValue > 0 && opValue < URX_LAST_SET);
 
-                UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
+                input.setIndex(fp->fInputIdx);
 
-                UChar32 c = UTEXT_NEXT32(fInputText);
+                UChar32 c = input.next32();
                 if (c < 256) {
                     Regex8BitSet *s8 = &fPattern->fStaticSets8[opValue];
                     if (s8->contains(c) == FALSE) {
-                        fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                        fp->fInputIdx = input.getIndex();
                         break;
                     }
                 } else {
                     const UnicodeSet *s = fPattern->fStaticSets[opValue];
                     if (s->contains(c) == FALSE) {
-                        fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                        fp->fInputIdx = input.getIndex();
                         break;
                     }
                 }
                 // the character wasn't in the set.
-                fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                fp = StateRestore(fp);
             }
             break;
 
@@ -3367,31 +3980,31 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
         case URX_SETREF:
             if (fp->fInputIdx >= fActiveLimit) {
                 fHitEnd = TRUE;
-                fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                fp = StateRestore(fp);
                 break;
             } else {
-                UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
+                input.setIndex(fp->fInputIdx);
 
                 // There is input left.  Pick up one char and test it for set membership.
-                UChar32 c = UTEXT_NEXT32(fInputText);
+                UChar32 c = input.next32();
                 U_ASSERT(opValue > 0 && opValue < fSets->size());
                 if (c<256) {
                     Regex8BitSet *s8 = &fPattern->fSets8[opValue];
                     if (s8->contains(c)) {
-                        fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                        fp->fInputIdx = input.getIndex();
                         break;
                     }
                 } else {
                     UnicodeSet *s = (UnicodeSet *)fSets->elementAt(opValue);
                     if (s->contains(c)) {
                         // The character is in the set.  A Match.
-                        fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                        fp->fInputIdx = input.getIndex();
                         break;
                     }
                 }
 
                 // the character wasn't in the set.
-                fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                fp = StateRestore(fp);
             }
             break;
 
@@ -3402,20 +4015,20 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                 if (fp->fInputIdx >= fActiveLimit) {
                     // At end of input.  Match failed.  Backtrack out.
                     fHitEnd = TRUE;
-                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                    fp = StateRestore(fp);
                     break;
                 }
 
-                UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
+                input.setIndex(fp->fInputIdx);
 
                 // There is input left.  Advance over one char, unless we've hit end-of-line
-                UChar32 c = UTEXT_NEXT32(fInputText);
+                UChar32 c = input.next32();
                 if (isLineTerminator(c)) {
                     // End of line in normal mode.   . does not match.
-                        fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                        fp = StateRestore(fp);
                     break;
                 }
-                fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                fp->fInputIdx = input.getIndex();
             }
             break;
 
@@ -3426,23 +4039,23 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                 if (fp->fInputIdx >= fActiveLimit) {
                     // At end of input.  Match failed.  Backtrack out.
                     fHitEnd = TRUE;
-                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                    fp = StateRestore(fp);
                     break;
                 }
 
-                UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
+                input.setIndex(fp->fInputIdx);
 
                 // There is input left.  Advance over one char, except if we are
                 //   at a cr/lf, advance over both of them.
                 UChar32 c;
-                c = UTEXT_NEXT32(fInputText);
-                fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                c = input.next32();
+                fp->fInputIdx = input.getIndex();
                 if (c==0x0d && fp->fInputIdx < fActiveLimit) {
                     // In the case of a CR/LF, we need to advance over both.
-                    UChar32 nextc = UTEXT_CURRENT32(fInputText);
+                    UChar32 nextc = input.current32();
                     if (nextc == 0x0a) {
-                        (void)UTEXT_NEXT32(fInputText);
-                        fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                        (void)input.next32();
+                        fp->fInputIdx = input.getIndex();
                     }
                 }
             }
@@ -3456,19 +4069,19 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                 if (fp->fInputIdx >= fActiveLimit) {
                     // At end of input.  Match failed.  Backtrack out.
                     fHitEnd = TRUE;
-                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                    fp = StateRestore(fp);
                     break;
                 }
 
-                UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
+                input.setIndex(fp->fInputIdx);
 
                 // There is input left.  Advance over one char, unless we've hit end-of-line
-                UChar32 c = UTEXT_NEXT32(fInputText);
+                UChar32 c = input.next32();
                 if (c == 0x0a) {
                     // End of line in normal mode.   '.' does not match the \n
-                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                    fp = StateRestore(fp);
                 } else {
-                    fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                    fp->fInputIdx = input.getIndex();
                 }
             }
             break;
@@ -3505,7 +4118,7 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                     // The match did make progress.  Repeat the loop.
                     fp = StateSave(fp, fp->fPatIdx, status);  // State save to loc following current
                     fp->fPatIdx = opValue;
-                    fp->fExtra[frameLoc] = fp->fInputIdx;
+                    setExtra(fp, frameLoc, fp->fInputIdx, status);
                 }
                 // If the input position did not advance, we do nothing here,
                 //   execution will fall out of the loop.
@@ -3515,7 +4128,7 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
         case URX_CTR_INIT:
             {
                 U_ASSERT(opValue >= 0 && opValue < fFrameSize-2);
-                fp->fExtra[opValue] = 0;                 //  Set the loop counter variable to zero
+                setExtra(fp, opValue, 0, status);        //  Set the loop counter variable to zero
 
                 // Pick up the three extra operands that CTR_INIT has, and
                 //    skip the pattern location counter past
@@ -3532,9 +4145,9 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                     fp = StateSave(fp, loopLoc+1, status);
                 }
                 if (maxCount == -1) {
-                    fp->fExtra[opValue+1] = fp->fInputIdx;   //  For loop breaking.
+                    setExtra(fp, opValue+1, fp->fInputIdx, status);   //  For loop breaking.
                 } else if (maxCount == 0) {
-                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                    fp = StateRestore(fp);
                 }
             }
             break;
@@ -3547,7 +4160,7 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                 int64_t *pCounter = &fp->fExtra[URX_VAL(initOp)];
                 int32_t minCount  = (int32_t)pat[opValue+2];
                 int32_t maxCount  = (int32_t)pat[opValue+3];
-                (*pCounter)++;
+                setExtra(fp, URX_VAL(initOp), *pCounter + 1, status);
                 if ((uint64_t)*pCounter >= (uint32_t)maxCount && maxCount != -1) {
                     U_ASSERT(*pCounter == maxCount);
                     break;
@@ -3560,7 +4173,7 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                         if (fp->fInputIdx == *pLastInputIdx) {
                             break;
                         } else {
-                            *pLastInputIdx = fp->fInputIdx;
+                            setExtra(fp, URX_VAL(initOp) + 1, fp->fInputIdx, status);
                         }
                     }
                     fp = StateSave(fp, fp->fPatIdx, status);
@@ -3580,7 +4193,7 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
             {
                 // Initialize a non-greedy loop
                 U_ASSERT(opValue >= 0 && opValue < fFrameSize-2);
-                fp->fExtra[opValue] = 0;                 //  Set the loop counter variable to zero
+                setExtra(fp, opValue, 0, status);        //  Set the loop counter variable to zero
 
                 // Pick up the three extra operands that CTR_INIT_NG has, and
                 //    skip the pattern location counter past
@@ -3593,7 +4206,7 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                 U_ASSERT(maxCount>=minCount || maxCount==-1);
                 U_ASSERT(loopLoc>fp->fPatIdx);
                 if (maxCount == -1) {
-                    fp->fExtra[opValue+1] = fp->fInputIdx;   //  Save initial input index for loop breaking.
+                    setExtra(fp, opValue+1, fp->fInputIdx, status);   //  Save initial input index for loop breaking.
                 }
 
                 if (minCount == 0) {
@@ -3615,7 +4228,7 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                 int32_t minCount  = (int32_t)pat[opValue+2];
                 int32_t maxCount  = (int32_t)pat[opValue+3];
 
-                (*pCounter)++;
+                setExtra(fp, URX_VAL(initOp), *pCounter + 1, status);
                 if ((uint64_t)*pCounter >= (uint32_t)maxCount && maxCount != -1) {
                     // The loop has matched the maximum permitted number of times.
                     //   Break out of here with no action.  Matching will
@@ -3643,7 +4256,7 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                         if (fp->fInputIdx == *pLastInputIdx) {
                             break;
                         }
-                        *pLastInputIdx = fp->fInputIdx;
+                        setExtra(fp, URX_VAL(initOp) + 1, fp->fInputIdx, status);
                     }
 
                     // Loop Continuation: we will fall into the pattern following the loop
@@ -3664,17 +4277,7 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
             {
                 U_ASSERT(opValue >= 0 && opValue < fPattern->fDataSize);
                 int32_t newStackSize = (int32_t)fData[opValue];
-                U_ASSERT(newStackSize <= fStack->size());
-                int64_t *newFP = fStack->getBuffer() + newStackSize - fFrameSize;
-                if (newFP == (int64_t *)fp) {
-                    break;
-                }
-                int32_t j;
-                for (j=0; j<fFrameSize; j++) {
-                    newFP[j] = ((int64_t *)fp)[j];
-                }
-                fp = (REStackFrame *)newFP;
-                fStack->setSize(newStackSize);
+                fp = cutStack(fp, newStackSize);
             }
             break;
 
@@ -3686,11 +4289,11 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                 U_ASSERT(groupStartIdx <= groupEndIdx);
                 if (groupStartIdx < 0) {
                     // This capture group has not participated in the match thus far,
-                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);   // FAIL, no match.
+                    fp = StateRestore(fp);   // FAIL, no match.
                     break;
                 }
                 UTEXT_SETNATIVEINDEX(fAltInputText, groupStartIdx);
-                UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
+                input.setIndex(fp->fInputIdx);
 
                 //   Note: if the capture group match was of an empty string the backref
                 //         match succeeds.  Verified by testing:  Perl matches succeed
@@ -3702,13 +4305,13 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                         success = TRUE;
                         break;
                     }
-                    if (utext_getNativeIndex(fInputText) >= fActiveLimit) {
+                    if (input.getIndex() >= fActiveLimit) {
                         success = FALSE;
                         fHitEnd = TRUE;
                         break;
                     }
                     UChar32 captureGroupChar = utext_next32(fAltInputText);
-                    UChar32 inputChar = utext_next32(fInputText);
+                    UChar32 inputChar = input.next32();
                     if (inputChar != captureGroupChar) {
                         success = FALSE;
                         break;
@@ -3716,9 +4319,9 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                 }
 
                 if (success) {
-                    fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                    fp->fInputIdx = input.getIndex();
                 } else {
-                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                    fp = StateRestore(fp);
                 }
             }
             break;
@@ -3733,7 +4336,7 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                 U_ASSERT(groupStartIdx <= groupEndIdx);
                 if (groupStartIdx < 0) {
                     // This capture group has not participated in the match thus far,
-                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);   // FAIL, no match.
+                    fp = StateRestore(fp);   // FAIL, no match.
                     break;
                 }
                 utext_setNativeIndex(fAltInputText, groupStartIdx);
@@ -3774,7 +4377,7 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                 if (success) {
                     fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
                 } else {
-                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                    fp = StateRestore(fp);
                 }
 
             }
@@ -3783,7 +4386,7 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
         case URX_STO_INP_LOC:
             {
                 U_ASSERT(opValue >= 0 && opValue < fFrameSize);
-                fp->fExtra[opValue] = fp->fInputIdx;
+                setExtra(fp, opValue, fp->fInputIdx, status);
             }
             break;
 
@@ -3798,7 +4401,7 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                 if (savedInputIdx < fp->fInputIdx) {
                     fp->fPatIdx = opValue;                               // JMP
                 } else {
-                     fp = (REStackFrame *)fStack->popFrame(fFrameSize);   // FAIL, no progress in loop.
+                     fp = StateRestore(fp);   // FAIL, no progress in loop.
                 }
             }
             break;
@@ -3824,16 +4427,10 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                 int32_t newStackSize =(int32_t)fData[opValue];
                 U_ASSERT(stackSize >= newStackSize);
                 if (stackSize > newStackSize) {
-                    // Copy the current top frame back to the new (cut back) top frame.
+                    // Cut back the stack, keeping the current frame.
                     //   This makes the capture groups from within the look-ahead
                     //   expression available.
-                    int64_t *newFP = fStack->getBuffer() + newStackSize - fFrameSize;
-                    int32_t j;
-                    for (j=0; j<fFrameSize; j++) {
-                        newFP[j] = ((int64_t *)fp)[j];
-                    }
-                    fp = (REStackFrame *)newFP;
-                    fStack->setSize(newStackSize);
+                    fp = cutStack(fp, newStackSize);
                 }
                 fp->fInputIdx = fData[opValue+1];
 
@@ -3849,18 +4446,18 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
             // Input text is not, but case folding the input can not reduce two or more code
             // points to one.
             if (fp->fInputIdx < fActiveLimit) {
-                UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
+                input.setIndex(fp->fInputIdx);
 
-                UChar32 c = UTEXT_NEXT32(fInputText);
+                UChar32 c = input.next32();
                 if (u_foldCase(c, U_FOLD_CASE_DEFAULT) == opValue) {
-                    fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                    fp->fInputIdx = input.getIndex();
                     break;
                 }
             } else {
                 fHitEnd = TRUE;
             }
 
-            fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+            fp = StateRestore(fp);
             break;
 
         case URX_STRING_I:
@@ -3907,7 +4504,7 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                     if (success) {
                         fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
                     } else {
-                        fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                        fp = StateRestore(fp);
                     }
                 }
             }
@@ -3940,7 +4537,7 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                 //   of this op in the pattern.
                 int32_t minML = (int32_t)pat[fp->fPatIdx++];
                 int32_t maxML = (int32_t)pat[fp->fPatIdx++];
-                if (!UTEXT_USES_U16(fInputText)) {
+                if (!input.usesU16()) {
                     // utf-8 fix to maximum match length. The pattern compiler assumes utf-16.
                     // The max length need not be exact; it just needs to be >= actual maximum.
                     maxML *= 3;
@@ -3956,8 +4553,8 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                     lbStartIdx = fp->fInputIdx - minML;
                     if (lbStartIdx > 0) {
                         // move index to a code point boudary, if it's not on one already.
-                        UTEXT_SETNATIVEINDEX(fInputText, lbStartIdx);
-                        lbStartIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                        input.setIndex(lbStartIdx);
+                        lbStartIdx = input.getIndex();
                     }
                 } else {
                     // 2nd through nth time through the loop.
@@ -3965,9 +4562,9 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                     if (lbStartIdx == 0) {
                         (lbStartIdx)--;
                     } else {
-                        UTEXT_SETNATIVEINDEX(fInputText, lbStartIdx);
-                        (void)UTEXT_PREVIOUS32(fInputText);
-                        lbStartIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                        input.setIndex(lbStartIdx);
+                        (void)input.previous32();
+                        lbStartIdx = input.getIndex();
                     }
                 }
 
@@ -3975,7 +4572,7 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                     // We have tried all potential match starting points without
                     //  getting a match.  Backtrack out, and out of the
                     //   Look Behind altogether.
-                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                    fp = StateRestore(fp);
                     int64_t restoreInputLen = fData[opValue+3];
                     U_ASSERT(restoreInputLen >= fActiveLimit);
                     U_ASSERT(restoreInputLen <= fInputLength);
@@ -4000,7 +4597,7 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                     //  FAIL out of here, which will take us back to the LB_CONT, which
                     //     will retry the match starting at another position or fail
                     //     the look-behind altogether, whichever is appropriate.
-                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                    fp = StateRestore(fp);
                     break;
                 }
 
@@ -4023,7 +4620,7 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                 // Fetch the extra parameters of this op.
                 int32_t minML       = (int32_t)pat[fp->fPatIdx++];
                 int32_t maxML       = (int32_t)pat[fp->fPatIdx++];
-                if (!UTEXT_USES_U16(fInputText)) {
+                if (!input.usesU16()) {
                     // utf-8 fix to maximum match length. The pattern compiler assumes utf-16.
                     // The max length need not be exact; it just needs to be >= actual maximum.
                     maxML *= 3;
@@ -4042,8 +4639,8 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                     lbStartIdx = fp->fInputIdx - minML;
                     if (lbStartIdx > 0) {
                         // move index to a code point boudary, if it's not on one already.
-                        UTEXT_SETNATIVEINDEX(fInputText, lbStartIdx);
-                        lbStartIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                        input.setIndex(lbStartIdx);
+                        lbStartIdx = input.getIndex();
                     }
                 } else {
                     // 2nd through nth time through the loop.
@@ -4051,9 +4648,9 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                     if (lbStartIdx == 0) {
                         (lbStartIdx)--;
                     } else {
-                        UTEXT_SETNATIVEINDEX(fInputText, lbStartIdx);
-                        (void)UTEXT_PREVIOUS32(fInputText);
-                        lbStartIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                        input.setIndex(lbStartIdx);
+                        (void)input.previous32();
+                        lbStartIdx = input.getIndex();
                     }
                 }
 
@@ -4086,7 +4683,7 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                     //  FAIL out of here, which will take us back to the LB_CONT, which
                     //     will retry the match starting at another position or succeed
                     //     the look-behind altogether, whichever is appropriate.
-                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                    fp = StateRestore(fp);
                     break;
                 }
 
@@ -4106,11 +4703,11 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                 U_ASSERT(opValue>=0 && opValue+1<fPattern->fDataSize);
                 int32_t newStackSize = (int32_t)fData[opValue];
                 U_ASSERT(fStack->size() > newStackSize);
-                fStack->setSize(newStackSize);
+                fp = cutStack(fp, newStackSize);
 
                 //  FAIL, which will take control back to someplace
                 //  prior to entering the look-behind test.
-                fp = (REStackFrame *)fStack->popFrame(fFrameSize);
+                fp = StateRestore(fp);
             }
             break;
 
@@ -4128,13 +4725,13 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                 // Loop through input, until either the input is exhausted or
                 //   we reach a character that is not a member of the set.
                 int64_t ix = fp->fInputIdx;
-                UTEXT_SETNATIVEINDEX(fInputText, ix);
+                input.setIndex(ix);
                 for (;;) {
                     if (ix >= fActiveLimit) {
                         fHitEnd = TRUE;
                         break;
                     }
-                    UChar32 c = UTEXT_NEXT32(fInputText);
+                    UChar32 c = input.next32();
                     if (c<256) {
                         if (s8->contains(c) == FALSE) {
                             break;
@@ -4144,7 +4741,7 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                             break;
                         }
                     }
-                    ix = UTEXT_GETNATIVEINDEX(fInputText);
+                    ix = input.getIndex();
                 }
 
                 // If there were no matching characters, skip over the loop altogether.
@@ -4161,7 +4758,7 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                 U_ASSERT(URX_TYPE(loopcOp) == URX_LOOP_C);
                 int32_t stackLoc = URX_VAL(loopcOp);
                 U_ASSERT(stackLoc >= 0 && stackLoc < fFrameSize);
-                fp->fExtra[stackLoc] = fp->fInputIdx;
+                setExtra(fp, stackLoc, fp->fInputIdx, status);
                 fp->fInputIdx = ix;
 
                 // Save State to the URX_LOOP_C op that follows this one,
@@ -4189,13 +4786,13 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                     // NOT DOT ALL mode.  Line endings do not match '.'
                     // Scan forward until a line ending or end of input.
                     ix = fp->fInputIdx;
-                    UTEXT_SETNATIVEINDEX(fInputText, ix);
+                    input.setIndex(ix);
                     for (;;) {
                         if (ix >= fActiveLimit) {
                             fHitEnd = TRUE;
                             break;
                         }
-                        UChar32 c = UTEXT_NEXT32(fInputText);
+                        UChar32 c = input.next32();
                         if ((c & 0x7f) <= 0x29) {          // Fast filter of non-new-line-s
                             if ((c == 0x0a) ||             //  0x0a is newline in both modes.
                                (((opValue & 2) == 0) &&    // IF not UNIX_LINES mode
@@ -4204,7 +4801,7 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                                 break;
                             }
                         }
-                        ix = UTEXT_GETNATIVEINDEX(fInputText);
+                        ix = input.getIndex();
                     }
                 }
 
@@ -4222,7 +4819,7 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                 U_ASSERT(URX_TYPE(loopcOp) == URX_LOOP_C);
                 int32_t stackLoc = URX_VAL(loopcOp);
                 U_ASSERT(stackLoc >= 0 && stackLoc < fFrameSize);
-                fp->fExtra[stackLoc] = fp->fInputIdx;
+                setExtra(fp, stackLoc, fp->fInputIdx, status);
                 fp->fInputIdx = ix;
 
                 // Save State to the URX_LOOP_C op that follows this one,
@@ -4251,18 +4848,18 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
                 //   (We're going backwards because this loop emulates stack unwinding, not
                 //    the initial scan forward.)
                 U_ASSERT(fp->fInputIdx > 0);
-                UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
-                UChar32 prevC = UTEXT_PREVIOUS32(fInputText);
-                fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                input.setIndex(fp->fInputIdx);
+                UChar32 prevC = input.previous32();
+                fp->fInputIdx = input.getIndex();
 
-                UChar32 twoPrevC = UTEXT_PREVIOUS32(fInputText);
+                UChar32 twoPrevC = input.previous32();
                 if (prevC == 0x0a &&
                     fp->fInputIdx > backSearchIndex &&
                     twoPrevC == 0x0d) {
                     int32_t prevOp = (int32_t)pat[fp->fPatIdx-2];
                     if (URX_TYPE(prevOp) == URX_LOOP_DOT_I) {
                         // .*, stepping back over CRLF pair.
-                        fp->fInputIdx = UTEXT_GETNATIVEINDEX(fInputText);
+                        fp->fInputIdx = input.getIndex();
                     }
                 }
 
@@ -4287,6 +4884,8 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
 
 breakFromLoop:
     fMatch = isMatch;
+    fOpCount  += opCount;
+    fCutCount += savedStateCount();                    // The states still saved on the stack.
     if (isMatch) {
         fLastMatchEnd = fMatchEnd;
         fMatchStart   = startIdx;
@@ -4310,1507 +4909,6 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
 }
 
 
-//--------------------------------------------------------------------------------
-//
-//   MatchChunkAt   This is the actual matching engine. Like MatchAt, but with the
-//                  assumption that the entire string is available in the UText's
-//                  chunk buffer. For now, that means we can use int32_t indexes,
-//                  except for anything that needs to be saved (like group starts
-//                  and ends).
-//
-//                  startIdx:    begin matching a this index.
-//                  toEnd:       if true, match must extend to end of the input region
-//
-//--------------------------------------------------------------------------------
-void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &status) {
-    UBool       isMatch  = FALSE;      // True if the we have a match.
-
-    int32_t     backSearchIndex = INT32_MAX; // used after greedy single-character matches for searching backwards
-
-    int32_t     op;                    // Operation from the compiled pattern, split into
-    int32_t     opType;                //    the opcode
-    int32_t     opValue;               //    and the operand value.
-
-#ifdef REGEX_RUN_DEBUG
-    if (fTraceDebug) {
-        printf("MatchAt(startIdx=%d)\n", startIdx);
-        printf("Original Pattern: \"%s\"\n", CStr(StringFromUText(fPattern->fPattern))());
-        printf("Input String:     \"%s\"\n\n", CStr(StringFromUText(fInputText))());
-    }
-#endif
-
-    if (U_FAILURE(status)) {
-        return;
-    }
-
-    //  Cache frequently referenced items from the compiled pattern
-    //
-    int64_t             *pat           = fPattern->fCompiledPat->getBuffer();
-
-    const UChar         *litText       = fPattern->fLiteralText.getBuffer();
-    UVector             *fSets         = fPattern->fSets;
-
-    const UChar         *inputBuf      = fInputText->chunkContents;
-
-    fFrameSize = fPattern->fFrameSize;
-    REStackFrame        *fp            = resetStack();
-    if (U_FAILURE(fDeferredStatus)) {
-        status = fDeferredStatus;
-        return;
-    }
-
-    fp->fPatIdx   = 0;
-    fp->fInputIdx = startIdx;
-
-    // Zero out the pattern's static data
-    int32_t i;
-    for (i = 0; i<fPattern->fDataSize; i++) {
-        fData[i] = 0;
-    }
-
-    //
-    //  Main loop for interpreting the compiled pattern.
-    //  One iteration of the loop per pattern operation performed.
-    //
-    for (;;) {
-        op      = (int32_t)pat[fp->fPatIdx];
-        opType  = URX_TYPE(op);
-        opValue = URX_VAL(op);
-#ifdef REGEX_RUN_DEBUG
-        if (fTraceDebug) {
-            UTEXT_SETNATIVEINDEX(fInputText, fp->fInputIdx);
-            printf("inputIdx=%ld   inputChar=%x   sp=%3ld   activeLimit=%ld  ", fp->fInputIdx,
-                   UTEXT_CURRENT32(fInputText), (int64_t *)fp-fStack->getBuffer(), fActiveLimit);
-            fPattern->dumpOp(fp->fPatIdx);
-        }
-#endif
-        fp->fPatIdx++;
-
-        switch (opType) {
-
-
-        case URX_NOP:
-            break;
-
-
-        case URX_BACKTRACK:
-            // Force a backtrack.  In some circumstances, the pattern compiler
-            //   will notice that the pattern can't possibly match anything, and will
-            //   emit one of these at that point.
-            fp = (REStackFrame *)fStack->popFrame(fFrameSize);
-            break;
-
-
-        case URX_ONECHAR:
-            if (fp->fInputIdx < fActiveLimit) {
-                UChar32 c;
-                U16_NEXT(inputBuf, fp->fInputIdx, fActiveLimit, c);
-                if (c == opValue) {
-                    break;
-                }
-            } else {
-                fHitEnd = TRUE;
-            }
-            fp = (REStackFrame *)fStack->popFrame(fFrameSize);
-            break;
-
-
-        case URX_STRING:
-            {
-                // Test input against a literal string.
-                // Strings require two slots in the compiled pattern, one for the
-                //   offset to the string text, and one for the length.
-                int32_t   stringStartIdx = opValue;
-                int32_t   stringLen;
-
-                op      = (int32_t)pat[fp->fPatIdx];     // Fetch the second operand
-                fp->fPatIdx++;
-                opType    = URX_TYPE(op);
-                stringLen = URX_VAL(op);
-                U_ASSERT(opType == URX_STRING_LEN);
-                U_ASSERT(stringLen >= 2);
-
-                const UChar * pInp = inputBuf + fp->fInputIdx;
-                const UChar * pInpLimit = inputBuf + fActiveLimit;
-                const UChar * pPat = litText+stringStartIdx;
-                const UChar * pEnd = pInp + stringLen;
-                UBool success = TRUE;
-                while (pInp < pEnd) {
-                    if (pInp >= pInpLimit) {
-                        fHitEnd = TRUE;
-                        success = FALSE;
-                        break;
-                    }
-                    if (*pInp++ != *pPat++) {
-                        success = FALSE;
-                        break;
-                    }
-                }
-
-                if (success) {
-                    fp->fInputIdx += stringLen;
-                } else {
-                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
-                }
-            }
-            break;
-
-
-        case URX_STATE_SAVE:
-            fp = StateSave(fp, opValue, status);
-            break;
-
-
-        case URX_END:
-            // The match loop will exit via this path on a successful match,
-            //   when we reach the end of the pattern.
-            if (toEnd && fp->fInputIdx != fActiveLimit) {
-                // The pattern matched, but not to the end of input.  Try some more.
-                fp = (REStackFrame *)fStack->popFrame(fFrameSize);
-                break;
-            }
-            isMatch = TRUE;
-            goto  breakFromLoop;
-
-            // Start and End Capture stack frame variables are laid out out like this:
-            //  fp->fExtra[opValue]  - The start of a completed capture group
-            //             opValue+1 - The end   of a completed capture group
-            //             opValue+2 - the start of a capture group whose end
-            //                          has not yet been reached (and might not ever be).
-        case URX_START_CAPTURE:
-            U_ASSERT(opValue >= 0 && opValue < fFrameSize-3);
-            fp->fExtra[opValue+2] = fp->fInputIdx;
-            break;
-
-
-        case URX_END_CAPTURE:
-            U_ASSERT(opValue >= 0 && opValue < fFrameSize-3);
-            U_ASSERT(fp->fExtra[opValue+2] >= 0);            // Start pos for this group must be set.
-            fp->fExtra[opValue]   = fp->fExtra[opValue+2];   // Tentative start becomes real.
-            fp->fExtra[opValue+1] = fp->fInputIdx;           // End position
-            U_ASSERT(fp->fExtra[opValue] <= fp->fExtra[opValue+1]);
-            break;
-
-
-        case URX_DOLLAR:                   //  $, test for End of line
-            //     or for position before new line at end of input
-            if (fp->fInputIdx < fAnchorLimit-2) {
-                // We are no where near the end of input.  Fail.
-                //   This is the common case.  Keep it first.
-                fp = (REStackFrame *)fStack->popFrame(fFrameSize);
-                break;
-            }
-            if (fp->fInputIdx >= fAnchorLimit) {
-                // We really are at the end of input.  Success.
-                fHitEnd = TRUE;
-                fRequireEnd = TRUE;
-                break;
-            }
-
-            // If we are positioned just before a new-line that is located at the
-            //   end of input, succeed.
-            if (fp->fInputIdx == fAnchorLimit-1) {
-                UChar32 c;
-                U16_GET(inputBuf, fAnchorStart, fp->fInputIdx, fAnchorLimit, c);
-
-                if (isLineTerminator(c)) {
-                    if ( !(c==0x0a && fp->fInputIdx>fAnchorStart && inputBuf[fp->fInputIdx-1]==0x0d)) {
-                        // At new-line at end of input. Success
-                        fHitEnd = TRUE;
-                        fRequireEnd = TRUE;
-                        break;
-                    }
-                }
-            } else if (fp->fInputIdx == fAnchorLimit-2 &&
-                inputBuf[fp->fInputIdx]==0x0d && inputBuf[fp->fInputIdx+1]==0x0a) {
-                    fHitEnd = TRUE;
-                    fRequireEnd = TRUE;
-                    break;                         // At CR/LF at end of input.  Success
-            }
-
-            fp = (REStackFrame *)fStack->popFrame(fFrameSize);
-
-            break;
-
-
-        case URX_DOLLAR_D:                   //  $, test for End of Line, in UNIX_LINES mode.
-            if (fp->fInputIdx >= fAnchorLimit-1) {
-                // Either at the last character of input, or off the end.
-                if (fp->fInputIdx == fAnchorLimit-1) {
-                    // At last char of input.  Success if it's a new line.
-                    if (inputBuf[fp->fInputIdx] == 0x0a) {
-                        fHitEnd = TRUE;
-                        fRequireEnd = TRUE;
-                        break;
-                    }
-                } else {
-                    // Off the end of input.  Success.
-                    fHitEnd = TRUE;
-                    fRequireEnd = TRUE;
-                    break;
-                }
-            }
-
-            // Not at end of input.  Back-track out.
-            fp = (REStackFrame *)fStack->popFrame(fFrameSize);
-            break;
-
-
-        case URX_DOLLAR_M:                //  $, test for End of line in multi-line mode
-            {
-                if (fp->fInputIdx >= fAnchorLimit) {
-                    // We really are at the end of input.  Success.
-                    fHitEnd = TRUE;
-                    fRequireEnd = TRUE;
-                    break;
-                }
-                // If we are positioned just before a new-line, succeed.
-                // It makes no difference where the new-line is within the input.
-                UChar32 c = inputBuf[fp->fInputIdx];
-                if (isLineTerminator(c)) {
-                    // At a line end, except for the odd chance of  being in the middle of a CR/LF sequence
-                    //  In multi-line mode, hitting a new-line just before the end of input does not
-                    //   set the hitEnd or requireEnd flags
-                    if ( !(c==0x0a && fp->fInputIdx>fAnchorStart && inputBuf[fp->fInputIdx-1]==0x0d)) {
-                        break;
-                    }
-                }
-                // not at a new line.  Fail.
-                fp = (REStackFrame *)fStack->popFrame(fFrameSize);
-            }
-            break;
-
-
-        case URX_DOLLAR_MD:                //  $, test for End of line in multi-line and UNIX_LINES mode
-            {
-                if (fp->fInputIdx >= fAnchorLimit) {
-                    // We really are at the end of input.  Success.
-                    fHitEnd = TRUE;
-                    fRequireEnd = TRUE;  // Java set requireEnd in this case, even though
-                    break;               //   adding a new-line would not lose the match.
-                }
-                // If we are not positioned just before a new-line, the test fails; backtrack out.
-                // It makes no difference where the new-line is within the input.
-                if (inputBuf[fp->fInputIdx] != 0x0a) {
-                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
-                }
-            }
-            break;
-
-
-        case URX_CARET:                    //  ^, test for start of line
-            if (fp->fInputIdx != fAnchorStart) {
-                fp = (REStackFrame *)fStack->popFrame(fFrameSize);
-            }
-            break;
-
-
-        case URX_CARET_M:                   //  ^, test for start of line in mulit-line mode
-            {
-                if (fp->fInputIdx == fAnchorStart) {
-                    // We are at the start input.  Success.
-                    break;
-                }
-                // Check whether character just before the current pos is a new-line
-                //   unless we are at the end of input
-                UChar  c = inputBuf[fp->fInputIdx - 1];
-                if ((fp->fInputIdx < fAnchorLimit) &&
-                    isLineTerminator(c)) {
-                    //  It's a new-line.  ^ is true.  Success.
-                    //  TODO:  what should be done with positions between a CR and LF?
-                    break;
-                }
-                // Not at the start of a line.  Fail.
-                fp = (REStackFrame *)fStack->popFrame(fFrameSize);
-            }
-            break;
-
-
-        case URX_CARET_M_UNIX:       //  ^, test for start of line in mulit-line + Unix-line mode
-            {
-                U_ASSERT(fp->fInputIdx >= fAnchorStart);
-                if (fp->fInputIdx <= fAnchorStart) {
-                    // We are at the start input.  Success.
-                    break;
-                }
-                // Check whether character just before the current pos is a new-line
-                U_ASSERT(fp->fInputIdx <= fAnchorLimit);
-                UChar  c = inputBuf[fp->fInputIdx - 1];
-                if (c != 0x0a) {
-                    // Not at the start of a line.  Back-track out.
-                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
-                }
-            }
-            break;
-
-        case URX_BACKSLASH_B:          // Test for word boundaries
-            {
-                UBool success = isChunkWordBoundary((int32_t)fp->fInputIdx);
-                success ^= (UBool)(opValue != 0);     // flip sense for \B
-                if (!success) {
-                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
-                }
-            }
-            break;
-
-
-        case URX_BACKSLASH_BU:          // Test for word boundaries, Unicode-style
-            {
-                UBool success = isUWordBoundary(fp->fInputIdx);
-                success ^= (UBool)(opValue != 0);     // flip sense for \B
-                if (!success) {
-                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
-                }
-            }
-            break;
-
-
-        case URX_BACKSLASH_D:            // Test for decimal digit
-            {
-                if (fp->fInputIdx >= fActiveLimit) {
-                    fHitEnd = TRUE;
-                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
-                    break;
-                }
-
-                UChar32 c;
-                U16_NEXT(inputBuf, fp->fInputIdx, fActiveLimit, c);
-                int8_t ctype = u_charType(c);     // TODO:  make a unicode set for this.  Will be faster.
-                UBool success = (ctype == U_DECIMAL_DIGIT_NUMBER);
-                success ^= (UBool)(opValue != 0);        // flip sense for \D
-                if (!success) {
-                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
-                }
-            }
-            break;
-
-
-        case URX_BACKSLASH_G:          // Test for position at end of previous match
-            if (!((fMatch && fp->fInputIdx==fMatchEnd) || (fMatch==FALSE && fp->fInputIdx==fActiveStart))) {
-                fp = (REStackFrame *)fStack->popFrame(fFrameSize);
-            }
-            break;
-
-
-        case URX_BACKSLASH_H:            // Test for \h, horizontal white space.
-            {
-                if (fp->fInputIdx >= fActiveLimit) {
-                    fHitEnd = TRUE;
-                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
-                    break;
-                }
-                UChar32 c;
-                U16_NEXT(inputBuf, fp->fInputIdx, fActiveLimit, c);
-                int8_t ctype = u_charType(c);
-                UBool success = (ctype == U_SPACE_SEPARATOR || c == 9);  // SPACE_SEPARATOR || TAB
-                success ^= (UBool)(opValue != 0);        // flip sense for \H
-                if (!success) {
-                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
-                }
-            }
-            break;
-
-
-        case URX_BACKSLASH_R:            // Test for \R, any line break sequence.
-            {
-                if (fp->fInputIdx >= fActiveLimit) {
-                    fHitEnd = TRUE;
-                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
-                    break;
-                }
-                UChar32 c;
-                U16_NEXT(inputBuf, fp->fInputIdx, fActiveLimit, c);
-                if (isLineTerminator(c)) {
-                    if (c == 0x0d && fp->fInputIdx < fActiveLimit) {
-                        // Check for CR/LF sequence. Consume both together when found.
-                        UChar c2;
-                        U16_NEXT(inputBuf, fp->fInputIdx, fActiveLimit, c2);
-                        if (c2 != 0x0a) {
-                            U16_PREV(inputBuf, 0, fp->fInputIdx, c2);
-                        }
-                    }
-                } else {
-                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
-                }
-            }
-            break;
-
-
-        case URX_BACKSLASH_V:         // Any single code point line ending.
-            {
-                if (fp->fInputIdx >= fActiveLimit) {
-                    fHitEnd = TRUE;
-                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
-                    break;
-                }
-                UChar32 c;
-                U16_NEXT(inputBuf, fp->fInputIdx, fActiveLimit, c);
-                UBool success = isLineTerminator(c);
-                success ^= (UBool)(opValue != 0);        // flip sense for \V
-                if (!success) {
-                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
-                }
-            }
-            break;
-
-
-
-        case URX_BACKSLASH_X:
-        //  Match a Grapheme, as defined by Unicode TR 29.
-        //  Differs slightly from Perl, which consumes combining marks independently
-        //    of context.
-        {
-
-            // Fail if at end of input
-            if (fp->fInputIdx >= fActiveLimit) {
-                fHitEnd = TRUE;
-                fp = (REStackFrame *)fStack->popFrame(fFrameSize);
-                break;
-            }
-
-            // Examine (and consume) the current char.
-            //   Dispatch into a little state machine, based on the char.
-            UChar32  c;
-            U16_NEXT(inputBuf, fp->fInputIdx, fActiveLimit, c);
-            UnicodeSet **sets = fPattern->fStaticSets;
-            if (sets[URX_GC_NORMAL]->contains(c))  goto GC_Extend;
-            if (sets[URX_GC_CONTROL]->contains(c)) goto GC_Control;
-            if (sets[URX_GC_L]->contains(c))       goto GC_L;
-            if (sets[URX_GC_LV]->contains(c))      goto GC_V;
-            if (sets[URX_GC_LVT]->contains(c))     goto GC_T;
-            if (sets[URX_GC_V]->contains(c))       goto GC_V;
-            if (sets[URX_GC_T]->contains(c))       goto GC_T;
-            goto GC_Extend;
-
-
-
-GC_L:
-            if (fp->fInputIdx >= fActiveLimit)         goto GC_Done;
-            U16_NEXT(inputBuf, fp->fInputIdx, fActiveLimit, c);
-            if (sets[URX_GC_L]->contains(c))       goto GC_L;
-            if (sets[URX_GC_LV]->contains(c))      goto GC_V;
-            if (sets[URX_GC_LVT]->contains(c))     goto GC_T;
-            if (sets[URX_GC_V]->contains(c))       goto GC_V;
-            U16_PREV(inputBuf, 0, fp->fInputIdx, c);
-            goto GC_Extend;
-
-GC_V:
-            if (fp->fInputIdx >= fActiveLimit)         goto GC_Done;
-            U16_NEXT(inputBuf, fp->fInputIdx, fActiveLimit, c);
-            if (sets[URX_GC_V]->contains(c))       goto GC_V;
-            if (sets[URX_GC_T]->contains(c))       goto GC_T;
-            U16_PREV(inputBuf, 0, fp->fInputIdx, c);
-            goto GC_Extend;
-
-GC_T:
-            if (fp->fInputIdx >= fActiveLimit)         goto GC_Done;
-            U16_NEXT(inputBuf, fp->fInputIdx, fActiveLimit, c);
-            if (sets[URX_GC_T]->contains(c))       goto GC_T;
-            U16_PREV(inputBuf, 0, fp->fInputIdx, c);
-            goto GC_Extend;
-
-GC_Extend:
-            // Combining characters are consumed here
-            for (;;) {
-                if (fp->fInputIdx >= fActiveLimit) {
-                    break;
-                }
-                U16_NEXT(inputBuf, fp->fInputIdx, fActiveLimit, c);
-                if (sets[URX_GC_EXTEND]->contains(c) == FALSE) {
-                    U16_BACK_1(inputBuf, 0, fp->fInputIdx);
-                    break;
-                }
-            }
-            goto GC_Done;
-
-GC_Control:
-            // Most control chars stand alone (don't combine with combining chars),
-            //   except for that CR/LF sequence is a single grapheme cluster.
-            if (c == 0x0d && fp->fInputIdx < fActiveLimit && inputBuf[fp->fInputIdx] == 0x0a) {
-                fp->fInputIdx++;
-            }
-
-GC_Done:
-            if (fp->fInputIdx >= fActiveLimit) {
-                fHitEnd = TRUE;
-            }
-            break;
-        }
-
-
-
-
-        case URX_BACKSLASH_Z:          // Test for end of Input
-            if (fp->fInputIdx < fAnchorLimit) {
-                fp = (REStackFrame *)fStack->popFrame(fFrameSize);
-            } else {
-                fHitEnd = TRUE;
-                fRequireEnd = TRUE;
-            }
-            break;
-
-
-
-        case URX_STATIC_SETREF:
-            {
-                // Test input character against one of the predefined sets
-                //    (Word Characters, for example)
-                // The high bit of the op value is a flag for the match polarity.
-                //    0:   success if input char is in set.
-                //    1:   success if input char is not in set.
-                if (fp->fInputIdx >= fActiveLimit) {
-                    fHitEnd = TRUE;
-                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
-                    break;
-                }
-
-                UBool success = ((opValue & URX_NEG_SET) == URX_NEG_SET);
-                opValue &= ~URX_NEG_SET;
-                U_ASSERT(opValue > 0 && opValue < URX_LAST_SET);
-
-                UChar32 c;
-                U16_NEXT(inputBuf, fp->fInputIdx, fActiveLimit, c);
-                if (c < 256) {
-                    Regex8BitSet *s8 = &fPattern->fStaticSets8[opValue];
-                    if (s8->contains(c)) {
-                        success = !success;
-                    }
-                } else {
-                    const UnicodeSet *s = fPattern->fStaticSets[opValue];
-                    if (s->contains(c)) {
-                        success = !success;
-                    }
-                }
-                if (!success) {
-                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
-                }
-            }
-            break;
-
-
-        case URX_STAT_SETREF_N:
-            {
-                // Test input character for NOT being a member of  one of
-                //    the predefined sets (Word Characters, for example)
-                if (fp->fInputIdx >= fActiveLimit) {
-                    fHitEnd = TRUE;
-                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
-                    break;
-                }
-
-                U_ASSERT(opValue > 0 && opValue < URX_LAST_SET);
-
-                UChar32  c;
-                U16_NEXT(inputBuf, fp->fInputIdx, fActiveLimit, c);
-                if (c < 256) {
-                    Regex8BitSet *s8 = &fPattern->fStaticSets8[opValue];
-                    if (s8->contains(c) == FALSE) {
-                        break;
-                    }
-                } else {
-                    const UnicodeSet *s = fPattern->fStaticSets[opValue];
-                    if (s->contains(c) == FALSE) {
-                        break;
-                    }
-                }
-                fp = (REStackFrame *)fStack->popFrame(fFrameSize);
-            }
-            break;
-
-
-        case URX_SETREF:
-            {
-                if (fp->fInputIdx >= fActiveLimit) {
-                    fHitEnd = TRUE;
-                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
-                    break;
-                }
-
-                U_ASSERT(opValue > 0 && opValue < fSets->size());
-
-                // There is input left.  Pick up one char and test it for set membership.
-                UChar32  c;
-                U16_NEXT(inputBuf, fp->fInputIdx, fActiveLimit, c);
-                if (c<256) {
-                    Regex8BitSet *s8 = &fPattern->fSets8[opValue];
-                    if (s8->contains(c)) {
-                        // The character is in the set.  A Match.
-                        break;
-                    }
-                } else {
-                    UnicodeSet *s = (UnicodeSet *)fSets->elementAt(opValue);
-                    if (s->contains(c)) {
-                        // The character is in the set.  A Match.
-                        break;
-                    }
-                }
-
-                // the character wasn't in the set.
-                fp = (REStackFrame *)fStack->popFrame(fFrameSize);
-            }
-            break;
-
-
-        case URX_DOTANY:
-            {
-                // . matches anything, but stops at end-of-line.
-                if (fp->fInputIdx >= fActiveLimit) {
-                    // At end of input.  Match failed.  Backtrack out.
-                    fHitEnd = TRUE;
-                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
-                    break;
-                }
-
-                // There is input left.  Advance over one char, unless we've hit end-of-line
-                UChar32  c;
-                U16_NEXT(inputBuf, fp->fInputIdx, fActiveLimit, c);
-                if (isLineTerminator(c)) {
-                    // End of line in normal mode.   . does not match.
-                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
-                    break;
-                }
-            }
-            break;
-
-
-        case URX_DOTANY_ALL:
-            {
-                // . in dot-matches-all (including new lines) mode
-                if (fp->fInputIdx >= fActiveLimit) {
-                    // At end of input.  Match failed.  Backtrack out.
-                    fHitEnd = TRUE;
-                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
-                    break;
-                }
-
-                // There is input left.  Advance over one char, except if we are
-                //   at a cr/lf, advance over both of them.
-                UChar32 c;
-                U16_NEXT(inputBuf, fp->fInputIdx, fActiveLimit, c);
-                if (c==0x0d && fp->fInputIdx < fActiveLimit) {
-                    // In the case of a CR/LF, we need to advance over both.
-                    if (inputBuf[fp->fInputIdx] == 0x0a) {
-                        U16_FWD_1(inputBuf, fp->fInputIdx, fActiveLimit);
-                    }
-                }
-            }
-            break;
-
-
-        case URX_DOTANY_UNIX:
-            {
-                // '.' operator, matches all, but stops at end-of-line.
-                //   UNIX_LINES mode, so 0x0a is the only recognized line ending.
-                if (fp->fInputIdx >= fActiveLimit) {
-                    // At end of input.  Match failed.  Backtrack out.
-                    fHitEnd = TRUE;
-                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
-                    break;
-                }
-
-                // There is input left.  Advance over one char, unless we've hit end-of-line
-                UChar32 c;
-                U16_NEXT(inputBuf, fp->fInputIdx, fActiveLimit, c);
-                if (c == 0x0a) {
-                    // End of line in normal mode.   '.' does not match the \n
-                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
-                }
-            }
-            break;
-
-
-        case URX_JMP:
-            fp->fPatIdx = opValue;
-            break;
-
-        case URX_FAIL:
-            isMatch = FALSE;
-            goto breakFromLoop;
-
-        case URX_JMP_SAV:
-            U_ASSERT(opValue < fPattern->fCompiledPat->size());
-            fp = StateSave(fp, fp->fPatIdx, status);       // State save to loc following current
-            fp->fPatIdx = opValue;                         // Then JMP.
-            break;
-
-        case URX_JMP_SAV_X:
-            // This opcode is used with (x)+, when x can match a zero length string.
-            // Same as JMP_SAV, except conditional on the match having made forward progress.
-            // Destination of the JMP must be a URX_STO_INP_LOC, from which we get the
-            //   data address of the input position at the start of the loop.
-            {
-                U_ASSERT(opValue > 0 && opValue < fPattern->fCompiledPat->size());
-                int32_t  stoOp = (int32_t)pat[opValue-1];
-                U_ASSERT(URX_TYPE(stoOp) == URX_STO_INP_LOC);
-                int32_t  frameLoc = URX_VAL(stoOp);
-                U_ASSERT(frameLoc >= 0 && frameLoc < fFrameSize);
-                int32_t prevInputIdx = (int32_t)fp->fExtra[frameLoc];
-                U_ASSERT(prevInputIdx <= fp->fInputIdx);
-                if (prevInputIdx < fp->fInputIdx) {
-                    // The match did make progress.  Repeat the loop.
-                    fp = StateSave(fp, fp->fPatIdx, status);  // State save to loc following current
-                    fp->fPatIdx = opValue;
-                    fp->fExtra[frameLoc] = fp->fInputIdx;
-                }
-                // If the input position did not advance, we do nothing here,
-                //   execution will fall out of the loop.
-            }
-            break;
-
-        case URX_CTR_INIT:
-            {
-                U_ASSERT(opValue >= 0 && opValue < fFrameSize-2);
-                fp->fExtra[opValue] = 0;                 //  Set the loop counter variable to zero
-
-                // Pick up the three extra operands that CTR_INIT has, and
-                //    skip the pattern location counter past
-                int32_t instrOperandLoc = (int32_t)fp->fPatIdx;
-                fp->fPatIdx += 3;
-                int32_t loopLoc  = URX_VAL(pat[instrOperandLoc]);
-                int32_t minCount = (int32_t)pat[instrOperandLoc+1];
-                int32_t maxCount = (int32_t)pat[instrOperandLoc+2];
-                U_ASSERT(minCount>=0);
-                U_ASSERT(maxCount>=minCount || maxCount==-1);
-                U_ASSERT(loopLoc>=fp->fPatIdx);
-
-                if (minCount == 0) {
-                    fp = StateSave(fp, loopLoc+1, status);
-                }
-                if (maxCount == -1) {
-                    fp->fExtra[opValue+1] = fp->fInputIdx;   //  For loop breaking.
-                } else if (maxCount == 0) {
-                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
-                }
-            }
-            break;
-
-        case URX_CTR_LOOP:
-            {
-                U_ASSERT(opValue>0 && opValue < fp->fPatIdx-2);
-                int32_t initOp = (int32_t)pat[opValue];
-                U_ASSERT(URX_TYPE(initOp) == URX_CTR_INIT);
-                int64_t *pCounter = &fp->fExtra[URX_VAL(initOp)];
-                int32_t minCount  = (int32_t)pat[opValue+2];
-                int32_t maxCount  = (int32_t)pat[opValue+3];
-                (*pCounter)++;
-                if ((uint64_t)*pCounter >= (uint32_t)maxCount && maxCount != -1) {
-                    U_ASSERT(*pCounter == maxCount);
-                    break;
-                }
-                if (*pCounter >= minCount) {
-                    if (maxCount == -1) {
-                        // Loop has no hard upper bound.
-                        // Check that it is progressing through the input, break if it is not.
-                        int64_t *pLastInputIdx =  &fp->fExtra[URX_VAL(initOp) + 1];
-                        if (fp->fInputIdx == *pLastInputIdx) {
-                            break;
-                        } else {
-                            *pLastInputIdx = fp->fInputIdx;
-                        }
-                    }
-                    fp = StateSave(fp, fp->fPatIdx, status);
-                } else {
-                    // Increment time-out counter. (StateSave() does it if count >= minCount)
-                    fTickCounter--;
-                    if (fTickCounter <= 0) {
-                        IncrementTime(status);    // Re-initializes fTickCounter
-                    }
-                }
-                fp->fPatIdx = opValue + 4;    // Loop back.
-            }
-            break;
-
-        case URX_CTR_INIT_NG:
-            {
-                // Initialize a non-greedy loop
-                U_ASSERT(opValue >= 0 && opValue < fFrameSize-2);
-                fp->fExtra[opValue] = 0;                 //  Set the loop counter variable to zero
-
-                // Pick up the three extra operands that CTR_INIT_NG has, and
-                //    skip the pattern location counter past
-                int32_t instrOperandLoc = (int32_t)fp->fPatIdx;
-                fp->fPatIdx += 3;
-                int32_t loopLoc  = URX_VAL(pat[instrOperandLoc]);
-                int32_t minCount = (int32_t)pat[instrOperandLoc+1];
-                int32_t maxCount = (int32_t)pat[instrOperandLoc+2];
-                U_ASSERT(minCount>=0);
-                U_ASSERT(maxCount>=minCount || maxCount==-1);
-                U_ASSERT(loopLoc>fp->fPatIdx);
-                if (maxCount == -1) {
-                    fp->fExtra[opValue+1] = fp->fInputIdx;   //  Save initial input index for loop breaking.
-                }
-
-                if (minCount == 0) {
-                    if (maxCount != 0) {
-                        fp = StateSave(fp, fp->fPatIdx, status);
-                    }
-                    fp->fPatIdx = loopLoc+1;   // Continue with stuff after repeated block
-                }
-            }
-            break;
-
-        case URX_CTR_LOOP_NG:
-            {
-                // Non-greedy {min, max} loops
-                U_ASSERT(opValue>0 && opValue < fp->fPatIdx-2);
-                int32_t initOp = (int32_t)pat[opValue];
-                U_ASSERT(URX_TYPE(initOp) == URX_CTR_INIT_NG);
-                int64_t *pCounter = &fp->fExtra[URX_VAL(initOp)];
-                int32_t minCount  = (int32_t)pat[opValue+2];
-                int32_t maxCount  = (int32_t)pat[opValue+3];
-
-                (*pCounter)++;
-                if ((uint64_t)*pCounter >= (uint32_t)maxCount && maxCount != -1) {
-                    // The loop has matched the maximum permitted number of times.
-                    //   Break out of here with no action.  Matching will
-                    //   continue with the following pattern.
-                    U_ASSERT(*pCounter == maxCount);
-                    break;
-                }
-
-                if (*pCounter < minCount) {
-                    // We haven't met the minimum number of matches yet.
-                    //   Loop back for another one.
-                    fp->fPatIdx = opValue + 4;    // Loop back.
-                    fTickCounter--;
-                    if (fTickCounter <= 0) {
-                        IncrementTime(status);    // Re-initializes fTickCounter
-                    }
-                } else {
-                    // We do have the minimum number of matches.
-
-                    // If there is no upper bound on the loop iterations, check that the input index
-                    // is progressing, and stop the loop if it is not.
-                    if (maxCount == -1) {
-                        int64_t *pLastInputIdx =  &fp->fExtra[URX_VAL(initOp) + 1];
-                        if (fp->fInputIdx == *pLastInputIdx) {
-                            break;
-                        }
-                        *pLastInputIdx = fp->fInputIdx;
-                    }
-
-                    // Loop Continuation: we will fall into the pattern following the loop
-                    //   (non-greedy, don't execute loop body first), but first do
-                    //   a state save to the top of the loop, so that a match failure
-                    //   in the following pattern will try another iteration of the loop.
-                    fp = StateSave(fp, opValue + 4, status);
-                }
-            }
-            break;
-
-        case URX_STO_SP:
-            U_ASSERT(opValue >= 0 && opValue < fPattern->fDataSize);
-            fData[opValue] = fStack->size();
-            break;
-
-        case URX_LD_SP:
-            {
-                U_ASSERT(opValue >= 0 && opValue < fPattern->fDataSize);
-                int32_t newStackSize = (int32_t)fData[opValue];
-                U_ASSERT(newStackSize <= fStack->size());
-                int64_t *newFP = fStack->getBuffer() + newStackSize - fFrameSize;
-                if (newFP == (int64_t *)fp) {
-                    break;
-                }
-                int32_t j;
-                for (j=0; j<fFrameSize; j++) {
-                    newFP[j] = ((int64_t *)fp)[j];
-                }
-                fp = (REStackFrame *)newFP;
-                fStack->setSize(newStackSize);
-            }
-            break;
-
-        case URX_BACKREF:
-            {
-                U_ASSERT(opValue < fFrameSize);
-                int64_t groupStartIdx = fp->fExtra[opValue];
-                int64_t groupEndIdx   = fp->fExtra[opValue+1];
-                U_ASSERT(groupStartIdx <= groupEndIdx);
-                int64_t inputIndex = fp->fInputIdx;
-                if (groupStartIdx < 0) {
-                    // This capture group has not participated in the match thus far,
-                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);   // FAIL, no match.
-                    break;
-                }
-                UBool success = TRUE;
-                for (int64_t groupIndex = groupStartIdx; groupIndex < groupEndIdx; ++groupIndex,++inputIndex) {
-                    if (inputIndex >= fActiveLimit) {
-                        success = FALSE;
-                        fHitEnd = TRUE;
-                        break;
-                    }
-                    if (inputBuf[groupIndex] != inputBuf[inputIndex]) {
-                        success = FALSE;
-                        break;
-                    }
-                }
-                if (success && groupStartIdx < groupEndIdx && U16_IS_LEAD(inputBuf[groupEndIdx-1]) &&
-                        inputIndex < fActiveLimit && U16_IS_TRAIL(inputBuf[inputIndex])) {
-                    // Capture group ended with an unpaired lead surrogate.
-                    // Back reference is not permitted to match lead only of a surrogatge pair.
-                    success = FALSE;
-                }
-                if (success) {
-                    fp->fInputIdx = inputIndex;
-                } else {
-                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
-                }
-            }
-            break;
-
-        case URX_BACKREF_I:
-            {
-                U_ASSERT(opValue < fFrameSize);
-                int64_t groupStartIdx = fp->fExtra[opValue];
-                int64_t groupEndIdx   = fp->fExtra[opValue+1];
-                U_ASSERT(groupStartIdx <= groupEndIdx);
-                if (groupStartIdx < 0) {
-                    // This capture group has not participated in the match thus far,
-                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);   // FAIL, no match.
-                    break;
-                }
-                CaseFoldingUCharIterator captureGroupItr(inputBuf, groupStartIdx, groupEndIdx);
-                CaseFoldingUCharIterator inputItr(inputBuf, fp->fInputIdx, fActiveLimit);
-
-                //   Note: if the capture group match was of an empty string the backref
-                //         match succeeds.  Verified by testing:  Perl matches succeed
-                //         in this case, so we do too.
-
-                UBool success = TRUE;
-                for (;;) {
-                    UChar32 captureGroupChar = captureGroupItr.next();
-                    if (captureGroupChar == U_SENTINEL) {
-                        success = TRUE;
-                        break;
-                    }
-                    UChar32 inputChar = inputItr.next();
-                    if (inputChar == U_SENTINEL) {
-                        success = FALSE;
-                        fHitEnd = TRUE;
-                        break;
-                    }
-                    if (inputChar != captureGroupChar) {
-                        success = FALSE;
-                        break;
-                    }
-                }
-
-                if (success && inputItr.inExpansion()) {
-                    // We otained a match by consuming part of a string obtained from
-                    // case-folding a single code point of the input text.
-                    // This does not count as an overall match.
-                    success = FALSE;
-                }
-
-                if (success) {
-                    fp->fInputIdx = inputItr.getIndex();
-                } else {
-                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
-                }
-            }
-            break;
-
-        case URX_STO_INP_LOC:
-            {
-                U_ASSERT(opValue >= 0 && opValue < fFrameSize);
-                fp->fExtra[opValue] = fp->fInputIdx;
-            }
-            break;
-
-        case URX_JMPX:
-            {
-                int32_t instrOperandLoc = (int32_t)fp->fPatIdx;
-                fp->fPatIdx += 1;
-                int32_t dataLoc  = URX_VAL(pat[instrOperandLoc]);
-                U_ASSERT(dataLoc >= 0 && dataLoc < fFrameSize);
-                int32_t savedInputIdx = (int32_t)fp->fExtra[dataLoc];
-                U_ASSERT(savedInputIdx <= fp->fInputIdx);
-                if (savedInputIdx < fp->fInputIdx) {
-                    fp->fPatIdx = opValue;                               // JMP
-                } else {
-                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);   // FAIL, no progress in loop.
-                }
-            }
-            break;
-
-        case URX_LA_START:
-            {
-                // Entering a lookahead block.
-                // Save Stack Ptr, Input Pos.
-                U_ASSERT(opValue>=0 && opValue+1<fPattern->fDataSize);
-                fData[opValue]   = fStack->size();
-                fData[opValue+1] = fp->fInputIdx;
-                fActiveStart     = fLookStart;          // Set the match region change for
-                fActiveLimit     = fLookLimit;          //   transparent bounds.
-            }
-            break;
-
-        case URX_LA_END:
-            {
-                // Leaving a look-ahead block.
-                //  restore Stack Ptr, Input Pos to positions they had on entry to block.
-                U_ASSERT(opValue>=0 && opValue+1<fPattern->fDataSize);
-                int32_t stackSize = fStack->size();
-                int32_t newStackSize = (int32_t)fData[opValue];
-                U_ASSERT(stackSize >= newStackSize);
-                if (stackSize > newStackSize) {
-                    // Copy the current top frame back to the new (cut back) top frame.
-                    //   This makes the capture groups from within the look-ahead
-                    //   expression available.
-                    int64_t *newFP = fStack->getBuffer() + newStackSize - fFrameSize;
-                    int32_t j;
-                    for (j=0; j<fFrameSize; j++) {
-                        newFP[j] = ((int64_t *)fp)[j];
-                    }
-                    fp = (REStackFrame *)newFP;
-                    fStack->setSize(newStackSize);
-                }
-                fp->fInputIdx = fData[opValue+1];
-
-                // Restore the active region bounds in the input string; they may have
-                //    been changed because of transparent bounds on a Region.
-                fActiveStart = fRegionStart;
-                fActiveLimit = fRegionLimit;
-            }
-            break;
-
-        case URX_ONECHAR_I:
-            if (fp->fInputIdx < fActiveLimit) {
-                UChar32 c;
-                U16_NEXT(inputBuf, fp->fInputIdx, fActiveLimit, c);
-                if (u_foldCase(c, U_FOLD_CASE_DEFAULT) == opValue) {
-                    break;
-                }
-            } else {
-                fHitEnd = TRUE;
-            }
-            fp = (REStackFrame *)fStack->popFrame(fFrameSize);
-            break;
-
-        case URX_STRING_I:
-            // Case-insensitive test input against a literal string.
-            // Strings require two slots in the compiled pattern, one for the
-            //   offset to the string text, and one for the length.
-            //   The compiled string has already been case folded.
-            {
-                const UChar *patternString = litText + opValue;
-
-                op      = (int32_t)pat[fp->fPatIdx];
-                fp->fPatIdx++;
-                opType  = URX_TYPE(op);
-                opValue = URX_VAL(op);
-                U_ASSERT(opType == URX_STRING_LEN);
-                int32_t patternStringLen = opValue;  // Length of the string from the pattern.
-
-                UChar32      cText;
-                UChar32      cPattern;
-                UBool        success = TRUE;
-                int32_t      patternStringIdx  = 0;
-                CaseFoldingUCharIterator inputIterator(inputBuf, fp->fInputIdx, fActiveLimit);
-                while (patternStringIdx < patternStringLen) {
-                    U16_NEXT(patternString, patternStringIdx, patternStringLen, cPattern);
-                    cText = inputIterator.next();
-                    if (cText != cPattern) {
-                        success = FALSE;
-                        if (cText == U_SENTINEL) {
-                            fHitEnd = TRUE;
-                        }
-                        break;
-                    }
-                }
-                if (inputIterator.inExpansion()) {
-                    success = FALSE;
-                }
-
-                if (success) {
-                    fp->fInputIdx = inputIterator.getIndex();
-                } else {
-                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
-                }
-            }
-            break;
-
-        case URX_LB_START:
-            {
-                // Entering a look-behind block.
-                // Save Stack Ptr, Input Pos.
-                //   TODO:  implement transparent bounds.  Ticket #6067
-                U_ASSERT(opValue>=0 && opValue+1<fPattern->fDataSize);
-                fData[opValue]   = fStack->size();
-                fData[opValue+1] = fp->fInputIdx;
-                // Init the variable containing the start index for attempted matches.
-                fData[opValue+2] = -1;
-                // Save input string length, then reset to pin any matches to end at
-                //   the current position.
-                fData[opValue+3] = fActiveLimit;
-                fActiveLimit     = fp->fInputIdx;
-            }
-            break;
-
-
-        case URX_LB_CONT:
-            {
-                // Positive Look-Behind, at top of loop checking for matches of LB expression
-                //    at all possible input starting positions.
-
-                // Fetch the min and max possible match lengths.  They are the operands
-                //   of this op in the pattern.
-                int32_t minML = (int32_t)pat[fp->fPatIdx++];
-                int32_t maxML = (int32_t)pat[fp->fPatIdx++];
-                U_ASSERT(minML <= maxML);
-                U_ASSERT(minML >= 0);
-
-                // Fetch (from data) the last input index where a match was attempted.
-                U_ASSERT(opValue>=0 && opValue+1<fPattern->fDataSize);
-                int64_t  &lbStartIdx = fData[opValue+2];
-                if (lbStartIdx < 0) {
-                    // First time through loop.
-                    lbStartIdx = fp->fInputIdx - minML;
-                    if (lbStartIdx > 0 && lbStartIdx < fInputLength) {
-                        U16_SET_CP_START(inputBuf, 0, lbStartIdx);
-                    }
-                } else {
-                    // 2nd through nth time through the loop.
-                    // Back up start position for match by one.
-                    if (lbStartIdx == 0) {
-                        lbStartIdx--;
-                    } else {
-                        U16_BACK_1(inputBuf, 0, lbStartIdx);
-                    }
-                }
-
-                if (lbStartIdx < 0 || lbStartIdx < fp->fInputIdx - maxML) {
-                    // We have tried all potential match starting points without
-                    //  getting a match.  Backtrack out, and out of the
-                    //   Look Behind altogether.
-                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
-                    int64_t restoreInputLen = fData[opValue+3];
-                    U_ASSERT(restoreInputLen >= fActiveLimit);
-                    U_ASSERT(restoreInputLen <= fInputLength);
-                    fActiveLimit = restoreInputLen;
-                    break;
-                }
-
-                //    Save state to this URX_LB_CONT op, so failure to match will repeat the loop.
-                //      (successful match will fall off the end of the loop.)
-                fp = StateSave(fp, fp->fPatIdx-3, status);
-                fp->fInputIdx =  lbStartIdx;
-            }
-            break;
-
-        case URX_LB_END:
-            // End of a look-behind block, after a successful match.
-            {
-                U_ASSERT(opValue>=0 && opValue+1<fPattern->fDataSize);
-                if (fp->fInputIdx != fActiveLimit) {
-                    //  The look-behind expression matched, but the match did not
-                    //    extend all the way to the point that we are looking behind from.
-                    //  FAIL out of here, which will take us back to the LB_CONT, which
-                    //     will retry the match starting at another position or fail
-                    //     the look-behind altogether, whichever is appropriate.
-                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
-                    break;
-                }
-
-                // Look-behind match is good.  Restore the orignal input string length,
-                //   which had been truncated to pin the end of the lookbehind match to the
-                //   position being looked-behind.
-                int64_t originalInputLen = fData[opValue+3];
-                U_ASSERT(originalInputLen >= fActiveLimit);
-                U_ASSERT(originalInputLen <= fInputLength);
-                fActiveLimit = originalInputLen;
-            }
-            break;
-
-
-        case URX_LBN_CONT:
-            {
-                // Negative Look-Behind, at top of loop checking for matches of LB expression
-                //    at all possible input starting positions.
-
-                // Fetch the extra parameters of this op.
-                int32_t minML       = (int32_t)pat[fp->fPatIdx++];
-                int32_t maxML       = (int32_t)pat[fp->fPatIdx++];
-                int32_t continueLoc = (int32_t)pat[fp->fPatIdx++];
-                continueLoc = URX_VAL(continueLoc);
-                U_ASSERT(minML <= maxML);
-                U_ASSERT(minML >= 0);
-                U_ASSERT(continueLoc > fp->fPatIdx);
-
-                // Fetch (from data) the last input index where a match was attempted.
-                U_ASSERT(opValue>=0 && opValue+1<fPattern->fDataSize);
-                int64_t  &lbStartIdx = fData[opValue+2];
-                if (lbStartIdx < 0) {
-                    // First time through loop.
-                    lbStartIdx = fp->fInputIdx - minML;
-                    if (lbStartIdx > 0 && lbStartIdx < fInputLength) {
-                        U16_SET_CP_START(inputBuf, 0, lbStartIdx);
-                    }
-                } else {
-                    // 2nd through nth time through the loop.
-                    // Back up start position for match by one.
-                    if (lbStartIdx == 0) {
-                        lbStartIdx--;   // Because U16_BACK is unsafe starting at 0.
-                    } else {
-                        U16_BACK_1(inputBuf, 0, lbStartIdx);
-                    }
-                }
-
-                if (lbStartIdx < 0 || lbStartIdx < fp->fInputIdx - maxML) {
-                    // We have tried all potential match starting points without
-                    //  getting a match, which means that the negative lookbehind as
-                    //  a whole has succeeded.  Jump forward to the continue location
-                    int64_t restoreInputLen = fData[opValue+3];
-                    U_ASSERT(restoreInputLen >= fActiveLimit);
-                    U_ASSERT(restoreInputLen <= fInputLength);
-                    fActiveLimit = restoreInputLen;
-                    fp->fPatIdx = continueLoc;
-                    break;
-                }
-
-                //    Save state to this URX_LB_CONT op, so failure to match will repeat the loop.
-                //      (successful match will cause a FAIL out of the loop altogether.)
-                fp = StateSave(fp, fp->fPatIdx-4, status);
-                fp->fInputIdx =  lbStartIdx;
-            }
-            break;
-
-        case URX_LBN_END:
-            // End of a negative look-behind block, after a successful match.
-            {
-                U_ASSERT(opValue>=0 && opValue+1<fPattern->fDataSize);
-                if (fp->fInputIdx != fActiveLimit) {
-                    //  The look-behind expression matched, but the match did not
-                    //    extend all the way to the point that we are looking behind from.
-                    //  FAIL out of here, which will take us back to the LB_CONT, which
-                    //     will retry the match starting at another position or succeed
-                    //     the look-behind altogether, whichever is appropriate.
-                    fp = (REStackFrame *)fStack->popFrame(fFrameSize);
-                    break;
-                }
-
-                // Look-behind expression matched, which means look-behind test as
-                //   a whole Fails
-
-                //   Restore the orignal input string length, which had been truncated
-                //   inorder to pin the end of the lookbehind match
-                //   to the position being looked-behind.
-                int64_t originalInputLen = fData[opValue+3];
-                U_ASSERT(originalInputLen >= fActiveLimit);
-                U_ASSERT(originalInputLen <= fInputLength);
-                fActiveLimit = originalInputLen;
-
-                // Restore original stack position, discarding any state saved
-                //   by the successful pattern match.
-                U_ASSERT(opValue>=0 && opValue+1<fPattern->fDataSize);
-                int32_t newStackSize = (int32_t)fData[opValue];
-                U_ASSERT(fStack->size() > newStackSize);
-                fStack->setSize(newStackSize);
-
-                //  FAIL, which will take control back to someplace
-                //  prior to entering the look-behind test.
-                fp = (REStackFrame *)fStack->popFrame(fFrameSize);
-            }
-            break;
-
-
-        case URX_LOOP_SR_I:
-            // Loop Initialization for the optimized implementation of
-            //     [some character set]*
-            //   This op scans through all matching input.
-            //   The following LOOP_C op emulates stack unwinding if the following pattern fails.
-            {
-                U_ASSERT(opValue > 0 && opValue < fSets->size());
-                Regex8BitSet *s8 = &fPattern->fSets8[opValue];
-                UnicodeSet   *s  = (UnicodeSet *)fSets->elementAt(opValue);
-
-                // Loop through input, until either the input is exhausted or
-                //   we reach a character that is not a member of the set.
-                int32_t ix = (int32_t)fp->fInputIdx;
-                for (;;) {
-                    if (ix >= fActiveLimit) {
-                        fHitEnd = TRUE;
-                        break;
-                    }
-                    UChar32   c;
-                    U16_NEXT(inputBuf, ix, fActiveLimit, c);
-                    if (c<256) {
-                        if (s8->contains(c) == FALSE) {
-                            U16_BACK_1(inputBuf, 0, ix);
-                            break;
-                        }
-                    } else {
-                        if (s->contains(c) == FALSE) {
-                            U16_BACK_1(inputBuf, 0, ix);
-                            break;
-                        }
-                    }
-                }
-
-                // If there were no matching characters, skip over the loop altogether.
-                //   The loop doesn't run at all, a * op always succeeds.
-                if (ix == fp->fInputIdx) {
-                    fp->fPatIdx++;   // skip the URX_LOOP_C op.
-                    break;
-                }
-
-                // Peek ahead in the compiled pattern, to the URX_LOOP_C that
-                //   must follow.  It's operand is the stack location
-                //   that holds the starting input index for the match of this [set]*
-                int32_t loopcOp = (int32_t)pat[fp->fPatIdx];
-                U_ASSERT(URX_TYPE(loopcOp) == URX_LOOP_C);
-                int32_t stackLoc = URX_VAL(loopcOp);
-                U_ASSERT(stackLoc >= 0 && stackLoc < fFrameSize);
-                fp->fExtra[stackLoc] = fp->fInputIdx;
-                fp->fInputIdx = ix;
-
-                // Save State to the URX_LOOP_C op that follows this one,
-                //   so that match failures in the following code will return to there.
-                //   Then bump the pattern idx so the LOOP_C is skipped on the way out of here.
-                fp = StateSave(fp, fp->fPatIdx, status);
-                fp->fPatIdx++;
-            }
-            break;
-
-
-        case URX_LOOP_DOT_I:
-            // Loop Initialization for the optimized implementation of .*
-            //   This op scans through all remaining input.
-            //   The following LOOP_C op emulates stack unwinding if the following pattern fails.
-            {
-                // Loop through input until the input is exhausted (we reach an end-of-line)
-                // In DOTALL mode, we can just go straight to the end of the input.
-                int32_t ix;
-                if ((opValue & 1) == 1) {
-                    // Dot-matches-All mode.  Jump straight to the end of the string.
-                    ix = (int32_t)fActiveLimit;
-                    fHitEnd = TRUE;
-                } else {
-                    // NOT DOT ALL mode.  Line endings do not match '.'
-                    // Scan forward until a line ending or end of input.
-                    ix = (int32_t)fp->fInputIdx;
-                    for (;;) {
-                        if (ix >= fActiveLimit) {
-                            fHitEnd = TRUE;
-                            break;
-                        }
-                        UChar32   c;
-                        U16_NEXT(inputBuf, ix, fActiveLimit, c);   // c = inputBuf[ix++]
-                        if ((c & 0x7f) <= 0x29) {          // Fast filter of non-new-line-s
-                            if ((c == 0x0a) ||             //  0x0a is newline in both modes.
-                                (((opValue & 2) == 0) &&    // IF not UNIX_LINES mode
-                                   isLineTerminator(c))) {
-                                //  char is a line ending.  Put the input pos back to the
-                                //    line ending char, and exit the scanning loop.
-                                U16_BACK_1(inputBuf, 0, ix);
-                                break;
-                            }
-                        }
-                    }
-                }
-
-                // If there were no matching characters, skip over the loop altogether.
-                //   The loop doesn't run at all, a * op always succeeds.
-                if (ix == fp->fInputIdx) {
-                    fp->fPatIdx++;   // skip the URX_LOOP_C op.
-                    break;
-                }
-
-                // Peek ahead in the compiled pattern, to the URX_LOOP_C that
-                //   must follow.  It's operand is the stack location
-                //   that holds the starting input index for the match of this .*
-                int32_t loopcOp = (int32_t)pat[fp->fPatIdx];
-                U_ASSERT(URX_TYPE(loopcOp) == URX_LOOP_C);
-                int32_t stackLoc = URX_VAL(loopcOp);
-                U_ASSERT(stackLoc >= 0 && stackLoc < fFrameSize);
-                fp->fExtra[stackLoc] = fp->fInputIdx;
-                fp->fInputIdx = ix;
-
-                // Save State to the URX_LOOP_C op that follows this one,
-                //   so that match failures in the following code will return to there.
-                //   Then bump the pattern idx so the LOOP_C is skipped on the way out of here.
-                fp = StateSave(fp, fp->fPatIdx, status);
-                fp->fPatIdx++;
-            }
-            break;
-
-
-        case URX_LOOP_C:
-            {
-                U_ASSERT(opValue>=0 && opValue<fFrameSize);
-                backSearchIndex = (int32_t)fp->fExtra[opValue];
-                U_ASSERT(backSearchIndex <= fp->fInputIdx);
-                if (backSearchIndex == fp->fInputIdx) {
-                    // We've backed up the input idx to the point that the loop started.
-                    // The loop is done.  Leave here without saving state.
-                    //  Subsequent failures won't come back here.
-                    break;
-                }
-                // Set up for the next iteration of the loop, with input index
-                //   backed up by one from the last time through,
-                //   and a state save to this instruction in case the following code fails again.
-                //   (We're going backwards because this loop emulates stack unwinding, not
-                //    the initial scan forward.)
-                U_ASSERT(fp->fInputIdx > 0);
-                UChar32 prevC;
-                U16_PREV(inputBuf, 0, fp->fInputIdx, prevC); // !!!: should this 0 be one of f*Limit?
-
-                if (prevC == 0x0a &&
-                    fp->fInputIdx > backSearchIndex &&
-                    inputBuf[fp->fInputIdx-1] == 0x0d) {
-                    int32_t prevOp = (int32_t)pat[fp->fPatIdx-2];
-                    if (URX_TYPE(prevOp) == URX_LOOP_DOT_I) {
-                        // .*, stepping back over CRLF pair.
-                        U16_BACK_1(inputBuf, 0, fp->fInputIdx);
-                    }
-                }
-
-
-                fp = StateSave(fp, fp->fPatIdx-1, status);
-            }
-            break;
-
-
-
-        default:
-            // Trouble.  The compiled pattern contains an entry with an
-            //           unrecognized type tag.
-            UPRV_UNREACHABLE;
-        }
-
-        if (U_FAILURE(status)) {
-            isMatch = FALSE;
-            break;
-        }
-    }
-
-breakFromLoop:
-    fMatch = isMatch;
-    if (isMatch) {
-        fLastMatchEnd = fMatchEnd;
-        fMatchStart   = startIdx;
-        fMatchEnd     = fp->fInputIdx;
-    }
-
-#ifdef REGEX_RUN_DEBUG
-    if (fTraceDebug) {
-        if (isMatch) {
-            printf("Match.  start=%ld   end=%ld\n\n", fMatchStart, fMatchEnd);
-        } else {
-            printf("No match\n\n");
-        }
-    }
-#endif
-
-    fFrame = fp;                // The active stack frame when the engine stopped.
-                                //   Contains the capture group results that we need to
-                                //    access later.
-
-    return;
-}
-
-
 UOBJECT_DEFINE_RTTI_IMPLEMENTATION(RegexMatcher)
 
 U_NAMESPACE_END
@@ -18,17 +18,22 @@
 #include "unicode/uclean.h"
 #include "cmemory.h"
 #include "cstr.h"
+#include "mutex.h"
 #include "uassert.h"
 #include "uhash.h"
 #include "uvector.h"
 #include "uvectr32.h"
 #include "uvectr64.h"
 #include "regexcmp.h"
+#include "regexdfa.h"
 #include "regeximp.h"
 #include "regexst.h"
 
 U_NAMESPACE_BEGIN
 
+// Guards the matcher pools of all RegexPatterns.
+static UMutex gMatcherPoolMutex;
+
 //--------------------------------------------------------------------------
 //
 //    RegexPattern    Default Constructor
@@ -107,6 +112,9 @@ RegexPattern &RegexPattern::operator = (const RegexPattern &other) {
     fInitialChar      = other.fInitialChar;
     *fInitialChars8   = *other.fInitialChars8;
     fNeedsAltInput    = other.fNeedsAltInput;
+    fRequiredStringIdx   = other.fRequiredStringIdx;
+    fRequiredStringLen   = other.fRequiredStringLen;
+    fRequiredStringStart = other.fRequiredStringStart;
 
     //  Copy the pattern.  It's just values, nothing deep to copy.
     fCompiledPat->assign(*other.fCompiledPat, fDeferredStatus);
@@ -152,6 +160,9 @@ RegexPattern &RegexPattern::operator = (const RegexPattern &other) {
             uhash_puti(fNamedCaptureMap, key, val, &fDeferredStatus);
         }
     }
+    if (other.fNFA != NULL) {
+        fNFA = RegexNFA::createInstance(*this, fDeferredStatus);
+    }
     return *this;
 }
 
@@ -182,7 +193,12 @@ void RegexPattern::init() {
     fInitialChar      = 0;
     fInitialChars8    = NULL;
     fNeedsAltInput    = FALSE;
+    fRequiredStringIdx   = 0;
+    fRequiredStringLen   = 0;
+    fRequiredStringStart = INT32_MAX;
     fNamedCaptureMap  = NULL;
+    fNFA              = NULL;
+    fMatcherPoolSize  = 0;
 
     fPattern          = NULL; // will be set later
     fPatternString    = NULL; // may be set later
@@ -248,6 +264,12 @@ void RegexPattern::zap() {
     }
     uhash_close(fNamedCaptureMap);
     fNamedCaptureMap = NULL;
+    delete fNFA;
+    fNFA = NULL;
+    for (i=0; i<fMatcherPoolSize; i++) {
+        delete fMatcherPool[i];
+    }
+    fMatcherPoolSize = 0;
 }
 
 
@@ -556,7 +578,88 @@ UBool U_EXPORT2 RegexPattern::matches(UText                *regex,
 }
 
 
+//---------------------------------------------------------------------
+//
+//   matches        Test for a match of this pattern, with a matcher from
+//                  the pool.
+//
+//---------------------------------------------------------------------
+UBool RegexPattern::matches(const UnicodeString &input, UErrorCode &status) const {
+    RegexMatcher *m = acquireMatcher(status);
+    if (U_FAILURE(status)) {
+        return FALSE;
+    }
+    m->reset(input);
+    UBool retVal = m->matches(status);
+    releaseMatcher(m);
+    return retVal;
+}
+
+
+UBool RegexPattern::matches(UText *input, UErrorCode &status) const {
+    RegexMatcher *m = acquireMatcher(status);
+    if (U_FAILURE(status)) {
+        return FALSE;
+    }
+    m->reset(input);
+    UBool retVal = m->matches(status);
+    releaseMatcher(m);
+    return retVal;
+}
+
+
+//---------------------------------------------------------------------
+//
+//   acquireMatcher     Take an idle matcher from the pool, or make a new one
+//                      if the pool is empty.  The matcher keeps its stack
+//                      and its other storage while it is in the pool.
+//
+//---------------------------------------------------------------------
+RegexMatcher *RegexPattern::acquireMatcher(UErrorCode &status) const {
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    {
+        Mutex lock(&gMatcherPoolMutex);
+        if (fMatcherPoolSize > 0) {
+            return fMatcherPool[--fMatcherPoolSize];
+        }
+    }
+    RegexMatcher *m = matcher(status);
+    if (U_SUCCESS(status) && U_FAILURE(m->fDeferredStatus)) {
+        status = m->fDeferredStatus;
+    }
+    if (U_FAILURE(status)) {
+        delete m;
+        return NULL;
+    }
+    return m;
+}
+
 
+//---------------------------------------------------------------------
+//
+//   releaseMatcher     Return a matcher from acquireMatcher() to the pool,
+//                      or delete it if the pool is full.
+//
+//---------------------------------------------------------------------
+void RegexPattern::releaseMatcher(RegexMatcher *m) const {
+    if (U_FAILURE(m->fDeferredStatus)) {
+        // reset() failed.  Don't keep the error for the next caller.
+        delete m;
+        return;
+    }
+    // Drop the reference to the caller's input, which may not outlive this call.
+    m->reset(RegexStaticSets::gStaticSets->fEmptyText);
+    {
+        Mutex lock(&gMatcherPoolMutex);
+        if (fMatcherPoolSize < UPRV_LENGTHOF(fMatcherPool)) {
+            fMatcherPool[fMatcherPoolSize++] = m;
+            return;
+        }
+    }
+    delete m;
+}
 
 
 //---------------------------------------------------------------------
@@ -833,6 +936,11 @@ void RegexPattern::dumpPattern() const {
                 printf("%#x\n", fInitialChar);
             }
     }
+    if (fRequiredStringLen > 0) {
+        UnicodeString requiredString(fLiteralText, fRequiredStringIdx, fRequiredStringLen);
+        printf("   Required string: \"%s\", starting within %d\n", CStr(requiredString)(),
+               fRequiredStringStart);
+    }
 
     printf("Named Capture Groups:\n");
     if (uhash_count(fNamedCaptureMap) == 0) {
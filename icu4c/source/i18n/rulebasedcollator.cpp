@@ -17,6 +17,7 @@
 
 #if !UCONFIG_NO_COLLATION
 
+#include "unicode/bytestream.h"
 #include "unicode/coll.h"
 #include "unicode/coleitr.h"
 #include "unicode/localpointer.h"
@@ -29,6 +30,7 @@
 #include "unicode/uniset.h"
 #include "unicode/unistr.h"
 #include "unicode/usetiter.h"
+#include "unicode/ustring.h"
 #include "unicode/utf8.h"
 #include "unicode/uversion.h"
 #include "bocsu.h"
@@ -440,49 +442,29 @@ RuleBasedCollator::getAttribute(UColAttribute attr, UErrorCode &errorCode) const
     return ((settings->options & option) == 0) ? UCOL_OFF : UCOL_ON;
 }
 
-void
-RuleBasedCollator::setAttribute(UColAttribute attr, UColAttributeValue value,
-                                UErrorCode &errorCode) {
-    UColAttributeValue oldValue = getAttribute(attr, errorCode);
-    if(U_FAILURE(errorCode)) { return; }
-    if(value == oldValue) {
-        setAttributeExplicitly(attr);
-        return;
-    }
-    const CollationSettings &defaultSettings = getDefaultSettings();
-    if(settings == &defaultSettings) {
-        if(value == UCOL_DEFAULT) {
-            setAttributeDefault(attr);
-            return;
-        }
-    }
-    CollationSettings *ownedSettings = SharedObject::copyOnWrite(settings);
-    if(ownedSettings == NULL) {
-        errorCode = U_MEMORY_ALLOCATION_ERROR;
-        return;
-    }
+namespace {
 
+void
+setSettingsAttribute(CollationSettings &cs, UColAttribute attr, UColAttributeValue value,
+                     int32_t defaultOptions, UErrorCode &errorCode) {
     switch(attr) {
     case UCOL_FRENCH_COLLATION:
-        ownedSettings->setFlag(CollationSettings::BACKWARD_SECONDARY, value,
-                               defaultSettings.options, errorCode);
+        cs.setFlag(CollationSettings::BACKWARD_SECONDARY, value, defaultOptions, errorCode);
         break;
     case UCOL_ALTERNATE_HANDLING:
-        ownedSettings->setAlternateHandling(value, defaultSettings.options, errorCode);
+        cs.setAlternateHandling(value, defaultOptions, errorCode);
         break;
     case UCOL_CASE_FIRST:
-        ownedSettings->setCaseFirst(value, defaultSettings.options, errorCode);
+        cs.setCaseFirst(value, defaultOptions, errorCode);
         break;
     case UCOL_CASE_LEVEL:
-        ownedSettings->setFlag(CollationSettings::CASE_LEVEL, value,
-                               defaultSettings.options, errorCode);
+        cs.setFlag(CollationSettings::CASE_LEVEL, value, defaultOptions, errorCode);
         break;
     case UCOL_NORMALIZATION_MODE:
-        ownedSettings->setFlag(CollationSettings::CHECK_FCD, value,
-                               defaultSettings.options, errorCode);
+        cs.setFlag(CollationSettings::CHECK_FCD, value, defaultOptions, errorCode);
         break;
     case UCOL_STRENGTH:
-        ownedSettings->setStrength(value, defaultSettings.options, errorCode);
+        cs.setStrength(value, defaultOptions, errorCode);
         break;
     case UCOL_HIRAGANA_QUATERNARY_MODE:
         // Deprecated attribute. Check for valid values but do not change anything.
@@ -491,12 +473,39 @@ RuleBasedCollator::setAttribute(UColAttribute attr, UColAttributeValue value,
         }
         break;
     case UCOL_NUMERIC_COLLATION:
-        ownedSettings->setFlag(CollationSettings::NUMERIC, value, defaultSettings.options, errorCode);
+        cs.setFlag(CollationSettings::NUMERIC, value, defaultOptions, errorCode);
         break;
     default:
         errorCode = U_ILLEGAL_ARGUMENT_ERROR;
         break;
     }
+}
+
+}  // namespace
+
+void
+RuleBasedCollator::setAttribute(UColAttribute attr, UColAttributeValue value,
+                                UErrorCode &errorCode) {
+    UColAttributeValue oldValue = getAttribute(attr, errorCode);
+    if(U_FAILURE(errorCode)) { return; }
+    if(value == oldValue) {
+        setAttributeExplicitly(attr);
+        return;
+    }
+    const CollationSettings &defaultSettings = getDefaultSettings();
+    if(settings == &defaultSettings) {
+        if(value == UCOL_DEFAULT) {
+            setAttributeDefault(attr);
+            return;
+        }
+    }
+    CollationSettings *ownedSettings = SharedObject::copyOnWrite(settings);
+    if(ownedSettings == NULL) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+
+    setSettingsAttribute(*ownedSettings, attr, value, defaultSettings.options, errorCode);
     if(U_FAILURE(errorCode)) { return; }
     setFastLatinOptions(*ownedSettings);
     if(value == UCOL_DEFAULT) {
@@ -506,6 +515,21 @@ RuleBasedCollator::setAttribute(UColAttribute attr, UColAttributeValue value,
     }
 }
 
+void
+RuleBasedCollator::internalInitViewSettings(CollationSettings &cs) const {
+    cs.aliasFrom(*settings);
+}
+
+void
+RuleBasedCollator::internalSetViewAttribute(CollationSettings &cs,
+                                            UColAttribute attr, UColAttributeValue value,
+                                            UErrorCode &errorCode) const {
+    if(U_FAILURE(errorCode)) { return; }
+    setSettingsAttribute(cs, attr, value, getDefaultSettings().options, errorCode);
+    if(U_FAILURE(errorCode)) { return; }
+    setFastLatinOptions(cs);
+}
+
 Collator &
 RuleBasedCollator::setMaxVariable(UColReorderCode group, UErrorCode &errorCode) {
     if(U_FAILURE(errorCode)) { return *this; }
@@ -700,7 +724,7 @@ UCollationResult
 RuleBasedCollator::compare(const UnicodeString &left, const UnicodeString &right,
                            UErrorCode &errorCode) const {
     if(U_FAILURE(errorCode)) { return UCOL_EQUAL; }
-    return doCompare(left.getBuffer(), left.length(),
+    return doCompare(*settings, left.getBuffer(), left.length(),
                      right.getBuffer(), right.length(), errorCode);
 }
 
@@ -716,7 +740,7 @@ RuleBasedCollator::compare(const UnicodeString &left, const UnicodeString &right
     int32_t rightLength = right.length();
     if(leftLength > length) { leftLength = length; }
     if(rightLength > length) { rightLength = length; }
-    return doCompare(left.getBuffer(), leftLength,
+    return doCompare(*settings, left.getBuffer(), leftLength,
                      right.getBuffer(), rightLength, errorCode);
 }
 
@@ -724,6 +748,14 @@ UCollationResult
 RuleBasedCollator::compare(const UChar *left, int32_t leftLength,
                            const UChar *right, int32_t rightLength,
                            UErrorCode &errorCode) const {
+    return internalCompare(*settings, left, leftLength, right, rightLength, errorCode);
+}
+
+UCollationResult
+RuleBasedCollator::internalCompare(const CollationSettings &cs,
+                                   const UChar *left, int32_t leftLength,
+                                   const UChar *right, int32_t rightLength,
+                                   UErrorCode &errorCode) const {
     if(U_FAILURE(errorCode)) { return UCOL_EQUAL; }
     if((left == NULL && leftLength != 0) || (right == NULL && rightLength != 0)) {
         errorCode = U_ILLEGAL_ARGUMENT_ERROR;
@@ -736,7 +768,7 @@ RuleBasedCollator::compare(const UChar *left, int32_t leftLength,
     } else {
         if(rightLength >= 0) { leftLength = u_strlen(left); }
     }
-    return doCompare(left, leftLength, right, rightLength, errorCode);
+    return doCompare(cs, left, leftLength, right, rightLength, errorCode);
 }
 
 UCollationResult
@@ -749,13 +781,21 @@ RuleBasedCollator::compareUTF8(const StringPiece &left, const StringPiece &right
         errorCode = U_ILLEGAL_ARGUMENT_ERROR;
         return UCOL_EQUAL;
     }
-    return doCompare(leftBytes, left.length(), rightBytes, right.length(), errorCode);
+    return doCompare(*settings, leftBytes, left.length(), rightBytes, right.length(), errorCode);
 }
 
 UCollationResult
 RuleBasedCollator::internalCompareUTF8(const char *left, int32_t leftLength,
                                        const char *right, int32_t rightLength,
                                        UErrorCode &errorCode) const {
+    return internalCompareUTF8(*settings, left, leftLength, right, rightLength, errorCode);
+}
+
+UCollationResult
+RuleBasedCollator::internalCompareUTF8(const CollationSettings &cs,
+                                       const char *left, int32_t leftLength,
+                                       const char *right, int32_t rightLength,
+                                       UErrorCode &errorCode) const {
     if(U_FAILURE(errorCode)) { return UCOL_EQUAL; }
     if((left == NULL && leftLength != 0) || (right == NULL && rightLength != 0)) {
         errorCode = U_ILLEGAL_ARGUMENT_ERROR;
@@ -768,7 +808,7 @@ RuleBasedCollator::internalCompareUTF8(const char *left, int32_t leftLength,
     } else {
         if(rightLength >= 0) { leftLength = static_cast<int32_t>(uprv_strlen(left)); }
     }
-    return doCompare(reinterpret_cast<const uint8_t *>(left), leftLength,
+    return doCompare(cs, reinterpret_cast<const uint8_t *>(left), leftLength,
                      reinterpret_cast<const uint8_t *>(right), rightLength, errorCode);
 }
 
@@ -849,32 +889,17 @@ class UTF16NFDIterator : public NFDIterator {
     const UChar *limit;
 };
 
-class FCDUTF16NFDIterator : public UTF16NFDIterator {
+class FCDUTF16NFDIterator : public NFDIterator {
 public:
-    FCDUTF16NFDIterator(const Normalizer2Impl &nfcImpl, const UChar *text, const UChar *textLimit)
-            : UTF16NFDIterator(NULL, NULL) {
+    FCDUTF16NFDIterator(const CollationData *data, const UChar *text, const UChar *textLimit)
+            : u16ci(data, FALSE, text, text, textLimit) {}
+protected:
+    virtual UChar32 nextRawCodePoint() {
         UErrorCode errorCode = U_ZERO_ERROR;
-        const UChar *spanLimit = nfcImpl.makeFCD(text, textLimit, NULL, errorCode);
-        if(U_FAILURE(errorCode)) { return; }
-        if(spanLimit == textLimit || (textLimit == NULL && *spanLimit == 0)) {
-            s = text;
-            limit = spanLimit;
-        } else {
-            str.setTo(text, (int32_t)(spanLimit - text));
-            {
-                ReorderingBuffer r_buffer(nfcImpl, str);
-                if(r_buffer.init(str.length(), errorCode)) {
-                    nfcImpl.makeFCD(spanLimit, textLimit, &r_buffer, errorCode);
-                }
-            }
-            if(U_SUCCESS(errorCode)) {
-                s = str.getBuffer();
-                limit = s + str.length();
-            }
-        }
+        return u16ci.nextCodePoint(errorCode);
     }
 private:
-    UnicodeString str;
+    FCDUTF16CollationIterator u16ci;
 };
 
 class UTF8NFDIterator : public NFDIterator {
@@ -965,7 +990,8 @@ UCollationResult compareNFDIter(const Normalizer2Impl &nfcImpl,
 }  // namespace
 
 UCollationResult
-RuleBasedCollator::doCompare(const UChar *left, int32_t leftLength,
+RuleBasedCollator::doCompare(const CollationSettings &cs,
+                             const UChar *left, int32_t leftLength,
                              const UChar *right, int32_t rightLength,
                              UErrorCode &errorCode) const {
     // U_FAILURE(errorCode) checked by caller.
@@ -1000,7 +1026,7 @@ RuleBasedCollator::doCompare(const UChar *left, int32_t leftLength,
         }
     }
 
-    UBool numeric = settings->isNumeric();
+    UBool numeric = cs.isNumeric();
     if(equalPrefixLength > 0) {
         if((equalPrefixLength != leftLength &&
                     data->isUnsafeBackward(left[equalPrefixLength], numeric)) ||
@@ -1020,7 +1046,7 @@ RuleBasedCollator::doCompare(const UChar *left, int32_t leftLength,
     }
 
     int32_t result;
-    int32_t fastLatinOptions = settings->fastLatinOptions;
+    int32_t fastLatinOptions = cs.fastLatinOptions;
     if(fastLatinOptions >= 0 &&
             (equalPrefixLength == leftLength ||
                 left[equalPrefixLength] <= CollationFastLatin::LATIN_MAX) &&
@@ -1028,7 +1054,7 @@ RuleBasedCollator::doCompare(const UChar *left, int32_t leftLength,
                 right[equalPrefixLength] <= CollationFastLatin::LATIN_MAX)) {
         if(leftLength >= 0) {
             result = CollationFastLatin::compareUTF16(data->fastLatinTable,
-                                                      settings->fastLatinPrimaries,
+                                                      cs.fastLatinPrimaries,
                                                       fastLatinOptions,
                                                       left + equalPrefixLength,
                                                       leftLength - equalPrefixLength,
@@ -1036,7 +1062,7 @@ RuleBasedCollator::doCompare(const UChar *left, int32_t leftLength,
                                                       rightLength - equalPrefixLength);
         } else {
             result = CollationFastLatin::compareUTF16(data->fastLatinTable,
-                                                      settings->fastLatinPrimaries,
+                                                      cs.fastLatinPrimaries,
                                                       fastLatinOptions,
                                                       left + equalPrefixLength, -1,
                                                       right + equalPrefixLength, -1);
@@ -1046,21 +1072,21 @@ RuleBasedCollator::doCompare(const UChar *left, int32_t leftLength,
     }
 
     if(result == CollationFastLatin::BAIL_OUT_RESULT) {
-        if(settings->dontCheckFCD()) {
+        if(cs.dontCheckFCD()) {
             UTF16CollationIterator leftIter(data, numeric,
                                             left, left + equalPrefixLength, leftLimit);
             UTF16CollationIterator rightIter(data, numeric,
                                             right, right + equalPrefixLength, rightLimit);
-            result = CollationCompare::compareUpToQuaternary(leftIter, rightIter, *settings, errorCode);
+            result = CollationCompare::compareUpToQuaternary(leftIter, rightIter, cs, errorCode);
         } else {
             FCDUTF16CollationIterator leftIter(data, numeric,
                                               left, left + equalPrefixLength, leftLimit);
             FCDUTF16CollationIterator rightIter(data, numeric,
                                                 right, right + equalPrefixLength, rightLimit);
-            result = CollationCompare::compareUpToQuaternary(leftIter, rightIter, *settings, errorCode);
+            result = CollationCompare::compareUpToQuaternary(leftIter, rightIter, cs, errorCode);
         }
     }
-    if(result != UCOL_EQUAL || settings->getStrength() < UCOL_IDENTICAL || U_FAILURE(errorCode)) {
+    if(result != UCOL_EQUAL || cs.getStrength() < UCOL_IDENTICAL || U_FAILURE(errorCode)) {
         return (UCollationResult)result;
     }
 
@@ -1072,19 +1098,20 @@ RuleBasedCollator::doCompare(const UChar *left, int32_t leftLength,
     const Normalizer2Impl &nfcImpl = data->nfcImpl;
     left += equalPrefixLength;
     right += equalPrefixLength;
-    if(settings->dontCheckFCD()) {
+    if(cs.dontCheckFCD()) {
         UTF16NFDIterator leftIter(left, leftLimit);
         UTF16NFDIterator rightIter(right, rightLimit);
         return compareNFDIter(nfcImpl, leftIter, rightIter);
     } else {
-        FCDUTF16NFDIterator leftIter(nfcImpl, left, leftLimit);
-        FCDUTF16NFDIterator rightIter(nfcImpl, right, rightLimit);
+        FCDUTF16NFDIterator leftIter(data, left, leftLimit);
+        FCDUTF16NFDIterator rightIter(data, right, rightLimit);
         return compareNFDIter(nfcImpl, leftIter, rightIter);
     }
 }
 
 UCollationResult
-RuleBasedCollator::doCompare(const uint8_t *left, int32_t leftLength,
+RuleBasedCollator::doCompare(const CollationSettings &cs,
+                             const uint8_t *left, int32_t leftLength,
                              const uint8_t *right, int32_t rightLength,
                              UErrorCode &errorCode) const {
     // U_FAILURE(errorCode) checked by caller.
@@ -1119,7 +1146,7 @@ RuleBasedCollator::doCompare(const uint8_t *left, int32_t leftLength,
         while(--equalPrefixLength > 0 && U8_IS_TRAIL(left[equalPrefixLength])) {}
     }
 
-    UBool numeric = settings->isNumeric();
+    UBool numeric = cs.isNumeric();
     if(equalPrefixLength > 0) {
         UBool unsafe = FALSE;
         if(equalPrefixLength != leftLength) {
@@ -1149,7 +1176,7 @@ RuleBasedCollator::doCompare(const uint8_t *left, int32_t leftLength,
     }
 
     int32_t result;
-    int32_t fastLatinOptions = settings->fastLatinOptions;
+    int32_t fastLatinOptions = cs.fastLatinOptions;
     if(fastLatinOptions >= 0 &&
             (equalPrefixLength == leftLength ||
                 left[equalPrefixLength] <= CollationFastLatin::LATIN_MAX_UTF8_LEAD) &&
@@ -1157,7 +1184,7 @@ RuleBasedCollator::doCompare(const uint8_t *left, int32_t leftLength,
                 right[equalPrefixLength] <= CollationFastLatin::LATIN_MAX_UTF8_LEAD)) {
         if(leftLength >= 0) {
             result = CollationFastLatin::compareUTF8(data->fastLatinTable,
-                                                     settings->fastLatinPrimaries,
+                                                     cs.fastLatinPrimaries,
                                                      fastLatinOptions,
                                                      left + equalPrefixLength,
                                                      leftLength - equalPrefixLength,
@@ -1165,7 +1192,7 @@ RuleBasedCollator::doCompare(const uint8_t *left, int32_t leftLength,
                                                      rightLength - equalPrefixLength);
         } else {
             result = CollationFastLatin::compareUTF8(data->fastLatinTable,
-                                                     settings->fastLatinPrimaries,
+                                                     cs.fastLatinPrimaries,
                                                      fastLatinOptions,
                                                      left + equalPrefixLength, -1,
                                                      right + equalPrefixLength, -1);
@@ -1175,17 +1202,17 @@ RuleBasedCollator::doCompare(const uint8_t *left, int32_t leftLength,
     }
 
     if(result == CollationFastLatin::BAIL_OUT_RESULT) {
-        if(settings->dontCheckFCD()) {
+        if(cs.dontCheckFCD()) {
             UTF8CollationIterator leftIter(data, numeric, left, equalPrefixLength, leftLength);
             UTF8CollationIterator rightIter(data, numeric, right, equalPrefixLength, rightLength);
-            result = CollationCompare::compareUpToQuaternary(leftIter, rightIter, *settings, errorCode);
+            result = CollationCompare::compareUpToQuaternary(leftIter, rightIter, cs, errorCode);
         } else {
             FCDUTF8CollationIterator leftIter(data, numeric, left, equalPrefixLength, leftLength);
             FCDUTF8CollationIterator rightIter(data, numeric, right, equalPrefixLength, rightLength);
-            result = CollationCompare::compareUpToQuaternary(leftIter, rightIter, *settings, errorCode);
+            result = CollationCompare::compareUpToQuaternary(leftIter, rightIter, cs, errorCode);
         }
     }
-    if(result != UCOL_EQUAL || settings->getStrength() < UCOL_IDENTICAL || U_FAILURE(errorCode)) {
+    if(result != UCOL_EQUAL || cs.getStrength() < UCOL_IDENTICAL || U_FAILURE(errorCode)) {
         return (UCollationResult)result;
     }
 
@@ -1201,7 +1228,7 @@ RuleBasedCollator::doCompare(const uint8_t *left, int32_t leftLength,
         leftLength -= equalPrefixLength;
         rightLength -= equalPrefixLength;
     }
-    if(settings->dontCheckFCD()) {
+    if(cs.dontCheckFCD()) {
         UTF8NFDIterator leftIter(left, leftLength);
         UTF8NFDIterator rightIter(right, rightLength);
         return compareNFDIter(nfcImpl, leftIter, rightIter);
@@ -1293,7 +1320,7 @@ RuleBasedCollator::getCollationKey(const UChar *s, int32_t length, CollationKey&
     }
     key.reset();  // resets the "bogus" state
     CollationKeyByteSink sink(key);
-    writeSortKey(s, length, sink, errorCode);
+    writeSortKey(*settings, s, length, sink, errorCode);
     if(U_FAILURE(errorCode)) {
         key.setToBogus();
     } else if(key.isBogus()) {
@@ -1313,7 +1340,18 @@ RuleBasedCollator::getSortKey(const UnicodeString &s,
 int32_t
 RuleBasedCollator::getSortKey(const UChar *s, int32_t length,
                               uint8_t *dest, int32_t capacity) const {
+    UErrorCode errorCode = U_ZERO_ERROR;
+    return internalGetSortKey(*settings, s, length, dest, capacity, errorCode);
+}
+
+int32_t
+RuleBasedCollator::internalGetSortKey(const CollationSettings &cs,
+                                      const UChar *s, int32_t length,
+                                      uint8_t *dest, int32_t capacity,
+                                      UErrorCode &errorCode) const {
+    if(U_FAILURE(errorCode)) { return 0; }
     if((s == NULL && length != 0) || capacity < 0 || (dest == NULL && capacity > 0)) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
         return 0;
     }
     uint8_t noDest[1] = { 0 };
@@ -1323,36 +1361,160 @@ RuleBasedCollator::getSortKey(const UChar *s, int32_t length,
         capacity = 0;
     }
     FixedSortKeyByteSink sink(reinterpret_cast<char *>(dest), capacity);
-    UErrorCode errorCode = U_ZERO_ERROR;
-    writeSortKey(s, length, sink, errorCode);
+    writeSortKey(cs, s, length, sink, errorCode);
     return U_SUCCESS(errorCode) ? sink.NumberOfBytesAppended() : 0;
 }
 
 void
-RuleBasedCollator::writeSortKey(const UChar *s, int32_t length,
+RuleBasedCollator::writeSortKey(const CollationSettings &cs, const UChar *s, int32_t length,
                                 SortKeyByteSink &sink, UErrorCode &errorCode) const {
     if(U_FAILURE(errorCode)) { return; }
     const UChar *limit = (length >= 0) ? s + length : NULL;
-    UBool numeric = settings->isNumeric();
+    UBool numeric = cs.isNumeric();
     CollationKeys::LevelCallback callback;
-    if(settings->dontCheckFCD()) {
+    if(cs.dontCheckFCD()) {
         UTF16CollationIterator iter(data, numeric, s, s, limit);
-        CollationKeys::writeSortKeyUpToQuaternary(iter, data->compressibleBytes, *settings,
+        CollationKeys::writeSortKeyUpToQuaternary(iter, data->compressibleBytes, cs,
                                                   sink, Collation::PRIMARY_LEVEL,
                                                   callback, TRUE, errorCode);
     } else {
         FCDUTF16CollationIterator iter(data, numeric, s, s, limit);
-        CollationKeys::writeSortKeyUpToQuaternary(iter, data->compressibleBytes, *settings,
+        CollationKeys::writeSortKeyUpToQuaternary(iter, data->compressibleBytes, cs,
                                                   sink, Collation::PRIMARY_LEVEL,
                                                   callback, TRUE, errorCode);
     }
-    if(settings->getStrength() == UCOL_IDENTICAL) {
+    if(cs.getStrength() == UCOL_IDENTICAL) {
         writeIdenticalLevel(s, limit, sink, errorCode);
     }
     static const char terminator = 0;  // TERMINATOR_BYTE
     sink.Append(&terminator, 1);
 }
 
+int32_t
+RuleBasedCollator::internalGetSortKeyUTF8(const char *s, int32_t length,
+                                          uint8_t *dest, int32_t capacity,
+                                          UErrorCode &errorCode) const {
+    if(U_FAILURE(errorCode)) { return 0; }
+    if((s == NULL && length != 0) || capacity < 0 || (dest == NULL && capacity > 0)) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    uint8_t noDest[1] = { 0 };
+    if(dest == NULL) {
+        // Distinguish pure preflighting from an allocation error.
+        dest = noDest;
+        capacity = 0;
+    }
+    FixedSortKeyByteSink sink(reinterpret_cast<char *>(dest), capacity);
+    writeSortKey(*settings, reinterpret_cast<const uint8_t *>(s), length, sink, errorCode);
+    return U_SUCCESS(errorCode) ? sink.NumberOfBytesAppended() : 0;
+}
+
+int32_t
+RuleBasedCollator::internalGetSortKeys(const UChar *const *strings, const int32_t *lengths,
+                                       int32_t count, uint8_t *dest, int32_t capacity,
+                                       int32_t *offsets, UErrorCode &errorCode) const {
+    if(U_FAILURE(errorCode)) { return 0; }
+    if(count < 0 || (strings == NULL && count > 0) || offsets == NULL ||
+            capacity < 0 || (dest == NULL && capacity > 0)) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    uint8_t noDest[1] = { 0 };
+    if(dest == NULL) {
+        dest = noDest;
+        capacity = 0;
+    }
+    // One sink for all keys: Each key starts where the previous one ended,
+    // and the sink keeps counting when the buffer is full.
+    FixedSortKeyByteSink sink(reinterpret_cast<char *>(dest), capacity);
+    for(int32_t i = 0; i < count; ++i) {
+        offsets[i] = sink.NumberOfBytesAppended();
+        int32_t length = (lengths != NULL) ? lengths[i] : -1;
+        if(strings[i] == NULL && length != 0) {
+            errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+            return 0;
+        }
+        writeSortKey(*settings, strings[i], length, sink, errorCode);
+        if(U_FAILURE(errorCode)) { return 0; }
+    }
+    offsets[count] = sink.NumberOfBytesAppended();
+    if(sink.Overflowed()) {
+        errorCode = U_BUFFER_OVERFLOW_ERROR;
+    }
+    return offsets[count];
+}
+
+int32_t
+RuleBasedCollator::internalGetSortKeys(const char *const *strings, const int32_t *lengths,
+                                       int32_t count, uint8_t *dest, int32_t capacity,
+                                       int32_t *offsets, UErrorCode &errorCode) const {
+    if(U_FAILURE(errorCode)) { return 0; }
+    if(count < 0 || (strings == NULL && count > 0) || offsets == NULL ||
+            capacity < 0 || (dest == NULL && capacity > 0)) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    uint8_t noDest[1] = { 0 };
+    if(dest == NULL) {
+        dest = noDest;
+        capacity = 0;
+    }
+    FixedSortKeyByteSink sink(reinterpret_cast<char *>(dest), capacity);
+    for(int32_t i = 0; i < count; ++i) {
+        offsets[i] = sink.NumberOfBytesAppended();
+        int32_t length = (lengths != NULL) ? lengths[i] : -1;
+        if(strings[i] == NULL && length != 0) {
+            errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+            return 0;
+        }
+        writeSortKey(*settings, reinterpret_cast<const uint8_t *>(strings[i]), length, sink, errorCode);
+        if(U_FAILURE(errorCode)) { return 0; }
+    }
+    offsets[count] = sink.NumberOfBytesAppended();
+    if(sink.Overflowed()) {
+        errorCode = U_BUFFER_OVERFLOW_ERROR;
+    }
+    return offsets[count];
+}
+
+void
+RuleBasedCollator::writeSortKey(const CollationSettings &cs, const uint8_t *s, int32_t length,
+                                SortKeyByteSink &sink, UErrorCode &errorCode) const {
+    if(U_FAILURE(errorCode)) { return; }
+    if(cs.getStrength() == UCOL_IDENTICAL) {
+        // The identical level is computed on NFD UTF-16 text.
+        // Convert once and share the UTF-16 code path.
+        if(length < 0) { length = static_cast<int32_t>(uprv_strlen(reinterpret_cast<const char *>(s))); }
+        UnicodeString s16 = UnicodeString::fromUTF8(
+                StringPiece(reinterpret_cast<const char *>(s), length));
+        if(s16.isBogus()) {
+            errorCode = U_MEMORY_ALLOCATION_ERROR;
+            return;
+        }
+        writeSortKey(cs, s16.getBuffer(), s16.length(), sink, errorCode);
+        return;
+    }
+    // Iterate over the UTF-8 text directly rather than converting it to UTF-16 first.
+    // The UTF-8 iterators look up ASCII and two-byte sequences in the data trie
+    // without decoding them to code points.
+    UBool numeric = cs.isNumeric();
+    CollationKeys::LevelCallback callback;
+    if(cs.dontCheckFCD()) {
+        UTF8CollationIterator iter(data, numeric, s, 0, length);
+        CollationKeys::writeSortKeyUpToQuaternary(iter, data->compressibleBytes, cs,
+                                                  sink, Collation::PRIMARY_LEVEL,
+                                                  callback, TRUE, errorCode);
+    } else {
+        FCDUTF8CollationIterator iter(data, numeric, s, 0, length);
+        CollationKeys::writeSortKeyUpToQuaternary(iter, data->compressibleBytes, cs,
+                                                  sink, Collation::PRIMARY_LEVEL,
+                                                  callback, TRUE, errorCode);
+    }
+    static const char terminator = 0;  // TERMINATOR_BYTE
+    sink.Append(&terminator, 1);
+}
+
 void
 RuleBasedCollator::writeIdenticalLevel(const UChar *s, const UChar *limit,
                                        SortKeyByteSink &sink, UErrorCode &errorCode) const {
@@ -1365,18 +1527,40 @@ RuleBasedCollator::writeIdenticalLevel(const UChar *s, const UChar *limit,
         prev = u_writeIdenticalLevelRun(prev, s, (int32_t)(nfdQCYesLimit - s), sink);
     }
     // Is there non-NFD text?
-    int32_t destLengthEstimate;
     if(limit != NULL) {
         if(nfdQCYesLimit == limit) { return; }
-        destLengthEstimate = (int32_t)(limit - nfdQCYesLimit);
     } else {
         // s is NUL-terminated
         if(*nfdQCYesLimit == 0) { return; }
-        destLengthEstimate = -1;
     }
-    UnicodeString nfd;
-    data->nfcImpl.decompose(nfdQCYesLimit, limit, nfd, destLengthEstimate, errorCode);
-    u_writeIdenticalLevelRun(prev, nfd.getBuffer(), nfd.length(), sink);
+    // Decompose the rest piece by piece into a stack buffer rather than into
+    // a normalized copy of the whole string.
+    // The FCD iterator normalizes only the segments that are not FCD,
+    // and in FCD text each code point can be decomposed on its own.
+    FCDUTF16CollationIterator iter(data, FALSE, nfdQCYesLimit, nfdQCYesLimit, limit);
+    UChar nfd[256];
+    int32_t nfdLength = 0;
+    UChar decompBuffer[4];
+    UChar32 c;
+    while((c = iter.nextCodePoint(errorCode)) >= 0) {
+        int32_t decompLength;
+        const UChar *decomp = data->nfcImpl.getDecomposition(c, decompBuffer, decompLength);
+        if(decomp == NULL) {
+            U16_APPEND_UNSAFE(nfd, nfdLength, c);
+        } else {
+            u_memcpy(nfd + nfdLength, decomp, decompLength);
+            nfdLength += decompLength;
+        }
+        // Keep room for the longest decomposition mapping (31 units).
+        if(nfdLength > UPRV_LENGTHOF(nfd) - 32) {
+            prev = u_writeIdenticalLevelRun(prev, nfd, nfdLength, sink);
+            nfdLength = 0;
+        }
+    }
+    if(U_FAILURE(errorCode)) { return; }
+    if(nfdLength > 0) {
+        u_writeIdenticalLevelRun(prev, nfd, nfdLength, sink);
+    }
 }
 
 namespace {
@@ -1487,6 +1671,101 @@ RuleBasedCollator::internalNextSortKeyPart(UCharIterator *iter, uint32_t state[2
     return length;
 }
 
+namespace {
+
+/**
+ * Passes the sort key bytes on to a ByteSink in chunks,
+ * so that writeSortKey() needs only a small buffer for the primary level
+ * regardless of the length of the text.
+ * When the chunk buffer is full, its contents are passed on and
+ * the base class starts over at the beginning of the buffer.
+ * NumberOfBytesAppended() counts only the bytes still in the buffer.
+ */
+class StreamingSortKeyByteSink : public SortKeyByteSink {
+public:
+    StreamingSortKeyByteSink(ByteSink &s)
+            : SortKeyByteSink(chunk, UPRV_LENGTHOF(chunk)), sink(s) {}
+    virtual ~StreamingSortKeyByteSink();
+
+    /** Passes on the bytes that are still in the buffer. */
+    void Flush() {
+        sink.Append(buffer_, appended_);
+        appended_ = 0;
+        sink.Flush();
+    }
+
+private:
+    virtual void AppendBeyondCapacity(const char *bytes, int32_t n, int32_t length);
+    virtual UBool Resize(int32_t appendCapacity, int32_t length);
+
+    ByteSink &sink;
+    char chunk[512];
+};
+
+StreamingSortKeyByteSink::~StreamingSortKeyByteSink() {}
+
+void
+StreamingSortKeyByteSink::AppendBeyondCapacity(const char *bytes, int32_t n, int32_t length) {
+    sink.Append(buffer_, length);
+    sink.Append(bytes, n);
+    appended_ = 0;
+}
+
+UBool
+StreamingSortKeyByteSink::Resize(int32_t appendCapacity, int32_t length) {
+    sink.Append(buffer_, length);
+    appended_ = 0;
+    return appendCapacity <= capacity_;
+}
+
+}  // namespace
+
+void
+RuleBasedCollator::writeSortKey(UCharIterator &iter, ByteSink &sink, UErrorCode &errorCode) const {
+    if(U_FAILURE(errorCode)) { return; }
+    StreamingSortKeyByteSink keySink(sink);
+    iter.move(&iter, 0, UITER_START);
+    UBool numeric = settings->isNumeric();
+    CollationKeys::LevelCallback callback;
+    if(settings->dontCheckFCD()) {
+        UIterCollationIterator ci(data, numeric, iter);
+        CollationKeys::writeSortKeyUpToQuaternary(ci, data->compressibleBytes, *settings,
+                                                  keySink, Collation::PRIMARY_LEVEL,
+                                                  callback, TRUE, errorCode);
+    } else {
+        FCDUIterCollationIterator ci(data, numeric, iter, 0);
+        CollationKeys::writeSortKeyUpToQuaternary(ci, data->compressibleBytes, *settings,
+                                                  keySink, Collation::PRIMARY_LEVEL,
+                                                  callback, TRUE, errorCode);
+    }
+    if(U_FAILURE(errorCode)) { return; }
+    if(settings->getStrength() == UCOL_IDENTICAL) {
+        UnicodeString s;
+        iter.move(&iter, 0, UITER_START);
+        for(;;) {
+            UChar32 c = iter.next(&iter);
+            if(c < 0) { break; }
+            s.append((UChar)c);
+        }
+        const UChar *sArray = s.getBuffer();
+        writeIdenticalLevel(sArray, sArray + s.length(), keySink, errorCode);
+        if(U_FAILURE(errorCode)) { return; }
+    }
+    static const char terminator = 0;  // TERMINATOR_BYTE
+    keySink.Append(&terminator, 1);
+    keySink.Flush();
+}
+
+void
+RuleBasedCollator::writeSortKeyUTF8(StringPiece s, ByteSink &sink, UErrorCode &errorCode) const {
+    if(U_FAILURE(errorCode)) { return; }
+    StreamingSortKeyByteSink keySink(sink);
+    writeSortKey(*settings, reinterpret_cast<const uint8_t *>(s.data()), s.length(),
+                 keySink, errorCode);
+    if(U_FAILURE(errorCode)) { return; }
+    keySink.Flush();
+}
+
 void
 RuleBasedCollator::internalGetCEs(const UnicodeString &str, UVector64 &ces,
                                   UErrorCode &errorCode) const {
@@ -0,0 +1,33 @@
+// © 2019 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+******************************************************************************
+* sharedmessageformat.h
+*/
+
+#ifndef __SHARED_MESSAGEFORMAT_H__
+#define __SHARED_MESSAGEFORMAT_H__
+
+#include "unicode/utypes.h"
+#include "sharedobject.h"
+
+U_NAMESPACE_BEGIN
+
+class MessageFormat;
+
+class U_I18N_API SharedMessageFormat : public SharedObject {
+public:
+    SharedMessageFormat(MessageFormat *mfToAdopt) : ptr(mfToAdopt) { }
+    virtual ~SharedMessageFormat();
+    const MessageFormat *get() const { return ptr; }
+    const MessageFormat *operator->() const { return ptr; }
+    const MessageFormat &operator*() const { return *ptr; }
+private:
+    MessageFormat *ptr;
+    SharedMessageFormat(const SharedMessageFormat &);
+    SharedMessageFormat &operator=(const SharedMessageFormat &);
+};
+
+U_NAMESPACE_END
+
+#endif
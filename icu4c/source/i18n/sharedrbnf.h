@@ -0,0 +1,33 @@
+// © 2019 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+******************************************************************************
+* sharedrbnf.h
+*/
+
+#ifndef __SHARED_RBNF_H__
+#define __SHARED_RBNF_H__
+
+#include "unicode/utypes.h"
+#include "sharedobject.h"
+
+U_NAMESPACE_BEGIN
+
+class RuleBasedNumberFormat;
+
+class U_I18N_API SharedRuleBasedNumberFormat : public SharedObject {
+public:
+    SharedRuleBasedNumberFormat(RuleBasedNumberFormat *rbnfToAdopt) : ptr(rbnfToAdopt) { }
+    virtual ~SharedRuleBasedNumberFormat();
+    const RuleBasedNumberFormat *get() const { return ptr; }
+    const RuleBasedNumberFormat *operator->() const { return ptr; }
+    const RuleBasedNumberFormat &operator*() const { return *ptr; }
+private:
+    RuleBasedNumberFormat *ptr;
+    SharedRuleBasedNumberFormat(const SharedRuleBasedNumberFormat &);
+    SharedRuleBasedNumberFormat &operator=(const SharedRuleBasedNumberFormat &);
+};
+
+U_NAMESPACE_END
+
+#endif
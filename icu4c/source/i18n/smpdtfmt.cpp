@@ -74,6 +74,8 @@
 #include "dayperiodrules.h"
 #include "tznames_impl.h"   // ZONE_NAME_U16_MAX
 #include "number_utypes.h"
+#include "gregoimp.h"
+#include "utracimp.h"
 
 #if defined( U_DEBUG_CALSVC ) || defined (U_DEBUG_CAL)
 #include <stdio.h>
@@ -234,6 +236,21 @@ static UMutex LOCK;
 
 UOBJECT_DEFINE_RTTI_IMPLEMENTATION(SimpleDateFormat)
 
+struct SimpleDateFormat::DateFields : public UMemory {
+    UDate time;
+    int32_t values[UCAL_FIELD_COUNT];
+
+    /** Returns the value of the field, from cal if fields is NULL. */
+    static inline int32_t get(const DateFields *fields, Calendar &cal,
+                              UCalendarDateFields field, UErrorCode &status) {
+        return fields != NULL ? fields->values[field] : cal.get(field, status);
+    }
+};
+
+// Dates from the Gregorian cutover until this limit (about the year 33000)
+// are formatted by formatWithFields() without a Calendar clone.
+static const double kMaxFieldsMillis = 1.0e15;
+
 SimpleDateFormat::NSOverride::~NSOverride() {
     if (snf != NULL) {
         snf->removeRef();
@@ -580,8 +597,10 @@ SimpleDateFormat& SimpleDateFormat::operator=(const SimpleDateFormat& other)
     fHaveDefaultCentury          = other.fHaveDefaultCentury;
 
     fPattern = other.fPattern;
+    fCompiledPattern = other.fCompiledPattern;
     fHasMinute = other.fHasMinute;
     fHasSecond = other.fHasSecond;
+    fFixedNumericPattern = other.fFixedNumericPattern;
 
     // TimeZoneFormat in ICU4C only depends on a locale for now
     if (fLocale != other.fLocale) {
@@ -958,16 +977,350 @@ SimpleDateFormat::format(Calendar& cal, UnicodeString& appendTo,
 
 //----------------------------------------------------------------------
 
+UBool
+SimpleDateFormat::formatWithFields(UDate date, UnicodeString& appendTo,
+                                   FieldPositionHandler& handler, UErrorCode& status) const
+{
+    // A subclass might override format(Calendar&, ...), and other calendar types
+    // compute their fields differently.
+    if (U_FAILURE(status) || fCalendar == NULL ||
+            getDynamicClassID() != SimpleDateFormat::getStaticClassID() ||
+            fCalendar->getDynamicClassID() != GregorianCalendar::getStaticClassID()) {
+        return FALSE;
+    }
+    // GregorianCalendar uses Julian fields before the cutover,
+    // and adjusts the day of year in the year of the cutover.
+    const GregorianCalendar *gc = static_cast<const GregorianCalendar *>(fCalendar);
+    if (!(gc->getGregorianChange() + 367.0 * U_MILLIS_PER_DAY <= date && date <= kMaxFieldsMillis)) {
+        return FALSE;
+    }
+    // Only fields that follow directly from the local date and time.
+    // Week-based fields depend on the calendar's week settings.
+    // Compute the date fields only if the pattern has any.
+    UBool hasDateField = FALSE;
+    const UChar *items = fCompiledPattern.getBuffer();
+    int32_t itemsLength = fCompiledPattern.length();
+    for (int32_t i = 0; i < itemsLength;) {
+        UChar item = items[i++];
+        if (item < 0x8000) {
+            i += item;
+            continue;
+        }
+        switch (DateFormatSymbols::getPatternCharIndex(items[i++])) {
+        case UDAT_ERA_FIELD:
+        case UDAT_YEAR_FIELD:
+        case UDAT_MONTH_FIELD:
+        case UDAT_DATE_FIELD:
+        case UDAT_DAY_OF_WEEK_FIELD:
+        case UDAT_DAY_OF_YEAR_FIELD:
+        case UDAT_EXTENDED_YEAR_FIELD:
+        case UDAT_STANDALONE_MONTH_FIELD:
+        case UDAT_QUARTER_FIELD:
+        case UDAT_STANDALONE_QUARTER_FIELD:
+            hasDateField = TRUE;
+            break;
+        case UDAT_HOUR_OF_DAY1_FIELD:
+        case UDAT_HOUR_OF_DAY0_FIELD:
+        case UDAT_MINUTE_FIELD:
+        case UDAT_SECOND_FIELD:
+        case UDAT_FRACTIONAL_SECOND_FIELD:
+        case UDAT_AM_PM_FIELD:
+        case UDAT_HOUR1_FIELD:
+        case UDAT_HOUR0_FIELD:
+        case UDAT_TIMEZONE_FIELD:
+        case UDAT_MILLISECONDS_IN_DAY_FIELD:
+        case UDAT_TIMEZONE_RFC_FIELD:
+        case UDAT_TIMEZONE_GENERIC_FIELD:
+        case UDAT_TIMEZONE_SPECIAL_FIELD:
+        case UDAT_TIMEZONE_LOCALIZED_GMT_OFFSET_FIELD:
+        case UDAT_TIMEZONE_ISO_FIELD:
+        case UDAT_TIMEZONE_ISO_LOCAL_FIELD:
+        case UDAT_AM_PM_MIDNIGHT_NOON_FIELD:
+        case UDAT_FLEXIBLE_DAY_PERIOD_FIELD:
+            break;
+        default:
+            return FALSE;
+        }
+    }
+
+    // Same as Calendar::computeFields() and GregorianCalendar::handleComputeFields()
+    // after the cutover, but into a stack-local struct rather than into a Calendar clone.
+    DateFields fields;
+    uprv_memset(fields.values, 0, sizeof(fields.values));
+    fields.time = date;
+    int32_t rawOffset, dstOffset;
+    fCalendar->getTimeZone().getOffset(date, FALSE, rawOffset, dstOffset, status);
+    if (U_FAILURE(status)) {
+        return TRUE;
+    }
+    double millisInDay;
+    double day = ClockMath::floorDivide(date + rawOffset + dstOffset, (double)U_MILLIS_PER_DAY, millisInDay);
+    int32_t *values = fields.values;
+    if (hasDateField) {
+        int32_t year, month, dom, dow, doy;
+        Grego::dayToFields(day, year, month, dom, dow, doy);
+        values[UCAL_ERA] = GregorianCalendar::AD;
+        values[UCAL_YEAR] = year;
+        values[UCAL_EXTENDED_YEAR] = year;
+        values[UCAL_MONTH] = month;
+        values[UCAL_DATE] = dom;
+        values[UCAL_DAY_OF_WEEK] = dow;
+        values[UCAL_DAY_OF_YEAR] = doy;
+    }
+    int32_t mid = (int32_t)millisInDay;
+    values[UCAL_MILLISECONDS_IN_DAY] = mid;
+    values[UCAL_MILLISECOND] = mid % 1000;
+    mid /= 1000;
+    values[UCAL_SECOND] = mid % 60;
+    mid /= 60;
+    values[UCAL_MINUTE] = mid % 60;
+    mid /= 60;
+    values[UCAL_HOUR_OF_DAY] = mid;
+    values[UCAL_AM_PM] = mid / 12;
+    values[UCAL_HOUR] = mid % 12;
+    values[UCAL_ZONE_OFFSET] = rawOffset;
+    values[UCAL_DST_OFFSET] = dstOffset;
+
+    // fCalendar is only read: its type, time zone and field limits.
+    _format(*fCalendar, appendTo, handler, status, &fields);
+    return TRUE;
+}
+
+//----------------------------------------------------------------------
+
+/**
+ * Parses exactly count ASCII digits at text[index]. Returns -1 if there are fewer.
+ */
+static int32_t parseAsciiDigits(const UChar *text, int32_t length, int32_t index, int32_t count) {
+    if (index + count > length) {
+        return -1;
+    }
+    int32_t value = 0;
+    for (int32_t i = index; i < index + count; ++i) {
+        UChar c = text[i];
+        if (c < 0x30 || 0x39 < c) {
+            return -1;
+        }
+        value = value * 10 + (c - 0x30);
+    }
+    return value;
+}
+
+static inline UBool isAsciiDigitAt(const UChar *text, int32_t length, int32_t index) {
+    return index < length && 0x30 <= text[index] && text[index] <= 0x39;
+}
+
+UBool
+SimpleDateFormat::parseFixedNumeric(const UnicodeString& text, ParsePosition& parsePos, UDate& result) const
+{
+    // Same conditions as formatWithFields(), plus the parse-time pattern check
+    // and no per-field number format overrides.
+    if (!fFixedNumericPattern || !fHasAsciiDigits || fSharedNumberFormatters != NULL ||
+            fCalendar == NULL ||
+            getDynamicClassID() != SimpleDateFormat::getStaticClassID() ||
+            fCalendar->getDynamicClassID() != GregorianCalendar::getStaticClassID()) {
+        return FALSE;
+    }
+    const UChar *chars = text.getBuffer();
+    int32_t length = text.length();
+    int32_t start = parsePos.getIndex();
+    if (chars == NULL || start < 0 || start > length) {
+        return FALSE;
+    }
+
+    // Each field takes exactly its pattern count of ASCII digits. Where the generic
+    // parser would read more digits, or would need leniency, return FALSE and let it do so.
+    int32_t year = 0, month = 1, dom = 1, hour = 0, minute = 0, second = 0, millis = 0;
+    UBool hasOffset = FALSE;
+    int32_t offset = 0;
+    int32_t index = start;
+    const UChar *items = fCompiledPattern.getBuffer();
+    int32_t itemsLength = fCompiledPattern.length();
+    for (int32_t i = 0; i < itemsLength;) {
+        UChar item = items[i++];
+        if (item < 0x8000) {
+            if (index + item > length || uprv_memcmp(chars + index, items + i, item * U_SIZEOF_UCHAR) != 0) {
+                return FALSE;
+            }
+            index += item;
+            i += item;
+            continue;
+        }
+        int32_t count = item & 0x7fff;
+        UDateFormatField field = DateFormatSymbols::getPatternCharIndex(items[i++]);
+        if (field == UDAT_TIMEZONE_ISO_FIELD || field == UDAT_TIMEZONE_ISO_LOCAL_FIELD) {
+            // X accepts "Z" for UTC; XX and xx are +HHmm, XXX and xxx are +HH:mm.
+            hasOffset = TRUE;
+            if (field == UDAT_TIMEZONE_ISO_FIELD && index < length && chars[index] == 0x5A) {
+                ++index;
+            } else {
+                if (index >= length || (chars[index] != 0x2B && chars[index] != 0x2D)) {
+                    return FALSE;
+                }
+                int32_t sign = chars[index++] == 0x2D ? -1 : 1;
+                int32_t offsetHour = parseAsciiDigits(chars, length, index, 2);
+                index += 2;
+                if (count == 3) {
+                    if (index >= length || chars[index] != 0x3A) {
+                        return FALSE;
+                    }
+                    ++index;
+                }
+                int32_t offsetMinute = parseAsciiDigits(chars, length, index, 2);
+                index += 2;
+                if (offsetHour < 0 || offsetHour > 23 || offsetMinute < 0 || offsetMinute > 59) {
+                    return FALSE;
+                }
+                offset = sign * (offsetHour * 60 + offsetMinute) * U_MILLIS_PER_MINUTE;
+            }
+            // Seconds or further digits are left to the generic parser.
+            if (isAsciiDigitAt(chars, length, index) || (index < length && chars[index] == 0x3A)) {
+                return FALSE;
+            }
+            continue;
+        }
+        int32_t value = parseAsciiDigits(chars, length, index, count);
+        if (value < 0) {
+            return FALSE;
+        }
+        index += count;
+        // Abutting fields continue with the next digits; otherwise the generic parser
+        // would read any further digits into this field.
+        if ((i >= itemsLength || items[i] < 0x8000) && isAsciiDigitAt(chars, length, index)) {
+            return FALSE;
+        }
+        switch (field) {
+        case UDAT_YEAR_FIELD:
+            year = value;
+            break;
+        case UDAT_MONTH_FIELD:
+            month = value;
+            break;
+        case UDAT_DATE_FIELD:
+            dom = value;
+            break;
+        case UDAT_HOUR_OF_DAY0_FIELD:
+            hour = value;
+            break;
+        case UDAT_MINUTE_FIELD:
+            minute = value;
+            break;
+        case UDAT_SECOND_FIELD:
+            second = value;
+            break;
+        default:  // UDAT_FRACTIONAL_SECOND_FIELD, left-justified as in subParse()
+            while (count < 3) {
+                value *= 10;
+                ++count;
+            }
+            while (count > 3) {
+                value /= 10;
+                --count;
+            }
+            millis = value;
+            break;
+        }
+    }
+    if (month < 1 || month > 12 || dom < 1 || dom > Grego::monthLength(year, month - 1) ||
+            hour > 23 || minute > 59 || second > 59) {
+        return FALSE;
+    }
+    UDate local = Grego::fieldsToDay(year, month - 1, dom) * U_MILLIS_PER_DAY +
+            (double)(((hour * 60 + minute) * 60 + second) * 1000 + millis);
+    // Grego is proleptic Gregorian, so stay clear of the calendar's cutover.
+    const GregorianCalendar *gc = static_cast<const GregorianCalendar *>(fCalendar);
+    if (!(gc->getGregorianChange() + 367.0 * U_MILLIS_PER_DAY <= local && local <= kMaxFieldsMillis)) {
+        return FALSE;
+    }
+
+    if (!hasOffset) {
+        // Same as Calendar::computeZoneOffset() for a BasicTimeZone. A skipped wall time
+        // depends on leniency and the skipped wall time option, so leave that to the Calendar.
+        const TimeZone &tz = fCalendar->getTimeZone();
+        const BasicTimeZone *btz = NULL;
+        if (dynamic_cast<const OlsonTimeZone *>(&tz) != NULL
+                || dynamic_cast<const SimpleTimeZone *>(&tz) != NULL
+                || dynamic_cast<const RuleBasedTimeZone *>(&tz) != NULL
+                || dynamic_cast<const VTimeZone *>(&tz) != NULL) {
+            btz = static_cast<const BasicTimeZone *>(&tz);
+        }
+        if (btz == NULL) {
+            return FALSE;
+        }
+        int32_t duplicatedTimeOpt = fCalendar->getRepeatedWallTimeOption() == UCAL_WALLTIME_FIRST ?
+                BasicTimeZone::kFormer : BasicTimeZone::kLatter;
+        UErrorCode status = U_ZERO_ERROR;
+        int32_t rawOffset, dstOffset, rawOffset2, dstOffset2;
+        btz->getOffsetFromLocal(local, BasicTimeZone::kFormer, duplicatedTimeOpt, rawOffset, dstOffset, status);
+        btz->getOffsetFromLocal(local, BasicTimeZone::kLatter, duplicatedTimeOpt, rawOffset2, dstOffset2, status);
+        if (U_FAILURE(status) || rawOffset + dstOffset != rawOffset2 + dstOffset2) {
+            return FALSE;
+        }
+        offset = rawOffset + dstOffset;
+    }
+    result = local - offset;
+    parsePos.setIndex(index);
+    return TRUE;
+}
+
+//----------------------------------------------------------------------
+
+int32_t
+SimpleDateFormat::formatToUTF16(UDate date, char16_t* dest, int32_t destCapacity,
+                                UErrorCode& status) const
+{
+    if (U_FAILURE(status)) {
+        return 0;
+    }
+    if (destCapacity < 0 || (dest == NULL && destCapacity > 0)) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    UnicodeString result;
+    if (dest != NULL) {
+        // Write directly into dest; UnicodeString reallocates only if the result does not fit.
+        result.setTo(dest, 0, destCapacity);
+    }
+    FieldPosition pos(FieldPosition::DONT_CARE);
+    format(date, result, pos);
+    // extract() is a no-op copy when result still aliases dest.
+    return result.extract(dest, destCapacity, status);
+}
+
+int32_t
+SimpleDateFormat::formatToUTF8(UDate date, char* dest, int32_t destCapacity,
+                               UErrorCode& status) const
+{
+    if (U_FAILURE(status)) {
+        return 0;
+    }
+    if (destCapacity < 0 || (dest == NULL && destCapacity > 0)) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    // Typical timestamps fit into the UnicodeString's inline buffer.
+    UnicodeString result;
+    FieldPosition pos(FieldPosition::DONT_CARE);
+    format(date, result, pos);
+    int32_t length = 0;
+    u_strToUTF8(dest, destCapacity, &length, result.getBuffer(), result.length(), &status);
+    return length;
+}
+
+//----------------------------------------------------------------------
+
 UnicodeString&
 SimpleDateFormat::_format(Calendar& cal, UnicodeString& appendTo,
-                            FieldPositionHandler& handler, UErrorCode& status) const
+                            FieldPositionHandler& handler, UErrorCode& status,
+                            const DateFields *fields) const
 {
     if ( U_FAILURE(status) ) {
        return appendTo;
     }
+    UTRACE_ENTRY(UTRACE_UDAT_FORMAT);
     Calendar* workCal = &cal;
     Calendar* calClone = NULL;
-    if (&cal != fCalendar && uprv_strcmp(cal.getType(), fCalendar->getType()) != 0) {
+    if (fields == NULL && &cal != fCalendar && uprv_strcmp(cal.getType(), fCalendar->getType()) != 0) {
         // Different calendar type
         // We use the time and time zone from the input calendar, but
         // do not use the input calendar for field calculation.
@@ -979,57 +1332,34 @@ SimpleDateFormat::_format(Calendar& cal, UnicodeString& appendTo,
             workCal = calClone;
         } else {
             status = U_MEMORY_ALLOCATION_ERROR;
+            UTRACE_EXIT_STATUS(status);
             return appendTo;
         }
     }
 
-    UBool inQuote = FALSE;
-    UChar prevCh = 0;
-    int32_t count = 0;
     int32_t fieldNum = 0;
     UDisplayContext capitalizationContext = getContext(UDISPCTX_TYPE_CAPITALIZATION, status);
 
-    // loop through the pattern string character by character
-    for (int32_t i = 0; i < fPattern.length() && U_SUCCESS(status); ++i) {
-        UChar ch = fPattern[i];
-
-        // Use subFormat() to format a repeated pattern character
-        // when a different pattern or non-pattern character is seen
-        if (ch != prevCh && count > 0) {
-            subFormat(appendTo, prevCh, count, capitalizationContext, fieldNum++, handler, *workCal, status);
-            count = 0;
-        }
-        if (ch == QUOTE) {
-            // Consecutive single quotes are a single quote literal,
-            // either outside of quotes or between quotes
-            if ((i+1) < fPattern.length() && fPattern[i+1] == QUOTE) {
-                appendTo += (UChar)QUOTE;
-                ++i;
-            } else {
-                inQuote = ! inQuote;
-            }
-        }
-        else if (!inQuote && isSyntaxChar(ch)) {
-            // ch is a date-time pattern character to be interpreted
-            // by subFormat(); count the number of times it is repeated
-            prevCh = ch;
-            ++count;
-        }
-        else {
+    // run the pattern compiled by parsePattern()
+    const UChar *items = fCompiledPattern.getBuffer();
+    int32_t itemsLength = fCompiledPattern.length();
+    for (int32_t i = 0; i < itemsLength && U_SUCCESS(status);) {
+        UChar item = items[i++];
+        if (item < 0x8000) {
             // Append quoted characters and unquoted non-pattern characters
-            appendTo += ch;
+            appendTo.append(items + i, item);
+            i += item;
+        } else {
+            // Use subFormat() to format a repeated pattern character
+            subFormat(appendTo, items[i++], item & 0x7fff, capitalizationContext, fieldNum++, handler, *workCal, status, fields);
         }
     }
 
-    // Format the last item in the pattern, if any
-    if (count > 0) {
-        subFormat(appendTo, prevCh, count, capitalizationContext, fieldNum++, handler, *workCal, status);
-    }
-
     if (calClone != NULL) {
         delete calClone;
     }
 
+    UTRACE_EXIT_STATUS(status);
     return appendTo;
 }
 
@@ -1239,6 +1569,37 @@ void SimpleDateFormat::initFastNumberFormatters(UErrorCode& status) {
     fFastNumberFormatters[SMPDTFMT_NF_3x10] = createFastFormatter(df, 3, 10);
     fFastNumberFormatters[SMPDTFMT_NF_4x10] = createFastFormatter(df, 4, 10);
     fFastNumberFormatters[SMPDTFMT_NF_2x2] = createFastFormatter(df, 2, 2);
+
+    // Check whether the fast formatters print non-negative integers with plain ASCII digits
+    // and nothing else. Then zeroPaddingNumber() writes those digits itself.
+    static const struct {
+        NumberFormatterKey key;
+        int32_t value;
+        const char16_t *expected;
+    } probes[] = {
+        { SMPDTFMT_NF_1x10, 0, u"0" },
+        { SMPDTFMT_NF_1x10, 1234567890, u"1234567890" },
+        { SMPDTFMT_NF_2x10, 7, u"07" },
+        { SMPDTFMT_NF_4x10, 98765, u"98765" },
+        { SMPDTFMT_NF_2x2, 1234, u"34" }
+    };
+    fHasAsciiDigits = TRUE;
+    for (const auto& probe : probes) {
+        const number::LocalizedNumberFormatter* formatter = fFastNumberFormatters[probe.key];
+        if (formatter == nullptr) {
+            fHasAsciiDigits = FALSE;
+            break;
+        }
+        UErrorCode localStatus = U_ZERO_ERROR;
+        number::impl::UFormattedNumberData result;
+        result.quantity.setToInt(probe.value);
+        formatter->formatImpl(&result, localStatus);
+        if (U_FAILURE(localStatus) ||
+                result.getStringRef().toTempUnicodeString() != UnicodeString(probe.expected)) {
+            fHasAsciiDigits = FALSE;
+            break;
+        }
+    }
 }
 
 void SimpleDateFormat::freeFastNumberFormatters() {
@@ -1252,6 +1613,7 @@ void SimpleDateFormat::freeFastNumberFormatters() {
     fFastNumberFormatters[SMPDTFMT_NF_3x10] = nullptr;
     fFastNumberFormatters[SMPDTFMT_NF_4x10] = nullptr;
     fFastNumberFormatters[SMPDTFMT_NF_2x2] = nullptr;
+    fHasAsciiDigits = FALSE;
 }
 
 
@@ -1404,7 +1766,8 @@ SimpleDateFormat::subFormat(UnicodeString &appendTo,
                             int32_t fieldNum,
                             FieldPositionHandler& handler,
                             Calendar& cal,
-                            UErrorCode& status) const
+                            UErrorCode& status,
+                            const DateFields *fields) const
 {
     if (U_FAILURE(status)) {
         return;
@@ -1435,7 +1798,7 @@ SimpleDateFormat::subFormat(UnicodeString &appendTo,
     int32_t value = 0;
     // Don't get value unless it is useful
     if (field < UCAL_FIELD_COUNT) {
-        value = (patternCharIndex != UDAT_RELATED_YEAR_FIELD)? cal.get(field, status): cal.getRelatedYear(status);
+        value = (patternCharIndex != UDAT_RELATED_YEAR_FIELD)? DateFields::get(fields, cal, field, status): cal.getRelatedYear(status);
     }
     if (U_FAILURE(status)) {
         return;
@@ -1512,7 +1875,7 @@ SimpleDateFormat::subFormat(UnicodeString &appendTo,
         }
         {
             int32_t isLeapMonth = (fSymbols->fLeapMonthPatterns != NULL && fSymbols->fLeapMonthPatternsCount >= DateFormatSymbols::kMonthPatternsCount)?
-                        cal.get(UCAL_IS_LEAP_MONTH, status): 0;
+                        DateFields::get(fields, cal, UCAL_IS_LEAP_MONTH, status): 0;
             // should consolidate the next section by using arrays of pointers & counts for the right symbols...
             if (count == 5) {
                 if (patternCharIndex == UDAT_MONTH_FIELD) {
@@ -1588,7 +1951,7 @@ SimpleDateFormat::subFormat(UnicodeString &appendTo,
         }
         // fall through to EEEEE-EEE handling, but for that we don't want local day-of-week,
         // we want standard day-of-week, so first fix value to work for EEEEE-EEE.
-        value = cal.get(UCAL_DAY_OF_WEEK, status);
+        value = DateFields::get(fields, cal, UCAL_DAY_OF_WEEK, status);
         if (U_FAILURE(status)) {
             return;
         }
@@ -1625,7 +1988,7 @@ SimpleDateFormat::subFormat(UnicodeString &appendTo,
         }
         // fall through to alpha DOW handling, but for that we don't want local day-of-week,
         // we want standard day-of-week, so first fix value.
-        value = cal.get(UCAL_DAY_OF_WEEK, status);
+        value = DateFields::get(fields, cal, UCAL_DAY_OF_WEEK, status);
         if (U_FAILURE(status)) {
             return;
         }
@@ -1688,7 +2051,7 @@ SimpleDateFormat::subFormat(UnicodeString &appendTo,
             UChar zsbuf[ZONE_NAME_U16_MAX];
             UnicodeString zoneString(zsbuf, 0, UPRV_LENGTHOF(zsbuf));
             const TimeZone& tz = cal.getTimeZone();
-            UDate date = cal.getTime(status);
+            UDate date = fields != NULL ? fields->time : cal.getTime(status);
             const TimeZoneFormat *tzfmt = tzFormat(status);
             if (U_SUCCESS(status)) {
                 if (patternCharIndex == UDAT_TIMEZONE_FIELD) {
@@ -1819,7 +2182,7 @@ SimpleDateFormat::subFormat(UnicodeString &appendTo,
     case UDAT_AM_PM_MIDNIGHT_NOON_FIELD:
     {
         const UnicodeString *toAppend = NULL;
-        int32_t hour = cal.get(UCAL_HOUR_OF_DAY, status);
+        int32_t hour = DateFields::get(fields, cal, UCAL_HOUR_OF_DAY, status);
 
         // Note: "midnight" can be ambiguous as to whether it refers to beginning of day or end of day.
         // For ICU 57 output of "midnight" is temporarily suppressed.
@@ -1828,12 +2191,12 @@ SimpleDateFormat::subFormat(UnicodeString &appendTo,
         // Time, as displayed, must be exactly noon or midnight.
         // This means minutes and seconds, if present, must be zero.
         if ((/*hour == 0 ||*/ hour == 12) &&
-                (!fHasMinute || cal.get(UCAL_MINUTE, status) == 0) &&
-                (!fHasSecond || cal.get(UCAL_SECOND, status) == 0)) {
+                (!fHasMinute || DateFields::get(fields, cal, UCAL_MINUTE, status) == 0) &&
+                (!fHasSecond || DateFields::get(fields, cal, UCAL_SECOND, status) == 0)) {
             // Stealing am/pm value to use as our array index.
             // It works out: am/midnight are both 0, pm/noon are both 1,
             // 12 am is 12 midnight, and 12 pm is 12 noon.
-            int32_t val = cal.get(UCAL_AM_PM, status);
+            int32_t val = DateFields::get(fields, cal, UCAL_AM_PM, status);
 
             if (count <= 3) {
                 toAppend = &fSymbols->fAbbreviatedDayPeriods[val];
@@ -1850,7 +2213,7 @@ SimpleDateFormat::subFormat(UnicodeString &appendTo,
         if (toAppend == NULL || toAppend->isBogus()) {
             // Reformat with identical arguments except ch, now changed to 'a'.
             subFormat(appendTo, 0x61, count, capitalizationContext, fieldNum,
-                      handler, cal, status);
+                      handler, cal, status, fields);
         } else {
             appendTo += *toAppend;
         }
@@ -1871,19 +2234,19 @@ SimpleDateFormat::subFormat(UnicodeString &appendTo,
             // Data doesn't exist for the locale we're looking for.
             // Falling back to am/pm.
             subFormat(appendTo, 0x61, count, capitalizationContext, fieldNum,
-                      handler, cal, status);
+                      handler, cal, status, fields);
             break;
         }
 
         // Get current display time.
-        int32_t hour = cal.get(UCAL_HOUR_OF_DAY, status);
+        int32_t hour = DateFields::get(fields, cal, UCAL_HOUR_OF_DAY, status);
         int32_t minute = 0;
         if (fHasMinute) {
-            minute = cal.get(UCAL_MINUTE, status);
+            minute = DateFields::get(fields, cal, UCAL_MINUTE, status);
         }
         int32_t second = 0;
         if (fHasSecond) {
-            second = cal.get(UCAL_SECOND, status);
+            second = DateFields::get(fields, cal, UCAL_SECOND, status);
         }
 
         // Determine day period.
@@ -1942,7 +2305,7 @@ SimpleDateFormat::subFormat(UnicodeString &appendTo,
             periodType == DayPeriodRules::DAYPERIOD_PM ||
             toAppend->isBogus()) {
             subFormat(appendTo, 0x61, count, capitalizationContext, fieldNum,
-                      handler, cal, status);
+                      handler, cal, status, fields);
         }
         else {
             appendTo += *toAppend;
@@ -2060,6 +2423,37 @@ SimpleDateFormat::zeroPaddingNumber(
         UnicodeString &appendTo,
         int32_t value, int32_t minDigits, int32_t maxDigits) const
 {
+    if (fHasAsciiDigits && currentNumberFormat == fNumberFormat && value >= 0 &&
+            (maxDigits == 10 || maxDigits == 2) && 1 <= minDigits && minDigits <= maxDigits) {
+        // Write the digits like the fast formatters would, two at a time from the end.
+        static const char kDigitPairs[] =
+            "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+            "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+            "8081828384858687888990919293949596979899";
+        char16_t digits[10];
+        int32_t start = 10;
+        if (maxDigits == 2) {
+            value %= 100;
+        }
+        while (value >= 100) {
+            int32_t pair = (value % 100) * 2;
+            value /= 100;
+            digits[--start] = kDigitPairs[pair + 1];
+            digits[--start] = kDigitPairs[pair];
+        }
+        if (value >= 10) {
+            digits[--start] = kDigitPairs[value * 2 + 1];
+            digits[--start] = kDigitPairs[value * 2];
+        } else {
+            digits[--start] = (char16_t)(u'0' + value);
+        }
+        while (start > 10 - minDigits) {
+            digits[--start] = u'0';
+        }
+        appendTo.append(digits + start, 10 - start);
+        return;
+    }
+
     const number::LocalizedNumberFormatter* fastFormatter = nullptr;
     // NOTE: This uses the heuristic that these five min/max int settings account for the vast majority
     // of SimpleDateFormat number formatting cases at the time of writing (ICU 62).
@@ -3929,6 +4323,7 @@ SimpleDateFormat::applyLocalizedPattern(const UnicodeString& pattern,
     translatePattern(pattern, fPattern,
                      fSymbols->fLocalPatternChars,
                      UnicodeString(DateFormatSymbols::getPatternUChars()), status);
+    parsePattern();
 }
 
 //----------------------------------------------------------------------
@@ -4255,24 +4650,108 @@ void SimpleDateFormat::parsePattern() {
     fHasSecond = FALSE;
     fHasHanYearChar = FALSE;
 
+    // Compile the pattern into literal and field items, see fCompiledPattern.
+    // This mirrors how format() used to interpret the pattern character by character.
+    fCompiledPattern.remove();
+    int32_t literalStart = -1;  // index of the current literal item's length unit
+    UChar prevCh = 0;
+    int32_t count = 0;
+
     int len = fPattern.length();
     UBool inQuote = FALSE;
     for (int32_t i = 0; i < len; ++i) {
         UChar ch = fPattern[i];
-        if (ch == QUOTE) {
-            inQuote = !inQuote;
+        if ((ch != prevCh && count > 0) || count == 0x7fff) {
+            fCompiledPattern.append((UChar)(0x8000 | count)).append(prevCh);
+            count = 0;
         }
         if (ch == 0x5E74) { // don't care whether this is inside quotes
             fHasHanYearChar = TRUE;
         }
-        if (!inQuote) {
+        if (ch == QUOTE) {
+            // Consecutive single quotes are a single quote literal,
+            // either outside of quotes or between quotes
+            if ((i+1) < len && fPattern[i+1] == QUOTE) {
+                ++i;
+            } else {
+                inQuote = !inQuote;
+                continue;
+            }
+        } else if (!inQuote && isSyntaxChar(ch)) {
             if (ch == 0x6D) {  // 0x6D == 'm'
                 fHasMinute = TRUE;
             }
             if (ch == 0x73) {  // 0x73 == 's'
                 fHasSecond = TRUE;
             }
+            prevCh = ch;
+            ++count;
+            literalStart = -1;
+            continue;
+        }
+        // Append to the current literal item, or start a new one.
+        if (literalStart < 0 || fCompiledPattern[literalStart] == 0x7fff) {
+            literalStart = fCompiledPattern.length();
+            fCompiledPattern.append((UChar)0);
+        }
+        fCompiledPattern.setCharAt(literalStart, (UChar)(fCompiledPattern[literalStart] + 1));
+        fCompiledPattern.append(ch);
+    }
+    if (count > 0) {
+        fCompiledPattern.append((UChar)(0x8000 | count)).append(prevCh);
+    }
+
+    // See parseFixedNumeric(): only fixed-width numeric fields, at most one of each,
+    // at least year, month and day, and an optional ISO offset as the last item.
+    // A literal must not start with an ASCII digit, which the previous field would consume.
+    fFixedNumericPattern = TRUE;
+    uint64_t seen = 0;
+    const UChar *items = fCompiledPattern.getBuffer();
+    int32_t itemsLength = fCompiledPattern.length();
+    for (int32_t i = 0; i < itemsLength && fFixedNumericPattern;) {
+        UChar item = items[i++];
+        if (item < 0x8000) {
+            if (0x30 <= items[i] && items[i] <= 0x39) {
+                fFixedNumericPattern = FALSE;
+            }
+            i += item;
+            continue;
+        }
+        int32_t itemCount = item & 0x7fff;
+        UDateFormatField field = DateFormatSymbols::getPatternCharIndex(items[i++]);
+        UBool ok;
+        switch (field) {
+        case UDAT_YEAR_FIELD:
+            ok = itemCount == 4;
+            break;
+        case UDAT_MONTH_FIELD:
+        case UDAT_DATE_FIELD:
+        case UDAT_HOUR_OF_DAY0_FIELD:
+        case UDAT_MINUTE_FIELD:
+        case UDAT_SECOND_FIELD:
+            ok = itemCount == 2;
+            break;
+        case UDAT_FRACTIONAL_SECOND_FIELD:
+            ok = itemCount <= 9;
+            break;
+        case UDAT_TIMEZONE_ISO_FIELD:
+        case UDAT_TIMEZONE_ISO_LOCAL_FIELD:
+            ok = (itemCount == 2 || itemCount == 3) && i == itemsLength;
+            break;
+        default:
+            ok = FALSE;
+            break;
         }
+        if (!ok || (seen & ((uint64_t)1 << field)) != 0) {
+            fFixedNumericPattern = FALSE;
+            break;
+        }
+        seen |= (uint64_t)1 << field;
+    }
+    uint64_t required = ((uint64_t)1 << UDAT_YEAR_FIELD) |
+            ((uint64_t)1 << UDAT_MONTH_FIELD) | ((uint64_t)1 << UDAT_DATE_FIELD);
+    if ((seen & required) != required) {
+        fFixedNumericPattern = FALSE;
     }
 }
 
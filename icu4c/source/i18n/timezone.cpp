@@ -80,6 +80,7 @@ static char gStrBuf[256];
 #include "uresimp.h" // struct UResourceBundle
 #include "olsontz.h"
 #include "mutex.h"
+#include "unifiedcache.h"
 #include "unicode/udata.h"
 #include "ucln_in.h"
 #include "cstring.h"
@@ -304,6 +305,63 @@ static UResourceBundle* openOlsonResource(const UnicodeString& id,
 
 // -------------------------------------
 
+/**
+ * UnifiedCache key for the data of the system zone with the given ID.
+ * Link IDs get their own entries, because the canonical ID stored in
+ * the data depends on the requested ID.
+ */
+class OlsonTimeZoneDataKey : public CacheKey<OlsonTimeZoneData> {
+private:
+    UnicodeString fID;
+public:
+    OlsonTimeZoneDataKey(const UnicodeString& id) : fID(id) { }
+    OlsonTimeZoneDataKey(const OlsonTimeZoneDataKey &other)
+            : CacheKey<OlsonTimeZoneData>(other), fID(other.fID) { }
+    virtual ~OlsonTimeZoneDataKey();
+    virtual int32_t hashCode() const {
+        return (int32_t)(37u * (uint32_t)CacheKey<OlsonTimeZoneData>::hashCode() + (uint32_t)fID.hashCode());
+    }
+    virtual UBool operator==(const CacheKeyBase &other) const {
+        if (this == &other) {
+            return TRUE;
+        }
+        if (!CacheKey<OlsonTimeZoneData>::operator==(other)) {
+            return FALSE;
+        }
+        // We know that this and other are of same class if we get this far.
+        return static_cast<const OlsonTimeZoneDataKey &>(other).fID == fID;
+    }
+    virtual CacheKeyBase *clone() const {
+        return new OlsonTimeZoneDataKey(*this);
+    }
+    virtual char *writeDescription(char *buffer, int32_t bufLen) const {
+        fID.extract(0, fID.length(), buffer, bufLen, US_INV);
+        buffer[bufLen - 1] = 0;
+        return buffer;
+    }
+    virtual const OlsonTimeZoneData *createObject(
+            const void * /*unused*/, UErrorCode &status) const {
+        StackUResourceBundle res;
+        UResourceBundle *top = openOlsonResource(fID, res.ref(), status);
+        OlsonTimeZoneData *result = NULL;
+        if (U_SUCCESS(status)) {
+            result = new OlsonTimeZoneData(top, res.getAlias(), fID, status);
+            if (result == NULL) {
+                status = U_MEMORY_ALLOCATION_ERROR;
+            }
+        }
+        ures_close(top);
+        if (U_FAILURE(status)) {
+            delete result;
+            return NULL;
+        }
+        result->addRef();
+        return result;
+    }
+};
+
+OlsonTimeZoneDataKey::~OlsonTimeZoneDataKey() { }
+
 namespace {
 
 void U_CALLCONV initStaticTimeZones() {
@@ -391,23 +449,20 @@ createSystemTimeZone(const UnicodeString& id, UErrorCode& ec) {
     if (U_FAILURE(ec)) {
         return NULL;
     }
-    TimeZone* z = 0;
-    StackUResourceBundle res;
-    U_DEBUG_TZ_MSG(("pre-err=%s\n", u_errorName(ec)));
-    UResourceBundle *top = openOlsonResource(id, res.ref(), ec);
-    U_DEBUG_TZ_MSG(("post-err=%s\n", u_errorName(ec)));
-    if (U_SUCCESS(ec)) {
-        z = new OlsonTimeZone(top, res.getAlias(), id, ec);
-        if (z == NULL) {
-            ec = U_MEMORY_ALLOCATION_ERROR;
-            U_DEBUG_TZ_MSG(("cstz: olson time zone failed to initialize - err %s\n", u_errorName(ec)));
-        }
+    const UnifiedCache *cache = UnifiedCache::getInstance(ec);
+    if (U_FAILURE(ec)) {
+        return NULL;
     }
-    ures_close(top);
+    const OlsonTimeZoneData *data = NULL;
+    cache->get(OlsonTimeZoneDataKey(id), data, ec);
     if (U_FAILURE(ec)) {
         U_DEBUG_TZ_MSG(("cstz: failed to create, err %s\n", u_errorName(ec)));
-        delete z;
-        z = NULL;
+        return NULL;
+    }
+    TimeZone* z = new OlsonTimeZone(data, id);
+    data->removeRef();
+    if (z == NULL) {
+        ec = U_MEMORY_ALLOCATION_ERROR;
     }
     return z;
 }
@@ -0,0 +1,495 @@
+// © 2019 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+//
+//  file:  transbuf.cpp
+//
+//  TransliterationBuffer, the text that Transliterator::transliterate()
+//  works on when it writes its result to a separate output.
+//
+//      The text lives in a gap buffer.  Rules replace text at a cursor that
+//      moves forward through the text, so the gap is nearly always right
+//      where the next replacement happens.
+//
+//      For Edits, each code unit records its origin, and each change records
+//      the range of the source that it replaced.  Writing the text walks it
+//      once, copying runs of unchanged source text straight from the source
+//      and converting only the changed text.
+//
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_TRANSLITERATION
+
+#include "unicode/bytestream.h"
+#include "unicode/edits.h"
+#include "unicode/utf16.h"
+#include "unicode/utf8.h"
+#include "bytesinkutil.h"
+#include "cmemory.h"
+#include "uassert.h"
+#include "transbuf.h"
+
+U_NAMESPACE_BEGIN
+
+TransliterationBuffer::TransliterationBuffer(UBool trackEdits, UErrorCode &errorCode) :
+        fTrackEdits(trackEdits),
+        fText(NULL), fOrigins(NULL), fCapacity(0), fGapStart(0), fGapLength(0),
+        fChanges(errorCode), fSourceLength(0), fSourceOffsets(NULL),
+        fErrorCode(U_ZERO_ERROR) {
+}
+
+TransliterationBuffer::~TransliterationBuffer() {
+    uprv_free(fText);
+    uprv_free(fOrigins);
+    uprv_free(fSourceOffsets);
+}
+
+void TransliterationBuffer::setUTF8(StringPiece src, UErrorCode &errorCode) {
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    const uint8_t *s = (const uint8_t *)src.data();
+    int32_t length = src.length();
+    // At most one UTF-16 code unit per byte.
+    if (!moveGap(0, length)) {
+        errorCode = fErrorCode;
+        return;
+    }
+    if (fTrackEdits) {
+        fSourceOffsets = (int32_t *)uprv_malloc((length + 1) * sizeof(int32_t));
+        if (fSourceOffsets == NULL) {
+            errorCode = U_MEMORY_ALLOCATION_ERROR;
+            return;
+        }
+    }
+    fSource8 = src;
+    int32_t i = 0, j = 0;
+    while (i < length) {
+        int32_t start = i;
+        UChar32 c;
+        U8_NEXT(s, i, length, c);
+        if (c < 0) {
+            // Ill-formed sequence: U+FFFD, changed from the source bytes.
+            fText[j] = 0xfffd;
+            if (fTrackEdits) {
+                fOrigins[j] = ~(fChanges.size() / 2);
+                fChanges.addElement(j, errorCode);
+                fChanges.addElement(j + 1, errorCode);
+                fSourceOffsets[j] = start;
+            }
+            ++j;
+        } else if (fTrackEdits) {
+            int32_t k = j;
+            U16_APPEND_UNSAFE(fText, j, c);
+            for (; k < j; ++k) {
+                fOrigins[k] = k;
+                fSourceOffsets[k] = start;
+            }
+        } else {
+            U16_APPEND_UNSAFE(fText, j, c);
+        }
+    }
+    if (fTrackEdits) {
+        fSourceOffsets[j] = length;
+    }
+    fSourceLength = j;
+    fGapStart = j;
+    fGapLength = fCapacity - j;
+}
+
+void TransliterationBuffer::setUTF16(const UnicodeString &src, UErrorCode &errorCode) {
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    int32_t length = src.length();
+    if (!moveGap(0, length)) {
+        errorCode = fErrorCode;
+        return;
+    }
+    src.extract(0, length, fText);
+    if (fTrackEdits) {
+        for (int32_t i = 0; i < length; ++i) {
+            fOrigins[i] = i;
+        }
+    }
+    fSourceLength = length;
+    fGapStart = length;
+    fGapLength = fCapacity - length;
+}
+
+UBool TransliterationBuffer::moveGap(int32_t index, int32_t minLength) {
+    if (U_FAILURE(fErrorCode)) {
+        return FALSE;
+    }
+    if (fGapLength < minLength) {
+        int32_t length = fCapacity - fGapLength;
+        if (minLength > INT32_MAX - length) {
+            fErrorCode = U_INDEX_OUTOFBOUNDS_ERROR;
+            return FALSE;
+        }
+        int32_t newCapacity = length + minLength;
+        if (newCapacity < 16) {
+            newCapacity = 16;
+        } else if (newCapacity <= INT32_MAX / 2 && newCapacity < 2 * fCapacity) {
+            newCapacity = 2 * fCapacity;
+        }
+        char16_t *newText = (char16_t *)uprv_malloc(newCapacity * sizeof(char16_t));
+        int32_t *newOrigins = NULL;
+        if (fTrackEdits) {
+            newOrigins = (int32_t *)uprv_malloc(newCapacity * sizeof(int32_t));
+        }
+        if (newText == NULL || (fTrackEdits && newOrigins == NULL)) {
+            uprv_free(newText);
+            uprv_free(newOrigins);
+            fErrorCode = U_MEMORY_ALLOCATION_ERROR;
+            return FALSE;
+        }
+        // Copy the text around the gap, with the new gap at index.
+        int32_t newGapLength = newCapacity - length;
+        for (int32_t i = 0; i < length; ++i) {
+            int32_t p = physical(i);
+            int32_t q = i < index ? i : i + newGapLength;
+            newText[q] = fText[p];
+            if (newOrigins != NULL) {
+                newOrigins[q] = fOrigins[p];
+            }
+        }
+        uprv_free(fText);
+        uprv_free(fOrigins);
+        fText = newText;
+        fOrigins = newOrigins;
+        fCapacity = newCapacity;
+        fGapStart = index;
+        fGapLength = newGapLength;
+        return TRUE;
+    }
+    if (index < fGapStart) {
+        // Move the text between index and the gap to the end of the gap.
+        int32_t n = fGapStart - index;
+        uprv_memmove(fText + index + fGapLength, fText + index, n * sizeof(char16_t));
+        if (fTrackEdits) {
+            uprv_memmove(fOrigins + index + fGapLength, fOrigins + index, n * sizeof(int32_t));
+        }
+    } else if (index > fGapStart) {
+        // Move the text between the gap and index to the start of the gap.
+        int32_t n = index - fGapStart;
+        int32_t gapLimit = fGapStart + fGapLength;
+        uprv_memmove(fText + fGapStart, fText + gapLimit, n * sizeof(char16_t));
+        if (fTrackEdits) {
+            uprv_memmove(fOrigins + fGapStart, fOrigins + gapLimit, n * sizeof(int32_t));
+        }
+    }
+    fGapStart = index;
+    return TRUE;
+}
+
+int32_t TransliterationBuffer::getLength() const {
+    return fCapacity - fGapLength;
+}
+
+char16_t TransliterationBuffer::getCharAt(int32_t offset) const {
+    if (0 <= offset && offset < getLength()) {
+        return fText[physical(offset)];
+    }
+    return 0xffff;
+}
+
+UChar32 TransliterationBuffer::getChar32At(int32_t offset) const {
+    int32_t length = getLength();
+    if (offset < 0 || length <= offset) {
+        return 0xffff;
+    }
+    UChar32 c = fText[physical(offset)];
+    if (U16_IS_LEAD(c)) {
+        char16_t c2;
+        if ((offset + 1) < length && U16_IS_TRAIL(c2 = fText[physical(offset + 1)])) {
+            c = U16_GET_SUPPLEMENTARY(c, c2);
+        }
+    } else if (U16_IS_TRAIL(c)) {
+        char16_t c2;
+        if (0 < offset && U16_IS_LEAD(c2 = fText[physical(offset - 1)])) {
+            c = U16_GET_SUPPLEMENTARY(c2, c);
+        }
+    }
+    return c;
+}
+
+void TransliterationBuffer::extractBetween(int32_t start, int32_t limit,
+                                           UnicodeString &target) const {
+    int32_t length = getLength();
+    if (start < 0) {
+        start = 0;
+    }
+    if (limit > length) {
+        limit = length;
+    }
+    target.remove();
+    if (start >= limit) {
+        return;
+    }
+    if (limit <= fGapStart) {
+        target.append(fText + start, limit - start);
+    } else if (start >= fGapStart) {
+        target.append(fText + start + fGapLength, limit - start);
+    } else {
+        target.append(fText + start, fGapStart - start);
+        target.append(fText + fGapStart + fGapLength, limit - fGapStart);
+    }
+}
+
+UBool TransliterationBuffer::isChangeBoundary(int32_t i) const {
+    if (i <= 0 || getLength() <= i) {
+        return TRUE;
+    }
+    int32_t before = originAt(i - 1);
+    int32_t after = originAt(i);
+    if (before < 0) {
+        return before != after;
+    }
+    // Unchanged units have their source text;
+    // keep a surrogate pair from the source together.
+    return !(after == before + 1 &&
+             U16_IS_LEAD(fText[physical(i - 1)]) && U16_IS_TRAIL(fText[physical(i)]));
+}
+
+int32_t TransliterationBuffer::sourceStartAt(int32_t i) const {
+    int32_t origin = originAt(i);
+    return origin >= 0 ? origin : fChanges.elementAti(2 * ~origin);
+}
+
+int32_t TransliterationBuffer::sourceLimitAt(int32_t i) const {
+    int32_t origin = originAt(i);
+    return origin >= 0 ? origin + 1 : fChanges.elementAti(2 * ~origin + 1);
+}
+
+void TransliterationBuffer::handleReplaceBetween(int32_t start, int32_t limit,
+                                                 const UnicodeString &text) {
+    int32_t length = getLength();
+    if (start < 0) {
+        start = 0;
+    }
+    if (limit > length) {
+        limit = length;
+    }
+    if (start > limit) {
+        limit = start;
+    }
+    int32_t textLength = text.length();
+    if (textLength == limit - start) {
+        // Replacing text with the same text is common, for example with
+        // rules that only move the cursor.  Leave it and its origins alone.
+        int32_t i = 0;
+        for (; i < textLength && fText[physical(start + i)] == text.charAt(i); ++i) {}
+        if (i == textLength) {
+            return;
+        }
+    }
+    if (!fTrackEdits) {
+        if (!moveGap(start, textLength - (limit - start))) {
+            return;
+        }
+        fGapLength += limit - start;
+        text.extract(0, textLength, fText + fGapStart);
+        fGapStart += textLength;
+        fGapLength -= textLength;
+        return;
+    }
+
+    // Grow the replacement to whole changes and source surrogate pairs.
+    int32_t newStart = start, newLimit = limit;
+    while (!isChangeBoundary(newStart)) { --newStart; }
+    while (!isChangeBoundary(newLimit)) { ++newLimit; }
+    int32_t srcStart, srcLimit;
+    if (newStart < newLimit) {
+        srcStart = sourceStartAt(newStart);
+        srcLimit = sourceLimitAt(newLimit - 1);
+    } else {
+        // Insertion: the change replaces no source, right after the text before it.
+        srcStart = srcLimit = newStart > 0 ? sourceLimitAt(newStart - 1) : 0;
+    }
+    UnicodeString newText;
+    const UnicodeString *replacement = &text;
+    if (newStart < start || limit < newLimit) {
+        UnicodeString suffix;
+        extractBetween(newStart, start, newText);
+        extractBetween(limit, newLimit, suffix);
+        newText.append(text).append(suffix);
+        replacement = &newText;
+    }
+    int32_t newLength = replacement->length();
+    if (!moveGap(newStart, newLength - (newLimit - newStart))) {
+        return;
+    }
+    fGapLength += newLimit - newStart;
+    if (newLength > 0) {
+        int32_t origin = ~(fChanges.size() / 2);
+        fChanges.addElement(srcStart, fErrorCode);
+        fChanges.addElement(srcLimit, fErrorCode);
+        replacement->extract(0, newLength, fText + fGapStart);
+        for (int32_t i = 0; i < newLength; ++i) {
+            fOrigins[fGapStart + i] = origin;
+        }
+        fGapStart += newLength;
+        fGapLength -= newLength;
+    }
+    // Otherwise the deleted source is simply missing from the text.
+}
+
+void TransliterationBuffer::copy(int32_t start, int32_t limit, int32_t dest) {
+    UnicodeString text;
+    extractBetween(start, limit, text);
+    handleReplaceBetween(dest, dest, text);
+}
+
+UBool TransliterationBuffer::hasMetaData() const {
+    return FALSE;
+}
+
+template<typename Writer>
+void TransliterationBuffer::writeRuns(Writer &writer, UErrorCode &errorCode) {
+    if (U_SUCCESS(errorCode) && U_FAILURE(fErrorCode)) {
+        errorCode = fErrorCode;
+    }
+    int32_t length = getLength();
+    if (U_FAILURE(errorCode) || !moveGap(length, 0)) {
+        return;
+    }
+    if (!fTrackEdits) {
+        writer.change(0, fSourceLength, fText, length, errorCode);
+        return;
+    }
+    // Source text that was deleted next to a change becomes part of it.
+    // A change is written only when the following run shows how far it reaches.
+    int32_t srcIndex = 0;
+    int32_t changeSrcStart = -1;
+    const char16_t *changeText = NULL;
+    int32_t changeLength = 0;
+    for (int32_t i = 0; i < length && U_SUCCESS(errorCode);) {
+        int32_t origin = fOrigins[i];
+        int32_t j = i + 1;
+        if (origin >= 0) {
+            while (j < length && fOrigins[j] == fOrigins[j - 1] + 1) { ++j; }
+            if (changeSrcStart >= 0) {
+                writer.change(changeSrcStart, origin, changeText, changeLength, errorCode);
+                changeSrcStart = -1;
+            } else if (srcIndex < origin) {
+                writer.change(srcIndex, origin, NULL, 0, errorCode);
+            }
+            srcIndex = origin + (j - i);
+            writer.unchanged(origin, srcIndex, fText + i, j - i, errorCode);
+        } else {
+            // One change, or several that share a surrogate pair.
+            while (j < length && fOrigins[j] < 0 &&
+                    (fOrigins[j] == origin ||
+                        (U16_IS_LEAD(fText[j - 1]) && U16_IS_TRAIL(fText[j])))) {
+                origin = fOrigins[j++];
+            }
+            U_ASSERT(srcIndex <= fChanges.elementAti(2 * ~fOrigins[i]));
+            if (changeSrcStart >= 0) {
+                writer.change(changeSrcStart, srcIndex, changeText, changeLength, errorCode);
+            }
+            changeSrcStart = srcIndex;
+            changeText = fText + i;
+            changeLength = j - i;
+            srcIndex = fChanges.elementAti(2 * ~origin + 1);
+        }
+        i = j;
+    }
+    if (changeSrcStart >= 0) {
+        writer.change(changeSrcStart, fSourceLength, changeText, changeLength, errorCode);
+    } else if (srcIndex < fSourceLength) {
+        writer.change(srcIndex, fSourceLength, NULL, 0, errorCode);
+    }
+}
+
+namespace {
+
+class UTF8Writer {
+public:
+    UTF8Writer(const uint8_t *src, const int32_t *offsets, ByteSink &sink, Edits *edits) :
+            fSrc(src), fOffsets(offsets), fSink(sink), fEdits(edits) {}
+
+    void unchanged(int32_t srcStart, int32_t srcLimit,
+                   const char16_t *, int32_t, UErrorCode &errorCode) {
+        const uint8_t *s = fSrc + fOffsets[srcStart];
+        ByteSinkUtil::appendUnchanged(s, fSrc + fOffsets[srcLimit],
+                                      fSink, 0, fEdits, errorCode);
+    }
+
+    void change(int32_t srcStart, int32_t srcLimit,
+                const char16_t *s16, int32_t length, UErrorCode &errorCode) {
+        int32_t oldLength = fOffsets != NULL ? fOffsets[srcLimit] - fOffsets[srcStart] :
+                                               srcLimit - srcStart;
+        if (oldLength > 0 || length > 0) {
+            ByteSinkUtil::appendChange(oldLength, s16, length, fSink, fEdits, errorCode);
+        }
+    }
+
+private:
+    const uint8_t *fSrc;
+    const int32_t *fOffsets;
+    ByteSink &fSink;
+    Edits *fEdits;
+};
+
+class UTF16Writer {
+public:
+    UTF16Writer(UnicodeString &dest, Edits *edits) : fDest(dest), fEdits(edits) {}
+
+    void unchanged(int32_t, int32_t, const char16_t *s16, int32_t length, UErrorCode &) {
+        fDest.append(s16, length);
+        if (fEdits != NULL) {
+            fEdits->addUnchanged(length);
+        }
+    }
+
+    void change(int32_t srcStart, int32_t srcLimit,
+                const char16_t *s16, int32_t length, UErrorCode &) {
+        fDest.append(s16, length);
+        if (fEdits != NULL && (srcStart < srcLimit || length > 0)) {
+            fEdits->addReplace(srcLimit - srcStart, length);
+        }
+    }
+
+private:
+    UnicodeString &fDest;
+    Edits *fEdits;
+};
+
+}  // namespace
+
+void TransliterationBuffer::writeUTF8(ByteSink &sink, Edits *edits, UErrorCode &errorCode) {
+    U_ASSERT(edits == NULL || fTrackEdits);
+    if (U_FAILURE(errorCode) || !moveGap(getLength(), 0)) {
+        return;
+    }
+    // UTF-8 cannot represent unpaired surrogates.
+    // The source had none, so they can only be in changed text.
+    int32_t length = getLength();
+    for (int32_t i = 0; i < length; ++i) {
+        char16_t c = fText[i];
+        if (U16_IS_SURROGATE(c)) {
+            if (U16_IS_SURROGATE_LEAD(c) && (i + 1) < length && U16_IS_TRAIL(fText[i + 1])) {
+                ++i;
+            } else {
+                fText[i] = 0xfffd;
+            }
+        }
+    }
+    UTF8Writer writer((const uint8_t *)fSource8.data(), fSourceOffsets, sink, edits);
+    writeRuns(writer, errorCode);
+}
+
+void TransliterationBuffer::writeUTF16(UnicodeString &dest, Edits *edits,
+                                       UErrorCode &errorCode) {
+    U_ASSERT(edits == NULL || fTrackEdits);
+    UTF16Writer writer(dest, edits);
+    writeRuns(writer, errorCode);
+    if (U_SUCCESS(errorCode) && dest.isBogus()) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+    }
+}
+
+U_NAMESPACE_END
+
+#endif  // !UCONFIG_NO_TRANSLITERATION
@@ -0,0 +1,162 @@
+// © 2019 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+//
+//  file:  transbuf.h
+//
+//  TransliterationBuffer, the text that Transliterator::transliterate()
+//  works on when it writes its result to a separate output.
+//
+
+#ifndef TRANSBUF_H
+#define TRANSBUF_H
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_TRANSLITERATION
+
+#include "unicode/rep.h"
+#include "unicode/stringpiece.h"
+#include "unicode/unistr.h"
+#include "uvectr32.h"
+
+U_NAMESPACE_BEGIN
+
+class ByteSink;
+class Edits;
+
+/**
+ * Replaceable text in a gap buffer, used for transliterating a source
+ * string into a separate output.
+ *
+ * Transliterators replace text at a cursor that moves through the text.
+ * In a UnicodeString each replacement moves the whole rest of the text,
+ * which is quadratic for long texts.  Here the gap stays where the last
+ * change was made, so a replacement only moves the text between the
+ * previous change and this one.
+ *
+ * If edits are tracked, each code unit also records where it came from:
+ * either its index in the source, or the change that produced it.  Each
+ * change covers a range of the source.  A replacement that cuts into a
+ * change, or into a surrogate pair from the source, grows to cover all of
+ * it, so that changes never overlap and the source stays in order.
+ */
+class TransliterationBuffer : public Replaceable {
+public:
+    /**
+     * @param trackEdits whether to record where the text came from,
+     *                   for writing Edits
+     */
+    TransliterationBuffer(UBool trackEdits, UErrorCode &errorCode);
+
+    virtual ~TransliterationBuffer();
+
+    /**
+     * Sets the text to UTF-8 source text.  Ill-formed sequences become
+     * U+FFFD, recorded as changes.  The source must stay valid until
+     * the text has been written.
+     */
+    void setUTF8(StringPiece src, UErrorCode &errorCode);
+
+    /**
+     * Sets the text to UTF-16 source text.
+     */
+    void setUTF16(const UnicodeString &src, UErrorCode &errorCode);
+
+    /**
+     * Writes the text as UTF-8, with unpaired surrogates written as
+     * U+FFFD, and records its differences from the UTF-8 source in edits.
+     * @param edits Edits to append to, or NULL; requires trackEdits
+     */
+    void writeUTF8(ByteSink &sink, Edits *edits, UErrorCode &errorCode);
+
+    /**
+     * Appends the text to dest, and records its differences from the
+     * UTF-16 source in edits.
+     * @param edits Edits to append to, or NULL; requires trackEdits
+     */
+    void writeUTF16(UnicodeString &dest, Edits *edits, UErrorCode &errorCode);
+
+    virtual void extractBetween(int32_t start, int32_t limit,
+                                UnicodeString &target) const;
+
+    virtual void handleReplaceBetween(int32_t start, int32_t limit,
+                                      const UnicodeString &text);
+
+    virtual void copy(int32_t start, int32_t limit, int32_t dest);
+
+    virtual UBool hasMetaData() const;
+
+protected:
+    virtual int32_t getLength() const;
+
+    virtual char16_t getCharAt(int32_t offset) const;
+
+    virtual UChar32 getChar32At(int32_t offset) const;
+
+private:
+    TransliterationBuffer(const TransliterationBuffer &other);  // forbid copying of this class
+    TransliterationBuffer &operator=(const TransliterationBuffer &other);  // forbid copying of this class
+
+    /** Physical index of the code unit at logical index i. */
+    inline int32_t physical(int32_t i) const {
+        return i < fGapStart ? i : i + fGapLength;
+    }
+
+    inline int32_t originAt(int32_t i) const {
+        return fOrigins[physical(i)];
+    }
+
+    /** Moves the gap to index and makes it at least minLength long. */
+    UBool moveGap(int32_t index, int32_t minLength);
+
+    /** Whether a change may start or end between units i-1 and i. */
+    UBool isChangeBoundary(int32_t i) const;
+
+    /** Source index where the source of the unit at i starts or ends. */
+    int32_t sourceStartAt(int32_t i) const;
+    int32_t sourceLimitAt(int32_t i) const;
+
+    /** Offset in the source string of the source unit at index. */
+    inline int32_t sourceOffset(int32_t index) const {
+        return fSourceOffsets != NULL ? fSourceOffsets[index] : index;
+    }
+
+    /**
+     * Calls back for each run of the text: a run of unchanged text, or one
+     * change, with its range in the source string and its units.
+     */
+    template<typename Writer>
+    void writeRuns(Writer &writer, UErrorCode &errorCode);
+
+    UBool fTrackEdits;
+    /** Text in a gap buffer of fCapacity units. */
+    char16_t *fText;
+    /**
+     * Parallel to fText if edits are tracked, otherwise NULL:
+     * the source index of an unchanged unit, or ~n for a unit from change n.
+     */
+    int32_t *fOrigins;
+    int32_t fCapacity;
+    int32_t fGapStart;
+    int32_t fGapLength;
+
+    /** Source range of each change, as pairs of source indexes. */
+    UVector32 fChanges;
+    /** Number of source units. */
+    int32_t fSourceLength;
+    /**
+     * For a UTF-8 source: the byte offset of each source unit, and of the
+     * end.  NULL for a UTF-16 source, where the two are the same.
+     */
+    int32_t *fSourceOffsets;
+    /** UTF-8 source, for copying unchanged text. */
+    StringPiece fSource8;
+
+    /** Memory allocation errors from the Replaceable functions. */
+    UErrorCode fErrorCode;
+};
+
+U_NAMESPACE_END
+
+#endif  // !UCONFIG_NO_TRANSLITERATION
+#endif  // TRANSBUF_H
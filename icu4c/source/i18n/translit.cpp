@@ -27,6 +27,8 @@
 #include "unicode/uscript.h"
 #include "unicode/strenum.h"
 #include "unicode/utf16.h"
+#include "unicode/bytestream.h"
+#include "unicode/edits.h"
 #include "cpdtrans.h"
 #include "nultrans.h"
 #include "rbt_data.h"
@@ -44,10 +46,14 @@
 #include "esctrn.h"
 #include "unesctrn.h"
 #include "tridpars.h"
+#include "transbuf.h"
 #include "anytrans.h"
 #include "util.h"
 #include "hash.h"
 #include "mutex.h"
+#include "sharedobject.h"
+#include "umutex.h"
+#include "unifiedcache.h"
 #include "ucln_in.h"
 #include "uassert.h"
 #include "cmemory.h"
@@ -102,6 +108,12 @@ static icu::TransliteratorRegistry* registry = 0;
 // MUTEX. Avoids function call when registry is initialized.
 #define HAVE_REGISTRY(status) (registry!=0 || initializeRegistry(status))
 
+/**
+ * Incremented whenever the registry is changed through the public API,
+ * so that createInstance() stops using instances cached before then.
+ */
+static icu::u_atomic_int32_t gRegistryGeneration(0);
+
 U_NAMESPACE_BEGIN
 
 UOBJECT_DEFINE_ABSTRACT_RTTI_IMPLEMENTATION(Transliterator)
@@ -213,6 +225,47 @@ void Transliterator::transliterate(Replaceable& text) const {
     transliterate(text, 0, text.length());
 }
 
+void Transliterator::transliterate(StringPiece src, ByteSink &sink, Edits *edits,
+                                   UErrorCode &errorCode) const {
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    if (edits != NULL) {
+        edits->reset();
+    }
+    TransliterationBuffer text(edits != NULL, errorCode);
+    text.setUTF8(src, errorCode);
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    transliterate(text, 0, text.length());
+    text.writeUTF8(sink, edits, errorCode);
+    sink.Flush();
+    if (U_SUCCESS(errorCode) && edits != NULL) {
+        edits->copyErrorTo(errorCode);
+    }
+}
+
+void Transliterator::transliterate(const UnicodeString &src, UnicodeString &dest, Edits *edits,
+                                   UErrorCode &errorCode) const {
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    if (edits != NULL) {
+        edits->reset();
+    }
+    TransliterationBuffer text(edits != NULL, errorCode);
+    text.setUTF16(src, errorCode);
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    transliterate(text, 0, text.length());
+    text.writeUTF16(dest, edits, errorCode);
+    if (U_SUCCESS(errorCode) && edits != NULL) {
+        edits->copyErrorTo(errorCode);
+    }
+}
+
 /**
  * Transliterates the portion of the text buffer that can be
  * transliterated unambiguosly after new text has been inserted,
@@ -896,6 +949,86 @@ Transliterator::createInstance(const UnicodeString& ID,
     return createInstance(ID, dir, parseError, status);
 }
 
+/**
+ * A transliterator shared through the UnifiedCache.  It is never used
+ * to transliterate; createInstance() returns clones of it.
+ */
+class SharedTransliterator : public SharedObject {
+public:
+    Transliterator *ptr;
+    SharedTransliterator(Transliterator *adopted) : ptr(adopted) { }
+    virtual ~SharedTransliterator();
+private:
+    SharedTransliterator(const SharedTransliterator &);
+    SharedTransliterator &operator=(const SharedTransliterator &);
+};
+
+SharedTransliterator::~SharedTransliterator() {
+    delete ptr;
+}
+
+/**
+ * UnifiedCache key for createInstance(): the ID as given, the direction,
+ * and the registry generation, since the result depends on what is
+ * registered.
+ */
+class TransliteratorCacheKey : public CacheKey<SharedTransliterator> {
+private:
+    UnicodeString fID;
+    UTransDirection fDir;
+    int32_t fGeneration;
+public:
+    TransliteratorCacheKey(const UnicodeString &id, UTransDirection dir, int32_t generation)
+            : fID(id), fDir(dir), fGeneration(generation) { }
+    TransliteratorCacheKey(const TransliteratorCacheKey &other)
+            : CacheKey<SharedTransliterator>(other), fID(other.fID), fDir(other.fDir),
+              fGeneration(other.fGeneration) { }
+    virtual ~TransliteratorCacheKey();
+    virtual int32_t hashCode() const {
+        return (int32_t)(37u * (37u * (uint32_t)CacheKey<SharedTransliterator>::hashCode() +
+                                (uint32_t)fID.hashCode()) +
+                         (uint32_t)(fGeneration * 2 + fDir));
+    }
+    virtual UBool operator==(const CacheKeyBase &other) const {
+        if (this == &other) {
+            return TRUE;
+        }
+        if (!CacheKey<SharedTransliterator>::operator==(other)) {
+            return FALSE;
+        }
+        // We know that this and other are of same class if we get this far.
+        const TransliteratorCacheKey &that = static_cast<const TransliteratorCacheKey &>(other);
+        return fDir == that.fDir && fGeneration == that.fGeneration && fID == that.fID;
+    }
+    virtual CacheKeyBase *clone() const {
+        return new TransliteratorCacheKey(*this);
+    }
+    virtual char *writeDescription(char *buffer, int32_t bufLen) const {
+        fID.extract(0, fID.length(), buffer, bufLen, US_INV);
+        buffer[bufLen - 1] = 0;
+        return buffer;
+    }
+    virtual const SharedTransliterator *createObject(
+            const void * /*unused*/, UErrorCode &status) const {
+        UParseError parseError;
+        Transliterator *t = Transliterator::createUncachedInstance(fID, fDir, parseError, status);
+        if (U_FAILURE(status)) {
+            delete t;
+            return NULL;
+        }
+        SharedTransliterator *result = new SharedTransliterator(t);
+        if (result == NULL) {
+            delete t;
+            status = U_MEMORY_ALLOCATION_ERROR;
+            return NULL;
+        }
+        result->addRef();
+        return result;
+    }
+};
+
+TransliteratorCacheKey::~TransliteratorCacheKey() { }
+
 /**
  * Returns a <code>Transliterator</code> object given its ID.
  * The ID must be either a system transliterator ID or a ID registered
@@ -910,13 +1043,45 @@ Transliterator::createInstance(const UnicodeString& ID,
 Transliterator* U_EXPORT2
 Transliterator::createInstance(const UnicodeString& ID,
                                 UTransDirection dir,
-                                UParseError& parseError,
+                                UParseError& /*parseError*/,
                                 UErrorCode& status)
 {
     if (U_FAILURE(status)) {
         return 0;
     }
 
+    const UnifiedCache *cache = UnifiedCache::getInstance(status);
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    const SharedTransliterator *shared = NULL;
+    TransliteratorCacheKey key(ID, dir, umtx_loadAcquire(gRegistryGeneration));
+    cache->get(key, shared, status);
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    const Transliterator* prototype = shared->ptr;
+    Transliterator* t = prototype->clone();
+    if (t != NULL) {
+        // Some clone() implementations start over with their default ID
+        // and no filter, while createInstance() sets both.
+        t->setID(prototype->getID());
+        if (t->getFilter() == NULL && prototype->getFilter() != NULL) {
+            t->adoptFilter((UnicodeFilter*) prototype->getFilter()->clone());
+        }
+    } else {
+        status = U_MEMORY_ALLOCATION_ERROR;
+    }
+    shared->removeRef();
+    return t;
+}
+
+Transliterator*
+Transliterator::createUncachedInstance(const UnicodeString& ID,
+                                       UTransDirection dir,
+                                       UParseError& parseError,
+                                       UErrorCode& status)
+{
     UnicodeString canonID;
     UVector list(status);
     if (U_FAILURE(status)) {
@@ -1216,6 +1381,7 @@ void U_EXPORT2 Transliterator::registerFactory(const UnicodeString& id,
     UErrorCode ec = U_ZERO_ERROR;
     if (HAVE_REGISTRY(ec)) {
         _registerFactory(id, factory, context);
+        umtx_atomic_inc(&gRegistryGeneration);
     }
 }
 
@@ -1255,6 +1421,7 @@ void U_EXPORT2 Transliterator::registerInstance(Transliterator* adoptedPrototype
     UErrorCode ec = U_ZERO_ERROR;
     if (HAVE_REGISTRY(ec)) {
         _registerInstance(adoptedPrototype);
+        umtx_atomic_inc(&gRegistryGeneration);
     }
 }
 
@@ -1269,6 +1436,7 @@ void U_EXPORT2 Transliterator::registerAlias(const UnicodeString& aliasID,
     UErrorCode ec = U_ZERO_ERROR;
     if (HAVE_REGISTRY(ec)) {
         _registerAlias(aliasID, realID);
+        umtx_atomic_inc(&gRegistryGeneration);
     }
 }
 
@@ -1291,6 +1459,7 @@ void U_EXPORT2 Transliterator::unregister(const UnicodeString& ID) {
     UErrorCode ec = U_ZERO_ERROR;
     if (HAVE_REGISTRY(ec)) {
         registry->remove(ID);
+        umtx_atomic_inc(&gRegistryGeneration);
     }
 }
 
@@ -1500,61 +1669,13 @@ UBool Transliterator::initializeRegistry(UErrorCode &status) {
      */
     //static const char translit_index[] = "translit_index";
 
-    UResourceBundle *bundle, *transIDs, *colBund;
+    // The entries are created on demand from the index, see
+    // TransliteratorRegistry::adoptStaticIndex().
+    UResourceBundle *bundle, *transIDs;
     bundle = ures_open(U_ICUDATA_TRANSLIT, NULL/*open default locale*/, &status);
     transIDs = ures_getByKey(bundle, RB_RULE_BASED_IDS, 0, &status);
-    const UnicodeString T_PART = UNICODE_STRING_SIMPLE("-t-");
-
-    int32_t row, maxRows;
-    if (U_SUCCESS(status)) {
-        maxRows = ures_getSize(transIDs);
-        for (row = 0; row < maxRows; row++) {
-            colBund = ures_getByIndex(transIDs, row, 0, &status);
-            if (U_SUCCESS(status)) {
-                UnicodeString id(ures_getKey(colBund), -1, US_INV);
-                if(id.indexOf(T_PART) != -1) {
-                    ures_close(colBund);
-                    continue;
-                }
-                UResourceBundle* res = ures_getNextResource(colBund, NULL, &status);
-                const char* typeStr = ures_getKey(res);
-                UChar type;
-                u_charsToUChars(typeStr, &type, 1);
-
-                if (U_SUCCESS(status)) {
-                    int32_t len = 0;
-                    const UChar *resString;
-                    switch (type) {
-                    case 0x66: // 'f'
-                    case 0x69: // 'i'
-                        // 'file' or 'internal';
-                        // row[2]=resource, row[3]=direction
-                        {
-                            
-                            resString = ures_getStringByKey(res, "resource", &len, &status);
-                            UBool visible = (type == 0x0066 /*f*/);
-                            UTransDirection dir = 
-                                (ures_getUnicodeStringByKey(res, "direction", &status).charAt(0) ==
-                                 0x0046 /*F*/) ?
-                                UTRANS_FORWARD : UTRANS_REVERSE;
-                            registry->put(id, UnicodeString(TRUE, resString, len), dir, TRUE, visible, status);
-                        }
-                        break;
-                    case 0x61: // 'a'
-                        // 'alias'; row[2]=createInstance argument
-                        resString = ures_getString(res, &len, &status);
-                        registry->put(id, UnicodeString(TRUE, resString, len), TRUE, TRUE, status);
-                        break;
-                    }
-                }
-                ures_close(res);
-            }
-            ures_close(colBund);
-        }
-    }
-
-    ures_close(transIDs);
     ures_close(bundle);
+    registry->adoptStaticIndex(transIDs, status);
 
     // Manually add prototypes that the system knows about to the
     // cache.  This is how new non-rule-based transliterators are
@@ -1640,6 +1761,7 @@ U_CFUNC UBool utrans_transliterator_cleanup(void) {
         delete registry;
         registry = NULL;
     }
+    umtx_atomic_inc(&gRegistryGeneration);
     return TRUE;
 }
 
@@ -26,7 +26,10 @@
 #include "rbt_pars.h"
 #include "tridpars.h"
 #include "charstr.h"
+#include "cstring.h"
+#include "uarrsort.h"
 #include "uassert.h"
+#include "uresimp.h"
 #include "locutil.h"
 
 // Enable the following symbol to add debugging code that tracks the
@@ -536,7 +539,10 @@ TransliteratorRegistry::TransliteratorRegistry(UErrorCode& status) :
     registry(TRUE, status),
     specDAG(TRUE, SPECDAG_INIT_SIZE, status),
     variantList(VARIANT_LIST_INIT_SIZE, status),
-    availableIDs(AVAILABLE_IDS_INIT_SIZE, status)
+    availableIDs(AVAILABLE_IDS_INIT_SIZE, status),
+    staticIndex(NULL),
+    staticItemCount(0),
+    staticIDsLoaded(TRUE)
 {
     registry.setValueDeleter(deleteEntry);
     variantList.setDeleter(uprv_deleteUObject);
@@ -551,7 +557,7 @@ TransliteratorRegistry::TransliteratorRegistry(UErrorCode& status) :
 }
 
 TransliteratorRegistry::~TransliteratorRegistry() {
-    // Through the magic of C++, everything cleans itself up
+    ures_close(staticIndex);
 }
 
 Transliterator* TransliteratorRegistry::get(const UnicodeString& ID,
@@ -714,9 +720,87 @@ void TransliteratorRegistry::remove(const UnicodeString& ID) {
     TransliteratorIDParser::STVtoID(source, target, variant, id);
     registry.remove(id);
     removeSTV(source, target, variant);
+    maskStaticItem(id, FALSE);
     availableIDs.removeElement((void*) &id);
 }
 
+U_CDECL_BEGIN
+static int32_t U_CALLCONV
+compareStaticItems(const void * /*context*/, const void *left, const void *right) {
+    // The key is the first field of a StaticItem.
+    return uprv_stricmp(*(const char * const *)left, *(const char * const *)right);
+}
+U_CDECL_END
+
+void TransliteratorRegistry::adoptStaticIndex(UResourceBundle* adoptedIndex,
+                                              UErrorCode& ec) {
+    U_ASSERT(staticIndex == NULL);
+    staticIndex = adoptedIndex;
+    if (U_FAILURE(ec)) {
+        return;
+    }
+    int32_t rowCount = ures_getSize(staticIndex);
+    if (rowCount <= 0) {
+        return;
+    }
+    if (staticItems.allocateInsteadAndReset(rowCount) == NULL) {
+        ec = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+
+    // Register the specs of the visible IDs now, in index order, so that
+    // the spec DAG and the variant list come out as if each entry had been
+    // put() here.  The entries themselves are created on demand by
+    // findInRegistry(), and the IDs are added by loadStaticIDs().
+    StackUResourceBundle row, res;
+    UnicodeString source, target, variant, id, canonID;
+    UBool sawSource;
+    int32_t count = 0;
+    for (int32_t i = 0; i < rowCount; ++i) {
+        ures_getByIndex(staticIndex, i, row.getAlias(), &ec);
+        ures_getByIndex(row.getAlias(), 0, res.getAlias(), &ec);
+        if (U_FAILURE(ec)) {
+            return;
+        }
+        const char* key = ures_getKey(row.getAlias());
+        if (uprv_strstr(key, "-t-") != NULL) {
+            continue;
+        }
+        // 'file' and 'alias' are visible, 'internal' is not.
+        char type = *ures_getKey(res.getAlias());
+        if (type != 'f' && type != 'a' && type != 'i') {
+            continue;
+        }
+        UBool visible = (type != 'i');
+        id = UnicodeString(key, -1, US_INV);
+        TransliteratorIDParser::IDtoSTV(id, source, target, variant, sawSource);
+        TransliteratorIDParser::STVtoID(source, target, variant, canonID);
+        if (id != canonID) {
+            // Only canonical IDs can be looked up in the index.
+            TransliteratorEntry* entry = createStaticEntry(row.getAlias(), ec);
+            if (entry == NULL) {
+                return;
+            }
+            registerEntry(canonID, source, target, variant, entry, visible);
+            continue;
+        }
+        if (visible) {
+            registerSTV(source, target, variant);
+        }
+        StaticItem& item = staticItems[count++];
+        item.key = key;
+        item.row = i;
+        item.visible = visible;
+        item.masked = FALSE;
+    }
+    uprv_sortArray(staticItems.getAlias(), count, (int32_t)sizeof(StaticItem),
+                   compareStaticItems, NULL, FALSE, &ec);
+    if (U_SUCCESS(ec)) {
+        staticItemCount = count;
+        staticIDsLoaded = FALSE;
+    }
+}
+
 //----------------------------------------------------------------------
 // class TransliteratorRegistry: Public ID and spec management
 //----------------------------------------------------------------------
@@ -727,7 +811,8 @@ void TransliteratorRegistry::remove(const UnicodeString& ID) {
  * To retrieve the actual IDs, call getAvailableID(i) with
  * i from 0 to countAvailableIDs() - 1.
  */
-int32_t TransliteratorRegistry::countAvailableIDs(void) const {
+int32_t TransliteratorRegistry::countAvailableIDs(void) {
+    loadStaticIDs();
     return availableIDs.size();
 }
 
@@ -737,14 +822,16 @@ int32_t TransliteratorRegistry::countAvailableIDs(void) const {
  * and countAvailableIDs() - 1, inclusive.  If index is out of
  * range, the result of getAvailableID(0) is returned.
  */
-const UnicodeString& TransliteratorRegistry::getAvailableID(int32_t index) const {
+const UnicodeString& TransliteratorRegistry::getAvailableID(int32_t index) {
+    loadStaticIDs();
     if (index < 0 || index >= availableIDs.size()) {
         index = 0;
     }
     return *(const UnicodeString*) availableIDs[index];
 }
 
-StringEnumeration* TransliteratorRegistry::getAvailableIDs() const {
+StringEnumeration* TransliteratorRegistry::getAvailableIDs() {
+    loadStaticIDs();
     return new Enumeration(*this);
 }
 
@@ -943,9 +1030,11 @@ void TransliteratorRegistry::registerEntry(const UnicodeString& ID,
                                            UBool visible) {
     UErrorCode status = U_ZERO_ERROR;
     registry.put(ID, adopted, status);
+    // An index ID not yet in availableIDs keeps its index position.
+    UBool deferred = maskStaticItem(ID, visible);
     if (visible) {
         registerSTV(source, target, variant);
-        if (!availableIDs.contains((void*) &ID)) {
+        if (!deferred && !availableIDs.contains((void*) &ID)) {
             UnicodeString *newID = (UnicodeString *)ID.clone();
             // Check to make sure newID was created.
             if (newID != NULL) {
@@ -1039,6 +1128,171 @@ void TransliteratorRegistry::removeSTV(const UnicodeString& source,
     }
 }
 
+/**
+ * Return the index of the static index item for the given canonical
+ * ID, or -1 if there is none.  Like the registry Hashtable, this
+ * ignores case.
+ */
+int32_t TransliteratorRegistry::findInStaticIndex(const UnicodeString& ID) const {
+    if (staticItemCount == 0) {
+        return -1;
+    }
+    UErrorCode status = U_ZERO_ERROR;
+    CharString key;
+    key.appendInvariantChars(ID, status);
+    if (U_FAILURE(status)) {
+        // not an invariant-character ID
+        return -1;
+    }
+    int32_t start = 0;
+    int32_t limit = staticItemCount;
+    while (start < limit) {
+        int32_t i = (start + limit) / 2;
+        int32_t cmp = uprv_stricmp(key.data(), staticItems[i].key);
+        if (cmp == 0) {
+            return i;
+        } else if (cmp < 0) {
+            limit = i;
+        } else {
+            start = i + 1;
+        }
+    }
+    return -1;
+}
+
+/**
+ * Create an entry from a row of the static index.  Return 0 if the
+ * row is malformed.
+ *
+ * Caller owns the returned object.
+ */
+TransliteratorEntry* TransliteratorRegistry::createStaticEntry(UResourceBundle* row,
+                                                               UErrorCode& status) const {
+    StackUResourceBundle res;
+    ures_getByIndex(row, 0, res.getAlias(), &status);
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    TransliteratorEntry *entry = new TransliteratorEntry();
+    if (entry == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return NULL;
+    }
+    int32_t len = 0;
+    const UChar *resString;
+    switch (*ures_getKey(res.getAlias())) {
+    case 'f':
+    case 'i':
+        // 'file' or 'internal': resource name and direction
+        {
+            resString = ures_getStringByKey(res.getAlias(), "resource", &len, &status);
+            int32_t dirLen = 0;
+            const UChar *dir = ures_getStringByKey(res.getAlias(), "direction", &dirLen, &status);
+            if (U_SUCCESS(status)) {
+                entry->entryType = (dir[0] == 0x0046 /*F*/) ? TransliteratorEntry::RULES_FORWARD
+                    : TransliteratorEntry::RULES_REVERSE;
+                entry->stringArg.setTo(TRUE, resString, len);
+            }
+        }
+        break;
+    case 'a':
+        // 'alias': createInstance argument
+        resString = ures_getString(res.getAlias(), &len, &status);
+        if (U_SUCCESS(status)) {
+            entry->entryType = TransliteratorEntry::ALIAS;
+            entry->stringArg.setTo(TRUE, resString, len);
+        }
+        break;
+    default:
+        status = U_INVALID_FORMAT_ERROR;
+        break;
+    }
+    if (U_FAILURE(status)) {
+        delete entry;
+        return NULL;
+    }
+    return entry;
+}
+
+/**
+ * Look up an entry by canonical ID in the dynamic store, creating it
+ * from the static index the first time.  Return 0 on failure.
+ *
+ * Caller does NOT own returned object.
+ */
+TransliteratorEntry* TransliteratorRegistry::findInRegistry(const UnicodeString& ID) {
+    TransliteratorEntry *entry = (TransliteratorEntry*) registry.get(ID);
+    if (entry != NULL) {
+        return entry;
+    }
+    int32_t i = findInStaticIndex(ID);
+    if (i < 0 || staticItems[i].masked) {
+        return NULL;
+    }
+    UErrorCode status = U_ZERO_ERROR;
+    StackUResourceBundle row;
+    ures_getByIndex(staticIndex, staticItems[i].row, row.getAlias(), &status);
+    entry = createStaticEntry(row.getAlias(), status);
+    if (entry == NULL) {
+        return NULL;
+    }
+    staticItems[i].masked = TRUE;
+    registry.put(UnicodeString(staticItems[i].key, -1, US_INV), entry, status);
+    return U_SUCCESS(status) ? entry : NULL;
+}
+
+/**
+ * The dynamic store is taking over the given ID.  If it is in the
+ * static index, mask the index item and record the ID's visibility.
+ * Return TRUE if the item then stands in for the ID in availableIDs,
+ * which is the case until loadStaticIDs() has run.
+ */
+UBool TransliteratorRegistry::maskStaticItem(const UnicodeString& ID, UBool visible) {
+    int32_t i = findInStaticIndex(ID);
+    if (i < 0) {
+        return FALSE;
+    }
+    staticItems[i].masked = TRUE;
+    staticItems[i].visible = visible;
+    return !staticIDsLoaded;
+}
+
+/**
+ * Add the visible static index IDs to availableIDs, ahead of all
+ * others and in index order, as though they had been registered
+ * first.
+ */
+void TransliteratorRegistry::loadStaticIDs() {
+    if (staticIDsLoaded) {
+        return;
+    }
+    staticIDsLoaded = TRUE;
+    int32_t rowCount = ures_getSize(staticIndex);
+    LocalMemory<const StaticItem*> byRow;
+    if (byRow.allocateInsteadAndReset(rowCount) == NULL) {
+        return;
+    }
+    for (int32_t i = 0; i < staticItemCount; ++i) {
+        if (staticItems[i].visible) {
+            byRow[staticItems[i].row] = &staticItems[i];
+        }
+    }
+    UErrorCode status = U_ZERO_ERROR;
+    int32_t insertIndex = 0;
+    for (int32_t row = 0; row < rowCount; ++row) {
+        if (byRow[row] == NULL) {
+            continue;
+        }
+        UnicodeString *newID = new UnicodeString(byRow[row]->key, -1, US_INV);
+        if (newID == NULL) {
+            return;
+        }
+        // NUL-terminate the ID string
+        newID->getTerminatedBuffer();
+        availableIDs.insertElementAt(newID, insertIndex++, status);
+    }
+}
+
 /**
  * Attempt to find a source-target/variant in the dynamic registry
  * store.  Return 0 on failure.
@@ -1047,10 +1301,10 @@ void TransliteratorRegistry::removeSTV(const UnicodeString& source,
  */
 TransliteratorEntry* TransliteratorRegistry::findInDynamicStore(const TransliteratorSpec& src,
                                                   const TransliteratorSpec& trg,
-                                                  const UnicodeString& variant) const {
+                                                  const UnicodeString& variant) {
     UnicodeString ID;
     TransliteratorIDParser::STVtoID(src, trg, variant, ID);
-    TransliteratorEntry *e = (TransliteratorEntry*) registry.get(ID);
+    TransliteratorEntry *e = findInRegistry(ID);
     DEBUG_useEntry(e);
     return e;
 }
@@ -1224,7 +1478,7 @@ TransliteratorEntry* TransliteratorRegistry::find(UnicodeString& source,
     // ICU ticket #8089
     UnicodeString ID;
     TransliteratorIDParser::STVtoID(source, target, variant, ID);
-    entry = (TransliteratorEntry*) registry.get(ID);
+    entry = findInRegistry(ID);
     if (entry != 0) {
         // std::string ss;
         // std::cout << ID.toUTF8String(ss) << std::endl;
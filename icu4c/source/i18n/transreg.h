@@ -18,6 +18,8 @@
 
 #include "unicode/uobject.h"
 #include "unicode/translit.h"
+#include "unicode/ures.h"
+#include "cmemory.h"
 #include "hash.h"
 #include "uvector.h"
 
@@ -249,6 +251,19 @@ class TransliteratorRegistry : public UMemory {
      */
     void remove(const UnicodeString& ID);
 
+    /**
+     * Register the system transliterators listed in the given index
+     * table (translit/root RuleBasedTransliteratorIDs), adopting the
+     * bundle.  Only their specs are registered up front; the entries
+     * themselves are created from the index the first time they are
+     * looked up, and their IDs are added to the list of available IDs
+     * the first time it is requested.  Registering or removing one of
+     * these IDs later masks the index entry, as with any other entry.
+     * Must be called before any other registration.
+     */
+    void adoptStaticIndex(UResourceBundle* adoptedIndex,
+                          UErrorCode& ec);
+
     //------------------------------------------------------------------
     // Public ID and spec management
     //------------------------------------------------------------------
@@ -258,7 +273,7 @@ class TransliteratorRegistry : public UMemory {
      * with the system.
      * @internal
      */
-    StringEnumeration* getAvailableIDs() const;
+    StringEnumeration* getAvailableIDs();
 
     /**
      * == OBSOLETE - remove in ICU 3.4 ==
@@ -268,7 +283,7 @@ class TransliteratorRegistry : public UMemory {
      * @return the number of IDs currently registered with the system.
      * @internal
      */
-    int32_t countAvailableIDs(void) const;
+    int32_t countAvailableIDs(void);
 
     /**
      * == OBSOLETE - remove in ICU 3.4 ==
@@ -281,7 +296,7 @@ class TransliteratorRegistry : public UMemory {
      *         range, the result of getAvailableID(0) is returned.
      * @internal
      */
-    const UnicodeString& getAvailableID(int32_t index) const;
+    const UnicodeString& getAvailableID(int32_t index);
 
     /**
      * Return the number of registered source specifiers.
@@ -363,13 +378,24 @@ class TransliteratorRegistry : public UMemory {
 
     TransliteratorEntry* find(const UnicodeString& ID);
 
+    TransliteratorEntry* findInRegistry(const UnicodeString& ID);
+
+    int32_t findInStaticIndex(const UnicodeString& ID) const;
+
+    TransliteratorEntry* createStaticEntry(UResourceBundle* row,
+                                           UErrorCode& status) const;
+
+    UBool maskStaticItem(const UnicodeString& ID, UBool visible);
+
+    void loadStaticIDs();
+
     TransliteratorEntry* find(UnicodeString& source,
                 UnicodeString& target,
                 UnicodeString& variant);
 
     TransliteratorEntry* findInDynamicStore(const TransliteratorSpec& src,
                               const TransliteratorSpec& trg,
-                              const UnicodeString& variant) const;
+                              const UnicodeString& variant);
 
     TransliteratorEntry* findInStaticStore(const TransliteratorSpec& src,
                              const TransliteratorSpec& trg,
@@ -450,10 +476,37 @@ class TransliteratorRegistry : public UMemory {
     UVector variantList;
 
     /**
-     * Vector of public full IDs.
+     * Vector of public full IDs.  Until loadStaticIDs() has run, this
+     * omits the IDs from the static index.
      */
     UVector availableIDs;
 
+    /**
+     * One item per ID in the static index, sorted case-insensitively
+     * by key.  The key points into the index resource data.  Once an
+     * item is masked, the dynamic store has taken over its ID, either
+     * because the entry was created from the index or because the ID
+     * was registered or removed.
+     */
+    struct StaticItem {
+        const char* key;   // must be first, see compareStaticItems()
+        int32_t row;
+        UBool visible;
+        UBool masked;
+    };
+
+    /**
+     * The static index table, or NULL.  Kept open so that the item
+     * keys and entry strings stay valid.
+     */
+    UResourceBundle* staticIndex;
+
+    LocalMemory<StaticItem> staticItems;
+
+    int32_t staticItemCount;
+
+    UBool staticIDsLoaded;
+
     TransliteratorRegistry(const TransliteratorRegistry &other); // forbid copying of this class
     TransliteratorRegistry &operator=(const TransliteratorRegistry &other); // forbid copying of this class
 };
@@ -19,12 +19,15 @@
 #include "unicode/ustring.h"
 #include "unicode/timezone.h"
 #include "unicode/utf16.h"
+#include "unicode/ucharstrie.h"
+#include "unicode/ucharstriebuilder.h"
 
 #include "tznames_impl.h"
 #include "bytesinkutil.h"
 #include "charstr.h"
 #include "cmemory.h"
 #include "cstring.h"
+#include "hash.h"
 #include "uassert.h"
 #include "mutex.h"
 #include "resource.h"
@@ -175,15 +178,16 @@ TextTrieMapSearchResultHandler::~TextTrieMapSearchResultHandler(){
 // ---------------------------------------------------
 TextTrieMap::TextTrieMap(UBool ignoreCase, UObjectDeleter *valueDeleter)
 : fIgnoreCase(ignoreCase), fNodes(NULL), fNodesCapacity(0), fNodesCount(0), 
-  fLazyContents(NULL), fIsEmpty(TRUE), fValueDeleter(valueDeleter) {
+  fLazyContents(NULL), fFrozenContentsCount(0), fTrieContentsCount(0), fIsEmpty(TRUE),
+  fValueDeleter(valueDeleter), fFrozenValues(NULL), fFrozenValuesCount(0) {
 }
 
 TextTrieMap::~TextTrieMap() {
-    int32_t index;
-    for (index = 0; index < fNodesCount; ++index) {
-        fNodes[index].deleteValues(fValueDeleter);
+    deleteNodes();
+    for (int32_t index = 0; index < fFrozenValuesCount; ++index) {
+        fFrozenValues[index].deleteValues(NULL);
     }
-    uprv_free(fNodes);
+    uprv_free(fFrozenValues);
     if (fLazyContents != NULL) {
         for (int32_t i=0; i<fLazyContents->size(); i+=2) {
             if (fValueDeleter) {
@@ -194,6 +198,17 @@ TextTrieMap::~TextTrieMap() {
     }
 }
 
+void TextTrieMap::deleteNodes() {
+    // The nodes only refer to the values, which are owned by fLazyContents.
+    for (int32_t index = 0; index < fNodesCount; ++index) {
+        fNodes[index].deleteValues(NULL);
+    }
+    uprv_free(fNodes);
+    fNodes = NULL;
+    fNodesCapacity = 0;
+    fNodesCount = 0;
+}
+
 int32_t TextTrieMap::isEmpty() const {
     // Use a separate field for fIsEmpty because it will remain unchanged once the
     //   Trie is built, while fNodes and fLazyContents change with the lazy init
@@ -226,21 +241,21 @@ TextTrieMap::put(const UChar *key, void *value, UErrorCode &status) {
     }
     if (U_FAILURE(status)) {
         if (fValueDeleter) {
-            fValueDeleter((void*) key);
+            fValueDeleter(value);
         }
         return;
     }
     U_ASSERT(fLazyContents != NULL);
 
     UChar *s = const_cast<UChar *>(key);
-    fLazyContents->addElement(s, status);
+    fLazyContents->ensureCapacity(fLazyContents->size() + 2, status);
     if (U_FAILURE(status)) {
         if (fValueDeleter) {
-            fValueDeleter((void*) key);
+            fValueDeleter(value);
         }
         return;
     }
-
+    fLazyContents->addElement(s, status);
     fLazyContents->addElement(value, status);
 }
 
@@ -275,7 +290,7 @@ TextTrieMap::putImpl(const UnicodeString &key, void *value, UErrorCode &status)
     for (index = 0; index < keyLength; ++index) {
         node = addChildNode(node, keyBuffer[index], status);
     }
-    node->addValue(value, fValueDeleter, status);
+    node->addValue(value, NULL, status);
 }
 
 UBool
@@ -360,21 +375,82 @@ TextTrieMap::getChildNode(CharacterNode *parent, UChar c) const {
 }
 
 
-// buildTrie() - The Trie node structure is needed.  Create it from the data that was
+// Maximum number of keys in the node-based trie before the frozen trie is rebuilt.
+static const int32_t MAX_UNFROZEN_CONTENTS = 1024;
+
+// buildTrie() - The Trie structure is needed.  Create it from the data that was
 //               saved at the time the ZoneStringFormatter was created.  The Trie is only
 //               needed for parsing operations, which are less common than formatting,
 //               and the Trie is big, which is why its creation is deferred until first use.
+//               Keys put since the last build go into the node-based trie, unless
+//               there are enough of them to rebuild the frozen trie, so that the total
+//               cost of freezing stays proportional to the number of keys.
 void TextTrieMap::buildTrie(UErrorCode &status) {
-    if (fLazyContents != NULL) {
-        for (int32_t i=0; i<fLazyContents->size(); i+=2) {
-            const UChar *key = (UChar *)fLazyContents->elementAt(i);
-            void  *val = fLazyContents->elementAt(i+1);
-            UnicodeString keyString(TRUE, key, -1);  // Aliasing UnicodeString constructor.
-            putImpl(keyString, val, status);
+    if (U_FAILURE(status) || fLazyContents == NULL) {
+        return;
+    }
+    int32_t contentsCount = fLazyContents->size() / 2;
+    if (fTrieContentsCount == contentsCount) {
+        return;
+    }
+    // The node-based trie uses 16-bit node indexes, so keep it small.
+    int32_t unfrozenCount = contentsCount - fFrozenContentsCount;
+    if (unfrozenCount * 4 >= fFrozenContentsCount || unfrozenCount > MAX_UNFROZEN_CONTENTS) {
+        freeze(status);
+        return;
+    }
+    for (int32_t i = fTrieContentsCount; i < contentsCount; ++i) {
+        const UChar *key = (UChar *)fLazyContents->elementAt(i * 2);
+        void  *val = fLazyContents->elementAt(i * 2 + 1);
+        UnicodeString keyString(TRUE, key, -1);  // Aliasing UnicodeString constructor.
+        putImpl(keyString, val, status);
+    }
+    fTrieContentsCount = contentsCount;
+}
+
+void TextTrieMap::freeze(UErrorCode &status) {
+    int32_t contentsCount = fLazyContents->size() / 2;
+    LocalMemory<CharacterNode> values((CharacterNode *)uprv_malloc(contentsCount * sizeof(CharacterNode)));
+    if (values.isNull()) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    int32_t valuesCount = 0;
+    Hashtable keyIndexes(status);
+    UCharsTrieBuilder builder(status);
+    for (int32_t i = 0; i < contentsCount && U_SUCCESS(status); ++i) {
+        UnicodeString key((const UChar *)fLazyContents->elementAt(i * 2), -1);
+        if (fIgnoreCase) {
+            key.foldCase();
         }
-        delete fLazyContents;
-        fLazyContents = NULL; 
+        // Values of the same key share one node, in put order.
+        int32_t index = keyIndexes.geti(key) - 1;
+        if (index < 0) {
+            index = valuesCount++;
+            values[index].clear();
+            keyIndexes.puti(key, index + 1, status);
+            builder.add(key, index, status);
+        }
+        values[index].addValue(fLazyContents->elementAt(i * 2 + 1), NULL, status);
+    }
+    UnicodeString frozenTrie;
+    builder.buildUnicodeString(USTRINGTRIE_BUILD_SMALL, frozenTrie, status);
+    if (U_FAILURE(status)) {
+        for (int32_t index = 0; index < valuesCount; ++index) {
+            values[index].deleteValues(NULL);
+        }
+        return;
     }
+
+    for (int32_t index = 0; index < fFrozenValuesCount; ++index) {
+        fFrozenValues[index].deleteValues(NULL);
+    }
+    uprv_free(fFrozenValues);
+    fFrozenValues = values.orphan();
+    fFrozenValuesCount = valuesCount;
+    fFrozenTrie = frozenTrie;
+    deleteNodes();
+    fFrozenContentsCount = fTrieContentsCount = contentsCount;
 }
 
 void
@@ -391,17 +467,57 @@ TextTrieMap::search(const UnicodeString &text, int32_t start,
         static UMutex TextTrieMutex;
 
         Mutex lock(&TextTrieMutex);
-        if (fLazyContents != NULL) {
+        if (fLazyContents != NULL && fTrieContentsCount < fLazyContents->size() / 2) {
             TextTrieMap *nonConstThis = const_cast<TextTrieMap *>(this);
             nonConstThis->buildTrie(status);
         }
     }
+    if (fFrozenValuesCount > 0) {
+        searchFrozen(text, start, handler, status);
+    }
     if (fNodes == NULL) {
         return;
     }
     search(fNodes, text, start, start, handler, status);
 }
 
+void
+TextTrieMap::searchFrozen(const UnicodeString &text, int32_t start,
+                  TextTrieMapSearchResultHandler *handler, UErrorCode &status) const {
+    UCharsTrie trie(fFrozenTrie.getBuffer());
+    int32_t index = start;
+    while (index < text.length() && U_SUCCESS(status)) {
+        UStringTrieResult result;
+        if (fIgnoreCase) {
+            // for folding we need to get a complete code point.
+            // size of character may grow after fold operation;
+            // then we need to get result as UTF16 code units.
+            UChar32 c32 = text.char32At(index);
+            index += U16_LENGTH(c32);
+            UnicodeString tmp(c32);
+            tmp.foldCase();
+            result = USTRINGTRIE_NO_MATCH;
+            for (int32_t tmpidx = 0; tmpidx < tmp.length(); ++tmpidx) {
+                result = trie.next(tmp.charAt(tmpidx));
+                if (!USTRINGTRIE_MATCHES(result)) {
+                    break;
+                }
+            }
+        } else {
+            // here we just get the next UTF16 code unit
+            result = trie.next(text.charAt(index++));
+        }
+        if (USTRINGTRIE_HAS_VALUE(result)) {
+            if (!handler->handleMatch(index - start, fFrozenValues + trie.getValue(), status)) {
+                return;
+            }
+        }
+        if (!USTRINGTRIE_HAS_NEXT(result)) {
+            return;
+        }
+    }
+}
+
 void
 TextTrieMap::search(CharacterNode *node, const UnicodeString &text, int32_t start,
                   int32_t index, TextTrieMapSearchResultHandler *handler, UErrorCode &status) const {
@@ -129,6 +129,11 @@ class TextTrieMapSearchResultHandler : public UMemory {
 /**
  * TextTrieMap is a trie implementation for supporting
  * fast prefix match for the string key.
+ *
+ * Keys are collected by put() and only built into a trie on the next search.
+ * The bulk of the keys is frozen into a compact UCharsTrie that maps each key
+ * to a value node. Keys put after that are added to a small node-based trie,
+ * until there are enough of them to make rebuilding the frozen trie worthwhile.
  */
 class U_I18N_API TextTrieMap : public UMemory {
 public:
@@ -147,16 +152,30 @@ class U_I18N_API TextTrieMap : public UMemory {
     int32_t         fNodesCapacity;
     int32_t         fNodesCount;
 
+    // All key/value pairs put so far, in put order. Owns the values.
     UVector         *fLazyContents;
+    // Number of pairs at the start of fLazyContents that are in the frozen trie,
+    // and in either of the tries.
+    int32_t         fFrozenContentsCount;
+    int32_t         fTrieContentsCount;
     UBool           fIsEmpty;
     UObjectDeleter  *fValueDeleter;
 
+    // Serialized UCharsTrie mapping the (folded) keys to indexes into fFrozenValues.
+    UnicodeString   fFrozenTrie;
+    CharacterNode   *fFrozenValues;
+    int32_t         fFrozenValuesCount;
+
     UBool growNodes();
     CharacterNode* addChildNode(CharacterNode *parent, UChar c, UErrorCode &status);
     CharacterNode* getChildNode(CharacterNode *parent, UChar c) const;
 
     void putImpl(const UnicodeString &key, void *value, UErrorCode &status);
     void buildTrie(UErrorCode &status);
+    void freeze(UErrorCode &status);
+    void deleteNodes();
+    void searchFrozen(const UnicodeString &text, int32_t start,
+        TextTrieMapSearchResultHandler *handler, UErrorCode &status) const;
     void search(CharacterNode *node, const UnicodeString &text, int32_t start,
         int32_t index, TextTrieMapSearchResultHandler *handler, UErrorCode &status) const;
 };
@@ -0,0 +1,207 @@
+// © 2019 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+
+// ucachepreload.cpp
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_FORMATTING
+
+#include <condition_variable>
+#include <mutex>
+
+#include "unicode/brkiter.h"
+#include "unicode/locid.h"
+#include "unicode/numfmt.h"
+#include "unicode/plurrule.h"
+#include "unicode/ucachepreload.h"
+#include "cmemory.h"
+#include "shareddateformatsymbols.h"
+#include "sharednumberformat.h"
+#include "sharedpluralrules.h"
+#include "unifiedcache.h"
+
+#if !UCONFIG_NO_COLLATION
+#include "collationtailoring.h"
+#include "ucol_imp.h"
+#endif
+
+U_NAMESPACE_USE
+
+namespace {
+
+const int32_t KIND_COUNT = 5;
+
+/**
+ * Shared state of one ucache_preload() call.
+ * The tasks and their results live in arrays owned by the caller's frame.
+ */
+struct PreloadBatch {
+    std::mutex mutex;
+    std::condition_variable done;
+    int32_t pending;
+    UErrorCode firstError;
+};
+
+}  // namespace
+
+struct UCachePreloadTask {
+    PreloadBatch *batch;
+    const char *localeID;
+    uint32_t kind;
+    const SharedObject *result;
+};
+
+struct UCachePin : public UMemory {
+    MaybeStackArray<const SharedObject *, 16> objects;
+    int32_t count;
+};
+
+namespace {
+
+/**
+ * Builds one kind of service for one locale and returns the cache entry
+ * that holds its data, with a reference added for the caller.
+ * Returns NULL without an error for kinds that are not cached.
+ */
+const SharedObject *preloadOne(const Locale &locale, uint32_t kind, UErrorCode &status) {
+    switch (kind) {
+#if !UCONFIG_NO_COLLATION
+    case UCACHE_PRELOAD_COLLATOR:
+        return CollationLoader::loadTailoring(locale, status);
+#endif
+    case UCACHE_PRELOAD_NUMBER_FORMAT:
+        return NumberFormat::createSharedInstance(locale, UNUM_DECIMAL, status);
+    case UCACHE_PRELOAD_DATE_FORMAT: {
+        const SharedDateFormatSymbols *symbols = nullptr;
+        UnifiedCache::getByLocale(locale, symbols, status);
+        return symbols;
+    }
+#if !UCONFIG_NO_BREAK_ITERATION
+    case UCACHE_PRELOAD_BREAK_ITERATOR: {
+        // Break iterators are not cached; creating one maps its rules and
+        // dictionaries into the data cache, which is what the first real
+        // request would pay for.
+        delete BreakIterator::createWordInstance(locale, status);
+        delete BreakIterator::createLineInstance(locale, status);
+        return nullptr;
+    }
+#endif
+    case UCACHE_PRELOAD_PLURAL_RULES:
+        return PluralRules::createSharedInstance(locale, UPLURAL_TYPE_CARDINAL, status);
+    default:
+        return nullptr;
+    }
+}
+
+}  // namespace
+
+U_CAPI void U_EXPORT2
+ucache_runPreloadTask(UCachePreloadTask *task) {
+    UErrorCode status = U_ZERO_ERROR;
+    task->result = preloadOne(Locale(task->localeID), task->kind, status);
+    if (U_FAILURE(status)) {
+        SharedObject::clearPtr(task->result);
+    }
+    PreloadBatch *batch = task->batch;
+    std::lock_guard<std::mutex> lock(batch->mutex);
+    if (U_FAILURE(status) && U_SUCCESS(batch->firstError)) {
+        batch->firstError = status;
+    }
+    if (--batch->pending == 0) {
+        batch->done.notify_all();
+    }
+}
+
+U_CAPI UCachePin * U_EXPORT2
+ucache_preload(const char *const *locales, int32_t localeCount, uint32_t kinds,
+               UCachePreloadExecutor *executor, const void *executorContext,
+               UErrorCode *status) {
+    if (U_FAILURE(*status)) {
+        return nullptr;
+    }
+    if (localeCount < 0 || (locales == nullptr && localeCount > 0) ||
+            (kinds & ~(uint32_t)UCACHE_PRELOAD_ALL) != 0) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return nullptr;
+    }
+    LocalPointer<UCachePin> pin(new UCachePin(), *status);
+    if (U_FAILURE(*status)) {
+        return nullptr;
+    }
+    pin->count = 0;
+
+    int32_t taskCount = 0;
+    for (int32_t k = 0; k < KIND_COUNT; ++k) {
+        if ((kinds & (1u << k)) != 0) {
+            taskCount += localeCount;
+        }
+    }
+    if (taskCount == 0) {
+        return pin.orphan();
+    }
+    MaybeStackArray<UCachePreloadTask, 16> tasks;
+    if (tasks.resize(taskCount) == nullptr) {
+        *status = U_MEMORY_ALLOCATION_ERROR;
+        return nullptr;
+    }
+    PreloadBatch batch;
+    batch.pending = taskCount;
+    batch.firstError = U_ZERO_ERROR;
+    int32_t i = 0;
+    for (int32_t k = 0; k < KIND_COUNT; ++k) {
+        if ((kinds & (1u << k)) == 0) {
+            continue;
+        }
+        for (int32_t l = 0; l < localeCount; ++l, ++i) {
+            tasks[i].batch = &batch;
+            tasks[i].localeID = locales[l];
+            tasks[i].kind = 1u << k;
+            tasks[i].result = nullptr;
+        }
+    }
+
+    for (i = 0; i < taskCount; ++i) {
+        if (executor == nullptr) {
+            ucache_runPreloadTask(&tasks[i]);
+        } else {
+            executor(executorContext, &tasks[i]);
+        }
+    }
+    {
+        std::unique_lock<std::mutex> lock(batch.mutex);
+        batch.done.wait(lock, [&batch]() { return batch.pending == 0; });
+    }
+
+    if (U_SUCCESS(batch.firstError) && pin->objects.resize(taskCount) == nullptr) {
+        batch.firstError = U_MEMORY_ALLOCATION_ERROR;
+    }
+    for (i = 0; i < taskCount; ++i) {
+        if (tasks[i].result == nullptr) {
+            continue;
+        }
+        if (U_SUCCESS(batch.firstError)) {
+            pin->objects[pin->count++] = tasks[i].result;
+        } else {
+            tasks[i].result->removeRef();
+        }
+    }
+    if (U_FAILURE(batch.firstError)) {
+        *status = batch.firstError;
+        return nullptr;
+    }
+    return pin.orphan();
+}
+
+U_CAPI void U_EXPORT2
+ucache_unpin(UCachePin *pin) {
+    if (pin == nullptr) {
+        return;
+    }
+    for (int32_t i = 0; i < pin->count; ++i) {
+        pin->objects[i]->removeRef();
+    }
+    delete pin;
+}
+
+#endif  // !UCONFIG_NO_FORMATTING
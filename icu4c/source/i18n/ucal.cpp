@@ -18,12 +18,16 @@
 #include "unicode/calendar.h"
 #include "unicode/timezone.h"
 #include "unicode/gregocal.h"
+#include "unicode/basictz.h"
 #include "unicode/simpletz.h"
+#include "unicode/tztrans.h"
 #include "unicode/ustring.h"
 #include "unicode/strenum.h"
 #include "unicode/localpointer.h"
 #include "cmemory.h"
 #include "cstring.h"
+#include "gregoimp.h"
+#include "putilimp.h"
 #include "ustrenum.h"
 #include "uenumimp.h"
 #include "ulist.h"
@@ -804,4 +808,171 @@ ucal_getTimeZoneIDForWindowsID(const UChar* winid, int32_t len, const char* regi
     return resultLen;
 }
 
+namespace {
+
+/**
+ * The total offset of a time zone over [fStart, fLimit), the dates between two of its
+ * transitions, so that runs of nearby dates take the offset without another lookup.
+ */
+class ZoneOffsetRange {
+public:
+    ZoneOffsetRange(const TimeZone &zone)
+            : fZone(zone), fBasicZone(dynamic_cast<const BasicTimeZone *>(&zone)),
+              fStart(0), fLimit(0), fOffset(0) {}
+
+    /** Returns the total offset at the UTC date. */
+    int32_t getOffset(UDate date, UErrorCode &status) {
+        if (fStart <= date && date < fLimit) {
+            return fOffset;
+        }
+        int32_t rawOffset, dstOffset;
+        fZone.getOffset(date, FALSE, rawOffset, dstOffset, status);
+        fOffset = rawOffset + dstOffset;
+        TimeZoneTransition transition;
+        if (fBasicZone == NULL) {
+            fStart = fLimit = date;  // always look up again
+        } else {
+            fStart = fBasicZone->getPreviousTransition(date, TRUE, transition) ?
+                transition.getTime() : -uprv_getInfinity();
+            fLimit = fBasicZone->getNextTransition(date, FALSE, transition) ?
+                transition.getTime() : uprv_getInfinity();
+        }
+        return fOffset;
+    }
+
+    /**
+     * Returns the total offset at the local date, as Calendar::computeZoneOffset()
+     * does with the default UCAL_WALLTIME_LAST options.
+     */
+    int32_t getOffsetFromLocal(UDate local, UErrorCode &status) {
+        // Local times near a transition may be skipped or repeated; no transition
+        // has shifted the offset by as much as two days.
+        UDate date = local - fOffset;
+        if (fStart + 2 * kOneDay <= date && date < fLimit - 2 * kOneDay) {
+            return fOffset;
+        }
+        int32_t rawOffset, dstOffset;
+        if (fBasicZone != NULL) {
+            fBasicZone->getOffsetFromLocal(local, BasicTimeZone::kFormer, BasicTimeZone::kLatter,
+                                           rawOffset, dstOffset, status);
+        } else {
+            fZone.getOffset(local, TRUE, rawOffset, dstOffset, status);
+        }
+        return getOffset(local - (rawOffset + dstOffset), status);
+    }
+
+private:
+    const TimeZone &fZone;
+    const BasicTimeZone *fBasicZone;
+    UDate fStart;
+    UDate fLimit;
+    int32_t fOffset;
+};
+
+inline void setField(int32_t *column, int32_t i, int32_t value) {
+    if (column != NULL) {
+        column[i] = value;
+    }
+}
+
+inline int32_t getField(const int32_t *column, int32_t i, int32_t defaultValue) {
+    return column != NULL ? column[i] : defaultValue;
+}
+
+}  // namespace
+
+U_CAPI void U_EXPORT2
+ucal_datesToFields(const UChar* zoneID, int32_t len,
+                   const UDate* dates, int32_t count,
+                   const UCalendarFieldArrays* fields, UErrorCode* status) {
+    if (U_FAILURE(*status)) {
+        return;
+    }
+    if (count < 0 || (dates == NULL && count > 0) || fields == NULL) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    LocalPointer<TimeZone> zone(_createTimeZone(zoneID, len, status));
+    if (U_FAILURE(*status)) {
+        return;
+    }
+    ZoneOffsetRange offsets(*zone);
+    double lastDay = uprv_getNaN();
+    int32_t year = 0, month = 0, dom = 0, dow = 0, doy;
+    for (int32_t i = 0; i < count; ++i) {
+        UDate date = dates[i];
+        if (!(MIN_MILLIS <= date && date <= MAX_MILLIS)) {  // also NaN
+            *status = U_ILLEGAL_ARGUMENT_ERROR;
+            return;
+        }
+        int32_t offset = offsets.getOffset(date, *status);
+        if (U_FAILURE(*status)) {
+            return;
+        }
+        double millisInDay;
+        double day = ClockMath::floorDivide(date + offset, kOneDay, millisInDay);
+        if (day != lastDay) {
+            Grego::dayToFields(day, year, month, dom, dow, doy);
+            lastDay = day;
+        }
+        int32_t millis = (int32_t)millisInDay;
+        setField(fields->year, i, year);
+        setField(fields->month, i, month);
+        setField(fields->dayOfMonth, i, dom);
+        setField(fields->dayOfWeek, i, dow);
+        setField(fields->hourOfDay, i, millis / U_MILLIS_PER_HOUR);
+        setField(fields->minute, i, (millis / U_MILLIS_PER_MINUTE) % 60);
+        setField(fields->second, i, (millis / U_MILLIS_PER_SECOND) % 60);
+        setField(fields->millisecond, i, millis % U_MILLIS_PER_SECOND);
+        setField(fields->zoneOffset, i, offset);
+    }
+}
+
+U_CAPI void U_EXPORT2
+ucal_fieldsToDates(const UChar* zoneID, int32_t len,
+                   const UCalendarFieldArrays* fields, int32_t count,
+                   UDate* dates, UErrorCode* status) {
+    if (U_FAILURE(*status)) {
+        return;
+    }
+    if (count < 0 || (dates == NULL && count > 0) || fields == NULL) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    LocalPointer<TimeZone> zone(_createTimeZone(zoneID, len, status));
+    if (U_FAILURE(*status)) {
+        return;
+    }
+    ZoneOffsetRange offsets(*zone);
+    for (int32_t i = 0; i < count; ++i) {
+        int32_t year = getField(fields->year, i, 1970);
+        int32_t month = getField(fields->month, i, 0);
+        // Lenient months roll over into the year.
+        int32_t yearDelta = ClockMath::floorDivide(month, 12);
+        year += yearDelta;
+        month -= yearDelta * 12;
+        // Far outside of the UCalendar range anyway, and would overflow in Grego::fieldsToDay().
+        if (year < -5880000 || 5880000 < year) {
+            *status = U_ILLEGAL_ARGUMENT_ERROR;
+            return;
+        }
+        double day = Grego::fieldsToDay(year, month, 1) + (getField(fields->dayOfMonth, i, 1) - 1.0);
+        double millisInDay =
+            (double)getField(fields->hourOfDay, i, 0) * U_MILLIS_PER_HOUR +
+            (double)getField(fields->minute, i, 0) * U_MILLIS_PER_MINUTE +
+            (double)getField(fields->second, i, 0) * U_MILLIS_PER_SECOND +
+            (double)getField(fields->millisecond, i, 0);
+        UDate local = day * kOneDay + millisInDay;
+        if (!(MIN_MILLIS <= local && local <= MAX_MILLIS)) {
+            *status = U_ILLEGAL_ARGUMENT_ERROR;
+            return;
+        }
+        int32_t offset = offsets.getOffsetFromLocal(local, *status);
+        if (U_FAILURE(*status)) {
+            return;
+        }
+        dates[i] = local - offset;
+    }
+}
+
 #endif /* #if !UCONFIG_NO_FORMATTING */
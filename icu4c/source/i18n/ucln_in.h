@@ -30,6 +30,7 @@ typedef enum ECleanupI18NType {
     UCLN_I18N_CURRENCY_SPACING,
     UCLN_I18N_SPOOF,
     UCLN_I18N_SPOOFDATA,
+    UCLN_I18N_SPOOF_SCRIPTSETS,
     UCLN_I18N_TRANSLITERATOR,
     UCLN_I18N_REGEX,
     UCLN_I18N_JAPANESE_CALENDAR,
@@ -59,7 +60,6 @@ typedef enum ECleanupI18NType {
     UCLN_I18N_GENDERINFO,
     UCLN_I18N_CDFINFO,
     UCLN_I18N_REGION,
-    UCLN_I18N_LIST_FORMATTER,
     UCLN_I18N_NUMSYS,
     UCLN_I18N_COUNT /* This must be last */
 } ECleanupI18NType;
@@ -23,6 +23,9 @@
 
 #if !UCONFIG_NO_COLLATION
 
+#include <condition_variable>
+#include <mutex>
+
 #include "unicode/coll.h"
 #include "unicode/tblcoll.h"
 #include "unicode/bytestream.h"
@@ -31,8 +34,10 @@
 #include "unicode/ustring.h"
 #include "cmemory.h"
 #include "collation.h"
+#include "collationsettings.h"
 #include "cstring.h"
 #include "putilimp.h"
+#include "uarrsort.h"
 #include "uassert.h"
 #include "utracimp.h"
 
@@ -209,6 +214,431 @@ ucol_getSortKey(const    UCollator    *coll,
     return keySize;
 }
 
+U_CAPI int32_t U_EXPORT2
+ucol_getSortKeyUTF8(const UCollator *coll,
+                    const char *source,
+                    int32_t sourceLength,
+                    uint8_t *result,
+                    int32_t resultLength,
+                    UErrorCode *status)
+{
+    UTRACE_ENTRY(UTRACE_UCOL_GET_SORTKEY);
+    if (UTRACE_LEVEL(UTRACE_VERBOSE)) {
+        UTRACE_DATA3(UTRACE_VERBOSE, "coll=%p, source string = %vb ", coll, source,
+            ((sourceLength==-1 && source!=NULL) ? (int32_t)uprv_strlen(source) : sourceLength));
+    }
+
+    int32_t keySize = Collator::fromUCollator(coll)->
+            internalGetSortKeyUTF8(source, sourceLength, result, resultLength, *status);
+
+    UTRACE_DATA2(UTRACE_VERBOSE, "Sort Key = %vb", result, keySize);
+    UTRACE_EXIT_VALUE_STATUS(keySize, *status);
+    return keySize;
+}
+
+U_CAPI int32_t U_EXPORT2
+ucol_getSortKeys(const UCollator *coll,
+                 const UChar *const *sources,
+                 const int32_t *sourceLengths,
+                 int32_t count,
+                 uint8_t *result,
+                 int32_t resultCapacity,
+                 int32_t *offsets,
+                 UErrorCode *status)
+{
+    if (U_FAILURE(*status)) {
+        return 0;
+    }
+    const RuleBasedCollator *rbc = RuleBasedCollator::rbcFromUCollator(coll);
+    if (rbc != NULL) {
+        return rbc->internalGetSortKeys(sources, sourceLengths, count,
+                                        result, resultCapacity, offsets, *status);
+    }
+    if (count < 0 || (sources == NULL && count > 0) || offsets == NULL ||
+            resultCapacity < 0 || (result == NULL && resultCapacity > 0)) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    const Collator *c = Collator::fromUCollator(coll);
+    int32_t total = 0;
+    for (int32_t i = 0; i < count; ++i) {
+        offsets[i] = total;
+        int32_t available = (total < resultCapacity) ? resultCapacity - total : 0;
+        int32_t keyLength = c->getSortKey(sources[i], (sourceLengths != NULL) ? sourceLengths[i] : -1,
+                                          available > 0 ? result + total : NULL, available);
+        if (keyLength == 0) {
+            *status = U_ILLEGAL_ARGUMENT_ERROR;
+            return 0;
+        }
+        total += keyLength;
+    }
+    offsets[count] = total;
+    if (total > resultCapacity) {
+        *status = U_BUFFER_OVERFLOW_ERROR;
+    }
+    return total;
+}
+
+U_CAPI int32_t U_EXPORT2
+ucol_getSortKeysUTF8(const UCollator *coll,
+                     const char *const *sources,
+                     const int32_t *sourceLengths,
+                     int32_t count,
+                     uint8_t *result,
+                     int32_t resultCapacity,
+                     int32_t *offsets,
+                     UErrorCode *status)
+{
+    if (U_FAILURE(*status)) {
+        return 0;
+    }
+    const RuleBasedCollator *rbc = RuleBasedCollator::rbcFromUCollator(coll);
+    if (rbc != NULL) {
+        return rbc->internalGetSortKeys(sources, sourceLengths, count,
+                                        result, resultCapacity, offsets, *status);
+    }
+    if (count < 0 || (sources == NULL && count > 0) || offsets == NULL ||
+            resultCapacity < 0 || (result == NULL && resultCapacity > 0)) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    const Collator *c = Collator::fromUCollator(coll);
+    int32_t total = 0;
+    for (int32_t i = 0; i < count; ++i) {
+        offsets[i] = total;
+        int32_t available = (total < resultCapacity) ? resultCapacity - total : 0;
+        total += c->internalGetSortKeyUTF8(sources[i], (sourceLengths != NULL) ? sourceLengths[i] : -1,
+                                           available > 0 ? result + total : NULL, available, *status);
+        if (U_FAILURE(*status)) {
+            return 0;
+        }
+    }
+    offsets[count] = total;
+    if (total > resultCapacity) {
+        *status = U_BUFFER_OVERFLOW_ERROR;
+    }
+    return total;
+}
+
+namespace {
+
+/** Number of sort key bytes kept per string for the first comparison. */
+constexpr int32_t SORT_PREFIX_LENGTH = 8;
+
+struct SortItem {
+    /** The first SORT_PREFIX_LENGTH sort key bytes, big-endian. */
+    uint64_t prefix;
+    /** Index into the input arrays. */
+    int32_t index;
+    /** TRUE if the whole sort key fits into the prefix. */
+    UBool isComplete;
+};
+
+struct SortContext {
+    const Collator *coll;
+    const UChar *const *strings16;
+    const char *const *strings8;
+    const int32_t *lengths;
+    UErrorCode errorCode;
+};
+
+uint64_t toSortPrefix(const uint8_t *key, int32_t keyLength) {
+    uint64_t prefix = 0;
+    for (int32_t i = 0; i < SORT_PREFIX_LENGTH; ++i) {
+        prefix = (prefix << 8) | (i < keyLength ? key[i] : 0);
+    }
+    return prefix;
+}
+
+int32_t U_CALLCONV
+compareSortItems(const void *context, const void *left, const void *right) {
+    const SortItem &l = *static_cast<const SortItem *>(left);
+    const SortItem &r = *static_cast<const SortItem *>(right);
+    if (l.prefix != r.prefix) {
+        return (l.prefix < r.prefix) ? -1 : 1;
+    }
+    // Equal prefixes: If either key ended within the prefix, then both did
+    // (the terminator byte sorts lowest) and the keys are equal.
+    if (!l.isComplete && !r.isComplete) {
+        SortContext &ctx = *const_cast<SortContext *>(static_cast<const SortContext *>(context));
+        int32_t leftLength = (ctx.lengths != NULL) ? ctx.lengths[l.index] : -1;
+        int32_t rightLength = (ctx.lengths != NULL) ? ctx.lengths[r.index] : -1;
+        UCollationResult order;
+        if (ctx.strings16 != NULL) {
+            order = ctx.coll->compare(ctx.strings16[l.index], leftLength,
+                                      ctx.strings16[r.index], rightLength, ctx.errorCode);
+        } else {
+            order = ctx.coll->internalCompareUTF8(ctx.strings8[l.index], leftLength,
+                                                  ctx.strings8[r.index], rightLength, ctx.errorCode);
+        }
+        if (order != UCOL_EQUAL) {
+            return order;
+        }
+    }
+    // Keep equal strings in input order.
+    return l.index - r.index;
+}
+
+/** Minimum number of strings per run that is sorted by one task. */
+constexpr int32_t SORT_MIN_RUN_LENGTH = 512;
+/** Maximum number of runs, and of sort tasks in flight at a time. */
+constexpr int32_t SORT_MAX_RUNS = 64;
+
+/**
+ * Shared state of one ucol_sortStrings() or ucol_sortStringsUTF8() call.
+ * The tasks and their results live in arrays owned by the caller's frame.
+ */
+struct SortBatch {
+    SortContext ctx;
+    SortItem *items;
+    /** Merge buffer, as long as items; NULL if there is only one run. */
+    SortItem *scratch;
+    std::mutex mutex;
+    std::condition_variable done;
+    int32_t pending;
+    UErrorCode firstError;
+};
+
+/**
+ * Computes the sort key prefixes for items[start..limit[ and sorts them.
+ */
+void sortRun(SortContext &ctx, SortItem *items, int32_t start, int32_t limit,
+             UErrorCode &errorCode) {
+    for (int32_t i = start; i < limit; ++i) {
+        uint8_t key[SORT_PREFIX_LENGTH];
+        int32_t length = (ctx.lengths != NULL) ? ctx.lengths[i] : -1;
+        int32_t keyLength;
+        if (ctx.strings16 != NULL) {
+            keyLength = ctx.coll->getSortKey(ctx.strings16[i], length, key, SORT_PREFIX_LENGTH);
+            if (keyLength == 0) {
+                errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+                return;
+            }
+        } else {
+            keyLength = ctx.coll->internalGetSortKeyUTF8(ctx.strings8[i], length,
+                                                         key, SORT_PREFIX_LENGTH, errorCode);
+            if (U_FAILURE(errorCode)) { return; }
+        }
+        items[i].prefix = toSortPrefix(key, keyLength);
+        items[i].index = i;
+        items[i].isComplete = keyLength <= SORT_PREFIX_LENGTH;
+    }
+    // The comparator never returns 0 for different items,
+    // so an unstable sort yields a stable result.
+    uprv_sortArray(items + start, limit - start, (int32_t)sizeof(SortItem),
+                   compareSortItems, &ctx, FALSE, &errorCode);
+}
+
+/**
+ * Merges the sorted runs items[start..middle[ and items[middle..limit[
+ * via the scratch buffer.
+ */
+void mergeRuns(SortContext &ctx, SortItem *items, SortItem *scratch,
+               int32_t start, int32_t middle, int32_t limit) {
+    int32_t left = start, right = middle, dest = start;
+    while (left < middle && right < limit) {
+        if (compareSortItems(&ctx, items + left, items + right) <= 0) {
+            scratch[dest++] = items[left++];
+        } else {
+            scratch[dest++] = items[right++];
+        }
+    }
+    while (left < middle) { scratch[dest++] = items[left++]; }
+    while (right < limit) { scratch[dest++] = items[right++]; }
+    uprv_memcpy(items + start, scratch + start, (size_t)(limit - start) * sizeof(SortItem));
+}
+
+}  // namespace
+
+struct UCollationSortTask {
+    SortBatch *batch;
+    int32_t start;
+    /** Start of the second run to be merged, or -1 to sort items[start..limit[. */
+    int32_t middle;
+    int32_t limit;
+};
+
+U_CAPI void U_EXPORT2
+ucol_runSortTask(UCollationSortTask *task) {
+    SortBatch *batch = task->batch;
+    // Each task records comparison errors in its own context.
+    SortContext ctx = batch->ctx;
+    ctx.errorCode = U_ZERO_ERROR;
+    UErrorCode errorCode = U_ZERO_ERROR;
+    if (task->middle < 0) {
+        sortRun(ctx, batch->items, task->start, task->limit, errorCode);
+    } else {
+        mergeRuns(ctx, batch->items, batch->scratch, task->start, task->middle, task->limit);
+    }
+    if (U_SUCCESS(errorCode)) {
+        errorCode = ctx.errorCode;
+    }
+    std::lock_guard<std::mutex> lock(batch->mutex);
+    if (U_FAILURE(errorCode) && U_SUCCESS(batch->firstError)) {
+        batch->firstError = errorCode;
+    }
+    if (--batch->pending == 0) {
+        batch->done.notify_all();
+    }
+}
+
+namespace {
+
+/**
+ * Hands the tasks to the executor, or runs them if there is none,
+ * and waits until all of them are done.
+ */
+void runSortTasks(SortBatch &batch, UCollationSortTask *tasks, int32_t taskCount,
+                  UCollationSortExecutor *executor, const void *executorContext) {
+    {
+        std::lock_guard<std::mutex> lock(batch.mutex);
+        batch.pending = taskCount;
+    }
+    for (int32_t i = 0; i < taskCount; ++i) {
+        if (executor == NULL) {
+            ucol_runSortTask(&tasks[i]);
+        } else {
+            executor(executorContext, &tasks[i]);
+        }
+    }
+    std::unique_lock<std::mutex> lock(batch.mutex);
+    batch.done.wait(lock, [&batch]() { return batch.pending == 0; });
+}
+
+/**
+ * Sorts the strings8 or strings16 array of the context, and the lengths
+ * array if there is one, into collation order.
+ *
+ * With an executor, the items are sorted in runs of at least
+ * SORT_MIN_RUN_LENGTH, one task per run, and then adjacent runs are merged
+ * pairwise, one task per pair, until one run is left.
+ */
+void sortStrings(const SortContext &ctx, const void **strings, int32_t *lengths,
+                 int32_t count, UCollationSortExecutor *executor, const void *executorContext,
+                 UErrorCode &errorCode) {
+    MaybeStackArray<SortItem, 64> items;
+    if (items.resize(count) == nullptr) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    int32_t runCount = 1;
+    if (executor != NULL) {
+        runCount = count / SORT_MIN_RUN_LENGTH;
+        if (runCount < 1) {
+            runCount = 1;
+        } else if (runCount > SORT_MAX_RUNS) {
+            runCount = SORT_MAX_RUNS;
+        }
+    }
+    MaybeStackArray<SortItem, 1> scratch;
+    if (runCount > 1 && scratch.resize(count) == nullptr) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    SortBatch batch;
+    batch.ctx = ctx;
+    batch.items = items.getAlias();
+    batch.scratch = runCount > 1 ? scratch.getAlias() : NULL;
+    batch.pending = 0;
+    batch.firstError = U_ZERO_ERROR;
+
+    // Run boundaries: run i is items[runStarts[i]..runStarts[i+1][.
+    int32_t runStarts[SORT_MAX_RUNS + 1];
+    UCollationSortTask tasks[SORT_MAX_RUNS];
+    for (int32_t i = 0; i <= runCount; ++i) {
+        runStarts[i] = (int32_t)(((int64_t)count * i) / runCount);
+    }
+    for (int32_t i = 0; i < runCount; ++i) {
+        tasks[i].batch = &batch;
+        tasks[i].start = runStarts[i];
+        tasks[i].middle = -1;
+        tasks[i].limit = runStarts[i + 1];
+    }
+    runSortTasks(batch, tasks, runCount, executor, executorContext);
+    while (U_SUCCESS(batch.firstError) && runCount > 1) {
+        int32_t taskCount = runCount / 2;
+        for (int32_t i = 0; i < taskCount; ++i) {
+            tasks[i].batch = &batch;
+            tasks[i].start = runStarts[2 * i];
+            tasks[i].middle = runStarts[2 * i + 1];
+            tasks[i].limit = runStarts[2 * i + 2];
+        }
+        runSortTasks(batch, tasks, taskCount, executor, executorContext);
+        // Drop the starts of the runs that were merged into their predecessors.
+        int32_t newRunCount = (runCount + 1) / 2;
+        for (int32_t i = 1; i <= newRunCount; ++i) {
+            runStarts[i] = runStarts[i < newRunCount ? 2 * i : runCount];
+        }
+        runCount = newRunCount;
+    }
+    if (U_FAILURE(batch.firstError)) {
+        errorCode = batch.firstError;
+        return;
+    }
+
+    MaybeStackArray<const void *, 64> sortedStrings;
+    MaybeStackArray<int32_t, 64> sortedLengths;
+    if (sortedStrings.resize(count) == nullptr ||
+            (lengths != NULL && sortedLengths.resize(count) == nullptr)) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    for (int32_t i = 0; i < count; ++i) {
+        sortedStrings[i] = strings[items[i].index];
+        if (lengths != NULL) {
+            sortedLengths[i] = lengths[items[i].index];
+        }
+    }
+    uprv_memcpy(strings, sortedStrings.getAlias(), (size_t)count * sizeof(const void *));
+    if (lengths != NULL) {
+        uprv_memcpy(lengths, sortedLengths.getAlias(), (size_t)count * sizeof(int32_t));
+    }
+}
+
+}  // namespace
+
+U_CAPI void U_EXPORT2
+ucol_sortStrings(const UCollator *coll,
+                 const UChar **strings,
+                 int32_t *lengths,
+                 int32_t count,
+                 UCollationSortExecutor *executor,
+                 const void *executorContext,
+                 UErrorCode *status)
+{
+    if (U_FAILURE(*status)) {
+        return;
+    }
+    if (count < 0 || (strings == NULL && count > 0)) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    SortContext ctx = { Collator::fromUCollator(coll), strings, NULL, lengths, U_ZERO_ERROR };
+    sortStrings(ctx, reinterpret_cast<const void **>(strings), lengths, count,
+                executor, executorContext, *status);
+}
+
+U_CAPI void U_EXPORT2
+ucol_sortStringsUTF8(const UCollator *coll,
+                     const char **strings,
+                     int32_t *lengths,
+                     int32_t count,
+                     UCollationSortExecutor *executor,
+                     const void *executorContext,
+                     UErrorCode *status)
+{
+    if (U_FAILURE(*status)) {
+        return;
+    }
+    if (count < 0 || (strings == NULL && count > 0)) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    SortContext ctx = { Collator::fromUCollator(coll), NULL, strings, lengths, U_ZERO_ERROR };
+    sortStrings(ctx, reinterpret_cast<const void **>(strings), lengths, count,
+                executor, executorContext, *status);
+}
+
 U_CAPI int32_t U_EXPORT2
 ucol_nextSortKeyPart(const UCollator *coll,
                      UCharIterator *iter,
@@ -486,6 +916,115 @@ ucol_strcollUTF8(
     return returnVal;
 }
 
+namespace {
+
+/** The private contents of a UCollatorView. */
+struct CollatorViewImpl : public UMemory {
+    const RuleBasedCollator *coll;
+    CollationSettings settings;
+};
+
+// ucol_initView() constructs the contents in place in the reserved array.
+static_assert(sizeof(CollatorViewImpl) <= sizeof(UCollatorView::reserved),
+              "UCollatorView is too small for its contents");
+static_assert(alignof(CollatorViewImpl) <= alignof(UCollatorView),
+              "UCollatorView is not aligned enough for its contents");
+
+inline CollatorViewImpl *viewImpl(UCollatorView *view) {
+    return reinterpret_cast<CollatorViewImpl *>(view->reserved);
+}
+
+inline const CollatorViewImpl *viewImpl(const UCollatorView *view) {
+    return reinterpret_cast<const CollatorViewImpl *>(view->reserved);
+}
+
+}  // namespace
+
+U_CAPI void U_EXPORT2
+ucol_initView(UCollatorView *view, const UCollator *coll, UErrorCode *status) {
+    if(U_FAILURE(*status)) {
+        return;
+    }
+    if(view == NULL) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    const RuleBasedCollator *rbc = RuleBasedCollator::rbcFromUCollator(coll);
+    if(rbc == NULL) {
+        *status = U_UNSUPPORTED_ERROR;
+        return;
+    }
+    // The settings never own memory, so the view need not be destroyed.
+    CollatorViewImpl *impl = new(view->reserved) CollatorViewImpl();
+    impl->coll = rbc;
+    rbc->internalInitViewSettings(impl->settings);
+}
+
+U_CAPI void U_EXPORT2
+ucol_setViewAttribute(UCollatorView *view, UColAttribute attr, UColAttributeValue value,
+                      UErrorCode *status) {
+    if(U_FAILURE(*status)) {
+        return;
+    }
+    if(view == NULL) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    CollatorViewImpl *impl = viewImpl(view);
+    impl->coll->internalSetViewAttribute(impl->settings, attr, value, *status);
+}
+
+U_CAPI UCollationResult U_EXPORT2
+ucol_viewStrcoll(const UCollatorView *view,
+                 const UChar *source, int32_t sourceLength,
+                 const UChar *target, int32_t targetLength,
+                 UErrorCode *status) {
+    if(U_FAILURE(*status)) {
+        return UCOL_EQUAL;
+    }
+    if(view == NULL) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return UCOL_EQUAL;
+    }
+    const CollatorViewImpl *impl = viewImpl(view);
+    return impl->coll->internalCompare(impl->settings, source, sourceLength,
+                                       target, targetLength, *status);
+}
+
+U_CAPI UCollationResult U_EXPORT2
+ucol_viewStrcollUTF8(const UCollatorView *view,
+                     const char *source, int32_t sourceLength,
+                     const char *target, int32_t targetLength,
+                     UErrorCode *status) {
+    if(U_FAILURE(*status)) {
+        return UCOL_EQUAL;
+    }
+    if(view == NULL) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return UCOL_EQUAL;
+    }
+    const CollatorViewImpl *impl = viewImpl(view);
+    return impl->coll->internalCompareUTF8(impl->settings, source, sourceLength,
+                                           target, targetLength, *status);
+}
+
+U_CAPI int32_t U_EXPORT2
+ucol_viewGetSortKey(const UCollatorView *view,
+                    const UChar *source, int32_t sourceLength,
+                    uint8_t *result, int32_t resultLength,
+                    UErrorCode *status) {
+    if(U_FAILURE(*status)) {
+        return 0;
+    }
+    if(view == NULL) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    const CollatorViewImpl *impl = viewImpl(view);
+    return impl->coll->internalGetSortKey(impl->settings, source, sourceLength,
+                                          result, resultLength, *status);
+}
+
 
 /* convenience function for comparing strings */
 U_CAPI UBool U_EXPORT2
@@ -93,18 +93,19 @@ udat_toCalendarDateField(UDateFormatField field) {
 
 /* For now- one opener. */
 static UDateFormatOpener gOpener = NULL;
+static UMutex gOpenerMutex;
 
 U_INTERNAL void U_EXPORT2
 udat_registerOpener(UDateFormatOpener opener, UErrorCode *status)
 {
   if(U_FAILURE(*status)) return;
-  umtx_lock(NULL);
+  umtx_lock(&gOpenerMutex);
   if(gOpener==NULL) {
     gOpener = opener;
   } else {
     *status = U_ILLEGAL_ARGUMENT_ERROR;
   }
-  umtx_unlock(NULL);
+  umtx_unlock(&gOpenerMutex);
 }
 
 U_INTERNAL UDateFormatOpener U_EXPORT2
@@ -112,14 +113,14 @@ udat_unregisterOpener(UDateFormatOpener opener, UErrorCode *status)
 {
   if(U_FAILURE(*status)) return NULL;
   UDateFormatOpener oldOpener = NULL;
-  umtx_lock(NULL);
+  umtx_lock(&gOpenerMutex);
   if(gOpener==NULL || gOpener!=opener) {
     *status = U_ILLEGAL_ARGUMENT_ERROR;
   } else {
     oldOpener=gOpener;
     gOpener=NULL;
   }
-  umtx_unlock(NULL);
+  umtx_unlock(&gOpenerMutex);
   return oldOpener;
 }
 
@@ -1163,6 +1163,14 @@ class U_I18N_API Collator : public UObject {
             UCharIterator *iter, uint32_t state[2],
             uint8_t *dest, int32_t count, UErrorCode &errorCode) const;
 
+    /**
+     * Implements ucol_getSortKeyUTF8().
+     * @internal
+     */
+    virtual int32_t internalGetSortKeyUTF8(
+            const char *s, int32_t length,
+            uint8_t *dest, int32_t capacity, UErrorCode &errorCode) const;
+
 #ifndef U_HIDE_INTERNAL_API
     /** @internal */
     static inline Collator *fromUCollator(UCollator *uc) {
@@ -1156,6 +1156,37 @@ class U_I18N_API DecimalFormat : public NumberFormat {
      */
     CurrencyAmount* parseCurrency(const UnicodeString& text, ParsePosition& pos) const U_OVERRIDE;
 
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Parses a number from the start of UTF-8 text into a double.
+     *
+     * This is a lightweight alternative to parse() for bulk input such as delimited files: it produces
+     * no Formattable, and the parser is built on first use and reused by all subsequent calls on this
+     * object. The text is converted to UTF-16 before parsing; for short fields the converted copy fits
+     * into the UnicodeString stack buffer, and longer ones allocate.
+     *
+     * @param text    UTF-8 text; parsing starts at its first byte.
+     * @param result  Receives the parsed value on success.
+     * @param status  Set to U_INVALID_FORMAT_ERROR if no number could be parsed.
+     * @return The number of bytes consumed, or 0 on failure.
+     * @draft ICU 65
+     */
+    int32_t parseDouble(StringPiece text, double& result, UErrorCode& status) const;
+
+    /**
+     * Parses an integer from the start of UTF-8 text into an int64_t.
+     * See parseDouble(StringPiece, double&, UErrorCode&) for details.
+     *
+     * @param text    UTF-8 text; parsing starts at its first byte.
+     * @param result  Receives the parsed value on success.
+     * @param status  Set to U_INVALID_FORMAT_ERROR if no number could be parsed, or if the parsed number
+     *                is not an integer in the range of int64_t.
+     * @return The number of bytes consumed, or 0 on failure.
+     * @draft ICU 65
+     */
+    int32_t parseInt64(StringPiece text, int64_t& result, UErrorCode& status) const;
+#endif  /* U_HIDE_DRAFT_API */
+
     /**
      * Returns the decimal format symbols, which is generally not changed
      * by the programmer or user.
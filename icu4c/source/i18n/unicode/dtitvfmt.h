@@ -697,6 +697,7 @@ class U_I18N_API DateIntervalFormat : public Format {
     DateIntervalFormat& operator=(const DateIntervalFormat&);
 
 private:
+    friend class DateIntervalFormatKey;
 
     /*
      * This is for ICU internal use only. Please do not use.
@@ -498,6 +498,8 @@ class U_I18N_API DateTimePatternGenerator : public UObject {
     static UClassID U_EXPORT2 getStaticClassID(void);
 
 private:
+    friend class SharedDateTimePatternGenerator;
+
     /**
      * Constructor.
      */
@@ -545,6 +547,10 @@ class U_I18N_API DateTimePatternGenerator : public UObject {
     // When this is set to an error the object is in an invalid state.
     UErrorCode internalErrorCode;
 
+    // The cached generator this one was cloned from, while this one is unmodified;
+    // shares its memo of best patterns. NULL otherwise.
+    const SharedDateTimePatternGenerator *fSharedData;
+
     /* internal flags masks for adjustFieldTypes etc. */
     enum {
         kDTPGNoFlags = 0,
@@ -554,6 +560,7 @@ class U_I18N_API DateTimePatternGenerator : public UObject {
     };
 
     void initData(const Locale &locale, UErrorCode &status);
+    UnicodeString getBestPatternImpl(const UnicodeString& patternForm, UDateTimePatternMatchOptions options, UErrorCode& status);
     void addCanonicalItems(UErrorCode &status);
     void addICUPatterns(const Locale& locale, UErrorCode& status);
     void hackTimes(const UnicodeString& hackPattern, UErrorCode& status);
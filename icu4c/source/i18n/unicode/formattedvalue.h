@@ -12,6 +12,7 @@
 #ifndef U_HIDE_DRAFT_API
 
 #include "unicode/appendable.h"
+#include "unicode/bytestream.h"
 #include "unicode/fpositer.h"
 #include "unicode/unistr.h"
 #include "unicode/uformattedvalue.h"
@@ -287,6 +288,20 @@ class U_I18N_API FormattedValue /* not : public UObject because this is an inter
      */
     virtual Appendable& appendTo(Appendable& appendable, UErrorCode& status) const = 0;
 
+    /**
+     * Appends the formatted string to a ByteSink in UTF-8.
+     *
+     * The string is converted from the temporary string (see #toTempString)
+     * directly into the sink, without an intermediate copy of the UTF-16 string.
+     *
+     * @param sink The ByteSink to which to append the UTF-8 string.
+     * @param status Set if an error occurs.
+     *
+     * @draft ICU 65
+     * @see ByteSink
+     */
+    void appendToUTF8(ByteSink& sink, UErrorCode& status) const;
+
     /**
      * Iterates over field positions in the FormattedValue. This lets you determine the position
      * of specific types of substrings, like a month or a decimal separator.
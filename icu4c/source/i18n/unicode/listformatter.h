@@ -35,7 +35,7 @@ class FormattedListData;
 class ListFormatter;
 
 /** @internal */
-class Hashtable;
+class ListFormatterKey;
 
 /** @internal */
 struct ListFormatInternal;
@@ -283,7 +283,7 @@ class U_I18N_API ListFormatter : public UObject{
 #endif  /* U_HIDE_INTERNAL_API */
 
   private:
-    static void initializeHash(UErrorCode& errorCode);
+    friend class ListFormatterKey;
     static const ListFormatInternal* getListFormatInternal(const Locale& locale, const char *style, UErrorCode& errorCode);
     struct ListPatternsSink;
     static ListFormatInternal* loadListFormatInternal(const Locale& locale, const char* style, UErrorCode& errorCode);
@@ -294,7 +294,6 @@ class U_I18N_API ListFormatter : public UObject{
 
     ListFormatter();
 
-    ListFormatInternal* owned;
     const ListFormatInternal* data;
 };
 
@@ -48,6 +48,7 @@ U_NAMESPACE_BEGIN
 class AppendableWrapper;
 class DateFormat;
 class NumberFormat;
+class SharedMessageFormat;
 
 /**
  * <p>MessageFormat prepares strings for display to users,
@@ -837,6 +838,18 @@ class U_I18N_API MessageFormat : public Format {
      * @internal
      */
     int32_t getArgTypeCount() const;
+
+    /**
+     * ICU use only.
+     * Returns a handle to the shared, cached MessageFormat for the given
+     * pattern and locale. The shared instance creates all of its formatters
+     * up front, so its format() methods may be called concurrently from
+     * multiple threads; it must not be modified. On success, the caller
+     * must call removeRef() on the returned value once it is done with it.
+     * @internal
+     */
+    static const SharedMessageFormat* U_EXPORT2 createSharedInstance(
+            const UnicodeString& pattern, const Locale& locale, UErrorCode& status);
 #endif  /* U_HIDE_INTERNAL_API */
 
     /**
@@ -901,6 +914,7 @@ class U_I18N_API MessageFormat : public Format {
         virtual UnicodeString select(void *ctx, double number, UErrorCode& ec) const;
 
         void reset();
+        void loadRules(UErrorCode& ec);
     private:
         const MessageFormat &msgFormat;
         PluralRules* rules;
@@ -942,6 +956,20 @@ class U_I18N_API MessageFormat : public Format {
     UHashtable* cachedFormatters;
     UHashtable* customFormatArgStarts;
 
+    /**
+     * Per-part-index view of cachedFormatters and of the plural number
+     * argument lookup, resolved when the pattern or a format changes
+     * so that format() need not repeat hash lookups and dynamic_casts
+     * for every argument. Only entries at ARG_START indexes are used.
+     */
+    struct ArgStartFormat;
+    ArgStartFormat* argStartFormats;
+    int32_t argStartFormatCount;
+
+    UBool allocateArgStartFormats(int32_t count, UErrorCode& status);
+    void setArgStartFormatSlot(int32_t argStart, const Format* formatter);
+    void clearArgStartFormatSlots();
+
     PluralSelectorProvider pluralProvider;
     PluralSelectorProvider ordinalProvider;
 
@@ -1021,7 +1049,7 @@ class U_I18N_API MessageFormat : public Format {
 
     const Formattable* getArgFromListByName(const Formattable* arguments,
                                             const UnicodeString *argumentNames,
-                                            int32_t cnt, UnicodeString& name) const;
+                                            int32_t cnt, const MessagePattern::Part& namePart) const;
 
     Formattable* parse(int32_t msgStart,
                        const UnicodeString& source,
@@ -1082,6 +1110,12 @@ class U_I18N_API MessageFormat : public Format {
      */
     void resetPattern();
 
+    /**
+     * Creates the default formats and plural rules that format() would
+     * otherwise create on first use, so that formatting does not modify *this.
+     */
+    void preloadFormatters(UErrorCode& status);
+
     /**
      * A DummyFormatter that we use solely to store a NULL value. UHash does
      * not support storing NULL values.
@@ -1107,6 +1141,7 @@ class U_I18N_API MessageFormat : public Format {
     };
 
     friend class MessageFormatAdapter; // getFormatTypeList() access
+    friend class MessageFormatKey;     // preloadFormatters() access
 };
 
 U_NAMESPACE_END
@@ -2269,6 +2269,136 @@ class U_I18N_API LocalizedNumberFormatter
      */
     FormattedNumber formatDecimal(StringPiece value, UErrorCode& status) const;
 
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Formats the given integer directly into a caller-provided UTF-16 buffer.
+     *
+     * Unlike formatInt(int64_t, UErrorCode&), this method does not allocate a FormattedNumber and, for
+     * typical output lengths, does not allocate any heap memory. Use it in tight loops that need only the
+     * formatted string and no field positions.
+     *
+     * The output is NUL-terminated if there is enough room. Standard ICU preflighting applies: if the
+     * result does not fit, U_BUFFER_OVERFLOW_ERROR is set and the full length is returned.
+     *
+     * @param value
+     *            The number to format.
+     * @param dest
+     *            Destination buffer; can be NULL if destCapacity is 0.
+     * @param destCapacity
+     *            Number of char16_t available at dest.
+     * @param status
+     *            Set to an ErrorCode if one occurred in the setter chain or during formatting.
+     * @return The length of the formatted string, not counting the terminating NUL.
+     * @draft ICU 65
+     */
+    int32_t formatInt(int64_t value, char16_t* dest, int32_t destCapacity, UErrorCode& status) const;
+
+    /**
+     * Formats the given float or double directly into a caller-provided UTF-16 buffer.
+     * See formatInt(int64_t, char16_t*, int32_t, UErrorCode&) for details.
+     *
+     * @param value
+     *            The number to format.
+     * @param dest
+     *            Destination buffer; can be NULL if destCapacity is 0.
+     * @param destCapacity
+     *            Number of char16_t available at dest.
+     * @param status
+     *            Set to an ErrorCode if one occurred in the setter chain or during formatting.
+     * @return The length of the formatted string, not counting the terminating NUL.
+     * @draft ICU 65
+     */
+    int32_t formatDouble(double value, char16_t* dest, int32_t destCapacity, UErrorCode& status) const;
+
+    /**
+     * Formats the given integer directly into a caller-provided UTF-8 buffer.
+     * See formatInt(int64_t, char16_t*, int32_t, UErrorCode&) for details.
+     *
+     * This method has a distinct name so that preflighting with a NULL buffer
+     * is not ambiguous with the UTF-16 version.
+     *
+     * @param value
+     *            The number to format.
+     * @param dest
+     *            Destination buffer; can be NULL if destCapacity is 0.
+     * @param destCapacity
+     *            Number of bytes available at dest.
+     * @param status
+     *            Set to an ErrorCode if one occurred in the setter chain or during formatting.
+     * @return The length of the formatted string in bytes, not counting the terminating NUL.
+     * @draft ICU 65
+     */
+    int32_t formatIntUTF8(int64_t value, char* dest, int32_t destCapacity, UErrorCode& status) const;
+
+    /**
+     * Formats the given float or double directly into a caller-provided UTF-8 buffer.
+     * See formatIntUTF8() for details.
+     *
+     * @param value
+     *            The number to format.
+     * @param dest
+     *            Destination buffer; can be NULL if destCapacity is 0.
+     * @param destCapacity
+     *            Number of bytes available at dest.
+     * @param status
+     *            Set to an ErrorCode if one occurred in the setter chain or during formatting.
+     * @return The length of the formatted string in bytes, not counting the terminating NUL.
+     * @draft ICU 65
+     */
+    int32_t formatDoubleUTF8(double value, char* dest, int32_t destCapacity, UErrorCode& status) const;
+
+    /**
+     * Formats an array of doubles into one contiguous UTF-16 buffer. The formatted strings are
+     * concatenated without separators; their boundaries are reported in the offsets array: the string
+     * for values[i] occupies dest[offsets[i]] through dest[offsets[i+1]-1].
+     *
+     * The formatter's data structures are built once for the whole batch, and no per-value objects are
+     * allocated. This is considerably faster than calling formatDouble() in a loop.
+     *
+     * Standard ICU preflighting applies to dest: if the concatenation does not fit, U_BUFFER_OVERFLOW_ERROR
+     * is set, the full length is returned and offsets are still filled in.
+     *
+     * @param values
+     *            The numbers to format.
+     * @param count
+     *            The number of values.
+     * @param dest
+     *            Destination buffer; can be NULL if destCapacity is 0.
+     * @param destCapacity
+     *            Number of char16_t available at dest.
+     * @param offsets
+     *            If not NULL, receives count+1 offsets into dest.
+     * @param status
+     *            Set to an ErrorCode if one occurred in the setter chain or during formatting.
+     * @return The total length of the formatted strings, not counting the terminating NUL.
+     * @draft ICU 65
+     */
+    int32_t formatBatch(const double* values, int32_t count, char16_t* dest, int32_t destCapacity,
+                        int32_t* offsets, UErrorCode& status) const;
+
+    /**
+     * Formats an array of integers into one contiguous UTF-16 buffer.
+     * See formatBatch(const double*, int32_t, char16_t*, int32_t, int32_t*, UErrorCode&) for details.
+     *
+     * @param values
+     *            The numbers to format.
+     * @param count
+     *            The number of values.
+     * @param dest
+     *            Destination buffer; can be NULL if destCapacity is 0.
+     * @param destCapacity
+     *            Number of char16_t available at dest.
+     * @param offsets
+     *            If not NULL, receives count+1 offsets into dest.
+     * @param status
+     *            Set to an ErrorCode if one occurred in the setter chain or during formatting.
+     * @return The total length of the formatted strings, not counting the terminating NUL.
+     * @draft ICU 65
+     */
+    int32_t formatBatch(const int64_t* values, int32_t count, char16_t* dest, int32_t destCapacity,
+                        int32_t* offsets, UErrorCode& status) const;
+#endif  /* U_HIDE_DRAFT_API */
+
 #ifndef U_HIDE_INTERNAL_API
 
     /** Internal method.
@@ -2310,6 +2440,36 @@ class U_I18N_API LocalizedNumberFormatter
      */
     Format* toFormat(UErrorCode& status) const;
 
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Returns a copy of this LocalizedNumberFormatter whose internal formatting data structures have
+     * already been built.
+     *
+     * By default, a LocalizedNumberFormatter formats its first few numbers on a slower path and builds a
+     * more efficient data structure only once it has been used several times. This method builds that
+     * data structure right away, which is useful for formatters that are created and used only for a
+     * short time, or to move the cost out of a latency-sensitive first call.
+     *
+     * The data structure is immutable, so the returned formatter can be used from multiple threads.
+     * Note that it is not carried over by copying; only moving the formatter keeps it.
+     *
+     * @param status Set if an error occurred in the setter chain or while building the data structure.
+     * @return A compiled copy of this formatter.
+     * @draft ICU 65
+     */
+    LocalizedNumberFormatter toCompiled(UErrorCode& status) const &;
+
+    /**
+     * Overload of toCompiled() for use on an rvalue reference.
+     *
+     * @param status Set if an error occurred in the setter chain or while building the data structure.
+     * @return A compiled formatter, moved from this formatter.
+     * @see #toCompiled
+     * @draft ICU 65
+     */
+    LocalizedNumberFormatter toCompiled(UErrorCode& status) &&;
+#endif  /* U_HIDE_DRAFT_API */
+
     /**
      * Default constructor: puts the formatter into a valid but undefined state.
      *
@@ -2390,6 +2550,26 @@ class U_I18N_API LocalizedNumberFormatter
      */
     bool computeCompiled(UErrorCode& status) const;
 
+    /**
+     * Builds the compiled formatter now, regardless of the call count.
+     */
+    void compileEagerly(UErrorCode& status);
+
+    /**
+     * Formats results->quantity and copies the string to dest, using a results object on the stack.
+     */
+    int32_t formatToBuffer(impl::UFormattedNumberData& results, char16_t* dest, int32_t destCapacity,
+                           UErrorCode& status) const;
+
+    int32_t formatToBuffer(impl::UFormattedNumberData& results, char* dest, int32_t destCapacity,
+                           UErrorCode& status) const;
+
+    /**
+     * Shared implementation of formatBatch(); exactly one of doubles and ints is not NULL.
+     */
+    int32_t formatBatchImpl(const double* doubles, const int64_t* ints, int32_t count, char16_t* dest,
+                            int32_t destCapacity, int32_t* offsets, UErrorCode& status) const;
+
     // To give the fluent setters access to this class's constructor:
     friend class NumberFormatterSettings<UnlocalizedNumberFormatter>;
     friend class NumberFormatterSettings<LocalizedNumberFormatter>;
@@ -48,6 +48,7 @@ class Hashtable;
 class IFixedDecimal;
 class RuleChain;
 class PluralRuleParser;
+class PluralRuleProgram;
 class PluralKeywordEnumeration;
 class AndConstraint;
 class SharedPluralRules;
@@ -351,6 +352,19 @@ class U_I18N_API PluralRules : public UObject {
     UnicodeString select(double number) const;
 
 #ifndef U_HIDE_DRAFT_API
+    /**
+     * Given a 64-bit integer, returns the keyword of the first rule
+     * that applies to  the number.  This function can be used with
+     * isKeyword* functions to determine the keyword for default plural rules.
+     *
+     * Integers are evaluated without converting them to a decimal number first.
+     *
+     * @param number  The number for which the rule has to be determined.
+     * @return        The keyword of the selected rule.
+     * @draft ICU 65
+     */
+    UnicodeString select(int64_t number) const;
+
     /**
      * Given a formatted number, returns the keyword of the first rule
      * that applies to  the number.  This function can be used with
@@ -515,6 +529,7 @@ class U_I18N_API PluralRules : public UObject {
 
 private:
     RuleChain  *mRules;
+    PluralRuleProgram *mProgram;
 
     PluralRules();   // default constructor not implemented
     void            parseDescription(const UnicodeString& ruleData, UErrorCode &status);
@@ -45,8 +45,11 @@ U_NAMESPACE_BEGIN
 class NFRule;
 class NFRuleSet;
 class LocalizationInfo;
+class Hashtable;
 class PluralFormat;
 class RuleBasedCollator;
+class SharedRuleBasedNumberFormat;
+class UVector32;
 
 /**
  * Tags for the predefined rulesets.
@@ -1061,6 +1064,20 @@ class U_I18N_API RuleBasedNumberFormat : public NumberFormat {
      */
     virtual void setDecimalFormatSymbols(const DecimalFormatSymbols& symbols);
 
+#ifndef U_HIDE_INTERNAL_API
+    /**
+     * ICU use only.
+     * Returns a handle to the shared, cached formatter for the given rule set
+     * tag and locale. Its rules are parsed only once per tag and locale; the
+     * constructor taking a URBNFRuleSetTag copies the parsed rules from it.
+     * The shared instance must not be modified. On success, the caller
+     * must call removeRef() on the returned value once it is done with it.
+     * @internal
+     */
+    static const SharedRuleBasedNumberFormat* U_EXPORT2 createSharedInstance(
+            URBNFRuleSetTag tag, const Locale& locale, UErrorCode& status);
+#endif  /* U_HIDE_INTERNAL_API */
+
 private:
     RuleBasedNumberFormat(); // default constructor not implemented
 
@@ -1070,6 +1087,9 @@ class U_I18N_API RuleBasedNumberFormat : public NumberFormat {
               const Locale& locale, UParseError& perror, UErrorCode& status);
 
     void init(const UnicodeString& rules, LocalizationInfo* localizations, UParseError& perror, UErrorCode& status);
+    static RuleBasedNumberFormat* createFromResources(URBNFRuleSetTag tag, const Locale& locale, UErrorCode& status);
+    void copyFrom(const RuleBasedNumberFormat& rhs, UErrorCode& status);
+    void copyRuleSets(const RuleBasedNumberFormat& rhs, UErrorCode& status);
     void initCapitalizationContextInfo(const Locale& thelocale);
     void dispose();
     void stripWhitespace(UnicodeString& src);
@@ -1081,9 +1101,11 @@ class U_I18N_API RuleBasedNumberFormat : public NumberFormat {
     friend class NFRule;
     friend class NFRuleSet;
     friend class FractionalPartSubstitution;
+    friend class RuleBasedNumberFormatKey;
 
     inline NFRuleSet * getDefaultRuleSet() const;
     const RuleBasedCollator * getCollator() const;
+    const UVector32 * getLenientPrimaries(const UnicodeString& key, UErrorCode& status) const;
     DecimalFormatSymbols * initializeDecimalFormatSymbols(UErrorCode &status);
     const DecimalFormatSymbols * getDecimalFormatSymbols() const;
     NFRule * initializeDefaultInfinityRule(UErrorCode &status);
@@ -1102,6 +1124,7 @@ class U_I18N_API RuleBasedNumberFormat : public NumberFormat {
     NFRuleSet *defaultRuleSet;
     Locale locale;
     RuleBasedCollator* collator;
+    Hashtable* lenientPrimaries;
     DecimalFormatSymbols* decimalFormatSymbols;
     NFRule *defaultInfinityRule;
     NFRule *defaultNaNRule;
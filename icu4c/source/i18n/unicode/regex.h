@@ -40,6 +40,9 @@
  * expression pattern strings application code can be simplified and the explicit
  * need for `RegexPattern` objects can usually be eliminated.
  *
+ * Class `RegexSet` tests an input text against many patterns at once, reporting
+ *  which of the patterns match.
+ *
  */
 
 #include "unicode/utypes.h"
@@ -63,8 +66,11 @@ U_NAMESPACE_BEGIN
 
 struct Regex8BitSet;
 class  RegexCImpl;
+class  RegexDFA;
 class  RegexMatcher;
+class  RegexNFA;
 class  RegexPattern;
+class  RegexSet;
 struct REStackFrame;
 class  RuleBasedBreakIterator;
 class  UnicodeSet;
@@ -417,6 +423,41 @@ class U_I18N_API RegexPattern U_FINAL : public UObject {
         UParseError     &pe,
         UErrorCode      &status);
 
+#ifndef U_HIDE_DRAFT_API
+   /**
+    * Test whether a string matches this pattern.  The result is the same as from
+    * creating a RegexMatcher for the input and calling its matches() function,
+    * but the pattern keeps a small pool of matchers that are reused from one call to
+    * the next.  Once a matcher is pooled, a call needs no heap allocation, except
+    * for patterns that need extra storage for the input; see matcher().
+    *
+    * This function may be called from several threads at once for the same pattern.
+    *
+    * @param input The string data to be matched
+    * @param status A reference to a UErrorCode to receive any errors.
+    * @return True if the pattern exactly matches the full input string.
+    *
+    * @draft ICU 65
+    */
+    UBool matches(const UnicodeString &input, UErrorCode &status) const;
+
+   /**
+    * Test whether a string matches this pattern.  The result is the same as from
+    * creating a RegexMatcher for the input and calling its matches() function,
+    * but the pattern keeps a small pool of matchers that are reused from one call to
+    * the next.
+    *
+    * This function may be called from several threads at once for the same pattern.
+    *
+    * @param input The string data to be matched
+    * @param status A reference to a UErrorCode to receive any errors.
+    * @return True if the pattern exactly matches the full input string.
+    *
+    * @draft ICU 65
+    */
+    UBool matches(UText *input, UErrorCode &status) const;
+#endif  /* U_HIDE_DRAFT_API */
+
    /**
     * Returns the regular expression from which this pattern was compiled. This method will work
     * even if the pattern was compiled from a UText.
@@ -626,11 +667,26 @@ class U_I18N_API RegexPattern U_FINAL : public UObject {
     Regex8BitSet   *fInitialChars8;
     UBool           fNeedsAltInput;
 
+    int32_t         fRequiredStringIdx;    // A literal string that every match contains,
+    int32_t         fRequiredStringLen;    //   in fLiteralText.  Zero length if none.
+    int32_t         fRequiredStringStart;  // Upper bound, in UTF-16 units, on the offset of the
+                                           //   required string from the start of the match.
+                                           //   INT32_MAX if unbounded.
+
     UHashtable     *fNamedCaptureMap;  // Map from capture group names to numbers.
 
+    RegexNFA       *fNFA;          // The pattern as an NFA, for matching without
+                                   //   backtracking.  NULL if the pattern can't be
+                                   //   matched that way.
+
+    mutable RegexMatcher *fMatcherPool[4];  // Idle matchers for matches(input).
+    mutable int32_t       fMatcherPoolSize; //   Guarded by a mutex in repattrn.cpp.
+
     friend class RegexCompile;
     friend class RegexMatcher;
     friend class RegexCImpl;
+    friend class RegexNFA;
+    friend class RegexSet;
 
     //
     //  Implementation Methods
@@ -638,6 +694,9 @@ class U_I18N_API RegexPattern U_FINAL : public UObject {
     void        init();            // Common initialization, for use by constructors.
     void        zap();             // Common cleanup
 
+    RegexMatcher *acquireMatcher(UErrorCode &status) const;   // Take a matcher from the pool.
+    void        releaseMatcher(RegexMatcher *matcher) const;  // Return it to the pool.
+
     void        dumpOp(int32_t index) const;
 
   public:
@@ -741,6 +800,25 @@ class U_I18N_API RegexMatcher U_FINAL : public UObject {
     RegexMatcher(UText *regexp, UText *input,
         uint32_t flags, UErrorCode &status);
 
+#ifndef U_HIDE_DRAFT_API
+    /**
+      * Construct a RegexMatcher for a pattern that has already been compiled.
+      * Unlike RegexPattern::matcher(), this allows the matcher to be a local
+      * variable or a member of another object, so that a pattern shared by several
+      * threads can be matched without allocating a new matcher on the heap each time.
+      * The input is initially empty; set it with reset().
+      *
+      * The matcher retains a reference to the pattern, which must not be deleted
+      * while the matcher exists.
+      *
+      *  @param pattern The compiled pattern.
+      *  @param status  Any errors are reported by setting this UErrorCode variable.
+      *
+      *  @draft ICU 65
+      */
+    RegexMatcher(const RegexPattern &pattern, UErrorCode &status);
+#endif  /* U_HIDE_DRAFT_API */
+
 private:
     /**
      * Cause a compilation error if an application accidentally attempts to
@@ -1664,6 +1742,87 @@ class U_I18N_API RegexMatcher U_FINAL : public UObject {
     */
     virtual int32_t  getStackLimit() const;
 
+#ifndef U_HIDE_DRAFT_API
+  /**
+    *  Set a limit on the number of times that the match engine may backtrack,
+    *  resuming from a state that it saved earlier in the match.
+    *  When the limit is exceeded the match operation fails with U_REGEX_TIME_OUT.
+    *
+    *  The limit applies to each call of find(), matches() or lookingAt().
+    *  It is checked at the intervals of processing steps at which the time limit is,
+    *  so that an operation may run a few thousand backtracks past it before it stops.
+    *
+    *  By default, backtracking is not limited.
+    *
+    *  @param limit   The maximum number of backtracks, or 0 for no limit.
+    *                 The limit must be greater or equal to zero.
+    *  @param status  A reference to a UErrorCode to receive any errors.
+    *  @draft ICU 65
+    */
+    void setBacktrackLimit(int64_t limit, UErrorCode &status);
+
+  /**
+    *  Get the backtrack limit, if any, for match operations made with this Matcher.
+    *
+    *  @return the maximum number of backtracks, or zero if backtracking is not limited.
+    *  @draft ICU 65
+    */
+    int64_t getBacktrackLimit() const;
+
+  /**
+    *  Set a wall clock deadline for match operations with this Matcher.
+    *  A match operation that is still running at the deadline fails with
+    *  U_REGEX_TIME_OUT.  The clock is read at the intervals of processing steps
+    *  at which the time limit is checked.
+    *
+    *  By default, there is no deadline.
+    *
+    *  @param deadline  The deadline, in milliseconds since 1970-01-01 00:00 UTC as
+    *                   returned by ucal_getNow(), or 0 for no deadline.
+    *                   The deadline must be greater or equal to zero.
+    *  @param status    A reference to a UErrorCode to receive any errors.
+    *  @draft ICU 65
+    */
+    void setDeadline(UDate deadline, UErrorCode &status);
+
+  /**
+    *  Get the wall clock deadline, if any, for match operations made with this Matcher.
+    *
+    *  @return the deadline, in milliseconds since 1970-01-01 00:00 UTC, or zero if there is none.
+    *  @draft ICU 65
+    */
+    UDate getDeadline() const;
+
+  /**
+    *  Get the number of pattern operations that the match engine executed
+    *  during the last call of find(), matches() or lookingAt().
+    *  Matches that ICU finds without running the backtracking engine do not add to the count.
+    *
+    *  @return the number of operations executed.
+    *  @draft ICU 65
+    */
+    int64_t getOpCount() const;
+
+  /**
+    *  Get the number of times that the match engine backtracked
+    *  during the last call of find(), matches() or lookingAt().
+    *
+    *  @return the number of backtracks.
+    *  @draft ICU 65
+    */
+    int64_t getBacktrackCount() const;
+
+  /**
+    *  Get the largest size that the backtrack stack reached
+    *  during the last call of find(), matches() or lookingAt().
+    *  Compare with getStackLimit().
+    *
+    *  @return the size, in bytes, of the backtrack stack at its deepest.
+    *  @draft ICU 65
+    */
+    int64_t getStackHighWater() const;
+#endif  /* U_HIDE_DRAFT_API */
+
 
   /**
     * Set a callback function for use with this Matcher.
@@ -1775,23 +1934,40 @@ class U_I18N_API RegexMatcher U_FINAL : public UObject {
     //
     //  MatchAt   This is the internal interface to the match engine itself.
     //            Match status comes back in matcher member variables.
+    //            MatchUsing() is the engine, reading the input through one of
+    //            the input reader types in rematch.cpp.
     //
     void                 MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status);
+    template<typename Input>
+    void                 MatchUsing(Input &input, int64_t startIdx, UBool toEnd, UErrorCode &status);
     inline void          backTrack(int64_t &inputIdx, int32_t &patIdx);
-    UBool                isWordBoundary(int64_t pos);         // perform Perl-like  \b test
+    template<typename Input>
+    UBool                isWordBoundary(Input &input, int64_t pos);   // perform Perl-like  \b test
     UBool                isUWordBoundary(int64_t pos);        // perform RBBI based \b test
     REStackFrame        *resetStack();
     inline REStackFrame *StateSave(REStackFrame *fp, int64_t savePatIdx, UErrorCode &status);
+    inline REStackFrame *StateRestore(REStackFrame *fp);
+    inline void          setExtra(REStackFrame *fp, int32_t index, int64_t value, UErrorCode &status);
+    inline REStackFrame *cutStack(REStackFrame *fp, int32_t newStackSize);
+    inline int64_t       savedStateCount() const;
     void                 IncrementTime(UErrorCode &status);
+    void                 resetCounters();
 
     // Call user find callback function, if set. Return TRUE if operation should be interrupted.
     inline UBool         findProgressInterrupt(int64_t matchIndex, UErrorCode &status);
     
     int64_t              appendGroup(int32_t groupNum, UText *dest, UErrorCode &status) const;
     
-    UBool                findUsingChunk(UErrorCode &status);
-    void                 MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &status);
-    UBool                isChunkWordBoundary(int32_t pos);
+    template<typename Input>
+    UBool                findUsing(Input &input, UErrorCode &status);
+    UBool                findUsingDFA(int64_t startPos, UErrorCode &status);
+    UBool                canSkipToRequiredString() const;
+    UBool                skipToRequiredString(int64_t &startPos);
+    UBool                matchAtWithDFAFallback(int64_t startIdx, UBool toEnd, UErrorCode &status);
+
+    //  getUTF8Input() returns the input text if it is a contiguous UTF-8 string that the
+    //  match engine can read directly, for an operation beginning at startIdx.
+    const uint8_t       *getUTF8Input(int64_t startIdx) const;
 
     const RegexPattern  *fPattern;
     RegexPattern        *fPatternOwned;    // Non-NULL if this matcher owns the pattern, and
@@ -1841,6 +2017,10 @@ class U_I18N_API RegexMatcher U_FINAL : public UObject {
     REStackFrame        *fFrame;           // After finding a match, the last active stack frame,
                                            //   which will contain the capture group results.
                                            //   NOT valid while match engine is running.
+    UBool                fUseUndoLog;      // Save states as frame headers plus an undo log of
+                                           //   the extra state, rather than as whole frames.
+    UVector64           *fUndoLog;         //   Index and old value of each change to the extra state.
+    int64_t             *fCurrentFrame;    //   The one frame, off the stack, that the engine runs in.
 
     int64_t             *fData;            // Data area for use by the compiled pattern.
     int64_t             fSmallData[8];     //   Use this for data if it's enough.
@@ -1874,7 +2054,169 @@ class U_I18N_API RegexMatcher U_FINAL : public UObject {
                                            //   reported, or that permanently disables this matcher.
 
     RuleBasedBreakIterator  *fWordBreakItr;
+
+    RegexDFA            *fDFA;             // Lazily built DFA for patterns with an NFA.
+    UBool                fDFAFallback;     // Set while the match engine runs an operation that the
+                                           //   DFA can take over if backtracking gets excessive.
+    UBool                fDFASwitch;       // Set when the match engine was stopped for the DFA.
+    int64_t              fDFAStartPos;     // Start position of the operation that may switch.
+    int32_t              fDFATimeStart;    // fTime when that operation began.
+
+    int64_t              fRequiredStringPos;  // Position of the pattern's required string found
+                                              //   by a previous find(), or -1.
+
+    int64_t              fBacktrackLimit;  // Max number of backtracks.  Zero for unlimited.
+    UDate                fDeadline;        // Wall clock time at which to stop.  Zero for none.
+
+    // Execution counters for the last find(), matches() or lookingAt().
+    //   The engine doesn't count its backtracks one by one.  Every state that it saves is
+    //   either backtracked into, or cut off the stack unused by some operation, or still
+    //   on the stack when the engine stops.
+    int64_t              fOpCount;         // Operations executed by the match engine.
+    int64_t              fSaveCount;       // States saved.
+    int64_t              fCutCount;        // Saved states discarded without backtracking.
+    int32_t              fStackHighWater;  // Largest size of fStack and fUndoLog, in elements.
+};
+
+
+#ifndef U_HIDE_DRAFT_API
+/**
+ *  class RegexSet holds a set of regular expression patterns, and reports which of
+ *  them match an input text.  A pattern matches if it would be found anywhere in
+ *  the text by RegexMatcher::find().
+ *
+ *  Patterns that need no backtracking state are combined into a few automata,
+ *  each of which scans the text once for all of its patterns, so that for them the
+ *  cost of a search grows with the length of the text, but not with the number of
+ *  patterns.  These are the patterns without back references, look-around
+ *  assertions, atomic or possessive constructs, counted loops, anchors, word
+ *  boundaries or case insensitive matching.  Each of the other patterns is
+ *  searched for by a RegexMatcher of its own.
+ *
+ *  The automaton states are built as they are needed by the searches, and are kept
+ *  by the RegexSet.  Like a RegexMatcher, a RegexSet must not be used by more than
+ *  one thread at a time.
+ *
+ *  <p>Class RegexSet is not intended to be subclassed.</p>
+ *
+ *  @draft ICU 65
+ */
+class U_I18N_API RegexSet U_FINAL : public UObject {
+public:
+
+    /**
+      * Construct an empty RegexSet.
+      *
+      *  @param flags  #URegexpFlag options, such as #UREGEX_CASE_INSENSITIVE, for
+      *                the patterns that are added to the set.
+      *  @param status Any errors are reported by setting this UErrorCode variable.
+      *  @draft ICU 65
+      */
+    RegexSet(uint32_t flags, UErrorCode &status);
+
+    /**
+     * Destructor.
+     *
+     * @draft ICU 65
+     */
+    virtual ~RegexSet();
+
+    /**
+      * Compile a regular expression and add it to the set.
+      * The combined automata are rebuilt by the next search.
+      *
+      *  @param regex  The regular expression to be compiled.
+      *  @param pe     Receives the position (line and column numbers) of any error
+      *                within the regular expression.
+      *  @param status Any errors are reported by setting this UErrorCode variable.
+      *  @return       The index of the pattern in the set, or -1 if it was not added.
+      *  @draft ICU 65
+      */
+    int32_t add(const UnicodeString &regex, UParseError &pe, UErrorCode &status);
+
+    /**
+      * Get the number of patterns in the set.
+      *
+      *  @return the number of patterns.
+      *  @draft ICU 65
+      */
+    int32_t size() const;
+
+    /**
+      * Get one of the patterns of the set.
+      *
+      *  @param index  The index of the pattern, from 0 to size()-1.
+      *  @return the pattern.  It is owned by the RegexSet.
+      *  @draft ICU 65
+      */
+    const RegexPattern &getPattern(int32_t index) const;
+
+    /**
+      * Find which patterns of the set match somewhere in an input text.
+      * The indexes of the matching patterns are written to dest in increasing order.
+      * If there are more of them than fit, status is set to U_BUFFER_OVERFLOW_ERROR,
+      * and the number returned is the number of patterns that match.
+      *
+      *  @param input         The input text.
+      *  @param dest          Receives the indexes of the matching patterns.
+      *                       May be NULL if destCapacity is 0.
+      *  @param destCapacity  The number of entries available at dest.
+      *  @param status        Any errors are reported by setting this UErrorCode variable.
+      *  @return              The number of patterns that match.
+      *  @draft ICU 65
+      */
+    int32_t find(const UnicodeString &input, int32_t *dest, int32_t destCapacity, UErrorCode &status);
+
+    /**
+      * Find which patterns of the set match somewhere in an input text.
+      * The indexes of the matching patterns are written to dest in increasing order.
+      * If there are more of them than fit, status is set to U_BUFFER_OVERFLOW_ERROR,
+      * and the number returned is the number of patterns that match.
+      *
+      *  @param input         The input text.  It is not retained by the RegexSet.
+      *  @param dest          Receives the indexes of the matching patterns.
+      *                       May be NULL if destCapacity is 0.
+      *  @param destCapacity  The number of entries available at dest.
+      *  @param status        Any errors are reported by setting this UErrorCode variable.
+      *  @return              The number of patterns that match.
+      *  @draft ICU 65
+      */
+    int32_t find(UText *input, int32_t *dest, int32_t destCapacity, UErrorCode &status);
+
+    /**
+    * ICU "poor man's RTTI", returns a UClassID for this class.
+    *
+    * @draft ICU 65
+    */
+    static UClassID U_EXPORT2 getStaticClassID();
+
+    /**
+     * ICU "poor man's RTTI", returns a UClassID for the actual class.
+     *
+     * @draft ICU 65
+     */
+    virtual UClassID getDynamicClassID() const;
+
+private:
+    // Instances of RegexSet can not be assigned, copied, cloned, etc.
+    RegexSet(const RegexSet &other);
+    RegexSet &operator =(const RegexSet &rhs);
+
+    void                 build(UErrorCode &status);
+    void                 addGroups(const RegexPattern **patterns, const int32_t *indexes, int32_t count,
+                                   UErrorCode &status);
+
+    UErrorCode           fDeferredStatus;  // Any error from the constructor.
+    uint32_t             fFlags;           // Flags for the patterns of the set.
+    UVector             *fPatterns;        // The RegexPatterns, owned.
+
+    UBool                fBuilt;           // The automata and matchers are up to date.
+    UVector             *fGroups;          // The RegexSetGroups of patterns scanned together.
+    UVector             *fMatchers;        // RegexMatchers for the other patterns.
+    UVector32           *fMatcherPatterns; //   The pattern index of each of fMatchers.
+    UBool               *fMatched;         // Scratch space, an entry per pattern.
 };
+#endif  /* U_HIDE_DRAFT_API */
 
 U_NAMESPACE_END
 #endif  // UCONFIG_NO_REGULAR_EXPRESSIONS
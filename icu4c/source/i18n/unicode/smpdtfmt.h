@@ -924,6 +924,41 @@ class U_I18N_API SimpleDateFormat: public DateFormat {
                                     FieldPositionIterator* posIter,
                                     UErrorCode& status) const;
 
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Formats a date or time directly into a caller-provided UTF-16 buffer.
+     * Use this in tight loops, for example for log timestamps, that need only
+     * the formatted string and no field positions.
+     *
+     * The output is NUL-terminated if there is enough room. Standard ICU preflighting
+     * applies: if the result does not fit, U_BUFFER_OVERFLOW_ERROR is set and
+     * the full length is returned.
+     *
+     * @param date          The date/time to format.
+     * @param dest          Destination buffer; can be NULL if destCapacity is 0.
+     * @param destCapacity  Number of char16_t available at dest.
+     * @param status        Input/output param set to success/failure code.
+     * @return              The length of the formatted string, not counting the terminating NUL.
+     * @draft ICU 65
+     */
+    int32_t formatToUTF16(UDate date, char16_t* dest, int32_t destCapacity,
+                          UErrorCode& status) const;
+
+    /**
+     * Formats a date or time directly into a caller-provided UTF-8 buffer.
+     * See formatToUTF16() for details.
+     *
+     * @param date          The date/time to format.
+     * @param dest          Destination buffer; can be NULL if destCapacity is 0.
+     * @param destCapacity  Number of bytes available at dest.
+     * @param status        Input/output param set to success/failure code.
+     * @return              The length of the formatted string in bytes, not counting the terminating NUL.
+     * @draft ICU 65
+     */
+    int32_t formatToUTF8(UDate date, char* dest, int32_t destCapacity,
+                         UErrorCode& status) const;
+#endif  /* U_HIDE_DRAFT_API */
+
     using DateFormat::parse;
 
     /**
@@ -1248,10 +1283,33 @@ class U_I18N_API SimpleDateFormat: public DateFormat {
      */
     SimpleDateFormat(const Locale& locale, UErrorCode& status); // Use default pattern
 
+    /**
+     * Calendar field values computed directly from a UDate, see formatWithFields().
+     */
+    struct DateFields;
+
     /**
      * Hook called by format(... FieldPosition& ...) and format(...FieldPositionIterator&...)
+     * If fields is not NULL, then the field values are taken from there instead of from cal.
      */
-    UnicodeString& _format(Calendar& cal, UnicodeString& appendTo, FieldPositionHandler& handler, UErrorCode& status) const;
+    UnicodeString& _format(Calendar& cal, UnicodeString& appendTo, FieldPositionHandler& handler, UErrorCode& status,
+                           const DateFields *fields = NULL) const;
+
+    /**
+     * Called by DateFormat::format(UDate ...). Formats the date without cloning fCalendar
+     * if it is a plain GregorianCalendar and the pattern uses only fields that can be
+     * computed directly from the date and the time zone offsets.
+     * @return FALSE if this fast path does not apply and nothing was formatted
+     */
+    UBool formatWithFields(UDate date, UnicodeString& appendTo, FieldPositionHandler& handler, UErrorCode& status) const;
+
+    /**
+     * Called by DateFormat::parse(const UnicodeString&, ParsePosition&). Parses text that
+     * matches a fixed-width numeric pattern like yyyy-MM-dd'T'HH:mm:ss.SSSXXX exactly,
+     * computing the UDate directly instead of through subParse() and a Calendar clone.
+     * @return FALSE if this fast path does not apply; then parsePos is unchanged
+     */
+    UBool parseFixedNumeric(const UnicodeString& text, ParsePosition& parsePos, UDate& result) const;
 
     /**
      * Called by format() to format a single field.
@@ -1268,6 +1326,8 @@ class U_I18N_API SimpleDateFormat: public DateFormat {
      * @param cal       Calendar to use
      * @param status    Receives a status code, which will be U_ZERO_ERROR if the operation
      *                  succeeds.
+     * @param fields    If not NULL, the field values to use instead of cal.get();
+     *                  then cal is used only for its type, time zone and limits.
      */
     void subFormat(UnicodeString &appendTo,
                    char16_t ch,
@@ -1276,7 +1336,8 @@ class U_I18N_API SimpleDateFormat: public DateFormat {
                    int32_t fieldNum,
                    FieldPositionHandler& handler,
                    Calendar& cal,
-                   UErrorCode& status) const; // in case of illegal argument
+                   UErrorCode& status,  // in case of illegal argument
+                   const DateFields *fields = NULL) const;
 
     /**
      * Used by subFormat() to format a numeric value.
@@ -1602,12 +1663,21 @@ class U_I18N_API SimpleDateFormat: public DateFormat {
     UBool                fHasMinute;
     UBool                fHasSecond;
     UBool                fHasHanYearChar; // pattern contains the Han year character \u5E74
+    UBool                fFixedNumericPattern; // see parseFixedNumeric()
 
     /**
-     * Sets fHasMinutes and fHasSeconds.
+     * Sets fHasMinutes, fHasSeconds and fFixedNumericPattern, and compiles fPattern into fCompiledPattern.
      */
     void                 parsePattern();
 
+    /**
+     * fPattern compiled by parsePattern() into a sequence of items, so that format()
+     * need not scan the pattern. Each item starts with a unit u:
+     * u<0x8000: a literal of u code units follows (quotes already resolved).
+     * u>=0x8000: a field; the pattern character follows and the count is u&0x7fff.
+     */
+    UnicodeString        fCompiledPattern;
+
     /**
      * See documentation for defaultCenturyStart.
      */
@@ -1643,6 +1713,12 @@ class U_I18N_API SimpleDateFormat: public DateFormat {
      */
     const number::LocalizedNumberFormatter* fFastNumberFormatters[SMPDTFMT_NF_COUNT] = {};
 
+    /**
+     * TRUE if the fast number formatters output plain ASCII digits for non-negative integers,
+     * so that zeroPaddingNumber() can write those digits itself.
+     */
+    UBool fHasAsciiDigits = FALSE;
+
     UBool fHaveDefaultCentury;
 
     BreakIterator* fCapitalizationBrkIter;
@@ -88,6 +88,7 @@ class StringSearch;
 */
 class CollationElementIterator;
 class CollationKey;
+class ByteSink;
 class SortKeyByteSink;
 class UnicodeSet;
 class UnicodeString;
@@ -188,6 +189,11 @@ class U_I18N_API RuleBasedCollator : public Collator {
     *  collator remains owned by the user and should stay around for
     *  the lifetime of the collator. The API also takes a base collator
     *  which must be the root collator.
+    *
+    *  The binary image is used in place, not copied, and it is not modified.
+    *  It may therefore be in read-only memory that is shared among processes,
+    *  such as a memory-mapped file or a shared memory segment filled by another
+    *  process with the same ICU version, so that the tailoring data is stored only once.
     *  @param bin binary image owned by the user and required through the
     *             lifetime of the collator
     *  @param length size of the image. If negative, the API will try to
@@ -651,6 +657,41 @@ class U_I18N_API RuleBasedCollator : public Collator {
     virtual int32_t getSortKey(const char16_t *source, int32_t sourceLength,
                                uint8_t *result, int32_t resultLength) const;
 
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Writes the sort key for the text to the sink in a single pass over the text.
+     * The primary weights are passed on to the sink in chunks while the text is
+     * iterated; only the compressed weights of the other levels are buffered
+     * until the end of the text.
+     * This lets an external sort stream the keys of very long strings
+     * without calling ucol_nextSortKeyPart() repeatedly,
+     * which iterates over the text again for each part.
+     *
+     * The bytes are the same as from getSortKey(), including the terminating 00 byte.
+     * With strength UCOL_IDENTICAL, the text is read into a buffer for the identical level.
+     *
+     * @param iter the text; iterated from its start
+     * @param sink the sort key bytes are appended to this sink
+     * @param errorCode ICU error code in/out parameter.
+     *                  Must fulfill U_SUCCESS before the function call.
+     * @see ucol_nextSortKeyPart
+     * @draft ICU 65
+     */
+    void writeSortKey(UCharIterator &iter, ByteSink &sink, UErrorCode &errorCode) const;
+
+    /**
+     * Writes the sort key for the UTF-8 text to the sink in a single pass over the text,
+     * like writeSortKey(UCharIterator &, ...).
+     *
+     * @param s the UTF-8 text
+     * @param sink the sort key bytes are appended to this sink
+     * @param errorCode ICU error code in/out parameter.
+     *                  Must fulfill U_SUCCESS before the function call.
+     * @draft ICU 65
+     */
+    void writeSortKeyUTF8(StringPiece s, ByteSink &sink, UErrorCode &errorCode) const;
+#endif  // U_HIDE_DRAFT_API
+
     /**
      * Retrieves the reordering codes for this collator.
      * @param dest The array to fill with the script ordering.
@@ -728,6 +769,14 @@ class U_I18N_API RuleBasedCollator : public Collator {
             UCharIterator *iter, uint32_t state[2],
             uint8_t *dest, int32_t count, UErrorCode &errorCode) const;
 
+    /**
+     * Implements ucol_getSortKeyUTF8().
+     * @internal
+     */
+    virtual int32_t internalGetSortKeyUTF8(
+            const char *s, int32_t length,
+            uint8_t *dest, int32_t capacity, UErrorCode &errorCode) const;
+
     // Do not enclose the default constructor with #ifndef U_HIDE_INTERNAL_API
     /**
      * Only for use in ucol_openRules().
@@ -778,6 +827,20 @@ class U_I18N_API RuleBasedCollator : public Collator {
             UParseError *outParseError, UnicodeString *outReason,
             UErrorCode &errorCode);
 
+    /**
+     * Implements ucol_openRulesCached().
+     * Maps the tailoring from a cache file in cacheDir if there is one,
+     * otherwise builds it and writes the file.
+     * @internal
+     */
+    void internalBuildCachedTailoring(
+            const UnicodeString &rules,
+            int32_t strength,
+            UColAttributeValue decompositionMode,
+            const char *cacheDir,
+            UParseError *outParseError,
+            UErrorCode &errorCode);
+
     /** @internal */
     static inline RuleBasedCollator *rbcFromUCollator(UCollator *uc) {
         return dynamic_cast<RuleBasedCollator *>(fromUCollator(uc));
@@ -787,6 +850,70 @@ class U_I18N_API RuleBasedCollator : public Collator {
         return dynamic_cast<const RuleBasedCollator *>(fromUCollator(uc));
     }
 
+    /**
+     * Implements ucol_getSortKeys().
+     * Writes the sort keys through one sink, one after the other.
+     * @internal
+     */
+    int32_t internalGetSortKeys(const char16_t *const *strings, const int32_t *lengths,
+                                int32_t count, uint8_t *dest, int32_t capacity,
+                                int32_t *offsets, UErrorCode &errorCode) const;
+
+    /**
+     * Implements ucol_getSortKeysUTF8().
+     * @internal
+     */
+    int32_t internalGetSortKeys(const char *const *strings, const int32_t *lengths,
+                                int32_t count, uint8_t *dest, int32_t capacity,
+                                int32_t *offsets, UErrorCode &errorCode) const;
+
+    /**
+     * Implements ucol_initView(): Copies this collator's settings into cs
+     * without allocating memory. cs aliases parts of this collator's settings.
+     * @internal
+     */
+    void internalInitViewSettings(CollationSettings &cs) const;
+
+    /**
+     * Implements ucol_setViewAttribute(): Same as setAttribute() but
+     * modifies cs rather than this collator's settings.
+     * @internal
+     */
+    void internalSetViewAttribute(CollationSettings &cs,
+                                  UColAttribute attr, UColAttributeValue value,
+                                  UErrorCode &errorCode) const;
+
+    /**
+     * Same as compare(const char16_t *, ...) but with the settings cs
+     * instead of this collator's. Implements ucol_viewStrcoll().
+     * @internal
+     */
+    UCollationResult internalCompare(const CollationSettings &cs,
+                                     const char16_t *left, int32_t leftLength,
+                                     const char16_t *right, int32_t rightLength,
+                                     UErrorCode &errorCode) const;
+
+    /**
+     * Same as internalCompareUTF8() but with the settings cs
+     * instead of this collator's. Implements ucol_viewStrcollUTF8().
+     * @internal
+     */
+    UCollationResult internalCompareUTF8(const CollationSettings &cs,
+                                         const char *left, int32_t leftLength,
+                                         const char *right, int32_t rightLength,
+                                         UErrorCode &errorCode) const;
+
+    /**
+     * Same as getSortKey(const char16_t *, ...) but with the settings cs
+     * instead of this collator's, and with an error code.
+     * Implements ucol_viewGetSortKey().
+     * @internal
+     */
+    int32_t internalGetSortKey(const CollationSettings &cs,
+                               const char16_t *s, int32_t length,
+                               uint8_t *dest, int32_t capacity,
+                               UErrorCode &errorCode) const;
+
     /**
      * Appends the CEs for the string to the vector.
      * @internal for tests & tools
@@ -806,6 +933,7 @@ class U_I18N_API RuleBasedCollator : public Collator {
 
 private:
     friend class CollationElementIterator;
+    friend class CollationProbe;
     friend class Collator;
 
     RuleBasedCollator(const CollationCacheEntry *entry);
@@ -823,14 +951,18 @@ class U_I18N_API RuleBasedCollator : public Collator {
     void adoptTailoring(CollationTailoring *t, UErrorCode &errorCode);
 
     // Both lengths must be <0 or else both must be >=0.
-    UCollationResult doCompare(const char16_t *left, int32_t leftLength,
+    UCollationResult doCompare(const CollationSettings &cs,
+                               const char16_t *left, int32_t leftLength,
                                const char16_t *right, int32_t rightLength,
                                UErrorCode &errorCode) const;
-    UCollationResult doCompare(const uint8_t *left, int32_t leftLength,
+    UCollationResult doCompare(const CollationSettings &cs,
+                               const uint8_t *left, int32_t leftLength,
                                const uint8_t *right, int32_t rightLength,
                                UErrorCode &errorCode) const;
 
-    void writeSortKey(const char16_t *s, int32_t length,
+    void writeSortKey(const CollationSettings &cs, const char16_t *s, int32_t length,
+                      SortKeyByteSink &sink, UErrorCode &errorCode) const;
+    void writeSortKey(const CollationSettings &cs, const uint8_t *s, int32_t length,
                       SortKeyByteSink &sink, UErrorCode &errorCode) const;
 
     void writeIdenticalLevel(const char16_t *s, const char16_t *limit,
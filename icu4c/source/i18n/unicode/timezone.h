@@ -858,6 +858,7 @@ class U_I18N_API TimeZone : public UObject {
 
 private:
     friend class ZoneMeta;
+    friend class OlsonTimeZoneData;
 
 
     static TimeZone*        createCustomTimeZone(const UnicodeString&); // Creates a time zone based on the string.
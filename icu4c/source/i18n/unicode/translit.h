@@ -28,14 +28,18 @@
 #include "unicode/parseerr.h"
 #include "unicode/utrans.h" // UTransPosition, UTransDirection
 #include "unicode/strenum.h"
+#include "unicode/stringpiece.h"
 
 U_NAMESPACE_BEGIN
 
+class ByteSink;
+class Edits;
 class UnicodeFilter;
 class UnicodeSet;
 class TransliteratorParser;
 class NormalizationTransliterator;
 class TransliteratorIDParser;
+class TransliteratorCacheKey;
 
 /**
  *
@@ -598,9 +602,19 @@ class U_I18N_API Transliterator : public UObject {
     static Transliterator* createBasicInstance(const UnicodeString& id,
                                                const UnicodeString* canon);
 
+    /**
+     * Parses the ID and instantiates the transliterator for
+     * createInstance(), without looking in the cache.
+     */
+    static Transliterator* createUncachedInstance(const UnicodeString& ID,
+                                                  UTransDirection dir,
+                                                  UParseError& parseError,
+                                                  UErrorCode& status);
+
     friend class TransliteratorParser; // for parseID()
     friend class TransliteratorIDParser; // for createBasicInstance()
     friend class TransliteratorAlias; // for setID()
+    friend class TransliteratorCacheKey; // for createUncachedInstance()
 
 public:
 
@@ -651,6 +665,49 @@ class U_I18N_API Transliterator : public UObject {
      */
     virtual void transliterate(Replaceable& text) const;
 
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Transliterates a UTF-8 string into a ByteSink and optionally records edits.
+     * The result is the same as for transliterating the text in place,
+     * except that ill-formed sequences in the source are treated as U+FFFD,
+     * and that unpaired surrogates in the result are written as U+FFFD.
+     *
+     * The source is not copied into a string whose tail moves
+     * with each replacement, so this is faster for long texts.
+     *
+     * @param src       The original string.
+     * @param sink      A ByteSink to which the result string is written.
+     *                  sink.Flush() is called at the end.
+     * @param edits     Records edits for index mapping, working with styled text,
+     *                  and getting only changes (if any).
+     *                  The Edits contents is undefined if any error occurs.
+     *                  This function calls edits->reset() first. edits can be NULL.
+     * @param errorCode Reference to an in/out error code value
+     *                  which must not indicate a failure before the function call.
+     * @draft ICU 65
+     */
+    void transliterate(StringPiece src, ByteSink &sink, Edits *edits,
+                       UErrorCode &errorCode) const;
+
+    /**
+     * Transliterates a string into a separate destination string
+     * and optionally records edits.
+     * The result is the same as for transliterating a copy of src in place.
+     *
+     * @param src       The original string.
+     * @param dest      The result string is appended to dest.
+     * @param edits     Records edits for index mapping, working with styled text,
+     *                  and getting only changes (if any).
+     *                  The Edits contents is undefined if any error occurs.
+     *                  This function calls edits->reset() first. edits can be NULL.
+     * @param errorCode Reference to an in/out error code value
+     *                  which must not indicate a failure before the function call.
+     * @draft ICU 65
+     */
+    void transliterate(const UnicodeString &src, UnicodeString &dest, Edits *edits,
+                       UErrorCode &errorCode) const;
+#endif  // U_HIDE_DRAFT_API
+
     /**
      * Transliterates the portion of the text buffer that can be
      * transliterated unambiguosly after new text has been inserted,
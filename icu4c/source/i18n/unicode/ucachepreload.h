@@ -0,0 +1,174 @@
+// © 2019 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+
+// ucachepreload.h
+
+#ifndef __UCACHEPRELOAD_H__
+#define __UCACHEPRELOAD_H__
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_FORMATTING
+
+#include "unicode/localpointer.h"
+
+#ifndef U_HIDE_DRAFT_API
+
+/**
+ * \file
+ * \brief C API: Preload ICU's object cache at startup.
+ *
+ * The first use of a service for a locale loads resource bundles, parses
+ * patterns and builds internal data. ucache_preload() does that work up
+ * front for a list of locales and kinds of services, optionally in parallel
+ * on a thread pool supplied by the caller, and pins the resulting cache
+ * entries so that they are not evicted until ucache_unpin() is called.
+ *
+ * Example with a hypothetical thread pool:
+ * \code
+ * static void U_CALLCONV submit(const void *context, UCachePreloadTask *task) {
+ *     ((ThreadPool *)context)->post([task]() { ucache_runPreloadTask(task); });
+ * }
+ *
+ * const char *locales[] = { "en_US", "de_DE", "ja_JP" };
+ * UErrorCode status = U_ZERO_ERROR;
+ * UCachePin *pin = ucache_preload(locales, 3, UCACHE_PRELOAD_ALL,
+ *                                 submit, &pool, &status);
+ * // ... serve requests ...
+ * ucache_unpin(pin);
+ * \endcode
+ */
+
+/**
+ * Kinds of services that ucache_preload() can build.
+ * The values are bit flags that can be combined.
+ * @draft ICU 65
+ */
+typedef enum UCachePreloadKind {
+    /**
+     * Collation tailorings, as used by ucol_open().
+     * @draft ICU 65
+     */
+    UCACHE_PRELOAD_COLLATOR = 1,
+    /**
+     * Decimal number formats and their symbols, as used by unum_open().
+     * @draft ICU 65
+     */
+    UCACHE_PRELOAD_NUMBER_FORMAT = 2,
+    /**
+     * Date format symbols, as used by udat_open().
+     * @draft ICU 65
+     */
+    UCACHE_PRELOAD_DATE_FORMAT = 4,
+    /**
+     * Break iterator rules and dictionaries. Break iterators are not kept in
+     * the object cache, so this only loads their data; nothing is pinned.
+     * @draft ICU 65
+     */
+    UCACHE_PRELOAD_BREAK_ITERATOR = 8,
+    /**
+     * Cardinal plural rules, as used by uplrules_open().
+     * @draft ICU 65
+     */
+    UCACHE_PRELOAD_PLURAL_RULES = 0x10,
+    /**
+     * All of the above.
+     * @draft ICU 65
+     */
+    UCACHE_PRELOAD_ALL = 0x1f
+} UCachePreloadKind;
+
+/**
+ * Opaque unit of work created by ucache_preload(), one per locale and kind.
+ * @draft ICU 65
+ */
+struct UCachePreloadTask;
+typedef struct UCachePreloadTask UCachePreloadTask;  /**< C typedef for struct UCachePreloadTask. @draft ICU 65 */
+
+/**
+ * Opaque set of cache entries pinned by ucache_preload().
+ * @draft ICU 65
+ */
+struct UCachePin;
+typedef struct UCachePin UCachePin;  /**< C typedef for struct UCachePin. @draft ICU 65 */
+
+/**
+ * Function type for handing preload tasks to a caller's thread pool.
+ * The function must arrange for ucache_runPreloadTask() to be called
+ * exactly once for the task, on any thread. It may also call it directly.
+ *
+ * @param context the executorContext passed to ucache_preload()
+ * @param task the task to run
+ * @draft ICU 65
+ */
+typedef void U_CALLCONV
+UCachePreloadExecutor(const void *context, UCachePreloadTask *task);
+
+/**
+ * Builds the requested kinds of services for each locale and pins the
+ * cache entries that hold their data. Returns after all tasks are done.
+ *
+ * The executor must not run the tasks on the calling thread after
+ * returning, since that thread blocks until all tasks complete.
+ *
+ * @param locales array of locale IDs
+ * @param localeCount number of locale IDs
+ * @param kinds bit set of UCachePreloadKind values
+ * @param executor function that schedules the tasks,
+ *                 or NULL to run them on the calling thread one by one
+ * @param executorContext passed verbatim to executor
+ * @param status ICU error code in/out parameter.
+ *               Must fulfill U_SUCCESS before the function call.
+ *               If any task fails, its error is returned and nothing is pinned.
+ * @return the pinned entries, to be released with ucache_unpin(),
+ *         or NULL on failure
+ * @draft ICU 65
+ */
+U_CAPI UCachePin * U_EXPORT2
+ucache_preload(const char *const *locales, int32_t localeCount, uint32_t kinds,
+               UCachePreloadExecutor *executor, const void *executorContext,
+               UErrorCode *status);
+
+/**
+ * Runs one preload task. Called by the executor passed to ucache_preload().
+ *
+ * @param task the task to run
+ * @draft ICU 65
+ */
+U_CAPI void U_EXPORT2
+ucache_runPreloadTask(UCachePreloadTask *task);
+
+/**
+ * Releases the cache entries pinned by ucache_preload(). They remain in the
+ * cache and become subject to the normal eviction policy.
+ *
+ * @param pin the object returned by ucache_preload(); may be NULL
+ * @draft ICU 65
+ */
+U_CAPI void U_EXPORT2
+ucache_unpin(UCachePin *pin);
+
+#if U_SHOW_CPLUSPLUS_API
+
+U_NAMESPACE_BEGIN
+
+/**
+ * \class LocalUCachePinPointer
+ * "Smart pointer" class, releases a UCachePin via ucache_unpin().
+ * For most methods see the LocalPointerBase base class.
+ *
+ * @see LocalPointerBase
+ * @see LocalPointer
+ * @draft ICU 65
+ */
+U_DEFINE_LOCAL_OPEN_POINTER(LocalUCachePinPointer, UCachePin, ucache_unpin);
+
+U_NAMESPACE_END
+
+#endif
+
+#endif  // U_HIDE_DRAFT_API
+
+#endif  // !UCONFIG_NO_FORMATTING
+
+#endif  // __UCACHEPRELOAD_H__
@@ -1580,6 +1580,92 @@ U_STABLE int32_t U_EXPORT2
 ucal_getTimeZoneIDForWindowsID(const UChar* winid, int32_t len, const char* region,
                                 UChar* id, int32_t idCapacity, UErrorCode* status);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Calendar field columns for ucal_datesToFields() and ucal_fieldsToDates(),
+ * with one array element per date. The fields are those of the proleptic
+ * Gregorian calendar, as in ISO 8601, without a Julian calendar cutover.
+ * Any column may be NULL if it is not needed.
+ *
+ * @see ucal_datesToFields
+ * @see ucal_fieldsToDates
+ * @draft ICU 65
+ */
+typedef struct UCalendarFieldArrays {
+    /** The extended year, as UCAL_EXTENDED_YEAR: 0 is 1 BC. @draft ICU 65 */
+    int32_t *year;
+    /** The month, 0-based as UCAL_MONTH. @draft ICU 65 */
+    int32_t *month;
+    /** The day of the month, starting with 1. @draft ICU 65 */
+    int32_t *dayOfMonth;
+    /** The hour of the day, 0..23. @draft ICU 65 */
+    int32_t *hourOfDay;
+    /** @draft ICU 65 */
+    int32_t *minute;
+    /** @draft ICU 65 */
+    int32_t *second;
+    /** @draft ICU 65 */
+    int32_t *millisecond;
+    /** The day of the week, as UCAL_DAY_OF_WEEK. Only written by ucal_datesToFields(). @draft ICU 65 */
+    int32_t *dayOfWeek;
+    /**
+     * The total time zone offset in milliseconds, UCAL_ZONE_OFFSET + UCAL_DST_OFFSET.
+     * Only written by ucal_datesToFields().
+     * @draft ICU 65
+     */
+    int32_t *zoneOffset;
+} UCalendarFieldArrays;
+
+/**
+ * Converts an array of UDate values to local calendar fields in the given time zone,
+ * one element of each non-NULL column of fields per date.
+ *
+ * This is equivalent to ucal_setMillis() and ucal_get() on a Gregorian UCalendar
+ * for each date, but the time zone offset is looked up only once for a run of
+ * dates between two of the zone's transitions. Input sorted by date is fastest.
+ *
+ * @param zoneID    The time zone ID. If the ID is unknown, GMT is used.
+ * @param len       The length of zoneID, or -1 if null-terminated.
+ * @param dates     The dates to convert.
+ * @param count     The number of dates.
+ * @param fields    Receives the fields; each non-NULL column must have count elements.
+ * @param status    A pointer to a UErrorCode to receive any errors.
+ *                  U_ILLEGAL_ARGUMENT_ERROR if a date is NaN or out of the UCalendar range.
+ * @see ucal_fieldsToDates
+ * @draft ICU 65
+ */
+U_DRAFT void U_EXPORT2
+ucal_datesToFields(const UChar* zoneID, int32_t len,
+                   const UDate* dates, int32_t count,
+                   const UCalendarFieldArrays* fields, UErrorCode* status);
+
+/**
+ * Converts columns of local calendar fields in the given time zone to an array of
+ * UDate values; the inverse of ucal_datesToFields().
+ *
+ * Field values outside of their normal ranges are interpreted leniently, as by a
+ * lenient UCalendar: month 12 is January of the next year, and so on. A NULL column
+ * is taken to contain the field's value at 1970-01-01T00:00, that is, year 1970,
+ * dayOfMonth 1 and 0 for the others; the dayOfWeek and zoneOffset columns are ignored.
+ * Local times that are skipped or repeated at a time zone transition are resolved as
+ * with the default UCAL_WALLTIME_LAST options.
+ *
+ * @param zoneID    The time zone ID. If the ID is unknown, GMT is used.
+ * @param len       The length of zoneID, or -1 if null-terminated.
+ * @param fields    The fields; each non-NULL column must have count elements.
+ * @param count     The number of dates.
+ * @param dates     Receives the dates.
+ * @param status    A pointer to a UErrorCode to receive any errors.
+ *                  U_ILLEGAL_ARGUMENT_ERROR if a result is out of the UCalendar range.
+ * @see ucal_datesToFields
+ * @draft ICU 65
+ */
+U_DRAFT void U_EXPORT2
+ucal_fieldsToDates(const UChar* zoneID, int32_t len,
+                   const UCalendarFieldArrays* fields, int32_t count,
+                   UDate* dates, UErrorCode* status);
+#endif  /* U_HIDE_DRAFT_API */
+
 #endif /* #if !UCONFIG_NO_FORMATTING */
 
 #endif
@@ -432,6 +432,44 @@ ucol_openRules( const UChar        *rules,
                 UParseError        *parseError,
                 UErrorCode         *status);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Same as ucol_openRules(), but keeps the built tailoring data in a file
+ * in cacheDir. If a file for the same rules, ICU version and root collation
+ * data is already there, it is memory-mapped instead of building the tailoring
+ * again, so that processes using the same rules start faster and share
+ * the tailoring data pages.
+ *
+ * The cache is keyed by a 64-bit hash of the rules.
+ * Files that do not match the running ICU are ignored and rewritten.
+ * Failure to write a file is not reported.
+ * Files are never deleted by ICU.
+ *
+ * When the tailoring is mapped from a file, the rules are not parsed,
+ * and parseError does not report anything.
+ *
+ * @param rules A string describing the collation rules.
+ * @param rulesLength The length of rules, or -1 if null-terminated.
+ * @param normalizationMode The normalization mode, as for ucol_openRules().
+ * @param strength The default collation strength, as for ucol_openRules().
+ * @param cacheDir The directory for cache files. It must exist.
+ *                 If NULL or empty, this is the same as ucol_openRules().
+ * @param parseError Receives information about errors during parsing.
+ * @param status A pointer to a UErrorCode to receive any errors
+ * @return A pointer to a UCollator, or NULL if an error occurred.
+ * @see ucol_openRules
+ * @draft ICU 65
+ */
+U_CAPI UCollator* U_EXPORT2
+ucol_openRulesCached(const UChar        *rules,
+                     int32_t            rulesLength,
+                     UColAttributeValue normalizationMode,
+                     UCollationStrength strength,
+                     const char         *cacheDir,
+                     UParseError        *parseError,
+                     UErrorCode         *status);
+#endif  /* U_HIDE_DRAFT_API */
+
 #ifndef U_HIDE_DEPRECATED_API
 /** 
  * Open a collator defined by a short form string.
@@ -1020,6 +1058,405 @@ ucol_getSortKey(const    UCollator    *coll,
         int32_t        resultLength);
 
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Get a sort key for a UTF-8 string from a UCollator.
+ * The sort key is the same as the one that ucol_getSortKey() returns for
+ * the UTF-16 version of the string. The UTF-8 text is processed directly,
+ * which avoids converting it first.
+ *
+ * Like ucol_getSortKey(), the terminating zero byte is counted in the
+ * sort key length, and the buffer contents is undefined if resultLength
+ * is too small.
+ * @param coll The UCollator containing the collation rules.
+ * @param source The UTF-8 string to transform.
+ * @param sourceLength The length of source, or -1 if null-terminated.
+ * @param result A pointer to a buffer to receive the sort key,
+ *        can be NULL if resultLength==0.
+ * @param resultLength The maximum size of result.
+ * @param status A pointer to a UErrorCode to receive any errors.
+ * @return The size needed to fully store the sort key.
+ * @see ucol_getSortKey
+ * @draft ICU 65
+ */
+U_CAPI int32_t U_EXPORT2
+ucol_getSortKeyUTF8(const UCollator *coll,
+                    const char *source,
+                    int32_t sourceLength,
+                    uint8_t *result,
+                    int32_t resultLength,
+                    UErrorCode *status);
+
+/**
+ * Get the sort keys for an array of strings, written one after the other
+ * into one buffer. This is faster than calling ucol_getSortKey() for each
+ * string, and the caller needs to manage only one buffer.
+ *
+ * Each sort key includes its terminating zero byte.
+ * The key for sources[i] starts at result+offsets[i] and ends before
+ * result+offsets[i+1]; offsets[count] is the total length.
+ * If resultCapacity is too small, then the offsets and the returned length
+ * are still set, the contents of result are undefined, and the status is set
+ * to U_BUFFER_OVERFLOW_ERROR. The caller can then allocate a buffer of
+ * the returned length and call the function again.
+ *
+ * @param coll The UCollator containing the collation rules.
+ * @param sources The strings to transform.
+ * @param sourceLengths The lengths of the strings, or -1 for a null-terminated string.
+ *        If NULL, then all strings are null-terminated.
+ * @param count The number of strings.
+ * @param result The buffer for the sort keys, can be NULL if resultCapacity==0.
+ * @param resultCapacity The size of result.
+ * @param offsets An array of count+1 elements that receives the start offset
+ *        of each sort key, followed by the total length.
+ * @param status A pointer to a UErrorCode to receive any errors.
+ * @return The total length of all sort keys.
+ * @see ucol_getSortKey
+ * @draft ICU 65
+ */
+U_CAPI int32_t U_EXPORT2
+ucol_getSortKeys(const UCollator *coll,
+                 const UChar *const *sources,
+                 const int32_t *sourceLengths,
+                 int32_t count,
+                 uint8_t *result,
+                 int32_t resultCapacity,
+                 int32_t *offsets,
+                 UErrorCode *status);
+
+/**
+ * Get the sort keys for an array of UTF-8 strings, written one after the other
+ * into one buffer. Same as ucol_getSortKeys() but with UTF-8 input.
+ *
+ * @param coll The UCollator containing the collation rules.
+ * @param sources The UTF-8 strings to transform.
+ * @param sourceLengths The lengths of the strings, or -1 for a null-terminated string.
+ *        If NULL, then all strings are null-terminated.
+ * @param count The number of strings.
+ * @param result The buffer for the sort keys, can be NULL if resultCapacity==0.
+ * @param resultCapacity The size of result.
+ * @param offsets An array of count+1 elements that receives the start offset
+ *        of each sort key, followed by the total length.
+ * @param status A pointer to a UErrorCode to receive any errors.
+ * @return The total length of all sort keys.
+ * @see ucol_getSortKeys
+ * @see ucol_getSortKeyUTF8
+ * @draft ICU 65
+ */
+U_CAPI int32_t U_EXPORT2
+ucol_getSortKeysUTF8(const UCollator *coll,
+                     const char *const *sources,
+                     const int32_t *sourceLengths,
+                     int32_t count,
+                     uint8_t *result,
+                     int32_t resultCapacity,
+                     int32_t *offsets,
+                     UErrorCode *status);
+
+/**
+ * Opaque unit of work created by ucol_sortStrings() and ucol_sortStringsUTF8().
+ * @see UCollationSortExecutor
+ * @draft ICU 65
+ */
+struct UCollationSortTask;
+typedef struct UCollationSortTask UCollationSortTask;  /**< C typedef for struct UCollationSortTask. @draft ICU 65 */
+
+/**
+ * Function type for handing sort tasks to a caller's thread pool.
+ * The function must arrange for ucol_runSortTask() to be called
+ * exactly once for the task, on any thread. It may also call it directly.
+ *
+ * @param context the executorContext passed to ucol_sortStrings()
+ * @param task the task to run
+ * @draft ICU 65
+ */
+typedef void U_CALLCONV
+UCollationSortExecutor(const void *context, UCollationSortTask *task);
+
+/**
+ * Runs one sort task. Called by the executor passed to ucol_sortStrings()
+ * or ucol_sortStringsUTF8().
+ *
+ * @param task the task to run
+ * @draft ICU 65
+ */
+U_CAPI void U_EXPORT2
+ucol_runSortTask(UCollationSortTask *task);
+
+/**
+ * Sorts an array of strings into the order defined by the collator.
+ * Equal strings keep their relative input order.
+ *
+ * This is faster than uprv_sortArray() or qsort() with ucol_strcoll()
+ * as the comparator: It computes a short sort key prefix for each string
+ * once, and compares the strings themselves only when their prefixes are equal.
+ *
+ * With an executor, large arrays are split into runs that are sorted in
+ * parallel on the caller's thread pool and then merged in parallel rounds.
+ * ICU does not create threads itself. The result is the same as without
+ * an executor. The function returns after all tasks are done; the executor
+ * must not defer tasks to the calling thread, which blocks until then.
+ *
+ * @param coll The UCollator containing the collation rules.
+ *        It is used concurrently by the sort tasks.
+ * @param strings The strings to sort. The array is reordered in place.
+ * @param lengths The lengths of the strings, or -1 for a null-terminated string.
+ *        If not NULL, then this array is reordered along with the strings.
+ *        If NULL, then all strings are null-terminated.
+ * @param count The number of strings.
+ * @param executor function that schedules the sort tasks,
+ *        or NULL to sort on the calling thread
+ * @param executorContext passed verbatim to executor
+ * @param status A pointer to a UErrorCode to receive any errors.
+ * @draft ICU 65
+ */
+U_CAPI void U_EXPORT2
+ucol_sortStrings(const UCollator *coll,
+                 const UChar **strings,
+                 int32_t *lengths,
+                 int32_t count,
+                 UCollationSortExecutor *executor,
+                 const void *executorContext,
+                 UErrorCode *status);
+
+/**
+ * Sorts an array of UTF-8 strings into the order defined by the collator.
+ * Same as ucol_sortStrings() but with UTF-8 input.
+ *
+ * @param coll The UCollator containing the collation rules.
+ * @param strings The UTF-8 strings to sort. The array is reordered in place.
+ * @param lengths The lengths of the strings, or -1 for a null-terminated string.
+ *        If not NULL, then this array is reordered along with the strings.
+ *        If NULL, then all strings are null-terminated.
+ * @param count The number of strings.
+ * @param executor function that schedules the sort tasks,
+ *        or NULL to sort on the calling thread
+ * @param executorContext passed verbatim to executor
+ * @param status A pointer to a UErrorCode to receive any errors.
+ * @see ucol_sortStrings
+ * @draft ICU 65
+ */
+U_CAPI void U_EXPORT2
+ucol_sortStringsUTF8(const UCollator *coll,
+                     const char **strings,
+                     int32_t *lengths,
+                     int32_t count,
+                     UCollationSortExecutor *executor,
+                     const void *executorContext,
+                     UErrorCode *status);
+
+/**
+ * Opaque collation probe: one string prepared for many comparisons.
+ * @see ucol_openProbe
+ * @draft ICU 65
+ */
+struct UCollationProbe;
+/** @draft ICU 65 */
+typedef struct UCollationProbe UCollationProbe;
+
+/**
+ * Prepares a string for comparing it against many others with the same collator,
+ * for example as the search key of a binary search or a B-tree lookup.
+ * The collation elements of the string are computed once,
+ * rather than for every comparison as with ucol_strcoll().
+ *
+ * The collator must not be modified or closed while the probe is open.
+ * A probe must not be used by multiple threads at the same time.
+ *
+ * @param coll The UCollator containing the collation rules.
+ *        Must be a rule-based collator, such as those from ucol_open().
+ * @param source The string to prepare; it is copied.
+ * @param sourceLength The length of source, or -1 if null-terminated.
+ * @param status A pointer to a UErrorCode to receive any errors.
+ *        Set to U_UNSUPPORTED_ERROR if coll is not rule-based.
+ * @return the probe, to be closed with ucol_closeProbe(), or NULL on failure
+ * @draft ICU 65
+ */
+U_CAPI UCollationProbe * U_EXPORT2
+ucol_openProbe(const UCollator *coll,
+               const UChar *source,
+               int32_t sourceLength,
+               UErrorCode *status);
+
+/**
+ * Closes a probe opened with ucol_openProbe().
+ * @param probe the probe; may be NULL
+ * @draft ICU 65
+ */
+U_CAPI void U_EXPORT2
+ucol_closeProbe(UCollationProbe *probe);
+
+/**
+ * Compares the probe string with a target string.
+ * Returns the same result as ucol_strcoll(coll, probeString, -1, target, targetLength).
+ *
+ * @param probe The prepared probe.
+ * @param target The string to compare with.
+ * @param targetLength The length of target, or -1 if null-terminated.
+ * @param status A pointer to a UErrorCode to receive any errors.
+ * @return UCOL_LESS if the probe is less than the target, etc.
+ * @draft ICU 65
+ */
+U_CAPI UCollationResult U_EXPORT2
+ucol_compareProbe(UCollationProbe *probe,
+                  const UChar *target,
+                  int32_t targetLength,
+                  UErrorCode *status);
+
+/**
+ * Compares the probe string with a UTF-8 target string.
+ * Returns the same result as ucol_strcollUTF8() with the probe string
+ * converted to UTF-8.
+ *
+ * @param probe The prepared probe.
+ * @param target The UTF-8 string to compare with.
+ * @param targetLength The length of target, or -1 if null-terminated.
+ * @param status A pointer to a UErrorCode to receive any errors.
+ * @return UCOL_LESS if the probe is less than the target, etc.
+ * @draft ICU 65
+ */
+U_CAPI UCollationResult U_EXPORT2
+ucol_compareProbeUTF8(UCollationProbe *probe,
+                      const char *target,
+                      int32_t targetLength,
+                      UErrorCode *status);
+
+#if U_SHOW_CPLUSPLUS_API
+
+U_NAMESPACE_BEGIN
+
+/**
+ * \class LocalUCollationProbePointer
+ * "Smart pointer" class, closes a UCollationProbe via ucol_closeProbe().
+ * For most methods see the LocalPointerBase base class.
+ *
+ * @see LocalPointerBase
+ * @see LocalPointer
+ * @draft ICU 65
+ */
+U_DEFINE_LOCAL_OPEN_POINTER(LocalUCollationProbePointer, UCollationProbe, ucol_closeProbe);
+
+U_NAMESPACE_END
+
+#endif
+#endif  /* U_HIDE_DRAFT_API */
+
+#ifndef U_HIDE_DRAFT_API
+/**
+ * A collator view: a collator's data with its own copy of the attributes.
+ *
+ * A view is a plain struct that the caller allocates, typically on the stack.
+ * Initializing one with ucol_initView() and changing its attributes does not
+ * allocate memory and does not touch the collator's reference counts,
+ * so it is much cheaper than ucol_safeClone() plus ucol_setAttribute()
+ * when each request or thread needs different settings, such as a different strength.
+ * A view need not be closed.
+ *
+ * The view uses the collator's data without owning it:
+ * The collator must not be modified or closed while the view is in use.
+ * A view can be used by multiple threads at the same time
+ * once its attributes are set.
+ *
+ * The contents of the struct are private.
+ * @see ucol_initView
+ * @draft ICU 65
+ */
+typedef struct UCollatorView {
+    /** @internal */
+    int64_t reserved[128];
+} UCollatorView;
+
+/**
+ * Initializes a view of the collator, with the collator's current attributes.
+ *
+ * @param view The view to initialize.
+ * @param coll The UCollator containing the collation rules.
+ *        Must be a rule-based collator, such as those from ucol_open().
+ * @param status A pointer to a UErrorCode to receive any errors.
+ *        Set to U_UNSUPPORTED_ERROR if coll is not rule-based.
+ * @draft ICU 65
+ */
+U_CAPI void U_EXPORT2
+ucol_initView(UCollatorView *view, const UCollator *coll, UErrorCode *status);
+
+/**
+ * Sets an attribute of the view, as ucol_setAttribute() does for a collator.
+ * The collator itself is not changed.
+ * Must not be called while another thread uses the view.
+ *
+ * @param view The view, initialized with ucol_initView().
+ * @param attr attribute type
+ * @param value attribute value
+ * @param status A pointer to a UErrorCode to receive any errors.
+ * @see ucol_setAttribute
+ * @draft ICU 65
+ */
+U_CAPI void U_EXPORT2
+ucol_setViewAttribute(UCollatorView *view, UColAttribute attr, UColAttributeValue value,
+                      UErrorCode *status);
+
+/**
+ * Compares two strings with the view's attributes, as ucol_strcoll() does.
+ *
+ * @param view The view, initialized with ucol_initView().
+ * @param source The source string.
+ * @param sourceLength The length of source, or -1 if null-terminated.
+ * @param target The target string.
+ * @param targetLength The length of target, or -1 if null-terminated.
+ * @param status A pointer to a UErrorCode to receive any errors.
+ * @return The result of comparing the strings; one of UCOL_EQUAL,
+ *         UCOL_GREATER, UCOL_LESS
+ * @see ucol_strcoll
+ * @draft ICU 65
+ */
+U_CAPI UCollationResult U_EXPORT2
+ucol_viewStrcoll(const UCollatorView *view,
+                 const UChar *source, int32_t sourceLength,
+                 const UChar *target, int32_t targetLength,
+                 UErrorCode *status);
+
+/**
+ * Compares two UTF-8 strings with the view's attributes, as ucol_strcollUTF8() does.
+ *
+ * @param view The view, initialized with ucol_initView().
+ * @param source The source UTF-8 string.
+ * @param sourceLength The length of source, or -1 if null-terminated.
+ * @param target The target UTF-8 string.
+ * @param targetLength The length of target, or -1 if null-terminated.
+ * @param status A pointer to a UErrorCode to receive any errors.
+ * @return The result of comparing the strings; one of UCOL_EQUAL,
+ *         UCOL_GREATER, UCOL_LESS
+ * @see ucol_strcollUTF8
+ * @draft ICU 65
+ */
+U_CAPI UCollationResult U_EXPORT2
+ucol_viewStrcollUTF8(const UCollatorView *view,
+                     const char *source, int32_t sourceLength,
+                     const char *target, int32_t targetLength,
+                     UErrorCode *status);
+
+/**
+ * Gets the sort key of a string with the view's attributes, as ucol_getSortKey() does.
+ *
+ * @param view The view, initialized with ucol_initView().
+ * @param source The string to transform.
+ * @param sourceLength The length of source, or -1 if null-terminated.
+ * @param result A pointer to a buffer to receive the sort key.
+ * @param resultLength The maximum size of result.
+ * @param status A pointer to a UErrorCode to receive any errors.
+ * @return The size needed to fully store the sort key.
+ *      If there was an internal error generating the sort key,
+ *      a zero value is returned.
+ * @see ucol_getSortKey
+ * @draft ICU 65
+ */
+U_CAPI int32_t U_EXPORT2
+ucol_viewGetSortKey(const UCollatorView *view,
+                    const UChar *source, int32_t sourceLength,
+                    uint8_t *result, int32_t resultLength,
+                    UErrorCode *status);
+#endif  /* U_HIDE_DRAFT_API */
+
 /** Gets the next count bytes of a sort key. Caller needs
  *  to preserve state array between calls and to provide
  *  the same type of UCharIterator set with the same string.
@@ -1475,6 +1912,11 @@ ucol_cloneBinary(const UCollator *coll,
  *  collator remains owned by the user and should stay around for 
  *  the lifetime of the collator. The API also takes a base collator
  *  which must be the root collator.
+ *
+ *  The binary image is used in place, not copied, and it is not modified.
+ *  It may therefore be in read-only memory that is shared among processes,
+ *  such as a memory-mapped file or a shared memory segment filled by another
+ *  process with the same ICU version, so that the tailoring data is stored only once.
  *  @param bin binary image owned by the user and required through the
  *             lifetime of the collator
  *  @param length size of the image. If negative, the API will try to
@@ -116,6 +116,10 @@ U_NAMESPACE_END
   * The input string must not be altered or deleted until the charset
   * detector is either closed or reset to refer to different input text.
   *
+  * A charset detector can be reused for any number of input texts.
+  * Setting new input text and detecting its charset does not allocate
+  * memory, and unless the input filter is enabled, the text is not copied.
+  *
   * @param ucsd   the charset detector to be used.
   * @param textIn the input text of unknown encoding.   .
   * @param len    the length of the input text, or -1 if the text
@@ -431,7 +431,9 @@ typedef struct UFormattedNumber UFormattedNumber;
  * Creates a new UNumberFormatter for the given skeleton string and locale. This is currently the only
  * method for creating a new UNumberFormatter.
  *
- * Objects of type UNumberFormatter returned by this method are threadsafe.
+ * Objects of type UNumberFormatter returned by this method are threadsafe. Their internal formatting
+ * data structures are built when the formatter is opened, so that the first format call is as fast as
+ * subsequent ones.
  *
  * For more details on skeleton strings, see the documentation in numberformatter.h. For more details on
  * the usage of this API, see the documentation at the top of unumberformatter.h.
@@ -157,6 +157,21 @@ struct UStringSearch;
 */
 typedef struct UStringSearch UStringSearch;
 
+#ifndef U_HIDE_DRAFT_API
+/**
+* Processed collation elements of a text, for repeated searching.
+* @see usearch_openTextIndex
+* @draft ICU 65
+*/
+struct USearchTextIndex;
+/**
+* Processed collation elements of a text, for repeated searching.
+* @see usearch_openTextIndex
+* @draft ICU 65
+*/
+typedef struct USearchTextIndex USearchTextIndex;
+#endif  /* U_HIDE_DRAFT_API */
+
 /**
 * @stable ICU 2.4
 */
@@ -347,6 +362,39 @@ U_STABLE UStringSearch * U_EXPORT2 usearch_openFromCollator(
 */
 U_STABLE void U_EXPORT2 usearch_close(UStringSearch *searchiter);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+* Computes the processed collation elements of a text once, so that
+* string searches for any number of patterns can share them.
+* Forward searches (usearch_first(), usearch_next(), usearch_following())
+* over an index read its collation elements instead of iterating over
+* the text again; backward searches still iterate over the text.
+* <p>
+* The index aliases the text and the collator, which must be kept unchanged
+* until the index is closed.
+* @param text text to be indexed
+* @param textlength length of the text, -1 for null-termination
+* @param collator collator that the searches will use
+* @param status for errors if it occurs. If text or collator is NULL,
+*               or textlength is 0, then an U_ILLEGAL_ARGUMENT_ERROR is returned.
+* @return the index, to be closed with usearch_closeTextIndex()
+* @see usearch_setTextIndex
+* @draft ICU 65
+*/
+U_CAPI USearchTextIndex * U_EXPORT2 usearch_openTextIndex(const UChar     *text,
+                                                          int32_t          textlength,
+                                                          const UCollator *collator,
+                                                          UErrorCode      *status);
+
+/**
+* Closes a text index and releases its memory.
+* No string search may be using the index any more.
+* @param index the index, can be NULL
+* @draft ICU 65
+*/
+U_CAPI void U_EXPORT2 usearch_closeTextIndex(USearchTextIndex *index);
+#endif  /* U_HIDE_DRAFT_API */
+
 #if U_SHOW_CPLUSPLUS_API
 
 U_NAMESPACE_BEGIN
@@ -362,6 +410,19 @@ U_NAMESPACE_BEGIN
  */
 U_DEFINE_LOCAL_OPEN_POINTER(LocalUStringSearchPointer, UStringSearch, usearch_close);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * \class LocalUSearchTextIndexPointer
+ * "Smart pointer" class, closes a USearchTextIndex via usearch_closeTextIndex().
+ * For most methods see the LocalPointerBase base class.
+ *
+ * @see LocalPointerBase
+ * @see LocalPointer
+ * @draft ICU 65
+ */
+U_DEFINE_LOCAL_OPEN_POINTER(LocalUSearchTextIndexPointer, USearchTextIndex, usearch_closeTextIndex);
+#endif  /* U_HIDE_DRAFT_API */
+
 U_NAMESPACE_END
 
 #endif
@@ -563,6 +624,26 @@ U_STABLE void U_EXPORT2 usearch_setText(      UStringSearch *strsrch,
 U_STABLE const UChar * U_EXPORT2 usearch_getText(const UStringSearch *strsrch, 
                                                int32_t       *length);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+* Sets the text to be searched to the text of an index, and makes the
+* forward search read the index's collation elements.
+* Iteration begins at the start of the text, as with usearch_setText().
+* The index stays in use until the text or the collator is set again.
+* @param strsrch search iterator data struct
+* @param index text index built with the same collator as this search uses,
+*              see usearch_getCollator()
+* @param status for errors if it occurs. If index is NULL or was built with
+*               a different collator, then an U_ILLEGAL_ARGUMENT_ERROR is
+*               returned with no change done to strsrch.
+* @see usearch_openTextIndex
+* @draft ICU 65
+*/
+U_CAPI void U_EXPORT2 usearch_setTextIndex(UStringSearch          *strsrch,
+                                           const USearchTextIndex *index,
+                                           UErrorCode             *status);
+#endif  /* U_HIDE_DRAFT_API */
+
 /**
 * Gets the collator used for the language rules. 
 * <p>
@@ -1272,6 +1272,58 @@ uspoof_getSkeletonUTF8(const USpoofChecker *sc,
                        char *dest, int32_t destCapacity,
                        UErrorCode *status);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Check whether an identifier is confusable with any of a set of existing
+ * identifiers, given their precomputed skeletons.
+ * The skeleton of the identifier is computed and looked up in the set.
+ *
+ * This is faster than calling uspoof_areConfusable() for each existing
+ * identifier, and it does not report the type of confusability.
+ *
+ * @param sc        The USpoofChecker
+ * @param skeletons The skeletons of the existing identifiers,
+ *                  from uspoof_getSkeleton(), as the strings of a USet.
+ *                  Freezing the set makes lookups faster.
+ * @param id        The identifier to be checked.
+ * @param length    The length of id, in 16 bit UTF-16 code units,
+ *                  or -1 if the string is zero terminated.
+ * @param status    The error code, set if an error occurred while attempting to
+ *                  perform the check.
+ * @return          TRUE if the skeleton of id is in the set.
+ *
+ * @draft ICU 65
+ * @see uspoof_getSkeleton
+ */
+U_CAPI UBool U_EXPORT2
+uspoof_isConfusableWithAny(const USpoofChecker *sc,
+                           const USet *skeletons,
+                           const UChar *id, int32_t length,
+                           UErrorCode *status);
+
+/**
+ * A version of {@link uspoof_isConfusableWithAny} accepting a UTF-8 identifier.
+ * The skeletons in the set are UTF-16 strings as always.
+ * Short identifiers whose skeletons are ASCII do not need memory allocation.
+ *
+ * @param sc        The USpoofChecker
+ * @param skeletons The skeletons of the existing identifiers, as the strings of a USet.
+ * @param id        The UTF-8 identifier to be checked.
+ * @param length    The length of id, in bytes, or -1 if the string is zero terminated.
+ * @param status    The error code, set if an error occurred while attempting to
+ *                  perform the check.
+ * @return          TRUE if the skeleton of id is in the set.
+ *
+ * @draft ICU 65
+ * @see uspoof_isConfusableWithAny
+ */
+U_CAPI UBool U_EXPORT2
+uspoof_isConfusableWithAnyUTF8(const USpoofChecker *sc,
+                               const USet *skeletons,
+                               const char *id, int32_t length,
+                               UErrorCode *status);
+#endif  /* U_HIDE_DRAFT_API */
+
 /**
   * Get the set of Candidate Characters for Inclusion in Identifiers, as defined
   * in http://unicode.org/Public/security/latest/xidmodifications.txt
@@ -1539,6 +1591,29 @@ uspoof_getSkeletonUnicodeString(const USpoofChecker *sc,
                                 icu::UnicodeString &dest,
                                 UErrorCode *status);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * A version of {@link uspoof_isConfusableWithAny} accepting UnicodeStrings.
+ *
+ * @param sc        The USpoofChecker
+ * @param skeletons The skeletons of the existing identifiers,
+ *                  from uspoof_getSkeletonUnicodeString(), as the strings of a UnicodeSet.
+ *                  Freezing the set makes lookups faster.
+ * @param id        The identifier to be checked.
+ * @param status    The error code, set if an error occurred while attempting to
+ *                  perform the check.
+ * @return          TRUE if the skeleton of id is in the set.
+ *
+ * @draft ICU 65
+ * @see uspoof_isConfusableWithAny
+ */
+U_I18N_API UBool U_EXPORT2
+uspoof_isConfusableWithAnyUnicodeString(const USpoofChecker *sc,
+                                        const icu::UnicodeSet &skeletons,
+                                        const icu::UnicodeString &id,
+                                        UErrorCode *status);
+#endif  /* U_HIDE_DRAFT_API */
+
 /**
   * Get the set of Candidate Characters for Inclusion in Identifiers, as defined
   * in http://unicode.org/Public/security/latest/xidmodifications.txt
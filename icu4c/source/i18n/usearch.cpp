@@ -26,7 +26,8 @@
 
 U_NAMESPACE_USE
 
-// don't use Boyer-Moore
+// don't use Boyer-Moore on 32-bit CEs;
+// usearch_search() does its own Horspool-style skipping on processed CEs, see setPCEShiftTable()
 // (and if we decide to turn this on again there are several new TODOs that will need to be addressed)
 #define BOYER_MOORE 0
 
@@ -95,6 +96,17 @@ inline int hashFromCE32(uint32_t ce)
     return hc;
 }
 
+/**
+* Getting the hash value of a processed (64-bit) collation element.
+* @param pce processed collation element
+* @return hash code in [0, MAX_TABLE_SIZE_[
+*/
+static
+inline int hashFromPCE(int64_t pce)
+{
+    return hashFromCE32((uint32_t)((uint64_t)pce >> 32) ^ (uint32_t)pce);
+}
+
 U_CDECL_BEGIN
 static UBool U_CALLCONV
 usearch_cleanup(void) {
@@ -348,6 +360,32 @@ inline uint16_t initializePatternCETable(UStringSearch *strsrch,
     return result;
 }
 
+/**
+* Sets the skip distances for the forward search in processed CE space.
+* A search window of pcesLength target CEs whose last CE is not the last
+* pattern CE can be moved ahead until that target CE lines up with its
+* last occurrence in the rest of the pattern (Horspool). CEs that hash to
+* the same slot share the smallest distance, which is always safe.
+* @param pattern with pces and pcesLength set
+*/
+static
+inline void setPCEShiftTable(UPattern *pattern)
+{
+    int32_t length = pattern->pcesLength;
+    int16_t maxShift = length < INT16_MAX ? (int16_t)length : INT16_MAX;
+    int32_t count;
+    for (count = 0; count < MAX_TABLE_SIZE_; count ++) {
+        pattern->pceShift[count] = maxShift;
+    }
+    for (count = 0; count < length - 1; count ++) {
+        int32_t temp = length - 1 - count;
+        int16_t &shift = pattern->pceShift[hashFromPCE(pattern->pces[count])];
+        if (temp < shift) {
+            shift = (int16_t)temp;
+        }
+    }
+}
+
 /**
 * Initializing the pce table for a pattern.
 * Stores non-ignorable collation keys.
@@ -421,6 +459,7 @@ inline uint16_t initializePatternPCETable(UStringSearch *strsrch,
     pcetable[offset]   = 0;
     pattern->pces       = pcetable;
     pattern->pcesLength = offset;
+    setPCEShiftTable(pattern);
 
     return result;
 }
@@ -2728,6 +2767,7 @@ U_CAPI UStringSearch * U_EXPORT2 usearch_openFromCollator(
         result->textIter              = ucol_openElements(collator, text,
                                                           textlength, status);
         result->textProcessedIter     = NULL;
+        result->textIndex             = NULL;
         if (U_FAILURE(*status)) {
             usearch_close(result);
             return NULL;
@@ -2801,6 +2841,28 @@ UBool initTextProcessedIter(UStringSearch *strsrch, UErrorCode *status) {
 
 }
 
+//
+//  CEI  Collation Element + source text index.
+//       These structs are kept in the circular buffer, and in a USearchTextIndex.
+//
+struct  CEI {
+    int64_t ce;
+    int32_t lowIndex;
+    int32_t highIndex;
+};
+
+//
+//  USearchTextIndex  The CEIs of a whole text, see usearch_openTextIndex().
+//       ceis[length] is the UCOL_PROCESSED_NULLORDER at the end of the text.
+//
+struct USearchTextIndex {
+    const UChar     *text;
+    int32_t          textLength;
+    const UCollator *collator;
+    CEI             *ceis;
+    int32_t          length;
+};
+
 // set and get methods --------------------------------------------------
 
 U_CAPI void U_EXPORT2 usearch_setOffset(UStringSearch *strsrch,
@@ -2985,6 +3047,7 @@ U_CAPI void U_EXPORT2 usearch_setText(      UStringSearch *strsrch,
             }
             strsrch->search->text       = text;
             strsrch->search->textLength = textlength;
+            strsrch->textIndex          = NULL;
             ucol_setText(strsrch->textIter, text, textlength, status);
             strsrch->search->matchedIndex  = USEARCH_DONE;
             strsrch->search->matchedLength = 0;
@@ -3000,6 +3063,93 @@ U_CAPI void U_EXPORT2 usearch_setText(      UStringSearch *strsrch,
     }
 }
 
+U_CAPI USearchTextIndex * U_EXPORT2 usearch_openTextIndex(const UChar     *text,
+                                                          int32_t          textlength,
+                                                          const UCollator *collator,
+                                                          UErrorCode      *status)
+{
+    if (U_FAILURE(*status)) {
+        return NULL;
+    }
+    if (text == NULL || textlength < -1 || textlength == 0 || collator == NULL) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return NULL;
+    }
+    if (textlength == -1) {
+        textlength = u_strlen(text);
+    }
+    USearchTextIndex *index = (USearchTextIndex *)uprv_malloc(sizeof(USearchTextIndex));
+    UCollationElements *coleiter = ucol_openElements(collator, text, textlength, status);
+    int32_t capacity = textlength + 1;
+    CEI *ceis = (CEI *)uprv_malloc(capacity * sizeof(CEI));
+    if (U_SUCCESS(*status) && (index == NULL || ceis == NULL)) {
+        *status = U_MEMORY_ALLOCATION_ERROR;
+    }
+    if (U_FAILURE(*status)) {
+        uprv_free(ceis);
+        uprv_free(index);
+        ucol_closeElements(coleiter);
+        return NULL;
+    }
+
+    icu::UCollationPCE iter(coleiter);
+    int32_t length = 0;
+    for (;;) {
+        if (length == capacity) {
+            capacity *= 2;
+            CEI *temp = (CEI *)uprv_realloc(ceis, capacity * sizeof(CEI));
+            if (temp == NULL) {
+                *status = U_MEMORY_ALLOCATION_ERROR;
+                break;
+            }
+            ceis = temp;
+        }
+        CEI &cei = ceis[length];
+        cei.ce = iter.nextProcessed(&cei.lowIndex, &cei.highIndex, status);
+        if (cei.ce == UCOL_PROCESSED_NULLORDER || U_FAILURE(*status)) {
+            break;
+        }
+        ++length;
+    }
+    ucol_closeElements(coleiter);
+    if (U_FAILURE(*status)) {
+        uprv_free(ceis);
+        uprv_free(index);
+        return NULL;
+    }
+
+    index->text       = text;
+    index->textLength = textlength;
+    index->collator   = collator;
+    index->ceis       = ceis;
+    index->length     = length;
+    return index;
+}
+
+U_CAPI void U_EXPORT2 usearch_closeTextIndex(USearchTextIndex *index)
+{
+    if (index != NULL) {
+        uprv_free(index->ceis);
+        uprv_free(index);
+    }
+}
+
+U_CAPI void U_EXPORT2 usearch_setTextIndex(UStringSearch          *strsrch,
+                                           const USearchTextIndex *index,
+                                           UErrorCode             *status)
+{
+    if (U_SUCCESS(*status)) {
+        if (strsrch == NULL || index == NULL || index->collator != strsrch->collator) {
+            *status = U_ILLEGAL_ARGUMENT_ERROR;
+            return;
+        }
+        usearch_setText(strsrch, index->text, index->textLength, status);
+        if (U_SUCCESS(*status)) {
+            strsrch->textIndex = index;
+        }
+    }
+}
+
 U_CAPI const UChar * U_EXPORT2 usearch_getText(const UStringSearch *strsrch,
                                                      int32_t       *length)
 {
@@ -3023,6 +3173,7 @@ U_CAPI void U_EXPORT2 usearch_setCollator(      UStringSearch *strsrch,
         if (strsrch) {
             delete strsrch->textProcessedIter;
             strsrch->textProcessedIter = NULL;
+            strsrch->textIndex = NULL;
             ucol_closeElements(strsrch->textIter);
             ucol_closeElements(strsrch->utilIter);
             strsrch->textIter = strsrch->utilIter = NULL;
@@ -3441,16 +3592,6 @@ U_CAPI void U_EXPORT2 usearch_reset(UStringSearch *strsrch)
     }
 }
 
-//
-//  CEI  Collation Element + source text index.
-//       These structs are kept in the circular buffer.
-//
-struct  CEI {
-    int64_t ce;
-    int32_t lowIndex;
-    int32_t highIndex;
-};
-
 U_NAMESPACE_BEGIN
 
 namespace {
@@ -3472,17 +3613,19 @@ struct CEIBuffer {
     int32_t              limitIx;
     UCollationElements  *ceIter;
     UStringSearch       *strSearch;
+    const CEI           *indexCEIs;    // forward: from strSearch->textIndex, starting at the search start, or NULL
+    int32_t              indexLength;
 
 
 
-               CEIBuffer(UStringSearch *ss, UErrorCode *status);
+               CEIBuffer(UStringSearch *ss, UBool forward, UErrorCode *status);
                ~CEIBuffer();
    const CEI   *get(int32_t index);
    const CEI   *getPrevious(int32_t index);
 };
 
 
-CEIBuffer::CEIBuffer(UStringSearch *ss, UErrorCode *status) {
+CEIBuffer::CEIBuffer(UStringSearch *ss, UBool forward, UErrorCode *status) {
     buf = defBuf;
     strSearch = ss;
     bufSize = ss->pattern.pcesLength + CEBUFFER_EXTRA;
@@ -3504,6 +3647,31 @@ CEIBuffer::CEIBuffer(UStringSearch *ss, UErrorCode *status) {
     ceIter    = ss->textIter;
     firstIx = 0;
     limitIx = 0;
+    indexCEIs = NULL;
+    indexLength = 0;
+
+    if (forward && ss->textIndex != NULL) {
+        // Start with the first CE of the character at the iterator's offset.
+        // Skip the trailing CEs of an expansion of the preceding character,
+        // which have lowIndex==highIndex==offset.
+        const USearchTextIndex *index = ss->textIndex;
+        int32_t offset = ucol_getOffset(ceIter);
+        int32_t start = 0, limit = index->length;
+        while (start < limit) {
+            int32_t mid = (start + limit) / 2;
+            if (index->ceis[mid].lowIndex < offset) {
+                start = mid + 1;
+            } else {
+                limit = mid;
+            }
+        }
+        while (start < index->length && index->ceis[start].lowIndex == index->ceis[start].highIndex) {
+            ++start;
+        }
+        indexCEIs = index->ceis + start;
+        indexLength = index->length - start;
+        return;
+    }
 
     if (!initTextProcessedIter(ss, status)) { return; }
 
@@ -3532,6 +3700,14 @@ CEIBuffer::~CEIBuffer() {
 //   The CE value will be UCOL__PROCESSED_NULLORDER at end of input.
 //
 const CEI *CEIBuffer::get(int32_t index) {
+    if (indexCEIs != NULL) {
+        // All CEs are in the text index; only keep limitIx up to date.
+        if (index >= limitIx) {
+            limitIx = index + 1;
+        }
+        return &indexCEIs[index < indexLength ? index : indexLength];
+    }
+
     int i = index % bufSize;
 
     if (index>=firstIx && index<limitIx) {
@@ -3867,7 +4043,7 @@ U_CAPI UBool U_EXPORT2 usearch_search(UStringSearch  *strsrch,
     }
 
     ucol_setOffset(strsrch->textIter, startIdx, status);
-    CEIBuffer ceb(strsrch, status);
+    CEIBuffer ceb(strsrch, TRUE, status);
 
 
     int32_t    targetIx = 0;
@@ -3880,7 +4056,15 @@ U_CAPI UBool U_EXPORT2 usearch_search(UStringSearch  *strsrch,
     int32_t  minLimit;
     int32_t  maxLimit;
 
-
+    // With exact CE comparison, a match needs the target CEs to equal the pattern CEs
+    // one by one, so we can skip match starting positions like Horspool's string search:
+    // Look at the target CE under the end of the pattern first, and if it is not the
+    // last pattern CE, move ahead by the distance from setPCEShiftTable().
+    // The target CEs must still be fetched in order; this saves the comparisons
+    // and the per-position overhead, not the collation element iteration.
+    int32_t  patLength = strsrch->pattern.pcesLength;
+    UBool    canSkip   = strsrch->search->elementComparisonType == 0 && patLength > 1;
+    int64_t  patLastCE = canSkip ? strsrch->pattern.pces[patLength - 1] : 0;
 
     // Outer loop moves over match starting positions in the
     //      target CE space.
@@ -3898,6 +4082,21 @@ U_CAPI UBool U_EXPORT2 usearch_search(UStringSearch  *strsrch,
     //
     for(targetIx=0; ; targetIx++)
     {
+        if (canSkip) {
+            for (;;) {
+                int32_t lastIx = targetIx + patLength - 1;
+                while (ceb.limitIx < lastIx) {
+                    ceb.get(ceb.limitIx);
+                }
+                int64_t targetCE = ceb.get(lastIx)->ce;
+                if (targetCE == patLastCE || targetCE == UCOL_PROCESSED_NULLORDER) {
+                    // Check this position; at the end of the input the check fails.
+                    break;
+                }
+                targetIx += strsrch->pattern.pceShift[hashFromPCE(targetCE)];
+            }
+        }
+
         found = TRUE;
         //  Inner loop checks for a match beginning at each
         //  position from the outer loop.
@@ -4166,7 +4365,7 @@ U_CAPI UBool U_EXPORT2 usearch_searchBackwards(UStringSearch  *strsrch,
         initializePatternPCETable(strsrch, status);
     }
 
-    CEIBuffer ceb(strsrch, status);
+    CEIBuffer ceb(strsrch, FALSE, status);
     int32_t    targetIx = 0;
 
     /*
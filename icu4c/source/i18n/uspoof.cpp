@@ -28,6 +28,7 @@
 #include "ucln_in.h"
 #include "uspoof_impl.h"
 #include "umutex.h"
+#include "ustr_imp.h"
 
 
 #if !UCONFIG_NO_NORMALIZATION
@@ -694,43 +695,105 @@ uspoof_getSkeleton(const USpoofChecker *sc,
 
 
 
-U_I18N_API UnicodeString &  U_EXPORT2
-uspoof_getSkeletonUnicodeString(const USpoofChecker *sc,
-                                uint32_t /*type*/,
-                                const UnicodeString &id,
-                                UnicodeString &dest,
-                                UErrorCode *status) {
-    const SpoofImpl *This = SpoofImpl::validateThis(sc, *status);
-    if (U_FAILURE(*status)) {
-        return dest;
+namespace {
+
+// Normalizes src to NFD into dest, replacing its contents.
+// Only the part from the first character that may not be in NFD is
+// normalized; identifiers are usually in NFD already.
+void normalizeNFD(const UnicodeString &src, UnicodeString &dest, UErrorCode &status) {
+    int32_t spanLength = gNfdNormalizer->spanQuickCheckYes(src, status);
+    if (U_FAILURE(status)) {
+        return;
+    }
+    if (spanLength == src.length()) {
+        dest.fastCopyFrom(src);
+    } else {
+        dest.setTo(src, 0, spanLength);
+        gNfdNormalizer->normalizeSecondAndAppend(dest, src.tempSubString(spanLength), status);
+    }
+}
+
+// The skeleton of id, as the NFD form of the NFD form of id with each
+// code point replaced by its confusable mapping.
+void getSkeleton(const SpoofImpl *This, const UnicodeString &id, UnicodeString &dest,
+                 UErrorCode &status) {
+    // ASCII text is in NFD, and so is its skeleton if that is ASCII as well.
+    const UChar *s = id.getBuffer();
+    int32_t length = id.length();
+    int32_t i = 0;
+    while (i < length && s[i] < 0x80) { ++i; }
+    if (i == length) {
+        UnicodeString skelStr;
+        for (i = 0; i < length; ++i) {
+            This->fSpoofData->confusableLookup(s[i], skelStr);
+        }
+        const UChar *skel = skelStr.getBuffer();
+        int32_t skelLength = skelStr.length();
+        for (i = 0; i < skelLength && skel[i] < 0x80; ++i) {}
+        if (i == skelLength) {
+            dest.fastCopyFrom(skelStr);
+            return;
+        }
     }
 
     UnicodeString nfdId;
-    gNfdNormalizer->normalize(id, nfdId, *status);
+    normalizeNFD(id, nfdId, status);
+    if (U_FAILURE(status)) {
+        return;
+    }
 
     // Apply the skeleton mapping to the NFD normalized input string
     // Accumulate the skeleton, possibly unnormalized, in a UnicodeString.
-    int32_t inputIndex = 0;
     UnicodeString skelStr;
     int32_t normalizedLen = nfdId.length();
-    for (inputIndex=0; inputIndex < normalizedLen; ) {
+    for (int32_t inputIndex = 0; inputIndex < normalizedLen; ) {
         UChar32 c = nfdId.char32At(inputIndex);
         inputIndex += U16_LENGTH(c);
         This->fSpoofData->confusableLookup(c, skelStr);
     }
+    normalizeNFD(skelStr, dest, status);
+}
+
+// The skeleton of a UTF-8 id.  An ASCII id with an ASCII skeleton is mapped
+// directly; the result is in skel8 if it fits, or else in skel16.
+// @return the length of the skeleton in skel8, or -1 if it is in skel16.
+int32_t getSkeletonUTF8(const SpoofImpl *This, StringPiece id,
+                        char *skel8, int32_t capacity, UnicodeString &skel16,
+                        UErrorCode &status) {
+    int32_t length = This->fSpoofData->getASCIISkeleton(id.data(), id.length(), skel8, capacity);
+    if (0 <= length && length <= capacity) {
+        return length;
+    }
+    getSkeleton(This, UnicodeString::fromUTF8(id), skel16, status);
+    return -1;
+}
+
+}  // namespace
 
-    gNfdNormalizer->normalize(skelStr, dest, *status);
+
+U_I18N_API UnicodeString &  U_EXPORT2
+uspoof_getSkeletonUnicodeString(const USpoofChecker *sc,
+                                uint32_t /*type*/,
+                                const UnicodeString &id,
+                                UnicodeString &dest,
+                                UErrorCode *status) {
+    const SpoofImpl *This = SpoofImpl::validateThis(sc, *status);
+    if (U_FAILURE(*status)) {
+        return dest;
+    }
+
+    getSkeleton(This, id, dest, *status);
     return dest;
 }
 
 
 U_CAPI int32_t U_EXPORT2
 uspoof_getSkeletonUTF8(const USpoofChecker *sc,
-                       uint32_t type,
+                       uint32_t /*type*/,
                        const char *id,  int32_t length,
                        char *dest, int32_t destCapacity,
                        UErrorCode *status) {
-    SpoofImpl::validateThis(sc, *status);
+    const SpoofImpl *This = SpoofImpl::validateThis(sc, *status);
     if (U_FAILURE(*status)) {
         return 0;
     }
@@ -739,9 +802,15 @@ uspoof_getSkeletonUTF8(const USpoofChecker *sc,
         return 0;
     }
 
-    UnicodeString srcStr = UnicodeString::fromUTF8(StringPiece(id, length>=0 ? length : static_cast<int32_t>(uprv_strlen(id))));
+    StringPiece idPiece(id, length>=0 ? length : static_cast<int32_t>(uprv_strlen(id)));
+    int32_t asciiLength = This->fSpoofData->getASCIISkeleton(
+        idPiece.data(), idPiece.length(), dest, destCapacity);
+    if (asciiLength >= 0) {
+        return u_terminateChars(dest, destCapacity, asciiLength, status);
+    }
+
     UnicodeString destStr;
-    uspoof_getSkeletonUnicodeString(sc, type, srcStr, destStr, status);
+    getSkeleton(This, UnicodeString::fromUTF8(idPiece), destStr, *status);
     if (U_FAILURE(*status)) {
         return 0;
     }
@@ -753,6 +822,72 @@ uspoof_getSkeletonUTF8(const USpoofChecker *sc,
 }
 
 
+U_CAPI UBool U_EXPORT2
+uspoof_isConfusableWithAny(const USpoofChecker *sc,
+                           const USet *skeletons,
+                           const UChar *id, int32_t length,
+                           UErrorCode *status) {
+    SpoofImpl::validateThis(sc, *status);
+    if (U_FAILURE(*status)) {
+        return FALSE;
+    }
+    if (skeletons == NULL || length < -1) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return FALSE;
+    }
+    UnicodeString idStr((length==-1), id, length);  // Aliasing constructor
+    return uspoof_isConfusableWithAnyUnicodeString(
+        sc, *UnicodeSet::fromUSet(skeletons), idStr, status);
+}
+
+
+U_CAPI UBool U_EXPORT2
+uspoof_isConfusableWithAnyUTF8(const USpoofChecker *sc,
+                               const USet *skeletons,
+                               const char *id, int32_t length,
+                               UErrorCode *status) {
+    const SpoofImpl *This = SpoofImpl::validateThis(sc, *status);
+    if (U_FAILURE(*status)) {
+        return FALSE;
+    }
+    if (skeletons == NULL || length < -1) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return FALSE;
+    }
+    // Most identifiers are short; their skeletons fit into the stack buffers.
+    char skel8[64];
+    UnicodeString skel16;
+    int32_t skel8Length = getSkeletonUTF8(
+        This, StringPiece(id, length>=0 ? length : static_cast<int32_t>(uprv_strlen(id))),
+        skel8, UPRV_LENGTHOF(skel8), skel16, *status);
+    if (U_FAILURE(*status)) {
+        return FALSE;
+    }
+    if (skel8Length >= 0) {
+        skel16 = UnicodeString::fromUTF8(StringPiece(skel8, skel8Length));
+    }
+    return UnicodeSet::fromUSet(skeletons)->contains(skel16);
+}
+
+
+U_I18N_API UBool U_EXPORT2
+uspoof_isConfusableWithAnyUnicodeString(const USpoofChecker *sc,
+                                        const UnicodeSet &skeletons,
+                                        const UnicodeString &id,
+                                        UErrorCode *status) {
+    const SpoofImpl *This = SpoofImpl::validateThis(sc, *status);
+    if (U_FAILURE(*status)) {
+        return FALSE;
+    }
+    UnicodeString skeleton;
+    getSkeleton(This, id, skeleton, *status);
+    if (U_FAILURE(*status)) {
+        return FALSE;
+    }
+    return skeletons.contains(skeleton);
+}
+
+
 U_CAPI int32_t U_EXPORT2
 uspoof_serialize(USpoofChecker *sc,void *buf, int32_t capacity, UErrorCode *status) {
     SpoofImpl *This = SpoofImpl::validateThis(sc, *status);
@@ -10,6 +10,8 @@
 #include "unicode/utypes.h"
 #include "unicode/uspoof.h"
 #include "unicode/uchar.h"
+#include "unicode/ucptrie.h"
+#include "unicode/umutablecptrie.h"
 #include "unicode/uniset.h"
 #include "unicode/utf16.h"
 #include "utrie2.h"
@@ -21,6 +23,7 @@
 #include "uassert.h"
 #include "ucln_in.h"
 #include "uspoof_impl.h"
+#include "uvector.h"
 
 #if !UCONFIG_NO_NORMALIZATION
 
@@ -266,6 +269,97 @@ void SpoofImpl::getAugmentedScriptSet(UChar32 codePoint, ScriptSet& result, UErr
     }
 }
 
+// The augmented script sets of all code points, interned: the trie maps each
+// code point to the index of its set in gAugmentedScriptSets.
+// Set 0 is the set of all scripts, for Common and Inherited characters.
+static UCPTrie *gAugmentedScriptTrie = nullptr;
+static UVector *gAugmentedScriptSets = nullptr;
+static UInitOnce gAugmentedScriptsInitOnce = U_INITONCE_INITIALIZER;
+
+static UBool U_CALLCONV
+uspoof_cleanupAugmentedScripts(void) {
+    ucptrie_close(gAugmentedScriptTrie);
+    gAugmentedScriptTrie = nullptr;
+    delete gAugmentedScriptSets;
+    gAugmentedScriptSets = nullptr;
+    gAugmentedScriptsInitOnce.reset();
+    return TRUE;
+}
+
+static UBool U_CALLCONV
+scriptSetsEqual(const UElement key1, const UElement key2) {
+    return *static_cast<const ScriptSet *>(key1.pointer) ==
+        *static_cast<const ScriptSet *>(key2.pointer);
+}
+
+static void U_CALLCONV initAugmentedScripts(UErrorCode &status) {
+    ucln_i18n_registerCleanup(UCLN_I18N_SPOOF_SCRIPTSETS, uspoof_cleanupAugmentedScripts);
+    LocalPointer<UVector> sets(
+        new UVector(uhash_deleteScriptSet, scriptSetsEqual, status), status);
+    // Set 1 is for unpaired surrogates, which the trie lookup returns as errors.
+    LocalUMutableCPTriePointer mutableTrie(umutablecptrie_open(0, 1, &status));
+    const UCPMap *scripts = u_getIntPropertyMap(UCHAR_SCRIPT, &status);
+    if (U_FAILURE(status)) { return; }
+
+    ScriptSet *all = new ScriptSet();
+    ScriptSet *unknown = new ScriptSet();
+    if (all == nullptr || unknown == nullptr) {
+        delete all;
+        delete unknown;
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    all->setAll();
+    sets->addElement(all, status);
+    SpoofImpl::getAugmentedScriptSet(0xd800, *unknown, status);
+    sets->addElement(unknown, status);
+    if (U_FAILURE(status)) { return; }
+
+    // Script extensions only differ from the script for assigned characters,
+    // so one lookup covers each range of unassigned code points.
+    ScriptSet set;
+    ScriptSet prevSet(*all);
+    int32_t index = 0;
+    UChar32 start = 0, end;
+    uint32_t script;
+    while (U_SUCCESS(status) &&
+            (end = ucpmap_getRange(scripts, start, UCPMAP_RANGE_NORMAL, 0,
+                                   nullptr, nullptr, &script)) >= 0) {
+        UChar32 limit = script == USCRIPT_UNKNOWN ? start + 1 : end + 1;
+        for (UChar32 c = start; c < limit; ++c) {
+            SpoofImpl::getAugmentedScriptSet(c, set, status);
+            if (U_FAILURE(status)) { return; }
+            if (set != prevSet) {
+                index = sets->indexOf(&set);
+                if (index < 0) {
+                    ScriptSet *newSet = new ScriptSet(set);
+                    if (newSet == nullptr) {
+                        status = U_MEMORY_ALLOCATION_ERROR;
+                        return;
+                    }
+                    index = sets->size();
+                    sets->addElement(newSet, status);
+                }
+                prevSet = set;
+            }
+            if (index != 0) {
+                if (limit == start + 1) {
+                    umutablecptrie_setRange(mutableTrie.getAlias(), start, end, index, &status);
+                } else {
+                    umutablecptrie_set(mutableTrie.getAlias(), c, index, &status);
+                }
+            }
+        }
+        start = end + 1;
+    }
+    if (U_FAILURE(status)) { return; }
+    U_ASSERT(sets->size() <= 0xffff);
+    gAugmentedScriptTrie = umutablecptrie_buildImmutable(
+        mutableTrie.getAlias(), UCPTRIE_TYPE_FAST, UCPTRIE_VALUE_BITS_16, &status);
+    if (U_FAILURE(status)) { return; }
+    gAugmentedScriptSets = sets.orphan();
+}
+
 // Computes the resolved script set for a string, according to UTS 39 section 5.1.
 void SpoofImpl::getResolvedScriptSet(const UnicodeString& input, ScriptSet& result, UErrorCode& status) const {
     getResolvedScriptSetWithout(input, USCRIPT_CODE_LIMIT, result, status);
@@ -275,20 +369,26 @@ void SpoofImpl::getResolvedScriptSet(const UnicodeString& input, ScriptSet& resu
 // If USCRIPT_CODE_LIMIT is passed as the second argument, all characters are included.
 void SpoofImpl::getResolvedScriptSetWithout(const UnicodeString& input, UScriptCode script, ScriptSet& result, UErrorCode& status) const {
     result.setAll();
+    umtx_initOnce(gAugmentedScriptsInitOnce, &initAugmentedScripts, status);
+    if (U_FAILURE(status)) { return; }
 
-    ScriptSet temp;
-    UChar32 codePoint;
-    for (int32_t i = 0; i < input.length(); i += U16_LENGTH(codePoint)) {
-        codePoint = input.char32At(i);
-
-        // Compute the augmented script set for the character
-        getAugmentedScriptSet(codePoint, temp, status);
-        if (U_FAILURE(status)) { return; }
+    // Look up the interned augmented script set of each character.
+    // Set 0 (all scripts) and a repeat of the previous set leave the result unchanged.
+    const UChar *s = input.getBuffer();
+    const UChar *limit = s + input.length();
+    uint32_t prevIndex = 0;
+    while (s < limit) {
+        UChar32 codePoint;
+        uint32_t index;
+        UCPTRIE_FAST_U16_NEXT(gAugmentedScriptTrie, UCPTRIE_16, s, limit, codePoint, index);
+        if (index == prevIndex) { continue; }
+        prevIndex = index;
+        const ScriptSet *temp = static_cast<const ScriptSet *>(gAugmentedScriptSets->elementAt(index));
 
         // Intersect the augmented script set with the resolved script set, but only if the character doesn't
         // have the script specified in the function call
-        if (script == USCRIPT_CODE_LIMIT || !temp.test(script, status)) {
-            result.intersect(temp);
+        if (script == USCRIPT_CODE_LIMIT || !temp->test(script, status)) {
+            result.intersect(*temp);
         }
     }
 }
@@ -662,6 +762,7 @@ void SpoofData::reset() {
    fCFUKeys = NULL;
    fCFUValues = NULL;
    fCFUStrings = NULL;
+   initASCIIIndex();
 }
 
 
@@ -696,6 +797,27 @@ void SpoofData::initPtrs(UErrorCode &status) {
     if (fRawData->fCFUStringTable != 0) {
         fCFUStrings = (UChar *)((char *)fRawData + fRawData->fCFUStringTable);
     }
+    initASCIIIndex();
+}
+
+
+//  SpoofData::initASCIIIndex()
+//            Find the entries for the ASCII code points, which sort first.
+//            Only the keys are needed, which the builder adds first.
+//
+void SpoofData::initASCIIIndex() {
+    uprv_memset(fASCIIIndex, -1, sizeof(fASCIIIndex));
+    if (fCFUKeys == NULL) {
+        return;
+    }
+    int32_t numKeys = length();
+    for (int32_t i = 0; i < numKeys; ++i) {
+        UChar32 c = codePointAt(i);
+        if (c >= 0x80) {
+            break;
+        }
+        fASCIIIndex[c] = (int16_t)i;
+    }
 }
 
 
@@ -763,6 +885,15 @@ int32_t SpoofData::size() const {
 //-------------------------------
 
 int32_t SpoofData::confusableLookup(UChar32 inChar, UnicodeString &dest) const {
+    if (inChar < 0x80) {
+        int32_t index = fASCIIIndex[inChar];
+        if (index < 0) {
+            dest.append((UChar)inChar);
+            return 1;
+        }
+        return appendValueTo(index, dest);
+    }
+
     // Perform a binary search.
     // [lo, hi), i.e lo is inclusive, hi is exclusive.
     // The result after the loop will be in lo.
@@ -814,6 +945,37 @@ int32_t SpoofData::appendValueTo(int32_t index, UnicodeString& dest) const {
     return stringLength;
 }
 
+int32_t SpoofData::getASCIISkeleton(const char *s, int32_t length,
+                                    char *dest, int32_t capacity) const {
+    int32_t destLength = 0;
+    for (int32_t i = 0; i < length; ++i) {
+        uint8_t c = (uint8_t)s[i];
+        if (c >= 0x80) {
+            return -1;
+        }
+        int32_t index = fASCIIIndex[c];
+        if (index < 0) {
+            if (destLength < capacity) {
+                dest[destLength] = (char)c;
+            }
+            ++destLength;
+            continue;
+        }
+        int32_t stringLength = ConfusableDataUtils::keyToLength(fCFUKeys[index]);
+        for (int32_t j = 0; j < stringLength; ++j) {
+            UChar u = stringLength == 1 ? (UChar)fCFUValues[index] : fCFUStrings[fCFUValues[index] + j];
+            if (u >= 0x80) {
+                return -1;
+            }
+            if (destLength < capacity) {
+                dest[destLength] = (char)u;
+            }
+            ++destLength;
+        }
+    }
+    return destLength;
+}
+
 
 U_NAMESPACE_END
 
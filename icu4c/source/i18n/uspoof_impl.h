@@ -262,6 +262,13 @@ class SpoofData: public UMemory {
     // @return   The length in UTF-16 code units of the skeleton string.
     int32_t appendValueTo(int32_t index, UnicodeString& dest) const;
 
+    // Get the confusable skeleton of an all-ASCII string whose skeleton is
+    // also ASCII, without normalization (ASCII text is in NFD).
+    // Writes at most capacity bytes to dest, and does not NUL-terminate.
+    // @return   The length of the skeleton, or -1 if s is not all ASCII,
+    //           or if the skeleton of one of its characters is not ASCII.
+    int32_t getASCIISkeleton(const char *s, int32_t length, char *dest, int32_t capacity) const;
+
   private:
     // Reserve space in the raw data.  For use by builder when putting together a
     //   new set of data.  Init the new storage to zero, to prevent inconsistent
@@ -273,6 +280,9 @@ class SpoofData: public UMemory {
     // initialize the pointers from this object to the raw data.
     void initPtrs(UErrorCode &status);
 
+    // initialize fASCIIIndex from the keys.
+    void initASCIIIndex();
+
     SpoofDataHeader             *fRawData;          // Ptr to the raw memory-mapped data
     UBool                       fDataOwned;         // True if the raw data is owned, and needs
                                                     //  to be deleted when refcount goes to zero.
@@ -288,6 +298,10 @@ class SpoofData: public UMemory {
     uint16_t                    *fCFUValues;
     UChar                       *fCFUStrings;
 
+    // Index of the entry for each ASCII code point, or -1 if it maps to itself.
+    // Saves the binary search for the most common characters.
+    int16_t                     fASCIIIndex[0x80];
+
     friend class ConfusabledataBuilder;
 };
 
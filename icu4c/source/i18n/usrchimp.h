@@ -158,6 +158,8 @@ struct UPattern {
           int32_t             pcesLength;
           int64_t            *pces;
           int64_t             pcesBuffer[INITIAL_ARRAY_SIZE_];
+          // skip distances for usearch_search(), see setPCEShiftTable()
+          int16_t             pceShift[MAX_TABLE_SIZE_];
           UBool               hasPrefixAccents;
           UBool               hasSuffixAccents;
           int16_t             defaultShiftSize;
@@ -174,6 +176,8 @@ struct UStringSearch {
     // if we are at the start of the text.
            UCollationElements *textIter;
            icu::UCollationPCE *textProcessedIter;
+    // processed CEs of the text for forward searching, or NULL; see usearch_setTextIndex()
+    const  struct USearchTextIndex *textIndex;
     // utility collation element, used throughout program for temporary 
     // iteration.
            UCollationElements *utilIter;
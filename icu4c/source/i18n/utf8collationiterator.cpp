@@ -161,6 +161,9 @@ FCDUTF8CollationIterator::handleNextCE32(UChar32 &c, UErrorCode &errorCode) {
                 // ASCII 00..7F
                 return trie->data32[c];
             }
+            --pos;
+            if(nextFCDInertSpan()) { continue; }
+            ++pos;
             uint8_t t1, t2;
             if(0xe0 <= c && c < 0xf0 &&
                     ((pos + 1) < length || length < 0) &&
@@ -231,6 +234,34 @@ FCDUTF8CollationIterator::nextHasLccc() const {
     return CollationFCD::hasLccc(c);
 }
 
+UBool
+FCDUTF8CollationIterator::nextFCDInertSpan() {
+    U_ASSERT(state == CHECK_FWD && pos != length && !U8_IS_SINGLE(u8[pos]));
+    // Same lead bytes as in nextHasLccc(): Code points below U+0300 and
+    // CJK U+4000..U+DFFF except U+Axxx have lccc=0.
+    // The scan steps by code point, exactly like the forward iteration,
+    // so that the segment limit is on a code point boundary.
+    int32_t i = pos;
+    int32_t lastStart = pos;
+    for(;;) {
+        if(i == length) {
+            // All of the rest of the text is FCD.
+            lastStart = length;
+            break;
+        }
+        uint8_t b = u8[i];
+        if(!(b < 0xcc || (0xe4 <= b && b <= 0xed && b != 0xea)) || (b == 0 && length < 0)) {
+            break;
+        }
+        lastStart = i;
+        U8_FWD_1(u8, i, length);
+    }
+    if(lastStart == pos) { return FALSE; }
+    limit = lastStart;
+    state = IN_FCD_SEGMENT;
+    return TRUE;
+}
+
 UBool
 FCDUTF8CollationIterator::previousHasTccc() const {
     U_ASSERT(state == CHECK_BWD && pos != 0);
@@ -273,6 +304,7 @@ FCDUTF8CollationIterator::nextCodePoint(UErrorCode &errorCode) {
                 ++pos;
                 return c;
             }
+            if(nextFCDInertSpan()) { continue; }
             U8_NEXT_OR_FFFD(u8, pos, length, c);
             if(CollationFCD::hasTccc(c <= 0xffff ? c : U16_LEAD(c)) &&
                     (CollationFCD::maybeTibetanCompositeVowel(c) ||
@@ -110,6 +110,16 @@ class U_I18N_API FCDUTF8CollationIterator : public UTF8CollationIterator {
     UBool nextHasLccc() const;
     UBool previousHasTccc() const;
 
+    /**
+     * Called in CHECK_FWD state with pos at a non-ASCII code point.
+     * Skips the FCD checks for a run of text that cannot fail them:
+     * If the code points from pos on have lccc=0 up to some point,
+     * then switches to an IN_FCD_SEGMENT for all of them but the last one,
+     * whose tccc still needs to be checked against the next code point.
+     * @return TRUE if the state was switched
+     */
+    UBool nextFCDInertSpan();
+
     /**
      * Switches to forward checking if possible.
      */
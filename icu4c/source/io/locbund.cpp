@@ -34,6 +34,38 @@
 
 static UNumberFormat *gPosixNumberFormat[ULOCALEBUNDLE_NUMBERFORMAT_COUNT];
 
+/*
+ * The number formats of the last closed bundle for the invariant locale,
+ * which the next one takes over, so that u_sprintf() and u_sscanf()
+ * do not copy the formats for each call.
+ */
+static ULocaleBundle gSpareInvariantBundle;
+static UBool gHasSpareInvariantBundle = FALSE;
+
+static icu::UMutex gLock;
+
+/* Moves the number formats and their variants from one bundle to another. */
+static void moveNumberFormats(ULocaleBundle *dest, ULocaleBundle *src) {
+    uprv_memcpy(dest->fNumberFormat, src->fNumberFormat, sizeof(dest->fNumberFormat));
+    uprv_memcpy(dest->fVariants, src->fVariants, sizeof(dest->fVariants));
+    dest->fNextVariant = src->fNextVariant;
+    uprv_memset(src->fNumberFormat, 0, sizeof(src->fNumberFormat));
+    uprv_memset(src->fVariants, 0, sizeof(src->fVariants));
+    src->fNextVariant = 0;
+}
+
+static void closeNumberFormats(ULocaleBundle *bundle) {
+    int32_t i;
+    for (i = 0; i < ULOCALEBUNDLE_NUMBERFORMAT_COUNT; i++) {
+        unum_close(bundle->fNumberFormat[i]);
+        bundle->fNumberFormat[i] = NULL;
+    }
+    for (i = 0; i < ULOCALEBUNDLE_VARIANT_COUNT; i++) {
+        unum_close(bundle->fVariants[i].fFormat);
+        bundle->fVariants[i].fFormat = NULL;
+    }
+}
+
 U_CDECL_BEGIN
 static UBool U_CALLCONV locbund_cleanup(void) {
     int32_t style;
@@ -41,13 +73,14 @@ static UBool U_CALLCONV locbund_cleanup(void) {
         unum_close(gPosixNumberFormat[style]);
         gPosixNumberFormat[style] = NULL;
     }
+    closeNumberFormats(&gSpareInvariantBundle);
+    gHasSpareInvariantBundle = FALSE;
     return TRUE;
 }
 U_CDECL_END
 
 static inline UNumberFormat * copyInvariantFormatter(ULocaleBundle *result, UNumberFormatStyle style) {
     U_NAMESPACE_USE
-    static UMutex gLock;
     Mutex lock(&gLock);
     if (result->fNumberFormat[style-1] == NULL) {
         if (gPosixNumberFormat[style-1] == NULL) {
@@ -91,6 +124,15 @@ u_locbund_init(ULocaleBundle *result, const char *loc)
 
     result->isInvariantLocale = uprv_strcmp(result->fLocale, "en_US_POSIX") == 0;
 
+    if (result->isInvariantLocale) {
+        U_NAMESPACE_USE
+        Mutex lock(&gLock);
+        if (gHasSpareInvariantBundle) {
+            moveNumberFormats(result, &gSpareInvariantBundle);
+            gHasSpareInvariantBundle = FALSE;
+        }
+    }
+
     return result;
 }
 
@@ -142,16 +184,19 @@ u_locbund_clone(const ULocaleBundle *bundle)
 U_CAPI void
 u_locbund_close(ULocaleBundle *bundle)
 {
-    int32_t styleIdx;
-
     uprv_free(bundle->fLocale);
-    
-    for (styleIdx = 0; styleIdx < ULOCALEBUNDLE_NUMBERFORMAT_COUNT; styleIdx++) {
-        if (bundle->fNumberFormat[styleIdx]) {
-            unum_close(bundle->fNumberFormat[styleIdx]);
+
+    if (bundle->isInvariantLocale) {
+        U_NAMESPACE_USE
+        Mutex lock(&gLock);
+        if (!gHasSpareInvariantBundle) {
+            moveNumberFormats(&gSpareInvariantBundle, bundle);
+            gHasSpareInvariantBundle = TRUE;
+            ucln_io_registerCleanup(UCLN_IO_LOCBUND, locbund_cleanup);
         }
     }
-    
+    closeNumberFormats(bundle);
+
     uprv_memset(bundle, 0, sizeof(ULocaleBundle));
 /*    uprv_free(bundle);*/
 }
@@ -182,4 +227,44 @@ u_locbund_getNumberFormat(ULocaleBundle *bundle, UNumberFormatStyle style)
     return formatAlias;
 }
 
+U_CAPI UNumberFormat *
+u_locbund_getNumberFormatVariant(ULocaleBundle *bundle, UNumberFormatStyle style,
+                                 int32_t key, int32_t value, UBool *isNew)
+{
+    ULocaleBundleVariant *variant;
+    UNumberFormat *format;
+    UErrorCode status = U_ZERO_ERROR;
+    int32_t i;
+
+    *isNew = FALSE;
+    for (i = 0; i < ULOCALEBUNDLE_VARIANT_COUNT; i++) {
+        variant = &bundle->fVariants[i];
+        if (variant->fFormat != NULL && variant->fStyle == style &&
+                variant->fKey == key && variant->fValue == value) {
+            return variant->fFormat;
+        }
+    }
+
+    format = u_locbund_getNumberFormat(bundle, style);
+    if (format == NULL) {
+        return NULL;
+    }
+    format = unum_clone(format, &status);
+    if (U_FAILURE(status)) {
+        unum_close(format);
+        return NULL;
+    }
+
+    /* Replace the variants in turn. */
+    variant = &bundle->fVariants[bundle->fNextVariant];
+    bundle->fNextVariant = (bundle->fNextVariant + 1) % ULOCALEBUNDLE_VARIANT_COUNT;
+    unum_close(variant->fFormat);
+    variant->fFormat = format;
+    variant->fStyle = style;
+    variant->fKey = key;
+    variant->fValue = value;
+    *isNew = TRUE;
+    return format;
+}
+
 #endif /* #if !UCONFIG_NO_FORMATTING */
@@ -29,11 +29,28 @@
 
 #define ULOCALEBUNDLE_NUMBERFORMAT_COUNT ((int32_t)UNUM_SPELLOUT)
 
+/* The number of number format variants that a ULocaleBundle caches. */
+#define ULOCALEBUNDLE_VARIANT_COUNT 4
+
+/**
+ * A copy of one of the bundle's number formats, with some changes made to it once.
+ * The style, key and value identify those changes.
+ */
+typedef struct ULocaleBundleVariant {
+    UNumberFormat       *fFormat;
+    UNumberFormatStyle  fStyle;
+    int32_t             fKey;
+    int32_t             fValue;
+} ULocaleBundleVariant;
+
 typedef struct ULocaleBundle {
     char            *fLocale;
 
     UNumberFormat   *fNumberFormat[ULOCALEBUNDLE_NUMBERFORMAT_COUNT];
     UBool           isInvariantLocale;
+
+    ULocaleBundleVariant fVariants[ULOCALEBUNDLE_VARIANT_COUNT];
+    int32_t         fNextVariant;   /* The variant to replace next */
 } ULocaleBundle;
 
 
@@ -77,6 +94,22 @@ u_locbund_close(ULocaleBundle *bundle);
 U_CAPI UNumberFormat *
 u_locbund_getNumberFormat(ULocaleBundle *bundle, UNumberFormatStyle style);
 
+/**
+ * Get a copy of the NumberFormat for a style, with changes that the caller makes
+ * when it is first returned. The copy is reused for later calls with the same
+ * style, key and value, which saves the caller from changing and restoring
+ * the shared NumberFormat, and from rebuilding it each time.
+ * @param bundle The ULocaleBundle to use
+ * @param style The style of the NumberFormat to copy
+ * @param key Identifies the kind of changes, together with the value
+ * @param value Identifies the changes, together with the key
+ * @param isNew Set to TRUE if the copy is new and still needs the changes
+ * @return A pointer to the NumberFormat copy, or NULL if it could not be created.
+ */
+U_CAPI UNumberFormat *
+u_locbund_getNumberFormatVariant(ULocaleBundle *bundle, UNumberFormatStyle style,
+                                 int32_t key, int32_t value, UBool *isNew);
+
 #endif /* #if !UCONFIG_NO_FORMATTING */
 
 #endif
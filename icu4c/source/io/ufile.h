@@ -31,11 +31,22 @@
 #include "unicode/utrans.h"
 #include "locbund.h"
 
+/*
+ * The buffer sizes can be overridden on the compiler command line,
+ * for example to write and read large files with fewer stdio calls.
+ * The char buffer is on the stack of the write and read functions,
+ * and the UChar buffer is part of each UFILE.
+ */
+
 /* The buffer size for fromUnicode calls */
-#define UFILE_CHARBUFFER_SIZE 1024
+#ifndef UFILE_CHARBUFFER_SIZE
+#define UFILE_CHARBUFFER_SIZE 4096
+#endif
 
 /* The buffer size for toUnicode calls */
-#define UFILE_UCHARBUFFER_SIZE 1024
+#ifndef UFILE_UCHARBUFFER_SIZE
+#define UFILE_UCHARBUFFER_SIZE 4096
+#endif
 
 /* A UFILE */
 
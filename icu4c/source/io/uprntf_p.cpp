@@ -159,6 +159,22 @@ u_printf_set_sign(UNumberFormat        *format,
     }
 }
 
+/*
+ * Keys for the number format variants that the numeric handlers use,
+ * times 4 plus the sign flags for the handlers that show the sign.
+ */
+#define UPRINTF_VARIANT_FRACTION_DIGITS 1
+#define UPRINTF_VARIANT_MIN_INTEGER_DIGITS 2
+#define UPRINTF_VARIANT_SIGNIFICANT_DIGITS 3
+
+/* Gets the key for a number format variant with the sign set according to u_printf_spec_info */
+static inline int32_t
+u_printf_variant_key(int32_t kind,
+                     const u_printf_spec_info     *info)
+{
+    return kind * 4 + (info->fShowSign ? (info->fSpace ? 2 : 1) : 0);
+}
+
 static void
 u_printf_reset_sign(UNumberFormat        *format,
                    const u_printf_spec_info     *info,
@@ -274,21 +290,25 @@ u_printf_char_handler(const u_printf_stream_handler  *handler,
     return written;
 }
 
+/*
+ * Formats a double in 'f' notation, optionally limited to as many significant digits
+ * as decimal digits, for 'g' notation.
+ */
 static int32_t
-u_printf_double_handler(const u_printf_stream_handler  *handler,
-                        void                           *context,
-                        ULocaleBundle                  *formatBundle,
-                        const u_printf_spec_info       *info,
-                        const ufmt_args                *args)
+u_printf_format_double(const u_printf_stream_handler  *handler,
+                       void                           *context,
+                       ULocaleBundle                  *formatBundle,
+                       const u_printf_spec_info       *info,
+                       double                         num,
+                       UBool                          useSignificantDigits)
 {
-    double        num         = (double) (args[0].doubleValue);
     UNumberFormat  *format;
     UChar          result[UPRINTF_BUFFER_SIZE];
     UChar          prefixBuffer[UPRINTF_BUFFER_SIZE];
     int32_t        prefixBufferLen = sizeof(prefixBuffer);
-    int32_t        minDecimalDigits;
-    int32_t        maxDecimalDigits;
+    int32_t        fractionDigits;
     int32_t        resultLen;
+    UBool          isNew;
     UErrorCode     status        = U_ZERO_ERROR;
 
     prefixBuffer[0] = 0;
@@ -297,35 +317,39 @@ u_printf_double_handler(const u_printf_stream_handler  *handler,
     /*  if(! info->fIsLongDouble)
     num &= DBL_MAX;*/
 
-    /* get the formatter */
-    format = u_locbund_getNumberFormat(formatBundle, UNUM_DECIMAL);
-
-    /* handle error */
-    if(format == 0)
-        return 0;
-
-    /* save the formatter's state */
-    minDecimalDigits = unum_getAttribute(format, UNUM_MIN_FRACTION_DIGITS);
-    maxDecimalDigits = unum_getAttribute(format, UNUM_MAX_FRACTION_DIGITS);
-
-    /* set the appropriate flags and number of decimal digits on the formatter */
     if(info->fPrecision != -1) {
         /* set the # of decimal digits */
-        unum_setAttribute(format, UNUM_FRACTION_DIGITS, info->fPrecision);
-    }
-    else if(info->fAlt) {
-        /* '#' means always show decimal point */
-        /* copy of printf behavior on Solaris - '#' shows 6 digits */
-        unum_setAttribute(format, UNUM_FRACTION_DIGITS, 6);
+        fractionDigits = info->fPrecision;
     }
     else {
         /* # of decimal digits is 6 if precision not specified regardless of locale */
-        unum_setAttribute(format, UNUM_FRACTION_DIGITS, 6);
+        /* '#' means always show decimal point */
+        /* copy of printf behavior on Solaris - '#' shows 6 digits */
+        fractionDigits = 6;
     }
 
-    /* set whether to show the sign */
-    if (info->fShowSign) {
-        u_printf_set_sign(format, info, prefixBuffer, &prefixBufferLen, &status);
+    /* get a copy of the formatter for this number of digits and sign */
+    format = u_locbund_getNumberFormatVariant(formatBundle, UNUM_DECIMAL,
+        u_printf_variant_key(useSignificantDigits ?
+            UPRINTF_VARIANT_SIGNIFICANT_DIGITS : UPRINTF_VARIANT_FRACTION_DIGITS, info),
+        fractionDigits, &isNew);
+
+    /* handle error */
+    if(format == 0)
+        return 0;
+
+    /* set the appropriate flags and number of digits on a new copy */
+    if (isNew) {
+        if (useSignificantDigits) {
+            unum_setAttribute(format, UNUM_SIGNIFICANT_DIGITS_USED, TRUE);
+            unum_setAttribute(format, UNUM_MAX_SIGNIFICANT_DIGITS, fractionDigits);
+        }
+        unum_setAttribute(format, UNUM_FRACTION_DIGITS, fractionDigits);
+
+        /* set whether to show the sign */
+        if (info->fShowSign) {
+            u_printf_set_sign(format, info, prefixBuffer, &prefixBufferLen, &status);
+        }
     }
 
     /* format the number */
@@ -335,20 +359,19 @@ u_printf_double_handler(const u_printf_stream_handler  *handler,
         resultLen = 0;
     }
 
-    /* restore the number format */
-    /* TODO: Is this needed? */
-    unum_setAttribute(format, UNUM_MIN_FRACTION_DIGITS, minDecimalDigits);
-    unum_setAttribute(format, UNUM_MAX_FRACTION_DIGITS, maxDecimalDigits);
-
-    if (info->fShowSign) {
-        /* Reset back to original value regardless of what the error was */
-        UErrorCode localStatus = U_ZERO_ERROR;
-        u_printf_reset_sign(format, info, prefixBuffer, &prefixBufferLen, &localStatus);
-    }
-
     return handler->pad_and_justify(context, info, result, resultLen);
 }
 
+static int32_t
+u_printf_double_handler(const u_printf_stream_handler  *handler,
+                        void                           *context,
+                        ULocaleBundle                  *formatBundle,
+                        const u_printf_spec_info       *info,
+                        const ufmt_args                *args)
+{
+    return u_printf_format_double(handler, context, formatBundle, info, args[0].doubleValue, FALSE);
+}
+
 /* HSYS */
 static int32_t
 u_printf_integer_handler(const u_printf_stream_handler  *handler,
@@ -362,8 +385,8 @@ u_printf_integer_handler(const u_printf_stream_handler  *handler,
     UChar           result[UPRINTF_BUFFER_SIZE];
     UChar           prefixBuffer[UPRINTF_BUFFER_SIZE];
     int32_t         prefixBufferLen = sizeof(prefixBuffer);
-    int32_t         minDigits     = -1;
     int32_t         resultLen;
+    UBool           isNew         = FALSE;
     UErrorCode      status        = U_ZERO_ERROR;
 
     prefixBuffer[0] = 0;
@@ -374,25 +397,31 @@ u_printf_integer_handler(const u_printf_stream_handler  *handler,
     else if (!info->fIsLongLong)
         num = (int32_t)num;
 
-    /* get the formatter */
-    format = u_locbund_getNumberFormat(formatBundle, UNUM_DECIMAL);
+    /* get the formatter, or a copy of it for this minimum # of digits and sign */
+    if(info->fPrecision == -1 && !info->fShowSign) {
+        format = u_locbund_getNumberFormat(formatBundle, UNUM_DECIMAL);
+    }
+    else {
+        format = u_locbund_getNumberFormatVariant(formatBundle, UNUM_DECIMAL,
+            u_printf_variant_key(UPRINTF_VARIANT_MIN_INTEGER_DIGITS, info), info->fPrecision, &isNew);
+    }
 
     /* handle error */
     if(format == 0)
         return 0;
 
-    /* set the appropriate flags on the formatter */
-
-    /* set the minimum integer digits */
-    if(info->fPrecision != -1) {
-        /* set the minimum # of digits */
-        minDigits = unum_getAttribute(format, UNUM_MIN_INTEGER_DIGITS);
-        unum_setAttribute(format, UNUM_MIN_INTEGER_DIGITS, info->fPrecision);
-    }
+    /* set the appropriate flags on a new copy */
+    if (isNew) {
+        /* set the minimum integer digits */
+        if(info->fPrecision != -1) {
+            /* set the minimum # of digits */
+            unum_setAttribute(format, UNUM_MIN_INTEGER_DIGITS, info->fPrecision);
+        }
 
-    /* set whether to show the sign */
-    if(info->fShowSign) {
-        u_printf_set_sign(format, info, prefixBuffer, &prefixBufferLen, &status);
+        /* set whether to show the sign */
+        if(info->fShowSign) {
+            u_printf_set_sign(format, info, prefixBuffer, &prefixBufferLen, &status);
+        }
     }
 
     /* format the number */
@@ -402,17 +431,6 @@ u_printf_integer_handler(const u_printf_stream_handler  *handler,
         resultLen = 0;
     }
 
-    /* restore the number format */
-    if (minDigits != -1) {
-        unum_setAttribute(format, UNUM_MIN_INTEGER_DIGITS, minDigits);
-    }
-
-    if (info->fShowSign) {
-        /* Reset back to original value regardless of what the error was */
-        UErrorCode localStatus = U_ZERO_ERROR;
-        u_printf_reset_sign(format, info, prefixBuffer, &prefixBufferLen, &localStatus);
-    }
-
     return handler->pad_and_justify(context, info, result, resultLen);
 }
 
@@ -497,8 +515,8 @@ u_printf_uinteger_handler(const u_printf_stream_handler *handler,
     int64_t         num        = args[0].int64Value;
     UNumberFormat   *format;
     UChar           result[UPRINTF_BUFFER_SIZE];
-    int32_t         minDigits     = -1;
     int32_t         resultLen;
+    UBool           isNew         = FALSE;
     UErrorCode      status        = U_ZERO_ERROR;
 
     /* TODO: Fix this once uint64_t can be formatted. */
@@ -507,24 +525,26 @@ u_printf_uinteger_handler(const u_printf_stream_handler *handler,
     else if (!info->fIsLongLong)
         num &= UINT32_MAX;
 
-    /* get the formatter */
-    format = u_locbund_getNumberFormat(formatBundle, UNUM_DECIMAL);
+    /* To mirror other stdio implementations, we ignore the sign argument */
+
+    /* get the formatter, or a copy of it for this minimum # of digits */
+    if(info->fPrecision == -1) {
+        format = u_locbund_getNumberFormat(formatBundle, UNUM_DECIMAL);
+    }
+    else {
+        format = u_locbund_getNumberFormatVariant(formatBundle, UNUM_DECIMAL,
+            UPRINTF_VARIANT_MIN_INTEGER_DIGITS * 4, info->fPrecision, &isNew);
+    }
 
     /* handle error */
     if(format == 0)
         return 0;
 
-    /* set the appropriate flags on the formatter */
-
-    /* set the minimum integer digits */
-    if(info->fPrecision != -1) {
-        /* set the minimum # of digits */
-        minDigits = unum_getAttribute(format, UNUM_MIN_INTEGER_DIGITS);
+    /* set the minimum integer digits on a new copy */
+    if (isNew) {
         unum_setAttribute(format, UNUM_MIN_INTEGER_DIGITS, info->fPrecision);
     }
 
-    /* To mirror other stdio implementations, we ignore the sign argument */
-
     /* format the number */
     resultLen = unum_formatInt64(format, num, result, UPRINTF_BUFFER_SIZE, 0, &status);
 
@@ -532,11 +552,6 @@ u_printf_uinteger_handler(const u_printf_stream_handler *handler,
         resultLen = 0;
     }
 
-    /* restore the number format */
-    if (minDigits != -1) {
-        unum_setAttribute(format, UNUM_MIN_INTEGER_DIGITS, minDigits);
-    }
-
     return handler->pad_and_justify(context, info, result, resultLen);
 }
 
@@ -812,8 +827,6 @@ u_printf_scidbl_handler(const u_printf_stream_handler  *handler,
     u_printf_spec_info scidbl_info;
     double      num = args[0].doubleValue;
     int32_t     retVal;
-    UNumberFormat *format;
-    int32_t maxSigDecimalDigits, significantDigits;
 
     memcpy(&scidbl_info, info, sizeof(u_printf_spec_info));
 
@@ -838,25 +851,9 @@ u_printf_scidbl_handler(const u_printf_stream_handler  *handler,
         retVal = u_printf_scientific_handler(handler, context, formatBundle, &scidbl_info, args);
     }
     else {
-        format = u_locbund_getNumberFormat(formatBundle, UNUM_DECIMAL);
-        /* Check for null pointer */
-        if (format == NULL) {
-            return 0;
-        }
-        maxSigDecimalDigits = unum_getAttribute(format, UNUM_MAX_SIGNIFICANT_DIGITS);
-        significantDigits = scidbl_info.fPrecision;
-
-        /* use 'f' notation */
+        /* use 'f' notation, with as many significant digits as the precision, or 6 */
         scidbl_info.fSpec = 0x0066;
-        if (significantDigits == -1) {
-            significantDigits = 6;
-        }
-        unum_setAttribute(format, UNUM_SIGNIFICANT_DIGITS_USED, TRUE);
-        unum_setAttribute(format, UNUM_MAX_SIGNIFICANT_DIGITS, significantDigits);
-        /* call the double handler */
-        retVal = u_printf_double_handler(handler, context, formatBundle, &scidbl_info, args);
-        unum_setAttribute(format, UNUM_MAX_SIGNIFICANT_DIGITS, maxSigDecimalDigits);
-        unum_setAttribute(format, UNUM_SIGNIFICANT_DIGITS_USED, FALSE);
+        retVal = u_printf_format_double(handler, context, formatBundle, &scidbl_info, num, TRUE);
     }
     return retVal;
 }
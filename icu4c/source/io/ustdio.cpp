@@ -279,6 +279,80 @@ ufile_close_translit(UFILE *f)
 }
 
 
+/*
+ * UTF-8 passthrough: ASCII is the same in UTF-8 and in UTF-16, so a leading run of it
+ * is copied directly between the buffers instead of going through the converter.
+ * The rest of the text goes through the converter in one call as usual.
+ * While *cnvBusy is TRUE, the converter may hold input or output from an earlier call
+ * which must come before any more text, and all of the text goes through the converter.
+ */
+
+static void
+ufile_fromUnicodeUTF8(UConverter *cnv,
+                      char **target, const char *targetLimit,
+                      const UChar **source, const UChar *sourceLimit,
+                      UBool flush, UBool *cnvBusy, UErrorCode *status)
+{
+    if (!*cnvBusy) {
+        const UChar *s = *source;
+        char *t = *target;
+        int32_t length = (int32_t)ufmt_min(sourceLimit - s, targetLimit - t);
+        int32_t i = 0;
+        while (i < length && s[i] < 0x80) {
+            t[i] = (char)s[i];
+            ++i;
+        }
+        *source += i;
+        *target += i;
+        if (*source == sourceLimit) {
+            return;
+        }
+        if (*target == targetLimit) {
+            *status = U_BUFFER_OVERFLOW_ERROR;
+            return;
+        }
+    }
+    ucnv_fromUnicode(cnv, target, targetLimit, source, sourceLimit, NULL, flush, status);
+    /* After an overflow, the converter may hold the rest of a character's bytes. */
+    *cnvBusy = U_FAILURE(*status);
+}
+
+static void
+ufile_toUnicodeUTF8(UConverter *cnv,
+                    UChar **target, const UChar *targetLimit,
+                    const char **source, const char *sourceLimit,
+                    UBool flush, UBool *cnvBusy, UErrorCode *status)
+{
+    if (!*cnvBusy) {
+        const uint8_t *s = (const uint8_t *)*source;
+        UChar *t = *target;
+        int32_t length = (int32_t)ufmt_min(sourceLimit - *source, targetLimit - t);
+        int32_t i = 0;
+        while (i < length && s[i] < 0x80) {
+            t[i] = s[i];
+            ++i;
+        }
+        *source += i;
+        *target += i;
+        if (*source == sourceLimit) {
+            return;
+        }
+        if (*target == targetLimit) {
+            *status = U_BUFFER_OVERFLOW_ERROR;
+            return;
+        }
+    }
+    ucnv_toUnicode(cnv, target, targetLimit, source, sourceLimit, NULL, flush, status);
+    /* After an overflow, the converter may hold the rest of a sequence's UChars. */
+    *cnvBusy = U_FAILURE(*status);
+}
+
+/* @return TRUE if text can be converted with ufile_fromUnicodeUTF8() and ufile_toUnicodeUTF8() */
+static inline UBool
+ufile_isUTF8(const UConverter *cnv) {
+    return cnv != NULL && ucnv_getType(cnv) == UCNV_UTF8;
+}
+
 /* Input/output */
 
 U_CAPI int32_t U_EXPORT2 /* U_CAPI ... U_EXPORT2 added by Peter Kirk 17 Nov 2001 */
@@ -322,6 +396,8 @@ u_file_write_flush(const UChar *chars,
     char        *myTarget   = charBuffer;
     int32_t     written      = 0;
     int32_t     numConverted = 0;
+    UBool       isUTF8;
+    UBool       cnvBusy      = FALSE;
 
     if (count < 0) {
         count = u_strlen(chars);
@@ -349,11 +425,26 @@ u_file_write_flush(const UChar *chars,
 
     mySourceEnd = mySource + count;
 
+    isUTF8 = ufile_isUTF8(f->fConverter);
+    if (isUTF8) {
+        /* An earlier write may have ended with a lead surrogate. */
+        cnvBusy = ucnv_fromUCountPending(f->fConverter, &status) != 0;
+    }
+
     /* Perform the conversion in a loop */
     do {
         mySourceBegin = mySource; /* beginning location for this loop */
         status     = U_ZERO_ERROR;
-        if(f->fConverter != NULL) { /* We have a valid converter */
+        if (isUTF8) {
+            ufile_fromUnicodeUTF8(f->fConverter,
+                &myTarget,
+                charBuffer + UFILE_CHARBUFFER_SIZE,
+                &mySource,
+                mySourceEnd,
+                flushIO,
+                &cnvBusy,
+                &status);
+        } else if(f->fConverter != NULL) { /* We have a valid converter */
             ucnv_fromUnicode(f->fConverter,
                 &myTarget,
                 charBuffer + UFILE_CHARBUFFER_SIZE,
@@ -415,6 +506,8 @@ ufile_fill_uchar_buffer(UFILE *f)
     int32_t     dataSize;
     char        charBuffer[UFILE_CHARBUFFER_SIZE];
     u_localized_string *str;
+    UBool       isUTF8;
+    UBool       cnvBusy;
 
     if (f->fFile == NULL) {
         /* There is nothing to do. It's a string. */
@@ -439,7 +532,9 @@ ufile_fill_uchar_buffer(UFILE *f)
 
     /* Determine the # of codepage bytes needed to fill our UChar buffer */
     /* weiv: if converter is NULL, we use invariant converter with charwidth = 1)*/
-    maxCPBytes = availLength / (f->fConverter!=NULL?(2*ucnv_getMinCharSize(f->fConverter)):1);
+    /* Each UTF-8 byte yields at most one UChar. */
+    isUTF8 = ufile_isUTF8(f->fConverter);
+    maxCPBytes = availLength / (f->fConverter!=NULL && !isUTF8?(2*ucnv_getMinCharSize(f->fConverter)):1);
 
     /* Read in the data to convert */
     if (f->fFileno == 0) {
@@ -462,7 +557,30 @@ ufile_fill_uchar_buffer(UFILE *f)
     myTarget    = f->fUCBuffer + dataSize;
     bufferSize  = UFILE_UCHARBUFFER_SIZE;
 
-    if(f->fConverter != NULL) { /* We have a valid converter */
+    if (isUTF8) {
+        /*
+         * Output any UChars that did not fit into the previous buffer.
+         * The previous bytes may also have ended with an incomplete sequence.
+         */
+        ucnv_toUnicode(f->fConverter,
+            &myTarget,
+            f->fUCBuffer + bufferSize,
+            &mySource,
+            mySource,
+            NULL,
+            FALSE,
+            &status);
+        cnvBusy = U_FAILURE(status) || ucnv_toUCountPending(f->fConverter, &status) != 0;
+        status = U_ZERO_ERROR;
+        ufile_toUnicodeUTF8(f->fConverter,
+            &myTarget,
+            f->fUCBuffer + bufferSize,
+            &mySource,
+            mySourceEnd,
+            (UBool)(feof(f->fFile) != 0),
+            &cnvBusy,
+            &status);
+    } else if(f->fConverter != NULL) { /* We have a valid converter */
         /* Perform the conversion */
         ucnv_toUnicode(f->fConverter,
             &myTarget,
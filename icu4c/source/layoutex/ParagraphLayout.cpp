@@ -1100,9 +1100,13 @@ void ParagraphLayout::appendRun(ParagraphLayout::Line *line, le_int32 run, le_in
 
     UBiDiDirection direction  = ((fStyleRunInfo[run].level & 1) == 0)? UBIDI_LTR : UBIDI_RTL;
     le_int32   glyphCount     = rightGlyph - leftGlyph;
-    LEGlyphID *glyphs         = LE_NEW_ARRAY(LEGlyphID, glyphCount);
-    float     *positions      = LE_NEW_ARRAY(float, glyphCount * 2 + 2);
-    le_int32  *glyphToCharMap = LE_NEW_ARRAY(le_int32, glyphCount);
+
+    // The glyphs, positions and character indices of the run share one block,
+    // which the VisualRun frees through its glyph array.
+    le_int32  *runStorage     = LE_NEW_ARRAY(le_int32, glyphCount * 4 + 2);
+    LEGlyphID *glyphs         = (LEGlyphID *) runStorage;
+    float     *positions      = (float *) (runStorage + glyphCount);
+    le_int32  *glyphToCharMap = runStorage + glyphCount * 3 + 2;
 
     LE_ARRAY_COPY(glyphs, &fStyleRunInfo[run].glyphs[leftGlyph], glyphCount);
 
@@ -1140,17 +1144,21 @@ le_int32 ParagraphLayout::getCharRun(le_int32 charIndex)
         return -1;
     }
 
-    le_int32 run;
+    // Binary search for the first run whose limit is after charIndex.
+    le_int32 start = 0;
+    le_int32 limit = fStyleRunCount;
 
-    // NOTE: as long as fStyleRunLimits is well-formed
-    // the above range check guarantees that we'll never
-    // fall off the end of the array.
-    run = 0;
-    while (charIndex >= fStyleRunLimits[run]) {
-        run += 1;
+    while (start < limit) {
+        le_int32 run = (start + limit) / 2;
+
+        if (charIndex >= fStyleRunLimits[run]) {
+            start = run + 1;
+        } else {
+            limit = run;
+        }
     }
 
-    return run;
+    return start;
 }
 
 
@@ -1270,8 +1278,8 @@ const char ParagraphLayout::VisualRun::fgClassID = 0;
 
 ParagraphLayout::VisualRun::~VisualRun()
 {
-    LE_DELETE_ARRAY(fGlyphToCharMap);
-    LE_DELETE_ARRAY(fPositions);
+    // fPositions and fGlyphToCharMap are in the same block as fGlyphs;
+    // see ParagraphLayout::appendRun().
     LE_DELETE_ARRAY(fGlyphs);
 }
 
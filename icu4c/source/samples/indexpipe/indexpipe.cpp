@@ -0,0 +1,396 @@
+/*************************************************************************
+*
+*   © 2019 and later: Unicode, Inc. and others.
+*   License & terms of use: http://www.unicode.org/copyright.html#License
+*
+**************************************************************************
+*/
+
+//
+//   indexpipe  - an ICU sample program showing how to chain the steps of a
+//                search indexer without materializing the whole document
+//                after each step:
+//
+//                  charset conversion   ucnv_toUnicode()
+//                  normalization and    Normalizer2, NFKC_Casefold, which does
+//                    case folding         both in a single pass
+//                  word breaking        BreakIterator
+//                  sort keys            Collator::getSortKey()
+//
+//            Each document is read and converted a few kilobytes at a time.
+//            Converted text is cut at a space before a character that starts
+//            a new normalization segment, and only that piece is folded,
+//            broken into words and turned into sort keys before more input
+//            is read, so the working set stays small and all of the buffers
+//            are reused from one piece to the next.
+//
+//            With -t, documents are processed on several threads. The
+//            converter, break iterator and collator are not thread-safe, so
+//            each thread opens its own converter and clones the break
+//            iterator and collator; the Normalizer2 instance is shared.
+//
+//            For each document the program prints the number of words and
+//            a hash of their sort keys, which does not depend on the number
+//            of threads.
+//
+
+#include <atomic>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <thread>
+#include <vector>
+
+#include "unicode/utypes.h"
+#include "unicode/brkiter.h"
+#include "unicode/coll.h"
+#include "unicode/normalizer2.h"
+#include "unicode/ucnv.h"
+#include "unicode/uchar.h"
+#include "unicode/uclean.h"
+#include "unicode/unistr.h"
+#include "unicode/utf16.h"
+
+using namespace icu;
+
+//
+//  Sizes of the input and text buffers. Text is processed in pieces of at
+//  most kTextCapacity code units; a single word longer than that is split.
+//
+static const int32_t kByteCapacity = 4096;
+static const int32_t kTextCapacity = 4096;
+
+//
+//  Documents used when no files are given on the command line, in UTF-8.
+//
+static const char *sampleDocuments[] = {
+    "The quick brown fox jumps over the lazy dog.\n"
+    "THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG.\n",
+    "Stra\xC3\x9F" "e, STRASSE und Stra\xC3\x9F" "enbahn.\n"
+    "Die \xEF\xAC\x81" "nale Fassung: ca\xCC\x81" "fe\xCC\x81 oder caf\xC3\xA9?\n",
+    "\xEF\xBC\xA9\xEF\xBC\xA3\xEF\xBC\xB5 \xE3\x81\xAF Unicode \xE3\x81\xAE"
+    "\xE3\x83\xA9\xE3\x82\xA4\xE3\x83\x96\xE3\x83\xA9\xE3\x83\xAA\xE3\x81\xA7"
+    "\xE3\x81\x99\xE3\x80\x82\n",
+};
+
+
+//
+//  Where the bytes of a document come from: a file, or a string in memory.
+//
+class DocumentSource {
+public:
+    DocumentSource(const char *fileName) : fName(fileName), fFile(NULL), fBytes(NULL), fLength(0) {}
+    DocumentSource(const char *bytes, int32_t length) :
+            fName(NULL), fFile(NULL), fBytes(bytes), fLength(length) {}
+    ~DocumentSource() {
+        if (fFile != NULL) {
+            fclose(fFile);
+        }
+    }
+
+    UBool open() {
+        if (fName != NULL) {
+            fFile = fopen(fName, "rb");
+            return fFile != NULL;
+        }
+        return TRUE;
+    }
+
+    // Reads up to capacity bytes. Returns 0 at the end of the document.
+    int32_t read(char *dest, int32_t capacity) {
+        if (fFile != NULL) {
+            return (int32_t)fread(dest, 1, capacity, fFile);
+        }
+        int32_t length = fLength < capacity ? fLength : capacity;
+        memcpy(dest, fBytes, length);
+        fBytes += length;
+        fLength -= length;
+        return length;
+    }
+
+private:
+    const char *fName;
+    FILE       *fFile;
+    const char *fBytes;
+    int32_t     fLength;
+};
+
+struct DocumentResult {
+    int32_t    words;
+    uint32_t   hash;
+    UErrorCode status;
+};
+
+
+//
+//  The engines and buffers used by one thread.
+//
+class Pipeline {
+public:
+    Pipeline(const char *charset, const BreakIterator &words, const Collator &collator,
+             UErrorCode &status);
+    ~Pipeline();
+
+    void process(DocumentSource &source, DocumentResult &result);
+
+private:
+    int32_t findCut(int32_t length) const;
+    void processText(int32_t length, DocumentResult &result, UErrorCode &status);
+
+    UConverter        *fConverter;
+    BreakIterator     *fWords;
+    Collator          *fCollator;
+    const Normalizer2 *fFolding;
+
+    char               fBytes[kByteCapacity];
+    UChar              fText[kTextCapacity];
+    UnicodeString      fFolded;
+    std::vector<uint8_t> fSortKey;
+};
+
+Pipeline::Pipeline(const char *charset, const BreakIterator &words, const Collator &collator,
+                   UErrorCode &status) :
+        fConverter(NULL), fWords(NULL), fCollator(NULL), fFolding(NULL), fSortKey(64) {
+    fConverter = ucnv_open(charset, &status);
+    fWords = words.clone();
+    fCollator = collator.clone();
+    fFolding = Normalizer2::getNFKCCasefoldInstance(status);
+    if (U_SUCCESS(status) && (fWords == NULL || fCollator == NULL)) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+    }
+}
+
+Pipeline::~Pipeline() {
+    ucnv_close(fConverter);
+    delete fWords;
+    delete fCollator;
+}
+
+//
+//  Returns the length of the longest prefix of fText[0..length) that can be
+//  processed on its own: it ends after white space, and the following
+//  character neither combines with the text before it during normalization
+//  nor attaches to it during word breaking. Returns 0 if there is none.
+//
+int32_t Pipeline::findCut(int32_t length) const {
+    for (int32_t i = length; i > 0;) {
+        UChar32 c;
+        U16_PREV(fText, 0, i, c);
+        int8_t type = u_charType(c);
+        UBool attaches = type == U_NON_SPACING_MARK || type == U_ENCLOSING_MARK ||
+                         type == U_COMBINING_SPACING_MARK || type == U_FORMAT_CHAR;
+        if (i > 0 && u_isUWhiteSpace(fText[i - 1]) && !u_isUWhiteSpace(c) &&
+                !attaches && fFolding->hasBoundaryBefore(c)) {
+            return i;
+        }
+    }
+    return 0;
+}
+
+//
+//  Folds, breaks and collates fText[0..length).
+//
+void Pipeline::processText(int32_t length, DocumentResult &result, UErrorCode &status) {
+    // Read-only alias, no copy.
+    const UnicodeString piece(FALSE, fText, length);
+    fFolding->normalize(piece, fFolded, status);
+    if (U_FAILURE(status)) {
+        return;
+    }
+
+    fWords->setText(fFolded);
+    const UChar *folded = fFolded.getBuffer();
+    int32_t start = fWords->first();
+    for (int32_t limit = fWords->next(); limit != BreakIterator::DONE;
+            start = limit, limit = fWords->next()) {
+        if (fWords->getRuleStatus() < UBRK_WORD_NONE_LIMIT) {
+            continue;  // Spaces and punctuation.
+        }
+        int32_t keyLength = fCollator->getSortKey(folded + start, limit - start,
+                                                  &fSortKey[0], (int32_t)fSortKey.size());
+        if (keyLength > (int32_t)fSortKey.size()) {
+            fSortKey.resize(keyLength);
+            keyLength = fCollator->getSortKey(folded + start, limit - start,
+                                              &fSortKey[0], keyLength);
+        }
+        if (keyLength == 0) {
+            status = U_INTERNAL_PROGRAM_ERROR;
+            return;
+        }
+        // FNV-1a over the sort keys, including their terminating zero bytes.
+        for (int32_t i = 0; i < keyLength; ++i) {
+            result.hash = (result.hash ^ fSortKey[i]) * 16777619u;
+        }
+        ++result.words;
+    }
+}
+
+void Pipeline::process(DocumentSource &source, DocumentResult &result) {
+    result.words = 0;
+    result.hash = 2166136261u;
+    result.status = U_ZERO_ERROR;
+    UErrorCode &status = result.status;
+    if (!source.open()) {
+        status = U_FILE_ACCESS_ERROR;
+        return;
+    }
+    ucnv_reset(fConverter);
+
+    int32_t textLength = 0;
+    const char *bytes = fBytes;
+    const char *bytesLimit = fBytes;
+    UBool flush = FALSE;
+    for (;;) {
+        if (bytes == bytesLimit && !flush) {
+            int32_t length = source.read(fBytes, kByteCapacity);
+            bytes = fBytes;
+            bytesLimit = fBytes + length;
+            flush = length == 0;
+        }
+
+        UChar *target = fText + textLength;
+        ucnv_toUnicode(fConverter, &target, fText + kTextCapacity,
+                       &bytes, bytesLimit, NULL, flush, &status);
+        textLength = (int32_t)(target - fText);
+        UBool full = status == U_BUFFER_OVERFLOW_ERROR;
+        if (full) {
+            status = U_ZERO_ERROR;
+        } else if (U_FAILURE(status)) {
+            return;
+        }
+
+        UBool done = flush && !full;
+        if (done || textLength == kTextCapacity) {
+            int32_t cut = done ? textLength : findCut(textLength);
+            if (cut == 0) {
+                cut = textLength;  // One word fills the buffer.
+            }
+            processText(cut, result, status);
+            if (U_FAILURE(status)) {
+                return;
+            }
+            textLength -= cut;
+            memmove(fText, fText + cut, textLength * U_SIZEOF_UCHAR);
+        }
+        if (done) {
+            return;
+        }
+    }
+}
+
+
+//
+//  Command line options.
+//
+static const char *charset = "UTF-8";
+static const char *localeID = "";
+static int32_t     threadCount = 1;
+
+static void printUsage() {
+    fprintf(stderr,
+        "indexpipe [-c charset] [-l locale] [-t threads] [file ...]\n"
+        "   Prints the number of words in each file, and a hash of their\n"
+        "   case-folded sort keys. Without files, uses built-in text.\n");
+    exit(1);
+}
+
+
+int main(int argc, const char **argv) {
+    int argNum;
+    for (argNum = 1; argNum < argc && argv[argNum][0] == '-'; ++argNum) {
+        const char *arg = argv[argNum];
+        if (argNum + 1 >= argc) {
+            printUsage();
+        }
+        if (strcmp(arg, "-c") == 0) {
+            charset = argv[++argNum];
+        } else if (strcmp(arg, "-l") == 0) {
+            localeID = argv[++argNum];
+        } else if (strcmp(arg, "-t") == 0) {
+            threadCount = atoi(argv[++argNum]);
+            if (threadCount < 1) {
+                printUsage();
+            }
+        } else {
+            printUsage();
+        }
+    }
+
+    std::vector<const char *> names;
+    std::vector<DocumentSource *> sources;
+    if (argNum < argc) {
+        for (; argNum < argc; ++argNum) {
+            names.push_back(argv[argNum]);
+            sources.push_back(new DocumentSource(argv[argNum]));
+        }
+    } else {
+        charset = "UTF-8";
+        for (size_t i = 0; i < sizeof(sampleDocuments) / sizeof(sampleDocuments[0]); ++i) {
+            names.push_back("<sample>");
+            sources.push_back(new DocumentSource(sampleDocuments[i],
+                                                 (int32_t)strlen(sampleDocuments[i])));
+        }
+    }
+
+    //  Prototype engines, cloned by each thread.
+    UErrorCode status = U_ZERO_ERROR;
+    Locale locale(localeID);
+    BreakIterator *words = BreakIterator::createWordInstance(locale, status);
+    Collator *collator = Collator::createInstance(locale, status);
+    if (U_FAILURE(status)) {
+        fprintf(stderr, "indexpipe: unable to create the break iterator or collator: %s\n",
+                u_errorName(status));
+        return 1;
+    }
+
+    std::vector<DocumentResult> results(sources.size());
+    std::atomic<int32_t> nextDocument(0);
+    std::atomic<int32_t> failures(0);
+    auto worker = [&]() {
+        UErrorCode workerStatus = U_ZERO_ERROR;
+        Pipeline pipeline(charset, *words, *collator, workerStatus);
+        if (U_FAILURE(workerStatus)) {
+            fprintf(stderr, "indexpipe: unable to set up the pipeline: %s\n",
+                    u_errorName(workerStatus));
+            ++failures;
+            return;
+        }
+        int32_t i;
+        while ((i = nextDocument++) < (int32_t)sources.size()) {
+            pipeline.process(*sources[i], results[i]);
+        }
+    };
+
+    if (threadCount == 1) {
+        worker();
+    } else {
+        std::vector<std::thread> threads;
+        for (int32_t i = 0; i < threadCount; ++i) {
+            threads.push_back(std::thread(worker));
+        }
+        for (size_t i = 0; i < threads.size(); ++i) {
+            threads[i].join();
+        }
+    }
+
+    int exitCode = failures == 0 ? 0 : 1;
+    if (exitCode == 0) {
+        for (size_t i = 0; i < results.size(); ++i) {
+            if (U_FAILURE(results[i].status)) {
+                fprintf(stderr, "%s: %s\n", names[i], u_errorName(results[i].status));
+                exitCode = 1;
+            } else {
+                printf("%s: %d words, sort key hash %08x\n",
+                       names[i], (int)results[i].words, (unsigned)results[i].hash);
+            }
+        }
+    }
+
+    for (size_t i = 0; i < sources.size(); ++i) {
+        delete sources[i];
+    }
+    delete words;
+    delete collator;
+    u_cleanup();
+    return exitCode;
+}
@@ -37,6 +37,7 @@ void addUStringPrepTest(TestNode** root);
 void addIDNATest(TestNode** root);
 void addHeapMutexTest(TestNode **root);
 void addUTraceTest(TestNode** root);
+void addUCacheTest(TestNode** root);
 void addURegexTest(TestNode** root);
 void addUTextTest(TestNode** root);
 void addUCsdetTest(TestNode** root);
@@ -55,6 +56,7 @@ void addAllTests(TestNode** root)
     addUTF8Test(root);
     addUtility(root);
     addUTraceTest(root);
+    addUCacheTest(root);
     addUTextTest(root);
     addConvert(root);
     addUCharTransformTest(root);
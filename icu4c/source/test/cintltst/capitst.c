@@ -90,6 +90,12 @@ void addCollAPITest(TestNode** root)
     addTest(root, &TestBengaliSortKey, "tscoll/capitst/TestBengaliSortKey");
     addTest(root, &TestGetKeywordValuesForLocale, "tscoll/capitst/TestGetKeywordValuesForLocale");
     addTest(root, &TestStrcollNull, "tscoll/capitst/TestStrcollNull");
+    addTest(root, &TestSortKeyUTF8, "tscoll/capitst/TestSortKeyUTF8");
+    addTest(root, &TestSortKeys, "tscoll/capitst/TestSortKeys");
+    addTest(root, &TestSortStrings, "tscoll/capitst/TestSortStrings");
+    addTest(root, &TestSortStringsWithExecutor, "tscoll/capitst/TestSortStringsWithExecutor");
+    addTest(root, &TestCollationProbe, "tscoll/capitst/TestCollationProbe");
+    addTest(root, &TestCollatorView, "tscoll/capitst/TestCollatorView");
 }
 
 void TestGetSetAttr(void) {
@@ -2565,4 +2571,398 @@ static void TestStrcollNull(void) {
     ucol_close(coll);
 }
 
+static void TestSortKeyUTF8(void) {
+    static const char *const locales[] = { "root", "de", "sv", "ja" };
+    static const char *const strings[] = {
+        "", "abc", "ABC", "a very Merry liTTle-lamB..", "co-op 123",
+        "\xC3\xA4pfel", "a\xCC\x88pfel", "\xC3\x85ngstr\xC3\xB6m", "stra\xC3\x9F" "e",
+        "\xE6\xBC\xA2\xE5\xAD\x97", "\xE3\x81\x8B\xE3\x82\x99", "\xF0\x9F\x98\x80!",
+        "bad\xFFutf8"
+    };
+    static const UColAttributeValue strengths[] = {
+        UCOL_PRIMARY, UCOL_SECONDARY, UCOL_TERTIARY, UCOL_QUATERNARY, UCOL_IDENTICAL
+    };
+    int32_t i, j, k;
+    for (i = 0; i < UPRV_LENGTHOF(locales); ++i) {
+        UErrorCode status = U_ZERO_ERROR;
+        UCollator *coll = ucol_open(locales[i], &status);
+        if (U_FAILURE(status)) {
+            log_data_err("ucol_open(%s) failed - %s\n", locales[i], u_errorName(status));
+            continue;
+        }
+        for (k = 0; k < UPRV_LENGTHOF(strengths); ++k) {
+            ucol_setStrength(coll, strengths[k]);
+            ucol_setAttribute(coll, UCOL_NORMALIZATION_MODE, (k & 1) ? UCOL_ON : UCOL_OFF, &status);
+            ucol_setAttribute(coll, UCOL_NUMERIC_COLLATION, (k == 2) ? UCOL_ON : UCOL_OFF, &status);
+            for (j = 0; j < UPRV_LENGTHOF(strings); ++j) {
+                UChar s16[64];
+                uint8_t key16[256], key8[256];
+                int32_t length16, keyLength16, keyLength8, preflightLength;
+                int32_t length8 = (int32_t)uprv_strlen(strings[j]);
+                u_strFromUTF8WithSub(s16, UPRV_LENGTHOF(s16), &length16, strings[j], length8,
+                                     0xfffd, NULL, &status);
+                if (U_FAILURE(status)) {
+                    log_err("u_strFromUTF8WithSub(string %d) failed - %s\n", j, u_errorName(status));
+                    status = U_ZERO_ERROR;
+                    continue;
+                }
+                keyLength16 = ucol_getSortKey(coll, s16, length16, key16, UPRV_LENGTHOF(key16));
+                keyLength8 = ucol_getSortKeyUTF8(coll, strings[j], length8,
+                                                 key8, UPRV_LENGTHOF(key8), &status);
+                if (U_FAILURE(status) || keyLength8 != keyLength16 ||
+                        uprv_memcmp(key8, key16, keyLength16) != 0) {
+                    log_err("ucol_getSortKeyUTF8(%s, strength %d, string %d) differs from "
+                            "ucol_getSortKey() - %s\n",
+                            locales[i], (int)strengths[k], j, u_errorName(status));
+                }
+                preflightLength = ucol_getSortKeyUTF8(coll, strings[j], -1, NULL, 0, &status);
+                if (U_FAILURE(status) || preflightLength != keyLength16) {
+                    log_err("ucol_getSortKeyUTF8(%s, strength %d, string %d, NUL-terminated) "
+                            "preflight length %d != %d - %s\n",
+                            locales[i], (int)strengths[k], j, (int)preflightLength,
+                            (int)keyLength16, u_errorName(status));
+                }
+                status = U_ZERO_ERROR;
+            }
+        }
+        ucol_close(coll);
+    }
+}
+
+static void TestSortKeys(void) {
+    static const char *const strings8[] = {
+        "abc", "", "ABC", "\xC3\xA4pfel", "\xE6\xBC\xA2\xE5\xAD\x97", "co-op 123"
+    };
+    enum { COUNT = UPRV_LENGTHOF(strings8) };
+    UChar buffers16[COUNT][16];
+    const UChar *strings16[COUNT];
+    int32_t lengths[COUNT];
+    int32_t offsets[COUNT + 1], offsets8[COUNT + 1];
+    uint8_t keys[512], keys8[512], key[64];
+    int32_t i, total, total8, keyLength;
+    UErrorCode status = U_ZERO_ERROR;
+    UCollator *coll = ucol_open("de", &status);
+    if (U_FAILURE(status)) {
+        log_data_err("ucol_open(de) failed - %s\n", u_errorName(status));
+        return;
+    }
+    for (i = 0; i < COUNT; ++i) {
+        u_strFromUTF8(buffers16[i], UPRV_LENGTHOF(buffers16[i]), &lengths[i],
+                      strings8[i], -1, &status);
+        strings16[i] = buffers16[i];
+    }
+
+    total = ucol_getSortKeys(coll, strings16, lengths, COUNT,
+                             keys, UPRV_LENGTHOF(keys), offsets, &status);
+    if (U_FAILURE(status) || offsets[0] != 0 || offsets[COUNT] != total) {
+        log_err("ucol_getSortKeys() failed or bad offsets - %s\n", u_errorName(status));
+        ucol_close(coll);
+        return;
+    }
+    for (i = 0; i < COUNT; ++i) {
+        keyLength = ucol_getSortKey(coll, strings16[i], lengths[i], key, UPRV_LENGTHOF(key));
+        if (keyLength != offsets[i + 1] - offsets[i] ||
+                uprv_memcmp(key, keys + offsets[i], keyLength) != 0) {
+            log_err("ucol_getSortKeys() key %d differs from ucol_getSortKey()\n", i);
+        }
+    }
+
+    /* UTF-8 input, NUL-terminated, must give the same keys. */
+    total8 = ucol_getSortKeysUTF8(coll, strings8, NULL, COUNT,
+                                  keys8, UPRV_LENGTHOF(keys8), offsets8, &status);
+    if (U_FAILURE(status) || total8 != total ||
+            uprv_memcmp(offsets8, offsets, sizeof(offsets)) != 0 ||
+            uprv_memcmp(keys8, keys, total) != 0) {
+        log_err("ucol_getSortKeysUTF8() differs from ucol_getSortKeys() - %s\n",
+                u_errorName(status));
+    }
+
+    /* Preflighting and a buffer that is too small. */
+    total8 = ucol_getSortKeysUTF8(coll, strings8, NULL, COUNT, NULL, 0, offsets8, &status);
+    if (status != U_BUFFER_OVERFLOW_ERROR || total8 != total ||
+            uprv_memcmp(offsets8, offsets, sizeof(offsets)) != 0) {
+        log_err("ucol_getSortKeysUTF8() preflighting: %d != %d - %s\n",
+                (int)total8, (int)total, u_errorName(status));
+    }
+    status = U_ZERO_ERROR;
+    total8 = ucol_getSortKeys(coll, strings16, lengths, COUNT, keys8, offsets[2], offsets8, &status);
+    if (status != U_BUFFER_OVERFLOW_ERROR || total8 != total ||
+            uprv_memcmp(keys8, keys, offsets[2]) != 0) {
+        log_err("ucol_getSortKeys() overflow: %d != %d - %s\n",
+                (int)total8, (int)total, u_errorName(status));
+    }
+
+    status = U_ZERO_ERROR;
+    ucol_getSortKeys(coll, strings16, lengths, COUNT, keys, UPRV_LENGTHOF(keys), NULL, &status);
+    if (status != U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("ucol_getSortKeys(offsets=NULL) should fail - %s\n", u_errorName(status));
+    }
+    ucol_close(coll);
+}
+
+static void TestSortStrings(void) {
+    /* Several strings share long sort key prefixes, to exercise the full comparison. */
+    static const char *const input[] = {
+        "peach", "p\xC3\xA9" "ch\xC3\xA9", "internationalization", "Peach", "",
+        "internationalisation", "p\xC3\xA9" "che", "internationalization", "apple", "international"
+    };
+    enum { COUNT = UPRV_LENGTHOF(input) };
+    const char *strings8[COUNT];
+    const UChar *strings16[COUNT];
+    UChar buffers16[COUNT][32];
+    int32_t lengths[COUNT];
+    int32_t i;
+    UErrorCode status = U_ZERO_ERROR;
+    UCollator *coll = ucol_open("fr_CA", &status);
+    if (U_FAILURE(status)) {
+        log_data_err("ucol_open(fr_CA) failed - %s\n", u_errorName(status));
+        return;
+    }
+    for (i = 0; i < COUNT; ++i) {
+        strings8[i] = input[i];
+        u_strFromUTF8(buffers16[i], UPRV_LENGTHOF(buffers16[i]), &lengths[i], input[i], -1, &status);
+        strings16[i] = buffers16[i];
+    }
+
+    ucol_sortStrings(coll, strings16, lengths, COUNT, NULL, NULL, &status);
+    if (U_FAILURE(status)) {
+        log_err("ucol_sortStrings() failed - %s\n", u_errorName(status));
+    } else {
+        for (i = 1; i < COUNT; ++i) {
+            if (ucol_strcoll(coll, strings16[i - 1], lengths[i - 1], strings16[i], -1) == UCOL_GREATER ||
+                    lengths[i] != u_strlen(strings16[i])) {
+                log_err("ucol_sortStrings(): strings %d and %d out of order\n", (int)i - 1, (int)i);
+            }
+        }
+    }
+
+    ucol_sortStringsUTF8(coll, strings8, NULL, COUNT, NULL, NULL, &status);
+    if (U_FAILURE(status)) {
+        log_err("ucol_sortStringsUTF8() failed - %s\n", u_errorName(status));
+    } else {
+        for (i = 0; i < COUNT; ++i) {
+            char s8[64];
+            u_strToUTF8(s8, UPRV_LENGTHOF(s8), NULL, strings16[i], -1, &status);
+            if (uprv_strcmp(s8, strings8[i]) != 0) {
+                log_err("ucol_sortStringsUTF8() [%d]=%s but ucol_sortStrings() gives %s\n",
+                        (int)i, strings8[i], s8);
+            }
+        }
+        /* Equal strings keep their input order. */
+        if (strings8[4] != input[2] || strings8[5] != input[7]) {
+            log_err("ucol_sortStringsUTF8() did not keep equal strings in input order\n");
+        }
+    }
+    ucol_close(coll);
+}
+
+static void U_CALLCONV countingSortExecutor(const void *context, UCollationSortTask *task) {
+    ++*(int32_t *)context;
+    ucol_runSortTask(task);
+}
+
+static void TestSortStringsWithExecutor(void) {
+    static const char *const words[] = {
+        "peach", "p\xC3\xA9" "ch\xC3\xA9", "Peach", "p\xC3\xA9" "che", "internationalization", "apple"
+    };
+    /* Enough strings for several runs that are sorted separately and then merged. */
+    enum { COUNT = 3000 };
+    char (*buffers)[32] = (char (*)[32])uprv_malloc(COUNT * 32);
+    const char **sequential = (const char **)uprv_malloc(COUNT * sizeof(const char *));
+    const char **parallel = (const char **)uprv_malloc(COUNT * sizeof(const char *));
+    int32_t taskCount = 0;
+    int32_t i;
+    UErrorCode status = U_ZERO_ERROR;
+    UCollator *coll = ucol_open("fr_CA", &status);
+    if (U_FAILURE(status)) {
+        log_data_err("ucol_open(fr_CA) failed - %s\n", u_errorName(status));
+    } else if (buffers == NULL || sequential == NULL || parallel == NULL) {
+        log_err("out of memory\n");
+    } else {
+        for (i = 0; i < COUNT; ++i) {
+            /* Many duplicates, to check that equal strings keep their input order. */
+            sprintf(buffers[i], "%s %d", words[i % UPRV_LENGTHOF(words)], (int)((i * 7919) % 500));
+            sequential[i] = parallel[i] = buffers[i];
+        }
+        ucol_sortStringsUTF8(coll, sequential, NULL, COUNT, NULL, NULL, &status);
+        ucol_sortStringsUTF8(coll, parallel, NULL, COUNT, countingSortExecutor, &taskCount, &status);
+        if (U_FAILURE(status)) {
+            log_err("ucol_sortStringsUTF8() failed - %s\n", u_errorName(status));
+        } else {
+            if (taskCount <= 1) {
+                log_err("ucol_sortStringsUTF8() with an executor ran %d tasks\n", (int)taskCount);
+            }
+            for (i = 0; i < COUNT; ++i) {
+                if (parallel[i] != sequential[i]) {
+                    log_err("ucol_sortStringsUTF8() with an executor: [%d]=%s but %s without\n",
+                            (int)i, parallel[i], sequential[i]);
+                    break;
+                }
+            }
+        }
+    }
+    ucol_close(coll);
+    uprv_free(buffers);
+    uprv_free(sequential);
+    uprv_free(parallel);
+}
+
+static void TestCollationProbe(void) {
+    static const char *const locales[] = { "root", "fr_CA", "ja", "hr", "th" };
+    static const char *const strings[] = {
+        "", "a", "A", "ab", "a-b", "a b", "ab-", "co-op", "coop", "C\xC3\xB4t\xC3\xA9", "cote",
+        "c\xC3\xB4te", "a10", "a9", "\xE3\x81\x8B", "\xE3\x82\xAB", "\xE3\x81\x8B\xE3\x82\x99",
+        "d\xC5\xBE", "dz\xCC\x8C", "\xE0\xB9\x80\xE0\xB8\x81", "\xF0\x9F\x98\x80"
+    };
+    enum { COUNT = UPRV_LENGTHOF(strings) };
+    UChar strings16[COUNT][16];
+    int32_t i, j, k, round;
+    UErrorCode status = U_ZERO_ERROR;
+    for (i = 0; i < COUNT; ++i) {
+        u_strFromUTF8(strings16[i], UPRV_LENGTHOF(strings16[i]), NULL, strings[i], -1, &status);
+    }
+    for (k = 0; k < UPRV_LENGTHOF(locales); ++k) {
+        UCollator *coll = ucol_open(locales[k], &status);
+        if (U_FAILURE(status)) {
+            log_data_err("ucol_open(%s) failed - %s\n", locales[k], u_errorName(status));
+            return;
+        }
+        for (round = 0; round < 4; ++round) {
+            /* Vary the attributes that change the CE comparison. */
+            ucol_setAttribute(coll, UCOL_ALTERNATE_HANDLING,
+                              (round & 1) ? UCOL_SHIFTED : UCOL_NON_IGNORABLE, &status);
+            ucol_setAttribute(coll, UCOL_NUMERIC_COLLATION, (round == 1) ? UCOL_ON : UCOL_OFF, &status);
+            ucol_setStrength(coll, (round == 3) ? UCOL_IDENTICAL :
+                                   (round == 1) ? UCOL_QUATERNARY : UCOL_TERTIARY);
+            ucol_setAttribute(coll, UCOL_CASE_FIRST, (round == 2) ? UCOL_UPPER_FIRST : UCOL_OFF, &status);
+            for (i = 0; i < COUNT; ++i) {
+                UCollationProbe *probe = ucol_openProbe(coll, strings16[i], -1, &status);
+                if (U_FAILURE(status)) {
+                    log_err("ucol_openProbe(%s, %d) failed - %s\n", locales[k], (int)i, u_errorName(status));
+                    ucol_close(coll);
+                    return;
+                }
+                for (j = 0; j < COUNT; ++j) {
+                    UCollationResult expected = ucol_strcoll(coll, strings16[i], -1, strings16[j], -1);
+                    UCollationResult actual = ucol_compareProbe(probe, strings16[j], -1, &status);
+                    UCollationResult actual8 = ucol_compareProbeUTF8(probe, strings[j], -1, &status);
+                    if (U_FAILURE(status) || actual != expected || actual8 != expected) {
+                        log_err("%s round %d: probe %d vs. %d gives %d/%d, expected %d - %s\n",
+                                locales[k], (int)round, (int)i, (int)j,
+                                (int)actual, (int)actual8, (int)expected, u_errorName(status));
+                        status = U_ZERO_ERROR;
+                    }
+                }
+                ucol_closeProbe(probe);
+            }
+        }
+        ucol_close(coll);
+    }
+}
+
+static void TestCollatorView(void) {
+    static const char *const locales[] = { "root", "fr_CA", "de" };
+    static const char *const strings[] = {
+        "", "a", "A", "ab", "a-b", "a b", "co-op", "coop", "C\xC3\xB4t\xC3\xA9", "cote",
+        "c\xC3\xB4te", "a10", "a9", "\xCE\xB1", "\xD0\xB0", "\xE3\x81\x8B"
+    };
+    enum { COUNT = UPRV_LENGTHOF(strings) };
+    static const int32_t greek[] = { USCRIPT_GREEK };
+    UChar strings16[COUNT][16];
+    int32_t i, j, k, round;
+    UErrorCode status = U_ZERO_ERROR;
+    for (i = 0; i < COUNT; ++i) {
+        u_strFromUTF8(strings16[i], UPRV_LENGTHOF(strings16[i]), NULL, strings[i], -1, &status);
+    }
+    for (k = 0; k < UPRV_LENGTHOF(locales); ++k) {
+        UCollator *coll = ucol_open(locales[k], &status);
+        if (U_FAILURE(status)) {
+            log_data_err("ucol_open(%s) failed - %s\n", locales[k], u_errorName(status));
+            return;
+        }
+        if (k == 2) {
+            /* The view aliases the reordering arrays that the collator owns. */
+            ucol_setReorderCodes(coll, greek, UPRV_LENGTHOF(greek), &status);
+        }
+        for (round = 0; round < 4; ++round) {
+            UCollatorView view;
+            UCollator *clone = ucol_safeClone(coll, NULL, NULL, &status);
+            ucol_initView(&view, coll, &status);
+            if (round != 0) {
+                UColAttributeValue strength = (round == 1) ? UCOL_PRIMARY :
+                                              (round == 2) ? UCOL_QUATERNARY : UCOL_IDENTICAL;
+                ucol_setViewAttribute(&view, UCOL_STRENGTH, strength, &status);
+                ucol_setAttribute(clone, UCOL_STRENGTH, strength, &status);
+                ucol_setViewAttribute(&view, UCOL_ALTERNATE_HANDLING,
+                                      (round == 2) ? UCOL_SHIFTED : UCOL_DEFAULT, &status);
+                ucol_setAttribute(clone, UCOL_ALTERNATE_HANDLING,
+                                  (round == 2) ? UCOL_SHIFTED : UCOL_DEFAULT, &status);
+                ucol_setViewAttribute(&view, UCOL_NUMERIC_COLLATION,
+                                      (round == 3) ? UCOL_ON : UCOL_OFF, &status);
+                ucol_setAttribute(clone, UCOL_NUMERIC_COLLATION,
+                                  (round == 3) ? UCOL_ON : UCOL_OFF, &status);
+            }
+            if (U_FAILURE(status)) {
+                log_err("%s round %d: setting up the view failed - %s\n",
+                        locales[k], (int)round, u_errorName(status));
+                ucol_close(clone);
+                ucol_close(coll);
+                return;
+            }
+            for (i = 0; i < COUNT; ++i) {
+                uint8_t key[100], viewKey[100];
+                int32_t length = ucol_getSortKey(clone, strings16[i], -1, key, UPRV_LENGTHOF(key));
+                int32_t viewLength = ucol_viewGetSortKey(&view, strings16[i], -1,
+                                                         viewKey, UPRV_LENGTHOF(viewKey), &status);
+                if (U_FAILURE(status) || length != viewLength ||
+                        uprv_memcmp(key, viewKey, length) != 0) {
+                    log_err("%s round %d: view sort key %d differs - %s\n",
+                            locales[k], (int)round, (int)i, u_errorName(status));
+                    status = U_ZERO_ERROR;
+                }
+                for (j = 0; j < COUNT; ++j) {
+                    UCollationResult expected = ucol_strcoll(clone, strings16[i], -1, strings16[j], -1);
+                    UCollationResult actual = ucol_viewStrcoll(&view, strings16[i], -1,
+                                                               strings16[j], -1, &status);
+                    UCollationResult actual8 = ucol_viewStrcollUTF8(&view, strings[i], -1,
+                                                                    strings[j], -1, &status);
+                    if (U_FAILURE(status) || actual != expected || actual8 != expected) {
+                        log_err("%s round %d: view %d vs. %d gives %d/%d, expected %d - %s\n",
+                                locales[k], (int)round, (int)i, (int)j,
+                                (int)actual, (int)actual8, (int)expected, u_errorName(status));
+                        status = U_ZERO_ERROR;
+                    }
+                }
+            }
+            ucol_close(clone);
+        }
+        if (ucol_getStrength(coll) != UCOL_TERTIARY) {
+            log_err("%s: ucol_setViewAttribute() changed the collator\n", locales[k]);
+        }
+        ucol_close(coll);
+    }
+
+    /* A NULL view is an argument error, not a crash. */
+    status = U_ZERO_ERROR;
+    ucol_setViewAttribute(NULL, UCOL_STRENGTH, UCOL_PRIMARY, &status);
+    if (status != U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("ucol_setViewAttribute(NULL) - %s\n", u_errorName(status));
+    }
+    status = U_ZERO_ERROR;
+    ucol_viewStrcoll(NULL, strings16[1], -1, strings16[2], -1, &status);
+    if (status != U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("ucol_viewStrcoll(NULL) - %s\n", u_errorName(status));
+    }
+    status = U_ZERO_ERROR;
+    ucol_viewStrcollUTF8(NULL, strings[1], -1, strings[2], -1, &status);
+    if (status != U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("ucol_viewStrcollUTF8(NULL) - %s\n", u_errorName(status));
+    }
+    status = U_ZERO_ERROR;
+    ucol_viewGetSortKey(NULL, strings16[1], -1, NULL, 0, &status);
+    if (status != U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("ucol_viewGetSortKey(NULL) - %s\n", u_errorName(status));
+    }
+}
+
 #endif /* #if !UCONFIG_NO_COLLATION */
@@ -136,6 +136,30 @@
      * test strcoll with null arg
      */
     static void TestStrcollNull(void);
+    /**
+     * Test ucol_getSortKeyUTF8() against ucol_getSortKey().
+     */
+    static void TestSortKeyUTF8(void);
+    /**
+     * Test ucol_getSortKeys() and ucol_getSortKeysUTF8().
+     */
+    static void TestSortKeys(void);
+    /**
+     * Test ucol_sortStrings() and ucol_sortStringsUTF8().
+     */
+    static void TestSortStrings(void);
+    /**
+     * Test ucol_sortStringsUTF8() with an executor against the sequential sort.
+     */
+    static void TestSortStringsWithExecutor(void);
+    /**
+     * Test ucol_openProbe() and ucol_compareProbe().
+     */
+    static void TestCollationProbe(void);
+    /**
+     * Tests collator views against clones with the same attributes.
+     */
+    static void TestCollatorView(void);
 
 #endif /* #if !UCONFIG_NO_COLLATION */
 
@@ -47,6 +47,7 @@ static void TestBreakIteratorSafeClone(void);
 static void TestBreakIteratorRules(void);
 static void TestBreakIteratorRuleError(void);
 static void TestBreakIteratorStatusVec(void);
+static void TestBreakIteratorGetBoundaries(void);
 static void TestBreakIteratorUText(void);
 static void TestBreakIteratorTailoring(void);
 static void TestBreakIteratorRefresh(void);
@@ -65,6 +66,7 @@ void addBrkIterAPITest(TestNode** root)
     addTest(root, &TestBreakIteratorRules, "tstxtbd/cbiapts/TestBreakIteratorRules");
     addTest(root, &TestBreakIteratorRuleError, "tstxtbd/cbiapts/TestBreakIteratorRuleError");
     addTest(root, &TestBreakIteratorStatusVec, "tstxtbd/cbiapts/TestBreakIteratorStatusVec");
+    addTest(root, &TestBreakIteratorGetBoundaries, "tstxtbd/cbiapts/TestBreakIteratorGetBoundaries");
     addTest(root, &TestBreakIteratorTailoring, "tstxtbd/cbiapts/TestBreakIteratorTailoring");
     addTest(root, &TestBreakIteratorRefresh, "tstxtbd/cbiapts/TestBreakIteratorRefresh");
     addTest(root, &TestBug11665, "tstxtbd/cbiapts/TestBug11665");
@@ -710,6 +712,58 @@ static void TestBreakIteratorStatusVec() {
 }
 
 
+/*
+ *  static void TestBreakIteratorGetBoundaries(void);
+ *
+ *         Test that ubrk_getBoundaries() matches a ubrk_next() loop.
+ */
+static void TestBreakIteratorGetBoundaries(void) {
+    UChar           testString[80];
+    UBreakIterator *bi        = NULL;
+    int32_t         expected[40];
+    int32_t         expectedStatuses[40];
+    int32_t         expectedLength = 0;
+    int32_t         boundaries[3];
+    int32_t         statuses[3];
+    int32_t         total = 0;
+    int32_t         length, i, pos;
+    UErrorCode      status    = U_ZERO_ERROR;
+
+    u_uastrncpy(testString, "Hello, world! It's 3.14 o'clock; time to go.", UPRV_LENGTHOF(testString));
+    bi = ubrk_open(UBRK_WORD, "en", testString, -1, &status);
+    if (U_FAILURE(status)) {
+        log_data_err("ubrk_open(UBRK_WORD) failed - %s\n", u_errorName(status));
+        return;
+    }
+    for (pos = ubrk_next(bi); pos != UBRK_DONE; pos = ubrk_next(bi)) {
+        expected[expectedLength] = pos;
+        expectedStatuses[expectedLength++] = ubrk_getRuleStatus(bi);
+    }
+
+    ubrk_first(bi);
+    do {
+        length = ubrk_getBoundaries(bi, boundaries, statuses, UPRV_LENGTHOF(boundaries), &status);
+        TEST_ASSERT_SUCCESS(status);
+        for (i = 0; i < length && total < expectedLength; ++i, ++total) {
+            TEST_ASSERT(boundaries[i] == expected[total]);
+            TEST_ASSERT(statuses[i] == expectedStatuses[total]);
+        }
+    } while (length == UPRV_LENGTHOF(boundaries));
+    TEST_ASSERT(total == expectedLength);
+    TEST_ASSERT(ubrk_current(bi) == u_strlen(testString));
+
+    ubrk_first(bi);
+    length = ubrk_getBoundaries(bi, boundaries, NULL, 2, &status);
+    TEST_ASSERT_SUCCESS(status);
+    TEST_ASSERT(length == 2 && boundaries[1] == expected[1]);
+    TEST_ASSERT(ubrk_next(bi) == expected[2]);
+
+    ubrk_getBoundaries(bi, boundaries, statuses, -1, &status);
+    TEST_ASSERT(status == U_ILLEGAL_ARGUMENT_ERROR);
+
+    ubrk_close(bi);
+}
+
 /*
  *  static void TestBreakIteratorUText(void);
  *
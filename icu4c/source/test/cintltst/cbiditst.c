@@ -91,6 +91,7 @@ static void doTailTest(void);
 
 static void testBracketOverflow(void);
 static void TestExplicitLevel0(void);
+static void testUpdatePara(void);
 
 /* new BIDI API */
 static void testReorderingMode(void);
@@ -140,6 +141,7 @@ addComplexTest(TestNode** root) {
     addTest(root, testContext, "complex/bidi/testContext");
     addTest(root, testBracketOverflow, "complex/bidi/TestBracketOverflow");
     addTest(root, TestExplicitLevel0, "complex/bidi/TestExplicitLevel0");
+    addTest(root, testUpdatePara, "complex/bidi/TestUpdatePara");
 
     addTest(root, doArabicShapingTest, "complex/arabic-shaping/ArabicShapingTest");
     addTest(root, doLamAlefSpecialVLTRArabicShapingTest, "complex/arabic-shaping/lamalef");
@@ -4948,3 +4950,88 @@ static void TestExplicitLevel0(void) {
     }
     ubidi_close(bidi);
 }
+
+static void
+testUpdatePara(void) {
+    /*
+     * Each test case starts with a pseudo-Bidi text and applies edits to it,
+     * each given as start, number of deleted units and inserted pseudo-Bidi text.
+     * After each edit, ubidi_updatePara() must yield the same as ubidi_setPara().
+     */
+    static const struct {
+        const char *text;
+        UBiDiLevel paraLevel;
+        struct { int32_t start, deletedLength; const char *inserted; } edits[6];
+    } testCases[] = {
+        { "abc GHI 123 def", 0,
+          { { 2, 0, "x" }, { 6, 0, "JK" }, { 9, 3, "" }, { 0, 0, "AB 12 " }, { 5, 4, "`H" }, { 3, 1, "9" } } },
+        { "GHI abc 45, def", 1,
+          { { 15, 0, " ghi" }, { 4, 3, "" }, { 1, 1, "Q_R" }, { 8, 0, "~" }, { 0, 2, "" }, { 3, 0, "  " } } },
+        { "GHI abc AB 12 def", UBIDI_DEFAULT_LTR,
+          { { 0, 0, "x" }, { 5, 0, "MN" }, { 12, 2, "3" }, { 2, 0, "@" }, { 14, 1, "&" }, { 0, 4, "" } } },
+        /* bracket pairs, explicit embeddings and paragraph separators */
+        { "abc GHI def", 0,
+          { { 4, 0, "(" }, { 9, 0, ")" }, { 4, 1, "" }, { 6, 0, "[" }, { 6, 1, "|" }, { 7, 0, "x" } } },
+        /* the text becomes unidirectional */
+        { "abc G def", 0,
+          { { 4, 1, "" }, { 3, 0, "H" }, { 0, 3, "" }, { 0, 0, "12 " }, { 0, 0, "I" }, { 0, 4, "" } } }
+    };
+    UChar text[MAXLEN], inserted[MAXLEN];
+    UErrorCode errorCode=U_ZERO_ERROR;
+    UBiDi *pBiDi=ubidi_open(), *pExpected=ubidi_open();
+    int32_t i, j, length, insertedLength;
+
+    if(pBiDi==NULL || pExpected==NULL) {
+        log_err("ubidi_open() returned NULL\n");
+        ubidi_close(pBiDi);
+        ubidi_close(pExpected);
+        return;
+    }
+    for(i=0; i<UPRV_LENGTHOF(testCases); ++i) {
+        length=pseudoToU16((int32_t)uprv_strlen(testCases[i].text), testCases[i].text, text);
+        ubidi_setPara(pBiDi, text, length, testCases[i].paraLevel, NULL, &errorCode);
+        for(j=0; j<UPRV_LENGTHOF(testCases[i].edits); ++j) {
+            int32_t start=testCases[i].edits[j].start;
+            int32_t deletedLength=testCases[i].edits[j].deletedLength;
+            const UBiDiLevel *levels, *expectedLevels;
+            int32_t map[MAXLEN], expectedMap[MAXLEN];
+
+            insertedLength=pseudoToU16((int32_t)uprv_strlen(testCases[i].edits[j].inserted),
+                                       testCases[i].edits[j].inserted, inserted);
+            u_memmove(text+start+insertedLength, text+start+deletedLength,
+                      length-start-deletedLength+1);
+            u_memcpy(text+start, inserted, insertedLength);
+            length+=insertedLength-deletedLength;
+
+            ubidi_updatePara(pBiDi, text, length, testCases[i].paraLevel,
+                             start, deletedLength, insertedLength, &errorCode);
+            ubidi_setPara(pExpected, text, length, testCases[i].paraLevel, NULL, &errorCode);
+            levels=ubidi_getLevels(pBiDi, &errorCode);
+            expectedLevels=ubidi_getLevels(pExpected, &errorCode);
+            ubidi_getLogicalMap(pBiDi, map, &errorCode);
+            ubidi_getLogicalMap(pExpected, expectedMap, &errorCode);
+            if(U_FAILURE(errorCode)) {
+                log_err("testUpdatePara case %d edit %d: error %s\n", i, j, myErrorName(errorCode));
+                break;
+            }
+            if(ubidi_getDirection(pBiDi)!=ubidi_getDirection(pExpected) ||
+                    ubidi_getParaLevel(pBiDi)!=ubidi_getParaLevel(pExpected) ||
+                    ubidi_countRuns(pBiDi, &errorCode)!=ubidi_countRuns(pExpected, &errorCode) ||
+                    uprv_memcmp(levels, expectedLevels, length)!=0 ||
+                    uprv_memcmp(map, expectedMap, length*4)!=0) {
+                log_err("testUpdatePara case %d edit %d: ubidi_updatePara() != ubidi_setPara()\n", i, j);
+            }
+        }
+    }
+
+    /* the edit must match the length of the previous text */
+    length=pseudoToU16(7, "abc GHI", text);
+    ubidi_setPara(pBiDi, text, length, 0, NULL, &errorCode);
+    ubidi_updatePara(pBiDi, text, length, 0, 2, 1, 0, &errorCode);
+    if(errorCode!=U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("ubidi_updatePara() with a wrong edit length: %s instead of U_ILLEGAL_ARGUMENT_ERROR\n",
+                myErrorName(errorCode));
+    }
+    ubidi_close(pBiDi);
+    ubidi_close(pExpected);
+}
@@ -31,6 +31,7 @@
 #include "cformtst.h"
 #include "cmemory.h"
 #include "cstring.h"
+#include "putilimp.h"
 #include "ulist.h"
 
 void TestGregorianChange(void);
@@ -41,6 +42,7 @@ void TestGetTZTransition(void);
 void TestGetWindowsTimeZoneID(void);
 void TestGetTimeZoneIDByWindowsID(void);
 void TestJpnCalAddSetNextEra(void);
+static void TestDatesToFields(void);
 
 void addCalTest(TestNode** root);
 
@@ -64,6 +66,7 @@ void addCalTest(TestNode** root)
     addTest(root, &TestGetWindowsTimeZoneID, "tsformat/ccaltst/TestGetWindowsTimeZoneID");
     addTest(root, &TestGetTimeZoneIDByWindowsID, "tsformat/ccaltst/TestGetTimeZoneIDByWindowsID");
     addTest(root, &TestJpnCalAddSetNextEra, "tsformat/ccaltst/TestJpnCalAddSetNextEra");
+    addTest(root, &TestDatesToFields, "tsformat/ccaltst/TestDatesToFields");
 }
 
 /* "GMT" */
@@ -2504,4 +2507,104 @@ void TestJpnCalAddSetNextEra() {
     }
 }
 
+enum { kBatchCount = 3000 };
+
+static void TestDatesToFields() {
+    /* Compare the batch conversions with ucal_setMillis()/ucal_get() and ucal_set()/ucal_getMillis(). */
+    static const char *zones[] = { "America/Los_Angeles", "Australia/Lord_Howe", "Pacific/Apia", "Europe/Paris", "Bogus" };
+    static const UCalendarDateFields calFields[] = {
+        UCAL_EXTENDED_YEAR, UCAL_MONTH, UCAL_DATE, UCAL_HOUR_OF_DAY, UCAL_MINUTE, UCAL_SECOND,
+        UCAL_MILLISECOND, UCAL_DAY_OF_WEEK
+    };
+    static UDate dates[kBatchCount], results[kBatchCount];
+    static int32_t columns[9][kBatchCount];
+    UCalendarFieldArrays fields = {
+        columns[0], columns[1], columns[2], columns[3], columns[4], columns[5], columns[6], columns[7], columns[8]
+    };
+    int32_t zoneIndex, pass, i, f;
+    for (zoneIndex = 0; zoneIndex < UPRV_LENGTHOF(zones); ++zoneIndex) {
+        UChar zoneID[32];
+        UErrorCode status = U_ZERO_ERROR;
+        UCalendar *cal;
+        u_uastrcpy(zoneID, zones[zoneIndex]);
+        cal = ucal_open(zoneID, -1, "en_US", UCAL_GREGORIAN, &status);
+        if (U_FAILURE(status)) {
+            log_data_err("FAIL: ucal_open(%s), status %s\n", zones[zoneIndex], u_errorName(status));
+            continue;
+        }
+        /* pass 0: sorted dates from 1900 to 2100, pass 1: the same dates out of order */
+        for (pass = 0; pass < 2; ++pass) {
+            for (i = 0; i < kBatchCount; ++i) {
+                int32_t j = pass == 0 ? i : (i * 7) % kBatchCount;
+                dates[i] = -2208988800000.0 + j * 2103840123.0;
+            }
+            ucal_datesToFields(zoneID, -1, dates, kBatchCount, &fields, &status);
+            if (U_FAILURE(status)) {
+                log_err("FAIL: ucal_datesToFields(%s), status %s\n", zones[zoneIndex], u_errorName(status));
+                break;
+            }
+            for (i = 0; i < kBatchCount; ++i) {
+                ucal_setMillis(cal, dates[i], &status);
+                for (f = 0; f < UPRV_LENGTHOF(calFields); ++f) {
+                    int32_t expected = ucal_get(cal, calFields[f], &status);
+                    if (columns[f][i] != expected) {
+                        log_err("FAIL: ucal_datesToFields(%s) date %.0f field %d: got %d, expected %d\n",
+                                zones[zoneIndex], dates[i], calFields[f], columns[f][i], expected);
+                    }
+                }
+                if (columns[8][i] != ucal_get(cal, UCAL_ZONE_OFFSET, &status) + ucal_get(cal, UCAL_DST_OFFSET, &status)) {
+                    log_err("FAIL: ucal_datesToFields(%s) date %.0f zone offset %d\n", zones[zoneIndex], dates[i], columns[8][i]);
+                }
+            }
+
+            /* Shift the local times by 90 minutes so that some are skipped or repeated. */
+            for (i = 0; i < kBatchCount; ++i) {
+                columns[4][i] += 90;
+            }
+            ucal_fieldsToDates(zoneID, -1, &fields, kBatchCount, results, &status);
+            if (U_FAILURE(status)) {
+                log_err("FAIL: ucal_fieldsToDates(%s), status %s\n", zones[zoneIndex], u_errorName(status));
+                break;
+            }
+            for (i = 0; i < kBatchCount; ++i) {
+                UDate expected;
+                ucal_clear(cal);
+                for (f = 0; f < 7; ++f) {
+                    ucal_set(cal, calFields[f], columns[f][i]);
+                }
+                expected = ucal_getMillis(cal, &status);
+                if (results[i] != expected) {
+                    log_err("FAIL: ucal_fieldsToDates(%s) %d-%d-%d %d:%d: got %.0f, expected %.0f\n", zones[zoneIndex],
+                            columns[0][i], columns[1][i], columns[2][i], columns[3][i], columns[4][i], results[i], expected);
+                }
+            }
+            if (U_FAILURE(status)) {
+                log_err("FAIL: UCalendar(%s), status %s\n", zones[zoneIndex], u_errorName(status));
+            }
+        }
+        ucal_close(cal);
+    }
+
+    {
+        /* NULL columns, lenient months and errors */
+        UErrorCode status = U_ZERO_ERROR;
+        int32_t year = 2018, month = 13, dom = 31;
+        UCalendarFieldArrays dateOnly = { &year, &month, &dom, NULL, NULL, NULL, NULL, NULL, NULL };
+        UCalendarFieldArrays yearOnly = { &year, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL };
+        UDate date = 0, bad = uprv_getNaN();
+        ucal_fieldsToDates(fgGMTID, -1, &dateOnly, 1, &date, &status);
+        if (U_FAILURE(status) || date != 1551571200000.0) {  /* 2019-02-31 = 2019-03-03 */
+            log_err("FAIL: ucal_fieldsToDates with lenient month: %.0f, status %s\n", date, u_errorName(status));
+        }
+        ucal_datesToFields(fgGMTID, -1, &date, 1, &yearOnly, &status);
+        if (U_FAILURE(status) || year != 2019) {
+            log_err("FAIL: ucal_datesToFields with year only: %d, status %s\n", year, u_errorName(status));
+        }
+        ucal_datesToFields(fgGMTID, -1, &bad, 1, &yearOnly, &status);
+        if (status != U_ILLEGAL_ARGUMENT_ERROR) {
+            log_err("FAIL: ucal_datesToFields with NaN, status %s\n", u_errorName(status));
+        }
+    }
+}
+
 #endif /* #if !UCONFIG_NO_FORMATTING */
@@ -66,6 +66,7 @@ static void TestLMBCSMaxChar(void);
 
 #if !UCONFIG_NO_LEGACY_CONVERSION
 static void TestConvertSafeCloneCallback(void);
+static void TestInitFromPrototype(void);
 #endif
 
 static void TestEBCDICSwapLFNL(void);
@@ -96,6 +97,7 @@ void addTestConvert(TestNode** root)
     addTest(root, &TestConvertSafeClone,        "tsconv/ccapitst/TestConvertSafeClone");
 #if !UCONFIG_NO_LEGACY_CONVERSION
     addTest(root, &TestConvertSafeCloneCallback,"tsconv/ccapitst/TestConvertSafeCloneCallback");
+    addTest(root, &TestInitFromPrototype,       "tsconv/ccapitst/TestInitFromPrototype");
 #endif
     addTest(root, &TestCCSID,                   "tsconv/ccapitst/TestCCSID"); 
     addTest(root, &TestJ932,                    "tsconv/ccapitst/TestJ932");
@@ -1901,6 +1903,91 @@ static void TestConvertSafeClone()
     }
 }
 
+#if !UCONFIG_NO_LEGACY_CONVERSION
+static void TestInitFromPrototype() {
+    static const char *const names[]={ "windows-1252", "ibm-943_P15A-2003", "ISO-2022-JP" };
+    static const UChar text[]={ 0x61, 0x62, 0xe9, 0x63, 0x65e5, 0x672c, 0x64, 0xd800, 0xdc00, 0x65, 0 };
+    static const char sub[]={ 0x3f };
+    char buffer[4000], expected[100], out[100];
+    UChar uOut[20];
+    int32_t i, n, size, expLength, length, uLength, bigSize;
+
+    for(n=0; n<UPRV_LENGTHOF(names); ++n) {
+        UErrorCode errorCode=U_ZERO_ERROR;
+        UConverter *prototype=ucnv_open(names[n], &errorCode), *cnv[3];
+        if(U_FAILURE(errorCode)) {
+            log_data_err("unable to open a %s converter - %s\n", names[n], u_errorName(errorCode));
+            continue;
+        }
+        /* the configuration of the prototype carries over */
+        if(n==0) {
+            ucnv_setSubstChars(prototype, sub, 1, &errorCode);
+        }
+        expLength=ucnv_fromUChars(prototype, expected, UPRV_LENGTHOF(expected), text, -1, &errorCode);
+        ucnv_resetFromUnicode(prototype);
+        if(U_FAILURE(errorCode)) {
+            log_err("%s prototype setup failed - %s\n", names[n], u_errorName(errorCode));
+            ucnv_close(prototype);
+            continue;
+        }
+
+        /* preflight, then a buffer that is too small */
+        size=0;
+        cnv[0]=ucnv_initFromPrototype(prototype, NULL, &size, &errorCode);
+        if(errorCode!=U_BUFFER_OVERFLOW_ERROR || cnv[0]!=NULL || size<=0 || size>1000) {
+            log_err("%s ucnv_initFromPrototype(preflighting) size=%d - %s\n",
+                    names[n], (int)size, u_errorName(errorCode));
+            ucnv_close(prototype);
+            continue;
+        }
+        errorCode=U_ZERO_ERROR;
+        bigSize=size-1;
+        cnv[0]=ucnv_initFromPrototype(prototype, buffer, &bigSize, &errorCode);
+        if(errorCode!=U_BUFFER_OVERFLOW_ERROR || cnv[0]!=NULL || bigSize!=size) {
+            log_err("%s ucnv_initFromPrototype(buffer too small) - %s\n", names[n], u_errorName(errorCode));
+        }
+
+        /* several converters at odd offsets into one buffer */
+        for(i=0; i<3; ++i) {
+            errorCode=U_ZERO_ERROR;
+            bigSize=size;
+            cnv[i]=ucnv_initFromPrototype(prototype, buffer+1+i*(size+1), &bigSize, &errorCode);
+            if(U_FAILURE(errorCode) || cnv[i]==NULL ||
+                    (char *)cnv[i]<buffer+1+i*(size+1) || (char *)cnv[i]>=buffer+(i+1)*(size+1)) {
+                log_err("%s ucnv_initFromPrototype(%d) failed - %s\n", names[n], (int)i, u_errorName(errorCode));
+                cnv[i]=NULL;
+            }
+        }
+        for(i=0; i<3; ++i) {
+            if(cnv[i]==NULL) {
+                continue;
+            }
+            errorCode=U_ZERO_ERROR;
+            length=ucnv_fromUChars(cnv[i], out, UPRV_LENGTHOF(out), text, -1, &errorCode);
+            if(U_FAILURE(errorCode) || length!=expLength || 0!=uprv_memcmp(expected, out, length)) {
+                log_err("%s converter %d from ucnv_initFromPrototype() converts differently - %s\n",
+                        names[n], (int)i, u_errorName(errorCode));
+            }
+            uLength=ucnv_toUChars(cnv[i], uOut, UPRV_LENGTHOF(uOut), out, length, &errorCode);
+            if(U_FAILURE(errorCode) || uLength<=0 || uOut[0]!=0x61) {
+                log_err("%s converter %d from ucnv_initFromPrototype() fails toUnicode - %s\n",
+                        names[n], (int)i, u_errorName(errorCode));
+            }
+            ucnv_close(cnv[i]);
+        }
+
+        /* closing the new converters must not have released the prototype's data */
+        errorCode=U_ZERO_ERROR;
+        length=ucnv_fromUChars(prototype, out, UPRV_LENGTHOF(out), text, -1, &errorCode);
+        if(U_FAILURE(errorCode) || length!=expLength || 0!=uprv_memcmp(expected, out, length)) {
+            log_err("%s prototype converts differently after closing its copies - %s\n",
+                    names[n], u_errorName(errorCode));
+        }
+        ucnv_close(prototype);
+    }
+}
+#endif
+
 static void TestCCSID() {
 #if !UCONFIG_NO_LEGACY_CONVERSION
     UConverter *cnv;
@@ -24,6 +24,7 @@
 static void TestBasic(void);
 static void TestOtherAPI(void);
 static void hashIChars(void);
+static void TestManyPutRemove(void);
 
 static int32_t U_EXPORT2 U_CALLCONV hashChars(const UHashTok key);
 
@@ -89,6 +90,7 @@ void addHashtableTest(TestNode** root) {
     addTest(root, &TestBasic,   "tsutil/chashtst/TestBasic");
     addTest(root, &TestOtherAPI, "tsutil/chashtst/TestOtherAPI");
     addTest(root, &hashIChars, "tsutil/chashtst/hashIChars");
+    addTest(root, &TestManyPutRemove, "tsutil/chashtst/TestManyPutRemove");
     
 }
 
@@ -282,6 +284,76 @@ static void TestOtherAPI(void){
 
 }
 
+/* All keys hash to the same value, so that every lookup has to probe. */
+static int32_t U_EXPORT2 U_CALLCONV
+hashConstant(const UHashTok key) {
+    (void)key;
+    return 5;
+}
+
+static void TestManyPutRemove(void) {
+    UErrorCode status = U_ZERO_ERROR;
+    int32_t i, round;
+    UHashtable *hash;
+
+    hash = uhash_open(uhash_hashLong, uhash_compareLong, NULL, &status);
+    if (U_FAILURE(status)) {
+        log_err("FAIL: uhash_open failed with %s\n", u_errorName(status));
+        return;
+    }
+    /* Grow the table, then remove every other key. */
+    for (i = 0; i < 1000; ++i) {
+        uhash_iputi(hash, i * 256, i + 1, &status);
+    }
+    for (i = 1; i < 1000; i += 2) {
+        if (uhash_iremovei(hash, i * 256) != i + 1) {
+            log_err("FAIL: uhash_iremovei(%d) failed\n", i * 256);
+        }
+    }
+    if (uhash_count(hash) != 500) {
+        log_err("FAIL: uhash_count() expected 500, got %d\n", uhash_count(hash));
+    }
+    for (i = 0; i < 1000; ++i) {
+        int32_t expected = (i & 1) == 0 ? i + 1 : 0;
+        if (uhash_igeti(hash, i * 256) != expected) {
+            log_err("FAIL: uhash_igeti(%d) expected %d\n", i * 256, expected);
+        }
+    }
+    uhash_close(hash);
+
+    /* Colliding keys in a small table that never grows,
+     * with many cycles of removals and insertions. */
+    status = U_ZERO_ERROR;
+    hash = uhash_openSize(hashConstant, uhash_compareLong, NULL, 16, &status);
+    if (U_FAILURE(status)) {
+        log_err("FAIL: uhash_openSize failed with %s\n", u_errorName(status));
+        return;
+    }
+    uhash_setResizePolicy(hash, U_FIXED);
+    for (round = 0; round < 100 && U_SUCCESS(status); ++round) {
+        for (i = 0; i < 10; ++i) {
+            uhash_iputi(hash, round * 10 + i, i + 1, &status);
+        }
+        for (i = 0; i < 10; i += 3) {
+            if (uhash_iremovei(hash, round * 10 + i) != i + 1) {
+                log_err("FAIL: round %d uhash_iremovei(%d) failed\n", round, round * 10 + i);
+            }
+        }
+        for (i = 0; i < 10; ++i) {
+            int32_t expected = i % 3 == 0 ? 0 : i + 1;
+            if (uhash_igeti(hash, round * 10 + i) != expected) {
+                log_err("FAIL: round %d uhash_igeti(%d) expected %d\n",
+                        round, round * 10 + i, expected);
+            }
+        }
+        uhash_removeAll(hash);
+    }
+    if (U_FAILURE(status)) {
+        log_err("FAIL: uhash_iputi failed with %s\n", u_errorName(status));
+    }
+    uhash_close(hash);
+}
+
 static void hashIChars(void) {
     static const char which[] = "which";
     static const char WHICH2[] = "WHICH";
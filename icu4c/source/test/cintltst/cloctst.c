@@ -257,6 +257,7 @@ void addLocaleTest(TestNode** root)
     TESTCASE(TestBug20132);
     TESTCASE(TestBug20149);
     TESTCASE(TestForLanguageTag);
+    TESTCASE(TestForLanguageTagTwice);
     TESTCASE(TestLangAndRegionCanonicalize);
     TESTCASE(TestTrailingNull);
     TESTCASE(TestUnicodeDefines);
@@ -6201,6 +6202,34 @@ static void TestForLanguageTag(void) {
     }
 }
 
+/* The second call for each tag gets its conversion from the language tag cache. */
+static void TestForLanguageTagTwice(void) {
+    static const char *const tags[] = { "en-US", "zh-Hant-TW", "de-u-co-phonebk", "en-US-x-twain", "ja-" };
+    char first[64], second[64];
+    int32_t i, firstLen, secondLen, firstParsed, secondParsed;
+    UErrorCode status;
+
+    for (i = 0; i < UPRV_LENGTHOF(tags); i++) {
+        status = U_ZERO_ERROR;
+        firstLen = uloc_forLanguageTag(tags[i], first, sizeof(first), &firstParsed, &status);
+        secondLen = uloc_forLanguageTag(tags[i], second, sizeof(second), &secondParsed, &status);
+        if (U_FAILURE(status)) {
+            log_err_status(status, "uloc_forLanguageTag(%s) failed - %s\n", tags[i], u_errorName(status));
+        } else if (firstLen != secondLen || uprv_strcmp(first, second) != 0 || firstParsed != secondParsed) {
+            log_err("uloc_forLanguageTag(%s) returned [%s] (parsed %d) and then [%s] (parsed %d)\n",
+                tags[i], first, firstParsed, second, secondParsed);
+        }
+
+        /* A cached conversion must still report a buffer overflow. */
+        status = U_ZERO_ERROR;
+        secondLen = uloc_forLanguageTag(tags[i], second, 1, NULL, &status);
+        if (firstLen > 1 && (status != U_BUFFER_OVERFLOW_ERROR || secondLen != firstLen)) {
+            log_err("uloc_forLanguageTag(%s) into 1 byte returned %d - %s, expected %d - U_BUFFER_OVERFLOW_ERROR\n",
+                tags[i], secondLen, u_errorName(status), firstLen);
+        }
+    }
+}
+
 static const struct {
     const char  *input;
     const char  *canonical;
@@ -124,6 +124,7 @@ static void TestLikelySubtags(void);
  * language tag
  */
 static void TestForLanguageTag(void);
+static void TestForLanguageTagTwice(void);
 static void TestToLanguageTag(void);
 static void TestBug20132(void);
 static void TestLangAndRegionCanonicalize(void);
@@ -17,6 +17,7 @@
 */
 
 
+#include <stdio.h>
 #include <time.h>
 #include "unicode/utypes.h"
 #include "cintltst.h"
@@ -187,6 +188,10 @@ static void TestCLDRStyleAliases(void);
 static void TestFallbackCodes(void);
 static void TestGetUTF8String(void);
 static void TestCLDRVersion(void);
+static void TestReopen(void);
+static void TestRepeatedFallbackLookup(void);
+static void TestTableHashes(void);
+static void TestCorruptTableHashes(void);
 
 /***************************************************************************************/
 
@@ -214,6 +219,8 @@ void addNEWResourceBundleTest(TestNode** root)
     addTest(root, &TestGetUTF8String,         "tsutil/creststn/TestGetUTF8String");
     addTest(root, &TestCLDRVersion,           "tsutil/creststn/TestCLDRVersion");
     addTest(root, &TestPreventFallback,       "tsutil/creststn/TestPreventFallback");
+    addTest(root, &TestTableHashes,           "tsutil/creststn/TestTableHashes");
+    addTest(root, &TestCorruptTableHashes,    "tsutil/creststn/TestCorruptTableHashes");
 #endif
     addTest(root, &TestFallback,              "tsutil/creststn/TestFallback");
     addTest(root, &TestGetVersion,            "tsutil/creststn/TestGetVersion");
@@ -223,6 +230,8 @@ void addNEWResourceBundleTest(TestNode** root)
     addTest(root, &TestGetFunctionalEquivalent,"tsutil/creststn/TestGetFunctionalEquivalent");
     addTest(root, &TestJB3763,                "tsutil/creststn/TestJB3763");
     addTest(root, &TestStackReuse,            "tsutil/creststn/TestStackReuse");
+    addTest(root, &TestReopen,                "tsutil/creststn/TestReopen");
+    addTest(root, &TestRepeatedFallbackLookup, "tsutil/creststn/TestRepeatedFallbackLookup");
 }
 
 
@@ -3102,3 +3111,310 @@ static void TestCLDRVersion(void) {
   }
 
 }
+
+/*
+ * Opening a bundle again must give the same bundle and status as the first time,
+ * except when the first bundle came from the default locale, and that has changed.
+ */
+static void TestReopen(void) {
+    static const char *const locales[] = { "de_CH", "de_XX", "xx_YY", "root", "" };
+    static const char *const defaults[] = { "fr_CA", "ja_JP" };
+    char savedDefault[ULOC_FULLNAME_CAPACITY];
+    int32_t i, j, k;
+    UErrorCode status = U_ZERO_ERROR;
+
+    uprv_strcpy(savedDefault, uloc_getDefault());
+    for (i = 0; i < UPRV_LENGTHOF(defaults); ++i) {
+        uloc_setDefault(defaults[i], &status);
+        for (j = 0; j < UPRV_LENGTHOF(locales); ++j) {
+            char firstName[ULOC_FULLNAME_CAPACITY] = "";
+            UErrorCode firstStatus = U_ZERO_ERROR;
+            for (k = 0; k < 2; ++k) {
+                const char *name;
+                UResourceBundle *res;
+                status = U_ZERO_ERROR;
+                res = ures_open(NULL, locales[j], &status);
+                if (U_FAILURE(status)) {
+                    log_data_err("ures_open(%s) failed - %s\n", locales[j], u_errorName(status));
+                    ures_close(res);
+                    break;
+                }
+                name = ures_getLocaleByType(res, ULOC_ACTUAL_LOCALE, &status);
+                if (k == 0) {
+                    uprv_strcpy(firstName, name);
+                    firstStatus = status;
+                } else if (uprv_strcmp(name, firstName) != 0 || status != firstStatus) {
+                    log_err("ures_open(%s) again gave %s %s, the first time %s %s\n",
+                            locales[j], name, u_errorName(status), firstName, u_errorName(firstStatus));
+                }
+                ures_close(res);
+            }
+            /* xx_YY has no data and falls back to the default locale. */
+            if (uprv_strcmp(locales[j], "xx_YY") == 0 && firstName[0] != 0 &&
+                    uprv_strncmp(firstName, defaults[i], 2) != 0) {
+                log_err("ures_open(xx_YY) with default locale %s gave %s\n", defaults[i], firstName);
+            }
+        }
+    }
+    status = U_ZERO_ERROR;
+    uloc_setDefault(savedDefault, &status);
+
+    for (k = 0; k < 2; ++k) {
+        UResourceBundle *res;
+        status = U_ZERO_ERROR;
+        res = ures_openDirect(NULL, "supplementalData", &status);
+        if (status != U_ZERO_ERROR) {
+            log_data_err("ures_openDirect(supplementalData) gave %s\n", u_errorName(status));
+        }
+        ures_close(res);
+    }
+}
+
+/*
+ * Looking up a path with fallback again must give the same item as the first time,
+ * and the status must follow the current default locale.
+ */
+static void TestRepeatedFallbackLookup(void) {
+    static const char *const locales[] = { "de_CH", "fr_CA", "sr_Latn_BA", "root" };
+    static const char *const paths[] = {
+        "NumberElements/latn/patterns/decimalFormat",
+        "calendar/gregorian/DateTimePatterns",
+        "calendar/islamic/monthNames/format/wide",
+        "calendar/gregorian/dayNames/format/abbreviated",
+        "NumberElements/latn/noSuchKey"
+    };
+    static const char *const defaults[] = { "en_US", "de" };
+    char savedDefault[ULOC_FULLNAME_CAPACITY];
+    int32_t i, j, k, m;
+    UErrorCode status = U_ZERO_ERROR;
+
+    uprv_strcpy(savedDefault, uloc_getDefault());
+    for (i = 0; i < UPRV_LENGTHOF(defaults); ++i) {
+        status = U_ZERO_ERROR;
+        uloc_setDefault(defaults[i], &status);
+        for (j = 0; j < UPRV_LENGTHOF(locales); ++j) {
+            UResourceBundle *res;
+            status = U_ZERO_ERROR;
+            res = ures_open(NULL, locales[j], &status);
+            if (U_FAILURE(status)) {
+                log_data_err("ures_open(%s) failed - %s\n", locales[j], u_errorName(status));
+                ures_close(res);
+                continue;
+            }
+            for (m = 0; m < UPRV_LENGTHOF(paths); ++m) {
+                char firstName[ULOC_FULLNAME_CAPACITY] = "";
+                UErrorCode firstStatus = U_ZERO_ERROR;
+                UResType firstType = URES_NONE;
+                int32_t firstSize = 0;
+                for (k = 0; k < 3; ++k) {
+                    UResourceBundle *item;
+                    const char *name = "";
+                    UResType type = URES_NONE;
+                    int32_t size = 0;
+                    status = U_ZERO_ERROR;
+                    item = ures_getByKeyWithFallback(res, paths[m], NULL, &status);
+                    if (U_SUCCESS(status)) {
+                        UErrorCode nameStatus = U_ZERO_ERROR;
+                        name = ures_getLocaleByType(item, ULOC_ACTUAL_LOCALE, &nameStatus);
+                        type = ures_getType(item);
+                        size = ures_getSize(item);
+                    }
+                    if (k == 0) {
+                        uprv_strcpy(firstName, name);
+                        firstStatus = status;
+                        firstType = type;
+                        firstSize = size;
+                    } else if (uprv_strcmp(name, firstName) != 0 || status != firstStatus ||
+                            type != firstType || size != firstSize) {
+                        log_err("%s: ures_getByKeyWithFallback(%s) again gave %s %s type %d size %d, "
+                                "the first time %s %s type %d size %d\n",
+                                locales[j], paths[m], name, u_errorName(status), (int)type, (int)size,
+                                firstName, u_errorName(firstStatus), (int)firstType, (int)firstSize);
+                    }
+                    ures_close(item);
+                }
+                if (firstStatus == U_USING_FALLBACK_WARNING &&
+                        (uprv_strcmp(firstName, defaults[i]) == 0 || uprv_strcmp(firstName, "root") == 0)) {
+                    log_err("%s: ures_getByKeyWithFallback(%s) from %s with default locale %s gave %s\n",
+                            locales[j], paths[m], firstName, defaults[i], u_errorName(firstStatus));
+                }
+                if (firstStatus == U_USING_DEFAULT_WARNING &&
+                        uprv_strcmp(firstName, defaults[i]) != 0 && uprv_strcmp(firstName, "root") != 0) {
+                    log_err("%s: ures_getByKeyWithFallback(%s) from %s with default locale %s gave %s\n",
+                            locales[j], paths[m], firstName, defaults[i], u_errorName(firstStatus));
+                }
+            }
+            ures_close(res);
+        }
+    }
+    status = U_ZERO_ERROR;
+    uloc_setDefault(savedDefault, &status);
+}
+
+/*
+ * The tablehash bundle is built with genrb --tableHashes 16,
+ * so that its two larger tables are looked up via their hash indexes.
+ */
+static void TestTableHashes(void) {
+    static const char *const missingKeys[] = { "AAA", "EU", "EURO", "GIQ", "ZZZ", "a", "" };
+    const char *testdatapath;
+    UResourceBundle *bundle, *table, *item = NULL;
+    UErrorCode status = U_ZERO_ERROR;
+    int32_t i, count;
+
+    testdatapath = loadTestData(&status);
+    if (U_FAILURE(status)) {
+        log_data_err("Could not load testdata.dat %s\n", u_errorName(status));
+        return;
+    }
+    bundle = ures_open(testdatapath, "tablehash", &status);
+    if (U_FAILURE(status)) {
+        log_data_err("ures_open(tablehash) failed - %s\n", u_errorName(status));
+        return;
+    }
+    if (bundle->fResData.pTableHashes == NULL) {
+        log_err("the tablehash bundle has no table hash indexes\n");
+    }
+
+    /* Every key must find its own item, and other keys none. */
+    table = ures_getByKey(bundle, "currencies", NULL, &status);
+    count = ures_getSize(table);
+    if (U_FAILURE(status) || count != 50) {
+        log_err("tablehash/currencies: %s, size %d\n", u_errorName(status), (int)count);
+    }
+    for (i = 0; i < count && U_SUCCESS(status); ++i) {
+        char expected[8], actual[8];
+        const char *key;
+        UErrorCode itemStatus = U_ZERO_ERROR;
+        item = ures_getByIndex(table, i, item, &status);
+        key = ures_getKey(item);
+        u_UCharsToChars(ures_getString(item, NULL, &status), expected, 4);
+        item = ures_getByKey(table, key, item, &itemStatus);
+        if (U_FAILURE(itemStatus)) {
+            log_err("tablehash/currencies/%s: %s\n", key, u_errorName(itemStatus));
+            continue;
+        }
+        u_UCharsToChars(ures_getString(item, NULL, &itemStatus), actual, 4);
+        if (uprv_strncmp(expected, actual, 3) != 0 || uprv_strcmp(key, ures_getKey(item)) != 0) {
+            log_err("tablehash/currencies/%s gave the item %s\n", key, ures_getKey(item));
+        }
+    }
+    for (i = 0; i < UPRV_LENGTHOF(missingKeys); ++i) {
+        UErrorCode itemStatus = U_ZERO_ERROR;
+        item = ures_getByKey(table, missingKeys[i], item, &itemStatus);
+        if (itemStatus != U_MISSING_RESOURCE_ERROR) {
+            log_err("tablehash/currencies/%s: %s rather than U_MISSING_RESOURCE_ERROR\n",
+                    missingKeys[i], u_errorName(itemStatus));
+        }
+    }
+    ures_close(table);
+
+    /* numbers has keys n3, n6, ..., n120 with values 1..40. */
+    table = ures_getByKey(bundle, "numbers", NULL, &status);
+    for (i = 0; i <= 130 && U_SUCCESS(status); ++i) {
+        char key[8];
+        UErrorCode itemStatus = U_ZERO_ERROR;
+        UBool expected = i % 3 == 0 && 3 <= i && i <= 120;
+        sprintf(key, "n%d", (int)i);
+        item = ures_getByKey(table, key, item, &itemStatus);
+        if (expected != U_SUCCESS(itemStatus) ||
+                (expected && ures_getInt(item, &itemStatus) != i / 3)) {
+            log_err("tablehash/numbers/%s: %s\n", key, u_errorName(itemStatus));
+        }
+    }
+    ures_close(table);
+
+    /* small is below the minimum length for a hash index. */
+    table = ures_getByKey(bundle, "small", NULL, &status);
+    item = ures_getByKey(table, "b", item, &status);
+    if (U_FAILURE(status)) {
+        log_err("tablehash/small/b: %s\n", u_errorName(status));
+    }
+    ures_close(table);
+    ures_close(item);
+    ures_close(bundle);
+}
+
+/*
+ * Looks up every key of the tablehash/currencies table in a copy of the bundle's
+ * ResourceData whose table hash indexes are damaged in one of several ways.
+ * The lookups must fall back to a binary search.
+ */
+static void TestCorruptTableHashes(void) {
+    const char *testdatapath;
+    UResourceBundle *bundle, *table, *item = NULL;
+    const int32_t *hashes;
+    int32_t *damaged = NULL;
+    int32_t directoryLength, slot = -1, blockOffset, bucketCount, count, i, j, damage;
+    UErrorCode status = U_ZERO_ERROR;
+
+    testdatapath = loadTestData(&status);
+    if (U_FAILURE(status)) {
+        log_data_err("Could not load testdata.dat %s\n", u_errorName(status));
+        return;
+    }
+    bundle = ures_open(testdatapath, "tablehash", &status);
+    table = ures_getByKey(bundle, "currencies", NULL, &status);
+    if (U_FAILURE(status)) {
+        log_data_err("ures_open(tablehash/currencies) failed - %s\n", u_errorName(status));
+        ures_close(bundle);
+        return;
+    }
+    hashes = bundle->fResData.pTableHashes;
+    if (hashes == NULL) {
+        log_err("the tablehash bundle has no table hash indexes\n");
+        ures_close(table);
+        ures_close(bundle);
+        return;
+    }
+    directoryLength = hashes[URES_TABLE_HASHES_DIRECTORY_LENGTH];
+    for (i = 0; i < directoryLength; ++i) {
+        if ((Resource)hashes[URES_TABLE_HASHES_DIRECTORY + 2 * i] == table->fRes) {
+            slot = URES_TABLE_HASHES_DIRECTORY + 2 * i;
+        }
+    }
+    count = ures_getSize(table);
+    if (slot < 0) {
+        log_err("tablehash/currencies has no hash index\n");
+    }
+    damaged = (int32_t *)uprv_malloc(bundle->fResData.tableHashesLength * 4);
+    for (damage = 0; slot >= 0 && damaged != NULL && damage < 4; ++damage) {
+        ResourceData resData = bundle->fResData;
+        uprv_memcpy(damaged, hashes, bundle->fResData.tableHashesLength * 4);
+        resData.pTableHashes = damaged;
+        blockOffset = damaged[slot + 1];
+        bucketCount = damaged[blockOffset];
+        switch (damage) {
+        case 0:  /* block offset beyond the end of the indexes */
+            damaged[slot + 1] = bundle->fResData.tableHashesLength;
+            break;
+        case 1:  /* bucket count too large for the indexes */
+            damaged[blockOffset] = 0x7fffffff;
+            break;
+        case 2:  /* item indexes outside of the table */
+            for (j = 0; j < count; ++j) {
+                damaged[blockOffset + 1 + bucketCount + j] = count + j;
+            }
+            break;
+        case 3:  /* a full directory without the table, so that probing never ends at an empty slot */
+            for (j = 0; j < directoryLength; ++j) {
+                damaged[URES_TABLE_HASHES_DIRECTORY + 2 * j] = (int32_t)(table->fRes + 1);
+            }
+            break;
+        }
+        for (i = 0; i < count; ++i) {
+            const char *key;
+            int32_t index = -1;
+            item = ures_getByIndex(table, i, item, &status);
+            key = ures_getKey(item);
+            if (res_getTableItemByKey(&resData, table->fRes, &index, &key) == RES_BOGUS || index != i) {
+                log_err("damage %d: tablehash/currencies/%s not found at index %d, got %d\n",
+                        (int)damage, ures_getKey(item), (int)i, (int)index);
+            }
+        }
+    }
+    uprv_free(damaged);
+    ures_close(item);
+    ures_close(table);
+    ures_close(bundle);
+}
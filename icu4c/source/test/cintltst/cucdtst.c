@@ -63,6 +63,9 @@ static void TestConsistency(void);
 static void TestCaseFolding(void);
 static void TestBinaryCharacterPropertiesAPI(void);
 static void TestIntCharacterPropertiesAPI(void);
+static void TestPropertySnapshotAPI(void);
+static void TestPropertySnapshotData(void);
+static void TestBatchPropertiesAPI(void);
 
 /* internal methods used */
 static int32_t MakeProp(char* str);
@@ -202,6 +205,12 @@ void addUnicodeTest(TestNode** root)
             "tsutil/cucdtst/TestBinaryCharacterPropertiesAPI");
     addTest(root, &TestIntCharacterPropertiesAPI,
             "tsutil/cucdtst/TestIntCharacterPropertiesAPI");
+    addTest(root, &TestPropertySnapshotAPI,
+            "tsutil/cucdtst/TestPropertySnapshotAPI");
+    addTest(root, &TestPropertySnapshotData,
+            "tsutil/cucdtst/TestPropertySnapshotData");
+    addTest(root, &TestBatchPropertiesAPI,
+            "tsutil/cucdtst/TestBatchPropertiesAPI");
 }
 
 /*==================================================== */
@@ -1948,6 +1957,12 @@ TestCharNames() {
             if(buf[0]==' ' || buf[0]=='\t' || buf[len-1]==' ' || buf[len-1]=='\t') {
                 log_err("u_charName(U+%04x) returns a name with leading or trailing whitespace\n", cp);
             }
+
+            /* test that u_charFromName() maps each name back to its code point */
+            if(u_charFromName(U_EXTENDED_CHAR_NAME, buf, &ec)!=cp || U_FAILURE(ec)) {
+                log_err("u_charFromName(%s) does not round-trip to U+%04x - %s\n", buf, cp, u_errorName(ec));
+                ec=U_ZERO_ERROR;
+            }
         }
 
         if(map[(uint8_t)'\t']) {
@@ -3607,3 +3622,206 @@ static void TestIntCharacterPropertiesAPI() {
         log_err("u_getIntPropertyMap(UCHAR_GENERAL_CATEGORY) wrong contents\n");
     }
 }
+
+static void TestPropertySnapshotAPI() {
+    UErrorCode errorCode = U_ZERO_ERROR;
+    int32_t length = u_writePropertySnapshot(NULL, 0, &errorCode);
+    uint32_t *snapshot;
+    const USet *set;
+    const UCPMap *map;
+    USet *pattern;
+    int32_t luSize;
+    static const UChar lu[] = { 0x5b, 0x3a, 0x4c, 0x75, 0x3a, 0x5d, 0 };  // "[:Lu:]"
+    if (errorCode != U_BUFFER_OVERFLOW_ERROR || length <= 0) {
+        log_err_status(errorCode, "u_writePropertySnapshot(preflighting) failed - %s\n",
+                       u_errorName(errorCode));
+        return;
+    }
+    // The snapshot must stay valid until u_cleanup().
+    snapshot = (uint32_t *)malloc(length);
+    errorCode = U_ZERO_ERROR;
+    if (snapshot == NULL || u_writePropertySnapshot(snapshot, length, &errorCode) != length ||
+            U_FAILURE(errorCode)) {
+        log_err("u_writePropertySnapshot() failed - %s\n", u_errorName(errorCode));
+        free(snapshot);
+        return;
+    }
+
+    pattern = uset_openPattern(lu, -1, &errorCode);
+    luSize = uset_size(pattern);
+    uset_close(pattern);
+
+    // Use the snapshot in a fresh ICU.
+    ctest_resetICU();
+    u_setPropertySnapshot(snapshot, length - 4, &errorCode);
+    if (errorCode != U_INVALID_FORMAT_ERROR) {
+        log_err("u_setPropertySnapshot(truncated) did not fail\n");
+    }
+    errorCode = U_ZERO_ERROR;
+    u_setPropertySnapshot(snapshot, length, &errorCode);
+    if (U_FAILURE(errorCode)) {
+        log_err("u_setPropertySnapshot() failed - %s\n", u_errorName(errorCode));
+    }
+    set = u_getBinaryPropertySet(UCHAR_WHITE_SPACE, &errorCode);
+    if (U_FAILURE(errorCode) || !uset_contains(set, 0x20) || uset_contains(set, 0x61) ||
+            !uset_isFrozen(set)) {
+        log_err("u_getBinaryPropertySet(UCHAR_WHITE_SPACE) from the snapshot is wrong\n");
+    }
+    map = u_getIntPropertyMap(UCHAR_GENERAL_CATEGORY, &errorCode);
+    if (U_FAILURE(errorCode) ||
+            ucpmap_get(map, 0x20) != U_SPACE_SEPARATOR || ucpmap_get(map, 0x23456) != U_OTHER_LETTER) {
+        log_err("u_getIntPropertyMap(UCHAR_GENERAL_CATEGORY) from the snapshot is wrong\n");
+    }
+    pattern = uset_openPattern(lu, -1, &errorCode);
+    if (U_FAILURE(errorCode) || !uset_contains(pattern, 0x41) || uset_contains(pattern, 0x61) ||
+            uset_size(pattern) != luSize) {
+        log_err("[:Lu:] built with the snapshot inclusions is wrong - %s\n", u_errorName(errorCode));
+    }
+    uset_close(pattern);
+
+    // A snapshot is tied to the platform type.
+    ((uint8_t *)snapshot)[8] = !U_IS_BIG_ENDIAN;
+    errorCode = U_ZERO_ERROR;
+    u_setPropertySnapshot(snapshot, length, &errorCode);
+    if (errorCode != U_INVALID_FORMAT_ERROR) {
+        log_err("u_setPropertySnapshot(wrong endianness) did not fail\n");
+    }
+    ctest_resetICU();
+    free(snapshot);
+}
+
+// The property sets and maps come from the snapshot in the ICU data.
+// Check them against the properties of every code point.
+static void TestPropertySnapshotData() {
+    UErrorCode errorCode = U_ZERO_ERROR;
+    UDataMemory *data = udata_open(NULL, "icu", "cpsnap", &errorCode);
+    UProperty prop;
+    UChar32 c;
+    if (U_FAILURE(errorCode)) {
+        log_data_err("unable to open the character property snapshot cpsnap.icu - %s\n",
+                     u_errorName(errorCode));
+        return;
+    }
+    udata_close(data);
+    for (prop = UCHAR_BINARY_START; prop < UCHAR_BINARY_LIMIT; ++prop) {
+        const USet *set = u_getBinaryPropertySet(prop, &errorCode);
+        if (U_FAILURE(errorCode)) {
+            log_err("u_getBinaryPropertySet(%d) failed - %s\n", (int)prop, u_errorName(errorCode));
+            return;
+        }
+        for (c = 0; c <= 0x10ffff; ++c) {
+            if (uset_contains(set, c) != u_hasBinaryProperty(c, prop)) {
+                log_err("u_getBinaryPropertySet(%d) differs from u_hasBinaryProperty(U+%04lx)\n",
+                        (int)prop, (long)c);
+                break;
+            }
+        }
+    }
+    for (prop = UCHAR_INT_START; prop < UCHAR_INT_LIMIT; ++prop) {
+        const UCPMap *map = u_getIntPropertyMap(prop, &errorCode);
+        if (U_FAILURE(errorCode)) {
+            log_err("u_getIntPropertyMap(%d) failed - %s\n", (int)prop, u_errorName(errorCode));
+            return;
+        }
+        for (c = 0; c <= 0x10ffff; ++c) {
+            if ((int32_t)ucpmap_get(map, c) != u_getIntPropertyValue(c, prop)) {
+                log_err("u_getIntPropertyMap(%d) differs from u_getIntPropertyValue(U+%04lx)\n",
+                        (int)prop, (long)c);
+                break;
+            }
+        }
+    }
+}
+
+static void TestBatchPropertiesAPI() {
+    // "a1 " U+00E9 U+4E00 U+1F600 U+0301 unpaired-lead-surrogate "Z"
+    static const UChar s16[] = {
+        0x61, 0x31, 0x20, 0xe9, 0x4e00, 0xd83d, 0xde00, 0x301, 0xd800, 0x5a, 0
+    };
+    // Same text in UTF-8, with an ill-formed three-byte prefix instead of the surrogate
+    static const char s8[] =
+        "a1 \xc3\xa9\xe4\xb8\x80\xf0\x9f\x98\x80\xcc\x81\xed\xa0\x80Z";
+    static const UProperty binaryProps[] = {
+        UCHAR_ALPHABETIC, UCHAR_WHITE_SPACE, UCHAR_EMOJI, UCHAR_LOWERCASE, UCHAR_NFC_INERT
+    };
+    int8_t types[32];
+    UBool values[32];
+    UErrorCode errorCode = U_ZERO_ERROR;
+    int32_t length = u_charTypes(s16, -1, types, &errorCode);
+    int32_t i, j, p;
+    if (U_FAILURE(errorCode) || length != UPRV_LENGTHOF(s16) - 1) {
+        log_err("u_charTypes() failed - %s, length %d\n", u_errorName(errorCode), (int)length);
+        return;
+    }
+    for (i = 0; i < length;) {
+        int32_t start = i;
+        UChar32 c;
+        U16_NEXT(s16, i, length, c);
+        for (j = start; j < i; ++j) {
+            if (types[j] != u_charType(c)) {
+                log_err("u_charTypes()[%d]=%d != u_charType(U+%04lx)\n", (int)j, types[j], (long)c);
+            }
+        }
+    }
+    length = u_charTypesUTF8(s8, -1, types, &errorCode);
+    if (U_FAILURE(errorCode) || length != UPRV_LENGTHOF(s8) - 1) {
+        log_err("u_charTypesUTF8() failed - %s, length %d\n", u_errorName(errorCode), (int)length);
+        return;
+    }
+    for (i = 0; i < length;) {
+        int32_t start = i;
+        UChar32 c;
+        U8_NEXT(s8, i, length, c);
+        for (j = start; j < i; ++j) {
+            if (types[j] != (c < 0 ? U_UNASSIGNED : u_charType(c))) {
+                log_err("u_charTypesUTF8()[%d]=%d != u_charType(U+%04lx)\n", (int)j, types[j], (long)c);
+            }
+        }
+    }
+
+    for (p = 0; p < UPRV_LENGTHOF(binaryProps); ++p) {
+        UProperty which = binaryProps[p];
+        length = u_hasBinaryProperties(s16, UPRV_LENGTHOF(s16) - 1, which, values, &errorCode);
+        if (U_FAILURE(errorCode) || length != UPRV_LENGTHOF(s16) - 1) {
+            log_err("u_hasBinaryProperties(%d) failed - %s\n", (int)which, u_errorName(errorCode));
+            return;
+        }
+        for (i = 0; i < length;) {
+            int32_t start = i;
+            UChar32 c;
+            U16_NEXT(s16, i, length, c);
+            for (j = start; j < i; ++j) {
+                if (values[j] != u_hasBinaryProperty(c, which)) {
+                    log_err("u_hasBinaryProperties(%d)[%d] != u_hasBinaryProperty(U+%04lx)\n",
+                            (int)which, (int)j, (long)c);
+                }
+            }
+        }
+        length = u_hasBinaryPropertiesUTF8(s8, UPRV_LENGTHOF(s8) - 1, which, values, &errorCode);
+        if (U_FAILURE(errorCode) || length != UPRV_LENGTHOF(s8) - 1) {
+            log_err("u_hasBinaryPropertiesUTF8(%d) failed - %s\n", (int)which, u_errorName(errorCode));
+            return;
+        }
+        for (i = 0; i < length;) {
+            int32_t start = i;
+            UChar32 c;
+            U8_NEXT(s8, i, length, c);
+            for (j = start; j < i; ++j) {
+                if (values[j] != (c >= 0 && u_hasBinaryProperty(c, which))) {
+                    log_err("u_hasBinaryPropertiesUTF8(%d)[%d] != u_hasBinaryProperty(U+%04lx)\n",
+                            (int)which, (int)j, (long)c);
+                }
+            }
+        }
+    }
+
+    u_hasBinaryProperties(s16, -1, UCHAR_BINARY_LIMIT, values, &errorCode);
+    if (errorCode != U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("u_hasBinaryProperties(UCHAR_BINARY_LIMIT) did not fail\n");
+    }
+    errorCode = U_ZERO_ERROR;
+    u_charTypes(NULL, 3, types, &errorCode);
+    if (errorCode != U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("u_charTypes(NULL) did not fail\n");
+    }
+}
@@ -44,6 +44,7 @@ static void Test_WCHART_LongString(void);
 static void Test_strToJavaModifiedUTF8(void);
 static void Test_strFromJavaModifiedUTF8(void);
 static void TestNullEmptySource(void);
+static void Test_UTF8ASCIIRuns(void);
 
 void 
 addUCharTransformTest(TestNode** root)
@@ -63,6 +64,7 @@ addUCharTransformTest(TestNode** root)
    addTest(root, &Test_strToJavaModifiedUTF8,  "custrtrn/Test_strToJavaModifiedUTF8");
    addTest(root, &Test_strFromJavaModifiedUTF8,  "custrtrn/Test_strFromJavaModifiedUTF8");
    addTest(root, &TestNullEmptySource,  "custrtrn/TestNullEmptySource");
+   addTest(root, &Test_UTF8ASCIIRuns,  "custrtrn/Test_UTF8ASCIIRuns");
 }
 
 static const UChar32 src32[]={
@@ -2114,3 +2116,86 @@ static void TestNullEmptySource() {
 
 #endif
 }
+
+/*
+ * The UTF-8 <-> UTF-16 conversion functions process runs of ASCII
+ * a word at a time. Exercise runs of various lengths and alignments,
+ * with non-ASCII characters and ill-formed bytes in between,
+ * and with exact and too-small destination capacities.
+ */
+static void Test_UTF8ASCIIRuns() {
+    static const char *const between8[]={ "\xc3\xa4", "\xe2\x82\xac", "\xf0\x9f\x98\x80", "\x80" };
+    static const UChar between16[][2]={ { 0xe4, 0 }, { 0x20ac, 0 }, { 0xd83d, 0xde00 }, { 0xfffd, 0 } };
+    char in8[200], dest8[200];
+    UChar in16[200], dest16[200];
+    int32_t offset, runLength, b;
+    for(b=0; b<UPRV_LENGTHOF(between8); ++b) {
+        for(offset=0; offset<8; ++offset) {
+            for(runLength=0; runLength<40; ++runLength) {
+                int32_t length8=0, length16=0, i, length;
+                UErrorCode errorCode;
+                for(i=0; i<offset; ++i) {
+                    in8[length8++]=in16[length16++]=(char)(0x61+i);
+                }
+                for(i=0; between8[b][i]!=0; ++i) {
+                    in8[length8++]=between8[b][i];
+                }
+                for(i=0; i<2 && between16[b][i]!=0; ++i) {
+                    in16[length16++]=between16[b][i];
+                }
+                for(i=0; i<runLength; ++i) {
+                    in8[length8]=(char)(0x20+(i*7)%0x5f);
+                    in16[length16++]=(UChar)(uint8_t)in8[length8++];
+                }
+                in8[length8++]=(char)0xc3;
+                in8[length8++]=(char)0xb6;
+                in16[length16++]=0xf6;
+
+                /* UTF-8 -> UTF-16 */
+                errorCode=U_ZERO_ERROR;
+                u_strFromUTF8WithSub(dest16, UPRV_LENGTHOF(dest16), &length,
+                                     in8, length8, 0xfffd, NULL, &errorCode);
+                if(U_FAILURE(errorCode) || length!=length16 ||
+                        0!=u_memcmp(dest16, in16, length16)) {
+                    log_err("u_strFromUTF8WithSub(between[%d], offset %d, run %d) failed - %s\n",
+                            (int)b, (int)offset, (int)runLength, u_errorName(errorCode));
+                }
+                errorCode=U_ZERO_ERROR;
+                u_strFromUTF8WithSub(NULL, 0, &length, in8, length8, 0xfffd, NULL, &errorCode);
+                if(errorCode!=U_BUFFER_OVERFLOW_ERROR || length!=length16) {
+                    log_err("u_strFromUTF8WithSub(preflight, between[%d], offset %d, run %d) failed - %s\n",
+                            (int)b, (int)offset, (int)runLength, u_errorName(errorCode));
+                }
+                errorCode=U_ZERO_ERROR;
+                u_strFromUTF8WithSub(dest16, length16-1, &length, in8, length8, 0xfffd, NULL, &errorCode);
+                if(errorCode!=U_BUFFER_OVERFLOW_ERROR || length!=length16) {
+                    log_err("u_strFromUTF8WithSub(short, between[%d], offset %d, run %d) failed - %s\n",
+                            (int)b, (int)offset, (int)runLength, u_errorName(errorCode));
+                }
+
+                if(between16[b][0]==0xfffd) {
+                    continue;  /* no UTF-16 -> UTF-8 round trip for ill-formed input */
+                }
+                /* UTF-16 -> UTF-8 */
+                errorCode=U_ZERO_ERROR;
+                u_strToUTF8(dest8, UPRV_LENGTHOF(dest8), &length, in16, length16, &errorCode);
+                if(U_FAILURE(errorCode) || length!=length8 || 0!=uprv_memcmp(dest8, in8, length8)) {
+                    log_err("u_strToUTF8(between[%d], offset %d, run %d) failed - %s\n",
+                            (int)b, (int)offset, (int)runLength, u_errorName(errorCode));
+                }
+                errorCode=U_ZERO_ERROR;
+                u_strToUTF8(NULL, 0, &length, in16, length16, &errorCode);
+                if(errorCode!=U_BUFFER_OVERFLOW_ERROR || length!=length8) {
+                    log_err("u_strToUTF8(preflight, between[%d], offset %d, run %d) failed - %s\n",
+                            (int)b, (int)offset, (int)runLength, u_errorName(errorCode));
+                }
+                errorCode=U_ZERO_ERROR;
+                u_strToUTF8(dest8, length8-1, &length, in16, length16, &errorCode);
+                if(errorCode!=U_BUFFER_OVERFLOW_ERROR || length!=length8) {
+                    log_err("u_strToUTF8(short, between[%d], offset %d, run %d) failed - %s\n",
+                            (int)b, (int)offset, (int)runLength, u_errorName(errorCode));
+                }
+            }
+        }
+    }
+}
@@ -15,6 +15,8 @@
 #include "unicode/uclean.h"
 #include "unicode/uchar.h"
 #include "unicode/ures.h"
+#include "unicode/ucnv.h"
+#include "unicode/ucounter.h"
 #include "cintltst.h"
 #include "unicode/utrace.h"
 #include <stdlib.h>
@@ -30,6 +32,7 @@ typedef union {
 } ctest_AlignedMemory;
 
 static void TestHeapFunctions(void);
+static void TestCounters(void);
 
 void addHeapMutexTest(TestNode **root);
 
@@ -38,6 +41,7 @@ void
 addHeapMutexTest(TestNode** root)
 {
     addTest(root, &TestHeapFunctions,       "hpmufn/TestHeapFunctions"  );
+    addTest(root, &TestCounters,            "hpmufn/TestCounters"  );
 }
 
 static int32_t gMutexFailures = 0;
@@ -197,3 +201,48 @@ static void TestHeapFunctions() {
 }
 
 
+/*
+ *  Test the per-thread counters.
+ *  They only move when ICU is built with U_ENABLE_COUNTERS.
+ */
+static void TestCounters() {
+    UErrorCode status = U_ZERO_ERROR;
+    int64_t before[UCOUNTER_LIMIT];
+    int32_t i;
+    UConverter *cnv;
+    UResourceBundle *rb;
+
+    for (i = 0; i < UCOUNTER_LIMIT; ++i) {
+        before[i] = ucounter_get((UCounterType)i);
+    }
+    cnv = ucnv_open("ISO-8859-1", &status);
+    rb = ures_open(NULL, "en", &status);
+    if (U_FAILURE(status)) {
+        log_data_err("ucnv_open()/ures_open() failed: %s (Are you missing data?)\n", u_errorName(status));
+    } else {
+#if U_ENABLE_COUNTERS
+        if (ucounter_get(UCOUNTER_CONVERTER_OPENS) <= before[UCOUNTER_CONVERTER_OPENS]) {
+            log_err("ucnv_open() did not bump UCOUNTER_CONVERTER_OPENS\n");
+        }
+        if (ucounter_get(UCOUNTER_RESOURCE_BUNDLE_OPENS) <= before[UCOUNTER_RESOURCE_BUNDLE_OPENS]) {
+            log_err("ures_open() did not bump UCOUNTER_RESOURCE_BUNDLE_OPENS\n");
+        }
+        if (ucounter_get(UCOUNTER_ALLOCATIONS) <= before[UCOUNTER_ALLOCATIONS] ||
+                ucounter_get(UCOUNTER_ALLOCATED_BYTES) <= before[UCOUNTER_ALLOCATED_BYTES]) {
+            log_err("opening a converter and a bundle did not bump the allocation counters\n");
+        }
+#else
+        for (i = 0; i < UCOUNTER_LIMIT; ++i) {
+            if (ucounter_get((UCounterType)i) != 0 || before[i] != 0) {
+                log_err("counter %d is not 0 although counters are disabled\n", (int)i);
+            }
+        }
+#endif
+    }
+    ures_close(rb);
+    ucnv_close(cnv);
+
+    if (ucounter_get((UCounterType)-1) != 0 || ucounter_get(UCOUNTER_LIMIT) != 0) {
+        log_err("ucounter_get() of an out-of-range type should return 0\n");
+    }
+}
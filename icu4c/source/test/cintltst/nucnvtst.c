@@ -56,6 +56,8 @@ static void TestLATIN1(void);
 static void TestSBCS(void);
 static void TestDBCS(void);
 static void TestMBCS(void);
+static void TestMBCSASCIIRuns(void);
+static void TestToUTF8Direct(void);
 #if !UCONFIG_NO_LEGACY_CONVERSION && !UCONFIG_NO_FILE_IO
 static void TestICCRunout(void);
 #endif
@@ -282,6 +284,8 @@ void addTestNewConvert(TestNode** root)
    addTest(root, &TestICCRunout, "tsconv/nucnvtst/TestICCRunout");
 #endif
    addTest(root, &TestMBCS, "tsconv/nucnvtst/TestMBCS");
+   addTest(root, &TestMBCSASCIIRuns, "tsconv/nucnvtst/TestMBCSASCIIRuns");
+   addTest(root, &TestToUTF8Direct, "tsconv/nucnvtst/TestToUTF8Direct");
 
 #ifdef U_ENABLE_GENERIC_ISO_2022
    addTest(root, &TestISO_2022, "tsconv/nucnvtst/TestISO_2022");
@@ -2662,6 +2666,178 @@ TestMBCS() {
 
 }
 
+/*
+ * Runs of ASCII are converted a word at a time.
+ * Check runs of various lengths between non-ASCII characters, with offsets,
+ * including ASCII characters that share asciiRoundtrips bits with ones
+ * that do not round-trip (like 0x5C and 0x7E in Shift-JIS).
+ */
+static void
+TestMBCSASCIIRuns() {
+    static const struct {
+        const char *name;
+        UChar nonASCII;
+        uint8_t bytes[2];
+        int32_t length;
+    } cases[]={
+        { "ibm-943_P15A-2003", 0x65e5, { 0x93, 0xfa }, 2 },
+        { "ibm-5348_P100-1997", 0xe9, { 0xe9, 0 }, 1 },
+        { "ibm-1363", 0xac00, { 0xb0, 0xa1 }, 2 }
+    };
+    static const char ascii[]="Lorem ipsum_dolor^sit]amet,[consectetur-adipiscing\telit.\n";
+    UChar u[800], uOut[800];
+    char b[1000], bOut[1000], u8[2000];
+    int32_t bOffsets[1000], expOffsets[1000], uOffsets[800];
+    int32_t c, i, run, uLength, bLength, u8Length, length;
+    for(c=0; c<UPRV_LENGTHOF(cases); ++c) {
+        UErrorCode errorCode=U_ZERO_ERROR;
+        UConverter *cnv=ucnv_open(cases[c].name, &errorCode);
+        if(U_FAILURE(errorCode)) {
+            log_data_err("Unable to open a %s converter: %s\n", cases[c].name, u_errorName(errorCode));
+            continue;
+        }
+        /* build a string with ASCII runs of lengths 0..23 */
+        uLength=bLength=0;
+        for(run=0; run<24; ++run) {
+            for(i=0; i<run; ++i) {
+                char a=ascii[(run+i)%(UPRV_LENGTHOF(ascii)-1)];
+                expOffsets[bLength]=uLength;
+                b[bLength++]=a;
+                u[uLength++]=(UChar)(uint8_t)a;
+            }
+            for(i=0; i<cases[c].length; ++i) {
+                expOffsets[bLength]=uLength;
+                b[bLength++]=(char)cases[c].bytes[i];
+            }
+            u[uLength++]=cases[c].nonASCII;
+        }
+
+        /* to Unicode */
+        {
+            const char *source=b;
+            UChar *target=uOut;
+            ucnv_toUnicode(cnv, &target, uOut+UPRV_LENGTHOF(uOut), &source, b+bLength,
+                           uOffsets, TRUE, &errorCode);
+            length=(int32_t)(target-uOut);
+            if(U_FAILURE(errorCode) || length!=uLength || 0!=u_memcmp(u, uOut, uLength)) {
+                log_err("%s: ucnv_toUnicode(ASCII runs) failed - %s\n", cases[c].name, u_errorName(errorCode));
+            } else {
+                /* each UChar comes from the first byte of its character */
+                int32_t j=0;
+                for(i=0; i<uLength; ++i) {
+                    if(uOffsets[i]!=j) {
+                        log_err("%s: ucnv_toUnicode(ASCII runs) offsets[%d]=%d != %d\n",
+                                cases[c].name, (int)i, (int)uOffsets[i], (int)j);
+                        break;
+                    }
+                    j+= u[i]<0x80 ? 1 : cases[c].length;
+                }
+            }
+        }
+
+        /* from Unicode */
+        {
+            const UChar *source=u;
+            char *target=bOut;
+            ucnv_fromUnicode(cnv, &target, bOut+UPRV_LENGTHOF(bOut), &source, u+uLength,
+                             bOffsets, TRUE, &errorCode);
+            length=(int32_t)(target-bOut);
+            if(U_FAILURE(errorCode) || length!=bLength || 0!=uprv_memcmp(b, bOut, bLength) ||
+                    0!=uprv_memcmp(expOffsets, bOffsets, bLength*4)) {
+                log_err("%s: ucnv_fromUnicode(ASCII runs) failed - %s\n", cases[c].name, u_errorName(errorCode));
+            }
+        }
+
+        /* from UTF-8 */
+        u_strToUTF8(u8, UPRV_LENGTHOF(u8), &u8Length, u, uLength, &errorCode);
+        length=ucnv_convert(cases[c].name, "UTF-8", bOut, UPRV_LENGTHOF(bOut), u8, u8Length, &errorCode);
+        if(U_FAILURE(errorCode) || length!=bLength || 0!=uprv_memcmp(b, bOut, bLength)) {
+            log_err("%s: conversion from UTF-8 (ASCII runs) failed - %s\n", cases[c].name, u_errorName(errorCode));
+        }
+        ucnv_close(cnv);
+    }
+}
+
+/*
+ * Conversion from some charsets to UTF-8 does not pivot through UTF-16
+ * for most characters. Compare with explicit conversion via UTF-16,
+ * including unmappable and illegal sequences and small target buffers.
+ */
+static void
+TestToUTF8Direct() {
+    static const struct {
+        const char *name;
+        const char *bytes;
+    } cases[]={
+        { "windows-1252", "ASCII text \x80uro \xe9t\xe9 \x81 \x9f\xff\x7f" },
+        { "ISO-8859-1", "caf\xe9 \xa0\xff\x80 plain ASCII text\x00." },
+        { "US-ASCII", "plain ASCII text, then \x80 and \xff." },
+        { "ibm-943_P15A-2003", "Shift-JIS \x93\xfa\x96\x7b\x8c\xea \x85\x40 \xff \x82\xa0 text \x93" },
+        { "gb18030", "GB \xd6\xd0\xce\xc4 \x81\x30\x81\x30 \x95\x32\x82\x36 \xa1\xa1 text \x80\xff \xd6" }
+    };
+    UChar u[200];
+    char expected[400], out[400];
+    int32_t c, capacity, uLength, expLength, length;
+    for(c=0; c<UPRV_LENGTHOF(cases); ++c) {
+        UErrorCode errorCode=U_ZERO_ERROR;
+        UConverter *cnv=ucnv_open(cases[c].name, &errorCode);
+        UConverter *utf8=ucnv_open("UTF-8", &errorCode);
+        int32_t bLength=(int32_t)uprv_strlen(cases[c].bytes);
+        if(U_FAILURE(errorCode)) {
+            log_data_err("Unable to open a %s or UTF-8 converter: %s\n", cases[c].name, u_errorName(errorCode));
+            ucnv_close(cnv);
+            ucnv_close(utf8);
+            continue;
+        }
+        uLength=ucnv_toUChars(cnv, u, UPRV_LENGTHOF(u), cases[c].bytes, bLength, &errorCode);
+        u_strToUTF8(expected, UPRV_LENGTHOF(expected), &expLength, u, uLength, &errorCode);
+        if(U_FAILURE(errorCode)) {
+            log_err("%s: conversion via UTF-16 failed - %s\n", cases[c].name, u_errorName(errorCode));
+            ucnv_close(cnv);
+            ucnv_close(utf8);
+            continue;
+        }
+
+        /* convert into target buffers of 1..8 bytes and then unlimited */
+        for(capacity=1; capacity<=9; ++capacity) {
+            const char *source=cases[c].bytes;
+            char *target=out;
+            UChar pivot[8];
+            UChar *pivotSource=pivot, *pivotTarget=pivot;
+            ucnv_resetToUnicode(cnv);
+            ucnv_resetFromUnicode(utf8);
+            errorCode=U_ZERO_ERROR;
+            do {
+                char *targetLimit= capacity<=8 ? target+capacity : out+UPRV_LENGTHOF(out);
+                if(targetLimit>out+UPRV_LENGTHOF(out)) {
+                    targetLimit=out+UPRV_LENGTHOF(out);
+                }
+                errorCode=U_ZERO_ERROR;
+                ucnv_convertEx(utf8, cnv, &target, targetLimit, &source, cases[c].bytes+bLength,
+                               pivot, &pivotSource, &pivotTarget, pivot+UPRV_LENGTHOF(pivot),
+                               FALSE, TRUE, &errorCode);
+            } while(errorCode==U_BUFFER_OVERFLOW_ERROR && target<out+UPRV_LENGTHOF(out));
+            length=(int32_t)(target-out);
+            if(U_FAILURE(errorCode) || length!=expLength || 0!=uprv_memcmp(expected, out, expLength)) {
+                log_err("%s: direct conversion to UTF-8 with target capacity %d differs from "
+                        "conversion via UTF-16 - %s\n",
+                        cases[c].name, (int)capacity, u_errorName(errorCode));
+            }
+        }
+
+        /* the one-shot API */
+        errorCode=U_ZERO_ERROR;
+        length=ucnv_convert("UTF-8", cases[c].name, out, UPRV_LENGTHOF(out),
+                            cases[c].bytes, bLength, &errorCode);
+        if(U_FAILURE(errorCode) || length!=expLength || 0!=uprv_memcmp(expected, out, expLength)) {
+            log_err("%s: ucnv_convert() to UTF-8 differs from conversion via UTF-16 - %s\n",
+                    cases[c].name, u_errorName(errorCode));
+        }
+        ucnv_close(cnv);
+        ucnv_close(utf8);
+    }
+}
+
 #if !UCONFIG_NO_LEGACY_CONVERSION && !UCONFIG_NO_FILE_IO
 static void
 TestICCRunout() {
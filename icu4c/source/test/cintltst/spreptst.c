@@ -41,6 +41,7 @@ static void Test_nfs4_mixed_prep(void);
 static void TestBEAMWarning(void);
 static void TestCoverage(void);
 static void TestStringPrepProfiles(void);
+static void TestStringPrepErrors(void);
 
 UStringPrepProfileType getTypeFromProfileName(const char* profileName);
 
@@ -58,6 +59,7 @@ addUStringPrepTest(TestNode** root)
 #endif
    addTest(root, &TestCoverage,              "spreptst/TestCoverage");
    addTest(root, &TestStringPrepProfiles,              "spreptst/TestStringPrepProfiles");
+   addTest(root, &TestStringPrepErrors,      "spreptst/TestStringPrepErrors");
 }
 
 static void 
@@ -809,6 +811,53 @@ static void TestStringPrepProfiles(void) {
     }
 }
 
+/*
+ * The checks for prohibited characters and bidi run during mapping
+ * while the string is unchanged, and in a separate pass otherwise.
+ * Both must report the same errors at the same offsets.
+ */
+static void TestStringPrepErrors(void) {
+    static const struct {
+        const char *src;
+        UErrorCode expected;
+        int32_t offset;
+    } cases[] = {
+        { "ab\\u0007cd", U_STRINGPREP_PROHIBITED_ERROR, 2 },
+        { "\\u00A0ab\\u0007cd", U_STRINGPREP_PROHIBITED_ERROR, 3 },
+        /* unassigned code points are reported before prohibited ones */
+        { "ab\\u0007c\\u0221", U_STRINGPREP_UNASSIGNED_ERROR, 4 },
+        { "\\u05D0\\u05D1", U_ZERO_ERROR, 0 },
+        { "\\u05D0\\u00A0\\u05D1", U_ZERO_ERROR, 0 },
+        { "ab\\u05D0", U_STRINGPREP_CHECK_BIDI_ERROR, 2 },
+        { "\\u05D0 ab", U_STRINGPREP_CHECK_BIDI_ERROR, 3 },
+        { "\\u05D01", U_STRINGPREP_CHECK_BIDI_ERROR, 0 },
+        { "\\u05D0\\u00A01", U_STRINGPREP_CHECK_BIDI_ERROR, 0 }
+    };
+    UErrorCode status = U_ZERO_ERROR;
+    UStringPrepProfile *sprep = usprep_openByType(USPREP_RFC4013_SASLPREP, &status);
+    int32_t i;
+    if (U_FAILURE(status)) {
+        log_data_err("Unable to open SASLprep profile - %s\n", u_errorName(status));
+        return;
+    }
+    for (i = 0; i < UPRV_LENGTHOF(cases); ++i) {
+        UChar src[32], dest[32];
+        UParseError parseError;
+        int32_t srcLength = u_unescape(cases[i].src, src, UPRV_LENGTHOF(src));
+        status = U_ZERO_ERROR;
+        parseError.offset = -1;
+        usprep_prepare(sprep, src, srcLength, dest, UPRV_LENGTHOF(dest), USPREP_DEFAULT, &parseError, &status);
+        if (status != cases[i].expected) {
+            log_err("usprep_prepare(%s) failed with %s, expected %s\n",
+                    cases[i].src, u_errorName(status), u_errorName(cases[i].expected));
+        } else if (U_FAILURE(status) && parseError.offset != cases[i].offset) {
+            log_err("usprep_prepare(%s) error at offset %d, expected %d\n",
+                    cases[i].src, (int)parseError.offset, (int)cases[i].offset);
+        }
+    }
+    usprep_close(sprep);
+}
+
 #endif
 
 /*
@@ -374,6 +374,8 @@ static void TestTraceAPI() {
         TEST_ASSERT(strcmp(name, "ucnv_open") == 0);
         name = utrace_functionName(UTRACE_UCOL_GET_SORTKEY);
         TEST_ASSERT(strcmp(name, "ucol_getSortKey") == 0);
+        name = utrace_functionName(UTRACE_UCACHE_GET);
+        TEST_ASSERT(strcmp(name, "ucache_get") == 0);
     }
 
 
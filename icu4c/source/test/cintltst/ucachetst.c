@@ -0,0 +1,168 @@
+// © 2019 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+
+// ucachetst.c
+
+#include "unicode/utypes.h"
+#include "unicode/ucache.h"
+#include "unicode/ucachepreload.h"
+#include "unicode/upluralrules.h"
+#include "cintltst.h"
+#include "cmemory.h"
+
+static void TestCacheStats(void);
+static void TestCacheKeyTypeStats(void);
+#if !UCONFIG_NO_FORMATTING
+static void TestCachePreload(void);
+#endif
+
+void addUCacheTest(TestNode** root);
+
+void addUCacheTest(TestNode** root)
+{
+    addTest(root, &TestCacheStats,        "tsutil/UCacheTest/TestCacheStats");
+    addTest(root, &TestCacheKeyTypeStats, "tsutil/UCacheTest/TestCacheKeyTypeStats");
+#if !UCONFIG_NO_FORMATTING
+    addTest(root, &TestCachePreload,      "tsutil/UCacheTest/TestCachePreload");
+#endif
+}
+
+static void TestCacheStats() {
+    UErrorCode status = U_ZERO_ERROR;
+    UCacheStats before, after;
+    ucache_getStats(&before, &status);
+    if (U_FAILURE(status)) {
+        log_err("ucache_getStats() failed: %s\n", u_errorName(status));
+        return;
+    }
+#if !UCONFIG_NO_FORMATTING
+    {
+        int32_t i;
+        // The first open may create the rules, the others must hit.
+        for (i = 0; i < 3; ++i) {
+            UPluralRules *rules = uplrules_open("fr", &status);
+            uplrules_close(rules);
+        }
+        if (U_FAILURE(status)) {
+            log_data_err("uplrules_open(fr) failed: %s\n", u_errorName(status));
+            return;
+        }
+        ucache_getStats(&after, &status);
+        if (U_FAILURE(status)) {
+            log_err("ucache_getStats() failed: %s\n", u_errorName(status));
+            return;
+        }
+        if (after.hits < before.hits + 2) {
+            log_err("expected at least 2 more cache hits, got %ld\n",
+                    (long)(after.hits - before.hits));
+        }
+        if (after.hitsWithoutLock > after.hits || after.keyCount <= 0 ||
+                after.unusedCount > after.keyCount || after.memoryFootprint <= 0) {
+            log_err("inconsistent cache statistics\n");
+        }
+    }
+#endif
+
+    status = U_ZERO_ERROR;
+    ucache_getStats(NULL, &status);
+    if (status != U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("ucache_getStats(NULL) should fail with U_ILLEGAL_ARGUMENT_ERROR, got %s\n",
+                u_errorName(status));
+    }
+}
+
+static void TestCacheKeyTypeStats() {
+    UErrorCode status = U_ZERO_ERROR;
+    UCacheKeyTypeStats types[64];
+    int32_t i, count, keyCount = 0;
+    UCacheStats stats;
+
+#if !UCONFIG_NO_FORMATTING
+    UPluralRules *rules = uplrules_open("de", &status);
+    uplrules_close(rules);
+    status = U_ZERO_ERROR;
+#endif
+    count = ucache_getKeyTypeStats(NULL, 0, &status);
+    if (status != U_BUFFER_OVERFLOW_ERROR && !(status == U_ZERO_ERROR && count == 0)) {
+        log_err("ucache_getKeyTypeStats() preflighting failed: %s\n", u_errorName(status));
+        return;
+    }
+    status = U_ZERO_ERROR;
+    count = ucache_getKeyTypeStats(types, UPRV_LENGTHOF(types), &status);
+    if (U_FAILURE(status)) {
+        log_err("ucache_getKeyTypeStats() failed: %s\n", u_errorName(status));
+        return;
+    }
+    for (i = 0; i < count; ++i) {
+        if (types[i].typeName == NULL || types[i].keyCount <= 0) {
+            log_err("bad key type statistics at index %d\n", (int)i);
+        }
+        keyCount += types[i].keyCount;
+    }
+    ucache_getStats(&stats, &status);
+    // Other threads do not use the cache while this test runs.
+    if (U_SUCCESS(status) && keyCount != stats.keyCount) {
+        log_err("key type counts add up to %d, expected %d\n", (int)keyCount, (int)stats.keyCount);
+    }
+
+    status = U_ZERO_ERROR;
+    ucache_getKeyTypeStats(NULL, 1, &status);
+    if (status != U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("ucache_getKeyTypeStats(NULL, 1) should fail with U_ILLEGAL_ARGUMENT_ERROR, got %s\n",
+                u_errorName(status));
+    }
+}
+
+#if !UCONFIG_NO_FORMATTING
+
+static void U_CALLCONV countingExecutor(const void *context, UCachePreloadTask *task) {
+    ++*(int32_t *)context;
+    ucache_runPreloadTask(task);
+}
+
+static void TestCachePreload() {
+    static const char *const locales[] = { "sv", "fi_FI" };
+    UErrorCode status = U_ZERO_ERROR;
+    int32_t taskCount = 0;
+    UCacheStats before, after;
+    UCachePin *pin;
+
+    pin = ucache_preload(locales, UPRV_LENGTHOF(locales),
+                         UCACHE_PRELOAD_NUMBER_FORMAT | UCACHE_PRELOAD_PLURAL_RULES,
+                         countingExecutor, &taskCount, &status);
+    if (U_FAILURE(status)) {
+        log_data_err("ucache_preload() failed: %s\n", u_errorName(status));
+        return;
+    }
+    if (pin == NULL || taskCount != 4) {
+        log_err("ucache_preload() should run 4 tasks, ran %d\n", (int)taskCount);
+    }
+
+    // The pinned plural rules must now be served from the cache.
+    ucache_getStats(&before, &status);
+    uplrules_close(uplrules_open("fi_FI", &status));
+    ucache_getStats(&after, &status);
+    if (U_FAILURE(status)) {
+        log_data_err("uplrules_open(fi_FI) failed: %s\n", u_errorName(status));
+    } else if (after.misses != before.misses || after.hits <= before.hits) {
+        log_err("plural rules for fi_FI should have been preloaded\n");
+    }
+    ucache_unpin(pin);
+
+    // Without an executor the tasks run on the calling thread.
+    pin = ucache_preload(locales, 1, UCACHE_PRELOAD_ALL, NULL, NULL, &status);
+    if (U_FAILURE(status)) {
+        log_data_err("ucache_preload(UCACHE_PRELOAD_ALL) failed: %s\n", u_errorName(status));
+    }
+    ucache_unpin(pin);
+
+    status = U_ZERO_ERROR;
+    pin = ucache_preload(locales, -1, UCACHE_PRELOAD_ALL, NULL, NULL, &status);
+    if (status != U_ILLEGAL_ARGUMENT_ERROR || pin != NULL) {
+        log_err("ucache_preload(localeCount=-1) should fail with U_ILLEGAL_ARGUMENT_ERROR, got %s\n",
+                u_errorName(status));
+    }
+    ucache_unpin(NULL);
+}
+
+#endif
@@ -36,6 +36,9 @@
 
 /* includes for TestSwapData() */
 #include "udataswp.h"
+#include "udatacmp.h"
+#include "datacompress.h"
+#include "swapimpl.h"
 
 /* swapping implementations in common */
 #include "uresdata.h"
@@ -64,6 +67,9 @@ static void TestUDataOpenChoiceDemo1(void);
 static void TestUDataOpenChoiceDemo2(void);
 static void TestUDataGetInfo(void);
 static void TestUDataGetMemory(void);
+static void TestLoadedItemsAndPrefetch(void);
+static void TestCompressedItem(void);
+static void TestDataOverlay(void);
 static void TestErrorConditions(void);
 static void TestAppData(void);
 static void TestSwapData(void);
@@ -88,6 +94,9 @@ addUDataTest(TestNode** root)
     addTest(root, &TestUDataOpenChoiceDemo2, "udatatst/TestUDataOpenChoiceDemo2"); 
     addTest(root, &TestUDataGetInfo,    "udatatst/TestUDataGetInfo"   );
     addTest(root, &TestUDataGetMemory,  "udatatst/TestUDataGetMemory" );
+    addTest(root, &TestLoadedItemsAndPrefetch, "udatatst/TestLoadedItemsAndPrefetch" );
+    addTest(root, &TestCompressedItem, "udatatst/TestCompressedItem" );
+    addTest(root, &TestDataOverlay, "udatatst/TestDataOverlay" );
     addTest(root, &TestErrorConditions, "udatatst/TestErrorConditions");
     addTest(root, &TestAppData, "udatatst/TestAppData" );
     addTest(root, &TestSwapData, "udatatst/TestSwapData" );
@@ -915,6 +924,61 @@ static void TestUDataGetMemory() {
 
 }
 
+static void TestLoadedItemsAndPrefetch() {
+    static const char *const missingItems[] = { U_ICUDATA_NAME "/no_such_item.icu", "no_such_package/cnvalias.icu" };
+    const char *names[1000];
+    const char *name;
+    UEnumeration *en;
+    UDataMemory *result;
+    UErrorCode status=U_ZERO_ERROR;
+    int32_t i, j, count=0, icuCount=0;
+
+    /* Open some data, which may come from the common data. */
+    result=udata_open(NULL, "icu", "cnvalias", &status);
+    if(U_FAILURE(status)){
+        log_data_err("FAIL: udata_open(cnvalias) failed - %s\n", myErrorName(status));
+        return;
+    }
+    udata_close(result);
+
+    /* Every loaded common data item is reported once. */
+    en=udata_openLoadedItems(&status);
+    if(U_FAILURE(status)){
+        log_err("FAIL: udata_openLoadedItems() failed - %s\n", myErrorName(status));
+        return;
+    }
+    while((name=uenum_next(en, NULL, &status))!=NULL && count<UPRV_LENGTHOF(names)) {
+        for(j=0; j<count; ++j) {
+            if(uprv_strcmp(name, names[j])==0) {
+                log_err("FAIL: udata_openLoadedItems() returned %s twice\n", name);
+            }
+        }
+        names[count++]=name;
+        if(uprv_strncmp(name, U_ICUDATA_NAME "/", uprv_strlen(U_ICUDATA_NAME "/"))==0) {
+            ++icuCount;
+        }
+    }
+    if(U_FAILURE(status) || uenum_count(en, &status)!=count) {
+        log_err("FAIL: udata_openLoadedItems() count is not %d - %s\n", (int)count, myErrorName(status));
+    }
+
+    /* The loaded ICU data items are available for prefetching, and others are ignored. */
+    i=udata_prefetch(names, count, &status);
+    if(U_FAILURE(status) || i!=icuCount) {
+        log_err("FAIL: udata_prefetch(loaded items) found %d of %d - %s\n", (int)i, (int)icuCount, myErrorName(status));
+    }
+    i=udata_prefetch(missingItems, UPRV_LENGTHOF(missingItems), &status);
+    if(U_FAILURE(status) || i!=0) {
+        log_err("FAIL: udata_prefetch(missing items) found %d - %s\n", (int)i, myErrorName(status));
+    }
+    uenum_close(en);
+
+    i=udata_prefetch(NULL, 1, &status);
+    if(status!=U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("FAIL: udata_prefetch(NULL, 1) set %s rather than U_ILLEGAL_ARGUMENT_ERROR\n", myErrorName(status));
+    }
+}
+
 static void TestErrorConditions(){
 
     UDataMemory *result=NULL;
@@ -1305,6 +1369,8 @@ static const struct {
     {"root",                     "res", ures_swap},
     /* Test a 32-bit key table. This is large. */
     {"*testtable32",             "res", ures_swap},
+    /* resource bundle with table hash indexes */
+    {"*tablehash",               "res", ures_swap},
 
     /* ICU 4.2 resource bundle - data format 1.2 (little-endian ASCII) */
     {"*old_l_testtypes",         "res", ures_swap},
@@ -1623,6 +1689,289 @@ TestSwapCase(UDataMemory *pData, const char *name,
     }
 }
 
+#if !UCONFIG_NO_FILE_IO && !UCONFIG_NO_LEGACY_CONVERSION
+/*
+ * udata_open() caches the uncompressed copy of a compressed item by its address,
+ * so the compressed item stays in static memory for the rest of the process.
+ */
+static uint8_t gCompressedItem[32768];
+
+static struct {
+    uint16_t headerSize;
+    uint8_t magic1, magic2;
+    UDataInfo info;
+    char padding[8];
+    uint32_t count, reserved;
+    struct {
+        const char *name;
+        const void *data;
+    } toc[1];
+} gCompressedAppData_dat = {
+    32,          /* headerSize */
+    0xda,        /* magic1 */
+    0x27,        /* magic2 */
+    {
+        sizeof(UDataInfo),
+        0,
+        U_IS_BIG_ENDIAN,
+        U_CHARSET_FAMILY,
+        sizeof(UChar),
+        0,
+        {0x54, 0x6f, 0x43, 0x50}, /* dataFormat="ToCP" */
+        {1, 0, 0, 0},
+        {0, 0, 0, 0}
+    },
+    {0,0,0,0,0,0,0,0},
+    1,
+    0,
+    {
+        { "CompressedAppData/ulayout.icu", gCompressedItem }
+    }
+};
+
+static void TestCompressedItem() {
+    UDataMemory *pData, *pUncompressed;
+    const uint8_t *item;
+    uint8_t *buffer;
+    UDataSwapper *ds;
+    UErrorCode errorCode=U_ZERO_ERROR;
+    int32_t itemLength, length, length2;
+
+    pData=udata_open(NULL, "icu", "ulayout", &errorCode);
+    if(U_FAILURE(errorCode)) {
+        log_data_err("FAIL: udata_open(ulayout) failed - %s\n", myErrorName(errorCode));
+        return;
+    }
+    item=(const uint8_t *)udata_getRawMemory(pData);
+    itemLength=udata_getLength(pData);
+    if(itemLength<0) {
+        log_data_err("udata_getLength(ulayout) is not known\n");
+        udata_close(pData);
+        return;
+    }
+    itemLength+=(int32_t)((const uint8_t *)udata_getMemory(pData)-item);
+
+    /* compress */
+    length=udata_compressItem(item, itemLength, NULL, 0, &errorCode);
+    if(errorCode!=U_BUFFER_OVERFLOW_ERROR || length>(int32_t)sizeof(gCompressedItem) || (length&15)!=0) {
+        log_err("FAIL: udata_compressItem(ulayout, preflighting) returned %d - %s\n",
+                (int)length, myErrorName(errorCode));
+        udata_close(pData);
+        return;
+    }
+    errorCode=U_ZERO_ERROR;
+    length2=udata_compressItem(item, itemLength, gCompressedItem, length, &errorCode);
+    if(U_FAILURE(errorCode) || length2!=length || length>=itemLength) {
+        log_err("FAIL: udata_compressItem(ulayout) returned %d of %d bytes - %s\n",
+                (int)length2, (int)itemLength, myErrorName(errorCode));
+        udata_close(pData);
+        return;
+    }
+    if(!udata_isCompressedItem(gCompressedItem, length) || udata_isCompressedItem(item, itemLength)) {
+        log_err("FAIL: udata_isCompressedItem() does not recognize the compressed item\n");
+    }
+
+    buffer=(uint8_t *)malloc(itemLength);
+    if(buffer==NULL) {
+        log_err("unable to allocate %d bytes\n", (int)itemLength);
+        udata_close(pData);
+        return;
+    }
+
+    /* swap to the opposite endianness and back; the swapped item is recompressed in place */
+    ds=udata_openSwapper(U_IS_BIG_ENDIAN, U_CHARSET_FAMILY, !U_IS_BIG_ENDIAN, U_CHARSET_FAMILY, &errorCode);
+    ds->printError=printError;
+    length2=udata_swap(ds, gCompressedItem, length, gCompressedItem, &errorCode);
+    udata_closeSwapper(ds);
+    if(U_FAILURE(errorCode) || length2!=length ||
+            udata_uncompressItem(gCompressedItem, length, buffer, itemLength, &errorCode)!=itemLength ||
+            buffer[8]!=!U_IS_BIG_ENDIAN) {
+        log_err("FAIL: udata_swap(compressed ulayout->!isBig) failed - %s\n", myErrorName(errorCode));
+    }
+    ds=udata_openSwapper(!U_IS_BIG_ENDIAN, U_CHARSET_FAMILY, U_IS_BIG_ENDIAN, U_CHARSET_FAMILY, &errorCode);
+    ds->printError=printError;
+    length2=udata_swap(ds, gCompressedItem, length, gCompressedItem, &errorCode);
+    udata_closeSwapper(ds);
+    if(U_FAILURE(errorCode) || length2!=length) {
+        log_err("FAIL: udata_swap(compressed ulayout->back to original) failed - %s\n", myErrorName(errorCode));
+    }
+
+    /* uncompress */
+    memset(buffer, 0, itemLength);
+    length2=udata_uncompressItem(gCompressedItem, length, buffer, itemLength, &errorCode);
+    if(U_FAILURE(errorCode) || length2!=itemLength || 0!=memcmp(buffer, item, itemLength)) {
+        log_err("FAIL: udata_uncompressItem(ulayout) returned %d bytes - %s\n",
+                (int)length2, myErrorName(errorCode));
+    }
+    length2=udata_uncompressItem(gCompressedItem, length, buffer, itemLength-1, &errorCode);
+    if(errorCode!=U_BUFFER_OVERFLOW_ERROR || length2!=itemLength) {
+        log_err("FAIL: udata_uncompressItem(ulayout, short buffer) returned %d - %s\n",
+                (int)length2, myErrorName(errorCode));
+    }
+    errorCode=U_ZERO_ERROR;
+    length2=udata_uncompressItem(item, itemLength, buffer, itemLength, &errorCode);
+    if(errorCode!=U_INVALID_FORMAT_ERROR) {
+        log_err("FAIL: udata_uncompressItem(uncompressed ulayout) set %s rather than U_INVALID_FORMAT_ERROR\n",
+                myErrorName(errorCode));
+    }
+    free(buffer);
+
+    /* udata_open() of a compressed common data item returns the uncompressed item */
+    errorCode=U_ZERO_ERROR;
+    udata_setAppData("CompressedAppData", &gCompressedAppData_dat, &errorCode);
+    pUncompressed=udata_open("CompressedAppData", "icu", "ulayout", &errorCode);
+    if(U_FAILURE(errorCode)) {
+        log_err("FAIL: udata_open(CompressedAppData/ulayout) failed - %s\n", myErrorName(errorCode));
+    } else {
+        if(udata_getRawMemory(pUncompressed)==(const void *)gCompressedItem ||
+                0!=memcmp(udata_getRawMemory(pUncompressed), item, itemLength)) {
+            log_err("FAIL: udata_open(CompressedAppData/ulayout) did not return the uncompressed item\n");
+        }
+        udata_close(pUncompressed);
+    }
+    udata_close(pData);
+}
+#endif
+
+#if !UCONFIG_NO_FILE_IO && !UCONFIG_NO_LEGACY_CONVERSION
+/*
+ * A data overlay must stay valid until u_cleanup().
+ * Its items have names that are not in the ICU data, so that it does not affect other tests.
+ */
+static uint32_t gOverlayItem[4096];
+static uint32_t gOverlayBundle[256];
+
+static struct {
+    uint16_t headerSize;
+    uint8_t magic1, magic2;
+    UDataInfo info;
+    char padding[8];
+    uint32_t count, reserved;
+    struct {
+        const char *name;
+        const void *data;
+    } toc[2];
+} gOverlay_dat = {
+    32,          /* headerSize */
+    0xda,        /* magic1 */
+    0x27,        /* magic2 */
+    {
+        sizeof(UDataInfo),
+        0,
+        U_IS_BIG_ENDIAN,
+        U_CHARSET_FAMILY,
+        sizeof(UChar),
+        0,
+        {0x54, 0x6f, 0x43, 0x50}, /* dataFormat="ToCP" */
+        {1, 0, 0, 0},
+        {0, 0, 0, 0}
+    },
+    {0,0,0,0,0,0,0,0},
+    2,
+    0,
+    {
+        { U_ICUDATA_NAME "/overlaytest.icu", gOverlayItem },
+        { U_ICUDATA_NAME "/overlaytest.res", gOverlayBundle }
+    }
+};
+
+/* Copies the whole data item, with its header, into dest. */
+static UBool copyDataItem(const char *type, const char *name, uint32_t *dest, int32_t capacity) {
+    UErrorCode errorCode=U_ZERO_ERROR;
+    UDataMemory *pData=udata_open(NULL, type, name, &errorCode);
+    const uint8_t *item;
+    int32_t length;
+    if(U_FAILURE(errorCode)) {
+        log_data_err("FAIL: udata_open(%s.%s) failed - %s\n", name, type, myErrorName(errorCode));
+        return FALSE;
+    }
+    item=(const uint8_t *)udata_getRawMemory(pData);
+    length=udata_getLength(pData);
+    if(length<0 || (length+=(int32_t)((const uint8_t *)udata_getMemory(pData)-item))>capacity) {
+        log_err("FAIL: %s.%s has an unknown length or does not fit into %d bytes\n", name, type, (int)capacity);
+        udata_close(pData);
+        return FALSE;
+    }
+    memcpy(dest, item, length);
+    udata_close(pData);
+    return TRUE;
+}
+
+static void TestDataOverlay() {
+    UDataMemory *pData;
+    UResourceBundle *posix, *bundle;
+    UErrorCode errorCode=U_ZERO_ERROR;
+    int32_t epoch;
+
+    if(!copyDataItem("icu", "ulayout", gOverlayItem, (int32_t)sizeof(gOverlayItem)) ||
+            !copyDataItem("res", "en_US_POSIX", gOverlayBundle, (int32_t)sizeof(gOverlayBundle))) {
+        return;
+    }
+
+    /* Open the missing items first, to test that the resource bundle cache is updated. */
+    pData=udata_open(NULL, "icu", "overlaytest", &errorCode);
+    if(U_SUCCESS(errorCode)) {
+        log_err("FAIL: udata_open(overlaytest) succeeded before publishing the overlay\n");
+        udata_close(pData);
+    }
+    errorCode=U_ZERO_ERROR;
+    bundle=ures_openDirect(NULL, "overlaytest", &errorCode);
+    if(U_SUCCESS(errorCode)) {
+        log_err("FAIL: ures_openDirect(overlaytest) succeeded before publishing the overlay\n");
+    }
+    ures_close(bundle);
+
+    /* A bad package is rejected and does not start an epoch. */
+    epoch=udata_getDataEpoch();
+    errorCode=U_ZERO_ERROR;
+    udata_publishOverlay(gOverlayItem, &errorCode);
+    if(errorCode!=U_INVALID_FORMAT_ERROR || udata_getDataEpoch()!=epoch) {
+        log_err("FAIL: udata_publishOverlay(not a package) set %s\n", myErrorName(errorCode));
+    }
+
+    errorCode=U_ZERO_ERROR;
+    udata_publishOverlay(&gOverlay_dat, &errorCode);
+    if(U_FAILURE(errorCode)) {
+        log_err("FAIL: udata_publishOverlay() failed - %s\n", myErrorName(errorCode));
+        return;
+    }
+    if(udata_getDataEpoch()!=epoch+1) {
+        log_err("FAIL: udata_publishOverlay() did not start a new data epoch\n");
+    }
+    if(!udata_isOverlaidSince(NULL, "icu", "overlaytest", epoch) ||
+            !udata_isOverlaidSince("ICUDATA", "res", "overlaytest", epoch) ||
+            udata_isOverlaidSince(NULL, "icu", "overlaytest", epoch+1) ||
+            udata_isOverlaidSince(NULL, "icu", "ulayout", epoch) ||
+            udata_isOverlaidSince(U_ICUDATA_NAME "-curr", "res", "overlaytest", epoch) ||
+            udata_isOverlaidSince("overlaytestapp", "res", "overlaytest", epoch)) {
+        log_err("FAIL: udata_isOverlaidSince() returned a wrong result\n");
+    }
+
+    errorCode=U_ZERO_ERROR;
+    pData=udata_open(NULL, "icu", "overlaytest", &errorCode);
+    if(U_FAILURE(errorCode)) {
+        log_err("FAIL: udata_open(overlaytest) failed - %s\n", myErrorName(errorCode));
+    } else {
+        if(udata_getRawMemory(pData)!=(const void *)gOverlayItem) {
+            log_err("FAIL: udata_open(overlaytest) did not return the overlay item\n");
+        }
+        udata_close(pData);
+    }
+
+    errorCode=U_ZERO_ERROR;
+    posix=ures_openDirect(NULL, "en_US_POSIX", &errorCode);
+    bundle=ures_openDirect(NULL, "overlaytest", &errorCode);
+    if(U_FAILURE(errorCode)) {
+        log_err("FAIL: ures_openDirect(overlaytest) failed after publishing the overlay - %s\n",
+                myErrorName(errorCode));
+    } else if(ures_getSize(bundle)!=ures_getSize(posix)) {
+        log_err("FAIL: ures_openDirect(overlaytest) did not open the overlay bundle\n");
+    }
+    ures_close(bundle);
+    ures_close(posix);
+}
+#endif
+
 static void U_CALLCONV
 printErrorToString(void *context, const char *fmt, va_list args) {
     vsprintf((char *)context, fmt, args);
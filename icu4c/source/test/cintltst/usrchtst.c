@@ -3005,6 +3005,85 @@ static void TestIndicPrefixMatch(void)
     close();
 }
 
+static UBool assertEqualWithTextIndex(const SearchData search)
+{
+    UErrorCode        status   = U_ZERO_ERROR;
+    UChar             pattern[32];
+    UChar             text[128];
+    UCollator        *collator = getCollator(search.collator);
+    UBreakIterator   *breaker  = getBreakIterator(search.breaker);
+    UStringSearch    *strsrch;
+    USearchTextIndex *index;
+    UBool             result;
+
+    CHECK_BREAK_BOOL(search.breaker);
+    u_unescape(search.text, text, 128);
+    u_unescape(search.pattern, pattern, 32);
+    ucol_setStrength(collator, search.strength);
+    strsrch = usearch_openFromCollator(pattern, -1, text, -1, collator,
+                                       breaker, &status);
+    index = usearch_openTextIndex(text, -1, collator, &status);
+    usearch_setTextIndex(strsrch, index, &status);
+    if (U_FAILURE(status)) {
+        log_err("Error opening string search with a text index %s\n", u_errorName(status));
+        result = FALSE;
+    } else {
+        result = assertEqualWithUStringSearch(strsrch, search);
+    }
+    ucol_setStrength(collator, UCOL_TERTIARY);
+    usearch_close(strsrch);
+    usearch_closeTextIndex(index);
+    return result;
+}
+
+static void TestTextIndex(void)
+{
+    static const SearchData *const tables[] = {
+        BASIC, NONNORMEXACT, STRENGTH, SUPPLEMENTARY, INDICPREFIXMATCH
+    };
+    UErrorCode        status = U_ZERO_ERROR;
+    UChar             text[128];
+    UChar             pattern[32];
+    UCollator        *collator;
+    UStringSearch    *strsrch;
+    USearchTextIndex *index;
+    int32_t           i;
+    int               count;
+
+    open(&status);
+    if (U_FAILURE(status)) {
+        log_err_status(status, "Unable to open static collators %s\n", u_errorName(status));
+        return;
+    }
+    for (i = 0; i < UPRV_LENGTHOF(tables); ++i) {
+        for (count = 0; tables[i][count].text != NULL; ++count) {
+            if (!assertEqualWithTextIndex(tables[i][count])) {
+                log_err("Error at test table %d number %d\n", (int)i, count);
+            }
+        }
+    }
+
+    /* the index must be built with the search's collator */
+    u_unescape("abc", text, 128);
+    u_unescape("b", pattern, 32);
+    collator = ucol_open("fr", &status);
+    strsrch = usearch_open(pattern, -1, text, -1, "en", NULL, &status);
+    index = usearch_openTextIndex(text, -1, collator, &status);
+    if (U_FAILURE(status)) {
+        log_err_status(status, "Error opening string search or text index %s\n", u_errorName(status));
+    } else {
+        usearch_setTextIndex(strsrch, index, &status);
+        if (status != U_ILLEGAL_ARGUMENT_ERROR) {
+            log_err("usearch_setTextIndex() with another collator should fail, got %s\n",
+                    u_errorName(status));
+        }
+    }
+    usearch_closeTextIndex(index);
+    usearch_close(strsrch);
+    ucol_close(collator);
+    close();
+}
+
 /**
 * addSearchTest
 */
@@ -3057,6 +3136,7 @@ void addSearchTest(TestNode** root)
                                "tscoll/usrchtst/TestSupplementaryCanonical");
     addTest(root, &TestContractionCanonical, 
                                  "tscoll/usrchtst/TestContractionCanonical");
+    addTest(root, &TestTextIndex, "tscoll/usrchtst/TestTextIndex");
     addTest(root, &TestEnd, "tscoll/usrchtst/TestEnd");
     addTest(root, &TestNumeric, "tscoll/usrchtst/TestNumeric");
     addTest(root, &TestDiacriticMatch, "tscoll/usrchtst/TestDiacriticMatch");
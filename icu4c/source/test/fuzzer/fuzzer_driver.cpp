@@ -1,20 +1,90 @@
 // © 2019 and later: Unicode, Inc. and others.
 // License & terms of use: http://www.unicode.org/copyright.html
 
+#include <chrono>
 #include <stddef.h>
 #include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
 
 #include "cmemory.h"
 
 extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size);
 
+namespace {
+
+// Reads the whole file into data. Returns false if it cannot be read.
+bool ReadInput(const char *path, std::vector<uint8_t> &data) {
+  FILE *f = fopen(path, "rb");
+  if (f == NULL) {
+    return false;
+  }
+  uint8_t buffer[4096];
+  size_t length;
+  while ((length = fread(buffer, 1, sizeof(buffer), f)) > 0) {
+    data.insert(data.end(), buffer, buffer + length);
+  }
+  bool ok = ferror(f) == 0;
+  fclose(f);
+  return ok;
+}
+
+}  // namespace
+
+// Without arguments, runs the fuzzer once on a fixed input.
+//
+// Otherwise replays each input file given on the command line, and prints
+// how long each one took. With -max_ms=N, fails if any input takes longer
+// than N milliseconds; this is used to replay inputs that once made a fuzzer
+// target super-linearly slow, see "make check-slow-inputs".
 int main(int argc, char* argv[])
 {
-  (void) argc;
-  (void) argv;
-  const char *fuzzer_data = "abc123";
-   
-  LLVMFuzzerTestOneInput((const uint8_t *) fuzzer_data, strlen(fuzzer_data));
+  if (argc < 2) {
+    const char *fuzzer_data = "abc123";
+
+    LLVMFuzzerTestOneInput((const uint8_t *) fuzzer_data, strlen(fuzzer_data));
+    return 0;
+  }
+
+  long max_ms = 0;
+  int errors = 0;
+  for (int i = 1; i < argc; ++i) {
+    const char *arg = argv[i];
+    if (strncmp(arg, "-max_ms=", 8) == 0) {
+      max_ms = strtol(arg + 8, NULL, 10);
+      continue;
+    }
+    std::vector<uint8_t> data;
+    if (!ReadInput(arg, data)) {
+      fprintf(stderr, "error: unable to read %s\n", arg);
+      ++errors;
+      continue;
+    }
+    // Copy into a buffer of exactly the input size, as libFuzzer does,
+    // so that out-of-bounds reads are visible to sanitizers.
+    uint8_t *input = (uint8_t *) uprv_malloc(data.empty() ? 1 : data.size());
+    if (input == NULL) {
+      fprintf(stderr, "error: out of memory for %s\n", arg);
+      return 1;
+    }
+    if (!data.empty()) {
+      uprv_memcpy(input, data.data(), data.size());
+    }
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    LLVMFuzzerTestOneInput(input, data.size());
+    long elapsed_ms = (long) std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start).count();
+    uprv_free(input);
 
-  return 0;
+    if (max_ms > 0 && elapsed_ms > max_ms) {
+      fprintf(stderr, "error: %s took %ld ms, limit is %ld ms\n", arg, elapsed_ms, max_ms);
+      ++errors;
+    } else {
+      printf("%s: %ld ms\n", arg, elapsed_ms);
+    }
+  }
+  return errors == 0 ? 0 : 1;
 }
@@ -16,6 +16,7 @@
 #include "intltest.h"
 #include "alphaindextst.h"
 #include "cmemory.h"
+#include "uvector.h"
 
 #include "unicode/alphaindex.h"
 #include "unicode/coll.h"
@@ -31,6 +32,14 @@
 
 namespace {
 
+int32_t U_CALLCONV collatorComparator(const void *context, const void *left, const void *right) {
+    const UnicodeString *leftString =
+        static_cast<const UnicodeString *>(static_cast<const UElement *>(left)->pointer);
+    const UnicodeString *rightString =
+        static_cast<const UnicodeString *>(static_cast<const UElement *>(right)->pointer);
+    return static_cast<const Collator *>(context)->compare(*leftString, *rightString);
+}
+
 UnicodeString joinLabelsAndAppend(AlphabeticIndex::ImmutableIndex &index, UnicodeString &dest) {
     int32_t oldLength = dest.length();
     const AlphabeticIndex::Bucket *bucket;
@@ -68,6 +77,7 @@ void AlphabeticIndexTest::runIndexedTest( int32_t index, UBool exec, const char*
     TESTCASE_AUTO(TestJapaneseKanji);
     TESTCASE_AUTO(TestChineseUnihan);
     TESTCASE_AUTO(testHasBuckets);
+    TESTCASE_AUTO(TestBucketsConsistent);
     TESTCASE_AUTO_END;
 }
 
@@ -749,4 +759,81 @@ void AlphabeticIndexTest::checkHasBuckets(const Locale &locale, UScriptCode scri
             uscript_getScript(bucket->getLabel().char32At(0), errorCode));
 }
 
+void AlphabeticIndexTest::TestBucketsConsistent() {
+    // Bucket boundaries are compared via sort key prefixes.
+    // Check that the results are consistent with the collator.
+    static const char *const localeIDs[] = { "en", "de", "sv", "ru", "ja", "ko", "ar" };
+    for (const char *localeID : localeIDs) {
+        checkBucketsConsistent(Locale(localeID));
+    }
+}
+
+void AlphabeticIndexTest::checkBucketsConsistent(const Locale &locale) {
+    IcuTestErrorCode errorCode(*this, "checkBucketsConsistent");
+    AlphabeticIndex aindex(locale, errorCode);
+    LocalPointer<AlphabeticIndex::ImmutableIndex> index(aindex.buildImmutableIndex(errorCode), errorCode);
+    LocalPointer<Collator> coll(aindex.getCollator().clone(), errorCode);
+    if (errorCode.errDataIfFailureAndReset("%s: unable to build the index", locale.getName())) {
+        return;
+    }
+    coll->setStrength(Collator::PRIMARY);
+
+    // Names: all labels, single characters, and longer strings.
+    UVector names(uprv_deleteUObject, NULL, errorCode);
+    for (int32_t i = 0; i < index->getBucketCount(); ++i) {
+        const UnicodeString &label = index->getBucket(i)->getLabel();
+        names.addElement(new UnicodeString(label), errorCode);
+        names.addElement(new UnicodeString(label + u"zz"), errorCode);
+    }
+    for (UChar32 c = 0x20; c < 0x3200; ++c) {
+        names.addElement(new UnicodeString(c), errorCode);
+    }
+    static const char16_t *const strings[] = {
+        u"Sch", u"St", u"\u00C5sa", u"Aardvark", u"\u0416\u0443\u043A",
+        u"\u304B\u304D\u304F\u3051\u3053", u"Zyxwvutsrqponmlkjihgfedcba0123456789"
+    };
+    for (const char16_t *str : strings) {
+        names.addElement(new UnicodeString(str), errorCode);
+    }
+    if (errorCode.errIfFailureAndReset("%s: unable to collect names", locale.getName())) {
+        return;
+    }
+
+    // Labels of normal buckets are in their own buckets.
+    for (int32_t i = 0; i < index->getBucketCount(); ++i) {
+        const AlphabeticIndex::Bucket *bucket = index->getBucket(i);
+        if (bucket->getLabelType() == U_ALPHAINDEX_NORMAL) {
+            assertEquals(UnicodeString(locale.getName()) + u" bucket of label " + bucket->getLabel(),
+                         i, index->getBucketIndex(bucket->getLabel(), errorCode));
+        }
+    }
+
+    // Bucket indexes do not decrease in collation order,
+    // and the records are bucketed like single names.
+    AlphabeticIndex records(locale, errorCode);
+    for (int32_t i = 0; i < names.size(); ++i) {
+        records.addRecord(*static_cast<UnicodeString *>(names[i]), names[i], errorCode);
+    }
+    names.sortWithUComparator(collatorComparator, coll.getAlias(), errorCode);
+    int32_t prevBucketIndex = 0;
+    for (int32_t i = 0; i < names.size(); ++i) {
+        const UnicodeString &name = *static_cast<UnicodeString *>(names[i]);
+        int32_t bucketIndex = index->getBucketIndex(name, errorCode);
+        if (bucketIndex < prevBucketIndex) {
+            errln(UnicodeString(locale.getName()) + u": bucket of " + name + u" is " + bucketIndex +
+                  u", lower than " + prevBucketIndex + u" of the preceding name");
+        }
+        prevBucketIndex = bucketIndex;
+    }
+    while (records.nextBucket(errorCode)) {
+        while (records.nextRecord(errorCode)) {
+            const UnicodeString &name = records.getRecordName();
+            if (records.getBucketIndex() != index->getBucketIndex(name, errorCode)) {
+                errln(UnicodeString(locale.getName()) + u": record " + name + u" is in bucket " +
+                      records.getBucketIndex() + u" rather than " + index->getBucketIndex(name, errorCode));
+            }
+        }
+    }
+}
+
 #endif
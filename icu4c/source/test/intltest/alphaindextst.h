@@ -53,6 +53,11 @@ class AlphabeticIndexTest: public IntlTest {
 
     void testHasBuckets();
     void checkHasBuckets(const Locale &locale, UScriptCode script);
+    /**
+     * Test that bucketing agrees with the collation order.
+     */
+    void TestBucketsConsistent();
+    void checkBucketsConsistent(const Locale &locale);
 };
 
 #endif
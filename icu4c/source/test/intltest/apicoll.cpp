@@ -33,6 +33,7 @@
 
 #if !UCONFIG_NO_COLLATION
 
+#include "unicode/bytestream.h"
 #include "unicode/localpointer.h"
 #include "unicode/coll.h"
 #include "unicode/tblcoll.h"
@@ -46,8 +47,11 @@
 #include "unicode/ucol.h"
 
 #include "sfwdchit.h"
+#include "charstr.h"
 #include "cmemory.h"
+#include "collationdiskcache.h"
 #include <stdlib.h>
+#include <string>
 
 void
 CollationAPITest::doAssert(UBool condition, const char *message)
@@ -2517,6 +2521,112 @@ void CollationAPITest::TestGapTooSmall() {
     }
 }
 
+void CollationAPITest::TestOpenRulesCached() {
+    IcuTestErrorCode errorCode(*this, "TestOpenRulesCached");
+    const char *dir = ".";
+    UnicodeString rules(u"&a<\u00e6<<<\u00c6 &c<ch");
+    CharString path;
+    CollationDiskCache::getPath(dir, rules, path, errorCode);
+    if(errorCode.errDataIfFailureAndReset("CollationDiskCache::getPath()")) {
+        return;
+    }
+    remove(path.data());
+
+    // The first open builds the tailoring and writes the file,
+    // the second one maps it.
+    UParseError parseError;
+    LocalUCollatorPointer built(ucol_openRulesCached(
+        toUCharPtr(rules.getBuffer()), rules.length(), UCOL_DEFAULT, UCOL_SECONDARY,
+        dir, &parseError, errorCode));
+    if(errorCode.errDataIfFailureAndReset("ucol_openRulesCached(build)")) {
+        return;
+    }
+    FILE *f = fopen(path.data(), "rb");
+    if(f == NULL) {
+        infoln("no cache file at %s, the directory may not be writable", path.data());
+        return;
+    }
+    fclose(f);
+    LocalUCollatorPointer mapped(ucol_openRulesCached(
+        toUCharPtr(rules.getBuffer()), rules.length(), UCOL_DEFAULT, UCOL_SECONDARY,
+        dir, &parseError, errorCode));
+    if(errorCode.errIfFailureAndReset("ucol_openRulesCached(map)")) {
+        remove(path.data());
+        return;
+    }
+    const RuleBasedCollator *rbc = RuleBasedCollator::rbcFromUCollator(built.getAlias());
+    const RuleBasedCollator *rbc2 = RuleBasedCollator::rbcFromUCollator(mapped.getAlias());
+    assertTrue("built==mapped", *rbc == *rbc2);
+    assertEquals("mapped rules", rules, rbc2->getRules());
+    assertEquals("mapped strength", (int32_t)UCOL_SECONDARY,
+                 rbc2->getAttribute(UCOL_STRENGTH, errorCode));
+    assertEquals("mapped: ch>cz", (int32_t)UCOL_GREATER,
+                 rbc2->compare(u"ch", u"cz", errorCode));
+    assertEquals("mapped secondary: ae-ligature==AE-ligature", (int32_t)UCOL_EQUAL,
+                 rbc2->compare(u"\u00e6", u"\u00c6", errorCode));
+    LocalUCollatorPointer clone(ucol_safeClone(mapped.getAlias(), NULL, NULL, errorCode));
+    mapped.adoptInstead(NULL);
+    assertEquals("clone of mapped: ae-ligature<b", (int32_t)UCOL_LESS,
+                 ucol_strcoll(clone.getAlias(), u"\u00e6", -1, u"b", -1));
+
+    // A damaged file is ignored and replaced.
+    f = fopen(path.data(), "wb");
+    if(f != NULL) {
+        fputs("not collation data", f);
+        fclose(f);
+    }
+    LocalUCollatorPointer rebuilt(ucol_openRulesCached(
+        toUCharPtr(rules.getBuffer()), rules.length(), UCOL_DEFAULT, UCOL_SECONDARY,
+        dir, &parseError, errorCode));
+    if(!errorCode.errIfFailureAndReset("ucol_openRulesCached(damaged file)")) {
+        rbc2 = RuleBasedCollator::rbcFromUCollator(rebuilt.getAlias());
+        assertTrue("built==rebuilt", *rbc == *rbc2);
+    }
+    LocalUCollatorPointer remapped(ucol_openRulesCached(
+        toUCharPtr(rules.getBuffer()), rules.length(), UCOL_DEFAULT, UCOL_SECONDARY,
+        dir, &parseError, errorCode));
+    if(!errorCode.errIfFailureAndReset("ucol_openRulesCached(rewritten file)")) {
+        rbc2 = RuleBasedCollator::rbcFromUCollator(remapped.getAlias());
+        assertTrue("built==remapped", *rbc == *rbc2);
+    }
+
+    // A file with the data for other rules, as if their hashes collided, is not used.
+    UnicodeString otherRules(u"&b<a");
+    CharString otherPath;
+    CollationDiskCache::getPath(dir, otherRules, otherPath, errorCode);
+    FILE *in = fopen(path.data(), "rb");
+    FILE *out = fopen(otherPath.data(), "wb");
+    if(in != NULL && out != NULL) {
+        int c;
+        while((c = getc(in)) != EOF) { putc(c, out); }
+    }
+    if(in != NULL) { fclose(in); }
+    if(out != NULL) { fclose(out); }
+    LocalUCollatorPointer other(ucol_openRulesCached(
+        toUCharPtr(otherRules.getBuffer()), otherRules.length(), UCOL_DEFAULT, UCOL_DEFAULT,
+        dir, &parseError, errorCode));
+    if(!errorCode.errIfFailureAndReset("ucol_openRulesCached(other rules)")) {
+        rbc2 = RuleBasedCollator::rbcFromUCollator(other.getAlias());
+        assertEquals("other rules", otherRules, rbc2->getRules());
+        assertEquals("other rules: b<a", (int32_t)UCOL_LESS, rbc2->compare(u"b", u"a", errorCode));
+    }
+    remove(otherPath.data());
+    remove(path.data());
+
+    // Syntax errors are reported as with ucol_openRules(), and nothing is written.
+    UnicodeString badRules(u"&a<<<<<<b");
+    CollationDiskCache::getPath(dir, badRules, path, errorCode);
+    LocalUCollatorPointer bad(ucol_openRulesCached(
+        toUCharPtr(badRules.getBuffer()), badRules.length(), UCOL_DEFAULT, UCOL_DEFAULT,
+        dir, &parseError, errorCode));
+    assertEquals("bad rules", U_INVALID_FORMAT_ERROR, errorCode.reset());
+    assertTrue("no file for bad rules", (f = fopen(path.data(), "rb")) == NULL);
+    if(f != NULL) {
+        fclose(f);
+        remove(path.data());
+    }
+}
+
  void CollationAPITest::dump(UnicodeString msg, RuleBasedCollator* c, UErrorCode& status) {
     const char* bigone = "One";
     const char* littleone = "one";
@@ -2525,6 +2635,53 @@ void CollationAPITest::TestGapTooSmall() {
                         " s: " + c->getStrength() +
                         " u: " + c->getAttribute(UCOL_CASE_FIRST, status));
 }
+void CollationAPITest::TestWriteSortKey() {
+    IcuTestErrorCode errorCode(*this, "TestWriteSortKey");
+    LocalPointer<Collator> coll(Collator::createInstance(Locale::getRoot(), errorCode));
+    if(errorCode.errDataIfFailureAndReset("Collator::createInstance(root)")) {
+        return;
+    }
+    RuleBasedCollator *rbc = dynamic_cast<RuleBasedCollator *>(coll.getAlias());
+    if(rbc == NULL) {
+        errln("the root collator is not a RuleBasedCollator");
+        return;
+    }
+    // Long enough for the primary weights to be passed on in several chunks.
+    UnicodeString text;
+    for(int32_t i = 0; i < 300; ++i) {
+        text.append(u"Ab\u00e7-\u0928\u092e\u0938\u094d\u0924\u0947 ");
+    }
+    std::string text8;
+    text.toUTF8String(text8);
+
+    static const UColAttributeValue strengths[] = {
+        UCOL_PRIMARY, UCOL_TERTIARY, UCOL_QUATERNARY, UCOL_IDENTICAL
+    };
+    rbc->setAttribute(UCOL_ALTERNATE_HANDLING, UCOL_SHIFTED, errorCode);
+    for(int32_t i = 0; i < UPRV_LENGTHOF(strengths); ++i) {
+        rbc->setAttribute(UCOL_STRENGTH, strengths[i], errorCode);
+        int32_t expectedLength = rbc->getSortKey(text, NULL, 0);
+        LocalArray<uint8_t> expected(new uint8_t[expectedLength]);
+        rbc->getSortKey(text, expected.getAlias(), expectedLength);
+
+        UCharIterator iter;
+        uiter_setString(&iter, toUCharPtr(text.getBuffer()), text.length());
+        std::string key;
+        StringByteSink<std::string> sink(&key);
+        rbc->writeSortKey(iter, sink, errorCode);
+        errorCode.errIfFailureAndReset("writeSortKey(strength index %d)", (int)i);
+        assertTrue("writeSortKey() == getSortKey()",
+                   (int32_t)key.length() == expectedLength &&
+                   uprv_memcmp(key.data(), expected.getAlias(), expectedLength) == 0);
+
+        std::string key8;
+        StringByteSink<std::string> sink8(&key8);
+        rbc->writeSortKeyUTF8(text8, sink8, errorCode);
+        errorCode.errIfFailureAndReset("writeSortKeyUTF8(strength index %d)", (int)i);
+        assertTrue("writeSortKeyUTF8() == getSortKey()", key8 == key);
+    }
+}
+
 void CollationAPITest::runIndexedTest( int32_t index, UBool exec, const char* &name, char* /*par */)
 {
     if (exec) logln("TestSuite CollationAPITest: ");
@@ -2560,6 +2717,8 @@ void CollationAPITest::runIndexedTest( int32_t index, UBool exec, const char* &n
     TESTCASE_AUTO(TestIterNumeric);
     TESTCASE_AUTO(TestBadKeywords);
     TESTCASE_AUTO(TestGapTooSmall);
+    TESTCASE_AUTO(TestOpenRulesCached);
+    TESTCASE_AUTO(TestWriteSortKey);
     TESTCASE_AUTO_END;
 }
 
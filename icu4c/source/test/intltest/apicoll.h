@@ -174,6 +174,8 @@ class CollationAPITest: public IntlTestCollator {
     void TestIterNumeric();
     void TestBadKeywords();
     void TestGapTooSmall();
+    void TestOpenRulesCached();
+    void TestWriteSortKey();
 
 private:
     // If this is too small for the test data, just increase it.
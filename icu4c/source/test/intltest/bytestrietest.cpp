@@ -15,6 +15,7 @@
 */
 
 #include <string.h>
+#include <string>
 
 #include "unicode/utypes.h"
 #include "unicode/bytestrie.h"
@@ -126,6 +127,34 @@ void BytesTrieTest::TestBuilder() {
         errln("BytesTrieBuilder.add() did not detect duplicates");
         return;
     }
+    // Strings added in order are not sorted, but duplicates must still be detected.
+    builder_->clear();
+    builder_->add("a", 0, errorCode).add("b", 1, errorCode).add("b", 2, errorCode).
+        build(USTRINGTRIE_BUILD_FAST, errorCode);
+    if(errorCode.reset()!=U_ILLEGAL_ARGUMENT_ERROR) {
+        errln("BytesTrieBuilder.add() did not detect duplicates after in-order strings");
+        return;
+    }
+    // Adding strings in order must yield the same trie as adding them out of order.
+    static const char *const strings[]={ "", "a", "ab", "abc", "b", "ba", "bc", "cdefg", "\xff" };
+    builder_->clear();
+    for(int32_t i=0; i<UPRV_LENGTHOF(strings); ++i) {
+        builder_->add(strings[i], i, errorCode);
+    }
+    StringPiece sp=builder_->buildStringPiece(USTRINGTRIE_BUILD_SMALL, errorCode);
+    std::string inOrder(sp.data(), sp.length());
+    builder_->clear();
+    for(int32_t i=UPRV_LENGTHOF(strings); i>0;) {
+        --i;
+        builder_->add(strings[i], i, errorCode);
+    }
+    StringPiece outOfOrder=builder_->buildStringPiece(USTRINGTRIE_BUILD_SMALL, errorCode);
+    if(errorCode.errIfFailureAndReset("in-order vs. out-of-order add()")) {
+        return;
+    }
+    if(StringPiece(inOrder)!=outOfOrder) {
+        errln("BytesTrieBuilder: in-order add() yields a different trie than out-of-order add()");
+    }
 }
 
 void BytesTrieTest::TestEmpty() {
@@ -336,6 +336,27 @@ void CalendarTest::runIndexedTest( int32_t index, UBool exec, const char* &name,
             TestChineseCalendarMapping();
           }
           break;
+        case 37:
+          name = "TestGregorianDayFields";
+          if(exec) {
+            logln("TestGregorianDayFields---"); logln("");
+            TestGregorianDayFields();
+          }
+          break;
+        case 38:
+          name = "TestChineseCalendarAstroTables";
+          if(exec) {
+            logln("TestChineseCalendarAstroTables---"); logln("");
+            TestChineseCalendarAstroTables();
+          }
+          break;
+        case 39:
+          name = "TestCalendarCacheCollisions";
+          if(exec) {
+            logln("TestCalendarCacheCollisions---"); logln("");
+            TestCalendarCacheCollisions();
+          }
+          break;
         default: name = ""; break;
     }
 }
@@ -3713,6 +3734,178 @@ void CalendarTest::TestChineseCalendarMapping() {
     }
 }
 
+void CalendarTest::TestGregorianDayFields() {
+    // The Gregorian fields of recently converted days are cached.
+    // Convert each day twice, interleaved with days that map to the same cache entries,
+    // and check the fields against the inverse conversion.
+    UErrorCode status = U_ZERO_ERROR;
+    GregorianCalendar cal(TimeZone::getGMT()->clone(), Locale::getEnglish(), status);
+    GregorianCalendar inverse(TimeZone::getGMT()->clone(), Locale::getEnglish(), status);
+    if (U_FAILURE(status)) {
+        dataerrln("Fail: creating GregorianCalendar - %s", u_errorName(status));
+        return;
+    }
+    cal.setGregorianChange(-184303902528000000.0, status);  // proleptic Gregorian
+    inverse.setGregorianChange(-184303902528000000.0, status);
+    static const double starts[] = { -719162 - 40, -141428, -1, 0, 17683, 23736 - 3, 2932896 - 3, 23217800 };
+    for (double start : starts) {
+        for (int32_t pass = 0; pass < 2; ++pass) {
+            for (int32_t i = 0; i < 80; ++i) {
+                double day = start + (i % 2 == 0 ? i / 2 : 16 * i);
+                cal.setTime(day * U_MILLIS_PER_DAY, status);
+                int32_t year = cal.get(UCAL_EXTENDED_YEAR, status);
+                int32_t month = cal.get(UCAL_MONTH, status);
+                int32_t dom = cal.get(UCAL_DATE, status);
+                int32_t dow = cal.get(UCAL_DAY_OF_WEEK, status);
+                int32_t doy = cal.get(UCAL_DAY_OF_YEAR, status);
+                inverse.clear();
+                inverse.set(UCAL_EXTENDED_YEAR, year);
+                inverse.set(UCAL_MONTH, month);
+                inverse.set(UCAL_DATE, dom);
+                UDate fromFields = inverse.getTime(status);
+                inverse.clear();
+                inverse.set(UCAL_EXTENDED_YEAR, year);
+                inverse.set(UCAL_DAY_OF_YEAR, doy);
+                UDate fromDayOfYear = inverse.getTime(status);
+                // 1970-01-01 was a Thursday.
+                int32_t expectedDow = (((int32_t)day + 4) % 7 + 7) % 7 + UCAL_SUNDAY;
+                if (U_FAILURE(status) || fromFields != day * U_MILLIS_PER_DAY ||
+                        fromDayOfYear != day * U_MILLIS_PER_DAY || dow != expectedDow) {
+                    errln("Fail: day %.0f pass %d -> %d-%02d-%02d dow %d doy %d - %s",
+                          day, pass, year, month + 1, dom, dow, doy, u_errorName(status));
+                    status = U_ZERO_ERROR;
+                }
+            }
+        }
+    }
+}
+
+void CalendarTest::TestChineseCalendarAstroTables() {
+    // Between 1900 and 2100, the Chinese and Dangi calendars use precomputed
+    // solstices and new moons for their respective zones; outside, they calculate.
+    static const struct {
+        const char *locale;
+        int32_t gyr, gmo, gda;  // Gregorian date of the first day of the month
+        int32_t cmo, clp;       // 1-based Chinese month, leap month flag
+    } months[] = {
+        { "zh@calendar=chinese", 1900,  1, 31,  1, 0 },
+        { "zh@calendar=chinese", 2012,  5, 21,  4, 1 },
+        { "zh@calendar=chinese", 2017,  7, 23,  6, 1 },
+        { "zh@calendar=chinese", 2033, 12, 22, 11, 1 },
+        { "zh@calendar=chinese", 2100,  2,  9,  1, 0 },
+        { "ko@calendar=dangi",   1900,  1, 31,  1, 0 },
+        { "ko@calendar=dangi",   1912,  2, 18,  1, 0 },
+        { "ko@calendar=dangi",   1988,  2, 18,  1, 0 },
+        { "ko@calendar=dangi",   1997,  2,  8,  1, 0 },
+        { "ko@calendar=dangi",   2012,  4, 21,  3, 1 },
+        { "ko@calendar=dangi",   2017,  6, 24,  5, 1 },
+        { "ko@calendar=dangi",   2092,  2,  8,  1, 0 },
+        { "ko@calendar=dangi",   2100,  2,  9,  1, 0 },
+    };
+    UErrorCode status = U_ZERO_ERROR;
+    GregorianCalendar greg(TimeZone::getGMT()->clone(), Locale::getEnglish(), status);
+    if (U_FAILURE(status)) {
+        dataerrln("Fail: creating GregorianCalendar - %s", u_errorName(status));
+        return;
+    }
+    for (const auto &m : months) {
+        LocalPointer<Calendar> cal(Calendar::createInstance(TimeZone::getGMT()->clone(), m.locale, status));
+        if (U_FAILURE(status)) {
+            dataerrln("Fail: creating %s - %s", m.locale, u_errorName(status));
+            return;
+        }
+        greg.clear();
+        greg.set(m.gyr, m.gmo - 1, m.gda, 12, 0);
+        cal->setTime(greg.getTime(status), status);
+        int32_t mo = cal->get(UCAL_MONTH, status) + 1;
+        int32_t lp = cal->get(UCAL_IS_LEAP_MONTH, status);
+        int32_t da = cal->get(UCAL_DATE, status);
+        if (U_FAILURE(status) || mo != m.cmo || lp != m.clp || da != 1) {
+            errln("Fail: %s for Gregorian %4d-%02d-%02d, expected month %d(%d) day 1, got %d(%d) day %d - %s",
+                  m.locale, m.gyr, m.gmo, m.gda, m.cmo, m.clp, mo, lp, da, u_errorName(status));
+        }
+    }
+
+    // Across the ends of the tables, and the Dangi zone change in 1912,
+    // days must follow each other and map back to themselves.
+    static const int32_t startYears[] = { 1899, 1911, 2100 };
+    static const char *locales[] = { "zh@calendar=chinese", "ko@calendar=dangi" };
+    for (const char *locale : locales) {
+        LocalPointer<Calendar> cal(Calendar::createInstance(TimeZone::getGMT()->clone(), locale, status));
+        LocalPointer<Calendar> inverse(Calendar::createInstance(TimeZone::getGMT()->clone(), locale, status));
+        if (U_FAILURE(status)) {
+            dataerrln("Fail: creating %s - %s", locale, u_errorName(status));
+            return;
+        }
+        for (int32_t startYear : startYears) {
+            greg.clear();
+            greg.set(startYear, UCAL_JUNE, 1, 12, 0);
+            UDate date = greg.getTime(status);
+            int32_t prevDate = 0;
+            for (int32_t i = 0; i < 400; ++i, date += U_MILLIS_PER_DAY) {
+                cal->setTime(date, status);
+                int32_t era = cal->get(UCAL_ERA, status);
+                int32_t yr = cal->get(UCAL_YEAR, status);
+                int32_t mo = cal->get(UCAL_MONTH, status);
+                int32_t lp = cal->get(UCAL_IS_LEAP_MONTH, status);
+                int32_t da = cal->get(UCAL_DATE, status);
+                inverse->clear();
+                inverse->set(UCAL_ERA, era);
+                inverse->set(UCAL_YEAR, yr);
+                inverse->set(UCAL_MONTH, mo);
+                inverse->set(UCAL_IS_LEAP_MONTH, lp);
+                inverse->set(UCAL_DATE, da);
+                inverse->set(UCAL_HOUR_OF_DAY, 12);
+                UDate fromFields = inverse->getTime(status);
+                UBool follows = i == 0 || da == prevDate + 1 ||
+                    (da == 1 && (prevDate == 29 || prevDate == 30));
+                if (U_FAILURE(status) || fromFields != date || !follows) {
+                    errln("Fail: %s day %d after %d-06-01: %d-%d-%02d(%d)-%02d maps back to %.0f, not %.0f - %s",
+                          locale, i, startYear, era, yr, mo + 1, lp, da, fromFields, date,
+                          u_errorName(status));
+                    break;
+                }
+                prevDate = da;
+            }
+        }
+    }
+}
+
+void CalendarTest::TestCalendarCacheCollisions() {
+    // The astronomical Islamic calendar caches month starts in a direct-mapped
+    // table, where months 256 apart share a slot. Alternate between such months,
+    // so that each lookup replaces the other's entry, and check that the fields
+    // still map back to the same days.
+    UErrorCode status = U_ZERO_ERROR;
+    LocalPointer<Calendar> cal(Calendar::createInstance(TimeZone::getGMT()->clone(),
+                                                        "ar@calendar=islamic", status));
+    LocalPointer<Calendar> inverse(Calendar::createInstance(TimeZone::getGMT()->clone(),
+                                                            "ar@calendar=islamic", status));
+    if (U_FAILURE(status)) {
+        dataerrln("Fail: creating the Islamic calendar - %s", u_errorName(status));
+        return;
+    }
+    const int32_t collidingDays = (int32_t)(256 * 29.530588853);  // 256 mean lunar months
+    for (int32_t pass = 0; pass < 2; ++pass) {
+        for (int32_t i = 0; i < 60; ++i) {
+            double day = 18000 + 5 * i + ((i & 1) != 0 ? collidingDays : 0);
+            UDate date = day * U_MILLIS_PER_DAY + 12 * U_MILLIS_PER_HOUR;
+            cal->setTime(date, status);
+            inverse->clear();
+            inverse->set(UCAL_EXTENDED_YEAR, cal->get(UCAL_EXTENDED_YEAR, status));
+            inverse->set(UCAL_MONTH, cal->get(UCAL_MONTH, status));
+            inverse->set(UCAL_DATE, cal->get(UCAL_DATE, status));
+            inverse->set(UCAL_HOUR_OF_DAY, 12);
+            UDate fromFields = inverse->getTime(status);
+            if (U_FAILURE(status) || fromFields != date) {
+                errln("Fail: pass %d day %.0f maps back to %.0f - %s",
+                      pass, day, fromFields / U_MILLIS_PER_DAY, u_errorName(status));
+                return;
+            }
+        }
+    }
+}
+
 #endif /* #if !UCONFIG_NO_FORMATTING */
 
 //eof
@@ -255,6 +255,12 @@ class CalendarTest: public CalendarTimeZoneTest {
     void TestAddAcrossZoneTransition(void);
 
     void TestChineseCalendarMapping(void);
+
+    void TestGregorianDayFields(void);
+
+    void TestChineseCalendarAstroTables(void);
+
+    void TestCalendarCacheCollisions(void);
 };
 
 #endif /* #if !UCONFIG_NO_FORMATTING */
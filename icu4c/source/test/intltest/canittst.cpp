@@ -38,6 +38,7 @@ void CanonicalIteratorTest::runIndexedTest(int32_t index, UBool exec,
         CASE(0, TestBasic);
         CASE(1, TestExhaustive);
         CASE(2, TestAPI);
+        CASE(3, TestMaxResults);
       default: name = ""; break;
     }
 }
@@ -336,4 +337,50 @@ void CanonicalIteratorTest::TestAPI() {
   }
 }
 
+void CanonicalIteratorTest::TestMaxResults() {
+  UErrorCode status = U_ZERO_ERROR;
+  // The combining marks all have different combining classes,
+  // so every order of them is canonically equivalent: far more than 10 strings.
+  UnicodeString input(u"a\u0334\u031B\u0323\u0301\u0345");
+  CanonicalIterator it(input, 10, status);
+  if (U_FAILURE(status)) {
+      dataerrln("Error creating CanonicalIterator: %s", u_errorName(status));
+      return;
+  }
+  UnicodeString nfd;
+  Normalizer::decompose(input, FALSE, 0, nfd, status);
+  UnicodeString first = it.next();
+  if (first != nfd) {
+    errln("CanonicalIterator with maxResults did not return the NFD form first");
+  }
+  int32_t count = 1;
+  UnicodeString s;
+  while (!(s = it.next()).isBogus()) {
+    ++count;
+    UnicodeString sNFD;
+    Normalizer::decompose(s, FALSE, 0, sNFD, status);
+    if (sNFD != nfd) {
+      errln("CanonicalIterator with maxResults returned a non-equivalent string");
+    }
+  }
+  if (count != 10) {
+    errln("CanonicalIterator with maxResults=10 returned %d strings", (int)count);
+  }
+
+  it.reset();
+  count = 0;
+  while (!it.next().isBogus()) {
+    ++count;
+  }
+  if (count != 10) {
+    errln("CanonicalIterator with maxResults=10 returned %d strings after reset()", (int)count);
+  }
+
+  status = U_ZERO_ERROR;
+  CanonicalIterator bad(input, 0, status);
+  if (status != U_ILLEGAL_ARGUMENT_ERROR) {
+    errln("CanonicalIterator with maxResults=0 did not fail with U_ILLEGAL_ARGUMENT_ERROR");
+  }
+}
+
 #endif /* #if !UCONFIG_NO_NORMALIZATION */
@@ -44,6 +44,7 @@ class CanonicalIteratorTest : public IntlTest {
     void TestExhaustive(void);
     void TestBasic();
     void TestAPI();
+    void TestMaxResults();
     UnicodeString collectionToString(Hashtable *col);
     //static UnicodeString collectionToString(Collection col);
 private:
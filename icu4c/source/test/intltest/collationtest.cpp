@@ -71,6 +71,8 @@ class CollationTest : public IntlTest {
     void TestImplicits();
     void TestNulTerminated();
     void TestIllegalUTF8();
+    void TestIdenticalLevel();
+    void TestFCDInertSpansUTF8();
     void TestShortFCDData();
     void TestFCD();
     void TestCollationWeights();
@@ -141,6 +143,8 @@ void CollationTest::runIndexedTest(int32_t index, UBool exec, const char *&name,
     TESTCASE_AUTO(TestImplicits);
     TESTCASE_AUTO(TestNulTerminated);
     TESTCASE_AUTO(TestIllegalUTF8);
+    TESTCASE_AUTO(TestIdenticalLevel);
+    TESTCASE_AUTO(TestFCDInertSpansUTF8);
     TESTCASE_AUTO(TestShortFCDData);
     TESTCASE_AUTO(TestFCD);
     TESTCASE_AUTO(TestCollationWeights);
@@ -315,6 +319,87 @@ void CollationTest::TestIllegalUTF8() {
     }
 }
 
+void CollationTest::TestIdenticalLevel() {
+    IcuTestErrorCode errorCode(*this, "TestIdenticalLevel");
+
+    setRootCollator(errorCode);
+    if(errorCode.isFailure()) {
+        errorCode.reset();
+        return;
+    }
+    coll->setAttribute(UCOL_STRENGTH, UCOL_IDENTICAL, errorCode);
+    coll->setAttribute(UCOL_NORMALIZATION_MODE, UCOL_ON, errorCode);
+
+    // Not FCD, and longer than the buffer for the NFD of the identical level,
+    // so that it is decomposed and written in several pieces.
+    UnicodeString s, sNFD;
+    for(int32_t i = 0; i < 200; ++i) {
+        s.append(u"a\u0301\u0323\uAC00");
+        sNFD.append(u"a\u0323\u0301\u1100\u1161");
+    }
+    if(coll->compare(s, sNFD, errorCode) != UCOL_EQUAL) {
+        errln("identical level: compare(s, NFD(s)) != UCOL_EQUAL");
+    }
+    if(coll->compare(s.getTerminatedBuffer(), -1,
+                     sNFD.getTerminatedBuffer(), -1, errorCode) != UCOL_EQUAL) {
+        errln("identical level: compare(s, NFD(s), NUL-terminated) != UCOL_EQUAL");
+    }
+    CollationKey key, keyNFD;
+    coll->getCollationKey(s, key, errorCode);
+    coll->getCollationKey(sNFD, keyNFD, errorCode);
+    if(key.compareTo(keyNFD, errorCode) != UCOL_EQUAL) {
+        errln("identical level: sort key(s) != sort key(NFD(s))");
+    }
+
+    // A difference only on the identical level, after the first piece:
+    // U+0001 and U+0002 are completely ignorable.
+    UnicodeString t = s + UnicodeString((UChar)1);
+    UnicodeString u = sNFD + UnicodeString((UChar)2);
+    if(coll->compare(t, u, errorCode) != UCOL_LESS) {
+        errln("identical level: compare(s+U+0001, NFD(s)+U+0002) != UCOL_LESS");
+    }
+    CollationKey keyT, keyU;
+    coll->getCollationKey(t, keyT, errorCode);
+    coll->getCollationKey(u, keyU, errorCode);
+    if(keyT.compareTo(keyU, errorCode) != UCOL_LESS) {
+        errln("identical level: sort key(s+U+0001) not less than sort key(NFD(s)+U+0002)");
+    }
+    errorCode.errIfFailureAndReset("identical level comparisons");
+}
+
+void CollationTest::TestFCDInertSpansUTF8() {
+    IcuTestErrorCode errorCode(*this, "TestFCDInertSpansUTF8");
+
+    setRootCollator(errorCode);
+    if(errorCode.isFailure()) {
+        errorCode.reset();
+        return;
+    }
+    coll->setAttribute(UCOL_STRENGTH, UCOL_IDENTICAL, errorCode);
+    coll->setAttribute(UCOL_NORMALIZATION_MODE, UCOL_ON, errorCode);
+
+    // Each pair is canonically equivalent. The first string has a run of
+    // FCD-inert text whose last character is not FCD with the one after the run.
+    static const char *strings[] = {
+        u8"r\u00E9sum\u00E9 \u00E1\u0323 na\u00EFve", u8"r\u00E9sum\u00E9 a\u0323\u0301 na\u00EFve",
+        u8"\u6F22\u5B57\u00E1\u0323\u6F22\u5B57", u8"\u6F22\u5B57a\u0323\u0301\u6F22\u5B57",
+        u8"\u00E9\u00E9\u00E9\u00E1", u8"e\u0301\u00E9e\u0301a\u0301",
+        u8"\u00E9\u00E1\u0F73", u8"\u00E9\u00E1\u0F71\u0F72"
+    };
+
+    for(int32_t i = 0; i < UPRV_LENGTHOF(strings); i += 2) {
+        StringPiece s(strings[i]);
+        StringPiece t(strings[i + 1]);
+        if(coll->compareUTF8(s, t, errorCode) != UCOL_EQUAL) {
+            errln("compareUTF8(pair %d) != UCOL_EQUAL", (int)i);
+        }
+        if(coll->compareUTF8(t, s, errorCode) != UCOL_EQUAL) {
+            errln("compareUTF8(pair %d, reversed) != UCOL_EQUAL", (int)i);
+        }
+    }
+    errorCode.errIfFailureAndReset("compareUTF8()");
+}
+
 namespace {
 
 void addLeadSurrogatesForSupplementary(const UnicodeSet &src, UnicodeSet &dest) {
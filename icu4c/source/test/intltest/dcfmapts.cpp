@@ -101,6 +101,12 @@ void IntlTestDecimalFormatAPI::runIndexedTest( int32_t index, UBool exec, const
                 testInvalidObject();
             }
             break;
+         case 10: name = "testParseUTF8";
+            if(exec) {
+                logln((UnicodeString) "testParseUTF8 ---");
+                testParseUTF8();
+            }
+            break;
        default: name = ""; break;
     }
 }
@@ -1385,3 +1391,35 @@ void IntlTestDecimalFormatAPI::testInvalidObject() {
 }
 
 #endif /* #if !UCONFIG_NO_FORMATTING */
+
+void IntlTestDecimalFormatAPI::testParseUTF8() {
+    IcuTestErrorCode status(*this, "testParseUTF8");
+    LocalPointer<DecimalFormat> df(
+        dynamic_cast<DecimalFormat*>(NumberFormat::createInstance("de", status)), status);
+    if (status.errDataIfFailureAndReset()) { return; }
+
+    double d = 0;
+    assertEquals("double length", 8, df->parseDouble("1.234,56;next", d, status));
+    assertEquals("double value", 1234.56, d);
+    assertEquals("negative double", 2, df->parseDouble("-7", d, status));
+    assertEquals("negative double value", -7.0, d);
+
+    int64_t n = 0;
+    assertEquals("int64 length", 21, df->parseInt64("9.007.199.254.740.993", n, status));
+    assertEquals("int64 value", (int64_t) 9007199254740993LL, n);
+
+    // Non-ASCII grouping separator: length is in bytes
+    LocalPointer<NumberFormat> fr(NumberFormat::createInstance("fr", status), status);
+    DecimalFormat* dfr = dynamic_cast<DecimalFormat*>(fr.getAlias());
+    if (dfr != nullptr) {
+        assertEquals("fr int64 length", 13, dfr->parseInt64(u8"1\u202F234\u202F567", n, status));
+        assertEquals("fr int64 value", (int64_t) 1234567, n);
+    }
+
+    df->parseInt64("1,5", n, status);
+    status.expectErrorAndReset(U_INVALID_FORMAT_ERROR);
+    df->parseDouble("abc", d, status);
+    status.expectErrorAndReset(U_INVALID_FORMAT_ERROR);
+    df->parseDouble("", d, status);
+    status.expectErrorAndReset(U_INVALID_FORMAT_ERROR);
+}
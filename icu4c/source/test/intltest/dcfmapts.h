@@ -35,6 +35,7 @@ class IntlTestDecimalFormatAPI: public IntlTest {
     void TestRequiredDecimalPoint();
     void testErrorCode();
     void testInvalidObject();
+    void testParseUTF8();
 private:
     /*Helper functions */
     void verify(const UnicodeString& message, const UnicodeString& got, double expected);
@@ -122,6 +122,9 @@ void DateFormatTest::runIndexedTest( int32_t index, UBool exec, const char* &nam
     TESTCASE_AUTO(TestMinuteSecondFieldsInOddPlaces);
     TESTCASE_AUTO(TestDayPeriodParsing);
     TESTCASE_AUTO(TestParseRegression13744);
+    TESTCASE_AUTO(TestFormatToBuffer);
+    TESTCASE_AUTO(TestFormatDateWithoutCalendar);
+    TESTCASE_AUTO(TestParseFixedNumeric);
 
     TESTCASE_AUTO_END;
 }
@@ -5557,6 +5560,200 @@ void DateFormatTest::TestParseRegression13744() {
     assertEquals("Error index", inDate.length(), pos.getErrorIndex());
 }
 
+void DateFormatTest::TestFormatToBuffer() {
+    IcuTestErrorCode status(*this, "TestFormatToBuffer");
+    SimpleDateFormat sdf(u"yyyy-MM-dd'T'HH:mm:ss.SSS 'o''clock' ''yy''", Locale::getEnglish(), status);
+    if (status.errDataIfFailureAndReset("SimpleDateFormat constructor")) {
+        return;
+    }
+    sdf.adoptTimeZone(TimeZone::createTimeZone(u"Etc/GMT"));
+    UDate date = 1559392496789.0;  // 2019-06-01T12:34:56.789Z
+    UnicodeString expected(u"2019-06-01T12:34:56.789 o'clock '19'");
+    UnicodeString result;
+    assertEquals("format()", expected, sdf.format(date, result));
+
+    char16_t buffer16[40];
+    int32_t length = sdf.formatToUTF16(date, nullptr, 0, status);
+    assertEquals("formatToUTF16() preflighting", U_BUFFER_OVERFLOW_ERROR, status.reset());
+    assertEquals("formatToUTF16() preflighting length", expected.length(), length);
+    length = sdf.formatToUTF16(date, buffer16, UPRV_LENGTHOF(buffer16), status);
+    assertSuccess("formatToUTF16()", status);
+    assertEquals("formatToUTF16()", expected, UnicodeString(buffer16, length));
+    assertEquals("formatToUTF16() NUL-terminated", (char16_t)0, buffer16[length]);
+
+    char buffer8[40];
+    length = sdf.formatToUTF8(date, buffer8, 10, status);
+    assertEquals("formatToUTF8() overflow", U_BUFFER_OVERFLOW_ERROR, status.reset());
+    assertEquals("formatToUTF8() overflow length", expected.length(), length);
+    length = sdf.formatToUTF8(date, buffer8, UPRV_LENGTHOF(buffer8), status);
+    assertSuccess("formatToUTF8()", status);
+    assertEquals("formatToUTF8()", "2019-06-01T12:34:56.789 o'clock '19'", buffer8);
+
+    // Numeric fields that bypass the number formatter must match the ones that do not.
+    // Year 12345 is wider than "yy" and than the fast formatters' minimum widths.
+    static const char16_t *patterns[] = {
+        u"y yy yyy yyyy yyyyy M MM d dd H HH m mm s ss S SS SSSS D DDD",
+        u"G y-M-d h:m:s a"
+    };
+    UDate dates[] = { date, -62135596800000.0, 327403382400000.0 };
+    for (const char16_t *pattern : patterns) {
+        SimpleDateFormat ascii(pattern, Locale::getEnglish(), status);
+        SimpleDateFormat thai(pattern, u"thai", Locale::getEnglish(), status);
+        SimpleDateFormat latnOverride(pattern, u"latn", Locale::getEnglish(), status);
+        if (!assertSuccess("SimpleDateFormat constructors", status)) {
+            return;
+        }
+        ascii.adoptTimeZone(TimeZone::createTimeZone(u"Etc/GMT"));
+        thai.adoptTimeZone(TimeZone::createTimeZone(u"Etc/GMT"));
+        latnOverride.adoptTimeZone(TimeZone::createTimeZone(u"Etc/GMT"));
+        for (UDate d : dates) {
+            UnicodeString asciiResult, thaiResult, latnResult;
+            ascii.format(d, asciiResult);
+            thai.format(d, thaiResult);
+            latnOverride.format(d, latnResult);
+            // The Thai digits U+0E50..U+0E59 map back to ASCII one-to-one.
+            for (int32_t i = 0; i < thaiResult.length(); ++i) {
+                char16_t c = thaiResult.charAt(i);
+                if (0xe50 <= c && c <= 0xe59) {
+                    thaiResult.setCharAt(i, (char16_t)(u'0' + c - 0xe50));
+                }
+            }
+            assertEquals(UnicodeString(u"Thai digits vs. fast digits: ") + pattern, thaiResult, asciiResult);
+            assertEquals(UnicodeString(u"latn override vs. fast digits: ") + pattern, latnResult, asciiResult);
+        }
+    }
+}
+
+void DateFormatTest::TestFormatDateWithoutCalendar() {
+    // format(UDate) computes the fields of a GregorianCalendar itself for most patterns.
+    // Compare with formatting a Calendar, which always takes the Calendar's fields.
+    IcuTestErrorCode status(*this, "TestFormatDateWithoutCalendar");
+    static const char16_t *patterns[] = {
+        u"GGGG yyyy-MM-dd'T'HH:mm:ss.SSS zzzz",
+        u"EEEE d MMMM y G, h:mm:ss a Z VVVV",
+        u"yy MMMMM LLL D u A, K:mm k:mm, QQQQ qqq, XXX xxxxx O",
+        u"h:mm b B vvvv",
+        u"EEEEEE EEEEE MMM d yyyyy",
+        u"Y-'W'ww-e"  // not computed without a Calendar
+    };
+    static const char *locales[] = { "en", "de", "ar", "hi_IN", "ja" };
+    static const char16_t *zones[] = { u"America/Los_Angeles", u"Europe/Berlin", u"Australia/Lord_Howe", u"Etc/GMT-14" };
+    UDate dates[] = {
+        0.0,
+        1559392496789.0,                 // 2019-06-01T12:34:56.789Z
+        1552212000000.0 - 1.0,           // just before a DST transition in Los Angeles
+        1552212000000.0,
+        951782400000.0,                  // 2000-02-29
+        -12219292800000.0,               // the Gregorian cutover
+        -12219292800000.0 + 400.0 * U_MILLIS_PER_DAY,
+        -62135596800000.0,               // Julian 0001-01-03
+        253402300799999.0,               // 9999-12-31T23:59:59.999Z
+        -1.0
+    };
+    for (const char *localeID : locales) {
+        Locale locale(localeID);
+        for (const char16_t *pattern : patterns) {
+            SimpleDateFormat sdf(pattern, locale, status);
+            if (status.errDataIfFailureAndReset("SimpleDateFormat(%s)", localeID)) {
+                return;
+            }
+            for (const char16_t *zone : zones) {
+                sdf.adoptTimeZone(TimeZone::createTimeZone(zone));
+                LocalPointer<Calendar> cal(sdf.getCalendar()->clone());
+                for (UDate date : dates) {
+                    UnicodeString expected, actual, actualIter;
+                    FieldPosition pos(FieldPosition::DONT_CARE);
+                    cal->setTime(date, status);
+                    sdf.format(*cal, expected, pos);
+                    sdf.format(date, actual);
+                    FieldPositionIterator iter;
+                    sdf.format(date, actualIter, &iter, status);
+                    status.errIfFailureAndReset();
+                    assertEquals(UnicodeString(localeID) + u" " + zone + u" " + pattern, expected, actual);
+                    assertEquals(UnicodeString(localeID) + u" " + zone + u" posIter " + pattern,
+                                 expected, actualIter);
+                }
+            }
+        }
+    }
+
+    // Field positions are reported as before.
+    SimpleDateFormat sdf(u"EEE, d MMM yyyy HH:mm", Locale::getEnglish(), status);
+    sdf.adoptTimeZone(TimeZone::createTimeZone(u"Etc/GMT"));
+    UnicodeString result;
+    FieldPosition pos(UDAT_MONTH_FIELD);
+    sdf.format(1559392496789.0, result, pos);
+    assertEquals("month field", u"Sat, 1 Jun 2019 12:34", result);
+    assertEquals("month field begin", 7, pos.getBeginIndex());
+    assertEquals("month field end", 10, pos.getEndIndex());
+}
+
+void DateFormatTest::TestParseFixedNumeric() {
+    // parse(text, ParsePosition&) computes the UDate itself for fixed-width numeric patterns.
+    // Compare with parsing into a Calendar, which always takes the generic path.
+    IcuTestErrorCode status(*this, "TestParseFixedNumeric");
+    static const struct {
+        const char16_t *pattern;
+        const char16_t *text;
+    } cases[] = {
+        { u"yyyy-MM-dd'T'HH:mm:ss.SSSXXX", u"2019-06-01T12:34:56.789Z" },
+        { u"yyyy-MM-dd'T'HH:mm:ss.SSSXXX", u"2019-06-01T12:34:56.789+05:30" },
+        { u"yyyy-MM-dd'T'HH:mm:ss.SSSXXX", u"2019-06-01T12:34:56.789-08:00 trailing" },
+        { u"yyyy-MM-dd'T'HH:mm:ss.SSSXXX", u"2019-06-01T12:34:56.789+05:30:15" },
+        { u"yyyy-MM-dd'T'HH:mm:ss.SSSXXX", u"2019-06-01T12:34:56.7891Z" },
+        { u"yyyy-MM-dd'T'HH:mm:ss.SSSXXX", u"2019-13-01T12:34:56.789Z" },
+        { u"yyyy-MM-dd'T'HH:mm:ss.SSSxx", u"2019-06-01T12:34:56.789+0530" },
+        { u"yyyy-MM-dd'T'HH:mm:ss.SSSxx", u"2019-06-01T12:34:56.789Z" },
+        { u"yyyy-MM-dd HH:mm:ss", u"2019-03-10 02:30:00" },   // skipped in Los Angeles
+        { u"yyyy-MM-dd HH:mm:ss", u"2019-11-03 01:30:00" },   // repeated in Los Angeles
+        { u"yyyy-MM-dd HH:mm:ss", u"2019-02-29 00:00:00" },
+        { u"yyyy-MM-dd HH:mm:ss", u"2000-02-29 23:59:59" },
+        { u"yyyy-MM-dd HH:mm:ss", u"1582-10-15 00:00:00" },  // the Gregorian cutover
+        { u"yyyy-MM-dd HH:mm:ss", u"2019-06-01 12:34:567" },
+        { u"yyyy-MM-dd HH:mm:ss", u"2019-06-01 12:34" },
+        { u"yyyyMMddHHmmss", u"20190601123456" },
+        { u"yyyyMMdd.S", u"20190601.5" },
+        { u"yyyyMMdd.SSSSSS", u"20190601.123456" },
+        { u"dd/MM/yyyy", u"31/12/9999" },
+        { u"dd/MM/yyyy", u"01/01/0001" }
+    };
+    static const char16_t *zones[] = { u"America/Los_Angeles", u"Australia/Lord_Howe", u"Etc/GMT-14" };
+    for (const auto &cas : cases) {
+        for (const char16_t *zone : zones) {
+            for (int32_t lenient = 0; lenient <= 1; ++lenient) {
+                SimpleDateFormat sdf(cas.pattern, Locale::getEnglish(), status);
+                if (status.errDataIfFailureAndReset("SimpleDateFormat")) {
+                    return;
+                }
+                sdf.adoptTimeZone(TimeZone::createTimeZone(zone));
+                sdf.setLenient(lenient);
+                UnicodeString text(cas.text);
+                UnicodeString message = UnicodeString(cas.pattern) + u" " + text + u" " + zone +
+                    (lenient ? u" lenient" : u"");
+
+                ParsePosition expectedPos(0);
+                UDate expected = 0;
+                LocalPointer<Calendar> cal(sdf.getCalendar()->clone());
+                cal->clear();
+                sdf.parse(text, *cal, expectedPos);
+                if (expectedPos.getIndex() != 0) {
+                    expected = cal->getTime(status);
+                    if (status.isFailure()) {
+                        status.reset();
+                        expectedPos.setIndex(0);
+                        expected = 0;
+                    }
+                }
+
+                ParsePosition actualPos(0);
+                UDate actual = sdf.parse(text, actualPos);
+                assertEquals(message + u" index", expectedPos.getIndex(), actualPos.getIndex());
+                assertEquals(message, expected, actual);
+            }
+        }
+    }
+}
+
 #endif /* #if !UCONFIG_NO_FORMATTING */
 
 //eof
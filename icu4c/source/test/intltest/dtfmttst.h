@@ -262,6 +262,9 @@ class DateFormatTest: public CalendarTimeZoneTest {
     void TestMinuteSecondFieldsInOddPlaces();
     void TestDayPeriodParsing();
     void TestParseRegression13744();
+    void TestFormatToBuffer();
+    void TestFormatDateWithoutCalendar();
+    void TestParseFixedNumeric();
 
 private:
     UBool showParse(DateFormat &format, const UnicodeString &formattedString);
@@ -57,6 +57,7 @@ void DateIntervalFormatTest::runIndexedTest( int32_t index, UBool exec, const ch
         TESTCASE(8, testTicket11669);
         TESTCASE(9, testTicket12065);
         TESTCASE(10, testFormattedDateInterval);
+        TESTCASE(11, testCachedInstances);
         default: name = ""; break;
     }
 }
@@ -1769,4 +1770,45 @@ void DateIntervalFormatTest::testFormattedDateInterval() {
 }
 
 
+void DateIntervalFormatTest::testCachedInstances() {
+    // createInstance(skeleton, locale) clones a formatter cached for the locale and skeleton.
+    IcuTestErrorCode status(*this, "testCachedInstances");
+    LocalPointer<DateIntervalFormat> first(
+        DateIntervalFormat::createInstance(u"yMMMdjm", Locale::getGerman(), status), status);
+    LocalPointer<DateIntervalFormat> second(
+        DateIntervalFormat::createInstance(u"yMMMdjm", Locale::getGerman(), status), status);
+    if (status.errDataIfFailureAndReset("createInstance")) {
+        return;
+    }
+    assertTrue("instances equal", *first == *second);
+    assertTrue("instances not shared", first.getAlias() != second.getAlias());
+
+    // A change to one instance does not affect the cached formatter.
+    LocalPointer<TimeZone> berlin(TimeZone::createTimeZone(u"Europe/Berlin"));
+    LocalPointer<TimeZone> tokyo(TimeZone::createTimeZone(u"Asia/Tokyo"));
+    first->setTimeZone(*tokyo);
+    DateInterval interval(1559392496789.0, 1559392496789.0 + 3 * U_MILLIS_PER_HOUR);
+    FieldPosition pos(FieldPosition::DONT_CARE);
+    UnicodeString tokyoResult, result;
+    first->format(&interval, tokyoResult, pos, status);
+    LocalPointer<DateIntervalFormat> third(
+        DateIntervalFormat::createInstance(u"yMMMdjm", Locale::getGerman(), status), status);
+    assertTrue("unaffected by setTimeZone", *second == *third);
+
+    // New instances use the current default time zone.
+    LocalPointer<TimeZone> savedDefault(TimeZone::createDefault());
+    TimeZone::setDefault(*tokyo);
+    LocalPointer<DateIntervalFormat> fourth(
+        DateIntervalFormat::createInstance(u"yMMMdjm", Locale::getGerman(), status), status);
+    fourth->format(&interval, result, pos, status);
+    assertEquals("default time zone", tokyoResult, result);
+    TimeZone::setDefault(*berlin);
+    LocalPointer<DateIntervalFormat> fifth(
+        DateIntervalFormat::createInstance(u"yMMMdjm", Locale::getGerman(), status), status);
+    assertEquals("time zone after setDefault", UnicodeString(u"Europe/Berlin"),
+                 fifth->getTimeZone().getID(result.remove()));
+    TimeZone::setDefault(*savedDefault);
+    status.errIfFailureAndReset();
+}
+
 #endif /* #if !UCONFIG_NO_FORMATTING */
@@ -66,6 +66,8 @@ class DateIntervalFormatTest: public IntlTestWithFieldPosition {
 
     void testFormattedDateInterval();
 
+    void testCachedInstances();
+
 private:
     /**
      * Test formatting against expected result
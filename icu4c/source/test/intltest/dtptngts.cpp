@@ -43,6 +43,7 @@ void IntlTestDateTimePatternGeneratorAPI::runIndexedTest( int32_t index, UBool e
         TESTCASE(7, testJjMapping);
         TESTCASE(8, test20640_HourCyclArsEnNH);
         TESTCASE(9, testFallbackWithDefaultRootLocale);
+        TESTCASE(10, testSharedInstanceData);
         default: name = ""; break;
     }
 }
@@ -1475,4 +1476,47 @@ void IntlTestDateTimePatternGeneratorAPI::testFallbackWithDefaultRootLocale() {
     }
 }
 
+void IntlTestDateTimePatternGeneratorAPI::testSharedInstanceData() {
+    // createInstance() clones a cached generator, and the clones share a memo of best patterns
+    // until one of them is modified.
+    IcuTestErrorCode status(*this, "testSharedInstanceData");
+    static const char16_t *skeletons[] = { u"yMMMd", u"jmm", u"yMMMdjmm", u"EEEEMMMMd", u"Hms" };
+    static const char *locales[] = { "en", "de", "ja@calendar=japanese", "ar" };
+    for (const char *localeID : locales) {
+        Locale locale(localeID);
+        LocalPointer<DateTimePatternGenerator> first(DateTimePatternGenerator::createInstance(locale, status));
+        LocalPointer<DateTimePatternGenerator> second(DateTimePatternGenerator::createInstance(locale, status));
+        if (status.errDataIfFailureAndReset("createInstance(%s)", localeID)) {
+            return;
+        }
+        assertTrue(UnicodeString(localeID) + " instances equal", *first == *second);
+        for (const char16_t *skeleton : skeletons) {
+            UnicodeString message = UnicodeString(localeID) + u" " + skeleton;
+            UnicodeString expected = first->getBestPattern(skeleton, status);
+            assertEquals(message + u" memoized", expected, second->getBestPattern(skeleton, status));
+            assertEquals(message + u" memoized again", expected, first->getBestPattern(skeleton, status));
+            LocalPointer<DateTimePatternGenerator> clone(first->clone());
+            assertEquals(message + u" clone", expected, clone->getBestPattern(skeleton, status));
+        }
+        // A modified instance no longer uses the memo, and does not affect the others.
+        UnicodeString conflictingPattern;
+        second->addPattern(u"d'x'MMMy", TRUE, conflictingPattern, status);
+        assertEquals(UnicodeString(localeID) + " modified", u"d'x'MMMy", second->getBestPattern(u"yMMMd", status));
+        LocalPointer<DateTimePatternGenerator> third(DateTimePatternGenerator::createInstance(locale, status));
+        assertEquals(UnicodeString(localeID) + " unmodified", first->getBestPattern(u"yMMMd", status),
+                     third->getBestPattern(u"yMMMd", status));
+        assertTrue(UnicodeString(localeID) + " modified differs", *first != *second);
+        status.errIfFailureAndReset();
+    }
+
+    // Options are part of the memo key.
+    LocalPointer<DateTimePatternGenerator> gen(DateTimePatternGenerator::createInstance(Locale::getEnglish(), status));
+    if (status.errDataIfFailureAndReset("createInstance(en)")) {
+        return;
+    }
+    assertEquals("no options", u"h:mm a", gen->getBestPattern(u"hhmm", status));
+    assertEquals("hour field length", u"hh:mm a", gen->getBestPattern(u"hhmm", UDATPG_MATCH_HOUR_FIELD_LENGTH, status));
+    assertEquals("no options again", u"h:mm a", gen->getBestPattern(u"hhmm", status));
+}
+
 #endif /* #if !UCONFIG_NO_FORMATTING */
@@ -35,6 +35,7 @@ class IntlTestDateTimePatternGeneratorAPI : public IntlTest {
     void testJjMapping();
     void test20640_HourCyclArsEnNH();
     void testFallbackWithDefaultRootLocale();
+    void testSharedInstanceData();
 };
 
 #endif /* #if !UCONFIG_NO_FORMATTING */
@@ -6,6 +6,7 @@
 #if !UCONFIG_NO_FORMATTING
 
 #include <set>
+#include <string>
 
 #include "unicode/formattedvalue.h"
 #include "unicode/unum.h"
@@ -217,6 +218,14 @@ void IntlTestWithFieldPosition::checkMixedFormattedValue(
             0, readOnlyAlias.getBuffer()[readOnlyAlias.length()]);
     }
 
+    // The UTF-8 string appends to what is in the sink
+    std::string utf8 = "<";
+    StringByteSink<std::string> sink(&utf8);
+    fv.appendToUTF8(sink, status);
+    std::string expectedUTF8 = "<";
+    expectedString.toUTF8String(expectedUTF8);
+    assertEquals(baseMessage + u"UTF-8", expectedUTF8.c_str(), utf8.c_str());
+
     // Check nextPosition over all fields
     ConstrainedFieldPosition cfpos;
     for (int32_t i = 0; i < length; i++) {
@@ -23,6 +23,7 @@
 #include "unicode/udata.h"
 #include "cmemory.h"
 #include "putilimp.h"
+#include "uresimp.h"
 #include "testutil.h"
 
 #include <string.h>
@@ -77,6 +78,8 @@ void IntlTestRBNF::runIndexedTest(int32_t index, UBool exec, const char* &name,
         TESTCASE(25, TestCompactDecimalFormatStyle);
         TESTCASE(26, TestParseFailure);
         TESTCASE(27, TestMinMaxIntegerDigitsIgnored);
+        TESTCASE(28, TestCopiedRuleSets);
+        TESTCASE(29, TestLenientParseCache);
 #else
         TESTCASE(0, TestRBNFDisabled);
 #endif
@@ -2320,6 +2323,147 @@ void IntlTestRBNF::TestMinMaxIntegerDigitsIgnored() {
     }
 }
 
+void IntlTestRBNF::TestCopiedRuleSets() {
+    IcuTestErrorCode status(*this, "TestCopiedRuleSets");
+
+    // Formatters created from a rule set tag copy the rules parsed by a
+    // cached instance, and copies of a formatter copy its parsed rules;
+    // both must behave like a formatter that parses the same description.
+    static const char* const locales[] = { "en", "de", "fr", "es", "ru", "he", "sv", "it" };
+    static const URBNFRuleSetTag tags[] = { URBNF_SPELLOUT, URBNF_ORDINAL };
+    static const char* const tagNames[] = { "SpelloutRules", "OrdinalRules" };
+    static const double numbers[] = {
+        0, 1, 2, 3, 5, 11, 21, 22, 25, 99, 101, 112, 1000, 1234, 21001, 1000000,
+        -17, 1.5, 0.25, 123.45, 2000000000, 1234567890123.0
+    };
+    for (int32_t i = 0; i < UPRV_LENGTHOF(locales); ++i) {
+        Locale locale(locales[i]);
+        for (int32_t t = 0; t < UPRV_LENGTHOF(tags); ++t) {
+            UnicodeString desc;
+            LocalUResourceBundlePointer nfrb(ures_open(U_ICUDATA_NAME U_TREE_SEPARATOR_STRING "rbnf", locales[i], status));
+            LocalUResourceBundlePointer rbnfRules(
+                ures_getByKeyWithFallback(nfrb.getAlias(), "RBNFRules", NULL, status));
+            LocalUResourceBundlePointer ruleSets(
+                ures_getByKeyWithFallback(rbnfRules.getAlias(), tagNames[t], NULL, status));
+            while (status.isSuccess() && ures_hasNext(ruleSets.getAlias())) {
+                desc.append(ures_getNextUnicodeString(ruleSets.getAlias(), NULL, status));
+            }
+            UParseError perror;
+            RuleBasedNumberFormat parsed(desc, locale, perror, status);
+            RuleBasedNumberFormat fromTag(tags[t], locale, status);
+            if (status.errIfFailureAndReset("%s %s", locales[i], tagNames[t])) {
+                continue;
+            }
+            LocalPointer<RuleBasedNumberFormat> copy(static_cast<RuleBasedNumberFormat*>(fromTag.clone()));
+            assertTrue(UnicodeString(locales[i]) + u" tag formatter equals parsed one", fromTag == parsed);
+            assertTrue(UnicodeString(locales[i]) + u" copy equals original", *copy == fromTag);
+            assertEquals(UnicodeString(locales[i]) + u" rules", parsed.getRules(), copy->getRules());
+
+            for (int32_t r = 0; r < parsed.getNumberOfRuleSetNames(); ++r) {
+                UnicodeString ruleSetName = parsed.getRuleSetName(r);
+                for (int32_t n = 0; n < UPRV_LENGTHOF(numbers); ++n) {
+                    UnicodeString expected, actual, actualCopy;
+                    FieldPosition pos;
+                    parsed.format(numbers[n], ruleSetName, expected, pos, status);
+                    fromTag.format(numbers[n], ruleSetName, actual, pos, status);
+                    copy->format(numbers[n], ruleSetName, actualCopy, pos, status);
+                    UnicodeString message = UnicodeString(locales[i]) + u" " + ruleSetName + u" " + numbers[n];
+                    assertEquals(message, expected, actual);
+                    assertEquals(message + u" (copy)", expected, actualCopy);
+                }
+            }
+        }
+    }
+
+    // the default rule set and the decimal format symbols carry over to a copy
+    RuleBasedNumberFormat en(URBNF_SPELLOUT, "en", status);
+    if (status.errIfFailureAndReset("en spellout")) {
+        return;
+    }
+    en.setDefaultRuleSet(u"%spellout-ordinal", status);
+    RuleBasedNumberFormat enCopy(en);
+    UnicodeString result;
+    assertEquals("copied default rule set", u"twenty-first", enCopy.format((int32_t)21, result.remove()));
+    assertEquals("copied default rule set name", u"%spellout-ordinal", enCopy.getDefaultRuleSetName());
+
+    UParseError perror;
+    RuleBasedNumberFormat decimal(u"%main: 0: =#,##0.00=;", Locale::getEnglish(), perror, status);
+    if (status.errIfFailureAndReset("decimal rules")) {
+        return;
+    }
+    DecimalFormatSymbols symbols("en", status);
+    symbols.setSymbol(DecimalFormatSymbols::kDecimalSeparatorSymbol, u",");
+    symbols.setSymbol(DecimalFormatSymbols::kGroupingSeparatorSymbol, u".");
+    decimal.setDecimalFormatSymbols(symbols);
+    RuleBasedNumberFormat decimalCopy(decimal);
+    assertEquals("copied symbols", u"1.234,50", decimalCopy.format(1234.5, result.remove()));
+}
+
+void IntlTestRBNF::TestLenientParseCache() {
+    IcuTestErrorCode status(*this, "TestLenientParseCache");
+
+    // Lenient parsing matches rule text against cached collation weights;
+    // the results must not depend on whether the cache is already filled,
+    // and must survive copying the formatter and toggling leniency.
+    static const struct {
+        const char* text;
+        int32_t expected;
+    } enData[] = {
+        { "fifty-7", 57 },
+        { " fifty-7", 57 },
+        { "  fifty-7", 57 },
+        { "2 thousand six HUNDRED fifty-7", 2657 },
+        { "fifteen hundred and zero", 1500 },
+        { "FOurhundred     thiRTY six", 436 },
+    };
+    RuleBasedNumberFormat en(URBNF_SPELLOUT, Locale::getEnglish(), status);
+    if (status.errIfFailureAndReset("en spellout")) {
+        return;
+    }
+    en.setLenient(TRUE);
+    for (int32_t pass = 0; pass < 3; ++pass) {
+        if (pass == 2) {
+            en.setLenient(FALSE);
+            en.setLenient(TRUE);
+        }
+        LocalPointer<RuleBasedNumberFormat> copy(static_cast<RuleBasedNumberFormat*>(en.clone()));
+        for (int32_t i = 0; i < UPRV_LENGTHOF(enData); ++i) {
+            Formattable result, resultCopy;
+            UnicodeString text(enData[i].text, -1, US_INV);
+            en.parse(text, result, status);
+            copy->parse(text, resultCopy, status);
+            if (status.errIfFailureAndReset("%s", enData[i].text)) {
+                continue;
+            }
+            assertEquals(text, enData[i].expected, result.getLong());
+            assertEquals(text + u" (copy)", enData[i].expected, resultCopy.getLong());
+        }
+    }
+
+    // lenient parsing of formatted text, including plural rule text
+    static const char* const locales[] = { "de", "es", "fr", "it" };
+    static const int32_t numbers[] = { 1, 2, 21, 35, 101, 1001, 2345 };
+    for (int32_t i = 0; i < UPRV_LENGTHOF(locales); ++i) {
+        RuleBasedNumberFormat formatter(URBNF_SPELLOUT, locales[i], status);
+        if (status.errIfFailureAndReset("%s spellout", locales[i])) {
+            continue;
+        }
+        for (int32_t n = 0; n < UPRV_LENGTHOF(numbers); ++n) {
+            UnicodeString text;
+            formatter.format(numbers[n], text);
+            Formattable strict, lenient;
+            formatter.setLenient(FALSE);
+            formatter.parse(text, strict, status);
+            formatter.setLenient(TRUE);
+            formatter.parse(text, lenient, status);
+            if (status.errIfFailureAndReset("%s %d", locales[i], numbers[n])) {
+                continue;
+            }
+            assertEquals(UnicodeString(locales[i]) + u" " + text, strict.getLong(), lenient.getLong());
+        }
+    }
+}
+
 void 
 IntlTestRBNF::doTest(RuleBasedNumberFormat* formatter, const char* const testData[][2], UBool testParsing) 
 {
@@ -28,6 +28,7 @@
 
 #include <stdlib.h>
 #include <stdio.h>
+#include <string>
 
 #define TEST_ASSERT_SUCCESS(status) {if (U_FAILURE(status)) { \
     errcheckln(status, "Failure at file %s, line %d, error = %s", __FILE__, __LINE__, u_errorName(status));}}
@@ -93,6 +94,8 @@ void IntlTestSpoof::runIndexedTest( int32_t index, UBool exec, const char* &name
     TESTCASE_AUTO(testBug13314_MixedNumbers);
     TESTCASE_AUTO(testBug13328_MixedCombiningMarks);
     TESTCASE_AUTO(testCombiningDot);
+    TESTCASE_AUTO(testSkeletonUTF8);
+    TESTCASE_AUTO(testConfusableWithAny);
     TESTCASE_AUTO_END;
 }
 
@@ -752,4 +755,93 @@ void IntlTestSpoof::testCombiningDot() {
     }
 }
 
+void IntlTestSpoof::testSkeletonUTF8() {
+    UErrorCode status = U_ZERO_ERROR;
+    LocalUSpoofCheckerPointer sc(uspoof_open(&status));
+    if (!assertSuccess("", status, true, __FILE__, __LINE__)) { return; }
+
+    // ASCII identifiers take a shortcut; it must give the same skeletons.
+    static const char16_t *const cases[] = {
+        u"nochange",
+        u"1ove",
+        u"00PS",
+        u"rnodern",
+        u"\"quoted\" | pipe",
+        u"A long string that wi11 overflow stack buffers.  A long string that will overflow stack buffers.",
+        u"\u0391\u13CF\u017F",
+        u"ca\u0301fe\u0301",
+        u"",
+    };
+    for (const char16_t *input : cases) {
+        UnicodeString id(input);
+        UnicodeString expected;
+        uspoof_getSkeletonUnicodeString(sc.getAlias(), 0, id, expected, &status);
+        std::string id8, expected8;
+        id.toUTF8String(id8);
+        expected.toUTF8String(expected8);
+        char dest[200];
+        int32_t length = uspoof_getSkeletonUTF8(sc.getAlias(), 0, id8.c_str(), -1,
+                                                dest, UPRV_LENGTHOF(dest), &status);
+        TEST_ASSERT_SUCCESS(status);
+        assertEquals(id, expected8.c_str(), std::string(dest, length).c_str());
+        assertEquals(id + u" NUL-terminated", (char)0, dest[length]);
+
+        // Preflighting.
+        UErrorCode preflightStatus = U_ZERO_ERROR;
+        length = uspoof_getSkeletonUTF8(sc.getAlias(), 0, id8.c_str(), -1, nullptr, 0,
+                                        &preflightStatus);
+        assertEquals(id + u" preflight", (int32_t)expected8.length(), length);
+        assertEquals(id + u" preflight status",
+                     expected8.empty() ? U_STRING_NOT_TERMINATED_WARNING : U_BUFFER_OVERFLOW_ERROR,
+                     preflightStatus);
+
+        // Skeleton into the input string itself.
+        UnicodeString same(id);
+        uspoof_getSkeletonUnicodeString(sc.getAlias(), 0, same, same, &status);
+        assertEquals(id + u" in place", expected, same);
+    }
+}
+
+void IntlTestSpoof::testConfusableWithAny() {
+    UErrorCode status = U_ZERO_ERROR;
+    LocalUSpoofCheckerPointer sc(uspoof_open(&status));
+    if (!assertSuccess("", status, true, __FILE__, __LINE__)) { return; }
+
+    static const char16_t *const existing[] = { u"paypal", u"modern", u"\u0441\u0435\u0440\u0433\u0435\u0439" };
+    UnicodeSet skeletons;
+    for (const char16_t *id : existing) {
+        UnicodeString skeleton;
+        skeletons.add(uspoof_getSkeletonUnicodeString(sc.getAlias(), 0, id, skeleton, &status));
+    }
+    skeletons.freeze();
+    TEST_ASSERT_SUCCESS(status);
+
+    static const struct TestCase {
+        bool confusable;
+        const char16_t *id;
+    } cases[] = {
+        {true, u"paypal"},
+        {true, u"paypa1"},
+        {true, u"p\u0430yp\u0430l"},  // Cyrillic a
+        {true, u"rnodern"},
+        {true, u"cepre\u0439"},  // Latin with Cyrillic short i
+        {false, u"paypals"},
+        {false, u"model"},
+        {false, u""},
+    };
+    for (auto &cas : cases) {
+        UnicodeString id(cas.id);
+        assertEquals(id, cas.confusable,
+                     (bool)uspoof_isConfusableWithAnyUnicodeString(sc.getAlias(), skeletons, id, &status));
+        assertEquals(id + u" UTF-16", cas.confusable,
+                     (bool)uspoof_isConfusableWithAny(sc.getAlias(), skeletons.toUSet(), cas.id, -1, &status));
+        std::string id8;
+        id.toUTF8String(id8);
+        assertEquals(id + u" UTF-8", cas.confusable,
+                     (bool)uspoof_isConfusableWithAnyUTF8(sc.getAlias(), skeletons.toUSet(),
+                                                          id8.c_str(), -1, &status));
+        TEST_ASSERT_SUCCESS(status);
+    }
+}
+
 #endif /* !UCONFIG_NO_REGULAR_EXPRESSIONS && !UCONFIG_NO_NORMALIZATION && !UCONFIG_NO_FILE_IO */
@@ -396,6 +396,8 @@ class LocalPointerTest : public IntlTest {
     void TestLocalXyzPointerMoveSwap();
     void TestLocalXyzPointerNull();
     void TestLocalXyzStdUniquePtr();
+    void TestMemoryPool();
+    void TestMaybeStackVector();
 };
 
 static IntlTest *createLocalPointerTest() {
@@ -417,6 +419,8 @@ void LocalPointerTest::runIndexedTest(int32_t index, UBool exec, const char *&na
     TESTCASE_AUTO(TestLocalXyzPointerMoveSwap);
     TESTCASE_AUTO(TestLocalXyzPointerNull);
     TESTCASE_AUTO(TestLocalXyzStdUniquePtr);
+    TESTCASE_AUTO(TestMemoryPool);
+    TESTCASE_AUTO(TestMaybeStackVector);
     TESTCASE_AUTO_END;
 }
 
@@ -648,6 +652,92 @@ void LocalPointerTest::TestLocalArrayStdUniquePtr() {
     assertTrue("Pointer should remain the same", ptr == a2.getAlias());
 }
 
+namespace {
+
+struct PoolItem {
+    PoolItem(int32_t v, int32_t &liveCount) : value(v), live(liveCount) { ++live; }
+    ~PoolItem() { --live; }
+    int32_t value;
+    int32_t &live;
+};
+
+}  // namespace
+
+void LocalPointerTest::TestMemoryPool() {
+    int32_t live = 0;
+    {
+        MemoryPool<PoolItem, 2> pool;
+        PoolItem *items[100];
+        for (int32_t i = 0; i < UPRV_LENGTHOF(items); ++i) {
+            items[i] = pool.create(i, live);
+            if (items[i] == nullptr) {
+                errln("MemoryPool.create() failed");
+                return;
+            }
+        }
+        assertEquals("all objects constructed", 100, live);
+        MemoryPool<PoolItem, 2> moved(std::move(pool));
+        MemoryPool<PoolItem, 2> assigned;
+        assigned.create(-1, live);
+        assigned = std::move(moved);
+        assertEquals("move assignment deleted the previous objects", 100, live);
+        // Objects stay in place across moves.
+        for (int32_t i = 0; i < UPRV_LENGTHOF(items); ++i) {
+            if (items[i]->value != i) {
+                errln("MemoryPool object %d has value %d", (int)i, (int)items[i]->value);
+            }
+        }
+        assertTrue("pool reusable after move", pool.create(0, live) != nullptr);
+        assertEquals("objects after reuse", 101, live);
+    }
+    assertEquals("all objects deleted", 0, live);
+}
+
+void LocalPointerTest::TestMaybeStackVector() {
+    IcuTestErrorCode status(*this, "TestMaybeStackVector");
+    MaybeStackVector<int32_t, 4> v;
+    assertTrue("empty", v.isEmpty());
+    for (int32_t i = 0; i < 100; ++i) {
+        v.addElement(i, status);
+    }
+    status.errIfFailureAndReset("addElement");
+    assertEquals("size", 100, v.size());
+    assertTrue("capacity", v.getCapacity() >= 100);
+    assertEquals("peek", 99, v.peek());
+    const int32_t *buffer = v.getBuffer();
+    MaybeStackVector<int32_t, 4> moved(std::move(v));
+    assertEquals("moved size", 100, moved.size());
+    assertTrue("heap buffer moved", buffer == moved.getBuffer());
+    assertTrue("source empty after move", v.isEmpty());
+    for (int32_t i = 0; i < moved.size(); ++i) {
+        if (moved[i] != i) {
+            errln("moved[%d] = %d", (int)i, (int)moved[i]);
+        }
+    }
+
+    MaybeStackVector<int32_t, 4> small;
+    small.addElement(7, status);
+    small.addElement(8, status);
+    moved = std::move(small);
+    assertEquals("assigned size", 2, moved.size());
+    assertEquals("assigned [1]", 8, moved[1]);
+
+    moved.setSize(20, status);
+    moved.removeAllElements();
+    assertTrue("setSize then removeAllElements", moved.isEmpty() && moved.getCapacity() >= 20);
+    status.errIfFailureAndReset("setSize");
+
+    MaybeStackVector<int64_t, 2> limited;
+    limited.setMaxCapacity(5);
+    for (int32_t i = 0; i < 5; ++i) {
+        limited.addElement(i, status);
+    }
+    status.errIfFailureAndReset("within the maximum capacity");
+    limited.addElement(5, status);
+    assertEquals("beyond the maximum capacity", U_BUFFER_OVERFLOW_ERROR, status.reset());
+    assertEquals("size at the maximum capacity", 5, limited.size());
+}
+
 #include "unicode/ucnvsel.h"
 #include "unicode/ucal.h"
 #include "unicode/udatpg.h"
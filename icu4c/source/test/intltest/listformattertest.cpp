@@ -611,6 +611,72 @@ void ListFormatterTest::TestBadStylesFail() {
     }
 }
 
+void ListFormatterTest::TestLongList() {
+    IcuTestErrorCode status(*this, "TestLongList()");
+    const int32_t count = 1000;
+    LocalArray<UnicodeString> items(new UnicodeString[count]);
+    UnicodeString expected;
+    for (int32_t i = 0; i < count; ++i) {
+        items[i] = UnicodeString(u"item") + i;
+        if (i == count - 1) {
+            expected.append(u", and ");
+        } else if (i > 0) {
+            expected.append(u", ");
+        }
+        expected.append(items[i]);
+    }
+    LocalPointer<ListFormatter> formatter(ListFormatter::createInstance("en", status));
+    if (status.errIfFailureAndReset()) { return; }
+    UnicodeString actual(u"prefix ");
+    formatter->format(items.getAlias(), count, actual, status);
+    assertEquals("long list", UnicodeString(u"prefix ") + expected, actual);
+
+    // The element fields of patterns that reorder the items still cover them in input order.
+    ListFormatData data("{1} after {0}", "{1} after the first {0}",
+                        "{1} after {0}", "{1} in the last after {0}");
+    ListFormatter reordering(data, status);
+    for (int32_t n = 2; n <= 50; n += 16) {
+        FieldPositionIterator iter;
+        UnicodeString result(u"> ");
+        reordering.format(items.getAlias(), n, result, &iter, status);
+        if (status.errIfFailureAndReset("reordering %d items", n)) { continue; }
+        FieldPosition fp;
+        int32_t element = 0;
+        int32_t covered = 0;
+        while (iter.next(fp)) {
+            covered += fp.getEndIndex() - fp.getBeginIndex();
+            if (fp.getField() == ULISTFMT_ELEMENT_FIELD) {
+                assertEquals(UnicodeString(u"element ") + element,
+                             items[element], result.tempSubString(fp.getBeginIndex(), fp.getEndIndex() - fp.getBeginIndex()));
+                ++element;
+            }
+        }
+        assertEquals("element count", n, element);
+        assertEquals("fields cover the list", result.length() - 2, covered);
+        assertEquals("last item first", 0, result.indexOf(UnicodeString(u"> ") + items[n - 1]));
+    }
+}
+
+void ListFormatterTest::TestRepeatedArgumentPatterns() {
+    IcuTestErrorCode status(*this, "TestRepeatedArgumentPatterns()");
+    ListFormatData data("{0} and {1} ({1})", "{0}, {1}", "{0}; {1}", "{0}, and {1} ({1})");
+    ListFormatter formatter(data, status);
+
+    UnicodeString input2[] = {one, two};
+    CheckFormatting(&formatter, input2, 2, one + " and " + two + " (" + two + ")",
+                    "TestRepeatedArgumentPatterns()");
+
+    UnicodeString input4[] = {one, two, three, four};
+    CheckFormatting(&formatter, input4, 4,
+                    one + ", " + two + "; " + three + ", and " + four + " (" + four + ")",
+                    "TestRepeatedArgumentPatterns()");
+
+    int32_t offset;
+    UnicodeString result(u"xx");
+    formatter.format(input4, 4, result, 2, offset, status);
+    assertEquals("offset of third item", result.indexOf(three), offset);
+}
+
 void ListFormatterTest::runIndexedTest(int32_t index, UBool exec,
                                        const char* &name, char* /*par */) {
     switch(index) {
@@ -662,6 +728,12 @@ void ListFormatterTest::runIndexedTest(int32_t index, UBool exec,
         case 23: name = "TestBadStylesFail";
                  if (exec) TestBadStylesFail();
                  break;
+        case 24: name = "TestLongList";
+                 if (exec) TestLongList();
+                 break;
+        case 25: name = "TestRepeatedArgumentPatterns";
+                 if (exec) TestRepeatedArgumentPatterns();
+                 break;
         default: name = ""; break;
     }
 }
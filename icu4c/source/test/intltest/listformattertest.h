@@ -57,6 +57,8 @@ class ListFormatterTest : public IntlTestWithFieldPosition {
     void TestFormattedValue();
     void TestDifferentStyles();
     void TestBadStylesFail();
+    void TestLongList();
+    void TestRepeatedArgumentPatterns();
 
   private:
     void CheckFormatting(
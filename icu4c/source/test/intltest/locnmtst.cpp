@@ -83,6 +83,7 @@ void LocaleDisplayNamesTest::runIndexedTest(int32_t index, UBool exec, const cha
         TESTCASE(12, TestUldnDisplayContext);
         TESTCASE(13, TestUldnWithGarbage);
         TESTCASE(14, TestSubstituteHandling);
+        TESTCASE(15, TestBatchDisplayNames);
 #endif
         default:
             name = "";
@@ -158,6 +159,40 @@ void LocaleDisplayNamesTest::TestPrivateUse() {
   test_assert_equal(target, temp);
 }
 
+void LocaleDisplayNamesTest::TestBatchDisplayNames() {
+  static const char *localeIds[] = {
+    "de_DE", "de_AT", "fr_CA", "zh_Hant_TW", "en_Latn_US", "de_DE", "xx_YY", "sr_Cyrl"
+  };
+  Locale locales[UPRV_LENGTHOF(localeIds)];
+  for (int32_t i = 0; i < UPRV_LENGTHOF(localeIds); ++i) {
+    locales[i] = Locale(localeIds[i]);
+  }
+  LocalPointer<LocaleDisplayNames> ldn(LocaleDisplayNames::createInstance(Locale::getGermany()));
+  UnicodeString results[UPRV_LENGTHOF(localeIds)];
+  assertTrue("results returned",
+             ldn->localeDisplayNames(locales, UPRV_LENGTHOF(locales), results) == results);
+  // Once with the names cached by the batch call, once with a fresh instance.
+  LocalPointer<LocaleDisplayNames> fresh(LocaleDisplayNames::createInstance(Locale::getGermany()));
+  for (int32_t i = 0; i < UPRV_LENGTHOF(localeIds); ++i) {
+    UnicodeString temp;
+    assertEquals(localeIds[i], ldn->localeDisplayName(locales[i], temp), results[i]);
+    assertEquals(localeIds[i], fresh->localeDisplayName(locales[i], temp), results[i]);
+  }
+  test_assert_equal("Deutsch (Deutschland)", results[0]);
+  test_assert_equal("Deutsch (Deutschland)", results[5]);
+
+  // Missing names must stay missing when they come from the cache.
+  UDisplayContext contexts[] = { UDISPCTX_NO_SUBSTITUTE };
+  LocalPointer<LocaleDisplayNames> noSubst(
+      LocaleDisplayNames::createInstance(Locale::getGermany(), contexts, UPRV_LENGTHOF(contexts)));
+  for (int32_t i = 0; i < 2; ++i) {
+    UnicodeString temp;
+    assertTrue("no language name for xx", noSubst->languageDisplayName("xx", temp).isBogus());
+    assertTrue("no region name for YY", noSubst->regionDisplayName("YY", temp).isBogus());
+    assertEquals("language name for de", u"Deutsch", noSubst->languageDisplayName("de", temp));
+  }
+}
+
 void LocaleDisplayNamesTest::TestUldnOpen() {
   UErrorCode status = U_ZERO_ERROR;
   const int32_t kMaxResultSize = 150;  // long enough
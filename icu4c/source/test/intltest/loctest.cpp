@@ -12,6 +12,7 @@
 
 #include "loctest.h"
 #include "unicode/localebuilder.h"
+#include "unicode/localematcher.h"
 #include "unicode/localpointer.h"
 #include "unicode/decimfmt.h"
 #include "unicode/ucurr.h"
@@ -266,6 +267,7 @@ void LocaleTest::runIndexedTest( int32_t index, UBool exec, const char* &name, c
     TESTCASE_AUTO(TestUndScript);
     TESTCASE_AUTO(TestUndRegion);
     TESTCASE_AUTO(TestUndCAPI);
+    TESTCASE_AUTO(TestLocaleMatcher);
     TESTCASE_AUTO_END;
 }
 
@@ -3832,3 +3834,73 @@ void LocaleTest::TestUndCAPI() {
     assertTrue("reslen >= 0", reslen >= 0);
     assertEquals("uloc_getLanguage()", empty, tmp);
 }
+
+void LocaleTest::TestLocaleMatcher() {
+    IcuTestErrorCode status(*this, "TestLocaleMatcher()");
+    const Locale supported[] = {
+        Locale("fr"), Locale("en_GB"), Locale("en"), Locale("zh_Hant"), Locale("sr_Latn")
+    };
+    LocaleMatcher matcher(supported, UPRV_LENGTHOF(supported), status);
+    status.errIfFailureAndReset("LocaleMatcher()");
+
+    static const struct {
+        const char *desired;
+        const char *expected;  // nullptr if no match
+    } cases[] = {
+        { "fr", "fr" },
+        { "fr_CA", "fr" },
+        { "en_GB", "en_GB" },
+        { "en_US", "en" },
+        { "en_AU", "en" },       // the likely region wins over earlier ones
+        { "zh_TW", "zh_Hant" },
+        { "zh_HK", "zh_Hant" },
+        { "zh", nullptr },       // zh_Hans_CN
+        { "sr_ME", "sr_Latn" },
+        { "sr", nullptr },       // sr_Cyrl_RS
+        { "de", nullptr },
+    };
+    for (int32_t i = 0; i < UPRV_LENGTHOF(cases); ++i) {
+        const Locale *best = matcher.getBestMatch(Locale(cases[i].desired), status);
+        status.errIfFailureAndReset("getBestMatch(%s)", cases[i].desired);
+        if (cases[i].expected == nullptr) {
+            assertTrue(UnicodeString("no match for ") + cases[i].desired, best == nullptr);
+        } else if (assertTrue(UnicodeString("match for ") + cases[i].desired, best != nullptr)) {
+            assertEquals(cases[i].desired, cases[i].expected, best->getName());
+        }
+    }
+
+    const Locale desired[] = { Locale("de"), Locale("zh_TW"), Locale("en") };
+    const Locale *best = matcher.getBestMatch(desired, UPRV_LENGTHOF(desired), status);
+    status.errIfFailureAndReset("getBestMatch(list)");
+    if (assertTrue("match for list", best != nullptr)) {
+        assertEquals("list", "zh_Hant", best->getName());
+    }
+
+    static const struct {
+        const char *list;
+        const char *expected;  // nullptr if no match
+    } lists[] = {
+        { "de-CH, en-GB;q=0.8, fr;q=0.5", "en_GB" },
+        { "de-CH, en-GB;q=0.5, fr;q=0.8", "fr" },
+        { "fr;q=0.5,en-gb ; q=0.9", "en_GB" },
+        { "en-us;q=0, fr;q=0.1", "fr" },
+        { "de, *;q=0.5", nullptr },
+        { "zz-@@, sr-Latn-ME", "sr_Latn" },
+        { "fr;q=1.5, en", "en" },
+        { "", nullptr },
+    };
+    for (int32_t i = 0; i < UPRV_LENGTHOF(lists); ++i) {
+        best = matcher.getBestMatchForListString(lists[i].list, status);
+        status.errIfFailureAndReset("getBestMatchForListString(%s)", lists[i].list);
+        if (lists[i].expected == nullptr) {
+            assertTrue(UnicodeString("no match for ") + lists[i].list, best == nullptr);
+        } else if (assertTrue(UnicodeString("match for ") + lists[i].list, best != nullptr)) {
+            assertEquals(lists[i].list, lists[i].expected, best->getName());
+        }
+    }
+
+    LocaleMatcher empty(nullptr, 0, status);
+    status.errIfFailureAndReset("LocaleMatcher(empty)");
+    assertTrue("empty matcher", empty.getBestMatch(Locale::getEnglish(), status) == nullptr);
+    status.errIfFailureAndReset("getBestMatch(empty)");
+}
@@ -142,6 +142,8 @@ class LocaleTest: public IntlTest {
     void TestUndRegion();
     void TestUndCAPI();
 
+    void TestLocaleMatcher();
+
 private:
     void _checklocs(const char* label,
                     const char* req,
@@ -54,6 +54,7 @@ class NumberFormatterApiTest : public IntlTestWithFieldPosition {
     void notationCompact();
     void unitMeasure();
     void unitCompoundMeasure();
+    void unitSharedLongNames();
     void unitCurrency();
     void unitPercent();
     void percentParity();
@@ -74,6 +75,8 @@ class NumberFormatterApiTest : public IntlTestWithFieldPosition {
     void locale();
     void skeletonUserGuideExamples();
     void formatTypes();
+    void formatToBuffer();
+    void formatBatch();
     void fieldPositionLogic();
     void fieldPositionCoverage();
     void toFormat();
@@ -144,6 +147,9 @@ class DecimalQuantityTest : public IntlTest {
     void testToDouble();
     void testMaxDigits();
     void testNickelRounding();
+    void testIntegerDigits();
+    void testShortestDoubleFastPath();
+    void testIncrementRounding();
 
     void runIndexedTest(int32_t index, UBool exec, const char *&name, char *par = 0);
 
@@ -246,6 +252,7 @@ class NumberRangeFormatterTest : public IntlTestWithFieldPosition {
     void testBasic();
     void testCollapse();
     void testIdentity();
+    void testIdentityResult();
     void testDifferentFormatters();
     void testPlurals();
     void testFieldPositions();
@@ -69,6 +69,7 @@ void NumberFormatterApiTest::runIndexedTest(int32_t index, UBool exec, const cha
         TESTCASE_AUTO(notationCompact);
         TESTCASE_AUTO(unitMeasure);
         TESTCASE_AUTO(unitCompoundMeasure);
+        TESTCASE_AUTO(unitSharedLongNames);
         TESTCASE_AUTO(unitCurrency);
         TESTCASE_AUTO(unitPercent);
         if (!quick) {
@@ -92,6 +93,8 @@ void NumberFormatterApiTest::runIndexedTest(int32_t index, UBool exec, const cha
         TESTCASE_AUTO(locale);
         TESTCASE_AUTO(skeletonUserGuideExamples);
         TESTCASE_AUTO(formatTypes);
+        TESTCASE_AUTO(formatToBuffer);
+        TESTCASE_AUTO(formatBatch);
         TESTCASE_AUTO(fieldPositionLogic);
         TESTCASE_AUTO(fieldPositionCoverage);
         TESTCASE_AUTO(toFormat);
@@ -672,6 +675,39 @@ void NumberFormatterApiTest::unitCompoundMeasure() {
             u"0 J/fur");
 }
 
+void NumberFormatterApiTest::unitSharedLongNames() {
+    IcuTestErrorCode status(*this, "unitSharedLongNames");
+    // Formatters with the same locale, unit and width share their unit patterns;
+    // any setting that differs must give its own patterns.
+    static const struct {
+        const char* locale;
+        MeasureUnit unit;
+        MeasureUnit perUnit;
+        UNumberUnitWidth width;
+        const char16_t* expected;
+    } cases[] = {
+        {"en", METER, NoUnit::base(), UNUM_UNIT_WIDTH_FULL_NAME, u"2 meters"},
+        {"en", METER, NoUnit::base(), UNUM_UNIT_WIDTH_SHORT, u"2 m"},
+        {"fr", METER, NoUnit::base(), UNUM_UNIT_WIDTH_FULL_NAME, u"2\u00A0mètres"},
+        {"en", METER, SECOND, UNUM_UNIT_WIDTH_FULL_NAME, u"2 meters per second"},
+        {"en", JOULE, FURLONG, UNUM_UNIT_WIDTH_FULL_NAME, u"2 joules per furlong"},
+        {"en", JOULE, FURLONG, UNUM_UNIT_WIDTH_SHORT, u"2 J/fur"},
+        {"en", FURLONG, JOULE, UNUM_UNIT_WIDTH_SHORT, u"2 fur/J"},
+        {"en", JOULE, NoUnit::base(), UNUM_UNIT_WIDTH_SHORT, u"2 J"},
+    };
+    for (int32_t pass = 0; pass < 2; pass++) {
+        for (const auto& cas : cases) {
+            LocalizedNumberFormatter formatter = NumberFormatter::withLocale(cas.locale)
+                    .unit(cas.unit)
+                    .perUnit(cas.perUnit)
+                    .unitWidth(cas.width);
+            UnicodeString actual = formatter.formatInt(2, status).toString(status);
+            assertEquals(UnicodeString(cas.locale) + u" " + cas.unit.getSubtype() + u" " +
+                         cas.perUnit.getSubtype() + u" " + cas.width, cas.expected, actual);
+        }
+    }
+}
+
 void NumberFormatterApiTest::unitCurrency() {
     assertFormatDescending(
             u"Currency",
@@ -2362,6 +2398,76 @@ void NumberFormatterApiTest::formatTypes() {
     assertEquals("Format decNumber to 40 digits", str, actual);
 }
 
+void NumberFormatterApiTest::formatToBuffer() {
+    IcuTestErrorCode status(*this, "formatToBuffer");
+    LocalizedNumberFormatter formatter = NumberFormatter::withLocale("de").toCompiled(status);
+
+    char16_t buffer[32];
+    int32_t length = formatter.formatInt(51423, buffer, UPRV_LENGTHOF(buffer), status);
+    assertEquals("UTF-16 int64", u"51.423", UnicodeString(buffer, length));
+    assertEquals("UTF-16 is NUL-terminated", 0, buffer[length]);
+    length = formatter.formatDouble(-514.23, buffer, UPRV_LENGTHOF(buffer), status);
+    assertEquals("UTF-16 double", u"-514,23", UnicodeString(buffer, length));
+
+    char bytes[32];
+    length = NumberFormatter::withLocale("fr").formatIntUTF8(1234567, bytes, UPRV_LENGTHOF(bytes), status);
+    assertEquals("UTF-8 int64 with NNBSP grouping", u"1\u202F234\u202F567",
+        UnicodeString::fromUTF8(StringPiece(bytes, length)));
+    length = formatter.formatDoubleUTF8(0.5, bytes, UPRV_LENGTHOF(bytes), status);
+    assertEquals("UTF-8 double", "0,5", bytes);
+
+    // Preflighting
+    length = formatter.formatInt(51423, NULL, 0, status);
+    status.expectErrorAndReset(U_BUFFER_OVERFLOW_ERROR);
+    assertEquals("UTF-16 preflight length", 6, length);
+    length = formatter.formatIntUTF8(51423, NULL, 0, status);
+    status.expectErrorAndReset(U_BUFFER_OVERFLOW_ERROR);
+    assertEquals("UTF-8 preflight length", 6, length);
+    length = formatter.formatIntUTF8(51423, bytes, 3, status);
+    status.expectErrorAndReset(U_BUFFER_OVERFLOW_ERROR);
+    assertEquals("UTF-8 short buffer length", 6, length);
+    length = formatter.formatInt(51423, buffer, 6, status);
+    status.expectErrorAndReset(U_STRING_NOT_TERMINATED_WARNING);
+    assertEquals("Exact fit is not terminated", u"51.423", UnicodeString(buffer, length));
+
+    formatter.formatInt(1, NULL, 5, status);
+    status.expectErrorAndReset(U_ILLEGAL_ARGUMENT_ERROR);
+}
+
+void NumberFormatterApiTest::formatBatch() {
+    IcuTestErrorCode status(*this, "formatBatch");
+    LocalizedNumberFormatter formatter = NumberFormatter::withLocale("en").precision(Precision::integer());
+
+    static const double doubles[] = {1234.4, -5.6, 0};
+    char16_t buffer[32];
+    int32_t offsets[4];
+    int32_t length = formatter.formatBatch(doubles, 3, buffer, UPRV_LENGTHOF(buffer), offsets, status);
+    assertEquals("Doubles", u"1,234-60", UnicodeString(buffer, length));
+    assertEquals("Offset 0", 0, offsets[0]);
+    assertEquals("Offset 1", 5, offsets[1]);
+    assertEquals("Offset 2", 7, offsets[2]);
+    assertEquals("Offset 3", 8, offsets[3]);
+    assertTrue("Batch does not compile the formatter", formatter.getCompiled() == nullptr);
+
+    static const int64_t ints[] = {INT64_MAX, 7};
+    length = formatter.toCompiled(status).formatBatch(ints, 2, buffer, UPRV_LENGTHOF(buffer), offsets, status);
+    assertEquals("Int64 with compiled formatter", u"9,223,372,036,854,775,8077", UnicodeString(buffer, length));
+    assertEquals("Int64 offset 1", 25, offsets[1]);
+
+    // Preflighting still reports the full length and all offsets.
+    length = formatter.formatBatch(ints, 2, buffer, 10, offsets, status);
+    status.expectErrorAndReset(U_BUFFER_OVERFLOW_ERROR);
+    assertEquals("Preflight length", 26, length);
+    assertEquals("Preflight offset 2", 26, offsets[2]);
+
+    length = formatter.formatBatch(ints, 0, buffer, UPRV_LENGTHOF(buffer), offsets, status);
+    assertEquals("Empty batch", 0, length);
+    assertEquals("Empty batch offset", 0, offsets[0]);
+
+    formatter.formatBatch(ints, -1, buffer, UPRV_LENGTHOF(buffer), offsets, status);
+    status.expectErrorAndReset(U_ILLEGAL_ARGUMENT_ERROR);
+}
+
 void NumberFormatterApiTest::fieldPositionLogic() {
     IcuTestErrorCode status(*this, "fieldPositionLogic");
 
@@ -2933,6 +3039,22 @@ void NumberFormatterApiTest::copyMove() {
     assertEquals("[assignment] Source should be reset after move", 0, l3.getCallCount());
     assertTrue("[assignment] Source should be reset after move", l3.getCompiled() == nullptr);
 
+    // Eagerly compiled formatters
+    LocalizedNumberFormatter l4 = NumberFormatter::withLocale("en").unit(NoUnit::percent()).toCompiled(status);
+    assertEquals("[toCompiled] Compiled before first use", INT32_MIN, l4.getCallCount());
+    assertTrue("[toCompiled] Compiled before first use", l4.getCompiled() != nullptr);
+    assertEquals("[toCompiled] Behavior", u"10%", l4.formatInt(10, status).toString(status));
+    LocalizedNumberFormatter l5 = l4.toCompiled(status);
+    assertTrue("[toCompiled] Copy gets its own compiled state",
+        l5.getCompiled() != nullptr && l5.getCompiled() != l4.getCompiled());
+    LocalizedNumberFormatter l6 = NumberFormatter::withLocale("en").threshold(0).toCompiled(status);
+    l6.formatInt(1, status);
+    assertTrue("[toCompiled] Zero threshold does not prevent eager compiling", l6.getCompiled() != nullptr);
+    LocalizedNumberFormatter l7 = NumberFormatter::withLocale("en").integerWidth(
+        IntegerWidth::zeroFillTo(-1)).toCompiled(status);
+    status.expectErrorAndReset(U_NUMBER_ARG_OUTOFBOUNDS_ERROR);
+    assertTrue("[toCompiled] Not compiled after setter error", l7.getCompiled() == nullptr);
+
     // Coverage tests for UnlocalizedNumberFormatter
     UnlocalizedNumberFormatter u1;
     assertEquals("Default behavior", u"10", u1.locale("en").formatInt(10, status).toString(status));
@@ -11,6 +11,12 @@
 #include <cmath>
 #include "number_utils.h"
 #include "numbertest.h"
+#include "double-conversion.h"
+
+using double_conversion::DoubleToStringConverter;
+
+static const double DOUBLE_POWERS_OF_TEN_FOR_TEST[] = {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11};
 
 void DecimalQuantityTest::runIndexedTest(int32_t index, UBool exec, const char *&name, char *) {
     if (exec) {
@@ -30,6 +36,9 @@ void DecimalQuantityTest::runIndexedTest(int32_t index, UBool exec, const char *
         TESTCASE_AUTO(testToDouble);
         TESTCASE_AUTO(testMaxDigits);
         TESTCASE_AUTO(testNickelRounding);
+        TESTCASE_AUTO(testIntegerDigits);
+        TESTCASE_AUTO(testShortestDoubleFastPath);
+        TESTCASE_AUTO(testIncrementRounding);
     TESTCASE_AUTO_END;
 }
 
@@ -467,4 +476,143 @@ void DecimalQuantityTest::testNickelRounding() {
     status.expectErrorAndReset(U_FORMAT_INEXACT_ERROR);
 }
 
+void DecimalQuantityTest::testIntegerDigits() {
+    IcuTestErrorCode status(*this, "testIntegerDigits");
+    // Every digit count, for both the packed and the byte-array storage, with
+    // odd and even numbers of digits and inner zeros
+    int64_t value = 7;
+    for (int32_t digits = 1; digits <= 18; digits++, value = value * 10 + (digits % 3 == 0 ? 0 : digits)) {
+        UnicodeString expected = Int64ToUnicodeString(value);
+        DecimalQuantity dq;
+        dq.setToLong(value);
+        assertEquals(expected + u" long", expected, dq.toPlainString());
+        assertEquals(expected + u" long magnitude", digits - 1, dq.getMagnitude());
+        assertHealth(dq);
+        dq.setToLong(-value);
+        assertEquals(expected + u" negative long", UnicodeString(u"-") + expected, dq.toPlainString());
+        if (value <= INT32_MAX) {
+            dq.setToInt(static_cast<int32_t>(value));
+            assertEquals(expected + u" int", expected, dq.toPlainString());
+            assertHealth(dq);
+        }
+        if (digits <= 15) {
+            dq.setToDouble(static_cast<double>(value));
+            assertEquals(expected + u" integral double", expected, dq.toPlainString());
+        }
+    }
+    DecimalQuantity dq;
+    dq.setToLong(100);
+    assertEquals("Trailing zeros are compacted", u"100", dq.toPlainString());
+    dq.setToInt(INT32_MIN);
+    assertEquals("INT32_MIN", u"-2147483648", dq.toPlainString());
+}
+
+void DecimalQuantityTest::testShortestDoubleFastPath() {
+    IcuTestErrorCode status(*this, "testShortestDoubleFastPath");
+    static const struct TestCase {
+        double input;
+        const char16_t* expected;
+    } cases[] = {
+            { 0.1, u"0.1" },
+            { 1.235, u"1.235" },
+            { 19.99, u"19.99" },
+            { 123456.789012345, u"123456.789012345" },
+            { 4.35e-15, u"0.00000000000000435" },
+            { 2.5e20, u"250000000000000000000" },
+            // More than 15 digits: needs the oracle
+            { 0.30000000000000004, u"0.30000000000000004" },
+            { 4095.9999999999977, u"4095.9999999999977" } };
+    for (auto& cas : cases) {
+        DecimalQuantity q;
+        q.setToDouble(cas.input);
+        q.roundToInfinity();
+        assertEquals("Shortest digits", cas.expected, q.toPlainString());
+        assertTrue("Exact after conversion", q.isExplicitExactDouble());
+        assertHealth(q);
+    }
+
+    // Short decimals must give the same digits as the oracle.
+    for (int32_t i = 0; i < 10000; i++) {
+        double d = static_cast<double>(rand() % 1000000) / DOUBLE_POWERS_OF_TEN_FOR_TEST[rand() % 12];
+        if (d == 0) { continue; }
+        char buffer[DoubleToStringConverter::kBase10MaximalLength + 1];
+        bool sign;
+        int32_t length;
+        int32_t point;
+        DoubleToStringConverter::DoubleToAscii(d, DoubleToStringConverter::DtoaMode::SHORTEST, 0,
+            buffer, sizeof(buffer), &sign, &length, &point);
+        DecimalQuantity expected;
+        char str[64];
+        sprintf(str, "%.*sE%d", static_cast<int>(length), buffer, static_cast<int>(point - length));
+        expected.setToDecNumber(str, status);
+        DecimalQuantity actual;
+        actual.setToDouble(d);
+        actual.roundToInfinity();
+        assertEquals(DoubleToUnicodeString(d), expected.toPlainString(), actual.toPlainString());
+    }
+}
+
+void DecimalQuantityTest::testIncrementRounding() {
+    IcuTestErrorCode status(*this, "testIncrementRounding");
+    struct TestCase {
+        const char* input;
+        double increment;
+        UNumberFormatRoundingMode roundingMode;
+        const char16_t* expected;
+    } cases[] = {
+        {"1.37", 0.25, UNUM_ROUND_HALFEVEN, u"1.25"},
+        {"1.375", 0.25, UNUM_ROUND_HALFEVEN, u"1.5"},
+        {"1.125", 0.25, UNUM_ROUND_HALFEVEN, u"1"},
+        {"1.375", 0.25, UNUM_ROUND_HALFDOWN, u"1.25"},
+        {"1.375", 0.25, UNUM_ROUND_HALFUP, u"1.5"},
+        {"-1.375", 0.25, UNUM_ROUND_CEILING, u"-1.25"},
+        {"-1.375", 0.25, UNUM_ROUND_FLOOR, u"-1.5"},
+        {"-1.26", 0.25, UNUM_ROUND_UP, u"-1.5"},
+        {"-1.49", 0.25, UNUM_ROUND_DOWN, u"-1.25"},
+        {"12345", 20, UNUM_ROUND_HALFEVEN, u"12340"},
+        {"12350", 20, UNUM_ROUND_HALFEVEN, u"12360"},
+        {"0.7", 0.3, UNUM_ROUND_HALFEVEN, u"0.6"},
+        {"1.5", 0.25, UNUM_ROUND_UNNECESSARY, u"1.5"},
+        // More than 18 digits: computed with DecNum
+        {"98765432109876543.21", 0.25, UNUM_ROUND_HALFEVEN, u"98765432109876543.25"},
+        {"123456789012345678901234.6", 0.25, UNUM_ROUND_HALFEVEN, u"123456789012345678901234.5"},
+    };
+    for (const auto& cas : cases) {
+        UnicodeString message = UnicodeString(cas.input, -1, US_INV) + u" @ " +
+            DoubleToUnicodeString(cas.increment) + u" / " + Int64ToUnicodeString(cas.roundingMode);
+        status.setScope(message);
+        DecimalQuantity dq;
+        dq.setToDecNumber(cas.input, status);
+        dq.roundToIncrement(cas.increment, cas.roundingMode, status);
+        status.errIfFailureAndReset();
+        assertEquals(message, cas.expected, dq.toPlainString());
+        assertHealth(dq);
+    }
+    status.setScope("");
+    DecimalQuantity dq;
+    dq.setToDecNumber("1.6", status);
+    dq.roundToIncrement(0.25, UNUM_ROUND_UNNECESSARY, status);
+    status.expectErrorAndReset(U_FORMAT_INEXACT_ERROR);
+
+    // Multiplication and division by DecNum
+    DecNum multiplier;
+    multiplier.setTo("1.2", status);
+    dq.setToDecNumber("-1.5", status);
+    dq.multiplyBy(multiplier, status);
+    assertEquals("-1.5 * 1.2", u"-1.8", dq.toPlainString());
+    dq.divideBy(multiplier, status);
+    assertEquals("-1.8 / 1.2", u"-1.5", dq.toPlainString());
+    multiplier.setTo("3", status);
+    dq.setToDecNumber("1", status);
+    dq.divideBy(multiplier, status);
+    assertEquals("1 / 3", u"0.3333333333333333333333333333333333", dq.toPlainString());
+    multiplier.setTo("1234567890123", status);
+    dq.setToDecNumber("1234567890123", status);
+    dq.multiplyBy(multiplier, status);
+    assertEquals("Product with more than 18 digits",
+        u"1524157875322755800955129", dq.toPlainString());
+    assertHealth(dq);
+    status.errIfFailureAndReset();
+}
+
 #endif /* #if !UCONFIG_NO_FORMATTING */
@@ -46,6 +46,7 @@ void NumberRangeFormatterTest::runIndexedTest(int32_t index, UBool exec, const c
         TESTCASE_AUTO(testBasic);
         TESTCASE_AUTO(testCollapse);
         TESTCASE_AUTO(testIdentity);
+        TESTCASE_AUTO(testIdentityResult);
         TESTCASE_AUTO(testDifferentFormatters);
         TESTCASE_AUTO(testPlurals);
         TESTCASE_AUTO(testFieldPositions);
@@ -643,6 +644,35 @@ void NumberRangeFormatterTest::testIdentity() {
         u"華氏 5,000-5,000,000 度");
 }
 
+void NumberRangeFormatterTest::testIdentityResult() {
+    IcuTestErrorCode status(*this, "testIdentityResult");
+    // Equal inputs through the same formatter take a shortcut;
+    // the result must still describe both rounded endpoints.
+    static const struct {
+        UNumberRangeIdentityFallback fallback;
+        const char16_t* expected;
+    } cases[] = {
+        {UNUM_IDENTITY_FALLBACK_SINGLE_VALUE, u"5.5"},
+        {UNUM_IDENTITY_FALLBACK_APPROXIMATELY_OR_SINGLE_VALUE, u"5.5"},
+        {UNUM_IDENTITY_FALLBACK_APPROXIMATELY, u"~5.5"},
+        {UNUM_IDENTITY_FALLBACK_RANGE, u"5.5–5.5"},
+    };
+    for (const auto& cas : cases) {
+        // Use two formatters: the second one gets its range patterns from the cache.
+        for (int32_t pass = 0; pass < 2; pass++) {
+            LocalizedNumberRangeFormatter lnrf = NumberRangeFormatter::withLocale("en-us")
+                .numberFormatterBoth(NumberFormatter::with().precision(Precision::fixedFraction(1)))
+                .identityFallback(cas.fallback);
+            FormattedNumberRange result = lnrf.formatFormattableRange(5.53, 5.53, status);
+            assertEquals("String", cas.expected, result.toString(status));
+            assertEquals("Identity result", UNUM_IDENTITY_RESULT_EQUAL_BEFORE_ROUNDING,
+                result.getIdentityResult(status));
+            assertEquals("First decimal", u"5.5E+0", result.getFirstDecimal(status));
+            assertEquals("Second decimal", u"5.5E+0", result.getSecondDecimal(status));
+        }
+    }
+}
+
 void NumberRangeFormatterTest::testDifferentFormatters() {
     assertFormatRange(
         u"Different rounding rules",
@@ -231,6 +231,7 @@ void NumberFormatTest::runIndexedTest( int32_t index, UBool exec, const char* &n
   TESTCASE_AUTO(Test20358_GroupingInPattern);
   TESTCASE_AUTO(Test13731_DefaultCurrency);
   TESTCASE_AUTO(Test20499_CurrencyVisibleDigitsPlural);
+  TESTCASE_AUTO(TestParseCurrencyManyLocales);
   TESTCASE_AUTO_END;
 }
 
@@ -9693,4 +9694,35 @@ void NumberFormatTest::Test20499_CurrencyVisibleDigitsPlural() {
     }
 }
 
+void NumberFormatTest::TestParseCurrencyManyLocales() {
+    IcuTestErrorCode status(*this, "TestParseCurrencyManyLocales");
+    // Parse currencies in more locales than fit in a small cache, several
+    // times over, so that the currency names of each locale are reused.
+    static const char* const locales[] = {
+        "en_US", "de", "fr", "ja", "ru", "es", "it", "pt", "zh", "ko", "ar", "hi", "nl", "sv"
+    };
+    static const char16_t* const isoCodes[] = { u"EUR", u"JPY", u"CHF" };
+    for (int32_t round = 0; round < 3; round++) {
+        for (int32_t i = 0; i < UPRV_LENGTHOF(locales); i++) {
+            LocalPointer<NumberFormat> nf(NumberFormat::createCurrencyInstance(locales[i], status), status);
+            if (status.errIfFailureAndReset("%s", locales[i])) {
+                continue;
+            }
+            nf->setLenient(TRUE);
+            for (int32_t j = 0; j < UPRV_LENGTHOF(isoCodes); j++) {
+                UnicodeString formatted;
+                nf->format(Formattable(new CurrencyAmount(3, isoCodes[j], status)), formatted, status);
+                ParsePosition pos;
+                LocalPointer<CurrencyAmount> parsed(nf->parseCurrency(formatted, pos));
+                UnicodeString message = UnicodeString(locales[i]) + u" " + formatted;
+                if (!assertTrue(message, parsed.isValid())) {
+                    continue;
+                }
+                assertEquals(message, isoCodes[j], UnicodeString(parsed->getISOCurrency()));
+                assertEquals(message, formatted.length(), pos.getIndex());
+            }
+        }
+    }
+}
+
 #endif /* #if !UCONFIG_NO_FORMATTING */
@@ -56,6 +56,7 @@ void PluralRulesTest::runIndexedTest( int32_t index, UBool exec, const char* &na
     TESTCASE_AUTO(testFixedDecimal);
     TESTCASE_AUTO(testSelectTrailingZeros);
     TESTCASE_AUTO(testLocaleExtension);
+    TESTCASE_AUTO(testSelectInt64);
     TESTCASE_AUTO_END;
 }
 
@@ -1037,6 +1038,44 @@ void PluralRulesTest::testSelectTrailingZeros() {
     }
 }
 
+void PluralRulesTest::testSelectInt64() {
+    IcuTestErrorCode status(*this, "testSelectInt64");
+    LocalPointer<PluralRules> rules(PluralRules::createRules(
+        u"one: i = 1 and v = 0; few: n % 100 = 3..10; many: n % 1000000 = 0 and v = 0", status));
+    if (status.errIfFailureAndReset()) {
+        return;
+    }
+    assertEquals("1", u"one", rules->select((int64_t)1));
+    assertEquals("-1", u"one", rules->select((int64_t)-1));
+    assertEquals("1.0", u"one", rules->select(1.0));
+    assertEquals("1.5", u"other", rules->select(1.5));
+    assertEquals("103", u"few", rules->select((int32_t)103));
+    assertEquals("2000000", u"many", rules->select((int64_t)2000000));
+    // Exact beyond 2^53, where a double would round.
+    assertEquals("INT64_MAX", u"few", rules->select(INT64_MAX));
+    assertEquals("INT64_MIN", u"few", rules->select(INT64_MIN));
+    assertEquals("9223372036854000000", u"many", rules->select((int64_t)9223372036854000000LL));
+
+    // The integer path agrees with the decimal path for all locales.
+    int32_t localeCount;
+    const Locale *locales = Locale::getAvailableLocales(localeCount);
+    for (int32_t i = 0; i < localeCount; ++i) {
+        for (UPluralType type : {UPLURAL_TYPE_CARDINAL, UPLURAL_TYPE_ORDINAL}) {
+            LocalPointer<PluralRules> locRules(PluralRules::forLocale(locales[i], type, status));
+            if (status.errIfFailureAndReset("%s", locales[i].getName())) {
+                continue;
+            }
+            for (int32_t n = -120; n <= 1200; ++n) {
+                UnicodeString expected = locRules->select(FixedDecimal((double)n));
+                if (expected != locRules->select((int64_t)n) || expected != locRules->select((double)n)) {
+                    errln(UnicodeString(u"select() mismatch for ") + locales[i].getName() + u" " + n);
+                    break;
+                }
+            }
+        }
+    }
+}
+
 void PluralRulesTest::testLocaleExtension() {
     IcuTestErrorCode errorCode(*this, "testLocaleExtension");
     LocalPointer<PluralRules> rules(PluralRules::forLocale("pt@calendar=gregorian", errorCode));
@@ -39,6 +39,7 @@ class PluralRulesTest : public IntlTest {
     void testFixedDecimal();
     void testSelectTrailingZeros();
     void testLocaleExtension();
+    void testSelectInt64();
 
     void assertRuleValue(const UnicodeString& rule, double expected);
     void assertRuleKeyValue(const UnicodeString& rule, const UnicodeString& key,
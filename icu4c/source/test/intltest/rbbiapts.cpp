@@ -25,6 +25,7 @@
 #include "unicode/ustring.h"
 #include "unicode/utext.h"
 #include "cmemory.h"
+#include "uvectr32.h"
 #if !UCONFIG_NO_BREAK_ITERATION
 #include "unicode/filteredbrk.h"
 #include <stdio.h> // for sprintf
@@ -1160,6 +1161,180 @@ void RBBIAPITest::TestRefreshInputText() {
 
 }
 
+//
+//  TestGetBoundaries   Check that bulk boundary extraction produces the same
+//                      results as repeated next() calls, for several capacities
+//                      and for text that mixes rule-based and dictionary segments.
+//
+void RBBIAPITest::TestGetBoundaries() {
+    UErrorCode status = U_ZERO_ERROR;
+    UnicodeString text(
+        u"Hello, world! Don't stop 3.14 now. "
+        u"\u0e01\u0e32\u0e23\u0e17\u0e14\u0e25\u0e2d\u0e07\u0e20\u0e32\u0e29\u0e32\u0e44\u0e17\u0e22 "
+        u"The quick (\"brown\") fox\u2014jumps over\nthe lazy dog. "
+        u"\u0e2a\u0e27\u0e31\u0e2a\u0e14\u0e35\u0e04\u0e23\u0e31\u0e1a end.");
+    LocalPointer<BreakIterator> wordBI(BreakIterator::createWordInstance(Locale::getEnglish(), status));
+    LocalPointer<BreakIterator> lineBI(BreakIterator::createLineInstance(Locale::getEnglish(), status));
+    if (U_FAILURE(status)) {
+        dataerrln("%s:%d: Failed to create break iterators - %s", __FILE__, __LINE__, u_errorName(status));
+        return;
+    }
+    BreakIterator *iters[] = { wordBI.getAlias(), lineBI.getAlias() };
+    for (BreakIterator *bi : iters) {
+        RuleBasedBreakIterator *rbbi = dynamic_cast<RuleBasedBreakIterator *>(bi);
+        TEST_ASSERT(rbbi != NULL);
+        if (rbbi == NULL) {
+            continue;
+        }
+        int32_t expected[200];
+        int32_t expectedStatuses[200];
+        int32_t expectedLength = 0;
+        rbbi->setText(text);
+        for (int32_t pos = rbbi->next(); pos != UBRK_DONE; pos = rbbi->next()) {
+            expected[expectedLength] = pos;
+            expectedStatuses[expectedLength++] = rbbi->getRuleStatus();
+        }
+
+        static const int32_t capacities[] = { 1, 2, 3, 7, 200 };
+        for (int32_t capacity : capacities) {
+            rbbi->setText(text);
+            int32_t boundaries[200];
+            int32_t statuses[200];
+            int32_t total = 0;
+            int32_t length;
+            do {
+                length = rbbi->getBoundaries(boundaries, (capacity & 1) != 0 ? statuses : NULL,
+                                             capacity, status);
+                TEST_ASSERT_SUCCESS(status);
+                TEST_ASSERT(length <= capacity);
+                for (int32_t i = 0; i < length && total < expectedLength; ++i, ++total) {
+                    assertEquals(WHERE, expected[total], boundaries[i]);
+                    if ((capacity & 1) != 0) {
+                        assertEquals(WHERE, expectedStatuses[total], statuses[i]);
+                    }
+                }
+                if (length > 0) {
+                    assertEquals(WHERE, boundaries[length - 1], rbbi->current());
+                }
+                // Mix in single steps and a step back to exercise the cache.
+                if (length == capacity && capacity == 3 && total < expectedLength) {
+                    assertEquals(WHERE, expected[total], rbbi->next());
+                    ++total;
+                    assertEquals(WHERE, expected[total - 2], rbbi->previous());
+                    assertEquals(WHERE, expected[total - 1], rbbi->next());
+                }
+            } while (length == capacity);
+            assertEquals(WHERE, expectedLength, total);
+            assertEquals(WHERE, text.length(), rbbi->current());
+            assertEquals(WHERE, (int32_t)UBRK_DONE, rbbi->next());
+        }
+
+        // From the middle of the text.
+        rbbi->following(20);
+        int32_t boundaries[2];
+        int32_t length = rbbi->getBoundaries(boundaries, NULL, 2, status);
+        TEST_ASSERT_SUCCESS(status);
+        TEST_ASSERT(length == 2);
+        int32_t i = 0;
+        while (expected[i] <= 20) { ++i; }
+        assertEquals(WHERE, expected[i + 1], boundaries[0]);
+        assertEquals(WHERE, expected[i + 2], boundaries[1]);
+
+        TEST_ASSERT(0 == rbbi->getBoundaries(NULL, NULL, 0, status));
+        TEST_ASSERT_SUCCESS(status);
+        rbbi->getBoundaries(NULL, NULL, 1, status);
+        TEST_ASSERT(status == U_ILLEGAL_ARGUMENT_ERROR);
+        status = U_ZERO_ERROR;
+    }
+}
+
+//
+//  TestBoundaryIndex   Check that random access with the boundary index finds the
+//                      same boundaries and rule statuses as forward iteration.
+//
+void RBBIAPITest::TestBoundaryIndex() {
+    UErrorCode status = U_ZERO_ERROR;
+    UnicodeString piece(
+        u"Hello, world! Don't stop 3.14 now. "
+        u"\u0e01\u0e32\u0e23\u0e17\u0e14\u0e25\u0e2d\u0e07\u0e20\u0e32\u0e29\u0e32\u0e44\u0e17\u0e22 "
+        u"The quick (\"brown\") fox\u2014jumps over\nthe lazy dog. ");
+    UnicodeString text;
+    for (int32_t i = 0; i < 60; ++i) {
+        text.append(piece);
+    }
+    LocalPointer<BreakIterator> wordBI(BreakIterator::createWordInstance(Locale::getEnglish(), status));
+    LocalPointer<BreakIterator> lineBI(BreakIterator::createLineInstance(Locale::getEnglish(), status));
+    if (U_FAILURE(status)) {
+        dataerrln("%s:%d: Failed to create break iterators - %s", __FILE__, __LINE__, u_errorName(status));
+        return;
+    }
+    BreakIterator *iters[] = { wordBI.getAlias(), lineBI.getAlias() };
+    for (BreakIterator *bi : iters) {
+        RuleBasedBreakIterator *rbbi = dynamic_cast<RuleBasedBreakIterator *>(bi);
+        TEST_ASSERT(rbbi != NULL);
+        if (rbbi == NULL) {
+            continue;
+        }
+        UVector32 expected(status);
+        UVector32 expectedStatuses(status);
+        rbbi->setText(text);
+        expected.addElement(0, status);
+        expectedStatuses.addElement(0, status);
+        for (int32_t pos = rbbi->next(); pos != UBRK_DONE; pos = rbbi->next()) {
+            expected.addElement(pos, status);
+            expectedStatuses.addElement(rbbi->getRuleStatus(), status);
+        }
+        TEST_ASSERT_SUCCESS(status);
+
+        TEST_ASSERT(!rbbi->isBoundaryIndexEnabled());
+        rbbi->setBoundaryIndexEnabled(TRUE);
+        TEST_ASSERT(rbbi->isBoundaryIndexEnabled());
+        rbbi->setText(text);
+        uint32_t seed = 12345;
+        for (int32_t i = 0; i < 300; ++i) {
+            seed = seed * 1103515245 + 12345;
+            int32_t offset = (int32_t)((seed >> 8) % (uint32_t)text.length());
+            // Index of the first expected boundary after offset.
+            int32_t n = 0;
+            while (expected.elementAti(n) <= offset) {
+                ++n;
+            }
+            assertEquals(WHERE, expected.elementAti(n), rbbi->following(offset));
+            assertEquals(WHERE, expectedStatuses.elementAti(n), rbbi->getRuleStatus());
+            UBool isBoundary = expected.elementAti(n - 1) == offset;
+            assertEquals(WHERE, isBoundary, rbbi->isBoundary(offset));
+            int32_t p = isBoundary ? n - 2 : n - 1;
+            if (p >= 0) {
+                assertEquals(WHERE, expected.elementAti(p), rbbi->preceding(offset));
+                assertEquals(WHERE, expectedStatuses.elementAti(p), rbbi->getRuleStatus());
+            }
+        }
+
+        // Backwards over the whole text, from a copy that shares the index.
+        LocalPointer<RuleBasedBreakIterator> copy(new RuleBasedBreakIterator(*rbbi), status);
+        if (!assertSuccess(WHERE, status)) {
+            return;
+        }
+        TEST_ASSERT(copy->isBoundaryIndexEnabled());
+        int32_t n = expected.size() - 1;
+        assertEquals(WHERE, expected.elementAti(n), copy->last());
+        for (int32_t pos = copy->previous(); pos != UBRK_DONE; pos = copy->previous()) {
+            --n;
+            assertEquals(WHERE, expected.elementAti(n), pos);
+        }
+        assertEquals(WHERE, 0, n);
+
+        // New text discards the index but keeps the setting.
+        rbbi->setText(piece);
+        TEST_ASSERT(rbbi->isBoundaryIndexEnabled());
+        int32_t last = rbbi->last();
+        assertEquals(WHERE, piece.length(), last);
+        assertEquals(WHERE, last, rbbi->following(last - 1));
+        rbbi->setBoundaryIndexEnabled(FALSE);
+        TEST_ASSERT(!rbbi->isBoundaryIndexEnabled());
+    }
+}
+
 #if !UCONFIG_NO_BREAK_ITERATION && !UCONFIG_NO_FILTERED_BREAK_ITERATION
 static void prtbrks(BreakIterator* brk, const UnicodeString &ustr, IntlTest &it) {
   static const UChar PILCROW=0x00B6, CHSTR=0x3010, CHEND=0x3011; // lenticular brackets
@@ -1397,6 +1572,39 @@ void RBBIAPITest::TestFilteredBreakIteratorBuilder() {
 	}
   }
 
+  {
+    logln("Sharing the English exceptions between iterators");
+    builder.adoptInstead(FilteredBreakIteratorBuilder::createInstance(Locale::getEnglish(), status));
+    TEST_ASSERT_SUCCESS(status);
+    LocalPointer<BreakIterator> first(builder->build(
+        BreakIterator::createSentenceInstance(Locale::getEnglish(), status), status));
+    LocalPointer<BreakIterator> second(builder->build(
+        BreakIterator::createSentenceInstance(Locale::getEnglish(), status), status));
+    TEST_ASSERT_SUCCESS(status);
+
+    if (U_SUCCESS(status)) {
+        // Changing the builder after building must not affect the iterators built so far.
+        TEST_ASSERT(TRUE == builder->unsuppressBreakAfter(ABBR_MR, status));
+        LocalPointer<BreakIterator> third(builder->build(
+            BreakIterator::createSentenceInstance(Locale::getEnglish(), status), status));
+        LocalPointer<BreakIterator> clone(first->clone());
+        first.adoptInstead(nullptr);
+        TEST_ASSERT_SUCCESS(status);
+
+        BreakIterator *bis[] = { second.getAlias(), clone.getAlias() };
+        for (BreakIterator *bi : bis) {
+            bi->setText(text);
+            TEST_ASSERT(84 == bi->next());
+            TEST_ASSERT(278 == bi->next());
+        }
+        third->setText(text);
+        TEST_ASSERT(20 == third->next());
+        TEST_ASSERT(84 == third->next());
+        TEST_ASSERT(181 == third->next());
+        TEST_ASSERT(278 == third->next());
+    }
+  }
+
 #else
   logln("Skipped- not: !UCONFIG_NO_BREAK_ITERATION && !UCONFIG_NO_FILTERED_BREAK_ITERATION");
 #endif
@@ -1429,6 +1637,8 @@ void RBBIAPITest::runIndexedTest( int32_t index, UBool exec, const char* &name,
     TESTCASE_AUTO(TestGetBinaryRules);
 #endif
     TESTCASE_AUTO(TestRefreshInputText);
+    TESTCASE_AUTO(TestGetBoundaries);
+    TESTCASE_AUTO(TestBoundaryIndex);
 #if !UCONFIG_NO_BREAK_ITERATION
     TESTCASE_AUTO(TestFilteredBreakIteratorBuilder);
 #endif
@@ -17,6 +17,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -30,7 +31,9 @@
 #include "unicode/schriter.h"
 #include "unicode/uchar.h"
 #include "unicode/utf16.h"
+#include "unicode/utf8.h"
 #include "unicode/ucnv.h"
+#include "unicode/ucptrie.h"
 #include "unicode/uniset.h"
 #include "unicode/uscript.h"
 #include "unicode/ustring.h"
@@ -42,6 +45,7 @@
 #include "intltest.h"
 #include "rbbitst.h"
 #include "rbbidata.h"
+#include "utrie2.h"
 #include "utypeinfo.h"  // for 'typeid' to work
 #include "uvector.h"
 #include "uvectr32.h"
@@ -114,6 +118,10 @@ void RBBITest::runIndexedTest( int32_t index, UBool exec, const char* &name, cha
     TESTCASE_AUTO(TestBug13447);
     TESTCASE_AUTO(TestReverse);
     TESTCASE_AUTO(TestBug13692);
+    TESTCASE_AUTO(TestTextAccessPaths);
+    TESTCASE_AUTO(TestTableRowSizes);
+    TESTCASE_AUTO(TestLongDictionaryRange);
+    TESTCASE_AUTO(TestFormatVersion5);
     TESTCASE_AUTO_END;
 }
 
@@ -4476,11 +4484,16 @@ void RBBITest::TestTableRedundancies() {
     // Check for duplicate columns (character categories)
 
     std::vector<UnicodeString> columns;
+    bool in8Bits = fwtbl->fFlags & RBBI_8BITS_ROWS;
     for (int32_t column = 0; column < numCharClasses; column++) {
         UnicodeString s;
         for (int32_t r = 1; r < (int32_t)fwtbl->fNumStates; r++) {
-            RBBIStateTableRow  *row = (RBBIStateTableRow *) (fwtbl->fTableData + (fwtbl->fRowLen * r));
-            s.append(row->fNextState[column]);
+            const char *rowData = fwtbl->fTableData + (fwtbl->fRowLen * r);
+            if (in8Bits) {
+                s.append(((const RBBIStateTableRow8 *)rowData)->fNextState[column]);
+            } else {
+                s.append(((const RBBIStateTableRow16 *)rowData)->fNextState[column]);
+            }
         }
         columns.push_back(s);
     }
@@ -4499,13 +4512,25 @@ void RBBITest::TestTableRedundancies() {
     std::vector<UnicodeString> rows;
     for (int32_t r=0; r < (int32_t)fwtbl->fNumStates; r++) {
         UnicodeString s;
-        RBBIStateTableRow  *row = (RBBIStateTableRow *) (fwtbl->fTableData + (fwtbl->fRowLen * r));
-        assertTrue(WHERE, row->fAccepting >= -1);
-        s.append(row->fAccepting + 1);   // values of -1 are expected.
-        s.append(row->fLookAhead);
-        s.append(row->fTagIdx);
-        for (int32_t column = 0; column < numCharClasses; column++) {
-            s.append(row->fNextState[column]);
+        const char *rowData = fwtbl->fTableData + (fwtbl->fRowLen * r);
+        if (in8Bits) {
+            const RBBIStateTableRow8 *row = (const RBBIStateTableRow8 *)rowData;
+            assertTrue(WHERE, row->fAccepting >= -1);
+            s.append(row->fAccepting + 1);   // values of -1 are expected.
+            s.append(row->fLookAhead);
+            s.append(row->fTagIdx);
+            for (int32_t column = 0; column < numCharClasses; column++) {
+                s.append(row->fNextState[column]);
+            }
+        } else {
+            const RBBIStateTableRow16 *row = (const RBBIStateTableRow16 *)rowData;
+            assertTrue(WHERE, row->fAccepting >= -1);
+            s.append(row->fAccepting + 1);   // values of -1 are expected.
+            s.append(row->fLookAhead);
+            s.append(row->fTagIdx);
+            for (int32_t column = 0; column < numCharClasses; column++) {
+                s.append(row->fNextState[column]);
+            }
         }
         rows.push_back(s);
     }
@@ -4578,12 +4603,12 @@ void RBBITest::TestReverse(std::unique_ptr<RuleBasedBreakIterator>bi) {
 
     RBBIDataWrapper *data = bi->fData;
     int32_t categoryCount = data->fHeader->fCatCount;
-    UTrie2  *trie = data->fTrie;
+    const UCPTrie  *trie = data->fTrie;
 
     std::vector<UnicodeString> strings(categoryCount, UnicodeString());
     for (int cp=0; cp<0x1fff0; ++cp) {
-        int cat = utrie2_get32(trie, cp);
-        cat &= ~0x4000;    // And off the dictionary bit from the category.
+        int cat = ucptrie_get(trie, cp);
+        cat &= ~data->fDictBit;    // And off the dictionary bit from the category.
         assertTrue(WHERE, cat < categoryCount && cat >= 0);
         if (cat < 0 || cat >= categoryCount) return;
         strings[cat].append(cp);
@@ -4640,6 +4665,380 @@ void RBBITest::TestBug13692() {
     assertSuccess(WHERE, status);
 }
 
+//
+//  TestTableRowSizes  State tables use 8-bit rows when they fit, 16-bit rows otherwise.
+//                     Check that both kinds work, including rules that need more
+//                     than 256 states.
+//
+void RBBITest::TestTableRowSizes() {
+    UnicodeString longWord;
+    for (int32_t i = 0; i < 300; ++i) {
+        longWord.append((UChar)(u'a' + i % 26));
+    }
+    UnicodeString smallRules(u"[a-z]+ {200}; [0-9]+ {100}; .;");
+    UnicodeString largeRules(u"'");
+    largeRules.append(longWord).append(u"' {300}; [a-z] {200}; [0-9]+ {100}; .;");
+    struct {
+        const UnicodeString *rules;
+        bool expect8Bits;
+    } cases[] = {{&smallRules, true}, {&largeRules, false}};
+    UnicodeString text(u"12 ");
+    text.append(longWord).append(u" xyz ").append(longWord, 0, 299);
+    for (const auto &c : cases) {
+        UParseError pe;
+        UErrorCode status = U_ZERO_ERROR;
+        RuleBasedBreakIterator bi(*c.rules, pe, status);
+        if (!assertSuccess(WHERE, status)) {
+            return;
+        }
+        const RBBIDataWrapper *dw = bi.fData;
+        assertEquals(WHERE, c.expect8Bits, (dw->fForwardTable->fFlags & RBBI_8BITS_ROWS) != 0);
+        assertTrue(WHERE, (dw->fReverseTable->fFlags & RBBI_8BITS_ROWS) != 0);
+
+        bi.setText(text);
+        std::vector<int32_t> forward;
+        for (int32_t pos = bi.first(); pos != BreakIterator::DONE; pos = bi.next()) {
+            forward.push_back(pos);
+            if (pos == 2) {
+                assertEquals(WHERE, 100, bi.getRuleStatus());
+            } else if (pos == 303) {
+                assertEquals(WHERE, c.expect8Bits ? 200 : 300, bi.getRuleStatus());
+            }
+        }
+        int32_t expectedCount = c.expect8Bits ? 8 : 308;
+        assertEquals(WHERE, expectedCount, (int32_t)forward.size());
+        std::vector<int32_t> backward;
+        for (int32_t pos = bi.last(); pos != BreakIterator::DONE; pos = bi.previous()) {
+            backward.insert(backward.begin(), pos);
+        }
+        assertTrue(WHERE, forward == backward);
+    }
+}
+
+//
+//  TestLongDictionaryRange  Very long runs of CJK text are segmented in pieces.
+//                           Check that the pieces are stitched back together
+//                           with the same boundaries as for a short text,
+//                           for UTF-16 and for UTF-8 input.
+//
+static void U_CALLCONV runBreakTaskOnNewThread(const void *context, UBreakIteratorTask *task) {
+    std::vector<std::thread> *threads =
+        static_cast<std::vector<std::thread> *>(const_cast<void *>(context));
+    threads->emplace_back(ubrk_runTask, task);
+}
+
+void RBBITest::TestLongDictionaryRange() {
+    UnicodeString unit(u"日本語のテキストを辞書で分割する東京都に住んでいる私はコンピュータが大好きです"
+                       u"カタカナ語もある漢字と平仮名の混ざった文章");
+    UErrorCode status = U_ZERO_ERROR;
+    LocalPointer<BreakIterator> bi(BreakIterator::createWordInstance(Locale::getJapanese(), status), status);
+    if (!assertSuccess(WHERE, status, true)) {
+        return;
+    }
+    // The boundaries within the middle one of three copies of the unit.
+    UnicodeString shortText = unit + unit + unit;
+    bi->setText(shortText);
+    std::vector<int32_t> unitBoundaries;
+    for (int32_t pos = bi->following(unit.length() - 1); pos < 2 * unit.length(); pos = bi->next()) {
+        unitBoundaries.push_back(pos - unit.length());
+    }
+    assertTrue(WHERE, unitBoundaries.size() > 10 && unitBoundaries[0] == 0);
+
+    UnicodeString longText;
+    std::vector<int32_t> expected;
+    for (int32_t i = 0; i < 400; ++i) {
+        for (int32_t pos : unitBoundaries) {
+            expected.push_back(longText.length() + pos);
+        }
+        longText.append(unit);
+    }
+    expected.push_back(longText.length());
+
+    bi->setText(longText);
+    std::vector<int32_t> actual;
+    for (int32_t pos = bi->first(); pos != BreakIterator::DONE; pos = bi->next()) {
+        actual.push_back(pos);
+    }
+    assertTrue(WHERE, expected == actual);
+
+    // The same text in UTF-8; all of the characters are three bytes long.
+    std::string longText8;
+    longText.toUTF8String(longText8);
+    LocalUTextPointer ut(utext_openUTF8(NULL, longText8.data(), (int64_t)longText8.length(), &status));
+    bi->setText(ut.getAlias(), status);
+    actual.clear();
+    for (int32_t pos = bi->first(); pos != BreakIterator::DONE; pos = bi->next()) {
+        actual.push_back(pos / 3);
+    }
+    assertSuccess(WHERE, status);
+    assertTrue(WHERE, expected == actual);
+
+    // With an executor, the long range is segmented in pieces on other threads,
+    // with the same boundaries.
+    RuleBasedBreakIterator *rbbi = dynamic_cast<RuleBasedBreakIterator *>(bi.getAlias());
+    if (!assertTrue(WHERE, rbbi != nullptr)) {
+        return;
+    }
+    std::vector<std::thread> threads;
+    rbbi->setExecutor(runBreakTaskOnNewThread, &threads);
+    for (int32_t utf8 = 0; utf8 <= 1; ++utf8) {
+        if (utf8) {
+            bi->setText(ut.getAlias(), status);
+        } else {
+            bi->setText(longText);
+        }
+        actual.clear();
+        for (int32_t pos = bi->first(); pos != BreakIterator::DONE; pos = bi->next()) {
+            actual.push_back(utf8 ? pos / 3 : pos);
+        }
+        assertSuccess(WHERE, status);
+        assertTrue(WHERE, expected == actual);
+    }
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+    assertTrue(WHERE, threads.size() > 4);
+}
+
+//
+//  TestTextAccessPaths  Break iterators read UnicodeString and UTF-8 text directly,
+//                       and other text through the UText functions.
+//                       Check that all of them find the same boundaries, including
+//                       for unpaired surrogates and ill-formed UTF-8.
+//
+static void getBoundaries(BreakIterator &bi, UVector32 &forward, UVector32 &backward,
+                          UErrorCode &status) {
+    forward.removeAllElements();
+    backward.removeAllElements();
+    for (int32_t pos = bi.first(); pos != BreakIterator::DONE; pos = bi.next()) {
+        forward.addElement(pos, status);
+        forward.addElement(bi.getRuleStatus(), status);
+    }
+    for (int32_t pos = bi.last(); pos != BreakIterator::DONE; pos = bi.previous()) {
+        backward.addElement(pos, status);
+    }
+}
+
+void RBBITest::TestTextAccessPaths() {
+    static const char *const texts[] = {
+        "Hello, world! It's 3.14 o'clock.\n",
+        "caf\xc3\xa9 na\xc3\xafve \xe6\x97\xa5\xe6\x9c\xac\xe8\xaa\x9e \xf0\x9f\x98\x80\xf0\x9f\x91\x8d!",
+        "bad \x80\x80 trail\xc3 lead\xe0\xb8 trunc\xf0\x9f. \xff\xfe\xed\xa0\x80 \xc0\xaf end",
+        "\xe0\xb8\x81\xe0\xb8\xb2\xe0\xb8\xa3\xe0\xb8\x97\xe0\xb8\x94\xe0\xb8\xa5\xe0\xb8\xad\xe0\xb8\x87 x\xf0\x9f"
+    };
+    UErrorCode status = U_ZERO_ERROR;
+    LocalPointer<BreakIterator> wordBI(BreakIterator::createWordInstance(Locale::getEnglish(), status), status);
+    LocalPointer<BreakIterator> lineBI(BreakIterator::createLineInstance(Locale::getEnglish(), status), status);
+    if (!assertSuccess(WHERE, status, true)) {
+        return;
+    }
+    BreakIterator *iters[] = { wordBI.getAlias(), lineBI.getAlias() };
+    UVector32 forward16(status), backward16(status), forward(status), backward(status);
+    for (const char *text : texts) {
+        // The UTF-16 string has one U+FFFD per ill-formed UTF-8 sequence.
+        UnicodeString s16 = UnicodeString::fromUTF8(text);
+        // Map UTF-8 offsets to UTF-16 offsets, the same way.
+        UVector32 map8to16(status);
+        int32_t length8 = (int32_t)strlen(text);
+        for (int32_t i8 = 0, i16 = 0; i8 < length8;) {
+            map8to16.addElement(i16, status);
+            UChar32 c;
+            U8_NEXT_OR_FFFD((const uint8_t *)text, i8, length8, c);
+            while (map8to16.size() < i8) {
+                map8to16.addElement(-1, status);
+            }
+            i16 += U16_LENGTH(c);
+        }
+        map8to16.addElement(s16.length(), status);
+        // Also test an unpaired surrogate in the UTF-16 text.
+        UnicodeString s16Surrogate(s16);
+        s16Surrogate.insert(3, (UChar)0xdc00);
+
+        for (BreakIterator *bi : iters) {
+            for (const UnicodeString *str : { &s16, &s16Surrogate }) {
+                bi->setText(*str);
+                getBoundaries(*bi, forward16, backward16, status);
+
+                // Through the UText functions.
+                StringCharacterIterator ci(*str);
+                LocalUTextPointer ut(utext_openCharacterIterator(NULL, &ci, &status));
+                bi->setText(ut.getAlias(), status);
+                getBoundaries(*bi, forward, backward, status);
+                assertSuccess(WHERE, status);
+                assertTrue(WHERE, forward16 == forward);
+                assertTrue(WHERE, backward16 == backward);
+                bi->setText(UnicodeString());
+            }
+
+            bi->setText(s16);
+            getBoundaries(*bi, forward16, backward16, status);
+            for (int32_t length : { length8, -1 }) {
+                LocalUTextPointer ut(utext_openUTF8(NULL, text, length, &status));
+                bi->setText(ut.getAlias(), status);
+                getBoundaries(*bi, forward, backward, status);
+                assertSuccess(WHERE, status);
+                for (int32_t i = 0; i < forward.size(); i += 2) {
+                    forward.setElementAt(map8to16.elementAti(forward.elementAti(i)), i);
+                }
+                for (int32_t i = 0; i < backward.size(); ++i) {
+                    backward.setElementAt(map8to16.elementAti(backward.elementAti(i)), i);
+                }
+                assertTrue(WHERE, forward16 == forward);
+                assertTrue(WHERE, backward16 == backward);
+                bi->setText(UnicodeString());
+            }
+        }
+    }
+}
+
+//
+//  TestFormatVersion5  Binary rules in data format version 5, with 16-bit state table rows
+//                      and a UTrie2 for the character categories, still load, and find the
+//                      same boundaries as the current format.
+//                      8-bit state table rows came with version 6, and are rejected in
+//                      version 5 data.
+//
+static void appendAligned(std::vector<uint8_t> &data, const void *bytes, size_t length,
+                          uint32_t &offset) {
+    data.resize((data.size() + 7) & ~(size_t)7);
+    offset = (uint32_t)data.size();
+    const uint8_t *p = static_cast<const uint8_t *>(bytes);
+    data.insert(data.end(), p, p + length);
+}
+
+static void appendVersion5Table(const RBBIDataHeader *header, uint32_t offset, uint32_t length,
+                                std::vector<uint8_t> &data, uint32_t &newOffset, uint32_t &newLength) {
+    if (length == 0) {
+        newOffset = (uint32_t)data.size();
+        newLength = 0;
+        return;
+    }
+    const RBBIStateTable *table = reinterpret_cast<const RBBIStateTable *>(
+        reinterpret_cast<const uint8_t *>(header) + offset);
+    int32_t numValues = (int32_t)(offsetof(RBBIStateTableRow16, fNextState) / 2 + header->fCatCount);
+    std::vector<int16_t> rows;
+    for (uint32_t state = 0; state < table->fNumStates; ++state) {
+        const char *row = table->fTableData + state * table->fRowLen;
+        if (table->fFlags & RBBI_8BITS_ROWS) {
+            const RBBIStateTableRow8 *row8 = reinterpret_cast<const RBBIStateTableRow8 *>(row);
+            rows.push_back(row8->fAccepting);
+            rows.push_back(row8->fLookAhead);
+            rows.push_back(row8->fTagIdx);
+            rows.push_back(row8->fReserved);
+            for (uint32_t col = 0; col < header->fCatCount; ++col) {
+                rows.push_back(row8->fNextState[col]);
+            }
+        } else {
+            const int16_t *row16 = reinterpret_cast<const int16_t *>(row);
+            rows.insert(rows.end(), row16, row16 + numValues);
+        }
+    }
+    RBBIStateTable top = *table;
+    top.fRowLen = numValues * 2;
+    top.fFlags &= ~RBBI_8BITS_ROWS;
+    appendAligned(data, &top, offsetof(RBBIStateTable, fTableData), newOffset);
+    uint32_t rowsOffset;
+    appendAligned(data, rows.data(), rows.size() * 2, rowsOffset);
+    newLength = (uint32_t)data.size() - newOffset;
+}
+
+static void toFormatVersion5(const uint8_t *rules, std::vector<uint8_t> &data, UErrorCode &status) {
+    const RBBIDataHeader *header = reinterpret_cast<const RBBIDataHeader *>(rules);
+    RBBIDataHeader newHeader = *header;
+    newHeader.fFormatVersion[0] = 5;
+    data.assign(sizeof(RBBIDataHeader), 0);
+    appendVersion5Table(header, header->fFTable, header->fFTableLen,
+                        data, newHeader.fFTable, newHeader.fFTableLen);
+    appendVersion5Table(header, header->fRTable, header->fRTableLen,
+                        data, newHeader.fRTable, newHeader.fRTableLen);
+
+    // The same categories in a UTrie2, with the dictionary bit at 0x4000.
+    UCPTrie *cpTrie = ucptrie_openFromBinary(UCPTRIE_TYPE_FAST, UCPTRIE_VALUE_BITS_ANY,
+                                             rules + header->fTrie, header->fTrieLen, NULL, &status);
+    UTrie2 *trie2 = utrie2_open(0, 0, &status);
+    if (U_SUCCESS(status)) {
+        uint32_t dictBit = cpTrie->valueWidth == UCPTRIE_VALUE_BITS_8 ? 0x80 : 0x4000;
+        uint32_t value;
+        for (UChar32 start = 0, end;
+                (end = ucptrie_getRange(cpTrie, start, UCPMAP_RANGE_NORMAL, 0, NULL, NULL, &value)) >= 0;
+                start = end + 1) {
+            if (value & dictBit) {
+                value = (value & ~dictBit) | 0x4000;
+            }
+            utrie2_setRange32(trie2, start, end, value, TRUE, &status);
+        }
+        utrie2_freeze(trie2, UTRIE2_16_VALUE_BITS, &status);
+    }
+    std::vector<uint8_t> trieBytes;
+    if (U_SUCCESS(status)) {
+        int32_t trieLength = utrie2_serialize(trie2, NULL, 0, &status);
+        if (status == U_BUFFER_OVERFLOW_ERROR) {
+            status = U_ZERO_ERROR;
+        }
+        trieBytes.resize(trieLength);
+        utrie2_serialize(trie2, trieBytes.data(), trieLength, &status);
+    }
+    utrie2_close(trie2);
+    ucptrie_close(cpTrie);
+    appendAligned(data, trieBytes.data(), trieBytes.size(), newHeader.fTrie);
+    newHeader.fTrieLen = (uint32_t)trieBytes.size();
+
+    appendAligned(data, rules + header->fStatusTable, header->fStatusTableLen, newHeader.fStatusTable);
+    appendAligned(data, rules + header->fRuleSource, header->fRuleSourceLen, newHeader.fRuleSource);
+    data.resize((data.size() + 7) & ~(size_t)7);
+    newHeader.fLength = (uint32_t)data.size();
+    uprv_memcpy(data.data(), &newHeader, sizeof(RBBIDataHeader));
+}
+
+void RBBITest::TestFormatVersion5() {
+    UnicodeString text(u"Hello, world! It's 3.14 o'clock.\n"
+                       u"การทดลอง 日本語の文章 "
+                       u"\U0001F600\U0001F44D!");
+    for (int32_t type = UBRK_CHARACTER; type <= UBRK_SENTENCE; ++type) {
+        UErrorCode status = U_ZERO_ERROR;
+        LocalPointer<BreakIterator> bi;
+        switch (type) {
+        case UBRK_CHARACTER: bi.adoptInstead(BreakIterator::createCharacterInstance(Locale::getEnglish(), status)); break;
+        case UBRK_WORD: bi.adoptInstead(BreakIterator::createWordInstance(Locale::getEnglish(), status)); break;
+        case UBRK_LINE: bi.adoptInstead(BreakIterator::createLineInstance(Locale::getEnglish(), status)); break;
+        default: bi.adoptInstead(BreakIterator::createSentenceInstance(Locale::getEnglish(), status)); break;
+        }
+        if (!assertSuccess(WHERE, status, true)) {
+            return;
+        }
+        RuleBasedBreakIterator *rbbi = dynamic_cast<RuleBasedBreakIterator *>(bi.getAlias());
+        uint32_t length = 0;
+        const uint8_t *rules = rbbi->getBinaryRules(length);
+        std::vector<uint8_t> data5;
+        toFormatVersion5(rules, data5, status);
+        RuleBasedBreakIterator bi5(data5.data(), (uint32_t)data5.size(), status);
+        if (!assertSuccess(WHERE, status)) {
+            return;
+        }
+        assertEquals(WHERE, 0x4000, (int32_t)bi5.fData->fDictBit);
+        assertEquals(WHERE, 0, (int32_t)(bi5.fData->fForwardTable->fFlags & RBBI_8BITS_ROWS));
+
+        bi->setText(text);
+        bi5.setText(text);
+        UVector32 forward(status), backward(status), forward5(status), backward5(status);
+        getBoundaries(*bi, forward, backward, status);
+        getBoundaries(bi5, forward5, backward5, status);
+        assertSuccess(WHERE, status);
+        assertTrue(WHERE, forward == forward5);
+        assertTrue(WHERE, backward == backward5);
+
+        std::vector<uint8_t> badData(data5);
+        const RBBIDataHeader *header5 = reinterpret_cast<const RBBIDataHeader *>(badData.data());
+        reinterpret_cast<RBBIStateTable *>(badData.data() + header5->fFTable)->fFlags |= RBBI_8BITS_ROWS;
+        UErrorCode badStatus = U_ZERO_ERROR;
+        RuleBasedBreakIterator badBI(badData.data(), (uint32_t)badData.size(), badStatus);
+        if (badStatus != U_INVALID_FORMAT_ERROR) {
+            errln("%s:%d Expected U_INVALID_FORMAT_ERROR for 8-bit rows in version 5 data, got %s",
+                  __FILE__, __LINE__, u_errorName(badStatus));
+        }
+    }
+}
+
 //
 //  TestDebug    -  A place-holder test for debugging purposes.
 //                  For putting in fragments of other tests that can be invoked
@@ -82,6 +82,10 @@ class RBBITest: public IntlTest {
     void TestReverse();
     void TestReverse(std::unique_ptr<RuleBasedBreakIterator>bi);
     void TestBug13692();
+    void TestTextAccessPaths();
+    void TestTableRowSizes();
+    void TestLongDictionaryRange();
+    void TestFormatVersion5();
 
     void TestDebug();
     void TestProperties();
@@ -105,6 +105,12 @@ void RegexTest::runIndexedTest( int32_t index, UBool exec, const char* &name, ch
     TESTCASE_AUTO(TestBug13631);
     TESTCASE_AUTO(TestBug13632);
     TESTCASE_AUTO(TestBug20359);
+    TESTCASE_AUTO(TestDFAMatching);
+    TESTCASE_AUTO(TestRequiredString);
+    TESTCASE_AUTO(TestUTF8Matching);
+    TESTCASE_AUTO(TestExecutionBudget);
+    TESTCASE_AUTO(TestRegexSet);
+    TESTCASE_AUTO(TestPatternMatches);
     TESTCASE_AUTO_END;
 }
 
@@ -1192,16 +1198,17 @@ void RegexTest::API_Match() {
 
     //
     //  Time Outs.
-    //       Note:  These tests will need to be changed when the regexp engine is
-    //              able to detect and cut short the exponential time behavior on
-    //              this type of match.
+    //       Note:  Patterns that need no backtracking state are matched without
+    //              the exponential time behavior (see TestDFAMatching), so these
+    //              tests use a back reference to keep the pattern on the
+    //              backtracking engine.
     //
     {
         UErrorCode status = U_ZERO_ERROR;
         //    Enough 'a's in the string to cause the match to time out.
         //       (Each on additonal 'a' doubles the time)
         UnicodeString testString("aaaaaaaaaaaaaaaaaaaaa");
-        RegexMatcher matcher("(a+)+b", testString, 0, status);
+        RegexMatcher matcher("(a+)+\\1b", testString, 0, status);
         REGEX_CHECK_STATUS;
         REGEX_ASSERT(matcher.getTimeLimit() == 0);
         matcher.setTimeLimit(100, status);
@@ -1213,7 +1220,7 @@ void RegexTest::API_Match() {
         UErrorCode status = U_ZERO_ERROR;
         //   Few enough 'a's to slip in under the time limit.
         UnicodeString testString("aaaaaaaaaaaaaaaaaa");
-        RegexMatcher matcher("(a+)+b", testString, 0, status);
+        RegexMatcher matcher("(a+)+\\1b", testString, 0, status);
         REGEX_CHECK_STATUS;
         matcher.setTimeLimit(100, status);
         REGEX_ASSERT(matcher.lookingAt(status) == FALSE);
@@ -5878,4 +5885,374 @@ void RegexTest::TestBug20359() {
     assertSuccess(WHERE, status);
 }
 
+// Patterns that need no backtracking state can be handed from the backtracking match engine
+// to a DFA, which runs in time linear in the length of the input. Check that patterns with
+// exponential backtracking complete quickly, and that results are unchanged from those of
+// the backtracking engine alone.
+
+void RegexTest::TestDFAMatching() {
+    // Each additional character would double the time taken by the backtracking engine.
+    static const char16_t *slowPats[] = {u"(a+)+b", u"(a|aa)+b", u"(?:a*)*c", nullptr};
+    UnicodeString slowText(40, u'a', 40);
+    for (const char16_t **pat=slowPats; *pat; ++pat) {
+        UErrorCode status = U_ZERO_ERROR;
+        RegexMatcher matcher(*pat, slowText, 0, status);
+        matcher.setTimeLimit(1000, status);
+        assertSuccess(WHERE, status);
+        assertFalse(WHERE, matcher.find(status));
+        assertSuccess(WHERE, status);
+        assertTrue(WHERE, matcher.hitEnd());
+        assertFalse(WHERE, matcher.matches(status));
+        assertSuccess(WHERE, status);
+        assertFalse(WHERE, matcher.lookingAt(status));
+        assertSuccess(WHERE, status);
+    }
+
+    // A match following a region of heavy backtracking; the groups come from the
+    // backtracking engine.
+    {
+        UErrorCode status = U_ZERO_ERROR;
+        UnicodeString text(slowText);
+        text.append(u"caab");
+        RegexMatcher matcher(u"(a|aa)+b", text, 0, status);
+        assertTrue(WHERE, matcher.find(status));
+        assertSuccess(WHERE, status);
+        assertEquals(WHERE, 41, matcher.start(status));
+        assertEquals(WHERE, 44, matcher.end(status));
+        assertEquals(WHERE, 42, matcher.start(1, status));
+        assertEquals(WHERE, 43, matcher.end(1, status));
+        assertFalse(WHERE, matcher.find(status));
+        assertSuccess(WHERE, status);
+    }
+
+    // Compare with the same patterns followed by an empty look-ahead, which keeps them
+    // on the backtracking engine. The last text is long enough for some patterns to
+    // switch to the DFA.
+    static const char16_t *pats[] = {u"(a|ab)(c|bcd)(d*)", u"(\\w+)@(\\w+)\\.com", u"x*",
+                                     u"[^a]+|a(b?)", u"(a+)+b", u".*\u00e9", nullptr};
+    static const char16_t *texts[] = {u"abcd abcdd", u"me@example.com, you@x.com",
+                                      u"a\u00e9\U0001F600b ab\nxx", u"aaaaaaaaaaaaaaaaaaaac aab",
+                                      nullptr};
+    for (const char16_t **pat=pats; *pat; ++pat) {
+        for (const char16_t **txt=texts; *txt; ++txt) {
+            UErrorCode status = U_ZERO_ERROR;
+            UnicodeString text(*txt);
+            RegexMatcher matcher(*pat, text, 0, status);
+            RegexMatcher expected(UnicodeString(u"(?:") + *pat + u")(?=)", text, 0, status);
+            if (!assertSuccess(WHERE, status)) {
+                return;
+            }
+            UBool found;
+            do {
+                found = expected.find(status);
+                assertEquals(WHERE, found, matcher.find(status));
+                assertSuccess(WHERE, status);
+                if (found) {
+                    for (int32_t group=0; group<=expected.groupCount(); ++group) {
+                        assertEquals(WHERE, expected.start(group, status), matcher.start(group, status));
+                        assertEquals(WHERE, expected.end(group, status), matcher.end(group, status));
+                    }
+                }
+                assertEquals(WHERE, expected.hitEnd(), matcher.hitEnd());
+            } while (found);
+            assertEquals(WHERE, expected.matches(status), matcher.matches(status));
+            assertEquals(WHERE, expected.hitEnd(), matcher.hitEnd());
+            assertEquals(WHERE, expected.lookingAt(status), matcher.lookingAt(status));
+            assertSuccess(WHERE, status);
+        }
+    }
+}
+
+// find() skips over input that lacks a literal string contained in every match of the pattern,
+// and over the start positions too far before the string for a match to reach it.
+
+void RegexTest::TestRequiredString() {
+    UnicodeString line(u"12:00:01 INFO request handled in 15 ms\n");
+    UnicodeString text;
+    for (int32_t i=0; i<50; ++i) {
+        text.append(line);
+    }
+    int32_t errorStart = text.length();
+    text.append(u"12:00:02 ERROR request timeout \U0001F600\n");
+    for (int32_t i=0; i<50; ++i) {
+        text.append(line);
+    }
+    static const struct {
+        const char16_t *pattern;
+        int32_t         start;      // Offset of the match from errorStart, or -1 for no match.
+        int32_t         end;
+    } cases[] = {
+        {u"\\d{2}:\\d{2}:\\d{2} ERROR", 0, 14},
+        {u"(\\d+) ERROR", 6, 14},
+        {u"[A-Z]+ request (timeout|refused)", 9, 30},
+        {u"\\w+ \\U0001F600", 23, 33},
+        {u"(?m)^\\S+ ERROR", 0, 14},
+        {u"\\d+ ms for user", -1, -1},
+        {u"(\\d+)? ?FATAL", -1, -1},
+    };
+    std::string u8;
+    text.toUTF8String(u8);
+    for (const auto &cas : cases) {
+        for (int32_t utf8=0; utf8<2; ++utf8) {
+            UErrorCode status = U_ZERO_ERROR;
+            RegexMatcher matcher(cas.pattern, 0, status);
+            LocalUTextPointer ut(utf8 ? utext_openUTF8(nullptr, u8.data(), u8.length(), &status) :
+                                        utext_openConstUnicodeString(nullptr, &text, &status));
+            matcher.reset(ut.getAlias());
+            if (!assertSuccess(WHERE, status)) {
+                return;
+            }
+            if (cas.start < 0) {
+                assertFalse(WHERE, matcher.find(status));
+                assertTrue(WHERE, matcher.hitEnd());
+                assertSuccess(WHERE, status);
+                continue;
+            }
+            // The text is ASCII up to the one supplementary character, so the UTF-8 and
+            //   UTF-16 indexes of the start of the match agree.
+            assertTrue(WHERE, matcher.find(status));
+            assertEquals(WHERE, errorStart + cas.start, matcher.start(status));
+            if (!utf8) {
+                assertEquals(WHERE, errorStart + cas.end, matcher.end(status));
+            }
+            assertFalse(WHERE, matcher.find(status));
+            assertTrue(WHERE, matcher.hitEnd());
+
+            // A region that ends within the required string.
+            matcher.region(0, errorStart + 12, status);
+            assertFalse(WHERE, matcher.find(status));
+            assertSuccess(WHERE, status);
+        }
+    }
+}
+
+// Matching UTF-8 input, which is scanned directly when it is one contiguous string,
+// gives the same results as matching the same text in UTF-16.
+// Ill-formed sequences match as U+FFFD.
+
+void RegexTest::TestUTF8Matching() {
+    static const char u8[] =
+        "ab\xC3\xA9 cd\r\nx1\xF0\x9F\x98\x80" "e\xCC\x81\xE2\x80\xA8" "AB\x80\xC3 \xED\xA0\x80y\xCE\xB1\xCE\xB2.\xC2\x85" "ab";
+    static const char16_t *patterns[] = {
+        u"\\w+", u"\\b\\w", u"\\B.", u"\\X", u"(?<=\\u00e9) (\\w)", u"(?<!b)\\u00e9", u"(.)\\1",
+        u"(?i)ab", u"(?i)[a-c\\u00c9]+", u"(?m)^.", u"(?m).$", u"$", u"\\R", u".*", u"(?s).+?y",
+        u"[^a-z]+", u"\\S+", u"\\uFFFD", u"\\uFFFD y", u"\\p{Greek}+", u"\\d\\U0001F600", u"\\v|\\h",
+    };
+    int32_t toUTF16[sizeof(u8)];     // UTF-16 index of each UTF-8 code point boundary.
+    UnicodeString text;
+    int32_t length = (int32_t)strlen(u8);
+    for (int32_t i = 0; i < length;) {
+        toUTF16[i] = text.length();
+        UChar32 c;
+        U8_NEXT_OR_FFFD(u8, i, length, c);
+        text.append(c);
+    }
+    toUTF16[length] = text.length();
+
+    for (const char16_t *pattern : patterns) {
+        UErrorCode status = U_ZERO_ERROR;
+        RegexMatcher m8(pattern, 0, status);
+        RegexMatcher m16(pattern, text, 0, status);
+        LocalUTextPointer ut(utext_openUTF8(nullptr, u8, length, &status));
+        m8.reset(ut.getAlias());
+        if (!assertSuccess(WHERE, status)) {
+            return;
+        }
+        for (int32_t regionStart : {0, 4, 21}) {
+            m8.region(regionStart, length, status);
+            m16.region(toUTF16[regionStart], text.length(), status);
+            UBool found;
+            while ((found = m16.find(status)) != FALSE) {
+                if (!assertTrue(WHERE, m8.find(status))) {
+                    break;
+                }
+                assertEquals(WHERE, m16.start(status), toUTF16[m8.start(status)]);
+                assertEquals(WHERE, m16.end(status), toUTF16[m8.end(status)]);
+                for (int32_t group = 1; group <= m16.groupCount(); ++group) {
+                    int32_t start = (int32_t)m8.start64(group, status);
+                    assertEquals(WHERE, m16.start(group, status), start < 0 ? -1 : toUTF16[start]);
+                }
+            }
+            assertFalse(WHERE, m8.find(status));
+            assertEquals(WHERE, m16.hitEnd(), m8.hitEnd());
+            m8.region(regionStart, length, status);
+            m16.region(toUTF16[regionStart], text.length(), status);
+            assertEquals(WHERE, m16.lookingAt(status), m8.lookingAt(status));
+            assertEquals(WHERE, m16.matches(status), m8.matches(status));
+            assertSuccess(WHERE, status);
+        }
+    }
+}
+
+// Backtrack limits, deadlines, and the execution counters of RegexMatcher.
+// The back reference keeps the pattern on the backtracking engine; see the time out tests in Callbacks().
+
+void RegexTest::TestExecutionBudget() {
+    UErrorCode status = U_ZERO_ERROR;
+    UnicodeString testString(u"aaaaaaaaaaaaaaaaaaaaa");
+    RegexMatcher matcher(u"(a+)+\\1b", testString, 0, status);
+    assertSuccess(WHERE, status);
+    assertEquals(WHERE, (int64_t)0, matcher.getOpCount());
+    assertEquals(WHERE, (int64_t)0, matcher.getBacktrackCount());
+    assertEquals(WHERE, (int64_t)0, matcher.getStackHighWater());
+
+    // Counters.
+    UnicodeString shortString(u"aaaaa");
+    matcher.reset(shortString);
+    assertFalse(WHERE, matcher.lookingAt(status));
+    assertSuccess(WHERE, status);
+    int64_t backtracks = matcher.getBacktrackCount();
+    assertTrue(WHERE, backtracks > 0);
+    assertTrue(WHERE, matcher.getOpCount() > backtracks);
+    assertTrue(WHERE, matcher.getStackHighWater() > 0);
+    assertTrue(WHERE, matcher.getStackHighWater() <= matcher.getStackLimit());
+    assertFalse(WHERE, matcher.lookingAt(status));
+    assertEquals(WHERE, backtracks, matcher.getBacktrackCount());   // lookingAt() starts a new count.
+    matcher.reset();
+    assertEquals(WHERE, (int64_t)0, matcher.getOpCount());
+    assertEquals(WHERE, (int64_t)0, matcher.getBacktrackCount());
+    assertEquals(WHERE, (int64_t)0, matcher.getStackHighWater());
+
+    // Backtrack limit.
+    assertEquals(WHERE, (int64_t)0, matcher.getBacktrackLimit());
+    matcher.setBacktrackLimit(-1, status);
+    assertEquals(WHERE, U_ILLEGAL_ARGUMENT_ERROR, status);
+    status = U_ZERO_ERROR;
+    matcher.setBacktrackLimit(backtracks + 1, status);
+    assertEquals(WHERE, backtracks + 1, matcher.getBacktrackLimit());
+    assertFalse(WHERE, matcher.lookingAt(status));
+    assertSuccess(WHERE, status);
+    matcher.setBacktrackLimit(100000, status);
+    matcher.reset(testString);
+    assertFalse(WHERE, matcher.lookingAt(status));
+    assertEquals(WHERE, U_REGEX_TIME_OUT, status);
+    assertTrue(WHERE, matcher.getBacktrackCount() > 100000);
+    assertTrue(WHERE, matcher.getBacktrackCount() < 200000);
+    status = U_ZERO_ERROR;
+    matcher.setBacktrackLimit(0, status);
+
+    // Deadline.
+    assertEquals(WHERE, 0.0, matcher.getDeadline());
+    matcher.setDeadline(-1, status);
+    assertEquals(WHERE, U_ILLEGAL_ARGUMENT_ERROR, status);
+    status = U_ZERO_ERROR;
+    matcher.setDeadline(1000.0, status);      // Long past.
+    assertEquals(WHERE, 1000.0, matcher.getDeadline());
+    assertFalse(WHERE, matcher.lookingAt(status));
+    assertEquals(WHERE, U_REGEX_TIME_OUT, status);
+    status = U_ZERO_ERROR;
+    matcher.reset(shortString);               // Too short to reach a check of the deadline.
+    assertFalse(WHERE, matcher.lookingAt(status));
+    assertSuccess(WHERE, status);
+}
+
+
+// RegexSet must report the same patterns as find() with each of its patterns does,
+// whether the patterns share a DFA or each have a RegexMatcher.
+void RegexTest::TestRegexSet() {
+    UErrorCode status = U_ZERO_ERROR;
+    UParseError pe;
+    RegexSet set(UREGEX_CASE_INSENSITIVE, status);
+    assertSuccess(WHERE, status);
+    assertEquals(WHERE, 0, set.size());
+
+    static const char16_t *patterns[] = {
+        u"abc",                 // Patterns that the DFA can match ...
+        u"\\d+x",
+        u"^b",
+        u"(?:a|b)*c$",
+        u"\\w+\\s\\w+",
+        u"(a)\\1",            // ... and patterns with back references and look around.
+        u"x(?=y)",
+        u"\\bq"
+    };
+    int32_t i;
+    for (i = 0; i < UPRV_LENGTHOF(patterns); ++i) {
+        assertEquals(WHERE, i, set.add(patterns[i], pe, status));
+    }
+    assertSuccess(WHERE, status);
+    assertEquals(WHERE, UPRV_LENGTHOF(patterns), set.size());
+    assertEquals(WHERE, UnicodeString(u"^b"), set.getPattern(2).pattern());
+
+    static const char16_t *inputs[] = {
+        u"", u"xABc", u"b12X", u"AA", u"one two", u"xy b", u"a q", u"12345"
+    };
+    for (i = 0; i < UPRV_LENGTHOF(inputs); ++i) {
+        UnicodeString input(inputs[i]);
+        int32_t dest[UPRV_LENGTHOF(patterns)];
+        int32_t numMatched = set.find(input, dest, UPRV_LENGTHOF(dest), status);
+        assertSuccess(WHERE, status);
+        int32_t numExpected = 0;
+        for (int32_t j = 0; j < UPRV_LENGTHOF(patterns); ++j) {
+            LocalPointer<RegexMatcher> matcher(set.getPattern(j).matcher(input, status));
+            if (matcher->find(status)) {
+                if (numExpected >= numMatched || dest[numExpected] != j) {
+                    errln("%s:%d input \"%s\": pattern %d not reported", __FILE__, __LINE__,
+                          CStr(input)(), j);
+                }
+                ++numExpected;
+            }
+        }
+        assertEquals(WHERE, numExpected, numMatched);
+    }
+
+    // Capacity.
+    UnicodeString input(u"xabc1xy");
+    assertEquals(WHERE, 3, set.find(input, NULL, 0, status));
+    assertEquals(WHERE, U_BUFFER_OVERFLOW_ERROR, status);
+    status = U_ZERO_ERROR;
+    assertEquals(WHERE, 0, set.find(input, NULL, 1, status));
+    assertEquals(WHERE, U_ILLEGAL_ARGUMENT_ERROR, status);
+    status = U_ZERO_ERROR;
+
+    // Adding a pattern after a find().
+    assertEquals(WHERE, UPRV_LENGTHOF(patterns), set.add(u"1XY$", pe, status));
+    int32_t dest[4];
+    assertEquals(WHERE, 4, set.find(input, dest, UPRV_LENGTHOF(dest), status));
+    assertSuccess(WHERE, status);
+    assertEquals(WHERE, UPRV_LENGTHOF(patterns), dest[3]);
+
+    // Syntax errors.
+    assertEquals(WHERE, -1, set.add(u"a(b", pe, status));
+    assertEquals(WHERE, U_REGEX_MISMATCHED_PAREN, status);
+    status = U_ZERO_ERROR;
+    assertEquals(WHERE, UPRV_LENGTHOF(patterns) + 1, set.size());
+}
+
+
+// RegexPattern::matches(input), with its pooled matchers, and a RegexMatcher
+// made on the stack from a shared pattern.
+void RegexTest::TestPatternMatches() {
+    UErrorCode status = U_ZERO_ERROR;
+    UParseError pe;
+    LocalPointer<RegexPattern> pattern(RegexPattern::compile(u"(\\w+)@(\\w+)\\.com", 0, pe, status));
+    assertSuccess(WHERE, status);
+    UnicodeString good(u"bob@example.com");
+    UnicodeString bad(u"bob@example.com.");
+    for (int32_t i = 0; i < 3; ++i) {
+        assertTrue(WHERE, pattern->matches(good, status));
+        assertFalse(WHERE, pattern->matches(bad, status));
+    }
+    UText goodText = UTEXT_INITIALIZER;
+    utext_openUTF8(&goodText, "alice@example.com", -1, &status);
+    assertTrue(WHERE, pattern->matches(&goodText, status));
+    utext_close(&goodText);
+    assertSuccess(WHERE, status);
+
+    // A pooled matcher is independent of the matchers that the application makes.
+    RegexMatcher matcher(*pattern, status);
+    assertSuccess(WHERE, status);
+    assertFalse(WHERE, matcher.matches(status));
+    matcher.reset(good);
+    assertTrue(WHERE, matcher.find(status));
+    assertFalse(WHERE, pattern->matches(bad, status));
+    assertEquals(WHERE, u"example", matcher.group(2, status));
+    assertSuccess(WHERE, status);
+
+    // An incoming error.
+    status = U_REGEX_TIME_OUT;
+    assertFalse(WHERE, pattern->matches(good, status));
+    assertEquals(WHERE, U_REGEX_TIME_OUT, status);
+}
+
 #endif  /* !UCONFIG_NO_REGULAR_EXPRESSIONS  */
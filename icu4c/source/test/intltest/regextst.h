@@ -60,6 +60,12 @@ class RegexTest: public IntlTest {
     virtual void TestBug13631();
     virtual void TestBug13632();
     virtual void TestBug20359();
+    virtual void TestDFAMatching();
+    virtual void TestRequiredString();
+    virtual void TestUTF8Matching();
+    virtual void TestExecutionBudget();
+    virtual void TestRegexSet();
+    virtual void TestPatternMatches();
 
     // The following functions are internal to the regexp tests.
     virtual void assertUText(const char *expected, UText *actual, const char *file, int line);
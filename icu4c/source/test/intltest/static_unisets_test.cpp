@@ -15,6 +15,7 @@ class StaticUnicodeSetsTest : public IntlTest {
   public:
     void testSetCoverage();
     void testNonEmpty();
+    void testSetContents();
 
     void runIndexedTest(int32_t index, UBool exec, const char *&name, char *par = 0);
 
@@ -39,6 +40,7 @@ void StaticUnicodeSetsTest::runIndexedTest(int32_t index, UBool exec, const char
             TESTCASE_AUTO(testSetCoverage);
         }
         TESTCASE_AUTO(testNonEmpty);
+        TESTCASE_AUTO(testSetContents);
     TESTCASE_AUTO_END;
 }
 
@@ -100,6 +102,33 @@ void StaticUnicodeSetsTest::testNonEmpty() {
     }
 }
 
+void StaticUnicodeSetsTest::testSetContents() {
+    // The sets that are not from data are built without parsing patterns.
+    // They must contain the same characters as these patterns.
+    static const struct {
+        unisets::Key key;
+        const char16_t* pattern;
+    } cases[] = {
+        {unisets::DEFAULT_IGNORABLES, u"[[:Zs:][\\u0009][:Bidi_Control:][:Variation_Selector:]]"},
+        {unisets::STRICT_IGNORABLES, u"[[:Bidi_Control:]]"},
+        {unisets::INFINITY_SIGN, u"[∞]"},
+        {unisets::DIGITS, u"[:digit:]"},
+    };
+    for (const auto& cas : cases) {
+        UErrorCode status = U_ZERO_ERROR;
+        UnicodeSet expected(cas.pattern, status);
+        if (!assertSuccess(UnicodeString(u"Parsing ") + cas.pattern, status)) {
+            continue;
+        }
+        assertTrue(UnicodeString(u"Set ") + cas.key + u" should be " + cas.pattern,
+                   expected == *get(cas.key));
+    }
+    UErrorCode status = U_ZERO_ERROR;
+    UnicodeSet otherGrouping(u"[٬‘\\u0020\\u00A0\\u2000-\\u200A\\u202F\\u205F\\u3000]", status);
+    otherGrouping.addAll(*get(unisets::APOSTROPHE_SIGN));
+    assertTrue("OTHER_GROUPING_SEPARATORS", otherGrouping == *get(unisets::OTHER_GROUPING_SEPARATORS));
+}
+
 void StaticUnicodeSetsTest::assertInSet(const UnicodeString &localeName, const UnicodeString &setName,
                               const UnicodeSet &set, const UnicodeString &str) {
     if (str.countChar32(0, str.length()) != 1) {
@@ -57,6 +57,7 @@ class StringCaseTest: public IntlTest {
     void TestMalformedUTF8();
     void TestBufferOverflow();
     void TestEdits();
+    void TestRepeatedReplaceEdits();
     void TestCopyMoveEdits();
     void TestEditsFindFwdBwd();
     void TestMergeEdits();
@@ -101,6 +102,7 @@ StringCaseTest::runIndexedTest(int32_t index, UBool exec, const char *&name, cha
     TESTCASE_AUTO(TestMalformedUTF8);
     TESTCASE_AUTO(TestBufferOverflow);
     TESTCASE_AUTO(TestEdits);
+    TESTCASE_AUTO(TestRepeatedReplaceEdits);
     TESTCASE_AUTO(TestCopyMoveEdits);
     TESTCASE_AUTO(TestEditsFindFwdBwd);
     TESTCASE_AUTO(TestMergeEdits);
@@ -983,6 +985,60 @@ void StringCaseTest::TestEdits() {
     assertFalse("reset then iterator", ei.next(errorCode));
 }
 
+void StringCaseTest::TestRepeatedReplaceEdits() {
+    IcuTestErrorCode errorCode(*this, "TestRepeatedReplaceEdits");
+    // addRepeatedReplace() must record the same edits as that many addReplace() calls.
+    static const struct {
+        int32_t oldLength, newLength, count;  // count 0: addUnchanged(oldLength)
+    } steps[] = {
+        { 1, 1, 1 },
+        { 1, 1, 700 },  // fills the first record and spans more
+        { 3, 0, 0 },
+        { 2, 1, 513 },
+        { 2, 1, 2 },  // continues the previous record
+        { 1, 1, 600 },
+        { 0, 10, 3 },  // insertions are not short changes
+        { 7, 7, 2 },
+        { 100000, 1, 2 }
+    };
+    Edits expected, actual;
+    for (const auto &step : steps) {
+        if (step.count == 0) {
+            expected.addUnchanged(step.oldLength);
+            actual.addUnchanged(step.oldLength);
+            continue;
+        }
+        for (int32_t i = 0; i < step.count; ++i) {
+            expected.addReplace(step.oldLength, step.newLength);
+        }
+        actual.addRepeatedReplace(step.oldLength, step.newLength, step.count);
+    }
+    assertEquals("numberOfChanges", expected.numberOfChanges(), actual.numberOfChanges());
+    assertEquals("lengthDelta", expected.lengthDelta(), actual.lengthDelta());
+    Edits::Iterator expectedIter = expected.getFineIterator();
+    Edits::Iterator actualIter = actual.getFineIterator();
+    for (int32_t i = 0;; ++i) {
+        UBool hasNext = expectedIter.next(errorCode);
+        if (!assertEquals("next() @ " + Int64ToUnicodeString(i), hasNext, actualIter.next(errorCode)) ||
+                !hasNext) {
+            break;
+        }
+        if (!assertEquals("oldLength @ " + Int64ToUnicodeString(i),
+                    expectedIter.oldLength(), actualIter.oldLength()) ||
+                !assertEquals("newLength @ " + Int64ToUnicodeString(i),
+                    expectedIter.newLength(), actualIter.newLength()) ||
+                !assertEquals("hasChange @ " + Int64ToUnicodeString(i),
+                    expectedIter.hasChange(), actualIter.hasChange())) {
+            break;
+        }
+    }
+
+    actual.addRepeatedReplace(1, 1, -1);
+    UErrorCode outErrorCode = U_ZERO_ERROR;
+    assertTrue("negative count: copyErrorTo", actual.copyErrorTo(outErrorCode));
+    assertEquals("negative count: error", U_ILLEGAL_ARGUMENT_ERROR, outErrorCode);
+}
+
 void StringCaseTest::TestCopyMoveEdits() {
     IcuTestErrorCode errorCode(*this, "TestCopyMoveEdits");
     // Exceed the stack array capacity.
@@ -75,6 +75,7 @@ TestMessageFormat::runIndexedTest(int32_t index, UBool exec,
     TESTCASE_AUTO(TestMessageFormatNumberSkeleton);
     TESTCASE_AUTO(TestMessageFormatDateSkeleton);
     TESTCASE_AUTO(TestMessageFormatTimeSkeleton);
+    TESTCASE_AUTO(TestArgFormatSlots);
     TESTCASE_AUTO_END;
 }
 
@@ -2075,4 +2076,45 @@ void TestMessageFormat::TestMessageFormatTimeSkeleton() {
     doTheRealDateTimeSkeletonTesting(date, u"{0,time,'::'yMMMMd}", "en", u"::2021November23", status);
 }
 
+void TestMessageFormat::TestArgFormatSlots() {
+    IcuTestErrorCode errorCode(*this, "TestArgFormatSlots");
+    // The plural number is selected by the explicit formatter in the "other" sub-message.
+    MessageFormat plural(u"{0,plural,one{{0,number,0.0} item}other{{0,number,0.0} items}}",
+                         Locale::getEnglish(), errorCode);
+    Formattable args[2] = { Formattable((int32_t)1), Formattable(u"x") };
+    FieldPosition ignore;
+    UnicodeString result;
+    assertEquals("plural number format", u"1.0 items",
+                 plural.format(args, 1, result, ignore, errorCode));
+
+    // setFormat(NULL) falls back to the default formatting.
+    MessageFormat simple(u"{0,number,percent} {1}", Locale::getEnglish(), errorCode);
+    args[0].setDouble(0.5);
+    assertEquals("percent", u"50% x", simple.format(args, 2, result.remove(), ignore, errorCode));
+    simple.adoptFormat(0, NULL);
+    assertEquals("adoptFormat(NULL)", u"0.5 x",
+                 simple.format(args, 2, result.remove(), ignore, errorCode));
+
+    // A custom ChoiceFormat whose result is a sub-message.
+    simple.adoptFormat(0, new ChoiceFormat(u"0#none|0<{1} some", errorCode));
+    assertEquals("custom ChoiceFormat", u"x some x",
+                 simple.format(args, 2, result.remove(), ignore, errorCode));
+
+    // Copies and reassigned patterns see their own formatters.
+    MessageFormat copy(simple);
+    MessageFormat assigned(u"{0}", Locale::getEnglish(), errorCode);
+    assigned = plural;
+    simple.applyPattern(u"{1} {0,number,integer}", errorCode);
+    args[0].setDouble(2.5);
+    assertEquals("copy", u"x some x", copy.format(args, 2, result.remove(), ignore, errorCode));
+    assertEquals("assigned", u"2.5 items", assigned.format(args, 1, result.remove(), ignore, errorCode));
+    assertEquals("applyPattern", u"x 2", simple.format(args, 2, result.remove(), ignore, errorCode));
+
+    // A missing named argument is echoed.
+    MessageFormat named(u"{a} {b}", Locale::getEnglish(), errorCode);
+    UnicodeString argNames[1] = { u"a" };
+    assertEquals("missing named argument", u"x {b}",
+                 named.format(argNames, args + 1, 1, result.remove(), errorCode));
+}
+
 #endif /* #if !UCONFIG_NO_FORMATTING */
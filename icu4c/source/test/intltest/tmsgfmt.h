@@ -124,6 +124,7 @@ class TestMessageFormat: public IntlTest {
     void TestMessageFormatNumberSkeleton();
     void TestMessageFormatDateSkeleton();
     void TestMessageFormatTimeSkeleton();
+    void TestArgFormatSlots();
 
 private:
     UnicodeString GetPatternAndSkipSyntax(const MessagePattern& pattern);
@@ -16,6 +16,8 @@
 
 #include "transtst.h"
 #include "unicode/locid.h"
+#include "unicode/bytestream.h"
+#include "unicode/edits.h"
 #include "unicode/dtfmtsym.h"
 #include "unicode/normlzr.h"
 #include "unicode/translit.h"
@@ -42,6 +44,7 @@
 #include "uni2name.h"
 #include "cstring.h"
 #include "cmemory.h"
+#include "testutil.h"
 #include <stdio.h>
 
 /***********************************************************************
@@ -196,6 +199,10 @@ TransliteratorTest::runIndexedTest(int32_t index, UBool exec,
         TESTCASE(82,TestHalfwidthFullwidth);
         TESTCASE(83,TestThai);
         TESTCASE(84,TestAny);
+        TESTCASE(85,TestFirstCharIndex);
+        TESTCASE(86,TestCachedInstances);
+        TESTCASE(87,TestSeparateOutput);
+        TESTCASE(88,TestIndexIDs);
         default: name = ""; break;
     }
 }
@@ -3931,6 +3938,273 @@ void TransliteratorTest::TestAny(void) {
     delete anyLatin;
 }
 
+/**
+ * Rules are tried only if they can start with the first character of
+ * the text.  Make sure that this keeps the rule order across rules that
+ * start with literals, sets, segments and supplementary characters.
+ */
+void TransliteratorTest::TestFirstCharIndex(void) {
+    UnicodeString rules(
+        "ab > 1;"
+        "[a-c] d > 2;"
+        "a > 3;"
+        "(c+) e > '[' $1 ']';"
+        "[{ch}h] i > 5;"
+        "\\U0001F600 > smile;"
+        "[\\U0001F601-\\U0001F602] > grin;", -1, US_INV);
+    UnicodeString source = CharsToUnicodeString(
+        "ab ad a bd cd ccce chi hi \\U0001F600 \\U0001F601 \\u0101b");
+    UnicodeString expected = CharsToUnicodeString(
+        "1 2 3 2 2 [ccc] 5 5 smile grin \\u0101b");
+    expect(rules, source, expected);
+
+    UParseError pe;
+    UErrorCode ec = U_ZERO_ERROR;
+    LocalPointer<Transliterator> t(Transliterator::createFromRules("Test", rules, UTRANS_FORWARD, pe, ec));
+    if (!assertSuccess("createFromRules", ec)) {
+        return;
+    }
+    LocalPointer<Transliterator> copy(t->clone());
+    expect(*copy, source, expected);
+}
+
+/**
+ * createInstance() hands out copies of cached instances.  Make sure
+ * that they are independent, and that registering or unregistering
+ * an ID is seen by the next createInstance().
+ */
+void TransliteratorTest::TestCachedInstances(void) {
+    UErrorCode ec = U_ZERO_ERROR;
+    UnicodeString id("[:^Lu:] Any-Latin; Latin-ASCII");
+    LocalPointer<Transliterator> t1(Transliterator::createInstance(id, UTRANS_FORWARD, ec));
+    LocalPointer<Transliterator> t2(Transliterator::createInstance(id, UTRANS_FORWARD, ec));
+    if (U_FAILURE(ec)) {
+        dataerrln("FAIL: createInstance(" + id + ") - " + u_errorName(ec));
+        return;
+    }
+    assertTrue("distinct instances", t1.getAlias() != t2.getAlias());
+    assertEquals("same ID", t1->getID(), t2->getID());
+    expect(*t2, CharsToUnicodeString("\\u0391\\u03B1"), CharsToUnicodeString("\\u0391a"));
+
+    LocalPointer<Transliterator> upper(Transliterator::createInstance("Any-Upper", UTRANS_FORWARD, ec));
+    if (!assertSuccess("createInstance(Any-Upper)", ec)) {
+        return;
+    }
+    upper->adoptFilter(new UnicodeSet("[a]", ec));
+    expect(*upper, "ab", "Ab");
+    LocalPointer<Transliterator> upper2(Transliterator::createInstance("Any-Upper", UTRANS_FORWARD, ec));
+    if (assertSuccess("createInstance(Any-Upper) again", ec)) {
+        expect(*upper2, "ab", "AB");
+    }
+
+    UParseError pe;
+    Transliterator::registerInstance(
+        Transliterator::createFromRules("Test-Cached", "a > b;", UTRANS_FORWARD, pe, ec));
+    LocalPointer<Transliterator> t4(Transliterator::createInstance("Test-Cached; Upper", UTRANS_FORWARD, ec));
+    if (!assertSuccess("createInstance(Test-Cached)", ec)) {
+        Transliterator::unregister("Test-Cached");
+        return;
+    }
+    expect(*t4, "ab", "BB");
+
+    Transliterator::unregister("Test-Cached");
+    LocalPointer<Transliterator> t5(Transliterator::createInstance("Test-Cached; Upper", UTRANS_FORWARD, ec));
+    assertEquals("createInstance after unregister", U_INVALID_ID, ec);
+    ec = U_ZERO_ERROR;
+
+    Transliterator::registerInstance(
+        Transliterator::createFromRules("Test-Cached", "a > c;", UTRANS_FORWARD, pe, ec));
+    LocalPointer<Transliterator> t6(Transliterator::createInstance("Test-Cached; Upper", UTRANS_FORWARD, ec));
+    if (assertSuccess("createInstance after registerInstance", ec)) {
+        expect(*t6, "ab", "CB");
+    }
+    Transliterator::unregister("Test-Cached");
+}
+
+namespace {
+
+/** Checks that the unchanged spans in edits are the same in src and dest. */
+template<typename StringType>
+void checkUnchangedSpans(IntlTest &test, const UnicodeString &name,
+                         const StringType &src, const StringType &dest, const Edits &edits) {
+    UErrorCode ec = U_ZERO_ERROR;
+    Edits::Iterator ei = edits.getCoarseIterator();
+    while (ei.next(ec)) {
+        if (!ei.hasChange() &&
+                src.compare(ei.sourceIndex(), ei.oldLength(),
+                            dest, ei.destinationIndex(), ei.newLength()) != 0) {
+            test.errln(name + ": unchanged span differs at source index " + ei.sourceIndex());
+        }
+    }
+    test.assertSuccess(name + " edits iterator", ec);
+    test.assertEquals(name + " lengthDelta", (int32_t)(dest.length() - src.length()),
+                      edits.lengthDelta());
+}
+
+}  // namespace
+
+/**
+ * transliterate() into a separate UTF-8 or UTF-16 output gives the same
+ * text as transliterating in place, and its Edits map back to the source.
+ */
+void TransliteratorTest::TestSeparateOutput(void) {
+    UErrorCode ec = U_ZERO_ERROR;
+    static const char *const ids[] = {
+        "Any-Latin",
+        "NFD; [:Nonspacing Mark:] Remove; NFC",
+        "[:^Lu:] Any-Latin; Latin-ASCII; Upper",
+        "Any-Hex/C",
+    };
+    UnicodeString src = CharsToUnicodeString(
+        "Caf\\u00E9 \\u0391\\u03B8\\u03AE\\u03BD\\u03B1 \\u041C\\u043E\\u0441\\u043A\\u0432\\u0430 "
+        "\\uD83D\\uDE00 \\u4E2D\\u6587 d\\u00E9j\\u00E0 vu");
+    for (int32_t i = 0; i < UPRV_LENGTHOF(ids); ++i) {
+        UnicodeString id(ids[i], -1, US_INV);
+        LocalPointer<Transliterator> t(Transliterator::createInstance(id, UTRANS_FORWARD, ec));
+        if (U_FAILURE(ec)) {
+            dataerrln("FAIL: createInstance(" + id + ") - " + u_errorName(ec));
+            return;
+        }
+        UnicodeString expected(src);
+        t->transliterate(expected);
+
+        UnicodeString dest16("prefix:");
+        Edits edits;
+        t->transliterate(src, dest16, &edits, ec);
+        assertSuccess(id + " UTF-16", ec);
+        assertEquals(id + " UTF-16", "prefix:" + expected, dest16);
+        checkUnchangedSpans(*this, id + " UTF-16", src, dest16.tempSubString(7), edits);
+
+        std::string src8, dest8;
+        src.toUTF8String(src8);
+        StringByteSink<std::string> sink(&dest8);
+        t->transliterate(src8, sink, &edits, ec);
+        assertSuccess(id + " UTF-8", ec);
+        assertEquals(id + " UTF-8", expected, UnicodeString::fromUTF8(dest8));
+        checkUnchangedSpans(*this, id + " UTF-8", src8, dest8, edits);
+
+        dest8.clear();
+        t->transliterate(src8, sink, NULL, ec);
+        assertEquals(id + " UTF-8 without Edits", expected, UnicodeString::fromUTF8(dest8));
+
+        // Long text, with many replacements far from the end.
+        UnicodeString longSrc;
+        for (int32_t j = 0; j < 200; ++j) {
+            longSrc.append(src);
+        }
+        UnicodeString longExpected(longSrc), longDest;
+        t->transliterate(longExpected);
+        t->transliterate(longSrc, longDest, &edits, ec);
+        assertEquals(id + " long text", longExpected, longDest);
+        checkUnchangedSpans(*this, id + " long text", longSrc, longDest, edits);
+    }
+
+    UParseError pe;
+    LocalPointer<Transliterator> t(Transliterator::createFromRules(
+        "Test", "a > bb; c > ; x > \\uD800;", UTRANS_FORWARD, pe, ec));
+    if (!assertSuccess("createFromRules", ec)) {
+        return;
+    }
+    UnicodeString dest16;
+    Edits edits;
+    t->transliterate(UnicodeString("abcd"), dest16, &edits, ec);
+    assertEquals("abcd", "bbbd", dest16);
+    static const EditChange expectedChanges[] = {
+        { TRUE, 1, 2 },
+        { FALSE, 1, 1 },
+        { TRUE, 1, 0 },
+        { FALSE, 1, 1 }
+    };
+    TestUtility::checkEditsIter(*this, u"abcd",
+        edits.getFineIterator(), edits.getFineIterator(),
+        expectedChanges, UPRV_LENGTHOF(expectedChanges), TRUE, ec);
+
+    // Ill-formed UTF-8 and unpaired surrogates in the result become U+FFFD.
+    std::string dest8;
+    StringByteSink<std::string> sink(&dest8);
+    t->transliterate("a\xFFx\xF0\x9F\x98\x80", sink, &edits, ec);
+    assertEquals("ill-formed UTF-8", "bb\xEF\xBF\xBD\xEF\xBF\xBD\xF0\x9F\x98\x80",
+                 dest8.c_str());
+    static const EditChange expectedChanges8[] = {
+        { TRUE, 1, 2 },
+        { TRUE, 1, 3 },
+        { TRUE, 1, 3 },
+        { FALSE, 4, 4 }
+    };
+    TestUtility::checkEditsIter(*this, u"ill-formed UTF-8",
+        edits.getFineIterator(), edits.getFineIterator(),
+        expectedChanges8, UPRV_LENGTHOF(expectedChanges8), TRUE, ec);
+
+    dest8.clear();
+    t->transliterate("", sink, &edits, ec);
+    assertTrue("empty", dest8.empty() && !edits.hasChanges() && edits.lengthDelta() == 0);
+    assertSuccess("TestSeparateOutput", ec);
+}
+
+static UBool isAvailableID(const UnicodeString& id) {
+    UErrorCode ec = U_ZERO_ERROR;
+    LocalPointer<StringEnumeration> ids(Transliterator::getAvailableIDs(ec));
+    const UnicodeString* s;
+    while (ids.isValid() && (s = ids->snext(ec)) != NULL) {
+        if (*s == id) {
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+/**
+ * The system transliterators from the data index are looked up and
+ * created on demand; make sure that they behave like registered ones.
+ */
+void TransliteratorTest::TestIndexIDs() {
+    UnicodeString id("Digit-Tone");
+    UnicodeString realID("NumericPinyin-Pinyin");
+    UnicodeString text(u"ni3 hao3");
+    UErrorCode ec = U_ZERO_ERROR;
+    LocalPointer<Transliterator> real(Transliterator::createInstance(realID, UTRANS_FORWARD, ec));
+    if (U_FAILURE(ec)) {
+        dataerrln("FAIL: createInstance(NumericPinyin-Pinyin) - %s", u_errorName(ec));
+        return;
+    }
+    UnicodeString expected(text);
+    real->transliterate(expected);
+    assertEquals("NumericPinyin-Pinyin", u"ni\u030C hao\u030C", expected);
+
+    assertTrue("Digit-Tone available", isAvailableID(id));
+    assertFalse("internal Devanagari-InterIndic not available",
+                isAvailableID(UnicodeString("Devanagari-InterIndic")));
+    int32_t count = Transliterator::countAvailableIDs();
+
+    // Index IDs are case-insensitive, like other IDs.
+    LocalPointer<Transliterator> t(Transliterator::createInstance(UnicodeString("digit-TONE"), UTRANS_FORWARD, ec));
+    if (assertSuccess("createInstance(digit-TONE)", ec)) {
+        UnicodeString result(text);
+        t->transliterate(result);
+        assertEquals("digit-TONE", expected, result);
+    }
+
+    // Unregistering masks the index entry.
+    Transliterator::unregister(id);
+    assertFalse("Digit-Tone unregistered", isAvailableID(id));
+    assertEquals("count after unregister", count - 1, Transliterator::countAvailableIDs());
+    t.adoptInstead(Transliterator::createInstance(id, UTRANS_FORWARD, ec));
+    if (U_SUCCESS(ec)) {
+        errln("FAIL: createInstance(Digit-Tone) succeeded after unregister()");
+    }
+
+    ec = U_ZERO_ERROR;
+    Transliterator::registerAlias(id, realID);
+    assertTrue("Digit-Tone registered again", isAvailableID(id));
+    assertEquals("count after registerAlias", count, Transliterator::countAvailableIDs());
+    t.adoptInstead(Transliterator::createInstance(id, UTRANS_FORWARD, ec));
+    if (assertSuccess("createInstance(Digit-Tone) after registerAlias", ec)) {
+        UnicodeString result(text);
+        t->transliterate(result);
+        assertEquals("Digit-Tone", expected, result);
+    }
+}
+
 
 /**
  * Test the source and target set API.  These are only implemented
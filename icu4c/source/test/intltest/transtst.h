@@ -338,6 +338,14 @@ class TransliteratorTest : public IntlTest {
 
     void TestAny(void);
 
+    void TestFirstCharIndex(void);
+
+    void TestCachedInstances(void);
+
+    void TestSeparateOutput(void);
+
+    void TestIndexIDs(void);
+
     void TestSourceTargetSet(void);
 
     void TestPatternWhiteSpace(void);
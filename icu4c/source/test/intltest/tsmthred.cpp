@@ -25,7 +25,10 @@
 #include "tsmthred.h"
 #include "unicode/ushape.h"
 #include "unicode/translit.h"
+#include "unicode/rbbi.h"
+#include "unicode/regex.h"
 #include "sharedobject.h"
+#include "sharedmessageformat.h"
 #include "unifiedcache.h"
 #include "uassert.h"
 
@@ -42,6 +45,7 @@ MultithreadTest::~MultithreadTest()
 #include <string.h>
 #include <ctype.h>    // tolower, toupper
 #include <memory>
+#include <vector>
 
 #include "unicode/putil.h"
 
@@ -67,6 +71,7 @@ void MultithreadTest::runIndexedTest( int32_t index, UBool exec,
 #endif
 #if !UCONFIG_NO_COLLATION
     TESTCASE_AUTO(TestCollators);
+    TESTCASE_AUTO(TestCollationSortExecutor);
 #endif /* #if !UCONFIG_NO_COLLATION */
     TESTCASE_AUTO(TestString);
     TESTCASE_AUTO(TestArabicShapingThreads);
@@ -79,6 +84,16 @@ void MultithreadTest::runIndexedTest( int32_t index, UBool exec,
     TESTCASE_AUTO(Test20104);
 #endif /* #if !UCONFIG_NO_FORMATTING */
 #endif /* #if !UCONFIG_NO_TRANSLITERATION */
+#if !UCONFIG_NO_BREAK_ITERATION
+    TESTCASE_AUTO(TestSharedBreakIterator);
+#endif
+#if !UCONFIG_NO_REGULAR_EXPRESSIONS
+    TESTCASE_AUTO(TestSharedRegexPattern);
+#endif
+#if !UCONFIG_NO_FORMATTING
+    TESTCASE_AUTO(TestSharedMessageFormat);
+#endif
+    TESTCASE_AUTO(TestUDataOpenThreads);
     TESTCASE_AUTO_END
 }
 
@@ -1366,3 +1381,361 @@ void MultithreadTest::Test20104() {
 #endif /* !UCONFIG_NO_FORMATTING */
 
 #endif /* !UCONFIG_NO_TRANSLITERATION */
+
+
+#if !UCONFIG_NO_BREAK_ITERATION
+//
+//  Shared break iterator test
+//     Threads concurrently copy one const RuleBasedBreakIterator onto their stacks,
+//     and iterate over their own texts, which use the dictionary break engines.
+//
+
+static const RuleBasedBreakIterator *gSharedBreakIterator;
+static const UnicodeString *gBreakTexts;
+static const std::vector<int32_t> *gExpectedBreaks;
+static const int32_t kNumBreakTexts = 3;
+
+class SharedBreakIteratorThread: public SimpleThread {
+  public:
+    SharedBreakIteratorThread() {}
+    ~SharedBreakIteratorThread() {}
+    void run();
+};
+
+void SharedBreakIteratorThread::run() {
+    for (int32_t i=0; i<100; i++) {
+        int32_t textIndex = i % kNumBreakTexts;
+        RuleBasedBreakIterator cursor(*gSharedBreakIterator);
+        cursor.setText(gBreakTexts[textIndex]);
+        std::vector<int32_t> breaks;
+        for (int32_t pos = cursor.first(); pos != BreakIterator::DONE; pos = cursor.next()) {
+            breaks.push_back(pos);
+        }
+        if (breaks != gExpectedBreaks[textIndex]) {
+            IntlTest::gTest->errln("%s:%d Shared break iterator threading failure.", __FILE__, __LINE__);
+            break;
+        }
+    }
+}
+
+void MultithreadTest::TestSharedBreakIterator() {
+    UErrorCode status = U_ZERO_ERROR;
+    const UnicodeString texts[kNumBreakTexts] = {
+        u"Hello, world. Shared break iterators are copied for each request.",
+        u"\u0E42\u0E14\u0E22\u0E1E\u0E37\u0E49\u0E19\u0E10\u0E32\u0E19\u0E41\u0E25\u0E49\u0E27 "
+        u"\u0E20\u0E32\u0E29\u0E32\u0E44\u0E17\u0E22",
+        u"\u65E5\u672C\u8A9E\u306E\u30C6\u30AD\u30B9\u30C8\u3092\u8F9E\u66F8\u3067"
+        u"\u5206\u5272\u3059\u308B"
+    };
+    LocalPointer<RuleBasedBreakIterator> shared(dynamic_cast<RuleBasedBreakIterator *>(
+        BreakIterator::createWordInstance(Locale::getEnglish(), status)));
+    if (!assertSuccess(WHERE, status, true) || !assertTrue(WHERE, shared.isValid())) {
+        return;
+    }
+    std::vector<int32_t> expected[kNumBreakTexts];
+    for (int32_t i=0; i<kNumBreakTexts; i++) {
+        shared->setText(texts[i]);
+        for (int32_t pos = shared->first(); pos != BreakIterator::DONE; pos = shared->next()) {
+            expected[i].push_back(pos);
+        }
+        assertTrue(WHERE, expected[i].size() > 3);
+    }
+    // The shared iterator has now found the Thai and CJK engines, which its copies get too.
+    shared->setText(UnicodeString());
+    gSharedBreakIterator = shared.getAlias();
+    gBreakTexts = texts;
+    gExpectedBreaks = expected;
+
+    SharedBreakIteratorThread threads[4];
+    for (int i=0; i<UPRV_LENGTHOF(threads); ++i) {
+        threads[i].start();
+    }
+    for (int i=0; i<UPRV_LENGTHOF(threads); ++i) {
+        threads[i].join();
+    }
+
+    gSharedBreakIterator = NULL;
+    gBreakTexts = NULL;
+    gExpectedBreaks = NULL;
+}
+#endif /* #if !UCONFIG_NO_BREAK_ITERATION */
+
+
+#if !UCONFIG_NO_REGULAR_EXPRESSIONS
+//
+//  Shared regex pattern test
+//     Threads concurrently match one const RegexPattern, both with the pattern's
+//     pooled matchers and with matchers on their stacks.  The inputs that backtrack
+//     heavily make the first threads to get to them build the pattern's NFA.
+//
+
+static const RegexPattern *gSharedRegexPattern;
+static const UnicodeString *gRegexTexts;
+static const UBool *gExpectedRegexMatches;
+static const int32_t kNumRegexTexts = 4;
+
+class SharedRegexPatternThread: public SimpleThread {
+  public:
+    SharedRegexPatternThread() {}
+    ~SharedRegexPatternThread() {}
+    void run();
+};
+
+void SharedRegexPatternThread::run() {
+    UErrorCode status = U_ZERO_ERROR;
+    RegexMatcher matcher(*gSharedRegexPattern, status);
+    for (int32_t i=0; i<400 && U_SUCCESS(status); i++) {
+        int32_t textIndex = i % kNumRegexTexts;
+        matcher.reset(gRegexTexts[textIndex]);
+        if (gSharedRegexPattern->matches(gRegexTexts[textIndex], status) != gExpectedRegexMatches[textIndex] ||
+                matcher.matches(status) != gExpectedRegexMatches[textIndex]) {
+            IntlTest::gTest->errln("%s:%d Shared regex pattern threading failure.", __FILE__, __LINE__);
+            break;
+        }
+    }
+    if (U_FAILURE(status)) {
+        IntlTest::gTest->errln("%s:%d %s", __FILE__, __LINE__, u_errorName(status));
+    }
+}
+
+void MultithreadTest::TestSharedRegexPattern() {
+    UErrorCode status = U_ZERO_ERROR;
+    UParseError pe;
+    LocalPointer<RegexPattern> shared(RegexPattern::compile(u"(?:a|aa)*(\\w+)@(\\w+)\\.com", 0, pe, status));
+    if (!assertSuccess(WHERE, status)) {
+        return;
+    }
+    UnicodeString many_a(u'a', 2000, 2000);
+    const UnicodeString texts[kNumRegexTexts] = {
+        u"bob@example.com",
+        u"bob@example.org",
+        many_a + u"x@example.com",
+        many_a + u"@"
+    };
+    UBool expected[kNumRegexTexts] = {TRUE, FALSE, TRUE, FALSE};
+    gSharedRegexPattern = shared.getAlias();
+    gRegexTexts = texts;
+    gExpectedRegexMatches = expected;
+
+    SharedRegexPatternThread threads[4];
+    for (int i=0; i<UPRV_LENGTHOF(threads); ++i) {
+        threads[i].start();
+    }
+    for (int i=0; i<UPRV_LENGTHOF(threads); ++i) {
+        threads[i].join();
+    }
+
+    gSharedRegexPattern = NULL;
+    gRegexTexts = NULL;
+    gExpectedRegexMatches = NULL;
+}
+#endif /* !UCONFIG_NO_REGULAR_EXPRESSIONS */
+
+
+#if !UCONFIG_NO_FORMATTING
+//
+//  Shared MessageFormat test
+//     Threads concurrently format with one cached MessageFormat, whose plural rules
+//     and default formats were created before it was shared.
+//
+
+static const MessageFormat *gSharedMessageFormat;
+static const UnicodeString *gExpectedMessages;
+static const int32_t kNumMessages = 3;
+
+class SharedMessageFormatThread: public SimpleThread {
+  public:
+    SharedMessageFormatThread() {}
+    ~SharedMessageFormatThread() {}
+    void run();
+};
+
+void SharedMessageFormatThread::run() {
+    UErrorCode status = U_ZERO_ERROR;
+    for (int32_t i=0; i<300 && U_SUCCESS(status); i++) {
+        int32_t n = i % kNumMessages;
+        Formattable args[3] = {
+            Formattable((int32_t)n), Formattable(1000000000000.0 * n, Formattable::kIsDate), Formattable(u"Ann")
+        };
+        UnicodeString result;
+        FieldPosition ignore;
+        gSharedMessageFormat->format(args, 3, result, ignore, status);
+        if (result != gExpectedMessages[n]) {
+            IntlTest::gTest->errln("%s:%d Shared MessageFormat threading failure.", __FILE__, __LINE__);
+            break;
+        }
+    }
+    if (U_FAILURE(status)) {
+        IntlTest::gTest->errln("%s:%d %s", __FILE__, __LINE__, u_errorName(status));
+    }
+}
+
+void MultithreadTest::TestSharedMessageFormat() {
+    UErrorCode status = U_ZERO_ERROR;
+    const UnicodeString pattern(u"{0,plural,one{# file}other{# files}} on {1}, {2}");
+    const SharedMessageFormat *shared = MessageFormat::createSharedInstance(pattern, "fr", status);
+    const SharedMessageFormat *again = MessageFormat::createSharedInstance(pattern, "fr", status);
+    if (!assertSuccess(WHERE, status, true)) {
+        return;
+    }
+    assertTrue(WHERE, shared == again);
+    again->removeRef();
+
+    MessageFormat unshared(pattern, "fr", status);
+    UnicodeString expected[kNumMessages];
+    for (int32_t n=0; n<kNumMessages; n++) {
+        Formattable args[3] = {
+            Formattable((int32_t)n), Formattable(1000000000000.0 * n, Formattable::kIsDate), Formattable(u"Ann")
+        };
+        FieldPosition ignore;
+        unshared.format(args, 3, expected[n], ignore, status);
+    }
+    assertSuccess(WHERE, status);
+    assertTrue(WHERE, expected[0].startsWith(u"0 file on "));
+    gSharedMessageFormat = shared->get();
+    gExpectedMessages = expected;
+
+    SharedMessageFormatThread threads[4];
+    for (int i=0; i<UPRV_LENGTHOF(threads); ++i) {
+        threads[i].start();
+    }
+    for (int i=0; i<UPRV_LENGTHOF(threads); ++i) {
+        threads[i].join();
+    }
+
+    gSharedMessageFormat = NULL;
+    gExpectedMessages = NULL;
+    shared->removeRef();
+}
+#endif /* !UCONFIG_NO_FORMATTING */
+
+
+//
+//  udata_open() test
+//     Threads concurrently open items of the ICU data and of the testdata package,
+//     which are found via the cache of common data, and check that they get the
+//     same items as the main thread.
+//
+
+static const char *gUDataTestPath;
+static const void *gUDataItems[2];
+
+class UDataOpenThread: public SimpleThread {
+  public:
+    UDataOpenThread() {}
+    ~UDataOpenThread() {}
+    void run();
+};
+
+void UDataOpenThread::run() {
+    for (int32_t i=0; i<200; i++) {
+        UErrorCode status = U_ZERO_ERROR;
+        LocalUDataMemoryPointer icuItem(udata_open(NULL, "icu", "cnvalias", &status));
+        LocalUDataMemoryPointer testItem(udata_open(gUDataTestPath, "res", "root", &status));
+        if (U_FAILURE(status)) {
+            IntlTest::gTest->errln("%s:%d udata_open() failed - %s", __FILE__, __LINE__, u_errorName(status));
+            break;
+        }
+        if (udata_getMemory(icuItem.getAlias()) != gUDataItems[0] ||
+                udata_getMemory(testItem.getAlias()) != gUDataItems[1]) {
+            IntlTest::gTest->errln("%s:%d udata_open() threading failure.", __FILE__, __LINE__);
+            break;
+        }
+    }
+}
+
+void MultithreadTest::TestUDataOpenThreads() {
+    UErrorCode status = U_ZERO_ERROR;
+    gUDataTestPath = loadTestData(status);
+    LocalUDataMemoryPointer icuItem(udata_open(NULL, "icu", "cnvalias", &status));
+    LocalUDataMemoryPointer testItem(udata_open(gUDataTestPath, "res", "root", &status));
+    if (U_FAILURE(status)) {
+        dataerrln("%s:%d udata_open() failed - %s", __FILE__, __LINE__, u_errorName(status));
+        return;
+    }
+    gUDataItems[0] = udata_getMemory(icuItem.getAlias());
+    gUDataItems[1] = udata_getMemory(testItem.getAlias());
+
+    UDataOpenThread threads[4];
+    for (int i=0; i<UPRV_LENGTHOF(threads); ++i) {
+        threads[i].start();
+    }
+    for (int i=0; i<UPRV_LENGTHOF(threads); ++i) {
+        threads[i].join();
+    }
+    gUDataTestPath = NULL;
+}
+
+#if !UCONFIG_NO_COLLATION
+//-----------------------------------------------------------------------------------
+//
+//   TestCollationSortExecutor - ucol_sortStrings() with sort tasks run on
+//                               separate threads, one thread per task.
+//
+//-----------------------------------------------------------------------------------
+
+namespace {
+
+class SortTaskThread : public SimpleThread {
+  public:
+    SortTaskThread(UCollationSortTask *task) : fTask(task) {}
+    virtual void run() { ucol_runSortTask(fTask); }
+  private:
+    UCollationSortTask *fTask;
+};
+
+typedef std::vector<std::unique_ptr<SortTaskThread>> SortTaskThreads;
+
+void U_CALLCONV threadSortExecutor(const void *context, UCollationSortTask *task) {
+    SortTaskThreads &threads = *static_cast<SortTaskThreads *>(const_cast<void *>(context));
+    threads.emplace_back(new SortTaskThread(task));
+    threads.back()->start();
+}
+
+}  // namespace
+
+void MultithreadTest::TestCollationSortExecutor() {
+    IcuTestErrorCode status(*this, "TestCollationSortExecutor");
+    LocalUCollatorPointer coll(ucol_open("de", status));
+    if (status.errDataIfFailureAndReset("ucol_open(de)")) {
+        return;
+    }
+    static const char16_t *const words[] = {
+        u"Stra\u00DFe", u"strasse", u"\u00C4rger", u"arger", u"Arger", u"zebra", u"\u00E9t\u00E9"
+    };
+    const int32_t count = 5000;
+    std::vector<UnicodeString> strings;
+    std::vector<const UChar *> sequential, parallel;
+    std::vector<int32_t> sequentialLengths, parallelLengths;
+    for (int32_t i = 0; i < count; ++i) {
+        UnicodeString s(words[i % UPRV_LENGTHOF(words)]);
+        s.append((UChar)0x20).append(UnicodeString(u"0123456789"), (i * 7919) % 10, 3);
+        strings.push_back(s);
+    }
+    for (int32_t i = 0; i < count; ++i) {
+        sequential.push_back(strings[i].getBuffer());
+        sequentialLengths.push_back(strings[i].length());
+    }
+    parallel = sequential;
+    parallelLengths = sequentialLengths;
+
+    ucol_sortStrings(coll.getAlias(), sequential.data(), sequentialLengths.data(), count,
+                     NULL, NULL, status);
+    SortTaskThreads threads;
+    ucol_sortStrings(coll.getAlias(), parallel.data(), parallelLengths.data(), count,
+                     threadSortExecutor, &threads, status);
+    for (size_t i = 0; i < threads.size(); ++i) {
+        threads[i]->join();
+    }
+    if (status.errIfFailureAndReset("ucol_sortStrings()")) {
+        return;
+    }
+    assertTrue("sort tasks ran on several threads", threads.size() > 1);
+    for (int32_t i = 0; i < count; ++i) {
+        if (parallel[i] != sequential[i] || parallelLengths[i] != sequentialLengths[i]) {
+            errln("ucol_sortStrings() with threads differs from the sequential sort at %d", (int)i);
+            break;
+        }
+    }
+}
+#endif  // !UCONFIG_NO_COLLATION
@@ -43,12 +43,17 @@ class MultithreadTest : public IntlTest
     void TestThreadedIntl(void);
 #endif
     void TestCollators(void);
+    void TestCollationSortExecutor();
     void TestString();
     void TestAnyTranslit();
     void TestUnifiedCache();
     void TestBreakTranslit();
     void TestIncDec();
     void Test20104();
+    void TestSharedBreakIterator();
+    void TestSharedRegexPattern();
+    void TestSharedMessageFormat();
+    void TestUDataOpenThreads();
 };
 
 #endif
@@ -10,6 +10,7 @@
 
 #if !UCONFIG_NO_NORMALIZATION
 
+#include "unicode/appendable.h"
 #include "unicode/uchar.h"
 #include "unicode/errorcode.h"
 #include "unicode/normlzr.h"
@@ -60,6 +61,12 @@ void BasicNormalizerTest::runIndexedTest(int32_t index, UBool exec,
     TESTCASE_AUTO(TestNormalizeIllFormedText);
     TESTCASE_AUTO(TestComposeJamoTBase);
     TESTCASE_AUTO(TestComposeBoundaryAfter);
+    TESTCASE_AUTO(TestQuickCheckLongRuns);
+    TESTCASE_AUTO(TestStreamingNormalizer);
+    TESTCASE_AUTO(TestDecomposeUTF8WithEdits);
+    TESTCASE_AUTO(TestCasefoldASCIIUTF8);
+    TESTCASE_AUTO(TestNormalizeUTF8Batch);
+    TESTCASE_AUTO(TestCompareCommonPrefix);
     TESTCASE_AUTO_END;
 }
 
@@ -1805,4 +1812,378 @@ BasicNormalizerTest::TestComposeBoundaryAfter() {
     assertFalse("U+FB2C boundary-after", nfkc->hasBoundaryAfter(0xFB2C));
 }
 
+void
+BasicNormalizerTest::TestQuickCheckLongRuns() {
+    IcuTestErrorCode errorCode(*this, "TestQuickCheckLongRuns");
+    const Normalizer2 *nfc = Normalizer2::getNFCInstance(errorCode);
+    const Normalizer2 *nfkc = Normalizer2::getNFKCInstance(errorCode);
+    if(errorCode.errDataIfFailureAndReset("Normalizer2::getNFC/NFKCInstance() call failed")) {
+        return;
+    }
+    // The fast paths test several code units at a time against the lowest
+    // code point that is not "yes" and ccc=0. Put one such character at every
+    // position of strings of characters just below that,
+    // so that it lands in every unit of a word and in the partial last word.
+    // Digits do not combine with the mappings.
+    static const struct {
+        const char *name;
+        const Normalizer2 *n2;
+        UChar low;  // below the threshold, UTF-8 lead byte too
+        UChar no;  // not "yes" in the normalization form
+        UChar mapped;  // normalize(no)
+    } cases[] = {
+        { "NFC", nfc, 0x2FF, 0x340, 0x300 },
+        { "NFKC", nfkc, 0x9F, 0xA0, 0x20 }
+    };
+    for (const auto &c : cases) {
+        for (int32_t length = 1; length <= 40; ++length) {
+            UnicodeString inert;
+            for (int32_t j = 0; j < length; ++j) {
+                inert.append(j % 5 == 4 ? c.low : (UChar)(u'0' + j % 10));
+            }
+            std::string inert8;
+            inert.toUTF8String(inert8);
+            if (!c.n2->isNormalized(inert, errorCode) ||
+                    c.n2->spanQuickCheckYes(inert, errorCode) != length ||
+                    !c.n2->isNormalizedUTF8(inert8, errorCode)) {
+                errln("%s: inert string of length %d not recognized as normalized",
+                      c.name, (int)length);
+            }
+            for (int32_t i = 0; i < length; ++i) {
+                UnicodeString s(inert), expected(inert);
+                s.setCharAt(i, c.no);
+                expected.setCharAt(i, c.mapped);
+                std::string s8, expected8, result8;
+                s.toUTF8String(s8);
+                expected.toUTF8String(expected8);
+                StringByteSink<std::string> sink(&result8);
+                c.n2->normalizeUTF8(0, s8, sink, nullptr, errorCode);
+                if (c.n2->isNormalized(s, errorCode) ||
+                        c.n2->spanQuickCheckYes(s, errorCode) > i ||
+                        c.n2->normalize(s, errorCode) != expected ||
+                        c.n2->isNormalizedUTF8(s8, errorCode) ||
+                        result8 != expected8) {
+                    errln("%s: U+%04X at index %d of %d not normalized",
+                          c.name, c.no, (int)i, (int)length);
+                }
+            }
+        }
+        errorCode.assertSuccess();
+    }
+}
+
+void
+BasicNormalizerTest::TestStreamingNormalizer() {
+    IcuTestErrorCode errorCode(*this, "TestStreamingNormalizer");
+    const Normalizer2 *nfc = Normalizer2::getNFCInstance(errorCode);
+    const Normalizer2 *nfd = Normalizer2::getNFDInstance(errorCode);
+    const Normalizer2 *nfkc_cf = Normalizer2::getNFKCCasefoldInstance(errorCode);
+    if(errorCode.errDataIfFailureAndReset("Normalizer2::getNFC/NFD/NFKCCasefoldInstance() call failed")) {
+        return;
+    }
+    // Compositions and reordering across chunk boundaries,
+    // Hangul syllables from Jamo, a supplementary composition (U+1109A),
+    // supplementary combining marks and an ill-formed UTF-8 sequence.
+    static const char *const src8 =
+        "Ha\xcc\x81l\xcc\xa3\xcc\x87o \xe1\x84\x80\xe1\x85\xa1\xe1\x86\xa8 "
+        "\xf0\x91\x82\x99\xf0\x91\x82\xba A\xf0\x9d\x85\xa5\xcc\x81\xcc\xa3 "
+        "\xef\xac\x81\xc3\x85\xe2\x84\xab\xc2\xad\xed\xa0\x80x \xe1\xba\x9b\xcc\xa3!";
+    UnicodeString src = UnicodeString::fromUTF8(src8);
+    static const struct {
+        const char *name;
+        const Normalizer2 *n2;
+    } forms[] = { { "NFC", nfc }, { "NFD", nfd }, { "NFKC_CF", nfkc_cf } };
+    for (const auto &form : forms) {
+        UnicodeString expected = form.n2->normalize(src, errorCode);
+        std::string expected8;
+        StringByteSink<std::string> expectedSink(&expected8);
+        form.n2->normalizeUTF8(0, src8, expectedSink, nullptr, errorCode);
+        StreamingNormalizer2 stream(*form.n2);
+        for (int32_t chunkLength = 1; chunkLength < 10; ++chunkLength) {
+            UnicodeString result;
+            UnicodeStringAppendable appendable(result);
+            for (int32_t i = 0; i < src.length(); i += chunkLength) {
+                stream.normalizeChunk(src.tempSubString(i, chunkLength), appendable, errorCode);
+            }
+            stream.finish(appendable, errorCode);
+            assertEquals(UnicodeString(form.name) + u" UTF-16 chunks of " + Int64ToUnicodeString(chunkLength),
+                         expected, result);
+
+            std::string result8;
+            StringByteSink<std::string> sink(&result8);
+            int32_t length8 = (int32_t)uprv_strlen(src8);
+            for (int32_t i = 0; i < length8; i += chunkLength) {
+                stream.normalizeChunkUTF8(
+                    StringPiece(src8 + i, chunkLength < length8 - i ? chunkLength : length8 - i), sink, errorCode);
+            }
+            stream.finishUTF8(sink, errorCode);
+            assertEquals(UnicodeString(form.name) + u" UTF-8 chunks of " + Int64ToUnicodeString(chunkLength),
+                         expected8.c_str(), result8.c_str());
+        }
+        errorCode.assertSuccess();
+    }
+
+    // Without boundaries, text is written out anyway, so that memory stays bounded.
+    StreamingNormalizer2 stream(*nfc);
+    UnicodeString marks;
+    for (int32_t i = 0; i < 100; ++i) {
+        marks.append(u"\u0301\u0323", 2);
+    }
+    UnicodeString result;
+    UnicodeStringAppendable appendable(result);
+    stream.normalizeChunk(u"x", appendable, errorCode);
+    for (int32_t i = 0; i < 30; ++i) {
+        stream.normalizeChunk(marks, appendable, errorCode);
+    }
+    assertTrue("text is written out without boundaries", result.length() > 0);
+    stream.finish(appendable, errorCode);
+    assertEquals("all of the text is written out", 1 + 30 * marks.length(), result.length());
+
+    // Mixing UTF-16 and UTF-8 input is an error.
+    std::string result8;
+    StringByteSink<std::string> sink(&result8);
+    stream.normalizeChunk(u"a\u0301", appendable, errorCode);
+    stream.normalizeChunkUTF8("b", sink, errorCode);
+    assertEquals("mixed input", U_INVALID_STATE_ERROR, errorCode.reset());
+    stream.reset();
+    stream.normalizeChunkUTF8("b", sink, errorCode);
+    stream.finishUTF8(sink, errorCode);
+    assertSuccess("after reset()", errorCode.get());
+    assertEquals("after reset()", "b", result8.c_str());
+}
+
+void
+BasicNormalizerTest::TestDecomposeUTF8WithEdits() {
+    IcuTestErrorCode errorCode(*this, "TestDecomposeUTF8WithEdits");
+    const Normalizer2 *nfd = Normalizer2::getNFDInstance(errorCode);
+    const Normalizer2 *nfkd = Normalizer2::getNFKDInstance(errorCode);
+    const Normalizer2 *fcd = Normalizer2::getInstance(nullptr, "nfc", UNORM2_FCD, errorCode);
+    if (errorCode.errDataIfFailureAndReset("Normalizer2 factory methods failed")) {
+        return;
+    }
+    static const char *const src = u8"  Ä\u0323a\u0301\u0323가\u1100\u1161 é";
+    std::string expected = u8"  A\u0323\u0308a\u0323\u0301\u1100\u1161\u1100\u1161 e\u0301";
+    std::string result;
+    StringByteSink<std::string> sink(&result, static_cast<int32_t>(expected.length()));
+    Edits edits;
+    nfd->normalizeUTF8(0, src, sink, &edits, errorCode);
+    assertSuccess("NFD normalizeUTF8 with Edits", errorCode.get());
+    assertEquals("NFD normalizeUTF8 with Edits", expected.c_str(), result.c_str());
+    static const EditChange expectedChanges[] = {
+        { FALSE, 2, 2 },  // 2 spaces
+        { TRUE, 4, 5 },  // Ä\u0323→A\u0323\u0308
+        { FALSE, 1, 1 },  // a
+        { TRUE, 4, 4 },  // \u0301\u0323→\u0323\u0301
+        { TRUE, 3, 6 },  // 가→\u1100\u1161
+        { FALSE, 7, 7 },  // \u1100\u1161 and a space
+        { TRUE, 2, 3 }  // é→e\u0301
+    };
+    static const EditChange expectedCoarseChanges[] = {
+        { FALSE, 2, 2 },
+        { TRUE, 4, 5 },
+        { FALSE, 1, 1 },
+        { TRUE, 7, 10 },
+        { FALSE, 7, 7 },
+        { TRUE, 2, 3 }
+    };
+    assertTrue("NFD normalizeUTF8 with Edits hasChanges", edits.hasChanges());
+    assertEquals("NFD normalizeUTF8 with Edits lengthDelta", 5, edits.lengthDelta());
+    TestUtility::checkEditsIter(*this, u"NFD normalizeUTF8 with Edits",
+            edits.getFineIterator(), edits.getFineIterator(),
+            expectedChanges, UPRV_LENGTHOF(expectedChanges),
+            TRUE, errorCode);
+    TestUtility::checkEditsIter(*this, u"NFD normalizeUTF8 with Edits coarse",
+            edits.getCoarseIterator(), edits.getCoarseIterator(),
+            expectedCoarseChanges, UPRV_LENGTHOF(expectedCoarseChanges),
+            TRUE, errorCode);
+    assertFalse("NFD isNormalizedUTF8(source)", nfd->isNormalizedUTF8(src, errorCode));
+    assertTrue("NFD isNormalizedUTF8(normalized)", nfd->isNormalizedUTF8(result, errorCode));
+
+    // Omit unchanged text.
+    expected = u8"A\u0323\u0308\u0323\u0301\u1100\u1161e\u0301";
+    result.clear();
+    edits.reset();
+    nfd->normalizeUTF8(U_OMIT_UNCHANGED_TEXT, src, sink, &edits, errorCode);
+    assertSuccess("NFD normalizeUTF8 omit unchanged", errorCode.get());
+    assertEquals("NFD normalizeUTF8 omit unchanged", expected.c_str(), result.c_str());
+    assertEquals("NFD normalizeUTF8 omit unchanged lengthDelta", 5, edits.lengthDelta());
+    TestUtility::checkEditsIter(*this, u"NFD normalizeUTF8 omit unchanged",
+            edits.getFineIterator(), edits.getFineIterator(),
+            expectedChanges, UPRV_LENGTHOF(expectedChanges),
+            TRUE, errorCode);
+
+    // Ill-formed sequences are inert and copied unchanged.
+    static const char illFormed[] = "a\xcc\x81\xcc\xa3\xcc" "b\xff\x80" "c";
+    static const char illFormedNFD[] = "a\xcc\xa3\xcc\x81\xcc" "b\xff\x80" "c";
+    result.clear();
+    nfd->normalizeUTF8(0, illFormed, sink, nullptr, errorCode);
+    assertEquals("NFD normalizeUTF8 ill-formed", illFormedNFD, result.c_str());
+
+    // The UTF-8 implementations must match the UTF-16 ones.
+    static const char16_t *const strings[] = {
+        u"",
+        u"abc",
+        u"\u00C0\u0323\u0345\u0301",
+        u"a\u0334\u00C0\u0301\u0344",
+        u"\uAC00\uAC01\u1100\u1161\u11A8",
+        u"\uFB01\u2126\uF900\uFF21\u00A0\u0385",
+        u"\u0F73\u0F71\u0F72\U0001D15E\U0001D165\U0001D16D\u05B0\u0591",
+        u"x\u304B\u3099\u309B\u0340\u0300\u0345\u0301\u0323 end"
+    };
+    static const struct {
+        const char *name;
+        const Normalizer2 *n2;
+    } modes[] = {
+        { "NFD", nfd },
+        { "NFKD", nfkd },
+        { "FCD", fcd }
+    };
+    for (const auto &mode : modes) {
+        for (int32_t i = 0; i < UPRV_LENGTHOF(strings); ++i) {
+            UnicodeString s16(strings[i]);
+            std::string s8, expected8, result8;
+            s16.toUTF8String(s8);
+            mode.n2->normalize(s16, errorCode).toUTF8String(expected8);
+            StringByteSink<std::string> sink8(&result8);
+            mode.n2->normalizeUTF8(0, s8, sink8, &edits, errorCode);
+            if (result8 != expected8 ||
+                    edits.lengthDelta() != (int32_t)(result8.length() - s8.length()) ||
+                    edits.hasChanges() != (result8 != s8) ||
+                    mode.n2->isNormalizedUTF8(s8, errorCode) != mode.n2->isNormalized(s16, errorCode)) {
+                errln("%s: normalizeUTF8(strings[%d]) differs from normalize()", mode.name, (int)i);
+            }
+        }
+        errorCode.assertSuccess();
+    }
+}
+
+void
+BasicNormalizerTest::TestCasefoldASCIIUTF8() {
+    IcuTestErrorCode errorCode(*this, "TestCasefoldASCIIUTF8");
+    const Normalizer2 *nfkc_cf = Normalizer2::getNFKCCasefoldInstance(errorCode);
+    if (errorCode.errDataIfFailureAndReset("Normalizer2::getNFKCCasefoldInstance() call failed")) {
+        return;
+    }
+    // Long ASCII runs with uppercase letters,
+    // and uppercase letters at the ends of runs that compose with what follows.
+    static const char *const src =
+        u8"THE QUICK BROWN FOX, The Quick Brown Fox; the quick brown fox. "
+        u8"ABCDEFGHIJKLMNOPQRSTUVWXYZ@[`{ A\u0308Bc\u0301 \uFB01X\u00AD\u0323XYZ";
+    std::string expected = u8"the quick brown fox, the quick brown fox; the quick brown fox. "
+        u8"abcdefghijklmnopqrstuvwxyz@[`{ äbć fix\u0323xyz";
+    std::string result;
+    StringByteSink<std::string> sink(&result);
+    Edits edits;
+    nfkc_cf->normalizeUTF8(0, src, sink, &edits, errorCode);
+    assertSuccess("normalizeUTF8 with Edits", errorCode.get());
+    assertEquals("normalizeUTF8 with Edits", expected.c_str(), result.c_str());
+    assertEquals("normalizeUTF8 with Edits lengthDelta",
+                 (int32_t)(expected.length() - uprv_strlen(src)), edits.lengthDelta());
+    UnicodeString src16 = UnicodeString::fromUTF8(src);
+    std::string expected16;
+    nfkc_cf->normalize(src16, errorCode).toUTF8String(expected16);
+    assertEquals("normalizeUTF8 == normalize", expected16.c_str(), result.c_str());
+    assertFalse("isNormalizedUTF8(source)", nfkc_cf->isNormalizedUTF8(src, errorCode));
+    assertTrue("isNormalizedUTF8(normalized)", nfkc_cf->isNormalizedUTF8(result, errorCode));
+    assertFalse("isNormalizedUTF8(one uppercase letter)",
+                nfkc_cf->isNormalizedUTF8("abcdefghijklmnopqrstuvwxyZ", errorCode));
+
+    // Omit unchanged text.
+    result.clear();
+    nfkc_cf->normalizeUTF8(U_OMIT_UNCHANGED_TEXT, "Hello WORLD a\xcc\x88", sink, nullptr, errorCode);
+    assertSuccess("normalizeUTF8 omit unchanged", errorCode.get());
+    assertEquals("normalizeUTF8 omit unchanged", "hworld\xc3\xa4", result.c_str());
+}
+
+void
+BasicNormalizerTest::TestNormalizeUTF8Batch() {
+    IcuTestErrorCode errorCode(*this, "TestNormalizeUTF8Batch");
+    const Normalizer2 *nfc = Normalizer2::getNFCInstance(errorCode);
+    if (errorCode.errDataIfFailureAndReset("Normalizer2::getNFCInstance() call failed")) {
+        return;
+    }
+    static const StringPiece src[] = {
+        u8"tag", u8"", u8"A\u0308", u8"ca\u0301fe\u0301", u8"\u00C4rger", u8"\u1100\u1161"
+    };
+    static const char *const expected = u8"tag\u00C4c\u00E1f\u00E9\u00C4rger\uAC00";
+    static const int32_t expectedLimits[] = { 3, 3, 5, 11, 17, 20 };
+    static const UBool expectedIsNormalized[] = { TRUE, TRUE, FALSE, FALSE, TRUE, FALSE };
+    std::string result;
+    StringByteSink<std::string> sink(&result);
+    int32_t limits[UPRV_LENGTHOF(src)];
+    UBool isNormalized[UPRV_LENGTHOF(src)];
+    nfc->normalizeUTF8Batch(0, src, UPRV_LENGTHOF(src), sink, limits, isNormalized, errorCode);
+    assertSuccess("normalizeUTF8Batch", errorCode.get());
+    assertEquals("normalizeUTF8Batch", expected, result.c_str());
+    for (int32_t i = 0; i < UPRV_LENGTHOF(src); ++i) {
+        assertEquals("normalizeUTF8Batch limit", expectedLimits[i], limits[i]);
+        assertEquals("normalizeUTF8Batch isNormalized", expectedIsNormalized[i], isNormalized[i]);
+    }
+
+    // Omit the strings that are already normalized.
+    result.clear();
+    nfc->normalizeUTF8Batch(U_OMIT_UNCHANGED_TEXT, src, UPRV_LENGTHOF(src), sink,
+                            limits, nullptr, errorCode);
+    assertSuccess("normalizeUTF8Batch omit unchanged", errorCode.get());
+    assertEquals("normalizeUTF8Batch omit unchanged",
+                 u8"\u00C4c\u00E1f\u00E9\uAC00", result.c_str());
+    assertEquals("normalizeUTF8Batch omit unchanged limits[0]", 0, limits[0]);
+    assertEquals("normalizeUTF8Batch omit unchanged limits[5]", 11, limits[5]);
+
+    nfc->normalizeUTF8Batch(0, nullptr, 1, sink, nullptr, nullptr, errorCode);
+    assertEquals("normalizeUTF8Batch(nullptr, 1)",
+                 U_ILLEGAL_ARGUMENT_ERROR, errorCode.reset());
+}
+
+void
+BasicNormalizerTest::TestCompareCommonPrefix() {
+    // unorm_compare() skips a common prefix up to its last ASCII character
+    // and compares ASCII-only strings without normalization data.
+    // Combining marks after the prefix must still be reordered with the marks
+    // in the prefix, and a longer string is not always greater.
+    static const struct {
+        const UChar *s1, *s2;
+        uint32_t options;
+        int32_t expected;  // sign
+    } cases[] = {
+        { u"Hello World", u"hello world", U_COMPARE_IGNORE_CASE, 0 },
+        { u"Hello World", u"hello world", 0, -1 },
+        { u"abc", u"ABD", U_COMPARE_IGNORE_CASE, -1 },
+        { u"abc", u"abcd", U_COMPARE_IGNORE_CASE, -1 },
+        { u"abcd", u"ABC", U_COMPARE_IGNORE_CASE, 1 },
+        { u"[", u"a", U_COMPARE_IGNORE_CASE, -1 },  // '[' is between 'Z' and 'a'
+        { u"x\u00E1", u"xa\u0301", 0, 0 },
+        { u"xa\u0301\u0323", u"xa\u0323\u0301", 0, 0 },
+        { u"x\u00E1b", u"xa\u0301c", U_COMPARE_IGNORE_CASE, -1 },
+        // The same text, then a mark that is reordered before the greater mark
+        // at the end of the shorter string.
+        { u"xa\u0346", u"xa\u0346\u0323", 0, 1 },
+        { u"\u00E9tude", u"\u00C9TUDE", U_COMPARE_IGNORE_CASE, 0 },
+        { u"\u00E9tude x", u"\u00C9TUDE y", U_COMPARE_IGNORE_CASE, -1 },
+        { u"stra\u00DFe", u"STRASSE", U_COMPARE_IGNORE_CASE, 0 },
+        { u"k", u"\u212A", U_COMPARE_IGNORE_CASE, 0 },  // KELVIN SIGN
+        { u"xI", u"xi", U_COMPARE_IGNORE_CASE | U_FOLD_CASE_EXCLUDE_SPECIAL_I, 1 }
+    };
+    for (int32_t i = 0; i < UPRV_LENGTHOF(cases); ++i) {
+        UnicodeString s1(cases[i].s1);
+        UnicodeString s2(cases[i].s2);
+        for (int32_t nulTerminated = 0; nulTerminated <= 1; ++nulTerminated) {
+            UErrorCode errorCode = U_ZERO_ERROR;
+            int32_t result = unorm_compare(
+                s1.getTerminatedBuffer(), nulTerminated ? -1 : s1.length(),
+                s2.getTerminatedBuffer(), nulTerminated ? -1 : s2.length(),
+                cases[i].options, &errorCode);
+            if (U_FAILURE(errorCode)) {
+                dataerrln("unorm_compare() case %d failed - %s", (int)i, u_errorName(errorCode));
+                return;
+            }
+            int32_t sign = result < 0 ? -1 : result > 0 ? 1 : 0;
+            if (sign != cases[i].expected) {
+                errln("unorm_compare() case %d (NUL-terminated=%d) returned %d, expected sign %d",
+                      (int)i, (int)nulTerminated, (int)result, (int)cases[i].expected);
+            }
+        }
+    }
+}
+
 #endif /* #if !UCONFIG_NO_NORMALIZATION */
@@ -53,6 +53,12 @@ class BasicNormalizerTest : public IntlTest {
     void TestNormalizeIllFormedText();
     void TestComposeJamoTBase();
     void TestComposeBoundaryAfter();
+    void TestQuickCheckLongRuns();
+    void TestStreamingNormalizer();
+    void TestDecomposeUTF8WithEdits();
+    void TestCasefoldASCIIUTF8();
+    void TestNormalizeUTF8Batch();
+    void TestCompareCommonPrefix();
 
 private:
     UnicodeString canonTests[24][3];
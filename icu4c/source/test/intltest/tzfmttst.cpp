@@ -86,6 +86,7 @@ TimeZoneFormatTest::runIndexedTest( int32_t index, UBool exec, const char* &name
         TESTCASE(6, TestFormatCustomZone);
         TESTCASE(7, TestFormatTZDBNamesAllZoneCoverage);
         TESTCASE(8, TestAdoptDefaultThreadSafe);
+        TESTCASE(9, TestFindIncrementallyLoadedNames);
     default: name = ""; break;
     }
 }
@@ -1338,4 +1339,48 @@ TimeZoneFormatTest::TestFormatTZDBNamesAllZoneCoverage(void) {
         }
     }
 }
+
+// Names loaded for formatting one zone at a time must be found by parsing
+// in between, while the name trie is rebuilt from the added names.
+void
+TimeZoneFormatTest::TestFindIncrementallyLoadedNames(void) {
+    static const char* const TZIDS[] = {
+        "America/Los_Angeles", "Europe/Paris", "Asia/Tokyo", "Australia/Sydney",
+        "America/Sao_Paulo", "Africa/Nairobi", "Asia/Kolkata", "Pacific/Auckland",
+        "America/Halifax", "Europe/Moscow", 0
+    };
+    const UDate date = 1358208000000.0; // 2013-01-15T00:00:00Z
+    UErrorCode status = U_ZERO_ERROR;
+    LocalPointer<TimeZoneNames> tzn(TimeZoneNames::createInstance(Locale("de"), status));
+    if (U_FAILURE(status)) {
+        dataerrln("TimeZoneNames::createInstance failed: %s", u_errorName(status));
+        return;
+    }
+    for (int32_t i = 0; TZIDS[i] != 0; i++) {
+        UnicodeString tzid(TZIDS[i], -1, US_INV);
+        UnicodeString mzid, name;
+        tzn->getMetaZoneID(tzid, date, mzid);
+        tzn->getDisplayName(tzid, UTZNM_LONG_STANDARD, date, name);
+        if (mzid.isEmpty() || name.isEmpty()) {
+            dataerrln(UnicodeString("No long standard name for ") + tzid);
+            continue;
+        }
+        LocalPointer<TimeZoneNames::MatchInfoCollection> matches(
+            tzn->find(name, 0, UTZNM_LONG_STANDARD, status));
+        if (U_FAILURE(status) || matches.isNull()) {
+            errln(UnicodeString("Fail: no match for ") + name + " - " + u_errorName(status));
+            status = U_ZERO_ERROR;
+            continue;
+        }
+        UBool found = FALSE;
+        for (int32_t j = 0; j < matches->size(); j++) {
+            UnicodeString matchedID;
+            if (matches->getMatchLengthAt(j) == name.length()
+                    && matches->getMetaZoneIDAt(j, matchedID) && matchedID == mzid) {
+                found = TRUE;
+            }
+        }
+        assertTrue(UnicodeString("Found ") + name + " for " + tzid, found);
+    }
+}
 #endif /* #if !UCONFIG_NO_FORMATTING */
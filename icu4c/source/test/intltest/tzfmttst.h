@@ -30,6 +30,7 @@ class TimeZoneFormatTest : public IntlTest {
     void TestFormatCustomZone(void);
     void TestFormatTZDBNamesAllZoneCoverage(void);
     void TestAdoptDefaultThreadSafe(void);
+    void TestFindIncrementallyLoadedNames(void);
 
     void RunTimeRoundTripTests(int32_t threadNumber);
     void RunAdoptDefaultThreadSafeTests(int32_t threadNumber);
@@ -17,6 +17,8 @@
 #include "unicode/resbund.h"
 #include "unicode/strenum.h"
 #include "unicode/uversion.h"
+#include "unicode/tzrule.h"
+#include "unicode/tztrans.h"
 #include "tztest.h"
 #include "cmemory.h"
 #include "putilimp.h"
@@ -75,6 +77,8 @@ void TimeZoneTest::runIndexedTest( int32_t index, UBool exec, const char* &name,
     TESTCASE_AUTO(TestGetGMT);
     TESTCASE_AUTO(TestGetWindowsID);
     TESTCASE_AUTO(TestGetIDForWindowsID);
+    TESTCASE_AUTO(TestHistoricalOffsetLookup);
+    TESTCASE_AUTO(TestSharedZoneData);
     TESTCASE_AUTO_END;
 }
 
@@ -2488,4 +2492,110 @@ void TimeZoneTest::TestGetIDForWindowsID(void) {
     }
 }
 
+/*
+ * Walks all transitions of zones with many (or unusual) transitions and
+ * makes sure getOffset reports the offsets on both sides of each one.
+ */
+void TimeZoneTest::TestHistoricalOffsetLookup() {
+    static const char* const ZONES[] = {
+        "America/New_York", "Europe/London", "Europe/Paris", "Asia/Kolkata",
+        "Australia/Lord_Howe", "Pacific/Apia", "America/Sao_Paulo", "Africa/Casablanca",
+        0
+    };
+    const UDate start = -3786825600000.0;   // 1850-01-01T00:00Z
+    const UDate limit = 4417977600000.0;    // 2110-01-01T00:00Z
+
+    for (int32_t i = 0; ZONES[i] != 0; i++) {
+        LocalPointer<BasicTimeZone> tz(
+            dynamic_cast<BasicTimeZone*>(TimeZone::createTimeZone(ZONES[i])));
+        if (tz.isNull()) {
+            errln(UnicodeString("Fail: cannot create BasicTimeZone ") + ZONES[i]);
+            continue;
+        }
+        TimeZoneTransition trans;
+        UDate t = start;
+        int32_t count = 0;
+        while (t < limit && tz->getNextTransition(t, FALSE, trans)) {
+            t = trans.getTime();
+            UErrorCode status = U_ZERO_ERROR;
+            int32_t raw, dst;
+            tz->getOffset(t - 1.0, FALSE, raw, dst, status);
+            if (U_FAILURE(status) || raw != trans.getFrom()->getRawOffset()
+                    || dst != trans.getFrom()->getDSTSavings()) {
+                errln(UnicodeString("Fail: ") + ZONES[i] + " offset before transition at "
+                    + t + " is " + raw + "/" + dst);
+            }
+            tz->getOffset(t, FALSE, raw, dst, status);
+            if (U_FAILURE(status) || raw != trans.getTo()->getRawOffset()
+                    || dst != trans.getTo()->getDSTSavings()) {
+                errln(UnicodeString("Fail: ") + ZONES[i] + " offset at transition "
+                    + t + " is " + raw + "/" + dst);
+            }
+            // Local time well after the transition resolves to the new offset
+            int32_t toOffset = trans.getTo()->getRawOffset() + trans.getTo()->getDSTSavings();
+            tz->getOffset(t + toOffset + 2.0 * U_MILLIS_PER_HOUR + 1.0, TRUE, raw, dst, status);
+            if (U_FAILURE(status) || raw + dst != toOffset) {
+                errln(UnicodeString("Fail: ") + ZONES[i] + " local offset after transition "
+                    + t + " is " + raw + "/" + dst);
+            }
+            count++;
+        }
+        if (count == 0) {
+            errln(UnicodeString("Fail: no transitions in ") + ZONES[i]);
+        }
+    }
+}
+
+/*
+ * Zones created for the same ID share their data, but must still behave
+ * as independent objects with their own ID and canonical ID.
+ */
+void TimeZoneTest::TestSharedZoneData() {
+    static const char* const TESTDATA[][2] = {
+        // ID, canonical ID
+        {"America/Los_Angeles", "America/Los_Angeles"},
+        {"US/Pacific",          "America/Los_Angeles"},
+        {"Asia/Calcutta",       "Asia/Calcutta"},
+        {"Asia/Kolkata",        "Asia/Calcutta"},
+        {0, 0}
+    };
+    const UDate date = 1561939200000.0; // 2019-07-01T00:00Z
+
+    for (int32_t i = 0; TESTDATA[i][0] != 0; i++) {
+        UnicodeString id(TESTDATA[i][0], -1, US_INV);
+        LocalPointer<TimeZone> tz1(TimeZone::createTimeZone(id));
+        LocalPointer<TimeZone> tz2(TimeZone::createTimeZone(id));
+        OlsonTimeZone *otz = dynamic_cast<OlsonTimeZone *>(tz2.getAlias());
+        if (otz == NULL) {
+            errln(UnicodeString("Fail: not an OlsonTimeZone: ") + id);
+            continue;
+        }
+        UnicodeString tmp;
+        assertEquals(id + " ID", id, tz2->getID(tmp));
+        assertEquals(id + " canonical ID", UnicodeString(TESTDATA[i][1], -1, US_INV),
+            UnicodeString(otz->getCanonicalID()));
+        assertTrue(id + " equal instances", *tz1 == *tz2);
+
+        // Changing the ID of one instance must not affect another
+        LocalPointer<TimeZone> clone(tz2->clone());
+        clone->setID(UNICODE_STRING_SIMPLE("Bogus/Zone"));
+        assertEquals(id + " ID after cloning", id, tz2->getID(tmp));
+        assertTrue(id + " same rules as clone", tz2->hasSameRules(*clone));
+
+        UErrorCode status = U_ZERO_ERROR;
+        int32_t raw1, dst1, raw2, dst2;
+        tz1->getOffset(date, FALSE, raw1, dst1, status);
+        clone->getOffset(date, FALSE, raw2, dst2, status);
+        assertSuccess(id + " getOffset", status);
+        assertEquals(id + " raw offset", raw1, raw2);
+        assertEquals(id + " dst offset", dst1, dst2);
+
+        // The assignment operator shares the data of the source zone
+        LocalPointer<TimeZone> other(TimeZone::createTimeZone(UNICODE_STRING_SIMPLE("Europe/Paris")));
+        OlsonTimeZone *otherOlson = dynamic_cast<OlsonTimeZone *>(other.getAlias());
+        *otherOlson = *otz;
+        assertTrue(id + " same rules after assignment", otherOlson->hasSameRules(*tz1));
+    }
+}
+
 #endif /* #if !UCONFIG_NO_FORMATTING */
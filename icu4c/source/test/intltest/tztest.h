@@ -104,6 +104,9 @@ class TimeZoneTest: public CalendarTimeZoneTest {
     void TestGetWindowsID(void);
     void TestGetIDForWindowsID(void);
 
+    void TestHistoricalOffsetLookup(void);
+    void TestSharedZoneData(void);
+
     static const UDate INTERVAL;
 
 private:
@@ -134,6 +134,34 @@ void UCharsTrieTest::TestBuilder() {
         errln("UCharsTrieBuilder.add() did not detect duplicates");
         return;
     }
+    // Strings added in order are not sorted, but duplicates must still be detected.
+    builder_->clear();
+    builder_->add("a", 0, errorCode).add("b", 1, errorCode).add("b", 2, errorCode).
+        build(USTRINGTRIE_BUILD_FAST, errorCode);
+    if(errorCode.reset()!=U_ILLEGAL_ARGUMENT_ERROR) {
+        errln("UCharsTrieBuilder.add() did not detect duplicates after in-order strings");
+        return;
+    }
+    // Adding strings in order must yield the same trie as adding them out of order.
+    static const char *const strings[]={ "", "a", "ab", "abc", "b", "ba", "bc", "cdefg" };
+    UnicodeString inOrder, outOfOrder;
+    builder_->clear();
+    for(int32_t i=0; i<UPRV_LENGTHOF(strings); ++i) {
+        builder_->add(strings[i], i, errorCode);
+    }
+    builder_->buildUnicodeString(USTRINGTRIE_BUILD_SMALL, inOrder, errorCode);
+    builder_->clear();
+    for(int32_t i=UPRV_LENGTHOF(strings); i>0;) {
+        --i;
+        builder_->add(strings[i], i, errorCode);
+    }
+    builder_->buildUnicodeString(USTRINGTRIE_BUILD_SMALL, outOfOrder, errorCode);
+    if(errorCode.errIfFailureAndReset("in-order vs. out-of-order add()")) {
+        return;
+    }
+    if(inOrder!=outOfOrder) {
+        errln("UCharsTrieBuilder: in-order add() yields a different trie than out-of-order add()");
+    }
 }
 
 void UCharsTrieTest::TestEmpty() {
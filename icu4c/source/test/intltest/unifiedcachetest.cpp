@@ -14,6 +14,7 @@
 #include "intltest.h"
 #include "unifiedcache.h"
 #include "unicode/datefmt.h"
+#include "unicode/udata.h"
 
 class UCTItem : public SharedObject {
   public:
@@ -24,11 +25,25 @@ class UCTItem : public SharedObject {
     virtual ~UCTItem() {
         uprv_free(value);
     }
+    virtual int32_t getMemoryFootprint() const {
+        return 1000;
+    }
 };
 
 class UCTItem2 : public SharedObject {
 };
 
+// Holds a reference to another cached item, like a cached Calendar
+// holding the cached data of its time zone.
+class UCTItem3 : public SharedObject {
+  public:
+    const UCTItem *ref;
+    UCTItem3() : ref(NULL) {}
+    virtual ~UCTItem3() {
+        SharedObject::clearPtr(ref);
+    }
+};
+
 U_NAMESPACE_BEGIN
 
 template<> U_EXPORT
@@ -62,6 +77,17 @@ const UCTItem2 *LocaleCacheKey<UCTItem2>::createObject(
     return NULL;
 }
 
+template<> U_EXPORT
+const UCTItem3 *LocaleCacheKey<UCTItem3>::createObject(
+        const void *context, UErrorCode &status) const {
+    const UnifiedCache *cacheContext = (const UnifiedCache *) context;
+    UCTItem3 *result = new UCTItem3();
+    cacheContext->get(
+            LocaleCacheKey<UCTItem>(fLoc.getName()), cacheContext, result->ref, status);
+    result->addRef();
+    return result;
+}
+
 U_NAMESPACE_END
 
 
@@ -77,6 +103,12 @@ class UnifiedCacheTest : public IntlTest {
     void TestError();
     void TestHashEquals();
     void TestEvictionUnderStress();
+    void TestSharded();
+    void TestHotHits();
+    void TestMemoryBudget();
+    void TestStats();
+    void TestDataEpoch();
+    void TestNestedRelease();
 };
 
 void UnifiedCacheTest::runIndexedTest(int32_t index, UBool exec, const char* &name, char* /*par*/) {
@@ -87,6 +119,12 @@ void UnifiedCacheTest::runIndexedTest(int32_t index, UBool exec, const char* &na
   TESTCASE_AUTO(TestError);
   TESTCASE_AUTO(TestHashEquals);
   TESTCASE_AUTO(TestEvictionUnderStress);
+  TESTCASE_AUTO(TestSharded);
+  TESTCASE_AUTO(TestHotHits);
+  TESTCASE_AUTO(TestMemoryBudget);
+  TESTCASE_AUTO(TestStats);
+  TESTCASE_AUTO(TestDataEpoch);
+  TESTCASE_AUTO(TestNestedRelease);
   TESTCASE_AUTO_END;
 }
 
@@ -396,6 +434,271 @@ void UnifiedCacheTest::TestHashEquals() {
     assertTrue("", diffKey1 != diffKey2);
 }
 
+void UnifiedCacheTest::TestSharded() {
+    UErrorCode status = U_ZERO_ERROR;
+    UnifiedCache::getInstance(status);
+
+    UnifiedCache badCache(0, status);
+    assertEquals("T0", U_ILLEGAL_ARGUMENT_ERROR, status);
+    status = U_ZERO_ERROR;
+
+    // Private instance so that the counts below are not disturbed.
+    UnifiedCache cache(8, status);
+    assertSuccess("T1", status);
+    assertEquals("T2", 8, cache.shardCount());
+
+    static const char *languages[] = {
+            "en", "fr", "de", "es", "it", "ja", "ko", "ru", "sr", "pt"};
+    const UCTItem *items[UPRV_LENGTHOF(languages)] = {};
+    const UCTItem *regional[UPRV_LENGTHOF(languages)] = {};
+
+    // The language keys and the regional keys that resolve to them will
+    // typically be spread across different shards.
+    for (int32_t i = 0; i < UPRV_LENGTHOF(languages); ++i) {
+        char regionalName[8];
+        uprv_strcpy(regionalName, languages[i]);
+        uprv_strcat(regionalName, "_AA");
+        cache.get(LocaleCacheKey<UCTItem>(regionalName), &cache, regional[i], status);
+        cache.get(LocaleCacheKey<UCTItem>(languages[i]), &cache, items[i], status);
+    }
+    assertSuccess("T3", status);
+    for (int32_t i = 0; i < UPRV_LENGTHOF(languages); ++i) {
+        if (items[i] != regional[i]) {
+            errln("T4: Expected %s and %s_AA to resolve to the same object.",
+                  languages[i], languages[i]);
+        }
+    }
+    assertEquals("T5", 2 * UPRV_LENGTHOF(languages), cache.keyCount());
+    assertEquals("T6", UPRV_LENGTHOF(languages), cache.unusedCount());
+
+    // Non-master keys are flushed, the masters are still referenced.
+    cache.flush();
+    assertEquals("T7", UPRV_LENGTHOF(languages), cache.keyCount());
+    assertEquals("T8", 0, cache.unusedCount());
+
+    for (int32_t i = 0; i < UPRV_LENGTHOF(languages); ++i) {
+        SharedObject::clearPtr(items[i]);
+        SharedObject::clearPtr(regional[i]);
+    }
+    cache.flush();
+    assertEquals("T9", 0, cache.keyCount());
+}
+
+void UnifiedCacheTest::TestHotHits() {
+    UErrorCode status = U_ZERO_ERROR;
+    UnifiedCache::getInstance(status);
+    UnifiedCache cache(status);
+    assertSuccess("T0", status);
+
+    // Evict as soon as anything is unused.
+    cache.setEvictionPolicy(0, 0, status);
+
+    // Repeated hits are served without the lock but must keep the same
+    // reference and in-use accounting as the locked path.
+    const UCTItem *en = NULL;
+    const UCTItem *en2 = NULL;
+    const UCTItem *en3 = NULL;
+    cache.get(LocaleCacheKey<UCTItem>("en"), &cache, en, status);
+    cache.get(LocaleCacheKey<UCTItem>("en"), &cache, en2, status);
+    cache.get(LocaleCacheKey<UCTItem>("en"), &cache, en3, status);
+    assertSuccess("T1", status);
+    if (en != en2 || en != en3) {
+        errln("T2: Expected repeated hits to return the same object.");
+    }
+    assertEquals("T3", 1, cache.keyCount());
+    assertEquals("T4", 0, cache.unusedCount());
+    SharedObject::clearPtr(en2);
+    SharedObject::clearPtr(en3);
+    assertEquals("T5", 1, cache.keyCount());
+
+    // Dropping the last reference makes the hot entry evictable.
+    SharedObject::clearPtr(en);
+    assertEquals("T6", 0, cache.keyCount());
+
+    // A new value replaces the evicted one.
+    cache.get(LocaleCacheKey<UCTItem>("en"), &cache, en, status);
+    assertEquals("T7", 1, cache.keyCount());
+    assertTrue("T8", en != NULL && uprv_strcmp(en->value, "en") == 0);
+    SharedObject::clearPtr(en);
+    assertEquals("T9", 0, cache.keyCount());
+    assertSuccess("T10", status);
+}
+
+void UnifiedCacheTest::TestMemoryBudget() {
+    UErrorCode status = U_ZERO_ERROR;
+    UnifiedCache::getInstance(status);
+    UnifiedCache cache(status);
+    assertSuccess("T0", status);
+
+    cache.setMemoryBudget(-1, status);
+    assertEquals("T1", U_ILLEGAL_ARGUMENT_ERROR, status);
+    status = U_ZERO_ERROR;
+
+    // The count based policy alone would keep everything here.
+    cache.setEvictionPolicy(1000, 100, status);
+    // Each UCTItem reports 1000 bytes.
+    cache.setMemoryBudget(3500, status);
+    assertSuccess("T2", status);
+
+    const UCTItem *held = NULL;
+    cache.get(LocaleCacheKey<UCTItem>("en"), &cache, held, status);
+    assertEquals("T3", (int64_t)1000, cache.memoryFootprint());
+
+    static const char *locales[] = {
+            "1", "2", "3", "4", "5", "6", "7", "8", "9", "10"};
+    for (int32_t i = 0; i < UPRV_LENGTHOF(locales); ++i) {
+        const UCTItem *item = NULL;
+        cache.get(LocaleCacheKey<UCTItem>(locales[i]), &cache, item, status);
+        SharedObject::clearPtr(item);
+        if (cache.memoryFootprint() > 3500) {
+            errln("T4: Cache exceeds memory budget: %ld bytes",
+                  (long)cache.memoryFootprint());
+        }
+    }
+    assertSuccess("T5", status);
+
+    // The value in use was never evicted.
+    const UCTItem *en = NULL;
+    cache.get(LocaleCacheKey<UCTItem>("en"), &cache, en, status);
+    if (en != held) {
+        errln("T6: Expected en to resolve to the same object.");
+    }
+    SharedObject::clearPtr(en);
+
+    // A budget smaller than the values in use cannot be honored.
+    cache.setMemoryBudget(500, status);
+    cache.flush();
+    assertEquals("T7", (int64_t)1000, cache.memoryFootprint());
+    SharedObject::clearPtr(held);
+    assertEquals("T8", (int64_t)0, cache.memoryFootprint());
+    assertEquals("T9", 0, cache.keyCount());
+}
+
+void UnifiedCacheTest::TestStats() {
+    UErrorCode status = U_ZERO_ERROR;
+    UnifiedCache::getInstance(status);
+    UnifiedCache cache(status);
+    assertSuccess("T0", status);
+
+    // en_US misses and creates en through a nested lookup: 2 misses.
+    // Both en lookups below hit.
+    const UCTItem *enUs = NULL;
+    const UCTItem *en = NULL;
+    cache.get(LocaleCacheKey<UCTItem>("en_US"), &cache, enUs, status);
+    cache.get(LocaleCacheKey<UCTItem>("en"), &cache, en, status);
+    cache.get(LocaleCacheKey<UCTItem>("en"), &cache, en, status);
+    assertSuccess("T1", status);
+
+    UCacheStats stats;
+    cache.getStats(stats);
+    assertEquals("T2", (int64_t)2, stats.misses);
+    assertEquals("T3", (int64_t)2, stats.hits);
+    assertTrue("T4", stats.hitsWithoutLock <= stats.hits);
+    assertEquals("T5", (int64_t)0, stats.inProgressWaits);
+    assertEquals("T6", 2, stats.keyCount);
+    assertEquals("T7", 1, stats.unusedCount);
+    assertEquals("T8", (int64_t)1000, stats.memoryFootprint);
+
+    UCacheKeyTypeStats types[2];
+    int32_t typeCount = cache.getKeyTypeStats(types, 0, status);
+    assertEquals("T9", U_BUFFER_OVERFLOW_ERROR, status);
+    assertEquals("T10", 1, typeCount);
+    status = U_ZERO_ERROR;
+    typeCount = cache.getKeyTypeStats(types, UPRV_LENGTHOF(types), status);
+    assertSuccess("T11", status);
+    assertEquals("T12", 1, typeCount);
+    assertEquals("T13", 2, types[0].keyCount);
+    assertEquals("T14", (int64_t)1000, types[0].memoryFootprint);
+    assertEquals("T15", typeid(LocaleCacheKey<UCTItem>).name(), types[0].typeName);
+
+    SharedObject::clearPtr(enUs);
+    SharedObject::clearPtr(en);
+}
+
+// A data overlay with an item name that is not in the ICU data.
+// The overlay must stay valid until u_cleanup().
+static const struct {
+    uint16_t headerSize;
+    uint8_t magic1, magic2;
+    UDataInfo info;
+    char padding[8];
+    uint32_t count, reserved;
+    struct {
+        const char *name;
+        const void *data;
+    } toc[1];
+} gUnifiedCacheTestOverlay = {
+    32, 0xda, 0x27,
+    {
+        sizeof(UDataInfo), 0,
+        U_IS_BIG_ENDIAN, U_CHARSET_FAMILY, U_SIZEOF_UCHAR, 0,
+        {0x54, 0x6f, 0x43, 0x50},  // dataFormat="ToCP"
+        {1, 0, 0, 0},
+        {0, 0, 0, 0}
+    },
+    {0, 0, 0, 0, 0, 0, 0, 0},
+    1, 0,
+    {
+        { U_ICUDATA_NAME "/unifiedcachetest.icu", &gUnifiedCacheTestOverlay }
+    }
+};
+
+void UnifiedCacheTest::TestDataEpoch() {
+    UErrorCode status = U_ZERO_ERROR;
+    UnifiedCache::getInstance(status);
+    UnifiedCache cache(status);
+    assertSuccess("T0", status);
+
+    const UCTItem *en = NULL;
+    const UCTItem *en2 = NULL;
+    LocaleCacheKey<UCTItem> oldKey("en");
+    cache.get(oldKey, &cache, en, status);
+    udata_publishOverlay(&gUnifiedCacheTestOverlay, &status);
+    assertSuccess("T1", status);
+
+    // Objects of the previous data epoch are not found any more.
+    LocaleCacheKey<UCTItem> newKey("en");
+    assertTrue("T2", oldKey == newKey && !oldKey.isSameDataEpoch(newKey));
+    cache.get(newKey, &cache, en2, status);
+    assertSuccess("T3", status);
+    assertTrue("T4", en != NULL && en2 != NULL && en != en2);
+    assertEquals("T5", 2, cache.keyCount());
+
+    // The stale object is evicted like any other unused one.
+    SharedObject::clearPtr(en);
+    cache.flush();
+    assertEquals("T6", 1, cache.keyCount());
+    cache.get(LocaleCacheKey<UCTItem>("en"), &cache, en, status);
+    assertTrue("T7", en == en2);
+    SharedObject::clearPtr(en);
+    SharedObject::clearPtr(en2);
+    cache.flush();
+    assertEquals("T8", 0, cache.keyCount());
+}
+
+void UnifiedCacheTest::TestNestedRelease() {
+    UErrorCode status = U_ZERO_ERROR;
+    UnifiedCache::getInstance(status);
+    // One shard, so that both items of each pair are in the same one.
+    UnifiedCache cache(1, status);
+    assertSuccess("T0", status);
+    cache.setEvictionPolicy(0, 0, status);
+
+    // Evicting an item3 releases the last reference to its item, whose entry
+    // then has to be updated in the shard that evicted the item3.
+    static const char *languages[] = {"en", "fr", "de", "es", "it", "ja"};
+    for (int32_t i = 0; i < UPRV_LENGTHOF(languages); ++i) {
+        const UCTItem3 *item = NULL;
+        cache.get(LocaleCacheKey<UCTItem3>(languages[i]), &cache, item, status);
+        assertTrue("T1", item != NULL && item->ref != NULL);
+        SharedObject::clearPtr(item);
+    }
+    assertSuccess("T2", status);
+    assertEquals("T3", 0, cache.unusedCount());
+    cache.flush();
+    assertEquals("T4", 0, cache.keyCount());
+}
+
 extern IntlTest *createUnifiedCacheTest() {
     return new UnifiedCacheTest();
 }
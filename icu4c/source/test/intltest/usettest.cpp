@@ -19,6 +19,7 @@
 #include "unicode/ucnv.h"
 #include "unicode/uniset.h"
 #include "unicode/uchar.h"
+#include "unicode/uscript.h"
 #include "unicode/usetiter.h"
 #include "unicode/ustring.h"
 #include "unicode/parsepos.h"
@@ -92,6 +93,10 @@ UnicodeSetTest::runIndexedTest(int32_t index, UBool exec,
     TESTCASE_AUTO(TestIntOverflow);
     TESTCASE_AUTO(TestUnusedCcc);
     TESTCASE_AUTO(TestDeepPattern);
+    TESTCASE_AUTO(TestSpanLongRuns);
+    TESTCASE_AUTO(TestFrozenTrie);
+    TESTCASE_AUTO(TestSerializeFrozen);
+    TESTCASE_AUTO(TestCachedPropertyValueSets);
     TESTCASE_AUTO_END;
 }
 
@@ -3978,3 +3983,214 @@ void UnicodeSetTest::TestDeepPattern() {
     assertTrue("[a[a[a...1000s...]]] -> error", errorCode.isFailure());
     errorCode.reset();
 }
+
+void UnicodeSetTest::TestSpanLongRuns() {
+    // Frozen sets span runs of ASCII and Latin-1 characters several at a time.
+    // Check that they stop at the right character wherever it is in such a run,
+    // for sets with all, none, or some of those characters.
+    IcuTestErrorCode errorCode(*this, "TestSpanLongRuns");
+    static const char16_t *const patterns[] = {
+        u"[\\u0000-\\u007F]", u"[\\u0000-\\u00FF]", u"[:Han:]", u"[a-z]",
+        u"[a-z\\u00C0-\\u00CF]", u"[^<\\&]", u"[\\u0000-\\U0010FFFF]"
+    };
+    static const char16_t runStarts[] = { u'a', 0xc0 };
+    static const char16_t stops[] = { u'a', u'<', 0x7f, 0xe9, 0x4e2d };
+    for (int32_t i = 0; i < UPRV_LENGTHOF(patterns); ++i) {
+        UnicodeSet set(patterns[i], errorCode);
+        if (errorCode.errIfFailureAndReset("UnicodeSet(patterns[%d])", (int)i)) {
+            continue;
+        }
+        UnicodeSet frozen(set);
+        frozen.freeze();
+        for (int32_t condition = USET_SPAN_NOT_CONTAINED; condition <= USET_SPAN_CONTAINED; ++condition) {
+            USetSpanCondition spanCondition = (USetSpanCondition)condition;
+            for (int32_t r = 0; r < UPRV_LENGTHOF(runStarts); ++r) {
+                for (int32_t j = 0; j < UPRV_LENGTHOF(stops); ++j) {
+                    for (int32_t length = 70; length >= 0; --length) {
+                        UnicodeString s;
+                        for (int32_t k = 0; k < length; ++k) {
+                            s.append((char16_t)(runStarts[r] + k % 26));
+                        }
+                        s.append(stops[j]).append(u"bc");
+                        std::string s8;
+                        s.toUTF8String(s8);
+                        if (set.span(s.getBuffer(), s.length(), spanCondition) !=
+                                    frozen.span(s.getBuffer(), s.length(), spanCondition) ||
+                                set.spanUTF8(s8.data(), (int32_t)s8.length(), spanCondition) !=
+                                    frozen.spanUTF8(s8.data(), (int32_t)s8.length(), spanCondition)) {
+                            errln(UnicodeString(u"frozen ") + patterns[i] + u".span(condition " + condition +
+                                  u") differs for a run of length " + length + u" before U+" +
+                                  toHex(stops[j], 4));
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+void UnicodeSetTest::TestFrozenTrie() {
+    // A frozen set with many ranges looks up code points in a trie
+    // once it has been used for enough long spans.
+    // Check that contains() and the spans give the same results before and after that.
+    IcuTestErrorCode errorCode(*this, "TestFrozenTrie");
+    UnicodeSet set(u"[[:Mn:][:Cn:]-[\\U000E0000-\\U000E0FFF]]", errorCode);
+    if (errorCode.errIfFailureAndReset("UnicodeSet()")) {
+        return;
+    }
+    UnicodeSet frozen(set);
+    frozen.freeze();
+    UnicodeString s;
+    for (UChar32 c = 0x300; c < 0x1e000; c += 0x3b) {
+        s.append(c);
+    }
+    std::string s8;
+    s.toUTF8String(s8);
+    for (int32_t i = 0; i < 300; ++i) {
+        for (int32_t condition = USET_SPAN_NOT_CONTAINED; condition <= USET_SPAN_CONTAINED; ++condition) {
+            USetSpanCondition spanCondition = (USetSpanCondition)condition;
+            int32_t start = i * 7;
+            int32_t length = s.length() - start;
+            if (set.span(s.getBuffer() + start, length, spanCondition) !=
+                        frozen.span(s.getBuffer() + start, length, spanCondition) ||
+                    set.spanBack(s.getBuffer(), length, spanCondition) !=
+                        frozen.spanBack(s.getBuffer(), length, spanCondition) ||
+                    set.spanUTF8(s8.data() + start, (int32_t)s8.length() - start, spanCondition) !=
+                        frozen.spanUTF8(s8.data() + start, (int32_t)s8.length() - start, spanCondition) ||
+                    set.spanBackUTF8(s8.data(), (int32_t)s8.length() - start, spanCondition) !=
+                        frozen.spanBackUTF8(s8.data(), (int32_t)s8.length() - start, spanCondition)) {
+                errln("frozen set span(condition %d) differs at iteration %d", (int)condition, (int)i);
+                return;
+            }
+        }
+    }
+    for (UChar32 c = 0; c <= 0x10ffff; ++c) {
+        if (set.contains(c) != frozen.contains(c)) {
+            errln("frozen set contains(U+%04lX) differs", (long)c);
+            return;
+        }
+    }
+}
+
+void UnicodeSetTest::TestSerializeFrozen() {
+    IcuTestErrorCode errorCode(*this, "TestSerializeFrozen");
+    static const char16_t *const patterns[] = {
+        u"[]",
+        u"[a-zA-Z0-9_]",
+        u"[\\u0000-\\U0010FFFF]",
+        u"[^\\uFFFD]",
+        u"[[:L:][:Nd:]]",
+        u"[\\U00010000-\\U0001FFFF]",
+        u"[[:Mn:][:Cn:]-[\\U000E0000-\\U000E0FFF]]"
+    };
+    UnicodeString s;
+    for (UChar32 c = 0; c < 0x30000; c += 0x35) {
+        s.append(c);
+    }
+    std::string s8;
+    s.toUTF8String(s8);
+    for (const char16_t *pattern : patterns) {
+        errorCode.setScope(pattern);
+        UnicodeSet set(pattern, errorCode);
+        UnicodeSet frozen(set);
+        frozen.freeze();
+        // Serialize both the unfrozen and the frozen set; the tables are the same.
+        uint16_t buffer[3000], frozenBuffer[3000];
+        int32_t length = set.serializeFrozen(nullptr, 0, errorCode);
+        errorCode.expectErrorAndReset(U_BUFFER_OVERFLOW_ERROR);
+        assertEquals("preflighting", length, set.serializeFrozen(buffer, UPRV_LENGTHOF(buffer), errorCode));
+        assertEquals("frozen length", length,
+                     frozen.serializeFrozen(frozenBuffer, UPRV_LENGTHOF(frozenBuffer), errorCode));
+        if (errorCode.errIfFailureAndReset("serializeFrozen()")) {
+            continue;
+        }
+        assertTrue("same serialization", uprv_memcmp(buffer, frozenBuffer, length * 2) == 0);
+
+        UnicodeSet loaded(buffer, length, UnicodeSet::kSerializedFrozen, errorCode);
+        if (errorCode.errIfFailureAndReset("UnicodeSet(kSerializedFrozen)")) {
+            continue;
+        }
+        assertTrue("loaded set is frozen", loaded.isFrozen());
+        assertTrue("loaded set equals the original", loaded == set);
+        for (int32_t condition = USET_SPAN_NOT_CONTAINED; condition <= USET_SPAN_CONTAINED; ++condition) {
+            USetSpanCondition spanCondition = (USetSpanCondition)condition;
+            for (int32_t start = 0; start < s.length(); start += 97) {
+                int32_t length16 = s.length() - start;
+                int32_t length8 = (int32_t)s8.length() - start;
+                if (frozen.span(s.getBuffer() + start, length16, spanCondition) !=
+                            loaded.span(s.getBuffer() + start, length16, spanCondition) ||
+                        frozen.spanBack(s.getBuffer(), length16, spanCondition) !=
+                            loaded.spanBack(s.getBuffer(), length16, spanCondition) ||
+                        frozen.spanUTF8(s8.data() + start, length8, spanCondition) !=
+                            loaded.spanUTF8(s8.data() + start, length8, spanCondition) ||
+                        frozen.spanBackUTF8(s8.data(), length8, spanCondition) !=
+                            loaded.spanBackUTF8(s8.data(), length8, spanCondition)) {
+                    errln(UnicodeString(u"loaded set span() differs for ") + pattern);
+                    break;
+                }
+            }
+        }
+        for (UChar32 c = 0; c <= 0x10ffff; ++c) {
+            if (frozen.contains(c) != loaded.contains(c)) {
+                errln(UnicodeString(u"loaded set contains() differs for ") + pattern);
+                break;
+            }
+        }
+
+        // The tables must be complete.
+        UnicodeSet truncated(buffer, length - 1, UnicodeSet::kSerializedFrozen, errorCode);
+        errorCode.expectErrorAndReset(U_ILLEGAL_ARGUMENT_ERROR);
+        assertTrue("truncated set is bogus", truncated.isBogus());
+    }
+    errorCode.setScope("");
+    UnicodeSet withStrings(u"[a-z{ch}]", errorCode);
+    uint16_t buffer[1000];
+    withStrings.serializeFrozen(buffer, UPRV_LENGTHOF(buffer), errorCode);
+    errorCode.expectErrorAndReset(U_UNSUPPORTED_ERROR);
+}
+
+void UnicodeSetTest::TestCachedPropertyValueSets() {
+    // applyIntPropertyValue() caches the sets for property values;
+    // repeated and modified results must match the property data.
+    IcuTestErrorCode errorCode(*this, "TestCachedPropertyValueSets");
+    static const struct {
+        UProperty prop;
+        int32_t value;
+    } cases[] = {
+        { UCHAR_GENERAL_CATEGORY_MASK, U_GC_L_MASK },
+        { UCHAR_GENERAL_CATEGORY_MASK, U_GC_LU_MASK | U_GC_ND_MASK },
+        { UCHAR_GENERAL_CATEGORY, U_LOWERCASE_LETTER },
+        { UCHAR_SCRIPT, USCRIPT_GREEK },
+        { UCHAR_SCRIPT_EXTENSIONS, USCRIPT_ARABIC },
+        { UCHAR_LINE_BREAK, U_LB_ALPHABETIC },
+        { UCHAR_CANONICAL_COMBINING_CLASS, 230 }
+    };
+    for (int32_t i = 0; i < UPRV_LENGTHOF(cases); ++i) {
+        UProperty prop = cases[i].prop;
+        int32_t value = cases[i].value;
+        for (int32_t pass = 0; pass < 2; ++pass) {
+            UnicodeSet set;
+            set.applyIntPropertyValue(prop, value, errorCode);
+            if (errorCode.errIfFailureAndReset("applyIntPropertyValue(%d, %d)", prop, value)) {
+                break;
+            }
+            for (UChar32 c = 0; c <= 0x10ffff; ++c) {
+                UBool expected;
+                if (prop == UCHAR_GENERAL_CATEGORY_MASK) {
+                    expected = (U_GET_GC_MASK(c) & value) != 0;
+                } else if (prop == UCHAR_SCRIPT_EXTENSIONS) {
+                    expected = uscript_hasScript(c, (UScriptCode)value);
+                } else {
+                    expected = u_getIntPropertyValue(c, prop) == value;
+                }
+                if (set.contains(c) != expected) {
+                    errln("applyIntPropertyValue(%d, %d) pass %d wrong for U+%04lX",
+                          prop, value, pass, (long)c);
+                    break;
+                }
+            }
+            // Modifying the result must not affect the next one.
+            set.complement();
+        }
+    }
+}
@@ -94,6 +94,10 @@ class UnicodeSetTest: public IntlTest {
     void TestIntOverflow();
     void TestUnusedCcc();
     void TestDeepPattern();
+    void TestSpanLongRuns();
+    void TestFrozenTrie();
+    void TestSerializeFrozen();
+    void TestCachedPropertyValueSets();
 
 private:
 
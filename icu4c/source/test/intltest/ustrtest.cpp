@@ -67,6 +67,7 @@ void UnicodeStringTest::runIndexedTest( int32_t index, UBool exec, const char* &
     TESTCASE_AUTO(TestWCharPointers);
     TESTCASE_AUTO(TestNullPointers);
     TESTCASE_AUTO(TestUnicodeStringInsertAppendToSelf);
+    TESTCASE_AUTO(TestCompareLongStrings);
     TESTCASE_AUTO_END;
 }
 
@@ -2310,3 +2311,40 @@ void UnicodeStringTest::TestUnicodeStringInsertAppendToSelf() {
     str.insert(2, sub);
     assertEquals("", u"abbcdcde", str);
 }
+
+void UnicodeStringTest::TestCompareLongStrings() {
+    // Comparisons skip identical prefixes several code units at a time.
+    // Put the first difference at every position and alignment,
+    // with units where code point order differs from code unit order.
+    // The last unit is never replaced, so that the surrogate pair is not cut off.
+    UnicodeString base;
+    for (int32_t i = 0; i < 40; ++i) {
+        base.append((UChar)(0x61 + i % 26));
+    }
+    static const UChar pair[] = { 0xd800, 0xdc00 };
+    for (int32_t offset = 0; offset < 4; ++offset) {
+        for (int32_t i = offset; i < base.length() - 1; ++i) {
+            UnicodeString s1(base), s2(base);
+            s1.setCharAt(i, 0xff61);
+            s2.replace(i, 1, pair, 2);
+            int32_t length = s1.length() - offset;
+            // U+FF61 > U+D800 in code unit order, but U+FF61 < U+10000 in code point order.
+            if (s1.compare(offset, length, s2, offset, length) <= 0 ||
+                    u_memcmp(s1.getBuffer() + offset, s2.getBuffer() + offset, length) <= 0) {
+                errln("code unit order comparison wrong at offset %d index %d", (int)offset, (int)i);
+            }
+            if (s1.compareCodePointOrder(offset, length, s2, offset, length) >= 0 ||
+                    u_memcmpCodePointOrder(s1.getBuffer() + offset, s2.getBuffer() + offset,
+                                           length) >= 0) {
+                errln("code point order comparison wrong at offset %d index %d", (int)offset, (int)i);
+            }
+            // Identical up to the shorter length.
+            if (base.compare(offset, i - offset, s1, offset, i - offset) != 0 ||
+                    base.compareCodePointOrder(offset, i - offset, s2, offset, i - offset) != 0 ||
+                    base.compare(offset, length, s1, offset, i - offset) <= 0) {
+                errln("comparison of an identical prefix wrong at offset %d index %d",
+                      (int)offset, (int)i);
+            }
+        }
+    }
+}
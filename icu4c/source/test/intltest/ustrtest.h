@@ -97,6 +97,7 @@ class UnicodeStringTest: public IntlTest {
     void TestWCharPointers();
     void TestNullPointers();
     void TestUnicodeStringInsertAppendToSelf();
+    void TestCompareLongStrings();
 };
 
 #endif
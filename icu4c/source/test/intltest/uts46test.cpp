@@ -29,6 +29,7 @@
 #include "charstr.h"
 #include "cmemory.h"
 #include "intltest.h"
+#include "punycode.h"
 #include "uparse.h"
 
 class UTS46Test : public IntlTest {
@@ -41,6 +42,7 @@ class UTS46Test : public IntlTest {
     void TestNotSTD3();
     void TestSomeCases();
     void IdnaTest();
+    void TestPunycodeUTF8();
 
     void checkIdnaTestResult(const char *line, const char *type,
                              const UnicodeString &expected, const UnicodeString &result,
@@ -84,6 +86,7 @@ void UTS46Test::runIndexedTest(int32_t index, UBool exec, const char *&name, cha
     TESTCASE_AUTO(TestNotSTD3);
     TESTCASE_AUTO(TestSomeCases);
     TESTCASE_AUTO(IdnaTest);
+    TESTCASE_AUTO(TestPunycodeUTF8);
     TESTCASE_AUTO_END;
 }
 
@@ -1044,4 +1047,59 @@ void UTS46Test::IdnaTest() {
     }
 }
 
+void UTS46Test::TestPunycodeUTF8() {
+    IcuTestErrorCode errorCode(*this, "TestPunycodeUTF8");
+    static const char16_t *const labels[] = {
+        u"abc",
+        u"\u00FC",
+        u"abschlu\u00DFpr\u00FCfung",
+        u"\u0644\u064A\u0647\u0645\u0627\u0628\u062A\u0643\u0644\u0645\u0648\u0634\u0639\u0631\u0628\u064A\u061F",
+        u"3\u5E74B\u7D44\u91D1\u516B\u5148\u751F",
+        u"a\U0001F600b\U0001F600\U00010400c",
+        u"\U0010FFFF\u0080-\uFFFD"
+    };
+    for (const char16_t *label : labels) {
+        UnicodeString unicode(label);
+        std::string utf8;
+        unicode.toUTF8String(utf8);
+        errorCode.setScope(utf8.c_str());
+
+        UChar puny16[100];
+        char puny8[100];
+        int32_t length16 = u_strToPunycode(unicode.getBuffer(), unicode.length(),
+                                           puny16, UPRV_LENGTHOF(puny16), NULL, errorCode);
+        int32_t length8 = u_strToPunycodeUTF8(utf8.data(), (int32_t)utf8.length(),
+                                              puny8, UPRV_LENGTHOF(puny8), errorCode);
+        if (errorCode.errIfFailureAndReset("toPunycode")) {
+            continue;
+        }
+        assertEquals("same Punycode", UnicodeString(puny16, length16),
+                     UnicodeString(puny8, length8, US_INV));
+        assertEquals("preflighting", length8,
+                     u_strToPunycodeUTF8(utf8.data(), -1, NULL, 0, errorCode));
+        errorCode.expectErrorAndReset(U_BUFFER_OVERFLOW_ERROR);
+
+        char back8[100];
+        int32_t backLength = u_strFromPunycodeUTF8(puny8, length8,
+                                                   back8, UPRV_LENGTHOF(back8), errorCode);
+        if (errorCode.errIfFailureAndReset("fromPunycode")) {
+            continue;
+        }
+        assertEquals("round trip", utf8.c_str(), std::string(back8, backLength).c_str());
+        assertEquals("from preflighting", backLength,
+                     u_strFromPunycodeUTF8(puny8, length8, back8, backLength - 1, errorCode));
+        errorCode.expectErrorAndReset(U_BUFFER_OVERFLOW_ERROR);
+    }
+    errorCode.setScope("");
+    char dest[100];
+    u_strToPunycodeUTF8("a\xC0\x80", -1, dest, UPRV_LENGTHOF(dest), errorCode);
+    errorCode.expectErrorAndReset(U_INVALID_CHAR_FOUND, "ill-formed UTF-8");
+    u_strFromPunycodeUTF8("a-\xC3\xA4", -1, dest, UPRV_LENGTHOF(dest), errorCode);
+    errorCode.expectErrorAndReset(U_INVALID_CHAR_FOUND, "non-ASCII Punycode digit");
+    u_strFromPunycodeUTF8("\xC3\xA4-ssb", -1, dest, UPRV_LENGTHOF(dest), errorCode);
+    errorCode.expectErrorAndReset(U_INVALID_CHAR_FOUND, "non-ASCII basic code point");
+    u_strFromPunycodeUTF8("a-99999999999", -1, dest, UPRV_LENGTHOF(dest), errorCode);
+    errorCode.expectErrorAndReset(U_ILLEGAL_CHAR_FOUND, "overflow");
+}
+
 #endif  // UCONFIG_NO_IDNA
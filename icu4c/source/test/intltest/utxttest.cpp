@@ -150,6 +150,18 @@ void  UTextTest::TextTest() {
         }
     }
     TestString(s);
+
+    // Runs of ASCII of varying lengths, some longer than the UTF-8 provider's
+    //   ASCII chunk, separated by multi-byte chars.
+    s.truncate(0);
+    for (i=0; i<8; i++) {
+        int32_t runLength = m_rand()%300 + 20;
+        for (j=0; j<runLength; j++) {
+            s.append((UChar)(0x61 + j%26));
+        }
+        s.append((UChar32)(i%2==0 ? 0xe9 : 0x10400));
+    }
+    TestString(s);
 }
 
 
@@ -1586,6 +1586,66 @@ static void TestFileWriteRetvalNONE(void) {
     TestFileWriteRetval(""); 
 } 
 
+/*
+ * Long runs of ASCII are copied directly between UTF-8 and UTF-16.
+ * Check that the characters around them, including surrogates that are split or
+ * unpaired across writes, and sequences that are split across buffer fills,
+ * still go through the converter in the right order.
+ */
+static void TestUTF8ASCIIRuns(void) {
+    static const UChar pair[] = { 0xE9, 0xD83D };
+    static const UChar trail[] = { 0xDE00, 0x62, 0x62 };
+    static const UChar lead[] = { 0xD800 };
+    static const UChar last[] = { 0x63 };
+    static const int32_t prefixLengths[] = { 1, 1023, 2047, 4095, 8191 };
+    int32_t i;
+
+    for (i = 0; i < UPRV_LENGTHOF(prefixLengths); ++i) {
+        int32_t prefixLength = prefixLengths[i];
+        int32_t expectedLength = prefixLength + 7;
+        UChar *buffer = (UChar *)malloc((prefixLength + 16) * sizeof(UChar));
+        UFILE *myFile;
+        int32_t length;
+
+        if (buffer == NULL) {
+            log_err("Out of memory\n");
+            return;
+        }
+        myFile = u_fopen(STANDARD_TEST_FILE, "wb", NULL, "UTF-8");
+        if (myFile == NULL) {
+            free(buffer);
+            log_err("Can't write test file %s\n", STANDARD_TEST_FILE);
+            return;
+        }
+        u_memset(buffer, 0x61, prefixLength);
+        u_file_write(buffer, prefixLength, myFile);
+        u_file_write(pair, UPRV_LENGTHOF(pair), myFile);
+        u_file_write(trail, UPRV_LENGTHOF(trail), myFile);
+        u_file_write(lead, UPRV_LENGTHOF(lead), myFile);
+        u_file_write(last, UPRV_LENGTHOF(last), myFile);
+        u_fclose(myFile);
+
+        myFile = u_fopen(STANDARD_TEST_FILE, "rb", NULL, "UTF-8");
+        if (myFile == NULL) {
+            free(buffer);
+            log_err("Can't read test file %s\n", STANDARD_TEST_FILE);
+            return;
+        }
+        length = u_file_read(buffer, prefixLength + 16, myFile);
+        u_fclose(myFile);
+        if (length != expectedLength ||
+                buffer[0] != 0x61 || buffer[prefixLength - 1] != 0x61 ||
+                buffer[prefixLength] != 0xE9 ||
+                buffer[prefixLength + 1] != 0xD83D || buffer[prefixLength + 2] != 0xDE00 ||
+                buffer[prefixLength + 3] != 0x62 || buffer[prefixLength + 4] != 0x62 ||
+                buffer[prefixLength + 5] != 0xFFFD || buffer[prefixLength + 6] != 0x63) {
+            log_err("UTF-8 round trip after %d ASCII characters failed, read %d UChars\n",
+                    prefixLength, length);
+        }
+        free(buffer);
+    }
+}
+
 U_CFUNC void
 addFileTest(TestNode** root) {
 #if !UCONFIG_NO_FORMATTING
@@ -1606,6 +1666,7 @@ addFileTest(TestNode** root) {
     addTest(root, &TestFileWriteRetvalUTF8, "file/TestFileWriteRetvalUTF8");
     addTest(root, &TestFileWriteRetvalASCII, "file/TestFileWriteRetvalASCII");
     addTest(root, &TestFileWriteRetvalNONE, "file/TestFileWriteRetvalNONE");
+    addTest(root, &TestUTF8ASCIIRuns, "file/TestUTF8ASCIIRuns");
 #if !UCONFIG_NO_FORMATTING
     addTest(root, &TestCodepageAndLocale, "file/TestCodepageAndLocale");
     addTest(root, &TestFprintfFormat, "file/TestFprintfFormat");
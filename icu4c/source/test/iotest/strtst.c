@@ -382,11 +382,13 @@ static void TestSprintfFormat(void) {
     static const char abcChars[] = "abc";
     const char *reorderFormat = "%2$d==>%1$-10.10s %6$lld %4$-10.10s %3$#x((%5$d"; /* reordering test*/
     const char *reorderResult = "99==>truncateif 1311768467463790322 1234567890 0xf1b93((10";
+    const char *variantsFormat = "%+d %d %.2f %f %.3d % d %.1f %g %u %.4u %.3g %d %f";
     UChar uBuffer[256];
     char buffer[256];
     char compBuffer[256];
     int32_t uNumPrinted;
     int32_t cNumPrinted;
+    int32_t i;
 
 
     TestSPrintFormat("%8S", abcUChars, "%8s", abcChars);
@@ -501,6 +503,16 @@ static void TestSprintfFormat(void) {
     if (strcmp(compBuffer, reorderResult) != 0) {
         log_err("%s Got: \"%s\", Expected: \"%s\"\n", reorderFormat, compBuffer, buffer);
     }    
+
+    /* Test more number conversions with different settings than the formatter caches, twice */
+    for (i = 0; i < 2; ++i) {
+        u_sprintf(uBuffer, variantsFormat, 5, 6, 1.5, 2.25, 7, 8, 3.25, 0.5, 9, 10, 1.23456, -11, 4.5);
+        u_austrncpy(compBuffer, uBuffer, UPRV_LENGTHOF(uBuffer));
+        sprintf(buffer, variantsFormat, 5, 6, 1.5, 2.25, 7, 8, 3.25, 0.5, 9, 10, 1.23456, -11, 4.5);
+        if (strcmp(compBuffer, buffer) != 0) {
+            log_err("%s Got: \"%s\", Expected: \"%s\"\n", variantsFormat, compBuffer, buffer);
+        }
+    }
 #endif
 }
 
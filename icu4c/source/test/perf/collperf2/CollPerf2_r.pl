@@ -34,6 +34,8 @@
 
 use lib '../perldriver';
 
+use File::Spec;
+
 require "../perldriver/Common.pl";
 
 use PerfFramework;
@@ -46,7 +48,8 @@
     "time"=>"2",
     #"outputType"=>"HTML",
     "dataDir"=>$CollationDataPath,
-    "outputDir"=>"../results"
+    "outputDir"=>"../results",
+    "outputJSON"=>"1"
 };
 
 # programs
@@ -103,8 +106,20 @@
     "binary search UnicodeString*[]: compare()",        ["$p1,TestUniStrBinSearch", "$p2,TestUniStrBinSearch"],
     "binary search StringPiece[]: compareUTF8()",       ["$p1,TestStringPieceBinSearchCpp", "$p2,TestStringPieceBinSearchCpp"],
     "binary search StringPiece[]: ucol_strcollUTF8()",  ["$p1,TestStringPieceBinSearchC", "$p2,TestStringPieceBinSearchC"],
+
+    # Four threads sharing one collator; see the --threads option.
+    "threads: ucol_strcoll/len",                ["$p1,--threads,4,TestStrcoll", "$p2,--threads,4,TestStrcoll"],
+    "threads: ucol_strcollUTF8/len",            ["$p1,--threads,4,TestStrcollUTF8", "$p2,--threads,4,TestStrcollUTF8"],
+    "threads: ucol_getSortKey/len",             ["$p1,--threads,4,TestGetSortKey", "$p2,--threads,4,TestGetSortKey"],
+    "threads: ucol_nextSortKeyPart/32_all",     ["$p1,--threads,4,TestNextSortKeyPart_32All", "$p2,--threads,4,TestNextSortKeyPart_32All"],
+    "threads: Collator::compare/len",           ["$p1,--threads,4,TestCppCompare", "$p2,--threads,4,TestCppCompare"],
+    "threads: Collator::compareUTF8/len",       ["$p1,--threads,4,TestCppCompareUTF8", "$p2,--threads,4,TestCppCompareUTF8"],
 };
 
+# Corpora in ./data: product titles, URLs and strings that mix scripts.
+# They are not in $CollationDataPath, so they are passed with absolute paths.
+my $corpora = File::Spec->rel2abs("data");
+
 my $dataFiles = {
     "en_US",
     [
@@ -155,7 +170,8 @@
     [
         "TestNames_Japanese.txt",
         "TestNames_Japanese_h.txt",
-        "TestNames_Japanese_k.txt"
+        "TestNames_Japanese_k.txt",
+        "$corpora/TestProductTitles.txt"
     ],
 
     "ja-u-ks-identic",
@@ -200,6 +216,27 @@
     "he",
     [
         "TestRandomWordsUDHR_he.txt"
+    ],
+
+    "en_US-u-kn",
+    [
+        "$corpora/TestProductTitles.txt",
+        "$corpora/TestURLs.txt"
+    ],
+
+    "de",
+    [
+        "$corpora/TestProductTitles.txt"
+    ],
+
+    "root",
+    [
+        "$corpora/TestMixedScripts.txt"
+    ],
+
+    "zh-u-co-pinyin-ka-shifted",
+    [
+        "$corpora/TestMixedScripts.txt"
     ]
 };
 
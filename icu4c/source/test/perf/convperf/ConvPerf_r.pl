@@ -64,6 +64,10 @@
     ####
     "ISO2022JP From Unicode",   ["$p1,TestICU_ISO2022JP_FromUnicode",   "$p2,TestICU_ISO2022JP_FromUnicode" ],
     "ISO2022JP To Unicode",     ["$p1,TestICU_ISO2022JP_ToUnicode",     "$p2,TestICU_ISO2022JP_ToUnicode" ],
+    ####
+    "ISO-8859-8 From UTF-8",    ["$p1,TestICU_Latin8_FromUTF8",         "$p2,TestICU_Latin8_FromUTF8" ],
+    "Shift-JIS From UTF-8",     ["$p1,TestICU_SJIS_FromUTF8",           "$p2,TestICU_SJIS_FromUTF8" ],
+    "GB2312 From UTF-8",        ["$p1,TestICU_GB2312_FromUTF8",         "$p2,TestICU_GB2312_FromUTF8" ],
 };
 
 
@@ -116,6 +116,10 @@ UPerfFunction* ConverterPerformanceTest::runIndexedTest(int32_t index, UBool exe
         TESTCASE(52,TestWinANSI_ISO2022JP_ToUnicode);
         TESTCASE(53,TestWinANSI_ISO2022JP_FromUnicode);
 
+        TESTCASE(54,TestICU_Latin8_FromUTF8);
+        TESTCASE(55,TestICU_SJIS_FromUTF8);
+        TESTCASE(56,TestICU_GB2312_FromUTF8);
+
         default: 
             name = ""; 
             return NULL;
@@ -657,3 +661,32 @@ UPerfFunction*  ConverterPerformanceTest::TestWinANSI_ISO2022JP_ToUnicode(){
     }
     return pf;
 }
+
+//################
+
+UPerfFunction* ConverterPerformanceTest::TestICU_Latin8_FromUTF8(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new ICUFromUTF8PerfFunction("iso-8859-8", (UChar *)latin8_uniSource, UPRV_LENGTHOF(latin8_uniSource), status);
+    if(U_FAILURE(status)){
+        return NULL;
+    }
+    return pf;
+}
+
+UPerfFunction* ConverterPerformanceTest::TestICU_SJIS_FromUTF8(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new ICUFromUTF8PerfFunction("sjis", (UChar *)sjis_uniSource, UPRV_LENGTHOF(sjis_uniSource), status);
+    if(U_FAILURE(status)){
+        return NULL;
+    }
+    return pf;
+}
+
+UPerfFunction* ConverterPerformanceTest::TestICU_GB2312_FromUTF8(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new ICUFromUTF8PerfFunction("gb2312", (UChar *)gb2312_uniSource, UPRV_LENGTHOF(gb2312_uniSource), status);
+    if(U_FAILURE(status)){
+        return NULL;
+    }
+    return pf;
+}
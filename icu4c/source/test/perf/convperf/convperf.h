@@ -117,6 +117,68 @@ class ICUFromUnicodePerfFunction : public UPerfFunction{
     }
 };
 
+class ICUFromUTF8PerfFunction : public UPerfFunction{
+private:
+    UConverter* conv;
+    UConverter* utf8;
+    char* src;
+    int32_t srcLen;
+    char* target;
+    char* targetLimit;
+    UChar pivot[MAX_BUF_SIZE];
+
+public:
+    ICUFromUTF8PerfFunction(const char* name,  const UChar* source, int32_t sourceLen, UErrorCode& status){
+        conv = ucnv_open(name,&status);
+        utf8 = ucnv_open("UTF-8",&status);
+        src = NULL;
+        target = NULL;
+        targetLimit = NULL;
+        if(U_FAILURE(status)){
+            return;
+        }
+        // ucnv_convertEx() uses the direct UTF-8-to-charset code if the charset supports it.
+        u_strToUTF8(NULL, 0, &srcLen, source, sourceLen, &status);
+        if(status==U_BUFFER_OVERFLOW_ERROR) {
+            status=U_ZERO_ERROR;
+        }
+        src=(char*)malloc(srcLen);
+        if(src == NULL){
+            status = U_MEMORY_ALLOCATION_ERROR;
+            return;
+        }
+        u_strToUTF8(src, srcLen, NULL, source, sourceLen, &status);
+        int32_t reqdLen = ucnv_fromUChars(conv, target, 0, source, sourceLen, &status);
+        if(status==U_BUFFER_OVERFLOW_ERROR) {
+            status=U_ZERO_ERROR;
+            target=(char*)malloc((reqdLen*2));
+            targetLimit = target + reqdLen*2;
+            if(target == NULL){
+                status = U_MEMORY_ALLOCATION_ERROR;
+                return;
+            }
+        }
+    }
+    virtual void call(UErrorCode* status){
+        const char* mySrc = src;
+        char* myTarget = target;
+        UChar* pivotSource = pivot;
+        UChar* pivotTarget = pivot;
+        ucnv_convertEx(conv, utf8, &myTarget, targetLimit, &mySrc, src + srcLen,
+                       pivot, &pivotSource, &pivotTarget, pivot + UPRV_LENGTHOF(pivot),
+                       TRUE, TRUE, status);
+    }
+    virtual long getOperationsPerIteration(void){
+        return srcLen;
+    }
+    ~ICUFromUTF8PerfFunction(){
+        free(target);
+        free(src);
+        ucnv_close(utf8);
+        ucnv_close(conv);
+    }
+};
+
 class ICUOpenAllConvertersFunction : public UPerfFunction{
 private:
     UBool cleanup;
@@ -566,6 +628,10 @@ class  ConverterPerformanceTest : public UPerfTest{
     UPerfFunction* TestWinIML2_ISO2022JP_ToUnicode();
     UPerfFunction* TestWinIML2_ISO2022JP_FromUnicode(); 
 
+    UPerfFunction* TestICU_Latin8_FromUTF8();
+    UPerfFunction* TestICU_SJIS_FromUTF8();
+    UPerfFunction* TestICU_GB2312_FromUTF8();
+
 };
 
 #endif
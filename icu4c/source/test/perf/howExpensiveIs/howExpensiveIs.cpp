@@ -840,6 +840,15 @@ void runTests() {
     DO_NumFmtInt64Test_gr0("#,###","12345",12345);
     DO_NumFmtInt64Test("#","-2",-2);
     DO_NumFmtInt64Test("+#","+2",2);
+    // integer digit conversion in DecimalQuantity, small and long paths
+    DO_NumFmtInt64Test("#","1234567890",1234567890);
+    DO_NumFmtInt64Test("#","1234567890123456",1234567890123456LL);
+    DO_NumFmtInt64Test("#","123456789012345678",123456789012345678LL);
+    DO_NumFmtTest("#","1234567890",1234567890.0);
+    // shortest conversion of doubles to exact digits, with and without the oracle
+    DO_NumFmtTest("0.0##################","1.235",1.235);
+    DO_NumFmtTest("0.0##################","19.99",19.99);
+    DO_NumFmtTest("0.0##################","0.30000000000000004",0.30000000000000004);
   }
 
 #ifndef SKIP_NUM_OPEN_TEST
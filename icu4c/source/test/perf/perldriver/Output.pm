@@ -32,6 +32,9 @@
 my %options;
 my $operationIs = "operation";
 my $eventIs = "event";
+my $json;
+my $jsonDate;
+my $jsonTitle;
 
 sub startTest {
   $current = shift;
@@ -202,6 +205,10 @@ sub setupOutput {
       $html = $options{ "outputDir" }."/".$html;
     }
     $html =~ s/ /_/g;
+    $json = $html;
+    $json =~ s/\.html$/.json/;
+    $jsonDate = $date;
+    $jsonTitle = $title;
 
     open(HTML,">$html") or die "Can't write to $html: $!";
 
@@ -250,6 +257,9 @@ sub closeOutput {
     }
     $legend .= "</ul>\n";
     print HTML $legend;
+    if($options{ "outputJSON" }) {
+      outputJSON(); # before outputRaw, which consumes %raw
+    }
     outputRaw();
     print HTML <<EOF;
    </BODY>
@@ -316,6 +326,63 @@ sub outputRaw {
   }
 }
 
+sub jsonString {
+  my $s = shift;
+  $s =~ s/\<br\>/ /g;
+  $s =~ s/\<\/?\w+\>//g; # HTML markup from startTest
+  $s =~ s/^\s+|\s+$//g;
+  $s =~ s/(["\\])/\\$1/g;
+  $s =~ s/([\x00-\x1f])/sprintf("\\u%04x", ord($1))/ge;
+  return "\"$s\"";
+}
+
+# Writes the raw data next to the HTML file, in a form that
+# scripts can compare across runs without parsing HTML.
+# There is one result per test, program and data set.
+# Times per operation are in nanoseconds; as in the HTML tables,
+# the first pass is discarded if there was more than one.
+sub outputJSON {
+  open(JSON,">$json") or die "Can't write to $json: $!";
+  print JSON "{\n";
+  print JSON "  \"title\": ".jsonString($jsonTitle).",\n";
+  print JSON "  \"headers\": [".join(", ", map { jsonString($_) } @headers)."],\n";
+  print JSON "  \"date\": ".jsonString($jsonDate).",\n";
+  print JSON "  \"results\": [";
+  my $first = 1;
+  my $key;
+  for $key (sort keys %raw) {
+    my $row;
+    for $row ( @{ $raw{$key} } ) {
+      my ($name, $iterations, $operations, $times, $events) = @$row;
+      my ($test, $command) = split(/,/, $name, 2);
+      my @data = @$times;
+      shift(@data) if (@data > 1); # discard first run
+      my $ds = Dataset->new(@data);
+      print JSON "," unless $first;
+      $first = 0;
+      print JSON "\n    {";
+      print JSON "\"dataset\": ".jsonString($key).", ";
+      print JSON "\"test\": ".jsonString($test).", ";
+      print JSON "\"command\": ".jsonString($command).", ";
+      print JSON "\"iterations\": $iterations, ";
+      print JSON "\"operations\": $operations, ";
+      if($iterations * $operations > 0) {
+        my $scale = $mult / ($iterations * $operations);
+        printf JSON "\"meanNsPerOp\": %.4f, ", $ds->getMean * $scale;
+        printf JSON "\"errorNsPerOp\": %.4f", $ds->getError * $scale;
+      } else {
+        print JSON "\"meanNsPerOp\": null, \"errorNsPerOp\": null";
+      }
+      if(defined $events) {
+        print JSON ", \"events\": $events";
+      }
+      print JSON "}";
+    }
+  }
+  print JSON "\n  ]\n}\n";
+  close(JSON) or die "Can't close $json: $!";
+}
+
 sub store {
   $raw{$current}[$exp++] = [@_];
 }
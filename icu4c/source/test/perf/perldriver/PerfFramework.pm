@@ -11,6 +11,7 @@
 
 use strict;
 
+use File::Spec;
 #use Dataset;
 use Format;
 use Output;
@@ -80,7 +81,9 @@ sub runTests {
         $locdata .= "<b>Datafile:</b> $data<br>";
         startTest($locdata);
 
-        if($DATADIR) {
+        # Absolute paths are for data files that do not live in dataDir,
+        # like the corpora that come with a test program.
+        if($DATADIR && !File::Spec->file_name_is_absolute($data)) {
           compareLoop ($tests, $locale, $DATADIR."/".$data);
         } else {
           compareLoop ($tests, $locale, $data);
@@ -0,0 +1,41 @@
+#!/usr/bin/perl
+#  ********************************************************************
+#  * Copyright (C) 2019 and later: Unicode, Inc. and others.
+#  * License & terms of use: http://www.unicode.org/copyright.html#License
+#  ********************************************************************
+
+# Runs each threadperf case on 1, 2, 4 and 8 threads.
+# With perfect scaling the time per operation halves from one column to the next
+# (up to the number of cores); a case that stays flat or gets slower
+# points at lock contention or false sharing on the shared object.
+
+#use strict;
+
+require "../perldriver/Common.pl";
+
+use lib '../perldriver';
+
+use PerfFramework;
+
+my $options = {
+    "title"=>"Shared ICU objects on several threads",
+    "headers"=>"1thread 2threads 4threads 8threads",
+    "operationIs"=>"operation on all threads",
+    "passes"=>"3",
+    "time"=>"2",
+    #"outputType"=>"HTML",
+    "outputDir"=>"../results"
+};
+
+# programs
+# tests will be done for all the programs. Results will be stored and connected
+# (threadperf is only built with the Makefiles, not on Windows.)
+my $p = "LD_LIBRARY_PATH=".$ICULatest."/source/lib:".$ICULatest."/source/tools/ctestfw ".$ICUPathLatest."/threadperf/threadperf";
+
+my $tests = {};
+foreach my $test ("CollatorCompare", "NumberFormatterFormat", "Normalizer2Normalize",
+                  "CacheLookup", "ResourceBundleOpen", "ConverterOpen") {
+    $tests->{$test} = [ map { "$p,--threads,$_,$test" } (1, 2, 4, 8) ];
+}
+
+runTests($options, $tests);
@@ -0,0 +1,271 @@
+// © 2019 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+ ***********************************************************************
+ *  file name:  threadperf.cpp
+ *  encoding:   UTF-8
+ *  tab size:   8 (not used)
+ *  indentation:4
+ *
+ *  Performance test program for ICU objects and caches shared by threads:
+ *  Each test case uses one collator, number formatter or normalizer that is
+ *  shared by all threads, or goes through one of ICU's global caches.
+ *
+ *  Run each case with --threads 1, 2, 4, ... (see ThreadPerf_r.pl).
+ *  The time per operation is the wall-clock time divided by the operations
+ *  of all threads, so on a machine with enough cores it should go down
+ *  in proportion to the number of threads. Where it does not, the threads
+ *  contend for a lock or write to shared cache lines.
+ *
+ * Usage from within <ICU build tree>/test/perf/threadperf/ :
+ * (Linux)
+ *  make
+ *  export LD_LIBRARY_PATH=../../../lib:../../../stubdata:../../../tools/ctestfw:../../../tools/toolutil
+ *  ./threadperf -t 2 -p 3 --threads 4 -L de [-f <UTF-8 text file, one string per line>] CollatorCompare
+ */
+
+#include <stdio.h>
+#include "unicode/coll.h"
+#include "unicode/localpointer.h"
+#include "unicode/normalizer2.h"
+#include "unicode/numberformatter.h"
+#include "unicode/plurrule.h"
+#include "unicode/ucnv.h"
+#include "unicode/unistr.h"
+#include "unicode/uperf.h"
+#include "unicode/ures.h"
+#include "cmemory.h"
+#include "sharedpluralrules.h"
+
+// Strings used when no -f file is given.
+static const char *const defaultStrings[] = {
+    "apple", "Äpfel", "application", "Zürich", "zebra", "résumé", "resume", "Résumé",
+    "naïve", "naive", "coöperate", "cooperate", "Straße", "strasse", "ŒUVRE", "oeuvre",
+    "Москва", "москва", "Αθήνα", "αθηνα", "東京", "とうきょう", "トウキョウ", "서울",
+    "e\\u0301cole", "\\u00E9cole", "A\\u030A", "\\u212B", "ﬁle", "file", "１２３", "123"
+};
+
+// Test object.
+// Holds the strings and the objects that are shared by the threads.
+class ThreadPerfTest : public UPerfTest {
+public:
+    ThreadPerfTest(int32_t argc, const char *argv[], UErrorCode &status)
+            : UPerfTest(argc, argv, NULL, 0, "", status),
+              loc("en"), strings(NULL), count(0), nfc(NULL) {
+        if(U_FAILURE(status)) {
+            return;
+        }
+        if(locale!=NULL) {
+            loc=Locale(locale);
+        }
+
+        if(ucharBuf!=NULL) {
+            const ULine *lines=getLines(status);
+            if(U_FAILURE(status)) {
+                return;
+            }
+            strings=new UnicodeString[numLines];
+            for(int32_t i=0; i<numLines; ++i) {
+                strings[i].setTo(FALSE, lines[i].name, lines[i].len);
+            }
+            count=numLines;
+        } else {
+            count=UPRV_LENGTHOF(defaultStrings);
+            strings=new UnicodeString[count];
+            for(int32_t i=0; i<count; ++i) {
+                strings[i]=UnicodeString::fromUTF8(defaultStrings[i]).unescape();
+            }
+        }
+        if(count<2) {
+            fprintf(stderr, "ThreadPerfTest needs at least two strings\n");
+            status=U_ILLEGAL_ARGUMENT_ERROR;
+            return;
+        }
+
+        collator.adoptInsteadAndCheckErrorCode(Collator::createInstance(loc, status), status);
+        formatter=number::NumberFormatter::withLocale(loc);
+        nfc=Normalizer2::getNFCInstance(status);
+        // Load the cached and global data once, outside of any timing.
+        const SharedPluralRules *shared=
+            PluralRules::createSharedInstance(loc, UPLURAL_TYPE_CARDINAL, status);
+        if(shared!=NULL) {
+            shared->removeRef();
+        }
+        ures_close(ures_open(NULL, loc.getName(), &status));
+        ucnv_close(ucnv_open("Shift_JIS", &status));
+    }
+
+    virtual ~ThreadPerfTest() {
+        delete[] strings;
+    }
+
+    virtual UPerfFunction *runIndexedTest(int32_t index, UBool exec, const char *&name, char *par=NULL);
+
+    Locale loc;
+    UnicodeString *strings;
+    int32_t count;
+    LocalPointer<Collator> collator;
+    number::LocalizedNumberFormatter formatter;
+    const Normalizer2 *nfc;
+};
+
+// Performance test function object.
+// Each thread runs its own copy, with its own scratch variables.
+class SharedObjectFunction : public UPerfFunction {
+protected:
+    SharedObjectFunction(ThreadPerfTest &perf, long ops) : perf(perf), ops(ops) {}
+
+public:
+    virtual ~SharedObjectFunction() {}
+
+    virtual long getOperationsPerIteration() {
+        return ops;
+    }
+
+protected:
+    ThreadPerfTest &perf;
+    long ops;
+};
+
+// Collator::compare() on a collator shared by all threads.
+class CollatorCompare : public SharedObjectFunction {
+public:
+    CollatorCompare(ThreadPerfTest &perf) : SharedObjectFunction(perf, perf.count-1) {}
+
+    virtual void call(UErrorCode *pErrorCode) {
+        for(int32_t i=1; i<perf.count; ++i) {
+            perf.collator->compare(perf.strings[i-1], perf.strings[i], *pErrorCode);
+        }
+    }
+};
+
+// LocalizedNumberFormatter::formatDouble() on a formatter shared by all threads.
+class NumberFormatterFormat : public SharedObjectFunction {
+public:
+    NumberFormatterFormat(ThreadPerfTest &perf) : SharedObjectFunction(perf, 100) {}
+
+    virtual void call(UErrorCode *pErrorCode) {
+        for(int32_t i=0; i<100; ++i) {
+            result=perf.formatter.formatDouble(i*1234.5+0.25, *pErrorCode).toString(*pErrorCode);
+        }
+    }
+
+private:
+    UnicodeString result;
+};
+
+// Normalizer2::normalize() on the NFC singleton.
+class Normalizer2Normalize : public SharedObjectFunction {
+public:
+    Normalizer2Normalize(ThreadPerfTest &perf) : SharedObjectFunction(perf, perf.count) {}
+
+    virtual void call(UErrorCode *pErrorCode) {
+        for(int32_t i=0; i<perf.count; ++i) {
+            perf.nfc->normalize(perf.strings[i], dest, *pErrorCode);
+        }
+    }
+
+private:
+    UnicodeString dest;
+};
+
+// UnifiedCache lookup of an object that is already cached.
+class CacheLookup : public SharedObjectFunction {
+public:
+    CacheLookup(ThreadPerfTest &perf) : SharedObjectFunction(perf, 100) {}
+
+    virtual void call(UErrorCode *pErrorCode) {
+        for(int32_t i=0; i<100; ++i) {
+            const SharedPluralRules *shared=
+                PluralRules::createSharedInstance(perf.loc, UPLURAL_TYPE_CARDINAL, *pErrorCode);
+            if(shared!=NULL) {
+                shared->removeRef();
+            }
+        }
+    }
+};
+
+// ures_open() and ures_close() of a bundle that is already in the bundle cache.
+class ResourceBundleOpen : public SharedObjectFunction {
+public:
+    ResourceBundleOpen(ThreadPerfTest &perf) : SharedObjectFunction(perf, 10) {}
+
+    virtual void call(UErrorCode *pErrorCode) {
+        for(int32_t i=0; i<10; ++i) {
+            ures_close(ures_open(NULL, perf.loc.getName(), pErrorCode));
+        }
+    }
+};
+
+// ucnv_open() and ucnv_close() of a converter whose shared data is already loaded.
+class ConverterOpen : public SharedObjectFunction {
+public:
+    ConverterOpen(ThreadPerfTest &perf) : SharedObjectFunction(perf, 10) {}
+
+    virtual void call(UErrorCode *pErrorCode) {
+        for(int32_t i=0; i<10; ++i) {
+            ucnv_close(ucnv_open("Shift_JIS", pErrorCode));
+        }
+    }
+};
+
+UPerfFunction *ThreadPerfTest::runIndexedTest(int32_t index, UBool exec,
+                                              const char *&name, char * /*par*/) {
+    switch(index) {
+    case 0:
+        name="CollatorCompare";
+        if(exec) {
+            return new CollatorCompare(*this);
+        }
+        break;
+    case 1:
+        name="NumberFormatterFormat";
+        if(exec) {
+            return new NumberFormatterFormat(*this);
+        }
+        break;
+    case 2:
+        name="Normalizer2Normalize";
+        if(exec) {
+            return new Normalizer2Normalize(*this);
+        }
+        break;
+    case 3:
+        name="CacheLookup";
+        if(exec) {
+            return new CacheLookup(*this);
+        }
+        break;
+    case 4:
+        name="ResourceBundleOpen";
+        if(exec) {
+            return new ResourceBundleOpen(*this);
+        }
+        break;
+    case 5:
+        name="ConverterOpen";
+        if(exec) {
+            return new ConverterOpen(*this);
+        }
+        break;
+    default:
+        name="";
+        break;
+    }
+    return NULL;
+}
+
+int main(int argc, const char *argv[]) {
+    UErrorCode status=U_ZERO_ERROR;
+    ThreadPerfTest test(argc, argv, status);
+    if(U_FAILURE(status)) {
+        fprintf(stderr, "ThreadPerfTest() failed: %s\n", u_errorName(status));
+        test.usage();
+        return status;
+    }
+    if(!test.run()) {
+        fprintf(stderr, "FAILED: Tests could not be run, please check the arguments.\n");
+        return -1;
+    }
+    return 0;
+}
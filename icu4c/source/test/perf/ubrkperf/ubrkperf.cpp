@@ -160,6 +160,16 @@ UPerfFunction* BreakIteratorPerformanceTest::TestICUIsBound()
   return new ICUIsBound(locale, m_mode_, m_file_, m_fileLen_);
 }
 
+UPerfFunction* BreakIteratorPerformanceTest::TestICUCategoryUTrie2()
+{
+  return new ICUCategoryLookup(locale, m_mode_, m_file_, m_fileLen_, TRUE);
+}
+
+UPerfFunction* BreakIteratorPerformanceTest::TestICUCategoryCPTrie()
+{
+  return new ICUCategoryLookup(locale, m_mode_, m_file_, m_fileLen_, FALSE);
+}
+
 UPerfFunction* BreakIteratorPerformanceTest::TestDarwinForward()
 {
   return NULL;
@@ -179,6 +189,8 @@ UPerfFunction* BreakIteratorPerformanceTest::runIndexedTest(int32_t index, UBool
 		TESTCASE(1, TestICUIsBound);
 		TESTCASE(2, TestDarwinForward);
 		TESTCASE(3, TestDarwinIsBound);
+		TESTCASE(4, TestICUCategoryUTrie2);
+		TESTCASE(5, TestICUCategoryCPTrie);
         default: 
             name = ""; 
             return NULL;
@@ -192,15 +204,12 @@ UOption options[]={
 
 
 BreakIteratorPerformanceTest::BreakIteratorPerformanceTest(int32_t argc, const char* argv[], UErrorCode& status)
-: UPerfTest(argc,argv,status),
+: UPerfTest(argc,argv,options,UPRV_LENGTHOF(options),NULL,status),
 m_mode_(NULL),
 m_file_(NULL),
 m_fileLen_(0)
 {
 
-    _remainingArgc = u_parseArgs(_remainingArgc, (char**)argv, UPRV_LENGTHOF(options), options);
-
-
     if(options[0].doesOccur) {
       m_mode_ = options[0].value;
       switch(options[0].value[0]) {
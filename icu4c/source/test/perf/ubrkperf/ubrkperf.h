@@ -15,6 +15,12 @@
 #include "unicode/uperf.h"
 
 #include <unicode/brkiter.h>
+#include <unicode/rbbi.h>
+#include <unicode/ucptrie.h>
+#include <unicode/utf16.h>
+
+#include "rbbidata.h"
+#include "utrie2.h"
 
 class ICUBreakFunction : public UPerfFunction {
 protected:
@@ -107,6 +113,88 @@ class ICUForward : public ICUBreakFunction {
   }
 };
 
+/**
+ * Character classification only: maps each code point of the text to its
+ * break iterator category, using the iterator's UCPTrie as stored in the
+ * .brk data (CPTrie) or an equivalent 16-bit UTrie2 built from it (UTrie2),
+ * to compare the two lookup paths.
+ */
+class ICUCategoryLookup : public ICUBreakFunction {
+protected:
+  const UCPTrie *m_cpTrie_;
+  UTrie2 *m_trie2_;
+  UBool m_useTrie2_;
+  uint32_t m_sum_;
+public:
+  ICUCategoryLookup(const char *locale, const char *mode, const UChar *file, int32_t file_len,
+                    UBool useTrie2) :
+      ICUBreakFunction(locale, mode, file, file_len),
+      m_cpTrie_(NULL),
+      m_trie2_(NULL),
+      m_useTrie2_(useTrie2),
+      m_sum_(0)
+  {
+    if (U_FAILURE(m_status_)) {
+      return;
+    }
+    RuleBasedBreakIterator *rbbi = dynamic_cast<RuleBasedBreakIterator *>(m_brkIt_);
+    if (rbbi == NULL) {
+      m_status_ = U_UNSUPPORTED_ERROR;
+      return;
+    }
+    uint32_t length;
+    const RBBIDataHeader *header = (const RBBIDataHeader *)rbbi->getBinaryRules(length);
+    m_cpTrie_ = ucptrie_openFromBinary(UCPTRIE_TYPE_FAST, UCPTRIE_VALUE_BITS_ANY,
+                                       (const uint8_t *)header + header->fTrie, header->fTrieLen,
+                                       NULL, &m_status_);
+    m_trie2_ = utrie2_open(0, 0, &m_status_);
+    UChar32 start = 0, end;
+    uint32_t value;
+    while (U_SUCCESS(m_status_) &&
+           (end = ucptrie_getRange(m_cpTrie_, start, UCPMAP_RANGE_NORMAL, 0,
+                                   NULL, NULL, &value)) >= 0) {
+      utrie2_setRange32(m_trie2_, start, end, value, TRUE, &m_status_);
+      start = end + 1;
+    }
+    utrie2_freeze(m_trie2_, UTRIE2_16_VALUE_BITS, &m_status_);
+    UErrorCode status = U_ZERO_ERROR;
+    call(&status);
+  }
+  ~ICUCategoryLookup() {
+    ucptrie_close((UCPTrie *)m_cpTrie_);
+    utrie2_close(m_trie2_);
+  }
+  virtual void call(UErrorCode * /*status*/)
+  {
+    uint32_t sum = 0;
+    int32_t count = 0;
+    int32_t i = 0;
+    UChar32 c;
+    if (m_useTrie2_) {
+      while (i < m_fileLen_) {
+        U16_NEXT(m_file_, i, m_fileLen_, c);
+        sum += UTRIE2_GET16(m_trie2_, c);
+        count++;
+      }
+    } else if (m_cpTrie_->valueWidth == UCPTRIE_VALUE_BITS_8) {
+      while (i < m_fileLen_) {
+        U16_NEXT(m_file_, i, m_fileLen_, c);
+        sum += UCPTRIE_FAST_GET(m_cpTrie_, UCPTRIE_8, c);
+        count++;
+      }
+    } else {
+      while (i < m_fileLen_) {
+        U16_NEXT(m_file_, i, m_fileLen_, c);
+        sum += UCPTRIE_FAST_GET(m_cpTrie_, UCPTRIE_16, c);
+        count++;
+      }
+    }
+    // Keep the category checksum so that the lookups are not optimized away.
+    m_sum_ = sum;
+    m_noBreaks_ = count;
+  }
+};
+
 class DarwinBreakFunction : public UPerfFunction {
 public:
   virtual void call(UErrorCode *status) {};
@@ -128,6 +216,9 @@ class BreakIteratorPerformanceTest : public UPerfTest {
   UPerfFunction* TestICUForward();
   UPerfFunction* TestICUIsBound();
 
+  UPerfFunction* TestICUCategoryUTrie2();
+  UPerfFunction* TestICUCategoryCPTrie();
+
   UPerfFunction* TestDarwinForward();
   UPerfFunction* TestDarwinIsBound();
 
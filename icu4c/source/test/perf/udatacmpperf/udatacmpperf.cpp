@@ -0,0 +1,206 @@
+// © 2019 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+ ***********************************************************************
+ *  file name:  udatacmpperf.cpp
+ *  encoding:   UTF-8
+ *  tab size:   8 (not used)
+ *  indentation:4
+ *
+ *  Performance test program for compressed data items:
+ *  The first-touch cost of uncompressing each item of the ICU data package,
+ *  compared with copying the uncompressed item, and the size savings.
+ *
+ * Usage from within <ICU build tree>/test/perf/udatacmpperf/ :
+ * (Linux)
+ *  make
+ *  export LD_LIBRARY_PATH=../../../lib:../../../stubdata:../../../tools/ctestfw:../../../tools/toolutil
+ *  ./udatacmpperf --sourcedir <ICU build tree>/data/out/tmp --passes 3 --iterations 10
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "unicode/uperf.h"
+#include "charstr.h"
+#include "cmemory.h"
+#include "datacompress.h"
+#include "package.h"
+#include "toolutil.h"
+#include "udatacmp.h"
+#include "uoptions.h"
+
+// Test object.
+// Loads icudt64l.dat (or whatever its current versioned filename)
+// from the -s or --sourcedir path, and compresses each item that gets smaller.
+class UDataCompressPerfTest : public UPerfTest {
+public:
+    UDataCompressPerfTest(int32_t argc, const char *argv[], UErrorCode &status)
+            : UPerfTest(argc, argv, NULL, 0, "", status),
+              itemCount(0), maxItemLength(0), items(NULL) {
+        if(U_FAILURE(status)) {
+            return;
+        }
+        CharString filename(sourceDir, status);
+        int32_t filenameLength=filename.length();
+        if(filenameLength>0 && filename[filenameLength-1]!=U_FILE_SEP_CHAR &&
+                               filename[filenameLength-1]!=U_FILE_ALT_SEP_CHAR) {
+            filename.append(U_FILE_SEP_CHAR, status);
+        }
+        filename.append(U_ICUDATA_NAME, status);
+        filename.append(".dat", status);
+        if(U_FAILURE(status)) {
+            return;
+        }
+        pkg.readPackage(filename.data());
+
+        itemCount=pkg.getItemCount();
+        items=new CompressedItem[itemCount];
+        if(items==NULL) {
+            status=U_MEMORY_ALLOCATION_ERROR;
+            return;
+        }
+        int64_t totalLength=0, totalCompressedLength=0;
+        for(int32_t i=0; i<itemCount; ++i) {
+            const Item *pItem=pkg.getItem(i);
+            CompressedItem &item=items[i];
+            item.data=pItem->data;
+            item.length=pItem->length;
+            if(item.length>maxItemLength) {
+                maxItemLength=item.length;
+            }
+            totalLength+=item.length;
+            UErrorCode errorCode=U_ZERO_ERROR;
+            int32_t length=udata_compressItem(pItem->data, pItem->length, NULL, 0, &errorCode);
+            if(errorCode==U_BUFFER_OVERFLOW_ERROR && length<pItem->length &&
+                    item.compressed.allocateInsteadAndReset(length)!=NULL) {
+                errorCode=U_ZERO_ERROR;
+                item.compressedLength=
+                    udata_compressItem(pItem->data, pItem->length,
+                                       item.compressed.getAlias(), length, &errorCode);
+                if(U_FAILURE(errorCode)) {
+                    status=errorCode;
+                    return;
+                }
+                totalCompressedLength+=item.compressedLength;
+            } else {
+                item.compressedLength=0;
+                totalCompressedLength+=item.length;
+            }
+        }
+        if(maxItemLength==0 || buffer.allocateInsteadAndReset(maxItemLength)==NULL) {
+            status=U_MEMORY_ALLOCATION_ERROR;
+            return;
+        }
+        printf("%ld items: %ld bytes uncompressed, %ld bytes compressed (%.1f%%)\n",
+               (long)itemCount, (long)totalLength, (long)totalCompressedLength,
+               (100.0*totalCompressedLength)/totalLength);
+    }
+
+    virtual ~UDataCompressPerfTest() {
+        delete[] items;
+    }
+
+    virtual UPerfFunction *runIndexedTest(int32_t index, UBool exec, const char *&name, char *par=NULL);
+
+    struct CompressedItem : public UMemory {
+        const uint8_t *data;
+        int32_t length;
+        LocalMemory<uint8_t> compressed;
+        int32_t compressedLength;  // 0 if the item is stored uncompressed
+    };
+
+    Package pkg;
+    int32_t itemCount, maxItemLength;
+    CompressedItem *items;
+    // Output buffer for the uncompressed items.
+    LocalMemory<uint8_t> buffer;
+};
+
+// Performance test function object.
+// One operation is the first access to one package item.
+class ItemAccess : public UPerfFunction {
+protected:
+    ItemAccess(UDataCompressPerfTest &perf) : perf(perf) {}
+
+public:
+    virtual ~ItemAccess() {}
+
+    // virtual void call(UErrorCode* pErrorCode) { ... }
+
+    virtual long getOperationsPerIteration() {
+        return perf.itemCount;
+    }
+
+protected:
+    UDataCompressPerfTest &perf;
+};
+
+// The ICU data is mapped: The first access to an uncompressed item reads its pages.
+// Copying the item is a lower bound for that cost.
+class CopyItems : public ItemAccess {
+public:
+    CopyItems(UDataCompressPerfTest &perf) : ItemAccess(perf) {}
+
+    virtual void call(UErrorCode * /*pErrorCode*/) {
+        for(int32_t i=0; i<perf.itemCount; ++i) {
+            const UDataCompressPerfTest::CompressedItem &item=perf.items[i];
+            uprv_memcpy(perf.buffer.getAlias(), item.data, item.length);
+        }
+    }
+};
+
+// udata_open() uncompresses a compressed item when it is first loaded.
+class UncompressItems : public ItemAccess {
+public:
+    UncompressItems(UDataCompressPerfTest &perf) : ItemAccess(perf) {}
+
+    virtual void call(UErrorCode *pErrorCode) {
+        for(int32_t i=0; i<perf.itemCount; ++i) {
+            const UDataCompressPerfTest::CompressedItem &item=perf.items[i];
+            if(item.compressedLength>0) {
+                udata_uncompressItem(item.compressed.getAlias(), item.compressedLength,
+                                     perf.buffer.getAlias(), perf.maxItemLength, pErrorCode);
+            } else {
+                uprv_memcpy(perf.buffer.getAlias(), item.data, item.length);
+            }
+        }
+    }
+};
+
+UPerfFunction *UDataCompressPerfTest::runIndexedTest(int32_t index, UBool exec,
+                                                     const char *&name, char * /*par*/) {
+    switch(index) {
+    case 0:
+        name="copy";
+        if(exec) {
+            return new CopyItems(*this);
+        }
+        break;
+    case 1:
+        name="uncompress";
+        if(exec) {
+            return new UncompressItems(*this);
+        }
+        break;
+    default:
+        name="";
+        break;
+    }
+    return NULL;
+}
+
+int main(int argc, const char *argv[]) {
+    IcuToolErrorCode errorCode("udatacmpperf main()");
+    UDataCompressPerfTest test(argc, argv, errorCode);
+    if(errorCode.isFailure()) {
+        fprintf(stderr, "UDataCompressPerfTest() failed: %s\n", errorCode.errorName());
+        test.usage();
+        return errorCode.reset();
+    }
+    if(!test.run()) {
+        fprintf(stderr, "FAILED: Tests could not be run, please check the arguments.\n");
+        return -1;
+    }
+    return 0;
+}
@@ -53,6 +53,9 @@
     "String Scanning(char)",                  ["$p,TestStdLibScan"         , "$p,TestScan"         ],
     "String Scanning(string)",                ["$p,TestStdLibScan1"        , "$p,TestScan1"        ],
     "String Scanning(char set)",              ["$p,TestStdLibScan2"        , "$p,TestScan2"        ],
+    "Copy Construction(another string)",      ["$p,TestStdLibCopy"         , "$p,TestCopy"         ],
+    "Move Assignment(another string)",        ["$p,TestStdLibMoveAssign"   , "$p,TestMoveAssign"   ],
+    "Fast Copy(another string)",              ["$p,TestStdLibAssign2"      , "$p,TestFastCopy"     ],
 };
 
 my $dataFiles = {
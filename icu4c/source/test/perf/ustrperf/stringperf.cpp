@@ -153,6 +153,12 @@ UPerfFunction* StringPerformanceTest::runIndexedTest(int32_t index, UBool exec,
         TESTCASE(22, TestStdLibScan1);
         TESTCASE(23, TestStdLibScan2);
 
+        TESTCASE(24, TestCopy);
+        TESTCASE(25, TestMoveAssign);
+        TESTCASE(26, TestFastCopy);
+        TESTCASE(27, TestStdLibCopy);
+        TESTCASE(28, TestStdLibMoveAssign);
+
         default: 
             name = ""; 
             return NULL;
@@ -379,4 +385,47 @@ UPerfFunction* StringPerformanceTest::TestStdLibScan2()
     }
 }
 
+UPerfFunction* StringPerformanceTest::TestCopy()
+{
+    if (line_mode) {
+        return new StringPerfFunction(copy, filelines_, numLines, uselen);
+    } else {
+        return new StringPerfFunction(copy, StrBuffer, StrBufferLen, uselen);
+    }
+}
 
+UPerfFunction* StringPerformanceTest::TestMoveAssign()
+{
+    if (line_mode) {
+        return new StringPerfFunction(moveAssign, filelines_, numLines, uselen);
+    } else {
+        return new StringPerfFunction(moveAssign, StrBuffer, StrBufferLen, uselen);
+    }
+}
+
+UPerfFunction* StringPerformanceTest::TestFastCopy()
+{
+    if (line_mode) {
+        return new StringPerfFunction(fastCopy, filelines_, numLines, uselen);
+    } else {
+        return new StringPerfFunction(fastCopy, StrBuffer, StrBufferLen, uselen);
+    }
+}
+
+UPerfFunction* StringPerformanceTest::TestStdLibCopy()
+{
+    if (line_mode) {
+        return new StringPerfFunction(StdLibCopy, filelines_, numLines, uselen);
+    } else {
+        return new StringPerfFunction(StdLibCopy, StrBuffer, StrBufferLen, uselen);
+    }
+}
+
+UPerfFunction* StringPerformanceTest::TestStdLibMoveAssign()
+{
+    if (line_mode) {
+        return new StringPerfFunction(StdLibMoveAssign, filelines_, numLines, uselen);
+    } else {
+        return new StringPerfFunction(StdLibMoveAssign, StrBuffer, StrBufferLen, uselen);
+    }
+}
@@ -20,6 +20,7 @@
 #include <string.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <utility>
 
 typedef std::wstring stlstring;	
 
@@ -365,6 +366,9 @@ class StringPerformanceTest : public UPerfTest
     UPerfFunction* TestScan();
     UPerfFunction* TestScan1();
     UPerfFunction* TestScan2();
+    UPerfFunction* TestCopy();
+    UPerfFunction* TestMoveAssign();
+    UPerfFunction* TestFastCopy();
 
     UPerfFunction* TestStdLibCtor();
     UPerfFunction* TestStdLibCtor1();
@@ -378,6 +382,8 @@ class StringPerformanceTest : public UPerfTest
     UPerfFunction* TestStdLibScan();
     UPerfFunction* TestStdLibScan1();
     UPerfFunction* TestStdLibScan2();
+    UPerfFunction* TestStdLibCopy();
+    UPerfFunction* TestStdLibMoveAssign();
 
 private:
     long COUNT_;
@@ -429,6 +435,23 @@ inline void assign2(const UChar* src,int32_t srcLen, UnicodeString s0)
     unistr = s0;
 }
 
+// Short strings are copied and moved within the UnicodeString object,
+// without heap allocation; see UNISTR_OBJECT_SIZE.
+inline void copy(const UChar* src,int32_t srcLen, UnicodeString s0)
+{
+    UnicodeString e(s0);
+}
+
+inline void moveAssign(const UChar* src,int32_t srcLen, UnicodeString s0)
+{
+    unistr = std::move(s0);
+}
+
+inline void fastCopy(const UChar* src,int32_t srcLen, UnicodeString s0)
+{
+    unistr.fastCopyFrom(s0);
+}
+
 inline void getch(const UChar* src,int32_t srcLen, UnicodeString s0)
 {
     s0.charAt(0);
@@ -518,6 +541,16 @@ inline void StdLibAssign2(const wchar_t* src,int32_t srcLen, stlstring s0)
     stlstr=s0;
 }
 
+inline void StdLibCopy(const wchar_t* src,int32_t srcLen, stlstring s0)
+{
+    stlstring e(s0);
+}
+
+inline void StdLibMoveAssign(const wchar_t* src,int32_t srcLen, stlstring s0)
+{
+    stlstr = std::move(s0);
+}
+
 inline void StdLibGetch(const wchar_t* src,int32_t srcLen, stlstring s0)
 {
     s0.at(0);
@@ -328,11 +328,52 @@ class FromUTF8 : public Command {
     int32_t input8Length;
 };
 
+// Test u_strToUTF8() of the whole input, independent of the --charset.
+class StrToUTF8 : public UPerfFunction {
+public:
+    StrToUTF8(const UtfPerformanceTest &testcase)
+            : input(testcase.getBuffer()), inputLength(testcase.getBufferLen()) {}
+    virtual void call(UErrorCode* pErrorCode){
+        u_strToUTF8(intermediate, OUTPUT_CAPACITY, &encodedLength,
+                    input, inputLength, pErrorCode);
+        if(U_SUCCESS(*pErrorCode) && encodedLength!=utf8Length) {
+            fprintf(stderr, "error: u_strToUTF8() length %d!=%d\n", encodedLength, utf8Length);
+            *pErrorCode=U_INTERNAL_PROGRAM_ERROR;
+        }
+    }
+    virtual long getOperationsPerIteration(){
+        return countInputCodePoints;
+    }
+private:
+    const UChar *input;
+    int32_t inputLength;
+};
+
+// Test u_strFromUTF8() of the whole input, independent of the --charset.
+class StrFromUTF8 : public UPerfFunction {
+public:
+    StrFromUTF8(const UtfPerformanceTest &testcase) : inputLength(testcase.getBufferLen()) {}
+    virtual void call(UErrorCode* pErrorCode){
+        u_strFromUTF8(output, OUTPUT_CAPACITY, &outputLength, utf8, utf8Length, pErrorCode);
+        if(U_SUCCESS(*pErrorCode) && outputLength!=inputLength) {
+            fprintf(stderr, "error: u_strFromUTF8() length %d!=%d\n", outputLength, inputLength);
+            *pErrorCode=U_INTERNAL_PROGRAM_ERROR;
+        }
+    }
+    virtual long getOperationsPerIteration(){
+        return countInputCodePoints;
+    }
+private:
+    int32_t inputLength;
+};
+
 UPerfFunction* UtfPerformanceTest::runIndexedTest(int32_t index, UBool exec, const char* &name, char* par) {
     switch (index) {
         case 0: name = "Roundtrip";     if (exec) return Roundtrip::get(*this); break;
         case 1: name = "FromUnicode";   if (exec) return FromUnicode::get(*this); break;
         case 2: name = "FromUTF8";      if (exec) return FromUTF8::get(*this); break;
+        case 3: name = "StrToUTF8";     if (exec) return new StrToUTF8(*this); break;
+        case 4: name = "StrFromUTF8";   if (exec) return new StrFromUTF8(*this); break;
         default: name = ""; break;
     }
     return NULL;
@@ -19,4 +19,6 @@ rem %PERF% CheckFCDAlwaysGet  -f \temp\udhr\%%f -v -e UTF-8 --passes 3 --iterati
 rem %PERF% CheckFCDUTF8       -f \temp\udhr\%%f -v -e UTF-8 --passes 3 --iterations 30000
     %PERF% ToNFC              -f \temp\udhr\%%f -v -e UTF-8 --passes 3 --iterations 30000
     %PERF% GetBiDiClass       -f \temp\udhr\%%f -v -e UTF-8 --passes 3 --iterations 30000
+    %PERF% ToLowerChar        -f \temp\udhr\%%f -v -e UTF-8 --passes 3 --iterations 30000
+    %PERF% FoldCase           -f \temp\udhr\%%f -v -e UTF-8 --passes 3 --iterations 30000
 )
@@ -15,13 +15,14 @@
  *  created on: 2008sep07
  *  created by: Markus W. Scherer
  *
- *  Performance test program for UTrie2.
+ *  Performance test program for UTrie2 and UCPTrie property lookups.
  */
 
 #include <stdio.h>
 #include <stdlib.h>
 #include "unicode/uchar.h"
 #include "unicode/unorm.h"
+#include "unicode/ustring.h"
 #include "unicode/uperf.h"
 #include "uoptions.h"
 
@@ -229,14 +230,71 @@ class GetBiDiClass : public Command {
     }
 };
 
+class ToLowerChar : public Command {
+protected:
+    ToLowerChar(const UTrie2PerfTest &testcase) : Command(testcase) {}
+public:
+    static UPerfFunction* get(const UTrie2PerfTest &testcase) {
+        return new ToLowerChar(testcase);
+    }
+    virtual void call(UErrorCode* pErrorCode) {
+        const UChar *buffer=testcase.getBuffer();
+        int32_t length=testcase.getBufferLen();
+        UChar32 c;
+        int32_t i;
+        uint32_t sum=0;
+        for(i=0; i<length;) {
+            U16_NEXT(buffer, i, length, c);
+            sum+=(uint32_t)u_tolower(c);
+        }
+        if(length>0 && sum==0) {
+            fprintf(stderr, "error: ToLowerChar() did not sum up the code points\n");
+        }
+    }
+};
+
+class FoldCase : public Command {
+protected:
+    FoldCase(const UTrie2PerfTest &testcase) : Command(testcase) {
+        UErrorCode errorCode=U_ZERO_ERROR;
+        destCapacity=u_strFoldCase(NULL, 0,
+                                   testcase.getBuffer(), testcase.getBufferLen(),
+                                   U_FOLD_CASE_DEFAULT, &errorCode);
+        dest=new UChar[destCapacity];
+    }
+    ~FoldCase() {
+        delete [] dest;
+    }
+public:
+    static UPerfFunction* get(const UTrie2PerfTest &testcase) {
+        return new FoldCase(testcase);
+    }
+    virtual void call(UErrorCode* pErrorCode) {
+        UErrorCode errorCode=U_ZERO_ERROR;
+        int32_t destLength=u_strFoldCase(dest, destCapacity,
+                                         testcase.getBuffer(), testcase.getBufferLen(),
+                                         U_FOLD_CASE_DEFAULT, &errorCode);
+        if(U_FAILURE(errorCode) || destLength!=destCapacity) {
+            fprintf(stderr, "error: u_strFoldCase() failed: %s\n",
+                    u_errorName(errorCode));
+        }
+    }
+
+private:
+    UChar *dest;
+    int32_t destCapacity;
+};
+
 UPerfFunction* UTrie2PerfTest::runIndexedTest(int32_t index, UBool exec, const char* &name, char* par) {
     switch (index) {
         case 0: name = "CheckFCD";              if (exec) return CheckFCD::get(*this); break;
         case 1: name = "ToNFC";                 if (exec) return ToNFC::get(*this); break;
         case 2: name = "GetBiDiClass";          if (exec) return GetBiDiClass::get(*this); break;
+        case 3: name = "ToLowerChar";           if (exec) return ToLowerChar::get(*this); break;
+        case 4: name = "FoldCase";              if (exec) return FoldCase::get(*this); break;
 #if 0  // See comment at unorm_initUTrie2() forward declaration.
-        case 3: name = "CheckFCDAlwaysGet";     if (exec) return CheckFCDAlwaysGet::get(*this); break;
-        case 4: name = "CheckFCDUTF8";          if (exec) return CheckFCDUTF8::get(*this); break;
+        case 5: name = "CheckFCDAlwaysGet";     if (exec) return CheckFCDAlwaysGet::get(*this); break;
+        case 6: name = "CheckFCDUTF8";          if (exec) return CheckFCDUTF8::get(*this); break;
 #endif
         default: name = ""; break;
     }
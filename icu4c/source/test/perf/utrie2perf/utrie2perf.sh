@@ -25,4 +25,6 @@ for file in udhr_eng.txt \
 # $PERF CheckFCDUTF8        -f ~/udhr/$file -v -e UTF-8 --passes 3 --iterations 30000
   $PERF ToNFC               -f ~/udhr/$file -v -e UTF-8 --passes 3 --iterations 30000
   $PERF GetBiDiClass        -f ~/udhr/$file -v -e UTF-8 --passes 3 --iterations 30000
+  $PERF ToLowerChar         -f ~/udhr/$file -v -e UTF-8 --passes 3 --iterations 30000
+  $PERF FoldCase            -f ~/udhr/$file -v -e UTF-8 --passes 3 --iterations 30000
 done
@@ -93,6 +93,15 @@ def generate_rb(config, glob, common_vars):
             args = "-s {IN_DIR} -d {OUT_DIR} -i {OUT_DIR} "
                 "--filterDir {IN_DIR}/filters filtertest.txt",
             format_with = {}
+        ),
+        SingleExecutionRequest(
+            name = "tablehash",
+            category = "tests",
+            input_files = [InFile("tablehash.txt")],
+            output_files = [OutFile("tablehash.res")],
+            tool = IcuTool("genrb"),
+            args = "-s {IN_DIR} -d {OUT_DIR} --tableHashes 16 {INPUT_FILES[0]}",
+            format_with = {}
         )
     ]
 
@@ -164,6 +164,13 @@ class T_CTEST_EXPORT_API UPerfTest {
 
     virtual UBool callTest( UPerfTest& testToBeCalled, char* par );
 
+    /**
+     * Appends one JSON object with the statistics of a test's timed passes
+     * as a single line to the --json file.
+     */
+    void writeJSONRecord(const char* name, int32_t loops, long ops, long events,
+                         const double* times, int32_t count);
+
     int32_t      _argc;
     const char** _argv;
     const char * _addUsage;
@@ -184,6 +191,9 @@ class T_CTEST_EXPORT_API UPerfTest {
     int32_t      passes;
     int32_t      iterations;
     int32_t      time;
+    int32_t      warmup;
+    int32_t      threads;
+    const char*  jsonFileName;
     const char*  locale;
 private:
     UPerfTest*   caller;
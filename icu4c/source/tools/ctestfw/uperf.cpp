@@ -13,13 +13,116 @@
 #include "unicode/uperf.h"
 #include "uoptions.h"
 #include "cmemory.h"
+#include <algorithm>
 #include <stdio.h>
 #include <stdlib.h>
+#include <thread>
+#include <vector>
 
 #if !UCONFIG_NO_CONVERSION
 
 UPerfFunction::~UPerfFunction() {}
 
+namespace {
+
+//
+// Runs copies of a test function on several threads at once.
+// Each thread times its own copy; the elapsed time is the wall-clock time
+// until all of them are done, and the operations are those of all copies,
+// so with enough cores the time per operation goes down as threads are added.
+//
+class MultiThreadedFunction : public UPerfFunction {
+public:
+    MultiThreadedFunction(std::vector<UPerfFunction*> &adopted) {
+        fns.swap(adopted);
+    }
+
+    virtual ~MultiThreadedFunction() {
+        for (UPerfFunction *fn : fns) {
+            delete fn;
+        }
+    }
+
+    virtual void call(UErrorCode* status) {
+        time(1, status);
+    }
+
+    virtual long getOperationsPerIteration() {
+        long ops = 0;
+        for (UPerfFunction *fn : fns) {
+            ops += fn->getOperationsPerIteration();
+        }
+        return ops;
+    }
+
+    virtual long getEventsPerIteration() {
+        long events = 0;
+        for (UPerfFunction *fn : fns) {
+            long n = fn->getEventsPerIteration();
+            if (n < 0) {
+                return n;
+            }
+            events += n;
+        }
+        return events;
+    }
+
+    virtual double time(int32_t n, UErrorCode* status) {
+        if (U_FAILURE(*status)) {
+            return 0;
+        }
+        std::vector<UErrorCode> statuses(fns.size(), U_ZERO_ERROR);
+        std::vector<std::thread> threads;
+        UTimer start, stop;
+        utimer_getTime(&start);
+        for (size_t i = 1; i < fns.size(); ++i) {
+            threads.emplace_back([this, &statuses, i, n]() { fns[i]->time(n, &statuses[i]); });
+        }
+        fns[0]->time(n, &statuses[0]);
+        for (std::thread &t : threads) {
+            t.join();
+        }
+        utimer_getTime(&stop);
+        for (UErrorCode errorCode : statuses) {
+            if (U_FAILURE(errorCode)) {
+                *status = errorCode;
+                break;
+            }
+        }
+        return utimer_getDeltaSeconds(&start, &stop);
+    }
+
+private:
+    std::vector<UPerfFunction*> fns;
+};
+
+void writeJSONString(FILE *f, const char *s) {
+    if (s == NULL) {
+        fputs("null", f);
+        return;
+    }
+    fputc('"', f);
+    for (; *s != 0; ++s) {
+        unsigned char c = (unsigned char)*s;
+        if (c == '"' || c == '\\') {
+            fprintf(f, "\\%c", c);
+        } else if (c < 0x20) {
+            fprintf(f, "\\u%04x", c);
+        } else {
+            fputc(c, f);
+        }
+    }
+    fputc('"', f);
+}
+
+// Nearest-rank percentile of sorted values.
+double percentile(const double *sorted, int32_t count, int32_t percent) {
+    int32_t rank = (count * percent + 99) / 100;
+    return sorted[rank > 0 ? rank - 1 : 0];
+}
+
+}  // namespace
+
 static const char delim = '/';
 static int32_t execCount = 0;
 UPerfTest* UPerfTest::gTest = NULL;
@@ -43,7 +146,12 @@ const char UPerfTest::gUsageString[] =
     "\t-l or --line-mode    The data file should be processed in line mode\n"
     "\t-b or --bulk-mode    The data file should be processed in file based.\n"
     "\t                     Cannot be used with --line-mode\n"
-    "\t-L or --locale       Locale for the test\n";
+    "\t-L or --locale       Locale for the test\n"
+    "\t--warmup             Number of untimed passes before the timed ones. Requires Numeric argument.\n"
+    "\t--threads            Run each test on this many threads at once, with one copy of the test\n"
+    "\t                     function per thread. Times are wall-clock times, operations are summed.\n"
+    "\t--json               Append one line of JSON per test with the statistics of its passes\n"
+    "\t                     to the file given as the argument.\n";
 
 enum
 {
@@ -60,6 +168,9 @@ enum
     LINE_MODE,
     BULK_MODE,
     LOCALE,
+    WARMUP,
+    THREADS,
+    JSON,
     OPTIONS_COUNT
 };
 
@@ -77,7 +188,10 @@ static UOption options[OPTIONS_COUNT+20]={
     UOPTION_DEF( "time",          't', UOPT_REQUIRES_ARG),
     UOPTION_DEF( "line-mode",     'l', UOPT_NO_ARG),
     UOPTION_DEF( "bulk-mode",     'b', UOPT_NO_ARG),
-    UOPTION_DEF( "locale",        'L', UOPT_REQUIRES_ARG)
+    UOPTION_DEF( "locale",        'L', UOPT_REQUIRES_ARG),
+    UOPTION_DEF( "warmup",        '\x01', UOPT_REQUIRES_ARG),
+    UOPTION_DEF( "threads",       '\x01', UOPT_REQUIRES_ARG),
+    UOPTION_DEF( "json",          '\x01', UOPT_REQUIRES_ARG)
 };
 
 UPerfTest::UPerfTest(int32_t argc, const char* argv[], UErrorCode& status)
@@ -89,6 +203,7 @@ UPerfTest::UPerfTest(int32_t argc, const char* argv[], UErrorCode& status)
           buffer(NULL), bufferLen(0),
           verbose(FALSE), bulk_mode(FALSE),
           passes(1), iterations(0), time(0),
+          warmup(0), threads(1), jsonFileName(NULL),
           locale(NULL) {
     init(NULL, 0, status);
 }
@@ -105,6 +220,7 @@ UPerfTest::UPerfTest(int32_t argc, const char* argv[],
           buffer(NULL), bufferLen(0),
           verbose(FALSE), bulk_mode(FALSE),
           passes(1), iterations(0), time(0),
+          warmup(0), threads(1), jsonFileName(NULL),
           locale(NULL) {
     init(addOptions, addOptionsCount, status);
 }
@@ -186,6 +302,22 @@ void UPerfTest::init(UOption addOptions[], int32_t addOptionsCount,
         locale = options[LOCALE].value;
     }
 
+    if(options[WARMUP].doesOccur) {
+        warmup = atoi(options[WARMUP].value);
+    }
+
+    if(options[THREADS].doesOccur) {
+        threads = atoi(options[THREADS].value);
+        if(threads < 1) {
+            status = U_ILLEGAL_ARGUMENT_ERROR;
+            return;
+        }
+    }
+
+    if(options[JSON].doesOccur) {
+        jsonFileName = options[JSON].value;
+    }
+
     int32_t len = 0;
     if(fileName!=NULL){
         //pre-flight
@@ -369,6 +501,24 @@ UBool UPerfTest::runTestLoop( char* testname, char* par )
                 fprintf(stderr,"%s function returned NULL", name);
                 return FALSE;
             }
+            if(threads > 1) {
+                // Create all copies before any thread starts, so that
+                // lazily initialized test data is complete when they share it.
+                std::vector<UPerfFunction*> fns;
+                fns.push_back(testFunction);
+                for(int32_t i = 1; i < threads; ++i) {
+                    UPerfFunction* copy = this->runIndexedTest( index, TRUE, name, par );
+                    if(copy==NULL){
+                        fprintf(stderr,"%s function returned NULL", name);
+                        for (UPerfFunction *fn : fns) {
+                            delete fn;
+                        }
+                        return FALSE;
+                    }
+                    fns.push_back(copy);
+                }
+                testFunction = new MultiThreadedFunction(fns);
+            }
             ops = testFunction->getOperationsPerIteration();
             if (ops < 1) {
                 fprintf(stderr, "%s returned an illegal operations/iteration()\n", name);
@@ -408,10 +558,15 @@ UBool UPerfTest::runTestLoop( char* testname, char* par )
                 loops = iterations;
             }
 
+            for(int32_t ws = 0; ws < warmup && U_SUCCESS(status); ws++) {
+                testFunction->time(loops, &status);
+            }
+
             double min_t=1000000.0, sum_t=0.0;
             long events = -1;
+            std::vector<double> times;
 
-            for(int32_t ps =0; ps < passes; ps++){
+            for(int32_t ps =0; ps < passes && U_SUCCESS(status); ps++){
                 fprintf(stdout,"= %s begin " ,name);
                 if(verbose==TRUE){
                     if(iterations > 0) {
@@ -427,6 +582,7 @@ UBool UPerfTest::runTestLoop( char* testname, char* par )
                     printf("Performance test failed with error: %s \n", u_errorName(status));
                     break;
                 }
+                times.push_back(t);
                 sum_t+=t;
                 if(t<min_t) {
                     min_t=t;
@@ -465,6 +621,9 @@ UBool UPerfTest::runTestLoop( char* testname, char* par )
                             name, min_t, (int)loops, (min_t*1E9)/(loops*ops), (min_t*1E9)/(loops*events));
                 }
             }
+            if(jsonFileName != NULL && U_SUCCESS(status) && !times.empty()) {
+                writeJSONRecord(name, loops, ops, events, times.data(), (int32_t)times.size());
+            }
             delete testFunction;
         }
         index++;
@@ -474,6 +633,52 @@ UBool UPerfTest::runTestLoop( char* testname, char* par )
     return rval;
 }
 
+void UPerfTest::writeJSONRecord(const char* name, int32_t loops, long ops, long events,
+                                const double* times, int32_t count) {
+    FILE* f = fopen(jsonFileName, "a");
+    if(f == NULL) {
+        fprintf(stderr, "Could not open %s for writing\n", jsonFileName);
+        return;
+    }
+    std::vector<double> sorted(times, times + count);
+    std::sort(sorted.begin(), sorted.end());
+    double sum = 0;
+    for(int32_t i = 0; i < count; ++i) {
+        sum += times[i];
+    }
+    double nsPerOp = 1E9 / ((double)loops * ops);
+
+    const char* program = _argv[0];
+    for(const char* p = program; *p != 0; ++p) {
+        if(*p == '/' || *p == '\\') {
+            program = p + 1;
+        }
+    }
+    fputs("{\"program\": ", f);
+    writeJSONString(f, program);
+    fputs(", \"test\": ", f);
+    writeJSONString(f, name);
+    fputs(", \"locale\": ", f);
+    writeJSONString(f, locale);
+    fputs(", \"file\": ", f);
+    writeJSONString(f, fileName);
+    fprintf(f, ", \"threads\": %d, \"warmup\": %d, \"loops\": %d, \"operations\": %ld",
+            (int)threads, (int)warmup, (int)loops, ops);
+    if(events >= 0) {
+        fprintf(f, ", \"events\": %ld", events);
+    }
+    fputs(", \"seconds\": [", f);
+    for(int32_t i = 0; i < count; ++i) {
+        fprintf(f, i == 0 ? "%.6g" : ", %.6g", times[i]);
+    }
+    fprintf(f, "], \"min\": %.6g, \"median\": %.6g, \"p90\": %.6g, \"max\": %.6g, \"mean\": %.6g",
+            sorted[0], percentile(sorted.data(), count, 50), percentile(sorted.data(), count, 90),
+            sorted[count - 1], sum / count);
+    fprintf(f, ", \"min_ns_per_op\": %.6g, \"median_ns_per_op\": %.6g}\n",
+            sorted[0] * nsPerOp, percentile(sorted.data(), count, 50) * nsPerOp);
+    fclose(f);
+}
+
 /**
 * Print a usage message for this test class.
 */
@@ -71,7 +71,10 @@ enum {
   kOptMatchArch,
 #endif
   kOptFilename,
-  kOptAssembly
+  kOptAssembly,
+#ifdef CAN_GENERATE_OBJECTS
+  kOptAlign,
+#endif
 };
 
 static UOption options[]={
@@ -86,7 +89,10 @@ static UOption options[]={
      UOPTION_DEF("match-arch", 'm', UOPT_REQUIRES_ARG),
 #endif
      UOPTION_DEF("filename", 'f', UOPT_REQUIRES_ARG),
-     UOPTION_DEF("assembly", 'a', UOPT_REQUIRES_ARG)
+     UOPTION_DEF("assembly", 'a', UOPT_REQUIRES_ARG),
+#ifdef CAN_GENERATE_OBJECTS
+     UOPTION_DEF("align", '\x01', UOPT_REQUIRES_ARG),
+#endif
 };
 
 #define CALL_WRITECCODE     'c'
@@ -127,7 +133,9 @@ main(int argc, char* argv[]) {
         fprintf(stderr,
             "\t-o or --object      write a .obj file instead of .c\n"
             "\t-m or --match-arch file.o  match the architecture (CPU, 32/64 bits) of the specified .o\n"
-            "\t                    ELF format defaults to i386. Windows defaults to the native platform.\n");
+            "\t                    Defaults to the native platform, or to i386 if it is not known.\n"
+            "\t--align n           for --object: align the data to n bytes (a power of 2, default 16);\n"
+            "\t                    for example, --align 2097152 allows mapping the data with 2MB pages\n");
 #endif
         fprintf(stderr,
             "\t-f or --filename    Specify an alternate base filename. (default: symbolname_typ)\n"
@@ -192,6 +200,7 @@ main(int argc, char* argv[]) {
                                 options[kOptEntryPoint].doesOccur ? options[kOptEntryPoint].value : NULL,
                                 options[kOptMatchArch].doesOccur ? options[kOptMatchArch].value : NULL,
                                 options[kOptFilename].doesOccur ? options[kOptFilename].value : NULL,
+                                options[kOptAlign].doesOccur ? (uint32_t)strtoul(options[kOptAlign].value, NULL, 0) : 0,
                                 NULL,
                                 0);
                 break;
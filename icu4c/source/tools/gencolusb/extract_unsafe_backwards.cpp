@@ -14,6 +14,8 @@
 #include "collationroot.h"
 #include "collationtailoring.h"
 
+U_NAMESPACE_USE
+
 /**
  * Define the type of generator to use. Choose one.
  */
@@ -15,6 +15,7 @@
 
 #include "collunsafe.h"
 
+U_NAMESPACE_USE
 
 int main(int argc, const char *argv[]) {
   puts("verify");
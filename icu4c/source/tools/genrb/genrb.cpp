@@ -84,7 +84,9 @@ enum
     WRITE_POOL_BUNDLE,
     USE_POOL_BUNDLE,
     INCLUDE_UNIHAN_COLL,
-    FILTERDIR
+    FILTERDIR,
+    TABLE_HASHES,
+    SKIP_UNCHANGED
 };
 
 UOption options[]={
@@ -111,6 +113,8 @@ UOption options[]={
                       UOPTION_DEF("usePoolBundle", '\x01', UOPT_OPTIONAL_ARG),/* 20 */
                       UOPTION_DEF("includeUnihanColl", '\x01', UOPT_NO_ARG),/* 21 */ /* temporary, don't display in usage info */
                       UOPTION_DEF("filterDir", '\x01', UOPT_OPTIONAL_ARG), /* 22 */
+                      UOPTION_DEF("tableHashes", '\x01', UOPT_OPTIONAL_ARG), /* 23 */
+                      UOPTION_DEF("skipUnchanged", '\x01', UOPT_NO_ARG), /* 24 */
                   };
 
 static     UBool       write_java = FALSE;
@@ -167,6 +171,19 @@ main(int argc,
         }
     }
 
+    if(options[TABLE_HASHES].doesOccur) {
+        int32_t minLength = 32;
+        if(options[TABLE_HASHES].value != NULL) {
+            char *end;
+            minLength = (int32_t)uprv_strtol(options[TABLE_HASHES].value, &end, 10);
+            if(*end != 0 || minLength <= 0) {
+                fprintf(stderr, "%s: unsupported --tableHashes %s\n", argv[0], options[TABLE_HASHES].value);
+                illegalArg = TRUE;
+            }
+        }
+        setTableHashMinLength(minLength);
+    }
+
     if((options[JAVA_PACKAGE].doesOccur || options[BUNDLE_NAME].doesOccur) &&
             !options[WRITE_JAVA].doesOccur) {
         fprintf(stderr,
@@ -241,6 +258,13 @@ main(int argc,
         fprintf(stderr,
                 "\t      --filterDir          Input directory where filter files are available.\n"
                 "\t                           For more on filter files, see ICU Data Build Tool.\n");
+        fprintf(stderr,
+                "\t      --tableHashes [n]    write a perfect-hash index for each table with at least n items\n"
+                "\t                           (default 32) for faster lookups by key; formatVersion 2 and up;\n"
+                "\t                           readers without support for the index ignore it\n");
+        fprintf(stderr,
+                "\t      --skipUnchanged      do not rewrite .res files whose contents are unchanged;\n"
+                "\t                           they keep their timestamps so that dependent build steps can be skipped\n");
 
         return illegalArg ? U_ILLEGAL_ARGUMENT_ERROR : U_ZERO_ERROR;
     }
@@ -258,6 +282,9 @@ main(int argc,
     if(options[COPYRIGHT].doesOccur){
         setIncludeCopyright(TRUE);
     }
+    if(options[SKIP_UNCHANGED].doesOccur) {
+        setSkipUnchanged(TRUE);
+    }
 
     if(options[SOURCEDIR].doesOccur) {
         inputDir = options[SOURCEDIR].value;
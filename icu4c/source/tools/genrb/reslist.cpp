@@ -27,6 +27,7 @@
 #   define UNISTR_FROM_STRING_EXPLICIT explicit
 #endif
 
+#include <algorithm>
 #include <assert.h>
 #include <iostream>
 #include <set>
@@ -72,6 +73,8 @@ U_NAMESPACE_USE
 
 static UBool gIncludeCopyright = FALSE;
 static UBool gUsePoolBundle = FALSE;
+static int32_t gTableHashMinLength = 0;
+static UBool gSkipUnchanged = FALSE;
 static UBool gIsDefaultFormatVersion = TRUE;
 static int32_t gFormatVersion = 3;
 
@@ -142,6 +145,14 @@ void setUsePoolBundle(UBool use) {
     gUsePoolBundle = use;
 }
 
+void setTableHashMinLength(int32_t minLength) {
+    gTableHashMinLength = minLength;
+}
+
+void setSkipUnchanged(UBool skip) {
+    gSkipUnchanged = skip;
+}
+
 // TODO: return const pointer, or find another way to express "none"
 struct SResource* res_none() {
     return &kNoResource;
@@ -934,6 +945,12 @@ void SRBRoot::write(const char *outputDir, const char *outputPkg,
     /* total size including the root item */
     top = byteOffset;
 
+    /* optional table hash indexes after the resources */
+    std::vector<int32_t> tableHashes;
+    if (gTableHashMinLength > 0 && formatVersion > 1) {
+        buildTableHashes(tableHashes);
+    }
+
     if (writtenFilename && writtenFilenameLen) {
         *writtenFilename = 0;
     }
@@ -990,8 +1007,12 @@ void SRBRoot::write(const char *outputDir, const char *outputPkg,
 
     uprv_memcpy(dataInfo.formatVersion, gFormatVersions + formatVersion, sizeof(UVersionInfo));
 
-    mem = udata_create(outputDir, "res", dataName,
-                       &dataInfo, (gIncludeCopyright==TRUE)? U_COPYRIGHT_STRING:NULL, &errorCode);
+    const char *comment = (gIncludeCopyright==TRUE)? U_COPYRIGHT_STRING:NULL;
+    if (gSkipUnchanged) {
+        mem = udata_createIfChanged(outputDir, "res", dataName, &dataInfo, comment, &errorCode);
+    } else {
+        mem = udata_create(outputDir, "res", dataName, &dataInfo, comment, &errorCode);
+    }
     if(U_FAILURE(errorCode)){
         return;
     }
@@ -1008,7 +1029,7 @@ void SRBRoot::write(const char *outputDir, const char *outputPkg,
     indexes[URES_INDEX_LENGTH]=             fIndexLength;
     indexes[URES_INDEX_KEYS_TOP]=           fKeysTop>>2;
     indexes[URES_INDEX_RESOURCES_TOP]=      (int32_t)(top>>2);
-    indexes[URES_INDEX_BUNDLE_TOP]=         indexes[URES_INDEX_RESOURCES_TOP];
+    indexes[URES_INDEX_BUNDLE_TOP]=         indexes[URES_INDEX_RESOURCES_TOP] + (int32_t)tableHashes.size();
     indexes[URES_INDEX_MAX_TABLE_LENGTH]=   fMaxTableLength;
 
     /*
@@ -1057,6 +1078,9 @@ void SRBRoot::write(const char *outputDir, const char *outputPkg,
             indexes[URES_INDEX_POOL_CHECKSUM] = fUsePoolBundle->fChecksum;
         }
     }
+    if (!tableHashes.empty()) {
+        indexes[URES_INDEX_ATTRIBUTES] |= URES_ATT_TABLE_HASHES;
+    }
     // formatVersion 3 (ICU 56):
     // share string values via pool bundle strings
     indexes[URES_INDEX_LENGTH] |= fPoolStringIndexLimit << 8;  // bits 23..0 -> 31..8
@@ -1078,6 +1102,12 @@ void SRBRoot::write(const char *outputDir, const char *outputPkg,
     fRoot->write(mem, &byteOffset);
     assert(byteOffset == top);
 
+    /* write the table hash indexes */
+    if (!tableHashes.empty()) {
+        udata_writeBlock(mem, tableHashes.data(), (int32_t)tableHashes.size() * 4);
+        top += (uint32_t)tableHashes.size() * 4;
+    }
+
     size = udata_finish(mem, &errorCode);
     if(top != size) {
         fprintf(stderr, "genrb error: wrote %u bytes but counted %u\n",
@@ -1352,6 +1382,133 @@ void ContainerResource::collectKeys(std::function<void(int32_t)> collector) cons
     }
 }
 
+void SResource::collectTables(std::function<void(const TableResource &)> /*collector*/) const {
+}
+
+void ContainerResource::collectTables(std::function<void(const TableResource &)> collector) const {
+    for (SResource* curr = fFirst; curr != NULL; curr = curr->fNext) {
+        curr->collectTables(collector);
+    }
+}
+
+void TableResource::collectTables(std::function<void(const TableResource &)> collector) const {
+    collector(*this);
+    ContainerResource::collectTables(collector);
+}
+
+namespace {
+
+/*
+ * Builds a minimal perfect hash ("hash, displace and compress" without the compression)
+ * for the keys of one table: bucketCount, seeds[bucketCount], items[count].
+ * Returns FALSE if no seeds were found.
+ */
+UBool buildTableHash(const std::vector<const char *> &keys, std::vector<int32_t> &block) {
+    const int32_t kMaxSeed = 0x100000;
+    uint32_t count = (uint32_t)keys.size();
+    for (uint32_t bucketCount = (count + 3) / 4;; bucketCount *= 2) {
+        if (bucketCount > count) {
+            bucketCount = count;
+        }
+        std::vector<std::vector<int32_t>> buckets(bucketCount);
+        for (uint32_t i = 0; i < count; ++i) {
+            buckets[URES_HASH_REDUCE(res_hashTableKey(keys[i], 0), bucketCount)].push_back((int32_t)i);
+        }
+        // Place the largest buckets first, while there are many empty slots.
+        std::vector<int32_t> order(bucketCount);
+        for (uint32_t b = 0; b < bucketCount; ++b) {
+            order[b] = (int32_t)b;
+        }
+        std::stable_sort(order.begin(), order.end(), [&buckets](int32_t a, int32_t b) {
+            return buckets[a].size() > buckets[b].size();
+        });
+        std::vector<int32_t> seeds(bucketCount, 0);
+        std::vector<int32_t> items(count, -1);
+        std::vector<uint32_t> slots;
+        UBool success = TRUE;
+        for (int32_t b : order) {
+            const std::vector<int32_t> &bucket = buckets[b];
+            if (bucket.empty()) {
+                break;
+            }
+            int32_t seed;
+            for (seed = 1; seed < kMaxSeed; ++seed) {
+                slots.clear();
+                for (int32_t i : bucket) {
+                    uint32_t slot = URES_HASH_REDUCE(res_hashTableKey(keys[i], (uint32_t)seed), count);
+                    if (items[slot] >= 0 ||
+                            std::find(slots.begin(), slots.end(), slot) != slots.end()) {
+                        break;
+                    }
+                    slots.push_back(slot);
+                }
+                if (slots.size() == bucket.size()) {
+                    break;
+                }
+            }
+            if (seed == kMaxSeed) {
+                success = FALSE;
+                break;
+            }
+            seeds[b] = seed;
+            for (size_t j = 0; j < bucket.size(); ++j) {
+                items[slots[j]] = bucket[j];
+            }
+        }
+        if (success) {
+            block.push_back((int32_t)bucketCount);
+            block.insert(block.end(), seeds.begin(), seeds.end());
+            block.insert(block.end(), items.begin(), items.end());
+            return TRUE;
+        }
+        if (bucketCount == count) {
+            return FALSE;
+        }
+    }
+}
+
+}  // namespace
+
+void
+SRBRoot::buildTableHashes(std::vector<int32_t> &hashes) const {
+    std::vector<const TableResource *> tables;
+    fRoot->collectTables([&tables](const TableResource &table) {
+        if (table.fCount >= (uint32_t)gTableHashMinLength) {
+            tables.push_back(&table);
+        }
+    });
+    if (tables.empty()) {
+        return;
+    }
+    int32_t directoryLength = 1;
+    while (directoryLength < 2 * (int32_t)tables.size()) {
+        directoryLength *= 2;
+    }
+    hashes.assign(URES_TABLE_HASHES_DIRECTORY + 2 * directoryLength, 0);
+    hashes[URES_TABLE_HASHES_CHARSET_FAMILY] = U_CHARSET_FAMILY;
+    hashes[URES_TABLE_HASHES_MIN_LENGTH] = gTableHashMinLength;
+    hashes[URES_TABLE_HASHES_DIRECTORY_LENGTH] = directoryLength;
+    std::vector<const char *> keys;
+    std::vector<int32_t> block;
+    for (const TableResource *table : tables) {
+        keys.clear();
+        for (SResource *current = table->fFirst; current != NULL; current = current->fNext) {
+            keys.push_back(current->getKeyString(this));
+        }
+        block.clear();
+        if (!buildTableHash(keys, block)) {
+            continue;  // The reader falls back to a binary search.
+        }
+        int32_t i = (int32_t)((table->fRes * 0x9e3779b9u) >> 16) & (directoryLength - 1);
+        while (hashes[URES_TABLE_HASHES_DIRECTORY + 2 * i] != 0) {
+            i = (i + 1) & (directoryLength - 1);
+        }
+        hashes[URES_TABLE_HASHES_DIRECTORY + 2 * i] = (int32_t)table->fRes;
+        hashes[URES_TABLE_HASHES_DIRECTORY + 2 * i + 1] = (int32_t)hashes.size();
+        hashes.insert(hashes.end(), block.begin(), block.end());
+    }
+}
+
 void
 SRBRoot::compactKeys(UErrorCode &errorCode) {
     KeyMapEntry *map;
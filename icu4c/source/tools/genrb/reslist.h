@@ -24,6 +24,7 @@
 #define RESLIST_MAX_INT_VECTOR 2048
 
 #include <functional>
+#include <vector>
 
 #include "unicode/utypes.h"
 #include "unicode/unistr.h"
@@ -93,6 +94,7 @@ struct SRBRoot {
 
 private:
     void compactStringsV2(UHashtable *stringSet, UErrorCode &errorCode);
+    void buildTableHashes(std::vector<int32_t> &hashes) const;
 
 public:
     // TODO: private
@@ -229,6 +231,11 @@ struct SResource {
      */
     virtual void collectKeys(std::function<void(int32_t)> collector) const;
 
+    /**
+     * Calls the given function for every table in this tree.
+     */
+    virtual void collectTables(std::function<void(const TableResource &)> collector) const;
+
     int8_t   fType;     /* nominal type: fRes (when != 0xffffffff) may use subtype */
     UBool    fWritten;  /* res_write() can exit early */
     uint32_t fRes;      /* resource item word; RES_BOGUS=0xffffffff if not known yet */
@@ -252,6 +259,8 @@ class ContainerResource : public SResource {
 
     void collectKeys(std::function<void(int32_t)> collector) const override;
 
+    void collectTables(std::function<void(const TableResource &)> collector) const override;
+
 protected:
     void writeAllRes16(SRBRoot *bundle);
     void preWriteAllRes(uint32_t *byteOffset);
@@ -280,6 +289,8 @@ class TableResource : public ContainerResource {
 
     void applyFilter(const PathFilter& filter, ResKeyPath& path, const SRBRoot* bundle) override;
 
+    void collectTables(std::function<void(const TableResource &)> collector) const override;
+
     int8_t fTableType;  // determined by table_write16() for table_preWrite() & table_write()
     SRBRoot *fRoot;
 };
@@ -438,6 +449,12 @@ int32_t getFormatVersion();
 
 void setUsePoolBundle(UBool use);
 
+/* Tables with at least this many items get a hash index; 0 for none. */
+void setTableHashMinLength(int32_t minLength);
+
+/* If TRUE, then .res files are not rewritten when their contents are unchanged. */
+void setSkipUnchanged(UBool skip);
+
 /* in wrtxml.cpp */
 uint32_t computeCRC(const char *ptr, uint32_t len, uint32_t lastcrc);
 
@@ -46,6 +46,7 @@ static UOption options[]={
   /*5*/ UOPTION_DEF("milisecond-time", 'm', UOPT_NO_ARG),
   /*6*/ UOPTION_DEF("cleanup", 'K', UOPT_NO_ARG),
   /*7*/ UOPTION_DEF("xml", 'x', UOPT_REQUIRES_ARG),
+  /*8*/ UOPTION_DEF("property-snapshot", 'S', UOPT_REQUIRES_ARG),
 };
 
 static UErrorCode initStatus = U_ZERO_ERROR;
@@ -222,6 +223,36 @@ void cmd_listplugins() {
 }
 
 
+/** Write a snapshot of the character property structures, see u_writePropertySnapshot(). */
+void cmd_writePropertySnapshot(const char *filename, UErrorCode &errorCode) {
+    do_init();
+    int32_t length = u_writePropertySnapshot(NULL, 0, &errorCode);
+    if(errorCode == U_BUFFER_OVERFLOW_ERROR) {
+        errorCode = U_ZERO_ERROR;
+    }
+    /* uint32_t for the 4-alignment that the snapshot requires */
+    uint32_t *snapshot = (uint32_t *)uprv_malloc(length);
+    if(U_SUCCESS(errorCode) && snapshot == NULL) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+    }
+    u_writePropertySnapshot(snapshot, length, &errorCode);
+    if(U_FAILURE(errorCode)) {
+        fprintf(stderr, "ERR: u_writePropertySnapshot() failed - %s\n", u_errorName(errorCode));
+        uprv_free(snapshot);
+        return;
+    }
+    FILE *out = fopen(filename, "wb");
+    if(out == NULL || fwrite(snapshot, 1, length, out) != (size_t)length) {
+        fprintf(stderr, "ERR: can't write the property snapshot to %s\n", filename);
+        errorCode = U_FILE_ACCESS_ERROR;
+    } else {
+        printf("Wrote a %ld-byte character property snapshot to %s\n", (long)length, filename);
+    }
+    if(out != NULL) {
+        fclose(out);
+    }
+    uprv_free(snapshot);
+}
 
 extern int
 main(int argc, char* argv[]) {
@@ -247,6 +278,8 @@ main(int argc, char* argv[]) {
 #if UCONFIG_ENABLE_PLUGINS
               " -L         or  --list-plugins     - List and diagnose issues with ICU Plugins\n"
 #endif
+              " -S <file>  or  --property-snapshot <file> - Write a snapshot of the character property\n"
+              "                                     structures for u_setPropertySnapshot()\n"
               " -K         or  --cleanup          - Call u_cleanup() before exitting (will attempt to unload plugins)\n"
               "\n"
               "If no arguments are given, the tool will print ICU version and configuration information.\n"
@@ -286,6 +319,11 @@ main(int argc, char* argv[]) {
       didSomething = TRUE;
     }
 
+    if(options[8].doesOccur) {
+      cmd_writePropertySnapshot(options[8].value, errorCode);
+      didSomething = TRUE;
+    }
+
     if(options[6].doesOccur) {  /* 2nd part of version: cleanup */
       cmd_cleanup();
       didSomething = TRUE;
@@ -57,8 +57,8 @@ printUsage(const char *pname, UBool isHelp) {
 
     fprintf(where,
             "%csage: %s [-h|-?|--help ] [-tl|-tb|-te] [-c] [-C comment]\n"
-            "\t[-a list] [-r list] [-x list] [-l [-o outputListFileName]]\n"
-            "\t[-s path] [-d path] [-w] [-m mode]\n"
+            "\t[-T trace] [-a list] [-r list] [-x list] [-l [-o outputListFileName]]\n"
+            "\t[-s path] [-d path] [-w] [-z] [-m mode]\n"
             "\t[--auto_toc_prefix] [--auto_toc_prefix_with_type] [--toc_prefix]\n"
             "\tinfilename [outfilename]\n",
             isHelp ? 'U' : 'u', pname);
@@ -68,7 +68,8 @@ printUsage(const char *pname, UBool isHelp) {
             "Read the input ICU .dat package file, modify it according to the options,\n"
             "swap it to the desired platform properties (charset & endianness),\n"
             "and optionally write the resulting ICU .dat package to the output file.\n"
-            "Items are removed, then added, then extracted and listed.\n"
+            "Items are subset to a trace, removed, then added,\n"
+            "then extracted and listed.\n"
             "An ICU .dat package is written if items are removed or added,\n"
             "or if the input and output filenames differ,\n"
             "or if the --writepkg (-w) option is set.\n");
@@ -110,10 +111,24 @@ printUsage(const char *pname, UBool isHelp) {
             "\tThe list can be a single item's filename,\n"
             "\tor a .txt filename with a list of item filenames,\n"
             "\tor an ICU .dat package filename.\n");
+        fprintf(where,
+            "\n"
+            "\t-T trace or --trace trace   keep only the items that are named in\n"
+            "\t                            the trace file, and the items that\n"
+            "\t                            those depend on, including parent locales\n"
+            "\tThe trace is the text that an application's UTraceData function\n"
+            "\twrote for the UTRACE_UDATA_BUNDLE, UTRACE_UDATA_DATA_FILE and\n"
+            "\tUTRACE_UDATA_RES_FILE trace points. Each word of the form\n"
+            "\tpackage/item, package-tree/item or tree/item names the package item,\n"
+            "\tother words are ignored.\n");
         fprintf(where,
             "\n"
             "\t-w or --writepkg  write the output package even if no items are removed\n"
-            "\t                  or added (e.g., for only swapping the data)\n");
+            "\t                  or added (e.g., for only swapping the data)\n"
+            "\t-z or --compress  compress the items of the output package that get\n"
+            "\t                  smaller that way; ICU uncompresses an item when it\n"
+            "\t                  is first loaded (compressed input items are always\n"
+            "\t                  uncompressed when they are read)\n");
         fprintf(where,
             "\n"
             "\t-m mode or --matchmode mode  set the matching mode for item names with\n"
@@ -195,9 +210,11 @@ static UOption options[]={
     UOPTION_DESTDIR,
 
     UOPTION_DEF("writepkg", 'w', UOPT_NO_ARG),
+    UOPTION_DEF("compress", 'z', UOPT_NO_ARG),
 
     UOPTION_DEF("matchmode", 'm', UOPT_REQUIRES_ARG),
 
+    UOPTION_DEF("trace", 'T', UOPT_REQUIRES_ARG),
     UOPTION_DEF("add", 'a', UOPT_REQUIRES_ARG),
     UOPTION_DEF("remove", 'r', UOPT_REQUIRES_ARG),
     UOPTION_DEF("extract", 'x', UOPT_REQUIRES_ARG),
@@ -222,9 +239,11 @@ enum {
     OPT_DESTDIR,
 
     OPT_WRITEPKG,
+    OPT_COMPRESS,
 
     OPT_MATCHMODE,
 
+    OPT_TRACE_LIST,
     OPT_ADD_LIST,
     OPT_REMOVE_LIST,
     OPT_EXTRACT_LIST,
@@ -280,6 +299,10 @@ main(int argc, char *argv[]) {
     }
     isModified=FALSE;
 
+    if(options[OPT_COMPRESS].doesOccur) {
+        pkg->setCompressItems();
+    }
+
     int autoPrefix=0;
     if(options[OPT_AUTO_TOC_PREFIX].doesOccur) {
         pkg->setAutoPrefix();
@@ -376,7 +399,7 @@ main(int argc, char *argv[]) {
         outType=0; /* tells extractItem() to not swap */
     }
 
-    if(options[OPT_WRITEPKG].doesOccur) {
+    if(options[OPT_WRITEPKG].doesOccur || options[OPT_COMPRESS].doesOccur) {
         isModified=TRUE;
     }
 
@@ -388,6 +411,8 @@ main(int argc, char *argv[]) {
         if( options[OPT_COMMENT].doesOccur ||
             options[OPT_COPYRIGHT].doesOccur ||
             options[OPT_MATCHMODE].doesOccur ||
+            options[OPT_COMPRESS].doesOccur ||
+            options[OPT_TRACE_LIST].doesOccur ||
             options[OPT_REMOVE_LIST].doesOccur ||
             options[OPT_ADD_LIST].doesOccur ||
             options[OPT_EXTRACT_LIST].doesOccur ||
@@ -423,6 +448,23 @@ main(int argc, char *argv[]) {
         }
     }
 
+    /* keep only the items that a trace names, and their dependencies */
+    if(options[OPT_TRACE_LIST].doesOccur) {
+        listPkg=new Package();
+        if(listPkg==NULL) {
+            fprintf(stderr, "icupkg: not enough memory\n");
+            exit(U_MEMORY_ALLOCATION_ERROR);
+        }
+        if(readTraceList(options[OPT_TRACE_LIST].value, *pkg, listPkg)) {
+            pkg->keepItems(*listPkg);
+            delete listPkg;
+            isModified=TRUE;
+        } else {
+            printUsage(pname, FALSE);
+            return U_ILLEGAL_ARGUMENT_ERROR;
+        }
+    }
+
     /* remove items */
     if(options[OPT_REMOVE_LIST].doesOccur) {
         listPkg=new Package();
@@ -0,0 +1,314 @@
+// © 2019 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+*******************************************************************************
+*   file name:  icustartup.cpp
+*   encoding:   UTF-8
+*   tab size:   8 (not used)
+*   indentation:4
+*
+*   This program measures the first-use cost of ICU services:
+*   For each scenario it starts a fresh copy of itself, which times the
+*   scenario's first call up to its first result, and counts the page faults
+*   incurred meanwhile. Data mapping, lazy initialization and the first
+*   cache fills all land in these numbers, which makes them suitable for
+*   comparing data layouts and initialization strategies.
+*
+*   Usage:
+*     icustartup [-L locale] [-r repeat] [-i datadir] [--json] [scenario ...]
+*   Without scenario names, all scenarios are run.
+*/
+
+// Defines _XOPEN_SOURCE for access to POSIX functions.
+// Must be before any other #includes.
+#include "uposixdefs.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include "unicode/utypes.h"
+#include "unicode/putil.h"
+#include "unicode/ubrk.h"
+#include "unicode/ucnv.h"
+#include "unicode/ucol.h"
+#include "unicode/udat.h"
+#include "unicode/udata.h"
+#include "unicode/uclean.h"
+#include "unicode/unumberformatter.h"
+#include "unicode/ures.h"
+#include "unicode/ustring.h"
+#include "cmemory.h"
+#include "cstring.h"
+#include "uoptions.h"
+
+#if U_PLATFORM_USES_ONLY_WIN32_API
+#   define popen _popen
+#   define pclose _pclose
+#else
+#   include <sys/resource.h>
+#endif
+
+static UOption options[]={
+  /*0*/ UOPTION_HELP_H,
+  /*1*/ UOPTION_HELP_QUESTION_MARK,
+  /*2*/ UOPTION_ICUDATADIR,
+  /*3*/ UOPTION_DEF("locale", 'L', UOPT_REQUIRES_ARG),
+  /*4*/ UOPTION_DEF("repeat", 'r', UOPT_REQUIRES_ARG),
+  /*5*/ UOPTION_DEF("json", 'j', UOPT_NO_ARG),
+  /*6*/ UOPTION_DEF("child", '\x01', UOPT_REQUIRES_ARG),  // internal: run one scenario in this process
+};
+
+enum { HELP_H, HELP_QUESTION_MARK, ICUDATADIR, LOCALE, REPEAT, JSON, CHILD };
+
+static const char *locale = "en";
+
+// Each scenario calls the APIs needed for its first result
+// and returns a failure if it did not get one.
+
+static void runUInit(UErrorCode &errorCode) {
+    u_init(&errorCode);
+}
+
+static void runUDataOpen(UErrorCode &errorCode) {
+    // Maps the common data file and finds one item in it.
+    UDataMemory *data = udata_open(NULL, "nrm", "nfkc", &errorCode);
+    if (U_SUCCESS(errorCode) && udata_getMemory(data) == NULL) {
+        errorCode = U_INVALID_FORMAT_ERROR;
+    }
+    udata_close(data);
+}
+
+static void runUResOpen(UErrorCode &errorCode) {
+    UResourceBundle *rb = ures_open(NULL, locale, &errorCode);
+    int32_t length = 0;
+    ures_getStringByKey(rb, "Version", &length, &errorCode);
+    ures_close(rb);
+}
+
+static void runUCnvOpen(UErrorCode &errorCode) {
+    UConverter *cnv = ucnv_open("Shift_JIS", &errorCode);
+    char dest[32];
+    ucnv_fromUChars(cnv, dest, UPRV_LENGTHOF(dest), u"\u6771\u4EAC", -1, &errorCode);
+    ucnv_close(cnv);
+}
+
+static void runUColOpen(UErrorCode &errorCode) {
+    UCollator *coll = ucol_open(locale, &errorCode);
+    if (U_SUCCESS(errorCode)) {
+        ucol_strcoll(coll, u"resume", -1, u"r\u00E9sum\u00E9", -1);
+    }
+    ucol_close(coll);
+}
+
+static void runUNumfOpen(UErrorCode &errorCode) {
+    UNumberFormatter *formatter =
+        unumf_openForSkeletonAndLocale(u"precision-integer", -1, locale, &errorCode);
+    UFormattedNumber *result = unumf_openResult(&errorCode);
+    UChar dest[40];
+    unumf_formatDouble(formatter, 1234.5, result, &errorCode);
+    unumf_resultToString(result, dest, UPRV_LENGTHOF(dest), &errorCode);
+    unumf_closeResult(result);
+    unumf_close(formatter);
+}
+
+static void runUDatOpen(UErrorCode &errorCode) {
+    UDateFormat *fmt = udat_open(UDAT_MEDIUM, UDAT_MEDIUM, locale, u"UTC", -1, NULL, 0, &errorCode);
+    UChar dest[80];
+    udat_format(fmt, 1.5e12, dest, UPRV_LENGTHOF(dest), NULL, &errorCode);
+    udat_close(fmt);
+}
+
+static void runUBrkOpen(UErrorCode &errorCode) {
+    static const UChar text[] = u"Hello, world. How are you?";
+    UBreakIterator *bi = ubrk_open(UBRK_WORD, locale, text, -1, &errorCode);
+    if (U_SUCCESS(errorCode)) {
+        ubrk_next(bi);
+    }
+    ubrk_close(bi);
+}
+
+static const struct Scenario {
+    const char *name;
+    void (*run)(UErrorCode &errorCode);
+} scenarios[] = {
+    { "u_init", runUInit },
+    { "udata_open", runUDataOpen },
+    { "ures_open", runUResOpen },
+    { "ucnv_open", runUCnvOpen },
+    { "ucol_open", runUColOpen },
+    { "unumf_open", runUNumfOpen },
+    { "udat_open", runUDatOpen },
+    { "ubrk_open", runUBrkOpen },
+};
+
+static const Scenario *findScenario(const char *name) {
+    for (const Scenario &s : scenarios) {
+        if (uprv_strcmp(s.name, name) == 0) {
+            return &s;
+        }
+    }
+    return NULL;
+}
+
+struct Measurement {
+    double micros;
+    long minorFaults;  // -1 if not available on this platform
+    long majorFaults;
+};
+
+static void getFaults(long &minor, long &major) {
+#if U_PLATFORM_USES_ONLY_WIN32_API
+    minor = major = -1;
+#else
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) == 0) {
+        minor = usage.ru_minflt;
+        major = usage.ru_majflt;
+    } else {
+        minor = major = -1;
+    }
+#endif
+}
+
+// Runs the scenario in this process and prints its measurement for the parent.
+static int runChild(const Scenario &scenario) {
+    long minor0, major0, minor1, major1;
+    UErrorCode errorCode = U_ZERO_ERROR;
+    getFaults(minor0, major0);
+    auto start = std::chrono::steady_clock::now();
+    scenario.run(errorCode);
+    auto end = std::chrono::steady_clock::now();
+    getFaults(minor1, major1);
+    if (U_FAILURE(errorCode)) {
+        fprintf(stderr, "icustartup: %s failed: %s\n", scenario.name, u_errorName(errorCode));
+        return 1;
+    }
+    printf("%.1f %ld %ld\n",
+           std::chrono::duration<double, std::micro>(end - start).count(),
+           minor0 < 0 ? -1 : minor1 - minor0, major0 < 0 ? -1 : major1 - major0);
+    return 0;
+}
+
+// Starts a fresh copy of this program for the scenario and reads its measurement.
+static UBool measure(const char *self, const Scenario &scenario, Measurement &m) {
+    char command[1024];
+    int length = snprintf(command, sizeof(command), "\"%s\" --child %s -L %s", self, scenario.name, locale);
+    if (options[ICUDATADIR].doesOccur && length > 0 && length < (int)sizeof(command)) {
+        length += snprintf(command + length, sizeof(command) - length, " -i \"%s\"", options[ICUDATADIR].value);
+    }
+    if (length <= 0 || length >= (int)sizeof(command)) {
+        fprintf(stderr, "icustartup: command line too long\n");
+        return FALSE;
+    }
+    FILE *child = popen(command, "r");
+    if (child == NULL) {
+        fprintf(stderr, "icustartup: unable to run %s\n", command);
+        return FALSE;
+    }
+    int count = fscanf(child, "%lf %ld %ld", &m.micros, &m.minorFaults, &m.majorFaults);
+    int status = pclose(child);
+    return count == 3 && status == 0;
+}
+
+static double median(double *values, int32_t count) {
+    std::sort(values, values + count);
+    return count % 2 != 0 ? values[count / 2] : (values[count / 2 - 1] + values[count / 2]) / 2;
+}
+
+int main(int argc, char *argv[]) {
+    U_MAIN_INIT_ARGS(argc, argv);
+    argc = u_parseArgs(argc, argv, UPRV_LENGTHOF(options), options);
+    if (argc < 0 || options[HELP_H].doesOccur || options[HELP_QUESTION_MARK].doesOccur) {
+        fprintf(stderr,
+                "usage: %s [-options] [scenario ...]\n"
+                "\tmeasures the first use of ICU services, each in a fresh process\n"
+                "options:\n"
+                "\t-h or -? or --help  this usage text\n"
+                "\t-i or --icudatadir  ICU data directory\n"
+                "\t-L or --locale      locale for the scenarios, default: en\n"
+                "\t-r or --repeat      run each scenario this many times and report the median, default: 5\n"
+                "\t-j or --json        write one JSON object per scenario instead of a table\n"
+                "scenarios:\n",
+                argv[0]);
+        for (const Scenario &s : scenarios) {
+            fprintf(stderr, "\t%s\n", s.name);
+        }
+        return argc < 0 ? U_ILLEGAL_ARGUMENT_ERROR : 0;
+    }
+    if (options[ICUDATADIR].doesOccur) {
+        u_setDataDirectory(options[ICUDATADIR].value);
+    }
+    if (options[LOCALE].doesOccur) {
+        locale = options[LOCALE].value;
+    }
+
+    if (options[CHILD].doesOccur) {
+        const Scenario *scenario = findScenario(options[CHILD].value);
+        return scenario != NULL ? runChild(*scenario) : 1;
+    }
+
+    int32_t repeat = options[REPEAT].doesOccur ? atoi(options[REPEAT].value) : 5;
+    if (repeat < 1) {
+        fprintf(stderr, "icustartup: --repeat must be at least 1\n");
+        return U_ILLEGAL_ARGUMENT_ERROR;
+    }
+    UBool json = options[JSON].doesOccur;
+
+    const Scenario *selected[UPRV_LENGTHOF(scenarios)];
+    int32_t selectedCount = 0;
+    if (argc > 1) {
+        for (int i = 1; i < argc; ++i) {
+            const Scenario *scenario = findScenario(argv[i]);
+            if (scenario == NULL || selectedCount == UPRV_LENGTHOF(scenarios)) {
+                fprintf(stderr, "icustartup: unknown scenario %s\n", argv[i]);
+                return U_ILLEGAL_ARGUMENT_ERROR;
+            }
+            selected[selectedCount++] = scenario;
+        }
+    } else {
+        for (const Scenario &s : scenarios) {
+            selected[selectedCount++] = &s;
+        }
+    }
+
+    if (!json) {
+        printf("%-12s %12s %12s %12s\n", "scenario", "first us", "minor faults", "major faults");
+    }
+    int result = 0;
+    double *micros = new double[repeat];
+    double *minor = new double[repeat];
+    double *major = new double[repeat];
+    for (int32_t i = 0; i < selectedCount; ++i) {
+        const Scenario &scenario = *selected[i];
+        int32_t r;
+        for (r = 0; r < repeat; ++r) {
+            Measurement m;
+            if (!measure(argv[0], scenario, m)) {
+                break;
+            }
+            micros[r] = m.micros;
+            minor[r] = (double)m.minorFaults;
+            major[r] = (double)m.majorFaults;
+        }
+        if (r < repeat) {
+            fprintf(stderr, "icustartup: scenario %s failed\n", scenario.name);
+            result = 1;
+            continue;
+        }
+        if (json) {
+            printf("{\"scenario\": \"%s\", \"locale\": \"%s\", \"runs\": %d, "
+                   "\"first_result_us\": %.1f, \"minor_faults\": %.0f, \"major_faults\": %.0f}\n",
+                   scenario.name, locale, (int)repeat,
+                   median(micros, repeat), median(minor, repeat), median(major, repeat));
+        } else {
+            printf("%-12s %12.1f %12.0f %12.0f\n", scenario.name,
+                   median(micros, repeat), median(minor, repeat), median(major, repeat));
+        }
+    }
+    delete[] micros;
+    delete[] minor;
+    delete[] major;
+    return result;
+}
@@ -1339,6 +1339,47 @@ compactStage2(MBCSData *mbcsData) {
     }
 }
 
+/*
+ * For verbose output: Count the 16-entry stage 3 blocks that are all-unassigned,
+ * and those that duplicate an earlier block.
+ * Such blocks would be candidates for sharing, but UTF-8-friendly tries
+ * need their 64-entry stage 3 blocks to be contiguous.
+ */
+static void
+countStage3Blocks(const MBCSData *mbcsData, int32_t stage3Width,
+                  int32_t &countBlocks, int32_t &countEmpty, int32_t &countDuplicates) {
+    const uint8_t *stage3=mbcsData->fromUBytes;
+    uint32_t blockLength, top, start, prev;
+    int32_t i;
+
+    if(mbcsData->ucm->states.maxCharLength==1) {
+        /* stage 3 contains 16-bit results, and stage3Top counts them */
+        blockLength=MBCS_STAGE_3_BLOCK_SIZE*2;
+        top=mbcsData->stage3Top*2;
+    } else {
+        blockLength=MBCS_STAGE_3_BLOCK_SIZE*stage3Width;
+        top=mbcsData->stage3Top;
+    }
+
+    countBlocks=countEmpty=countDuplicates=0;
+    /* skip the initial all-unassigned block */
+    for(start=MBCS_UTF8_STAGE_3_BLOCK_SIZE*(blockLength/MBCS_STAGE_3_BLOCK_SIZE);
+            start+blockLength<=top; start+=blockLength) {
+        ++countBlocks;
+        for(i=0; i<(int32_t)blockLength && stage3[start+i]==0; ++i) {}
+        if(i==(int32_t)blockLength) {
+            ++countEmpty;
+            continue;
+        }
+        for(prev=0; prev<start; prev+=blockLength) {
+            if(uprv_memcmp(stage3+prev, stage3+start, blockLength)==0) {
+                ++countDuplicates;
+                break;
+            }
+        }
+    }
+}
+
 static void
 MBCSPostprocess(MBCSData *mbcsData, const UConverterStaticData * /*staticData*/) {
     UCMStates *states;
@@ -1387,6 +1428,11 @@ MBCSPostprocess(MBCSData *mbcsData, const UConverterStaticData * /*staticData*/)
                (int)stage3Width,
                (unsigned long)mbcsData->stage3Top/stage3Width,
                (unsigned long)mbcsData->stage3Top/stage3Width);
+
+        int32_t countBlocks, countEmpty, countDuplicates;
+        countStage3Blocks(mbcsData, stage3Width, countBlocks, countEmpty, countDuplicates);
+        printf("fromUnicode stage 3 has %ld 16-entry blocks, %ld all-unassigned and %ld duplicates\n",
+               (long)countBlocks, (long)countEmpty, (long)countDuplicates);
 #if 0
         c=0;
         for(i1=0; i1<MBCS_STAGE_1_SIZE; ++i1) {
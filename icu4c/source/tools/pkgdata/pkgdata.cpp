@@ -765,6 +765,7 @@ static int32_t pkg_executeOptions(UPKGOptions *o) {
                         o->entryName,
                         (optMatchArch[0] == 0 ? NULL : optMatchArch),
                         NULL,
+                        0,
                         gencFilePath,
                         sizeof(gencFilePath));
                     pkg_destroyOptMatchArch(optMatchArch);
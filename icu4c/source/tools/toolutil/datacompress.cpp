@@ -0,0 +1,365 @@
+// © 2019 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+*******************************************************************************
+*   file name:  datacompress.cpp
+*   encoding:   UTF-8
+*   tab size:   8 (not used)
+*   indentation:4
+*
+*   Writing and swapping compressed data items, see udatacmp.h.
+*   The compressor writes the LZ4 block format with a simple greedy
+*   hash-table match finder.
+*/
+
+#include "unicode/utypes.h"
+#include "unicode/udata.h"
+#include "cmemory.h"
+#include "ucmndata.h"
+#include "udatacmp.h"
+#include "udataswp.h"
+#include "swapimpl.h"
+#include "datacompress.h"
+
+// LZ4 block format -------------------------------------------------------- ***
+
+enum {
+    LZ4_MIN_MATCH=4,
+    /* The last 5 bytes are always literals. */
+    LZ4_LAST_LITERALS=5,
+    /* The last match must start at least 12 bytes before the end of the block. */
+    LZ4_MF_LIMIT=12,
+    LZ4_MAX_OFFSET=0xffff,
+    LZ4_HASH_BITS=14
+};
+
+static int32_t
+lz4CompressBound(int32_t length) {
+    return length+length/255+16;
+}
+
+static inline uint32_t
+read32(const uint8_t *p) {
+    uint32_t x;
+    uprv_memcpy(&x, p, 4);
+    return x;
+}
+
+static inline int32_t
+hash32(uint32_t x) {
+    return (int32_t)((x*2654435761u)>>(32-LZ4_HASH_BITS));
+}
+
+static uint8_t *
+writeExtraLength(uint8_t *p, int32_t length) {
+    while(length>=255) {
+        *p++=255;
+        length-=255;
+    }
+    *p++=(uint8_t)length;
+    return p;
+}
+
+/* Writes one sequence; matchLength==0 for the last one, which has only literals. */
+static uint8_t *
+writeSequence(uint8_t *p,
+              const uint8_t *literals, int32_t literalLength,
+              int32_t offset, int32_t matchLength) {
+    uint8_t *token=p++;
+    int32_t t;
+    if(literalLength>=15) {
+        t=15<<4;
+        p=writeExtraLength(p, literalLength-15);
+    } else {
+        t=literalLength<<4;
+    }
+    uprv_memcpy(p, literals, literalLength);
+    p+=literalLength;
+    if(matchLength>0) {
+        *p++=(uint8_t)offset;
+        *p++=(uint8_t)(offset>>8);
+        matchLength-=LZ4_MIN_MATCH;
+        if(matchLength>=15) {
+            t|=15;
+            p=writeExtraLength(p, matchLength-15);
+        } else {
+            t|=matchLength;
+        }
+    }
+    *token=(uint8_t)t;
+    return p;
+}
+
+/*
+ * Compresses src into dest, which must have a capacity of at least lz4CompressBound(length).
+ * table must have 1<<LZ4_HASH_BITS entries.
+ */
+static int32_t
+lz4Compress(const uint8_t *src, int32_t length, uint8_t *dest, int32_t *table) {
+    uint8_t *p=dest;
+    int32_t anchor=0, i=0;
+    for(int32_t j=0; j<(1<<LZ4_HASH_BITS); ++j) {
+        table[j]=-1;
+    }
+    int32_t matchStartLimit=length-LZ4_MF_LIMIT;
+    int32_t matchLimit=length-LZ4_LAST_LITERALS;
+    while(i<matchStartLimit) {
+        uint32_t seq=read32(src+i);
+        int32_t h=hash32(seq);
+        int32_t ref=table[h];
+        table[h]=i;
+        if(ref>=0 && (i-ref)<=LZ4_MAX_OFFSET && read32(src+ref)==seq) {
+            int32_t matchEnd=i+LZ4_MIN_MATCH;
+            while(matchEnd<matchLimit && src[matchEnd]==src[ref+(matchEnd-i)]) {
+                ++matchEnd;
+            }
+            p=writeSequence(p, src+anchor, i-anchor, i-ref, matchEnd-i);
+            i=anchor=matchEnd;
+        } else {
+            ++i;
+        }
+    }
+    p=writeSequence(p, src+anchor, length-anchor, 0, 0);
+    return (int32_t)(p-dest);
+}
+
+/* Compresses src into a new buffer. Returns the compressed length, or -1 if out of memory. */
+static int32_t
+compressBytes(const uint8_t *src, int32_t length, icu::LocalMemory<uint8_t> &dest) {
+    icu::LocalMemory<int32_t> table;
+    if(dest.allocateInsteadAndReset(lz4CompressBound(length))==NULL ||
+            table.allocateInsteadAndReset(1<<LZ4_HASH_BITS)==NULL) {
+        return -1;
+    }
+    return lz4Compress(src, length, dest.getAlias(), table.getAlias());
+}
+
+// compressed data items --------------------------------------------------- ***
+
+static void
+writeUInt16(void *p, uint16_t x, UBool isBigEndian) {
+    uint8_t *s=(uint8_t *)p;
+    if(isBigEndian) {
+        s[0]=(uint8_t)(x>>8);
+        s[1]=(uint8_t)x;
+    } else {
+        s[0]=(uint8_t)x;
+        s[1]=(uint8_t)(x>>8);
+    }
+}
+
+static void
+writeInt32(void *p, int32_t x, UBool isBigEndian) {
+    uint8_t *s=(uint8_t *)p;
+    for(int32_t i=0; i<4; ++i) {
+        s[isBigEndian ? 3-i : i]=(uint8_t)((uint32_t)x>>(8*i));
+    }
+}
+
+U_CAPI int32_t U_EXPORT2
+udata_compressItem(const void *inData, int32_t length,
+                   void *outData, int32_t capacity,
+                   UErrorCode *pErrorCode) {
+    if(pErrorCode==NULL || U_FAILURE(*pErrorCode)) {
+        return 0;
+    }
+    if(inData==NULL || length<(int32_t)sizeof(DataHeader) || capacity<0 || (outData==NULL && capacity>0)) {
+        *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    const DataHeader *pHeader=(const DataHeader *)inData;
+    if(pHeader->dataHeader.magic1!=0xda || pHeader->dataHeader.magic2!=0x27) {
+        *pErrorCode=U_INVALID_FORMAT_ERROR;
+        return 0;
+    }
+    UBool isBigEndian=pHeader->info.isBigEndian;
+    uint8_t charsetFamily=pHeader->info.charsetFamily;
+
+    icu::LocalMemory<uint8_t> compressed;
+    int32_t compressedLength=compressBytes((const uint8_t *)inData, length, compressed);
+    if(compressedLength<0) {
+        *pErrorCode=U_MEMORY_ALLOCATION_ERROR;
+        return 0;
+    }
+
+    // Make room for the item compressed for each platform type that it can be swapped to.
+    static const struct {
+        UBool isBigEndian;
+        uint8_t charsetFamily;
+    } types[]={
+        { FALSE, U_ASCII_FAMILY },
+        { TRUE, U_ASCII_FAMILY },
+        { TRUE, U_EBCDIC_FAMILY }
+    };
+    int32_t maxCompressedLength=compressedLength;
+    icu::LocalMemory<uint8_t> swapped;
+    if(swapped.allocateInsteadAndReset(length)==NULL) {
+        *pErrorCode=U_MEMORY_ALLOCATION_ERROR;
+        return 0;
+    }
+    for(int32_t i=0; i<UPRV_LENGTHOF(types); ++i) {
+        if(types[i].isBigEndian==isBigEndian && types[i].charsetFamily==charsetFamily) {
+            continue;
+        }
+        UErrorCode errorCode=U_ZERO_ERROR;
+        UDataSwapper *ds=udata_openSwapper(isBigEndian, charsetFamily,
+                                           types[i].isBigEndian, types[i].charsetFamily,
+                                           &errorCode);
+        uprv_memcpy(swapped.getAlias(), inData, length);
+        udata_swap(ds, swapped.getAlias(), length, swapped.getAlias(), &errorCode);
+        udata_closeSwapper(ds);
+        if(U_FAILURE(errorCode)) {
+            continue;  // The item cannot be swapped to this type.
+        }
+        icu::LocalMemory<uint8_t> other;
+        int32_t otherLength=compressBytes(swapped.getAlias(), length, other);
+        if(otherLength<0) {
+            *pErrorCode=U_MEMORY_ALLOCATION_ERROR;
+            return 0;
+        }
+        if(otherLength>maxCompressedLength) {
+            maxCompressedLength=otherLength;
+        }
+    }
+
+    // Write the header, the indexes, and the compressed bytes with padding to a multiple of 16.
+    int32_t headerSize=32;
+    int32_t dataOffset=headerSize+4*UDATA_CMP_IX_COUNT;
+    int32_t totalLength=(dataOffset+maxCompressedLength+15)&~15;
+    if(totalLength>capacity) {
+        *pErrorCode=U_BUFFER_OVERFLOW_ERROR;
+        return totalLength;
+    }
+    uint8_t *out=(uint8_t *)outData;
+    uprv_memset(out, 0, totalLength);
+    DataHeader *outHeader=(DataHeader *)out;
+    writeUInt16(&outHeader->dataHeader.headerSize, (uint16_t)headerSize, isBigEndian);
+    outHeader->dataHeader.magic1=0xda;
+    outHeader->dataHeader.magic2=0x27;
+    writeUInt16(&outHeader->info.size, (uint16_t)sizeof(UDataInfo), isBigEndian);
+    outHeader->info.isBigEndian=isBigEndian;
+    outHeader->info.charsetFamily=charsetFamily;
+    outHeader->info.sizeofUChar=pHeader->info.sizeofUChar;
+    outHeader->info.dataFormat[0]=UDATA_CMP_FMT_0;
+    outHeader->info.dataFormat[1]=UDATA_CMP_FMT_1;
+    outHeader->info.dataFormat[2]=UDATA_CMP_FMT_2;
+    outHeader->info.dataFormat[3]=UDATA_CMP_FMT_3;
+    outHeader->info.formatVersion[0]=1;
+
+    uint8_t *indexes=out+headerSize;
+    writeInt32(indexes+4*UDATA_CMP_IX_INDEXES_LENGTH, UDATA_CMP_IX_COUNT, isBigEndian);
+    writeInt32(indexes+4*UDATA_CMP_IX_METHOD, UDATA_CMP_METHOD_LZ4_BLOCK, isBigEndian);
+    writeInt32(indexes+4*UDATA_CMP_IX_UNCOMPRESSED_LENGTH, length, isBigEndian);
+    writeInt32(indexes+4*UDATA_CMP_IX_COMPRESSED_LENGTH, compressedLength, isBigEndian);
+    writeInt32(indexes+4*UDATA_CMP_IX_CAPACITY, totalLength-dataOffset, isBigEndian);
+    uprv_memcpy(out+dataOffset, compressed.getAlias(), compressedLength);
+    return totalLength;
+}
+
+U_CAPI int32_t U_EXPORT2
+udata_swapCompressedItem(const UDataSwapper *ds,
+                         const void *inData, int32_t length, void *outData,
+                         UErrorCode *pErrorCode) {
+    /* udata_swapDataHeader checks the header; swap it into outData at the end */
+    if(pErrorCode==NULL || U_FAILURE(*pErrorCode)) {
+        return 0;
+    }
+    if(length>=0 && outData==NULL) {
+        *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    int32_t headerSize=udata_swapDataHeader(ds, inData, -1, NULL, pErrorCode);
+    if(pErrorCode==NULL || U_FAILURE(*pErrorCode)) {
+        return 0;
+    }
+
+    /* check data format and format version */
+    const UDataInfo *pInfo=(const UDataInfo *)((const char *)inData+4);
+    if(!(
+        pInfo->dataFormat[0]==UDATA_CMP_FMT_0 &&
+        pInfo->dataFormat[1]==UDATA_CMP_FMT_1 &&
+        pInfo->dataFormat[2]==UDATA_CMP_FMT_2 &&
+        pInfo->dataFormat[3]==UDATA_CMP_FMT_3 &&
+        pInfo->formatVersion[0]==1
+    )) {
+        udata_printError(ds, "udata_swapCompressedItem(): data format %02x.%02x.%02x.%02x (format version %02x) is not a compressed data item\n",
+                         pInfo->dataFormat[0], pInfo->dataFormat[1],
+                         pInfo->dataFormat[2], pInfo->dataFormat[3],
+                         pInfo->formatVersion[0]);
+        *pErrorCode=U_UNSUPPORTED_ERROR;
+        return 0;
+    }
+
+    const uint8_t *inBytes=(const uint8_t *)inData+headerSize;
+    const int32_t *inIndexes=(const int32_t *)inBytes;
+    if(length>=0 && (length-headerSize)<4*UDATA_CMP_IX_COUNT) {
+        udata_printError(ds, "udata_swapCompressedItem(): too few bytes (%d after header) for a compressed data item\n",
+                         length-headerSize);
+        *pErrorCode=U_INDEX_OUTOFBOUNDS_ERROR;
+        return 0;
+    }
+    int32_t indexesLength=udata_readInt32(ds, inIndexes[UDATA_CMP_IX_INDEXES_LENGTH]);
+    int32_t itemCapacity=udata_readInt32(ds, inIndexes[UDATA_CMP_IX_CAPACITY]);
+    if(indexesLength<UDATA_CMP_IX_COUNT || itemCapacity<0) {
+        udata_printError(ds, "udata_swapCompressedItem(): malformed indexes\n");
+        *pErrorCode=U_INVALID_FORMAT_ERROR;
+        return 0;
+    }
+    int32_t dataOffset=headerSize+4*indexesLength;
+    int32_t size=dataOffset+itemCapacity;
+    if(length<0) {
+        return size;
+    }
+    if(length<size) {
+        udata_printError(ds, "udata_swapCompressedItem(): too few bytes (%d) for the compressed data item (%d)\n",
+                         length, size);
+        *pErrorCode=U_INDEX_OUTOFBOUNDS_ERROR;
+        return 0;
+    }
+
+    /* uncompress, swap and compress the contained item */
+    int32_t itemLength=udata_uncompressItem(inData, length, NULL, 0, pErrorCode);
+    if(*pErrorCode!=U_BUFFER_OVERFLOW_ERROR) {
+        if(U_SUCCESS(*pErrorCode)) {
+            *pErrorCode=U_INVALID_FORMAT_ERROR;
+        }
+        udata_printError(ds, "udata_swapCompressedItem(): malformed compressed data item\n");
+        return 0;
+    }
+    *pErrorCode=U_ZERO_ERROR;
+    icu::LocalMemory<uint8_t> item;
+    if(item.allocateInsteadAndReset(itemLength>0 ? itemLength : 1)==NULL) {
+        *pErrorCode=U_MEMORY_ALLOCATION_ERROR;
+        return 0;
+    }
+    udata_uncompressItem(inData, length, item.getAlias(), itemLength, pErrorCode);
+    udata_swap(ds, item.getAlias(), itemLength, item.getAlias(), pErrorCode);
+    if(U_FAILURE(*pErrorCode)) {
+        udata_printError(ds, "udata_swapCompressedItem(): unable to swap the contained item - %s\n",
+                         u_errorName(*pErrorCode));
+        return 0;
+    }
+    icu::LocalMemory<uint8_t> compressed;
+    int32_t compressedLength=compressBytes(item.getAlias(), itemLength, compressed);
+    if(compressedLength<0) {
+        *pErrorCode=U_MEMORY_ALLOCATION_ERROR;
+        return 0;
+    }
+    if(compressedLength>itemCapacity) {
+        udata_printError(ds, "udata_swapCompressedItem(): the swapped item compresses to %d bytes, more than the capacity of %d\n",
+                         compressedLength, itemCapacity);
+        *pErrorCode=U_BUFFER_OVERFLOW_ERROR;
+        return 0;
+    }
+
+    /* write the swapped header and indexes, and the new compressed bytes */
+    udata_swapDataHeader(ds, inData, length, outData, pErrorCode);
+    uint8_t *outBytes=(uint8_t *)outData+headerSize;
+    int32_t *outIndexes=(int32_t *)outBytes;
+    ds->swapArray32(ds, inIndexes, 4*indexesLength, outIndexes, pErrorCode);
+    ds->writeUInt32((uint32_t *)outIndexes+UDATA_CMP_IX_COMPRESSED_LENGTH, (uint32_t)compressedLength);
+    uint8_t *outCompressed=(uint8_t *)outData+dataOffset;
+    uprv_memcpy(outCompressed, compressed.getAlias(), compressedLength);
+    uprv_memset(outCompressed+compressedLength, 0, itemCapacity-compressedLength);
+    return size;
+}
@@ -0,0 +1,50 @@
+// © 2019 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+*******************************************************************************
+*   file name:  datacompress.h
+*   encoding:   UTF-8
+*   tab size:   8 (not used)
+*   indentation:4
+*
+*   Writing and swapping compressed data items, see udatacmp.h.
+*/
+
+#ifndef __DATACOMPRESS_H__
+#define __DATACOMPRESS_H__
+
+#include "unicode/utypes.h"
+#include "udataswp.h"
+
+/**
+ * Compresses an ICU data item into a compressed data item ("Cmpr").
+ * The compressed item has room for the item compressed for each of the
+ * platform types that it can be swapped to, so that udata_swap()
+ * can swap it in place.
+ *
+ * @param inData the data item
+ * @param length the length of the data item
+ * @param outData output buffer, can be NULL if capacity==0 for preflighting
+ * @param capacity capacity of outData
+ * @param pErrorCode ICU error code
+ * @return the length of the compressed item, a multiple of 16;
+ *         it can be longer than the input item
+ * @internal
+ */
+U_CAPI int32_t U_EXPORT2
+udata_compressItem(const void *inData, int32_t length,
+                   void *outData, int32_t capacity,
+                   UErrorCode *pErrorCode);
+
+/**
+ * Swaps a compressed data item: Uncompresses it, swaps the contained item
+ * with udata_swap(), and compresses it again.
+ * @see UDataSwapFn
+ * @internal
+ */
+U_CAPI int32_t U_EXPORT2
+udata_swapCompressedItem(const UDataSwapper *ds,
+                         const void *inData, int32_t length, void *outData,
+                         UErrorCode *pErrorCode);
+
+#endif
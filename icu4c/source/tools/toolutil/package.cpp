@@ -29,8 +29,10 @@
 #include "cstring.h"
 #include "uarrsort.h"
 #include "ucmndata.h"
+#include "udatacmp.h"
 #include "udataswp.h"
 #include "swapimpl.h"
+#include "datacompress.h"
 #include "toolutil.h"
 #include "package.h"
 #include "cmemory.h"
@@ -302,6 +304,42 @@ makeFullFilenameAndDirs(const char *path, const char *name,
     }
 }
 
+/*
+ * If the item is compressed, then replace it with an owned, uncompressed copy
+ * padded to a multiple of 16. The platform type does not change.
+ */
+static void
+uncompressItem(const char *name, uint8_t *&data, int32_t &length, UBool &isDataOwned) {
+    if(!udata_isCompressedItem(data, length)) {
+        return;
+    }
+    UErrorCode errorCode=U_ZERO_ERROR;
+    int32_t itemLength=udata_uncompressItem(data, length, NULL, 0, &errorCode);
+    if(errorCode!=U_BUFFER_OVERFLOW_ERROR) {
+        fprintf(stderr, "icupkg: malformed compressed item \"%s\"\n", name);
+        exit(U_INVALID_FORMAT_ERROR);
+    }
+    int32_t paddedLength=(itemLength+0xf)&~0xf;
+    uint8_t *item=(uint8_t *)uprv_malloc(paddedLength);
+    if(item==NULL) {
+        fprintf(stderr, "icupkg: malloc error allocating %d bytes.\n", (int)paddedLength);
+        exit(U_MEMORY_ALLOCATION_ERROR);
+    }
+    errorCode=U_ZERO_ERROR;
+    udata_uncompressItem(data, length, item, itemLength, &errorCode);
+    if(U_FAILURE(errorCode)) {
+        fprintf(stderr, "icupkg: unable to uncompress item \"%s\" - %s\n", name, u_errorName(errorCode));
+        exit(errorCode);
+    }
+    memset(item+itemLength, 0xaa, paddedLength-itemLength);
+    if(isDataOwned) {
+        uprv_free(data);
+    }
+    data=item;
+    length=paddedLength;
+    isDataOwned=TRUE;
+}
+
 static uint8_t *
 readFile(const char *path, const char *name, int32_t &length, char &type) {
     char filename[1024];
@@ -363,7 +401,10 @@ readFile(const char *path, const char *name, int32_t &length, char &type) {
     }
     type=makeTypeLetter(typeEnum);
 
-    return data.orphan();
+    uint8_t *p=data.orphan();
+    UBool isDataOwned=TRUE;
+    uncompressItem(name, p, length, isDataOwned);
+    return p;
 }
 
 // .dat package file representation ---------------------------------------- ***
@@ -382,7 +423,7 @@ U_CDECL_END
 U_NAMESPACE_BEGIN
 
 Package::Package()
-        : doAutoPrefix(FALSE), prefixEndsWithType(FALSE) {
+        : doAutoPrefix(FALSE), prefixEndsWithType(FALSE), doCompress(FALSE) {
     inPkgName[0]=0;
     pkgPrefix[0]=0;
     inData=NULL;
@@ -668,6 +709,10 @@ Package::readPackage(const char *filename) {
         }
         items[itemCount-1].type=makeTypeLetter(typeEnum);
 
+        for(i=0; i<itemCount; ++i) {
+            uncompressItem(items[i].name, items[i].data, items[i].length, items[i].isDataOwned);
+        }
+
         if(type!=U_ICUDATA_TYPE_LETTER[0]) {
             // sort the item names for the local charset
             sortItems();
@@ -804,6 +849,46 @@ Package::writePackage(const char *filename, char outType, const char *comment) {
         items[i].name=name;
     }
 
+    if(doCompress) {
+        // swap each item to the output type first, then compress it
+        for(pItem=items, i=0; i<itemCount; ++pItem, ++i) {
+            int32_t type=makeTypeEnum(pItem->type);
+            if(ds[type]!=NULL) {
+                udata_swap(ds[type], pItem->data, pItem->length, pItem->data, &errorCode);
+                if(U_FAILURE(errorCode)) {
+                    fprintf(stderr, "icupkg: udata_swap(item %ld) failed - %s\n", (long)i, u_errorName(errorCode));
+                    exit(errorCode);
+                }
+                pItem->type=outType;
+            }
+            length=udata_compressItem(pItem->data, pItem->length, NULL, 0, &errorCode);
+            if(errorCode!=U_BUFFER_OVERFLOW_ERROR) {
+                fprintf(stderr, "icupkg: udata_compressItem(item %ld) failed - %s\n", (long)i, u_errorName(errorCode));
+                exit(errorCode);
+            }
+            errorCode=U_ZERO_ERROR;
+            if(length>=pItem->length) {
+                continue;  // keep the item uncompressed
+            }
+            uint8_t *compressed=(uint8_t *)uprv_malloc(length);
+            if(compressed==NULL) {
+                fprintf(stderr, "icupkg: malloc error allocating %d bytes.\n", (int)length);
+                exit(U_MEMORY_ALLOCATION_ERROR);
+            }
+            udata_compressItem(pItem->data, pItem->length, compressed, length, &errorCode);
+            if(U_FAILURE(errorCode)) {
+                fprintf(stderr, "icupkg: udata_compressItem(item %ld) failed - %s\n", (long)i, u_errorName(errorCode));
+                exit(errorCode);
+            }
+            if(pItem->isDataOwned) {
+                uprv_free(pItem->data);
+            }
+            pItem->data=compressed;
+            pItem->length=length;
+            pItem->isDataOwned=TRUE;
+        }
+    }
+
     // calculate offsets for item names and items, pad to 16-align items
     // align only the first item; each item's length is a multiple of 16
     basenameOffset=4+8*itemCount;
@@ -1123,6 +1208,70 @@ Package::removeItems(const Package &listPkg) {
     }
 }
 
+// state for keepItems()
+struct KeepItemsContext {
+    const Package *pkg;
+    UBool *isKept;
+    int32_t *queue;
+    int32_t queueLength;
+};
+
+static void
+keepDependency(void *context, const char * /*itemName*/, const char *targetName) {
+    // keep the target item if it is in the package;
+    // checkDependencies() complains about missing ones
+    KeepItemsContext *ctx=(KeepItemsContext *)context;
+    int32_t idx=ctx->pkg->findItem(targetName);
+    if(idx>=0 && !ctx->isKept[idx]) {
+        ctx->isKept[idx]=TRUE;
+        ctx->queue[ctx->queueLength++]=idx;
+    }
+}
+
+void
+Package::keepItems(const Package &listPkg) {
+    KeepItemsContext ctx;
+    int32_t i, idx;
+
+    if(itemCount==0) {
+        return;
+    }
+    ctx.pkg=this;
+    ctx.isKept=(UBool *)uprv_malloc(itemCount*sizeof(UBool));
+    ctx.queue=(int32_t *)uprv_malloc(itemCount*sizeof(int32_t));
+    ctx.queueLength=0;
+    if(ctx.isKept==NULL || ctx.queue==NULL) {
+        fprintf(stderr, "icupkg: not enough memory\n");
+        exit(U_MEMORY_ALLOCATION_ERROR);
+    }
+    uprv_memset(ctx.isKept, 0, itemCount*sizeof(UBool));
+
+    // mark the listed items
+    for(i=0; i<listPkg.itemCount; ++i) {
+        findItems(listPkg.items[i].name);
+        while((idx=findNextItem())>=0) {
+            if(!ctx.isKept[idx]) {
+                ctx.isKept[idx]=TRUE;
+                ctx.queue[ctx.queueLength++]=idx;
+            }
+        }
+    }
+
+    // mark the items that marked items depend on, until there are no new ones
+    for(i=0; i<ctx.queueLength; ++i) {
+        enumDependencies(items+ctx.queue[i], &ctx, keepDependency, TRUE);
+    }
+
+    // remove the unmarked items, from the end so that the indexes stay valid
+    for(idx=itemCount-1; idx>=0; --idx) {
+        if(!ctx.isKept[idx]) {
+            removeItem(idx);
+        }
+    }
+    uprv_free(ctx.isKept);
+    uprv_free(ctx.queue);
+}
+
 void
 Package::extractItem(const char *filesPath, const char *outName, int32_t idx, char outType) {
     char filename[1024];
@@ -66,6 +66,12 @@ class U_TOOLUTIL_API Package {
         prefixEndsWithType=TRUE;
     }
     void setPrefix(const char *p);
+    /**
+     * Makes writePackage() store items compressed (see udatacmp.h)
+     * when that makes them smaller.
+     * readPackage() and addFile() always uncompress compressed items.
+     */
+    void setCompressItems() { doCompress=TRUE; }
 
     /*
      * Read an existing .dat package file.
@@ -115,6 +121,14 @@ class U_TOOLUTIL_API Package {
     void removeItem(int32_t itemIndex);
     void removeItems(const char *pattern);
     void removeItems(const Package &listPkg);
+    /*
+     * Remove all items except for the ones that match the listPkg item names
+     * (which may contain wildcards), and the ones that those depend on,
+     * directly or indirectly.
+     * The dependencies include explicit parent locales (%%Parent) of
+     * resource bundles, so that locale fallback finds all of its bundles.
+     */
+    void keepItems(const Package &listPkg);
 
     /* The extractItem() functions accept outputType=0 to mean "don't swap the item". */
     void extractItem(const char *filesPath, int32_t itemIndex, char outType);
@@ -140,7 +154,8 @@ class U_TOOLUTIL_API Package {
     void enumDependencies(void *context, CheckDependency check);
 
 private:
-    void enumDependencies(Item *pItem, void *context, CheckDependency check);
+    void enumDependencies(Item *pItem, void *context, CheckDependency check,
+                          UBool explicitParents=FALSE);
 
     /**
      * Default CheckDependency function used by checkDependencies()
@@ -166,6 +181,7 @@ class U_TOOLUTIL_API Package {
     UBool inIsBigEndian;
     UBool doAutoPrefix;
     UBool prefixEndsWithType;
+    UBool doCompress;
 
     int32_t itemCount;
     int32_t itemMax;
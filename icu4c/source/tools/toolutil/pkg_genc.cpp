@@ -34,6 +34,9 @@
 #   ifndef EM_X86_64
 #       define EM_X86_64 62
 #   endif
+#   ifndef EM_AARCH64
+#       define EM_AARCH64 183
+#   endif
 #   define ICU_ENTRY_OFFSET 0
 #endif
 
@@ -769,10 +772,27 @@ getArchitecture(uint16_t *pCPU, uint16_t *pBits, UBool *pIsBigEndian, const char
     } else {
         /* set defaults */
 #ifdef U_ELF
-        /* set EM_386 because elf.h does not provide better defaults */
+        /* elf.h does not provide defaults, use the architecture that genccode was built for */
+#   if defined(__x86_64__)
+        *pCPU=EM_X86_64;
+        *pBits=64;
+#   elif defined(__aarch64__)
+        *pCPU=EM_AARCH64;
+        *pBits=64;
+#   elif defined(__arm__)
+        *pCPU=EM_ARM;
+        *pBits=32;
+#   else
         *pCPU=EM_386;
         *pBits=32;
-        *pIsBigEndian=(UBool)(U_IS_BIG_ENDIAN ? ELFDATA2MSB : ELFDATA2LSB);
+#   endif
+#   ifndef U_ELF64
+        if(*pBits==64) {
+            *pCPU=EM_386;
+            *pBits=32;
+        }
+#   endif
+        *pIsBigEndian=(UBool)U_IS_BIG_ENDIAN;
 #elif U_PLATFORM_HAS_WIN32_API
         // Windows always runs in little-endian mode.
         *pIsBigEndian = FALSE;
@@ -877,6 +897,7 @@ writeObjectCode(
         const char *optEntryPoint,
         const char *optMatchArch,
         const char *optFilename,
+        uint32_t optAlignment,
         char *outFilePath,
         size_t outFilePathCapacity) {
     /* common variables */
@@ -1140,6 +1161,21 @@ writeObjectCode(
 #endif
 
     /* deal with options, files and the entry point name */
+    if(optAlignment==0) {
+        optAlignment=16;
+    } else if((optAlignment&(optAlignment-1))!=0) {
+        fprintf(stderr, "genccode: alignment %lu is not a power of 2\n", (unsigned long)optAlignment);
+        exit(U_ILLEGAL_ARGUMENT_ERROR);
+    } else if(optAlignment<16) {
+        /* keep at least the default alignment */
+        optAlignment=16;
+    }
+#if U_PLATFORM_HAS_WIN32_API
+    if(optAlignment>8192) {
+        fprintf(stderr, "genccode: alignment %lu exceeds the COFF maximum of 8192\n", (unsigned long)optAlignment);
+        exit(U_ILLEGAL_ARGUMENT_ERROR);
+    }
+#endif
     getArchitecture(&cpu, &bits, &makeBigEndian, optMatchArch);
     if (optMatchArch)
     {
@@ -1212,6 +1248,7 @@ writeObjectCode(
         }
 
         sectionHeaders32[4].sh_size=(Elf32_Word)size;
+        sectionHeaders32[4].sh_addralign=(Elf32_Word)optAlignment;
 
         symbols32[1].st_size=(Elf32_Word)size;
 
@@ -1232,6 +1269,7 @@ writeObjectCode(
         }
 
         sectionHeaders64[4].sh_size=(Elf64_Xword)size;
+        sectionHeaders64[4].sh_addralign=(Elf64_Xword)optAlignment;
 
         symbols64[1].st_size=(Elf64_Xword)size;
 
@@ -1278,7 +1316,9 @@ writeObjectCode(
     uprv_strncpy((char *)objHeader.sections[1].Name, ".rdata", 6);
     objHeader.sections[1].SizeOfRawData=size;
     objHeader.sections[1].PointerToRawData=IMAGE_SIZEOF_FILE_HEADER+2*IMAGE_SIZEOF_SECTION_HEADER+length;
-    objHeader.sections[1].Characteristics=IMAGE_SCN_CNT_INITIALIZED_DATA|IMAGE_SCN_ALIGN_16BYTES|IMAGE_SCN_MEM_READ;
+    /* IMAGE_SCN_ALIGN_1BYTES..IMAGE_SCN_ALIGN_8192BYTES encode log2(alignment)+1 in bits 23..20 */
+    for(i=1; (1UL<<(i-1))<optAlignment; ++i) {}
+    objHeader.sections[1].Characteristics=IMAGE_SCN_CNT_INITIALIZED_DATA|((DWORD)i<<20)|IMAGE_SCN_MEM_READ;
 
     /* set the symbol table */
     if(entryLength<=8) {
@@ -92,6 +92,12 @@ writeAssemblyCode(
     char *outFilePath,
     size_t outFilePathCapacity);
 
+/*
+ * optAlignment: alignment of the data section in bytes, a power of 2;
+ * 0 for the default of 16.
+ * Large alignments, such as 0x200000, allow the data to be mapped with huge pages.
+ * COFF supports at most 8192.
+ */
 U_INTERNAL void U_EXPORT2
 writeObjectCode(
     const char *filename,
@@ -99,6 +105,7 @@ writeObjectCode(
     const char *optEntryPoint,
     const char *optMatchArch,
     const char *optFilename,
+    uint32_t optAlignment,
     char *outFilePath,
     size_t outFilePathCapacity);
 
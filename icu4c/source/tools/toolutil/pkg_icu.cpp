@@ -8,6 +8,7 @@
 #include "unicode/utypes.h"
 #include "unicode/localpointer.h"
 #include "unicode/putil.h"
+#include "unicode/udata.h"
 #include "cstring.h"
 #include "toolutil.h"
 #include "uoptions.h"
@@ -150,6 +151,120 @@ readList(const char *filesPath, const char *listname, UBool readContents, Packag
     return listPkg;
 }
 
+// read a trace of loaded data -------------------------------------------- ***
+
+/*
+ * Add item to listPkg if it is in pkg. The name is copied.
+ */
+static UBool
+addTracedItem(const Package &pkg, const char *name, int32_t length, Package *listPkg) {
+    char itemName[1024];
+    if(length<=0 || length>=(int32_t)sizeof(itemName)) {
+        return FALSE;
+    }
+    memcpy(itemName, name, length);
+    itemName[length]=0;
+    if(pkg.findItem(itemName)<0) {
+        return FALSE;
+    }
+    if(listPkg->findItem(itemName)<0) {
+        listPkg->addItem(itemName);
+    }
+    return TRUE;
+}
+
+/*
+ * Read the text output of an application's UTraceData function
+ * for the UTRACE_UDATA_BUNDLE, UTRACE_UDATA_DATA_FILE and UTRACE_UDATA_RES_FILE
+ * trace points, and add the package items that it mentions to listPkg.
+ *
+ * Those trace points report data files as path/name.type where the
+ * last path segment is the package name, like "icudt65l/zh.res",
+ * or the package name and tree, like "icudt65l-brkitr/word.brk".
+ * Each whitespace-separated word of the trace is taken as such a file,
+ * or as an item name like "brkitr/word.brk", and only words for items
+ * that are in pkg are added. Other words are ignored,
+ * so that the trace may contain arbitrary other text.
+ */
+U_CAPI Package * U_EXPORT2
+readTraceList(const char *tracename, const Package &pkg, Package *listPkgIn) {
+    Package *listPkg = listPkgIn;
+    FILE *file;
+
+    if(tracename==NULL || tracename[0]==0) {
+        fprintf(stderr, "missing trace file\n");
+        return NULL;
+    }
+
+    file=fopen(tracename, "r");
+    if(file==NULL) {
+        fprintf(stderr, "icupkg: unable to open trace file \"%s\"\n", tracename);
+        exit(U_FILE_ACCESS_ERROR);
+    }
+    if (listPkg == NULL) {
+        listPkg=new Package();
+        if(listPkg==NULL) {
+            fprintf(stderr, "icupkg: not enough memory\n");
+            exit(U_MEMORY_ALLOCATION_ERROR);
+        }
+    }
+
+    char line[4096];
+    while(fgets(line, sizeof(line), file)) {
+        const char *start=line;
+        for(;;) {
+            // find the next word, without quotes and similar punctuation around it
+            while(*start!=0 && strchr(" \t\r\n\"'(),;[]", *start)!=NULL) {
+                ++start;
+            }
+            if(*start==0) {
+                break;
+            }
+            const char *limit=start;
+            while(*limit!=0 && strchr(" \t\r\n\"'(),;[]", *limit)==NULL) {
+                ++limit;
+            }
+
+            // split the word into the last path segment before the file name, and the file name
+            const char *name=limit;
+            while(name>start && *(name-1)!='/' && *(name-1)!=U_FILE_SEP_CHAR) {
+                --name;
+            }
+            if(name==start) {
+                // no path
+                addTracedItem(pkg, start, (int32_t)(limit-start), listPkg);
+            } else if(name<limit) {
+                const char *segment=name-1;
+                while(segment>start && *(segment-1)!='/' && *(segment-1)!=U_FILE_SEP_CHAR) {
+                    --segment;
+                }
+                const char *tree=NULL;
+                for(const char *s=segment; s<name-1; ++s) {
+                    if(*s==U_TREE_SEPARATOR) {
+                        tree=s+1;
+                    }
+                }
+                char itemName[1024];
+                int32_t treeLength = tree!=NULL ? (int32_t)(name-1-tree) : (int32_t)(name-1-segment);
+                int32_t nameLength=(int32_t)(limit-name);
+                if((treeLength+1+nameLength)<(int32_t)sizeof(itemName)) {
+                    // package-tree/name or tree/name: look for tree/name
+                    memcpy(itemName, tree!=NULL ? tree : segment, treeLength);
+                    itemName[treeLength]=U_TREE_ENTRY_SEP_CHAR;
+                    memcpy(itemName+treeLength+1, name, nameLength);
+                    if(!addTracedItem(pkg, itemName, treeLength+1+nameLength, listPkg) && tree==NULL) {
+                        // package/name: look for name
+                        addTracedItem(pkg, name, nameLength, listPkg);
+                    }
+                }
+            }
+            start=limit;
+        }
+    }
+    fclose(file);
+    return listPkg;
+}
+
 U_CAPI int U_EXPORT2
 writePackageDatFile(const char *outFilename, const char *outComment, const char *sourcePath, const char *addList, Package *pkg, char outType) {
     LocalPointer<Package> ownedPkg;
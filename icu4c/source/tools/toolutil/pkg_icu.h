@@ -22,4 +22,7 @@ writePackageDatFile(const char *outFilename, const char *outComment,
 U_CAPI icu::Package * U_EXPORT2
 readList(const char *filesPath, const char *listname, UBool readContents, icu::Package *listPkgIn);
 
+U_CAPI icu::Package * U_EXPORT2
+readTraceList(const char *tracename, const icu::Package &pkg, icu::Package *listPkgIn);
+
 #endif
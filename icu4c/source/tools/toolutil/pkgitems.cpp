@@ -369,7 +369,7 @@ static void
 ures_enumDependencies(const char *itemName, const UDataInfo *pInfo,
                       const uint8_t *inBytes, int32_t length,
                       CheckDependency check, void *context,
-                      Package *pkg,
+                      Package *pkg, UBool explicitParents,
                       UErrorCode *pErrorCode) {
     ResourceData resData;
 
@@ -431,6 +431,25 @@ ures_enumDependencies(const char *itemName, const UDataInfo *pInfo,
         }
     }
 
+    /*
+     * The explicit parent locale in %%Parent is only reported on request:
+     * Locale data filtering does not keep such parents, so that
+     * checkDependencies() must not treat them as requirements.
+     */
+    if(explicitParents) {
+        int32_t index;
+        const char *key="%%Parent";
+        Resource parent=res_getTableItemByKey(&resData, resData.rootRes, &index, &key);
+        if(res_getPublicType(parent)==URES_STRING) {
+            int32_t parentLength;
+            const UChar *parentID=res_getStringNoTrace(&resData, parent, &parentLength);
+            checkAlias(itemName, parent, parentID, parentLength, TRUE, check, context, pErrorCode);
+            if(U_FAILURE(*pErrorCode)) {
+                return;
+            }
+        }
+    }
+
     ures_enumDependencies(
         itemName, &resData,
         resData.rootRes, NULL, NULL, 0,
@@ -576,7 +595,7 @@ getDataFormat(const uint8_t dataFormat[4]) {
 // enumerate dependencies of a package item -------------------------------- ***
 
 void
-Package::enumDependencies(Item *pItem, void *context, CheckDependency check) {
+Package::enumDependencies(Item *pItem, void *context, CheckDependency check, UBool explicitParents) {
     int32_t infoLength, itemHeaderLength;
     UErrorCode errorCode=U_ZERO_ERROR;
     const UDataInfo *pInfo=getDataInfo(pItem->data, pItem->length, infoLength, itemHeaderLength, &errorCode);
@@ -596,7 +615,7 @@ Package::enumDependencies(Item *pItem, void *context, CheckDependency check) {
                  * We do not want to duplicate that code, especially not together with on-the-fly swapping.
                  */
                 NativeItem nrb(pItem, ures_swap);
-                ures_enumDependencies(pItem->name, nrb.getDataInfo(), nrb.getBytes(), nrb.getLength(), check, context, this, &errorCode);
+                ures_enumDependencies(pItem->name, nrb.getDataInfo(), nrb.getBytes(), nrb.getLength(), check, context, this, explicitParents, &errorCode);
                 break;
             }
         case FMT_CNV:
@@ -40,6 +40,8 @@
 #include "uassert.h"
 #include "uarrsort.h"
 #include "ucmndata.h"
+#include "cpsnap.h"
+#include "udatacmp.h"
 #include "udataswp.h"
 #include "ulayout_props.h"
 
@@ -60,6 +62,7 @@
 #include "utrie.h"
 #include "utrie2.h"
 #include "dictionarydata.h"
+#include "datacompress.h"
 
 /* swapping implementations in i18n */
 
@@ -741,6 +744,113 @@ ulayout_swap(const UDataSwapper *ds,
     return headerSize + size;
 }
 
+// Character property snapshot data swapping ----------------------------------
+
+static int32_t U_CALLCONV
+cpsnap_swap(const UDataSwapper *ds,
+            const void *inData, int32_t length, void *outData,
+            UErrorCode *pErrorCode) {
+    // udata_swapDataHeader checks the arguments.
+    int32_t headerSize = udata_swapDataHeader(ds, inData, length, outData, pErrorCode);
+    if (pErrorCode == nullptr || U_FAILURE(*pErrorCode)) {
+        return 0;
+    }
+
+    // Check data format and format version.
+    const UDataInfo *pInfo = (const UDataInfo *)((const char *)inData + 4);
+    if (!(
+            pInfo->dataFormat[0] == CPSNAP_FMT_0 &&    // dataFormat="CPSn"
+            pInfo->dataFormat[1] == CPSNAP_FMT_1 &&
+            pInfo->dataFormat[2] == CPSNAP_FMT_2 &&
+            pInfo->dataFormat[3] == CPSNAP_FMT_3 &&
+            pInfo->formatVersion[0] == 1)) {
+        udata_printError(ds,
+            "cpsnap_swap(): data format %02x.%02x.%02x.%02x (format version %02x) "
+            "is not recognized as a character property snapshot\n",
+            pInfo->dataFormat[0], pInfo->dataFormat[1],
+            pInfo->dataFormat[2], pInfo->dataFormat[3],
+            pInfo->formatVersion[0]);
+        *pErrorCode = U_UNSUPPORTED_ERROR;
+        return 0;
+    }
+
+    const uint8_t *inBytes = (const uint8_t *)inData + headerSize;
+    uint8_t *outBytes = (uint8_t *)outData + headerSize;
+
+    const int32_t *inIndexes = (const int32_t *)inBytes;
+
+    if (length >= 0) {
+        length -= headerSize;
+        if (length < CPSNAP_IX_COUNT * 4) {
+            udata_printError(ds,
+                "cpsnap_swap(): too few bytes (%d after header) for a character property snapshot\n",
+                length);
+            *pErrorCode = U_INDEX_OUTOFBOUNDS_ERROR;
+            return 0;
+        }
+    }
+
+    int32_t indexesLength = udata_readInt32(ds, inIndexes[CPSNAP_IX_INDEXES_LENGTH]);
+    int32_t size = udata_readInt32(ds, inIndexes[CPSNAP_IX_LENGTH]);
+    // The inclusions and sets are UnicodeSets, followed by the maps.
+    int32_t setsCount = udata_readInt32(ds, inIndexes[CPSNAP_IX_INCLUSIONS_COUNT]) +
+        udata_readInt32(ds, inIndexes[CPSNAP_IX_SETS_COUNT]);
+    int32_t itemCount = setsCount + udata_readInt32(ds, inIndexes[CPSNAP_IX_MAPS_COUNT]);
+    if (indexesLength < CPSNAP_IX_COUNT || setsCount < 0 || itemCount < setsCount ||
+            size < (indexesLength + itemCount + 1) * 4) {
+        udata_printError(ds,
+            "cpsnap_swap(): malformed indexes for a character property snapshot\n");
+        *pErrorCode = U_INVALID_FORMAT_ERROR;
+        return 0;
+    }
+
+    if (length >= 0) {
+        if (length < size) {
+            udata_printError(ds,
+                "cpsnap_swap(): too few bytes (%d after header) "
+                "for all of the character property snapshot\n",
+                length);
+            *pErrorCode = U_INDEX_OUTOFBOUNDS_ERROR;
+            return 0;
+        }
+
+        // Copy the data for inaccessible bytes.
+        if (inBytes != outBytes) {
+            uprv_memcpy(outBytes, inBytes, size);
+        }
+
+        // Swap the items first, while the item offsets can still be read
+        // if the data is swapped in place.
+        const int32_t *inOffsets = inIndexes + indexesLength;
+        int32_t start = udata_readInt32(ds, inOffsets[0]);
+        for (int32_t i = 0; i < itemCount && U_SUCCESS(*pErrorCode); ++i) {
+            int32_t limit = udata_readInt32(ds, inOffsets[i + 1]);
+            int32_t count = limit - start;
+            if (start < 0 || count < 0 || limit > size) {
+                udata_printError(ds,
+                    "cpsnap_swap(): item %d is out of bounds of the character property snapshot\n",
+                    i);
+                *pErrorCode = U_INVALID_FORMAT_ERROR;
+                return 0;
+            }
+            if (count > 0) {
+                if (i < setsCount) {
+                    // UnicodeSet::serialize() output is an array of uint16_t.
+                    ds->swapArray16(ds, inBytes + start, count & ~1, outBytes + start, pErrorCode);
+                } else {
+                    ucptrie_swap(ds, inBytes + start, count, outBytes + start, pErrorCode);
+                }
+            }
+            start = limit;
+        }
+
+        // Swap the int32_t indexes[] and offsets[].
+        ds->swapArray32(ds, inBytes, (indexesLength + itemCount + 1) * 4, outBytes, pErrorCode);
+    }
+
+    return headerSize + size;
+}
+
 /* Swap 'Test' data from gentest */
 static int32_t U_CALLCONV
 test_swap(const UDataSwapper *ds,
@@ -819,6 +929,8 @@ static const struct {
 #if !UCONFIG_NO_IDNA
     { { 0x53, 0x50, 0x52, 0x50 }, usprep_swap },        /* dataFormat="SPRP" */
 #endif
+    { { UDATA_CMP_FMT_0, UDATA_CMP_FMT_1, UDATA_CMP_FMT_2, UDATA_CMP_FMT_3 },
+                                  udata_swapCompressedItem },  /* dataFormat="Cmpr" */
     /* insert data formats here, descending by expected frequency of occurrence */
     { { 0x55, 0x50, 0x72, 0x6f }, uprops_swap },        /* dataFormat="UPro" */
 
@@ -836,6 +948,9 @@ static const struct {
     { { ULAYOUT_FMT_0, ULAYOUT_FMT_1, ULAYOUT_FMT_2, ULAYOUT_FMT_3 },
                                   ulayout_swap },       // dataFormat="Layo"
 
+    { { CPSNAP_FMT_0, CPSNAP_FMT_1, CPSNAP_FMT_2, CPSNAP_FMT_3 },
+                                  cpsnap_swap },        // dataFormat="CPSn"
+
 #if !UCONFIG_NO_COLLATION
     { { 0x55, 0x43, 0x6f, 0x6c }, ucol_swap },          /* dataFormat="UCol" */
     { { 0x49, 0x6e, 0x76, 0x43 }, ucol_swapInverseUCA },/* dataFormat="InvC" */
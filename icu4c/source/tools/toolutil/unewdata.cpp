@@ -30,16 +30,21 @@ struct UNewDataMemory {
     FileStream *file;
     uint16_t headerSize;
     uint8_t magic1, magic2;
+    /* for udata_createIfChanged(): file is tempFilename, to be copied to filename */
+    UBool onlyIfChanged;
+    char filename[512];
+    char tempFilename[516];
 };
 
-U_CAPI UNewDataMemory * U_EXPORT2
-udata_create(const char *dir, const char *type, const char *name,
-             const UDataInfo *pInfo,
-             const char *comment,
-             UErrorCode *pErrorCode) {
+static UNewDataMemory *
+createData(const char *dir, const char *type, const char *name,
+           const UDataInfo *pInfo,
+           const char *comment,
+           UBool onlyIfChanged,
+           UErrorCode *pErrorCode) {
     UNewDataMemory *pData;
     uint16_t headerSize, commentLength;
-    char filename[512];
+    char *filename;
     uint8_t bytes[16];
     int32_t length;
 
@@ -56,7 +61,9 @@ udata_create(const char *dir, const char *type, const char *name,
         *pErrorCode=U_MEMORY_ALLOCATION_ERROR;
         return NULL;
     }
-    
+    pData->onlyIfChanged=onlyIfChanged;
+    filename=pData->filename;
+
     /* Check that the full path won't be too long */
     length = 0;					/* Start with nothing */
     if(dir != NULL  && *dir !=0)	/* Add directory length if one was given */
@@ -76,7 +83,7 @@ udata_create(const char *dir, const char *type, const char *name,
 
         
      /* LDH buffer Length error check */
-    if(length  > ((int32_t)sizeof(filename) - 1))
+    if(length  > ((int32_t)sizeof(pData->filename) - 1))
     {
    	    *pErrorCode = U_BUFFER_OVERFLOW_ERROR;
    	    uprv_free(pData);
@@ -99,7 +106,13 @@ udata_create(const char *dir, const char *type, const char *name,
         uprv_strcat(filename, ".");
         uprv_strcat(filename, type);
     }
-    pData->file=T_FileStream_open(filename, "wb");
+    if(onlyIfChanged) {
+        uprv_strcpy(pData->tempFilename, filename);
+        uprv_strcat(pData->tempFilename, ".tmp");
+        pData->file=T_FileStream_open(pData->tempFilename, "w+b");
+    } else {
+        pData->file=T_FileStream_open(filename, "wb");
+    }
     if(pData->file==NULL) {
         uprv_free(pData);
         *pErrorCode=U_FILE_ACCESS_ERROR;
@@ -140,6 +153,64 @@ udata_create(const char *dir, const char *type, const char *name,
     return pData;
 }
 
+U_CAPI UNewDataMemory * U_EXPORT2
+udata_create(const char *dir, const char *type, const char *name,
+             const UDataInfo *pInfo,
+             const char *comment,
+             UErrorCode *pErrorCode) {
+    return createData(dir, type, name, pInfo, comment, FALSE, pErrorCode);
+}
+
+U_CAPI UNewDataMemory * U_EXPORT2
+udata_createIfChanged(const char *dir, const char *type, const char *name,
+                      const UDataInfo *pInfo,
+                      const char *comment,
+                      UErrorCode *pErrorCode) {
+    return createData(dir, type, name, pInfo, comment, TRUE, pErrorCode);
+}
+
+/*
+ * Compares the rewound temporary file with the existing output file,
+ * and copies the former over the latter if they differ.
+ */
+static void
+copyIfChanged(FileStream *temp, const char *filename, UErrorCode *pErrorCode) {
+    char tempBytes[4096], oldBytes[4096];
+    int32_t tempLength, oldLength;
+    UBool changed=TRUE;
+
+    FileStream *old=T_FileStream_open(filename, "rb");
+    if(old!=NULL) {
+        changed=FALSE;
+        do {
+            tempLength=T_FileStream_read(temp, tempBytes, (int32_t)sizeof(tempBytes));
+            oldLength=T_FileStream_read(old, oldBytes, (int32_t)sizeof(oldBytes));
+            if(tempLength!=oldLength || uprv_memcmp(tempBytes, oldBytes, tempLength)!=0) {
+                changed=TRUE;
+                break;
+            }
+        } while(tempLength>0);
+        T_FileStream_close(old);
+    }
+    if(!changed) {
+        return;
+    }
+
+    FileStream *out=T_FileStream_open(filename, "wb");
+    if(out==NULL) {
+        *pErrorCode=U_FILE_ACCESS_ERROR;
+        return;
+    }
+    T_FileStream_rewind(temp);
+    while((tempLength=T_FileStream_read(temp, tempBytes, (int32_t)sizeof(tempBytes)))>0) {
+        T_FileStream_write(out, tempBytes, tempLength);
+    }
+    if(T_FileStream_error(out)) {
+        *pErrorCode=U_FILE_ACCESS_ERROR;
+    }
+    T_FileStream_close(out);
+}
+
 U_CAPI uint32_t U_EXPORT2
 udata_finish(UNewDataMemory *pData, UErrorCode *pErrorCode) {
     uint32_t fileLength=0;
@@ -156,8 +227,15 @@ udata_finish(UNewDataMemory *pData, UErrorCode *pErrorCode) {
                 *pErrorCode=U_FILE_ACCESS_ERROR;
             } else {
                 fileLength-=pData->headerSize;
+                if(pData->onlyIfChanged) {
+                    T_FileStream_rewind(pData->file);
+                    copyIfChanged(pData->file, pData->filename, pErrorCode);
+                }
             }
             T_FileStream_close(pData->file);
+            if(pData->onlyIfChanged) {
+                T_FileStream_remove(pData->tempFilename);
+            }
         }
         uprv_free(pData);
     }
@@ -64,6 +64,19 @@ udata_create(const char *dir, const char *type, const char *name,
              const char *comment,
              UErrorCode *pErrorCode);
 
+/**
+ * Like udata_create(), except that udata_finish() writes the file only if
+ * it does not exist yet or if its contents change.
+ * An unchanged file keeps its timestamp, so that build steps which depend
+ * on it need not run again.
+ * The data is collected in a temporary file "name.type.tmp" until udata_finish().
+ */
+U_CAPI UNewDataMemory * U_EXPORT2
+udata_createIfChanged(const char *dir, const char *type, const char *name,
+                      const UDataInfo *pInfo,
+                      const char *comment,
+                      UErrorCode *pErrorCode);
+
 /** @memo Close a newly written binary file. */
 U_CAPI uint32_t U_EXPORT2
 udata_finish(UNewDataMemory *pData, UErrorCode *pErrorCode);
@@ -16,6 +16,8 @@
 
 import com.ibm.icu.impl.ICUBinary.Authenticate;
 import com.ibm.icu.text.RuleBasedBreakIterator;
+import com.ibm.icu.util.CodePointTrie;
+import com.ibm.icu.util.MutableCodePointTrie;
 
 /**
 * <p>Internal class used for Rule Based Break Iterators.</p>
@@ -55,7 +57,10 @@ static public class RBBIStateTable {
         public RBBIStateTable() {
         }
 
-        static RBBIStateTable get(ByteBuffer bytes, int length) throws IOException {
+        /**
+         * Read a state table. Tables with 8-bit rows are allowed only with format version 6 data.
+         */
+        static RBBIStateTable get(ByteBuffer bytes, int length, int formatVersion) throws IOException {
             if (length == 0) {
                 return null;
             }
@@ -67,6 +72,28 @@ static RBBIStateTable get(ByteBuffer bytes, int length) throws IOException {
             This.fRowLen    = bytes.getInt();
             This.fFlags     = bytes.getInt();
             This.fReserved  = bytes.getInt();
+            if ((This.fFlags & RBBI_8BITS_ROWS) != 0) {
+                if (formatVersion < 6) {
+                    throw new IOException("Break iterator Rule data corrupt");
+                }
+                // Widen a table with 8-bit rows to the 16-bit form used at run time in Java.
+                // The accepting and lookahead values are signed, the others unsigned.
+                if (This.fNumStates < 0 || This.fRowLen <= NEXTSTATES ||
+                        (long)This.fNumStates * This.fRowLen > length - 16) {
+                    throw new IOException("Invalid RBBI state table length.");
+                }
+                int numBytes = This.fNumStates * This.fRowLen;
+                This.fTable = new short[numBytes];
+                for (int i = 0; i < numBytes; i++) {
+                    byte b = bytes.get();
+                    int column = i % This.fRowLen;
+                    This.fTable[i] = (column == ACCEPTING || column == LOOKAHEAD) ? b : (short)(b & 0xff);
+                }
+                ICUBinary.skipBytes(bytes, length - 16 - numBytes);
+                This.fRowLen *= 2;
+                This.fFlags &= ~RBBI_8BITS_ROWS;
+                return This;
+            }
             int lengthOfShorts = length - 16;   // length in bytes.
             This.fTable     = ICUBinary.getShorts(bytes, lengthOfShorts / 2, lengthOfShorts & 1);
             return This;
@@ -134,18 +161,29 @@ static public boolean equals(RBBIStateTable left, RBBIStateTable right) {
 
     public RBBIStateTable   fRTable;
 
-    public Trie2   fTrie;
+    public CodePointTrie fTrie;
+    /**
+     * The flag bit in character category values for characters handled by a dictionary.
+     * 0x80 for a trie with 8-bit values, 0x4000 for one with 16-bit values.
+     */
+    public int     fDictBit;
     public String  fRuleSource;
     public int     fStatusTable[];
 
     public static final int DATA_FORMAT = 0x42726b20;     // "Brk "
-    public static final int FORMAT_VERSION = 0x05000000;  // 4.0.0.0
+    public static final int FORMAT_VERSION = 0x06000000;  // 6.0.0.0
+
+    /**
+     * Format version 5 data has the character categories in a Trie2 with 16-bit values.
+     * It is still accepted, and converted to a CodePointTrie when loaded.
+     */
+    private static final int FORMAT_VERSION_5 = 0x05000000;
 
     private static final class IsAcceptable implements Authenticate {
         @Override
         public boolean isDataVersionAcceptable(byte version[]) {
             int intVersion = (version[0] << 24) + (version[1] << 16) + (version[2] << 8) + version[3];
-            return intVersion == FORMAT_VERSION;
+            return intVersion == FORMAT_VERSION || intVersion == FORMAT_VERSION_5;
         }
     }
     private static final IsAcceptable IS_ACCEPTABLE = new IsAcceptable();
@@ -200,6 +238,10 @@ public boolean isDataVersionAcceptable(byte version[]) {
     //
     public final static int      RBBI_LOOKAHEAD_HARD_BREAK = 1;
     public final static int      RBBI_BOF_REQUIRED         = 2;
+    /**
+     * The table has 8-bit rows. Only in format version 6 data; widened to 16 bits when loaded.
+     */
+    public final static int      RBBI_8BITS_ROWS           = 4;
 
     /**
      * Data Header.  A struct-like class with the fields from the RBBI data file header.
@@ -249,6 +291,21 @@ public int getRowIndex(int state){
     RBBIDataWrapper() {
     }
 
+    /**
+     * Copy the character categories of format version 5 data, in a Trie2,
+     * into a CodePointTrie with 16-bit values, as in version 6 data.
+     */
+    private static CodePointTrie trieFromVersion5(Trie2 trie2) {
+        MutableCodePointTrie mutableTrie = new MutableCodePointTrie(0, 0);
+        for (Trie2.Range range : trie2) {
+            if (range.leadSurrogate) {
+                break;
+            }
+            mutableTrie.setRange(range.startCodePoint, range.endCodePoint, range.value);
+        }
+        return mutableTrie.buildImmutable(CodePointTrie.Type.FAST, CodePointTrie.ValueWidth.BITS_16);
+    }
+
     /**
      *  Get an RBBIDataWrapper from an InputStream onto a pre-compiled set
      *  of RBBI rules.
@@ -300,7 +357,7 @@ public static RBBIDataWrapper get(ByteBuffer bytes) throws IOException {
         ICUBinary.skipBytes(bytes, This.fHeader.fFTable - pos);
         pos = This.fHeader.fFTable;
 
-        This.fFTable = RBBIStateTable.get(bytes, This.fHeader.fFTableLen);
+        This.fFTable = RBBIStateTable.get(bytes, This.fHeader.fFTableLen, This.fHeader.fFormatVersion[0]);
         pos += This.fHeader.fFTableLen;
 
         //
@@ -312,7 +369,7 @@ public static RBBIDataWrapper get(ByteBuffer bytes) throws IOException {
         pos = This.fHeader.fRTable;
 
         // Create & fill the table itself.
-        This.fRTable = RBBIStateTable.get(bytes, This.fHeader.fRTableLen);
+        This.fRTable = RBBIStateTable.get(bytes, This.fHeader.fRTableLen, This.fHeader.fFormatVersion[0]);
         pos += This.fHeader.fRTableLen;
 
         //
@@ -330,9 +387,21 @@ public static RBBIDataWrapper get(ByteBuffer bytes) throws IOException {
                                                 //  as we don't go more than 100 bytes past the
                                                 //  past the end of the TRIE.
 
-        This.fTrie = Trie2.createFromSerialized(bytes);  // Deserialize the TRIE, leaving buffer
-                                                //  at an unknown position, preceding the
-                                                //  padding between TRIE and following section.
+        // Deserialize the TRIE, leaving buffer at an unknown position, preceding the
+        //  padding between TRIE and following section.
+        if (This.fHeader.fFormatVersion[0] == 5) {
+            This.fTrie = trieFromVersion5(Trie2.createFromSerialized(bytes));
+        } else {
+            This.fTrie = CodePointTrie.fromBinary(CodePointTrie.Type.FAST, null, bytes);
+        }
+        CodePointTrie.ValueWidth width = This.fTrie.getValueWidth();
+        if (width == CodePointTrie.ValueWidth.BITS_8) {
+            This.fDictBit = 0x80;
+        } else if (width == CodePointTrie.ValueWidth.BITS_16) {
+            This.fDictBit = 0x4000;
+        } else {
+            throw new IOException("Break iterator Rule data has an unexpected trie value width");
+        }
 
         bytes.reset();                          // Move buffer back to marked position at
                                                 //   the start of the serialized TRIE.  Now our
@@ -474,7 +543,7 @@ private void dumpCharCategories(java.io.PrintStream out) {
         out.println("--------------------");
         for (char32 = 0; char32<=0x10ffff; char32++) {
             category = fTrie.get(char32);
-            category &= ~0x4000;            // Mask off dictionary bit.
+            category &= ~fDictBit;          // Mask off dictionary bit.
             if (category < 0 || category > fHeader.fCatCount) {
                 out.println("Error, bad category " + Integer.toHexString(category) +
                         " for char " + Integer.toHexString(char32));
@@ -8,15 +8,16 @@
 */
 package com.ibm.icu.text;
 
+import java.io.ByteArrayOutputStream;
 import java.io.IOException;
 import java.io.OutputStream;
 import java.util.ArrayList;
 import java.util.List;
 
 import com.ibm.icu.impl.Assert;
-import com.ibm.icu.impl.Trie2Writable;
-import com.ibm.icu.impl.Trie2_16;
 import com.ibm.icu.text.RBBIRuleBuilder.IntPair;
+import com.ibm.icu.util.CodePointTrie;
+import com.ibm.icu.util.MutableCodePointTrie;
 
 //
 //  RBBISetBuilder   Handles processing of Unicode Sets from RBBI rules
@@ -125,9 +126,8 @@ void setDictionaryFlag() {
     RBBIRuleBuilder       fRB;             // The RBBI Rule Compiler that owns us.
     RangeDescriptor       fRangeList;      // Head of the linked list of RangeDescriptors
 
-    Trie2Writable         fTrie;           // The mapping TRIE that is the end result of processing
+    CodePointTrie         fTrie;           // The mapping TRIE that is the end result of processing
                                            //  the Unicode Sets.
-    Trie2_16              fFrozenTrie;
 
     // Groups correspond to character categories -
     //       groups of ranges that are in the same original UnicodeSets.
@@ -141,6 +141,12 @@ void setDictionaryFlag() {
 
     static final int    DICT_BIT = 0x4000;
 
+    /**
+     * The dictionary bit in the trie values when the categories fit into
+     * an 8-bit trie, see buildTrie().
+     */
+    static final int    DICT_BIT_8 = 0x80;
+
 
     //------------------------------------------------------------------------
     //
@@ -293,17 +299,24 @@ void buildRanges() {
     void buildTrie() {
         RangeDescriptor rlRange;
 
-        fTrie = new Trie2Writable(0,       //   Initial value for all code points.
-                                  0);      //   Error value for out-of-range input.
+        MutableCodePointTrie mutableTrie = new MutableCodePointTrie(
+                0,       //   Initial value for all code points.
+                0);      //   Error value for out-of-range input.
+        boolean use8Bits = getNumCharCategories() <= DICT_BIT_8;
 
         for (rlRange = fRangeList; rlRange!=null; rlRange=rlRange.fNext) {
-            fTrie.setRange(
+            int value = rlRange.fNum;
+            if (use8Bits && (value & DICT_BIT) != 0) {
+                value = (value & ~DICT_BIT) | DICT_BIT_8;
+            }
+            mutableTrie.setRange(
                     rlRange.fStartChar,     // Range start
                     rlRange.fEndChar,       // Range end (inclusive)
-                    rlRange.fNum,           // value for range
-                    true                    // Overwrite previously written values
+                    value                   // value for range
                     );
         }
+        fTrie = mutableTrie.buildImmutable(CodePointTrie.Type.FAST,
+                use8Bits ? CodePointTrie.ValueWidth.BITS_8 : CodePointTrie.ValueWidth.BITS_16);
     }
 
     /**
@@ -332,11 +345,7 @@ void mergeCategories(IntPair categories) {
     //
     //-----------------------------------------------------------------------------------
     int getTrieSize()  {
-        if (fFrozenTrie == null) {
-            fFrozenTrie = fTrie.toTrie2_16();
-            fTrie = null;
-        }
-        return fFrozenTrie.getSerializedLength();
+        return fTrie.toBinary(new ByteArrayOutputStream());
     }
 
 
@@ -346,12 +355,8 @@ int getTrieSize()  {
     //
     //-----------------------------------------------------------------------------------
     void serializeTrie(OutputStream os) throws IOException {
-        if (fFrozenTrie == null) {
-            fFrozenTrie = fTrie.toTrie2_16();
-            fTrie = null;
-        }
-        fFrozenTrie.serialize(os);
-   }
+        fTrie.toBinary(os);
+    }
 
     //------------------------------------------------------------------------
     //
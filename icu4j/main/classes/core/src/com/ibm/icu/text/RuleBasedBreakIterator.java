@@ -26,10 +26,10 @@
 import com.ibm.icu.impl.ICUBinary;
 import com.ibm.icu.impl.ICUDebug;
 import com.ibm.icu.impl.RBBIDataWrapper;
-import com.ibm.icu.impl.Trie2;
 import com.ibm.icu.lang.UCharacter;
 import com.ibm.icu.lang.UProperty;
 import com.ibm.icu.lang.UScript;
+import com.ibm.icu.util.CodePointTrie;
 
 /**
  * Rule Based Break Iterator
@@ -821,7 +821,8 @@ private int handleNext() {
 
         // caches for quicker access
         CharacterIterator text = fText;
-        Trie2 trie = fRData.fTrie;
+        CodePointTrie trie = fRData.fTrie;
+        int dictBit = fRData.fDictBit;
 
         short[] stateTable  = fRData.fFTable.fTable;
         int initialPosition = fPosition;
@@ -885,10 +886,10 @@ else if (mode == RBBI_RUN) {
                 //    Chars that need to be handled by a dictionary have a flag bit set
                 //    in their category values.
                 //
-                if ((category & 0x4000) != 0)  {
+                if ((category & dictBit) != 0)  {
                     fDictionaryCharCount++;
                     //  And off the dictionary flag bit.
-                    category &= ~0x4000;
+                    category &= ~dictBit;
                 }
 
                 if (TRACE) {
@@ -997,7 +998,7 @@ private int handleSafePrevious(int fromPosition) {
 
         // caches for quicker access
         CharacterIterator text = fText;
-        Trie2 trie = fRData.fTrie;
+        CodePointTrie trie = fRData.fTrie;
         short[] stateTable  = fRData.fRTable.fTable;
 
         CISetIndex32(text, fromPosition);
@@ -1024,7 +1025,7 @@ private int handleSafePrevious(int fromPosition) {
             //
             //  And off the dictionary flag bit. For reverse iteration it is not used.
             category = (short) trie.get(c);
-            category &= ~0x4000;
+            category &= ~fRData.fDictBit;
             if (TRACE) {
                 System.out.print("            " +  RBBIDataWrapper.intToString(text.getIndex(), 5));
                 System.out.print(RBBIDataWrapper.intToHexString(c, 10));
@@ -1214,7 +1215,7 @@ void populateDictionary(int startPos, int endPos,
             category = (short)fRData.fTrie.get(c);
 
             while(true) {
-                while((current = fText.getIndex()) < rangeEnd && (category & 0x4000) == 0) {
+                while((current = fText.getIndex()) < rangeEnd && (category & fRData.fDictBit) == 0) {
                     c = CharacterIteration.next32(fText);    // pre-increment
                     category = (short)fRData.fTrie.get(c);
                 }
@@ -23,6 +23,7 @@
 #include <stdlib.h>
 #include "unicode/utypes.h"
 #include "unicode/localpointer.h"
+#include "unicode/umutablecptrie.h"
 #include "unicode/uniset.h"
 #include "unicode/unistr.h"
 #include "charstr.h"
@@ -47,6 +48,45 @@ void PropsBuilder::writeCSourceFile(const char *, UErrorCode &) {}
 void PropsBuilder::writeJavaSourceFile(const char *, UErrorCode &) {}
 void PropsBuilder::writeBinaryData(const char *, UBool, UErrorCode &) {}
 
+static UBool U_CALLCONV
+setMutableTrieRange(const void *context, UChar32 start, UChar32 end, uint32_t value) {
+    UMutableCPTrie *mutableTrie=(UMutableCPTrie *)context;
+    UErrorCode errorCode=U_ZERO_ERROR;
+    umutablecptrie_setRange(mutableTrie, start, end, value, &errorCode);
+    return U_SUCCESS(errorCode);
+}
+
+UCPTrie *
+buildFastUCPTrie16(const UTrie2 *trie2, UErrorCode &errorCode) {
+    if(U_FAILURE(errorCode)) { return NULL; }
+    LocalUMutableCPTriePointer mutableTrie(
+        umutablecptrie_open(trie2->initialValue, trie2->errorValue, &errorCode));
+    if(U_FAILURE(errorCode)) {
+        fprintf(stderr, "genprops error: umutablecptrie_open() failed - %s\n",
+                u_errorName(errorCode));
+        return NULL;
+    }
+    utrie2_enum(trie2, NULL, setMutableTrieRange, mutableTrie.getAlias());
+    UCPTrie *trie=umutablecptrie_buildImmutable(mutableTrie.getAlias(),
+                                                UCPTRIE_TYPE_FAST, UCPTRIE_VALUE_BITS_16,
+                                                &errorCode);
+    if(U_FAILURE(errorCode)) {
+        fprintf(stderr, "genprops error: umutablecptrie_buildImmutable() failed - %s\n",
+                u_errorName(errorCode));
+        return NULL;
+    }
+    for(UChar32 c=0; c<=0x10ffff; ++c) {
+        if(ucptrie_get(trie, c)!=utrie2_get32(trie2, c)) {
+            fprintf(stderr, "genprops error: UCPTrie value differs from UTrie2 for U+%04lX\n",
+                    (long)c);
+            ucptrie_close(trie);
+            errorCode=U_INTERNAL_PROGRAM_ERROR;
+            return NULL;
+        }
+    }
+    return trie;
+}
+
 enum {
     HELP_H,
     HELP_QUESTION_MARK,
@@ -21,9 +21,11 @@
 
 #include <stdio.h>
 #include "unicode/utypes.h"
+#include "unicode/ucptrie.h"
 #include "unicode/uniset.h"
 #include "ppucd.h"
 #include "unewdata.h"
+#include "utrie2.h"
 
 #define LENGTHOF(array) (int32_t)(sizeof(array)/sizeof((array)[0]))
 
@@ -53,6 +55,12 @@ PropsBuilder *createCasePropsBuilder(UErrorCode &errorCode);
 PropsBuilder *createLayoutPropsBuilder(UErrorCode &errorCode);
 PropsBuilder *createNamesPropsBuilder(UErrorCode &errorCode);
 
+/**
+ * Copies a frozen UTrie2 with 16-bit values into a new fast-type UCPTrie,
+ * for the runtime code which hardcodes the data from the C source file.
+ */
+UCPTrie *buildFastUCPTrie16(const UTrie2 *trie2, UErrorCode &errorCode);
+
 /* global flags */
 extern UBool beVerbose;
 extern UBool beQuiet;